@@ -14,6 +14,8 @@
 #include "vtkDataArray.h"
 #include "vtkPoints.h"
 
+#include <atomic>
+
 namespace fromvtkm
 {
 VTK_ABI_NAMESPACE_BEGIN
@@ -21,6 +23,26 @@ VTK_ABI_NAMESPACE_BEGIN
 namespace
 {
 
+std::atomic<bool> DeviceResidentArrays(false);
+
+// Whether the array should be wrapped instead of transferred to the host.
+template <typename T, typename S>
+bool KeepOnDevice(const vtkm::cont::ArrayHandle<T, S>& handle)
+{
+  if (!DeviceResidentArrays)
+  {
+    return false;
+  }
+  for (const auto& buffer : handle.GetBuffers())
+  {
+    if (!buffer.IsAllocatedOnHost())
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
 struct ArrayConverter
 {
 public:
@@ -52,6 +74,11 @@ public:
     {
       return;
     }
+    if (KeepOnDevice(handle))
+    {
+      this->Data = make_vtkmDataArray(handle);
+      return;
+    }
 
     VTKArrayType* array = VTKArrayType::New();
     array->SetNumberOfComponents(Traits::NUM_COMPONENTS);
@@ -93,6 +120,11 @@ public:
     {
       return;
     }
+    if (KeepOnDevice(handle))
+    {
+      this->Data = make_vtkmDataArray(handle);
+      return;
+    }
 
     VTKArrayType* array = VTKArrayType::New();
     array->SetNumberOfComponents(Traits::NUM_COMPONENTS);
@@ -201,5 +233,15 @@ vtkPoints* Convert(const vtkm::cont::CoordinateSystem& input)
   return points;
 }
 
+void SetDeviceResidentArrays(bool enabled)
+{
+  DeviceResidentArrays = enabled;
+}
+
+bool GetDeviceResidentArrays()
+{
+  return DeviceResidentArrays;
+}
+
 VTK_ABI_NAMESPACE_END
 }
@@ -122,6 +122,16 @@ vtkDataArray* Convert(const vtkm::cont::UnknownArrayHandle& input, const char* n
 VTKACCELERATORSVTKMCORE_EXPORT
 vtkPoints* Convert(const vtkm::cont::CoordinateSystem& input);
 
+/// When enabled, the conversions above wrap the arrays that are not in host memory in a
+/// vtkmDataArray instead of transferring them to the host. The data then stays on the device
+/// when passed to another VTK-m based filter, and is only transferred when accessed through the
+/// vtkDataArray API, e.g. by a VTK filter or a mapper. Disabled by default.
+VTKACCELERATORSVTKMCORE_EXPORT
+void SetDeviceResidentArrays(bool enabled);
+
+VTKACCELERATORSVTKMCORE_EXPORT
+bool GetDeviceResidentArrays();
+
 VTK_ABI_NAMESPACE_END
 }
 
@@ -7,6 +7,7 @@
 #include <vtkmFilterOverrides.h>
 
 #include <vtkNew.h>
+#include <vtkProbeFilter.h>
 
 #include <string>
 
@@ -36,6 +37,7 @@ bool TestOverrides()
             << vtkmFilterOverrides::GetEnabled() << "\n";
 
   TEST_OVERRIDE(vtkContourFilter, vtkmContour)
+  TEST_OVERRIDE(vtkProbeFilter, vtkmProbeFilter)
 
   return true;
 }
@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-FileCopyrightText: Copyright (c) Kitware, Inc.
+// SPDX-FileCopyrightText: Copyright 2012 Sandia Corporation.
+// SPDX-License-Identifier: LicenseRef-BSD-3-Clause-Sandia-USGov
+
+#include "vtkDataArray.h"
+#include "vtkDataSet.h"
+#include "vtkIdTypeArray.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkProbeFilter.h"
+#include "vtkRTAnalyticSource.h"
+#include "vtkmProbeFilter.h"
+
+#include <cmath>
+#include <iostream>
+
+int TestVTKMProbeFilter(int, char*[])
+{
+  vtkNew<vtkRTAnalyticSource> source;
+  source->SetWholeExtent(-10, 10, -10, 10, -10, 10);
+
+  // A plane of points in the source, except for the last row and column which
+  // are outside. No point lies on a cell boundary of the source.
+  vtkNew<vtkImageData> input;
+  input->SetOrigin(-5.25, -5.25, 0.5);
+  input->SetSpacing(1.5, 1.5, 1.0);
+  input->SetDimensions(12, 12, 1);
+
+  vtkNew<vtkProbeFilter> probe;
+  probe->SetInputData(input);
+  probe->SetSourceConnection(source->GetOutputPort());
+  probe->Update();
+
+  vtkNew<vtkmProbeFilter> vtkmProbe;
+  vtkmProbe->SetInputData(input);
+  vtkmProbe->SetSourceConnection(source->GetOutputPort());
+  vtkmProbe->Update();
+
+  vtkPointData* expected = vtkDataSet::SafeDownCast(probe->GetOutput())->GetPointData();
+  vtkPointData* result = vtkDataSet::SafeDownCast(vtkmProbe->GetOutput())->GetPointData();
+  vtkDataArray* expectedMask = expected->GetArray("vtkValidPointMask");
+  vtkDataArray* resultMask = result->GetArray("vtkValidPointMask");
+  vtkDataArray* expectedValues = expected->GetArray("RTData");
+  vtkDataArray* resultValues = result->GetArray("RTData");
+  if (!resultMask || !resultValues)
+  {
+    std::cerr << "Missing output arrays" << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (result->GetScalars() != resultValues)
+  {
+    std::cerr << "The probed scalars should be the active scalars" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  for (vtkIdType i = 0; i < input->GetNumberOfPoints(); ++i)
+  {
+    if (resultMask->GetComponent(i, 0) != expectedMask->GetComponent(i, 0))
+    {
+      std::cerr << "Wrong valid point mask at point " << i << std::endl;
+      return EXIT_FAILURE;
+    }
+    const double value = resultValues->GetComponent(i, 0);
+    const double expectedValue = expectedValues->GetComponent(i, 0);
+    if (!(std::abs(value - expectedValue) < 1e-3))
+    {
+      std::cerr << "Wrong value at point " << i << ": " << value << ", expected "
+                << expectedValue << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (vtkmProbe->GetValidPoints()->GetNumberOfTuples() != 11 * 11)
+  {
+    std::cerr << "Expected " << 11 * 11 << " valid points, got "
+              << vtkmProbe->GetValidPoints()->GetNumberOfTuples() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
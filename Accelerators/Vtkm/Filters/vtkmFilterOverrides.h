@@ -23,6 +23,22 @@ public:
   static void EnabledOn() { vtkmFilterOverrides::SetEnabled(true); }
   static void EnabledOff() { vtkmFilterOverrides::SetEnabled(false); }
   ///@}
+
+  ///@{
+  /**
+   * Runtime enable/disable for device-resident outputs of the VTK-m filters.
+   * When enabled, the output arrays of the VTK-m filters that are in device memory are wrapped
+   * in a vtkmDataArray instead of being transferred to the host, so that consecutive VTK-m filters
+   * do not transfer the data back and forth. The data is transferred to the host only when it is
+   * accessed through the vtkDataArray API, e.g. by a VTK filter or a mapper. Only the point
+   * coordinates and the fields are kept on the device, the cells are always transferred.
+   * Disabled by default.
+   */
+  static void SetDeviceResidentOutputs(bool value);
+  static bool GetDeviceResidentOutputs();
+  static void DeviceResidentOutputsOn() { vtkmFilterOverrides::SetDeviceResidentOutputs(true); }
+  static void DeviceResidentOutputsOff() { vtkmFilterOverrides::SetDeviceResidentOutputs(false); }
+  ///@}
 };
 
 VTK_ABI_NAMESPACE_END
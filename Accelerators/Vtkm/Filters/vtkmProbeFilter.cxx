@@ -0,0 +1,141 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-FileCopyrightText: Copyright (c) Kitware, Inc.
+// SPDX-FileCopyrightText: Copyright 2012 Sandia Corporation.
+// SPDX-License-Identifier: LicenseRef-BSD-3-Clause-Sandia-USGov
+#include "vtkmProbeFilter.h"
+
+#include "vtkCharArray.h"
+#include "vtkDataSet.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkSmartPointer.h"
+
+#include "vtkmlib/ArrayConverters.h"
+#include "vtkmlib/DataSetConverters.h"
+#include "vtkmlib/DataSetUtils.h"
+
+#include <vtkm/cont/ErrorFilterExecution.h>
+#include <vtkm/cont/ErrorUserAbort.h>
+#include <vtkm/filter/resampling/Probe.h>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkmProbeFilter);
+
+//------------------------------------------------------------------------------
+vtkmProbeFilter::vtkmProbeFilter() = default;
+
+//------------------------------------------------------------------------------
+vtkmProbeFilter::~vtkmProbeFilter() = default;
+
+//------------------------------------------------------------------------------
+void vtkmProbeFilter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+}
+
+//------------------------------------------------------------------------------
+bool vtkmProbeFilter::CanProcessInput(vtkDataSet* input, vtkDataSet* source)
+{
+  // VTK-m's probe filter requires the source to have a cell set, and has its own
+  // cell search that cannot be configured.
+  return input && source && source->GetNumberOfCells() > 0 && !this->CategoricalData &&
+    this->ComputeTolerance && !this->SnapToCellWithClosestPoint && !this->CellLocatorPrototype &&
+    !this->FindCellStrategy;
+}
+
+//------------------------------------------------------------------------------
+int vtkmProbeFilter::RequestData(
+  vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  vtkInformation* sourceInfo = inputVector[1]->GetInformationObject(0);
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+
+  vtkDataSet* input = vtkDataSet::SafeDownCast(inInfo->Get(vtkDataObject::DATA_OBJECT()));
+  vtkDataSet* source = vtkDataSet::SafeDownCast(sourceInfo->Get(vtkDataObject::DATA_OBJECT()));
+  vtkDataSet* output = vtkDataSet::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
+
+  if (!this->CanProcessInput(input, source))
+  {
+    return this->Superclass::RequestData(request, inputVector, outputVector);
+  }
+
+  // Copy the input to the output as a starting point
+  output->CopyStructure(input);
+
+  try
+  {
+    vtkm::cont::ScopedRuntimeDeviceTracker rtdt([&]() { return this->CheckAbort(); });
+
+    vtkm::cont::DataSet in = tovtkm::Convert(input);
+    vtkm::cont::DataSet so = tovtkm::Convert(source, tovtkm::FieldsFlag::PointsAndCells);
+
+    // The input in VTK is the geometry in VTKM and the source in VTK is the input
+    // in VTKM.
+    vtkm::filter::resampling::Probe probe;
+    probe.SetGeometry(in);
+    probe.SetInvalidValue(0.0);
+    vtkm::cont::DataSet result = probe.Execute(so);
+
+    // The cell data of the source is probed into point fields, the cell fields
+    // only hold the valid cell mask that vtkProbeFilter does not produce.
+    vtkPointData* outPD = output->GetPointData();
+    for (auto i : GetFieldsIndicesWithoutCoords(result))
+    {
+      const vtkm::cont::Field& field = result.GetField(i);
+      if (field.GetAssociation() != vtkm::cont::Field::Association::Points)
+      {
+        continue;
+      }
+      auto array = vtk::TakeSmartPointer(fromvtkm::Convert(field));
+      if (!array)
+      {
+        throw vtkm::cont::ErrorFilterExecution("Unable to convert the probed field " +
+          field.GetName() + " back to VTK.");
+      }
+      if (field.GetName() != "HIDDEN")
+      {
+        outPD->AddArray(array);
+        continue;
+      }
+
+      // VTK-m marks the hidden points with a non-zero value while vtkProbeFilter
+      // marks the valid points with 1.
+      if (this->MaskPoints)
+      {
+        this->MaskPoints->Delete();
+      }
+      const vtkIdType numPts = array->GetNumberOfTuples();
+      this->MaskPoints = vtkCharArray::New();
+      this->MaskPoints->SetNumberOfComponents(1);
+      this->MaskPoints->SetNumberOfTuples(numPts);
+      this->MaskPoints->SetName(
+        this->ValidPointMaskArrayName ? this->ValidPointMaskArrayName : "vtkValidPointMask");
+      for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+      {
+        this->MaskPoints->SetValue(ptId, array->GetComponent(ptId, 0) == 0 ? 1 : 0);
+      }
+      outPD->AddArray(this->MaskPoints);
+    }
+    fromvtkm::PassAttributesInformation(source->GetPointData(), outPD);
+  }
+  catch (const vtkm::cont::ErrorUserAbort&)
+  {
+    // vtkm detected an abort request, clear the output
+    output->Initialize();
+    return 1;
+  }
+  catch (const vtkm::cont::Error& e)
+  {
+    vtkWarningMacro(<< "VTK-m failed with message: " << e.GetMessage() << "\n"
+                    << "Falling back to the default VTK implementation.");
+    output->Initialize();
+    return this->Superclass::RequestData(request, inputVector, outputVector);
+  }
+
+  this->PassAttributeData(input, source, output);
+  return 1;
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-FileCopyrightText: Copyright (c) Kitware, Inc.
+// SPDX-FileCopyrightText: Copyright 2012 Sandia Corporation.
+// SPDX-License-Identifier: LicenseRef-BSD-3-Clause-Sandia-USGov
+/**
+ * @class   vtkmProbeFilter
+ * @brief   sample data values at specified point locations using VTK-m
+ *
+ * vtkmProbeFilter is a drop-in replacement of vtkProbeFilter that probes the
+ * source with the probe filter of VTK-m. Unlike vtkmProbe, it produces the same
+ * arrays as vtkProbeFilter, including the valid point mask, and can thus be used
+ * as an override of vtkProbeFilter.
+ *
+ * @warning
+ * The options of vtkProbeFilter controlling the cell search (Tolerance when
+ * ComputeTolerance is off, SnapToCellWithClosestPoint, CellLocatorPrototype and
+ * FindCellStrategy) and CategoricalData are not supported by VTK-m. When one of
+ * them is used, this filter falls back to the vtkProbeFilter implementation.
+ *
+ * @sa
+ * vtkProbeFilter vtkmProbe
+ */
+
+#ifndef vtkmProbeFilter_h
+#define vtkmProbeFilter_h
+
+#include "vtkAcceleratorsVTKmFiltersModule.h" //required for correct implementation
+#include "vtkProbeFilter.h"
+#include "vtkmlib/vtkmInitializer.h" // Need for initializing vtk-m
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKACCELERATORSVTKMFILTERS_EXPORT vtkmProbeFilter : public vtkProbeFilter
+{
+public:
+  vtkTypeMacro(vtkmProbeFilter, vtkProbeFilter);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  static vtkmProbeFilter* New();
+
+protected:
+  /// \brief Check if the input dataset and parameters combination is supported by this filter
+  ///
+  /// Certain input and parameters combinations are not currently supported by vtkm.
+  /// This information is internally used to determine if this filter should fall back to
+  /// Superclass implementation.
+  bool CanProcessInput(vtkDataSet* input, vtkDataSet* source);
+
+  vtkmProbeFilter();
+  ~vtkmProbeFilter() override;
+
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
+private:
+  vtkmProbeFilter(const vtkmProbeFilter&) = delete;
+  void operator=(const vtkmProbeFilter&) = delete;
+  vtkmInitializer Initializer;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif // vtkmProbeFilter_h
@@ -125,6 +125,7 @@ set(vtk_cmake_module_files
   Findutf8cpp.cmake
   FindCGNS.cmake
   FindzSpace.cmake
+  FindZstd.cmake
 
   vtkCMakeBackports.cmake
   vtkDetectLibraryType.cmake
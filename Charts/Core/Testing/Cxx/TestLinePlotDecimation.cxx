@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkChartXY.h"
+#include "vtkContextScene.h"
+#include "vtkContextView.h"
+#include "vtkFloatArray.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkPlotLine.h"
+#include "vtkPointData.h"
+#include "vtkRenderWindow.h"
+#include "vtkTable.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkWindowToImageFilter.h"
+
+#include <cmath>
+#include <iostream>
+
+namespace
+{
+void Capture(vtkContextView* view, vtkImageData* image)
+{
+  view->Render();
+  vtkNew<vtkWindowToImageFilter> capture;
+  capture->SetInput(view->GetRenderWindow());
+  capture->ReadFrontBufferOff();
+  capture->Update();
+  image->DeepCopy(capture->GetOutput());
+}
+}
+
+//------------------------------------------------------------------------------
+int TestLinePlotDecimation(int, char*[])
+{
+  vtkNew<vtkContextView> view;
+  view->GetRenderWindow()->SetSize(400, 300);
+  vtkNew<vtkChartXY> chart;
+  view->GetScene()->AddItem(chart);
+
+  // A noisy signal with far more samples than pixel columns.
+  const vtkIdType numberOfPoints = 200000;
+  vtkNew<vtkTable> table;
+  vtkNew<vtkFloatArray> arrX;
+  arrX->SetName("X Axis");
+  arrX->SetNumberOfTuples(numberOfPoints);
+  vtkNew<vtkFloatArray> arrY;
+  arrY->SetName("Signal");
+  arrY->SetNumberOfTuples(numberOfPoints);
+  for (vtkIdType i = 0; i < numberOfPoints; ++i)
+  {
+    const float x = static_cast<float>(i) / 1000.0f;
+    arrX->SetValue(i, x);
+    arrY->SetValue(i, std::sin(x) + 0.3f * std::sin(97.0f * x) * std::cos(13.0f * x));
+  }
+  table->AddColumn(arrX);
+  table->AddColumn(arrY);
+
+  vtkPlotLine* line = vtkPlotLine::SafeDownCast(chart->AddPlot(vtkChart::LINE));
+  line->SetInputData(table, 0, 1);
+  line->SetMarkerStyle(vtkPlotPoints::CIRCLE);
+  line->SetMarkerSize(2.0);
+
+  // Decimating must not change the picture beyond a few pixels.
+  line->DecimationOff();
+  vtkNew<vtkImageData> full;
+  Capture(view, full);
+  line->DecimationOn();
+  vtkNew<vtkImageData> decimated;
+  Capture(view, decimated);
+
+  vtkUnsignedCharArray* fullColors =
+    vtkArrayDownCast<vtkUnsignedCharArray>(full->GetPointData()->GetScalars());
+  vtkUnsignedCharArray* decimatedColors =
+    vtkArrayDownCast<vtkUnsignedCharArray>(decimated->GetPointData()->GetScalars());
+  if (!fullColors || !decimatedColors ||
+    fullColors->GetNumberOfValues() != decimatedColors->GetNumberOfValues())
+  {
+    std::cerr << "Could not capture the chart." << std::endl;
+    return EXIT_FAILURE;
+  }
+  const vtkIdType numberOfPixels = fullColors->GetNumberOfTuples();
+  const int numberOfComponents = fullColors->GetNumberOfComponents();
+  vtkIdType different = 0;
+  for (vtkIdType i = 0; i < numberOfPixels; ++i)
+  {
+    for (int c = 0; c < numberOfComponents; ++c)
+    {
+      if (std::abs(fullColors->GetTypedComponent(i, c) - decimatedColors->GetTypedComponent(i, c)) >
+        32)
+      {
+        ++different;
+        break;
+      }
+    }
+  }
+  if (different > numberOfPixels / 100)
+  {
+    std::cerr << different << " of " << numberOfPixels
+              << " pixels differ between the full and the decimated series." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -81,8 +81,17 @@ bool vtkPlotLine::Paint(vtkContext2D* painter)
   }
   else
   {
-    // draw lines between all points
-    if (this->PolyLine)
+    // draw lines between all points, decimated for large series
+    float* points = nullptr;
+    vtkIdType n = 0;
+    if (this->PolyLine && this->GetLinePointsToDraw(painter, points, n))
+    {
+      if (n > 1)
+      {
+        painter->DrawPoly(points, static_cast<int>(n));
+      }
+    }
+    else if (this->PolyLine)
     {
       painter->DrawPoly(this->Points);
     }
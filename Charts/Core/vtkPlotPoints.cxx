@@ -15,16 +15,22 @@
 #include "vtkImageData.h"
 #include "vtkLookupTable.h"
 #include "vtkMath.h"
+#include "vtkMatrix3x3.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPen.h"
 #include "vtkPoints2D.h"
+#include "vtkSMPTools.h"
 #include "vtkTable.h"
+#include "vtkTransform2D.h"
 #include "vtkUnsignedCharArray.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <limits>
 #include <set>
+#include <utility>
 #include <vector>
 
 // PIMPL for STL vector...
@@ -51,6 +57,281 @@ public:
   }
 };
 
+class vtkPlotPoints::DecimationPIMPL
+{
+public:
+  // Whether the x coordinates of Points are finite and increasing.
+  bool XSorted = false;
+  vtkMTimeType XSortedTime = 0;
+
+  // Line through the first, lowest, highest and last points of each bin.
+  vtkNew<vtkFloatArray> Line;
+  bool LineDecimated = false;
+  double LineBinWidth = 0.0;
+  vtkMTimeType LineTime = 0;
+
+  // First point of each occupied cell.
+  vtkNew<vtkFloatArray> Markers;
+  bool MarkersDecimated = false;
+  double MarkersCellSize[2] = { 0.0, 0.0 };
+  vtkMTimeType MarkersTime = 0;
+
+  bool IsXSorted(const float* points, vtkIdType n, vtkMTimeType pointsTime);
+};
+
+namespace
+{
+// Whether the cached decimation, made for bins of the given size, can be
+// reused with bins of the new size. Tolerates the rounding errors of panning.
+bool SameBinSize(double size, double newSize)
+{
+  return std::abs(newSize - size) <= 1e-3 * std::abs(size);
+}
+
+bool AreXSorted(const float* points, vtkIdType n)
+{
+  if (n == 0 || !std::isfinite(points[0]) || !std::isfinite(points[2 * (n - 1)]))
+  {
+    return false;
+  }
+  std::atomic<bool> sorted(true);
+  vtkSMPTools::For(1, n, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end && sorted; ++i)
+    {
+      if (!(points[2 * i - 2] <= points[2 * i]))
+      {
+        sorted = false;
+      }
+    }
+  });
+  return sorted;
+}
+
+// Split the points, sorted by increasing x, in bins of the given width
+// starting at the first point. Returns false when there would be more than
+// maxNumberOfBins bins, otherwise the points of bin b are in
+// [starts[b], starts[b + 1]).
+bool ComputeBins(const float* points, vtkIdType n, double width, vtkIdType maxNumberOfBins,
+  std::vector<vtkIdType>& starts)
+{
+  const double x0 = points[0];
+  const double lastBin = std::floor((points[2 * (n - 1)] - x0) / width);
+  if (!(lastBin < maxNumberOfBins))
+  {
+    return false;
+  }
+  const vtkIdType numberOfBins = static_cast<vtkIdType>(lastBin) + 1;
+  starts.resize(numberOfBins + 1);
+  vtkSMPTools::For(0, numberOfBins + 1, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType b = begin; b < end; ++b)
+    {
+      // First point whose bin is not before b.
+      vtkIdType lo = 0;
+      vtkIdType hi = n;
+      while (lo < hi)
+      {
+        const vtkIdType mid = lo + (hi - lo) / 2;
+        if (std::floor((points[2 * mid] - x0) / width) < b)
+        {
+          lo = mid + 1;
+        }
+        else
+        {
+          hi = mid;
+        }
+      }
+      starts[b] = lo;
+    }
+  });
+  return true;
+}
+
+// Gather the points whose ids are stored, per bin, at the beginning of the
+// bin range of ids, in output.
+void CompactBins(const float* points, const std::vector<vtkIdType>& starts,
+  const std::vector<vtkIdType>& ids, std::vector<vtkIdType>& counts, vtkFloatArray* output)
+{
+  const vtkIdType numberOfBins = static_cast<vtkIdType>(counts.size());
+  std::vector<vtkIdType> offsets(numberOfBins + 1, 0);
+  for (vtkIdType b = 0; b < numberOfBins; ++b)
+  {
+    offsets[b + 1] = offsets[b] + counts[b];
+  }
+  output->SetNumberOfComponents(2);
+  output->SetNumberOfTuples(offsets[numberOfBins]);
+  float* out = output->GetPointer(0);
+  vtkSMPTools::For(0, numberOfBins, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType b = begin; b < end; ++b)
+    {
+      for (vtkIdType k = 0; k < counts[b]; ++k)
+      {
+        const vtkIdType id = ids[starts[b] + k];
+        out[2 * (offsets[b] + k)] = points[2 * id];
+        out[2 * (offsets[b] + k) + 1] = points[2 * id + 1];
+      }
+    }
+  });
+  output->Modified();
+}
+
+// M4 decimation: keep the first, lowest, highest and last points of each bin.
+bool DecimateLine(const float* points, vtkIdType n, double width, vtkFloatArray* output)
+{
+  std::vector<vtkIdType> starts;
+  if (!ComputeBins(points, n, width, n / 4, starts))
+  {
+    return false;
+  }
+  const vtkIdType numberOfBins = static_cast<vtkIdType>(starts.size()) - 1;
+  std::vector<vtkIdType> ids(n);
+  std::vector<vtkIdType> counts(numberOfBins, 0);
+  vtkSMPTools::For(0, numberOfBins, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType b = begin; b < end; ++b)
+    {
+      const vtkIdType first = starts[b];
+      const vtkIdType last = starts[b + 1] - 1;
+      if (last < first)
+      {
+        continue;
+      }
+      vtkIdType lowest = first;
+      vtkIdType highest = first;
+      for (vtkIdType i = first + 1; i <= last; ++i)
+      {
+        if (points[2 * i + 1] < points[2 * lowest + 1])
+        {
+          lowest = i;
+        }
+        if (points[2 * i + 1] > points[2 * highest + 1])
+        {
+          highest = i;
+        }
+      }
+      vtkIdType kept[4] = { first, std::min(lowest, highest), std::max(lowest, highest), last };
+      vtkIdType* end4 = std::unique(kept, kept + 4);
+      counts[b] = static_cast<vtkIdType>(end4 - kept);
+      std::copy(kept, end4, ids.begin() + first);
+    }
+  });
+  CompactBins(points, starts, ids, counts, output);
+  return true;
+}
+
+// Keep the first point of each cell of the given size.
+bool DecimateMarkers(
+  const float* points, vtkIdType n, const double size[2], vtkFloatArray* output)
+{
+  std::vector<vtkIdType> starts;
+  if (!ComputeBins(points, n, size[0], n / 2, starts))
+  {
+    return false;
+  }
+  const vtkIdType numberOfBins = static_cast<vtkIdType>(starts.size()) - 1;
+  std::vector<vtkIdType> ids(n);
+  std::vector<vtkIdType> counts(numberOfBins, 0);
+  vtkSMPTools::For(0, numberOfBins, [&](vtkIdType begin, vtkIdType end) {
+    std::vector<vtkIdType> firstInCell;
+    std::vector<std::pair<double, vtkIdType>> cells;
+    for (vtkIdType b = begin; b < end; ++b)
+    {
+      const vtkIdType first = starts[b];
+      const vtkIdType last = starts[b + 1];
+      vtkIdType* binIds = ids.data() + first;
+      if (first == last)
+      {
+        continue;
+      }
+      double minCell = std::floor(points[2 * first + 1] / size[1]);
+      double maxCell = minCell;
+      for (vtkIdType i = first + 1; i < last; ++i)
+      {
+        const double cell = std::floor(points[2 * i + 1] / size[1]);
+        minCell = std::min(minCell, cell);
+        maxCell = std::max(maxCell, cell);
+      }
+      if (maxCell - minCell < static_cast<double>(last - first) + 4096.0)
+      {
+        // Few cells: mark the first point of each one in a dense table.
+        firstInCell.assign(static_cast<size_t>(maxCell - minCell) + 1, -1);
+        for (vtkIdType i = first; i < last; ++i)
+        {
+          vtkIdType& cellFirst = firstInCell[static_cast<size_t>(
+            std::floor(points[2 * i + 1] / size[1]) - minCell)];
+          if (cellFirst < 0)
+          {
+            cellFirst = i;
+            binIds[counts[b]++] = i;
+          }
+        }
+        continue;
+      }
+      cells.clear();
+      for (vtkIdType i = first; i < last; ++i)
+      {
+        cells.emplace_back(std::floor(points[2 * i + 1] / size[1]), i);
+      }
+      std::sort(cells.begin(), cells.end());
+      auto uniqueEnd = std::unique(cells.begin(), cells.end(),
+        [](const std::pair<double, vtkIdType>& a, const std::pair<double, vtkIdType>& c) {
+          return a.first == c.first;
+        });
+      for (auto it = cells.begin(); it != uniqueEnd; ++it)
+      {
+        binIds[counts[b]++] = it->second;
+      }
+      std::sort(binIds, binIds + counts[b]);
+    }
+  });
+  vtkIdType total = 0;
+  for (vtkIdType count : counts)
+  {
+    total += count;
+  }
+  if (total > n / 2)
+  {
+    return false;
+  }
+  CompactBins(points, starts, ids, counts, output);
+  return true;
+}
+
+// The size of a pixel of painter in the coordinates of the plot, if the
+// transform is a scaling and translation.
+bool GetPixelSize(vtkContext2D* painter, double size[2], double* transform = nullptr)
+{
+  vtkTransform2D* t = painter->GetTransform();
+  if (!t)
+  {
+    return false;
+  }
+  const double* m = t->GetMatrix()->GetData();
+  if (m[1] != 0.0 || m[3] != 0.0 || m[0] == 0.0 || m[4] == 0.0)
+  {
+    return false;
+  }
+  size[0] = 1.0 / std::abs(m[0]);
+  size[1] = 1.0 / std::abs(m[4]);
+  if (transform)
+  {
+    std::copy(m, m + 9, transform);
+  }
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+bool vtkPlotPoints::DecimationPIMPL::IsXSorted(
+  const float* points, vtkIdType n, vtkMTimeType pointsTime)
+{
+  if (this->XSortedTime != pointsTime)
+  {
+    this->XSorted = AreXSorted(points, n);
+    this->XSortedTime = pointsTime;
+    this->LineTime = this->MarkersTime = 0;
+  }
+  return this->XSorted;
+}
+
 //------------------------------------------------------------------------------
 vtkStandardNewMacro(vtkPlotPoints);
 
@@ -59,6 +340,8 @@ vtkPlotPoints::vtkPlotPoints()
 {
   this->Points = nullptr;
   this->Sorted = nullptr;
+  this->Decimation = true;
+  this->Decimated = new DecimationPIMPL;
   this->BadPoints = nullptr;
   this->ValidPointMask = nullptr;
   this->MarkerStyle = vtkPlotPoints::CIRCLE;
@@ -83,6 +366,7 @@ vtkPlotPoints::~vtkPlotPoints()
     this->Points = nullptr;
   }
   delete this->Sorted;
+  delete this->Decimated;
   if (this->BadPoints)
   {
     this->BadPoints->Delete();
@@ -160,11 +444,20 @@ bool vtkPlotPoints::Paint(vtkContext2D* painter)
     }
     else
     {
-      // draw all of the points
-      const std::uintptr_t cacheIdentifier = reinterpret_cast<std::uintptr_t>(this);
+      // draw all of the points, or one per pixel for large series
       vtkUnsignedCharArray* colorsArray = this->ScalarVisibility ? this->Colors : nullptr;
-      painter->DrawMarkers(
-        this->MarkerStyle, false, this->Points->GetData(), colorsArray, cacheIdentifier);
+      vtkFloatArray* decimated = colorsArray ? nullptr : this->GetMarkerPointsToDraw(painter);
+      if (decimated)
+      {
+        const std::uintptr_t cacheIdentifier = reinterpret_cast<std::uintptr_t>(decimated);
+        painter->DrawMarkers(this->MarkerStyle, false, decimated, nullptr, cacheIdentifier);
+      }
+      else
+      {
+        const std::uintptr_t cacheIdentifier = reinterpret_cast<std::uintptr_t>(this);
+        painter->DrawMarkers(
+          this->MarkerStyle, false, this->Points->GetData(), colorsArray, cacheIdentifier);
+      }
     }
   }
 
@@ -270,6 +563,100 @@ void vtkPlotPoints::CreateSortedPoints()
   }
 }
 
+//------------------------------------------------------------------------------
+bool vtkPlotPoints::GetLinePointsToDraw(vtkContext2D* painter, float*& points, vtkIdType& n)
+{
+  double pixelSize[2];
+  double transform[9];
+  vtkIdType numberOfPoints = this->Points ? this->Points->GetNumberOfPoints() : 0;
+  if (!this->Decimation || numberOfPoints < 2 ||
+    (this->BadPoints && this->BadPoints->GetNumberOfTuples() > 0) ||
+    !GetPixelSize(painter, pixelSize, transform))
+  {
+    return false;
+  }
+
+  DecimationPIMPL* decimated = this->Decimated;
+  float* data = static_cast<float*>(this->Points->GetVoidPointer(0));
+  const vtkMTimeType pointsTime = this->Points->GetMTime();
+  if (!decimated->IsXSorted(data, numberOfPoints, pointsTime))
+  {
+    return false;
+  }
+
+  if (decimated->LineTime != pointsTime || !SameBinSize(decimated->LineBinWidth, pixelSize[0]))
+  {
+    decimated->LineDecimated = DecimateLine(data, numberOfPoints, pixelSize[0], decimated->Line);
+    decimated->LineBinWidth = pixelSize[0];
+    decimated->LineTime = pointsTime;
+  }
+  if (decimated->LineDecimated)
+  {
+    data = decimated->Line->GetPointer(0);
+    numberOfPoints = decimated->Line->GetNumberOfTuples();
+  }
+
+  // Only draw the visible part of the line, plus one point on each side.
+  vtkIdType first = 0;
+  vtkIdType last = numberOfPoints;
+  const int viewportWidth = painter->GetDevice()->GetViewportSize()[0];
+  if (viewportWidth > 0)
+  {
+    double xMin = -transform[2] / transform[0];
+    double xMax = (viewportWidth - transform[2]) / transform[0];
+    if (xMax < xMin)
+    {
+      std::swap(xMin, xMax);
+    }
+    const vtkVector2f* begin = reinterpret_cast<vtkVector2f*>(data);
+    const vtkVector2f* end = begin + numberOfPoints;
+    first = std::lower_bound(begin, end, xMin,
+              [](const vtkVector2f& p, double x) { return p.GetX() < x; }) -
+      begin;
+    last = std::upper_bound(begin, end, xMax,
+             [](double x, const vtkVector2f& p) { return x < p.GetX(); }) -
+      begin;
+    first = std::max<vtkIdType>(first - 1, 0);
+    last = std::min<vtkIdType>(last + 1, numberOfPoints);
+  }
+  points = data + 2 * first;
+  n = last - first;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+vtkFloatArray* vtkPlotPoints::GetMarkerPointsToDraw(vtkContext2D* painter)
+{
+  double pixelSize[2];
+  const vtkIdType numberOfPoints = this->Points ? this->Points->GetNumberOfPoints() : 0;
+  if (!this->Decimation || numberOfPoints < 2 ||
+    (this->BadPoints && this->BadPoints->GetNumberOfTuples() > 0) ||
+    !GetPixelSize(painter, pixelSize))
+  {
+    return nullptr;
+  }
+
+  DecimationPIMPL* decimated = this->Decimated;
+  float* data = static_cast<float*>(this->Points->GetVoidPointer(0));
+  const vtkMTimeType pointsTime = this->Points->GetMTime();
+  if (!decimated->IsXSorted(data, numberOfPoints, pointsTime))
+  {
+    return nullptr;
+  }
+
+  if (decimated->MarkersTime != pointsTime ||
+    !SameBinSize(decimated->MarkersCellSize[0], pixelSize[0]) ||
+    !SameBinSize(decimated->MarkersCellSize[1], pixelSize[1]))
+  {
+    decimated->MarkersDecimated =
+      DecimateMarkers(data, numberOfPoints, pixelSize, decimated->Markers);
+    decimated->MarkersCellSize[0] = pixelSize[0];
+    decimated->MarkersCellSize[1] = pixelSize[1];
+    decimated->MarkersTime = pointsTime;
+  }
+  return decimated->MarkersDecimated ? decimated->Markers.Get() : nullptr;
+}
+
 //------------------------------------------------------------------------------
 vtkIdType vtkPlotPoints::GetNearestPoint(const vtkVector2f& point, const vtkVector2f& tol,
   vtkVector2f* location, vtkIdType* vtkNotUsed(segmentId))
@@ -687,6 +1074,7 @@ void vtkPlotPoints::ReleaseGraphicsCache()
     if (auto device2d = lastPainter->GetDevice())
     {
       device2d->ReleaseCache(reinterpret_cast<std::uintptr_t>(this->SelectedPoints.Get()));
+      device2d->ReleaseCache(reinterpret_cast<std::uintptr_t>(this->Decimated->Markers.Get()));
     }
   }
 }
@@ -963,5 +1351,6 @@ vtkStdString vtkPlotPoints::GetColorArrayName()
 void vtkPlotPoints::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "Decimation: " << this->Decimation << endl;
 }
 VTK_ABI_NAMESPACE_END
@@ -165,6 +165,20 @@ public:
   vtkSetMacro(ValidPointMaskName, vtkStdString);
   ///@}
 
+  ///@{
+  /**
+   * Get/set whether series sorted by increasing x are decimated to the
+   * resolution of the screen before being drawn. The line keeps the first,
+   * last, lowest and highest points of each pixel column (M4 decimation) and
+   * only its visible part is drawn, uncolored markers keep one point per
+   * pixel. The decimated points are computed in parallel and cached until
+   * the zoom level or the data change. The default is true.
+   */
+  vtkGetMacro(Decimation, bool);
+  vtkSetMacro(Decimation, bool);
+  vtkBooleanMacro(Decimation, bool);
+  ///@}
+
   /**
    * Update the internal cache. Returns true if cache was successfully updated. Default does
    * nothing.
@@ -217,6 +231,19 @@ protected:
    */
   void CreateSortedPoints();
 
+  /**
+   * Return in points and n the part of the line through Points to draw with
+   * painter, decimated to one pixel column per bin and clipped to the
+   * viewport, or false when the whole series must be drawn.
+   */
+  bool GetLinePointsToDraw(vtkContext2D* painter, float*& points, vtkIdType& n);
+
+  /**
+   * Return Points decimated to one marker per pixel of painter, or nullptr
+   * when all the markers must be drawn.
+   */
+  vtkFloatArray* GetMarkerPointsToDraw(vtkContext2D* painter);
+
   ///@{
   /**
    * Store a well packed set of XY coordinates for this data series.
@@ -233,6 +260,15 @@ protected:
   VectorPIMPL* Sorted;
   ///@}
 
+  ///@{
+  /**
+   * Decimated points, used to draw large series.
+   */
+  bool Decimation;
+  class DecimationPIMPL;
+  DecimationPIMPL* Decimated;
+  ///@}
+
   /**
    * An array containing the indices of all the "bad points", meaning any x, y
    * pair that has an infinity, -infinity or not a number value.
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 
 #include "SMP/Common/vtkSMPToolsAPI.h"
+#include "vtkLogger.h" // For vtkVLogF
 #include "vtkSMP.h"    // For SMP preprocessor information
 #include "vtkSetGet.h" // For vtkWarningMacro
 
@@ -9,6 +10,7 @@
 #include <cstdlib>   // For std::getenv
 #include <iostream>  // For std::cerr
 #include <string>    // For std::string
+#include <utility>   // For std::move
 
 namespace vtk
 {
@@ -48,6 +50,20 @@ vtkSMPToolsAPI::vtkSMPToolsAPI()
 
   // Set max thread number from env
   this->RefreshNumberOfThread();
+
+  // Enable NUMA awareness from env
+  const char* vtkSMPNUMAAware = std::getenv("VTK_SMP_NUMA_AWARE");
+  if (vtkSMPNUMAAware)
+  {
+    this->SetNUMAAware(std::atoi(vtkSMPNUMAAware) != 0);
+  }
+
+  // Enable profiling from env
+  const char* vtkSMPProfiling = std::getenv("VTK_SMP_PROFILING");
+  if (vtkSMPProfiling)
+  {
+    this->SetProfiling(std::atoi(vtkSMPProfiling) != 0);
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -112,6 +128,7 @@ bool vtkSMPToolsAPI::SetBackend(const char* type)
     return false;
   }
   this->RefreshNumberOfThread();
+  this->RefreshThreadsAffinity();
   return true;
 }
 
@@ -143,6 +160,28 @@ void vtkSMPToolsAPI::RefreshNumberOfThread()
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkSMPToolsAPI::SetNUMAAware(bool isNUMAAware)
+{
+  this->NUMAAware = isNUMAAware;
+  this->RefreshThreadsAffinity();
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPToolsAPI::RefreshThreadsAffinity()
+{
+#if VTK_SMP_ENABLE_STDTHREAD
+  // Only the STDThread backend owns its threads, the thread pool is not created if it is
+  // never pinned.
+  const bool pin = this->NUMAAware && this->ActivatedBackend == BackendType::STDThread;
+  if (pin != this->ThreadsPinned)
+  {
+    vtkSMPThreadPool::GetInstance().SetThreadsAffinity(pin);
+    this->ThreadsPinned = pin;
+  }
+#endif
+}
+
 //------------------------------------------------------------------------------
 int vtkSMPToolsAPI::GetEstimatedNumberOfThreads()
 {
@@ -197,6 +236,43 @@ bool vtkSMPToolsAPI::GetNestedParallelism()
   return false;
 }
 
+//------------------------------------------------------------------------------
+void vtkSMPToolsAPI::SetAdaptiveScheduling(bool isAdaptive)
+{
+  switch (this->ActivatedBackend)
+  {
+    case BackendType::Sequential:
+      this->SequentialBackend->SetAdaptiveScheduling(isAdaptive);
+      break;
+    case BackendType::STDThread:
+      this->STDThreadBackend->SetAdaptiveScheduling(isAdaptive);
+      break;
+    case BackendType::TBB:
+      this->TBBBackend->SetAdaptiveScheduling(isAdaptive);
+      break;
+    case BackendType::OpenMP:
+      this->OpenMPBackend->SetAdaptiveScheduling(isAdaptive);
+      break;
+  }
+}
+
+//------------------------------------------------------------------------------
+bool vtkSMPToolsAPI::GetAdaptiveScheduling()
+{
+  switch (this->ActivatedBackend)
+  {
+    case BackendType::Sequential:
+      return this->SequentialBackend->GetAdaptiveScheduling();
+    case BackendType::STDThread:
+      return this->STDThreadBackend->GetAdaptiveScheduling();
+    case BackendType::TBB:
+      return this->TBBBackend->GetAdaptiveScheduling();
+    case BackendType::OpenMP:
+      return this->OpenMPBackend->GetAdaptiveScheduling();
+  }
+  return false;
+}
+
 //------------------------------------------------------------------------------
 bool vtkSMPToolsAPI::IsParallelScope()
 {
@@ -235,6 +311,71 @@ bool vtkSMPToolsAPI::GetSingleThread()
   }
 }
 
+//------------------------------------------------------------------------------
+std::vector<vtkSMPToolsForStatistics> vtkSMPToolsAPI::GetStatistics()
+{
+  std::lock_guard<std::mutex> lock(this->StatisticsMutex);
+  // oldest records first
+  std::vector<vtkSMPToolsForStatistics> statistics(
+    this->Statistics.begin() + this->NextStatistics, this->Statistics.end());
+  statistics.insert(statistics.end(), this->Statistics.begin(),
+    this->Statistics.begin() + this->NextStatistics);
+  return statistics;
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPToolsAPI::ResetStatistics()
+{
+  std::lock_guard<std::mutex> lock(this->StatisticsMutex);
+  this->Statistics.clear();
+  this->NextStatistics = 0;
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPToolsAPI::SetMaximumNumberOfStatistics(std::size_t maximum)
+{
+  std::vector<vtkSMPToolsForStatistics> statistics = this->GetStatistics();
+  if (statistics.size() > maximum)
+  {
+    statistics.erase(statistics.begin(), statistics.end() - maximum);
+  }
+
+  std::lock_guard<std::mutex> lock(this->StatisticsMutex);
+  this->Statistics.swap(statistics);
+  this->NextStatistics = 0;
+  this->MaximumNumberOfStatistics = maximum;
+}
+
+//------------------------------------------------------------------------------
+std::size_t vtkSMPToolsAPI::GetMaximumNumberOfStatistics()
+{
+  std::lock_guard<std::mutex> lock(this->StatisticsMutex);
+  return this->MaximumNumberOfStatistics;
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPToolsAPI::AddStatistics(vtkSMPToolsForStatistics&& statistics)
+{
+  vtkVLogF(vtkLogger::VERBOSITY_TRACE,
+    "vtkSMPTools::For (%s): %lld items, grain %lld, %lld chunks, %d/%d threads, "
+    "%g s, imbalance %g",
+    statistics.Backend.c_str(), static_cast<long long>(statistics.NumberOfItems),
+    static_cast<long long>(statistics.Grain), static_cast<long long>(statistics.NumberOfChunks),
+    statistics.NumberOfThreads, statistics.NumberOfAvailableThreads, statistics.WallTime,
+    statistics.ImbalanceRatio);
+
+  std::lock_guard<std::mutex> lock(this->StatisticsMutex);
+  if (this->Statistics.size() < this->MaximumNumberOfStatistics)
+  {
+    this->Statistics.push_back(std::move(statistics));
+  }
+  else if (this->MaximumNumberOfStatistics > 0)
+  {
+    this->Statistics[this->NextStatistics] = std::move(statistics);
+    this->NextStatistics = (this->NextStatistics + 1) % this->MaximumNumberOfStatistics;
+  }
+}
+
 VTK_ABI_NAMESPACE_END
 } // namespace smp
 } // namespace detail
@@ -9,9 +9,14 @@
 #include "vtkObject.h"
 #include "vtkSMP.h"
 
+#include <atomic>
+#include <cstddef>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "SMP/Common/vtkSMPToolsImpl.h"
+#include "SMP/Common/vtkSMPToolsProfiler.h"
 #if VTK_SMP_ENABLE_SEQUENTIAL
 #include "SMP/Sequential/vtkSMPToolsImpl.txx"
 #endif
@@ -62,12 +67,42 @@ public:
   //--------------------------------------------------------------------------------
   bool GetNestedParallelism();
 
+  //------------------------------------------------------------------------------
+  void SetAdaptiveScheduling(bool isAdaptive);
+
+  //--------------------------------------------------------------------------------
+  bool GetAdaptiveScheduling();
+
   //--------------------------------------------------------------------------------
   bool IsParallelScope();
 
   //--------------------------------------------------------------------------------
   bool GetSingleThread();
 
+  //--------------------------------------------------------------------------------
+  void SetNUMAAware(bool isNUMAAware);
+
+  //--------------------------------------------------------------------------------
+  bool GetNUMAAware() { return this->NUMAAware; }
+
+  //--------------------------------------------------------------------------------
+  void SetProfiling(bool isProfiling) { this->Profiling = isProfiling; }
+
+  //--------------------------------------------------------------------------------
+  bool GetProfiling() { return this->Profiling; }
+
+  //--------------------------------------------------------------------------------
+  std::vector<vtkSMPToolsForStatistics> GetStatistics();
+
+  //--------------------------------------------------------------------------------
+  void ResetStatistics();
+
+  //--------------------------------------------------------------------------------
+  void SetMaximumNumberOfStatistics(std::size_t maximum);
+
+  //--------------------------------------------------------------------------------
+  std::size_t GetMaximumNumberOfStatistics();
+
   //--------------------------------------------------------------------------------
   int GetInternalDesiredNumberOfThread() { return this->DesiredNumberOfThread; }
 
@@ -92,6 +127,25 @@ public:
   //--------------------------------------------------------------------------------
   template <typename FunctorInternal>
   void For(vtkIdType first, vtkIdType last, vtkIdType grain, FunctorInternal& fi)
+  {
+    if (this->Profiling)
+    {
+      const int numberOfThreads = this->GetEstimatedNumberOfThreads();
+      vtkSMPToolsForRecorder recorder;
+      vtkSMPToolsProfiledFunctor<FunctorInternal> profiled{ fi, recorder };
+      this->DispatchFor(first, last, grain, profiled);
+      this->AddStatistics(
+        recorder.Finish(this->GetBackend(), last - first, grain, numberOfThreads));
+    }
+    else
+    {
+      this->DispatchFor(first, last, grain, fi);
+    }
+  }
+
+  //--------------------------------------------------------------------------------
+  template <typename FunctorInternal>
+  void DispatchFor(vtkIdType first, vtkIdType last, vtkIdType grain, FunctorInternal& fi)
   {
     switch (this->ActivatedBackend)
     {
@@ -216,6 +270,66 @@ public:
     }
   }
 
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+  void InclusiveScan(InputIt inBegin, InputIt inEnd, OutputIt outBegin, BinaryOp& op, T init)
+  {
+    switch (this->ActivatedBackend)
+    {
+      case BackendType::Sequential:
+        this->SequentialBackend->InclusiveScan(inBegin, inEnd, outBegin, op, init);
+        break;
+      case BackendType::STDThread:
+        this->STDThreadBackend->InclusiveScan(inBegin, inEnd, outBegin, op, init);
+        break;
+      case BackendType::TBB:
+        this->TBBBackend->InclusiveScan(inBegin, inEnd, outBegin, op, init);
+        break;
+      case BackendType::OpenMP:
+        this->OpenMPBackend->InclusiveScan(inBegin, inEnd, outBegin, op, init);
+        break;
+    }
+  }
+
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+  void ExclusiveScan(InputIt inBegin, InputIt inEnd, OutputIt outBegin, T init, BinaryOp& op)
+  {
+    switch (this->ActivatedBackend)
+    {
+      case BackendType::Sequential:
+        this->SequentialBackend->ExclusiveScan(inBegin, inEnd, outBegin, init, op);
+        break;
+      case BackendType::STDThread:
+        this->STDThreadBackend->ExclusiveScan(inBegin, inEnd, outBegin, init, op);
+        break;
+      case BackendType::TBB:
+        this->TBBBackend->ExclusiveScan(inBegin, inEnd, outBegin, init, op);
+        break;
+      case BackendType::OpenMP:
+        this->OpenMPBackend->ExclusiveScan(inBegin, inEnd, outBegin, init, op);
+        break;
+    }
+  }
+
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename T, typename BinaryOp>
+  T Reduce(InputIt begin, InputIt end, T init, BinaryOp& op)
+  {
+    switch (this->ActivatedBackend)
+    {
+      case BackendType::Sequential:
+        return this->SequentialBackend->Reduce(begin, end, init, op);
+      case BackendType::STDThread:
+        return this->STDThreadBackend->Reduce(begin, end, init, op);
+      case BackendType::TBB:
+        return this->TBBBackend->Reduce(begin, end, init, op);
+      case BackendType::OpenMP:
+        return this->OpenMPBackend->Reduce(begin, end, init, op);
+    }
+    return init;
+  }
+
   // disable copying
   vtkSMPToolsAPI(vtkSMPToolsAPI const&) = delete;
   void operator=(vtkSMPToolsAPI const&) = delete;
@@ -227,6 +341,12 @@ private:
   //--------------------------------------------------------------------------------
   void RefreshNumberOfThread();
 
+  //--------------------------------------------------------------------------------
+  void RefreshThreadsAffinity();
+
+  //--------------------------------------------------------------------------------
+  void AddStatistics(vtkSMPToolsForStatistics&& statistics);
+
   //--------------------------------------------------------------------------------
   // This operator overload is used to unpack Config parameters and set them
   // in vtkSMPToolsAPI (e.g `*this << config;`)
@@ -236,6 +356,8 @@ private:
     this->Initialize(config.MaxNumberOfThreads);
     this->SetBackend(config.Backend.c_str());
     this->SetNestedParallelism(config.NestedParallelism);
+    this->SetAdaptiveScheduling(config.AdaptiveScheduling);
+    this->SetNUMAAware(config.NUMAAware);
     return *this;
   }
 
@@ -249,6 +371,32 @@ private:
    */
   int DesiredNumberOfThread = 0;
 
+  /**
+   * Pin threads and first touch allocated arrays
+   */
+  bool NUMAAware = false;
+
+  /**
+   * True if the STDThread thread pool has been pinned
+   */
+  bool ThreadsPinned = false;
+
+  /**
+   * Record statistics for each For call
+   */
+  std::atomic<bool> Profiling{ false };
+
+  /**
+   * Statistics recorded while profiling, protected by StatisticsMutex. Once
+   * MaximumNumberOfStatistics records are stored, Statistics is used as a ring
+   * buffer and NextStatistics is the index of the oldest record, overwritten
+   * by the next one.
+   */
+  std::vector<vtkSMPToolsForStatistics> Statistics;
+  std::size_t NextStatistics = 0;
+  std::size_t MaximumNumberOfStatistics = 1024;
+  std::mutex StatisticsMutex;
+
   /**
    * Sequential backend
    */
@@ -58,6 +58,12 @@ public:
   //--------------------------------------------------------------------------------
   bool GetNestedParallelism() { return this->NestedActivated; }
 
+  //--------------------------------------------------------------------------------
+  void SetAdaptiveScheduling(bool isAdaptive) { this->AdaptiveScheduling = isAdaptive; }
+
+  //--------------------------------------------------------------------------------
+  bool GetAdaptiveScheduling() { return this->AdaptiveScheduling; }
+
   //--------------------------------------------------------------------------------
   bool IsParallelScope() { return this->IsParallel; }
 
@@ -89,6 +95,18 @@ public:
   template <typename RandomAccessIterator, typename Compare>
   void Sort(RandomAccessIterator begin, RandomAccessIterator end, Compare comp);
 
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+  void InclusiveScan(InputIt inBegin, InputIt inEnd, OutputIt outBegin, BinaryOp op, T init);
+
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+  void ExclusiveScan(InputIt inBegin, InputIt inEnd, OutputIt outBegin, T init, BinaryOp op);
+
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename T, typename BinaryOp>
+  T Reduce(InputIt begin, InputIt end, T init, BinaryOp op);
+
   //--------------------------------------------------------------------------------
   vtkSMPToolsImpl()
     : NestedActivated(true)
@@ -99,6 +117,7 @@ public:
   //--------------------------------------------------------------------------------
   vtkSMPToolsImpl(const vtkSMPToolsImpl& other)
     : NestedActivated(other.NestedActivated)
+    , AdaptiveScheduling(other.AdaptiveScheduling)
     , IsParallel(other.IsParallel.load())
   {
   }
@@ -107,11 +126,13 @@ public:
   void operator=(const vtkSMPToolsImpl& other)
   {
     this->NestedActivated = other.NestedActivated;
+    this->AdaptiveScheduling = other.AdaptiveScheduling;
     this->IsParallel = other.IsParallel.load();
   }
 
 private:
   bool NestedActivated = false;
+  bool AdaptiveScheduling = false;
   std::atomic<bool> IsParallel{ false };
 };
 
@@ -4,7 +4,10 @@
 #ifndef vtkSMPToolsInternal_h
 #define vtkSMPToolsInternal_h
 
-#include <iterator> // For std::advance
+#include <algorithm> // For std::min
+#include <atomic>    // For std::atomic
+#include <iterator>  // For std::advance
+#include <vector>    // For std::vector
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 namespace vtk
@@ -15,6 +18,50 @@ namespace smp
 {
 VTK_ABI_NAMESPACE_BEGIN
 
+//--------------------------------------------------------------------------------
+// Range shared by the workers of the adaptive scheduling mode (guided
+// self-scheduling). Each worker repeatedly claims the next chunk, whose size is
+// proportional to the remaining work: big chunks are handed out first to limit
+// the overhead, and small ones at the end so that the workers finish together.
+// Since chunks are only claimed when a worker is idle, fast workers naturally
+// take over the work that a static partition would have given to slow ones.
+class GuidedRange
+{
+public:
+  GuidedRange(vtkIdType first, vtkIdType last, int numberOfWorkers)
+    : Current(first)
+    , Last(last)
+    , Divisor(2 * static_cast<vtkIdType>((std::max)(numberOfWorkers, 1)))
+    , MinimumChunkSize((std::max<vtkIdType>)((last - first) / (this->Divisor * 128), 1))
+  {
+  }
+
+  // Claim the next chunk [from, to), return false once the range is drained.
+  bool Next(vtkIdType& from, vtkIdType& to)
+  {
+    vtkIdType current = this->Current.load(std::memory_order_relaxed);
+    while (current < this->Last)
+    {
+      const vtkIdType remaining = this->Last - current;
+      const vtkIdType size =
+        (std::min)((std::max)(remaining / this->Divisor, this->MinimumChunkSize), remaining);
+      if (this->Current.compare_exchange_weak(current, current + size))
+      {
+        from = current;
+        to = current + size;
+        return true;
+      }
+    }
+    return false;
+  }
+
+private:
+  std::atomic<vtkIdType> Current;
+  const vtkIdType Last;
+  const vtkIdType Divisor;
+  const vtkIdType MinimumChunkSize;
+};
+
 template <typename InputIt, typename OutputIt, typename Functor>
 class UnaryTransformCall
 {
@@ -90,6 +137,179 @@ public:
   T operator()(T vtkNotUsed(inValue)) { return Value; }
 };
 
+// Minimum number of values processed by a chunk of a parallel scan or reduction
+const vtkIdType ScanMinimumChunkSize = 1024;
+
+//--------------------------------------------------------------------------------
+// Compute the size of the chunks used by the chunked scan and reduce algorithms, so that
+// there is a few chunks per thread but chunks are not too small.
+inline vtkIdType ComputeScanChunkSize(vtkIdType size, int numberOfThreads)
+{
+  const vtkIdType numberOfChunks =
+    static_cast<vtkIdType>(numberOfThreads > 0 ? numberOfThreads : 1) * 4;
+  const vtkIdType chunkSize = (size + numberOfChunks - 1) / numberOfChunks;
+  return chunkSize > ScanMinimumChunkSize ? chunkSize : ScanMinimumChunkSize;
+}
+
+//--------------------------------------------------------------------------------
+// Reduce each chunk of the input range independently
+template <typename InputIt, typename T, typename BinaryOp>
+class ChunkReduceCall
+{
+  InputIt In;
+  vtkIdType Size;
+  vtkIdType ChunkSize;
+  BinaryOp& Op;
+  std::vector<T>& Sums;
+
+public:
+  ChunkReduceCall(
+    InputIt _in, vtkIdType _size, vtkIdType _chunkSize, BinaryOp& _op, std::vector<T>& _sums)
+    : In(_in)
+    , Size(_size)
+    , ChunkSize(_chunkSize)
+    , Op(_op)
+    , Sums(_sums)
+  {
+  }
+
+  void Execute(vtkIdType begin, vtkIdType end)
+  {
+    for (vtkIdType chunk = begin; chunk < end; ++chunk)
+    {
+      const vtkIdType first = chunk * this->ChunkSize;
+      const vtkIdType last = (std::min)(first + this->ChunkSize, this->Size);
+      InputIt itIn(In);
+      std::advance(itIn, first);
+      T sum = *itIn;
+      ++itIn;
+      for (vtkIdType it = first + 1; it < last; ++it, ++itIn)
+      {
+        sum = this->Op(sum, *itIn);
+      }
+      this->Sums[chunk] = sum;
+    }
+  }
+};
+
+//--------------------------------------------------------------------------------
+// Scan each chunk of the input range, starting from the offset of the chunk
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+class ChunkScanCall
+{
+  InputIt In;
+  OutputIt Out;
+  vtkIdType Size;
+  vtkIdType ChunkSize;
+  BinaryOp& Op;
+  const std::vector<T>& Offsets;
+  bool Inclusive;
+
+public:
+  ChunkScanCall(InputIt _in, OutputIt _out, vtkIdType _size, vtkIdType _chunkSize, BinaryOp& _op,
+    const std::vector<T>& _offsets, bool _inclusive)
+    : In(_in)
+    , Out(_out)
+    , Size(_size)
+    , ChunkSize(_chunkSize)
+    , Op(_op)
+    , Offsets(_offsets)
+    , Inclusive(_inclusive)
+  {
+  }
+
+  void Execute(vtkIdType begin, vtkIdType end)
+  {
+    for (vtkIdType chunk = begin; chunk < end; ++chunk)
+    {
+      const vtkIdType first = chunk * this->ChunkSize;
+      const vtkIdType last = (std::min)(first + this->ChunkSize, this->Size);
+      InputIt itIn(In);
+      OutputIt itOut(Out);
+      std::advance(itIn, first);
+      std::advance(itOut, first);
+      T sum = this->Offsets[chunk];
+      for (vtkIdType it = first; it < last; ++it, ++itIn, ++itOut)
+      {
+        // Read before writing to support in-place scans
+        const T value = *itIn;
+        if (this->Inclusive)
+        {
+          sum = this->Op(sum, value);
+          *itOut = sum;
+        }
+        else
+        {
+          *itOut = sum;
+          sum = this->Op(sum, value);
+        }
+      }
+    }
+  }
+};
+
+//--------------------------------------------------------------------------------
+// Scan algorithm for backends providing a For: reduce each chunk in parallel, scan the
+// chunk sums serially, then scan each chunk in parallel from its offset.
+template <typename Backend, typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+void ChunkedScan(Backend& backend, int numberOfThreads, InputIt inBegin, InputIt inEnd,
+  OutputIt outBegin, T init, BinaryOp& op, bool inclusive)
+{
+  const vtkIdType size = std::distance(inBegin, inEnd);
+  if (size <= 0)
+  {
+    return;
+  }
+
+  const vtkIdType chunkSize = ComputeScanChunkSize(size, numberOfThreads);
+  const vtkIdType numberOfChunks = (size + chunkSize - 1) / chunkSize;
+
+  // The sum of the last chunk is not needed
+  std::vector<T> offsets(numberOfChunks, init);
+  ChunkReduceCall<InputIt, T, BinaryOp> reduce(inBegin, size, chunkSize, op, offsets);
+  backend.For(0, numberOfChunks - 1, 1, reduce);
+
+  T sum = init;
+  for (vtkIdType chunk = 0; chunk < numberOfChunks; ++chunk)
+  {
+    const T chunkSum = offsets[chunk];
+    offsets[chunk] = sum;
+    sum = op(sum, chunkSum);
+  }
+
+  ChunkScanCall<InputIt, OutputIt, T, BinaryOp> scan(
+    inBegin, outBegin, size, chunkSize, op, offsets, inclusive);
+  backend.For(0, numberOfChunks, 1, scan);
+}
+
+//--------------------------------------------------------------------------------
+// Reduce algorithm for backends providing a For: reduce each chunk in parallel then combine
+// the chunk sums serially, in order, so the operation does not need to be commutative.
+template <typename Backend, typename InputIt, typename T, typename BinaryOp>
+T ChunkedReduce(
+  Backend& backend, int numberOfThreads, InputIt begin, InputIt end, T init, BinaryOp& op)
+{
+  const vtkIdType size = std::distance(begin, end);
+  if (size <= 0)
+  {
+    return init;
+  }
+
+  const vtkIdType chunkSize = ComputeScanChunkSize(size, numberOfThreads);
+  const vtkIdType numberOfChunks = (size + chunkSize - 1) / chunkSize;
+
+  std::vector<T> sums(numberOfChunks, init);
+  ChunkReduceCall<InputIt, T, BinaryOp> reduce(begin, size, chunkSize, op, sums);
+  backend.For(0, numberOfChunks, 1, reduce);
+
+  T sum = init;
+  for (const T& chunkSum : sums)
+  {
+    sum = op(sum, chunkSum);
+  }
+  return sum;
+}
+
 VTK_ABI_NAMESPACE_END
 
 } // namespace smp
@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "SMP/Common/vtkSMPToolsProfiler.h"
+
+#include <algorithm> // For std::max, std::find_if
+
+namespace vtk
+{
+namespace detail
+{
+namespace smp
+{
+VTK_ABI_NAMESPACE_BEGIN
+
+//------------------------------------------------------------------------------
+vtkSMPToolsForRecorder::vtkSMPToolsForRecorder()
+  : Start(Clock::now())
+{
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPToolsForRecorder::AddChunk(Clock::time_point start)
+{
+  const double busyTime = std::chrono::duration<double>(Clock::now() - start).count();
+  const std::thread::id threadId = std::this_thread::get_id();
+
+  std::lock_guard<std::mutex> lock(this->Mutex);
+  this->NumberOfChunks++;
+  auto it = std::find_if(this->BusyTimes.begin(), this->BusyTimes.end(),
+    [&threadId](const std::pair<std::thread::id, double>& record)
+    { return record.first == threadId; });
+  if (it == this->BusyTimes.end())
+  {
+    this->BusyTimes.emplace_back(threadId, busyTime);
+  }
+  else
+  {
+    it->second += busyTime;
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkSMPToolsForStatistics vtkSMPToolsForRecorder::Finish(
+  const char* backend, vtkIdType numberOfItems, vtkIdType grain, int numberOfAvailableThreads) const
+{
+  vtkSMPToolsForStatistics statistics;
+  statistics.Backend = backend ? backend : "";
+  statistics.NumberOfItems = numberOfItems;
+  statistics.Grain = grain;
+  statistics.NumberOfChunks = this->NumberOfChunks;
+  statistics.NumberOfThreads = static_cast<int>(this->BusyTimes.size());
+  statistics.NumberOfAvailableThreads =
+    std::max(numberOfAvailableThreads, statistics.NumberOfThreads);
+  statistics.WallTime = std::chrono::duration<double>(Clock::now() - this->Start).count();
+
+  double totalBusyTime = 0.0;
+  double maxBusyTime = 0.0;
+  for (const auto& record : this->BusyTimes)
+  {
+    statistics.ThreadBusyTimes.push_back(record.second);
+    totalBusyTime += record.second;
+    maxBusyTime = std::max(maxBusyTime, record.second);
+  }
+  if (totalBusyTime > 0.0)
+  {
+    statistics.ImbalanceRatio =
+      maxBusyTime * statistics.NumberOfAvailableThreads / totalBusyTime;
+  }
+  return statistics;
+}
+
+VTK_ABI_NAMESPACE_END
+} // namespace smp
+} // namespace detail
+} // namespace vtk
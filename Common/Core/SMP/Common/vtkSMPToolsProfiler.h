@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef vtkSMPToolsProfiler_h
+#define vtkSMPToolsProfiler_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkSystemIncludes.h"
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace vtk
+{
+namespace detail
+{
+namespace smp
+{
+VTK_ABI_NAMESPACE_BEGIN
+
+/**
+ * Statistics recorded for one vtkSMPTools::For call when profiling is enabled.
+ */
+struct VTKCOMMONCORE_EXPORT vtkSMPToolsForStatistics
+{
+  /**
+   * Backend that executed the call.
+   */
+  std::string Backend;
+
+  /**
+   * Size of the range processed by the call.
+   */
+  vtkIdType NumberOfItems = 0;
+
+  /**
+   * Grain requested by the caller, 0 when it was chosen by the backend.
+   */
+  vtkIdType Grain = 0;
+
+  /**
+   * Number of chunks the range was split into.
+   */
+  vtkIdType NumberOfChunks = 0;
+
+  /**
+   * Number of threads available to the call.
+   */
+  int NumberOfAvailableThreads = 0;
+
+  /**
+   * Number of threads that executed at least one chunk.
+   */
+  int NumberOfThreads = 0;
+
+  /**
+   * Wall time of the whole call, in seconds.
+   */
+  double WallTime = 0.0;
+
+  /**
+   * Time spent executing chunks by each participating thread, in seconds.
+   */
+  std::vector<double> ThreadBusyTimes;
+
+  /**
+   * Ratio between the busy time of the busiest thread and the mean busy time
+   * over all available threads. 1 means a perfectly balanced call, larger
+   * values mean that threads were idle while the busiest one finished.
+   */
+  double ImbalanceRatio = 1.0;
+};
+
+/**
+ * Record the chunks executed by one vtkSMPTools::For call. AddChunk() is
+ * thread safe.
+ */
+class VTKCOMMONCORE_EXPORT vtkSMPToolsForRecorder
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  vtkSMPToolsForRecorder();
+
+  /**
+   * Record a chunk that started executing at `start` on the calling thread
+   * and just finished.
+   */
+  void AddChunk(Clock::time_point start);
+
+  /**
+   * Compute the statistics of the call once the For returned.
+   */
+  vtkSMPToolsForStatistics Finish(const char* backend, vtkIdType numberOfItems, vtkIdType grain,
+    int numberOfAvailableThreads) const;
+
+private:
+  Clock::time_point Start;
+  std::mutex Mutex;
+  vtkIdType NumberOfChunks = 0;
+  std::vector<std::pair<std::thread::id, double>> BusyTimes;
+};
+
+/**
+ * Functor wrapper timing each chunk executed by the backend.
+ */
+template <typename FunctorInternal>
+struct vtkSMPToolsProfiledFunctor
+{
+  FunctorInternal& F;
+  vtkSMPToolsForRecorder& Recorder;
+
+  void Execute(vtkIdType first, vtkIdType last)
+  {
+    const auto start = vtkSMPToolsForRecorder::Clock::now();
+    this->F.Execute(first, last);
+    this->Recorder.AddChunk(start);
+  }
+};
+
+VTK_ABI_NAMESPACE_END
+} // namespace smp
+} // namespace detail
+} // namespace vtk
+
+#endif
+/* VTK-HeaderTest-Exclude: vtkSMPToolsProfiler.h */
@@ -73,8 +73,28 @@ bool vtkSMPToolsImpl<BackendType::OpenMP>::GetSingleThread()
 
 //------------------------------------------------------------------------------
 void vtkSMPToolsImplForOpenMP(vtkIdType first, vtkIdType last, vtkIdType grain,
-  ExecuteFunctorPtrType functorExecuter, void* functor, bool nestedActivated)
+  ExecuteFunctorPtrType functorExecuter, void* functor, bool nestedActivated,
+  bool adaptiveScheduling)
 {
+  if (grain <= 0 && adaptiveScheduling)
+  {
+    GuidedRange range(first, last, GetNumberOfThreadsOpenMP());
+    omp_set_nested(nestedActivated);
+#pragma omp single
+    threadIdStack.emplace(omp_get_thread_num());
+#pragma omp parallel
+    {
+      vtkIdType from, to;
+      while (range.Next(from, to))
+      {
+        functorExecuter(functor, from, to - from, last);
+      }
+    }
+#pragma omp single
+    threadIdStack.pop();
+    return;
+  }
+
   if (grain <= 0)
   {
     vtkIdType estimateGrain = (last - first) / (GetNumberOfThreadsOpenMP() * 4);
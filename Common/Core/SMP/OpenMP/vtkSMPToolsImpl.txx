@@ -21,7 +21,8 @@ VTK_ABI_NAMESPACE_BEGIN
 int VTKCOMMONCORE_EXPORT GetNumberOfThreadsOpenMP();
 bool VTKCOMMONCORE_EXPORT GetSingleThreadOpenMP();
 void VTKCOMMONCORE_EXPORT vtkSMPToolsImplForOpenMP(vtkIdType first, vtkIdType last, vtkIdType grain,
-  ExecuteFunctorPtrType functorExecuter, void* functor, bool nestedActivated);
+  ExecuteFunctorPtrType functorExecuter, void* functor, bool nestedActivated,
+  bool adaptiveScheduling);
 
 //--------------------------------------------------------------------------------
 template <typename FunctorInternal>
@@ -55,8 +56,8 @@ void vtkSMPToolsImpl<BackendType::OpenMP>::For(
     // (e.g only the 2 first nested For are in parallel)
     bool fromParallelCode = this->IsParallel.exchange(true);
 
-    vtkSMPToolsImplForOpenMP(
-      first, last, grain, ExecuteFunctorOpenMP<FunctorInternal>, &fi, this->NestedActivated);
+    vtkSMPToolsImplForOpenMP(first, last, grain, ExecuteFunctorOpenMP<FunctorInternal>, &fi,
+      this->NestedActivated, this->AdaptiveScheduling);
 
     // Atomic contortion to achieve this->IsParallel &= fromParallelCode.
     // This compare&exchange basically boils down to:
@@ -127,6 +128,33 @@ void vtkSMPToolsImpl<BackendType::OpenMP>::Sort(
   std::sort(begin, end, comp);
 }
 
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+void vtkSMPToolsImpl<BackendType::OpenMP>::InclusiveScan(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, BinaryOp op, T init)
+{
+  ChunkedScan(*this, GetNumberOfThreadsOpenMP(), inBegin, inEnd, outBegin, init, op, true);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+void vtkSMPToolsImpl<BackendType::OpenMP>::ExclusiveScan(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, T init, BinaryOp op)
+{
+  ChunkedScan(*this, GetNumberOfThreadsOpenMP(), inBegin, inEnd, outBegin, init, op, false);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename T, typename BinaryOp>
+T vtkSMPToolsImpl<BackendType::OpenMP>::Reduce(
+  InputIt begin, InputIt end, T init, BinaryOp op)
+{
+  return ChunkedReduce(*this, GetNumberOfThreadsOpenMP(), begin, end, init, op);
+}
+
 //--------------------------------------------------------------------------------
 template <>
 void vtkSMPToolsImpl<BackendType::OpenMP>::Initialize(int);
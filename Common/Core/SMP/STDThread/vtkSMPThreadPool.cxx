@@ -11,6 +11,11 @@
 #include <future>
 #include <iostream>
 
+#if defined(__linux__)
+#include <pthread.h> // For pthread_setaffinity_np
+#include <sched.h>   // For sched_getaffinity
+#endif
+
 namespace vtk
 {
 namespace detail
@@ -324,6 +329,59 @@ std::size_t vtkSMPThreadPool::ThreadCount() const noexcept
   return this->Threads.size();
 }
 
+bool vtkSMPThreadPool::SetThreadsAffinity(bool pin)
+{
+#if defined(__linux__)
+  // CPUs the process is allowed to run on, threads are either bound to one of them or to all
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  if (sched_getaffinity(0, sizeof(cpu_set_t), &allowed) != 0)
+  {
+    return false;
+  }
+
+  std::vector<int> cpus;
+  for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+  {
+    if (CPU_ISSET(cpu, &allowed))
+    {
+      cpus.push_back(cpu);
+    }
+  }
+  if (cpus.empty())
+  {
+    return false;
+  }
+
+  bool success = true;
+  for (std::size_t i = 0; i < this->Threads.size(); ++i)
+  {
+    cpu_set_t mask;
+    if (pin)
+    {
+      CPU_ZERO(&mask);
+      CPU_SET(cpus[i % cpus.size()], &mask);
+    }
+    else
+    {
+      mask = allowed;
+    }
+    success &= pthread_setaffinity_np(
+                 this->Threads[i]->SystemThread.native_handle(), sizeof(cpu_set_t), &mask) == 0;
+  }
+
+  this->ThreadsPinned = pin && success;
+  return success;
+#else
+  return !pin;
+#endif
+}
+
+bool vtkSMPThreadPool::GetThreadsAffinity() const noexcept
+{
+  return this->ThreadsPinned;
+}
+
 vtkSMPThreadPool::ThreadData* vtkSMPThreadPool::GetCallerThreadData() const noexcept
 {
   for (const auto& threadData : this->Threads)
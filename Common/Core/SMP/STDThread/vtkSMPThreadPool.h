@@ -153,6 +153,22 @@ public:
    */
   std::size_t ThreadCount() const noexcept;
 
+  /**
+   * @brief Pin or unpin the threads of the pool.
+   *
+   * When pinned, the i-th thread of the pool is bound to the i-th core the process is allowed to
+   * run on, so threads do not migrate across NUMA nodes and the memory they touch first stays
+   * local to them. When unpinned, the threads may run on any core allowed for the process.
+   *
+   * Only implemented on Linux, returns false if threads could not be (un)pinned.
+   */
+  bool SetThreadsAffinity(bool pin);
+
+  /**
+   * @brief Returns true if the threads of the pool are pinned to cores.
+   */
+  bool GetThreadsAffinity() const noexcept;
+
 private:
   // static because also used by proxy
   static void RunJob(ThreadData& data, std::size_t jobIndex, std::unique_lock<std::mutex>& lock);
@@ -167,6 +183,7 @@ private:
   std::atomic<bool> Joining{};
   std::vector<std::unique_ptr<ThreadData>> Threads; // Thread pool, fixed size
   std::atomic<std::size_t> NextProxyThreadId{ 1 };
+  bool ThreadsPinned{};
 
 public:
   static vtkSMPThreadPool& GetInstance();
@@ -42,6 +42,24 @@ void vtkSMPToolsImpl<BackendType::STDThread>::For(
   {
     int threadNumber = GetNumberOfThreadsSTDThread();
 
+    if (grain <= 0 && this->AdaptiveScheduling)
+    {
+      GuidedRange range(first, last, threadNumber);
+      auto proxy = vtkSMPThreadPool::GetInstance().AllocateThreads(threadNumber);
+      for (int i = 0; i < threadNumber; ++i)
+      {
+        proxy.DoJob([&fi, &range] {
+          vtkIdType from, to;
+          while (range.Next(from, to))
+          {
+            fi.Execute(from, to);
+          }
+        });
+      }
+      proxy.Join();
+      return;
+    }
+
     if (grain <= 0)
     {
       vtkIdType estimateGrain = (last - first) / (threadNumber * 4);
@@ -115,6 +133,33 @@ void vtkSMPToolsImpl<BackendType::STDThread>::Sort(
   std::sort(begin, end, comp);
 }
 
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+void vtkSMPToolsImpl<BackendType::STDThread>::InclusiveScan(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, BinaryOp op, T init)
+{
+  ChunkedScan(*this, GetNumberOfThreadsSTDThread(), inBegin, inEnd, outBegin, init, op, true);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+void vtkSMPToolsImpl<BackendType::STDThread>::ExclusiveScan(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, T init, BinaryOp op)
+{
+  ChunkedScan(*this, GetNumberOfThreadsSTDThread(), inBegin, inEnd, outBegin, init, op, false);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename T, typename BinaryOp>
+T vtkSMPToolsImpl<BackendType::STDThread>::Reduce(
+  InputIt begin, InputIt end, T init, BinaryOp op)
+{
+  return ChunkedReduce(*this, GetNumberOfThreadsSTDThread(), begin, end, init, op);
+}
+
 //--------------------------------------------------------------------------------
 template <>
 void vtkSMPToolsImpl<BackendType::STDThread>::Initialize(int);
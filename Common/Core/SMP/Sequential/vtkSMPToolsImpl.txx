@@ -5,6 +5,7 @@
 #define SequentialvtkSMPToolsImpl_txx
 
 #include <algorithm> // For std::sort, std::transform, std::fill
+#include <numeric>   // For std::accumulate
 
 #include "SMP/Common/vtkSMPToolsImpl.h"
 #include "SMP/Common/vtkSMPToolsInternal.h" // For common vtk smp class
@@ -93,6 +94,43 @@ void vtkSMPToolsImpl<BackendType::Sequential>::Sort(
   std::sort(begin, end, comp);
 }
 
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+void vtkSMPToolsImpl<BackendType::Sequential>::InclusiveScan(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, BinaryOp op, T init)
+{
+  for (; inBegin != inEnd; ++inBegin, ++outBegin)
+  {
+    init = op(init, *inBegin);
+    *outBegin = init;
+  }
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+void vtkSMPToolsImpl<BackendType::Sequential>::ExclusiveScan(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, T init, BinaryOp op)
+{
+  for (; inBegin != inEnd; ++inBegin, ++outBegin)
+  {
+    // Read before writing to support in-place scans
+    const T value = *inBegin;
+    *outBegin = init;
+    init = op(init, value);
+  }
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename T, typename BinaryOp>
+T vtkSMPToolsImpl<BackendType::Sequential>::Reduce(
+  InputIt begin, InputIt end, T init, BinaryOp op)
+{
+  return std::accumulate(begin, end, init, op);
+}
+
 //--------------------------------------------------------------------------------
 template <>
 void vtkSMPToolsImpl<BackendType::Sequential>::Initialize(int);
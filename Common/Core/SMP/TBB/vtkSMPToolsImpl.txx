@@ -15,6 +15,8 @@
 
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/parallel_scan.h>
 #include <tbb/parallel_sort.h>
 
 #ifdef _MSC_VER
@@ -92,6 +94,141 @@ void ExecuteFunctorTBB(void* functor, vtkIdType first, vtkIdType last, vtkIdType
   }
 }
 
+//--------------------------------------------------------------------------------
+// Body of tbb::parallel_scan. The operation may not have an identity element, so a body
+// created by splitting does not hold any partial sum until it processes values.
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+class ScanBodyTBB
+{
+  InputIt In;
+  OutputIt Out;
+  BinaryOp& Op;
+  bool Inclusive;
+  T Sum;
+  bool HasSum;
+
+public:
+  ScanBodyTBB(InputIt _in, OutputIt _out, BinaryOp& _op, T init, bool _inclusive)
+    : In(_in)
+    , Out(_out)
+    , Op(_op)
+    , Inclusive(_inclusive)
+    , Sum(init)
+    , HasSum(true)
+  {
+  }
+
+  ScanBodyTBB(ScanBodyTBB& other, tbb::split)
+    : In(other.In)
+    , Out(other.Out)
+    , Op(other.Op)
+    , Inclusive(other.Inclusive)
+    , Sum(other.Sum)
+    , HasSum(false)
+  {
+  }
+
+  template <typename Tag>
+  void operator()(const tbb::blocked_range<vtkIdType>& r, Tag tag)
+  {
+    InputIt itIn(In);
+    std::advance(itIn, r.begin());
+    if (tag.is_final_scan())
+    {
+      // The final scan of a range always knows the sum of all the values before it
+      OutputIt itOut(Out);
+      std::advance(itOut, r.begin());
+      for (vtkIdType it = r.begin(); it < r.end(); ++it, ++itIn, ++itOut)
+      {
+        // Read before writing to support in-place scans
+        const T value = *itIn;
+        if (this->Inclusive)
+        {
+          this->Sum = this->Op(this->Sum, value);
+          *itOut = this->Sum;
+        }
+        else
+        {
+          *itOut = this->Sum;
+          this->Sum = this->Op(this->Sum, value);
+        }
+      }
+    }
+    else
+    {
+      for (vtkIdType it = r.begin(); it < r.end(); ++it, ++itIn)
+      {
+        this->Sum = this->HasSum ? this->Op(this->Sum, *itIn) : static_cast<T>(*itIn);
+        this->HasSum = true;
+      }
+    }
+  }
+
+  void reverse_join(ScanBodyTBB& left)
+  {
+    if (left.HasSum)
+    {
+      this->Sum = this->HasSum ? this->Op(left.Sum, this->Sum) : left.Sum;
+      this->HasSum = true;
+    }
+  }
+
+  void assign(ScanBodyTBB& other)
+  {
+    this->Sum = other.Sum;
+    this->HasSum = other.HasSum;
+  }
+};
+
+//--------------------------------------------------------------------------------
+// Body of tbb::parallel_reduce, see ScanBodyTBB for the meaning of HasSum.
+template <typename InputIt, typename T, typename BinaryOp>
+class ReduceBodyTBB
+{
+  InputIt In;
+  BinaryOp& Op;
+
+public:
+  T Sum;
+  bool HasSum;
+
+  ReduceBodyTBB(InputIt _in, BinaryOp& _op, T init)
+    : In(_in)
+    , Op(_op)
+    , Sum(init)
+    , HasSum(true)
+  {
+  }
+
+  ReduceBodyTBB(ReduceBodyTBB& other, tbb::split)
+    : In(other.In)
+    , Op(other.Op)
+    , Sum(other.Sum)
+    , HasSum(false)
+  {
+  }
+
+  void operator()(const tbb::blocked_range<vtkIdType>& r)
+  {
+    InputIt itIn(In);
+    std::advance(itIn, r.begin());
+    for (vtkIdType it = r.begin(); it < r.end(); ++it, ++itIn)
+    {
+      this->Sum = this->HasSum ? this->Op(this->Sum, *itIn) : static_cast<T>(*itIn);
+      this->HasSum = true;
+    }
+  }
+
+  void join(ReduceBodyTBB& right)
+  {
+    if (right.HasSum)
+    {
+      this->Sum = this->HasSum ? this->Op(this->Sum, right.Sum) : right.Sum;
+      this->HasSum = true;
+    }
+  }
+};
+
 //--------------------------------------------------------------------------------
 template <>
 template <typename FunctorInternal>
@@ -178,6 +315,39 @@ void vtkSMPToolsImpl<BackendType::TBB>::Sort(
   tbb::parallel_sort(begin, end, comp);
 }
 
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+void vtkSMPToolsImpl<BackendType::TBB>::InclusiveScan(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, BinaryOp op, T init)
+{
+  const vtkIdType size = std::distance(inBegin, inEnd);
+  ScanBodyTBB<InputIt, OutputIt, T, BinaryOp> body(inBegin, outBegin, op, init, true);
+  tbb::parallel_scan(tbb::blocked_range<vtkIdType>(0, size, ScanMinimumChunkSize), body);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+void vtkSMPToolsImpl<BackendType::TBB>::ExclusiveScan(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, T init, BinaryOp op)
+{
+  const vtkIdType size = std::distance(inBegin, inEnd);
+  ScanBodyTBB<InputIt, OutputIt, T, BinaryOp> body(inBegin, outBegin, op, init, false);
+  tbb::parallel_scan(tbb::blocked_range<vtkIdType>(0, size, ScanMinimumChunkSize), body);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename T, typename BinaryOp>
+T vtkSMPToolsImpl<BackendType::TBB>::Reduce(InputIt begin, InputIt end, T init, BinaryOp op)
+{
+  const vtkIdType size = std::distance(begin, end);
+  ReduceBodyTBB<InputIt, T, BinaryOp> body(begin, op, init);
+  tbb::parallel_reduce(tbb::blocked_range<vtkIdType>(0, size, ScanMinimumChunkSize), body);
+  return body.Sum;
+}
+
 //--------------------------------------------------------------------------------
 template <>
 void vtkSMPToolsImpl<BackendType::TBB>::Initialize(int);
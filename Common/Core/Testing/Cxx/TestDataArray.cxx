@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkDoubleArray.h"
+#include "vtkIdTypeArray.h"
 #include "vtkIntArray.h"
 #include "vtkMathUtilities.h"
 
@@ -16,6 +17,7 @@
 #include <iostream>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace TestDataArrayPrivate
 {
@@ -179,6 +181,38 @@ int TestDataArray(int, char*[])
   }
   farray->Delete();
 
+  // Multi-component ranges, with NaN leading values and ghosts
+  farray = vtkDoubleArray::New();
+  farray->SetNumberOfComponents(2);
+  farray->InsertNextTuple2(vtkMath::Nan(), vtkMath::Nan());
+  for (cc = 0; cc < 10; cc++)
+  {
+    farray->InsertNextTuple2(cc, -cc);
+  }
+  farray->InsertNextTuple2(vtkMath::Inf(), 100.0);
+  std::vector<unsigned char> ghosts(farray->GetNumberOfTuples(), 0);
+  ghosts[10] = ghosts[11] = 1;
+  double range1[2];
+  farray->GetRange(range, 0);
+  farray->GetFiniteRange(range1, 1);
+  if (range[0] != 0.0 || range[1] != vtkMath::Inf() || range1[0] != -9.0 || range1[1] != 100.0)
+  {
+    cerr << "Wrong multi-component ranges (" << range[0] << "-" << range[1] << ", " << range1[0]
+         << "-" << range1[1] << ")" << std::endl;
+    farray->Delete();
+    return 1;
+  }
+  farray->GetRange(range, 0, ghosts.data(), 1);
+  farray->GetFiniteRange(range1, 1, ghosts.data(), 1);
+  if (range[0] != 0.0 || range[1] != 8.0 || range1[0] != -8.0 || range1[1] != 0.0)
+  {
+    cerr << "Wrong multi-component ranges skipping ghosts (" << range[0] << "-" << range[1] << ", "
+         << range1[0] << "-" << range1[1] << ")" << std::endl;
+    farray->Delete();
+    return 1;
+  }
+  farray->Delete();
+
   farray = vtkDoubleArray::New();
   farray->SetNumberOfComponents(3);
   for (cc = 0; cc < 10; cc++)
@@ -210,6 +244,63 @@ int TestDataArray(int, char*[])
   }
   cout << endl;
   farray->Delete();
+
+  // Partial modifications
+  farray = vtkDoubleArray::New();
+  farray->SetNumberOfComponents(2);
+  farray->SetNumberOfTuples(20000);
+  for (cc = 0; cc < 20000; ++cc)
+  {
+    farray->SetTuple2(cc, cc, -cc);
+  }
+  farray->Modified();
+  vtkIdTypeArray* modified = vtkIdTypeArray::New();
+  if (farray->GetModifiedTupleRanges(farray->GetMTime(), modified))
+  {
+    cerr << "Modified ranges should not be available without ModifiedTuples()." << endl;
+    farray->Delete();
+    modified->Delete();
+    return 1;
+  }
+  farray->ModifiedTuples(0, 1);
+  farray->GetRange(range, 1);
+  vtkMTimeType since = farray->GetMTime();
+  farray->SetTuple2(19999, 0.5, -0.5);
+  farray->ModifiedTuples(19999, 20000);
+  farray->SetTuple2(5000, -3.0, 3.0);
+  farray->SetTuple2(5001, 25000.0, 3.0);
+  farray->ModifiedTuples(5001, 6000);
+  farray->ModifiedTuples(5000, 5002);
+  if (!farray->GetModifiedTupleRanges(since, modified) || modified->GetNumberOfTuples() != 2 ||
+    modified->GetValue(0) != 5000 || modified->GetValue(1) != 6000 ||
+    modified->GetValue(2) != 19999 || modified->GetValue(3) != 20000)
+  {
+    cerr << "Wrong modified tuple ranges." << endl;
+    farray->Delete();
+    modified->Delete();
+    return 1;
+  }
+  farray->GetRange(range, 0);
+  farray->GetRange(range1, 1);
+  if (range[0] != -3.0 || range[1] != 25000.0 || range1[0] != -19998.0 || range1[1] != 3.0)
+  {
+    cerr << "Wrong range after partial modifications: " << range[0] << " " << range[1] << " "
+         << range1[0] << " " << range1[1] << endl;
+    farray->Delete();
+    modified->Delete();
+    return 1;
+  }
+  since = farray->GetMTime();
+  farray->Modified();
+  if (farray->GetModifiedTupleRanges(since, modified))
+  {
+    cerr << "Modified ranges should not be available after Modified()." << endl;
+    farray->Delete();
+    modified->Delete();
+    return 1;
+  }
+  farray->Delete();
+  modified->Delete();
   return 0;
 }
 
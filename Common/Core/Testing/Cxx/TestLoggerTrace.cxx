@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Test the trace of vtkLogger scopes and its Chrome trace output.
+
+#include "vtkLogger.h"
+#include "vtkSMPTools.h"
+#include "vtkTestUtilities.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+std::size_t CountOccurrences(const std::string& text, const std::string& pattern)
+{
+  std::size_t count = 0;
+  for (std::size_t pos = text.find(pattern); pos != std::string::npos;
+       pos = text.find(pattern, pos + pattern.size()))
+  {
+    ++count;
+  }
+  return count;
+}
+
+std::string ReadFile(const std::string& path)
+{
+  std::ifstream file(path);
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  return buffer.str();
+}
+}
+
+int TestLoggerTrace(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string path = std::string(tempDir) + "/TestLoggerTrace.json";
+  delete[] tempDir;
+
+  // not traced
+  vtkLogger::TraceBegin("not-traced");
+  vtkLogger::TraceEnd();
+
+  vtkLogger::StartTracing(1024);
+  vtkLogger::SetThreadName("trace main thread");
+  vtkLogger::TraceBegin("outer \"quoted\"");
+  vtkSMPTools::For(0, 100, 10, [](vtkIdType, vtkIdType) {
+    vtkLogger::TraceBegin("smp-chunk");
+    vtkLogger::TraceEnd();
+  });
+  vtkLogger::TraceComplete("gpu-event", vtkLogger::GetTraceTime(), 0.001, "GPU");
+  vtkLogger::TraceEnd();
+  vtkLogger::StopTracing();
+  vtkLogger::TraceBegin("not-traced");
+  vtkLogger::TraceEnd();
+  if (vtkLogger::IsTracing() || !vtkLogger::WriteTrace(path.c_str()))
+  {
+    std::cerr << "Could not write " << path << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::string trace = ReadFile(path);
+  if (trace.find("\"traceEvents\"") == std::string::npos ||
+    trace.find("\"trace main thread\"") == std::string::npos ||
+    trace.find("\"outer \\\"quoted\\\"\"") == std::string::npos ||
+    trace.find("\"GPU\"") == std::string::npos ||
+    trace.find("\"gpu-event\"") == std::string::npos ||
+    trace.find("not-traced") != std::string::npos)
+  {
+    std::cerr << "Missing or unexpected events in the trace:\n" << trace << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (CountOccurrences(trace, "\"smp-chunk\"") != 10)
+  {
+    std::cerr << "Expected an event for each of the 10 vtkSMPTools chunks:\n"
+              << trace << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // the ring buffer keeps the last events, and restarting clears the events
+  vtkLogger::StartTracing(10);
+  for (int i = 0; i < 100; ++i)
+  {
+    vtkLogger::TraceBegin(i < 95 ? "dropped" : "kept");
+    vtkLogger::TraceEnd();
+  }
+  vtkLogger::StopTracing();
+  if (!vtkLogger::WriteTrace(path.c_str()))
+  {
+    std::cerr << "Could not write " << path << std::endl;
+    return EXIT_FAILURE;
+  }
+  trace = ReadFile(path);
+  if (CountOccurrences(trace, "\"kept\"") != 5 || CountOccurrences(trace, "\"ph\": \"E\"") != 5 ||
+    trace.find("dropped") != std::string::npos || trace.find("smp-chunk") != std::string::npos)
+  {
+    std::cerr << "Expected the last 10 events only:\n" << trace << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
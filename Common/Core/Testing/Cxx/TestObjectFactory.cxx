@@ -10,6 +10,8 @@
 #include "vtkPoints.h"
 #include "vtkVersion.h"
 
+#include <sstream>
+
 static int failed = 0;
 
 class vtkTestPoints : public vtkPoints
@@ -71,6 +73,31 @@ TestFactory::TestFactory()
     vtkObjectFactoryCreatevtkTestPoints2);
 }
 
+// A factory registering its overrides lazily, as the generated factories do.
+class VTK_EXPORT LazyTestFactory : public vtkObjectFactory
+{
+public:
+  static LazyTestFactory* New()
+  {
+    LazyTestFactory* f = new LazyTestFactory;
+    f->InitializeObjectBase();
+    return f;
+  }
+  const char* GetVTKSourceVersion() override { return VTK_SOURCE_VERSION; }
+  const char* GetDescription() override { return "A lazy Test Factory"; }
+
+protected:
+  LazyTestFactory() = default;
+  void RegisterOverrides() override
+  {
+    this->RegisterOverride("vtkPoints", "vtkTestPoints2", "lazy test vertex factory override", 1,
+      vtkObjectFactoryCreatevtkTestPoints2);
+  }
+
+  LazyTestFactory(const LazyTestFactory&) = delete;
+  LazyTestFactory& operator=(const LazyTestFactory&) = delete;
+};
+
 void TestNewPoints(vtkPoints* v, const char* expectedClassName)
 {
   if (strcmp(v->GetClassName(), expectedClassName) != 0)
@@ -165,6 +192,36 @@ int TestObjectFactory(int, char*[])
     failed = 1;
   }
   oic->Delete();
+
+  // The overrides of a lazy factory are registered on its first query.
+  factory->Disable("vtkPoints");
+  LazyTestFactory* lazyFactory = LazyTestFactory::New();
+  vtkObjectFactory::RegisterFactory(lazyFactory);
+  lazyFactory->Delete();
+  std::ostringstream report;
+  vtkObjectFactory::PrintRegistrationReport(report);
+  if (report.str().find("A lazy Test Factory overrides pending registration") ==
+    std::string::npos)
+  {
+    cout << "failed: the lazy factory should not be initialized yet:\n" << report.str();
+    failed = 1;
+  }
+  v = vtkPoints::New();
+  TestNewPoints(v, "vtkTestPoints2");
+  v->Delete();
+  if (lazyFactory->GetNumberOfOverrides() != 1 || lazyFactory->GetRegistrationTime() < 0.0)
+  {
+    cout << "failed: the lazy factory should have 1 registered override\n";
+    failed = 1;
+  }
+  report.str("");
+  vtkObjectFactory::PrintRegistrationReport(report);
+  if (report.str().find("A lazy Test Factory 1 overrides registered") == std::string::npos)
+  {
+    cout << "failed: the lazy factory should be reported as initialized:\n" << report.str();
+    failed = 1;
+  }
+
   vtkObjectFactory::UnRegisterAllFactories();
   return failed;
 }
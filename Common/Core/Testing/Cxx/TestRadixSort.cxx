@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkRadixSort.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+template <typename T>
+bool CheckSorted(const char* name, const std::vector<T>& keys, const std::vector<vtkIdType>& ids,
+  bool descending)
+{
+  // Stable reference: std::stable_sort of the identity
+  std::vector<vtkIdType> expected(keys.size());
+  std::iota(expected.begin(), expected.end(), 0);
+  std::stable_sort(expected.begin(), expected.end(),
+    [&](vtkIdType l, vtkIdType r) { return descending ? keys[r] < keys[l] : keys[l] < keys[r]; });
+  if (ids != expected)
+  {
+    std::cerr << "Wrong " << (descending ? "descending" : "ascending") << " order for " << name
+              << " keys." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+template <typename T>
+bool TestKeys(const char* name, const std::vector<T>& keys)
+{
+  bool ok = true;
+  for (bool descending : { false, true })
+  {
+    std::vector<vtkIdType> ids(keys.size());
+    std::iota(ids.begin(), ids.end(), 0);
+    vtkRadixSort::SortIdsByKey(keys.data(), ids.data(), static_cast<vtkIdType>(ids.size()),
+      descending);
+    ok &= CheckSorted(name, keys, ids, descending);
+
+    // Resorting the identity exercises both the insertion sort, for short
+    // inputs, and the fallback to the radix sort.
+    std::iota(ids.begin(), ids.end(), 0);
+    vtkRadixSort::ResortIdsByKey(keys.data(), ids.data(), static_cast<vtkIdType>(ids.size()),
+      descending);
+    ok &= CheckSorted(name, keys, ids, descending);
+  }
+  return ok;
+}
+}
+
+int TestRadixSort(int, char*[])
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(1);
+
+  bool ok = true;
+  for (vtkIdType n : { 0, 1, 7, 1000, 100000 })
+  {
+    std::vector<float> floats(n);
+    std::vector<double> doubles(n);
+    std::vector<int> ints(n);
+    std::vector<unsigned short> ushorts(n);
+    for (vtkIdType i = 0; i < n; ++i)
+    {
+      // Few distinct values so that the stability is checked too
+      const double value = random->GetNextRangeValue(-100.0, 100.0);
+      floats[i] = static_cast<float>(static_cast<int>(value) / 4);
+      doubles[i] = value;
+      ints[i] = static_cast<int>(value * 1000);
+      ushorts[i] = static_cast<unsigned short>(value + 100.0);
+    }
+    ok &= TestKeys("float", floats);
+    ok &= TestKeys("double", doubles);
+    ok &= TestKeys("int", ints);
+    ok &= TestKeys("unsigned short", ushorts);
+  }
+
+  // Special floating point values
+  std::vector<double> special = { 0.0, -0.0, 1e-300, -1e-300, 1e300, -1e300, 2.5, -2.5 };
+  ok &= TestKeys("special double", special);
+
+  // A slightly perturbed order, as after a small camera motion
+  std::vector<float> depths(50000);
+  for (size_t i = 0; i < depths.size(); ++i)
+  {
+    depths[i] = static_cast<float>(i) + static_cast<float>(random->GetNextRangeValue(-2.0, 2.0));
+  }
+  std::vector<vtkIdType> ids(depths.size());
+  std::iota(ids.begin(), ids.end(), 0);
+  vtkRadixSort::ResortIdsByKey(depths.data(), ids.data(), static_cast<vtkIdType>(ids.size()));
+  ok &= CheckSorted("perturbed float", depths, ids, false);
+
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -5,13 +5,19 @@
 #include "vtkObject.h"
 #include "vtkObjectFactory.h"
 #include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalArena.h"
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <cstdlib>
 #include <deque>
 #include <functional>
 #include <numeric>
 #include <set>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 static const int Target = 10000;
@@ -479,6 +485,269 @@ int doTestSMP()
       return EXIT_FAILURE;
     }
   }
+
+  // Test thread local arena: per batch scratch buffers, recycled with Reset
+  {
+    vtkSMPThreadLocalArena arena(1024);
+    vtkSMPThreadLocal<int> arenaErrors(0);
+    vtkSMPTools::For(0, Target, 100, [&](vtkIdType begin, vtkIdType end) {
+      arena.Reset();
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        const std::size_t size = static_cast<std::size_t>(i % 300) + 1;
+        vtkIdType* ids = arena.Allocate<vtkIdType>(size);
+        if (reinterpret_cast<std::uintptr_t>(ids) % alignof(vtkIdType) != 0)
+        {
+          arenaErrors.Local()++;
+        }
+        std::fill(ids, ids + size, i);
+        if (std::accumulate(ids, ids + size, vtkIdType(0)) != i * static_cast<vtkIdType>(size))
+        {
+          arenaErrors.Local()++;
+        }
+      }
+    });
+    total = 0;
+    for (const auto& el : arenaErrors)
+    {
+      total += el;
+    }
+    if (total != 0 || arena.GetCapacity() == 0)
+    {
+      cerr << "Error: on vtkSMPThreadLocalArena, got " << total << " invalid allocations" << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Test adaptive scheduling: every item must be processed exactly once
+  {
+    vtkSMPTools::Config adaptiveConfig;
+    adaptiveConfig.AdaptiveScheduling = true;
+    std::vector<int> visits(Target, 0);
+    bool isAdaptive = false;
+    vtkSMPTools::LocalScope(adaptiveConfig, [&]() {
+      // a configuration that does not set the scheduling keeps the current one
+      vtkSMPTools::LocalScope(vtkSMPTools::Config{ 2 },
+        [&]() { isAdaptive = vtkSMPTools::GetAdaptiveScheduling(); });
+      isAdaptive = isAdaptive && vtkSMPTools::GetAdaptiveScheduling();
+      vtkSMPTools::For(0, Target, [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          visits[i]++;
+        }
+      });
+    });
+    if (!isAdaptive || vtkSMPTools::GetAdaptiveScheduling() ||
+      std::count(visits.begin(), visits.end(), 1) != Target)
+    {
+      cerr << "Error: on adaptive scheduling, some items were not processed exactly once" << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Test profiling statistics
+  {
+    vtkSMPTools::ResetStatistics();
+    vtkSMPTools::SetProfiling(true);
+    std::atomic<int> profiledCount(0);
+    vtkSMPTools::For(0, Target, 100, [&](vtkIdType begin, vtkIdType end) {
+      profiledCount += static_cast<int>(end - begin);
+    });
+    vtkSMPTools::SetProfiling(false);
+    vtkSMPTools::For(0, Target, [](vtkIdType, vtkIdType) {});
+
+    const auto statistics = vtkSMPTools::GetStatistics();
+    vtkSMPTools::ResetStatistics();
+    if (statistics.size() != 1 || profiledCount != Target)
+    {
+      cerr << "Error: on profiling, got " << statistics.size() << " records instead of 1" << endl;
+      return EXIT_FAILURE;
+    }
+    const auto& stats = statistics[0];
+    if (stats.NumberOfItems != Target || stats.Grain != 100 || stats.NumberOfChunks < 1 ||
+      stats.NumberOfThreads < 1 || stats.NumberOfThreads > stats.NumberOfAvailableThreads ||
+      static_cast<int>(stats.ThreadBusyTimes.size()) != stats.NumberOfThreads ||
+      stats.ImbalanceRatio < 0.999 || stats.Backend != vtkSMPTools::GetBackend())
+    {
+      cerr << "Error: on profiling, invalid statistics: " << stats.NumberOfItems << " items, "
+           << stats.NumberOfChunks << " chunks, " << stats.NumberOfThreads << "/"
+           << stats.NumberOfAvailableThreads << " threads, imbalance " << stats.ImbalanceRatio
+           << endl;
+      return EXIT_FAILURE;
+    }
+
+    // Only the most recent records are kept
+    const std::size_t maximumNumberOfStatistics = vtkSMPTools::GetMaximumNumberOfStatistics();
+    vtkSMPTools::SetMaximumNumberOfStatistics(2);
+    vtkSMPTools::SetProfiling(true);
+    for (vtkIdType grain = 1; grain <= 5; ++grain)
+    {
+      vtkSMPTools::For(0, 10, grain, [](vtkIdType, vtkIdType) {});
+    }
+    vtkSMPTools::SetProfiling(false);
+    const auto lastStatistics = vtkSMPTools::GetStatistics();
+    vtkSMPTools::ResetStatistics();
+    vtkSMPTools::SetMaximumNumberOfStatistics(maximumNumberOfStatistics);
+    if (lastStatistics.size() != 2 || lastStatistics[0].Grain != 4 ||
+      lastStatistics[1].Grain != 5)
+    {
+      cerr << "Error: on profiling, the ring buffer of statistics does not keep the last records"
+           << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Test NUMA aware mode: pinned threads and first touch of allocated arrays
+  bool numaAware = false;
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ 0, vtkSMPTools::GetBackend(), false, true }, [&]() {
+    numaAware = vtkSMPTools::GetNUMAAware();
+    vtkNew<vtkAOSDataArrayTemplate<double>> numaArray;
+    numaArray->SetNumberOfComponents(3);
+    numaArray->SetNumberOfTuples(100000);
+    auto numaRange = vtk::DataArrayValueRange<3>(numaArray);
+    vtkSMPTools::Fill(numaRange.begin(), numaRange.end(), 2.0);
+    total = static_cast<int>(vtkSMPTools::Reduce(numaRange.cbegin(), numaRange.cend(), 0.0));
+  });
+  if (!numaAware || vtkSMPTools::GetNUMAAware() || total != 600000)
+  {
+    cerr << "Error: on NUMA aware mode, got " << total << " instead of 600000" << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Test scans and reduction, with enough values to use several chunks
+  const vtkIdType scanSize = 100003;
+  std::vector<vtkIdType> scanInput(scanSize);
+  for (vtkIdType i = 0; i < scanSize; ++i)
+  {
+    scanInput[i] = i % 7;
+  }
+  std::vector<vtkIdType> inclusiveOutput(scanSize);
+  std::vector<vtkIdType> exclusiveOutput(scanSize);
+  vtkSMPTools::InclusiveScan(scanInput.cbegin(), scanInput.cend(), inclusiveOutput.begin());
+  vtkSMPTools::ExclusiveScan(
+    scanInput.cbegin(), scanInput.cend(), exclusiveOutput.begin(), static_cast<vtkIdType>(5));
+  vtkIdType scanSum = 0;
+  for (vtkIdType i = 0; i < scanSize; ++i)
+  {
+    if (exclusiveOutput[i] != scanSum + 5)
+    {
+      cerr << "Error: Invalid output for vtkSMPTools::ExclusiveScan at index " << i << endl;
+      return EXIT_FAILURE;
+    }
+    scanSum += scanInput[i];
+    if (inclusiveOutput[i] != scanSum)
+    {
+      cerr << "Error: Invalid output for vtkSMPTools::InclusiveScan at index " << i << endl;
+      return EXIT_FAILURE;
+    }
+  }
+  if (vtkSMPTools::Reduce(scanInput.cbegin(), scanInput.cend(), static_cast<vtkIdType>(0)) !=
+    scanSum)
+  {
+    cerr << "Error: Invalid output for vtkSMPTools::Reduce!" << endl;
+    return EXIT_FAILURE;
+  }
+
+  // In place scan on a vtkDataArray with a custom operation
+  vtkNew<vtkAOSDataArrayTemplate<double>> scanArray;
+  scanArray->SetNumberOfValues(scanSize);
+  auto scanRange = vtk::DataArrayValueRange<1>(scanArray);
+  vtkSMPTools::Fill(scanRange.begin(), scanRange.end(), 1.0);
+  scanRange[42] = 123.0;
+  vtkSMPTools::InclusiveScan(scanRange.cbegin(), scanRange.cend(), scanRange.begin(),
+    [](double a, double b) { return std::max(a, b); });
+  if (scanRange[41] != 1.0 || scanRange[42] != 123.0 || scanRange[scanSize - 1] != 123.0)
+  {
+    cerr << "Error: Invalid output for in place vtkSMPTools::InclusiveScan applied on "
+            "vtk::DataArrayValueRange!"
+         << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Non commutative reduction, the order of the values must be preserved
+  std::vector<std::string> words = { "a", "b", "c", "d", "e", "f" };
+  words.resize(5000, "g");
+  const std::string concatenated =
+    vtkSMPTools::Reduce(words.cbegin(), words.cend(), std::string("<"),
+      [](const std::string& a, const std::string& b) { return a + b; });
+  if (concatenated.size() != 5001 || concatenated.compare(0, 8, "<abcdefg") != 0)
+  {
+    cerr << "Error: Invalid output for non commutative vtkSMPTools::Reduce!" << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Test task graph: count -> prefix sum -> fill
+  const int nbBlocks = 37;
+  const int blockSize = 100;
+  std::vector<int> blockCounts(nbBlocks, 0);
+  std::vector<int> blockOffsets(nbBlocks + 1, 0);
+  std::vector<int> filled(nbBlocks * blockSize, -1);
+  vtkSMPTools::TaskGraph graph;
+  std::vector<vtkSMPTools::TaskGraph::TaskId> countTasks;
+  for (int block = 0; block < nbBlocks; ++block)
+  {
+    countTasks.push_back(graph.AddTask([&, block]() { blockCounts[block] = block % 5 + 1; }));
+  }
+  const auto scanTask = graph.AddTask(
+    [&]() {
+      for (int block = 0; block < nbBlocks; ++block)
+      {
+        blockOffsets[block + 1] = blockOffsets[block] + blockCounts[block];
+      }
+    },
+    countTasks);
+  for (int block = 0; block < nbBlocks; ++block)
+  {
+    graph.AddTask(
+      [&, block]() {
+        for (int i = blockOffsets[block]; i < blockOffsets[block + 1]; ++i)
+        {
+          filled[i] = block;
+        }
+      },
+      { scanTask });
+  }
+  if (graph.GetNumberOfTasks() != static_cast<std::size_t>(2 * nbBlocks + 1))
+  {
+    cerr << "Error: Invalid number of tasks in vtkSMPTools::TaskGraph!" << endl;
+    return EXIT_FAILURE;
+  }
+  graph.Execute();
+  if (graph.GetNumberOfTasks() != 0)
+  {
+    cerr << "Error: vtkSMPTools::TaskGraph should be empty after Execute()!" << endl;
+    return EXIT_FAILURE;
+  }
+  for (int block = 0; block < nbBlocks; ++block)
+  {
+    for (int i = blockOffsets[block]; i < blockOffsets[block + 1]; ++i)
+    {
+      if (filled[i] != block)
+      {
+        cerr << "Error: Invalid output for vtkSMPTools::TaskGraph!" << endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // Exceptions thrown by tasks are forwarded by Execute()
+  std::atomic<int> executedTasks(0);
+  graph.AddTask([]() { throw std::runtime_error("task failure"); });
+  graph.AddTask([&]() { ++executedTasks; });
+  try
+  {
+    graph.Execute();
+    cerr << "Error: vtkSMPTools::TaskGraph did not forward a task exception!" << endl;
+    return EXIT_FAILURE;
+  }
+  catch (const std::runtime_error&)
+  {
+  }
+  if (executedTasks != 1)
+  {
+    cerr << "Error: vtkSMPTools::TaskGraph did not execute all tasks!" << endl;
+    return EXIT_FAILURE;
+  }
   return EXIT_SUCCESS;
 }
 
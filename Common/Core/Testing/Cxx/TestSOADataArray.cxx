@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkArrayIterator.h"
 #include "vtkArrayIteratorIncludes.h"
+#include "vtkDoubleArray.h"
 #include "vtkMathUtilities.h"
+#include "vtkNew.h"
 #include "vtkSOADataArrayTemplate.h"
 
 // Needed for portable setenv on MSVC...
@@ -83,6 +85,76 @@ bool HasCorrectValues(vtkDataArray* array, bool useVoidPointerData)
 
   return true;
 }
+
+// Wrap external memory with deleters and check that shallow copies between
+// AOS and SOA arrays share it.
+int TestExternalMemory()
+{
+  int retVal = 0;
+  int numberOfDeletes = 0;
+  double external[2 * numValues];
+  std::copy(voidPointerData, voidPointerData + 2 * numValues, external);
+  {
+    vtkNew<vtkDoubleArray> aos;
+    aos->SetNumberOfComponents(2);
+    aos->SetArray(external, 2 * numValues, [&numberOfDeletes](double*) { ++numberOfDeletes; });
+
+    vtkNew<vtkSOADataArrayTemplate<double>> soa;
+    soa->ShallowCopy(aos);
+    if (soa->GetAOSBuffer() != aos->GetBuffer() || !HasCorrectValues(soa, true))
+    {
+      std::cerr << "ShallowCopy() from an AOS array did not share its memory\n";
+      retVal++;
+    }
+
+    vtkNew<vtkDoubleArray> aos2;
+    aos2->ShallowCopy(soa);
+    if (aos2->GetPointer(0) != external || !HasCorrectValues(aos2, true))
+    {
+      std::cerr << "ShallowCopy() from an SOA array did not share its memory\n";
+      retVal++;
+    }
+  }
+  if (numberOfDeletes != 1)
+  {
+    std::cerr << "External memory deleter called " << numberOfDeletes << " times\n";
+    retVal++;
+  }
+
+  // Writing to read-only memory must copy it first.
+  vtkNew<vtkDoubleArray> readOnly;
+  readOnly->SetNumberOfComponents(2);
+  readOnly->SetArray(external, 2 * numValues, nullptr, true);
+  vtkNew<vtkDoubleArray> shared;
+  shared->ShallowCopy(readOnly);
+  double* writable = readOnly->WritePointer(0, 2 * numValues);
+  if (writable == external || !HasCorrectValues(readOnly, true) ||
+    shared->GetPointer(0) != external)
+  {
+    std::cerr << "WritePointer() did not copy read-only memory\n";
+    retVal++;
+  }
+  writable[0] = 42;
+  shared->InsertNextTuple2(1, 2);
+  if (external[0] != voidPointerData[0] || shared->GetPointer(0) == external ||
+    shared->GetNumberOfTuples() != numValues + 1 || !HasCorrectValues(shared, true))
+  {
+    std::cerr << "Read-only memory was modified\n";
+    retVal++;
+  }
+
+  vtkNew<vtkSOADataArrayTemplate<double>> readOnlySOA;
+  readOnlySOA->SetNumberOfComponents(1);
+  readOnlySOA->SetArray(0, external, numValues, true, nullptr, true);
+  readOnlySOA->InsertNextValue(3);
+  if (readOnlySOA->GetComponentArrayPointer(0) == external ||
+    readOnlySOA->GetValue(0) != voidPointerData[0] || readOnlySOA->GetValue(numValues) != 3)
+  {
+    std::cerr << "Resizing read-only SOA memory did not copy it\n";
+    retVal++;
+  }
+  return retVal;
+}
 }
 
 int TestSOADataArray(int, char*[])
@@ -233,5 +305,7 @@ int TestSOADataArray(int, char*[])
   newInstance->Delete();
   array->Delete();
 
+  retVal += TestExternalMemory();
+
   return retVal; // success has retVal = 0
 }
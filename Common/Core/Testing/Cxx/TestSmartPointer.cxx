@@ -142,6 +142,47 @@ int TestSmartPointer(int, char*[])
       std::cerr << "Cast move-constructing vtkSmartPointer failed.\n";
       rval = 1;
     }
+
+    // Move assignment transfers the reference without registering the object
+    // again, and releases the reference to the old object.
+    vtkSmartPointer<vtkIntArray> other = vtkSmartPointer<vtkIntArray>::New();
+    vtkSmartPointer<vtkIntArray> intArrayAssigned = other;
+    intArrayAssigned = vtkSmartPointer<vtkIntArray>(intArray);
+    if (intArrayAssigned != intArray || intArray->GetReferenceCount() != 4 ||
+      other->GetReferenceCount() != 1)
+    {
+      std::cerr << "Move assigning vtkSmartPointer yielded unexpected result.\n";
+      rval = 1;
+    }
+
+    vtkSmartPointer<vtkDataArray> dataArrayAssigned;
+    dataArrayAssigned = std::move(intArrayAssigned);
+    // NOLINTNEXTLINE(bugprone-use-after-move)
+    if (intArrayAssigned || dataArrayAssigned != intArray || intArray->GetReferenceCount() != 4)
+    {
+      std::cerr << "Cast move-assigning vtkSmartPointer failed.\n";
+      rval = 1;
+    }
+
+    // Self move assignment keeps the reference.
+    vtkSmartPointer<vtkDataArray>& self = dataArrayAssigned;
+    dataArrayAssigned = std::move(self);
+    if (dataArrayAssigned != intArray || intArray->GetReferenceCount() != 4)
+    {
+      std::cerr << "Self move-assigning vtkSmartPointer failed.\n";
+      rval = 1;
+    }
+
+    vtkNew<vtkIntArray> newArray;
+    vtkIntArray* newArrayPtr = newArray;
+    dataArrayAssigned = std::move(newArray);
+    // NOLINTNEXTLINE(bugprone-use-after-move)
+    if (newArray.GetPointer() || dataArrayAssigned != newArrayPtr ||
+      newArrayPtr->GetReferenceCount() != 1 || intArray->GetReferenceCount() != 3)
+    {
+      std::cerr << "Move-assigning vtkNew to vtkSmartPointer failed.\n";
+      rval = 1;
+    }
   }
 
   return rval;
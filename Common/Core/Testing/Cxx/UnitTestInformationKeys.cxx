@@ -3,6 +3,7 @@
 #include "vtkInformation.h"
 #include "vtkInformationDoubleKey.h"
 #include "vtkInformationDoubleVectorKey.h"
+#include "vtkInformationIntegerKey.h"
 #include "vtkInformationStringKey.h"
 #include "vtkInformationStringVectorKey.h"
 #include "vtkInformationVariantKey.h"
@@ -11,6 +12,9 @@
 #include "vtkNew.h"
 #include "vtkVariant.h"
 
+#include <string>
+#include <vector>
+
 template <typename T, typename V>
 int UnitTestScalarValueKey(vtkInformation* info, T* key, const V& val)
 {
@@ -127,6 +131,67 @@ int UnitTestVectorValueKey(
   return ok_setgetcomp && ok_copyget && ok_length && ok_appendedlength;
 }
 
+// Copy() must replace the entries already present in the destination and
+// remove the ones missing from the source.
+int UnitTestInformationCopy()
+{
+  const int numberOfKeys = 20;
+  std::vector<vtkInformationIntegerKey*> keys;
+  for (int i = 0; i < numberOfKeys; ++i)
+  {
+    keys.push_back(new vtkInformationIntegerKey("TestCopy", "vtkTest"));
+  }
+  vtkInformationStringVectorKey* skey = new vtkInformationStringVectorKey("TestCopy", "vtkTest");
+
+  vtkNew<vtkInformation> from;
+  vtkNew<vtkInformation> to;
+  for (int i = 0; i < numberOfKeys; ++i)
+  {
+    if (i % 2 == 0)
+    {
+      keys[i]->Set(from, i);
+    }
+    keys[i]->Set(to, -1);
+  }
+  skey->Set(from, "a", 0);
+  skey->Set(to, "b", 0);
+  skey->Set(to, "c", 1);
+
+  int ok = 1;
+  for (vtkTypeBool deep : { 0, 1 })
+  {
+    to->Copy(from, deep);
+    for (int i = 0; i < numberOfKeys; ++i)
+    {
+      bool expected = (i % 2 == 0);
+      if (keys[i]->Has(to) != expected || (expected && keys[i]->Get(to) != i))
+      {
+        cerr << "Copy did not reproduce key " << i << ".\n";
+        ok = 0;
+      }
+    }
+    if (skey->Length(to) != 1 || std::string(skey->Get(to, 0)) != "a")
+    {
+      cerr << "Copy did not replace the string vector.\n";
+      ok = 0;
+    }
+    if (to->GetNumberOfKeys() != from->GetNumberOfKeys())
+    {
+      cerr << "Copy produced " << to->GetNumberOfKeys() << " keys, expected "
+           << from->GetNumberOfKeys() << ".\n";
+      ok = 0;
+    }
+  }
+
+  to->Copy(nullptr);
+  if (to->GetNumberOfKeys() != 0)
+  {
+    cerr << "Copy from nullptr did not clear the information.\n";
+    ok = 0;
+  }
+  return ok;
+}
+
 int UnitTestInformationKeys(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
 {
   int ok = 1;
@@ -153,5 +218,7 @@ int UnitTestInformationKeys(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
   vtkInformationStringVectorKey* tsvkey = new vtkInformationStringVectorKey("Test", "vtkTest");
   ok &= UnitTestVectorValueKey(info, tsvkey, tsval);
 
+  ok &= UnitTestInformationCopy();
+
   return !ok;
 }
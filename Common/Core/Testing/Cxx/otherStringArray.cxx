@@ -6,8 +6,10 @@
 #include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
 #include "vtkNew.h"
+#include "vtkSMPTools.h"
 #include "vtkStringArray.h"
 
+#include <atomic>
 #include <sstream>
 
 #define SIZE 1000
@@ -183,6 +185,122 @@ int doStringArrayTest(ostream& strm, int size)
   return errors;
 }
 
+int doCompactStringArrayTest(ostream& strm, bool dictionaryEncode)
+{
+  int errors = 0;
+
+  vtkNew<vtkStringArray> ptr;
+  for (int i = 0; i < SIZE; ++i)
+  {
+    ptr->InsertNextValue("category " + std::to_string(i % 7));
+  }
+  ptr->InsertNextValue("");
+  const unsigned long expandedSize = ptr->GetActualMemorySize();
+
+  strm << "\tCompact...";
+  ptr->Compact(dictionaryEncode);
+  if (ptr->IsCompact() && ptr->IsDictionaryEncoded() == dictionaryEncode &&
+    ptr->GetNumberOfValues() == SIZE + 1 && ptr->GetActualMemorySize() < expandedSize)
+  {
+    strm << "OK" << endl;
+  }
+  else
+  {
+    ++errors;
+    strm << "FAILED" << endl;
+  }
+
+  strm << "\tGetValueData...";
+  vtkIdType length;
+  const char* data = ptr->GetValueData(10, length);
+  vtkIdType emptyLength;
+  const char* empty = ptr->GetValueData(SIZE, emptyLength);
+  if (vtkStdString(data, length) == "category 3" && data[length] == '\0' && emptyLength == 0 &&
+    empty[0] == '\0' && ptr->GetVariantValue(11).ToString() == "category 4" && ptr->IsCompact())
+  {
+    strm << "OK" << endl;
+  }
+  else
+  {
+    ++errors;
+    strm << "FAILED" << endl;
+  }
+
+  strm << "\tLookupValue...";
+  vtkNew<vtkIdList> ids;
+  ptr->LookupValue("category 5", ids);
+  bool found = ids->GetNumberOfIds() == (SIZE - 5 + 6) / 7;
+  for (vtkIdType i = 0; found && i < ids->GetNumberOfIds(); ++i)
+  {
+    found = ids->GetId(i) == 5 + 7 * i;
+  }
+  if (found && ptr->LookupValue("category 2") == 2 && ptr->LookupValue("") == SIZE &&
+    ptr->LookupValue("category 7") == -1 && ptr->IsCompact())
+  {
+    strm << "OK" << endl;
+  }
+  else
+  {
+    ++errors;
+    strm << "FAILED" << endl;
+  }
+
+  strm << "\tDeepCopy and InsertTuple...";
+  vtkNew<vtkStringArray> copy;
+  copy->DeepCopy(ptr);
+  vtkNew<vtkStringArray> tuples;
+  tuples->InsertTuple(0, 12, ptr);
+  if (copy->IsCompact() && copy->LookupValue("category 6") == 6 &&
+    tuples->GetValue(0) == "category 5" && ptr->IsCompact())
+  {
+    strm << "OK" << endl;
+  }
+  else
+  {
+    ++errors;
+    strm << "FAILED" << endl;
+  }
+
+  strm << "\tConcurrent const GetValue...";
+  const vtkStringArray* constPtr = ptr;
+  std::atomic<int> mismatches(0);
+  vtkSMPTools::For(0, SIZE, 1, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      if (constPtr->GetValue(i) != "category " + std::to_string(i % 7))
+      {
+        ++mismatches;
+      }
+    }
+  });
+  if (mismatches == 0 && constPtr->GetValue(SIZE).empty() && ptr->IsCompact())
+  {
+    strm << "OK" << endl;
+  }
+  else
+  {
+    ++errors;
+    strm << "FAILED" << endl;
+  }
+
+  strm << "\tExpand on write...";
+  ptr->InsertNextValue("new category");
+  ptr->SetValue(0, "first");
+  if (!ptr->IsCompact() && ptr->GetNumberOfValues() == SIZE + 2 && ptr->GetValue(0) == "first" &&
+    ptr->GetValue(8) == "category 1" && ptr->GetValue(SIZE + 1) == "new category" &&
+    ptr->LookupValue("category 0") == 7)
+  {
+    strm << "OK" << endl;
+  }
+  else
+  {
+    ++errors;
+    strm << "FAILED" << endl;
+  }
+
+  return errors;
+}
+
 int otherStringArrayTest(ostream& strm)
 {
   int errors = 0;
@@ -190,6 +308,14 @@ int otherStringArrayTest(ostream& strm)
     strm << "Test StringArray" << endl;
     errors += doStringArrayTest(strm, SIZE);
   }
+  {
+    strm << "Test compact StringArray" << endl;
+    errors += doCompactStringArrayTest(strm, false);
+  }
+  {
+    strm << "Test dictionary encoded StringArray" << endl;
+    errors += doCompactStringArrayTest(strm, true);
+  }
 
   return errors;
 }
@@ -9,6 +9,7 @@ Created on Aug 1, 2015 by David Gobbi
 
 """
 
+import os
 import sys
 import struct
 import vtkmodules.vtkCommonCore
@@ -21,6 +22,9 @@ from vtkmodules.vtkCommonCore import (
     vtkFloatArray,
 )
 from vtkmodules.test import Testing
+from vtkmodules.util.misc import vtkGetTempDir
+
+VTK_TEMP_DIR = vtkGetTempDir()
 
 # array types and the corresponding format
 lsize = VTK_SIZEOF_LONG
@@ -114,6 +118,22 @@ class TestBuffer(Testing.vtkTest):
         # test the contents of the memoryview
         self.assertEqual(ord(m.tobytes()) & 0xF8, 0x68)
 
+    def testReadOnlyBuffer(self):
+        """Test that memory wrapped read-only gives a read-only buffer."""
+        filename = os.path.join(VTK_TEMP_DIR, "TestBufferReadOnly.raw")
+        with open(filename, 'wb') as f:
+            f.write(struct.pack('3f', 10, 7, 85))
+        a = vtkFloatArray()
+        self.assertTrue(a.MapFile(filename, 0, 3, True))
+        m = memoryview(a)
+        self.assertTrue(m.readonly)
+        self.assertEqual(m.tolist(), [10.0, 7.0, 85.0])
+        # the values are copied once they are modified through VTK
+        a.WritePointer(0, 3)
+        m = memoryview(a)
+        self.assertFalse(m.readonly)
+        self.assertEqual(m.tolist(), [10.0, 7.0, 85.0])
+
     def testBufferShared(self):
         """Test the special buffer_shared() check that VTK provides."""
         a = bytearray(b'hello')
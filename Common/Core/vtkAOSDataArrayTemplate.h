@@ -200,6 +200,44 @@ public:
    **/
   void SetArrayFreeFunction(void (*callback)(void*)) override;
 
+  /**
+   * Wrap externally owned memory without copying it. @a deleter is called
+   * with @a array once no array uses the memory anymore, an empty deleter
+   * meaning that the memory is never released by VTK. When @a readOnly is
+   * true, WritePointer(), WriteVoidPointer() and resizing first copy the values
+   * into memory owned by the array (copy-on-write), the external memory
+   * itself is never modified through these methods. Accessors writing values
+   * directly, such as SetValue() or GetPointer(), do not check the flag.
+   * The memory is shared with the arrays shallow copying this one.
+   */
+  void SetArray(ValueType* array, vtkIdType size,
+    typename vtkBuffer<ValueType>::DeleterType deleter, bool readOnly = false);
+
+  /**
+   * Use @a numValues values stored in @a fileName at byte @a offset without
+   * reading them, through a private memory mapping of the file (see
+   * vtkMemoryMappedFile). The values must be stored with the native byte order
+   * and @a offset must be a multiple of the alignment of ValueType. When
+   * @a readOnly is true the mapped memory is read-only, see the SetArray()
+   * overload taking a deleter for the copy-on-write semantics; otherwise the
+   * pages modified through the array are copied by the system and the file is
+   * never changed. The mapping is released once no array uses it anymore.
+   * Returns false, leaving the array unchanged, when the file cannot be mapped.
+   */
+  bool MapFile(
+    const char* fileName, vtkTypeInt64 offset, vtkIdType numValues, bool readOnly = true);
+
+  ///@{
+  /**
+   * Get/Set the reference counted buffer holding the values. Setting a buffer
+   * shares it with its current users, the size of the array becomes the size
+   * of the buffer. These let several arrays, including vtkSOADataArrayTemplate
+   * instances using AOS storage, use the same memory without copying it.
+   */
+  vtkBuffer<ValueType>* GetBuffer() { return this->Buffer; }
+  void SetBuffer(vtkBuffer<ValueType>* buffer);
+  ///@}
+
   // Overridden for optimized implementations:
   void SetTuple(vtkIdType tupleIdx, const float* tuple) override;
   void SetTuple(vtkIdType tupleIdx, const double* tuple) override;
@@ -296,6 +334,12 @@ protected:
    */
   bool ReallocateTuples(vtkIdType numTuples);
 
+  /**
+   * Replace a read-only buffer by a buffer owned by this array holding
+   * @a numValues values, the current values are copied.
+   */
+  bool DetachReadOnlyBuffer(vtkIdType numValues);
+
   vtkBuffer<ValueType>* Buffer;
 
 private:
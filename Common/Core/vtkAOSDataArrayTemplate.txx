@@ -12,6 +12,11 @@
 #include "vtkAOSDataArrayTemplate.h"
 
 #include "vtkArrayIteratorTemplate.h"
+#include "vtkMemoryMappedFile.h"
+#include "vtkSOADataArrayTemplate.h"
+#include "vtkSmartPointer.h"
+
+#include <utility>
 
 //-----------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
@@ -114,6 +119,64 @@ void vtkAOSDataArrayTemplate<ValueType>::SetArrayFreeFunction(void (*callback)(v
   this->Buffer->SetFreeFunction(false, callback);
 }
 
+//-----------------------------------------------------------------------------
+template <class ValueTypeT>
+void vtkAOSDataArrayTemplate<ValueTypeT>::SetArray(ValueType* array, vtkIdType size,
+  typename vtkBuffer<ValueType>::DeleterType deleter, bool readOnly)
+{
+  if (this->Buffer->GetReferenceCount() > 1)
+  {
+    // Do not change the memory of the arrays sharing the current buffer.
+    this->Buffer->Delete();
+    this->Buffer = vtkBuffer<ValueType>::New();
+  }
+  this->Buffer->SetBuffer(array, size, std::move(deleter), readOnly);
+  this->Size = size;
+  this->MaxId = this->Size - 1;
+  this->DataChanged();
+}
+
+//-----------------------------------------------------------------------------
+template <class ValueTypeT>
+bool vtkAOSDataArrayTemplate<ValueTypeT>::MapFile(
+  const char* fileName, vtkTypeInt64 offset, vtkIdType numValues, bool readOnly)
+{
+  if (numValues <= 0 || offset % static_cast<vtkTypeInt64>(alignof(ValueType)) != 0)
+  {
+    return false;
+  }
+  vtkSmartPointer<vtkMemoryMappedFile> mapping = vtkSmartPointer<vtkMemoryMappedFile>::New();
+  if (!mapping->Map(fileName, offset,
+        static_cast<vtkTypeUInt64>(numValues) * sizeof(ValueType), readOnly))
+  {
+    return false;
+  }
+  // The deleter owns the mapping: it is released with the last buffer using it.
+  this->SetArray(static_cast<ValueType*>(mapping->GetPointer()), numValues,
+    [mapping](ValueType*) { mapping->Unmap(); }, readOnly);
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+template <class ValueTypeT>
+void vtkAOSDataArrayTemplate<ValueTypeT>::SetBuffer(vtkBuffer<ValueType>* buffer)
+{
+  if (!buffer)
+  {
+    vtkErrorMacro("Cannot set a nullptr buffer.");
+    return;
+  }
+  if (this->Buffer != buffer)
+  {
+    buffer->Register(nullptr);
+    this->Buffer->Delete();
+    this->Buffer = buffer;
+  }
+  this->Size = buffer->GetSize();
+  this->MaxId = this->Size - 1;
+  this->DataChanged();
+}
+
 //-----------------------------------------------------------------------------
 template <class ValueTypeT>
 void vtkAOSDataArrayTemplate<ValueTypeT>::SetTuple(vtkIdType tupleIdx, const float* tuple)
@@ -295,6 +358,24 @@ void vtkAOSDataArrayTemplate<ValueTypeT>::ShallowCopy(vtkDataArray* other)
     }
     this->DataChanged();
   }
+  else if (auto* soa = vtkSOADataArrayTemplate<ValueType>::FastDownCast(other))
+  {
+    // Share the memory of SOA arrays using the AOS storage instead of
+    // deep copying it.
+    if (vtkBuffer<ValueType>* buffer = soa->GetAOSBuffer())
+    {
+      this->SetNumberOfComponents(other->GetNumberOfComponents());
+      this->SetBuffer(buffer);
+      this->Size = other->GetSize();
+      this->MaxId = other->GetMaxId();
+      this->SetName(other->GetName());
+      this->CopyComponentNames(other);
+    }
+    else
+    {
+      this->Superclass::ShallowCopy(other);
+    }
+  }
   else
   {
     this->Superclass::ShallowCopy(other);
@@ -395,6 +476,10 @@ typename vtkAOSDataArrayTemplate<ValueTypeT>::ValueType*
 vtkAOSDataArrayTemplate<ValueTypeT>::WritePointer(vtkIdType valueIdx, vtkIdType numValues)
 {
   vtkIdType newSize = valueIdx + numValues;
+  if (this->Buffer->GetReadOnly() && !this->DetachReadOnlyBuffer(std::max(this->Size, newSize)))
+  {
+    return nullptr;
+  }
   if (newSize > this->Size)
   {
     if (!this->Resize(newSize / this->NumberOfComponents + 1))
@@ -441,6 +526,10 @@ bool vtkAOSDataArrayTemplate<ValueTypeT>::AllocateTuples(vtkIdType numTuples)
   if (this->Buffer->Allocate(numValues))
   {
     this->Size = this->Buffer->GetSize();
+    if (vtkSMPTools::GetNUMAAware())
+    {
+      vtkSMPTools::FirstTouch(this->Buffer->GetBuffer(), numValues * sizeof(ValueType));
+    }
     return true;
   }
   return false;
@@ -450,6 +539,10 @@ bool vtkAOSDataArrayTemplate<ValueTypeT>::AllocateTuples(vtkIdType numTuples)
 template <class ValueTypeT>
 bool vtkAOSDataArrayTemplate<ValueTypeT>::ReallocateTuples(vtkIdType numTuples)
 {
+  if (this->Buffer->GetReadOnly())
+  {
+    return this->DetachReadOnlyBuffer(numTuples * this->GetNumberOfComponents());
+  }
   if (this->Buffer->Reallocate(numTuples * this->GetNumberOfComponents()))
   {
     this->Size = this->Buffer->GetSize();
@@ -458,5 +551,23 @@ bool vtkAOSDataArrayTemplate<ValueTypeT>::ReallocateTuples(vtkIdType numTuples)
   return false;
 }
 
+//-----------------------------------------------------------------------------
+template <class ValueTypeT>
+bool vtkAOSDataArrayTemplate<ValueTypeT>::DetachReadOnlyBuffer(vtkIdType numValues)
+{
+  vtkBuffer<ValueType>* buffer = vtkBuffer<ValueType>::New();
+  if (!buffer->Allocate(numValues))
+  {
+    buffer->Delete();
+    return false;
+  }
+  const ValueType* source = this->Buffer->GetBuffer();
+  std::copy(source, source + std::min(this->Buffer->GetSize(), numValues), buffer->GetBuffer());
+  this->Buffer->Delete();
+  this->Buffer = buffer;
+  this->Size = buffer->GetSize();
+  return true;
+}
+
 VTK_ABI_NAMESPACE_END
 #endif // header guard
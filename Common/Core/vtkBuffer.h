@@ -13,10 +13,12 @@
 #ifndef vtkBuffer_h
 #define vtkBuffer_h
 
+#include "vtkMemoryTracker.h" // For allocation tracking
 #include "vtkObject.h"
 #include "vtkObjectFactory.h" // New() implementation
 
-#include <algorithm> // for std::min and std::copy
+#include <algorithm>  // for std::min and std::copy
+#include <functional> // for std::function
 
 VTK_ABI_NAMESPACE_BEGIN
 template <class ScalarTypeT>
@@ -25,6 +27,7 @@ class vtkBuffer : public vtkObject
 public:
   vtkTemplateTypeMacro(vtkBuffer<ScalarTypeT>, vtkObject);
   typedef ScalarTypeT ScalarType;
+  using DeleterType = std::function<void(ScalarType*)>;
 
   static vtkBuffer<ScalarTypeT>* New();
   static vtkBuffer<ScalarTypeT>* ExtendedNew();
@@ -42,6 +45,30 @@ public:
    */
   void SetBuffer(ScalarType* array, vtkIdType size);
 
+  /**
+   * Set an externally owned memory buffer. @a deleter is called with @a array
+   * when the buffer is released, i.e. when this vtkBuffer is deleted or its
+   * memory is replaced. An empty @a deleter means that the memory is never
+   * released by this object. The free function set with SetFreeFunction() is
+   * left untouched and is used again for memory allocated afterwards.
+   *
+   * When @a readOnly is true, the memory must not be modified nor resized in
+   * place: Reallocate() then always copies the values into a new buffer.
+   */
+  void SetBuffer(ScalarType* array, vtkIdType size, DeleterType deleter, bool readOnly = false);
+
+  /**
+   * Return true if the current memory is read-only, see SetBuffer(). The flag
+   * is cleared when the memory is replaced.
+   */
+  inline bool GetReadOnly() const { return this->ReadOnly; }
+
+  /**
+   * Return true if the current memory is externally owned, i.e. it was set
+   * with the SetBuffer() overload taking a deleter.
+   */
+  inline bool GetExternal() const { return static_cast<bool>(this->Deleter); }
+
   /**
    * Set the malloc function to be used when allocating space inside this object.
    **/
@@ -80,6 +107,7 @@ protected:
   vtkBuffer()
     : Pointer(nullptr)
     , Size(0)
+    , ReadOnly(false)
   {
     this->SetMallocFunction(vtkObjectBase::GetCurrentMallocFunction());
     this->SetReallocFunction(vtkObjectBase::GetCurrentReallocFunction());
@@ -93,8 +121,15 @@ protected:
   vtkMallocingFunction MallocFunction;
   vtkReallocingFunction ReallocFunction;
   vtkFreeingFunction DeleteFunction;
+  DeleterType Deleter;
+  bool ReadOnly;
+  // Bytes of the current memory accounted for by vtkMemoryTracker.
+  vtkTypeInt64 TrackedBytes = 0;
 
 private:
+  // Release the current memory with the deleter or the free function.
+  void ReleaseBuffer();
+
   vtkBuffer(const vtkBuffer&) = delete;
   void operator=(const vtkBuffer&) = delete;
 };
@@ -118,14 +153,53 @@ void vtkBuffer<ScalarT>::SetBuffer(typename vtkBuffer<ScalarT>::ScalarType* arra
 {
   if (this->Pointer != array)
   {
-    if (this->DeleteFunction)
-    {
-      this->DeleteFunction(this->Pointer);
-    }
+    this->ReleaseBuffer();
     this->Pointer = array;
   }
   this->Size = size;
 }
+
+//------------------------------------------------------------------------------
+template <typename ScalarT>
+void vtkBuffer<ScalarT>::SetBuffer(typename vtkBuffer<ScalarT>::ScalarType* array, vtkIdType size,
+  DeleterType deleter, bool readOnly)
+{
+  if (this->Pointer != array)
+  {
+    this->ReleaseBuffer();
+    this->Pointer = array;
+  }
+  this->Size = size;
+  this->Deleter = std::move(deleter);
+  this->ReadOnly = readOnly;
+  if (!this->Deleter)
+  {
+    // Never release memory owned by someone else.
+    this->Deleter = [](ScalarType*) {};
+  }
+}
+
+//------------------------------------------------------------------------------
+template <typename ScalarT>
+void vtkBuffer<ScalarT>::ReleaseBuffer()
+{
+  if (this->Deleter)
+  {
+    DeleterType deleter;
+    std::swap(deleter, this->Deleter);
+    if (this->Pointer)
+    {
+      deleter(this->Pointer);
+    }
+  }
+  else if (this->DeleteFunction)
+  {
+    this->DeleteFunction(this->Pointer);
+  }
+  this->ReadOnly = false;
+  vtkMemoryTracker::Freed(this->TrackedBytes);
+  this->TrackedBytes = 0;
+}
 //------------------------------------------------------------------------------
 template <typename ScalarT>
 void vtkBuffer<ScalarT>::SetMallocFunction(vtkMallocingFunction mallocFunction)
@@ -143,6 +217,8 @@ void vtkBuffer<ScalarT>::SetReallocFunction(vtkReallocingFunction reallocFunctio
 template <typename ScalarT>
 void vtkBuffer<ScalarT>::SetFreeFunction(bool noFreeFunction, vtkFreeingFunction deleteFunction)
 {
+  // The free function replaces any custom deleter of the current memory.
+  this->Deleter = nullptr;
   if (noFreeFunction)
   {
     this->DeleteFunction = nullptr;
@@ -173,6 +249,7 @@ bool vtkBuffer<ScalarT>::Allocate(vtkIdType size)
     if (newArray)
     {
       this->SetBuffer(newArray, size);
+      this->TrackedBytes = vtkMemoryTracker::Allocated(size * sizeof(ScalarType));
       if (!this->MallocFunction)
       {
         this->DeleteFunction = free;
@@ -193,7 +270,7 @@ bool vtkBuffer<ScalarT>::Reallocate(vtkIdType newsize)
     return this->Allocate(0);
   }
 
-  if (this->Pointer && this->DeleteFunction != free)
+  if (this->Pointer && (this->DeleteFunction != free || this->Deleter || this->ReadOnly))
   {
     ScalarType* newArray;
     bool forceFreeFunction = false;
@@ -222,6 +299,7 @@ bool vtkBuffer<ScalarT>::Reallocate(vtkIdType newsize)
     std::copy(this->Pointer, this->Pointer + (std::min)(this->Size, newsize), newArray);
     // now save the new array and release the old one too.
     this->SetBuffer(newArray, newsize);
+    this->TrackedBytes = vtkMemoryTracker::Allocated(newsize * sizeof(ScalarType));
     if (!this->MallocFunction || forceFreeFunction)
     {
       this->DeleteFunction = free;
@@ -247,6 +325,8 @@ bool vtkBuffer<ScalarT>::Reallocate(vtkIdType newsize)
     }
     this->Pointer = newArray;
     this->Size = newsize;
+    vtkMemoryTracker::Freed(this->TrackedBytes);
+    this->TrackedBytes = vtkMemoryTracker::Allocated(newsize * sizeof(ScalarType));
   }
   return true;
 }
@@ -36,6 +36,7 @@
 #include "vtkUnsignedShortArray.h"
 
 #include <algorithm> // for min(), max()
+#include <utility>
 #include <vector>
 
 namespace
@@ -422,10 +423,115 @@ bool hasValidKey(InfoType info, KeyType key, ComponentKeyType ckey, double range
   return false;
 }
 
+// Compute the component ranges of blocks of tuples
+struct BlockRangeWorker
+{
+  double* BlockRanges;
+  const unsigned char* DirtyBlocks; // nullptr to compute all the blocks
+  vtkIdType NumberOfBlocks;
+  vtkIdType BlockSize;
+
+  template <typename ArrayT>
+  void operator()(ArrayT* array)
+  {
+    using APIType = vtk::GetAPIType<ArrayT>;
+    const vtkIdType numTuples = array->GetNumberOfTuples();
+    const int numComps = array->GetNumberOfComponents();
+    vtkSMPTools::For(0, this->NumberOfBlocks,
+      [&](vtkIdType block, vtkIdType endBlock)
+      {
+        std::vector<APIType> range(2 * numComps);
+        for (; block < endBlock; ++block)
+        {
+          if (this->DirtyBlocks && !this->DirtyBlocks[block])
+          {
+            continue;
+          }
+          for (int c = 0; c < numComps; ++c)
+          {
+            range[2 * c] = vtkTypeTraits<APIType>::Max();
+            range[2 * c + 1] = vtkTypeTraits<APIType>::Min();
+          }
+          const vtkIdType begin = block * this->BlockSize;
+          const vtkIdType end = std::min(begin + this->BlockSize, numTuples);
+          const auto tuples = vtk::DataArrayTupleRange(array, begin, end);
+          for (const auto tuple : tuples)
+          {
+            size_t j = 0;
+            for (const APIType value : tuple)
+            {
+              // Branch free so that the loop can be vectorized, NaN are ignored
+              range[j] = value < range[j] ? value : range[j];
+              range[j + 1] = range[j + 1] < value ? value : range[j + 1];
+              j += 2;
+            }
+          }
+          double* blockRange = this->BlockRanges + 2 * numComps * block;
+          for (int c = 0; c < 2 * numComps; ++c)
+          {
+            blockRange[c] = static_cast<double>(range[c]);
+          }
+        }
+      });
+  }
+};
+
 } // end anon namespace
 
 VTK_ABI_NAMESPACE_BEGIN
 
+//------------------------------------------------------------------------------
+// Partial modifications of the array, and cached ranges of blocks of tuples.
+struct vtkDataArray::vtkModifiedTuplesInternals
+{
+  struct Record
+  {
+    vtkMTimeType Time;
+    vtkIdType Begin;
+    vtkIdType End;
+  };
+
+  static constexpr size_t MaxNumberOfRecords = 64;
+  static constexpr vtkIdType BlockSize = 4096;
+
+  std::vector<Record> Records;
+  vtkMTimeType FullModifiedTime = 0;
+  bool MarkingTuples = false;
+
+  std::vector<double> BlockRanges;
+  vtkMTimeType BlockRangesTime = 0;
+  vtkIdType BlockRangesNumberOfTuples = 0;
+  int BlockRangesNumberOfComponents = 0;
+
+  // Sorted and merged ranges modified after since, clamped to numTuples
+  void GetModifiedRanges(vtkMTimeType since, vtkIdType numTuples,
+    std::vector<std::pair<vtkIdType, vtkIdType>>& modified) const
+  {
+    modified.clear();
+    for (const Record& record : this->Records)
+    {
+      if (record.Time > since && record.Begin < numTuples)
+      {
+        modified.emplace_back(record.Begin, std::min(record.End, numTuples));
+      }
+    }
+    std::sort(modified.begin(), modified.end());
+    size_t numMerged = 0;
+    for (const auto& range : modified)
+    {
+      if (numMerged > 0 && range.first <= modified[numMerged - 1].second)
+      {
+        modified[numMerged - 1].second = std::max(modified[numMerged - 1].second, range.second);
+      }
+      else
+      {
+        modified[numMerged++] = range;
+      }
+    }
+    modified.resize(numMerged);
+  }
+};
+
 vtkInformationKeyRestrictedMacro(vtkDataArray, COMPONENT_RANGE, DoubleVector, 2);
 vtkInformationKeyRestrictedMacro(vtkDataArray, L2_NORM_RANGE, DoubleVector, 2);
 vtkInformationKeyRestrictedMacro(vtkDataArray, L2_NORM_FINITE_RANGE, DoubleVector, 2);
@@ -440,6 +546,7 @@ vtkDataArray::vtkDataArray()
   this->Range[1] = 0;
   this->FiniteRange[0] = 0;
   this->FiniteRange[1] = 0;
+  this->ModifiedTuplesInternals = nullptr;
 }
 
 //------------------------------------------------------------------------------
@@ -449,6 +556,7 @@ vtkDataArray::~vtkDataArray()
   {
     this->LookupTable->Delete();
   }
+  delete this->ModifiedTuplesInternals;
   this->SetName(nullptr);
 }
 
@@ -1717,7 +1825,8 @@ void vtkDataArray::ComputeRange(
     // hasValidKey will update range to the cached value if it exists.
     if (!hasValidKey(info, PER_COMPONENT(), rkey, range, comp))
     {
-      const bool computed = this->ComputeScalarRange(allCompRanges.data());
+      const bool computed = this->ComputeTrackedScalarRange(allCompRanges.data()) ||
+        this->ComputeScalarRange(allCompRanges.data());
       if (computed)
       {
         // construct the keys and add them to the info object
@@ -1751,6 +1860,132 @@ void vtkDataArray::Modified()
     info->Remove(L2_NORM_FINITE_RANGE());
   }
   this->Superclass::Modified();
+
+  // A modification not coming from ModifiedTuples() invalidates the tracked
+  // modified ranges.
+  vtkModifiedTuplesInternals* internals = this->ModifiedTuplesInternals;
+  if (internals && !internals->MarkingTuples)
+  {
+    internals->FullModifiedTime = this->MTime.GetMTime();
+    internals->Records.clear();
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkDataArray::ModifiedTuples(vtkIdType beginTuple, vtkIdType endTuple)
+{
+  beginTuple = std::max<vtkIdType>(beginTuple, 0);
+  endTuple = std::min(endTuple, this->GetNumberOfTuples());
+  if (beginTuple >= endTuple)
+  {
+    return;
+  }
+
+  if (!this->ModifiedTuplesInternals)
+  {
+    // Nothing is known about the modifications done before
+    this->ModifiedTuplesInternals = new vtkModifiedTuplesInternals;
+    this->ModifiedTuplesInternals->FullModifiedTime = this->MTime.GetMTime();
+  }
+  vtkModifiedTuplesInternals* internals = this->ModifiedTuplesInternals;
+
+  internals->MarkingTuples = true;
+  this->Modified();
+  internals->MarkingTuples = false;
+
+  if (internals->Records.size() >= vtkModifiedTuplesInternals::MaxNumberOfRecords)
+  {
+    // Too many partial modifications, consider the whole array modified
+    internals->FullModifiedTime = this->MTime.GetMTime();
+    internals->Records.clear();
+  }
+  else
+  {
+    internals->Records.push_back({ this->MTime.GetMTime(), beginTuple, endTuple });
+  }
+}
+
+//------------------------------------------------------------------------------
+bool vtkDataArray::GetModifiedTupleRanges(vtkMTimeType since, vtkIdTypeArray* ranges)
+{
+  vtkModifiedTuplesInternals* internals = this->ModifiedTuplesInternals;
+  if (!internals || !ranges || internals->FullModifiedTime > since)
+  {
+    return false;
+  }
+
+  std::vector<std::pair<vtkIdType, vtkIdType>> modified;
+  internals->GetModifiedRanges(since, this->GetNumberOfTuples(), modified);
+
+  ranges->SetNumberOfComponents(2);
+  ranges->SetNumberOfTuples(static_cast<vtkIdType>(modified.size()));
+  for (size_t i = 0; i < modified.size(); ++i)
+  {
+    ranges->SetTypedComponent(static_cast<vtkIdType>(i), 0, modified[i].first);
+    ranges->SetTypedComponent(static_cast<vtkIdType>(i), 1, modified[i].second);
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkDataArray::ComputeTrackedScalarRange(double* ranges)
+{
+  vtkModifiedTuplesInternals* internals = this->ModifiedTuplesInternals;
+  const vtkIdType numTuples = this->GetNumberOfTuples();
+  const int numComps = this->GetNumberOfComponents();
+  if (!internals || numTuples == 0)
+  {
+    return false;
+  }
+
+  const vtkIdType blockSize = vtkModifiedTuplesInternals::BlockSize;
+  const vtkIdType numBlocks = (numTuples + blockSize - 1) / blockSize;
+  std::vector<unsigned char> dirtyBlocks;
+  std::vector<std::pair<vtkIdType, vtkIdType>> modified;
+  if (internals->BlockRangesNumberOfTuples == numTuples &&
+    internals->BlockRangesNumberOfComponents == numComps &&
+    internals->FullModifiedTime <= internals->BlockRangesTime)
+  {
+    // Only recompute the blocks containing modified tuples
+    internals->GetModifiedRanges(internals->BlockRangesTime, numTuples, modified);
+    dirtyBlocks.resize(numBlocks, 0);
+    for (const auto& range : modified)
+    {
+      std::fill(dirtyBlocks.begin() + range.first / blockSize,
+        dirtyBlocks.begin() + (range.second - 1) / blockSize + 1, 1);
+    }
+  }
+  else
+  {
+    internals->BlockRanges.resize(2 * numComps * numBlocks);
+    internals->BlockRangesNumberOfTuples = numTuples;
+    internals->BlockRangesNumberOfComponents = numComps;
+  }
+
+  BlockRangeWorker worker{ internals->BlockRanges.data(),
+    dirtyBlocks.empty() ? nullptr : dirtyBlocks.data(), numBlocks, blockSize };
+  if (!vtkArrayDispatch::Dispatch::Execute(this, worker))
+  {
+    worker(this);
+  }
+  internals->BlockRangesTime = this->MTime.GetMTime();
+
+  // Reduce the ranges of the blocks
+  for (int c = 0; c < numComps; ++c)
+  {
+    ranges[2 * c] = internals->BlockRanges[2 * c];
+    ranges[2 * c + 1] = internals->BlockRanges[2 * c + 1];
+  }
+  const double* blockRange = internals->BlockRanges.data() + 2 * numComps;
+  for (vtkIdType block = 1; block < numBlocks; ++block)
+  {
+    for (int c = 0; c < numComps; ++c, blockRange += 2)
+    {
+      ranges[2 * c] = std::min(ranges[2 * c], blockRange[0]);
+      ranges[2 * c + 1] = std::max(ranges[2 * c + 1], blockRange[1]);
+    }
+  }
+  return true;
 }
 VTK_ABI_NAMESPACE_END
 
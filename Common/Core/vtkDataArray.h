@@ -30,6 +30,7 @@
 VTK_ABI_NAMESPACE_BEGIN
 class vtkDoubleArray;
 class vtkIdList;
+class vtkIdTypeArray;
 class vtkInformationStringKey;
 class vtkInformationDoubleVectorKey;
 class vtkLookupTable;
@@ -516,6 +517,25 @@ public:
    */
   void Modified() override;
 
+  ///@{
+  /**
+   * Partial modification tracking. ModifiedTuples() marks the tuples in
+   * [beginTuple, endTuple) as modified and calls Modified(). It should be
+   * used instead of Modified() by code updating a small part of the array.
+   * A consumer that processed the array at time `since` can then call
+   * GetModifiedTupleRanges() to get the sorted, disjoint [begin, end) tuple
+   * ranges modified since then, stored as the 2-component tuples of
+   * `ranges`, and only process those. GetModifiedTupleRanges() returns false
+   * when the modifications since `since` are not all known, i.e. when the
+   * array was modified with a plain Modified() or when too many ranges were
+   * marked, in which case the whole array must be considered modified.
+   * The component ranges returned by GetRange() are updated incrementally
+   * from the modified tuples.
+   */
+  void ModifiedTuples(vtkIdType beginTuple, vtkIdType endTuple);
+  bool GetModifiedTupleRanges(vtkMTimeType since, vtkIdTypeArray* ranges);
+  ///@}
+
   /**
    * A human-readable string indicating the units for the array data.
    */
@@ -668,9 +688,20 @@ protected:
   double Range[2];
   double FiniteRange[2];
 
+  /**
+   * Compute the component ranges from cached ranges of blocks of tuples,
+   * recomputing only the blocks containing tuples marked by
+   * ModifiedTuples(). Returns false when the partial modifications of the
+   * array are not tracked, or when it is empty.
+   */
+  bool ComputeTrackedScalarRange(double* ranges);
+
 private:
   double* GetTupleN(vtkIdType i, int n);
 
+  struct vtkModifiedTuplesInternals;
+  vtkModifiedTuplesInternals* ModifiedTuplesInternals;
+
   vtkDataArray(const vtkDataArray&) = delete;
   void operator=(const vtkDataArray&) = delete;
 };
@@ -90,6 +90,24 @@ bool isinf(T x)
   // Select the correct partially specialized type.
   return has_infinity<T, std::numeric_limits<T>::has_infinity>::isinf(x);
 }
+
+// Branch free range update, so that the loops using it can be vectorized.
+// NaN values are ignored since comparisons with them are false.
+template <typename T>
+void UpdateMinMax(T& min, T& max, const T& value)
+{
+  min = value < min ? value : min;
+  max = max < value ? value : max;
+}
+
+// Same as UpdateMinMax, ignoring infinite values too.
+template <typename T>
+void UpdateFiniteMinMax(T& min, T& max, const T& value)
+{
+  const bool finite = !detail::isinf(value);
+  min = (finite && value < min) ? value : min;
+  max = (finite && max < value) ? value : max;
+}
 }
 
 template <typename APIType, int NumComps>
@@ -163,21 +181,36 @@ public:
   void operator()(vtkIdType begin, vtkIdType end)
   {
     const auto tuples = vtk::DataArrayTupleRange<NumComps>(this->Array, begin, end);
-    auto& range = MinAndMaxT::TLRange.Local();
-    const unsigned char* ghostIt = this->Ghosts ? this->Ghosts + begin : nullptr;
-    for (const auto tuple : tuples)
+    // Accumulate in a local copy of the thread local range: it can stay in
+    // registers, and the loop without ghosts can be vectorized.
+    auto& tlRange = MinAndMaxT::TLRange.Local();
+    auto range = tlRange;
+    if (!this->Ghosts)
     {
-      if (ghostIt && (*(ghostIt++) & this->GhostsToSkip))
+      for (const auto tuple : tuples)
       {
-        continue;
+        for (int i = 0, j = 0; i < NumComps; ++i, j += 2)
+        {
+          detail::UpdateMinMax<APIType>(range[j], range[j + 1], tuple[i]);
+        }
       }
-      size_t j = 0;
-      for (const APIType value : tuple)
+    }
+    else
+    {
+      const unsigned char* ghostIt = this->Ghosts + begin;
+      for (const auto tuple : tuples)
       {
-        vtkMathUtilities::UpdateRange(range[j], range[j + 1], value);
-        j += 2;
+        if (*(ghostIt++) & this->GhostsToSkip)
+        {
+          continue;
+        }
+        for (int i = 0, j = 0; i < NumComps; ++i, j += 2)
+        {
+          detail::UpdateMinMax<APIType>(range[j], range[j + 1], tuple[i]);
+        }
       }
     }
+    tlRange = range;
   }
 };
 
@@ -204,24 +237,36 @@ public:
   void operator()(vtkIdType begin, vtkIdType end)
   {
     const auto tuples = vtk::DataArrayTupleRange<NumComps>(this->Array, begin, end);
-    auto& range = MinAndMaxT::TLRange.Local();
-    const unsigned char* ghostIt = this->Ghosts ? this->Ghosts + begin : nullptr;
-    for (const auto tuple : tuples)
+    // Accumulate in a local copy of the thread local range: it can stay in
+    // registers, and the loop without ghosts can be vectorized.
+    auto& tlRange = MinAndMaxT::TLRange.Local();
+    auto range = tlRange;
+    if (!this->Ghosts)
     {
-      if (ghostIt && (*(ghostIt++) & this->GhostsToSkip))
+      for (const auto tuple : tuples)
       {
-        continue;
+        for (int i = 0, j = 0; i < NumComps; ++i, j += 2)
+        {
+          detail::UpdateFiniteMinMax<APIType>(range[j], range[j + 1], tuple[i]);
+        }
       }
-      size_t j = 0;
-      for (const APIType value : tuple)
+    }
+    else
+    {
+      const unsigned char* ghostIt = this->Ghosts + begin;
+      for (const auto tuple : tuples)
       {
-        if (!detail::isinf(value))
+        if (*(ghostIt++) & this->GhostsToSkip)
         {
-          vtkMathUtilities::UpdateRange(range[j], range[j + 1], value);
+          continue;
+        }
+        for (int i = 0, j = 0; i < NumComps; ++i, j += 2)
+        {
+          detail::UpdateFiniteMinMax<APIType>(range[j], range[j + 1], tuple[i]);
         }
-        j += 2;
       }
     }
+    tlRange = range;
   }
 };
 
@@ -127,16 +127,20 @@ void vtkInformation::SetAsObjectBase(vtkInformationKey* key, vtkObjectBase* newv
   if (i != this->Internal->Map.end())
   {
     vtkObjectBase* oldvalue = i->second;
-    if (newvalue)
+    // Setting the object already stored does not change the references.
+    if (newvalue != oldvalue)
     {
-      i->second = newvalue;
-      newvalue->Register(nullptr);
+      if (newvalue)
+      {
+        i->second = newvalue;
+        newvalue->Register(nullptr);
+      }
+      else
+      {
+        this->Internal->Map.erase(i);
+      }
+      oldvalue->UnRegister(nullptr);
     }
-    else
-    {
-      this->Internal->Map.erase(i);
-    }
-    oldvalue->UnRegister(nullptr);
   }
   else if (newvalue)
   {
@@ -186,6 +190,38 @@ void vtkInformation::Clear()
 //------------------------------------------------------------------------------
 void vtkInformation::Copy(vtkInformation* from, vtkTypeBool deep)
 {
+  if (from != this)
+  {
+    // Keep the entries also stored in the source, so that copying them
+    // reuses their values instead of allocating new ones. The removed values
+    // are released last, as when replacing the whole internal representation.
+    typedef vtkInformationInternals::MapType MapType;
+    MapType& map = this->Internal->Map;
+    std::vector<vtkObjectBase*> removed;
+    for (MapType::iterator i = map.begin(); i != map.end();)
+    {
+      if (!from || from->Internal->Map.find(i->first) == from->Internal->Map.end())
+      {
+        removed.push_back(i->second);
+        i = map.erase(i);
+      }
+      else
+      {
+        ++i;
+      }
+    }
+    this->Append(from, deep);
+    if (from && !removed.empty())
+    {
+      this->Modified();
+    }
+    for (vtkObjectBase* value : removed)
+    {
+      value->UnRegister(nullptr);
+    }
+    return;
+  }
+
   vtkInformationInternals* oldInternal = this->Internal;
   this->Internal = new vtkInformationInternals;
   if (from)
@@ -15,13 +15,9 @@
 #include "vtkInformationKey.h"
 #include "vtkObjectBase.h"
 
-#include <cstdint>
-#define VTK_INFORMATION_USE_HASH_MAP
-#ifdef VTK_INFORMATION_USE_HASH_MAP
-#include <unordered_map>
-#else
-#include <map>
-#endif
+#include <algorithm> // for std::find_if
+#include <utility>   // for std::pair
+#include <vector>    // for std::vector
 
 //----------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
@@ -30,26 +26,53 @@ class vtkInformationInternals
 public:
   typedef vtkInformationKey* KeyType;
   typedef vtkObjectBase* DataType;
-#ifdef VTK_INFORMATION_USE_HASH_MAP
-  struct HashFun
+
+  // Flat storage of the key/value pairs. An information object holds a few
+  // tens of entries at most, for which a linear search in contiguous memory
+  // is faster than hashing and avoids allocating a node per entry.
+  class MapType
   {
-    size_t operator()(KeyType key) const
+  public:
+    typedef std::pair<KeyType, DataType> value_type;
+    typedef std::vector<value_type>::iterator iterator;
+    typedef std::vector<value_type>::const_iterator const_iterator;
+
+    iterator begin() { return this->Entries.begin(); }
+    iterator end() { return this->Entries.end(); }
+    const_iterator begin() const { return this->Entries.begin(); }
+    const_iterator end() const { return this->Entries.end(); }
+    std::size_t size() const { return this->Entries.size(); }
+    bool empty() const { return this->Entries.empty(); }
+
+    iterator find(KeyType key)
+    {
+      return std::find_if(this->Entries.begin(), this->Entries.end(),
+        [key](const value_type& entry) { return entry.first == key; });
+    }
+    const_iterator find(KeyType key) const
     {
-      return reinterpret_cast<uintptr_t>(key) / sizeof(vtkInformationKey);
+      return std::find_if(this->Entries.begin(), this->Entries.end(),
+        [key](const value_type& entry) { return entry.first == key; });
     }
+
+    // The key must not be stored yet.
+    void insert(const value_type& entry)
+    {
+      if (this->Entries.capacity() == 0)
+      {
+        this->Entries.reserve(16);
+      }
+      this->Entries.push_back(entry);
+    }
+
+    iterator erase(iterator i) { return this->Entries.erase(i); }
+
+  private:
+    std::vector<value_type> Entries;
   };
-  typedef std::unordered_map<KeyType, DataType, HashFun> MapType;
-#else
-  typedef std::map<KeyType, DataType> MapType;
-#endif
   MapType Map;
 
-#ifdef VTK_INFORMATION_USE_HASH_MAP
-  vtkInformationInternals()
-    : Map(33)
-  {
-  }
-#endif
+  vtkInformationInternals() = default;
 
   ~vtkInformationInternals()
   {
@@ -62,14 +85,11 @@ public:
     }
   }
 
-#ifdef VTK_INFORMATION_USE_HASH_MAP
 private:
   vtkInformationInternals(vtkInformationInternals const&) = delete;
-#endif
+  void operator=(vtkInformationInternals const&) = delete;
 };
 
-#undef VTK_INFORMATION_USE_HASH_MAP
-
 VTK_ABI_NAMESPACE_END
 #endif
 // VTK-HeaderTest-Exclude: vtkInformationInternals.h
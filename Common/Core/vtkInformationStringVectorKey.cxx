@@ -118,6 +118,21 @@ int vtkInformationStringVectorKey::Length(vtkInformation* info)
 //------------------------------------------------------------------------------
 void vtkInformationStringVectorKey::ShallowCopy(vtkInformation* from, vtkInformation* to)
 {
+  vtkInformationStringVectorValue* fromV =
+    static_cast<vtkInformationStringVectorValue*>(this->GetAsObjectBase(from));
+  if (!fromV || fromV->Value.empty())
+  {
+    return;
+  }
+  vtkInformationStringVectorValue* toV =
+    static_cast<vtkInformationStringVectorValue*>(this->GetAsObjectBase(to));
+  if (toV)
+  {
+    // Replace the whole vector so that an existing longer value is truncated.
+    toV->Value = fromV->Value;
+    to->Modified(this);
+    return;
+  }
   int length = this->Length(from);
   for (int i = 0; i < length; ++i)
   {
@@ -8,7 +8,13 @@
 #include <vtk_loguru.h>
 #endif
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -24,6 +30,7 @@ public:
 #if VTK_MODULE_ENABLE_VTK_loguru
   std::unique_ptr<loguru::LogScopeRAII> Data;
 #endif
+  bool Traced = false;
 };
 
 vtkLogger::LogScopeRAII::LogScopeRAII()
@@ -46,6 +53,11 @@ vtkLogger::LogScopeRAII::LogScopeRAII(
   va_end(vlist);
   this->Internals->Data.reset(new loguru::LogScopeRAII(
     static_cast<loguru::Verbosity>(verbosity), fname, lineno, "%s", result.c_str()));
+  if (vtkLogger::IsTracing())
+  {
+    vtkLogger::TraceBegin(result.c_str());
+    this->Internals->Traced = true;
+  }
 #else
   (void)verbosity;
   (void)fname;
@@ -56,6 +68,10 @@ vtkLogger::LogScopeRAII::LogScopeRAII(
 
 vtkLogger::LogScopeRAII::~LogScopeRAII()
 {
+  if (this->Internals && this->Internals->Traced)
+  {
+    vtkLogger::TraceEnd();
+  }
   delete this->Internals;
 }
 //=============================================================================
@@ -65,18 +81,30 @@ namespace detail
 {
 VTK_ABI_NAMESPACE_BEGIN
 #if VTK_MODULE_ENABLE_VTK_loguru
-using scope_pair = std::pair<std::string, std::shared_ptr<loguru::LogScopeRAII>>;
+// scope id, scope, and whether the scope is traced
+struct scope_entry
+{
+  std::string first;
+  std::shared_ptr<loguru::LogScopeRAII> second;
+  bool traced;
+};
 static std::mutex g_mutex;
-static std::unordered_map<std::thread::id, std::vector<scope_pair>> g_vectors;
-static std::vector<scope_pair>& get_vector()
+static std::unordered_map<std::thread::id, std::vector<scope_entry>> g_vectors;
+static std::vector<scope_entry>& get_vector()
 {
   std::lock_guard<std::mutex> guard(g_mutex);
   return g_vectors[std::this_thread::get_id()];
 }
 
-static void push_scope(const char* id, std::shared_ptr<loguru::LogScopeRAII> ptr)
+static void push_scope(
+  const char* id, std::shared_ptr<loguru::LogScopeRAII> ptr, const char* traceName = nullptr)
 {
-  get_vector().emplace_back(std::string(id), ptr);
+  const bool traced = traceName && vtkLogger::IsTracing();
+  if (traced)
+  {
+    vtkLogger::TraceBegin(traceName);
+  }
+  get_vector().push_back(scope_entry{ std::string(id), ptr, traced });
 }
 
 static void pop_scope(const char* id)
@@ -84,6 +112,10 @@ static void pop_scope(const char* id)
   auto& vector = get_vector();
   if (!vector.empty() && vector.back().first == id)
   {
+    if (vector.back().traced)
+    {
+      vtkLogger::TraceEnd();
+    }
     vector.pop_back();
 
     if (vector.empty())
@@ -100,6 +132,99 @@ static void pop_scope(const char* id)
 static VTK_THREAD_LOCAL char ThreadName[128] = {};
 #endif
 
+// Trace events of a thread, or of a named track, kept in a ring buffer.
+struct trace_event
+{
+  std::string name;
+  double time;     // in microseconds
+  double duration; // in microseconds, for complete events
+  char phase;      // 'B'egin, 'E'nd or 'X' for complete events
+};
+
+struct trace_buffer
+{
+  std::mutex mutex;
+  std::vector<trace_event> events;
+  std::size_t next = 0;
+  int tid = 0;
+  std::string name;
+
+  void record(const char* eventName, double time, double duration, char phase);
+};
+
+static std::atomic<bool> g_tracing(false);
+static std::atomic<int> g_trace_pid(0);
+static std::mutex g_trace_mutex;
+static std::atomic<std::size_t> g_trace_capacity(1);
+static std::chrono::steady_clock::time_point g_trace_origin = std::chrono::steady_clock::now();
+static std::vector<std::unique_ptr<trace_buffer>> g_trace_buffers;
+static std::map<std::string, trace_buffer*> g_trace_tracks;
+static VTK_THREAD_LOCAL trace_buffer* t_trace_buffer = nullptr;
+
+void trace_buffer::record(const char* eventName, double time, double duration, char phase)
+{
+  std::lock_guard<std::mutex> guard(this->mutex);
+  const std::size_t capacity = g_trace_capacity;
+  if (this->events.size() < capacity)
+  {
+    this->events.push_back(trace_event{ eventName ? eventName : "", time, duration, phase });
+  }
+  else
+  {
+    trace_event& event = this->events[this->next % capacity];
+    event.name = eventName ? eventName : "";
+    event.time = time;
+    event.duration = duration;
+    event.phase = phase;
+  }
+  this->next = (this->next + 1) % capacity;
+}
+
+// must be called with g_trace_mutex locked
+static trace_buffer* new_trace_buffer(const std::string& name)
+{
+  g_trace_buffers.emplace_back(new trace_buffer());
+  trace_buffer* buffer = g_trace_buffers.back().get();
+  buffer->tid = static_cast<int>(g_trace_buffers.size());
+  buffer->name = name;
+  return buffer;
+}
+
+static trace_buffer* get_thread_trace_buffer()
+{
+  if (!t_trace_buffer)
+  {
+    const std::string name = vtkLogger::GetThreadName();
+    std::lock_guard<std::mutex> guard(g_trace_mutex);
+    t_trace_buffer = new_trace_buffer(name);
+  }
+  return t_trace_buffer;
+}
+
+static double get_trace_time_us()
+{
+  return std::chrono::duration<double, std::micro>(
+    std::chrono::steady_clock::now() - g_trace_origin)
+    .count();
+}
+
+static void write_json_string(std::ostream& os, const std::string& text)
+{
+  os << '"';
+  for (char c : text)
+  {
+    if (c == '"' || c == '\\')
+    {
+      os << '\\' << c;
+    }
+    else if (static_cast<unsigned char>(c) >= 0x20)
+    {
+      os << c;
+    }
+  }
+  os << '"';
+}
+
 VTK_ABI_NAMESPACE_END
 }
 
@@ -227,9 +352,12 @@ void vtkLogger::SetThreadName(const std::string& name)
   // Save threadname so if this is called before `Init`, we can pass the thread
   // name to loguru::init().
   strncpy(detail::ThreadName, name.c_str(), sizeof(detail::ThreadName) - 1);
-#else
-  (void)name;
 #endif
+  if (detail::t_trace_buffer)
+  {
+    std::lock_guard<std::mutex> guard(detail::g_trace_mutex);
+    detail::t_trace_buffer->name = name;
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -405,11 +533,12 @@ void vtkLogger::StartScope(
   Verbosity verbosity, const char* id, const char* fname, unsigned int lineno)
 {
 #if VTK_MODULE_ENABLE_VTK_loguru
+  const bool logged = verbosity <= vtkLogger::GetCurrentVerbosityCutoff();
   detail::push_scope(id,
-    verbosity > vtkLogger::GetCurrentVerbosityCutoff()
-      ? std::make_shared<loguru::LogScopeRAII>()
-      : std::make_shared<loguru::LogScopeRAII>(
-          static_cast<loguru::Verbosity>(verbosity), fname, lineno, "%s", id));
+    !logged ? std::make_shared<loguru::LogScopeRAII>()
+            : std::make_shared<loguru::LogScopeRAII>(
+                static_cast<loguru::Verbosity>(verbosity), fname, lineno, "%s", id),
+    logged ? id : nullptr);
 #else
   (void)verbosity;
   (void)id;
@@ -446,7 +575,8 @@ void vtkLogger::StartScopeF(Verbosity verbosity, const char* id, const char* fna
 
     detail::push_scope(id,
       std::make_shared<loguru::LogScopeRAII>(
-        static_cast<loguru::Verbosity>(verbosity), fname, lineno, "%s", result.c_str()));
+        static_cast<loguru::Verbosity>(verbosity), fname, lineno, "%s", result.c_str()),
+      result.c_str());
   }
 #else
   (void)verbosity;
@@ -457,6 +587,140 @@ void vtkLogger::StartScopeF(Verbosity verbosity, const char* id, const char* fna
 #endif
 }
 
+//------------------------------------------------------------------------------
+void vtkLogger::StartTracing(std::size_t maxNumberOfEventsPerThread)
+{
+  std::lock_guard<std::mutex> guard(detail::g_trace_mutex);
+  detail::g_tracing = false;
+  for (auto& buffer : detail::g_trace_buffers)
+  {
+    std::lock_guard<std::mutex> bufferGuard(buffer->mutex);
+    buffer->events.clear();
+    buffer->next = 0;
+  }
+  detail::g_trace_capacity = std::max<std::size_t>(maxNumberOfEventsPerThread, 1);
+  detail::g_trace_origin = std::chrono::steady_clock::now();
+  detail::g_tracing = true;
+}
+
+//------------------------------------------------------------------------------
+void vtkLogger::StopTracing()
+{
+  detail::g_tracing = false;
+}
+
+//------------------------------------------------------------------------------
+bool vtkLogger::IsTracing()
+{
+  return detail::g_tracing.load(std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+void vtkLogger::SetTraceProcessId(int pid)
+{
+  detail::g_trace_pid = pid;
+}
+
+//------------------------------------------------------------------------------
+double vtkLogger::GetTraceTime()
+{
+  return detail::get_trace_time_us() * 1e-6;
+}
+
+//------------------------------------------------------------------------------
+void vtkLogger::TraceBegin(const char* name)
+{
+  if (vtkLogger::IsTracing())
+  {
+    detail::get_thread_trace_buffer()->record(name, detail::get_trace_time_us(), 0.0, 'B');
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkLogger::TraceEnd()
+{
+  if (vtkLogger::IsTracing())
+  {
+    detail::get_thread_trace_buffer()->record(nullptr, detail::get_trace_time_us(), 0.0, 'E');
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkLogger::TraceComplete(
+  const char* name, double startTime, double duration, const char* track)
+{
+  if (!vtkLogger::IsTracing())
+  {
+    return;
+  }
+  detail::trace_buffer* buffer;
+  if (track)
+  {
+    std::lock_guard<std::mutex> guard(detail::g_trace_mutex);
+    detail::trace_buffer*& trackBuffer = detail::g_trace_tracks[track];
+    if (!trackBuffer)
+    {
+      trackBuffer = detail::new_trace_buffer(track);
+    }
+    buffer = trackBuffer;
+  }
+  else
+  {
+    buffer = detail::get_thread_trace_buffer();
+  }
+  buffer->record(name, startTime * 1e6, duration * 1e6, 'X');
+}
+
+//------------------------------------------------------------------------------
+bool vtkLogger::WriteTrace(const char* path)
+{
+  std::ofstream os(path);
+  if (!os)
+  {
+    return false;
+  }
+
+  const int pid = detail::g_trace_pid;
+  os << "{ \"traceEvents\": [" << std::fixed << std::setprecision(3);
+  bool first = true;
+  std::lock_guard<std::mutex> guard(detail::g_trace_mutex);
+  for (auto& buffer : detail::g_trace_buffers)
+  {
+    std::lock_guard<std::mutex> bufferGuard(buffer->mutex);
+    if (buffer->events.empty())
+    {
+      continue;
+    }
+    os << (first ? "\n" : ",\n") << "  { \"name\": \"thread_name\", \"ph\": \"M\", \"pid\": "
+       << pid << ", \"tid\": " << buffer->tid << ", \"args\": { \"name\": ";
+    detail::write_json_string(os, buffer->name);
+    os << " } }";
+    first = false;
+
+    // oldest events first, once the ring buffer is full
+    const std::size_t numberOfEvents = buffer->events.size();
+    const std::size_t start = numberOfEvents < detail::g_trace_capacity ? 0 : buffer->next;
+    for (std::size_t i = 0; i < numberOfEvents; ++i)
+    {
+      const detail::trace_event& event = buffer->events[(start + i) % numberOfEvents];
+      os << ",\n  { \"ph\": \"" << event.phase << "\", \"pid\": " << pid
+         << ", \"tid\": " << buffer->tid << ", \"ts\": " << event.time;
+      if (event.phase != 'E')
+      {
+        os << ", \"name\": ";
+        detail::write_json_string(os, event.name);
+      }
+      if (event.phase == 'X')
+      {
+        os << ", \"dur\": " << event.duration;
+      }
+      os << " }";
+    }
+  }
+  os << "\n], \"displayTimeUnit\": \"ms\" }\n";
+  return static_cast<bool>(os);
+}
+
 //------------------------------------------------------------------------------
 vtkLogger::Verbosity vtkLogger::ConvertToVerbosity(int value)
 {
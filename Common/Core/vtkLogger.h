@@ -158,7 +158,8 @@
 #include "vtkObjectBase.h"
 #include "vtkSetGet.h" // needed for macros
 
-#include <string> // needed for std::string
+#include <cstddef> // needed for std::size_t
+#include <string>  // needed for std::string
 
 #if defined(_MSC_VER)
 #include <sal.h> // Needed for _In_z_ etc annotations
@@ -387,6 +388,56 @@ public:
    */
   static Verbosity ConvertToVerbosity(const char* text);
 
+  ///@{
+  /**
+   * Record trace events and write them to a JSON file in the Chrome trace
+   * event format, which can be opened in chrome://tracing or in the Perfetto
+   * UI. While tracing, the begin and end of the scopes logged with
+   * vtkLogScopeF(), vtkLogStartScope() and the like, and of the execution of
+   * the algorithms by their executive, are recorded for each thread, including
+   * the vtkSMPTools worker threads. Each thread records its events in a ring
+   * buffer of `maxNumberOfEventsPerThread` events, that keeps the most recent
+   * events. When tracing is off, recording an event is a single atomic test.
+   *
+   * StartTracing() clears the events previously recorded. WriteTrace() may be
+   * called while tracing, and returns false if the file cannot be written.
+   */
+  static void StartTracing(std::size_t maxNumberOfEventsPerThread = 1 << 20);
+  static void StopTracing();
+  static bool IsTracing();
+  static bool WriteTrace(VTK_FILEPATH const char* path);
+  ///@}
+
+  /**
+   * Set the process id of the trace events, to tell the processes apart when
+   * merging the traces of several processes. vtkMPIController sets it to the
+   * MPI rank. Default is 0.
+   */
+  static void SetTraceProcessId(int pid);
+
+  /**
+   * Get the time in seconds since StartTracing(), the time of the events.
+   */
+  static double GetTraceTime();
+
+  ///@{
+  /**
+   * Record the begin and the end of an event on the current thread, when
+   * tracing. Events must be nested on each thread.
+   */
+  static void TraceBegin(const char* name);
+  static void TraceEnd();
+  ///@}
+
+  /**
+   * Record an event of the given duration that starts at `startTime`, when
+   * tracing. Times are in seconds, like GetTraceTime(). The event goes to the
+   * timeline named `track` if given, for example for events measured on the
+   * GPU, or to the current thread otherwise.
+   */
+  static void TraceComplete(
+    const char* name, double startTime, double duration, const char* track = nullptr);
+
   ///@{
   /**
    * @internal
@@ -11,6 +11,9 @@
 #include "vtkVariantArray.h"
 
 #include <cassert>
+#include <limits>
+#include <type_traits>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 const vtkIdType vtkLookupTable::REPEATED_LAST_COLOR_INDEX = 0;
@@ -794,11 +797,88 @@ VTK_ABI_NAMESPACE_END
 namespace
 {
 
+//------------------------------------------------------------------------------
+template <class T>
+void vtkLookupTableMapData(vtkLookupTable* self, T* input, unsigned char* output, int length,
+  int inIncr, int outFormat, TableParameters& p);
+
+//------------------------------------------------------------------------------
+// Copy the colors of the values from a table of colors for all the values
+template <class T, int N>
+void vtkLookupTableCopyValueColors(
+  const T* input, unsigned char* output, int length, int inIncr, const unsigned char* colors)
+{
+  const int minValue = std::numeric_limits<T>::min();
+  for (int i = 0; i < length; i++)
+  {
+    const unsigned char* cptr = colors + N * (static_cast<int>(*input) - minValue);
+    for (int k = 0; k < N; k++)
+    {
+      output[k] = cptr[k];
+    }
+    input += inIncr;
+    output += N;
+  }
+}
+
+//------------------------------------------------------------------------------
+// For 8-bit and 16-bit types, if there are many more values to map than the
+// type has values, map each value of the type once and copy the colors
+template <class T>
+bool vtkLookupTableMapValues(vtkLookupTable*, T*, unsigned char*, int, int, int,
+  TableParameters&, std::false_type)
+{
+  return false;
+}
+
+template <class T>
+bool vtkLookupTableMapValues(vtkLookupTable* self, T* input, unsigned char* output, int length,
+  int inIncr, int outFormat, TableParameters& p, std::true_type)
+{
+  const int minValue = std::numeric_limits<T>::min();
+  const int numValues = std::numeric_limits<T>::max() - minValue + 1;
+  if (length < 2 * numValues || outFormat < VTK_LUMINANCE || outFormat > VTK_RGBA)
+  {
+    return false;
+  }
+
+  std::vector<T> values(numValues);
+  for (int i = 0; i < numValues; i++)
+  {
+    values[i] = static_cast<T>(minValue + i);
+  }
+  std::vector<unsigned char> colors(static_cast<size_t>(numValues) * outFormat);
+  vtkLookupTableMapData(self, values.data(), colors.data(), numValues, 1, outFormat, p);
+
+  switch (outFormat)
+  {
+    case VTK_RGBA:
+      vtkLookupTableCopyValueColors<T, 4>(input, output, length, inIncr, colors.data());
+      break;
+    case VTK_RGB:
+      vtkLookupTableCopyValueColors<T, 3>(input, output, length, inIncr, colors.data());
+      break;
+    case VTK_LUMINANCE_ALPHA:
+      vtkLookupTableCopyValueColors<T, 2>(input, output, length, inIncr, colors.data());
+      break;
+    default: // VTK_LUMINANCE
+      vtkLookupTableCopyValueColors<T, 1>(input, output, length, inIncr, colors.data());
+      break;
+  }
+  return true;
+}
+
 //------------------------------------------------------------------------------
 template <class T>
 void vtkLookupTableMapData(vtkLookupTable* self, T* input, unsigned char* output, int length,
   int inIncr, int outFormat, TableParameters& p)
 {
+  if (vtkLookupTableMapValues(self, input, output, length, inIncr, outFormat, p,
+        std::integral_constant<bool, std::is_integral<T>::value && sizeof(T) <= 2>()))
+  {
+    return;
+  }
+
   int i = length;
   const double* range = self->GetTableRange();
   const unsigned char* cptr;
@@ -0,0 +1,142 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkMemoryMappedFile.h"
+
+#include "vtkObjectFactory.h"
+
+#include <limits>
+
+#ifdef _WIN32
+#include "vtkWindows.h"
+#include <vtksys/Encoding.hxx>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkMemoryMappedFile);
+
+//------------------------------------------------------------------------------
+vtkMemoryMappedFile::vtkMemoryMappedFile() = default;
+
+//------------------------------------------------------------------------------
+vtkMemoryMappedFile::~vtkMemoryMappedFile()
+{
+  this->Unmap();
+}
+
+//------------------------------------------------------------------------------
+bool vtkMemoryMappedFile::Map(
+  const char* fileName, vtkTypeInt64 offset, vtkTypeUInt64 length, bool readOnly)
+{
+  this->Unmap();
+  if (!fileName || offset < 0 || length == 0 ||
+    length > static_cast<vtkTypeUInt64>(std::numeric_limits<std::size_t>::max() / 2))
+  {
+    return false;
+  }
+
+#ifdef _WIN32
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  const vtkTypeInt64 granularity = static_cast<vtkTypeInt64>(info.dwAllocationGranularity);
+#else
+  const vtkTypeInt64 granularity = static_cast<vtkTypeInt64>(sysconf(_SC_PAGESIZE));
+#endif
+  // Mappings must start at a multiple of the allocation granularity.
+  const vtkTypeInt64 mappedOffset = offset - offset % granularity;
+  const std::size_t delta = static_cast<std::size_t>(offset - mappedOffset);
+  const std::size_t mappedLength = static_cast<std::size_t>(length) + delta;
+
+#ifdef _WIN32
+  std::wstring wideName = vtksys::Encoding::ToWindowsExtendedPath(fileName);
+  HANDLE file = CreateFileW(wideName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    return false;
+  }
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx(file, &fileSize) ||
+    static_cast<vtkTypeUInt64>(fileSize.QuadPart) < static_cast<vtkTypeUInt64>(offset) + length)
+  {
+    CloseHandle(file);
+    return false;
+  }
+  HANDLE mapping =
+    CreateFileMappingW(file, nullptr, readOnly ? PAGE_READONLY : PAGE_WRITECOPY, 0, 0, nullptr);
+  // The view keeps the file and the mapping object alive.
+  CloseHandle(file);
+  if (!mapping)
+  {
+    return false;
+  }
+  void* base = MapViewOfFile(mapping, readOnly ? FILE_MAP_READ : FILE_MAP_COPY,
+    static_cast<DWORD>(static_cast<vtkTypeUInt64>(mappedOffset) >> 32),
+    static_cast<DWORD>(mappedOffset & 0xffffffff), mappedLength);
+  CloseHandle(mapping);
+  if (!base)
+  {
+    return false;
+  }
+#else
+  int fd = open(fileName, O_RDONLY);
+  if (fd < 0)
+  {
+    return false;
+  }
+  struct stat fileStat;
+  if (fstat(fd, &fileStat) != 0 ||
+    static_cast<vtkTypeUInt64>(fileStat.st_size) < static_cast<vtkTypeUInt64>(offset) + length)
+  {
+    close(fd);
+    return false;
+  }
+  void* base = mmap(nullptr, mappedLength, readOnly ? PROT_READ : (PROT_READ | PROT_WRITE),
+    MAP_PRIVATE, fd, static_cast<off_t>(mappedOffset));
+  // The mapping keeps a reference to the file.
+  close(fd);
+  if (base == MAP_FAILED)
+  {
+    return false;
+  }
+#endif
+
+  this->Base = base;
+  this->MappedLength = mappedLength;
+  this->Pointer = static_cast<unsigned char*>(base) + delta;
+  this->Length = length;
+  this->ReadOnly = readOnly;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkMemoryMappedFile::Unmap()
+{
+  if (!this->Base)
+  {
+    return;
+  }
+#ifdef _WIN32
+  UnmapViewOfFile(this->Base);
+#else
+  munmap(this->Base, this->MappedLength);
+#endif
+  this->Base = nullptr;
+  this->MappedLength = 0;
+  this->Pointer = nullptr;
+  this->Length = 0;
+}
+
+//------------------------------------------------------------------------------
+void vtkMemoryMappedFile::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Pointer: " << this->Pointer << "\n";
+  os << indent << "Length: " << this->Length << "\n";
+  os << indent << "ReadOnly: " << (this->ReadOnly ? "On" : "Off") << "\n";
+}
+VTK_ABI_NAMESPACE_END
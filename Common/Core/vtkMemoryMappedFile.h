@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+/**
+ * @class   vtkMemoryMappedFile
+ * @brief   map a region of a file in memory
+ *
+ * vtkMemoryMappedFile maps a byte range of a file in the address space of the
+ * process, so that the values stored in the file can be used in place, e.g.
+ * by vtkAOSDataArrayTemplate::MapFile(), without reading them into memory.
+ * Pages are loaded from the page cache on first access and can be evicted
+ * by the system under memory pressure.
+ *
+ * The mapping is always private: when it is not read-only, modified pages
+ * are copied on write and the file itself is never changed. The content of
+ * the file must not change while it is mapped.
+ */
+
+#ifndef vtkMemoryMappedFile_h
+#define vtkMemoryMappedFile_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkObject.h"
+
+#include <cstddef> // For std::size_t
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKCOMMONCORE_EXPORT vtkMemoryMappedFile : public vtkObject
+{
+public:
+  static vtkMemoryMappedFile* New();
+  vtkTypeMacro(vtkMemoryMappedFile, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Map @a length bytes of @a fileName starting at byte @a offset. The
+   * previous mapping, if any, is released first. When @a readOnly is true,
+   * the mapped memory must not be written to. Returns false when the file
+   * cannot be opened, is too small or when the system refuses the mapping.
+   */
+  bool Map(const char* fileName, vtkTypeInt64 offset, vtkTypeUInt64 length, bool readOnly = true);
+
+  /**
+   * Release the mapping. Pointers to the mapped memory become invalid.
+   */
+  void Unmap();
+
+  /**
+   * Return the address of the first mapped byte, nullptr when nothing is
+   * mapped.
+   */
+  void* GetPointer() const { return this->Pointer; }
+
+  /**
+   * Return the number of bytes mapped by the last successful call to Map().
+   */
+  vtkTypeUInt64 GetLength() const { return this->Length; }
+
+  /**
+   * Return true if the mapped memory is read-only.
+   */
+  bool GetReadOnly() const { return this->ReadOnly; }
+
+protected:
+  vtkMemoryMappedFile();
+  ~vtkMemoryMappedFile() override;
+
+private:
+  vtkMemoryMappedFile(const vtkMemoryMappedFile&) = delete;
+  void operator=(const vtkMemoryMappedFile&) = delete;
+
+  // Mappings start on a page boundary: Base and MappedLength describe the
+  // whole mapping, Pointer and Length the requested region.
+  void* Base = nullptr;
+  std::size_t MappedLength = 0;
+  void* Pointer = nullptr;
+  vtkTypeUInt64 Length = 0;
+  bool ReadOnly = true;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkMemoryTracker.h"
+
+#include "vtkObjectFactory.h"
+
+#include <atomic>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkMemoryTracker);
+
+namespace
+{
+std::atomic<bool> TrackerEnabled{ false };
+std::atomic<vtkTypeInt64> CurrentBytes{ 0 };
+std::atomic<vtkTypeInt64> PeakBytes{ 0 };
+
+void UpdatePeak(vtkTypeInt64 bytes)
+{
+  vtkTypeInt64 peak = PeakBytes.load(std::memory_order_relaxed);
+  while (bytes > peak && !PeakBytes.compare_exchange_weak(peak, bytes, std::memory_order_relaxed))
+  {
+  }
+}
+}
+
+//------------------------------------------------------------------------------
+void vtkMemoryTracker::SetEnabled(bool enabled)
+{
+  TrackerEnabled = enabled;
+}
+
+//------------------------------------------------------------------------------
+bool vtkMemoryTracker::GetEnabled()
+{
+  return TrackerEnabled.load(std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+vtkTypeInt64 vtkMemoryTracker::GetCurrentMemory()
+{
+  return CurrentBytes.load(std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+vtkTypeInt64 vtkMemoryTracker::GetPeakMemory()
+{
+  return PeakBytes.load(std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+void vtkMemoryTracker::ResetPeakMemory()
+{
+  PeakBytes = CurrentBytes.load(std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+vtkTypeInt64 vtkMemoryTracker::BeginPeakScope()
+{
+  return PeakBytes.exchange(CurrentBytes.load(std::memory_order_relaxed));
+}
+
+//------------------------------------------------------------------------------
+vtkTypeInt64 vtkMemoryTracker::EndPeakScope(vtkTypeInt64 previousPeak)
+{
+  vtkTypeInt64 peak = PeakBytes.load(std::memory_order_relaxed);
+  UpdatePeak(previousPeak);
+  return peak;
+}
+
+//------------------------------------------------------------------------------
+vtkTypeInt64 vtkMemoryTracker::Allocated(vtkTypeInt64 bytes)
+{
+  if (!TrackerEnabled.load(std::memory_order_relaxed) || bytes <= 0)
+  {
+    return 0;
+  }
+  UpdatePeak(CurrentBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+  return bytes;
+}
+
+//------------------------------------------------------------------------------
+void vtkMemoryTracker::Freed(vtkTypeInt64 trackedBytes)
+{
+  if (trackedBytes > 0)
+  {
+    CurrentBytes.fetch_sub(trackedBytes, std::memory_order_relaxed);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkMemoryTracker::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Enabled: " << vtkMemoryTracker::GetEnabled() << "\n";
+  os << indent << "CurrentMemory: " << vtkMemoryTracker::GetCurrentMemory() << "\n";
+  os << indent << "PeakMemory: " << vtkMemoryTracker::GetPeakMemory() << "\n";
+}
+VTK_ABI_NAMESPACE_END
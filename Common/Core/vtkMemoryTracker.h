@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+/**
+ * @class   vtkMemoryTracker
+ * @brief   process-wide accounting of the memory allocated by vtkBuffer
+ *
+ * vtkMemoryTracker counts the bytes allocated and released by vtkBuffer, the
+ * storage of vtkAOSDataArrayTemplate and vtkSOADataArrayTemplate, and keeps
+ * the high watermark of the allocated bytes. Tracking is disabled by default
+ * and costs a single test per allocation when disabled. Memory allocated
+ * while tracking is disabled and memory set with vtkBuffer::SetBuffer() is
+ * not counted.
+ *
+ * The counters are shared by all the threads of the process. BeginPeakScope()
+ * and EndPeakScope() measure the peak reached within a section of code, e.g.
+ * the execution of an algorithm, and can be nested:
+ *
+ * @code{cpp}
+ * vtkTypeInt64 previousPeak = vtkMemoryTracker::BeginPeakScope();
+ * filter->Update();
+ * vtkTypeInt64 peak = vtkMemoryTracker::EndPeakScope(previousPeak);
+ * @endcode
+ *
+ * @sa
+ * vtkBuffer vtkExecutive::SetMemoryInstrumentation()
+ */
+
+#ifndef vtkMemoryTracker_h
+#define vtkMemoryTracker_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkObject.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKCOMMONCORE_EXPORT vtkMemoryTracker : public vtkObject
+{
+public:
+  static vtkMemoryTracker* New();
+  vtkTypeMacro(vtkMemoryTracker, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Enable/disable the tracking of allocations. Memory allocated while
+   * tracking is enabled is accounted for when released, even after tracking
+   * is disabled.
+   */
+  static void SetEnabled(bool enabled);
+  static bool GetEnabled();
+  ///@}
+
+  /**
+   * Return the number of tracked bytes currently allocated.
+   */
+  static vtkTypeInt64 GetCurrentMemory();
+
+  /**
+   * Return the largest number of tracked bytes allocated at once since the
+   * last call to ResetPeakMemory().
+   */
+  static vtkTypeInt64 GetPeakMemory();
+
+  /**
+   * Reset the peak memory to the current memory.
+   */
+  static void ResetPeakMemory();
+
+  ///@{
+  /**
+   * Measure the peak memory of a section of code. BeginPeakScope() resets the
+   * peak memory to the current memory and returns the previous peak, to be
+   * given to the matching EndPeakScope(). EndPeakScope() returns the peak
+   * memory reached since BeginPeakScope() and restores the peak memory of the
+   * enclosing scope, including the peak of this one.
+   */
+  static vtkTypeInt64 BeginPeakScope();
+  static vtkTypeInt64 EndPeakScope(vtkTypeInt64 previousPeak);
+  ///@}
+
+  ///@{
+  /**
+   * Hooks called by vtkBuffer. Allocated() returns the number of bytes
+   * tracked for the allocation, 0 when tracking is disabled, to be given to
+   * Freed() when the memory is released.
+   */
+  static vtkTypeInt64 Allocated(vtkTypeInt64 bytes);
+  static void Freed(vtkTypeInt64 trackedBytes);
+  ///@}
+
+protected:
+  vtkMemoryTracker() = default;
+  ~vtkMemoryTracker() override = default;
+
+private:
+  vtkMemoryTracker(const vtkMemoryTracker&) = delete;
+  void operator=(const vtkMemoryTracker&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
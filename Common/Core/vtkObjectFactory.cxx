@@ -12,11 +12,17 @@
 #include "vtksys/Directory.hxx"
 
 #include <cctype>
+#include <chrono>
+#include <mutex>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkObjectFactoryCollection* vtkObjectFactory::RegisteredFactories = nullptr;
 static unsigned int vtkObjectFactoryRegistryCleanupCounter = 0;
 
+// Serializes the lazy registration of the overrides, as objects may be created
+// from several threads.
+static std::mutex vtkObjectFactoryOverridesMutex;
+
 vtkObjectFactoryRegistryCleanup::vtkObjectFactoryRegistryCleanup()
 {
   ++vtkObjectFactoryRegistryCleanupCounter;
@@ -250,6 +256,8 @@ vtkObjectFactory::vtkObjectFactory()
   this->SizeOverrideArray = 0;
   this->OverrideArrayLength = 0;
   this->LibraryVTKVersion = nullptr;
+  this->OverridesInitialized = false;
+  this->RegistrationTime = 0.0;
 }
 
 // Unload the library and free the path string
@@ -398,6 +406,7 @@ void vtkObjectFactory::RegisterOverride(const char* classOverride, const char* s
 // Create an instance of an object
 vtkObject* vtkObjectFactory::CreateObject(const char* vtkclassname)
 {
+  this->InitializeOverrides();
   for (int i = 0; i < this->OverrideArrayLength; i++)
   {
     if (this->OverrideArray[i].EnabledFlag &&
@@ -409,6 +418,24 @@ vtkObject* vtkObjectFactory::CreateObject(const char* vtkclassname)
   return nullptr;
 }
 
+// Register the overrides of the factory the first time they are needed.
+void vtkObjectFactory::InitializeOverrides()
+{
+  if (this->OverridesInitialized.load(std::memory_order_acquire))
+  {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(vtkObjectFactoryOverridesMutex);
+  if (!this->OverridesInitialized.load(std::memory_order_relaxed))
+  {
+    auto start = std::chrono::steady_clock::now();
+    this->RegisterOverrides();
+    this->RegistrationTime =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    this->OverridesInitialized.store(true, std::memory_order_release);
+  }
+}
+
 // grow the array if the length is greater than the size.
 void vtkObjectFactory::GrowOverrideArray()
 {
@@ -431,26 +458,31 @@ void vtkObjectFactory::GrowOverrideArray()
 
 int vtkObjectFactory::GetNumberOfOverrides()
 {
+  this->InitializeOverrides();
   return this->OverrideArrayLength;
 }
 
 const char* vtkObjectFactory::GetClassOverrideName(int index)
 {
+  this->InitializeOverrides();
   return this->OverrideClassNames[index];
 }
 
 const char* vtkObjectFactory::GetClassOverrideWithName(int index)
 {
+  this->InitializeOverrides();
   return this->OverrideArray[index].OverrideWithName;
 }
 
 vtkTypeBool vtkObjectFactory::GetEnableFlag(int index)
 {
+  this->InitializeOverrides();
   return this->OverrideArray[index].EnabledFlag;
 }
 
 const char* vtkObjectFactory::GetOverrideDescription(int index)
 {
+  this->InitializeOverrides();
   return this->OverrideArray[index].Description;
 }
 
@@ -458,6 +490,7 @@ const char* vtkObjectFactory::GetOverrideDescription(int index)
 void vtkObjectFactory::SetEnableFlag(
   vtkTypeBool flag, const char* className, const char* subclassName)
 {
+  this->InitializeOverrides();
   for (int i = 0; i < this->OverrideArrayLength; i++)
   {
     if (strcmp(this->OverrideClassNames[i], className) == 0)
@@ -481,6 +514,7 @@ void vtkObjectFactory::SetEnableFlag(
 // Get the enable flag for a className/subclassName pair
 vtkTypeBool vtkObjectFactory::GetEnableFlag(const char* className, const char* subclassName)
 {
+  this->InitializeOverrides();
   for (int i = 0; i < this->OverrideArrayLength; i++)
   {
     if (strcmp(this->OverrideClassNames[i], className) == 0)
@@ -497,6 +531,7 @@ vtkTypeBool vtkObjectFactory::GetEnableFlag(const char* className, const char* s
 // Set the EnabledFlag to 0 for a given classname
 void vtkObjectFactory::Disable(const char* className)
 {
+  this->InitializeOverrides();
   for (int i = 0; i < this->OverrideArrayLength; i++)
   {
     if (strcmp(this->OverrideClassNames[i], className) == 0)
@@ -509,6 +544,7 @@ void vtkObjectFactory::Disable(const char* className)
 // 1,0 is the class overridden by className
 vtkTypeBool vtkObjectFactory::HasOverride(const char* className)
 {
+  this->InitializeOverrides();
   for (int i = 0; i < this->OverrideArrayLength; i++)
   {
     if (strcmp(this->OverrideClassNames[i], className) == 0)
@@ -522,6 +558,7 @@ vtkTypeBool vtkObjectFactory::HasOverride(const char* className)
 // 1,0 is the class overridden by className/subclassName pair
 vtkTypeBool vtkObjectFactory::HasOverride(const char* className, const char* subclassName)
 {
+  this->InitializeOverrides();
   for (int i = 0; i < this->OverrideArrayLength; i++)
   {
     if (strcmp(this->OverrideClassNames[i], className) == 0)
@@ -572,6 +609,7 @@ void vtkObjectFactory::GetOverrideInformation(
   vtkObjectFactory::RegisteredFactories->InitTraversal(osit);
   for (; (factory = vtkObjectFactory::RegisteredFactories->GetNextObjectFactory(osit));)
   {
+    factory->InitializeOverrides();
     for (int i = 0; i < factory->OverrideArrayLength; i++)
     {
       if (strcmp(name, factory->OverrideClassNames[i]) == 0)
@@ -620,6 +658,28 @@ void vtkObjectFactory::SetAllEnableFlags(
   }
 }
 
+// print the registration cost of the registered factories
+void vtkObjectFactory::PrintRegistrationReport(ostream& os)
+{
+  vtkObjectFactoryCollection* collection = vtkObjectFactory::GetRegisteredFactories();
+  os << "Registered object factories: " << collection->GetNumberOfItems() << "\n";
+  vtkObjectFactory* factory;
+  vtkCollectionSimpleIterator osit;
+  for (collection->InitTraversal(osit); (factory = collection->GetNextObjectFactory(osit));)
+  {
+    os << "  " << factory->GetDescription() << " ";
+    if (factory->OverridesInitialized.load(std::memory_order_acquire))
+    {
+      os << factory->OverrideArrayLength << " overrides registered in "
+         << factory->RegistrationTime * 1e3 << " ms\n";
+    }
+    else
+    {
+      os << "overrides pending registration\n";
+    }
+  }
+}
+
 void vtkObjectFactory::CreateAllInstance(const char* vtkclassname, vtkCollection* retList)
 {
   vtkObjectFactory* f;
@@ -31,6 +31,7 @@
 #include "vtkFeatures.h"          // For VTK_ALL_NEW_OBJECT_FACTORY
 #include "vtkObject.h"
 
+#include <atomic> // for std::atomic
 #include <string> // for std::string
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -109,6 +110,14 @@ public:
    */
   static void SetAllEnableFlags(vtkTypeBool flag, const char* className, const char* subclassName);
 
+  /**
+   * Print the registration cost of every registered factory: its number of
+   * overrides and the time spent registering them. Factories whose overrides
+   * are registered lazily and have not been queried yet are reported as
+   * pending, without registering their overrides.
+   */
+  static void PrintRegistrationReport(ostream& os);
+
   // Instance methods to be used on individual instances of vtkObjectFactory
 
   // Methods from vtkObject
@@ -193,6 +202,12 @@ public:
 
   typedef vtkObject* (*CreateFunction)();
 
+  /**
+   * Return the time in seconds spent in RegisterOverrides(), 0 if the
+   * overrides have not been registered yet.
+   */
+  double GetRegistrationTime() const { return this->RegistrationTime; }
+
 protected:
   /**
    * Register object creation information with the factory.
@@ -200,6 +215,15 @@ protected:
   void RegisterOverride(const char* classOverride, const char* overrideClassName,
     const char* description, int enableFlag, CreateFunction createFunction);
 
+  /**
+   * Register the overrides of the factory with RegisterOverride(). This is
+   * called once, the first time the overrides of the factory are needed, so
+   * that registering the factory at startup stays cheap. The factories
+   * generated by vtk_object_factory_configure() register their overrides here,
+   * others may instead register them in their constructor.
+   */
+  virtual void RegisterOverrides() {}
+
   /**
    * This method is provided by sub-classes of vtkObjectFactory.
    * It should create the named vtk object or return 0 if that object
@@ -226,6 +250,14 @@ protected:
 private:
   void GrowOverrideArray();
 
+  /**
+   * Call RegisterOverrides() if it has not been called yet.
+   */
+  void InitializeOverrides();
+
+  std::atomic<bool> OverridesInitialized;
+  double RegistrationTime;
+
   /**
    * Initialize the static members of vtkObjectFactory.   RegisterDefaults
    * is called here.
@@ -116,7 +116,10 @@ void vtkPoints::ComputeBounds()
 {
   if (this->GetMTime() > this->ComputeTime)
   {
-    this->Data->ComputeScalarRange(this->Bounds);
+    if (!this->Data->ComputeTrackedScalarRange(this->Bounds))
+    {
+      this->Data->ComputeScalarRange(this->Bounds);
+    }
     this->ComputeTime.Modified();
   }
 }
@@ -240,6 +240,16 @@ public:
    */
   void Modified() override;
 
+  /**
+   * Mark the points in [beginPoint, endPoint) as modified, instead of the
+   * whole points. See vtkDataArray::ModifiedTuples(). The bounds are then
+   * updated from the modified points only.
+   */
+  void ModifiedPoints(vtkIdType beginPoint, vtkIdType endPoint)
+  {
+    this->Data->ModifiedTuples(beginPoint, endPoint);
+  }
+
 protected:
   vtkPoints(int dataType = VTK_FLOAT);
   ~vtkPoints() override;
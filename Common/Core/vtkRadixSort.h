@@ -0,0 +1,201 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+/**
+ * @class   vtkRadixSort
+ * @brief   parallel radix sort of ids by numeric keys
+ *
+ * Provide templated functions that reorder a list of ids by the value of a
+ * key associated with each id, such as the depth of a cell along the view
+ * direction. SortIdsByKey is a stable least significant digit radix sort
+ * whose passes are split across threads with vtkSMPTools; its cost is linear
+ * in the number of ids, unlike the comparison sorts of vtkSMPTools::Sort or
+ * vtkSortDataArray. ResortIdsByKey exploits temporal coherence: when the ids
+ * are still almost sorted, for instance because they are the order of the
+ * previous frame and the camera barely moved, an insertion sort finishes the
+ * work in a single pass; otherwise it falls back to SortIdsByKey.
+ *
+ * Keys may be of any arithmetic type.
+ */
+
+#ifndef vtkRadixSort_h
+#define vtkRadixSort_h
+
+#include "vtkABINamespace.h"
+#include "vtkSMPTools.h"
+#include "vtkType.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace vtkRadixSort
+{
+VTK_ABI_NAMESPACE_BEGIN
+namespace detail
+{
+// Map the keys to unsigned integers with the same ordering as operator<.
+inline std::uint32_t ToRadixKey(float key)
+{
+  key += 0.0f; // -0 and +0 compare equal
+  std::uint32_t bits;
+  std::memcpy(&bits, &key, sizeof(bits));
+  return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+inline std::uint64_t ToRadixKey(double key)
+{
+  key += 0.0; // -0 and +0 compare equal
+  std::uint64_t bits;
+  std::memcpy(&bits, &key, sizeof(bits));
+  return (bits & 0x8000000000000000ull) ? ~bits : (bits | 0x8000000000000000ull);
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value,
+  typename std::make_unsigned<T>::type>::type
+ToRadixKey(T key)
+{
+  using UT = typename std::make_unsigned<T>::type;
+  return static_cast<UT>(static_cast<UT>(key) ^ (UT(1) << (8 * sizeof(T) - 1)));
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value, T>::type
+ToRadixKey(T key)
+{
+  return key;
+}
+}
+
+/**
+ * Reorder the n ids so that keys[ids[i]] is increasing, or decreasing when
+ * descending is true. Ids with equal keys keep their relative order.
+ */
+template <typename TKey>
+void SortIdsByKey(const TKey* keys, vtkIdType* ids, vtkIdType n, bool descending = false)
+{
+  using UKey = decltype(detail::ToRadixKey(TKey()));
+  constexpr int NumberOfBuckets = 256;
+  if (n < 2)
+  {
+    return;
+  }
+
+  std::vector<UKey> keys0(n);
+  std::vector<UKey> keys1(n);
+  std::vector<vtkIdType> ids1(n);
+  vtkSMPTools::For(0, n, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      const UKey key = detail::ToRadixKey(keys[ids[i]]);
+      keys0[i] = descending ? static_cast<UKey>(~key) : key;
+    }
+  });
+
+  // Each block is counted and scattered by a single thread, which keeps the
+  // passes stable.
+  const vtkIdType numberOfBlocks = std::max<vtkIdType>(1,
+    std::min<vtkIdType>(n / 16384, 4 * vtkSMPTools::GetEstimatedNumberOfThreads()));
+  const vtkIdType blockSize = (n + numberOfBlocks - 1) / numberOfBlocks;
+  std::vector<vtkIdType> offsets(numberOfBlocks * NumberOfBuckets);
+
+  UKey* srcKeys = keys0.data();
+  UKey* dstKeys = keys1.data();
+  vtkIdType* srcIds = ids;
+  vtkIdType* dstIds = ids1.data();
+  for (unsigned int shift = 0; shift < 8 * sizeof(UKey); shift += 8)
+  {
+    vtkSMPTools::For(0, numberOfBlocks, 1, [&](vtkIdType blockBegin, vtkIdType blockEnd) {
+      for (vtkIdType block = blockBegin; block < blockEnd; ++block)
+      {
+        vtkIdType* count = offsets.data() + block * NumberOfBuckets;
+        std::fill_n(count, NumberOfBuckets, 0);
+        const vtkIdType end = std::min(n, (block + 1) * blockSize);
+        for (vtkIdType i = block * blockSize; i < end; ++i)
+        {
+          ++count[(srcKeys[i] >> shift) & 0xff];
+        }
+      }
+    });
+
+    // Turn the counts into the position of the first key of each bucket and
+    // block, skipping the passes where all the keys fall in the same bucket.
+    vtkIdType sum = 0;
+    bool skip = false;
+    for (int bucket = 0; bucket < NumberOfBuckets && !skip; ++bucket)
+    {
+      const vtkIdType bucketBegin = sum;
+      for (vtkIdType block = 0; block < numberOfBlocks; ++block)
+      {
+        vtkIdType& offset = offsets[block * NumberOfBuckets + bucket];
+        const vtkIdType count = offset;
+        offset = sum;
+        sum += count;
+      }
+      skip = (sum - bucketBegin == n);
+    }
+    if (skip)
+    {
+      continue;
+    }
+
+    vtkSMPTools::For(0, numberOfBlocks, 1, [&](vtkIdType blockBegin, vtkIdType blockEnd) {
+      for (vtkIdType block = blockBegin; block < blockEnd; ++block)
+      {
+        vtkIdType* offset = offsets.data() + block * NumberOfBuckets;
+        const vtkIdType end = std::min(n, (block + 1) * blockSize);
+        for (vtkIdType i = block * blockSize; i < end; ++i)
+        {
+          const vtkIdType dst = offset[(srcKeys[i] >> shift) & 0xff]++;
+          dstKeys[dst] = srcKeys[i];
+          dstIds[dst] = srcIds[i];
+        }
+      }
+    });
+    std::swap(srcKeys, dstKeys);
+    std::swap(srcIds, dstIds);
+  }
+
+  if (srcIds != ids)
+  {
+    std::copy(srcIds, srcIds + n, ids);
+  }
+}
+
+/**
+ * Same as SortIdsByKey, but cheaper when the ids are already almost sorted.
+ * An insertion sort is tried first and abandoned, leaving the ids to
+ * SortIdsByKey, once it has moved more ids than there are.
+ */
+template <typename TKey>
+void ResortIdsByKey(const TKey* keys, vtkIdType* ids, vtkIdType n, bool descending = false)
+{
+  vtkIdType budget = n;
+  for (vtkIdType i = 1; i < n; ++i)
+  {
+    const vtkIdType id = ids[i];
+    const TKey key = keys[id];
+    vtkIdType j = i;
+    while (j > 0 && (descending ? keys[ids[j - 1]] < key : key < keys[ids[j - 1]]))
+    {
+      ids[j] = ids[j - 1];
+      --j;
+    }
+    ids[j] = id;
+    budget -= i - j;
+    if (budget < 0)
+    {
+      SortIdsByKey(keys, ids, n, descending);
+      return;
+    }
+  }
+}
+
+VTK_ABI_NAMESPACE_END
+} // End vtkRadixSort namespace.
+
+#endif // vtkRadixSort_h
+// VTK-HeaderTest-Exclude: vtkRadixSort.h
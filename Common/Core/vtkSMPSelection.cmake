@@ -127,17 +127,21 @@ endif()
 
 set(vtk_smp_common_dir SMP/Common)
 list(APPEND vtk_smp_sources
-  "${vtk_smp_common_dir}/vtkSMPToolsAPI.cxx")
+  "${vtk_smp_common_dir}/vtkSMPToolsAPI.cxx"
+  "${vtk_smp_common_dir}/vtkSMPToolsProfiler.cxx")
 list(APPEND vtk_smp_nowrap_headers
   "${vtk_smp_common_dir}/vtkSMPThreadLocalAPI.h"
   "${vtk_smp_common_dir}/vtkSMPThreadLocalImplAbstract.h"
   "${vtk_smp_common_dir}/vtkSMPToolsAPI.h"
   "${vtk_smp_common_dir}/vtkSMPToolsImpl.h"
-  "${vtk_smp_common_dir}/vtkSMPToolsInternal.h")
+  "${vtk_smp_common_dir}/vtkSMPToolsInternal.h"
+  "${vtk_smp_common_dir}/vtkSMPToolsProfiler.h")
 
 list(APPEND vtk_smp_sources
+  vtkSMPThreadLocalArena.cxx
   vtkSMPTools.cxx)
 list(APPEND vtk_smp_headers
   vtkSMPTools.h
   vtkSMPThreadLocal.h
+  vtkSMPThreadLocalArena.h
   vtkSMPThreadLocalObject.h)
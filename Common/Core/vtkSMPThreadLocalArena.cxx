@@ -0,0 +1,160 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkSMPThreadLocalArena.h"
+
+#include "vtkSMPThreadLocal.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+//------------------------------------------------------------------------------
+// Bump-pointer arena used by a single thread.
+class vtkArena
+{
+public:
+  explicit vtkArena(std::size_t blockSize = vtkSMPThreadLocalArena::DefaultBlockSize)
+    : BlockSize(blockSize)
+  {
+  }
+
+  // Only the configuration is copied: vtkSMPThreadLocal creates the thread
+  // local arenas as copies of its exemplar.
+  vtkArena(const vtkArena& other)
+    : BlockSize(other.BlockSize)
+  {
+  }
+
+  vtkArena& operator=(const vtkArena& other)
+  {
+    if (this != &other)
+    {
+      this->BlockSize = other.BlockSize;
+      this->Blocks.clear();
+      this->Offset = 0;
+    }
+    return *this;
+  }
+
+  void* Allocate(std::size_t numberOfBytes, std::size_t alignment)
+  {
+    if (!this->Blocks.empty())
+    {
+      if (void* ptr = this->AllocateInBlock(numberOfBytes, alignment))
+      {
+        return ptr;
+      }
+    }
+
+    std::size_t size = std::max(this->BlockSize, numberOfBytes + alignment);
+    this->Blocks.emplace_back(std::unique_ptr<unsigned char[]>(new unsigned char[size]), size);
+    this->Offset = 0;
+    return this->AllocateInBlock(numberOfBytes, alignment);
+  }
+
+  void Reset()
+  {
+    if (this->Blocks.size() > 1)
+    {
+      // The arena grew since the last reset: replace all the blocks by a
+      // single one so that the same workload fits without new allocations.
+      std::size_t capacity = this->GetCapacity();
+      this->Blocks.clear();
+      this->Blocks.emplace_back(
+        std::unique_ptr<unsigned char[]>(new unsigned char[capacity]), capacity);
+    }
+    this->Offset = 0;
+  }
+
+  std::size_t GetCapacity() const
+  {
+    std::size_t capacity = 0;
+    for (const auto& block : this->Blocks)
+    {
+      capacity += block.second;
+    }
+    return capacity;
+  }
+
+private:
+  // Allocate from the last block, return nullptr if it is too small.
+  void* AllocateInBlock(std::size_t numberOfBytes, std::size_t alignment)
+  {
+    auto& block = this->Blocks.back();
+    std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(block.first.get());
+    std::uintptr_t address = begin + this->Offset;
+    address = (address + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+    std::size_t offset = static_cast<std::size_t>(address - begin);
+    if (offset + numberOfBytes > block.second)
+    {
+      return nullptr;
+    }
+    this->Offset = offset + numberOfBytes;
+    return reinterpret_cast<void*>(address);
+  }
+
+  std::size_t BlockSize;
+  std::vector<std::pair<std::unique_ptr<unsigned char[]>, std::size_t>> Blocks;
+  std::size_t Offset = 0;
+};
+}
+
+//------------------------------------------------------------------------------
+struct vtkSMPThreadLocalArena::vtkInternals
+{
+  explicit vtkInternals(std::size_t blockSize)
+    : Arenas(vtkArena(blockSize))
+  {
+  }
+
+  vtkSMPThreadLocal<vtkArena> Arenas;
+};
+
+//------------------------------------------------------------------------------
+vtkSMPThreadLocalArena::vtkSMPThreadLocalArena(std::size_t blockSize)
+  : BlockSize(std::max<std::size_t>(blockSize, 1))
+  , Internals(new vtkInternals(this->BlockSize))
+{
+}
+
+//------------------------------------------------------------------------------
+vtkSMPThreadLocalArena::~vtkSMPThreadLocalArena() = default;
+
+//------------------------------------------------------------------------------
+void* vtkSMPThreadLocalArena::Allocate(std::size_t numberOfBytes, std::size_t alignment)
+{
+  return this->Internals->Arenas.Local().Allocate(
+    numberOfBytes, std::max<std::size_t>(alignment, 1));
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPThreadLocalArena::Reset()
+{
+  this->Internals->Arenas.Local().Reset();
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPThreadLocalArena::ResetAll()
+{
+  for (auto& arena : this->Internals->Arenas)
+  {
+    arena.Reset();
+  }
+}
+
+//------------------------------------------------------------------------------
+std::size_t vtkSMPThreadLocalArena::GetCapacity() const
+{
+  std::size_t capacity = 0;
+  for (const auto& arena : this->Internals->Arenas)
+  {
+    capacity += arena.GetCapacity();
+  }
+  return capacity;
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkSMPThreadLocalArena
+ * @brief   Thread local bump-pointer arena for scratch storage.
+ *
+ * vtkSMPThreadLocalArena maintains one memory arena per thread. Memory is
+ * handed out by bumping a pointer inside large blocks, so that functors
+ * that need many small temporary buffers (per cell or per batch) do not hit
+ * the global heap, and hence its locks, for each of them. Allocate() is
+ * thread safe as long as it is called from within a vtkSMPTools parallel
+ * section (or sequentially): each thread only touches its own arena.
+ *
+ * Memory is never released individually. Instead, Reset() recycles the
+ * arena of the calling thread, typically at the beginning of each batch
+ * processed by a functor, and ResetAll() recycles the arenas of all threads.
+ * When an arena had to grow during a batch, its blocks are coalesced in a
+ * single block on Reset() so that the next batches do not allocate anymore.
+ * All the memory is released when the vtkSMPThreadLocalArena is destroyed.
+ *
+ * Since no destructor is ever called on the allocated memory, only trivially
+ * destructible types can be allocated with the typed Allocate() overload.
+ *
+ * @code
+ * struct Functor
+ * {
+ *   vtkSMPThreadLocalArena Arena;
+ *
+ *   void operator()(vtkIdType begin, vtkIdType end)
+ *   {
+ *     this->Arena.Reset();
+ *     for (vtkIdType cellId = begin; cellId < end; ++cellId)
+ *     {
+ *       vtkIdType* ids = this->Arena.Allocate<vtkIdType>(GetCellSize(cellId));
+ *       [...]
+ *     }
+ *   }
+ * };
+ * @endcode
+ *
+ * @sa
+ * vtkSMPThreadLocal vtkSMPTools
+ */
+
+#ifndef vtkSMPThreadLocalArena_h
+#define vtkSMPThreadLocalArena_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkSystemIncludes.h"
+
+#include <cstddef>     // For std::size_t, std::max_align_t
+#include <memory>      // For std::unique_ptr
+#include <type_traits> // For std::is_trivially_destructible
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKCOMMONCORE_EXPORT vtkSMPThreadLocalArena
+{
+public:
+  /**
+   * Default size in bytes of the blocks allocated by each thread arena.
+   */
+  static constexpr std::size_t DefaultBlockSize = 1 << 20;
+
+  /**
+   * Construct an arena whose threads allocate blocks of `blockSize` bytes.
+   * Requests larger than `blockSize` get a block of their own.
+   */
+  explicit vtkSMPThreadLocalArena(std::size_t blockSize = DefaultBlockSize);
+  ~vtkSMPThreadLocalArena();
+
+  vtkSMPThreadLocalArena(const vtkSMPThreadLocalArena&) = delete;
+  vtkSMPThreadLocalArena& operator=(const vtkSMPThreadLocalArena&) = delete;
+
+  /**
+   * Allocate `numberOfBytes` bytes aligned on `alignment` from the arena of
+   * the calling thread. `alignment` must be a power of two. The memory is
+   * not initialized and stays valid until the next Reset() of this thread,
+   * ResetAll() or the destruction of the arena.
+   */
+  void* Allocate(std::size_t numberOfBytes, std::size_t alignment = alignof(std::max_align_t));
+
+  /**
+   * Allocate storage for `numberOfValues` values of type `T` from the arena of
+   * the calling thread. The values are not initialized.
+   */
+  template <typename T>
+  T* Allocate(std::size_t numberOfValues)
+  {
+    static_assert(std::is_trivially_destructible<T>::value,
+      "vtkSMPThreadLocalArena never calls destructors, T must be trivially destructible.");
+    return static_cast<T*>(this->Allocate(numberOfValues * sizeof(T), alignof(T)));
+  }
+
+  /**
+   * Recycle all the memory allocated by the calling thread. Pointers
+   * previously returned to this thread must not be used anymore.
+   */
+  void Reset();
+
+  /**
+   * Recycle the memory of all the threads. This is not thread safe and must
+   * be called outside of a parallel section.
+   */
+  void ResetAll();
+
+  /**
+   * Return the number of bytes reserved by the arenas of all the threads.
+   * This is not thread safe and must be called outside of a parallel section.
+   */
+  std::size_t GetCapacity() const;
+
+  /**
+   * Return the size of the blocks allocated by the thread arenas.
+   */
+  std::size_t GetBlockSize() const { return this->BlockSize; }
+
+private:
+  struct vtkInternals;
+
+  std::size_t BlockSize;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
+// VTK-HeaderTest-Exclude: vtkSMPThreadLocalArena.h
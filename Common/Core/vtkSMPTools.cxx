@@ -5,6 +5,12 @@
 
 #include "vtkSMP.h"
 
+#include <algorithm>          // For std::min, std::max
+#include <condition_variable> // For std::condition_variable
+#include <deque>              // For std::deque
+#include <exception>          // For std::exception_ptr
+#include <mutex>              // For std::mutex
+
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
 const char* vtkSMPTools::GetBackend()
@@ -61,4 +67,240 @@ bool vtkSMPTools::GetSingleThread()
   auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
   return SMPToolsAPI.GetSingleThread();
 }
+
+//------------------------------------------------------------------------------
+void vtkSMPTools::SetAdaptiveScheduling(bool isAdaptive)
+{
+  auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+  SMPToolsAPI.SetAdaptiveScheduling(isAdaptive);
+}
+
+//------------------------------------------------------------------------------
+bool vtkSMPTools::GetAdaptiveScheduling()
+{
+  auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+  return SMPToolsAPI.GetAdaptiveScheduling();
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPTools::SetNUMAAware(bool isNUMAAware)
+{
+  auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+  SMPToolsAPI.SetNUMAAware(isNUMAAware);
+}
+
+//------------------------------------------------------------------------------
+bool vtkSMPTools::GetNUMAAware()
+{
+  auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+  return SMPToolsAPI.GetNUMAAware();
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPTools::SetProfiling(bool isProfiling)
+{
+  auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+  SMPToolsAPI.SetProfiling(isProfiling);
+}
+
+//------------------------------------------------------------------------------
+bool vtkSMPTools::GetProfiling()
+{
+  auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+  return SMPToolsAPI.GetProfiling();
+}
+
+//------------------------------------------------------------------------------
+std::vector<vtkSMPTools::ForStatistics> vtkSMPTools::GetStatistics()
+{
+  auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+  return SMPToolsAPI.GetStatistics();
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPTools::ResetStatistics()
+{
+  auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+  SMPToolsAPI.ResetStatistics();
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPTools::SetMaximumNumberOfStatistics(std::size_t maximum)
+{
+  auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+  SMPToolsAPI.SetMaximumNumberOfStatistics(maximum);
+}
+
+//------------------------------------------------------------------------------
+std::size_t vtkSMPTools::GetMaximumNumberOfStatistics()
+{
+  auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+  return SMPToolsAPI.GetMaximumNumberOfStatistics();
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPTools::FirstTouch(void* buffer, std::size_t numberOfBytes)
+{
+  // Touching a byte every 4KiB is enough for any page size
+  const std::size_t pageSize = 4096;
+  const vtkIdType numberOfPages =
+    static_cast<vtkIdType>((numberOfBytes + pageSize - 1) / pageSize);
+  char* bytes = static_cast<char*>(buffer);
+  vtkSMPTools::For(0, numberOfPages, [bytes, pageSize](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType page = begin; page < end; ++page)
+    {
+      bytes[page * pageSize] = 0;
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+struct vtkSMPTools::TaskGraph::vtkInternals
+{
+  struct TaskNode
+  {
+    std::function<void()> Function;
+    std::vector<TaskId> Dependents;
+    std::size_t NumberOfDependencies = 0;
+  };
+
+  std::vector<TaskNode> Tasks;
+
+  // Execution state, only used during Execute()
+  std::mutex Mutex;
+  std::condition_variable ConditionVariable;
+  std::deque<TaskId> Ready;
+  std::vector<std::size_t> PendingDependencies;
+  std::size_t Remaining = 0;
+  std::exception_ptr Exception;
+
+  void RunTasks()
+  {
+    std::unique_lock<std::mutex> lock(this->Mutex);
+    while (true)
+    {
+      // Waiting only happens when other workers are running tasks, as every task that is not
+      // ready depends on an unfinished one.
+      this->ConditionVariable.wait(
+        lock, [this]() { return !this->Ready.empty() || this->Remaining == 0; });
+      if (this->Ready.empty())
+      {
+        return;
+      }
+
+      const TaskId id = this->Ready.front();
+      this->Ready.pop_front();
+      lock.unlock();
+
+      try
+      {
+        this->Tasks[id].Function();
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> exceptionLock(this->Mutex);
+        if (!this->Exception)
+        {
+          this->Exception = std::current_exception();
+        }
+      }
+
+      lock.lock();
+      bool notify = --this->Remaining == 0;
+      for (TaskId dependent : this->Tasks[id].Dependents)
+      {
+        if (--this->PendingDependencies[dependent] == 0)
+        {
+          this->Ready.push_back(dependent);
+          notify = true;
+        }
+      }
+      if (notify)
+      {
+        this->ConditionVariable.notify_all();
+      }
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+vtkSMPTools::TaskGraph::TaskGraph()
+  : Internals(new vtkInternals)
+{
+}
+
+//------------------------------------------------------------------------------
+vtkSMPTools::TaskGraph::~TaskGraph() = default;
+
+//------------------------------------------------------------------------------
+vtkSMPTools::TaskGraph::TaskId vtkSMPTools::TaskGraph::AddTask(
+  std::function<void()> task, const std::vector<TaskId>& dependencies)
+{
+  auto& tasks = this->Internals->Tasks;
+  const TaskId id = tasks.size();
+  tasks.emplace_back();
+  tasks.back().Function = std::move(task);
+
+  for (TaskId dependency : dependencies)
+  {
+    if (dependency >= id)
+    {
+      vtkGenericWarningMacro(
+        "Task " << id << " cannot depend on task " << dependency << ", dependency ignored.");
+      continue;
+    }
+    tasks[dependency].Dependents.push_back(id);
+    tasks.back().NumberOfDependencies++;
+  }
+  return id;
+}
+
+//------------------------------------------------------------------------------
+std::size_t vtkSMPTools::TaskGraph::GetNumberOfTasks() const
+{
+  return this->Internals->Tasks.size();
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPTools::TaskGraph::Execute()
+{
+  vtkInternals& internals = *this->Internals;
+  const std::size_t nbTasks = internals.Tasks.size();
+  if (nbTasks == 0)
+  {
+    return;
+  }
+
+  internals.PendingDependencies.resize(nbTasks);
+  for (std::size_t id = 0; id < nbTasks; ++id)
+  {
+    internals.PendingDependencies[id] = internals.Tasks[id].NumberOfDependencies;
+    if (internals.Tasks[id].NumberOfDependencies == 0)
+    {
+      internals.Ready.push_back(id);
+    }
+  }
+  internals.Remaining = nbTasks;
+  internals.Exception = nullptr;
+
+  // One worker per thread, each worker pulls ready tasks until the whole graph is done.
+  const vtkIdType nbWorkers = std::min(static_cast<vtkIdType>(nbTasks),
+    static_cast<vtkIdType>(std::max(vtkSMPTools::GetEstimatedNumberOfThreads(), 1)));
+  vtkSMPTools::For(0, nbWorkers, 1, [&internals](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType worker = begin; worker < end; ++worker)
+    {
+      internals.RunTasks();
+    }
+  });
+
+  std::exception_ptr exception = internals.Exception;
+  internals.Tasks.clear();
+  internals.PendingDependencies.clear();
+  internals.Ready.clear();
+  internals.Exception = nullptr;
+  if (exception)
+  {
+    std::rethrow_exception(exception);
+  }
+}
 VTK_ABI_NAMESPACE_END
@@ -24,8 +24,12 @@
 #include "SMP/Common/vtkSMPToolsAPI.h"
 #include "vtkSMPThreadLocal.h" // For Initialized
 
-#include <functional>  // For std::function
+#include <cstddef>     // For std::size_t
+#include <functional>  // For std::function, std::plus
+#include <iterator>    // For std::iterator_traits, std::next
+#include <memory>      // For std::unique_ptr
 #include <type_traits> // For std:::enable_if
+#include <vector>      // For std::vector
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 namespace vtk
@@ -429,6 +433,25 @@ public:
    */
   static bool GetNestedParallelism();
 
+  /**
+   * /!\ This method is not thread safe.
+   * If true, For calls that do not specify a grain (grain == 0) use an adaptive scheduling
+   * for the STDThread and OpenMP backends instead of a static partition of the range: the
+   * threads repeatedly claim the next chunk of the range, and the size of the chunks shrinks
+   * as the range drains (guided scheduling). Idle threads keep taking work from the shared
+   * range, which balances irregular workloads similarly to the TBB backend.
+   * TBB and Sequential are not affected since TBB already balances the load dynamically.
+   *
+   * Like nested parallelism, this setting applies to the current backend.
+   * Default to false.
+   */
+  static void SetAdaptiveScheduling(bool isAdaptive);
+
+  /**
+   * Get true if the adaptive scheduling is enabled for the current backend.
+   */
+  static bool GetAdaptiveScheduling();
+
   /**
    * Return true if it is called from a parallel scope.
    */
@@ -440,18 +463,101 @@ public:
    */
   static bool GetSingleThread();
 
+  /**
+   * /!\ This method is not thread safe.
+   * If true, enable the NUMA aware mode:
+   *    - For STDThread the threads of the pool are pinned to cores, so they do not migrate
+   *      from a NUMA node to another.
+   *    - The memory of AOS and SOA data arrays is touched in parallel right after its
+   *      allocation (see FirstTouch()), so pages are distributed on the NUMA nodes of the
+   *      threads that will later process them.
+   * For OpenMP, pinning is controlled by the OMP_PROC_BIND environment variable.
+   *
+   * VTK_SMP_NUMA_AWARE env variable can also be used to enable this mode.
+   * Default to false.
+   */
+  static void SetNUMAAware(bool isNUMAAware);
+
+  /**
+   * Get true if the NUMA aware mode is enabled.
+   */
+  static bool GetNUMAAware();
+
+  /**
+   * Write one byte of each memory page of the given buffer in parallel. Operating systems
+   * usually allocate physical pages on the NUMA node of the thread that first writes to them, so
+   * touching freshly allocated memory this way spreads it over the nodes the same way a
+   * vtkSMPTools::For over the buffer would. The content of the buffer is undefined afterwards.
+   */
+  static void FirstTouch(void* buffer, std::size_t numberOfBytes);
+
+  /**
+   * Statistics recorded for each vtkSMPTools::For call while profiling is enabled:
+   * backend, range size, requested grain, number of chunks, number of available and
+   * participating threads, wall time, per thread busy time and imbalance ratio (busy time
+   * of the busiest thread over the mean busy time of the available threads).
+   */
+  using ForStatistics = vtk::detail::smp::vtkSMPToolsForStatistics;
+
+  /**
+   * If true, each vtkSMPTools::For call records ForStatistics, which can be queried with
+   * GetStatistics() and are also logged by vtkLogger at the TRACE verbosity. Each executed
+   * chunk is timed, so this adds a small overhead to every call and should only be enabled to
+   * tune grain sizes or to investigate scaling issues. Nested calls are recorded too. Only
+   * the last GetMaximumNumberOfStatistics() records are kept.
+   *
+   * VTK_SMP_PROFILING env variable can also be used to enable profiling.
+   * Default to false.
+   */
+  static void SetProfiling(bool isProfiling);
+
+  /**
+   * Get true if profiling is enabled.
+   */
+  static bool GetProfiling();
+
+  /**
+   * Get the statistics of the For calls recorded since the last ResetStatistics(),
+   * in completion order. When more calls were recorded than the maximum number of
+   * statistics, only the most recent ones are returned.
+   */
+  static std::vector<ForStatistics> GetStatistics();
+
+  /**
+   * Discard all the recorded statistics.
+   */
+  static void ResetStatistics();
+
+  ///@{
+  /**
+   * Set/Get the maximum number of statistics kept while profiling. The records are
+   * stored in a ring buffer: once it is full, each new record replaces the oldest one,
+   * so that profiling a long-running application uses a bounded amount of memory.
+   * Reducing the maximum discards the oldest records in excess.
+   * Default to 1024.
+   */
+  static void SetMaximumNumberOfStatistics(std::size_t maximum);
+  static std::size_t GetMaximumNumberOfStatistics();
+  ///@}
+
   /**
    * Structure used to specify configuration for LocalScope() method.
    * Several parameters can be configured:
    *    - MaxNumberOfThreads set the maximum number of threads.
    *    - Backend set a specific SMPTools backend.
    *    - NestedParallelism, if true enable nested parallelism.
+   *    - NUMAAware, if true enable the NUMA aware mode (see SetNUMAAware()).
+   *    - AdaptiveScheduling, if true enable the adaptive scheduling
+   *      (see SetAdaptiveScheduling()).
    */
   struct Config
   {
     int MaxNumberOfThreads = 0;
     std::string Backend = vtk::detail::smp::vtkSMPToolsAPI::GetInstance().GetBackend();
     bool NestedParallelism = false;
+    bool NUMAAware = vtk::detail::smp::vtkSMPToolsAPI::GetInstance().GetNUMAAware();
+    bool AdaptiveScheduling =
+      vtk::detail::smp::vtkSMPToolsAPI::GetInstance().GetAdaptiveScheduling();
 
     Config() = default;
     Config(int maxNumberOfThreads)
@@ -472,11 +578,20 @@ public:
       , NestedParallelism(nestedParallelism)
     {
     }
+    Config(int maxNumberOfThreads, std::string backend, bool nestedParallelism, bool numaAware)
+      : MaxNumberOfThreads(maxNumberOfThreads)
+      , Backend(backend)
+      , NestedParallelism(nestedParallelism)
+      , NUMAAware(numaAware)
+    {
+    }
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
     Config(vtk::detail::smp::vtkSMPToolsAPI& API)
       : MaxNumberOfThreads(API.GetInternalDesiredNumberOfThread())
       , Backend(API.GetBackend())
       , NestedParallelism(API.GetNestedParallelism())
+      , NUMAAware(API.GetNUMAAware())
+      , AdaptiveScheduling(API.GetAdaptiveScheduling())
     {
     }
 #endif // DOXYGEN_SHOULD_SKIP_THIS
@@ -591,6 +706,173 @@ public:
     auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
     SMPToolsAPI.Sort(begin, end, comp);
   }
+
+  ///@{
+  /**
+   * A convenience method for computing prefix sums. It is a drop in replacement for
+   * std::inclusive_scan(): the i-th output value is the combination of the i first input
+   * values (and of init if given). The input and output ranges may be the same. The operation
+   * must be associative, it is applied in parallel on chunks of the input range. The default
+   * operation is the addition.
+   *
+   * Usage example with vtkDataArray:
+   * \code
+   * const auto counts = vtk::DataArrayValueRange<1>(countArray);
+   * auto offsets = vtk::DataArrayValueRange<1>(offsetArray);
+   * vtkSMPTools::InclusiveScan(counts.cbegin(), counts.cend(), offsets.begin());
+   * \endcode
+   */
+  template <typename InputIt, typename OutputIt>
+  static void InclusiveScan(InputIt inBegin, InputIt inEnd, OutputIt outBegin)
+  {
+    using ValueType = typename std::iterator_traits<InputIt>::value_type;
+    vtkSMPTools::InclusiveScan(inBegin, inEnd, outBegin, std::plus<ValueType>());
+  }
+
+  template <typename InputIt, typename OutputIt, typename BinaryOp>
+  static void InclusiveScan(InputIt inBegin, InputIt inEnd, OutputIt outBegin, BinaryOp op)
+  {
+    if (inBegin == inEnd)
+    {
+      return;
+    }
+    // The first value is the initial value of the scan of the remaining values
+    const typename std::iterator_traits<InputIt>::value_type init = *inBegin;
+    *outBegin = init;
+    vtkSMPTools::InclusiveScan(std::next(inBegin), inEnd, std::next(outBegin), op, init);
+  }
+
+  template <typename InputIt, typename OutputIt, typename BinaryOp, typename T>
+  static void InclusiveScan(InputIt inBegin, InputIt inEnd, OutputIt outBegin, BinaryOp op, T init)
+  {
+    auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+    SMPToolsAPI.InclusiveScan(inBegin, inEnd, outBegin, op, init);
+  }
+  ///@}
+
+  ///@{
+  /**
+   * A convenience method for computing prefix sums. It is a drop in replacement for
+   * std::exclusive_scan(): the i-th output value is the combination of init and of the i-1 first
+   * input values, which for instance converts counts to offsets. The input and output ranges may
+   * be the same. The operation must be associative, it is applied in parallel on chunks of the
+   * input range. The default operation is the addition.
+   *
+   * Usage example:
+   * \code
+   * std::vector<vtkIdType> counts = { 3, 1, 4, 1, 5 };
+   * std::vector<vtkIdType> offsets(counts.size());
+   * vtkSMPTools::ExclusiveScan(counts.begin(), counts.end(), offsets.begin(), 0);
+   * // offsets = { 0, 3, 4, 8, 9 }
+   * \endcode
+   */
+  template <typename InputIt, typename OutputIt, typename T>
+  static void ExclusiveScan(InputIt inBegin, InputIt inEnd, OutputIt outBegin, T init)
+  {
+    vtkSMPTools::ExclusiveScan(inBegin, inEnd, outBegin, init, std::plus<T>());
+  }
+
+  template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+  static void ExclusiveScan(InputIt inBegin, InputIt inEnd, OutputIt outBegin, T init, BinaryOp op)
+  {
+    auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+    SMPToolsAPI.ExclusiveScan(inBegin, inEnd, outBegin, init, op);
+  }
+  ///@}
+
+  ///@{
+  /**
+   * A convenience method for reducing data. It is a drop in replacement for std::reduce(), it
+   * returns the combination of init and of all the values of the range. The operation must be
+   * associative, but it does not need to be commutative as the partial results are combined in
+   * order. The default operation is the addition.
+   *
+   * Usage example with vtkDataArray:
+   * \code
+   * const auto range = vtk::DataArrayValueRange<1>(array);
+   * double sum = vtkSMPTools::Reduce(range.cbegin(), range.cend(), 0.0);
+   * double max = vtkSMPTools::Reduce(range.cbegin(), range.cend(), VTK_DOUBLE_MIN,
+   *   [](double a, double b) { return std::max(a, b); });
+   * \endcode
+   */
+  template <typename InputIt, typename T>
+  static T Reduce(InputIt begin, InputIt end, T init)
+  {
+    return vtkSMPTools::Reduce(begin, end, init, std::plus<T>());
+  }
+
+  template <typename InputIt, typename T, typename BinaryOp>
+  static T Reduce(InputIt begin, InputIt end, T init, BinaryOp op)
+  {
+    auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+    return SMPToolsAPI.Reduce(begin, end, init, op);
+  }
+  ///@}
+
+  /**
+   * A graph of tasks with dependencies, executed by the active backend.
+   *
+   * Tasks are registered with AddTask() and may depend on any task that was
+   * added before them, which guarantees that the graph is acyclic. Calling
+   * Execute() runs all the tasks using the threads of the active backend: a
+   * task is started as soon as all its dependencies are done, so independent
+   * chains (e.g. the per-block passes of a multi-pass algorithm) can progress
+   * without a global barrier between passes. Idle threads pick the next ready
+   * task from a shared queue, which balances irregular workloads.
+   *
+   * Usage example:
+   * \code
+   * vtkSMPTools::TaskGraph graph;
+   * std::vector<vtkSMPTools::TaskGraph::TaskId> counts;
+   * for (int block = 0; block < nbBlocks; ++block)
+   * {
+   *   counts.push_back(graph.AddTask([&, block]() { CountBlock(block); }));
+   * }
+   * auto scan = graph.AddTask([&]() { PrefixSum(); }, counts);
+   * for (int block = 0; block < nbBlocks; ++block)
+   * {
+   *   graph.AddTask([&, block]() { FillBlock(block); }, { scan });
+   * }
+   * graph.Execute();
+   * \endcode
+   *
+   * Tasks must not add tasks to the graph they belong to. If a task throws,
+   * the remaining tasks are still executed and the first exception is
+   * rethrown by Execute().
+   */
+  class VTKCOMMONCORE_EXPORT TaskGraph
+  {
+  public:
+    using TaskId = std::size_t;
+
+    TaskGraph();
+    ~TaskGraph();
+    TaskGraph(const TaskGraph&) = delete;
+    TaskGraph& operator=(const TaskGraph&) = delete;
+
+    /**
+     * Add a task to the graph. The task will not start before all the tasks
+     * listed in dependencies are done. Dependencies must be ids returned by
+     * previous calls to AddTask() on this graph, invalid ids are ignored with a
+     * warning. Returns the id of the new task.
+     */
+    TaskId AddTask(std::function<void()> task, const std::vector<TaskId>& dependencies = {});
+
+    /**
+     * Return the number of tasks waiting for Execute().
+     */
+    std::size_t GetNumberOfTasks() const;
+
+    /**
+     * Execute all the tasks added so far and return when they are all done.
+     * The graph is empty afterwards and can be filled again.
+     */
+    void Execute();
+
+  private:
+    struct vtkInternals;
+    std::unique_ptr<vtkInternals> Internals;
+  };
 };
 
 VTK_ABI_NAMESPACE_END
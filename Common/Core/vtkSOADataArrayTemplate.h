@@ -162,6 +162,17 @@ public:
   void SetArray(int comp, VTK_ZEROCOPY ValueType* array, vtkIdType size, bool updateMaxId = false,
     bool save = false, int deleteMethod = VTK_DATA_ARRAY_FREE);
 
+  /**
+   * Wrap externally owned memory as component @a comp without copying it.
+   * @a deleter is called with @a array once no array uses the memory anymore,
+   * an empty deleter meaning that the memory is never released by VTK. When
+   * @a readOnly is true, resizing the array copies the values into memory
+   * owned by the array instead of reallocating the external memory.
+   * \c updateMaxId and \c size have the same meaning as above.
+   */
+  void SetArray(int comp, ValueType* array, vtkIdType size, bool updateMaxId,
+    typename vtkBuffer<ValueType>::DeleterType deleter, bool readOnly = false);
+
   /**
    * This method allows the user to specify a custom free function to be
    * called when the array is deallocated. Calling this method will implicitly
@@ -185,6 +196,16 @@ public:
    */
   ValueType* GetComponentArrayPointer(int comp);
 
+  /**
+   * Return the reference counted buffer holding all the values when the
+   * array uses the AOS storage, nullptr when it uses the SOA storage. It can
+   * be shared with a vtkAOSDataArrayTemplate through its SetBuffer() method.
+   */
+  vtkBuffer<ValueType>* GetAOSBuffer()
+  {
+    return this->StorageType == StorageTypeEnum::AOS ? this->AoSData : nullptr;
+  }
+
   /**
    * Use of this method is discouraged, it creates a deep copy of the data into
    * a contiguous AoS-ordered buffer and prints a warning.
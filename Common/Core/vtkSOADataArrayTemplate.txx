@@ -12,11 +12,13 @@
 
 #include "vtkSOADataArrayTemplate.h"
 
+#include "vtkAOSDataArrayTemplate.h"
 #include "vtkArrayIteratorTemplate.h"
 #include "vtkBuffer.h"
 
 #include <array>
 #include <cassert>
+#include <utility>
 
 //-----------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
@@ -140,6 +142,29 @@ void vtkSOADataArrayTemplate<ValueType>::ShallowCopy(vtkDataArray* other)
     }
     this->DataChanged();
   }
+  else if (auto* aos = vtkAOSDataArrayTemplate<ValueType>::FastDownCast(other))
+  {
+    // Share the memory of AOS arrays by switching to the AOS storage instead
+    // of deep copying it.
+    this->ClearSOAData();
+    this->StorageType = StorageTypeEnum::AOS;
+    vtkBuffer<ValueType>* otherBuffer = aos->GetBuffer();
+    if (this->AoSData != otherBuffer)
+    {
+      otherBuffer->Register(nullptr);
+      if (this->AoSData)
+      {
+        this->AoSData->Delete();
+      }
+      this->AoSData = otherBuffer;
+    }
+    this->Size = other->GetSize();
+    this->MaxId = other->GetMaxId();
+    this->SetName(other->GetName());
+    this->SetNumberOfComponents(other->GetNumberOfComponents());
+    this->CopyComponentNames(other);
+    this->DataChanged();
+  }
   else
   {
     this->Superclass::ShallowCopy(other);
@@ -295,6 +320,50 @@ void vtkSOADataArrayTemplate<ValueType>::SetArray(
   this->DataChanged();
 }
 
+//-----------------------------------------------------------------------------
+template <class ValueType>
+void vtkSOADataArrayTemplate<ValueType>::SetArray(int comp, ValueType* array, vtkIdType size,
+  bool updateMaxId, typename vtkBuffer<ValueType>::DeleterType deleter, bool readOnly)
+{
+  const int numComps = this->GetNumberOfComponents();
+  if (comp >= numComps || comp < 0)
+  {
+    vtkErrorMacro("Invalid component number '"
+      << comp
+      << "' specified. "
+         "Use `SetNumberOfComponents` first to set the number of components.");
+    return;
+  }
+
+  if (this->StorageType == StorageTypeEnum::AOS && this->AoSData)
+  {
+    this->AoSData->Delete();
+    this->AoSData = nullptr;
+  }
+
+  while (this->Data.size() < static_cast<size_t>(numComps))
+  {
+    this->Data.push_back(vtkBuffer<ValueType>::New());
+  }
+
+  if (this->Data[comp]->GetReferenceCount() > 1)
+  {
+    // Do not change the memory of the arrays sharing the current buffer.
+    this->Data[comp]->Delete();
+    this->Data[comp] = vtkBuffer<ValueType>::New();
+  }
+  this->Data[comp]->SetBuffer(array, size, std::move(deleter), readOnly);
+
+  if (updateMaxId)
+  {
+    this->Size = numComps * size;
+    this->MaxId = this->Size - 1;
+  }
+  this->StorageType = StorageTypeEnum::SOA;
+
+  this->DataChanged();
+}
+
 //-----------------------------------------------------------------------------
 template <class ValueType>
 void vtkSOADataArrayTemplate<ValueType>::SetArrayFreeFunction(void (*callback)(void*))
@@ -354,14 +423,23 @@ bool vtkSOADataArrayTemplate<ValueType>::AllocateTuples(vtkIdType numTuples)
       {
         return false;
       }
+      if (vtkSMPTools::GetNUMAAware())
+      {
+        vtkSMPTools::FirstTouch(this->Data[cc]->GetBuffer(), numTuples * sizeof(ValueType));
+      }
     }
   }
   else
   {
-    if (!this->AoSData->Allocate(numTuples * this->GetNumberOfComponents()))
+    const vtkIdType numValues = numTuples * this->GetNumberOfComponents();
+    if (!this->AoSData->Allocate(numValues))
     {
       return false;
     }
+    if (vtkSMPTools::GetNUMAAware())
+    {
+      vtkSMPTools::FirstTouch(this->AoSData->GetBuffer(), numValues * sizeof(ValueType));
+    }
   }
   return true;
 }
@@ -0,0 +1,173 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkSharedMemorySegment.h"
+
+#include "vtkObjectFactory.h"
+
+#include <limits>
+
+#ifdef _WIN32
+#include "vtkWindows.h"
+#include <vtksys/Encoding.hxx>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkSharedMemorySegment);
+
+//------------------------------------------------------------------------------
+vtkSharedMemorySegment::vtkSharedMemorySegment() = default;
+
+//------------------------------------------------------------------------------
+vtkSharedMemorySegment::~vtkSharedMemorySegment()
+{
+  this->Close();
+}
+
+//------------------------------------------------------------------------------
+bool vtkSharedMemorySegment::Create(const char* name, vtkTypeUInt64 size)
+{
+  return this->Map(name, size, true, false);
+}
+
+//------------------------------------------------------------------------------
+bool vtkSharedMemorySegment::Open(const char* name, bool readOnly)
+{
+  return this->Map(name, 0, false, readOnly);
+}
+
+//------------------------------------------------------------------------------
+bool vtkSharedMemorySegment::Map(const char* name, vtkTypeUInt64 size, bool create, bool readOnly)
+{
+  this->Close();
+  if (!name || !*name ||
+    size > static_cast<vtkTypeUInt64>(std::numeric_limits<std::size_t>::max() / 2) ||
+    (create && size == 0))
+  {
+    return false;
+  }
+
+#ifdef _WIN32
+  std::wstring wideName = vtksys::Encoding::ToWide(name);
+  HANDLE mapping;
+  if (create)
+  {
+    mapping = CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+      static_cast<DWORD>(size >> 32), static_cast<DWORD>(size & 0xffffffff), wideName.c_str());
+    if (mapping && GetLastError() == ERROR_ALREADY_EXISTS)
+    {
+      // Named mappings cannot be replaced while another process uses them.
+      CloseHandle(mapping);
+      return false;
+    }
+  }
+  else
+  {
+    mapping = OpenFileMappingW(readOnly ? FILE_MAP_READ : FILE_MAP_WRITE, FALSE, wideName.c_str());
+  }
+  if (!mapping)
+  {
+    return false;
+  }
+  void* pointer = MapViewOfFile(mapping, readOnly ? FILE_MAP_READ : FILE_MAP_WRITE, 0, 0, 0);
+  if (!pointer)
+  {
+    CloseHandle(mapping);
+    return false;
+  }
+  if (!create)
+  {
+    // The size of the segment is the size of the region of the view.
+    MEMORY_BASIC_INFORMATION info;
+    VirtualQuery(pointer, &info, sizeof(info));
+    size = static_cast<vtkTypeUInt64>(info.RegionSize);
+  }
+  // The mapping object must stay open for the name to remain usable.
+  this->Handle = mapping;
+#else
+  if (create)
+  {
+    shm_unlink(name);
+  }
+  int fd = shm_open(name, create ? (O_CREAT | O_EXCL | O_RDWR) : (readOnly ? O_RDONLY : O_RDWR),
+    S_IRUSR | S_IWUSR);
+  if (fd < 0)
+  {
+    return false;
+  }
+  struct stat segmentStat;
+  if (create ? ftruncate(fd, static_cast<off_t>(size)) != 0
+             : (fstat(fd, &segmentStat) != 0 || segmentStat.st_size <= 0))
+  {
+    close(fd);
+    if (create)
+    {
+      shm_unlink(name);
+    }
+    return false;
+  }
+  if (!create)
+  {
+    size = static_cast<vtkTypeUInt64>(segmentStat.st_size);
+  }
+  void* pointer = mmap(nullptr, static_cast<std::size_t>(size),
+    readOnly ? PROT_READ : (PROT_READ | PROT_WRITE), MAP_SHARED, fd, 0);
+  // The mapping keeps a reference to the segment.
+  close(fd);
+  if (pointer == MAP_FAILED)
+  {
+    if (create)
+    {
+      shm_unlink(name);
+    }
+    return false;
+  }
+#endif
+
+  this->Pointer = pointer;
+  this->Size = size;
+  this->Name = name;
+  this->ReadOnly = readOnly;
+  this->Owner = create;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkSharedMemorySegment::Close()
+{
+  if (!this->Pointer)
+  {
+    return;
+  }
+#ifdef _WIN32
+  UnmapViewOfFile(this->Pointer);
+  CloseHandle(static_cast<HANDLE>(this->Handle));
+  this->Handle = nullptr;
+#else
+  munmap(this->Pointer, static_cast<std::size_t>(this->Size));
+  if (this->Owner)
+  {
+    shm_unlink(this->Name.c_str());
+  }
+#endif
+  this->Pointer = nullptr;
+  this->Size = 0;
+  this->Name.clear();
+  this->Owner = false;
+}
+
+//------------------------------------------------------------------------------
+void vtkSharedMemorySegment::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Name: " << this->Name << "\n";
+  os << indent << "Pointer: " << this->Pointer << "\n";
+  os << indent << "Size: " << this->Size << "\n";
+  os << indent << "ReadOnly: " << (this->ReadOnly ? "On" : "Off") << "\n";
+  os << indent << "Owner: " << (this->Owner ? "On" : "Off") << "\n";
+}
+VTK_ABI_NAMESPACE_END
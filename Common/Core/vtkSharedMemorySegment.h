@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+/**
+ * @class   vtkSharedMemorySegment
+ * @brief   named memory segment shared between processes
+ *
+ * vtkSharedMemorySegment creates or opens a named shared memory segment
+ * (POSIX shared memory object, named file mapping on Windows) and maps it in
+ * the address space of the process. Every process mapping the same name sees
+ * the same memory, which lets a process use values written by another one
+ * without copying them. See vtkSharedMemoryPublisher and
+ * vtkSharedMemoryProducer for sharing datasets.
+ *
+ * The segment created by Create() is removed when it is closed by the process
+ * that created it: processes still mapping it keep their mapping, but the name
+ * can no longer be opened. Names should start with a '/' and contain no other
+ * '/' to be portable across POSIX systems. On Windows, the segment exists as
+ * long as a process maps it and Create() fails when the name is in use.
+ *
+ * @warning
+ * vtkSharedMemorySegment does not synchronize accesses to the memory.
+ */
+
+#ifndef vtkSharedMemorySegment_h
+#define vtkSharedMemorySegment_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkObject.h"
+
+#include <string> // For std::string
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKCOMMONCORE_EXPORT vtkSharedMemorySegment : public vtkObject
+{
+public:
+  static vtkSharedMemorySegment* New();
+  vtkTypeMacro(vtkSharedMemorySegment, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Create a segment of @a size bytes named @a name and map it for reading
+   * and writing. A segment already existing with this name is replaced, see
+   * the class documentation for Windows. The memory is initialized to zero.
+   * The previous segment, if any, is closed first. Returns false when the
+   * system refuses to create the segment.
+   */
+  bool Create(const char* name, vtkTypeUInt64 size);
+
+  /**
+   * Map the existing segment named @a name. When @a readOnly is true, the
+   * mapped memory must not be written to. The previous segment, if any, is
+   * closed first. Returns false when no segment has this name.
+   */
+  bool Open(const char* name, bool readOnly = true);
+
+  /**
+   * Release the mapping, and remove the segment if it was created by this
+   * object. Pointers to the mapped memory become invalid.
+   */
+  void Close();
+
+  /**
+   * Return the address of the first byte of the segment, nullptr when nothing
+   * is mapped.
+   */
+  void* GetPointer() const { return this->Pointer; }
+
+  /**
+   * Return the size of the mapped segment, in bytes.
+   */
+  vtkTypeUInt64 GetSize() const { return this->Size; }
+
+  /**
+   * Return the name of the mapped segment, empty when nothing is mapped.
+   */
+  const std::string& GetName() const { return this->Name; }
+
+  /**
+   * Return true if the mapped memory is read-only.
+   */
+  bool GetReadOnly() const { return this->ReadOnly; }
+
+  /**
+   * Return true if the mapped segment was created by this object.
+   */
+  bool GetOwner() const { return this->Owner; }
+
+protected:
+  vtkSharedMemorySegment();
+  ~vtkSharedMemorySegment() override;
+
+private:
+  vtkSharedMemorySegment(const vtkSharedMemorySegment&) = delete;
+  void operator=(const vtkSharedMemorySegment&) = delete;
+
+  bool Map(const char* name, vtkTypeUInt64 size, bool create, bool readOnly);
+
+  void* Pointer = nullptr;
+  vtkTypeUInt64 Size = 0;
+  std::string Name;
+  bool ReadOnly = true;
+  bool Owner = false;
+#ifdef _WIN32
+  void* Handle = nullptr;
+#endif
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
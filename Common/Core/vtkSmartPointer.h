@@ -145,6 +145,29 @@ public:
   }
   ///@}
 
+  ///@{
+  /**
+   * Move the pointer from @a r into @a this, resetting @a r. This removes any
+   * reference to an old object, but does not add a reference to the new one.
+   */
+  // Need this since the compiler won't recognize template functions as
+  // assignment operators.
+  vtkSmartPointer& operator=(vtkSmartPointer&& r) noexcept
+  {
+    this->vtkSmartPointerBase::operator=(std::move(r));
+    return *this;
+  }
+
+  template <class U>
+  vtkSmartPointer& operator=(vtkSmartPointer<U>&& r) noexcept
+  {
+    vtkSmartPointer::CheckTypes<U>();
+
+    this->vtkSmartPointerBase::operator=(std::move(r));
+    return *this;
+  }
+  ///@}
+
   /**
    * Assign object to reference.  This removes any reference to an old
    * object.
@@ -158,6 +181,20 @@ public:
     return *this;
   }
 
+  /**
+   * Move the pointer from the vtkNew smart pointer into @a this, stealing its
+   * reference and resetting the vtkNew object to nullptr. This removes any
+   * reference to an old object.
+   */
+  template <typename U>
+  vtkSmartPointer& operator=(vtkNew<U>&& r) noexcept
+  {
+    vtkSmartPointer::CheckTypes<U>();
+
+    this->vtkSmartPointerBase::operator=(vtkSmartPointer<T>(std::move(r)));
+    return *this;
+  }
+
   /**
    * Assign object to reference.  This adds a new reference to an old
    * object.
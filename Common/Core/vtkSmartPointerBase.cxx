@@ -4,6 +4,8 @@
 
 #include "vtkGarbageCollector.h"
 
+#include <utility>
+
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
 vtkSmartPointerBase::vtkSmartPointerBase() noexcept
@@ -80,6 +82,18 @@ vtkSmartPointerBase& vtkSmartPointerBase::operator=(const vtkSmartPointerBase& r
   return *this;
 }
 
+//------------------------------------------------------------------------------
+vtkSmartPointerBase& vtkSmartPointerBase::operator=(vtkSmartPointerBase&& r) noexcept
+{
+  if (&r != this)
+  {
+    // The temporary steals the reference of r, then its destructor
+    // unreferences the old object once swapped.
+    vtkSmartPointerBase(std::move(r)).Swap(*this);
+  }
+  return *this;
+}
+
 //------------------------------------------------------------------------------
 void vtkSmartPointerBase::Report(vtkGarbageCollector* collector, const char* desc)
 {
@@ -60,6 +60,13 @@ public:
   vtkSmartPointerBase& operator=(const vtkSmartPointerBase& r);
   ///@}
 
+  /**
+   * Move the pointee from @a r into @a this, reset @a r and remove the
+   * reference to the old object. The reference held by @a r is transferred
+   * without registering the object again.
+   */
+  vtkSmartPointerBase& operator=(vtkSmartPointerBase&& r) noexcept;
+
   /**
    * Get the contained pointer.
    */
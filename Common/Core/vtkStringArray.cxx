@@ -20,7 +20,12 @@
 #include "vtkSortDataArray.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -32,6 +37,14 @@ VTK_ABI_NAMESPACE_BEGIN
 namespace
 {
 auto DefaultDeleteFunction = [](void* ptr) { delete[] reinterpret_cast<vtkStdString*>(ptr); };
+
+// Read a value without expanding a compact array.
+vtkStdString GetSourceValue(vtkStringArray* source, vtkIdType id)
+{
+  vtkIdType length;
+  const char* data = source->GetValueData(id, length);
+  return vtkStdString(data, static_cast<size_t>(length));
+}
 }
 
 //------------------------------------------------------------------------------
@@ -63,6 +76,156 @@ public:
   bool Rebuild;
 };
 
+//------------------------------------------------------------------------------
+// Values stored by vtkStringArray::Compact(): the characters of the entries,
+// each followed by a null character, and their offsets. The entries are the
+// values, or the distinct values when the array is dictionary encoded.
+class vtkStringArrayCompactStorage
+{
+public:
+  std::vector<char> Bytes;
+  std::vector<vtkIdType> Offsets{ 0 };
+  // Entry of each value when dictionary encoded, empty otherwise.
+  std::vector<vtkTypeInt32> Codes;
+  // First value of each entry when dictionary encoded.
+  std::vector<vtkIdType> FirstValues;
+
+  // Open addressing hash table of the distinct entries, built on the first
+  // lookup. Slots hold an entry or -1, and Next chains the entries equal to
+  // each other by increasing index (not dictionary encoded only).
+  std::vector<vtkIdType> Slots;
+  std::vector<vtkIdType> Next;
+
+  // The entries as strings, for the const GetValue(). They are built once, on
+  // the first call, so that concurrent readers never see the array change.
+  std::unique_ptr<vtkStdString[]> Strings;
+  std::once_flag StringsFlag;
+  std::atomic<bool> HasStrings{ false };
+
+  vtkIdType GetNumberOfEntries() const
+  {
+    return static_cast<vtkIdType>(this->Offsets.size()) - 1;
+  }
+
+  const char* GetEntry(vtkIdType entry, vtkIdType& length) const
+  {
+    length = this->Offsets[entry + 1] - this->Offsets[entry] - 1;
+    return this->Bytes.data() + this->Offsets[entry];
+  }
+
+  vtkIdType GetEntryOfValue(vtkIdType id) const
+  {
+    return this->Codes.empty() ? id : this->Codes[id];
+  }
+
+  void AppendEntry(const char* data, size_t length)
+  {
+    this->Bytes.insert(this->Bytes.end(), data, data + length);
+    this->Bytes.push_back('\0');
+    this->Offsets.push_back(static_cast<vtkIdType>(this->Bytes.size()));
+  }
+
+  bool EntryEquals(vtkIdType entry, const char* data, vtkIdType length) const
+  {
+    vtkIdType entryLength;
+    const char* entryData = this->GetEntry(entry, entryLength);
+    return entryLength == length && std::memcmp(entryData, data, static_cast<size_t>(length)) == 0;
+  }
+
+  // FNV-1a
+  static size_t Hash(const char* data, vtkIdType length)
+  {
+    vtkTypeUInt64 hash = 14695981039346656037ULL;
+    for (vtkIdType i = 0; i < length; ++i)
+    {
+      hash = (hash ^ static_cast<unsigned char>(data[i])) * 1099511628211ULL;
+    }
+    return static_cast<size_t>(hash);
+  }
+
+  void BuildIndex()
+  {
+    if (!this->Slots.empty())
+    {
+      return;
+    }
+    const vtkIdType numberOfEntries = this->GetNumberOfEntries();
+    size_t numberOfSlots = 16;
+    while (numberOfSlots < 2 * static_cast<size_t>(numberOfEntries))
+    {
+      numberOfSlots *= 2;
+    }
+    this->Slots.assign(numberOfSlots, -1);
+    if (this->Codes.empty())
+    {
+      this->Next.assign(numberOfEntries, -1);
+    }
+    // Insert the entries backward so that the chains are in increasing order.
+    for (vtkIdType entry = numberOfEntries - 1; entry >= 0; --entry)
+    {
+      vtkIdType length;
+      const char* data = this->GetEntry(entry, length);
+      size_t slot = Hash(data, length) & (numberOfSlots - 1);
+      while (this->Slots[slot] >= 0 && !this->EntryEquals(this->Slots[slot], data, length))
+      {
+        slot = (slot + 1) & (numberOfSlots - 1);
+      }
+      if (this->Slots[slot] >= 0)
+      {
+        this->Next[entry] = this->Slots[slot];
+      }
+      this->Slots[slot] = entry;
+    }
+  }
+
+  // Return the first entry equal to value, -1 if none.
+  vtkIdType FindEntry(const vtkStdString& value)
+  {
+    this->BuildIndex();
+    const vtkIdType length = static_cast<vtkIdType>(value.size());
+    const size_t mask = this->Slots.size() - 1;
+    size_t slot = Hash(value.data(), length) & mask;
+    while (this->Slots[slot] >= 0)
+    {
+      if (this->EntryEquals(this->Slots[slot], value.data(), length))
+      {
+        return this->Slots[slot];
+      }
+      slot = (slot + 1) & mask;
+    }
+    return -1;
+  }
+
+  const vtkStdString& GetString(vtkIdType id)
+  {
+    std::call_once(this->StringsFlag, [this]() {
+      const vtkIdType numberOfEntries = this->GetNumberOfEntries();
+      this->Strings.reset(new vtkStdString[numberOfEntries]);
+      for (vtkIdType entry = 0; entry < numberOfEntries; ++entry)
+      {
+        vtkIdType length;
+        const char* data = this->GetEntry(entry, length);
+        this->Strings[entry].assign(data, static_cast<size_t>(length));
+      }
+      this->HasStrings = true;
+    });
+    return this->Strings[this->GetEntryOfValue(id)];
+  }
+
+  size_t GetMemorySize() const
+  {
+    size_t size = this->Bytes.capacity() + sizeof(vtkIdType) * this->Offsets.capacity() +
+      sizeof(vtkTypeInt32) * this->Codes.capacity() +
+      sizeof(vtkIdType) *
+        (this->FirstValues.capacity() + this->Slots.capacity() + this->Next.capacity());
+    if (this->HasStrings)
+    {
+      size += (sizeof(vtkStdString) + 1) * this->GetNumberOfEntries() + this->Bytes.size();
+    }
+    return size;
+  }
+};
+
 vtkStandardNewMacro(vtkStringArray);
 vtkStandardExtendedNewMacro(vtkStringArray);
 
@@ -73,6 +236,7 @@ vtkStringArray::vtkStringArray()
   this->Array = nullptr;
   this->DeleteFunction = DefaultDeleteFunction;
   this->Lookup = nullptr;
+  this->CompactStorage = nullptr;
 }
 
 //------------------------------------------------------------------------------
@@ -84,11 +248,13 @@ vtkStringArray::~vtkStringArray()
     this->DeleteFunction(this->Array);
   }
   delete this->Lookup;
+  delete this->CompactStorage;
 }
 
 //------------------------------------------------------------------------------
 vtkArrayIterator* vtkStringArray::NewIterator()
 {
+  this->Expand();
   vtkArrayIteratorTemplate<vtkStdString>* iter = vtkArrayIteratorTemplate<vtkStdString>::New();
   iter->Initialize(this);
   return iter;
@@ -103,6 +269,7 @@ vtkArrayIterator* vtkStringArray::NewIterator()
 // from the suppled array.
 void vtkStringArray::SetArray(vtkStdString* array, vtkIdType size, int save, int deleteMethod)
 {
+  this->ReleaseCompactStorage();
   if (this->Array && this->DeleteFunction)
   {
     vtkDebugMacro(<< "Deleting the array...");
@@ -154,6 +321,7 @@ void vtkStringArray::SetArrayFreeFunction(void (*callback)(void*))
 
 vtkTypeBool vtkStringArray::Allocate(vtkIdType sz, vtkIdType)
 {
+  this->ReleaseCompactStorage();
   if (sz > this->Size)
   {
     if (this->DeleteFunction)
@@ -181,6 +349,7 @@ vtkTypeBool vtkStringArray::Allocate(vtkIdType sz, vtkIdType)
 
 void vtkStringArray::Initialize()
 {
+  this->ReleaseCompactStorage();
   if (this->DeleteFunction)
   {
     this->DeleteFunction(this->Array);
@@ -229,6 +398,8 @@ void vtkStringArray::DeepCopy(vtkAbstractArray* aa)
   {
     this->DeleteFunction(this->Array);
   }
+  this->Array = nullptr;
+  this->ReleaseCompactStorage();
 
   this->Superclass::DeepCopy(aa); // copy information objects.
 
@@ -237,6 +408,17 @@ void vtkStringArray::DeepCopy(vtkAbstractArray* aa)
   this->MaxId = fa->GetMaxId();
   this->Size = fa->GetSize();
   this->DeleteFunction = DefaultDeleteFunction;
+  if (fa->CompactStorage)
+  {
+    // Keep the copy compact, without its lookup index.
+    this->CompactStorage = new vtkStringArrayCompactStorage;
+    this->CompactStorage->Bytes = fa->CompactStorage->Bytes;
+    this->CompactStorage->Offsets = fa->CompactStorage->Offsets;
+    this->CompactStorage->Codes = fa->CompactStorage->Codes;
+    this->CompactStorage->FirstValues = fa->CompactStorage->FirstValues;
+    this->DataChanged();
+    return;
+  }
   this->Array = new vtkStdString[this->Size];
 
   for (int i = 0; i < this->Size; ++i)
@@ -321,6 +503,11 @@ void vtkStringArray::PrintSelf(ostream& os, vtkIndent indent)
   {
     os << indent << "Array: (null)\n";
   }
+  os << indent << "Compact: " << (this->CompactStorage ? "On" : "Off") << "\n";
+  if (this->CompactStorage)
+  {
+    os << indent << "DictionaryEncoded: " << (this->IsDictionaryEncoded() ? "On" : "Off") << "\n";
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -331,6 +518,8 @@ vtkStdString* vtkStringArray::ResizeAndExtend(vtkIdType sz)
   vtkStdString* newArray;
   vtkIdType newSize;
 
+  this->Expand();
+
   if (sz > this->Size)
   {
     // Requested size is bigger than current size.  Allocate enough
@@ -395,6 +584,8 @@ vtkTypeBool vtkStringArray::Resize(vtkIdType sz)
   vtkStdString* newArray;
   vtkIdType newSize = sz * this->NumberOfComponents;
 
+  this->Expand();
+
   if (newSize == this->Size)
   {
     return 1;
@@ -443,6 +634,7 @@ vtkTypeBool vtkStringArray::Resize(vtkIdType sz)
 //------------------------------------------------------------------------------
 vtkStdString* vtkStringArray::WritePointer(vtkIdType id, vtkIdType number)
 {
+  this->Expand();
   vtkIdType newSize = id + number;
   if (newSize > this->Size)
   {
@@ -459,6 +651,7 @@ vtkStdString* vtkStringArray::WritePointer(vtkIdType id, vtkIdType number)
 //------------------------------------------------------------------------------
 void vtkStringArray::InsertValue(vtkIdType id, vtkStdString f)
 {
+  this->Expand();
   if (id >= this->Size)
   {
     if (!this->ResizeAndExtend(id + 1))
@@ -477,6 +670,8 @@ void vtkStringArray::InsertValue(vtkIdType id, vtkStdString f)
 //------------------------------------------------------------------------------
 vtkIdType vtkStringArray::InsertNextValue(vtkStdString f)
 {
+  // Expand before MaxId counts the new value.
+  this->Expand();
   this->InsertValue(++this->MaxId, f);
   this->DataElementChanged(this->MaxId);
   return this->MaxId;
@@ -494,6 +689,12 @@ unsigned long vtkStringArray::GetActualMemorySize() const
   size_t totalSize = 0;
   size_t numPrims = static_cast<size_t>(this->GetSize());
 
+  if (this->CompactStorage)
+  {
+    totalSize = this->CompactStorage->GetMemorySize();
+    numPrims = 0;
+  }
+
   for (size_t i = 0; i < numPrims; ++i)
   {
     totalSize += sizeof(vtkStdString);
@@ -510,7 +711,9 @@ vtkIdType vtkStringArray::GetDataSize() const
   size_t numStrs = static_cast<size_t>(this->GetMaxId() + 1);
   for (size_t i = 0; i < numStrs; i++)
   {
-    size += this->Array[i].size() + 1;
+    vtkIdType length;
+    this->GetValueData(static_cast<vtkIdType>(i), length);
+    size += static_cast<size_t>(length) + 1;
     // (+1) for termination character.
   }
   return static_cast<vtkIdType>(size);
@@ -534,7 +737,7 @@ void vtkStringArray::SetTuple(vtkIdType i, vtkIdType j, vtkAbstractArray* source
   vtkIdType locj = j * sa->GetNumberOfComponents();
   for (vtkIdType cur = 0; cur < this->NumberOfComponents; cur++)
   {
-    this->SetValue(loci + cur, sa->GetValue(locj + cur));
+    this->SetValue(loci + cur, ::GetSourceValue(sa, locj + cur));
   }
   this->DataChanged();
 }
@@ -555,7 +758,7 @@ void vtkStringArray::InsertTuple(vtkIdType i, vtkIdType j, vtkAbstractArray* sou
   vtkIdType locj = j * sa->GetNumberOfComponents();
   for (vtkIdType cur = 0; cur < this->NumberOfComponents; cur++)
   {
-    this->InsertValue(loci + cur, sa->GetValue(locj + cur));
+    this->InsertValue(loci + cur, ::GetSourceValue(sa, locj + cur));
   }
   this->DataChanged();
 }
@@ -590,7 +793,7 @@ void vtkStringArray::InsertTuples(vtkIdList* dstIds, vtkIdList* srcIds, vtkAbstr
     vtkIdType dstLoc = dstIds->GetId(idIndex) * this->NumberOfComponents;
     while (numComp-- > 0)
     {
-      this->InsertValue(dstLoc++, sa->GetValue(srcLoc++));
+      this->InsertValue(dstLoc++, ::GetSourceValue(sa, srcLoc++));
     }
   }
 
@@ -623,7 +826,7 @@ void vtkStringArray::InsertTuplesStartingAt(
     vtkIdType dstLoc = (dstStart + idIndex) * this->NumberOfComponents;
     while (numComp-- > 0)
     {
-      this->InsertValue(dstLoc++, sa->GetValue(srcLoc++));
+      this->InsertValue(dstLoc++, ::GetSourceValue(sa, srcLoc++));
     }
   }
 
@@ -662,7 +865,7 @@ void vtkStringArray::InsertTuples(
     vtkIdType dstLoc = (dstStart + i) * this->NumberOfComponents;
     while (numComp-- > 0)
     {
-      this->InsertValue(dstLoc++, sa->GetValue(srcLoc++));
+      this->InsertValue(dstLoc++, ::GetSourceValue(sa, srcLoc++));
     }
   }
 
@@ -685,7 +888,7 @@ vtkIdType vtkStringArray::InsertNextTuple(vtkIdType j, vtkAbstractArray* source)
   vtkIdType locj = j * sa->GetNumberOfComponents();
   for (vtkIdType cur = 0; cur < this->NumberOfComponents; cur++)
   {
-    this->InsertNextValue(sa->GetValue(locj + cur));
+    this->InsertNextValue(::GetSourceValue(sa, locj + cur));
   }
   this->DataChanged();
   return (this->GetNumberOfTuples() - 1);
@@ -694,14 +897,140 @@ vtkIdType vtkStringArray::InsertNextTuple(vtkIdType j, vtkAbstractArray* source)
 //------------------------------------------------------------------------------
 const vtkStdString& vtkStringArray::GetValue(vtkIdType id) const
 {
+  if (this->CompactStorage)
+  {
+    return this->CompactStorage->GetString(id);
+  }
   return this->Array[id];
 }
 
 vtkStdString& vtkStringArray::GetValue(vtkIdType id)
 {
+  this->Expand();
   return this->Array[id];
 }
 
+//------------------------------------------------------------------------------
+const char* vtkStringArray::GetValueData(vtkIdType id, vtkIdType& length) const
+{
+  if (this->CompactStorage)
+  {
+    return this->CompactStorage->GetEntry(this->CompactStorage->GetEntryOfValue(id), length);
+  }
+  length = static_cast<vtkIdType>(this->Array[id].size());
+  return this->Array[id].c_str();
+}
+
+//------------------------------------------------------------------------------
+vtkVariant vtkStringArray::GetVariantValue(vtkIdType id)
+{
+  return vtkVariant(::GetSourceValue(this, id));
+}
+
+//------------------------------------------------------------------------------
+void vtkStringArray::Compact(bool dictionaryEncode)
+{
+  if (this->CompactStorage)
+  {
+    if (this->IsDictionaryEncoded() == dictionaryEncode)
+    {
+      return;
+    }
+    this->Expand();
+  }
+
+  const vtkIdType numberOfValues = this->MaxId + 1;
+  vtkStringArrayCompactStorage* storage = new vtkStringArrayCompactStorage;
+  if (dictionaryEncode)
+  {
+    std::unordered_map<std::string, vtkTypeInt32> codes;
+    storage->Codes.resize(numberOfValues);
+    for (vtkIdType i = 0; i < numberOfValues; ++i)
+    {
+      auto inserted =
+        codes.insert(std::make_pair(this->Array[i], static_cast<vtkTypeInt32>(codes.size())));
+      if (inserted.second)
+      {
+        if (codes.size() > static_cast<size_t>(VTK_TYPE_INT32_MAX))
+        {
+          // Too many distinct values for 32 bit codes.
+          delete storage;
+          this->Compact(false);
+          return;
+        }
+        storage->AppendEntry(this->Array[i].data(), this->Array[i].size());
+        storage->FirstValues.push_back(i);
+      }
+      storage->Codes[i] = inserted.first->second;
+    }
+  }
+  else
+  {
+    size_t numberOfBytes = 0;
+    for (vtkIdType i = 0; i < numberOfValues; ++i)
+    {
+      numberOfBytes += this->Array[i].size() + 1;
+    }
+    storage->Bytes.reserve(numberOfBytes);
+    storage->Offsets.reserve(numberOfValues + 1);
+    for (vtkIdType i = 0; i < numberOfValues; ++i)
+    {
+      storage->AppendEntry(this->Array[i].data(), this->Array[i].size());
+    }
+  }
+
+  if (this->DeleteFunction)
+  {
+    this->DeleteFunction(this->Array);
+  }
+  this->Array = nullptr;
+  this->DeleteFunction = DefaultDeleteFunction;
+  this->Size = numberOfValues;
+  this->CompactStorage = storage;
+  // The sorted lookup holds a copy of all the values.
+  this->ClearLookup();
+}
+
+//------------------------------------------------------------------------------
+void vtkStringArray::Expand()
+{
+  if (!this->CompactStorage)
+  {
+    return;
+  }
+
+  const vtkIdType numberOfValues = this->MaxId + 1;
+  vtkStdString* values = numberOfValues > 0 ? new vtkStdString[numberOfValues] : nullptr;
+  for (vtkIdType i = 0; i < numberOfValues; ++i)
+  {
+    vtkIdType length;
+    const char* data = this->GetValueData(i, length);
+    values[i].assign(data, static_cast<size_t>(length));
+  }
+  this->ReleaseCompactStorage();
+  this->Array = values;
+  this->Size = numberOfValues;
+  this->DeleteFunction = DefaultDeleteFunction;
+  this->DataChanged();
+}
+
+//------------------------------------------------------------------------------
+bool vtkStringArray::IsDictionaryEncoded() const
+{
+  return this->CompactStorage && !this->CompactStorage->Codes.empty();
+}
+
+//------------------------------------------------------------------------------
+void vtkStringArray::ReleaseCompactStorage()
+{
+  if (this->CompactStorage)
+  {
+    delete this->CompactStorage;
+    this->CompactStorage = nullptr;
+    this->Size = 0;
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkStringArray::GetTuples(vtkIdList* indices, vtkAbstractArray* aa)
 {
@@ -723,7 +1052,7 @@ void vtkStringArray::GetTuples(vtkIdList* indices, vtkAbstractArray* aa)
   for (vtkIdType i = 0; i < indices->GetNumberOfIds(); ++i)
   {
     vtkIdType index = indices->GetId(i);
-    output->SetValue(i, this->GetValue(index));
+    output->SetValue(i, ::GetSourceValue(this, index));
   }
 }
 
@@ -748,7 +1077,7 @@ void vtkStringArray::GetTuples(vtkIdType startIndex, vtkIdType endIndex, vtkAbst
   for (vtkIdType i = 0; i < (endIndex - startIndex) + 1; ++i)
   {
     vtkIdType index = startIndex + i;
-    output->SetValue(i, this->GetValue(index));
+    output->SetValue(i, ::GetSourceValue(this, index));
   }
 }
 
@@ -800,6 +1129,16 @@ void vtkStringArray::LookupValue(vtkVariant var, vtkIdList* ids)
 //------------------------------------------------------------------------------
 vtkIdType vtkStringArray::LookupValue(const vtkStdString& value)
 {
+  if (this->CompactStorage)
+  {
+    const vtkIdType entry = this->CompactStorage->FindEntry(value);
+    if (entry < 0 || this->CompactStorage->Codes.empty())
+    {
+      return entry;
+    }
+    return this->CompactStorage->FirstValues[entry];
+  }
+
   this->UpdateLookup();
 
   // First look into the cached updates, to see if there were any
@@ -870,8 +1209,34 @@ vtkIdType vtkStringArray::LookupValue(const vtkStdString& value)
 //------------------------------------------------------------------------------
 void vtkStringArray::LookupValue(const vtkStdString& value, vtkIdList* ids)
 {
-  this->UpdateLookup();
   ids->Reset();
+  if (this->CompactStorage)
+  {
+    vtkStringArrayCompactStorage* storage = this->CompactStorage;
+    const vtkIdType entry = storage->FindEntry(value);
+    if (entry >= 0 && storage->Codes.empty())
+    {
+      for (vtkIdType id = entry; id >= 0; id = storage->Next[id])
+      {
+        ids->InsertNextId(id);
+      }
+    }
+    else if (entry >= 0)
+    {
+      const vtkTypeInt32 code = static_cast<vtkTypeInt32>(entry);
+      const vtkIdType numberOfValues = this->GetNumberOfValues();
+      for (vtkIdType id = storage->FirstValues[entry]; id < numberOfValues; ++id)
+      {
+        if (storage->Codes[id] == code)
+        {
+          ids->InsertNextId(id);
+        }
+      }
+    }
+    return;
+  }
+
+  this->UpdateLookup();
 
   // First look into the cached updates, to see if there were any
   // cached changes. Find an equivalent element in the set of cached
@@ -928,7 +1293,7 @@ void vtkStringArray::DataChanged()
 //------------------------------------------------------------------------------
 void vtkStringArray::DataElementChanged(vtkIdType id)
 {
-  if (this->Lookup)
+  if (this->Lookup && !this->CompactStorage)
   {
     if (this->Lookup->Rebuild)
     {
@@ -955,6 +1320,13 @@ void vtkStringArray::ClearLookup()
 {
   delete this->Lookup;
   this->Lookup = nullptr;
+  if (this->CompactStorage)
+  {
+    this->CompactStorage->Slots.clear();
+    this->CompactStorage->Slots.shrink_to_fit();
+    this->CompactStorage->Next.clear();
+    this->CompactStorage->Next.shrink_to_fit();
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -8,6 +8,12 @@
  * Points and cells may sometimes have associated data that are stored
  * as strings, e.g. labels for information visualization projects.
  * This class provides a clean way to store and access those strings.
+ *
+ * Compact() stores the values contiguously instead of one vtkStdString per
+ * value, optionally encoding them with a dictionary of the distinct values.
+ * This saves most of the memory of columns of short or repeated strings while
+ * keeping the vtkStringArray API, see Compact() for the accessors that expand
+ * the array back.
  * @par Thanks:
  * Andy Wilson (atwilso@sandia.gov) wrote this class.
  */
@@ -20,6 +26,7 @@
 #include "vtkStdString.h"        // needed for vtkStdString definition
 
 VTK_ABI_NAMESPACE_BEGIN
+class vtkStringArrayCompactStorage;
 class vtkStringArrayLookup;
 
 class VTKCOMMONCORE_EXPORT vtkStringArray : public vtkAbstractArray
@@ -68,7 +75,13 @@ public:
    * Free any unnecessary memory.
    * Resize object to just fit data requirement. Reclaims extra memory.
    */
-  void Squeeze() override { this->ResizeAndExtend(this->MaxId + 1); }
+  void Squeeze() override
+  {
+    if (!this->CompactStorage)
+    {
+      this->ResizeAndExtend(this->MaxId + 1);
+    }
+  }
 
   /**
    * Resize the array while conserving the data.
@@ -176,6 +189,10 @@ public:
   void SetValue(vtkIdType id, vtkStdString value)
     VTK_EXPECTS(0 <= id && id < this->GetNumberOfValues())
   {
+    if (this->CompactStorage)
+    {
+      this->Expand();
+    }
     this->Array[id] = value;
     this->DataChanged();
   }
@@ -197,6 +214,20 @@ public:
    */
   vtkIdType GetNumberOfValues() const { return (this->MaxId + 1); }
 
+  /**
+   * Return the characters of the value at @a id and set @a length to their
+   * number, without expanding a compact array. The characters are followed by
+   * a null character and remain valid until the array is modified.
+   */
+  const char* GetValueData(vtkIdType id, vtkIdType& length) const
+    VTK_EXPECTS(0 <= id && id < this->GetNumberOfValues());
+
+  /**
+   * Return the value at @a id as a variant, without expanding a compact array.
+   */
+  vtkVariant GetVariantValue(vtkIdType valueIdx)
+    VTK_EXPECTS(0 <= valueIdx && valueIdx < GetNumberOfValues()) override;
+
   int GetNumberOfElementComponents() { return 0; }
   int GetElementComponentSize() const override
   {
@@ -238,7 +269,14 @@ public:
    * Get the address of a particular data index. Performs no checks
    * to verify that the memory has been allocated etc.
    */
-  vtkStdString* GetPointer(vtkIdType id) { return this->Array + id; }
+  vtkStdString* GetPointer(vtkIdType id)
+  {
+    if (this->CompactStorage)
+    {
+      this->Expand();
+    }
+    return this->Array + id;
+  }
   void* GetVoidPointer(vtkIdType id) override { return this->GetPointer(id); }
 
   /**
@@ -303,6 +341,32 @@ public:
    */
   vtkIdType GetDataSize() const override;
 
+  ///@{
+  /**
+   * Compact() stores the values contiguously, as the characters of all the
+   * values and their offsets, instead of one vtkStdString per value. With
+   * @a dictionaryEncode each distinct value is stored once, and each value is
+   * a 32 bit index into the distinct values: this suits categorical columns
+   * with few distinct values. Compact arrays use a hash index for
+   * LookupValue().
+   *
+   * A compact array is meant to be read. GetValueData(), GetVariantValue(),
+   * LookupValue(), the const GetValue() and copying its values to another
+   * array (SetTuple(), InsertTuples(), GetTuples(), DeepCopy()...) keep it
+   * compact. The first call to the const GetValue() builds a vtkStdString per
+   * stored value (per distinct value when dictionary encoded), once and
+   * thread safely, so that it can be called from several threads. Accessing
+   * the values through mutable references or pointers (the non-const
+   * GetValue(), GetPointer(), NewIterator()...) or modifying them first calls
+   * Expand(), which restores one vtkStdString per value. Expanding is not
+   * thread safe.
+   */
+  void Compact(bool dictionaryEncode = false);
+  void Expand();
+  bool IsCompact() const { return this->CompactStorage != nullptr; }
+  bool IsDictionaryEncoded() const;
+  ///@}
+
   ///@{
   /**
    * Return the indices where a specific value appears.
@@ -356,6 +420,9 @@ private:
 
   vtkStringArrayLookup* Lookup;
   void UpdateLookup();
+
+  vtkStringArrayCompactStorage* CompactStorage;
+  void ReleaseCompactStorage();
 };
 
 VTK_ABI_NAMESPACE_END
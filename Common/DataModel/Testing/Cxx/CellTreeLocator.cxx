@@ -5,7 +5,9 @@
 #include "vtkPointData.h"
 
 #include "vtkCellTreeLocator.h"
+#include "vtkMath.h"
 #include "vtkNew.h"
+#include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkSphereSource.h"
 
@@ -86,9 +88,74 @@ int TestWithCachedCellBoundsParameter(int cachedCellBounds)
   return EXIT_SUCCESS;
 }
 
+// Check that a refitted locator gives the same line intersections as a
+// locator built from scratch after the points moved.
+int TestRefitLocator(int cachedCellBounds)
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(100);
+  sphere->SetPhiResolution(100);
+  sphere->SetRadius(1.0);
+  sphere->Update();
+  vtkNew<vtkPolyData> polyData;
+  polyData->DeepCopy(sphere->GetOutput());
+
+  vtkNew<vtkCellTreeLocator> locator;
+  locator->SetDataSet(polyData);
+  locator->SetCacheCellBounds(cachedCellBounds);
+  locator->BuildLocator();
+
+  // Deform the sphere in an ellipsoid, and move it
+  vtkPoints* points = polyData->GetPoints();
+  double p[3];
+  for (vtkIdType i = 0; i < points->GetNumberOfPoints(); ++i)
+  {
+    points->GetPoint(i, p);
+    points->SetPoint(i, 1.5 * p[0] + 0.2, p[1], 0.8 * p[2] - 0.1);
+  }
+  points->Modified();
+
+  if (!locator->RefitLocator())
+  {
+    std::cerr << "vtkCellTreeLocator::RefitLocator failed." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkCellTreeLocator> reference;
+  reference->SetDataSet(polyData);
+  reference->SetCacheCellBounds(cachedCellBounds);
+  reference->BuildLocator();
+
+  vtkNew<vtkGenericCell> cell;
+  double p1[3], p2[3], t, refT, x[3], pcoords[3];
+  int subId;
+  vtkIdType cellId, refCellId;
+  for (int i = 0; i < 200; ++i)
+  {
+    p1[0] = vtkMath::Random(-4.0, 4.0);
+    p1[1] = vtkMath::Random(-4.0, 4.0);
+    p1[2] = 4.0;
+    p2[0] = vtkMath::Random(-1.0, 1.0);
+    p2[1] = vtkMath::Random(-1.0, 1.0);
+    p2[2] = -4.0;
+    int hit = locator->IntersectWithLine(p1, p2, 0.0, t, x, pcoords, subId, cellId, cell);
+    int refHit =
+      reference->IntersectWithLine(p1, p2, 0.0, refT, x, pcoords, subId, refCellId, cell);
+    if (hit != refHit || (hit && std::abs(t - refT) > 1e-10))
+    {
+      std::cerr << "Refitted locator intersection differs: " << cellId << " - " << refCellId
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
+
 int CellTreeLocator(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
 {
   int retVal = TestWithCachedCellBoundsParameter(0);
   retVal += TestWithCachedCellBoundsParameter(1);
+  retVal += TestRefitLocator(0);
+  retVal += TestRefitLocator(1);
   return retVal;
 }
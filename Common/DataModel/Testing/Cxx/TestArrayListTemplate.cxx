@@ -4,13 +4,97 @@
 #include "vtkAbstractArray.h"
 #include "vtkArrayListTemplate.h"
 #include "vtkCellData.h"
+#include "vtkDoubleArray.h"
 #include "vtkGeometryFilter.h"
 #include "vtkImageData.h"
+#include "vtkIntArray.h"
 #include "vtkLogger.h"
 #include "vtkNew.h"
+#include "vtkPointData.h"
 #include "vtkRTAnalyticSource.h"
 #include "vtkStringArray.h"
 
+namespace
+{
+// Check that the batched operations give the same results as the per-tuple ones.
+bool TestBatchedOperations()
+{
+  const vtkIdType numInPts = 10;
+  vtkNew<vtkDoubleArray> vectors;
+  vectors->SetName("Vectors");
+  vectors->SetNumberOfComponents(3);
+  vectors->SetNumberOfTuples(numInPts);
+  vtkNew<vtkIntArray> ints;
+  ints->SetName("Ints");
+  ints->SetNumberOfTuples(numInPts);
+  for (vtkIdType i = 0; i < numInPts; ++i)
+  {
+    vectors->SetTuple3(i, i, 2.0 * i, -3.0 * i);
+    ints->SetValue(i, static_cast<int>(10 * i));
+  }
+  vtkNew<vtkPointData> inPD;
+  inPD->AddArray(vectors);
+  inPD->AddArray(ints);
+
+  const vtkIdType numOutPts = 4;
+  const vtkIdType v0s[numOutPts] = { 0, 2, 9, 5 };
+  const vtkIdType v1s[numOutPts] = { 1, 7, 3, 5 };
+  const double ts[numOutPts] = { 0.5, 0.2, 1.0, 0.3 };
+  const vtkIdType outIds[numOutPts] = { 3, 0, 2, 1 };
+
+  vtkNew<vtkPointData> serialPD;
+  serialPD->InterpolateAllocate(inPD, numOutPts);
+  ArrayList serialArrays;
+  serialArrays.AddArrays(numOutPts, inPD, serialPD, 0.0, false);
+  vtkNew<vtkPointData> batchPD;
+  batchPD->InterpolateAllocate(inPD, numOutPts);
+  ArrayList batchArrays;
+  batchArrays.AddArrays(numOutPts, inPD, batchPD, 0.0, false);
+
+  ArrayList::EdgeBatch batch(&batchArrays, 3);
+  for (vtkIdType i = 0; i < numOutPts; ++i)
+  {
+    serialArrays.InterpolateEdge(v0s[i], v1s[i], ts[i], outIds[i]);
+    batch.Add(v0s[i], v1s[i], ts[i], outIds[i]);
+  }
+  batch.Flush();
+  if (batch.GetNumberOfEdges() != 0)
+  {
+    vtkLog(ERROR, "ArrayList::EdgeBatch should be empty after Flush().");
+    return false;
+  }
+
+  for (int a = 0; a < 2; ++a)
+  {
+    vtkDataArray* serial = serialPD->GetArray(a);
+    vtkDataArray* batched = batchPD->GetArray(a);
+    for (vtkIdType i = 0; i < numOutPts * serial->GetNumberOfComponents(); ++i)
+    {
+      if (serial->GetVariantValue(i) != batched->GetVariantValue(i))
+      {
+        vtkLog(ERROR, "ArrayList::InterpolateEdges() differs from InterpolateEdge().");
+        return false;
+      }
+    }
+  }
+
+  batchArrays.CopyTuples(numOutPts, v0s, 0);
+  for (vtkIdType i = 0; i < numOutPts; ++i)
+  {
+    double expected[3];
+    vectors->GetTuple(v0s[i], expected);
+    double* copied = batchPD->GetArray("Vectors")->GetTuple3(i);
+    if (copied[0] != expected[0] || copied[1] != expected[1] || copied[2] != expected[2] ||
+      batchPD->GetArray("Ints")->GetComponent(i, 0) != ints->GetValue(v0s[i]))
+    {
+      vtkLog(ERROR, "ArrayList::CopyTuples() did not gather the right tuples.");
+      return false;
+    }
+  }
+  return true;
+}
+}
+
 int TestArrayListTemplate(int, char*[])
 {
   int retVal = EXIT_SUCCESS;
@@ -40,5 +124,10 @@ int TestArrayListTemplate(int, char*[])
     retVal = EXIT_FAILURE;
   }
 
+  if (!::TestBatchedOperations())
+  {
+    retVal = EXIT_FAILURE;
+  }
+
   return retVal;
 }
@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that vtk::ForEachCell visits the cells of unstructured grids (with 32
+// and 64 bit cell arrays), polydata and image data with the same types and
+// point ids as vtkDataSet::GetCellType() and vtkDataSet::GetCellPoints().
+
+#include "vtkCellArray.h"
+#include "vtkForEachCell.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+bool CheckCells(vtkDataSet* dataSet, const char* name)
+{
+  vtkNew<vtkGenericCell> cell;
+  dataSet->GetCell(0, cell);
+
+  const vtkIdType numberOfCells = dataSet->GetNumberOfCells();
+  vtkIdType numberOfVisitedCells = 0;
+  bool success = true;
+  vtkNew<vtkIdList> ptIds;
+  // visit the cells in a few ranges, like vtkSMPTools::For() would
+  for (vtkIdType begin = 0; begin < numberOfCells; begin += 3)
+  {
+    const vtkIdType end = std::min(begin + 3, numberOfCells);
+    vtk::ForEachCell(dataSet, begin, end,
+      [&](vtkIdType cellId, int cellType, vtkIdType npts, const vtkIdType* pts) {
+        ++numberOfVisitedCells;
+        dataSet->GetCellPoints(cellId, ptIds);
+        if (cellType != dataSet->GetCellType(cellId) || npts != ptIds->GetNumberOfIds())
+        {
+          success = false;
+          return;
+        }
+        for (vtkIdType i = 0; i < npts; ++i)
+        {
+          success &= pts[i] == ptIds->GetId(i);
+        }
+      });
+  }
+  if (!success || numberOfVisitedCells != numberOfCells)
+  {
+    std::cerr << "The cells of the " << name << " are not visited as expected." << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestForEachCell(int, char*[])
+{
+  vtkNew<vtkPoints> points;
+  for (int i = 0; i < 12; ++i)
+  {
+    points->InsertNextPoint(i % 3, (i / 3) % 2, i / 6);
+  }
+
+  vtkNew<vtkUnstructuredGrid> grid;
+  grid->SetPoints(points);
+  grid->Allocate(8);
+  const vtkIdType hex[8] = { 0, 1, 4, 3, 6, 7, 10, 9 };
+  const vtkIdType tetra[4] = { 1, 2, 5, 8 };
+  const vtkIdType quad[4] = { 6, 7, 10, 9 };
+  const vtkIdType line[2] = { 2, 11 };
+  const vtkIdType vertex[1] = { 5 };
+  grid->InsertNextCell(VTK_HEXAHEDRON, 8, hex);
+  grid->InsertNextCell(VTK_TETRA, 4, tetra);
+  grid->InsertNextCell(VTK_QUAD, 4, quad);
+  grid->InsertNextCell(VTK_EMPTY_CELL, 0, nullptr);
+  grid->InsertNextCell(VTK_LINE, 2, line);
+  grid->InsertNextCell(VTK_VERTEX, 1, vertex);
+  grid->InsertNextCell(VTK_TETRA, 4, tetra);
+  if (!CheckCells(grid, "unstructured grid"))
+  {
+    return EXIT_FAILURE;
+  }
+  grid->GetCells()->ConvertTo32BitStorage();
+  if (!CheckCells(grid, "unstructured grid with 32 bit storage"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkPolyData> polyData;
+  polyData->SetPoints(points);
+  vtkNew<vtkCellArray> verts, lines, polys;
+  verts->InsertNextCell(1, vertex);
+  lines->InsertNextCell(2, line);
+  polys->InsertNextCell(4, quad);
+  polys->InsertNextCell(3, tetra);
+  polyData->SetVerts(verts);
+  polyData->SetLines(lines);
+  polyData->SetPolys(polys);
+  if (!CheckCells(polyData, "polydata"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(4, 3, 2);
+  if (!CheckCells(image, "image data"))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
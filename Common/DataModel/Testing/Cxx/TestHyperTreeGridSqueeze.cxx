@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that squeezing a vtkHyperTreeGrid compacts the storage of its trees
+// without changing their structure nor their global indices.
+
+#include "vtkHyperTree.h"
+#include "vtkHyperTreeGridNonOrientedCursor.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkUniformHyperTreeGrid.h"
+
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+// Subdivide the first child of every level down to the given depth, giving
+// the vertices explicit global indices from their local ones
+void BuildTree(
+  vtkHyperTreeGridNonOrientedCursor* cursor, vtkIdType start, vtkIdType step, unsigned int depth)
+{
+  cursor->SetGlobalIndexFromLocal(start + step * cursor->GetVertexId());
+  if (cursor->GetLevel() == depth)
+  {
+    return;
+  }
+  cursor->SubdivideLeaf();
+  for (unsigned char child = 0; child < cursor->GetNumberOfChildren(); ++child)
+  {
+    cursor->ToChild(child);
+    if (child == 0)
+    {
+      BuildTree(cursor, start, step, depth);
+    }
+    else
+    {
+      cursor->SetGlobalIndexFromLocal(start + step * cursor->GetVertexId());
+    }
+    cursor->ToParent();
+  }
+}
+
+struct TreeState
+{
+  std::vector<vtkIdType> GlobalIndices;
+  std::vector<bool> Leaves;
+  vtkIdType GlobalIndexMax;
+};
+
+TreeState GetState(vtkHyperTree* tree)
+{
+  TreeState state;
+  for (vtkIdType index = 0; index < tree->GetNumberOfVertices(); ++index)
+  {
+    state.GlobalIndices.push_back(tree->GetGlobalIndexFromLocal(index));
+    state.Leaves.push_back(tree->IsLeaf(index));
+  }
+  state.GlobalIndexMax = tree->GetGlobalNodeIndexMax();
+  return state;
+}
+}
+
+int TestHyperTreeGridSqueeze(int, char*[])
+{
+  vtkNew<vtkUniformHyperTreeGrid> htg;
+  htg->SetBranchFactor(2);
+  htg->SetDimensions(3, 2, 1);
+
+  // Consecutive global indices for the first tree, spread ones for the second
+  vtkNew<vtkHyperTreeGridNonOrientedCursor> cursor;
+  htg->InitializeNonOrientedCursor(cursor, 0, true);
+  BuildTree(cursor, 0, 1, 4);
+  const vtkIdType start = htg->GetTree(0)->GetNumberOfVertices();
+  htg->InitializeNonOrientedCursor(cursor, 1, true);
+  BuildTree(cursor, start, 3, 4);
+  const vtkIdType next = start + 3 * htg->GetTree(1)->GetNumberOfVertices();
+
+  std::vector<TreeState> states;
+  for (vtkIdType treeId = 0; treeId < 2; ++treeId)
+  {
+    states.push_back(GetState(htg->GetTree(treeId)));
+  }
+  const unsigned long memorySize = htg->GetActualMemorySizeBytes();
+
+  htg->Squeeze();
+
+  if (htg->GetActualMemorySizeBytes() >= memorySize)
+  {
+    vtkLog(ERROR,
+      "Storage not compacted: " << htg->GetActualMemorySizeBytes() << " bytes instead of less than "
+                                << memorySize);
+    return EXIT_FAILURE;
+  }
+  for (vtkIdType treeId = 0; treeId < 2; ++treeId)
+  {
+    const TreeState state = GetState(htg->GetTree(treeId));
+    if (state.GlobalIndices != states[treeId].GlobalIndices ||
+      state.Leaves != states[treeId].Leaves ||
+      state.GlobalIndexMax != states[treeId].GlobalIndexMax)
+    {
+      vtkLog(ERROR, "Tree " << treeId << " changed when squeezed");
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The compacted explicit indices can still be extended
+  htg->InitializeNonOrientedCursor(cursor, 1, false);
+  cursor->ToChild(1);
+  cursor->SubdivideLeaf();
+  for (unsigned char child = 0; child < cursor->GetNumberOfChildren(); ++child)
+  {
+    cursor->ToChild(child);
+    cursor->SetGlobalIndexFromLocal(next + child);
+    cursor->ToParent();
+  }
+  vtkHyperTree* tree = htg->GetTree(1);
+  const std::size_t numVertices = states[1].GlobalIndices.size();
+  if (tree->GetGlobalIndexFromLocal(1) != states[1].GlobalIndices[1] ||
+    tree->GetGlobalIndexFromLocal(numVertices) != next ||
+    tree->GetGlobalNodeIndexMax() != next + cursor->GetNumberOfChildren() - 1)
+  {
+    vtkLog(ERROR, "Wrong global indices after subdividing a squeezed tree");
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the batch evaluation of the implicit functions matches the
+// evaluation of each point.
+
+#include "vtkBox.h"
+#include "vtkCylinder.h"
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkImplicitBoolean.h"
+#include "vtkMath.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPlanes.h"
+#include "vtkSphere.h"
+#include "vtkTransform.h"
+
+#include <cmath>
+#include <iostream>
+
+namespace
+{
+template <typename OutputArrayType>
+bool TestBatchEvaluation(vtkImplicitFunction* function, vtkDataArray* points, const char* name)
+{
+  vtkNew<OutputArrayType> values;
+  function->FunctionValue(points, values);
+  if (values->GetNumberOfTuples() != points->GetNumberOfTuples() ||
+    values->GetNumberOfComponents() != 1)
+  {
+    std::cerr << name << ": wrong output size" << std::endl;
+    return false;
+  }
+
+  // float outputs are compared with a float tolerance.
+  const double tol = sizeof(typename OutputArrayType::ValueType) == sizeof(float) ? 1e-5 : 1e-12;
+  for (vtkIdType i = 0; i < points->GetNumberOfTuples(); ++i)
+  {
+    double x[3];
+    points->GetTuple(i, x);
+    const double expected = function->FunctionValue(x);
+    const double value = values->GetValue(i);
+    if (std::abs(value - expected) > tol * (1.0 + std::abs(expected)))
+    {
+      std::cerr << name << ": wrong value at point " << i << ": " << value << ", expected "
+                << expected << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TestFunction(vtkImplicitFunction* function, vtkDataArray* points, const char* name)
+{
+  return TestBatchEvaluation<vtkDoubleArray>(function, points, name) &&
+    TestBatchEvaluation<vtkFloatArray>(function, points, name);
+}
+}
+
+int TestImplicitFunctionBatchEvaluation(int, char*[])
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(1);
+  vtkNew<vtkDoubleArray> points;
+  points->SetNumberOfComponents(3);
+  points->SetNumberOfTuples(10000);
+  for (vtkIdType i = 0; i < points->GetNumberOfTuples(); ++i)
+  {
+    for (int j = 0; j < 3; ++j)
+    {
+      points->SetComponent(i, j, random->GetNextRangeValue(-2.0, 2.0));
+    }
+  }
+  vtkNew<vtkFloatArray> floatPoints;
+  floatPoints->DeepCopy(points);
+
+  vtkNew<vtkSphere> sphere;
+  sphere->SetCenter(0.1, -0.2, 0.3);
+  sphere->SetRadius(0.8);
+
+  vtkNew<vtkBox> box;
+  box->SetBounds(-0.5, 1.0, -1.0, 0.25, -0.75, 0.75);
+
+  vtkNew<vtkCylinder> cylinder;
+  cylinder->SetCenter(0.2, 0.0, -0.1);
+  cylinder->SetAxis(1.0, 1.0, 0.0);
+  cylinder->SetRadius(0.6);
+
+  vtkNew<vtkPlanes> planes;
+  planes->SetBounds(-1.0, 1.0, -0.5, 0.5, -1.5, 0.5);
+
+  bool success = TestFunction(sphere, points, "vtkSphere") &&
+    TestFunction(sphere, floatPoints, "vtkSphere (float points)") &&
+    TestFunction(box, points, "vtkBox") && TestFunction(cylinder, points, "vtkCylinder") &&
+    TestFunction(planes, points, "vtkPlanes");
+
+  const int operations[] = { vtkImplicitBoolean::VTK_UNION, vtkImplicitBoolean::VTK_INTERSECTION,
+    vtkImplicitBoolean::VTK_DIFFERENCE, vtkImplicitBoolean::VTK_UNION_OF_MAGNITUDES };
+  for (int operation : operations)
+  {
+    vtkNew<vtkImplicitBoolean> boolean;
+    boolean->SetOperationType(operation);
+    boolean->AddFunction(box);
+    boolean->AddFunction(sphere);
+    boolean->AddFunction(cylinder);
+    success = success && TestFunction(boolean, points, boolean->GetOperationTypeAsString());
+  }
+
+  // A transformed function evaluated in a boolean.
+  vtkNew<vtkTransform> transform;
+  transform->RotateZ(30.0);
+  transform->Translate(0.2, 0.1, 0.0);
+  sphere->SetTransform(transform);
+  vtkNew<vtkImplicitBoolean> boolean;
+  boolean->AddFunction(sphere);
+  boolean->AddFunction(planes);
+  success = success && TestFunction(boolean, points, "transformed vtkImplicitBoolean");
+
+  // An empty boolean evaluates to 0.
+  vtkNew<vtkImplicitBoolean> empty;
+  success = success && TestFunction(empty, points, "empty vtkImplicitBoolean");
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
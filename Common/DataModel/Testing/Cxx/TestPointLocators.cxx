@@ -1,13 +1,18 @@
 // SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
 // SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDoubleArray.h"
 #include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkKdTree.h"
 #include "vtkKdTreePointLocator.h"
 #include "vtkMath.h"
 #include "vtkOctreePointLocator.h"
 #include "vtkPointLocator.h"
 #include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkStaticPointLocator.h"
 #include "vtkStructuredGrid.h"
+#include "vtkUnsignedCharArray.h"
 
 // returns true if 2 points are equidistant from x, within a tolerance
 bool ArePointsEquidistant(double x[3], vtkIdType id1, vtkIdType id2, vtkPointSet* grid)
@@ -274,6 +279,187 @@ int TestKdTreePointLocator()
   return rval;
 }
 
+// This test checks that the batched queries of vtkStaticPointLocator return
+// the same results as the single point queries.
+int TestStaticPointLocatorBatchedQueries()
+{
+  int rval = 0;
+  const vtkIdType numPoints = 5000;
+  const vtkIdType numQueries = 3000;
+
+  vtkPoints* points = vtkPoints::New();
+  points->SetDataTypeToDouble();
+  points->SetNumberOfPoints(numPoints);
+  for (vtkIdType i = 0; i < numPoints; ++i)
+  {
+    points->SetPoint(i, vtkMath::Random(), vtkMath::Random(), vtkMath::Random());
+  }
+  vtkPolyData* polyData = vtkPolyData::New();
+  polyData->SetPoints(points);
+
+  vtkDoubleArray* queries = vtkDoubleArray::New();
+  queries->SetNumberOfComponents(3);
+  queries->SetNumberOfTuples(numQueries);
+  for (vtkIdType i = 0; i < numQueries; ++i)
+  {
+    queries->SetTuple3(i, vtkMath::Random(-0.1, 1.1), vtkMath::Random(-0.1, 1.1),
+      vtkMath::Random(-0.1, 1.1));
+  }
+
+  vtkStaticPointLocator* locator = vtkStaticPointLocator::New();
+  locator->SetDataSet(polyData);
+  locator->BuildLocator();
+
+  vtkIdTypeArray* offsets = vtkIdTypeArray::New();
+  vtkIdTypeArray* ids = vtkIdTypeArray::New();
+  vtkIdList* result = vtkIdList::New();
+  double x[3];
+
+  for (int pass = 0; pass < 2; ++pass)
+  {
+    if (pass == 0)
+    {
+      locator->FindClosestNPoints(7, queries, offsets, ids);
+    }
+    else
+    {
+      locator->FindPointsWithinRadius(0.07, queries, offsets, ids);
+    }
+    if (offsets->GetNumberOfValues() != numQueries + 1 ||
+      offsets->GetValue(numQueries) != ids->GetNumberOfValues())
+    {
+      cerr << "Wrong batched query offsets.\n";
+      rval++;
+      continue;
+    }
+    for (vtkIdType q = 0; q < numQueries; ++q)
+    {
+      queries->GetTuple(q, x);
+      if (pass == 0)
+      {
+        locator->FindClosestNPoints(7, x, result);
+      }
+      else
+      {
+        locator->FindPointsWithinRadius(0.07, x, result);
+      }
+      vtkIdType begin = offsets->GetValue(q);
+      vtkIdType numIds = offsets->GetValue(q + 1) - begin;
+      bool same = numIds == result->GetNumberOfIds();
+      for (vtkIdType i = 0; same && i < numIds; ++i)
+      {
+        same = ids->GetValue(begin + i) == result->GetId(i);
+      }
+      if (!same)
+      {
+        cerr << "Batched query " << q << " differs from the single point query.\n";
+        rval++;
+        break;
+      }
+    }
+  }
+
+  result->Delete();
+  ids->Delete();
+  offsets->Delete();
+  locator->Delete();
+  queries->Delete();
+  polyData->Delete();
+  points->Delete();
+
+  return rval;
+}
+
+// This test checks that updating a vtkStaticPointLocator after some points
+// moved gives the same results as rebuilding it.
+int TestStaticPointLocatorUpdate()
+{
+  int rval = 0;
+  const vtkIdType numPoints = 5000;
+
+  vtkPoints* points = vtkPoints::New();
+  points->SetDataTypeToDouble();
+  points->SetNumberOfPoints(numPoints);
+  for (vtkIdType i = 0; i < numPoints; ++i)
+  {
+    points->SetPoint(i, vtkMath::Random(), vtkMath::Random(), vtkMath::Random());
+  }
+  // Make sure the bounds stay the same when moving the other points
+  points->SetPoint(0, 0.0, 0.0, 0.0);
+  points->SetPoint(1, 1.0, 1.0, 1.0);
+  vtkPolyData* polyData = vtkPolyData::New();
+  polyData->SetPoints(points);
+
+  vtkStaticPointLocator* locator = vtkStaticPointLocator::New();
+  locator->SetDataSet(polyData);
+  locator->BuildLocator();
+
+  // Move one point out of twenty
+  vtkUnsignedCharArray* moved = vtkUnsignedCharArray::New();
+  moved->SetNumberOfValues(numPoints);
+  moved->FillValue(0);
+  double x[3];
+  for (vtkIdType i = 2; i < numPoints; i += 20)
+  {
+    points->GetPoint(i, x);
+    points->SetPoint(i, 1.0 - x[0], x[1], 0.5 * x[2]);
+    moved->SetValue(i, 1);
+  }
+  points->Modified();
+
+  if (!locator->UpdateLocator(moved))
+  {
+    cerr << "vtkStaticPointLocator::UpdateLocator failed.\n";
+    rval++;
+  }
+
+  vtkStaticPointLocator* reference = vtkStaticPointLocator::New();
+  reference->SetDataSet(polyData);
+  reference->BuildLocator();
+
+  vtkIdList* result = vtkIdList::New();
+  vtkIdList* refResult = vtkIdList::New();
+  for (int i = 0; i < 500 && rval == 0; ++i)
+  {
+    x[0] = vtkMath::Random();
+    x[1] = vtkMath::Random();
+    x[2] = vtkMath::Random();
+    locator->FindPointsWithinRadius(0.1, x, result);
+    reference->FindPointsWithinRadius(0.1, x, refResult);
+    bool same = result->GetNumberOfIds() == refResult->GetNumberOfIds();
+    for (vtkIdType j = 0; same && j < result->GetNumberOfIds(); ++j)
+    {
+      same = result->GetId(j) == refResult->GetId(j);
+    }
+    if (!same || locator->FindClosestPoint(x) != reference->FindClosestPoint(x))
+    {
+      cerr << "Updated locator differs from the rebuilt one.\n";
+      rval++;
+    }
+  }
+
+  // Moving a point out of the bounds rebuilds the locator
+  points->SetPoint(2, 2.0, 0.5, 0.5);
+  points->Modified();
+  x[0] = 2.0;
+  x[1] = x[2] = 0.5;
+  if (locator->UpdateLocator(moved) || locator->FindClosestPoint(x) != 2)
+  {
+    cerr << "Updating the locator with points out of bounds should rebuild it.\n";
+    rval++;
+  }
+
+  refResult->Delete();
+  result->Delete();
+  reference->Delete();
+  moved->Delete();
+  locator->Delete();
+  polyData->Delete();
+  points->Delete();
+
+  return rval;
+}
+
 int TestPointLocators(int, char*[])
 {
   vtkKdTreePointLocator* kdTreeLocator = vtkKdTreePointLocator::New();
@@ -293,5 +479,11 @@ int TestPointLocators(int, char*[])
 
   rval += TestKdTreePointLocator();
 
+  cout << "Testing vtkStaticPointLocator batched queries.\n";
+  rval += TestStaticPointLocatorBatchedQueries();
+
+  cout << "Testing vtkStaticPointLocator update.\n";
+  rval += TestStaticPointLocatorUpdate();
+
   return rval;
 }
@@ -0,0 +1,210 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the polyhedra returned by a vtkUnstructuredGrid with a cached
+// polyhedron topology have the same faces and edges as without it, and that
+// contouring and clipping them from their faces gives the same results.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
+#include "vtkMergePoints.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyhedron.h"
+#include "vtkTriangle.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+const int N = 3;
+
+vtkIdType PointId(int i, int j, int k)
+{
+  return i + (N + 1) * (j + (N + 1) * k);
+}
+
+// A sheared block of N^3 cubes described as polyhedra, with a linear scalar
+// field so that the contour polygons are planar.
+void CreateGrid(vtkUnstructuredGrid* grid)
+{
+  vtkNew<vtkPoints> points;
+  for (int k = 0; k <= N; ++k)
+  {
+    for (int j = 0; j <= N; ++j)
+    {
+      for (int i = 0; i <= N; ++i)
+      {
+        points->InsertNextPoint(i, j + 0.1 * i, k + 0.05 * j);
+      }
+    }
+  }
+  grid->SetPoints(points);
+  grid->Allocate(N * N * N);
+
+  for (int k = 0; k < N; ++k)
+  {
+    for (int j = 0; j < N; ++j)
+    {
+      for (int i = 0; i < N; ++i)
+      {
+        const vtkIdType p[8] = { PointId(i, j, k), PointId(i + 1, j, k), PointId(i + 1, j + 1, k),
+          PointId(i, j + 1, k), PointId(i, j, k + 1), PointId(i + 1, j, k + 1),
+          PointId(i + 1, j + 1, k + 1), PointId(i, j + 1, k + 1) };
+        const vtkIdType faces[] = { 6, 4, p[0], p[3], p[2], p[1], 4, p[4], p[5], p[6], p[7], 4,
+          p[0], p[1], p[5], p[4], 4, p[3], p[7], p[6], p[2], 4, p[1], p[2], p[6], p[5], 4, p[0],
+          p[4], p[7], p[3] };
+        // list the points of some cells in another order
+        const vtkIdType q[8] = { p[6], p[0], p[1], p[7], p[2], p[3], p[4], p[5] };
+        grid->InsertNextCell(VTK_POLYHEDRON, 8, (i + j + k) % 2 ? q : p, 6, faces);
+      }
+    }
+  }
+
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("Scalars");
+  for (vtkIdType ptId = 0; ptId < points->GetNumberOfPoints(); ++ptId)
+  {
+    double x[3];
+    points->GetPoint(ptId, x);
+    scalars->InsertNextValue(x[0] + 2.0 * x[1] - 1.5 * x[2]);
+  }
+  grid->GetPointData()->SetScalars(scalars);
+}
+
+bool SameTopology(vtkPolyhedron* cell0, vtkPolyhedron* cell1)
+{
+  if (cell0->GetNumberOfFaces() != cell1->GetNumberOfFaces() ||
+    cell0->GetNumberOfEdges() != cell1->GetNumberOfEdges())
+  {
+    return false;
+  }
+  for (int faceId = 0; faceId < cell0->GetNumberOfFaces(); ++faceId)
+  {
+    vtkNew<vtkIdList> ids0;
+    ids0->DeepCopy(cell0->GetFace(faceId)->GetPointIds());
+    vtkIdList* ids1 = cell1->GetFace(faceId)->GetPointIds();
+    if (ids0->GetNumberOfIds() != ids1->GetNumberOfIds())
+    {
+      return false;
+    }
+    for (vtkIdType i = 0; i < ids0->GetNumberOfIds(); ++i)
+    {
+      if (ids0->GetId(i) != ids1->GetId(i))
+      {
+        return false;
+      }
+    }
+  }
+  for (int edgeId = 0; edgeId < cell0->GetNumberOfEdges(); ++edgeId)
+  {
+    vtkIdList* ids0 = cell0->GetEdge(edgeId)->GetPointIds();
+    const vtkIdType id0 = ids0->GetId(0);
+    const vtkIdType id1 = ids0->GetId(1);
+    vtkIdList* ids1 = cell1->GetEdge(edgeId)->GetPointIds();
+    if (ids1->GetId(0) != id0 || ids1->GetId(1) != id1)
+    {
+      return false;
+    }
+  }
+  return cell0->IsConvex() == cell1->IsConvex();
+}
+
+// Contour and clip all the cells, return the area of the contour and the
+// number of clipped cells.
+void ContourAndClip(vtkUnstructuredGrid* grid, double value, double& area, vtkIdType& numClipped)
+{
+  double bounds[6];
+  grid->GetBounds(bounds);
+  vtkNew<vtkPoints> contourPoints;
+  vtkNew<vtkMergePoints> contourLocator;
+  contourLocator->InitPointInsertion(contourPoints, bounds);
+  vtkNew<vtkPoints> clipPoints;
+  vtkNew<vtkMergePoints> clipLocator;
+  clipLocator->InitPointInsertion(clipPoints, bounds);
+
+  vtkPointData* inPd = grid->GetPointData();
+  vtkNew<vtkPointData> contourPd, clipPd;
+  contourPd->InterpolateAllocate(inPd);
+  clipPd->InterpolateAllocate(inPd);
+  vtkCellData* inCd = grid->GetCellData();
+  vtkNew<vtkCellData> contourCd, clipCd;
+  vtkNew<vtkCellArray> verts, lines, polys, clipped;
+  vtkNew<vtkDoubleArray> cellScalars;
+  vtkNew<vtkGenericCell> cell;
+  for (vtkIdType cellId = 0; cellId < grid->GetNumberOfCells(); ++cellId)
+  {
+    grid->GetCell(cellId, cell);
+    inPd->GetScalars()->GetTuples(cell->GetPointIds(), cellScalars);
+    cell->Contour(value, cellScalars, contourLocator, verts, lines, polys, inPd, contourPd, inCd,
+      cellId, contourCd);
+    cell->Clip(value, cellScalars, clipLocator, clipped, inPd, clipPd, inCd, cellId, clipCd, 0);
+  }
+
+  area = 0.0;
+  vtkIdType npts;
+  const vtkIdType* pts;
+  for (polys->InitTraversal(); polys->GetNextCell(npts, pts);)
+  {
+    double p0[3], p1[3], p2[3];
+    contourPoints->GetPoint(pts[0], p0);
+    for (vtkIdType i = 1; i + 1 < npts; ++i)
+    {
+      contourPoints->GetPoint(pts[i], p1);
+      contourPoints->GetPoint(pts[i + 1], p2);
+      area += vtkTriangle::TriangleArea(p0, p1, p2);
+    }
+  }
+  numClipped = clipped->GetNumberOfCells();
+}
+}
+
+int TestPolyhedronTopology(int, char*[])
+{
+  vtkNew<vtkUnstructuredGrid> grid;
+  CreateGrid(grid);
+  vtkNew<vtkUnstructuredGrid> cached;
+  cached->DeepCopy(grid);
+  cached->BuildPolyhedronTopology();
+
+  vtkNew<vtkGenericCell> cell0, cell1;
+  for (vtkIdType cellId = 0; cellId < grid->GetNumberOfCells(); ++cellId)
+  {
+    grid->GetCell(cellId, cell0);
+    cached->GetCell(cellId, cell1);
+    if (!SameTopology(vtkPolyhedron::SafeDownCast(cell0->GetRepresentativeCell()),
+          vtkPolyhedron::SafeDownCast(cell1->GetRepresentativeCell())))
+    {
+      std::cerr << "Cell " << cellId << " has another topology when it is cached." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  for (double value : { -0.35, 1.35, 3.4 })
+  {
+    double area0, area1;
+    vtkIdType numClipped0, numClipped1;
+    ContourAndClip(grid, value, area0, numClipped0);
+    ContourAndClip(cached, value, area1, numClipped1);
+    if (area0 <= 0.0 || std::abs(area0 - area1) > 1e-6 * area0)
+    {
+      std::cerr << "Contour " << value << " has an area of " << area1 << " instead of " << area0
+                << "." << std::endl;
+      return EXIT_FAILURE;
+    }
+    if (numClipped0 == 0 || numClipped0 != numClipped1)
+    {
+      std::cerr << "Clip " << value << " gives " << numClipped1 << " cells instead of "
+                << numClipped0 << "." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -1,7 +1,11 @@
 // SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
 // SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCellArray.h"
+#include "vtkCellLinks.h"
 #include "vtkExtractGeometry.h"
+#include "vtkIdList.h"
 #include "vtkImageData.h"
+#include "vtkNew.h"
 #include "vtkPolyData.h"
 #include "vtkSmartPointer.h"
 #include "vtkSphere.h"
@@ -183,5 +187,73 @@ int TestStaticCellLinks(int, char*[])
     return EXIT_FAILURE;
   }
 
+  //----------------------------------------------------------------------------
+  // Polydata with several cell arrays: compare the serial and threaded static
+  // links with vtkCellLinks.
+  vtkNew<vtkPolyData> mixed;
+  mixed->DeepCopy(pdata);
+  vtkNew<vtkCellArray> verts;
+  vtkNew<vtkCellArray> lines;
+  for (vtkIdType ptId = 0; ptId < mixed->GetNumberOfPoints(); ptId += 3)
+  {
+    verts->InsertNextCell(1, &ptId);
+    vtkIdType line[2] = { ptId, (ptId + 7) % mixed->GetNumberOfPoints() };
+    lines->InsertNextCell(2, line);
+  }
+  mixed->SetVerts(verts);
+  mixed->SetLines(lines);
+
+  vtkNew<vtkCellLinks> clinks;
+  clinks->SetDataSet(mixed);
+  clinks->BuildLinks();
+  vtkStaticCellLinksTemplate<vtkIdType> serialLinks;
+  serialLinks.SetSequentialProcessing(true);
+  serialLinks.BuildLinks(mixed);
+  vtkStaticCellLinksTemplate<vtkIdType> threadedLinks;
+  threadedLinks.BuildLinks(mixed.Get());
+  for (vtkIdType ptId = 0; ptId < mixed->GetNumberOfPoints(); ++ptId)
+  {
+    const vtkIdType numPtCells = clinks->GetNcells(ptId);
+    if (serialLinks.GetNcells(ptId) != numPtCells || threadedLinks.GetNcells(ptId) != numPtCells)
+    {
+      cout << "Wrong number of cells using point " << ptId << "\n";
+      return EXIT_FAILURE;
+    }
+    const vtkIdType* expected = clinks->GetCells(ptId);
+    const vtkIdType* ptCells = threadedLinks.GetCells(ptId);
+    const vtkIdType* serialPtCells = serialLinks.GetCells(ptId);
+    for (vtkIdType i = 0; i < numPtCells; ++i)
+    {
+      // vtkCellLinks and the threaded links are sorted by cell id, the serial
+      // links are in reverse order.
+      if (ptCells[i] != expected[i] || serialPtCells[numPtCells - 1 - i] != expected[i])
+      {
+        cout << "Wrong cells using point " << ptId << "\n";
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // vtkPolyData builds static links unless it is editable
+  mixed->BuildLinks();
+  if (!vtkStaticCellLinks::SafeDownCast(mixed->GetLinks()))
+  {
+    cout << "Expected static links for a non editable polydata\n";
+    return EXIT_FAILURE;
+  }
+  vtkNew<vtkIdList> pointCells;
+  mixed->GetPointCells(0, pointCells);
+  if (pointCells->GetNumberOfIds() != clinks->GetNcells(0))
+  {
+    return EXIT_FAILURE;
+  }
+  mixed->EditableOn();
+  mixed->BuildLinks();
+  if (!vtkCellLinks::SafeDownCast(mixed->GetLinks()))
+  {
+    cout << "Expected vtkCellLinks for an editable polydata\n";
+    return EXIT_FAILURE;
+  }
+
   return EXIT_SUCCESS;
 }
@@ -3,11 +3,14 @@
 
 // .NAME Test of vtkStaticCellLocator::FindClosestPoint
 // .SECTION Description
-// this program tests the FindClosestPoint method
+// this program tests the FindClosestPoint and IntersectWithLines methods
 
 #include "vtkCellLocator.h" // used as reference
 #include "vtkCylinderSource.h"
+#include "vtkDoubleArray.h"
 #include "vtkGenericCell.h"
+#include "vtkIdTypeArray.h"
+#include "vtkMath.h"
 #include "vtkPolyData.h"
 #include "vtkSmartPointer.h"
 #include "vtkStaticCellLocator.h"
@@ -94,5 +97,49 @@ int TestStaticCellLocator(int, char*[])
     }
   }
 
+  // Batched line intersections must match the single line queries
+  const vtkIdType numLines = 500;
+  auto p1s = vtkSmartPointer<vtkDoubleArray>::New();
+  auto p2s = vtkSmartPointer<vtkDoubleArray>::New();
+  p1s->SetNumberOfComponents(3);
+  p2s->SetNumberOfComponents(3);
+  p1s->SetNumberOfTuples(numLines);
+  p2s->SetNumberOfTuples(numLines);
+  for (vtkIdType i = 0; i < numLines; ++i)
+  {
+    p1s->SetTuple3(i, vtkMath::Random(-3, 3), vtkMath::Random(-4, 2), vtkMath::Random(-1, 11));
+    p2s->SetTuple3(i, vtkMath::Random(-3, 3), vtkMath::Random(-4, 2), vtkMath::Random(-1, 11));
+  }
+  auto cellIds = vtkSmartPointer<vtkIdTypeArray>::New();
+  auto ts = vtkSmartPointer<vtkDoubleArray>::New();
+  auto pcoords = vtkSmartPointer<vtkDoubleArray>::New();
+  static_loc->IntersectWithLines(p1s, p2s, 0.0, cellIds, ts, pcoords);
+  if (cellIds->GetNumberOfTuples() != numLines || ts->GetNumberOfTuples() != numLines ||
+    pcoords->GetNumberOfTuples() != numLines)
+  {
+    std::cerr << "wrong size of batched line intersection results\n";
+    num_failed++;
+  }
+  else
+  {
+    double p1[3], p2[3], t, x[3], pc[3];
+    for (vtkIdType i = 0; i < numLines; ++i)
+    {
+      p1s->GetTuple(i, p1);
+      p2s->GetTuple(i, p2);
+      vtkIdType cellId = -1;
+      if (!static_loc->IntersectWithLine(p1, p2, 0.0, t, x, pc, subId, cellId, cell))
+      {
+        cellId = -1;
+      }
+      if (cellId != cellIds->GetValue(i) || (cellId >= 0 && std::abs(t - ts->GetValue(i)) > 1e-12))
+      {
+        std::cerr << "different batched line intersection for line " << i << ":\n";
+        std::cerr << "\t" << cellIds->GetValue(i) << " - " << cellId << "\n";
+        num_failed++;
+      }
+    }
+  }
+
   return (num_failed == 0) ? 0 : 1;
 }
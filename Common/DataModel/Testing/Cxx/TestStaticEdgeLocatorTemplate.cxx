@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkLogger.h"
+#include "vtkStaticEdgeLocatorTemplate.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+using EdgeTupleType = EdgeTuple<vtkIdType, int>;
+
+// Generate numEdges random edges with many duplicates.
+std::vector<EdgeTupleType> GenerateEdges(vtkIdType numEdges)
+{
+  std::mt19937 generator(0);
+  std::uniform_int_distribution<vtkIdType> distribution(0, numEdges / 4 + 1);
+  std::vector<EdgeTupleType> edges;
+  edges.reserve(numEdges);
+  for (vtkIdType i = 0; i < numEdges; ++i)
+  {
+    vtkIdType v0 = distribution(generator);
+    vtkIdType v1 = v0 + 1 + distribution(generator) % 4;
+    edges.emplace_back(v0, v1, static_cast<int>(i));
+  }
+  return edges;
+}
+
+// Check MergeEdges() and BuildLocator() against std::sort and std::unique.
+bool TestEdgeLocator(vtkIdType numEdges)
+{
+  std::vector<EdgeTupleType> edges = GenerateEdges(numEdges);
+  std::vector<EdgeTupleType> expected = edges;
+  std::sort(expected.begin(), expected.end());
+  const vtkIdType numExpected = std::unique(expected.begin(), expected.end()) - expected.begin();
+
+  std::vector<EdgeTupleType> mergeEdges = edges;
+  vtkStaticEdgeLocatorTemplate<vtkIdType, int> mergeLocator;
+  vtkIdType numUniqueEdges;
+  const vtkIdType* offsets = mergeLocator.MergeEdges(numEdges, mergeEdges.data(), numUniqueEdges);
+  if (numUniqueEdges != numExpected || offsets[numUniqueEdges] != numEdges)
+  {
+    vtkLog(ERROR, "MergeEdges() found " << numUniqueEdges << " unique edges instead of "
+                                        << numExpected << " for " << numEdges << " edges.");
+    return false;
+  }
+  for (vtkIdType i = 0; i < numUniqueEdges; ++i)
+  {
+    for (vtkIdType eId = offsets[i]; eId < offsets[i + 1]; ++eId)
+    {
+      if (mergeEdges[eId] != expected[i])
+      {
+        vtkLog(ERROR, "MergeEdges() produced a wrong group of edges.");
+        return false;
+      }
+    }
+  }
+
+  vtkStaticEdgeLocatorTemplate<vtkIdType, int> locator;
+  if (locator.BuildLocator(numEdges, edges.data()) != numExpected)
+  {
+    vtkLog(ERROR, "BuildLocator() found a wrong number of unique edges.");
+    return false;
+  }
+  for (vtkIdType i = 0; i < numExpected; ++i)
+  {
+    if (edges[i] != expected[i] || locator.IsInsertedEdge(expected[i].V1, expected[i].V0) != i)
+    {
+      vtkLog(ERROR, "BuildLocator() did not locate edge " << i << ".");
+      return false;
+    }
+  }
+  if (locator.IsInsertedEdge(0, numEdges + 10) >= 0)
+  {
+    vtkLog(ERROR, "BuildLocator() located an edge that was not inserted.");
+    return false;
+  }
+  return true;
+}
+}
+
+int TestStaticEdgeLocatorTemplate(int, char*[])
+{
+  // The small array is processed serially, the large one in parallel.
+  if (!::TestEdgeLocator(1000) || !::TestEdgeLocator(200000))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -6,7 +6,9 @@
 // this program tests vtkUnstructuredGrid
 
 #include "vtkLogger.h"
+#include "vtkCellType.h"
 #include "vtkNew.h"
+#include "vtkPoints.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
@@ -33,5 +35,42 @@ int otherUnstructuredGrid(int, char*[])
     retVal = EXIT_FAILURE;
   }
 
+  if (ug->GetHomogeneousCellType() != -1)
+  {
+    vtkLog(ERROR, "An empty vtkUnstructuredGrid should not have a homogeneous cell type");
+    retVal = EXIT_FAILURE;
+  }
+
+  vtkNew<vtkPoints> points;
+  for (int i = 0; i < 8; ++i)
+  {
+    points->InsertNextPoint(i & 1, (i >> 1) & 1, (i >> 2) & 1);
+  }
+  ug->SetPoints(points);
+  ug->AllocateEstimate(3, 8);
+  const vtkIdType tet1[4] = { 0, 1, 2, 4 };
+  const vtkIdType tet2[4] = { 1, 3, 2, 7 };
+  ug->InsertNextCell(VTK_TETRA, 4, tet1);
+  ug->InsertNextCell(VTK_TETRA, 4, tet2);
+  if (ug->GetHomogeneousCellType() != VTK_TETRA || !ug->IsHomogeneous())
+  {
+    vtkLog(ERROR, "A tetrahedral vtkUnstructuredGrid should be homogeneous");
+    retVal = EXIT_FAILURE;
+  }
+
+  // The cached distinct cell types must be refreshed when cells are inserted.
+  const vtkIdType hex[8] = { 0, 1, 3, 2, 4, 5, 7, 6 };
+  ug->InsertNextCell(VTK_HEXAHEDRON, 8, hex);
+  if (ug->GetHomogeneousCellType() != -1 || ug->IsHomogeneous())
+  {
+    vtkLog(ERROR, "A vtkUnstructuredGrid with tetrahedra and a hexahedron is not homogeneous");
+    retVal = EXIT_FAILURE;
+  }
+  if (ug->GetDistinctCellTypesArray()->GetNumberOfValues() != 2)
+  {
+    vtkLog(ERROR, "Expected 2 distinct cell types");
+    retVal = EXIT_FAILURE;
+  }
+
   return retVal;
 }
@@ -9,6 +9,7 @@
 #include "vtkFieldData.h"
 #include "vtkOverlappingAMR.h"
 #include "vtkPointData.h"
+#include "vtkSMPTools.h"
 #include "vtkStructuredData.h"
 #include "vtkUniformGrid.h"
 #include "vtkUnsignedCharArray.h"
@@ -367,72 +368,75 @@ void vtkAMRUtilities::BlankGridsAtLevel(vtkOverlappingAMR* amr, int levelIdx,
   std::vector<std::vector<unsigned int>>& children, const std::vector<int>& processMap)
 {
   unsigned int numDataSets = amr->GetNumberOfDataSets(levelIdx);
-  int N;
 
-  for (unsigned int dataSetIdx = 0; dataSetIdx < numDataSets; dataSetIdx++)
-  {
-    const vtkAMRBox& box = amr->GetAMRBox(levelIdx, dataSetIdx);
-    vtkUniformGrid* grid = amr->GetDataSet(levelIdx, dataSetIdx);
-    if (grid == nullptr)
+  // The grids of a level are blanked independently: each one only reads the
+  // metadata of its children and writes its own ghost array.
+  vtkSMPTools::For(0, numDataSets, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType dataSetIdx = begin; dataSetIdx < end; dataSetIdx++)
     {
-      continue;
-    }
-    N = grid->GetNumberOfCells();
-
-    vtkUnsignedCharArray* ghosts = vtkUnsignedCharArray::New();
-    ghosts->SetNumberOfTuples(N);
-    ghosts->FillComponent(0, 0);
-    ghosts->SetName(vtkDataSetAttributes::GhostArrayName());
+      const vtkAMRBox& box = amr->GetAMRBox(levelIdx, dataSetIdx);
+      vtkUniformGrid* grid = amr->GetDataSet(levelIdx, dataSetIdx);
+      if (grid == nullptr)
+      {
+        continue;
+      }
+      vtkIdType N = grid->GetNumberOfCells();
 
-    if (children.size() > dataSetIdx)
-    {
-      std::vector<unsigned int>& dsChildren = children[dataSetIdx];
-      std::vector<unsigned int>::iterator iter;
+      vtkUnsignedCharArray* ghosts = vtkUnsignedCharArray::New();
+      ghosts->SetNumberOfTuples(N);
+      ghosts->FillComponent(0, 0);
+      ghosts->SetName(vtkDataSetAttributes::GhostArrayName());
 
-      // For each higher res box fill in the cells that
-      // it covers
-      for (iter = dsChildren.begin(); iter != dsChildren.end(); ++iter)
+      if (static_cast<vtkIdType>(children.size()) > dataSetIdx)
       {
-        vtkAMRBox ibox;
-        int childGridIndex = amr->GetCompositeIndex(levelIdx + 1, *iter);
-        if (processMap[childGridIndex] < 0)
-        {
-          continue;
-        }
-        if (amr->GetAMRInfo()->GetCoarsenedAMRBox(levelIdx + 1, *iter, ibox))
+        std::vector<unsigned int>& dsChildren = children[dataSetIdx];
+        std::vector<unsigned int>::iterator iter;
+
+        // For each higher res box fill in the cells that
+        // it covers
+        for (iter = dsChildren.begin(); iter != dsChildren.end(); ++iter)
         {
-          bool shouldBeTrue = ibox.Intersect(box);
-          assert(shouldBeTrue); // if the boxes don't intersect, there is a bug
-          (void)shouldBeTrue;   // to avoid warning in release
-          const int* loCorner = ibox.GetLoCorner();
-          int hi[3];
-          ibox.GetValidHiCorner(hi);
-          for (int iz = loCorner[2]; iz <= hi[2]; iz++)
+          vtkAMRBox ibox;
+          int childGridIndex = amr->GetCompositeIndex(levelIdx + 1, *iter);
+          if (processMap[childGridIndex] < 0)
           {
-            for (int iy = loCorner[1]; iy <= hi[1]; iy++)
+            continue;
+          }
+          if (amr->GetAMRInfo()->GetCoarsenedAMRBox(levelIdx + 1, *iter, ibox))
+          {
+            bool shouldBeTrue = ibox.Intersect(box);
+            assert(shouldBeTrue); // if the boxes don't intersect, there is a bug
+            (void)shouldBeTrue;   // to avoid warning in release
+            const int* loCorner = ibox.GetLoCorner();
+            int hi[3];
+            ibox.GetValidHiCorner(hi);
+            for (int iz = loCorner[2]; iz <= hi[2]; iz++)
             {
-              for (int ix = loCorner[0]; ix <= hi[0]; ix++)
+              for (int iy = loCorner[1]; iy <= hi[1]; iy++)
               {
-                vtkIdType id =
-                  vtkAMRBox::GetCellLinearIndex(box, ix, iy, iz, grid->GetDimensions());
-                ghosts->SetValue(id, ghosts->GetValue(id) | vtkDataSetAttributes::REFINEDCELL);
-              } // END for x
-            }   // END for y
-          }     // END for z
-        }
-      } // Processing all higher boxes for a specific coarse grid
-    }
+                for (int ix = loCorner[0]; ix <= hi[0]; ix++)
+                {
+                  vtkIdType id =
+                    vtkAMRBox::GetCellLinearIndex(box, ix, iy, iz, grid->GetDimensions());
+                  ghosts->SetValue(id, ghosts->GetValue(id) | vtkDataSetAttributes::REFINEDCELL);
+                } // END for x
+              }   // END for y
+            }     // END for z
+          }
+        } // Processing all higher boxes for a specific coarse grid
+      }
 
-    if (grid->GetCellData()->HasArray(vtkDataSetAttributes::GhostArrayName()))
-    {
-      MergeGhostArrays(
-        grid->GetCellData()->GetArray(vtkDataSetAttributes::GhostArrayName()), ghosts);
-    }
+      if (grid->GetCellData()->HasArray(vtkDataSetAttributes::GhostArrayName()))
+      {
+        MergeGhostArrays(
+          grid->GetCellData()->GetArray(vtkDataSetAttributes::GhostArrayName()), ghosts);
+      }
 
-    grid->GetCellData()->AddArray(ghosts);
+      grid->GetCellData()->AddArray(ghosts);
 
-    ghosts->Delete();
-  }
+      ghosts->Delete();
+    }
+  });
 }
 
 //------------------------------------------------------------------------------
@@ -6,6 +6,7 @@
 #include "vtkCellArray.h"
 #include "vtkDataArrayRange.h"
 #include "vtkDataSet.h"
+#include "vtkDoubleArray.h"
 #include "vtkGenericCell.h"
 #include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
@@ -13,9 +14,12 @@
 #include "vtkObjectFactory.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
+
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
 vtkAbstractCellLocator::vtkAbstractCellLocator()
@@ -151,6 +155,93 @@ int vtkAbstractCellLocator::IntersectWithLine(const double vtkNotUsed(p1)[3],
   return 0;
 }
 
+//------------------------------------------------------------------------------
+namespace
+{
+// Intersect a range of lines with the locator.
+struct IntersectLinesWorker
+{
+  vtkAbstractCellLocator* Locator;
+  vtkDataArray* P1s;
+  vtkDataArray* P2s;
+  double Tolerance;
+  vtkIdType* CellIds;
+  double* Ts;
+  double* PCoords;
+  vtkSMPThreadLocalObject<vtkGenericCell> Cell;
+
+  void operator()(vtkIdType line, vtkIdType endLine)
+  {
+    vtkGenericCell* cell = this->Cell.Local();
+    const auto p1s = vtk::DataArrayTupleRange<3>(this->P1s);
+    const auto p2s = vtk::DataArrayTupleRange<3>(this->P2s);
+    double p1[3], p2[3], t, x[3], pcoords[3];
+    int subId;
+    vtkIdType cellId;
+    for (; line < endLine; ++line)
+    {
+      p1s[line].GetTuple(p1);
+      p2s[line].GetTuple(p2);
+      cellId = -1;
+      if (!this->Locator->IntersectWithLine(
+            p1, p2, this->Tolerance, t, x, pcoords, subId, cellId, cell))
+      {
+        cellId = -1;
+        t = 0.0;
+        pcoords[0] = pcoords[1] = pcoords[2] = 0.0;
+      }
+      this->CellIds[line] = cellId;
+      if (this->Ts)
+      {
+        this->Ts[line] = t;
+      }
+      if (this->PCoords)
+      {
+        std::copy(pcoords, pcoords + 3, this->PCoords + 3 * line);
+      }
+    }
+  }
+};
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+void vtkAbstractCellLocator::IntersectWithLines(vtkDataArray* p1s, vtkDataArray* p2s,
+  double tol, vtkIdTypeArray* cellIds, vtkDoubleArray* ts, vtkDoubleArray* pcoords)
+{
+  if (!p1s || !p2s || !cellIds)
+  {
+    vtkErrorMacro("Line end points and cell ids arrays must be provided");
+    return;
+  }
+  if (p1s->GetNumberOfComponents() != 3 || p2s->GetNumberOfComponents() != 3 ||
+    p1s->GetNumberOfTuples() != p2s->GetNumberOfTuples())
+  {
+    vtkErrorMacro("Line end points must be 3-component arrays of the same size");
+    return;
+  }
+
+  // The locator must be built before the threaded traversal
+  this->BuildLocator();
+
+  const vtkIdType numLines = p1s->GetNumberOfTuples();
+  cellIds->SetNumberOfComponents(1);
+  cellIds->SetNumberOfTuples(numLines);
+  if (ts)
+  {
+    ts->SetNumberOfComponents(1);
+    ts->SetNumberOfTuples(numLines);
+  }
+  if (pcoords)
+  {
+    pcoords->SetNumberOfComponents(3);
+    pcoords->SetNumberOfTuples(numLines);
+  }
+
+  IntersectLinesWorker worker{ this, p1s, p2s, tol, cellIds->GetPointer(0),
+    ts ? ts->GetPointer(0) : nullptr, pcoords ? pcoords->GetPointer(0) : nullptr, {} };
+  vtkSMPTools::For(0, numLines, worker);
+}
+
 //------------------------------------------------------------------------------
 void vtkAbstractCellLocator::FindClosestPoint(
   const double x[3], double closestPoint[3], vtkIdType& cellId, int& subId, double& dist2)
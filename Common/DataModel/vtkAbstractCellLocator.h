@@ -34,8 +34,11 @@
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkCellArray;
+class vtkDataArray;
+class vtkDoubleArray;
 class vtkGenericCell;
 class vtkIdList;
+class vtkIdTypeArray;
 class vtkPoints;
 
 class VTKCOMMONDATAMODEL_EXPORT vtkAbstractCellLocator : public vtkLocator
@@ -158,6 +161,23 @@ public:
   virtual int IntersectWithLine(const double p1[3], const double p2[3], double tol,
     vtkPoints* points, vtkIdList* cellIds, vtkGenericCell* cell);
 
+  /**
+   * Intersect a batch of finite lines with the data set. Line i goes from
+   * tuple i of p1s to tuple i of p2s (both arrays have 3 components). For
+   * each line, the id of the cell intersected closest to p1 (or -1 when the
+   * line does not intersect the data set) is returned in cellIds, the
+   * parametric coordinate along the line in ts and the parametric coordinates
+   * of the intersection in the cell in pcoords (3 components). The ts and
+   * pcoords arrays can be nullptr if this information is not needed, and are
+   * set to 0 for lines without intersection. The lines are processed in
+   * parallel with vtkSMPTools, each thread using the thread safe
+   * IntersectWithLine() method with its own vtkGenericCell.
+   *
+   * THIS FUNCTION IS NOT THREAD SAFE.
+   */
+  virtual void IntersectWithLines(vtkDataArray* p1s, vtkDataArray* p2s, double tol,
+    vtkIdTypeArray* cellIds, vtkDoubleArray* ts = nullptr, vtkDoubleArray* pcoords = nullptr);
+
   /**
    * Return the closest point and the cell which is closest to the point x.
    * The closest point is somewhere on a cell, it need not be one of the
@@ -93,6 +93,13 @@ struct BaseArrayPair
     unsigned short v0, unsigned short v1, double t, unsigned short outId) = 0;
   virtual void AssignNullValue(unsigned short outId) = 0;
 
+  // Batched operations. Each call processes a list of tuples so that the
+  // cost of the virtual dispatch is paid once per array instead of once per
+  // tuple, and the inner loops can be optimized for the array type.
+  virtual void CopyTuples(vtkIdType numIds, const vtkIdType* inIds, vtkIdType outStartId) = 0;
+  virtual void InterpolateEdges(vtkIdType numEdges, const vtkIdType* v0s, const vtkIdType* v1s,
+    const double* ts, const vtkIdType* outIds) = 0;
+
   virtual void Realloc(vtkIdType sze) = 0;
 };
 
@@ -290,6 +297,58 @@ public:
     this->AssignNullValue<unsigned short>(outId);
   }
 
+  void CopyTuples(vtkIdType numIds, const vtkIdType* inIds, vtkIdType outStartId) override
+  {
+    const int numComp = this->NumComp;
+    const auto* const input = this->Input;
+    auto* const output = this->Output + outStartId * numComp;
+    if (numComp == 1)
+    {
+      for (vtkIdType i = 0; i < numIds; ++i)
+      {
+        output[i] = static_cast<T>(input[inIds[i]]);
+      }
+      return;
+    }
+    for (vtkIdType i = 0; i < numIds; ++i)
+    {
+      const auto* const in = input + inIds[i] * numComp;
+      auto* const out = output + i * numComp;
+      for (int j = 0; j < numComp; ++j)
+      {
+        out[j] = static_cast<T>(in[j]);
+      }
+    }
+  }
+  void InterpolateEdges(vtkIdType numEdges, const vtkIdType* v0s, const vtkIdType* v1s,
+    const double* ts, const vtkIdType* outIds) override
+  {
+    const int numComp = this->NumComp;
+    const auto* const input = this->Input;
+    auto* const output = this->Output;
+    if (numComp == 1)
+    {
+      for (vtkIdType i = 0; i < numEdges; ++i)
+      {
+        const double v = input[v0s[i]] + ts[i] * (input[v1s[i]] - input[v0s[i]]);
+        output[outIds[i]] = static_cast<T>(v);
+      }
+      return;
+    }
+    for (vtkIdType i = 0; i < numEdges; ++i)
+    {
+      const auto* const x0 = input + v0s[i] * numComp;
+      const auto* const x1 = input + v1s[i] * numComp;
+      auto* const out = output + outIds[i] * numComp;
+      const double t = ts[i];
+      for (int j = 0; j < numComp; ++j)
+      {
+        const double v = x0[j] + t * (x1[j] - x0[j]);
+        out[j] = static_cast<T>(v);
+      }
+    }
+  }
+
   void Realloc(vtkIdType sze) override
   {
     this->OutputArray->Resize(sze);
@@ -465,6 +524,22 @@ public:
     this->AssignNullValue<unsigned short>(outId);
   }
 
+  void CopyTuples(vtkIdType numIds, const vtkIdType* inIds, vtkIdType outStartId) override
+  {
+    for (vtkIdType i = 0; i < numIds; ++i)
+    {
+      this->Copy<vtkIdType>(inIds[i], outStartId + i);
+    }
+  }
+  void InterpolateEdges(vtkIdType numEdges, const vtkIdType* v0s, const vtkIdType* v1s,
+    const double* ts, const vtkIdType* outIds) override
+  {
+    for (vtkIdType i = 0; i < numEdges; ++i)
+    {
+      this->InterpolateEdge<vtkIdType>(v0s[i], v1s[i], ts[i], outIds[i]);
+    }
+  }
+
   void Realloc(vtkIdType sze) override
   {
     this->OutputArray->Resize(sze);
@@ -669,6 +744,58 @@ public:
     this->AssignNullValue<unsigned short>(outId);
   }
 
+  void CopyTuples(vtkIdType numIds, const vtkIdType* inIds, vtkIdType outStartId) override
+  {
+    const int numComp = this->NumComp;
+    const auto* const input = this->Input;
+    auto* const output = this->Output + outStartId * numComp;
+    if (numComp == 1)
+    {
+      for (vtkIdType i = 0; i < numIds; ++i)
+      {
+        output[i] = static_cast<TOutput>(input[inIds[i]]);
+      }
+      return;
+    }
+    for (vtkIdType i = 0; i < numIds; ++i)
+    {
+      const auto* const in = input + inIds[i] * numComp;
+      auto* const out = output + i * numComp;
+      for (int j = 0; j < numComp; ++j)
+      {
+        out[j] = static_cast<TOutput>(in[j]);
+      }
+    }
+  }
+  void InterpolateEdges(vtkIdType numEdges, const vtkIdType* v0s, const vtkIdType* v1s,
+    const double* ts, const vtkIdType* outIds) override
+  {
+    const int numComp = this->NumComp;
+    const auto* const input = this->Input;
+    auto* const output = this->Output;
+    if (numComp == 1)
+    {
+      for (vtkIdType i = 0; i < numEdges; ++i)
+      {
+        const double v = input[v0s[i]] + ts[i] * (input[v1s[i]] - input[v0s[i]]);
+        output[outIds[i]] = static_cast<TOutput>(v);
+      }
+      return;
+    }
+    for (vtkIdType i = 0; i < numEdges; ++i)
+    {
+      const auto* const x0 = input + v0s[i] * numComp;
+      const auto* const x1 = input + v1s[i] * numComp;
+      auto* const out = output + outIds[i] * numComp;
+      const double t = ts[i];
+      for (int j = 0; j < numComp; ++j)
+      {
+        const double v = x0[j] + t * (x1[j] - x0[j]);
+        out[j] = static_cast<TOutput>(v);
+      }
+    }
+  }
+
   void Realloc(vtkIdType sze) override
   {
     this->OutputArray->Resize(sze);
@@ -785,6 +912,55 @@ protected:
   }
 
 public:
+  /**
+   * Accumulate edge interpolations and process them in batches with
+   * InterpolateEdges(). The batch is processed whenever it holds BatchSize
+   * edges, and Flush() must be called once the last edge has been added. A
+   * batch is not thread-safe: each thread should use its own instance,
+   * which is typically local to a vtkSMPTools::For() functor invocation.
+   */
+  struct EdgeBatch
+  {
+    ArrayList* Arrays;
+    vtkIdType BatchSize;
+    std::vector<vtkIdType> V0;
+    std::vector<vtkIdType> V1;
+    std::vector<double> T;
+    std::vector<vtkIdType> OutIds;
+
+    EdgeBatch(ArrayList* arrays, vtkIdType batchSize = 1024)
+      : Arrays(arrays)
+      , BatchSize(batchSize)
+    {
+    }
+    void Add(vtkIdType v0, vtkIdType v1, double t, vtkIdType outId)
+    {
+      this->V0.push_back(v0);
+      this->V1.push_back(v1);
+      this->T.push_back(t);
+      this->OutIds.push_back(outId);
+      if (this->GetNumberOfEdges() >= this->BatchSize)
+      {
+        this->Flush();
+      }
+    }
+    vtkIdType GetNumberOfEdges() const { return static_cast<vtkIdType>(this->OutIds.size()); }
+    // Interpolate the accumulated edges on all the arrays of the list, then
+    // empty the batch.
+    void Flush()
+    {
+      if (!this->OutIds.empty())
+      {
+        this->Arrays->InterpolateEdges(this->GetNumberOfEdges(), this->V0.data(),
+          this->V1.data(), this->T.data(), this->OutIds.data());
+      }
+      this->V0.clear();
+      this->V1.clear();
+      this->T.clear();
+      this->OutIds.clear();
+    }
+  };
+
   /**
    * Loop over the array pairs and copy data from one to another. This (and the following methods)
    * can be used within threads.
@@ -927,6 +1103,34 @@ public:
    */
   void AssignNullValue(unsigned short outId) { this->AssignNullValue<unsigned short>(outId); }
 
+  /**
+   * Copy the input tuples inIds[0..numIds) to the consecutive output tuples
+   * starting at outStartId. Each array processes the whole list at once,
+   * which is much faster than repeated calls to Copy() when there are many
+   * arrays.
+   */
+  void CopyTuples(vtkIdType numIds, const vtkIdType* inIds, vtkIdType outStartId)
+  {
+    for (auto& array : this->Arrays)
+    {
+      array->CopyTuples(numIds, inIds, outStartId);
+    }
+  }
+  /**
+   * Perform numEdges edge interpolations: output tuple outIds[i] is
+   * interpolated between the input tuples v0s[i] and v1s[i] with the
+   * parametric coordinate ts[i]. Each array processes the whole list at
+   * once, see also EdgeBatch.
+   */
+  void InterpolateEdges(vtkIdType numEdges, const vtkIdType* v0s, const vtkIdType* v1s,
+    const double* ts, const vtkIdType* outIds)
+  {
+    for (auto& array : this->Arrays)
+    {
+      array->InterpolateEdges(numEdges, v0s, v1s, ts, outIds);
+    }
+  }
+
   /**
    * Extend (realloc) the arrays.
    */
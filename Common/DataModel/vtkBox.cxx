@@ -1,10 +1,13 @@
 // SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkBox.h"
+#include "vtkArrayDispatch.h"
 #include "vtkBoundingBox.h"
+#include "vtkDataArrayRange.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
 #include "vtkPlane.h"
+#include "vtkSMPTools.h"
 
 #include <algorithm> // for sorting
 #include <cassert>
@@ -109,19 +112,19 @@ void vtkBox::AddBounds(const double bounds[6])
   }
 }
 
-//------------------------------------------------------------------------------
-// Evaluate box equation. This differs from the similar vtkPlanes
-// (with six planes) because of the "rounded" nature of the corners.
-double vtkBox::EvaluateFunction(double x[3])
+namespace
+{
+// Signed distance to the box, shared by the single point and the batch
+// evaluations. This differs from the similar vtkPlanes (with six planes)
+// because of the "rounded" nature of the corners.
+inline double BoxDistance(const double x[3], const double minP[3], const double maxP[3])
 {
   double diff, dist, minDistance = (-VTK_DOUBLE_MAX), t, distance = 0.0;
   int inside = 1;
-  const double* minP = this->BBox->GetMinPoint();
-  const double* maxP = this->BBox->GetMaxPoint();
 
   for (int i = 0; i < 3; i++)
   {
-    diff = this->BBox->GetLength(i);
+    diff = maxP[i] - minP[i];
     if (diff != 0.0)
     {
       t = (x[i] - minP[i]) / diff;
@@ -176,6 +179,58 @@ double vtkBox::EvaluateFunction(double x[3])
   }
 }
 
+struct BoxFunctionWorker
+{
+  double MinPoint[3];
+  double MaxPoint[3];
+
+  template <typename InputArrayType, typename OutputArrayType>
+  void operator()(InputArrayType* input, OutputArrayType* output)
+  {
+    const auto srcTuples = vtk::DataArrayTupleRange<3>(input);
+    auto dstValues = vtk::DataArrayValueRange<1>(output);
+    using DstValueT = typename decltype(dstValues)::ValueType;
+
+    vtkSMPTools::For(0, input->GetNumberOfTuples(), [&](vtkIdType begin, vtkIdType end) {
+      double tuple[3];
+      for (vtkIdType pointId = begin; pointId < end; ++pointId)
+      {
+        srcTuples.GetTuple(pointId, tuple);
+        dstValues[pointId] =
+          static_cast<DstValueT>(BoxDistance(tuple, this->MinPoint, this->MaxPoint));
+      }
+    });
+  }
+};
+} // end anon namespace
+
+//------------------------------------------------------------------------------
+// Evaluate box equation.
+double vtkBox::EvaluateFunction(double x[3])
+{
+  return BoxDistance(x, this->BBox->GetMinPoint(), this->BBox->GetMaxPoint());
+}
+
+//------------------------------------------------------------------------------
+void vtkBox::EvaluateFunction(vtkDataArray* input, vtkDataArray* output)
+{
+  output->SetNumberOfComponents(1);
+  output->SetNumberOfTuples(input->GetNumberOfTuples());
+
+  BoxFunctionWorker worker;
+  std::copy_n(this->BBox->GetMinPoint(), 3, worker.MinPoint);
+  std::copy_n(this->BBox->GetMaxPoint(), 3, worker.MaxPoint);
+  typedef vtkTypeList::Create<float, double> InputTypes;
+  typedef vtkTypeList::Create<float, double> OutputTypes;
+  typedef vtkArrayDispatch::Dispatch2ByValueTypeUsingArrays<vtkArrayDispatch::AllArrays, InputTypes,
+    OutputTypes>
+    MyDispatch;
+  if (!MyDispatch::Execute(input, output, worker))
+  {
+    worker(input, output); // Use vtkDataArray API if dispatch fails.
+  }
+}
+
 //------------------------------------------------------------------------------
 // Evaluate box gradient.
 void vtkBox::EvaluateGradient(double x[3], double n[3])
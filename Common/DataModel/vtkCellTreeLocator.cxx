@@ -10,6 +10,8 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 
 #include <algorithm>
 #include <array>
@@ -62,6 +64,7 @@ struct vtkCellTree
   virtual int IntersectWithLine(const double p1[3], const double p2[3], double tol,
     vtkPoints* points, vtkIdList* cellIds, vtkGenericCell* cell) = 0;
   virtual void GenerateRepresentation(int level, vtkPolyData* pd) = 0;
+  virtual bool Refit() = 0;
 
   // Utility methods
   static int getDominantAxis(const double dir[3])
@@ -210,6 +213,65 @@ struct CellTree : public vtkCellTree
   int IntersectWithLine(const double p1[3], const double p2[3], double tol, vtkPoints* points,
     vtkIdList* cellIds, vtkGenericCell* cell) override;
   void GenerateRepresentation(int level, vtkPolyData* pd) override;
+
+  // Recompute the split planes of the nodes from the current cell bounds,
+  // keeping the partition of the cells. The nodes are stored breadth first,
+  // children after their parent, so a reverse traversal processes the
+  // children before their parent.
+  bool Refit() override
+  {
+    if (static_cast<vtkIdType>(this->Leaves.size()) != this->DataSet->GetNumberOfCells() ||
+      this->Nodes.empty())
+    {
+      return false;
+    }
+
+    // The first call is done serially to avoid the side effects of
+    // GetCellBounds() when the bounds are not cached.
+    double cellBounds[6], *cellBoundsPtr;
+    cellBoundsPtr = cellBounds;
+    this->Locator->GetCellBounds(0, cellBoundsPtr);
+
+    const vtkIdType numNodes = static_cast<vtkIdType>(this->Nodes.size());
+    std::vector<vtkBoundingBox> boxes(this->Nodes.size());
+    vtkSMPTools::For(0, numNodes,
+      [this, &boxes](vtkIdType node, vtkIdType endNode)
+      {
+        double bounds[6], *boundsPtr;
+        for (; node < endNode; ++node)
+        {
+          const TCellTreeNode& n = this->Nodes[node];
+          if (!n.IsLeaf())
+          {
+            continue;
+          }
+          for (T i = n.Start(); i < n.Start() + n.Size(); ++i)
+          {
+            boundsPtr = bounds;
+            this->Locator->GetCellBounds(this->Leaves[i], boundsPtr);
+            boxes[node].AddBounds(boundsPtr);
+          }
+        }
+      });
+
+    for (vtkIdType node = numNodes - 1; node >= 0; --node)
+    {
+      TCellTreeNode& n = this->Nodes[node];
+      if (n.IsLeaf())
+      {
+        continue;
+      }
+      const vtkBoundingBox& left = boxes[n.GetLeftChildIndex()];
+      const vtkBoundingBox& right = boxes[n.GetRightChildIndex()];
+      const T dim = n.GetDimension();
+      n.LeftMax = left.GetMaxPoint()[dim];
+      n.RightMin = right.GetMinPoint()[dim];
+      boxes[node] = left;
+      boxes[node].AddBox(right);
+    }
+    boxes[0].GetBounds(this->DataBBox);
+    return true;
+  }
 };
 
 //------------------------------------------------------------------------------
@@ -319,6 +381,19 @@ private:
         this->Max = max;
       }
     }
+
+    inline void Merge(const Bucket& other)
+    {
+      this->Cnt += other.Cnt;
+      if (other.Min < this->Min)
+      {
+        this->Min = other.Min;
+      }
+      if (other.Max > this->Max)
+      {
+        this->Max = other.Max;
+      }
+    }
   };
 
   struct CellInfo
@@ -381,9 +456,25 @@ private:
   int NumberOfBuckets;
   int NumberOfNodesPerLeaf;
 
+  using TNodes = std::vector<TCellTreeNode>;
+  using TSplitStack = std::stack<SplitInfo>;
+
+  // A subtree built independently by one thread. Its root replaces the leaf
+  // RootIndex of the top of the tree, its nodes are indexed locally.
+  struct Subtree
+  {
+    T RootIndex;
+    SplitInfo Root;
+    TNodes Nodes;
+  };
+
   std::vector<CellInfo> CellsInfo;
-  std::vector<CellTreeNode<T>> Nodes;
-  std::stack<SplitInfo> SplitStack;
+  TNodes Nodes;
+  TSplitStack SplitStack;
+  std::vector<Subtree> Subtrees;
+  // Nodes with fewer cells are built as independent subtrees, larger ones
+  // are split with parallel binning of the cell centers.
+  vtkIdType SubtreeSize;
 
   struct BucketsType : public std::array<std::vector<Bucket>, 3>
   {
@@ -406,6 +497,105 @@ private:
   };
   BucketsType Buckets;
 
+  // -------------------------------------------------------------------------
+  void BinCells(const CellInfo* begin, const CellInfo* end, const double min[3],
+    const double iext[3], BucketsType& buckets)
+  {
+    for (const CellInfo* pc = begin; pc != end; ++pc)
+    {
+      for (uint8_t d = 0; d < 3; ++d)
+      {
+        double cen = (pc->Min[d] + pc->Max[d]) / 2.0;
+        double dblIdx = (cen - min[d]) * iext[d];
+        dblIdx = vtkMath::ClampValue(dblIdx, 0.0, static_cast<double>(this->NumberOfBuckets - 1));
+        size_t ind = static_cast<size_t>(dblIdx);
+
+        buckets[d][ind].Add(pc->Min[d], pc->Max[d]);
+      }
+    }
+  }
+
+  // -------------------------------------------------------------------------
+  // Bin the cells of a large node in parallel, each thread filling its own
+  // buckets which are merged at the end.
+  struct ParallelBinning
+  {
+    CellTreeBuilder* Builder;
+    const CellInfo* Begin;
+    const double* Min;
+    const double* IExt;
+    BucketsType& Buckets;
+    vtkSMPThreadLocal<BucketsType> LocalBuckets;
+
+    ParallelBinning(CellTreeBuilder* builder, const CellInfo* begin, const double* min,
+      const double* iext, BucketsType& buckets)
+      : Builder(builder)
+      , Begin(begin)
+      , Min(min)
+      , IExt(iext)
+      , Buckets(buckets)
+    {
+    }
+
+    void Initialize() { this->LocalBuckets.Local() = BucketsType(this->Builder->NumberOfBuckets); }
+
+    void operator()(vtkIdType begin, vtkIdType end)
+    {
+      this->Builder->BinCells(
+        this->Begin + begin, this->Begin + end, this->Min, this->IExt, this->LocalBuckets.Local());
+    }
+
+    void Reduce()
+    {
+      for (const auto& localBuckets : this->LocalBuckets)
+      {
+        for (uint8_t d = 0; d < 3; ++d)
+        {
+          for (int n = 0; n < this->Builder->NumberOfBuckets; ++n)
+          {
+            this->Buckets[d][n].Merge(localBuckets[d][n]);
+          }
+        }
+      }
+    }
+  };
+
+  // -------------------------------------------------------------------------
+  // Build the subtrees in parallel. They cover disjoint ranges of CellsInfo.
+  struct BuildSubtrees
+  {
+    CellTreeBuilder* Builder;
+    vtkSMPThreadLocal<BucketsType> LocalBuckets;
+
+    BuildSubtrees(CellTreeBuilder* builder)
+      : Builder(builder)
+    {
+    }
+
+    void Initialize() { this->LocalBuckets.Local() = BucketsType(this->Builder->NumberOfBuckets); }
+
+    void operator()(vtkIdType subtreeId, vtkIdType endSubtreeId)
+    {
+      BucketsType& buckets = this->LocalBuckets.Local();
+      TSplitStack splitStack;
+      for (; subtreeId < endSubtreeId; ++subtreeId)
+      {
+        Subtree& subtree = this->Builder->Subtrees[subtreeId];
+        subtree.Nodes.push_back(this->Builder->Nodes[subtree.RootIndex]);
+        splitStack.emplace(0, subtree.Root.Min, subtree.Root.Max);
+        while (!splitStack.empty())
+        {
+          auto splitInfo = std::move(splitStack.top());
+          splitStack.pop();
+          this->Builder->Split(
+            splitInfo.Index, splitInfo.Min, splitInfo.Max, subtree.Nodes, splitStack, buckets);
+        }
+      }
+    }
+
+    void Reduce() {}
+  };
+
   // -------------------------------------------------------------------------
   void FindMinMax(const CellInfo* begin, const CellInfo* end, double* min, double* max)
   {
@@ -437,10 +627,11 @@ private:
   }
 
   // -------------------------------------------------------------------------
-  void Split(T index, double min[3], double max[3], BucketsType& buckets)
+  void Split(T index, double min[3], double max[3], TNodes& nodes, TSplitStack& splitStack,
+    BucketsType& buckets)
   {
-    const T& start = this->Nodes[index].Start();
-    const T& size = this->Nodes[index].Size();
+    const T start = nodes[index].Start();
+    const T size = nodes[index].Size();
 
     if (size < this->NumberOfNodesPerLeaf)
     {
@@ -457,17 +648,14 @@ private:
 
     buckets.Reset();
 
-    for (const CellInfo* pc = begin; pc != end; ++pc)
+    if (size >= this->SubtreeSize)
     {
-      for (uint8_t d = 0; d < 3; ++d)
-      {
-        double cen = (pc->Min[d] + pc->Max[d]) / 2.0;
-        double dblIdx = (cen - min[d]) * iext[d];
-        dblIdx = vtkMath::ClampValue(dblIdx, 0.0, static_cast<double>(this->NumberOfBuckets - 1));
-        size_t ind = static_cast<size_t>(dblIdx);
-
-        buckets[d][ind].Add(pc->Min[d], pc->Max[d]);
-      }
+      ParallelBinning binning(this, begin, min, iext, buckets);
+      vtkSMPTools::For(0, static_cast<vtkIdType>(size), binning);
+    }
+    else
+    {
+      this->BinCells(begin, end, min, iext, buckets);
     }
 
     double cost = VTK_DOUBLE_MAX;
@@ -548,11 +736,11 @@ private:
     child[0].MakeLeaf(begin - this->CellsInfo.data(), mid - begin);
     child[1].MakeLeaf(mid - this->CellsInfo.data(), end - mid);
 
-    this->Nodes[index].MakeNode(static_cast<T>(this->Nodes.size()), dim, clip);
-    this->Nodes.insert(this->Nodes.end(), child, child + 2);
+    nodes[index].MakeNode(static_cast<T>(nodes.size()), dim, clip);
+    nodes.insert(nodes.end(), child, child + 2);
 
-    this->SplitStack.emplace(this->Nodes[index].GetRightChildIndex(), rMin, rMax);
-    this->SplitStack.emplace(this->Nodes[index].GetLeftChildIndex(), lMin, lMax);
+    splitStack.emplace(nodes[index].GetRightChildIndex(), rMin, rMax);
+    splitStack.emplace(nodes[index].GetLeftChildIndex(), lMin, lMax);
   }
 
 public:
@@ -567,42 +755,50 @@ public:
     const auto numberOfCells = static_cast<T>(this->DataSet->GetNumberOfCells());
     this->CellsInfo.resize(static_cast<size_t>(numberOfCells));
 
-    double min[3] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MAX, VTK_DOUBLE_MAX };
-    double max[3] = {
-      -VTK_DOUBLE_MAX,
-      -VTK_DOUBLE_MAX,
-      -VTK_DOUBLE_MAX,
-    };
-
+    // Gather the cell bounds in parallel. The first call is done serially to
+    // avoid the side effects of GetCellBounds() when the bounds are not cached.
     double cellBounds[6], *cellBoundsPtr;
     cellBoundsPtr = cellBounds;
-    for (T i = 0; i < numberOfCells; ++i)
-    {
-      this->CellsInfo[i].Ind = i;
-      this->Locator->GetCellBounds(i, cellBoundsPtr);
+    this->Locator->GetCellBounds(0, cellBoundsPtr);
 
-      for (uint8_t d = 0; d < 3; ++d)
+    vtkSMPThreadLocal<vtkBoundingBox> localBBoxes;
+    vtkSMPTools::For(0, static_cast<vtkIdType>(numberOfCells),
+      [this, &localBBoxes](vtkIdType begin, vtkIdType end)
       {
-        this->CellsInfo[i].Min[d] = cellBoundsPtr[2 * d + 0];
-        this->CellsInfo[i].Max[d] = cellBoundsPtr[2 * d + 1];
-
-        if (this->CellsInfo[i].Min[d] < min[d])
+        vtkBoundingBox& bbox = localBBoxes.Local();
+        double bounds[6], *boundsPtr;
+        for (vtkIdType i = begin; i < end; ++i)
         {
-          min[d] = this->CellsInfo[i].Min[d];
-        }
-        if (this->CellsInfo[i].Max[d] > max[d])
-        {
-          max[d] = this->CellsInfo[i].Max[d];
+          boundsPtr = bounds;
+          CellInfo& info = this->CellsInfo[i];
+          info.Ind = static_cast<T>(i);
+          this->Locator->GetCellBounds(i, boundsPtr);
+          for (uint8_t d = 0; d < 3; ++d)
+          {
+            info.Min[d] = boundsPtr[2 * d + 0];
+            info.Max[d] = boundsPtr[2 * d + 1];
+          }
+          bbox.AddBounds(boundsPtr);
         }
-      }
-    }
+      });
 
-    this->Tree.DataBBox[0] = min[0];
-    this->Tree.DataBBox[1] = max[0];
-    this->Tree.DataBBox[2] = min[1];
-    this->Tree.DataBBox[3] = max[1];
-    this->Tree.DataBBox[4] = min[2];
-    this->Tree.DataBBox[5] = max[2];
+    vtkBoundingBox dataBBox;
+    for (const auto& bbox : localBBoxes)
+    {
+      dataBBox.AddBox(bbox);
+    }
+    dataBBox.GetBounds(this->Tree.DataBBox);
+    double min[3], max[3];
+    dataBBox.GetMinPoint(min);
+    dataBBox.GetMaxPoint(max);
+
+    // Split the top of the tree until the nodes are small enough to give
+    // each thread several subtrees to build. Small data sets are built by a
+    // single thread.
+    const vtkIdType minSubtreeSize = 8192;
+    const vtkIdType numberOfThreads = vtkSMPTools::GetEstimatedNumberOfThreads();
+    this->SubtreeSize =
+      std::max(static_cast<vtkIdType>(numberOfCells) / (8 * numberOfThreads), minSubtreeSize);
 
     TCellTreeNode root;
     root.MakeLeaf(0, numberOfCells);
@@ -619,13 +815,43 @@ public:
 
   void operator()()
   {
+    // Split the large nodes at the top of the tree, deferring the small
+    // enough ones to independent subtrees.
     auto& buckets = this->Buckets;
     while (!this->SplitStack.empty())
     {
       auto splitInfo = std::move(this->SplitStack.top());
       this->SplitStack.pop();
-      this->Split(splitInfo.Index, splitInfo.Min, splitInfo.Max, buckets);
+      if (this->Nodes[splitInfo.Index].Size() < this->SubtreeSize)
+      {
+        this->Subtrees.push_back(Subtree{ splitInfo.Index, splitInfo, TNodes() });
+        continue;
+      }
+      this->Split(
+        splitInfo.Index, splitInfo.Min, splitInfo.Max, this->Nodes, this->SplitStack, buckets);
     }
+
+    BuildSubtrees buildSubtrees(this);
+    vtkSMPTools::For(0, static_cast<vtkIdType>(this->Subtrees.size()), 1, buildSubtrees);
+
+    // Append the subtrees to the top of the tree. The local child indices
+    // of a subtree are shifted by the position its nodes are inserted at
+    // (the local root replacing the subtree leaf).
+    for (auto& subtree : this->Subtrees)
+    {
+      const T offset = static_cast<T>(this->Nodes.size()) - 1;
+      for (auto& node : subtree.Nodes)
+      {
+        if (node.IsNode())
+        {
+          node.SetChildren(node.GetLeftChildIndex() + offset);
+        }
+      }
+      this->Nodes[subtree.RootIndex] = subtree.Nodes[0];
+      this->Nodes.insert(this->Nodes.end(), subtree.Nodes.begin() + 1, subtree.Nodes.end());
+      TNodes().swap(subtree.Nodes);
+    }
+    this->Subtrees.clear();
   }
 
   void Reduce()
@@ -1281,6 +1507,27 @@ vtkCellTreeLocator::~vtkCellTreeLocator()
   this->FreeCellBounds();
 }
 
+//------------------------------------------------------------------------------
+bool vtkCellTreeLocator::RefitLocator()
+{
+  if (!this->Tree || !this->DataSet || this->Tree->DataSet != this->DataSet)
+  {
+    this->ForceBuildLocator();
+    return false;
+  }
+
+  // Update the cached cell bounds before refitting the tree
+  this->ComputeCellBounds();
+  if (!this->Tree->Refit())
+  {
+    this->ForceBuildLocator();
+    return false;
+  }
+
+  this->BuildTime.Modified();
+  return true;
+}
+
 //------------------------------------------------------------------------------
 void vtkCellTreeLocator::FreeSearchStructure()
 {
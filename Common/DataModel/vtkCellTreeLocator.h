@@ -157,6 +157,18 @@ public:
   void GenerateRepresentation(int level, vtkPolyData* pd) override;
   ///@}
 
+  /**
+   * Update the locator after the points of the data set moved, instead of
+   * rebuilding it. The partition of the cells in the tree is kept and only
+   * the bounds of its nodes are recomputed, which is much faster than a
+   * rebuild but makes the queries slower as the cells move away from their
+   * initial position, so the locator should still be rebuilt once in a
+   * while. When the tree cannot be refitted (the locator was never built or
+   * the number of cells changed) the locator is rebuilt and false is
+   * returned. This method is not thread safe.
+   */
+  bool RefitLocator();
+
   /**
    * Shallow copy of a vtkCellTreeLocator.
    */
@@ -0,0 +1,141 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef vtkForEachCell_h
+#define vtkForEachCell_h
+
+#include "vtkCellArray.h"
+#include "vtkDataSet.h"
+#include "vtkIdList.h"
+#include "vtkNew.h"
+#include "vtkPolyData.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace vtk
+{
+namespace detail
+{
+VTK_ABI_NAMESPACE_BEGIN
+
+// Visit the cells of the cell array of an unstructured grid. The point ids
+// are read in place when the cell array stores vtkIdType values and copied
+// to a buffer otherwise.
+struct ForEachCellArrayWorker
+{
+  template <typename CellStateT, typename Functor>
+  void operator()(CellStateT& state, const unsigned char* types, vtkIdType begin, vtkIdType end,
+    Functor& functor) const
+  {
+    using ValueType = typename CellStateT::ValueType;
+    const ValueType* offsets = state.GetOffsets()->GetPointer(0);
+    const ValueType* connectivity = state.GetConnectivity()->GetPointer(0);
+    std::vector<vtkIdType> buffer;
+    std::integral_constant<bool, CellStateT::ValueTypeIsSameAsIdType> inPlace;
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      const vtkIdType npts = static_cast<vtkIdType>(offsets[cellId + 1] - offsets[cellId]);
+      const vtkIdType* pts =
+        this->GetPointIds(connectivity + offsets[cellId], npts, buffer, inPlace);
+      functor(cellId, static_cast<int>(types[cellId]), npts, pts);
+    }
+  }
+
+  template <typename ValueType>
+  const vtkIdType* GetPointIds(
+    const ValueType* ids, vtkIdType, std::vector<vtkIdType>&, std::true_type) const
+  {
+    return reinterpret_cast<const vtkIdType*>(ids);
+  }
+
+  template <typename ValueType>
+  const vtkIdType* GetPointIds(
+    const ValueType* ids, vtkIdType npts, std::vector<vtkIdType>& buffer, std::false_type) const
+  {
+    buffer.assign(ids, ids + npts);
+    return buffer.data();
+  }
+};
+
+VTK_ABI_NAMESPACE_END
+} // end namespace detail
+
+VTK_ABI_NAMESPACE_BEGIN
+
+/**
+ * Call `functor(cellId, cellType, npts, pts)` for each cell of `dataSet` in
+ * [begin, end), where `pts` holds the `npts` point ids of the cell (the point
+ * ids, not the face stream, for polyhedra). This is a lighter alternative to
+ * `vtkDataSet::GetCell(cellId, vtkGenericCell*)` for algorithms that only need
+ * the type and the points of the cells: nothing is copied into a cell, and the
+ * functor can switch on the cell type to inline a kernel for each type.
+ *
+ * Unstructured grids are visited straight from their type and connectivity
+ * arrays, and polydata through their inlined cell map. Other datasets go
+ * through the thread safe `vtkDataSet::GetCellPoints(cellId, npts, pts, ptIds)`.
+ *
+ * `pts` is only valid during the call of the functor. This function may be
+ * called concurrently on disjoint ranges of cells, as it is usually done within
+ * `vtkSMPTools::For()`, once the dataset is ready for threaded access: like for
+ * `vtkDataSet::GetCell()`, call `GetCell()` once beforehand from a single
+ * thread so that polydata build their cells.
+ *
+ * ```cpp
+ * vtkSMPTools::For(0, dataSet->GetNumberOfCells(), [&](vtkIdType begin, vtkIdType end) {
+ *   vtk::ForEachCell(dataSet, begin, end,
+ *     [&](vtkIdType cellId, int cellType, vtkIdType npts, const vtkIdType* pts) {
+ *       // ...
+ *     });
+ * });
+ * ```
+ */
+template <typename Functor>
+void ForEachCell(vtkDataSet* dataSet, vtkIdType begin, vtkIdType end, Functor&& functor)
+{
+  if (begin >= end)
+  {
+    return;
+  }
+
+  if (vtkUnstructuredGrid* grid = vtkUnstructuredGrid::SafeDownCast(dataSet))
+  {
+    vtkCellArray* cells = grid->GetCells();
+    vtkUnsignedCharArray* types = grid->GetCellTypesArray();
+    if (cells && types)
+    {
+      cells->Visit(
+        detail::ForEachCellArrayWorker{}, types->GetPointer(0), begin, end, functor);
+    }
+    return;
+  }
+
+  vtkNew<vtkIdList> ptIds;
+  vtkIdType npts;
+  const vtkIdType* pts;
+  if (vtkPolyData* polyData = vtkPolyData::SafeDownCast(dataSet))
+  {
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      polyData->vtkPolyData::GetCellPoints(cellId, npts, pts, ptIds);
+      functor(cellId, polyData->vtkPolyData::GetCellType(cellId), npts, pts);
+    }
+    return;
+  }
+
+  for (vtkIdType cellId = begin; cellId < end; ++cellId)
+  {
+    dataSet->GetCellPoints(cellId, npts, pts, ptIds);
+    functor(cellId, dataSet->GetCellType(cellId), npts, pts);
+  }
+}
+
+VTK_ABI_NAMESPACE_END
+} // end namespace vtk
+
+#endif // vtkForEachCell_h
+
+// VTK-HeaderTest-Exclude: vtkForEachCell.h
@@ -127,6 +127,11 @@ struct vtkCompactHyperTreeData
 
   // Storage to record the local to global id mapping
   std::vector<vtkIdType> GlobalIndexTable_stl;
+
+  // Compact storage of the local to global id mapping set by Freeze, as
+  // 32-bit offsets from the smallest global index
+  std::vector<unsigned int> GlobalIndexOffsets_stl;
+  vtkIdType GlobalIndexBase = 0;
 };
 
 //=============================================================================
@@ -311,6 +316,47 @@ public:
   vtkHyperTree* Freeze(const char* vtkNotUsed(mode)) override
   {
     // Option not used
+    vtkCompactHyperTreeData* datas = this->CompactDatas.get();
+
+    // Trailing leaves need no entry, see IsLeaf
+    auto& elderChild = datas->ParentToElderChild_stl;
+    while (elderChild.size() > 1 && elderChild.back() == std::numeric_limits<unsigned int>::max())
+    {
+      elderChild.pop_back();
+    }
+    elderChild.shrink_to_fit();
+
+    // An explicit global index mapping is replaced by an implicit one when
+    // its indices are consecutive, or else by 32-bit offsets when possible
+    auto& globalIndices = datas->GlobalIndexTable_stl;
+    if (!globalIndices.empty())
+    {
+      const auto range = std::minmax_element(globalIndices.begin(), globalIndices.end());
+      const vtkIdType base = *range.first;
+      bool consecutive = true;
+      for (std::size_t i = 0; i < globalIndices.size() && consecutive; ++i)
+      {
+        consecutive = globalIndices[i] == globalIndices[0] + static_cast<vtkIdType>(i);
+      }
+      if (consecutive && base >= 0 &&
+        static_cast<vtkIdType>(globalIndices.size()) == this->Datas->NumberOfVertices)
+      {
+        this->Datas->GlobalIndexStart = base;
+        globalIndices.clear();
+      }
+      else if (base >= 0 &&
+        *range.second - base < static_cast<vtkIdType>(std::numeric_limits<unsigned int>::max()))
+      {
+        datas->GlobalIndexBase = base;
+        datas->GlobalIndexOffsets_stl.resize(globalIndices.size());
+        for (std::size_t i = 0; i < globalIndices.size(); ++i)
+        {
+          datas->GlobalIndexOffsets_stl[i] = static_cast<unsigned int>(globalIndices[i] - base);
+        }
+        globalIndices.clear();
+      }
+      globalIndices.shrink_to_fit();
+    }
     return this;
   }
 
@@ -324,7 +370,8 @@ public:
   void SetGlobalIndexStart(vtkIdType start) override
   {
     assert("pre: not_global_index_start_if_use_global_index_from_local" &&
-      this->CompactDatas->GlobalIndexTable_stl.size() == 0);
+      this->CompactDatas->GlobalIndexTable_stl.empty() &&
+      this->CompactDatas->GlobalIndexOffsets_stl.empty());
 
     this->Datas->GlobalIndexStart = start;
   }
@@ -335,6 +382,20 @@ public:
     assert("pre: not_global_index_from_local_if_use_global_index_start" &&
       this->Datas->GlobalIndexStart < 0);
 
+    // Restore the explicit mapping compacted by Freeze
+    vtkCompactHyperTreeData* datas = this->CompactDatas.get();
+    if (!datas->GlobalIndexOffsets_stl.empty())
+    {
+      datas->GlobalIndexTable_stl.assign(
+        datas->GlobalIndexOffsets_stl.begin(), datas->GlobalIndexOffsets_stl.end());
+      for (vtkIdType& globalIndex : datas->GlobalIndexTable_stl)
+      {
+        globalIndex += datas->GlobalIndexBase;
+      }
+      datas->GlobalIndexOffsets_stl.clear();
+      datas->GlobalIndexOffsets_stl.shrink_to_fit();
+    }
+
     // If local index outside map range, resize the latter
     if (static_cast<vtkIdType>(this->CompactDatas->GlobalIndexTable_stl.size()) <= index)
     {
@@ -359,6 +420,14 @@ public:
         "pre: not_positive_global_index" && this->CompactDatas->GlobalIndexTable_stl[index] >= 0);
       return this->CompactDatas->GlobalIndexTable_stl[index];
     }
+    if (!this->CompactDatas->GlobalIndexOffsets_stl.empty())
+    {
+      // Case explicit global node index compacted by Freeze
+      assert("pre: not_valid_index" && index >= 0 &&
+        index < (vtkIdType)this->CompactDatas->GlobalIndexOffsets_stl.size());
+      return this->CompactDatas->GlobalIndexBase +
+        this->CompactDatas->GlobalIndexOffsets_stl[index];
+    }
     // Case implicit global node index
     assert("pre: not_positive_start_index" && this->Datas->GlobalIndexStart >= 0);
     assert("pre: not_valid_index" && index >= 0);
@@ -378,6 +447,13 @@ public:
         (*std::max_element(this->CompactDatas->GlobalIndexTable_stl.begin(), it_end)) >= 0);
       return *elt_found;
     }
+    if (!this->CompactDatas->GlobalIndexOffsets_stl.empty())
+    {
+      // Case explicit global node index compacted by Freeze
+      return this->CompactDatas->GlobalIndexBase +
+        *std::max_element(this->CompactDatas->GlobalIndexOffsets_stl.begin(),
+          this->CompactDatas->GlobalIndexOffsets_stl.end());
+    }
     // Case implicit global node index
     assert("pre: not_positive_start_index" && this->Datas->GlobalIndexStart >= 0);
     return this->Datas->GlobalIndexStart + this->Datas->NumberOfVertices - 1;
@@ -438,6 +514,7 @@ public:
     return static_cast<unsigned long>(
       sizeof(unsigned int) * this->CompactDatas->ParentToElderChild_stl.size() +
       sizeof(vtkIdType) * this->CompactDatas->GlobalIndexTable_stl.size() +
+      sizeof(unsigned int) * this->CompactDatas->GlobalIndexOffsets_stl.size() +
       3 * sizeof(unsigned char) + 6 * sizeof(vtkIdType));
   }
 
@@ -511,6 +588,7 @@ protected:
     this->CompactDatas->ParentToElderChild_stl[0] = 0;
     // By default, the root don't have parent
     this->CompactDatas->GlobalIndexTable_stl.clear();
+    this->CompactDatas->GlobalIndexOffsets_stl.clear();
   }
 
   //---------------------------------------------------------------------------
@@ -530,6 +608,17 @@ protected:
       os << " " << this->CompactDatas->GlobalIndexTable_stl[i];
     }
     os << endl;
+
+    if (!this->CompactDatas->GlobalIndexOffsets_stl.empty())
+    {
+      os << indent << "GlobalIndexBase: " << this->CompactDatas->GlobalIndexBase << endl;
+      os << indent << "GlobalIndexOffsets: ";
+      for (unsigned int offset : this->CompactDatas->GlobalIndexOffsets_stl)
+      {
+        os << " " << offset;
+      }
+      os << endl;
+    }
   }
 
   //---------------------------------------------------------------------------
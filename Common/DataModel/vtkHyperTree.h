@@ -277,7 +277,11 @@ public:
    * unmodifiable).
    * This method is calling by the Squeeze method of hypertree grid.
    * The mode parameter will allow to propose different instances.
-   * Today, there is none, the freeze call does not do anything.
+   * Today, there is none: the tree is compacted in place and returned.
+   * Trailing leaves are dropped from the elder child storage, and an
+   * explicit global index mapping is replaced by an implicit start index
+   * when consecutive, or else stored as 32-bit offsets when possible.
+   * It is meant to be called once the tree is built.
    */
   virtual vtkHyperTree* Freeze(const char* mode) = 0;
 
@@ -357,8 +361,8 @@ public:
    * Other versions of this code could be made available to meet
    * other needs without questioning cursors and filters.
    * Since an instance, an other instance can be creating by call
-   * the method Freeze (by default, nothing more, instance currently
-   * is returning).
+   * the method Freeze (by default, the instance currently is compacted
+   * and returned).
    */
   VTK_NEWINSTANCE
   static vtkHyperTree* CreateInstance(unsigned char branchFactor, unsigned char dimension);
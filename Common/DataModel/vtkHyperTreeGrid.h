@@ -109,6 +109,7 @@ public:
 
   /**
    * Squeeze this representation.
+   * Every tree is frozen, which compacts its storage, see vtkHyperTree::Freeze.
    */
   virtual void Squeeze();
 
@@ -2,9 +2,14 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkImplicitBoolean.h"
 
+#include "vtkDoubleArray.h"
 #include "vtkImplicitFunctionCollection.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 
+#include <algorithm>
 #include <cmath>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -61,6 +66,79 @@ void vtkImplicitBoolean::RemoveFunction(vtkImplicitFunction* f)
   }
 }
 
+// Evaluate boolean combinations of implicit function using current operator.
+// Each function is evaluated on all the points with its own batch evaluation,
+// then its values are combined in parallel with the values of the previous
+// functions.
+void vtkImplicitBoolean::EvaluateFunction(vtkDataArray* input, vtkDataArray* output)
+{
+  const vtkIdType numPts = input->GetNumberOfTuples();
+  output->SetNumberOfComponents(1);
+  output->SetNumberOfTuples(numPts);
+
+  if (this->FunctionList->GetNumberOfItems() == 0)
+  {
+    output->Fill(0.0);
+    return;
+  }
+
+  vtkSmartPointer<vtkDoubleArray> values = vtkArrayDownCast<vtkDoubleArray>(output);
+  if (!values)
+  {
+    values = vtkSmartPointer<vtkDoubleArray>::New();
+    values->SetNumberOfTuples(numPts);
+  }
+  vtkNew<vtkDoubleArray> fValues;
+
+  const int operation = this->OperationType;
+  bool first = true;
+  vtkImplicitFunction* f;
+  vtkCollectionSimpleIterator sit;
+  for (this->FunctionList->InitTraversal(sit);
+       (f = this->FunctionList->GetNextImplicitFunction(sit));)
+  {
+    f->FunctionValue(input, fValues);
+    double* value = values->GetPointer(0);
+    const double* v = fValues->GetPointer(0);
+    vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+      if (operation == VTK_UNION)
+      { // take minimum value
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          value[i] = first ? v[i] : std::min(value[i], v[i]);
+        }
+      }
+      else if (operation == VTK_INTERSECTION)
+      { // take maximum value
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          value[i] = first ? v[i] : std::max(value[i], v[i]);
+        }
+      }
+      else if (operation == VTK_UNION_OF_MAGNITUDES)
+      { // take minimum absolute value
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          value[i] = first ? std::fabs(v[i]) : std::min(value[i], std::fabs(v[i]));
+        }
+      }
+      else // difference
+      {
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          value[i] = first ? v[i] : std::max(value[i], -v[i]);
+        }
+      }
+    });
+    first = false;
+  }
+
+  if (values != output)
+  {
+    output->CopyComponent(0, values, 0);
+  }
+}
+
 // Evaluate boolean combinations of implicit function using current operator.
 double vtkImplicitBoolean::EvaluateFunction(double x[3])
 {
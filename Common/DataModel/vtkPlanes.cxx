@@ -2,12 +2,16 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkPlanes.h"
 
+#include "vtkArrayDispatch.h"
+#include "vtkDataArrayRange.h"
 #include "vtkDoubleArray.h"
 #include "vtkObjectFactory.h"
 #include "vtkPlane.h"
 #include "vtkPoints.h"
+#include "vtkSMPTools.h"
 
 #include <cmath>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkPlanes);
@@ -72,6 +76,83 @@ void vtkPlanes::SetNormals(vtkDataArray* normals)
   }
 }
 
+namespace
+{
+struct PlanesFunctionWorker
+{
+  // Normal and point of each plane, gathered once so that the evaluation of
+  // the points does not go through the vtkDataArray API of the planes.
+  std::vector<double> Planes;
+
+  template <typename InputArrayType, typename OutputArrayType>
+  void operator()(InputArrayType* input, OutputArrayType* output)
+  {
+    const auto srcTuples = vtk::DataArrayTupleRange<3>(input);
+    auto dstValues = vtk::DataArrayValueRange<1>(output);
+    using DstValueT = typename decltype(dstValues)::ValueType;
+
+    const double* planes = this->Planes.data();
+    const std::size_t numPlanes = this->Planes.size() / 6;
+    vtkSMPTools::For(0, input->GetNumberOfTuples(), [&](vtkIdType begin, vtkIdType end) {
+      double tuple[3];
+      for (vtkIdType pointId = begin; pointId < end; ++pointId)
+      {
+        srcTuples.GetTuple(pointId, tuple);
+        double maxVal = -VTK_DOUBLE_MAX;
+        for (std::size_t i = 0; i < numPlanes; ++i)
+        {
+          const double* plane = planes + 6 * i;
+          const double val = plane[0] * (tuple[0] - plane[3]) +
+            plane[1] * (tuple[1] - plane[4]) + plane[2] * (tuple[2] - plane[5]);
+          maxVal = val > maxVal ? val : maxVal;
+        }
+        dstValues[pointId] = static_cast<DstValueT>(maxVal);
+      }
+    });
+  }
+};
+} // end anon namespace
+
+//------------------------------------------------------------------------------
+void vtkPlanes::EvaluateFunction(vtkDataArray* input, vtkDataArray* output)
+{
+  output->SetNumberOfComponents(1);
+  output->SetNumberOfTuples(input->GetNumberOfTuples());
+
+  if (!this->Points || !this->Normals)
+  {
+    vtkErrorMacro(<< "Please define points and/or normals!");
+    output->Fill(VTK_DOUBLE_MAX);
+    return;
+  }
+
+  const vtkIdType numPlanes = this->Points->GetNumberOfPoints();
+  if (numPlanes != this->Normals->GetNumberOfTuples())
+  {
+    vtkErrorMacro(<< "Number of normals/points inconsistent!");
+    output->Fill(VTK_DOUBLE_MAX);
+    return;
+  }
+
+  PlanesFunctionWorker worker;
+  worker.Planes.resize(6 * numPlanes);
+  for (vtkIdType i = 0; i < numPlanes; ++i)
+  {
+    this->Normals->GetTuple(i, worker.Planes.data() + 6 * i);
+    this->Points->GetPoint(i, worker.Planes.data() + 6 * i + 3);
+  }
+
+  typedef vtkTypeList::Create<float, double> InputTypes;
+  typedef vtkTypeList::Create<float, double> OutputTypes;
+  typedef vtkArrayDispatch::Dispatch2ByValueTypeUsingArrays<vtkArrayDispatch::AllArrays, InputTypes,
+    OutputTypes>
+    MyDispatch;
+  if (!MyDispatch::Execute(input, output, worker))
+  {
+    worker(input, output); // Use vtkDataArray API if dispatch fails.
+  }
+}
+
 //------------------------------------------------------------------------------
 // Evaluate plane equations. Return the largest value.
 double vtkPlanes::EvaluateFunction(double x[3])
@@ -17,6 +17,7 @@
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
+#include "vtkStaticCellLinks.h"
 #include "vtkUnsignedCharArray.h"
 
 #include <stdexcept>
@@ -824,18 +825,35 @@ void vtkPolyData::BuildLinks(int initialSize)
   {
     return;
   }
+  // Create appropriate links: a vtkCellLinks when the dataset is editable,
+  // a vtkStaticCellLinks otherwise. Links of the wrong kind (e.g. built
+  // before the Editable flag changed) are replaced.
+  const bool editableLinks =
+    this->Links && this->Links->GetType() == vtkAbstractCellLinks::CELL_LINKS;
+  if (this->Links && editableLinks != static_cast<bool>(this->Editable))
+  {
+    this->Links = nullptr;
+  }
   if (!this->Links)
   {
-    this->Links = vtkSmartPointer<vtkCellLinks>::New();
-    if (initialSize > 0)
+    if (!this->Editable)
     {
-      this->Links->Allocate(initialSize);
+      this->Links = vtkSmartPointer<vtkStaticCellLinks>::New();
+    }
+    else
+    {
+      vtkNew<vtkCellLinks> links;
+      if (initialSize > 0)
+      {
+        links->Allocate(initialSize);
+      }
+      this->Links = links;
     }
     this->Links->SetDataSet(this);
   }
-  else if (initialSize > 0)
+  else if (initialSize > 0 && this->Editable)
   {
-    this->Links->Allocate(initialSize);
+    static_cast<vtkCellLinks*>(this->Links.Get())->Allocate(initialSize);
     this->Links->SetDataSet(this);
   }
   else if (this->Points->GetMTime() > this->Links->GetMTime())
@@ -850,14 +868,14 @@ void vtkPolyData::SetLinks(vtkAbstractCellLinks* links)
 {
   if (this->Links != links)
   {
-    if (auto cellLinks = vtkCellLinks::SafeDownCast(links))
+    if (!links || vtkCellLinks::SafeDownCast(links) || vtkStaticCellLinks::SafeDownCast(links))
     {
-      this->Links = cellLinks;
+      this->Links = links;
       this->Modified();
     }
     else
     {
-      vtkErrorMacro("Only vtkCellLinks are currently supported.");
+      vtkErrorMacro("Only vtkCellLinks and vtkStaticCellLinks are currently supported.");
     }
   }
 }
@@ -883,6 +901,23 @@ void vtkPolyData::GetCellPoints(vtkIdType cellId, vtkIdList* ptIds)
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkPolyData::GetPointCells(vtkIdType ptId, vtkIdType& ncells, vtkIdType*& cells)
+{
+  if (this->Links->GetType() == vtkAbstractCellLinks::CELL_LINKS)
+  {
+    vtkCellLinks* links = static_cast<vtkCellLinks*>(this->Links.Get());
+    ncells = links->GetNcells(ptId);
+    cells = links->GetCells(ptId);
+  }
+  else
+  {
+    vtkStaticCellLinks* links = static_cast<vtkStaticCellLinks*>(this->Links.Get());
+    ncells = links->GetNcells(ptId);
+    cells = links->GetCells(ptId);
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkPolyData::GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
 {
@@ -896,8 +931,7 @@ void vtkPolyData::GetPointCells(vtkIdType ptId, vtkIdList* cellIds)
   }
   cellIds->Reset();
 
-  numCells = this->Links->GetNcells(ptId);
-  cells = this->Links->GetCells(ptId);
+  this->GetPointCells(ptId, numCells, cells);
 
   for (i = 0; i < numCells; i++)
   {
@@ -1058,7 +1092,7 @@ void vtkPolyData::ReverseCell(vtkIdType cellId)
 // use this method, make sure points are available and BuildLinks() has been invoked.)
 vtkIdType vtkPolyData::InsertNextLinkedPoint(int numLinks)
 {
-  return this->Links->InsertNextPoint(numLinks);
+  return static_cast<vtkCellLinks*>(this->Links.Get())->InsertNextPoint(numLinks);
 }
 
 //------------------------------------------------------------------------------
@@ -1068,7 +1102,7 @@ vtkIdType vtkPolyData::InsertNextLinkedPoint(int numLinks)
 // and BuildLinks() has been invoked.)
 vtkIdType vtkPolyData::InsertNextLinkedPoint(double x[3], int numLinks)
 {
-  this->Links->InsertNextPoint(numLinks);
+  static_cast<vtkCellLinks*>(this->Links.Get())->InsertNextPoint(numLinks);
   return this->Points->InsertNextPoint(x);
 }
 
@@ -1082,10 +1116,11 @@ vtkIdType vtkPolyData::InsertNextLinkedCell(int type, int npts, const vtkIdType
 
   id = this->InsertNextCell(type, npts, pts);
 
+  vtkCellLinks* links = static_cast<vtkCellLinks*>(this->Links.Get());
   for (i = 0; i < npts; i++)
   {
-    this->Links->ResizeCellList(pts[i], 1);
-    this->Links->AddCellReference(id, pts[i]);
+    links->ResizeCellList(pts[i], 1);
+    links->AddCellReference(id, pts[i]);
   }
 
   return id;
@@ -1098,7 +1133,7 @@ vtkIdType vtkPolyData::InsertNextLinkedCell(int type, int npts, const vtkIdType
 // operator ResizeCellList() to do this if necessary.
 void vtkPolyData::RemoveReferenceToCell(vtkIdType ptId, vtkIdType cellId)
 {
-  this->Links->RemoveCellReference(cellId, ptId);
+  static_cast<vtkCellLinks*>(this->Links.Get())->RemoveCellReference(cellId, ptId);
 }
 
 //------------------------------------------------------------------------------
@@ -1108,7 +1143,7 @@ void vtkPolyData::RemoveReferenceToCell(vtkIdType ptId, vtkIdType cellId)
 // operator ResizeCellList() to do this if necessary.
 void vtkPolyData::AddReferenceToCell(vtkIdType ptId, vtkIdType cellId)
 {
-  this->Links->AddCellReference(cellId, ptId);
+  static_cast<vtkCellLinks*>(this->Links.Get())->AddCellReference(cellId, ptId);
 }
 
 //------------------------------------------------------------------------------
@@ -1144,9 +1179,10 @@ void vtkPolyData::ReplaceCell(vtkIdType cellId, int npts, const vtkIdType pts[])
 void vtkPolyData::ReplaceLinkedCell(vtkIdType cellId, int npts, const vtkIdType pts[])
 {
   this->ReplaceCell(cellId, npts, pts);
+  vtkCellLinks* links = static_cast<vtkCellLinks*>(this->Links.Get());
   for (int i = 0; i < npts; i++)
   {
-    this->Links->InsertNextCellReference(pts[i], cellId);
+    links->InsertNextCellReference(pts[i], cellId);
   }
 }
 
@@ -1159,14 +1195,13 @@ void vtkPolyData::GetCellEdgeNeighbors(
 {
   cellIds->Reset();
 
-  const vtkCellLinks::Link& link1(this->Links->GetLink(p1));
-  const vtkCellLinks::Link& link2(this->Links->GetLink(p2));
-
-  const vtkIdType* cells1 = link1.cells;
-  const vtkIdType* cells1End = cells1 + link1.ncells;
+  vtkIdType ncells1, ncells2;
+  vtkIdType *cells1, *cells2;
+  this->GetPointCells(p1, ncells1, cells1);
+  this->GetPointCells(p2, ncells2, cells2);
 
-  const vtkIdType* cells2 = link2.cells;
-  const vtkIdType* cells2End = cells2 + link2.ncells;
+  const vtkIdType* cells1End = cells1 + ncells1;
+  const vtkIdType* cells2End = cells2 + ncells2;
 
   while (cells1 != cells1End)
   {
@@ -1205,8 +1240,9 @@ void vtkPolyData::GetCellNeighbors(vtkIdType cellId, vtkIdList* ptIds, vtkIdList
 
   // load list with candidate cells, remove current cell
   vtkIdType ptId = ptIds->GetId(0);
-  int numPrime = this->Links->GetNcells(ptId);
-  vtkIdType* primeCells = this->Links->GetCells(ptId);
+  vtkIdType numPrime;
+  vtkIdType* primeCells;
+  this->GetPointCells(ptId, numPrime, primeCells);
   numPts = ptIds->GetNumberOfIds();
 
   // for each potential cell
@@ -1219,8 +1255,9 @@ void vtkPolyData::GetCellNeighbors(vtkIdType cellId, vtkIdList* ptIds, vtkIdList
       for (allFound = 1, i = 1; i < numPts && allFound; i++)
       {
         ptId = ptIds->GetId(i);
-        int numCurrent = this->Links->GetNcells(ptId);
-        vtkIdType* currentCells = this->Links->GetCells(ptId);
+        vtkIdType numCurrent;
+        vtkIdType* currentCells;
+        this->GetPointCells(ptId, numCurrent, currentCells);
         oneFound = 0;
         for (j = 0; j < numCurrent; j++)
         {
@@ -1446,7 +1483,7 @@ void vtkPolyData::DeepCopy(vtkDataObject* dataObject)
     }
     if (polyData->Links)
     {
-      this->Links = vtkSmartPointer<vtkCellLinks>::Take(polyData->Links->NewInstance());
+      this->Links = vtkSmartPointer<vtkAbstractCellLinks>::Take(polyData->Links->NewInstance());
       this->Links->DeepCopy(polyData->Links);
     }
     else
@@ -359,9 +359,13 @@ public:
 
   /**
    * Create upward links from points to cells that use each point. Enables
-   * topologically complex queries. Normally the links array is allocated
-   * based on the number of points in the vtkPolyData. The optional
-   * initialSize parameter can be used to allocate a larger size initially.
+   * topologically complex queries. When the dataset is not Editable (the
+   * default), the links are a vtkStaticCellLinks built in parallel, which
+   * cannot be modified afterwards. When the dataset is set as Editable, the
+   * links are a vtkCellLinks supporting the link editing methods below. In
+   * that case the links array is normally allocated based on the number of
+   * points in the vtkPolyData, and the optional initialSize parameter can be
+   * used to allocate a larger size initially.
    */
   void BuildLinks(int initialSize = 0);
 
@@ -369,7 +373,8 @@ public:
   /**
    * Set/Get the links that you created possibly without using BuildLinks.
    *
-   * Note: Only vtkCellLinks are currently supported.
+   * Note: Only vtkCellLinks and vtkStaticCellLinks are currently supported.
+   * The link editing methods require vtkCellLinks.
    */
   virtual void SetLinks(vtkAbstractCellLinks* links);
   vtkGetSmartPointerMacro(Links, vtkAbstractCellLinks);
@@ -713,7 +718,7 @@ protected:
   // supporting structures for more complex topological operations
   // built only when necessary
   vtkSmartPointer<CellMap> Cells;
-  vtkSmartPointer<vtkCellLinks> Links;
+  vtkSmartPointer<vtkAbstractCellLinks> Links;
 
   vtkNew<vtkIdList> LegacyBuffer;
 
@@ -732,13 +737,6 @@ private:
   void operator=(const vtkPolyData&) = delete;
 };
 
-//------------------------------------------------------------------------------
-inline void vtkPolyData::GetPointCells(vtkIdType ptId, vtkIdType& ncells, vtkIdType*& cells)
-{
-  ncells = this->Links->GetNcells(ptId);
-  cells = this->Links->GetCells(ptId);
-}
-
 //------------------------------------------------------------------------------
 inline vtkIdType vtkPolyData::GetNumberOfCells()
 {
@@ -840,7 +838,7 @@ inline int vtkPolyData::IsPointUsedByCell(vtkIdType ptId, vtkIdType cellId)
 //------------------------------------------------------------------------------
 inline void vtkPolyData::DeletePoint(vtkIdType ptId)
 {
-  this->Links->DeletePoint(ptId);
+  static_cast<vtkCellLinks*>(this->Links.Get())->DeletePoint(ptId);
 }
 
 //------------------------------------------------------------------------------
@@ -856,9 +854,10 @@ inline void vtkPolyData::RemoveCellReference(vtkIdType cellId)
   vtkIdType npts;
 
   this->GetCellPoints(cellId, npts, pts);
+  vtkCellLinks* links = static_cast<vtkCellLinks*>(this->Links.Get());
   for (vtkIdType i = 0; i < npts; i++)
   {
-    this->Links->RemoveCellReference(cellId, pts[i]);
+    links->RemoveCellReference(cellId, pts[i]);
   }
 }
 
@@ -869,16 +868,17 @@ inline void vtkPolyData::AddCellReference(vtkIdType cellId)
   vtkIdType npts;
 
   this->GetCellPoints(cellId, npts, pts);
+  vtkCellLinks* links = static_cast<vtkCellLinks*>(this->Links.Get());
   for (vtkIdType i = 0; i < npts; i++)
   {
-    this->Links->AddCellReference(cellId, pts[i]);
+    links->AddCellReference(cellId, pts[i]);
   }
 }
 
 //------------------------------------------------------------------------------
 inline void vtkPolyData::ResizeCellList(vtkIdType ptId, int size)
 {
-  this->Links->ResizeCellList(ptId, size);
+  static_cast<vtkCellLinks*>(this->Links.Get())->ResizeCellList(ptId, size);
 }
 
 //------------------------------------------------------------------------------
@@ -21,6 +21,7 @@
 #include "vtkTriangle.h"
 #include "vtkVector.h"
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
 #include <map>
@@ -188,6 +189,7 @@ vtkPolyhedron::vtkPolyhedron()
 
   this->FacesGenerated = 0;
   this->Faces = vtkIdTypeArray::New();
+  this->CanonicalTopologySet = false;
 
   this->BoundsComputed = 0;
 
@@ -356,6 +358,7 @@ void vtkPolyhedron::Initialize()
   // Faces may need renumbering later. This means converting the face ids from
   // global ids to local, canonical ids.
   this->FacesGenerated = 0;
+  this->CanonicalTopologySet = false;
 
   // No bounds have been computed as of yet.
   this->BoundsComputed = 0;
@@ -580,6 +583,24 @@ void vtkPolyhedron::SetFaces(vtkIdType* faces)
   } // for all faces
 }
 
+//------------------------------------------------------------------------------
+// Set the canonical faces and the edges built for all the polyhedra of a grid.
+void vtkPolyhedron::SetCanonicalTopology(
+  const vtkIdType* faces, vtkIdType numEdges, const vtkIdType* edges, const vtkIdType* edgeFaces)
+{
+  const vtkIdType facesSize = this->GlobalFaces->GetNumberOfValues();
+  this->Faces->SetNumberOfValues(facesSize);
+  std::copy(faces, faces + facesSize, this->Faces->GetPointer(0));
+  this->FacesGenerated = 1;
+
+  this->Edges->SetNumberOfTuples(numEdges);
+  std::copy(edges, edges + 2 * numEdges, this->Edges->GetPointer(0));
+  this->EdgeFaces->SetNumberOfTuples(numEdges);
+  std::copy(edgeFaces, edgeFaces + 2 * numEdges, this->EdgeFaces->GetPointer(0));
+  this->EdgesGenerated = 1;
+  this->CanonicalTopologySet = true;
+}
+
 //------------------------------------------------------------------------------
 // Return the list of faces for this cell.
 vtkIdType* vtkPolyhedron::GetFaces()
@@ -835,10 +856,14 @@ bool vtkPolyhedron::IsConvex()
   this->ConstructPolyData();
   this->ComputeBounds();
 
-  // loop over all edges in the polyhedron
-  this->EdgeTable->InitTraversal();
-  while ((edgeId = this->EdgeTable->GetNextEdge(w[0], w[1])) >= 0)
+  // loop over all edges in the polyhedron. The edge array is used rather than
+  // the edge table, which is not filled when the edges are set with
+  // SetCanonicalTopology().
+  const vtkIdType numEdges = this->Edges->GetNumberOfTuples();
+  for (edgeId = 0; edgeId < numEdges; ++edgeId)
   {
+    this->Edges->GetTypedTuple(edgeId, w);
+
     // get the edge points
     this->Points->GetPoint(w[0], x[0]);
     this->Points->GetPoint(w[1], x[1]);
@@ -1939,11 +1964,294 @@ int CreateContours(EdgeFaceSetMap& edgeFaceMap, FaceEdgesVector& faceEdgesVector
   return EXIT_SUCCESS;
 }
 
+namespace
+{
+// Contour of a polyhedron computed directly from its canonical faces and
+// edges, without triangulating the faces. Each edge crossed by the contour
+// value gets a contour point, and the contour points are linked from face to
+// face into closed loops. This requires every crossed edge to be used by
+// exactly two faces and every face to be crossed zero or two times. Other
+// polyhedra are handled by the general implementation, which triangulates
+// their faces first.
+class vtkPolyhedronContourLoops
+{
+public:
+  vtkPolyhedronContourLoops(vtkPolyhedron* cell, const vtkIdType* faces,
+    const vtkIdType* faceLocations, vtkIdType numFaces, const vtkIdType* edges,
+    const vtkIdType* edgeFaces, vtkIdType numEdges)
+    : Cell(cell)
+    , Faces(faces)
+    , FaceLocations(faceLocations)
+    , NumberOfFaces(numFaces)
+    , Edges(edges)
+    , EdgeFaces(edgeFaces)
+    , NumberOfEdges(numEdges)
+  {
+  }
+
+  // Find the crossed edges and the faces they link. Return false when the
+  // polyhedron cannot be contoured this way.
+  bool Build(double value, vtkDataArray* pointScalars)
+  {
+    this->Value = value;
+    const vtkIdType numPts = this->Cell->GetNumberOfPoints();
+    this->Scalars.resize(numPts);
+    for (vtkIdType i = 0; i < numPts; ++i)
+    {
+      this->Scalars[i] = pointScalars->GetTuple1(i);
+    }
+
+    this->FaceCrossings.assign(2 * this->NumberOfFaces, -1);
+    this->CrossedEdges.clear();
+    for (vtkIdType edgeId = 0; edgeId < this->NumberOfEdges; ++edgeId)
+    {
+      if (!this->IsCrossed(this->Edges[2 * edgeId], this->Edges[2 * edgeId + 1]))
+      {
+        continue;
+      }
+      const vtkIdType face0 = this->EdgeFaces[2 * edgeId];
+      const vtkIdType face1 = this->EdgeFaces[2 * edgeId + 1];
+      if (face0 < 0 || face1 < 0 || face0 == face1 || !this->AddFaceCrossing(face0, edgeId) ||
+        !this->AddFaceCrossing(face1, edgeId))
+      {
+        return false;
+      }
+      this->CrossedEdges.push_back(edgeId);
+    }
+
+    // An edge used by more than two faces is only recorded with two of them:
+    // make sure that each face is crossed by the edges recorded for it.
+    for (vtkIdType faceId = 0; faceId < this->NumberOfFaces; ++faceId)
+    {
+      const vtkIdType* face = this->Faces + this->FaceLocations[faceId];
+      int numCrossings = 0;
+      for (vtkIdType i = 1; i <= face[0]; ++i)
+      {
+        numCrossings += this->IsCrossed(face[i], face[i != face[0] ? i + 1 : 1]) ? 1 : 0;
+      }
+      const int numRecorded =
+        (this->FaceCrossings[2 * faceId] >= 0 ? 1 : 0) + (this->FaceCrossings[2 * faceId + 1] >= 0);
+      if (numCrossings != numRecorded || numCrossings == 1)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Whether the contour crosses the edge between two canonical points.
+  bool IsCrossed(vtkIdType p0, vtkIdType p1) const
+  {
+    const double v0 = this->Scalars[p0];
+    const double v1 = this->Scalars[p1];
+    return (v0 < this->Value && v1 >= this->Value) || (v1 < this->Value && v0 >= this->Value);
+  }
+
+  vtkIdType GetNumberOfCrossedEdges() const
+  {
+    return static_cast<vtkIdType>(this->CrossedEdges.size());
+  }
+
+  // Insert the contour points of the crossed edges and interpolate their
+  // point data. Like the general implementation, the contour points are kept
+  // away from the points of the polyhedron.
+  void InsertPoints(vtkIncrementalPointLocator* locator, vtkPointData* inPd, vtkPointData* outPd)
+  {
+    const double eps = 1e-6;
+    vtkPoints* cellPoints = this->Cell->GetPoints();
+    this->EdgePointIds.assign(this->NumberOfEdges, -1);
+    this->EdgePoints.resize(3 * this->NumberOfEdges);
+    double p0[3], p1[3];
+    for (vtkIdType edgeId : this->CrossedEdges)
+    {
+      const vtkIdType id0 = this->Edges[2 * edgeId];
+      const vtkIdType id1 = this->Edges[2 * edgeId + 1];
+      const double v0 = this->Scalars[id0];
+      const double v1 = this->Scalars[id1];
+      double f = (this->Value - v0) / (v1 - v0);
+      f = std::min(1.0 - eps, std::max(0.0 + eps, f));
+      cellPoints->GetPoint(id0, p0);
+      cellPoints->GetPoint(id1, p1);
+      double* cp = this->EdgePoints.data() + 3 * edgeId;
+      for (int i = 0; i < 3; ++i)
+      {
+        cp[i] = (1.0 - f) * p0[i] + f * p1[i];
+      }
+      vtkIdType ptId = -1;
+      locator->InsertUniquePoint(cp, ptId);
+      outPd->InterpolateEdge(
+        inPd, ptId, this->Cell->GetPointId(id0), this->Cell->GetPointId(id1), f);
+      this->EdgePointIds[edgeId] = ptId;
+    }
+  }
+
+  // Return the contour point inserted on the edge (p0, p1) of a face, or -1
+  // when the edge is not crossed.
+  vtkIdType GetFaceEdgePoint(vtkIdType faceId, vtkIdType p0, vtkIdType p1) const
+  {
+    for (int i = 0; i < 2; ++i)
+    {
+      const vtkIdType edgeId = this->FaceCrossings[2 * faceId + i];
+      if (edgeId >= 0 &&
+        ((this->Edges[2 * edgeId] == p0 && this->Edges[2 * edgeId + 1] == p1) ||
+          (this->Edges[2 * edgeId] == p1 && this->Edges[2 * edgeId + 1] == p0)))
+      {
+        return this->EdgePointIds[edgeId];
+      }
+    }
+    return -1;
+  }
+
+  // Walk the crossed edges from face to face and return the closed loops of
+  // contour point ids, along with the coordinates of the points.
+  void GetLoops(
+    std::vector<std::vector<vtkIdType>>& loops, std::vector<std::vector<double>>& loopPoints) const
+  {
+    std::vector<char> visited(this->NumberOfEdges, 0);
+    for (vtkIdType start : this->CrossedEdges)
+    {
+      if (visited[start])
+      {
+        continue;
+      }
+      std::vector<vtkIdType> loop;
+      std::vector<double> points;
+      vtkIdType edgeId = start;
+      vtkIdType faceId = this->EdgeFaces[2 * start];
+      do
+      {
+        visited[edgeId] = 1;
+        loop.push_back(this->EdgePointIds[edgeId]);
+        points.insert(points.end(), this->EdgePoints.data() + 3 * edgeId,
+          this->EdgePoints.data() + 3 * edgeId + 3);
+        // leave the edge through its other face, then the face through its
+        // other crossed edge
+        faceId = this->EdgeFaces[2 * edgeId] == faceId ? this->EdgeFaces[2 * edgeId + 1]
+                                                       : this->EdgeFaces[2 * edgeId];
+        edgeId = this->FaceCrossings[2 * faceId] == edgeId ? this->FaceCrossings[2 * faceId + 1]
+                                                           : this->FaceCrossings[2 * faceId];
+      } while (edgeId != start && !visited[edgeId]);
+      loops.push_back(std::move(loop));
+      loopPoints.push_back(std::move(points));
+    }
+  }
+
+private:
+  bool AddFaceCrossing(vtkIdType faceId, vtkIdType edgeId)
+  {
+    vtkIdType* crossings = this->FaceCrossings.data() + 2 * faceId;
+    if (crossings[0] < 0)
+    {
+      crossings[0] = edgeId;
+      return true;
+    }
+    if (crossings[1] < 0)
+    {
+      crossings[1] = edgeId;
+      return true;
+    }
+    return false;
+  }
+
+  vtkPolyhedron* Cell;
+  const vtkIdType* Faces;
+  const vtkIdType* FaceLocations;
+  vtkIdType NumberOfFaces;
+  const vtkIdType* Edges;
+  const vtkIdType* EdgeFaces;
+  vtkIdType NumberOfEdges;
+  double Value = 0.0;
+  std::vector<double> Scalars;
+  std::vector<vtkIdType> CrossedEdges;
+  std::vector<vtkIdType> FaceCrossings;
+  std::vector<vtkIdType> EdgePointIds;
+  std::vector<double> EdgePoints;
+};
+
+// Insert a contour polygon, triangulated when it has more than three points,
+// and copy the data of the contoured cell to the new cells.
+void InsertContourPolygon(const std::vector<vtkIdType>& ids, const std::vector<double>& points,
+  vtkPolygon* polygon, vtkIdList* triIds, vtkCellArray* polys, vtkIdType offset, vtkCellData* inCd,
+  vtkIdType cellId, vtkCellData* outCd)
+{
+  const vtkIdType npts = static_cast<vtkIdType>(ids.size());
+  if (npts <= 3)
+  {
+    vtkIdType newCellId = offset + polys->InsertNextCell(npts, ids.data());
+    if (outCd)
+    {
+      outCd->CopyData(inCd, cellId, newCellId);
+    }
+    return;
+  }
+
+  polygon->PointIds->SetNumberOfIds(npts);
+  polygon->Points->SetNumberOfPoints(npts);
+  for (vtkIdType i = 0; i < npts; i++)
+  {
+    polygon->PointIds->SetId(i, ids[i]);
+    polygon->Points->SetPoint(i, points.data() + 3 * i);
+  }
+  polygon->TriangulateLocalIds(0, triIds);
+  const vtkIdType numSimplices = triIds->GetNumberOfIds() / 3;
+  vtkIdType triPts[3];
+  for (vtkIdType i = 0; i < numSimplices; i++)
+  {
+    for (vtkIdType j = 0; j < 3; j++)
+    {
+      triPts[j] = ids[triIds->GetId(3 * i + j)];
+    }
+    vtkIdType newCellId = offset + polys->InsertNextCell(3, triPts);
+    if (outCd)
+    {
+      outCd->CopyData(inCd, cellId, newCellId);
+    }
+  }
+}
+} // anonymous namespace
+
 void vtkPolyhedron::Contour(double value, vtkDataArray* pointScalars,
   vtkIncrementalPointLocator* locator, vtkCellArray* verts, vtkCellArray* lines,
   vtkCellArray* polys, vtkPointData* inPd, vtkPointData* outPd, vtkCellData* inCd, vtkIdType cellId,
   vtkCellData* outCd)
 {
+  vtkIdType offset(0);
+  if (verts)
+  {
+    offset += verts->GetNumberOfCells();
+  }
+  if (lines)
+  {
+    offset += lines->GetNumberOfCells();
+  }
+
+  // With the topology cached by the grid, contour the well behaved polyhedra
+  // directly from their faces.
+  if (this->CanonicalTopologySet)
+  {
+    vtkPolyhedronContourLoops contourLoops(this, this->Faces->GetPointer(0),
+      this->FaceLocations->GetPointer(0), this->GetNumberOfFaces(), this->Edges->GetPointer(0),
+      this->EdgeFaces->GetPointer(0), this->Edges->GetNumberOfTuples());
+    if (contourLoops.Build(value, pointScalars))
+    {
+      contourLoops.InsertPoints(locator, inPd, outPd);
+      std::vector<std::vector<vtkIdType>> loops;
+      std::vector<std::vector<double>> loopPoints;
+      contourLoops.GetLoops(loops, loopPoints);
+      vtkNew<vtkPolygon> polygon;
+      vtkNew<vtkIdList> triIds;
+      for (size_t i = 0; i < loops.size(); ++i)
+      {
+        if (loops[i].size() > 2)
+        {
+          InsertContourPolygon(
+            loops[i], loopPoints[i], polygon, triIds, polys, offset, inCd, cellId, outCd);
+        }
+      }
+      return;
+    }
+  }
+
   EdgeFaceSetMap edgeFaceMap;
   FaceEdgesVector faceEdgesVector;
   PointIndexEdgeMultiMap contourPointEdgeMultiMap;
@@ -1959,16 +2267,6 @@ void vtkPolyhedron::Contour(double value, vtkDataArray* pointScalars,
     return;
   }
 
-  vtkIdType offset(0);
-  if (verts)
-  {
-    offset += verts->GetNumberOfCells();
-  }
-  if (lines)
-  {
-    offset += lines->GetNumberOfCells();
-  }
-
   if (contourPointEdgeMultiMap.empty())
   {
     return; // no contours made
@@ -2271,6 +2569,109 @@ void MergeTriFacePolygons(vtkPolyhedron* cell,
   }
 }
 
+namespace
+{
+// Group the clipped polygons sharing points into closed polyhedra and insert
+// them.
+void InsertClippedPolyhedra(std::vector<std::vector<vtkIdType>>& polygons,
+  vtkCellArray* connectivity, vtkCellData* inCd, vtkIdType cellId, vtkCellData* outCd)
+{
+  // this next bit finds closed polyhedra by looking at disjoint sets of point ids
+  // that hold the polyhedra. Note that if two closed polyhedra share one point
+  // that they are identified as one closed polyhedron with two closed parts.
+  while (!polygons.empty())
+  {
+    // the set of point ids that form a closed polyhedron
+    std::unordered_set<vtkIdType> polyhedralIdSet;
+
+    // this list holds the polygons by moving references
+    // in the polygons list of polyhedral faces that
+    // belong to the polyhedron being built.
+    std::vector<std::vector<vtkIdType>> polyhedralFaceList;
+
+    // while one face is added, keep looping all faces that
+    // were not yet added. The face last added can make faces that were
+    // skipped earlier be valid candidates now. At a certain point, no
+    // faces can be added anymore, and the polyhedron is finished.
+    bool add = true;
+    while (add)
+    {
+      add = false;
+      auto it = polygons.begin();
+      while (it != polygons.end())
+      {
+        // If there are empty polygons, we erase them
+        while (it != polygons.end() && it->empty())
+        {
+          it = polygons.erase(it);
+        }
+        if (it == polygons.end())
+        {
+          // All polygons were empty
+          break;
+        }
+        if (polyhedralIdSet.empty())
+        {
+          // Insert seed polygon in the polyhedron
+          polyhedralIdSet.insert(it->begin(), it->end());
+          continue;
+        }
+
+        const std::vector<vtkIdType>& nextPolygon = *it;
+        auto polygon_it = nextPolygon.begin();
+        bool insertedNextPolygon = false;
+        for (; polygon_it != nextPolygon.end(); ++polygon_it)
+        {
+          // Check if the next polygon has any common point with the seed polygon
+          if (polyhedralIdSet.find(*polygon_it) != polyhedralIdSet.end())
+          {
+            polyhedralIdSet.insert(nextPolygon.begin(), nextPolygon.end());
+            polyhedralFaceList.emplace_back(std::move(*it));
+            it = polygons.erase(it);
+            // We might have missed a polygon earlier because
+            // polyhedralIdSet has new ids now
+            // this flag allows to scan again the list polygons
+            add = true;
+            insertedNextPolygon = true;
+            // We found a polygon, we can look for another one now
+            break;
+          }
+        }
+        if (it == polygons.end())
+        {
+          break;
+        }
+        if (!insertedNextPolygon)
+        {
+          ++it;
+        }
+      }
+    }
+    if (!polyhedralFaceList.empty())
+    {
+      // next, build the face stream for the polyhedron.
+      vtkNew<vtkIdList> polyhedron;
+      // first entry: # of faces:
+      polyhedron->InsertNextId(static_cast<vtkIdType>(polyhedralFaceList.size()));
+      for (const auto& polyFace : polyhedralFaceList)
+      {
+        // each face entry starts with # points in that face
+        polyhedron->InsertNextId(static_cast<vtkIdType>(polyFace.size()));
+        for (const auto& id : polyFace)
+        {
+          // then all global face point ids
+          polyhedron->InsertNextId(id);
+        }
+      }
+
+      vtkIdType newCellId = connectivity->InsertNextCell(polyhedron);
+      // we've added a cell, so add cell data too
+      outCd->CopyData(inCd, cellId, newCellId);
+    }
+  }
+}
+} // anonymous namespace
+
 void vtkPolyhedron::Clip(double value, vtkDataArray* pointScalars,
   vtkIncrementalPointLocator* locator, vtkCellArray* connectivity, vtkPointData* inPd,
   vtkPointData* outPd, vtkCellData* inCd, vtkIdType cellId, vtkCellData* outCd, int insideOut)
@@ -2317,6 +2718,72 @@ void vtkPolyhedron::Clip(double value, vtkDataArray* pointScalars,
     return;
   }
 
+  // With the topology cached by the grid, clip the well behaved polyhedra
+  // directly from their faces.
+  if (this->CanonicalTopologySet)
+  {
+    vtkPolyhedronContourLoops contourLoops(this, this->Faces->GetPointer(0),
+      this->FaceLocations->GetPointer(0), this->GetNumberOfFaces(), this->Edges->GetPointer(0),
+      this->EdgeFaces->GetPointer(0), this->Edges->GetNumberOfTuples());
+    if (contourLoops.Build(value, pointScalars))
+    {
+      if (contourLoops.GetNumberOfCrossedEdges() == 0)
+      {
+        return;
+      }
+      contourLoops.InsertPoints(locator, inPd, outPd);
+
+      // walk the faces and keep their inside points and contour points
+      std::vector<std::vector<vtkIdType>> polygons;
+      std::vector<vtkIdType> pointIds(this->GetNumberOfPoints(), -1);
+      vtkPoints* cellPoints = this->GetPoints();
+      const int nFaces = this->GetNumberOfFaces();
+      for (int faceId = 0; faceId < nFaces; ++faceId)
+      {
+        const vtkIdType* face = this->Faces->GetPointer(this->FaceLocations->GetValue(faceId));
+        std::vector<vtkIdType> polygon;
+        for (vtkIdType i = 1; i <= face[0]; ++i)
+        {
+          const vtkIdType p0 = face[i];
+          const vtkIdType p1 = face[i != face[0] ? i + 1 : 1];
+          if (c(pointScalars->GetTuple1(p0), value))
+          {
+            if (pointIds[p0] < 0)
+            {
+              locator->InsertUniquePoint(cellPoints->GetPoint(p0), pointIds[p0]);
+              outPd->CopyData(inPd, this->PointIds->GetId(p0), pointIds[p0]);
+            }
+            polygon.push_back(pointIds[p0]);
+          }
+          const vtkIdType contourPointId = contourLoops.GetFaceEdgePoint(faceId, p0, p1);
+          if (contourPointId >= 0)
+          {
+            polygon.push_back(contourPointId);
+          }
+        }
+        if (polygon.size() > 2)
+        {
+          polygons.push_back(std::move(polygon));
+        }
+      }
+
+      // the contour loops close the clipped polyhedra
+      std::vector<std::vector<vtkIdType>> loops;
+      std::vector<std::vector<double>> loopPoints;
+      contourLoops.GetLoops(loops, loopPoints);
+      for (auto& loop : loops)
+      {
+        if (loop.size() > 2)
+        {
+          polygons.push_back(std::move(loop));
+        }
+      }
+
+      InsertClippedPolyhedra(polygons, connectivity, inCd, cellId, outCd);
+      return;
+    }
+  }
+
   EdgeFaceSetMap edgeFaceMap;
   FaceEdgesVector faceEdgesVector;
   PointIndexEdgeMultiMap contourPointEdgeMultiMap;
@@ -2411,99 +2878,7 @@ void vtkPolyhedron::Clip(double value, vtkDataArray* pointScalars,
 
   CreateContours(edgeFaceMap, faceEdgesVector, edgeContourPointMap, originalEdges, cb);
 
-  // this next bit finds closed polyhedra by looking at disjoint sets of point ids
-  // that hold the polyhedra. Note that if two closed polyhedra share one point
-  // that they are identified as one closed polyhedron with two closed parts.
-  while (!polygons.empty())
-  {
-    // the set of point ids that form a closed polyhedron
-    std::unordered_set<vtkIdType> polyhedralIdSet;
-
-    // this list holds the polygons by moving references
-    // in the polygons list of polyhedral faces that
-    // belong to the polyhedron being built.
-    std::vector<std::vector<vtkIdType>> polyhedralFaceList;
-
-    // while one face is added, keep looping all faces that
-    // were not yet added. The face last added can make faces that were
-    // skipped earlier be valid candidates now. At a certain point, no
-    // faces can be added anymore, and the polyhedron is finished.
-    bool add = true;
-    while (add)
-    {
-      add = false;
-      auto it = polygons.begin();
-      while (it != polygons.end())
-      {
-        // If there are empty polygons, we erase them
-        while (it != polygons.end() && it->empty())
-        {
-          it = polygons.erase(it);
-        }
-        if (it == polygons.end())
-        {
-          // All polygons were empty
-          break;
-        }
-        if (polyhedralIdSet.empty())
-        {
-          // Insert seed polygon in the polyhedron
-          polyhedralIdSet.insert(it->begin(), it->end());
-          continue;
-        }
-
-        const std::vector<vtkIdType>& nextPolygon = *it;
-        auto polygon_it = nextPolygon.begin();
-        bool insertedNextPolygon = false;
-        for (; polygon_it != nextPolygon.end(); ++polygon_it)
-        {
-          // Check if the next polygon has any common point with the seed polygon
-          if (polyhedralIdSet.find(*polygon_it) != polyhedralIdSet.end())
-          {
-            polyhedralIdSet.insert(nextPolygon.begin(), nextPolygon.end());
-            polyhedralFaceList.emplace_back(std::move(*it));
-            it = polygons.erase(it);
-            // We might have missed a polygon earlier because
-            // polyhedralIdSet has new ids now
-            // this flag allows to scan again the list polygons
-            add = true;
-            insertedNextPolygon = true;
-            // We found a polygon, we can look for another one now
-            break;
-          }
-        }
-        if (it == polygons.end())
-        {
-          break;
-        }
-        if (!insertedNextPolygon)
-        {
-          ++it;
-        }
-      }
-    }
-    if (!polyhedralFaceList.empty())
-    {
-      // next, build the face stream for the polyhedron.
-      vtkNew<vtkIdList> polyhedron;
-      // first entry: # of faces:
-      polyhedron->InsertNextId(static_cast<vtkIdType>(polyhedralFaceList.size()));
-      for (const auto& polyFace : polyhedralFaceList)
-      {
-        // each face entry starts with # points in that face
-        polyhedron->InsertNextId(static_cast<vtkIdType>(polyFace.size()));
-        for (const auto& id : polyFace)
-        {
-          // then all global face point ids
-          polyhedron->InsertNextId(id);
-        }
-      }
-
-      vtkIdType newCellId = connectivity->InsertNextCell(polyhedron);
-      // we've added a cell, so add cell data too
-      outCd->CopyData(inCd, cellId, newCellId);
-    }
-  }
+  InsertClippedPolyhedra(polygons, connectivity, inCd, cellId, outCd);
 }
 
 //------------------------------------------------------------------------------
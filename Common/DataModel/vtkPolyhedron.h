@@ -383,6 +383,23 @@ public:
    */
   vtkIdType* GetFaces() override;
 
+  /**
+   * Set the faces and the edges of the polyhedron expressed with <b> canonical
+   * (cell local) point IDs </b>, as built once for all the polyhedra of a grid
+   * by vtkUnstructuredGrid::BuildPolyhedronTopology(). This must be called
+   * after SetFaces() and Initialize(), and spares the generation of the
+   * canonical faces and of the edges of the cell.
+   *
+   * @param faces the canonical faces, with the same layout as the faces given
+   * to SetFaces()
+   * @param numEdges the number of edges
+   * @param edges the canonical point ids of the edges, two per edge
+   * @param edgeFaces the ids of the faces using each edge, two per edge (the
+   * second one is -1 when a single face uses the edge)
+   */
+  void SetCanonicalTopology(
+    const vtkIdType* faces, vtkIdType numEdges, const vtkIdType* edges, const vtkIdType* edgeFaces);
+
   /**
    * A method particular to vtkPolyhedron. It determines whether a point x[3]
    * is inside the polyhedron or not (returns 1 is the point is inside, 0
@@ -447,6 +464,10 @@ protected:
   vtkIdTypeArray* Faces; // These are numbered in canonical id space
   int FacesGenerated;    // True when Faces have been successfully constructed
 
+  // True when the faces and edges were set with SetCanonicalTopology(): the
+  // contour and clip operations then use their face based implementation.
+  bool CanonicalTopologySet;
+
   // Bounds management
   int BoundsComputed;
   void ComputeBounds();
@@ -1,8 +1,11 @@
 // SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkSphere.h"
+#include "vtkArrayDispatch.h"
+#include "vtkDataArrayRange.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 
 #include <algorithm>
 
@@ -20,6 +23,59 @@ vtkSphere::vtkSphere()
   this->Center[2] = 0.0;
 }
 
+namespace
+{
+struct SphereFunctionWorker
+{
+  double Center[3];
+  double Radius2;
+
+  template <typename InputArrayType, typename OutputArrayType>
+  void operator()(InputArrayType* input, OutputArrayType* output)
+  {
+    const auto srcTuples = vtk::DataArrayTupleRange<3>(input);
+    auto dstValues = vtk::DataArrayValueRange<1>(output);
+    using DstValueT = typename decltype(dstValues)::ValueType;
+
+    const double cx = this->Center[0];
+    const double cy = this->Center[1];
+    const double cz = this->Center[2];
+    const double r2 = this->Radius2;
+    vtkSMPTools::For(0, input->GetNumberOfTuples(), [&](vtkIdType begin, vtkIdType end) {
+      double tuple[3];
+      for (vtkIdType pointId = begin; pointId < end; ++pointId)
+      {
+        srcTuples.GetTuple(pointId, tuple);
+        const double dx = tuple[0] - cx;
+        const double dy = tuple[1] - cy;
+        const double dz = tuple[2] - cz;
+        dstValues[pointId] = static_cast<DstValueT>((dx * dx + dy * dy + dz * dz) - r2);
+      }
+    });
+  }
+};
+} // end anon namespace
+
+//------------------------------------------------------------------------------
+void vtkSphere::EvaluateFunction(vtkDataArray* input, vtkDataArray* output)
+{
+  output->SetNumberOfComponents(1);
+  output->SetNumberOfTuples(input->GetNumberOfTuples());
+
+  SphereFunctionWorker worker;
+  std::copy_n(this->Center, 3, worker.Center);
+  worker.Radius2 = this->Radius * this->Radius;
+  typedef vtkTypeList::Create<float, double> InputTypes;
+  typedef vtkTypeList::Create<float, double> OutputTypes;
+  typedef vtkArrayDispatch::Dispatch2ByValueTypeUsingArrays<vtkArrayDispatch::AllArrays, InputTypes,
+    OutputTypes>
+    MyDispatch;
+  if (!MyDispatch::Execute(input, output, worker))
+  {
+    worker(input, output); // Use vtkDataArray API if dispatch fails.
+  }
+}
+
 //------------------------------------------------------------------------------
 // Evaluate sphere equation ((x-x0)^2 + (y-y0)^2 + (z-z0)^2) - R^2.
 double vtkSphere::EvaluateFunction(double x[3])
@@ -12,6 +12,7 @@
 #include "vtkPolyData.h"
 #include "vtkSMPTools.h"
 #include "vtkUnstructuredGrid.h"
+#include <algorithm>
 #include <array>
 #include <atomic>
 
@@ -318,19 +319,45 @@ struct InsertLinks
   std::atomic<TIds>* Counts;
   const TIds* Offsets;
   TIds* Links;
+  TIds IdOffset;
 
-  InsertLinks(vtkCellArray* cellArray, std::atomic<TIds>* counts, const TIds* offsets, TIds* links)
+  InsertLinks(vtkCellArray* cellArray, std::atomic<TIds>* counts, const TIds* offsets, TIds* links,
+    TIds idOffset = 0)
     : CellArray(cellArray)
     , Counts(counts)
     , Offsets(offsets)
     , Links(links)
+    , IdOffset(idOffset)
   {
   }
 
   void operator()(vtkIdType cellId, vtkIdType endCellId)
   {
     this->CellArray->Visit(vtkSCLT_detail::BuildLinksThreaded{}, this->Offsets, this->Counts,
-      this->Links, cellId, endCellId);
+      this->Links, cellId, endCellId, this->IdOffset);
+  }
+};
+
+// The threaded insertion fills the links of a point in no particular order.
+// Sort them so that the links do not depend on the scheduling of the threads.
+template <typename TIds>
+struct SortLinks
+{
+  const TIds* Offsets;
+  TIds* Links;
+
+  SortLinks(const TIds* offsets, TIds* links)
+    : Offsets(offsets)
+    , Links(links)
+  {
+  }
+
+  void operator()(vtkIdType ptId, vtkIdType endPtId)
+  {
+    for (; ptId < endPtId; ++ptId)
+    {
+      std::sort(this->Links + this->Offsets[ptId], this->Links + this->Offsets[ptId + 1]);
+    }
   }
 };
 
@@ -362,15 +389,9 @@ void vtkStaticCellLinksTemplate<TIds>::ThreadedBuildLinks(
   CountUses<TIds> count(cellArray, counts);
   vtkSMPTools::For(0, numCells, count);
 
-  // Perform prefix sum to determine offsets
-  vtkIdType ptId, npts;
+  // Perform prefix sum (exclusive scan) to determine offsets
   this->Offsets = new TIds[numPts + 1];
-  this->Offsets[0] = 0;
-  for (ptId = 1; ptId < numPts; ++ptId)
-  {
-    npts = counts[ptId - 1];
-    this->Offsets[ptId] = this->Offsets[ptId - 1] + npts;
-  }
+  vtkSMPTools::ExclusiveScan(counts, counts + numPts, this->Offsets, static_cast<TIds>(0));
   this->Offsets[numPts] = this->LinksSize;
 
   // Now insert cell ids into cell links.
@@ -459,18 +480,57 @@ void vtkStaticCellLinksTemplate<TIds>::BuildLinks(vtkPolyData* pd)
   this->Links = new TIds[this->LinksSize + 1];
   this->Links[this->LinksSize] = this->NumPts;
   this->Offsets = new TIds[this->NumPts + 1];
-  this->Offsets[this->NumPts] = this->LinksSize;
-  std::fill_n(this->Offsets, this->NumPts + 1, 0);
 
   // Now create the links.
   vtkIdType npts, CellId, ptId;
 
+  if (!this->SequentialProcessing)
+  {
+    // Count the point uses of the four arrays in parallel
+    std::atomic<TIds>* counts = new std::atomic<TIds>[this->NumPts]();
+    for (j = 0; j < 4; ++j)
+    {
+      if (numCells[j] > 0)
+      {
+        CountUses<TIds> count(cellArrays[j], counts);
+        vtkSMPTools::For(0, numCells[j], count);
+      }
+    }
+
+    // Perform prefix sum (exclusive scan) to determine offsets
+    vtkSMPTools::ExclusiveScan(
+      counts, counts + this->NumPts, this->Offsets, static_cast<TIds>(0));
+    this->Offsets[this->NumPts] = this->LinksSize;
+
+    // Now insert cell ids into cell links, then sort each link
+    for (CellId = 0, j = 0; j < 4; ++j)
+    {
+      if (numCells[j] > 0)
+      {
+        InsertLinks<TIds> insertLinks(
+          cellArrays[j], counts, this->Offsets, this->Links, static_cast<TIds>(CellId));
+        vtkSMPTools::For(0, numCells[j], insertLinks);
+      }
+      CellId += numCells[j];
+    }
+    SortLinks<TIds> sortLinks(this->Offsets, this->Links);
+    vtkSMPTools::For(0, this->NumPts, sortLinks);
+
+    // Clean up
+    delete[] counts;
+    return;
+  }
+
+  std::fill_n(this->Offsets, this->NumPts + 1, 0);
+
   // Visit the four arrays
-  for (CellId = 0, j = 0; j < 4; ++j)
+  for (j = 0; j < 4; ++j)
   {
     // Count number of point uses
-    cellArrays[j]->Visit(vtkSCLT_detail::CountPoints{}, this->Offsets, 0, numCells[j], CellId);
-    CellId += numCells[j];
+    if (numCells[j] > 0)
+    {
+      cellArrays[j]->Visit(vtkSCLT_detail::CountPoints{}, this->Offsets, 0, numCells[j]);
+    }
   } // for each of the four polydata cell arrays
 
   // Perform prefix sum (inclusive scan)
@@ -486,7 +546,10 @@ void vtkStaticCellLinksTemplate<TIds>::BuildLinks(vtkPolyData* pd)
   // points to the beginning of each cell run.
   for (CellId = 0, j = 0; j < 4; ++j)
   {
-    cellArrays[j]->Visit(vtkSCLT_detail::BuildLinks{}, this->Offsets, this->Links, CellId);
+    if (numCells[j] > 0)
+    {
+      cellArrays[j]->Visit(vtkSCLT_detail::BuildLinks{}, this->Offsets, this->Links, CellId);
+    }
     CellId += numCells[j];
   } // for each of the four polydata arrays
   this->Offsets[this->NumPts] = this->LinksSize;
@@ -4,12 +4,131 @@
 
 #include "vtkSMPTools.h"
 
+#include <algorithm>
+#include <vector>
+
 #ifndef vtkStaticEdgeLocatorTemplate_txx
 #define vtkStaticEdgeLocatorTemplate_txx
 
 //----------------------------------------------------------------------------
-// Gather coincident edges into contiguous runs. Use this for merging edges.
+// Helper functors to process a sorted edge array in parallel.
 VTK_ABI_NAMESPACE_BEGIN
+namespace vtkSELT_detail
+{
+// Below this number of edges the sorted edge array is processed serially.
+constexpr vtkIdType ParallelThreshold = 65536;
+// Number of edges processed by each batch of the parallel passes.
+constexpr vtkIdType BatchSize = 16384;
+
+// Indicate whether the eId'th edge of a sorted array starts a new group of
+// identical edges.
+template <typename TEdge>
+bool IsFirstOfGroup(const TEdge* edges, vtkIdType eId)
+{
+  return eId == 0 || edges[eId - 1] != edges[eId];
+}
+
+// Count the number of groups of identical edges starting in each batch.
+template <typename TEdge>
+struct CountGroups
+{
+  const TEdge* Edges;
+  vtkIdType NumEdges;
+  vtkIdType* Counts;
+
+  void operator()(vtkIdType batch, vtkIdType endBatch)
+  {
+    for (; batch < endBatch; ++batch)
+    {
+      const vtkIdType endId = std::min((batch + 1) * BatchSize, this->NumEdges);
+      vtkIdType count = 0;
+      for (vtkIdType eId = batch * BatchSize; eId < endId; ++eId)
+      {
+        count += IsFirstOfGroup(this->Edges, eId) ? 1 : 0;
+      }
+      this->Counts[batch] = count;
+    }
+  }
+};
+
+// Write the offset of each group of identical edges. BatchOffsets is the
+// exclusive scan of the counts computed by CountGroups.
+template <typename TEdge, typename TIds>
+struct WriteGroupOffsets
+{
+  const TEdge* Edges;
+  vtkIdType NumEdges;
+  const vtkIdType* BatchOffsets;
+  TIds* Offsets;
+
+  void operator()(vtkIdType batch, vtkIdType endBatch)
+  {
+    for (; batch < endBatch; ++batch)
+    {
+      const vtkIdType endId = std::min((batch + 1) * BatchSize, this->NumEdges);
+      vtkIdType idx = this->BatchOffsets[batch];
+      for (vtkIdType eId = batch * BatchSize; eId < endId; ++eId)
+      {
+        if (IsFirstOfGroup(this->Edges, eId))
+        {
+          this->Offsets[idx++] = static_cast<TIds>(eId);
+        }
+      }
+    }
+  }
+};
+
+// Copy the first edge of each group of identical edges to the unique edge
+// array.
+template <typename TEdge>
+struct CopyUniqueEdges
+{
+  const TEdge* Edges;
+  vtkIdType NumEdges;
+  const vtkIdType* BatchOffsets;
+  TEdge* UniqueEdges;
+
+  void operator()(vtkIdType batch, vtkIdType endBatch)
+  {
+    for (; batch < endBatch; ++batch)
+    {
+      const vtkIdType endId = std::min((batch + 1) * BatchSize, this->NumEdges);
+      vtkIdType idx = this->BatchOffsets[batch];
+      for (vtkIdType eId = batch * BatchSize; eId < endId; ++eId)
+      {
+        if (IsFirstOfGroup(this->Edges, eId))
+        {
+          this->UniqueEdges[idx++] = this->Edges[eId];
+        }
+      }
+    }
+  }
+};
+
+// Count the groups of identical edges of a sorted array in parallel.
+// batchOffsets is resized to hold the offset of the first group of each
+// batch, followed by the total number of groups.
+template <typename TEdge>
+vtkIdType CountAllGroups(
+  const TEdge* edges, vtkIdType numEdges, std::vector<vtkIdType>& batchOffsets)
+{
+  const vtkIdType numBatches = (numEdges + BatchSize - 1) / BatchSize;
+  std::vector<vtkIdType> counts(numBatches);
+  CountGroups<TEdge> countGroups{ edges, numEdges, counts.data() };
+  vtkSMPTools::For(0, numBatches, countGroups);
+
+  batchOffsets.resize(numBatches + 1);
+  batchOffsets[0] = 0;
+  for (vtkIdType batch = 0; batch < numBatches; ++batch)
+  {
+    batchOffsets[batch + 1] = batchOffsets[batch] + counts[batch];
+  }
+  return batchOffsets[numBatches];
+}
+} // end namespace vtkSELT_detail
+
+//----------------------------------------------------------------------------
+// Gather coincident edges into contiguous runs. Use this for merging edges.
 template <typename IDType, typename EdgeData>
 const IDType* vtkStaticEdgeLocatorTemplate<IDType, EdgeData>::MergeEdges(
   vtkIdType numEdges, EdgeTupleType* mergeArray, vtkIdType& numUniqueEdges)
@@ -27,7 +146,22 @@ const IDType* vtkStaticEdgeLocatorTemplate<IDType, EdgeData>::MergeEdges(
   vtkSMPTools::Sort(this->MergeArray, this->MergeArray + numEdges);
 
   // Now build offsets, i.e., determine the number of unique edges and determine
-  // the offsets into each identical group of edges.
+  // the offsets into each identical group of edges. Large arrays are processed
+  // in parallel: the groups starting in each batch of edges are counted, and
+  // the offsets are then written at the position given by the scan of the
+  // counts.
+  if (numEdges >= vtkSELT_detail::ParallelThreshold)
+  {
+    std::vector<vtkIdType> batchOffsets;
+    numUniqueEdges = vtkSELT_detail::CountAllGroups(this->MergeArray, numEdges, batchOffsets);
+    this->MergeOffsets.resize(numUniqueEdges + 1);
+    vtkSELT_detail::WriteGroupOffsets<EdgeTupleType, IDType> writeOffsets{ this->MergeArray,
+      numEdges, batchOffsets.data(), this->MergeOffsets.data() };
+    vtkSMPTools::For(0, static_cast<vtkIdType>(batchOffsets.size()) - 1, writeOffsets);
+    this->MergeOffsets[numUniqueEdges] = static_cast<IDType>(numEdges);
+    return this->MergeOffsets.data();
+  }
+
   this->MergeOffsets.push_back(0);
   IDType curOffset = 0;
 
@@ -60,9 +194,26 @@ vtkIdType vtkStaticEdgeLocatorTemplate<IDType, EdgeData>::BuildLocator(
   vtkSMPTools::Sort(this->EdgeArray, this->EdgeArray + numEdges);
 
   // Remove duplicates. What's left is a list of unique edges, with their
-  // position in the edge array corresponding to their edge id.
-  EdgeTupleType* end = std::unique(this->EdgeArray, this->EdgeArray + numEdges);
-  this->NumEdges = end - this->EdgeArray;
+  // position in the edge array corresponding to their edge id. Large arrays
+  // are compacted in parallel through a temporary array.
+  if (numEdges >= vtkSELT_detail::ParallelThreshold)
+  {
+    std::vector<vtkIdType> batchOffsets;
+    this->NumEdges = vtkSELT_detail::CountAllGroups(this->EdgeArray, numEdges, batchOffsets);
+    std::vector<EdgeTupleType> uniqueEdges(this->NumEdges);
+    vtkSELT_detail::CopyUniqueEdges<EdgeTupleType> copyUnique{ this->EdgeArray, numEdges,
+      batchOffsets.data(), uniqueEdges.data() };
+    vtkSMPTools::For(0, static_cast<vtkIdType>(batchOffsets.size()) - 1, copyUnique);
+    EdgeTupleType* edges = this->EdgeArray;
+    vtkSMPTools::For(0, this->NumEdges,
+      [&uniqueEdges, edges](vtkIdType eId, vtkIdType endEId)
+      { std::copy(uniqueEdges.begin() + eId, uniqueEdges.begin() + endEId, edges + eId); });
+  }
+  else
+  {
+    EdgeTupleType* end = std::unique(this->EdgeArray, this->EdgeArray + numEdges);
+    this->NumEdges = end - this->EdgeArray;
+  }
 
   // Create an offset array to accelerate finding edges (v0,v1). Basically
   // this is a 1D binning based on v0, with a quick search is then made to
@@ -75,6 +226,31 @@ vtkIdType vtkStaticEdgeLocatorTemplate<IDType, EdgeData>::BuildLocator(
   this->NDivs = (this->V0Range / this->NumEdgesPerBin) + 1;
   this->EdgeOffsets = new IDType[this->NDivs + 1]; // one extra simplifies math
 
+  if (this->NumEdges >= vtkSELT_detail::ParallelThreshold)
+  {
+    // Each edge starting a new bin fills the offsets of the bins between the
+    // bin of the previous edge and its own bin. These ranges are disjoint.
+    this->EdgeOffsets[0] = 0;
+    vtkSMPTools::For(0, this->NumEdges,
+      [this](vtkIdType eId, vtkIdType endEId)
+      {
+        IDType prevPos = eId > 0 ? this->HashBin(this->EdgeArray[eId - 1].V0) : 0;
+        for (; eId < endEId; ++eId)
+        {
+          const IDType pos = this->HashBin(this->EdgeArray[eId].V0);
+          for (IDType bin = prevPos + 1; bin <= pos; ++bin)
+          {
+            this->EdgeOffsets[bin] = static_cast<IDType>(eId);
+          }
+          prevPos = pos;
+        }
+      });
+    const IDType lastPos = this->HashBin(this->MaxV0);
+    std::fill(this->EdgeOffsets + lastPos + 1, this->EdgeOffsets + this->NDivs + 1,
+      static_cast<IDType>(this->NumEdges));
+    return this->NumEdges;
+  }
+
   IDType pos, curPos = 0;
   IDType num, idx = 0;
   this->EdgeOffsets[idx++] = curPos;
@@ -31,8 +31,9 @@
  *    a cell can have less than 2^7 faces, so use vtkTypeInt8. Otherwise, use vtkTypeInt32
  *    when the input grid has polyhedron cells.
  *
- * @warning
- * This class handles only linear cells.
+ * The faces of nonlinear cells, e.g. quadratic or higher order cells, are
+ * hashed by their corner points, so that they match the faces of neighbor
+ * cells of the same shape regardless of their order.
  *
  * @warning
  * This class has been threaded with vtkSMPTools. Using TBB or other
@@ -299,20 +299,28 @@ struct vtkStaticFaceHashLinksTemplate<TInputIdType, TFaceIdType>::CreateFacesInf
               }
               break;
             default:
-              // Other types of 3D linear cells handled by vtkGeometryFilter. Exactly what
-              // is a linear cell is defined by vtkCellTypes::IsLinear().
+              // Other types of 3D linear cells handled by vtkGeometryFilter, and nonlinear
+              // cells. Exactly what is a linear cell is defined by vtkCellTypes::IsLinear().
               This->Input->GetCell(cellId, cell);
-              if (cell->GetCellDimension() == 3 && cell->IsLinear())
+              cellOffsets[cellId] = facesOffset;
+              if (cell->GetCellDimension() == 3)
               {
-                cellOffsets[cellId] = facesOffset;
                 for (faceId = 0, numFaces = cell->GetNumberOfFaces(); faceId < numFaces; faceId++)
                 {
+                  // The faces of nonlinear cells are hashed by their corner points, which
+                  // come first and are as many as their edges.
                   vtkCell* faceCell = cell->GetFace(faceId);
-                  faceHashValues[facesOffset++] =
-                    *std::min_element(faceCell->PointIds->GetPointer(0),
-                      faceCell->PointIds->GetPointer(faceCell->PointIds->GetNumberOfIds()));
+                  const vtkIdType numCorners = faceCell->IsLinear()
+                    ? faceCell->PointIds->GetNumberOfIds()
+                    : faceCell->GetNumberOfEdges();
+                  faceHashValues[facesOffset++] = *std::min_element(
+                    faceCell->PointIds->GetPointer(0), faceCell->PointIds->GetPointer(numCorners));
                 }
               }
+              else
+              {
+                faceHashValues[facesOffset++] = This->NumberOfPoints;
+              }
           }
         }
       }
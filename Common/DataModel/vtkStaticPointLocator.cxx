@@ -2,11 +2,16 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkStaticPointLocator.h"
 
+#include "vtkArrayDispatch.h"
 #include "vtkBoundingBox.h"
 #include "vtkBox.h"
 #include "vtkCellArray.h"
 #include "vtkDataArray.h"
+#include "vtkDataArrayRange.h"
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
 #include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkIntArray.h"
 #include "vtkLine.h"
 #include "vtkMath.h"
@@ -17,7 +22,9 @@
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
 #include "vtkStructuredData.h"
+#include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -101,6 +108,7 @@ struct vtkBucketList
   // Virtuals for templated subclasses
   virtual ~vtkBucketList() = default;
   virtual void BuildLocator() = 0;
+  virtual bool UpdateLocator(const unsigned char* movedPoints) = 0;
 
   // place points in appropriate buckets
   void GetBucketNeighbors(
@@ -991,24 +999,23 @@ struct BucketList : public vtkBucketList
   {
     // Place each point in a bucket
     //
+    // Only read raw pointers from explicit float or double arrays: asking an
+    // implicit array (e.g., the structured points of a converted image) for
+    // its pointer would allocate a copy of all its coordinates.
     vtkPointSet* ps = vtkPointSet::SafeDownCast(this->DataSet);
-    if (ps)
-    { // map points array: explicit points representation of float or double
-      int dataType = ps->GetPoints()->GetDataType();
-      void* pts = ps->GetPoints()->GetVoidPointer(0);
-      if (dataType == VTK_FLOAT)
-      {
-        MapPointsArray<TIds, float> mapper(this, static_cast<float*>(pts));
-        vtkSMPTools::For(0, this->NumPts, mapper);
-      }
-      else if (dataType == VTK_DOUBLE)
-      {
-        MapPointsArray<TIds, double> mapper(this, static_cast<double*>(pts));
-        vtkSMPTools::For(0, this->NumPts, mapper);
-      }
+    vtkDataArray* ptsData = ps && ps->GetPoints() ? ps->GetPoints()->GetData() : nullptr;
+    if (vtkFloatArray* floatPts = vtkFloatArray::FastDownCast(ptsData))
+    {
+      MapPointsArray<TIds, float> mapper(this, floatPts->GetPointer(0));
+      vtkSMPTools::For(0, this->NumPts, mapper);
     }
-    else // if (!mapped)
-    {    // map dataset points: non-float points or implicit points representation
+    else if (vtkDoubleArray* doublePts = vtkDoubleArray::FastDownCast(ptsData))
+    {
+      MapPointsArray<TIds, double> mapper(this, doublePts->GetPointer(0));
+      vtkSMPTools::For(0, this->NumPts, mapper);
+    }
+    else
+    { // map dataset points: non-float points or implicit points representation
       MapDataSet<TIds> mapper(this, this->DataSet);
       vtkSMPTools::For(0, this->NumPts, mapper);
     }
@@ -1025,6 +1032,120 @@ struct BucketList : public vtkBucketList
     MapOffsets<TIds> offMapper(this);
     vtkSMPTools::For(0, numBatches, offMapper);
   }
+
+  // A point that moved to another bucket: its position in the map and its
+  // new tuple.
+  struct MovedTuple
+  {
+    vtkIdType MapIndex;
+    LocatorTuple<TIds> Tuple;
+  };
+
+  // Find the moved points that changed of bucket. Fails if a moved point
+  // left the locator bounds.
+  struct FindMovedTuples
+  {
+    BucketList<TIds>* BList;
+    const unsigned char* MovedPoints;
+    vtkSMPThreadLocal<std::vector<MovedTuple>> Moved;
+    vtkSMPThreadLocal<unsigned char> OutOfBounds;
+
+    FindMovedTuples(BucketList<TIds>* blist, const unsigned char* movedPoints)
+      : BList(blist)
+      , MovedPoints(movedPoints)
+    {
+    }
+
+    void Initialize() { this->OutOfBounds.Local() = 0; }
+
+    void operator()(vtkIdType mapIndex, vtkIdType endMapIndex)
+    {
+      BucketList<TIds>* bList = this->BList;
+      std::vector<MovedTuple>& moved = this->Moved.Local();
+      unsigned char& outOfBounds = this->OutOfBounds.Local();
+      const double* bds = bList->Bounds;
+      double p[3];
+      for (; mapIndex < endMapIndex && !outOfBounds; ++mapIndex)
+      {
+        const LocatorTuple<TIds>& t = bList->Map[mapIndex];
+        if (!this->MovedPoints[t.PtId])
+        {
+          continue;
+        }
+        bList->DataSet->GetPoint(t.PtId, p);
+        if (p[0] < bds[0] || p[0] > bds[1] || p[1] < bds[2] || p[1] > bds[3] || p[2] < bds[4] ||
+          p[2] > bds[5])
+        {
+          outOfBounds = 1;
+          break;
+        }
+        TIds bucket = static_cast<TIds>(bList->GetBucketIndex(p));
+        if (bucket != t.Bucket)
+        {
+          MovedTuple m;
+          m.MapIndex = mapIndex;
+          m.Tuple.PtId = t.PtId;
+          m.Tuple.Bucket = bucket;
+          moved.push_back(m);
+        }
+      }
+    }
+
+    void Reduce() {}
+  };
+
+  // Re-bin the moved points. The points which changed of bucket are removed
+  // from the sorted map, and merged back at their new position. The map is
+  // the same as the one a full rebuild with the same bounds would produce.
+  bool UpdateLocator(const unsigned char* movedPoints) override
+  {
+    FindMovedTuples finder(this, movedPoints);
+    vtkSMPTools::For(0, this->NumPts, finder);
+
+    size_t numMoved = 0;
+    for (auto outOfBounds : finder.OutOfBounds)
+    {
+      if (outOfBounds)
+      {
+        return false;
+      }
+    }
+    for (const auto& moved : finder.Moved)
+    {
+      numMoved += moved.size();
+    }
+    if (numMoved == 0)
+    {
+      return true;
+    }
+
+    // Flag the moved tuples with an invalid bucket, and gather their new
+    // value sorted.
+    std::vector<LocatorTuple<TIds>> movedTuples;
+    movedTuples.reserve(numMoved);
+    const TIds removed = static_cast<TIds>(this->NumBuckets);
+    for (const auto& moved : finder.Moved)
+    {
+      for (const auto& m : moved)
+      {
+        this->Map[m.MapIndex].Bucket = removed;
+        movedTuples.push_back(m.Tuple);
+      }
+    }
+    vtkSMPTools::Sort(movedTuples.begin(), movedTuples.end());
+
+    LocatorTuple<TIds>* mapEnd = this->Map + this->NumPts;
+    LocatorTuple<TIds>* kept = std::remove_if(this->Map, mapEnd,
+      [removed](const LocatorTuple<TIds>& t) { return t.Bucket == removed; });
+    std::copy(movedTuples.begin(), movedTuples.end(), kept);
+    std::inplace_merge(this->Map, kept, mapEnd);
+
+    // Rebuild the offsets
+    int numBatches = static_cast<int>(ceil(static_cast<double>(this->NumPts) / this->BatchSize));
+    MapOffsets<TIds> offMapper(this);
+    vtkSMPTools::For(0, numBatches, offMapper);
+    return true;
+  }
 };
 
 //------------------------------------------------------------------------------
@@ -1452,6 +1573,187 @@ void BucketList<TIds>::FindPointsWithinRadius(double R, const double x[3], vtkId
   }         // k-footprint
 }
 
+//------------------------------------------------------------------------------
+namespace
+{
+//------------------------------------------------------------------------------
+// Batched queries. The query points are first sorted by the bucket they fall
+// in, so that the queries processed together by a thread visit the same
+// buckets (and the same locator points). The sorted queries are processed in
+// fixed size chunks, each chunk gathering its results in its own buffer. Once
+// the number of results of each query is known, the offsets are computed and
+// the results are scattered into the output ids, following the original order
+// of the queries.
+enum BatchedQueryType
+{
+  CLOSEST_N_POINTS,
+  POINTS_WITHIN_RADIUS
+};
+
+template <typename TIds>
+struct BatchedQueries
+{
+  static constexpr vtkIdType ChunkSize = 1024;
+
+  BucketList<TIds>* BList;
+  BatchedQueryType Type;
+  int N;
+  double R;
+  vtkIdType NumQueries;
+  vtkIdType NumChunks;
+  std::vector<LocatorTuple<vtkIdType>> Order;        // queries sorted by bucket
+  std::vector<vtkIdType> Counts;                     // number of results per query
+  std::vector<vtkIdType> ChunkOffsets;               // query offsets in chunk buffers
+  std::vector<std::vector<vtkIdType>> ChunkResults;  // results of each chunk
+  vtkSMPThreadLocalObject<vtkIdList> Result;
+
+  BatchedQueries(BucketList<TIds>* blist, BatchedQueryType type, int n, double r,
+    vtkIdType numQueries)
+    : BList(blist)
+    , Type(type)
+    , N(n)
+    , R(r)
+    , NumQueries(numQueries)
+  {
+    this->NumChunks = (numQueries + ChunkSize - 1) / ChunkSize;
+    this->Order.resize(numQueries);
+    this->Counts.resize(numQueries);
+    this->ChunkOffsets.resize(numQueries);
+    this->ChunkResults.resize(this->NumChunks);
+  }
+
+  // Compute the bucket of each query point.
+  template <typename TArray>
+  struct BinQueries
+  {
+    BatchedQueries* Self;
+    TArray* Queries;
+
+    void operator()(vtkIdType query, vtkIdType endQuery)
+    {
+      const auto queries = vtk::DataArrayTupleRange<3>(this->Queries, query, endQuery);
+      double x[3];
+      for (const auto q : queries)
+      {
+        x[0] = static_cast<double>(q[0]);
+        x[1] = static_cast<double>(q[1]);
+        x[2] = static_cast<double>(q[2]);
+        LocatorTuple<vtkIdType>& t = this->Self->Order[query];
+        t.PtId = query++;
+        t.Bucket = this->Self->BList->GetBucketIndex(x);
+      }
+    }
+  };
+
+  // Process chunks of sorted queries.
+  template <typename TArray>
+  struct ProcessChunks
+  {
+    BatchedQueries* Self;
+    TArray* Queries;
+
+    void Initialize() { this->Self->Result.Local()->Allocate(256); }
+
+    void operator()(vtkIdType chunk, vtkIdType endChunk)
+    {
+      BatchedQueries* self = this->Self;
+      vtkIdList* result = self->Result.Local();
+      const auto queries = vtk::DataArrayTupleRange<3>(this->Queries);
+      double x[3];
+      for (; chunk < endChunk; ++chunk)
+      {
+        std::vector<vtkIdType>& buffer = self->ChunkResults[chunk];
+        vtkIdType end = std::min((chunk + 1) * ChunkSize, self->NumQueries);
+        for (vtkIdType i = chunk * ChunkSize; i < end; ++i)
+        {
+          vtkIdType query = self->Order[i].PtId;
+          const auto q = queries[query];
+          x[0] = static_cast<double>(q[0]);
+          x[1] = static_cast<double>(q[1]);
+          x[2] = static_cast<double>(q[2]);
+          if (self->Type == CLOSEST_N_POINTS)
+          {
+            self->BList->FindClosestNPoints(self->N, x, result);
+          }
+          else
+          {
+            self->BList->FindPointsWithinRadius(self->R, x, result);
+          }
+          self->Counts[query] = result->GetNumberOfIds();
+          self->ChunkOffsets[query] = static_cast<vtkIdType>(buffer.size());
+          buffer.insert(buffer.end(), result->begin(), result->end());
+        }
+      }
+    }
+
+    void Reduce() {}
+  };
+
+  // Copy the chunk results into the output ids.
+  struct ScatterResults
+  {
+    BatchedQueries* Self;
+    const vtkIdType* Offsets;
+    vtkIdType* Ids;
+
+    void operator()(vtkIdType chunk, vtkIdType endChunk)
+    {
+      BatchedQueries* self = this->Self;
+      for (; chunk < endChunk; ++chunk)
+      {
+        std::vector<vtkIdType>& buffer = self->ChunkResults[chunk];
+        vtkIdType end = std::min((chunk + 1) * ChunkSize, self->NumQueries);
+        for (vtkIdType i = chunk * ChunkSize; i < end; ++i)
+        {
+          vtkIdType query = self->Order[i].PtId;
+          std::copy_n(buffer.data() + self->ChunkOffsets[query], self->Counts[query],
+            this->Ids + this->Offsets[query]);
+        }
+        // Release the memory of the chunk as soon as possible
+        std::vector<vtkIdType>().swap(buffer);
+      }
+    }
+  };
+
+  // Entry point of the dispatch
+  template <typename TArray>
+  void operator()(TArray* queries, vtkIdTypeArray* offsets, vtkIdTypeArray* ids)
+  {
+    BinQueries<TArray> binQueries{ this, queries };
+    vtkSMPTools::For(0, this->NumQueries, binQueries);
+    vtkSMPTools::Sort(this->Order.begin(), this->Order.end());
+
+    ProcessChunks<TArray> processChunks{ this, queries };
+    vtkSMPTools::For(0, this->NumChunks, 1, processChunks);
+
+    // Exclusive prefix sum of the number of results of each query
+    offsets->SetNumberOfValues(this->NumQueries + 1);
+    vtkIdType* offsetsPtr = offsets->GetPointer(0);
+    offsetsPtr[0] = 0;
+    for (vtkIdType query = 0; query < this->NumQueries; ++query)
+    {
+      offsetsPtr[query + 1] = offsetsPtr[query] + this->Counts[query];
+    }
+
+    ids->SetNumberOfValues(offsetsPtr[this->NumQueries]);
+    ScatterResults scatter{ this, offsetsPtr, ids->GetPointer(0) };
+    vtkSMPTools::For(0, this->NumChunks, 1, scatter);
+  }
+
+  // Run the queries, dispatching on the type of the query points
+  static void Execute(BucketList<TIds>* blist, BatchedQueryType type, int n, double r,
+    vtkDataArray* queries, vtkIdTypeArray* offsets, vtkIdTypeArray* ids)
+  {
+    BatchedQueries<TIds> batch(blist, type, n, r, queries->GetNumberOfTuples());
+    using Dispatcher = vtkArrayDispatch::DispatchByValueType<vtkArrayDispatch::Reals>;
+    if (!Dispatcher::Execute(queries, batch, offsets, ids))
+    {
+      batch(queries, offsets, ids);
+    }
+  }
+};
+} // anonymous namespace
+
 //------------------------------------------------------------------------------
 // Find the point within tol of the finite line, and closest to the starting
 // point of the line (i.e., min parametric coordinate t).
@@ -1967,6 +2269,29 @@ void vtkStaticPointLocator::ForceBuildLocator()
   this->BuildLocatorInternal();
 }
 
+//------------------------------------------------------------------------------
+bool vtkStaticPointLocator::UpdateLocator(vtkUnsignedCharArray* movedPoints)
+{
+  if (!this->Buckets || !this->DataSet || !movedPoints ||
+    this->Buckets->NumPts != this->DataSet->GetNumberOfPoints() ||
+    movedPoints->GetNumberOfValues() < this->Buckets->NumPts)
+  {
+    vtkDebugMacro(<< "Cannot update the locator, rebuilding it");
+    this->ForceBuildLocator();
+    return false;
+  }
+
+  if (!this->Buckets->UpdateLocator(movedPoints->GetPointer(0)))
+  {
+    vtkDebugMacro(<< "Moved points left the locator bounds, rebuilding it");
+    this->ForceBuildLocator();
+    return false;
+  }
+
+  this->BuildTime.Modified();
+  return true;
+}
+
 //------------------------------------------------------------------------------
 //  Method to form subdivision of space based on the points provided and
 //  subject to the constraints of levels and NumberOfPointsPerBucket.
@@ -2237,6 +2562,61 @@ void vtkStaticPointLocator::FindPointsWithinRadius(double R, const double x[3],
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkStaticPointLocator::FindClosestNPoints(
+  int N, vtkDataArray* queries, vtkIdTypeArray* offsets, vtkIdTypeArray* ids)
+{
+  this->BatchedQuery(CLOSEST_N_POINTS, N, 0.0, queries, offsets, ids);
+}
+
+//------------------------------------------------------------------------------
+void vtkStaticPointLocator::FindPointsWithinRadius(
+  double R, vtkDataArray* queries, vtkIdTypeArray* offsets, vtkIdTypeArray* ids)
+{
+  this->BatchedQuery(POINTS_WITHIN_RADIUS, 0, R, queries, offsets, ids);
+}
+
+//------------------------------------------------------------------------------
+void vtkStaticPointLocator::BatchedQuery(
+  int type, int N, double R, vtkDataArray* queries, vtkIdTypeArray* offsets, vtkIdTypeArray* ids)
+{
+  if (!queries || !offsets || !ids)
+  {
+    vtkErrorMacro("Query points, offsets and ids arrays must be provided");
+    return;
+  }
+  if (queries->GetNumberOfComponents() != 3)
+  {
+    vtkErrorMacro("Query points must have 3 components");
+    return;
+  }
+
+  offsets->SetNumberOfComponents(1);
+  ids->SetNumberOfComponents(1);
+
+  this->BuildLocator(); // will subdivide if modified; otherwise returns
+  if (!this->Buckets)
+  {
+    // No points: every query has an empty result
+    offsets->SetNumberOfValues(queries->GetNumberOfTuples() + 1);
+    offsets->FillValue(0);
+    ids->SetNumberOfValues(0);
+    return;
+  }
+
+  BatchedQueryType queryType = static_cast<BatchedQueryType>(type);
+  if (this->LargeIds)
+  {
+    BatchedQueries<vtkIdType>::Execute(static_cast<BucketList<vtkIdType>*>(this->Buckets),
+      queryType, N, R, queries, offsets, ids);
+  }
+  else
+  {
+    BatchedQueries<int>::Execute(
+      static_cast<BucketList<int>*>(this->Buckets), queryType, N, R, queries, offsets, ids);
+  }
+}
+
 //------------------------------------------------------------------------------
 // This method traverses the locator along the defined ray, finding the
 // closest point to a0 when projected onto the line (a0,a1) (i.e., min
@@ -52,6 +52,8 @@ VTK_ABI_NAMESPACE_BEGIN
 class vtkIdList;
 struct vtkBucketList;
 class vtkDataArray;
+class vtkIdTypeArray;
+class vtkUnsignedCharArray;
 
 class VTKCOMMONDATAMODEL_EXPORT vtkStaticPointLocator : public vtkAbstractPointLocator
 {
@@ -139,6 +141,25 @@ public:
    */
   void FindPointsWithinRadius(double R, const double x[3], vtkIdList* result) override;
 
+  ///@{
+  /**
+   * Batched versions of FindClosestNPoints() and FindPointsWithinRadius().
+   * The queries array holds one 3-component query point per tuple. The
+   * results are returned in compressed sparse row form: the ids of the
+   * points found for query i are ids[offsets[i]] to ids[offsets[i+1]-1],
+   * offsets having one more value than there are queries. The results of
+   * each query are the same as those of the single point methods. The
+   * queries are executed in parallel with vtkSMPTools, in the order of the
+   * buckets they fall in to improve memory locality, which is much faster
+   * than calling the single point methods in a loop for large numbers of
+   * queries. The offsets and ids arrays are resized as needed.
+   */
+  void FindClosestNPoints(
+    int N, vtkDataArray* queries, vtkIdTypeArray* offsets, vtkIdTypeArray* ids);
+  void FindPointsWithinRadius(
+    double R, vtkDataArray* queries, vtkIdTypeArray* offsets, vtkIdTypeArray* ids);
+  ///@}
+
   /**
    * Intersect the points contained in the locator with the line defined by
    * (a0,a1). Return the point within the tolerance tol that is closest to a0
@@ -187,6 +208,17 @@ public:
   void BuildLocator(const double* inBounds);
   ///@}
 
+  /**
+   * Update the locator after some points of the data set moved, instead of
+   * rebuilding it. movedPoints is a mask with one value per point, nonzero
+   * for the points whose position changed. Only the moved points are binned
+   * again, the locator keeping its bounds and divisions. When the update is
+   * not possible (the locator was never built, the number of points changed,
+   * or a moved point left the locator bounds) the locator is rebuilt and
+   * false is returned. This method is not thread safe.
+   */
+  bool UpdateLocator(vtkUnsignedCharArray* movedPoints);
+
   /**
    * Populate a polydata with the faces of the bins that potentially contain cells.
    * Note that the level parameter has no effect on this method as there is no
@@ -296,6 +328,10 @@ protected:
   bool LargeIds;                // indicate whether integer ids are small or large
   int TraversalOrder;           // Control traversal order when threading
 
+  // Shared implementation of the batched queries
+  void BatchedQuery(
+    int type, int N, double R, vtkDataArray* queries, vtkIdTypeArray* offsets, vtkIdTypeArray* ids);
+
 private:
   vtkStaticPointLocator(const vtkStaticPointLocator&) = delete;
   void operator=(const vtkStaticPointLocator&) = delete;
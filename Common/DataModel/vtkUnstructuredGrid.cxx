@@ -18,17 +18,51 @@
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkPolyhedron.h"
+#include "vtkSMPTools.h"
 #include "vtkStaticCellLinks.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGridCellIterator.h"
 
 #include <algorithm>
+#include <limits>
+#include <numeric>
 #include <set>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkUnstructuredGrid);
 vtkStandardExtendedNewMacro(vtkUnstructuredGrid);
 
+//------------------------------------------------------------------------------
+struct vtkUnstructuredGrid::vtkPolyhedronTopology
+{
+  // The arrays the topology was built from, to detect that it is outdated.
+  vtkCellArray* Connectivity = nullptr;
+  vtkIdTypeArray* Faces = nullptr;
+  vtkIdType NumberOfCells = 0;
+  vtkIdType FacesSize = 0;
+
+  // The faces with cell local point ids, at the same locations as in Faces.
+  std::vector<vtkIdType> CanonicalFaces;
+
+  // The edges of each polyhedron, with cell local point ids, and the two faces
+  // using each edge as vtkPolyhedron generates them. EdgeOffsets reserves the
+  // number of face edges of each cell, an upper bound of its number of edges.
+  std::vector<vtkIdType> EdgeOffsets;
+  std::vector<vtkIdType> NumberOfEdges;
+  std::vector<vtkIdType> Edges;
+  std::vector<vtkIdType> EdgeFaces;
+
+  bool IsValid(vtkUnstructuredGrid* grid, vtkIdType cellId) const
+  {
+    return grid->Connectivity == this->Connectivity && grid->Faces == this->Faces &&
+      cellId < this->NumberOfCells && this->NumberOfEdges[cellId] > 0 &&
+      grid->GetNumberOfCells() == this->NumberOfCells &&
+      grid->Faces->GetNumberOfValues() == this->FacesSize;
+  }
+};
+
 namespace
 {
 constexpr unsigned char MASKED_CELL_VALUE = vtkDataSetAttributes::HIDDENCELL |
@@ -217,6 +251,7 @@ void vtkUnstructuredGrid::CopyStructure(vtkDataSet* ds)
   this->DistinctCellTypesUpdateMTime = 0;
   this->Faces = ug->Faces;
   this->FaceLocations = ug->FaceLocations;
+  this->PolyhedronTopology = ug->PolyhedronTopology;
 }
 
 //------------------------------------------------------------------------------
@@ -229,6 +264,7 @@ void vtkUnstructuredGrid::Cleanup()
   this->DistinctCellTypesUpdateMTime = 0;
   this->Faces = nullptr;
   this->FaceLocations = nullptr;
+  this->PolyhedronTopology = nullptr;
 }
 
 //------------------------------------------------------------------------------
@@ -285,6 +321,19 @@ void vtkUnstructuredGrid::GetCell(vtkIdType cellId, vtkGenericCell* cell)
   if (cell->RequiresInitialization())
   {
     cell->Initialize();
+
+    // Hand the cached faces and edges to the polyhedron
+    if (cellType == VTK_POLYHEDRON && this->PolyhedronTopology &&
+      this->PolyhedronTopology->IsValid(this, cellId))
+    {
+      const vtkPolyhedronTopology& topology = *this->PolyhedronTopology;
+      const vtkIdType offset = 2 * topology.EdgeOffsets[cellId];
+      const vtkIdType loc = this->FaceLocations->GetValue(cellId);
+      static_cast<vtkPolyhedron*>(cell->GetRepresentativeCell())
+        ->SetCanonicalTopology(topology.CanonicalFaces.data() + loc,
+          topology.NumberOfEdges[cellId], topology.Edges.data() + offset,
+          topology.EdgeFaces.data() + offset);
+    }
   }
   this->SetCellOrderAndRationalWeights(cellId, cell);
 }
@@ -629,6 +678,7 @@ void vtkUnstructuredGrid::SetCells(vtkUnsignedCharArray* cellTypes, vtkCellArray
   this->DistinctCellTypesUpdateMTime = 0;
   this->Faces = faces;
   this->FaceLocations = faceLocations;
+  this->PolyhedronTopology = nullptr;
 }
 
 //------------------------------------------------------------------------------
@@ -661,6 +711,168 @@ void vtkUnstructuredGrid::BuildLinks()
   this->Links->BuildLinks();
 }
 
+namespace
+{
+// An edge of a face of a polyhedron, oriented like the face.
+struct vtkPolyhedronFaceEdge
+{
+  vtkIdType Min;
+  vtkIdType Max;
+  vtkIdType Id0;
+  vtkIdType Id1;
+  vtkIdType Face;
+  vtkIdType Order;
+
+  bool operator<(const vtkPolyhedronFaceEdge& other) const
+  {
+    return this->Min < other.Min ||
+      (this->Min == other.Min &&
+        (this->Max < other.Max || (this->Max == other.Max && this->Order < other.Order)));
+  }
+};
+}
+
+//------------------------------------------------------------------------------
+void vtkUnstructuredGrid::BuildPolyhedronTopology()
+{
+  this->PolyhedronTopology = nullptr;
+  if (!this->Connectivity || !this->Types || !this->Faces || !this->FaceLocations)
+  {
+    return;
+  }
+
+  auto topology = std::make_shared<vtkPolyhedronTopology>();
+  const vtkIdType numCells = this->GetNumberOfCells();
+  topology->Connectivity = this->Connectivity;
+  topology->Faces = this->Faces;
+  topology->NumberOfCells = numCells;
+  topology->FacesSize = this->Faces->GetNumberOfValues();
+  topology->CanonicalFaces.resize(topology->FacesSize);
+  topology->EdgeOffsets.assign(numCells + 1, 0);
+  topology->NumberOfEdges.assign(numCells, 0);
+
+  const unsigned char* types = this->Types->GetPointer(0);
+  const vtkIdType* faces = this->Faces->GetPointer(0);
+  const vtkIdType* faceLocations = this->FaceLocations->GetPointer(0);
+  const vtkIdType numFaceLocations = this->FaceLocations->GetNumberOfValues();
+  auto getFaceLocation = [&](vtkIdType cellId) {
+    return types[cellId] == VTK_POLYHEDRON && cellId < numFaceLocations ? faceLocations[cellId]
+                                                                        : -1;
+  };
+
+  // Reserve room for the face edges of each polyhedron.
+  vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      const vtkIdType loc = getFaceLocation(cellId);
+      if (loc < 0)
+      {
+        continue;
+      }
+      const vtkIdType* face = faces + loc + 1;
+      vtkIdType numFaceEdges = 0;
+      for (vtkIdType faceId = 0; faceId < faces[loc]; ++faceId)
+      {
+        numFaceEdges += face[0];
+        face += face[0] + 1;
+      }
+      topology->EdgeOffsets[cellId + 1] = numFaceEdges;
+    }
+  });
+  std::partial_sum(
+    topology->EdgeOffsets.begin(), topology->EdgeOffsets.end(), topology->EdgeOffsets.begin());
+  topology->Edges.resize(2 * topology->EdgeOffsets[numCells]);
+  topology->EdgeFaces.resize(2 * topology->EdgeOffsets[numCells]);
+
+  // Convert the faces to local point ids and gather their edges. The edges are
+  // numbered in the order of their first use by the faces, oriented like the
+  // first face using them, and list the first and the last faces using them.
+  vtkCellArray* connectivity = this->Connectivity;
+  vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+    vtkNew<vtkIdList> ptIds;
+    std::vector<std::pair<vtkIdType, vtkIdType>> localIds;
+    std::vector<vtkPolyhedronFaceEdge> faceEdges;
+    std::vector<std::pair<vtkIdType, std::pair<size_t, size_t>>> edgeGroups;
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      const vtkIdType loc = getFaceLocation(cellId);
+      if (loc < 0)
+      {
+        continue;
+      }
+
+      // like vtkPolyhedron, map a point id repeated in the cell to its last
+      // position and a point id missing from the cell to 0
+      connectivity->GetCellAtId(cellId, ptIds);
+      localIds.clear();
+      for (vtkIdType i = 0; i < ptIds->GetNumberOfIds(); ++i)
+      {
+        localIds.emplace_back(ptIds->GetId(i), i);
+      }
+      std::sort(localIds.begin(), localIds.end());
+      auto toLocal = [&localIds](vtkIdType id) {
+        auto it = std::upper_bound(localIds.begin(), localIds.end(),
+          std::make_pair(id, std::numeric_limits<vtkIdType>::max()));
+        return it != localIds.begin() && (it - 1)->first == id ? (it - 1)->second : 0;
+      };
+
+      const vtkIdType numFaces = faces[loc];
+      vtkIdType* canonical = topology->CanonicalFaces.data() + loc;
+      canonical[0] = numFaces;
+      faceEdges.clear();
+      vtkIdType pos = 1;
+      for (vtkIdType faceId = 0; faceId < numFaces; ++faceId)
+      {
+        const vtkIdType npts = faces[loc + pos];
+        canonical[pos] = npts;
+        for (vtkIdType i = 1; i <= npts; ++i)
+        {
+          canonical[pos + i] = toLocal(faces[loc + pos + i]);
+        }
+        for (vtkIdType i = 1; i <= npts; ++i)
+        {
+          const vtkIdType id0 = canonical[pos + i];
+          const vtkIdType id1 = canonical[pos + (i != npts ? i + 1 : 1)];
+          faceEdges.push_back({ std::min(id0, id1), std::max(id0, id1), id0, id1, faceId,
+            static_cast<vtkIdType>(faceEdges.size()) });
+        }
+        pos += npts + 1;
+      }
+
+      // group the uses of each edge, then number the edges by first use
+      std::sort(faceEdges.begin(), faceEdges.end());
+      edgeGroups.clear();
+      for (size_t first = 0, last; first < faceEdges.size(); first = last + 1)
+      {
+        last = first;
+        while (last + 1 < faceEdges.size() && faceEdges[last + 1].Min == faceEdges[first].Min &&
+          faceEdges[last + 1].Max == faceEdges[first].Max)
+        {
+          ++last;
+        }
+        edgeGroups.emplace_back(faceEdges[first].Order, std::make_pair(first, last));
+      }
+      std::sort(edgeGroups.begin(), edgeGroups.end());
+
+      const vtkIdType offset = 2 * topology->EdgeOffsets[cellId];
+      vtkIdType* edges = topology->Edges.data() + offset;
+      vtkIdType* edgeFaces = topology->EdgeFaces.data() + offset;
+      for (const auto& group : edgeGroups)
+      {
+        const vtkPolyhedronFaceEdge& firstUse = faceEdges[group.second.first];
+        const vtkPolyhedronFaceEdge& lastUse = faceEdges[group.second.second];
+        *edges++ = firstUse.Id0;
+        *edges++ = firstUse.Id1;
+        *edgeFaces++ = firstUse.Face;
+        *edgeFaces++ = group.second.second > group.second.first ? lastUse.Face : -1;
+      }
+      topology->NumberOfEdges[cellId] = static_cast<vtkIdType>(edgeGroups.size());
+    }
+  });
+
+  this->PolyhedronTopology = topology;
+}
+
 //------------------------------------------------------------------------------
 vtkAbstractCellLinks* vtkUnstructuredGrid::GetCellLinks()
 {
@@ -712,7 +924,8 @@ vtkUnsignedCharArray* vtkUnstructuredGrid::GetDistinctCellTypesArray()
   }
 
   if (this->DistinctCellTypes == nullptr ||
-    this->Types->GetMTime() > this->DistinctCellTypesUpdateMTime)
+    this->Types->GetMTime() > this->DistinctCellTypesUpdateMTime ||
+    this->Types->GetNumberOfValues() != this->DistinctCellTypesNumberOfCells)
   {
     if (this->DistinctCellTypes)
     {
@@ -727,11 +940,23 @@ vtkUnsignedCharArray* vtkUnstructuredGrid::GetDistinctCellTypesArray()
     vtkDataSet::GetCellTypes(this->DistinctCellTypes);
 
     this->DistinctCellTypesUpdateMTime = this->Types->GetMTime();
+    this->DistinctCellTypesNumberOfCells = this->Types->GetNumberOfValues();
   }
 
   return this->DistinctCellTypes->GetCellTypesArray();
 }
 
+//------------------------------------------------------------------------------
+int vtkUnstructuredGrid::GetHomogeneousCellType()
+{
+  vtkUnsignedCharArray* distinctCellTypes = this->GetDistinctCellTypesArray();
+  if (this->GetNumberOfCells() > 0 && distinctCellTypes->GetNumberOfValues() == 1)
+  {
+    return static_cast<int>(distinctCellTypes->GetValue(0));
+  }
+  return -1;
+}
+
 //------------------------------------------------------------------------------
 vtkUnsignedCharArray* vtkUnstructuredGrid::GetCellTypesArray()
 {
@@ -857,6 +1082,7 @@ void vtkUnstructuredGrid::Reset()
   {
     this->FaceLocations->Reset();
   }
+  this->PolyhedronTopology = nullptr;
 }
 
 //------------------------------------------------------------------------------
@@ -925,6 +1151,7 @@ void vtkUnstructuredGrid::ResizeCellList(vtkIdType ptId, int size)
 void vtkUnstructuredGrid::InternalReplaceCell(vtkIdType cellId, int npts, const vtkIdType pts[])
 {
   this->Connectivity->ReplaceCellAtId(cellId, npts, pts);
+  this->PolyhedronTopology = nullptr;
 }
 
 //------------------------------------------------------------------------------
@@ -1007,6 +1234,7 @@ void vtkUnstructuredGrid::ShallowCopy(vtkDataObject* dataObject)
     this->DistinctCellTypesUpdateMTime = 0;
     this->Faces = grid->Faces;
     this->FaceLocations = grid->FaceLocations;
+    this->PolyhedronTopology = grid->PolyhedronTopology;
   }
   else if (vtkUnstructuredGridBase* ugb = vtkUnstructuredGridBase::SafeDownCast(dataObject))
   {
@@ -1377,21 +1605,7 @@ void vtkUnstructuredGrid::GetCellNeighbors(
 //------------------------------------------------------------------------------
 int vtkUnstructuredGrid::IsHomogeneous()
 {
-  unsigned char type;
-  if (this->Types && this->Types->GetMaxId() >= 0)
-  {
-    type = Types->GetValue(0);
-    vtkIdType numCells = this->GetNumberOfCells();
-    for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
-    {
-      if (this->Types->GetValue(cellId) != type)
-      {
-        return 0;
-      }
-    }
-    return 1;
-  }
-  return 0;
+  return this->GetHomogeneousCellType() >= 0 ? 1 : 0;
 }
 
 //------------------------------------------------------------------------------
@@ -24,6 +24,8 @@
 
 #include "vtkSmartPointer.h" // for smart pointer
 
+#include <memory> // for std::shared_ptr
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkCellArray;
 class vtkIdList;
@@ -145,6 +147,18 @@ public:
    */
   vtkUnsignedCharArray* GetDistinctCellTypesArray();
 
+  /**
+   * Return the type of the cells when all the cells of the grid share the
+   * same type, or -1 when the grid has no cells or cells of different types.
+   * This relies on the cached distinct cell types (see
+   * GetDistinctCellTypesArray()), so filters can cheaply check for pure
+   * tetrahedral or hexahedral grids and select specialized code paths.
+   *
+   * THIS METHOD IS THREAD SAFE IF FIRST CALLED FROM A SINGLE THREAD AND
+   * THE DATASET IS NOT MODIFIED
+   */
+  int GetHomogeneousCellType();
+
   /**
    * A higher-performing variant of the virtual vtkDataSet::GetCellPoints()
    * for unstructured grids. Given a cellId, return the number of defining
@@ -377,7 +391,8 @@ public:
   void GetIdsOfCellsOfType(int type, vtkIdTypeArray* array) override;
 
   /**
-   * Returns whether cells are all of the same type.
+   * Returns whether cells are all of the same type. See also
+   * GetHomogeneousCellType().
    */
   int IsHomogeneous() override;
 
@@ -418,6 +433,17 @@ public:
    */
   int InitializeFacesRepresentation(vtkIdType numPrevCells);
 
+  /**
+   * Build the faces and the edges of all the polyhedron cells expressed with
+   * cell local point ids, in parallel. Once built, GetCell() hands them to the
+   * polyhedra it returns, which then skip the generation of their faces and
+   * edges and contour or clip directly from their faces. Like BuildLinks(),
+   * call this before accessing the polyhedra from several threads. The
+   * topology is discarded when the cells of the grid are changed through its
+   * API; rebuild it after modifying the cell or face arrays directly.
+   */
+  void BuildPolyhedronTopology();
+
   /**
    * Return the mesh (geometry/topology) modification time.
    * This time is different from the usual MTime which also takes into
@@ -536,7 +562,10 @@ protected:
 
   // The DistinctCellTypes is cached, so we keep track of the last time it was
   // updated so we can compare it to the modified time of the Types array.
+  // Cells inserted with InsertNextCell() do not modify the Types array, so
+  // the number of cells is checked as well.
   vtkMTimeType DistinctCellTypesUpdateMTime;
+  vtkIdType DistinctCellTypesNumberOfCells = 0;
 
   // Special support for polyhedra/cells with explicit face representations.
   // The Faces class represents polygonal faces using a modified vtkCellArray
@@ -561,6 +590,10 @@ private:
   void operator=(const vtkUnstructuredGrid&) = delete;
 
   void Cleanup();
+
+  // Canonical faces and edges of the polyhedra, see BuildPolyhedronTopology().
+  struct vtkPolyhedronTopology;
+  std::shared_ptr<vtkPolyhedronTopology> PolyhedronTopology;
 };
 
 VTK_ABI_NAMESPACE_END
@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkAppendPolyData.h"
+#include "vtkDemandDrivenPipeline.h"
+#include "vtkElevationFilter.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPolyData.h"
+#include "vtkSphereSource.h"
+
+namespace
+{
+bool CheckReleased(vtkAlgorithm* algorithm, bool expected, const char* name)
+{
+  if (algorithm->GetOutputDataObject(0)->GetDataReleased() != expected)
+  {
+    vtkLog(ERROR, "The output of the " << name << (expected ? " was not" : " was") << " released.");
+    return false;
+  }
+  return true;
+}
+}
+
+int TestAutomaticReleaseData(int, char*[])
+{
+  bool success = true;
+  vtkDemandDrivenPipeline::AutomaticReleaseDataOn();
+
+  // A sphere consumed by two filters, themselves consumed by an append filter.
+  vtkNew<vtkSphereSource> sphere;
+  vtkNew<vtkElevationFilter> elevation1;
+  elevation1->SetInputConnection(sphere->GetOutputPort());
+  vtkNew<vtkElevationFilter> elevation2;
+  elevation2->SetInputConnection(sphere->GetOutputPort());
+  elevation2->SetLowPoint(0.0, 0.0, 1.0);
+  vtkNew<vtkAppendPolyData> append;
+  append->AddInputConnection(elevation1->GetOutputPort());
+  append->AddInputConnection(elevation2->GetOutputPort());
+  append->Update();
+
+  // Every intermediate output is released once all its consumers executed.
+  success &= CheckReleased(sphere, true, "sphere");
+  success &= CheckReleased(elevation1, true, "first elevation filter");
+  success &= CheckReleased(elevation2, true, "second elevation filter");
+  success &= CheckReleased(append, false, "append filter");
+  // The default sphere has 50 points.
+  if (append->GetOutput()->GetNumberOfPoints() != 2 * 50)
+  {
+    vtkLog(ERROR, "Wrong number of appended points.");
+    success = false;
+  }
+
+  // Updating again does not execute anything.
+  vtkMTimeType updateTime = append->GetOutput()->GetUpdateTime();
+  append->Update();
+  if (append->GetOutput()->GetUpdateTime() != updateTime)
+  {
+    vtkLog(ERROR, "An up to date pipeline was executed again.");
+    success = false;
+  }
+
+  // An interactive consumer keeps its inputs.
+  vtkDemandDrivenPipeline::SafeDownCast(append->GetExecutive())->InteractiveOn();
+  elevation1->Modified();
+  append->Update();
+  success &= CheckReleased(elevation1, false, "first elevation filter");
+  success &= CheckReleased(elevation2, false, "second elevation filter");
+  // Both elevation filters executed again as their outputs had been released.
+  success &= CheckReleased(sphere, true, "sphere");
+
+  // Now that the append filter keeps its inputs, modifying one branch only
+  // executes that branch, and the sphere is kept for the other one.
+  elevation1->Modified();
+  append->Update();
+  success &= CheckReleased(sphere, false, "sphere");
+  success &= CheckReleased(elevation2, false, "second elevation filter");
+
+  vtkDemandDrivenPipeline::AutomaticReleaseDataOff();
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
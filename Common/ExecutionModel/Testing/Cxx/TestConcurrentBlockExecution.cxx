@@ -0,0 +1,202 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkFieldData.h"
+#include "vtkIdTypeArray.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkLogger.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPartitionedDataSet.h"
+#include "vtkPartitionedDataSetAlgorithm.h"
+#include "vtkPartitionedDataSetCollection.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+
+#include <atomic>
+
+namespace
+{
+vtkSmartPointer<vtkPolyData> MakePolyData(vtkIdType numPoints)
+{
+  vtkNew<vtkPoints> points;
+  for (vtkIdType i = 0; i < numPoints; ++i)
+  {
+    points->InsertNextPoint(static_cast<double>(i), 0.0, 0.0);
+  }
+  auto polyData = vtkSmartPointer<vtkPolyData>::New();
+  polyData->SetPoints(points);
+  return polyData;
+}
+
+// Store the number of input points in the field data of the output.
+vtkIdType GetStoredNumberOfPoints(vtkDataObject* dobj)
+{
+  auto array = dobj
+    ? vtkIdTypeArray::SafeDownCast(dobj->GetFieldData()->GetArray("NumberOfPoints"))
+    : nullptr;
+  return array ? array->GetValue(0) : -1;
+}
+
+void StoreNumberOfPoints(vtkDataObject* dobj, vtkIdType numPoints)
+{
+  vtkNew<vtkIdTypeArray> array;
+  array->SetName("NumberOfPoints");
+  array->InsertNextValue(numPoints);
+  dobj->GetFieldData()->AddArray(array);
+}
+}
+
+//------------------------------------------------------------------------------
+class vtkTestConcurrentPolyDataFilter : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkTestConcurrentPolyDataFilter* New();
+  vtkTypeMacro(vtkTestConcurrentPolyDataFilter, vtkPolyDataAlgorithm);
+
+  bool CanExecuteBlocksConcurrently() override { return true; }
+
+  std::atomic<int> NumberOfExecutions{ 0 };
+
+protected:
+  int RequestData(vtkInformation*, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override
+  {
+    vtkPolyData* input = vtkPolyData::GetData(inputVector[0]);
+    vtkPolyData* output = vtkPolyData::GetData(outputVector);
+    StoreNumberOfPoints(output, input->GetNumberOfPoints());
+    ++this->NumberOfExecutions;
+    return 1;
+  }
+};
+vtkStandardNewMacro(vtkTestConcurrentPolyDataFilter);
+
+//------------------------------------------------------------------------------
+class vtkTestConcurrentPartitionedFilter : public vtkPartitionedDataSetAlgorithm
+{
+public:
+  static vtkTestConcurrentPartitionedFilter* New();
+  vtkTypeMacro(vtkTestConcurrentPartitionedFilter, vtkPartitionedDataSetAlgorithm);
+
+  bool CanExecuteBlocksConcurrently() override { return true; }
+
+  std::atomic<int> NumberOfExecutions{ 0 };
+
+protected:
+  int RequestData(vtkInformation*, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override
+  {
+    vtkPartitionedDataSet* input = vtkPartitionedDataSet::GetData(inputVector[0]);
+    vtkPartitionedDataSet* output = vtkPartitionedDataSet::GetData(outputVector);
+    output->ShallowCopy(input);
+    StoreNumberOfPoints(output, input->GetNumberOfPoints());
+    ++this->NumberOfExecutions;
+    return 1;
+  }
+};
+vtkStandardNewMacro(vtkTestConcurrentPartitionedFilter);
+
+//------------------------------------------------------------------------------
+int TestConcurrentBlockExecution(int, char*[])
+{
+  int retVal = EXIT_SUCCESS;
+
+  // Many small blocks, some of them sharing the same dataset.
+  const unsigned int numBlocks = 64;
+  vtkNew<vtkMultiBlockDataSet> multiBlock;
+  multiBlock->SetNumberOfBlocks(numBlocks);
+  auto shared = MakePolyData(3);
+  for (unsigned int i = 0; i < numBlocks; ++i)
+  {
+    if (i % 8 == 0)
+    {
+      multiBlock->SetBlock(i, shared);
+    }
+    else if (i % 8 != 5)
+    {
+      multiBlock->SetBlock(i, MakePolyData(i));
+    }
+  }
+
+  vtkNew<vtkTestConcurrentPolyDataFilter> polyDataFilter;
+  polyDataFilter->SetInputDataObject(multiBlock);
+  polyDataFilter->Update();
+
+  auto outputBlocks = vtkMultiBlockDataSet::SafeDownCast(polyDataFilter->GetOutputDataObject(0));
+  if (!outputBlocks || outputBlocks->GetNumberOfBlocks() != numBlocks)
+  {
+    vtkLog(ERROR, "Wrong multiblock output structure.");
+    return EXIT_FAILURE;
+  }
+  int expectedExecutions = 0;
+  for (unsigned int i = 0; i < numBlocks; ++i)
+  {
+    vtkDataObject* inBlock = multiBlock->GetBlock(i);
+    vtkDataObject* outBlock = outputBlocks->GetBlock(i);
+    if (!inBlock)
+    {
+      if (outBlock)
+      {
+        vtkLog(ERROR, "Unexpected output for empty block " << i << ".");
+        retVal = EXIT_FAILURE;
+      }
+      continue;
+    }
+    ++expectedExecutions;
+    if (GetStoredNumberOfPoints(outBlock) !=
+      vtkPolyData::SafeDownCast(inBlock)->GetNumberOfPoints())
+    {
+      vtkLog(ERROR, "Wrong output for block " << i << ".");
+      retVal = EXIT_FAILURE;
+    }
+  }
+  if (polyDataFilter->NumberOfExecutions != expectedExecutions)
+  {
+    vtkLog(ERROR,
+      "Expected " << expectedExecutions << " executions, got "
+                  << polyDataFilter->NumberOfExecutions << ".");
+    retVal = EXIT_FAILURE;
+  }
+
+  // Partitioned datasets of a collection, the first and last ones sharing a
+  // partition.
+  const unsigned int numDataSets = 4;
+  vtkNew<vtkPartitionedDataSetCollection> collection;
+  collection->SetNumberOfPartitionedDataSets(numDataSets);
+  for (unsigned int i = 0; i < numDataSets; ++i)
+  {
+    collection->SetPartition(i, 0, MakePolyData(i + 1));
+    collection->SetPartition(i, 1, i == 0 || i == numDataSets - 1 ? shared : MakePolyData(2));
+  }
+
+  vtkNew<vtkTestConcurrentPartitionedFilter> partitionedFilter;
+  partitionedFilter->SetInputDataObject(collection);
+  partitionedFilter->Update();
+
+  auto outputCollection =
+    vtkPartitionedDataSetCollection::SafeDownCast(partitionedFilter->GetOutputDataObject(0));
+  if (!outputCollection || outputCollection->GetNumberOfPartitionedDataSets() != numDataSets)
+  {
+    vtkLog(ERROR, "Wrong partitioned dataset collection output structure.");
+    return EXIT_FAILURE;
+  }
+  for (unsigned int i = 0; i < numDataSets; ++i)
+  {
+    if (GetStoredNumberOfPoints(outputCollection->GetPartitionedDataSet(i)) !=
+      collection->GetPartitionedDataSet(i)->GetNumberOfPoints())
+    {
+      vtkLog(ERROR, "Wrong output for partitioned dataset " << i << ".");
+      retVal = EXIT_FAILURE;
+    }
+  }
+  if (partitionedFilter->NumberOfExecutions != static_cast<int>(numDataSets))
+  {
+    vtkLog(ERROR, "Expected one execution per partitioned dataset.");
+    retVal = EXIT_FAILURE;
+  }
+
+  return retVal;
+}
@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkAppendPolyData.h"
+#include "vtkConcurrentCompositeDataPipeline.h"
+#include "vtkConeSource.h"
+#include "vtkElevationFilter.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPolyData.h"
+#include "vtkSphereSource.h"
+
+int TestConcurrentCompositeDataPipeline(int, char*[])
+{
+  int retVal = EXIT_SUCCESS;
+
+  // Three independent sources.
+  vtkNew<vtkSphereSource> sphere1;
+  sphere1->SetThetaResolution(64);
+  sphere1->SetPhiResolution(64);
+  vtkNew<vtkSphereSource> sphere2;
+  sphere2->SetCenter(2.0, 0.0, 0.0);
+  vtkNew<vtkConeSource> cone;
+  cone->SetResolution(32);
+
+  vtkNew<vtkConcurrentCompositeDataPipeline> executive;
+  vtkNew<vtkAppendPolyData> append;
+  append->SetExecutive(executive);
+  append->AddInputConnection(sphere1->GetOutputPort());
+  append->AddInputConnection(sphere2->GetOutputPort());
+  append->AddInputConnection(cone->GetOutputPort());
+  append->Update();
+
+  vtkIdType expectedPoints = sphere1->GetOutput()->GetNumberOfPoints() +
+    sphere2->GetOutput()->GetNumberOfPoints() + cone->GetOutput()->GetNumberOfPoints();
+  if (executive->GetNumberOfIndependentBranches() != 3)
+  {
+    vtkLog(ERROR, "Expected 3 independent branches.");
+    retVal = EXIT_FAILURE;
+  }
+  if (append->GetOutput()->GetNumberOfPoints() != expectedPoints)
+  {
+    vtkLog(ERROR, "Wrong number of appended points.");
+    retVal = EXIT_FAILURE;
+  }
+
+  // Two branches sharing the same source must be grouped, the cone is still
+  // independent.
+  vtkNew<vtkElevationFilter> elevation1;
+  elevation1->SetInputConnection(sphere1->GetOutputPort());
+  vtkNew<vtkElevationFilter> elevation2;
+  elevation2->SetInputConnection(sphere1->GetOutputPort());
+  elevation2->SetLowPoint(0.0, 0.0, 1.0);
+  append->RemoveAllInputConnections(0);
+  append->AddInputConnection(elevation1->GetOutputPort());
+  append->AddInputConnection(cone->GetOutputPort());
+  append->AddInputConnection(elevation2->GetOutputPort());
+  append->Update();
+
+  expectedPoints =
+    2 * sphere1->GetOutput()->GetNumberOfPoints() + cone->GetOutput()->GetNumberOfPoints();
+  if (executive->GetNumberOfIndependentBranches() != 2)
+  {
+    vtkLog(ERROR, "Expected 2 independent branches.");
+    retVal = EXIT_FAILURE;
+  }
+  if (append->GetOutput()->GetNumberOfPoints() != expectedPoints)
+  {
+    vtkLog(ERROR, "Wrong number of appended points with a shared source.");
+    retVal = EXIT_FAILURE;
+  }
+
+  // Updating again must not execute anything and still succeed.
+  append->Modified();
+  append->Update();
+  if (append->GetOutput()->GetNumberOfPoints() != expectedPoints)
+  {
+    vtkLog(ERROR, "Wrong number of appended points after re-execution.");
+    retVal = EXIT_FAILURE;
+  }
+
+  return retVal;
+}
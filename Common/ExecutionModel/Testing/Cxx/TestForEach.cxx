@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
 // SPDX-License-Identifier: BSD-3-Clause
 
+#include <vtkAlgorithmOutput.h>
 #include <vtkContourFilter.h>
 #include <vtkEndFor.h>
 #include <vtkForEach.h>
@@ -126,6 +127,71 @@ bool TestComplexPipeline()
   return true;
 }
 
+bool TestConcurrentPipeline()
+{
+  vtkNew<vtkSpatioTemporalHarmonicsSource> source;
+
+  // Sequential reference
+  vtkNew<vtkForEach> forEach;
+  forEach->SetInputConnection(source->GetOutputPort());
+  vtkNew<vtkPlaneCutter> slice;
+  slice->SetInputConnection(forEach->GetOutputPort());
+  vtkNew<vtkContourFilter> contour;
+  contour->SetInputConnection(slice->GetOutputPort());
+  contour->SetNumberOfContours(1);
+  contour->SetValue(0, 1);
+  vtkNew<vtkEndFor> endFor;
+  endFor->SetInputConnection(contour->GetOutputPort());
+  endFor->Update();
+
+  // Same loop body built for each thread
+  vtkNew<vtkForEach> concurrentForEach;
+  concurrentForEach->SetInputConnection(source->GetOutputPort());
+  vtkNew<vtkEndFor> concurrentEndFor;
+  concurrentEndFor->SetInputConnection(concurrentForEach->GetOutputPort());
+  concurrentEndFor->SetBatchSize(6);
+  concurrentEndFor->SetSubPipelineBuilder(
+    [](vtkAlgorithmOutput* input) -> vtkSmartPointer<vtkAlgorithm> {
+      vtkNew<vtkPlaneCutter> threadSlice;
+      threadSlice->SetInputConnection(input);
+      auto threadContour = vtkSmartPointer<vtkContourFilter>::New();
+      threadContour->SetInputConnection(threadSlice->GetOutputPort());
+      threadContour->SetNumberOfContours(1);
+      threadContour->SetValue(0, 1);
+      return threadContour;
+    });
+  concurrentEndFor->Update();
+
+  auto reference = vtkPartitionedDataSetCollection::SafeDownCast(endFor->GetOutput());
+  auto pdsc = vtkPartitionedDataSetCollection::SafeDownCast(concurrentEndFor->GetOutput());
+  if (!reference || !pdsc)
+  {
+    std::cerr << "Output was not partitioned data set collection" << std::endl;
+    return false;
+  }
+
+  if (pdsc->GetNumberOfPartitionedDataSets() != ::NB_SOURCE_TIME_STEPS)
+  {
+    std::cerr << "Concurrent output did not have correct number of blocks" << std::endl;
+    return false;
+  }
+
+  // Results must be aggregated in iteration order
+  for (unsigned int i = 0; i < ::NB_SOURCE_TIME_STEPS; ++i)
+  {
+    vtkDataSet* expected = reference->GetPartition(i, 0);
+    vtkDataSet* part = pdsc->GetPartition(i, 0);
+    if (!expected || !part || expected->GetNumberOfPoints() != part->GetNumberOfPoints())
+    {
+      std::cerr << "Concurrent output differs from sequential output at iteration " << i
+                << std::endl;
+      return false;
+    }
+  }
+
+  return true;
+}
+
 }
 
 int TestForEach(int, char*[])
@@ -134,5 +200,6 @@ int TestForEach(int, char*[])
   res &= ::TestNoPipeline();
   res &= ::TestSimplePipeline();
   res &= ::TestComplexPipeline();
+  res &= ::TestConcurrentPipeline();
   return res ? EXIT_SUCCESS : EXIT_FAILURE;
 }
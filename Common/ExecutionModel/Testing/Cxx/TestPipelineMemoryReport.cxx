@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkDoubleArray.h"
+#include "vtkExecutive.h"
+#include "vtkIdTypeArray.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkLogger.h"
+#include "vtkMemoryTracker.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkStringArray.h"
+#include "vtkTable.h"
+#include "vtkUnsignedLongArray.h"
+
+namespace
+{
+const vtkIdType NumberOfPoints = 100000;
+}
+
+// Source producing NumberOfPoints points.
+class vtkTestMemorySource : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkTestMemorySource* New();
+  vtkTypeMacro(vtkTestMemorySource, vtkPolyDataAlgorithm);
+
+protected:
+  vtkTestMemorySource() { this->SetNumberOfInputPorts(0); }
+
+  int RequestData(
+    vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector) override
+  {
+    vtkPolyData* output = vtkPolyData::GetData(outputVector);
+    vtkNew<vtkPoints> points;
+    points->SetNumberOfPoints(NumberOfPoints);
+    for (vtkIdType i = 0; i < NumberOfPoints; ++i)
+    {
+      points->SetPoint(i, static_cast<double>(i), 0.0, 0.0);
+    }
+    output->SetPoints(points);
+    return 1;
+  }
+};
+vtkStandardNewMacro(vtkTestMemorySource);
+
+// Filter copying its input using a large temporary array.
+class vtkTestMemoryFilter : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkTestMemoryFilter* New();
+  vtkTypeMacro(vtkTestMemoryFilter, vtkPolyDataAlgorithm);
+
+protected:
+  int RequestData(vtkInformation*, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override
+  {
+    vtkPolyData* input = vtkPolyData::GetData(inputVector[0]);
+    vtkPolyData* output = vtkPolyData::GetData(outputVector);
+    vtkNew<vtkDoubleArray> temporary;
+    temporary->SetNumberOfValues(4 * NumberOfPoints);
+    temporary->FillValue(1.0);
+    output->DeepCopy(input);
+    return 1;
+  }
+};
+vtkStandardNewMacro(vtkTestMemoryFilter);
+
+int TestPipelineMemoryReport(int, char*[])
+{
+  bool success = true;
+  vtkExecutive::SetMemoryInstrumentation(true);
+  vtkExecutive::ResetMemoryReport();
+
+  vtkNew<vtkTestMemorySource> source;
+  source->ReleaseDataFlagOn();
+  vtkNew<vtkTestMemoryFilter> filter;
+  filter->SetInputConnection(source->GetOutputPort());
+  filter->Update();
+
+  if (source->GetOutput()->GetNumberOfPoints() != 0)
+  {
+    vtkLog(ERROR, "The output of the source was not released.");
+    success = false;
+  }
+  if (vtkMemoryTracker::GetPeakMemory() < 4 * NumberOfPoints * 8)
+  {
+    vtkLog(ERROR, "The temporary array was not tracked.");
+    success = false;
+  }
+
+  vtkNew<vtkTable> report;
+  vtkExecutive::GetMemoryReport(report);
+  vtkExecutive::PrintMemoryReport(cout);
+  if (report->GetNumberOfRows() != 2 || report->GetNumberOfColumns() != 5)
+  {
+    vtkLog(ERROR, "Expected a report with 2 rows and 5 columns.");
+    return EXIT_FAILURE;
+  }
+  auto algorithms = vtkStringArray::SafeDownCast(report->GetColumnByName("Algorithm"));
+  auto executions = vtkIdTypeArray::SafeDownCast(report->GetColumnByName("Executions"));
+  auto outputMemory = vtkUnsignedLongArray::SafeDownCast(report->GetColumnByName("OutputMemory"));
+  auto peakMemory = vtkUnsignedLongArray::SafeDownCast(report->GetColumnByName("PeakMemory"));
+  auto releasedMemory =
+    vtkUnsignedLongArray::SafeDownCast(report->GetColumnByName("ReleasedMemory"));
+  if (!algorithms || !executions || !outputMemory || !peakMemory || !releasedMemory)
+  {
+    vtkLog(ERROR, "Missing report columns.");
+    return EXIT_FAILURE;
+  }
+  if (algorithms->GetValue(0) != source->GetObjectDescription() ||
+    algorithms->GetValue(1) != filter->GetObjectDescription() || executions->GetValue(0) != 1 ||
+    executions->GetValue(1) != 1)
+  {
+    vtkLog(ERROR, "Expected one execution of the source, then of the filter.");
+    success = false;
+  }
+
+  // 100000 float points take 1172 KiB and the temporary array 3125 KiB.
+  const unsigned long pointsMemory = 3 * NumberOfPoints * 4 / 1024;
+  const unsigned long temporaryMemory = 4 * NumberOfPoints * 8 / 1024;
+  if (outputMemory->GetValue(0) < pointsMemory || outputMemory->GetValue(1) < pointsMemory)
+  {
+    vtkLog(ERROR, "Wrong output memory.");
+    success = false;
+  }
+  if (peakMemory->GetValue(0) < pointsMemory ||
+    peakMemory->GetValue(1) < pointsMemory + temporaryMemory)
+  {
+    vtkLog(ERROR, "Wrong peak memory.");
+    success = false;
+  }
+  if (releasedMemory->GetValue(0) != outputMemory->GetValue(0) ||
+    releasedMemory->GetValue(1) != 0)
+  {
+    vtkLog(ERROR, "Wrong released memory.");
+    success = false;
+  }
+
+  vtkExecutive::SetMemoryInstrumentation(false);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkCellArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkImageData.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSharedMemoryProducer.h"
+#include "vtkSharedMemoryPublisher.h"
+
+#include <chrono>
+#include <string>
+
+namespace
+{
+void MakeLine(vtkPolyData* polyData, vtkIdType numberOfPoints, float value)
+{
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkFloatArray> scalars;
+  scalars->SetName("Scalars");
+  vtkNew<vtkCellArray> lines;
+  lines->InsertNextCell(static_cast<int>(numberOfPoints));
+  for (vtkIdType i = 0; i < numberOfPoints; ++i)
+  {
+    points->InsertNextPoint(static_cast<double>(i), 0.0, 0.0);
+    scalars->InsertNextValue(value);
+    lines->InsertCellPoint(i);
+  }
+  polyData->SetPoints(points);
+  polyData->SetLines(lines);
+  polyData->GetPointData()->SetScalars(scalars);
+}
+
+bool CheckLine(vtkSharedMemoryProducer* producer, vtkIdType numberOfPoints, float value)
+{
+  vtkPolyData* output = vtkPolyData::SafeDownCast(producer->GetOutputDataObject(0));
+  if (!output || output->GetNumberOfPoints() != numberOfPoints ||
+    output->GetNumberOfLines() != 1 || !output->GetPointData()->GetScalars() ||
+    output->GetPointData()->GetScalars()->GetComponent(numberOfPoints - 1, 0) != value)
+  {
+    vtkLog(ERROR, "Wrong output for " << numberOfPoints << " points of value " << value << ".");
+    return false;
+  }
+  return true;
+}
+}
+
+int TestSharedMemoryProducer(int, char*[])
+{
+  bool success = true;
+  const std::string name = "/vtkTestSharedMemory" +
+    std::to_string(std::chrono::steady_clock::now().time_since_epoch().count() % 1000000);
+
+  vtkNew<vtkSharedMemoryPublisher> publisher;
+  publisher->SetSegmentName(name.c_str());
+  vtkNew<vtkSharedMemoryProducer> producer;
+  producer->SetSegmentName(name.c_str());
+  if (producer->CheckForUpdate())
+  {
+    vtkLog(ERROR, "Nothing was published yet.");
+    success = false;
+  }
+
+  vtkNew<vtkPolyData> line;
+  MakeLine(line, 10, 1.0f);
+  if (!publisher->Publish(line) || !producer->CheckForUpdate())
+  {
+    vtkLog(ERROR, "The first generation was not published.");
+    return EXIT_FAILURE;
+  }
+  producer->Update();
+  success &= CheckLine(producer, 10, 1.0f);
+  if (producer->GetGeneration() != 1 || producer->CheckForUpdate())
+  {
+    vtkLog(ERROR, "The first generation should be up to date.");
+    success = false;
+  }
+
+  // The output uses the values of the segment in place.
+  MakeLine(line, 10, 2.0f);
+  publisher->Publish(line);
+  success &= CheckLine(producer, 10, 2.0f);
+  if (!producer->CheckForUpdate())
+  {
+    vtkLog(ERROR, "The second generation was not detected.");
+    success = false;
+  }
+  producer->Update();
+  if (producer->GetGeneration() != 2)
+  {
+    vtkLog(ERROR, "Expected generation 2, got " << producer->GetGeneration() << ".");
+    success = false;
+  }
+
+  // A larger dataset replaces the segment.
+  MakeLine(line, 10000, 3.0f);
+  publisher->Publish(line);
+  if (!producer->CheckForUpdate())
+  {
+    vtkLog(ERROR, "The replaced segment was not detected.");
+    success = false;
+  }
+  producer->Update();
+  success &= CheckLine(producer, 10000, 3.0f);
+
+  // Image data keep their structure.
+  vtkNew<vtkImageData> image;
+  image->SetExtent(0, 3, 0, 4, 0, 5);
+  image->SetSpacing(0.5, 1.0, 2.0);
+  vtkNew<vtkDoubleArray> values;
+  values->SetName("Values");
+  values->SetNumberOfValues(image->GetNumberOfPoints());
+  values->Fill(4.0);
+  image->GetPointData()->AddArray(values);
+  publisher->Publish(image);
+  producer->CheckForUpdate();
+  producer->Update();
+  vtkImageData* outputImage = vtkImageData::SafeDownCast(producer->GetOutputDataObject(0));
+  int dimensions[3];
+  if (!outputImage || (outputImage->GetDimensions(dimensions), dimensions[2] != 6) ||
+    outputImage->GetSpacing()[2] != 2.0 || !outputImage->GetPointData()->GetArray("Values") ||
+    outputImage->GetPointData()->GetArray("Values")->GetComponent(119, 0) != 4.0)
+  {
+    vtkLog(ERROR, "Wrong image output.");
+    success = false;
+  }
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,165 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkTemporalCachePipeline.h"
+
+#include <atomic>
+
+namespace
+{
+const int NumberOfTimeSteps = 10;
+const vtkIdType PointsPerTimeStep = 1000;
+}
+
+// Source producing (step + 1) * PointsPerTimeStep points at time step `step`.
+class vtkTestTemporalSource : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkTestTemporalSource* New();
+  vtkTypeMacro(vtkTestTemporalSource, vtkPolyDataAlgorithm);
+
+  std::atomic<int> NumberOfExecutions{ 0 };
+
+protected:
+  vtkTestTemporalSource() { this->SetNumberOfInputPorts(0); }
+
+  int RequestInformation(vtkInformation*, vtkInformationVector**,
+    vtkInformationVector* outputVector) override
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    double steps[NumberOfTimeSteps];
+    for (int i = 0; i < NumberOfTimeSteps; ++i)
+    {
+      steps[i] = i;
+    }
+    double range[2] = { steps[0], steps[NumberOfTimeSteps - 1] };
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_STEPS(), steps, NumberOfTimeSteps);
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_RANGE(), range, 2);
+    return 1;
+  }
+
+  int RequestData(
+    vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector) override
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    vtkPolyData* output = vtkPolyData::GetData(outInfo);
+    double time = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
+    vtkIdType numPoints = (static_cast<vtkIdType>(time) + 1) * PointsPerTimeStep;
+    vtkNew<vtkPoints> points;
+    points->SetNumberOfPoints(numPoints);
+    for (vtkIdType i = 0; i < numPoints; ++i)
+    {
+      points->SetPoint(i, static_cast<double>(i), time, 0.0);
+    }
+    output->SetPoints(points);
+    output->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(), time);
+    ++this->NumberOfExecutions;
+    return 1;
+  }
+};
+vtkStandardNewMacro(vtkTestTemporalSource);
+
+namespace
+{
+bool CheckOutput(vtkTestTemporalSource* source, int step)
+{
+  vtkPolyData* output = source->GetOutput();
+  if (output->GetNumberOfPoints() != (step + 1) * PointsPerTimeStep ||
+    output->GetInformation()->Get(vtkDataObject::DATA_TIME_STEP()) != step)
+  {
+    vtkLog(ERROR, "Wrong output for time step " << step << ".");
+    return false;
+  }
+  return true;
+}
+
+bool CheckExecutions(vtkTestTemporalSource* source, int expected)
+{
+  if (source->NumberOfExecutions != expected)
+  {
+    vtkLog(ERROR,
+      "Expected " << expected << " executions, got " << source->NumberOfExecutions << ".");
+    return false;
+  }
+  return true;
+}
+}
+
+int TestTemporalCachePipeline(int, char*[])
+{
+  bool success = true;
+
+  vtkNew<vtkTestTemporalSource> source;
+  vtkNew<vtkTemporalCachePipeline> executive;
+  source->SetExecutive(executive);
+
+  // Going back to time steps already produced does not execute the source.
+  for (int step : { 0, 1, 2, 1, 0, 2 })
+  {
+    source->UpdateTimeStep(step);
+    success &= CheckOutput(source, step);
+  }
+  success &= CheckExecutions(source, 3);
+  if (executive->GetNumberOfCachedDataObjects() != 3)
+  {
+    vtkLog(ERROR, "Expected 3 cached data objects.");
+    success = false;
+  }
+
+  // Modifying the source invalidates the cache.
+  source->Modified();
+  source->UpdateTimeStep(1);
+  success &= CheckOutput(source, 1);
+  success &= CheckExecutions(source, 4);
+
+  // A small memory limit evicts the least recently used time steps.
+  executive->ClearCache();
+  source->UpdateTimeStep(0);
+  executive->SetMemoryLimit(5 * source->GetOutput()->GetActualMemorySize() / 2);
+  for (int step : { 1, 2, 3 })
+  {
+    source->UpdateTimeStep(step);
+  }
+  if (executive->GetCacheMemorySize() > executive->GetMemoryLimit())
+  {
+    vtkLog(ERROR, "The cache exceeds its memory limit.");
+    success = false;
+  }
+  int executions = source->NumberOfExecutions;
+  source->UpdateTimeStep(0);
+  success &= CheckOutput(source, 0);
+  success &= CheckExecutions(source, executions + 1);
+
+  // Adjacent time steps are prefetched in the background.
+  executive->SetMemoryLimit(1048576);
+  executive->ClearCache();
+  executive->SetPrefetchTimeSteps(1);
+  source->UpdateTimeStep(5);
+  executive->WaitForPrefetch();
+  executions = source->NumberOfExecutions;
+  success &= CheckOutput(source, 5);
+  for (int step : { 6, 4 })
+  {
+    source->UpdateTimeStep(step);
+    success &= CheckOutput(source, step);
+    executive->WaitForPrefetch();
+  }
+  // Time steps 4 and 6 were prefetched, 7 and 3 were prefetched on the way.
+  success &= CheckExecutions(source, executions + 2);
+  if (executive->GetNumberOfCachedDataObjects() != 5)
+  {
+    vtkLog(ERROR, "Expected time steps 3 to 7 to be cached.");
+    success = false;
+  }
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
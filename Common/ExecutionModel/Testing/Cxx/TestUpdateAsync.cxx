@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkElevationFilter.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkSphereSource.h"
+
+#include <atomic>
+#include <thread>
+
+int TestUpdateAsync(int, char*[])
+{
+  bool success = true;
+
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(64);
+  sphere->SetPhiResolution(64);
+  vtkNew<vtkElevationFilter> elevation;
+  elevation->SetInputConnection(sphere->GetOutputPort());
+
+  std::atomic<int> numberOfCallbacks{ 0 };
+  std::atomic<bool> calledFromWorker{ true };
+  const std::thread::id caller = std::this_thread::get_id();
+  auto callback = [&](vtkTypeBool result) {
+    if (!result || std::this_thread::get_id() == caller)
+    {
+      calledFromWorker = false;
+    }
+    ++numberOfCallbacks;
+  };
+
+  // Updates are queued and executed one after the other.
+  std::future<vtkTypeBool> first = elevation->UpdateAsync(0, callback);
+  std::future<vtkTypeBool> second = elevation->UpdateAsync(0, callback);
+  if (!first.get() || !second.get())
+  {
+    vtkLog(ERROR, "The asynchronous updates failed.");
+    success = false;
+  }
+  if (numberOfCallbacks != 2 || !calledFromWorker)
+  {
+    vtkLog(ERROR, "The callback was not called from the worker thread for each update.");
+    success = false;
+  }
+  const vtkIdType numPoints = 64 * 62 + 2;
+  if (elevation->GetOutput()->GetNumberOfPoints() != numPoints ||
+    !elevation->GetOutput()->GetPointData()->GetArray("Elevation"))
+  {
+    vtkLog(ERROR, "Wrong output after the asynchronous update.");
+    success = false;
+  }
+
+  // Modified pipelines execute again.
+  sphere->SetThetaResolution(32);
+  if (!elevation->UpdateAsync().get() ||
+    elevation->GetOutput()->GetNumberOfPoints() != 32 * 62 + 2)
+  {
+    vtkLog(ERROR, "Wrong output after modifying the pipeline.");
+    success = false;
+  }
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
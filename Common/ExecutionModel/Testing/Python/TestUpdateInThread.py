@@ -0,0 +1,55 @@
+""" Tests Update() from a second Python thread.
+Update() is run from a worker thread while the main thread keeps
+running Python code. Python observers of the algorithms are called
+from C++ during Update(), on the worker thread, and must be able to
+run whether or not the wrappers release the GIL around Update().
+"""
+import threading
+from vtkmodules.vtkCommonCore import vtkCommand
+from vtkmodules.vtkFiltersGeneral import vtkShrinkFilter
+from vtkmodules.vtkFiltersSources import vtkSphereSource
+from vtkmodules.test import Testing
+
+class TestUpdateInThread(Testing.vtkTest):
+    def test(self):
+        sphere = vtkSphereSource()
+        sphere.SetThetaResolution(400)
+        sphere.SetPhiResolution(400)
+
+        shrink = vtkShrinkFilter()
+        shrink.SetInputConnection(sphere.GetOutputPort())
+
+        events = []
+        def observer(caller, event):
+            events.append((caller.GetClassName(), event, threading.get_ident()))
+        for algorithm in (sphere, shrink):
+            algorithm.AddObserver(vtkCommand.StartEvent, observer)
+            algorithm.AddObserver(vtkCommand.EndEvent, observer)
+
+        errors = []
+        def update():
+            try:
+                shrink.Update()
+            except Exception as e:
+                errors.append(e)
+
+        worker = threading.Thread(target=update)
+        worker.start()
+        # keep the main thread busy with Python code while Update() runs
+        count = 0
+        while worker.is_alive() and count < 10000000:
+            count += 1
+        worker.join(60)
+        self.assertFalse(worker.is_alive(), "Update() did not return")
+        self.assertEqual(errors, [])
+
+        self.assertTrue(shrink.GetOutput().GetNumberOfCells() > 0)
+        self.assertEqual(len(events), 4)
+        for className, event, ident in events:
+            self.assertEqual(ident, worker.ident)
+        self.assertEqual([(c, e) for c, e, i in events],
+            [("vtkSphereSource", "StartEvent"), ("vtkSphereSource", "EndEvent"),
+             ("vtkShrinkFilter", "StartEvent"), ("vtkShrinkFilter", "EndEvent")])
+
+if __name__ == "__main__":
+    Testing.main([(TestUpdateInThread, 'test')])
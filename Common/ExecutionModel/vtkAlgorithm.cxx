@@ -33,7 +33,11 @@
 #include "vtkTable.h"
 #include "vtkTrivialProducer.h"
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <set>
+#include <thread>
 #include <vector>
 #include <vtksys/SystemTools.hxx>
 
@@ -66,6 +70,76 @@ public:
   std::vector<vtkSmartPointer<vtkAlgorithmOutput>> Outputs;
 };
 
+//------------------------------------------------------------------------------
+namespace
+{
+// Worker thread running the asynchronous updates of all the pipelines, one
+// after the other since executives are not thread-safe.
+class vtkAlgorithmUpdateQueue
+{
+public:
+  ~vtkAlgorithmUpdateQueue()
+  {
+    {
+      // Updates still pending at exit are abandoned.
+      std::lock_guard<std::mutex> lock(this->Mutex);
+      this->Tasks.clear();
+      this->Stop = true;
+    }
+    this->Condition.notify_all();
+    if (this->Worker.joinable())
+    {
+      this->Worker.join();
+    }
+  }
+
+  void Push(std::packaged_task<vtkTypeBool()> task)
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->Mutex);
+      if (!this->Worker.joinable())
+      {
+        this->Worker = std::thread(&vtkAlgorithmUpdateQueue::Run, this);
+      }
+      this->Tasks.push_back(std::move(task));
+    }
+    this->Condition.notify_one();
+  }
+
+private:
+  void Run()
+  {
+    while (true)
+    {
+      std::packaged_task<vtkTypeBool()> task;
+      {
+        std::unique_lock<std::mutex> lock(this->Mutex);
+        this->Condition.wait(lock, [this] { return this->Stop || !this->Tasks.empty(); });
+        if (this->Stop)
+        {
+          return;
+        }
+        task = std::move(this->Tasks.front());
+        this->Tasks.pop_front();
+      }
+      task();
+    }
+  }
+
+  std::mutex Mutex;
+  std::condition_variable Condition;
+  std::deque<std::packaged_task<vtkTypeBool()>> Tasks;
+  std::thread Worker;
+  bool Stop = false;
+};
+
+vtkAlgorithmUpdateQueue& GetUpdateQueue()
+{
+  static vtkAlgorithmUpdateQueue queue;
+  return queue;
+}
+}
+
 //------------------------------------------------------------------------------
 class vtkAlgorithmToExecutiveFriendship
 {
@@ -1523,6 +1597,33 @@ void vtkAlgorithm::Update(int port)
   this->GetExecutive()->Update(port);
 }
 
+//------------------------------------------------------------------------------
+std::future<vtkTypeBool> vtkAlgorithm::UpdateAsync(
+  int port, std::function<void(vtkTypeBool)> callback)
+{
+  // Create the executive on the calling thread and keep the pipeline alive
+  // until the update is complete.
+  vtkSmartPointer<vtkAlgorithm> self = this;
+  vtkSmartPointer<vtkExecutive> executive = this->GetExecutive();
+  std::packaged_task<vtkTypeBool()> task([self, executive, port, callback]() {
+    vtkTypeBool result = executive->Update(port);
+    if (callback)
+    {
+      callback(result);
+    }
+    return result;
+  });
+  std::future<vtkTypeBool> future = task.get_future();
+  GetUpdateQueue().Push(std::move(task));
+  return future;
+}
+
+//------------------------------------------------------------------------------
+std::future<vtkTypeBool> vtkAlgorithm::UpdateAsync()
+{
+  return this->UpdateAsync(this->GetNumberOfOutputPorts() ? 0 : -1);
+}
+
 //------------------------------------------------------------------------------
 vtkTypeBool vtkAlgorithm::Update(int port, vtkInformationVector* requests)
 {
@@ -23,6 +23,11 @@
 #include "vtkCommonExecutionModelModule.h" // For export macro
 #include "vtkObject.h"
 
+#ifndef __VTK_WRAP__
+#include <functional> // For std::function
+#include <future>     // For std::future
+#endif
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkAbstractArray;
 class vtkAlgorithmInternals;
@@ -242,6 +247,17 @@ public:
   vtkGetMacro(AbortOutput, bool);
   ///@}
 
+  /**
+   * Return true if the algorithm can execute the blocks of a composite input
+   * concurrently when vtkCompositeDataPipeline iterates over them, i.e. when
+   * the algorithm is not composite-aware. This requires all pipeline passes
+   * of the algorithm to be re-entrant: any state must be stored in the input
+   * and output information objects, which are unique to each thread. Blocks
+   * sharing data objects are always executed on the same thread, one after the
+   * other. Returns false by default.
+   */
+  virtual bool CanExecuteBlocksConcurrently() { return false; }
+
   ///@{
   /**
    * Specify the shift and scale values to use to apply to the progress amount
@@ -560,10 +576,33 @@ public:
   /**
    * Bring this algorithm's outputs up-to-date.
    */
-  virtual void Update(int port);
-  virtual void Update();
+  VTK_UNBLOCKTHREADS virtual void Update(int port);
+  VTK_UNBLOCKTHREADS virtual void Update();
   ///@}
 
+#ifndef __VTK_WRAP__
+  ///@{
+  /**
+   * Bring this algorithm's outputs up-to-date on a background thread and
+   * return immediately. The returned future holds the result of the update of
+   * the given port, or of the first output port by default. When given,
+   * @a callback is called with the same result on the background thread once
+   * the update is complete, e.g. to post a render to the event loop of an
+   * application.
+   *
+   * The pipeline executives are not thread-safe: all asynchronous updates are
+   * executed one after the other on a single worker thread, and the pipeline
+   * must not be modified nor updated from another thread until the update is
+   * complete. Observers of the algorithms of the pipeline are invoked from the
+   * worker thread. SetAbortExecuteAndUpdateTime() can be called from any
+   * thread to interrupt the update.
+   */
+  std::future<vtkTypeBool> UpdateAsync(
+    int port, std::function<void(vtkTypeBool)> callback = nullptr);
+  std::future<vtkTypeBool> UpdateAsync();
+  ///@}
+#endif
+
   /**
    * This method enables the passing of data requests to the algorithm
    * to be used during execution (in addition to bringing a particular
@@ -586,14 +625,14 @@ public:
    * Available requests include UPDATE_PIECE_NUMBER(), UPDATE_NUMBER_OF_PIECES()
    * UPDATE_EXTENT() etc etc.
    */
-  virtual vtkTypeBool Update(int port, vtkInformationVector* requests);
+  VTK_UNBLOCKTHREADS virtual vtkTypeBool Update(int port, vtkInformationVector* requests);
 
   /**
    * Convenience method to update an algorithm after passing requests
    * to its first output port. See documentation for
    * Update(int port, vtkInformationVector* requests) for details.
    */
-  virtual vtkTypeBool Update(vtkInformation* requests);
+  VTK_UNBLOCKTHREADS virtual vtkTypeBool Update(vtkInformation* requests);
 
   /**
    * Convenience method to update an algorithm after passing requests
@@ -601,7 +640,7 @@ public:
    * Update(int port, vtkInformationVector* requests) for details.
    * Supports piece and extent (optional) requests.
    */
-  virtual int UpdatePiece(
+  VTK_UNBLOCKTHREADS virtual int UpdatePiece(
     int piece, int numPieces, int ghostLevels, const int extents[6] = nullptr);
 
   /**
@@ -609,7 +648,7 @@ public:
    * to its first output port.
    * Supports extent request.
    */
-  virtual int UpdateExtent(const int extents[6]);
+  VTK_UNBLOCKTHREADS virtual int UpdateExtent(const int extents[6]);
 
   /**
    * Convenience method to update an algorithm after passing requests
@@ -617,13 +656,13 @@ public:
    * Update(int port, vtkInformationVector* requests) for details.
    * Supports time, piece (optional) and extent (optional) requests.
    */
-  virtual int UpdateTimeStep(double time, int piece = -1, int numPieces = 1, int ghostLevels = 0,
-    const int extents[6] = nullptr);
+  VTK_UNBLOCKTHREADS virtual int UpdateTimeStep(double time, int piece = -1, int numPieces = 1,
+    int ghostLevels = 0, const int extents[6] = nullptr);
 
   /**
    * Bring the algorithm's information up-to-date.
    */
-  virtual void UpdateInformation();
+  VTK_UNBLOCKTHREADS virtual void UpdateInformation();
 
   /**
    * Create output object(s).
@@ -638,7 +677,7 @@ public:
   /**
    * Bring this algorithm's outputs up-to-date.
    */
-  virtual void UpdateWholeExtent();
+  VTK_UNBLOCKTHREADS virtual void UpdateWholeExtent();
 
   /**
    * Convenience routine to convert from a linear ordering of input
@@ -20,15 +20,23 @@
 #include "vtkInformationStringKey.h"
 #include "vtkInformationVector.h"
 #include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPartitionedDataSetCollection.h"
 #include "vtkPolyData.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPProgressObserver.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStructuredGrid.h"
 #include "vtkTrivialProducer.h"
 #include "vtkUniformGrid.h"
 
+#include <numeric>
+#include <unordered_map>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkCompositeDataPipeline);
 
@@ -39,10 +47,142 @@ vtkInformationKeyMacro(vtkCompositeDataPipeline, DATA_COMPOSITE_INDICES, Integer
 vtkInformationKeyMacro(vtkCompositeDataPipeline, SUPPRESS_RESET_PI, Integer);
 vtkInformationKeyMacro(vtkCompositeDataPipeline, BLOCK_AMOUNT_OF_DETAIL, Double);
 
+//------------------------------------------------------------------------------
+namespace
+{
+vtkInformationVector** Clone(vtkInformationVector** src, int n)
+{
+  vtkInformationVector** dst = new vtkInformationVector*[n];
+  for (int i = 0; i < n; ++i)
+  {
+    dst[i] = vtkInformationVector::New();
+    dst[i]->Copy(src[i], 1);
+  }
+  return dst;
+}
+void DeleteAll(vtkInformationVector** dst, int n)
+{
+  for (int i = 0; i < n; ++i)
+  {
+    dst[i]->Delete();
+  }
+  delete[] dst;
+}
+
+// Find the representative of a group of blocks sharing data objects.
+vtkIdType FindGroup(std::vector<vtkIdType>& parents, vtkIdType i)
+{
+  while (parents[i] != i)
+  {
+    parents[i] = parents[parents[i]];
+    i = parents[i];
+  }
+  return i;
+}
+}
+
+//------------------------------------------------------------------------------
+// Execute groups of blocks concurrently. Each thread works on its own copy
+// of the information vectors and of the request.
+class vtkCompositeDataPipelineProcessBlock
+{
+public:
+  vtkCompositeDataPipelineProcessBlock(vtkCompositeDataPipeline* exec,
+    vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec, int compositePort,
+    int connection, vtkInformation* request, const std::vector<vtkDataObject*>& inObjs,
+    const std::vector<vtkIdType>& groupOffsets, const std::vector<vtkIdType>& groupBlocks,
+    std::vector<vtkDataObject*>& outObjs)
+    : Exec(exec)
+    , CompositePort(compositePort)
+    , Connection(connection)
+    , Request(request)
+    , InObjs(inObjs)
+    , GroupOffsets(groupOffsets)
+    , GroupBlocks(groupBlocks)
+    , OutObjs(outObjs.data())
+  {
+    this->InSize = this->Exec->GetNumberOfInputPorts();
+    this->InInfoPrototype = Clone(inInfoVec, this->InSize);
+    this->OutInfoPrototype = vtkInformationVector::New();
+    this->OutInfoPrototype->Copy(outInfoVec, 1);
+  }
+
+  ~vtkCompositeDataPipelineProcessBlock()
+  {
+    for (auto& inInfoVec : this->InInfoVecs)
+    {
+      DeleteAll(inInfoVec, this->InSize);
+    }
+    for (auto& outInfoVec : this->OutInfoVecs)
+    {
+      outInfoVec->Delete();
+    }
+    DeleteAll(this->InInfoPrototype, this->InSize);
+    this->OutInfoPrototype->Delete();
+  }
+
+  void Initialize()
+  {
+    this->InInfoVecs.Local() = Clone(this->InInfoPrototype, this->InSize);
+    vtkInformationVector*& outInfoVec = this->OutInfoVecs.Local();
+    outInfoVec = vtkInformationVector::New();
+    outInfoVec->Copy(this->OutInfoPrototype, 1);
+    this->Requests.Local()->Copy(this->Request, 1);
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    vtkInformationVector** inInfoVec = this->InInfoVecs.Local();
+    vtkInformationVector* outInfoVec = this->OutInfoVecs.Local();
+    vtkInformation* request = this->Requests.Local();
+    vtkInformation* inInfo = inInfoVec[this->CompositePort]->GetInformationObject(this->Connection);
+    const int numOutputs = outInfoVec->GetNumberOfInformationObjects();
+    vtkAlgorithm* algo = this->Exec->GetAlgorithm();
+
+    for (vtkIdType group = begin; group < end; ++group)
+    {
+      for (vtkIdType k = this->GroupOffsets[group]; k < this->GroupOffsets[group + 1]; ++k)
+      {
+        if (algo->GetAbortOutput())
+        {
+          return;
+        }
+        const vtkIdType i = this->GroupBlocks[k];
+        std::vector<vtkDataObject*> outObjList = this->Exec->ExecuteSimpleAlgorithmForBlock(
+          inInfoVec, outInfoVec, inInfo, request, this->InObjs[i]);
+        for (int j = 0; j < numOutputs && j < static_cast<int>(outObjList.size()); ++j)
+        {
+          this->OutObjs[i * numOutputs + j] = outObjList[j];
+        }
+      }
+    }
+  }
+
+  void Reduce() {}
+
+private:
+  vtkCompositeDataPipeline* Exec;
+  int InSize;
+  vtkInformationVector** InInfoPrototype;
+  vtkInformationVector* OutInfoPrototype;
+  int CompositePort;
+  int Connection;
+  vtkInformation* Request;
+  const std::vector<vtkDataObject*>& InObjs;
+  const std::vector<vtkIdType>& GroupOffsets;
+  const std::vector<vtkIdType>& GroupBlocks;
+  vtkDataObject** OutObjs;
+
+  vtkSMPThreadLocal<vtkInformationVector**> InInfoVecs;
+  vtkSMPThreadLocal<vtkInformationVector*> OutInfoVecs;
+  vtkSMPThreadLocalObject<vtkInformation> Requests;
+};
+
 //------------------------------------------------------------------------------
 vtkCompositeDataPipeline::vtkCompositeDataPipeline()
 {
   this->InLocalLoop = 0;
+  this->ExecutingBlocksConcurrently = false;
   this->InformationCache = vtkInformation::New();
 
   this->GenericRequest = vtkInformation::New();
@@ -258,6 +398,13 @@ void vtkCompositeDataPipeline::ExecuteEach(vtkCompositeDataIterator* iter,
   int connection, vtkInformation* request,
   std::vector<vtkSmartPointer<vtkCompositeDataSet>>& compositeOutputs)
 {
+  if (this->GetAlgorithm()->CanExecuteBlocksConcurrently())
+  {
+    this->ExecuteEachConcurrently(
+      iter, inInfoVec, outInfoVec, compositePort, connection, request, compositeOutputs);
+    return;
+  }
+
   vtkInformation* inInfo = inInfoVec[compositePort]->GetInformationObject(connection);
 
   vtkIdType num_blocks = 0;
@@ -307,6 +454,143 @@ void vtkCompositeDataPipeline::ExecuteEach(vtkCompositeDataIterator* iter,
   algo->SetProgressShiftScale(0.0, 1.0);
 }
 
+//------------------------------------------------------------------------------
+void vtkCompositeDataPipeline::ExecuteEachConcurrently(vtkCompositeDataIterator* iter,
+  vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec, int compositePort,
+  int connection, vtkInformation* request,
+  std::vector<vtkSmartPointer<vtkCompositeDataSet>>& compositeOutputs)
+{
+  // from input data objects  itr -> (inObjs, indices)
+  // inObjs are the non-null objects that we will loop over.
+  // indices map the input objects to inObjs
+  std::vector<vtkDataObject*> inObjs;
+  std::vector<vtkIdType> indices;
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    vtkDataObject* dobj = iter->GetCurrentDataObject();
+    if (dobj)
+    {
+      inObjs.push_back(dobj);
+      indices.push_back(static_cast<vtkIdType>(inObjs.size()) - 1);
+    }
+    else
+    {
+      indices.push_back(-1);
+    }
+  }
+  const vtkIdType numBlocks = static_cast<vtkIdType>(inObjs.size());
+
+  // Blocks depend on each other when they share a data object, either
+  // directly or through their leaves when the blocks are themselves composite
+  // (e.g. the partitioned datasets of a vtkPartitionedDataSetCollection).
+  // Reading the same data object from several threads is not safe since many
+  // datasets build caches lazily, so dependent blocks are grouped.
+  std::vector<vtkIdType> parents(numBlocks);
+  std::iota(parents.begin(), parents.end(), 0);
+  std::unordered_map<vtkDataObject*, vtkIdType> owners;
+  auto addDependency = [&](vtkDataObject* dobj, vtkIdType block)
+  {
+    auto result = owners.emplace(dobj, block);
+    if (!result.second)
+    {
+      parents[FindGroup(parents, block)] = FindGroup(parents, result.first->second);
+    }
+  };
+  for (vtkIdType i = 0; i < numBlocks; ++i)
+  {
+    addDependency(inObjs[i], i);
+    if (auto composite = vtkCompositeDataSet::SafeDownCast(inObjs[i]))
+    {
+      vtkSmartPointer<vtkCompositeDataIterator> leaves;
+      leaves.TakeReference(composite->NewIterator());
+      for (leaves->InitTraversal(); !leaves->IsDoneWithTraversal(); leaves->GoToNextItem())
+      {
+        addDependency(leaves->GetCurrentDataObject(), i);
+      }
+    }
+  }
+
+  // Store the blocks of each group contiguously, keeping the traversal order
+  // within a group.
+  std::vector<vtkIdType> groupIds(numBlocks, -1);
+  std::vector<vtkIdType> groupOffsets(1, 0);
+  for (vtkIdType i = 0; i < numBlocks; ++i)
+  {
+    vtkIdType& groupId = groupIds[FindGroup(parents, i)];
+    if (groupId < 0)
+    {
+      groupId = static_cast<vtkIdType>(groupOffsets.size()) - 1;
+      groupOffsets.push_back(0);
+    }
+    ++groupOffsets[groupId + 1];
+  }
+  std::partial_sum(groupOffsets.begin(), groupOffsets.end(), groupOffsets.begin());
+  const vtkIdType numGroups = static_cast<vtkIdType>(groupOffsets.size()) - 1;
+  std::vector<vtkIdType> groupBlocks(numBlocks);
+  std::vector<vtkIdType> insertAt(groupOffsets.begin(), groupOffsets.end() - 1);
+  for (vtkIdType i = 0; i < numBlocks; ++i)
+  {
+    groupBlocks[insertAt[groupIds[FindGroup(parents, i)]]++] = i;
+  }
+
+  // instantiate outObjs, the output objects that will be created from inObjs
+  const int numOutputs = outInfoVec->GetNumberOfInformationObjects();
+  std::vector<vtkDataObject*> outObjs(numBlocks * numOutputs, nullptr);
+
+  vtkCompositeDataPipelineProcessBlock processBlock(this, inInfoVec, outInfoVec, compositePort,
+    connection, request, inObjs, groupOffsets, groupBlocks, outObjs);
+
+  vtkSmartPointer<vtkProgressObserver> origPo(this->Algorithm->GetProgressObserver());
+  vtkNew<vtkSMPProgressObserver> po;
+  this->Algorithm->SetProgressObserver(po);
+  this->ExecutingBlocksConcurrently = true;
+  vtkSMPTools::For(0, numGroups, processBlock);
+  this->ExecutingBlocksConcurrently = false;
+  this->Algorithm->SetProgressObserver(origPo);
+
+  vtkIdType i = 0;
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem(), ++i)
+  {
+    const vtkIdType j = indices[i];
+    if (j < 0)
+    {
+      continue;
+    }
+    for (int port = 0; port < numOutputs; ++port)
+    {
+      if (vtkDataObject* outObj = outObjs[j * numOutputs + port])
+      {
+        if (compositeOutputs[port])
+        {
+          compositeOutputs[port]->SetDataSet(iter, outObj);
+        }
+        outObj->FastDelete();
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+int vtkCompositeDataPipeline::CallAlgorithm(vtkInformation* request, int direction,
+  vtkInformationVector** inInfo, vtkInformationVector* outInfo)
+{
+  if (!this->ExecutingBlocksConcurrently)
+  {
+    return this->Superclass::CallAlgorithm(request, direction, inInfo, outInfo);
+  }
+
+  // The InAlgorithm flag of the executive is shared by all threads, leave it
+  // alone while blocks are executed concurrently.
+  this->CopyDefaultInformation(request, direction, inInfo, outInfo);
+  int result = this->Algorithm->ProcessRequest(request, inInfo, outInfo);
+  if (!result)
+  {
+    vtkErrorMacro("Algorithm " << this->Algorithm->GetObjectDescription()
+                               << " returned failure for request: " << *request);
+  }
+  return result;
+}
+
 //------------------------------------------------------------------------------
 // Execute a simple (non-composite-aware) filter multiple times, once per
 // block. Collect the result in a composite dataset that is of the same
@@ -24,9 +24,12 @@
  * vtkCompositeDataPipeline is assigned to a simple filter,
  * it will invoke the  vtkStreamingDemandDrivenPipeline passes in a loop,
  * passing a different block each time and will collect the results in a
- * composite dataset.
+ * composite dataset. When the simple filter returns true from
+ * vtkAlgorithm::CanExecuteBlocksConcurrently(), the blocks are executed
+ * concurrently using vtkSMPTools. Blocks sharing data objects are executed
+ * on the same thread, one after the other.
  * @sa
- *  vtkCompositeDataSet
+ *  vtkCompositeDataSet vtkThreadedCompositeDataPipeline
  */
 
 #ifndef vtkCompositeDataPipeline_h
@@ -104,6 +107,13 @@ public:
    */
   static vtkInformationDoubleKey* BLOCK_AMOUNT_OF_DETAIL();
 
+  /**
+   * Overridden to allow the algorithm to be called from several threads
+   * while blocks are executed concurrently.
+   */
+  int CallAlgorithm(vtkInformation* request, int direction, vtkInformationVector** inInfo,
+    vtkInformationVector* outInfo) override;
+
 protected:
   vtkCompositeDataPipeline();
   ~vtkCompositeDataPipeline() override;
@@ -152,6 +162,21 @@ protected:
     vtkInformationVector* outInfoVec, vtkInformation* inInfo, vtkInformation* request,
     vtkDataObject* dobj);
 
+  /**
+   * Same as ExecuteEach() but execute the blocks concurrently using
+   * vtkSMPTools. Each thread works on its own copy of the information
+   * vectors and the request. Blocks that share data objects, either directly
+   * or through their partitions, are grouped and executed sequentially by
+   * the same thread.
+   */
+  void ExecuteEachConcurrently(vtkCompositeDataIterator* iter, vtkInformationVector** inInfoVec,
+    vtkInformationVector* outInfoVec, int compositePort, int connection, vtkInformation* request,
+    std::vector<vtkSmartPointer<vtkCompositeDataSet>>& compositeOutput);
+
+  // True while ExecuteEachConcurrently() is running the algorithm from
+  // several threads.
+  bool ExecutingBlocksConcurrently;
+
   bool ShouldIterateOverInput(vtkInformationVector** inInfoVec, int& compositePort);
 
   int InputTypeIsValid(int port, int index, vtkInformationVector** inInfoVec) override;
@@ -198,6 +223,7 @@ protected:
 private:
   vtkCompositeDataPipeline(const vtkCompositeDataPipeline&) = delete;
   void operator=(const vtkCompositeDataPipeline&) = delete;
+  friend class vtkCompositeDataPipelineProcessBlock;
 };
 
 VTK_ABI_NAMESPACE_END
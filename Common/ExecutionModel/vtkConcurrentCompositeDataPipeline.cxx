@@ -0,0 +1,165 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkConcurrentCompositeDataPipeline.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkAlgorithmOutput.h"
+#include "vtkInformation.h"
+#include "vtkInformationIntegerKey.h"
+#include "vtkInformationRequestKey.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <set>
+#include <vector>
+
+//------------------------------------------------------------------------------
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkConcurrentCompositeDataPipeline);
+
+//------------------------------------------------------------------------------
+namespace
+{
+// Collect the executive and all the executives upstream of it.
+void CollectUpstreamExecutives(vtkExecutive* executive, std::set<vtkExecutive*>& executives)
+{
+  if (!executives.insert(executive).second)
+  {
+    return;
+  }
+  for (int i = 0; i < executive->GetNumberOfInputPorts(); ++i)
+  {
+    for (int j = 0; j < executive->GetNumberOfInputConnections(i); ++j)
+    {
+      if (vtkExecutive* upstream = executive->GetInputExecutive(i, j))
+      {
+        CollectUpstreamExecutives(upstream, executives);
+      }
+    }
+  }
+}
+
+// A set of input connections whose upstream pipelines share executives.
+struct BranchGroup
+{
+  std::set<vtkExecutive*> Executives;
+  // The index, producer executive and producer output port of each connection.
+  struct Connection
+  {
+    int Index;
+    vtkExecutive* Producer;
+    int Port;
+  };
+  std::vector<Connection> Connections;
+
+  bool Intersects(const std::set<vtkExecutive*>& executives) const
+  {
+    return std::any_of(executives.begin(), executives.end(),
+      [this](vtkExecutive* e) { return this->Executives.count(e) != 0; });
+  }
+};
+}
+
+//------------------------------------------------------------------------------
+vtkConcurrentCompositeDataPipeline::vtkConcurrentCompositeDataPipeline() = default;
+
+//------------------------------------------------------------------------------
+vtkConcurrentCompositeDataPipeline::~vtkConcurrentCompositeDataPipeline() = default;
+
+//------------------------------------------------------------------------------
+void vtkConcurrentCompositeDataPipeline::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfIndependentBranches: " << this->NumberOfIndependentBranches << "\n";
+}
+
+//------------------------------------------------------------------------------
+int vtkConcurrentCompositeDataPipeline::ForwardUpstream(vtkInformation* request)
+{
+  if (this->SharedInputInformation || !request->Has(REQUEST_DATA()))
+  {
+    return this->Superclass::ForwardUpstream(request);
+  }
+
+  // Group the input connections whose upstream pipelines share an executive.
+  // Connections of a group keep their original order.
+  std::vector<BranchGroup> groups;
+  int index = 0;
+  for (int i = 0; i < this->GetNumberOfInputPorts(); ++i)
+  {
+    for (int j = 0; j < this->Algorithm->GetNumberOfInputConnections(i); ++j)
+    {
+      vtkExecutive* e = this->GetInputExecutive(i, j);
+      if (!e)
+      {
+        continue;
+      }
+      BranchGroup group;
+      CollectUpstreamExecutives(e, group.Executives);
+      group.Connections.push_back(
+        { index++, e, this->Algorithm->GetInputConnection(i, j)->GetIndex() });
+      for (auto it = groups.begin(); it != groups.end();)
+      {
+        if (it->Intersects(group.Executives))
+        {
+          group.Executives.insert(it->Executives.begin(), it->Executives.end());
+          group.Connections.insert(
+            group.Connections.end(), it->Connections.begin(), it->Connections.end());
+          it = groups.erase(it);
+        }
+        else
+        {
+          ++it;
+        }
+      }
+      std::sort(group.Connections.begin(), group.Connections.end(),
+        [](const BranchGroup::Connection& a, const BranchGroup::Connection& b)
+        { return a.Index < b.Index; });
+      groups.push_back(std::move(group));
+    }
+  }
+  this->NumberOfIndependentBranches = static_cast<int>(groups.size());
+
+  if (groups.size() < 2)
+  {
+    return this->Superclass::ForwardUpstream(request);
+  }
+
+  if (!this->Algorithm->ModifyRequest(request, BeforeForward))
+  {
+    return 0;
+  }
+
+  // Each group uses its own copy of the request since FROM_OUTPUT_PORT is
+  // modified while forwarding.
+  std::vector<int> results(groups.size(), 1);
+  vtkSMPTools::For(0, static_cast<vtkIdType>(groups.size()), 1,
+    [&groups, &results, request](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType g = begin; g < end; ++g)
+      {
+        vtkNew<vtkInformation> groupRequest;
+        groupRequest->Copy(request);
+        for (const auto& connection : groups[g].Connections)
+        {
+          vtkExecutive* e = connection.Producer;
+          groupRequest->Set(FROM_OUTPUT_PORT(), connection.Port);
+          if (!e->ProcessRequest(groupRequest, e->GetInputInformation(), e->GetOutputInformation()))
+          {
+            results[g] = 0;
+          }
+        }
+      }
+    });
+
+  if (!this->Algorithm->ModifyRequest(request, AfterForward))
+  {
+    return 0;
+  }
+
+  return std::all_of(results.begin(), results.end(), [](int result) { return result != 0; });
+}
+VTK_ABI_NAMESPACE_END
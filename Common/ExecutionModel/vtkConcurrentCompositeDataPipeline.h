@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkConcurrentCompositeDataPipeline
+ * @brief   Executive updating independent input branches concurrently
+ *
+ * vtkConcurrentCompositeDataPipeline is a vtkCompositeDataPipeline that
+ * forwards REQUEST_DATA to the input connections of its algorithm
+ * concurrently, using vtkSMPTools. The upstream pipeline of each input
+ * connection is traversed to find the executives it depends on. Connections
+ * sharing at least one upstream executive are grouped and updated one after
+ * the other in the same task, so that no executive, and hence none of its
+ * information objects, is ever accessed by two threads at the same time.
+ * Independent groups, such as several readers feeding a vtkAppendFilter,
+ * execute their RequestData() in parallel. Other requests are forwarded
+ * serially as in vtkCompositeDataPipeline.
+ *
+ * This executive is opt-in: set it on the algorithm that consumes the
+ * independent branches, e.g.
+ * `append->SetExecutive(vtkNew<vtkConcurrentCompositeDataPipeline>())`. The
+ * upstream algorithms keep their own executives.
+ *
+ * @warning
+ * The upstream algorithms of different groups execute on different threads.
+ * They must not share state outside of the pipeline (for example a common
+ * non thread-safe library handle), and observers of their events, such as
+ * progress, may be invoked concurrently. The Sequential SMP backend updates
+ * the groups serially.
+ *
+ * @sa
+ * vtkCompositeDataPipeline vtkThreadedCompositeDataPipeline vtkSMPTools
+ */
+
+#ifndef vtkConcurrentCompositeDataPipeline_h
+#define vtkConcurrentCompositeDataPipeline_h
+
+#include "vtkCommonExecutionModelModule.h" // For export macro
+#include "vtkCompositeDataPipeline.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKCOMMONEXECUTIONMODEL_EXPORT vtkConcurrentCompositeDataPipeline
+  : public vtkCompositeDataPipeline
+{
+public:
+  static vtkConcurrentCompositeDataPipeline* New();
+  vtkTypeMacro(vtkConcurrentCompositeDataPipeline, vtkCompositeDataPipeline);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Return the number of groups of independent input connections found the
+   * last time REQUEST_DATA was forwarded upstream. This is mostly useful for
+   * testing and debugging.
+   */
+  vtkGetMacro(NumberOfIndependentBranches, int);
+
+protected:
+  vtkConcurrentCompositeDataPipeline();
+  ~vtkConcurrentCompositeDataPipeline() override;
+
+  int ForwardUpstream(vtkInformation* request) override;
+  using Superclass::ForwardUpstream;
+
+  int NumberOfIndependentBranches = 0;
+
+private:
+  vtkConcurrentCompositeDataPipeline(const vtkConcurrentCompositeDataPipeline&) = delete;
+  void operator=(const vtkConcurrentCompositeDataPipeline&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
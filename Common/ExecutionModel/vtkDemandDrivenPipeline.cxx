@@ -20,8 +20,10 @@
 #include "vtkInformationUnsignedLongKey.h"
 #include "vtkInformationVector.h"
 #include "vtkLogger.h"
+#include "vtkMemoryTracker.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkTrivialProducer.h"
 
 #include <vector>
 
@@ -35,6 +37,8 @@ vtkInformationKeyMacro(vtkDemandDrivenPipeline, REQUEST_DATA_NOT_GENERATED, Requ
 vtkInformationKeyMacro(vtkDemandDrivenPipeline, REQUEST_DATA_OBJECT, Request);
 vtkInformationKeyMacro(vtkDemandDrivenPipeline, REQUEST_INFORMATION, Request);
 
+static vtkTypeBool vtkDemandDrivenPipelineAutomaticReleaseData = 0;
+
 //------------------------------------------------------------------------------
 vtkDemandDrivenPipeline::vtkDemandDrivenPipeline()
 {
@@ -66,6 +70,9 @@ void vtkDemandDrivenPipeline::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
   os << indent << "PipelineMTime: " << this->PipelineMTime << "\n";
+  os << indent << "Interactive: " << (this->Interactive ? "On" : "Off") << "\n";
+  os << indent << "AutomaticReleaseData: "
+     << (vtkDemandDrivenPipelineAutomaticReleaseData ? "On" : "Off") << "\n";
 }
 
 //------------------------------------------------------------------------------
@@ -246,7 +253,27 @@ vtkTypeBool vtkDemandDrivenPipeline::ProcessRequest(
 
       // Request data from the algorithm.
       vtkLogF(TRACE, "%s execute-data", vtkLogIdentifier(this->Algorithm));
-      result = this->ExecuteData(request, inInfoVec, outInfoVec);
+      const bool traced = vtkLogger::IsTracing();
+      if (traced)
+      {
+        vtkLogger::TraceBegin(vtkLogger::GetIdentifier(this->Algorithm).c_str());
+      }
+      if (vtkExecutive::GetMemoryInstrumentation())
+      {
+        vtkTypeInt64 previousPeak = vtkMemoryTracker::BeginPeakScope();
+        vtkTypeInt64 startMemory = vtkMemoryTracker::GetCurrentMemory();
+        result = this->ExecuteData(request, inInfoVec, outInfoVec);
+        vtkTypeInt64 peak = vtkMemoryTracker::EndPeakScope(previousPeak) - startMemory;
+        vtkExecutive::RecordExecutionMemory(this->Algorithm, peak, outInfoVec);
+      }
+      else
+      {
+        result = this->ExecuteData(request, inInfoVec, outInfoVec);
+      }
+      if (traced)
+      {
+        vtkLogger::TraceEnd();
+      }
 
       // Data are now up to date.
       this->DataTime.Modified();
@@ -564,8 +591,16 @@ void vtkDemandDrivenPipeline::ExecuteDataEnd(
     {
       vtkInformation* inInfo = inInfoVec[i]->GetInformationObject(j);
       vtkDataObject* dataObject = inInfo->Get(vtkDataObject::DATA_OBJECT());
-      if (dataObject && (vtkDataObject::GetGlobalReleaseDataFlag() || inInfo->Get(RELEASE_DATA())))
+      if (dataObject &&
+        (vtkDataObject::GetGlobalReleaseDataFlag() || inInfo->Get(RELEASE_DATA()) ||
+          this->CanReleaseInputData(inInfo, dataObject)))
       {
+        if (vtkExecutive::GetMemoryInstrumentation())
+        {
+          vtkExecutive* producer = vtkExecutive::PRODUCER()->GetExecutive(inInfo);
+          vtkExecutive::RecordReleasedMemory(
+            producer ? producer->GetAlgorithm() : nullptr, dataObject->GetActualMemorySize());
+        }
         dataObject->ReleaseData();
       }
     }
@@ -1012,9 +1047,9 @@ int vtkDemandDrivenPipeline ::NeedToExecuteData(
     }
 
     // If the output on the port making the request is out-of-date
-    // then we must execute.
+    // or has been released then we must execute.
     vtkDataObject* data = info->Get(vtkDataObject::DATA_OBJECT());
-    if (!data || this->PipelineMTime > data->GetUpdateTime())
+    if (!data || data->GetDataReleased() || this->PipelineMTime > data->GetUpdateTime())
     {
       return 1;
     }
@@ -1065,4 +1100,51 @@ vtkTypeBool vtkDemandDrivenPipeline::GetReleaseDataFlag(int port)
   }
   return info->Get(RELEASE_DATA());
 }
+
+//------------------------------------------------------------------------------
+void vtkDemandDrivenPipeline::SetAutomaticReleaseData(vtkTypeBool val)
+{
+  vtkDemandDrivenPipelineAutomaticReleaseData = val;
+}
+
+//------------------------------------------------------------------------------
+vtkTypeBool vtkDemandDrivenPipeline::GetAutomaticReleaseData()
+{
+  return vtkDemandDrivenPipelineAutomaticReleaseData;
+}
+
+//------------------------------------------------------------------------------
+bool vtkDemandDrivenPipeline::CanReleaseInputData(vtkInformation* inInfo, vtkDataObject* dataObject)
+{
+  if (!vtkDemandDrivenPipelineAutomaticReleaseData || this->Interactive ||
+    dataObject->GetDataReleased())
+  {
+    return false;
+  }
+
+  // Data set by the user cannot be produced again.
+  vtkExecutive* producer = vtkExecutive::PRODUCER()->GetExecutive(inInfo);
+  if (!producer || vtkTrivialProducer::SafeDownCast(producer->GetAlgorithm()))
+  {
+    return false;
+  }
+
+  // Every other consumer must have executed since the data was produced.
+  vtkExecutive** consumers = vtkExecutive::CONSUMERS()->GetExecutives(inInfo);
+  int numberOfConsumers = vtkExecutive::CONSUMERS()->Length(inInfo);
+  for (int i = 0; i < numberOfConsumers; ++i)
+  {
+    if (consumers[i] == this)
+    {
+      continue;
+    }
+    auto consumer = vtkDemandDrivenPipeline::SafeDownCast(consumers[i]);
+    if (!consumer || consumer->Interactive ||
+      consumer->DataTime.GetMTime() < dataObject->GetUpdateTime())
+    {
+      return false;
+    }
+  }
+  return true;
+}
 VTK_ABI_NAMESPACE_END
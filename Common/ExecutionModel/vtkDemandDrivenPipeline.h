@@ -7,6 +7,13 @@
  * vtkDemandDrivenPipeline is an executive that will execute an
  * algorithm only when its outputs are out-of-date with respect to its
  * inputs.
+ *
+ * When AutomaticReleaseData is on, the data produced by an algorithm is
+ * released as soon as all the algorithms consuming it have executed since it
+ * was produced, so that the intermediate outputs of a pipeline do not stay in
+ * memory after the update. Consumers marked Interactive, e.g. a filter whose
+ * parameters are changed repeatedly, keep their inputs alive so that their
+ * re-execution does not re-execute the whole upstream pipeline.
  */
 
 #ifndef vtkDemandDrivenPipeline_h
@@ -81,6 +88,33 @@ public:
    */
   virtual vtkTypeBool GetReleaseDataFlag(int port);
 
+  ///@{
+  /**
+   * Turn on/off the automatic release of the data consumed by all the
+   * pipelines. When on, an input is released at the end of the execution of
+   * its consumer if all the other consumers of the same output have executed
+   * since the data was produced and none of them is Interactive. The data of
+   * vtkTrivialProducer, i.e. set with SetInputData(), is never released this
+   * way. An algorithm consuming released data re-executes its producer, as
+   * with the release data flag. Off by default.
+   */
+  static void SetAutomaticReleaseData(vtkTypeBool val);
+  static vtkTypeBool GetAutomaticReleaseData();
+  static void AutomaticReleaseDataOn() { vtkDemandDrivenPipeline::SetAutomaticReleaseData(1); }
+  static void AutomaticReleaseDataOff() { vtkDemandDrivenPipeline::SetAutomaticReleaseData(0); }
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get whether the algorithm of this executive is an interactive
+   * consumer, whose inputs are never released by AutomaticReleaseData.
+   * Default is off.
+   */
+  vtkSetMacro(Interactive, vtkTypeBool);
+  vtkGetMacro(Interactive, vtkTypeBool);
+  vtkBooleanMacro(Interactive, vtkTypeBool);
+  ///@}
+
   /**
    * Bring the PipelineMTime up to date.
    */
@@ -190,6 +224,10 @@ protected:
   int InputIsOptional(int port);
   int InputIsRepeatable(int port);
 
+  // Decide whether AutomaticReleaseData releases an input at the end of the
+  // execution of the algorithm.
+  bool CanReleaseInputData(vtkInformation* inInfo, vtkDataObject* dataObject);
+
   // Decide whether the output data need to be generated.
   virtual int NeedToExecuteData(
     int outputPort, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec);
@@ -211,6 +249,8 @@ protected:
   vtkTimeStamp InformationTime;
   vtkTimeStamp DataTime;
 
+  vtkTypeBool Interactive = 0;
+
   friend class vtkCompositeDataPipeline;
 
   vtkInformation* InfoRequest;
@@ -4,6 +4,7 @@
 #include "vtkEndFor.h"
 
 #include "vtkAggregateToPartitionedDataSetCollection.h"
+#include "vtkAlgorithmOutput.h"
 #include "vtkCallbackCommand.h"
 #include "vtkExecutionAggregator.h"
 #include "vtkExecutive.h"
@@ -13,9 +14,16 @@
 #include "vtkInformationRequestKey.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkTrivialProducer.h"
 #include "vtkWeakPointer.h"
 
+#include <atomic>
+#include <mutex>
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 
 namespace
@@ -32,9 +40,20 @@ void AggregatorModifiedCallback(vtkObject*, unsigned long, void* clientdata, voi
 //------------------------------------------------------------------------------
 struct vtkEndFor::Internals
 {
+  // Copy of the sub-pipeline used by one thread.
+  struct SubPipeline
+  {
+    vtkSmartPointer<vtkTrivialProducer> Producer;
+    vtkSmartPointer<vtkAlgorithm> Output;
+  };
+
   Internals() = default;
   vtkSmartPointer<vtkExecutionAggregator> Aggregator;
   vtkWeakPointer<vtkForEach> ForEach;
+  SubPipelineBuilder Builder;
+  std::mutex BuilderMutex;
+  std::vector<vtkSmartPointer<vtkDataObject>> PendingInputs;
+  std::unique_ptr<vtkSMPThreadLocal<SubPipeline>> SubPipelines;
 };
 
 //------------------------------------------------------------------------------
@@ -64,6 +83,9 @@ void vtkEndFor::PrintSelf(std::ostream& os, vtkIndent indent)
   {
     os << indent.GetNextIndent() << "is empty" << std::endl;
   }
+  os << indent.GetNextIndent()
+     << "SubPipelineBuilder: " << (this->Internal->Builder ? "set" : "none") << std::endl;
+  os << indent.GetNextIndent() << "BatchSize: " << this->BatchSize << std::endl;
 }
 
 //------------------------------------------------------------------------------
@@ -83,6 +105,62 @@ void vtkEndFor::SetAggregator(vtkExecutionAggregator* aggregator)
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkEndFor::SetSubPipelineBuilder(SubPipelineBuilder builder)
+{
+  this->Internal->Builder = std::move(builder);
+  this->Internal->SubPipelines.reset();
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+bool vtkEndFor::ProcessPendingIterations()
+{
+  auto& internal = *this->Internal;
+  if (!internal.SubPipelines)
+  {
+    internal.SubPipelines.reset(new vtkSMPThreadLocal<Internals::SubPipeline>);
+  }
+
+  const vtkIdType numberOfInputs = static_cast<vtkIdType>(internal.PendingInputs.size());
+  std::vector<vtkSmartPointer<vtkDataObject>> results(internal.PendingInputs.size());
+  std::atomic<bool> success(true);
+  vtkSMPTools::For(0, numberOfInputs, 1, [&](vtkIdType begin, vtkIdType end) {
+    Internals::SubPipeline& subPipeline = internal.SubPipelines->Local();
+    if (!subPipeline.Producer)
+    {
+      std::lock_guard<std::mutex> lock(internal.BuilderMutex);
+      subPipeline.Producer = vtkSmartPointer<vtkTrivialProducer>::New();
+      subPipeline.Output = internal.Builder(subPipeline.Producer->GetOutputPort());
+    }
+    for (vtkIdType i = begin; i < end && success; ++i)
+    {
+      subPipeline.Producer->SetOutput(internal.PendingInputs[i]);
+      if (!subPipeline.Output || !subPipeline.Output->GetExecutive()->Update(0))
+      {
+        success = false;
+        return;
+      }
+      // The output is reused by the next iteration of this thread.
+      vtkDataObject* output = subPipeline.Output->GetOutputDataObject(0);
+      results[i] = vtkSmartPointer<vtkDataObject>::Take(output->NewInstance());
+      results[i]->ShallowCopy(output);
+    }
+  });
+  internal.PendingInputs.clear();
+
+  if (!success)
+  {
+    vtkErrorMacro("The execution of a sub-pipeline copy failed.");
+    return false;
+  }
+  for (const auto& result : results)
+  {
+    internal.Aggregator->Aggregate(result);
+  }
+  return true;
+}
+
 //------------------------------------------------------------------------------
 int vtkEndFor::RequestInformation(
   vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
@@ -184,10 +262,32 @@ int vtkEndFor::RequestData(
   }
   vtkDataObject* input = inInfo->Get(vtkDataObject::DATA_OBJECT());
 
-  this->Internal->Aggregator->Aggregate(input);
-
   using SDDP = vtkStreamingDemandDrivenPipeline;
-  if (this->Internal->ForEach->IsIterating())
+  const bool isIterating = this->Internal->ForEach->IsIterating();
+  if (this->Internal->Builder)
+  {
+    // The input is reused by the next iteration.
+    auto pendingInput = vtkSmartPointer<vtkDataObject>::Take(input->NewInstance());
+    pendingInput->ShallowCopy(input);
+    this->Internal->PendingInputs.emplace_back(pendingInput);
+
+    std::size_t batchSize = this->BatchSize > 0
+      ? static_cast<std::size_t>(this->BatchSize)
+      : static_cast<std::size_t>(2 * vtkSMPTools::GetEstimatedNumberOfThreads());
+    if ((!isIterating || this->Internal->PendingInputs.size() >= batchSize) &&
+      !this->ProcessPendingIterations())
+    {
+      request->Remove(SDDP::CONTINUE_EXECUTING());
+      this->Internal->Aggregator->Clear();
+      return 0;
+    }
+  }
+  else
+  {
+    this->Internal->Aggregator->Aggregate(input);
+  }
+
+  if (isIterating)
   {
     // We need to "touch" the top of the sub-pipeline we want
     // to loop.
@@ -228,6 +328,7 @@ int vtkEndFor::RequestData(
 
   // reclaim unused memory
   this->Internal->Aggregator->Clear();
+  this->Internal->SubPipelines.reset();
 
   return 1;
 }
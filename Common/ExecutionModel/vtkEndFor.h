@@ -12,6 +12,15 @@
  * The default aggregator is vtkAggregateToPartitionedDataSetCollection, which
  * build a vtkPartitionedDataSetCollection with each result in a separate partition.
  *
+ * When a sub-pipeline builder is set, the input of each iteration is also
+ * processed by a copy of the sub-pipeline it builds before being aggregated.
+ * The iterations are gathered in batches of BatchSize and the batches are
+ * processed concurrently with vtkSMPTools, each thread using its own copy of
+ * the sub-pipeline. Results are still aggregated in iteration order. Connect
+ * vtkEndFor directly to vtkForEach to have the whole loop body executed
+ * concurrently: only the production of the inputs by vtkForEach and upstream
+ * algorithms remains sequential.
+ *
  * > Largely inspired by the ttkForEach/ttkEndFor in the TTK project
  * > (https://github.com/topology-tool-kit/ttk/tree/dev)
  *
@@ -24,10 +33,18 @@
 #include "vtkCommonExecutionModelModule.h" // for export macro
 #include "vtkDataObjectAlgorithm.h"
 
+#include "vtkSmartPointer.h" // for smart pointer signature
+
 #include <memory> // for std::unique_ptr
 
+#ifndef __VTK_WRAP__
+#include <functional> // for std::function
+#endif
+
 VTK_ABI_NAMESPACE_BEGIN
 
+class vtkAlgorithm;
+class vtkAlgorithmOutput;
 class vtkExecutionAggregator;
 class VTKCOMMONEXECUTIONMODEL_EXPORT vtkEndFor : public vtkDataObjectAlgorithm
 {
@@ -41,6 +58,34 @@ public:
    */
   virtual void SetAggregator(vtkExecutionAggregator*);
 
+#ifndef __VTK_WRAP__
+  /**
+   * Function building a copy of the sub-pipeline connected to the given input
+   * and returning its last algorithm, whose first output is aggregated. It is
+   * called once per thread, never concurrently. The copies must not share
+   * algorithms nor any other state that is not thread-safe.
+   */
+  using SubPipelineBuilder = std::function<vtkSmartPointer<vtkAlgorithm>(vtkAlgorithmOutput*)>;
+
+  /**
+   * Set the function building the copies of the sub-pipeline executed
+   * concurrently. An empty function, the default, aggregates the inputs of
+   * the iterations directly.
+   */
+  void SetSubPipelineBuilder(SubPipelineBuilder builder);
+#endif
+
+  ///@{
+  /**
+   * Set/Get the number of iterations executed concurrently by the
+   * sub-pipeline copies. The inputs of a batch are kept in memory until the
+   * batch is processed. 0, the default, uses twice the estimated number of
+   * threads of vtkSMPTools.
+   */
+  vtkSetClampMacro(BatchSize, int, 0, VTK_INT_MAX);
+  vtkGetMacro(BatchSize, int);
+  ///@}
+
 protected:
   vtkEndFor();
   ~vtkEndFor() override;
@@ -49,10 +94,16 @@ protected:
   int RequestDataObject(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
 
+  int BatchSize = 0;
+
 private:
   vtkEndFor(const vtkEndFor&) = delete;
   void operator=(const vtkEndFor&) = delete;
 
+  // Execute the sub-pipeline copies on the pending inputs and aggregate the
+  // results in order.
+  bool ProcessPendingIterations();
+
   struct Internals;
   std::unique_ptr<Internals> Internal;
 };
@@ -6,6 +6,7 @@
 #include "vtkAlgorithmOutput.h"
 #include "vtkDataObject.h"
 #include "vtkGarbageCollector.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationExecutivePortKey.h"
 #include "vtkInformationExecutivePortVectorKey.h"
@@ -13,10 +14,20 @@
 #include "vtkInformationIterator.h"
 #include "vtkInformationKeyVectorKey.h"
 #include "vtkInformationVector.h"
+#include "vtkMemoryTracker.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkSmartPointer.h"
-
+#include "vtkStringArray.h"
+#include "vtkTable.h"
+#include "vtkUnsignedLongArray.h"
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
 #include <sstream>
+#include <string>
 #include <vector>
 
 #include "vtkCompositeDataPipeline.h"
@@ -784,4 +795,157 @@ bool vtkExecutive::CheckAbortedInput(vtkInformationVector** inInfoVec)
   }
   return false;
 }
+
+namespace
+{
+struct vtkExecutiveMemoryRecord
+{
+  std::string Algorithm;
+  vtkIdType Executions = 0;
+  unsigned long OutputMemory = 0;
+  unsigned long PeakMemory = 0;
+  unsigned long ReleasedMemory = 0;
+};
+
+struct vtkExecutiveMemoryReport
+{
+  std::atomic<bool> Enabled{ false };
+  std::mutex Mutex;
+  std::vector<vtkExecutiveMemoryRecord> Records;
+  std::map<std::string, std::size_t> Index;
+
+  // Must be called with the mutex locked.
+  vtkExecutiveMemoryRecord& GetRecord(vtkAlgorithm* algorithm)
+  {
+    std::string description = algorithm->GetObjectDescription();
+    auto inserted = this->Index.emplace(description, this->Records.size());
+    if (inserted.second)
+    {
+      this->Records.emplace_back();
+      this->Records.back().Algorithm = std::move(description);
+    }
+    return this->Records[inserted.first->second];
+  }
+};
+
+vtkExecutiveMemoryReport& GetExecutiveMemoryReport()
+{
+  static vtkExecutiveMemoryReport report;
+  return report;
+}
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutive::SetMemoryInstrumentation(bool enabled)
+{
+  GetExecutiveMemoryReport().Enabled = enabled;
+  vtkMemoryTracker::SetEnabled(enabled);
+}
+
+//------------------------------------------------------------------------------
+bool vtkExecutive::GetMemoryInstrumentation()
+{
+  return GetExecutiveMemoryReport().Enabled.load(std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutive::GetMemoryReport(vtkTable* report)
+{
+  if (!report)
+  {
+    return;
+  }
+  vtkNew<vtkStringArray> algorithms;
+  algorithms->SetName("Algorithm");
+  vtkNew<vtkIdTypeArray> executions;
+  executions->SetName("Executions");
+  vtkNew<vtkUnsignedLongArray> outputMemory;
+  outputMemory->SetName("OutputMemory");
+  vtkNew<vtkUnsignedLongArray> peakMemory;
+  peakMemory->SetName("PeakMemory");
+  vtkNew<vtkUnsignedLongArray> releasedMemory;
+  releasedMemory->SetName("ReleasedMemory");
+
+  vtkExecutiveMemoryReport& memoryReport = GetExecutiveMemoryReport();
+  {
+    std::lock_guard<std::mutex> lock(memoryReport.Mutex);
+    for (const auto& record : memoryReport.Records)
+    {
+      algorithms->InsertNextValue(record.Algorithm);
+      executions->InsertNextValue(record.Executions);
+      outputMemory->InsertNextValue(record.OutputMemory);
+      peakMemory->InsertNextValue(record.PeakMemory);
+      releasedMemory->InsertNextValue(record.ReleasedMemory);
+    }
+  }
+
+  report->Initialize();
+  report->AddColumn(algorithms);
+  report->AddColumn(executions);
+  report->AddColumn(outputMemory);
+  report->AddColumn(peakMemory);
+  report->AddColumn(releasedMemory);
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutive::PrintMemoryReport(ostream& os)
+{
+  vtkExecutiveMemoryReport& memoryReport = GetExecutiveMemoryReport();
+  std::lock_guard<std::mutex> lock(memoryReport.Mutex);
+  os << "Algorithm, Executions, OutputMemory (KiB), PeakMemory (KiB), ReleasedMemory (KiB)\n";
+  for (const auto& record : memoryReport.Records)
+  {
+    os << record.Algorithm << ", " << record.Executions << ", " << record.OutputMemory << ", "
+       << record.PeakMemory << ", " << record.ReleasedMemory << "\n";
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutive::ResetMemoryReport()
+{
+  vtkExecutiveMemoryReport& memoryReport = GetExecutiveMemoryReport();
+  std::lock_guard<std::mutex> lock(memoryReport.Mutex);
+  memoryReport.Records.clear();
+  memoryReport.Index.clear();
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutive::RecordExecutionMemory(
+  vtkAlgorithm* algorithm, vtkTypeInt64 peakMemory, vtkInformationVector* outInfoVec)
+{
+  if (!algorithm)
+  {
+    return;
+  }
+  unsigned long outputMemory = 0;
+  for (int i = 0; i < outInfoVec->GetNumberOfInformationObjects(); ++i)
+  {
+    vtkInformation* outInfo = outInfoVec->GetInformationObject(i);
+    if (vtkDataObject* output = outInfo->Get(vtkDataObject::DATA_OBJECT()))
+    {
+      outputMemory += output->GetActualMemorySize();
+    }
+  }
+  // Round the peak up as GetActualMemorySize() does.
+  unsigned long peak = peakMemory > 0 ? static_cast<unsigned long>((peakMemory + 1023) / 1024) : 0;
+
+  vtkExecutiveMemoryReport& memoryReport = GetExecutiveMemoryReport();
+  std::lock_guard<std::mutex> lock(memoryReport.Mutex);
+  vtkExecutiveMemoryRecord& record = memoryReport.GetRecord(algorithm);
+  ++record.Executions;
+  record.OutputMemory = outputMemory;
+  record.PeakMemory = std::max(record.PeakMemory, peak);
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutive::RecordReleasedMemory(vtkAlgorithm* algorithm, unsigned long releasedMemory)
+{
+  if (!algorithm)
+  {
+    return;
+  }
+  vtkExecutiveMemoryReport& memoryReport = GetExecutiveMemoryReport();
+  std::lock_guard<std::mutex> lock(memoryReport.Mutex);
+  memoryReport.GetRecord(algorithm).ReleasedMemory += releasedMemory;
+}
 VTK_ABI_NAMESPACE_END
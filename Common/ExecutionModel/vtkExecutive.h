@@ -31,6 +31,7 @@ class vtkInformationIntegerKey;
 class vtkInformationRequestKey;
 class vtkInformationKeyVectorKey;
 class vtkInformationVector;
+class vtkTable;
 
 class VTKCOMMONEXECUTIONMODEL_EXPORT vtkExecutive : public vtkObject
 {
@@ -215,6 +216,41 @@ public:
   virtual int CallAlgorithm(vtkInformation* request, int direction, vtkInformationVector** inInfo,
     vtkInformationVector* outInfo);
 
+  ///@{
+  /**
+   * Enable/disable the memory instrumentation of all the pipelines. When
+   * enabled, vtkMemoryTracker accounts for the arrays allocated and every
+   * execution of an algorithm records, in a process-wide report, the memory
+   * size of its outputs, the peak memory allocated while it executes and the
+   * memory released when its outputs are released by consumers with the
+   * release data flag. Disabled by default.
+   */
+  static void SetMemoryInstrumentation(bool enabled);
+  static bool GetMemoryInstrumentation();
+  ///@}
+
+  /**
+   * Fill @a report with one row per instrumented algorithm, in the order of
+   * their first execution. The columns are "Algorithm", the description of
+   * the algorithm, "Executions", "OutputMemory", the memory size of the
+   * outputs of the last execution, "PeakMemory", the largest increase of the
+   * tracked memory during an execution, and "ReleasedMemory", the total
+   * memory of the outputs released by consumers. Memory sizes are in
+   * kibibytes. The peak of an algorithm executing concurrently with other
+   * work includes the allocations of that work.
+   */
+  static void GetMemoryReport(vtkTable* report);
+
+  /**
+   * Print the memory report, see GetMemoryReport().
+   */
+  static void PrintMemoryReport(ostream& os);
+
+  /**
+   * Remove all the rows of the memory report.
+   */
+  static void ResetMemoryReport();
+
 protected:
   vtkExecutive();
   ~vtkExecutive() override;
@@ -240,6 +276,17 @@ protected:
    */
   bool CheckAbortedInput(vtkInformationVector** inInfoVec);
 
+  ///@{
+  /**
+   * Record an execution of @a algorithm, or the release of one of its
+   * outputs, in the memory report. @a peakMemory is in bytes and
+   * @a releasedMemory in kibibytes.
+   */
+  static void RecordExecutionMemory(
+    vtkAlgorithm* algorithm, vtkTypeInt64 peakMemory, vtkInformationVector* outInfoVec);
+  static void RecordReleasedMemory(vtkAlgorithm* algorithm, unsigned long releasedMemory);
+  ///@}
+
   virtual int ForwardDownstream(vtkInformation* request);
   virtual int ForwardUpstream(vtkInformation* request);
   virtual void CopyDefaultInformation(vtkInformation* request, int direction,
@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+/**
+ * Layout of the shared memory segments written by vtkSharedMemoryPublisher
+ * and read by vtkSharedMemoryProducer.
+ *
+ * A segment starts with a vtkSharedMemoryHeader followed by NumberOfEntries
+ * vtkSharedMemoryEntry, each describing an array whose values are stored at
+ * Offset bytes from the start of the segment. Generation is odd while the
+ * publisher writes the segment, readers check that it is even and unchanged
+ * around their reads. Retired is set when the publisher replaced the segment
+ * by a larger one with the same name.
+ */
+
+#ifndef vtkSharedMemoryLayout_h
+#define vtkSharedMemoryLayout_h
+
+#include "vtkType.h"
+
+#include <atomic>  // For std::atomic
+#include <cstddef> // For std::size_t
+
+VTK_ABI_NAMESPACE_BEGIN
+namespace vtkSharedMemoryLayout
+{
+// Version of the layout, changed whenever the structures below change.
+constexpr char Magic[8] = { 'v', 't', 'k', 'S', 'H', 'M', '0', '1' };
+
+// Alignment of the header, of the entries and of the array values.
+constexpr std::size_t Alignment = 64;
+
+constexpr std::size_t MaximumNameLength = 255;
+
+// What an entry holds. Cell entries of vtkPolyData use Index to tell the
+// vertices (0), lines (1), polygons (2) and strips (3) apart.
+enum Role : vtkTypeInt32
+{
+  Points = 0,
+  PointData,
+  CellData,
+  FieldData,
+  CellOffsets,
+  CellConnectivity,
+  CellTypes
+};
+
+struct Header
+{
+  char Magic[8];
+  std::atomic<vtkTypeUInt64> Generation;
+  std::atomic<vtkTypeUInt32> Retired;
+  vtkTypeInt32 DataObjectType;
+  vtkTypeUInt64 NumberOfEntries;
+  // Structure of vtkImageData and vtkStructuredGrid.
+  vtkTypeInt32 Extent[6];
+  double Origin[3];
+  double Spacing[3];
+};
+
+struct Entry
+{
+  char Name[MaximumNameLength + 1];
+  vtkTypeInt32 Role;
+  vtkTypeInt32 Index;
+  // Attribute type (vtkDataSetAttributes::AttributeTypes) of the array, or -1.
+  vtkTypeInt32 Attribute;
+  vtkTypeInt32 DataType;
+  vtkTypeInt32 NumberOfComponents;
+  vtkTypeInt64 NumberOfTuples;
+  vtkTypeUInt64 Offset;
+};
+
+inline std::size_t Align(std::size_t size)
+{
+  return (size + Alignment - 1) / Alignment * Alignment;
+}
+
+inline Entry* GetEntries(void* segment)
+{
+  return reinterpret_cast<Entry*>(static_cast<char*>(segment) + Align(sizeof(Header)));
+}
+
+// Offset of the first array values for a segment of numberOfEntries entries.
+inline std::size_t GetValuesOffset(std::size_t numberOfEntries)
+{
+  return Align(sizeof(Header)) + Align(numberOfEntries * sizeof(Entry));
+}
+}
+VTK_ABI_NAMESPACE_END
+
+#endif
+// VTK-HeaderTest-Exclude: vtkSharedMemoryLayout.h
@@ -0,0 +1,423 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkSharedMemoryProducer.h"
+
+#include "vtkAOSDataArrayTemplate.h"
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDataObjectTypes.h"
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSharedMemoryLayout.h"
+#include "vtkSharedMemorySegment.h"
+#include "vtkSmartPointer.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkStructuredGrid.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkSharedMemoryProducer);
+
+namespace
+{
+template <typename ValueType>
+void WrapValues(vtkDataArray* array, void* values, vtkIdType numberOfValues,
+  vtkSmartPointer<vtkSharedMemorySegment> segment)
+{
+  // vtkDataArray::CreateDataArray() creates a vtkAOSDataArrayTemplate for all
+  // the types handled by vtkTemplateMacro.
+  auto aos = static_cast<vtkAOSDataArrayTemplate<ValueType>*>(array);
+  // The deleter keeps the segment mapped as long as an array uses its values.
+  aos->SetArray(static_cast<ValueType*>(values), numberOfValues,
+    [segment](ValueType*) { static_cast<void>(segment); }, true);
+}
+
+bool IsStructured(int dataObjectType)
+{
+  return vtkDataObjectTypes::TypeIdIsA(dataObjectType, VTK_IMAGE_DATA) ||
+    vtkDataObjectTypes::TypeIdIsA(dataObjectType, VTK_STRUCTURED_GRID);
+}
+}
+
+class vtkSharedMemoryProducer::vtkInternals
+{
+public:
+  vtkSmartPointer<vtkSharedMemorySegment> Segment;
+  // Segment and generation of the last produced output.
+  vtkSmartPointer<vtkSharedMemorySegment> ProducedSegment;
+
+  // Consistent copy of the header and of the entries of the segment.
+  vtkTypeUInt64 Generation = 0;
+  int DataObjectType = -1;
+  int Extent[6] = { 0, -1, 0, -1, 0, -1 };
+  double Origin[3] = { 0.0, 0.0, 0.0 };
+  double Spacing[3] = { 1.0, 1.0, 1.0 };
+  std::vector<vtkSharedMemoryLayout::Entry> Entries;
+
+  vtkSharedMemoryLayout::Header* GetHeader()
+  {
+    return static_cast<vtkSharedMemoryLayout::Header*>(this->Segment->GetPointer());
+  }
+
+  // Map the segment, again if the publisher replaced it.
+  bool Open(const char* name)
+  {
+    if (this->Segment && this->GetHeader()->Retired.load(std::memory_order_acquire))
+    {
+      this->Segment = nullptr;
+    }
+    if (this->Segment)
+    {
+      return true;
+    }
+    if (!name)
+    {
+      return false;
+    }
+    vtkNew<vtkSharedMemorySegment> segment;
+    if (!segment->Open(name, true) ||
+      segment->GetSize() < vtkSharedMemoryLayout::GetValuesOffset(0) ||
+      !std::equal(vtkSharedMemoryLayout::Magic, vtkSharedMemoryLayout::Magic + 8,
+        static_cast<vtkSharedMemoryLayout::Header*>(segment->GetPointer())->Magic))
+    {
+      return false;
+    }
+    this->Segment = segment;
+    return true;
+  }
+
+  // Copy the header and the entries once the publisher is done writing them.
+  bool ReadSnapshot(const char* name, double timeout)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    while (this->Open(name))
+    {
+      vtkSharedMemoryLayout::Header* header = this->GetHeader();
+      const vtkTypeUInt64 generation = header->Generation.load(std::memory_order_acquire);
+      // Generation 0 means that nothing was published yet.
+      if (generation != 0 && generation % 2 == 0)
+      {
+        this->DataObjectType = header->DataObjectType;
+        std::copy(header->Extent, header->Extent + 6, this->Extent);
+        std::copy(header->Origin, header->Origin + 3, this->Origin);
+        std::copy(header->Spacing, header->Spacing + 3, this->Spacing);
+        const vtkTypeUInt64 numberOfEntries = header->NumberOfEntries;
+        const bool fits = numberOfEntries < this->Segment->GetSize() &&
+          vtkSharedMemoryLayout::GetValuesOffset(numberOfEntries) <= this->Segment->GetSize();
+        if (fits)
+        {
+          const vtkSharedMemoryLayout::Entry* entries =
+            vtkSharedMemoryLayout::GetEntries(this->Segment->GetPointer());
+          this->Entries.assign(entries, entries + numberOfEntries);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (header->Generation.load(std::memory_order_relaxed) == generation)
+        {
+          this->Generation = generation / 2;
+          return fits && this->CheckEntries();
+        }
+      }
+      std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      if (elapsed.count() > timeout)
+      {
+        return false;
+      }
+      std::this_thread::yield();
+    }
+    return false;
+  }
+
+  // Check that the values of the entries lie in the segment.
+  bool CheckEntries()
+  {
+    for (vtkSharedMemoryLayout::Entry& entry : this->Entries)
+    {
+      entry.Name[vtkSharedMemoryLayout::MaximumNameLength] = '\0';
+      const int typeSize = vtkAbstractArray::GetDataTypeSize(entry.DataType);
+      if (typeSize <= 0 || entry.NumberOfComponents <= 0 || entry.NumberOfTuples < 0 ||
+        entry.Offset > this->Segment->GetSize())
+      {
+        return false;
+      }
+      const vtkTypeUInt64 maximumValues = (this->Segment->GetSize() - entry.Offset) / typeSize;
+      if (static_cast<vtkTypeUInt64>(entry.NumberOfTuples) >
+        maximumValues / static_cast<vtkTypeUInt64>(entry.NumberOfComponents))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Create an array using the values of an entry in place.
+  vtkSmartPointer<vtkDataArray> WrapEntry(const vtkSharedMemoryLayout::Entry& entry)
+  {
+    vtkSmartPointer<vtkDataArray> array;
+    array.TakeReference(vtkDataArray::CreateDataArray(entry.DataType));
+    if (!array)
+    {
+      return nullptr;
+    }
+    array->SetName(entry.Name[0] ? entry.Name : nullptr);
+    array->SetNumberOfComponents(entry.NumberOfComponents);
+    const vtkIdType numberOfValues =
+      static_cast<vtkIdType>(entry.NumberOfTuples) * entry.NumberOfComponents;
+    if (numberOfValues == 0)
+    {
+      return array;
+    }
+    void* values = static_cast<char*>(this->Segment->GetPointer()) + entry.Offset;
+    switch (entry.DataType)
+    {
+      vtkTemplateMacro(WrapValues<VTK_TT>(array, values, numberOfValues, this->Segment));
+      default:
+        return nullptr;
+    }
+    return array;
+  }
+};
+
+//------------------------------------------------------------------------------
+vtkSharedMemoryProducer::vtkSharedMemoryProducer()
+  : Internals(new vtkInternals)
+{
+  this->SetNumberOfInputPorts(0);
+}
+
+//------------------------------------------------------------------------------
+vtkSharedMemoryProducer::~vtkSharedMemoryProducer()
+{
+  this->SetSegmentName(nullptr);
+}
+
+//------------------------------------------------------------------------------
+void vtkSharedMemoryProducer::SetSegmentName(const char* name)
+{
+  if (this->SegmentName && name && strcmp(this->SegmentName, name) == 0)
+  {
+    return;
+  }
+  if (!this->SegmentName && !name)
+  {
+    return;
+  }
+  delete[] this->SegmentName;
+  this->SegmentName = nullptr;
+  if (name)
+  {
+    this->SegmentName = new char[strlen(name) + 1];
+    strcpy(this->SegmentName, name);
+  }
+  this->Internals->Segment = nullptr;
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+bool vtkSharedMemoryProducer::CheckForUpdate()
+{
+  vtkInternals& internals = *this->Internals;
+  if (!internals.Open(this->SegmentName))
+  {
+    return false;
+  }
+  const vtkTypeUInt64 generation =
+    internals.GetHeader()->Generation.load(std::memory_order_acquire);
+  if (generation == 0 || generation % 2 != 0)
+  {
+    return false;
+  }
+  if (internals.Segment == internals.ProducedSegment && generation / 2 == this->Generation)
+  {
+    return false;
+  }
+  this->Modified();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+int vtkSharedMemoryProducer::FillOutputPortInformation(int, vtkInformation* info)
+{
+  info->Set(vtkDataObject::DATA_TYPE_NAME(), "vtkDataSet");
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkSharedMemoryProducer::RequestDataObject(
+  vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector)
+{
+  if (!this->Internals->ReadSnapshot(this->SegmentName, this->Timeout))
+  {
+    vtkErrorMacro("Cannot read the shared memory segment "
+      << (this->SegmentName ? this->SegmentName : "(none)"));
+    return 0;
+  }
+  return vtkDataObjectAlgorithm::SetOutputDataObject(
+           this->Internals->DataObjectType, outputVector->GetInformationObject(0), true)
+    ? 1
+    : 0;
+}
+
+//------------------------------------------------------------------------------
+int vtkSharedMemoryProducer::RequestInformation(
+  vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector)
+{
+  vtkInternals& internals = *this->Internals;
+  if (!internals.ReadSnapshot(this->SegmentName, this->Timeout))
+  {
+    vtkErrorMacro("Cannot read the shared memory segment "
+      << (this->SegmentName ? this->SegmentName : "(none)"));
+    return 0;
+  }
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  if (IsStructured(internals.DataObjectType))
+  {
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), internals.Extent, 6);
+  }
+  if (vtkDataObjectTypes::TypeIdIsA(internals.DataObjectType, VTK_IMAGE_DATA))
+  {
+    outInfo->Set(vtkDataObject::ORIGIN(), internals.Origin, 3);
+    outInfo->Set(vtkDataObject::SPACING(), internals.Spacing, 3);
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkSharedMemoryProducer::RequestData(
+  vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector)
+{
+  vtkInternals& internals = *this->Internals;
+  vtkDataSet* output = vtkDataSet::GetData(outputVector);
+  if (!output || !internals.ReadSnapshot(this->SegmentName, this->Timeout))
+  {
+    vtkErrorMacro("Cannot read the shared memory segment "
+      << (this->SegmentName ? this->SegmentName : "(none)"));
+    return 0;
+  }
+  if (output->GetDataObjectType() != internals.DataObjectType)
+  {
+    vtkErrorMacro("The type of the published dataset changed, update the pipeline again.");
+    return 0;
+  }
+
+  output->Initialize();
+  if (vtkImageData* image = vtkImageData::SafeDownCast(output))
+  {
+    image->SetExtent(internals.Extent);
+    image->SetOrigin(internals.Origin);
+    image->SetSpacing(internals.Spacing);
+  }
+  else if (vtkStructuredGrid* grid = vtkStructuredGrid::SafeDownCast(output))
+  {
+    grid->SetExtent(internals.Extent);
+  }
+
+  vtkSmartPointer<vtkDataArray> offsets[4];
+  vtkSmartPointer<vtkDataArray> connectivity[4];
+  vtkSmartPointer<vtkDataArray> cellTypes;
+  for (const vtkSharedMemoryLayout::Entry& entry : internals.Entries)
+  {
+    vtkSmartPointer<vtkDataArray> array = internals.WrapEntry(entry);
+    if (!array || entry.Index < 0 || entry.Index > 3)
+    {
+      vtkErrorMacro("Unsupported array " << entry.Name << " of type " << entry.DataType);
+      return 0;
+    }
+    switch (entry.Role)
+    {
+      case vtkSharedMemoryLayout::Points:
+        if (vtkPointSet* ps = vtkPointSet::SafeDownCast(output))
+        {
+          vtkNew<vtkPoints> points;
+          points->SetData(array);
+          ps->SetPoints(points);
+        }
+        break;
+      case vtkSharedMemoryLayout::PointData:
+      case vtkSharedMemoryLayout::CellData:
+      {
+        vtkDataSetAttributes* dsa = entry.Role == vtkSharedMemoryLayout::PointData
+          ? static_cast<vtkDataSetAttributes*>(output->GetPointData())
+          : static_cast<vtkDataSetAttributes*>(output->GetCellData());
+        if (entry.Attribute >= 0 && entry.Attribute < vtkDataSetAttributes::NUM_ATTRIBUTES)
+        {
+          dsa->SetAttribute(array, entry.Attribute);
+        }
+        else
+        {
+          dsa->AddArray(array);
+        }
+        break;
+      }
+      case vtkSharedMemoryLayout::FieldData:
+        output->GetFieldData()->AddArray(array);
+        break;
+      case vtkSharedMemoryLayout::CellOffsets:
+        offsets[entry.Index] = array;
+        break;
+      case vtkSharedMemoryLayout::CellConnectivity:
+        connectivity[entry.Index] = array;
+        break;
+      case vtkSharedMemoryLayout::CellTypes:
+        cellTypes = array;
+        break;
+      default:
+        vtkErrorMacro("Unsupported array " << entry.Name);
+        return 0;
+    }
+  }
+
+  vtkSmartPointer<vtkCellArray> cells[4];
+  for (int i = 0; i < 4; ++i)
+  {
+    if (offsets[i] && connectivity[i])
+    {
+      cells[i] = vtkSmartPointer<vtkCellArray>::New();
+      if (!cells[i]->SetData(offsets[i], connectivity[i]))
+      {
+        return 0;
+      }
+    }
+  }
+  if (vtkPolyData* polyData = vtkPolyData::SafeDownCast(output))
+  {
+    polyData->SetVerts(cells[0]);
+    polyData->SetLines(cells[1]);
+    polyData->SetPolys(cells[2]);
+    polyData->SetStrips(cells[3]);
+  }
+  else if (vtkUnstructuredGrid* grid = vtkUnstructuredGrid::SafeDownCast(output))
+  {
+    vtkUnsignedCharArray* types = vtkUnsignedCharArray::SafeDownCast(cellTypes);
+    if (cells[0] && types)
+    {
+      grid->SetCells(types, cells[0]);
+    }
+  }
+
+  internals.ProducedSegment = internals.Segment;
+  this->Generation = internals.Generation;
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkSharedMemoryProducer::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "SegmentName: " << (this->SegmentName ? this->SegmentName : "(none)") << "\n";
+  os << indent << "Timeout: " << this->Timeout << "\n";
+  os << indent << "Generation: " << this->Generation << "\n";
+}
+VTK_ABI_NAMESPACE_END
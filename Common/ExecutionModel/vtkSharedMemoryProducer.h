@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkSharedMemoryProducer
+ * @brief   Produce datasets published in shared memory by another process
+ *
+ * vtkSharedMemoryProducer is a source producing the dataset last published
+ * by a vtkSharedMemoryPublisher, usually living in another process such as a
+ * running simulation, in the shared memory segment named SegmentName. The
+ * arrays of the output use the values of the segment in place, no value is
+ * copied. The output is read-only: modifying it through WritePointer() or by
+ * resizing copies the values first, see vtkAOSDataArrayTemplate::SetArray().
+ *
+ * The producer does not watch the segment by itself: call CheckForUpdate(),
+ * e.g. from a timer, to mark the producer modified when a new generation was
+ * published, then update the pipeline.
+ *
+ * @code{cpp}
+ * vtkNew<vtkSharedMemoryProducer> producer;
+ * producer->SetSegmentName("/simulation");
+ * // ...
+ * if (producer->CheckForUpdate())
+ * {
+ *   renderWindow->Render();
+ * }
+ * @endcode
+ *
+ * @warning
+ * The values of the output change when the publisher publishes the next
+ * generation, see vtkSharedMemoryPublisher.
+ *
+ * @sa
+ * vtkSharedMemoryPublisher vtkSharedMemorySegment vtkTrivialProducer
+ */
+
+#ifndef vtkSharedMemoryProducer_h
+#define vtkSharedMemoryProducer_h
+
+#include "vtkCommonExecutionModelModule.h" // For export macro
+#include "vtkDataObjectAlgorithm.h"
+
+#include <memory> // For std::unique_ptr
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKCOMMONEXECUTIONMODEL_EXPORT vtkSharedMemoryProducer : public vtkDataObjectAlgorithm
+{
+public:
+  static vtkSharedMemoryProducer* New();
+  vtkTypeMacro(vtkSharedMemoryProducer, vtkDataObjectAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Set/Get the name of the shared memory segment to read, as given to
+   * vtkSharedMemoryPublisher::SetSegmentName().
+   */
+  virtual void SetSegmentName(const char* name);
+  vtkGetStringMacro(SegmentName);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the maximum time, in seconds, to wait for the publisher to finish
+   * writing the segment when the producer executes. Default is 10.
+   */
+  vtkSetClampMacro(Timeout, double, 0.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(Timeout, double);
+  ///@}
+
+  /**
+   * Check whether a generation newer than the one produced was published.
+   * If so, mark the producer modified and return true. Returns false when
+   * the segment does not exist or the publisher is writing it.
+   */
+  bool CheckForUpdate();
+
+  /**
+   * Return the generation of the last produced output, 0 before the first
+   * execution.
+   */
+  vtkGetMacro(Generation, vtkTypeUInt64);
+
+protected:
+  vtkSharedMemoryProducer();
+  ~vtkSharedMemoryProducer() override;
+
+  int FillOutputPortInformation(int port, vtkInformation* info) override;
+  int RequestDataObject(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+  int RequestInformation(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
+  char* SegmentName = nullptr;
+  double Timeout = 10.0;
+  vtkTypeUInt64 Generation = 0;
+
+private:
+  vtkSharedMemoryProducer(const vtkSharedMemoryProducer&) = delete;
+  void operator=(const vtkSharedMemoryProducer&) = delete;
+
+  class vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
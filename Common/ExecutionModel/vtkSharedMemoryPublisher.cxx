@@ -0,0 +1,286 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkSharedMemoryPublisher.h"
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDataArray.h"
+#include "vtkFieldData.h"
+#include "vtkIdTypeArray.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSharedMemoryLayout.h"
+#include "vtkSharedMemorySegment.h"
+#include "vtkStructuredGrid.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkSharedMemoryPublisher);
+
+namespace
+{
+struct ArrayToPublish
+{
+  vtkDataArray* Array;
+  vtkTypeInt32 Role;
+  vtkTypeInt32 Index;
+  vtkTypeInt32 Attribute;
+};
+
+std::size_t GetNumberOfBytes(vtkDataArray* array)
+{
+  return static_cast<std::size_t>(array->GetNumberOfValues()) *
+    static_cast<std::size_t>(array->GetDataTypeSize());
+}
+
+void AddAttributeArrays(vtkFieldData* fd, vtkTypeInt32 role, std::vector<ArrayToPublish>& arrays)
+{
+  vtkDataSetAttributes* dsa = vtkDataSetAttributes::SafeDownCast(fd);
+  for (int i = 0; i < fd->GetNumberOfArrays(); ++i)
+  {
+    // Arrays that are not vtkDataArray, e.g. string arrays, are not supported.
+    if (vtkDataArray* array = fd->GetArray(i))
+    {
+      vtkTypeInt32 attribute = dsa ? dsa->IsArrayAnAttribute(i) : -1;
+      arrays.push_back({ array, role, 0, attribute });
+    }
+  }
+}
+
+void AddCellArrays(vtkCellArray* cells, vtkTypeInt32 index, std::vector<ArrayToPublish>& arrays)
+{
+  if (cells && cells->GetNumberOfCells() > 0)
+  {
+    arrays.push_back({ cells->GetOffsetsArray(), vtkSharedMemoryLayout::CellOffsets, index, -1 });
+    arrays.push_back(
+      { cells->GetConnectivityArray(), vtkSharedMemoryLayout::CellConnectivity, index, -1 });
+  }
+}
+}
+
+//------------------------------------------------------------------------------
+vtkSharedMemoryPublisher::vtkSharedMemoryPublisher() = default;
+
+//------------------------------------------------------------------------------
+vtkSharedMemoryPublisher::~vtkSharedMemoryPublisher()
+{
+  this->Close();
+  this->SetSegmentName(nullptr);
+}
+
+//------------------------------------------------------------------------------
+void vtkSharedMemoryPublisher::SetSegmentName(const char* name)
+{
+  if (this->SegmentName && name && strcmp(this->SegmentName, name) == 0)
+  {
+    return;
+  }
+  if (!this->SegmentName && !name)
+  {
+    return;
+  }
+  this->Close();
+  delete[] this->SegmentName;
+  this->SegmentName = nullptr;
+  if (name)
+  {
+    this->SegmentName = new char[strlen(name) + 1];
+    strcpy(this->SegmentName, name);
+  }
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkSharedMemoryPublisher::Close()
+{
+  if (this->Segment)
+  {
+    // Tell the consumers still mapping the segment that it is gone.
+    auto header = static_cast<vtkSharedMemoryLayout::Header*>(this->Segment->GetPointer());
+    header->Retired.store(1, std::memory_order_release);
+    this->Segment = nullptr;
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkTypeUInt64 vtkSharedMemoryPublisher::GetGeneration()
+{
+  if (!this->Segment)
+  {
+    return 0;
+  }
+  auto header = static_cast<vtkSharedMemoryLayout::Header*>(this->Segment->GetPointer());
+  return header->Generation.load(std::memory_order_relaxed) / 2;
+}
+
+//------------------------------------------------------------------------------
+bool vtkSharedMemoryPublisher::Publish(vtkDataObject* data)
+{
+  if (!this->SegmentName || !*this->SegmentName)
+  {
+    vtkErrorMacro("No segment name set.");
+    return false;
+  }
+  vtkDataSet* ds = vtkDataSet::SafeDownCast(data);
+  if (!ds)
+  {
+    vtkErrorMacro("Cannot publish " << (data ? data->GetClassName() : "a nullptr data object"));
+    return false;
+  }
+
+  // Gather the arrays describing the dataset.
+  std::vector<ArrayToPublish> arrays;
+  int extent[6] = { 0, -1, 0, -1, 0, -1 };
+  double origin[3] = { 0.0, 0.0, 0.0 };
+  double spacing[3] = { 1.0, 1.0, 1.0 };
+  if (vtkImageData* image = vtkImageData::SafeDownCast(ds))
+  {
+    image->GetExtent(extent);
+    image->GetOrigin(origin);
+    image->GetSpacing(spacing);
+  }
+  else if (vtkPointSet* ps = vtkPointSet::SafeDownCast(ds))
+  {
+    if (ps->GetPoints())
+    {
+      arrays.push_back({ ps->GetPoints()->GetData(), vtkSharedMemoryLayout::Points, 0, -1 });
+    }
+    if (vtkStructuredGrid* sg = vtkStructuredGrid::SafeDownCast(ps))
+    {
+      sg->GetExtent(extent);
+    }
+    else if (vtkPolyData* pd = vtkPolyData::SafeDownCast(ps))
+    {
+      AddCellArrays(pd->GetVerts(), 0, arrays);
+      AddCellArrays(pd->GetLines(), 1, arrays);
+      AddCellArrays(pd->GetPolys(), 2, arrays);
+      AddCellArrays(pd->GetStrips(), 3, arrays);
+    }
+    else if (vtkUnstructuredGrid* ug = vtkUnstructuredGrid::SafeDownCast(ps))
+    {
+      if (ug->GetFaces() && ug->GetFaces()->GetNumberOfValues() > 0)
+      {
+        vtkErrorMacro("Cannot publish polyhedral cells.");
+        return false;
+      }
+      if (ug->GetNumberOfCells() > 0)
+      {
+        AddCellArrays(ug->GetCells(), 0, arrays);
+        arrays.push_back({ ug->GetCellTypesArray(), vtkSharedMemoryLayout::CellTypes, 0, -1 });
+      }
+    }
+    else
+    {
+      vtkErrorMacro("Cannot publish " << ds->GetClassName());
+      return false;
+    }
+  }
+  else
+  {
+    vtkErrorMacro("Cannot publish " << ds->GetClassName());
+    return false;
+  }
+  AddAttributeArrays(ds->GetPointData(), vtkSharedMemoryLayout::PointData, arrays);
+  AddAttributeArrays(ds->GetCellData(), vtkSharedMemoryLayout::CellData, arrays);
+  AddAttributeArrays(ds->GetFieldData(), vtkSharedMemoryLayout::FieldData, arrays);
+
+  std::size_t size = vtkSharedMemoryLayout::GetValuesOffset(arrays.size());
+  for (const ArrayToPublish& entry : arrays)
+  {
+    size += vtkSharedMemoryLayout::Align(GetNumberOfBytes(entry.Array));
+  }
+
+  // Replace the segment when the dataset does not fit in it, with some room
+  // to grow so that slowly growing datasets do not replace it every time.
+  if (!this->Segment || this->Segment->GetSize() < size)
+  {
+    this->Close();
+    vtkNew<vtkSharedMemorySegment> segment;
+    if (!segment->Create(this->SegmentName, size + size / 2))
+    {
+      vtkErrorMacro("Cannot create the shared memory segment " << this->SegmentName);
+      return false;
+    }
+    auto header = static_cast<vtkSharedMemoryLayout::Header*>(segment->GetPointer());
+    new (header) vtkSharedMemoryLayout::Header();
+    std::copy(vtkSharedMemoryLayout::Magic, vtkSharedMemoryLayout::Magic + 8, header->Magic);
+    header->Generation.store(0, std::memory_order_relaxed);
+    header->Retired.store(0, std::memory_order_relaxed);
+    this->Segment = segment;
+  }
+
+  char* base = static_cast<char*>(this->Segment->GetPointer());
+  auto header = reinterpret_cast<vtkSharedMemoryLayout::Header*>(base);
+  vtkSharedMemoryLayout::Entry* entries = vtkSharedMemoryLayout::GetEntries(base);
+
+  // An odd generation tells the consumers that the segment is being written.
+  const vtkTypeUInt64 generation = header->Generation.load(std::memory_order_relaxed);
+  header->Generation.store(generation + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  header->DataObjectType = ds->GetDataObjectType();
+  header->NumberOfEntries = static_cast<vtkTypeUInt64>(arrays.size());
+  std::copy(extent, extent + 6, header->Extent);
+  std::copy(origin, origin + 3, header->Origin);
+  std::copy(spacing, spacing + 3, header->Spacing);
+
+  std::size_t offset = vtkSharedMemoryLayout::GetValuesOffset(arrays.size());
+  for (std::size_t i = 0; i < arrays.size(); ++i)
+  {
+    vtkDataArray* array = arrays[i].Array;
+    vtkSharedMemoryLayout::Entry& entry = entries[i];
+    std::memset(entry.Name, 0, sizeof(entry.Name));
+    if (const char* name = array->GetName())
+    {
+      strncpy(entry.Name, name, vtkSharedMemoryLayout::MaximumNameLength);
+    }
+    entry.Role = arrays[i].Role;
+    entry.Index = arrays[i].Index;
+    entry.Attribute = arrays[i].Attribute;
+    entry.DataType = array->GetDataType();
+    entry.NumberOfComponents = array->GetNumberOfComponents();
+    entry.NumberOfTuples = static_cast<vtkTypeInt64>(array->GetNumberOfTuples());
+    entry.Offset = static_cast<vtkTypeUInt64>(offset);
+
+    const std::size_t numberOfBytes = GetNumberOfBytes(array);
+    if (numberOfBytes > 0)
+    {
+      if (array->HasStandardMemoryLayout())
+      {
+        std::memcpy(base + offset, array->GetVoidPointer(0), numberOfBytes);
+      }
+      else
+      {
+        // Other layouts, e.g. structure of arrays, are converted to the layout
+        // of vtkAOSDataArrayTemplate.
+        vtkSmartPointer<vtkDataArray> copy =
+          vtkSmartPointer<vtkDataArray>::Take(vtkDataArray::CreateDataArray(entry.DataType));
+        copy->DeepCopy(array);
+        std::memcpy(base + offset, copy->GetVoidPointer(0), numberOfBytes);
+      }
+    }
+    offset += vtkSharedMemoryLayout::Align(numberOfBytes);
+  }
+
+  header->Generation.store(generation + 2, std::memory_order_release);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkSharedMemoryPublisher::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "SegmentName: " << (this->SegmentName ? this->SegmentName : "(none)") << "\n";
+  os << indent << "Generation: " << this->GetGeneration() << "\n";
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkSharedMemoryPublisher
+ * @brief   Publish datasets in shared memory for other processes
+ *
+ * vtkSharedMemoryPublisher writes the structure and the arrays of a dataset
+ * in a named shared memory segment (see vtkSharedMemorySegment), to be used
+ * by vtkSharedMemoryProducer in other processes. A simulation typically
+ * calls Publish() after each time step, and a visualization process polls
+ * the segment through vtkSharedMemoryProducer::CheckForUpdate() and uses the
+ * values in place, without copying or serializing them.
+ *
+ * vtkImageData, vtkStructuredGrid, vtkPolyData and vtkUnstructuredGrid
+ * without polyhedral cells are supported, with their point, cell and field
+ * data arrays. Arrays that are not vtkDataArray are skipped and array names
+ * are truncated to 255 characters.
+ *
+ * Each call to Publish() increments the generation of the segment. The
+ * segment is recreated, larger, when the dataset does not fit in it anymore,
+ * and is removed when the publisher is closed or destroyed.
+ *
+ * @warning
+ * Publish() overwrites the values in place. Consumers reading the previous
+ * generation at the same time may see a mix of both generations: consumers
+ * should be done with their output before the next call to Publish(), which
+ * the simulation and the visualization process typically synchronize with
+ * their own means.
+ *
+ * @sa
+ * vtkSharedMemoryProducer vtkSharedMemorySegment
+ */
+
+#ifndef vtkSharedMemoryPublisher_h
+#define vtkSharedMemoryPublisher_h
+
+#include "vtkCommonExecutionModelModule.h" // For export macro
+#include "vtkObject.h"
+#include "vtkSmartPointer.h" // For vtkSmartPointer
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkDataObject;
+class vtkSharedMemorySegment;
+
+class VTKCOMMONEXECUTIONMODEL_EXPORT vtkSharedMemoryPublisher : public vtkObject
+{
+public:
+  static vtkSharedMemoryPublisher* New();
+  vtkTypeMacro(vtkSharedMemoryPublisher, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Set/Get the name of the shared memory segment, e.g. "/simulation". The
+   * segment published with the previous name, if any, is removed.
+   */
+  virtual void SetSegmentName(const char* name);
+  vtkGetStringMacro(SegmentName);
+  ///@}
+
+  /**
+   * Write @a data in the segment and increment its generation. Returns false
+   * when the dataset is not supported or the segment cannot be created.
+   */
+  bool Publish(vtkDataObject* data);
+
+  /**
+   * Return the number of successful calls to Publish() since the segment was
+   * created.
+   */
+  vtkTypeUInt64 GetGeneration();
+
+  /**
+   * Remove the segment. The next call to Publish() creates a new one.
+   */
+  void Close();
+
+protected:
+  vtkSharedMemoryPublisher();
+  ~vtkSharedMemoryPublisher() override;
+
+  char* SegmentName = nullptr;
+
+private:
+  vtkSharedMemoryPublisher(const vtkSharedMemoryPublisher&) = delete;
+  void operator=(const vtkSharedMemoryPublisher&) = delete;
+
+  vtkSmartPointer<vtkSharedMemorySegment> Segment;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
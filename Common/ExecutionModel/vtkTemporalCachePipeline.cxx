@@ -0,0 +1,472 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkTemporalCachePipeline.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkDataObject.h"
+#include "vtkGarbageCollector.h"
+#include "vtkInformation.h"
+#include "vtkInformationDoubleKey.h"
+#include "vtkInformationDoubleVectorKey.h"
+#include "vtkInformationIntegerKey.h"
+#include "vtkInformationIntegerVectorKey.h"
+#include "vtkInformationRequestKey.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkProgressObserver.h"
+#include "vtkSmartPointer.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <list>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+//------------------------------------------------------------------------------
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkTemporalCachePipeline);
+
+//------------------------------------------------------------------------------
+namespace
+{
+// What was requested to produce a cached data object.
+struct CacheKey
+{
+  bool HasTime = false;
+  double Time = 0.0;
+  int Piece = 0;
+  int NumberOfPieces = 1;
+  int GhostLevels = 0;
+  bool HasExtent = false;
+  std::array<int, 6> Extent = { { 0, -1, 0, -1, 0, -1 } };
+
+  bool operator<(const CacheKey& other) const
+  {
+    return std::tie(this->HasTime, this->Time, this->Piece, this->NumberOfPieces,
+             this->GhostLevels, this->HasExtent, this->Extent) <
+      std::tie(other.HasTime, other.Time, other.Piece, other.NumberOfPieces, other.GhostLevels,
+        other.HasExtent, other.Extent);
+  }
+};
+
+CacheKey MakeKey(vtkInformation* outInfo)
+{
+  CacheKey key;
+  if (outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP()))
+  {
+    key.HasTime = true;
+    key.Time = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
+  }
+  if (outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER()))
+  {
+    key.Piece = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER());
+  }
+  if (outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES()))
+  {
+    key.NumberOfPieces = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES());
+  }
+  if (outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_GHOST_LEVELS()))
+  {
+    key.GhostLevels =
+      outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_GHOST_LEVELS());
+  }
+  if (outInfo->Has(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT()))
+  {
+    key.HasExtent = true;
+    outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), key.Extent.data());
+  }
+  return key;
+}
+}
+
+//------------------------------------------------------------------------------
+class vtkTemporalCachePipeline::vtkInternals
+{
+public:
+  struct Entry
+  {
+    CacheKey Key;
+    vtkSmartPointer<vtkDataObject> Data;
+    // Pipeline MTime when the data was produced.
+    vtkMTimeType PipelineMTime;
+    unsigned long Size;
+  };
+
+  // Look for valid data produced for the given key and mark it as the most
+  // recently used.
+  vtkSmartPointer<vtkDataObject> Find(const CacheKey& key, vtkMTimeType pipelineMTime)
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    auto found = this->Lookup.find(key);
+    if (found == this->Lookup.end())
+    {
+      return nullptr;
+    }
+    if (found->second->PipelineMTime < pipelineMTime)
+    {
+      this->Erase(found->second);
+      return nullptr;
+    }
+    this->Entries.splice(this->Entries.begin(), this->Entries, found->second);
+    return found->second->Data;
+  }
+
+  bool Contains(const CacheKey& key, vtkMTimeType pipelineMTime)
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    auto found = this->Lookup.find(key);
+    return found != this->Lookup.end() && found->second->PipelineMTime >= pipelineMTime;
+  }
+
+  void Insert(const CacheKey& key, vtkDataObject* data, vtkMTimeType pipelineMTime,
+    unsigned long memoryLimit)
+  {
+    const unsigned long size = data->GetActualMemorySize();
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    auto found = this->Lookup.find(key);
+    if (found != this->Lookup.end())
+    {
+      this->Erase(found->second);
+    }
+    if (size > memoryLimit)
+    {
+      return;
+    }
+    this->Entries.push_front(Entry{ key, data, pipelineMTime, size });
+    this->Lookup[key] = this->Entries.begin();
+    this->MemorySize += size;
+    this->Evict(memoryLimit);
+  }
+
+  // Remove the least recently used entries until the cache fits the limit.
+  void Evict(unsigned long memoryLimit)
+  {
+    while (this->MemorySize > memoryLimit && !this->Entries.empty())
+    {
+      this->Erase(std::prev(this->Entries.end()));
+    }
+  }
+
+  void Erase(std::list<Entry>::iterator entry)
+  {
+    this->MemorySize -= entry->Size;
+    this->Lookup.erase(entry->Key);
+    this->Entries.erase(entry);
+  }
+
+  void Clear()
+  {
+    this->Entries.clear();
+    this->Lookup.clear();
+    this->MemorySize = 0;
+  }
+
+  // Entries ordered from the most to the least recently used.
+  std::list<Entry> Entries;
+  std::map<CacheKey, std::list<Entry>::iterator> Lookup;
+  unsigned long MemorySize = 0;
+  std::mutex Mutex;
+
+  std::thread Prefetcher;
+  std::atomic<bool> CancelPrefetch{ false };
+  vtkSmartPointer<vtkProgressObserver> AlgorithmProgressObserver;
+  bool ProgressObserverSwapped = false;
+};
+
+//------------------------------------------------------------------------------
+vtkTemporalCachePipeline::vtkTemporalCachePipeline()
+  : Internals(new vtkInternals)
+{
+}
+
+//------------------------------------------------------------------------------
+vtkTemporalCachePipeline::~vtkTemporalCachePipeline()
+{
+  this->StopPrefetch(true, false);
+}
+
+//------------------------------------------------------------------------------
+void vtkTemporalCachePipeline::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "MemoryLimit: " << this->MemoryLimit << "\n";
+  os << indent << "PrefetchTimeSteps: " << this->PrefetchTimeSteps << "\n";
+  os << indent << "NumberOfCachedDataObjects: " << this->GetNumberOfCachedDataObjects() << "\n";
+  os << indent << "CacheMemorySize: " << this->GetCacheMemorySize() << "\n";
+}
+
+//------------------------------------------------------------------------------
+void vtkTemporalCachePipeline::SetMemoryLimit(unsigned long limit)
+{
+  if (this->MemoryLimit == limit)
+  {
+    return;
+  }
+  this->MemoryLimit = limit;
+  std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+  this->Internals->Evict(limit);
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+int vtkTemporalCachePipeline::GetNumberOfCachedDataObjects()
+{
+  std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+  return static_cast<int>(this->Internals->Entries.size());
+}
+
+//------------------------------------------------------------------------------
+unsigned long vtkTemporalCachePipeline::GetCacheMemorySize()
+{
+  std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+  return this->Internals->MemorySize;
+}
+
+//------------------------------------------------------------------------------
+void vtkTemporalCachePipeline::ClearCache()
+{
+  this->StopPrefetch(true);
+  std::lock_guard<std::mutex> lock(this->Internals->Mutex);
+  this->Internals->Clear();
+}
+
+//------------------------------------------------------------------------------
+void vtkTemporalCachePipeline::WaitForPrefetch()
+{
+  this->StopPrefetch(false);
+}
+
+//------------------------------------------------------------------------------
+void vtkTemporalCachePipeline::ReportReferences(vtkGarbageCollector* collector)
+{
+  // The algorithm may be about to be collected: it must not be running in the
+  // background. Its progress observer is restored by the next request since
+  // references must not be modified while the collector is running.
+  this->StopPrefetch(true, false);
+  this->Superclass::ReportReferences(collector);
+}
+
+//------------------------------------------------------------------------------
+vtkTypeBool vtkTemporalCachePipeline::ProcessRequest(
+  vtkInformation* request, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec)
+{
+  if (this->Internals->ProgressObserverSwapped &&
+    this->NeedsAlgorithm(request, inInfoVec, outInfoVec))
+  {
+    this->StopPrefetch(true);
+  }
+
+  if (!this->Algorithm || !request->Has(REQUEST_DATA()) || !this->CanUseCache(outInfoVec))
+  {
+    return this->Superclass::ProcessRequest(request, inInfoVec, outInfoVec);
+  }
+
+  int outputPort = -1;
+  if (request->Has(FROM_OUTPUT_PORT()))
+  {
+    outputPort = request->Get(FROM_OUTPUT_PORT());
+  }
+  if (!this->NeedToExecuteData(outputPort, inInfoVec, outInfoVec))
+  {
+    return this->Superclass::ProcessRequest(request, inInfoVec, outInfoVec);
+  }
+
+  if (this->RestoreFromCache(request, inInfoVec, outInfoVec))
+  {
+    this->StartPrefetch(outInfoVec);
+    return 1;
+  }
+
+  vtkInformation* outInfo = outInfoVec->GetInformationObject(0);
+  const CacheKey key = MakeKey(outInfo);
+  const vtkMTimeType dataTime = this->DataTime.GetMTime();
+  vtkTypeBool result = this->Superclass::ProcessRequest(request, inInfoVec, outInfoVec);
+  vtkDataObject* output = outInfo->Get(vtkDataObject::DATA_OBJECT());
+  if (result && output && this->DataTime.GetMTime() != dataTime &&
+    !outInfo->Get(vtkAlgorithm::ABORTED()))
+  {
+    vtkSmartPointer<vtkDataObject> cached = vtk::TakeSmartPointer(output->NewInstance());
+    cached->ShallowCopy(output);
+    this->Internals->Insert(key, cached, this->GetPipelineMTime(), this->MemoryLimit);
+    this->StartPrefetch(outInfoVec);
+  }
+  return result;
+}
+
+//------------------------------------------------------------------------------
+bool vtkTemporalCachePipeline::CanUseCache(vtkInformationVector* outInfoVec)
+{
+  return this->MemoryLimit > 0 && !this->ContinueExecuting &&
+    this->Algorithm->GetNumberOfOutputPorts() == 1 &&
+    outInfoVec->GetNumberOfInformationObjects() == 1 &&
+    !outInfoVec->GetInformationObject(0)->Has(UPDATE_COMPOSITE_INDICES());
+}
+
+//------------------------------------------------------------------------------
+bool vtkTemporalCachePipeline::NeedsAlgorithm(
+  vtkInformation* request, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec)
+{
+  // These requests short circuit without calling the algorithm when it is up
+  // to date, see vtkDemandDrivenPipeline::ProcessRequest().
+  if (request->Has(REQUEST_DATA_OBJECT()))
+  {
+    return this->PipelineMTime >= this->DataObjectTime.GetMTime();
+  }
+  if (request->Has(REQUEST_INFORMATION()))
+  {
+    return this->PipelineMTime >= this->InformationTime.GetMTime();
+  }
+  if (request->Has(REQUEST_DATA()))
+  {
+    int outputPort = -1;
+    if (request->Has(FROM_OUTPUT_PORT()))
+    {
+      outputPort = request->Get(FROM_OUTPUT_PORT());
+    }
+    return this->NeedToExecuteData(outputPort, inInfoVec, outInfoVec) != 0;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkTemporalCachePipeline::RestoreFromCache(
+  vtkInformation* request, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec)
+{
+  vtkInformation* outInfo = outInfoVec->GetInformationObject(0);
+  vtkDataObject* output = outInfo->Get(vtkDataObject::DATA_OBJECT());
+  vtkSmartPointer<vtkDataObject> cached =
+    this->Internals->Find(MakeKey(outInfo), this->GetPipelineMTime());
+  if (!output || !cached || !output->IsA(cached->GetClassName()))
+  {
+    return false;
+  }
+
+  output->Initialize();
+  output->ShallowCopy(cached);
+  this->MarkOutputsGenerated(request, inInfoVec, outInfoVec);
+  if (outInfo->Has(COMBINED_UPDATE_EXTENT()))
+  {
+    static int emptyExt[6] = { 0, -1, 0, -1, 0, -1 };
+    outInfo->Set(COMBINED_UPDATE_EXTENT(), emptyExt, 6);
+  }
+
+  // The output is up to date, as if the algorithm executed.
+  this->DataTime.Modified();
+  this->InformationTime.Modified();
+  this->DataObjectTime.Modified();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkTemporalCachePipeline::StartPrefetch(vtkInformationVector* outInfoVec)
+{
+  vtkInformation* outInfo = outInfoVec->GetInformationObject(0);
+  if (this->PrefetchTimeSteps <= 0 || this->Algorithm->GetNumberOfInputPorts() > 0 ||
+    !outInfo->Has(TIME_STEPS()) || !outInfo->Has(UPDATE_TIME_STEP()))
+  {
+    return;
+  }
+  this->StopPrefetch(true);
+
+  // Find the index of the time step which was just produced.
+  const double* steps = outInfo->Get(TIME_STEPS());
+  const int numSteps = outInfo->Length(TIME_STEPS());
+  const double time = outInfo->Get(UPDATE_TIME_STEP());
+  const int current =
+    std::max(static_cast<int>(std::upper_bound(steps, steps + numSteps, time) - steps) - 1, 0);
+
+  // Next time steps first, since moving forward is the most common.
+  const vtkMTimeType pipelineMTime = this->GetPipelineMTime();
+  CacheKey key = MakeKey(outInfo);
+  std::vector<double> times;
+  for (int offset = 1; offset <= this->PrefetchTimeSteps; ++offset)
+  {
+    for (int step : { current + offset, current - offset })
+    {
+      key.Time = step >= 0 && step < numSteps ? steps[step] : 0.0;
+      if (step >= 0 && step < numSteps && !this->Internals->Contains(key, pipelineMTime))
+      {
+        times.push_back(steps[step]);
+      }
+    }
+  }
+  if (times.empty())
+  {
+    return;
+  }
+
+  // The prefetch works on private copies of the output information so that
+  // the pipeline is left untouched. Progress events are not reported from the
+  // background thread.
+  vtkSmartPointer<vtkInformationVector> prefetchInfo = vtkSmartPointer<vtkInformationVector>::New();
+  prefetchInfo->Copy(outInfoVec, 1);
+  vtkInformationVector** inInfoVec = this->GetInputInformation();
+  this->Internals->AlgorithmProgressObserver = this->Algorithm->GetProgressObserver();
+  vtkNew<vtkProgressObserver> silentObserver;
+  this->Algorithm->SetProgressObserver(silentObserver);
+  this->Internals->ProgressObserverSwapped = true;
+  this->Internals->CancelPrefetch = false;
+
+  vtkAlgorithm* algorithm = this->Algorithm;
+  vtkInternals* internals = this->Internals.get();
+  const unsigned long memoryLimit = this->MemoryLimit;
+  this->Internals->Prefetcher = std::thread(
+    [algorithm, internals, inInfoVec, prefetchInfo, times, pipelineMTime, memoryLimit]()
+    {
+      vtkInformation* info = prefetchInfo->GetInformationObject(0);
+      vtkDataObject* prototype = info->Get(vtkDataObject::DATA_OBJECT());
+      if (!prototype)
+      {
+        return;
+      }
+      vtkNew<vtkInformation> request;
+      request->Set(REQUEST_DATA());
+      request->Set(FROM_OUTPUT_PORT(), 0);
+      for (double time : times)
+      {
+        if (internals->CancelPrefetch)
+        {
+          return;
+        }
+        vtkSmartPointer<vtkDataObject> data = vtk::TakeSmartPointer(prototype->NewInstance());
+        info->Set(vtkDataObject::DATA_OBJECT(), data);
+        info->Set(UPDATE_TIME_STEP(), time);
+        if (!algorithm->ProcessRequest(request, inInfoVec, prefetchInfo) ||
+          algorithm->GetAbortOutput())
+        {
+          return;
+        }
+        if (!data->GetInformation()->Has(vtkDataObject::DATA_TIME_STEP()))
+        {
+          data->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(), time);
+        }
+        internals->Insert(MakeKey(info), data, pipelineMTime, memoryLimit);
+      }
+    });
+}
+
+//------------------------------------------------------------------------------
+void vtkTemporalCachePipeline::StopPrefetch(bool cancel, bool restoreProgressObserver)
+{
+  if (this->Internals->Prefetcher.joinable())
+  {
+    this->Internals->CancelPrefetch = cancel;
+    this->Internals->Prefetcher.join();
+  }
+  if (restoreProgressObserver && this->Internals->ProgressObserverSwapped)
+  {
+    if (this->Algorithm)
+    {
+      this->Algorithm->SetProgressObserver(this->Internals->AlgorithmProgressObserver);
+    }
+    this->Internals->AlgorithmProgressObserver = nullptr;
+    this->Internals->ProgressObserverSwapped = false;
+  }
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkTemporalCachePipeline
+ * @brief   Executive caching the outputs of its algorithm per time step
+ *
+ * vtkTemporalCachePipeline is a vtkCompositeDataPipeline that keeps the data
+ * produced by its algorithm in a least recently used cache. Entries are keyed
+ * on the requested time step, piece, number of pieces, ghost levels and
+ * update extent. When a request matches a cached entry the data is shallow
+ * copied to the output and neither the algorithm nor the upstream pipeline
+ * execute. This makes moving back and forth through time steps, or
+ * alternating between pieces, cheap once they have been produced. Entries are
+ * evicted, least recently used first, to keep the total memory size of the
+ * cache under MemoryLimit. The cache is invalidated whenever the pipeline is
+ * modified upstream.
+ *
+ * When PrefetchTimeSteps is larger than 0 and the algorithm is a source (it
+ * has no input port), producing a time step also starts a background thread
+ * producing the PrefetchTimeSteps time steps before and after it into the
+ * cache, so that stepping through time typically hits the cache. Any request
+ * needing the algorithm first interrupts the prefetch and waits for the time
+ * step being prefetched, if any, to complete.
+ *
+ * Only algorithms with a single output port are cached. Set this executive on
+ * the algorithm whose output is expensive to produce, e.g.
+ * `reader->SetExecutive(vtkNew<vtkTemporalCachePipeline>())`.
+ *
+ * @warning
+ * Cached entries share their arrays with the outputs they were copied from.
+ * Algorithms modifying the arrays of their previous output in place are not
+ * supported.
+ *
+ * @warning
+ * Prefetching calls RequestData() from a background thread with private
+ * copies of the output information. The algorithm must only use the
+ * information objects it is given, like algorithms used with
+ * vtkThreadedCompositeDataPipeline, and progress events are not reported
+ * while prefetching. The algorithm must not be modified while a prefetch is
+ * running: call WaitForPrefetch() first.
+ *
+ * @sa
+ * vtkCachedStreamingDemandDrivenPipeline vtkCompositeDataPipeline
+ */
+
+#ifndef vtkTemporalCachePipeline_h
+#define vtkTemporalCachePipeline_h
+
+#include "vtkCommonExecutionModelModule.h" // For export macro
+#include "vtkCompositeDataPipeline.h"
+
+#include <memory> // For std::unique_ptr
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKCOMMONEXECUTIONMODEL_EXPORT vtkTemporalCachePipeline : public vtkCompositeDataPipeline
+{
+public:
+  static vtkTemporalCachePipeline* New();
+  vtkTypeMacro(vtkTemporalCachePipeline, vtkCompositeDataPipeline);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  vtkTypeBool ProcessRequest(
+    vtkInformation* request, vtkInformationVector** inInfo, vtkInformationVector* outInfo) override;
+
+  ///@{
+  /**
+   * Set/Get the maximum memory size of the cached data, in kibibytes, as
+   * reported by vtkDataObject::GetActualMemorySize(). Data larger than the
+   * limit is not cached. Decreasing the limit evicts entries immediately.
+   * Default is 1048576 (1 GiB).
+   */
+  void SetMemoryLimit(unsigned long limit);
+  vtkGetMacro(MemoryLimit, unsigned long);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the number of time steps to prefetch on each side of the last
+   * produced time step. 0 disables prefetching. Default is 0.
+   */
+  vtkSetClampMacro(PrefetchTimeSteps, int, 0, VTK_INT_MAX);
+  vtkGetMacro(PrefetchTimeSteps, int);
+  ///@}
+
+  /**
+   * Return the number of data objects currently cached.
+   */
+  int GetNumberOfCachedDataObjects();
+
+  /**
+   * Return the memory size of the cached data, in kibibytes.
+   */
+  unsigned long GetCacheMemorySize();
+
+  /**
+   * Remove all the cached data. A running prefetch is interrupted first.
+   */
+  void ClearCache();
+
+  /**
+   * Wait until the running prefetch, if any, has produced all its time steps.
+   */
+  void WaitForPrefetch();
+
+protected:
+  vtkTemporalCachePipeline();
+  ~vtkTemporalCachePipeline() override;
+
+  void ReportReferences(vtkGarbageCollector*) override;
+
+  unsigned long MemoryLimit = 1048576;
+  int PrefetchTimeSteps = 0;
+
+private:
+  vtkTemporalCachePipeline(const vtkTemporalCachePipeline&) = delete;
+  void operator=(const vtkTemporalCachePipeline&) = delete;
+
+  bool CanUseCache(vtkInformationVector* outInfoVec);
+  bool NeedsAlgorithm(
+    vtkInformation* request, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec);
+  bool RestoreFromCache(
+    vtkInformation* request, vtkInformationVector** inInfoVec, vtkInformationVector* outInfoVec);
+  void StartPrefetch(vtkInformationVector* outInfoVec);
+  void StopPrefetch(bool cancel, bool restoreProgressObserver = true);
+
+  class vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -10,7 +10,8 @@
  * using vtkSMPTools::For. Note that this requires that the
  * algorithm implement all pipeline passes in a re-entrant way. It should
  * store/retrieve all state changes using input and output information
- * objects, which are unique to each thread.
+ * objects, which are unique to each thread. Blocks sharing data objects
+ * are executed on the same thread, one after the other.
  */
 
 #ifndef vtkThreadedCompositeDataPipeline_h
@@ -48,7 +49,6 @@ protected:
 private:
   vtkThreadedCompositeDataPipeline(const vtkThreadedCompositeDataPipeline&) = delete;
   void operator=(const vtkThreadedCompositeDataPipeline&) = delete;
-  friend class ProcessBlock;
 };
 
 VTK_ABI_NAMESPACE_END
@@ -8,6 +8,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <memory>
 #include <numeric>
 
@@ -70,6 +71,7 @@ static int Test_fft_cplx();
 static int Test_fft_direct();
 static int Test_fft_inverse();
 static int Test_fft_inverse_cplx();
+static int Test_fft_batch();
 static int Test_complex_module();
 static int Test_fftfreq();
 static int Test_rfftfreq();
@@ -87,6 +89,7 @@ int UnitTestFFT(int, char*[])
   status += Test_fft_direct();
   status += Test_fft_inverse();
   status += Test_fft_inverse_cplx();
+  status += Test_fft_batch();
   status += Test_complex_module();
   status += Test_fftfreq();
   status += Test_rfftfreq();
@@ -371,6 +374,44 @@ int Test_fft_inverse_cplx()
   return status;
 }
 
+int Test_fft_batch()
+{
+  std::cout << "Test_fft_batch..";
+
+  auto comparator = [](vtkFFT::ComplexNumber l, vtkFFT::ComplexNumber r) {
+    return FuzzyCompare(l, r, 1e-12);
+  };
+  int status = 0;
+
+  // batches of signals of sizes with small and large prime factors
+  static constexpr std::size_t count = 5;
+  for (std::size_t size : { 1, 12, 17, 30 })
+  {
+    std::vector<vtkFFT::ComplexNumber> signals(size * count);
+    for (std::size_t i = 0; i < signals.size(); ++i)
+    {
+      signals[i] = vtkFFT::ComplexNumber{ std::sin(0.3 * i), std::cos(0.7 * i) };
+    }
+    std::vector<vtkFFT::ComplexNumber> batch(size * count);
+    std::vector<vtkFFT::ComplexNumber> inverseBatch(size * count);
+    vtkFFT::BatchFft(signals.data(), size, count, batch.data());
+    vtkFFT::BatchIFft(batch.data(), size, count, inverseBatch.data());
+    for (std::size_t n = 0; n < count; ++n)
+    {
+      std::vector<vtkFFT::ComplexNumber> signal(
+        signals.begin() + n * size, signals.begin() + (n + 1) * size);
+      auto expected = size > 1 ? vtkFFT::Fft(signal) : signal;
+      status += static_cast<int>(
+        !std::equal(expected.begin(), expected.end(), batch.begin() + n * size, comparator));
+      status += static_cast<int>(
+        !std::equal(signal.begin(), signal.end(), inverseBatch.begin() + n * size, comparator));
+    }
+  }
+
+  std::cout << (status ? "..FAILED" : ".PASSED") << std::endl;
+  return status;
+}
+
 int Test_complex_module()
 {
   int status = 0;
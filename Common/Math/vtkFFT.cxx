@@ -251,6 +251,51 @@ std::vector<vtkFFT::ScalarNumber> vtkFFT::IRFft(const std::vector<vtkFFT::Comple
   return {};
 }
 
+//------------------------------------------------------------------------------
+namespace
+{
+void BatchKissFft(const vtkFFT::ComplexNumber* input, std::size_t size, std::size_t count,
+  vtkFFT::ComplexNumber* result, bool inverse)
+{
+  if (size <= 1)
+  {
+    std::copy(input, input + size * count, result);
+    return;
+  }
+
+  kiss_fft_cfg cfg = kiss_fft_alloc(static_cast<int>(size), inverse ? 1 : 0, nullptr, nullptr);
+  if (cfg != nullptr)
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      kiss_fft(cfg, input + i * size, result + i * size);
+    }
+    kiss_fft_free(cfg);
+  }
+
+  if (inverse)
+  {
+    std::for_each(result, result + size * count, [size](vtkFFT::ComplexNumber& x) {
+      x = vtkFFT::ComplexNumber{ x.r / size, x.i / size };
+    });
+  }
+}
+}
+
+//------------------------------------------------------------------------------
+void vtkFFT::BatchFft(
+  const ComplexNumber* input, std::size_t size, std::size_t count, ComplexNumber* result)
+{
+  BatchKissFft(input, size, count, result, false);
+}
+
+//------------------------------------------------------------------------------
+void vtkFFT::BatchIFft(
+  const ComplexNumber* input, std::size_t size, std::size_t count, ComplexNumber* result)
+{
+  BatchKissFft(input, size, count, result, true);
+}
+
 //------------------------------------------------------------------------------
 std::vector<vtkFFT::ScalarNumber> vtkFFT::FftFreq(int windowLength, double sampleSpacing)
 {
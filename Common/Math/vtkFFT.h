@@ -164,6 +164,22 @@ public:
    */
   static std::vector<ScalarNumber> IRFft(const std::vector<ComplexNumber>& in);
 
+  ///@{
+  /**
+   * Compute the DFT (@c BatchFft) or the inverse DFT (@c BatchIFft) of
+   * @c count complex signals of @c size points, stored one after the other.
+   * The same plan is used for all the signals, which makes it much faster
+   * than one call per signal when the signals are short. As with @c IFft,
+   * the inverse is scaled by 1 / size.
+   *
+   *  input and result have size * count complex points
+   */
+  static void BatchFft(
+    const ComplexNumber* input, std::size_t size, std::size_t count, ComplexNumber* result);
+  static void BatchIFft(
+    const ComplexNumber* input, std::size_t size, std::size_t count, ComplexNumber* result);
+  ///@}
+
   /**
    * Return the absolute value (also known as norm, modulus, or magnitude) of complex number
    */
@@ -74,6 +74,7 @@ static bool TestScalarLogic();
 static bool TestVectorLogic();
 static bool TestMiscFunctions();
 static bool TestErrors();
+static bool TestBatchEvaluation();
 
 int UnitTestFunctionParser(int, char*[])
 {
@@ -108,6 +109,7 @@ int UnitTestFunctionParser(int, char*[])
 
   status &= TestMiscFunctions();
   status &= TestErrors();
+  status &= TestBatchEvaluation();
   if (status == STATUS_FAILURE)
   {
     return EXIT_FAILURE;
@@ -1078,3 +1080,95 @@ bool TestErrors()
   }
   return status;
 }
+
+bool TestBatchEvaluation()
+{
+  std::cout << "Testing EvaluateBatch...";
+  bool status = STATUS_SUCCESS;
+  const char* functions[] = { "a*b - 3.5/(b+4) + abs(a)^2", "min(a,b) + max(sqrt(b),ln(b))",
+    "if(a < b | a = 0, sin(a), cos(b) - 1)", "a*u + cross(u,v)/b - iHat", "norm(u) * (u.v)",
+    "if(mag(u) > 0.8, u, -v)", "v*a + u/b" };
+  const vtkIdType n = 37;
+
+  auto rand = vtkSmartPointer<vtkMinimalStandardRandomSequence>::New();
+  std::vector<double> a(n), b(n), u(3 * n), v(3 * n);
+  for (vtkIdType i = 0; i < n; ++i)
+  {
+    a[i] = rand->GetNextRangeValue(-1.0, 1.0);
+    b[i] = rand->GetNextRangeValue(0.1, 2.0);
+    for (int c = 0; c < 3; ++c)
+    {
+      u[3 * i + c] = rand->GetNextRangeValue(-1.0, 1.0);
+      v[3 * i + c] = rand->GetNextRangeValue(-1.0, 1.0);
+    }
+  }
+
+  for (const char* function : functions)
+  {
+    auto parser = vtkSmartPointer<vtkFunctionParser>::New();
+    parser->SetFunction(function);
+    parser->SetScalarVariableValue("a", 0.0);
+    parser->SetScalarVariableValue("b", 1.0);
+    parser->SetVectorVariableValue("u", 0.0, 0.0, 0.0);
+    parser->SetVectorVariableValue("v", 0.0, 0.0, 0.0);
+    const int numComponents = parser->IsScalarResult() ? 1 : 3;
+    const double* scalars[] = { a.data(), b.data() };
+    const double* vectors[] = { u.data(), v.data() };
+    std::vector<double> result(3 * n);
+    if (!parser->EvaluateBatch(n, scalars, vectors, result.data()))
+    {
+      std::cout << "\n  EvaluateBatch failed for " << function;
+      status = STATUS_FAILURE;
+      continue;
+    }
+    for (vtkIdType i = 0; i < n; ++i)
+    {
+      parser->SetScalarVariableValue(0, a[i]);
+      parser->SetScalarVariableValue(1, b[i]);
+      parser->SetVectorVariableValue(0, &u[3 * i]);
+      parser->SetVectorVariableValue(1, &v[3 * i]);
+      const double* expected = nullptr;
+      double scalar = 0.0;
+      if (numComponents == 1)
+      {
+        scalar = parser->GetScalarResult();
+        expected = &scalar;
+      }
+      else
+      {
+        expected = parser->GetVectorResult();
+      }
+      for (int c = 0; c < numComponents; ++c)
+      {
+        if (!vtkMathUtilities::FuzzyCompare(result[numComponents * i + c], expected[c], 1e-12))
+        {
+          std::cout << "\n  " << function << " at " << i << ": expected " << expected[c]
+                    << " but got " << result[numComponents * i + c];
+          status = STATUS_FAILURE;
+        }
+      }
+    }
+  }
+
+  // Invalid values are replaced as in the evaluation of a single set of values
+  auto parser = vtkSmartPointer<vtkFunctionParser>::New();
+  parser->SetFunction("sqrt(a)");
+  parser->SetScalarVariableValue("a", 0.0);
+  parser->ReplaceInvalidValuesOn();
+  parser->SetReplacementValue(-7.0);
+  const double* scalars[] = { a.data() };
+  std::vector<double> result(n);
+  parser->EvaluateBatch(n, scalars, nullptr, result.data());
+  for (vtkIdType i = 0; i < n; ++i)
+  {
+    const double expected = a[i] < 0 ? -7.0 : std::sqrt(a[i]);
+    if (result[i] != expected)
+    {
+      std::cout << "\n  sqrt(a) at " << i << ": expected " << expected << " but got " << result[i];
+      status = STATUS_FAILURE;
+    }
+  }
+
+  std::cout << (status == STATUS_SUCCESS ? "PASSED\n" : "FAILED\n");
+  return status;
+}
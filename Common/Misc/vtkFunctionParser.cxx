@@ -6,6 +6,51 @@
 #include <algorithm>
 #include <cctype>
 
+namespace
+{
+//------------------------------------------------------------------------------
+// Operations of vtkFunctionParser::EvaluateBatch applied to rows of values
+template <typename Op>
+void BatchUnary(double* x, vtkIdType n, Op op)
+{
+  for (vtkIdType i = 0; i < n; i++)
+  {
+    x[i] = op(x[i]);
+  }
+}
+
+template <typename Op>
+void BatchBinary(double* x, const double* y, vtkIdType n, Op op)
+{
+  for (vtkIdType i = 0; i < n; i++)
+  {
+    x[i] = op(x[i], y[i]);
+  }
+}
+
+// Returns false when a value is outside of the domain of op and cannot be replaced
+template <typename Domain, typename Op>
+bool BatchChecked(double* x, vtkIdType n, Domain inDomain, Op op, bool replace, double replacement)
+{
+  for (vtkIdType i = 0; i < n; i++)
+  {
+    if (inDomain(x[i]))
+    {
+      x[i] = op(x[i]);
+    }
+    else if (replace)
+    {
+      x[i] = replacement;
+    }
+    else
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkFunctionParser);
 
@@ -834,6 +879,418 @@ bool vtkFunctionParser::Evaluate()
   return true;
 }
 
+//------------------------------------------------------------------------------
+bool vtkFunctionParser::EvaluateBatch(vtkIdType numberOfTuples, const double* const* scalarValues,
+  const double* const* vectorValues, double* result)
+{
+  if (this->FunctionMTime.GetMTime() > this->ParseMTime.GetMTime())
+  {
+    if (this->Parse() == 0)
+    {
+      return false;
+    }
+  }
+  const vtkIdType n = numberOfTuples;
+  if (n <= 0)
+  {
+    return true;
+  }
+
+  // The stack holds a row of n values for each position of the stack of Evaluate()
+  this->BatchStack.resize(static_cast<size_t>(this->StackSize * n));
+  double* stack = this->BatchStack.data();
+  auto row = [stack, n](int position) { return stack + position * n; };
+  const bool replace = this->ReplaceInvalidValues != 0;
+  const double replacement = this->ReplacementValue;
+  int numImmediatesProcessed = 0;
+  int stackPosition = -1;
+  vtkIdType i;
+
+  for (int numBytesProcessed = 0; numBytesProcessed < this->ByteCodeSize; numBytesProcessed++)
+  {
+    const unsigned int byte = this->ByteCode[numBytesProcessed];
+    double* x = stackPosition >= 0 ? row(stackPosition) : nullptr;
+    double* y = stackPosition >= 1 ? row(stackPosition - 1) : nullptr;
+    switch (byte)
+    {
+      case VTK_PARSER_IMMEDIATE:
+        std::fill_n(row(++stackPosition), n, this->Immediates[numImmediatesProcessed++]);
+        break;
+      case VTK_PARSER_UNARY_MINUS:
+        BatchUnary(x, n, [](double a) { return -a; });
+        break;
+      case VTK_PARSER_UNARY_PLUS:
+        break;
+      case VTK_PARSER_ADD:
+        BatchBinary(y, x, n, [](double a, double b) { return a + b; });
+        stackPosition--;
+        break;
+      case VTK_PARSER_SUBTRACT:
+        BatchBinary(y, x, n, [](double a, double b) { return a - b; });
+        stackPosition--;
+        break;
+      case VTK_PARSER_MULTIPLY:
+        BatchBinary(y, x, n, [](double a, double b) { return a * b; });
+        stackPosition--;
+        break;
+      case VTK_PARSER_DIVIDE:
+        for (i = 0; i < n; i++)
+        {
+          if (x[i] == 0)
+          {
+            if (!replace)
+            {
+              vtkErrorMacro("Trying to divide by zero");
+              return false;
+            }
+            y[i] = replacement;
+          }
+          else
+          {
+            y[i] /= x[i];
+          }
+        }
+        stackPosition--;
+        break;
+      case VTK_PARSER_POWER:
+        BatchBinary(y, x, n, [](double a, double b) { return pow(a, b); });
+        stackPosition--;
+        break;
+      case VTK_PARSER_ABSOLUTE_VALUE:
+        BatchUnary(x, n, [](double a) { return fabs(a); });
+        break;
+      case VTK_PARSER_EXPONENT:
+        BatchUnary(x, n, [](double a) { return exp(a); });
+        break;
+      case VTK_PARSER_CEILING:
+        BatchUnary(x, n, [](double a) { return ceil(a); });
+        break;
+      case VTK_PARSER_FLOOR:
+        BatchUnary(x, n, [](double a) { return floor(a); });
+        break;
+      case VTK_PARSER_LOGARITHM:
+        if (!BatchChecked(
+              x, n, [](double a) { return a > 0; }, [](double a) { return log(a); }, replace,
+              replacement))
+        {
+          vtkErrorMacro("Trying to take a log of a non-positive value");
+          return false;
+        }
+        break;
+      case VTK_PARSER_LOGARITHME:
+        if (!BatchChecked(
+              x, n, [](double a) { return a > 0; }, [](double a) { return log(a); }, replace,
+              replacement))
+        {
+          vtkErrorMacro("Trying to take a natural logarithm of a non-positive value");
+          return false;
+        }
+        break;
+      case VTK_PARSER_LOGARITHM10:
+        if (!BatchChecked(
+              x, n, [](double a) { return a > 0; }, [](double a) { return log10(a); }, replace,
+              replacement))
+        {
+          vtkErrorMacro("Trying to take a log10 of a non-positive value");
+          return false;
+        }
+        break;
+      case VTK_PARSER_SQUARE_ROOT:
+        if (!BatchChecked(
+              x, n, [](double a) { return a >= 0; }, [](double a) { return sqrt(a); }, replace,
+              replacement))
+        {
+          vtkErrorMacro("Trying to take a square root of a negative value");
+          return false;
+        }
+        break;
+      case VTK_PARSER_SINE:
+        BatchUnary(x, n, [](double a) { return sin(a); });
+        break;
+      case VTK_PARSER_COSINE:
+        BatchUnary(x, n, [](double a) { return cos(a); });
+        break;
+      case VTK_PARSER_TANGENT:
+        BatchUnary(x, n, [](double a) { return tan(a); });
+        break;
+      case VTK_PARSER_ARCSINE:
+        if (!BatchChecked(
+              x, n, [](double a) { return a >= -1 && a <= 1; }, [](double a) { return asin(a); },
+              replace, replacement))
+        {
+          vtkErrorMacro("Trying to take asin of a value < -1 or > 1");
+          return false;
+        }
+        break;
+      case VTK_PARSER_ARCCOSINE:
+        if (!BatchChecked(
+              x, n, [](double a) { return a >= -1 && a <= 1; }, [](double a) { return acos(a); },
+              replace, replacement))
+        {
+          vtkErrorMacro("Trying to take acos of a value < -1 or > 1");
+          return false;
+        }
+        break;
+      case VTK_PARSER_ARCTANGENT:
+        BatchUnary(x, n, [](double a) { return atan(a); });
+        break;
+      case VTK_PARSER_HYPERBOLIC_SINE:
+        BatchUnary(x, n, [](double a) { return sinh(a); });
+        break;
+      case VTK_PARSER_HYPERBOLIC_COSINE:
+        BatchUnary(x, n, [](double a) { return cosh(a); });
+        break;
+      case VTK_PARSER_HYPERBOLIC_TANGENT:
+        BatchUnary(x, n, [](double a) { return tanh(a); });
+        break;
+      case VTK_PARSER_MIN:
+        BatchBinary(y, x, n, [](double a, double b) { return b < a ? b : a; });
+        stackPosition--;
+        break;
+      case VTK_PARSER_MAX:
+        BatchBinary(y, x, n, [](double a, double b) { return b > a ? b : a; });
+        stackPosition--;
+        break;
+      case VTK_PARSER_CROSS:
+      {
+        double* ux = row(stackPosition - 5);
+        double* uy = row(stackPosition - 4);
+        double* uz = row(stackPosition - 3);
+        const double* vx = row(stackPosition - 2);
+        const double* vy = row(stackPosition - 1);
+        const double* vz = x;
+        for (i = 0; i < n; i++)
+        {
+          const double cx = uy[i] * vz[i] - uz[i] * vy[i];
+          const double cy = uz[i] * vx[i] - ux[i] * vz[i];
+          const double cz = ux[i] * vy[i] - uy[i] * vx[i];
+          ux[i] = cx;
+          uy[i] = cy;
+          uz[i] = cz;
+        }
+        stackPosition -= 3;
+        break;
+      }
+      case VTK_PARSER_SIGN:
+        BatchUnary(x, n, [](double a) { return a < 0 ? -1.0 : (a == 0 ? 0.0 : 1.0); });
+        break;
+      case VTK_PARSER_VECTOR_UNARY_MINUS:
+        for (int c = 0; c < 3; c++)
+        {
+          BatchUnary(row(stackPosition - c), n, [](double a) { return -a; });
+        }
+        break;
+      case VTK_PARSER_VECTOR_UNARY_PLUS:
+        break;
+      case VTK_PARSER_DOT_PRODUCT:
+      {
+        double* ux = row(stackPosition - 5);
+        const double* uy = row(stackPosition - 4);
+        const double* uz = row(stackPosition - 3);
+        const double* vx = row(stackPosition - 2);
+        const double* vy = y;
+        const double* vz = x;
+        for (i = 0; i < n; i++)
+        {
+          ux[i] = ux[i] * vx[i] + uy[i] * vy[i] + uz[i] * vz[i];
+        }
+        stackPosition -= 5;
+        break;
+      }
+      case VTK_PARSER_VECTOR_ADD:
+        for (int c = 0; c < 3; c++)
+        {
+          BatchBinary(row(stackPosition - 3 - c), row(stackPosition - c), n,
+            [](double a, double b) { return a + b; });
+        }
+        stackPosition -= 3;
+        break;
+      case VTK_PARSER_VECTOR_SUBTRACT:
+        for (int c = 0; c < 3; c++)
+        {
+          BatchBinary(row(stackPosition - 3 - c), row(stackPosition - c), n,
+            [](double a, double b) { return a - b; });
+        }
+        stackPosition -= 3;
+        break;
+      case VTK_PARSER_SCALAR_TIMES_VECTOR:
+      {
+        // (s, vx, vy, vz) becomes (s * vx, s * vy, s * vz)
+        const double* s = row(stackPosition - 3);
+        for (int c = 0; c < 3; c++)
+        {
+          BatchBinary(row(stackPosition - 2 + c), s, n, [](double a, double b) { return a * b; });
+        }
+        for (int c = 0; c < 3; c++)
+        {
+          std::copy_n(row(stackPosition - 2 + c), n, row(stackPosition - 3 + c));
+        }
+        stackPosition--;
+        break;
+      }
+      case VTK_PARSER_VECTOR_TIMES_SCALAR:
+        for (int c = 1; c < 4; c++)
+        {
+          BatchBinary(row(stackPosition - c), x, n, [](double a, double b) { return a * b; });
+        }
+        stackPosition--;
+        break;
+      case VTK_PARSER_VECTOR_OVER_SCALAR:
+        for (int c = 1; c < 4; c++)
+        {
+          BatchBinary(
+            row(stackPosition - c), x, n, [](double a, double b) { return b != 0.0 ? a / b : a; });
+        }
+        stackPosition--;
+        break;
+      case VTK_PARSER_MAGNITUDE:
+      {
+        double* vx = row(stackPosition - 2);
+        const double* vy = y;
+        const double* vz = x;
+        for (i = 0; i < n; i++)
+        {
+          vx[i] = sqrt(vx[i] * vx[i] + vy[i] * vy[i] + vz[i] * vz[i]);
+        }
+        stackPosition -= 2;
+        break;
+      }
+      case VTK_PARSER_NORMALIZE:
+      {
+        double* vx = row(stackPosition - 2);
+        double* vy = y;
+        double* vz = x;
+        for (i = 0; i < n; i++)
+        {
+          const double magnitude = sqrt(vx[i] * vx[i] + vy[i] * vy[i] + vz[i] * vz[i]);
+          if (magnitude != 0)
+          {
+            vx[i] /= magnitude;
+            vy[i] /= magnitude;
+            vz[i] /= magnitude;
+          }
+        }
+        break;
+      }
+      case VTK_PARSER_IHAT:
+      case VTK_PARSER_JHAT:
+      case VTK_PARSER_KHAT:
+        std::fill_n(row(++stackPosition), n, byte == VTK_PARSER_IHAT ? 1.0 : 0.0);
+        std::fill_n(row(++stackPosition), n, byte == VTK_PARSER_JHAT ? 1.0 : 0.0);
+        std::fill_n(row(++stackPosition), n, byte == VTK_PARSER_KHAT ? 1.0 : 0.0);
+        break;
+      case VTK_PARSER_LESS_THAN:
+        BatchBinary(y, x, n, [](double a, double b) { return static_cast<double>(a < b); });
+        stackPosition--;
+        break;
+      case VTK_PARSER_GREATER_THAN:
+        BatchBinary(y, x, n, [](double a, double b) { return static_cast<double>(a > b); });
+        stackPosition--;
+        break;
+      case VTK_PARSER_EQUAL_TO:
+        BatchBinary(y, x, n, [](double a, double b) { return static_cast<double>(a == b); });
+        stackPosition--;
+        break;
+      case VTK_PARSER_AND:
+        BatchBinary(y, x, n, [](double a, double b) { return static_cast<double>(a && b); });
+        stackPosition--;
+        break;
+      case VTK_PARSER_OR:
+        BatchBinary(y, x, n, [](double a, double b) { return static_cast<double>(a || b); });
+        stackPosition--;
+        break;
+      case VTK_PARSER_IF:
+      {
+        // if(bool, valTrue, valFalse) with valFalse at stackPosition - 2
+        double* valFalse = row(stackPosition - 2);
+        const double* valTrue = y;
+        const double* boolArg = x;
+        for (i = 0; i < n; i++)
+        {
+          valFalse[i] = boolArg[i] != 0.0 ? valTrue[i] : valFalse[i];
+        }
+        stackPosition -= 2;
+        break;
+      }
+      case VTK_PARSER_VECTOR_IF:
+      {
+        const double* boolArg = x;
+        for (int c = 0; c < 3; c++)
+        {
+          double* valFalse = row(stackPosition - 6 + c);
+          const double* valTrue = row(stackPosition - 3 + c);
+          for (i = 0; i < n; i++)
+          {
+            valFalse[i] = boolArg[i] != 0.0 ? valTrue[i] : valFalse[i];
+          }
+        }
+        stackPosition -= 4;
+        break;
+      }
+      default:
+      {
+        const int numScalars = this->GetNumberOfScalarVariables();
+        const int variable = static_cast<int>(byte - VTK_PARSER_BEGIN_VARIABLES);
+        if (variable < numScalars)
+        {
+          double* dest = row(++stackPosition);
+          const double* values = scalarValues ? scalarValues[variable] : nullptr;
+          if (values)
+          {
+            std::copy_n(values, n, dest);
+          }
+          else
+          {
+            std::fill_n(dest, n, this->ScalarVariableValues[variable]);
+          }
+        }
+        else
+        {
+          const int vectorNum = variable - numScalars;
+          const double* values = vectorValues ? vectorValues[vectorNum] : nullptr;
+          for (int c = 0; c < 3; c++)
+          {
+            double* dest = row(++stackPosition);
+            if (values)
+            {
+              for (i = 0; i < n; i++)
+              {
+                dest[i] = values[3 * i + c];
+              }
+            }
+            else
+            {
+              std::fill_n(dest, n, this->VectorVariableValues[vectorNum][c]);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  if (stackPosition == 0)
+  {
+    std::copy_n(row(0), n, result);
+  }
+  else if (stackPosition == 2)
+  {
+    for (int c = 0; c < 3; c++)
+    {
+      const double* values = row(c);
+      for (i = 0; i < n; i++)
+      {
+        result[3 * i + c] = values[i];
+      }
+    }
+  }
+  else
+  {
+    vtkErrorMacro("EvaluateBatch: no valid scalar or vector result");
+    return false;
+  }
+  return true;
+}
+
 //------------------------------------------------------------------------------
 int vtkFunctionParser::IsScalarResult()
 {
@@ -170,6 +170,23 @@ public:
   }
   ///@}
 
+  /**
+   * Evaluate the function for @a numberOfTuples sets of variable values at
+   * once. Each operation of the function is applied to the whole block of
+   * values before the next one, which avoids interpreting the function for
+   * each set of values and lets the compiler vectorize the operations.
+   * The values of the scalar variable i are read from scalarValues[i][t] and
+   * the values of the vector variable i from vectorValues[i][3 * t + c],
+   * where t is the index of the set and c the component. A null pointer, or
+   * a null array of pointers, uses the current value of the variable for all
+   * the sets. The results are written to @a result with 1 or 3 components
+   * per set, depending on whether the result of the function is scalar or
+   * vector. Returns false if the function could not be parsed or if an
+   * invalid value was found while ReplaceInvalidValues is off.
+   */
+  bool EvaluateBatch(vtkIdType numberOfTuples, const double* const* scalarValues,
+    const double* const* vectorValues, double* result);
+
   ///@{
   /**
    * Set the value of a scalar variable.  If a variable with this name
@@ -430,6 +447,7 @@ protected:
   double* Stack;
   int StackSize;
   int StackPointer;
+  std::vector<double> BatchStack;
 
   vtkTimeStamp FunctionMTime;
   vtkTimeStamp ParseMTime;
@@ -1,14 +1,24 @@
 // SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
 // SPDX-License-Identifier: BSD-3-Clause
 
+#include <cmath>
 #include <iostream>
 
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkSOADataArrayTemplate.h"
 #include "vtkSmartPointer.h"
+#include "vtkThinPlateSplineTransform.h"
 #include "vtkTransform.h"
 
 // forward declare test subroutines
 int testUseOfInverse();
 int testConcatenationIdentity();
+int testTransformPointsNormalsVectors();
+int testWarpTransformPoints();
 
 int TestTransform(int, char*[])
 {
@@ -16,6 +26,8 @@ int TestTransform(int, char*[])
 
   numErrors += testUseOfInverse();
   numErrors += testConcatenationIdentity();
+  numErrors += testTransformPointsNormalsVectors();
+  numErrors += testWarpTransformPoints();
 
   return (numErrors > 0) ? 1 : 0;
 }
@@ -77,3 +89,189 @@ int testConcatenationIdentity()
   trans1->DeepCopy(trans2);
   return 0;
 }
+
+namespace
+{
+bool fuzzyEqual(const double a[3], const double b[3], double tol)
+{
+  return std::abs(a[0] - b[0]) <= tol && std::abs(a[1] - b[1]) <= tol &&
+    std::abs(a[2] - b[2]) <= tol;
+}
+
+void fillRandom(vtkDataArray* array, vtkIdType n, int seed)
+{
+  vtkMath::RandomSeed(seed);
+  array->SetNumberOfComponents(3);
+  array->SetNumberOfTuples(n);
+  for (vtkIdType i = 0; i < n; ++i)
+  {
+    array->SetTuple3(
+      i, vtkMath::Random(-10.0, 10.0), vtkMath::Random(-10.0, 10.0), vtkMath::Random(-10.0, 10.0));
+  }
+}
+}
+
+// Check the batch transformation of points, normals and vectors stored in
+// SOA and AOS arrays of different types against the transformation of each
+// tuple, with enough tuples to be processed by several threads.
+int testTransformPointsNormalsVectors()
+{
+  const vtkIdType n = 200000;
+
+  vtkNew<vtkTransform> transform;
+  transform->Translate(1.0, -2.0, 3.0);
+  transform->RotateWXYZ(30.0, 1.0, 2.0, 3.0);
+  transform->Scale(2.0, 0.5, 1.5);
+
+  vtkNew<vtkSOADataArrayTemplate<double>> inPtsData;
+  fillRandom(inPtsData, n, 1);
+  vtkNew<vtkPoints> inPts;
+  inPts->SetData(inPtsData);
+  vtkNew<vtkSOADataArrayTemplate<float>> inNms;
+  fillRandom(inNms, n, 2);
+  vtkNew<vtkDoubleArray> inVrs;
+  fillRandom(inVrs, n, 3);
+
+  // The transformed points are appended to the existing ones.
+  vtkNew<vtkPoints> outPts;
+  outPts->SetDataTypeToFloat();
+  outPts->InsertNextPoint(0.0, 0.0, 0.0);
+  vtkNew<vtkSOADataArrayTemplate<double>> outNms;
+  vtkNew<vtkFloatArray> outVrs;
+  transform->TransformPointsNormalsVectors(inPts, outPts, inNms, outNms, inVrs, outVrs);
+
+  if (outPts->GetNumberOfPoints() != n + 1 || outNms->GetNumberOfTuples() != n ||
+    outVrs->GetNumberOfTuples() != n)
+  {
+    std::cerr << "Wrong number of transformed tuples" << std::endl;
+    return 1;
+  }
+
+  double in[3], expected[3], out[3];
+  for (vtkIdType i = 0; i < n; ++i)
+  {
+    inPts->GetPoint(i, in);
+    transform->TransformPoint(in, expected);
+    outPts->GetPoint(i + 1, out);
+    if (!fuzzyEqual(expected, out, 1e-4))
+    {
+      std::cerr << "Wrong transformed point " << i << std::endl;
+      return 1;
+    }
+
+    inNms->GetTuple(i, in);
+    transform->TransformNormal(in, expected);
+    outNms->GetTuple(i, out);
+    if (!fuzzyEqual(expected, out, 1e-6))
+    {
+      std::cerr << "Wrong transformed normal " << i << std::endl;
+      return 1;
+    }
+
+    inVrs->GetTuple(i, in);
+    transform->TransformVector(in, expected);
+    outVrs->GetTuple(i, out);
+    if (!fuzzyEqual(expected, out, 1e-4))
+    {
+      std::cerr << "Wrong transformed vector " << i << std::endl;
+      return 1;
+    }
+  }
+
+  // The separate transformations give the same results.
+  vtkNew<vtkPoints> outPts2;
+  transform->TransformPoints(inPts, outPts2);
+  vtkNew<vtkDoubleArray> outNms2;
+  transform->TransformNormals(inNms, outNms2);
+  for (vtkIdType i = 0; i < n; ++i)
+  {
+    outPts->GetPoint(i + 1, expected);
+    outPts2->GetPoint(i, out);
+    if (!fuzzyEqual(expected, out, 1e-4))
+    {
+      std::cerr << "TransformPoints differs from TransformPointsNormalsVectors" << std::endl;
+      return 1;
+    }
+    outNms->GetTuple(i, expected);
+    outNms2->GetTuple(i, out);
+    if (!fuzzyEqual(expected, out, 1e-12))
+    {
+      std::cerr << "TransformNormals differs from TransformPointsNormalsVectors" << std::endl;
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+// Check the parallel transformation of points and vectors by a warp transform
+// against the transformation of each point.
+int testWarpTransformPoints()
+{
+  vtkNew<vtkPoints> source;
+  vtkNew<vtkPoints> target;
+  for (int i = 0; i < 8; ++i)
+  {
+    const double p[3] = { (i & 1) * 1.0, ((i >> 1) & 1) * 1.0, ((i >> 2) & 1) * 1.0 };
+    source->InsertNextPoint(p);
+    target->InsertNextPoint(p[0] + 0.1 * p[1], p[1] - 0.2 * p[2] * p[0], p[2] + 0.05);
+  }
+  vtkNew<vtkThinPlateSplineTransform> transform;
+  transform->SetSourceLandmarks(source);
+  transform->SetTargetLandmarks(target);
+  transform->SetBasisToR();
+
+  const vtkIdType n = 10000;
+  vtkNew<vtkPoints> inPts;
+  inPts->SetNumberOfPoints(n);
+  vtkMath::RandomSeed(4);
+  for (vtkIdType i = 0; i < n; ++i)
+  {
+    inPts->SetPoint(i, vtkMath::Random(), vtkMath::Random(), vtkMath::Random());
+  }
+  vtkNew<vtkFloatArray> inVrs;
+  fillRandom(inVrs, n, 5);
+
+  vtkNew<vtkPoints> outPts;
+  transform->TransformPoints(inPts, outPts);
+  vtkNew<vtkPoints> outPts2;
+  vtkNew<vtkFloatArray> outVrs;
+  transform->TransformPointsNormalsVectors(inPts, outPts2, nullptr, nullptr, inVrs, outVrs);
+  if (outPts->GetNumberOfPoints() != n || outPts2->GetNumberOfPoints() != n ||
+    outVrs->GetNumberOfTuples() != n)
+  {
+    std::cerr << "Wrong number of warped tuples" << std::endl;
+    return 1;
+  }
+
+  double in[3], expected[3], out[3], derivative[3][3];
+  for (vtkIdType i = 0; i < n; ++i)
+  {
+    inPts->GetPoint(i, in);
+    transform->TransformPoint(in, expected);
+    outPts->GetPoint(i, out);
+    if (!fuzzyEqual(expected, out, 1e-12))
+    {
+      std::cerr << "Wrong warped point " << i << std::endl;
+      return 1;
+    }
+    outPts2->GetPoint(i, out);
+    if (!fuzzyEqual(expected, out, 1e-12))
+    {
+      std::cerr << "Wrong warped point with vectors " << i << std::endl;
+      return 1;
+    }
+
+    transform->InternalTransformDerivative(in, expected, derivative);
+    inVrs->GetTuple(i, in);
+    vtkMath::Multiply3x3(derivative, in, expected);
+    outVrs->GetTuple(i, out);
+    if (!fuzzyEqual(expected, out, 1e-4))
+    {
+      std::cerr << "Wrong warped vector " << i << std::endl;
+      return 1;
+    }
+  }
+
+  return 0;
+}
@@ -2,12 +2,17 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkLinearTransform.h"
 
+#include "vtkArrayDispatch.h"
 #include "vtkDataArray.h"
+#include "vtkDataArrayRange.h"
 #include "vtkMath.h"
 #include "vtkMatrix4x4.h"
 #include "vtkPoints.h"
 #include "vtkSMPTools.h"
 
+#include <cmath>
+#include <vector>
+
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
 void vtkLinearTransform::PrintSelf(ostream& os, vtkIndent indent)
@@ -80,100 +85,160 @@ inline void vtkLinearTransformNormal(T1 mat[4][4], T2 in[3], T3 out[3])
 // experiments and could readily be changed.
 constexpr int VTK_SMP_THRESHOLD = 350000;
 
+// How the 3-component tuples of an array are transformed.
+enum class TupleKind
+{
+  Point,
+  Vector,
+  Normal // the matrix is expected to be the transposed inverse
+};
+
 //------------------------------------------------------------------------------
-template <class T1, class T2, class T3>
-inline void vtkLinearTransformPoints(T1 matrix[4][4], T2* in, T3* out, vtkIdType n)
+// Transform the tuples [begin, end) of inArray into the tuples
+// [offset + begin, offset + end) of outArray. The matrix coefficients are
+// copied to locals so that they stay in registers and the loop can be
+// vectorized by the compiler.
+template <TupleKind Kind>
+struct TransformTuplesWorker
 {
-  // Switch based on the number of points to transform: serial processing is
-  // faster for a smaller number of transformations.
-  if (n >= VTK_SMP_THRESHOLD)
+  template <typename InArrayT, typename OutArrayT>
+  void operator()(InArrayT* inArray, OutArrayT* outArray, const double (*matrix)[4],
+    vtkIdType offset, vtkIdType begin, vtkIdType end) const
   {
-    vtkSMPTools::For(0, n, [&](vtkIdType ptId, vtkIdType endPtId) {
-      T2* pin = in + 3 * ptId;
-      T3* pout = out + 3 * ptId;
-      for (; ptId < endPtId; ++ptId)
+    using OutValueT = vtk::GetAPIType<OutArrayT>;
+    const auto inTuples = vtk::DataArrayTupleRange<3>(inArray, begin, end);
+    auto outTuples = vtk::DataArrayTupleRange<3>(outArray, offset + begin, offset + end);
+
+    const double m00 = matrix[0][0], m01 = matrix[0][1], m02 = matrix[0][2], m03 = matrix[0][3];
+    const double m10 = matrix[1][0], m11 = matrix[1][1], m12 = matrix[1][2], m13 = matrix[1][3];
+    const double m20 = matrix[2][0], m21 = matrix[2][1], m22 = matrix[2][2], m23 = matrix[2][3];
+
+    auto out = outTuples.begin();
+    for (const auto in : inTuples)
+    {
+      const double x = static_cast<double>(in[0]);
+      const double y = static_cast<double>(in[1]);
+      const double z = static_cast<double>(in[2]);
+      double ox = m00 * x + m01 * y + m02 * z;
+      double oy = m10 * x + m11 * y + m12 * z;
+      double oz = m20 * x + m21 * y + m22 * z;
+      if (Kind == TupleKind::Point)
+      {
+        ox += m03;
+        oy += m13;
+        oz += m23;
+      }
+      else if (Kind == TupleKind::Normal)
       {
-        vtkLinearTransformPoint(matrix, pin, pout);
-        pin += 3;
-        pout += 3;
+        const double norm = std::sqrt(ox * ox + oy * oy + oz * oz);
+        if (norm != 0.0)
+        {
+          ox /= norm;
+          oy /= norm;
+          oz /= norm;
+        }
       }
-    });
+      (*out)[0] = static_cast<OutValueT>(ox);
+      (*out)[1] = static_cast<OutValueT>(oy);
+      (*out)[2] = static_cast<OutValueT>(oz);
+      ++out;
+    }
   }
-  else
+};
+
+//------------------------------------------------------------------------------
+template <TupleKind Kind>
+void vtkLinearTransformTuples(vtkDataArray* inArray, vtkDataArray* outArray,
+  const double (*matrix)[4], vtkIdType offset, vtkIdType begin, vtkIdType end)
+{
+  // Fast path for float/double arrays with AOS or SOA storage, use the
+  // vtkDataArray API otherwise.
+  using Dispatcher =
+    vtkArrayDispatch::Dispatch2ByValueType<vtkArrayDispatch::Reals, vtkArrayDispatch::Reals>;
+  TransformTuplesWorker<Kind> worker;
+  if (!Dispatcher::Execute(inArray, outArray, worker, matrix, offset, begin, end))
   {
-    for (vtkIdType i = 0; i < n; i++)
-    {
-      vtkLinearTransformPoint(matrix, in, out);
-      in += 3;
-      out += 3;
-    }
+    worker(inArray, outArray, matrix, offset, begin, end);
   }
 }
 
 //------------------------------------------------------------------------------
-template <class T1, class T2, class T3>
-inline void vtkLinearTransformVectors(T1 matrix[4][4], T2* in, T3* out, vtkIdType n)
+// An array of tuples to transform, appended to the output array.
+struct TransformJob
 {
-  // Switch based on the number of points to transform: serial processing is
-  // faster for a smaller number of transformations.
-  if (n >= VTK_SMP_THRESHOLD)
+  vtkDataArray* In;
+  vtkDataArray* Out;
+  const double (*Matrix)[4];
+  TupleKind Kind;
+  vtkIdType Offset;
+
+  TransformJob(vtkDataArray* in, vtkDataArray* out, const double (*matrix)[4], TupleKind kind)
+    : In(in)
+    , Out(out)
+    , Matrix(matrix)
+    , Kind(kind)
+    , Offset(out->GetNumberOfTuples())
   {
-    vtkSMPTools::For(0, n, [&](vtkIdType ptId, vtkIdType endPtId) {
-      T2* pin = in + 3 * ptId;
-      T3* pout = out + 3 * ptId;
-      for (; ptId < endPtId; ++ptId)
-      {
-        vtkLinearTransformVector(matrix, pin, pout);
-        pin += 3;
-        pout += 3;
-      }
-    });
   }
-  else
+};
+
+//------------------------------------------------------------------------------
+// Transform the n first tuples of all the arrays in a single pass: each thread
+// transforms the same range of points, normals and vectors, while they are in
+// its cache.
+void vtkLinearTransformJobs(const std::vector<TransformJob>& jobs, vtkIdType n)
+{
+  for (const TransformJob& job : jobs)
   {
-    for (vtkIdType i = 0; i < n; i++)
+    if (job.Offset == 0)
     {
-      vtkLinearTransformVector(matrix, in, out);
-      in += 3;
-      out += 3;
+      job.Out->SetNumberOfComponents(3);
     }
+    job.Out->SetNumberOfTuples(job.Offset + n);
   }
-}
 
-//------------------------------------------------------------------------------
-template <class T1, class T2, class T3>
-inline void vtkLinearTransformNormals(T1 matrix[4][4], T2* in, T3* out, vtkIdType n)
-{
-  // Switch based on the number of points to transform: serial processing is
-  // faster for a smaller number of transformations.
-  if (n >= VTK_SMP_THRESHOLD)
-  {
-    vtkSMPTools::For(0, n, [&](vtkIdType ptId, vtkIdType endPtId) {
-      T2* pin = in + 3 * ptId;
-      T3* pout = out + 3 * ptId;
-      for (; ptId < endPtId; ++ptId)
+  auto transformRange = [&](vtkIdType begin, vtkIdType end) {
+    for (const TransformJob& job : jobs)
+    {
+      switch (job.Kind)
       {
-        // matrix has been transposed & inverted, so use TransformVector
-        vtkLinearTransformVector(matrix, pin, pout);
-        vtkMath::Normalize(pout);
-        pin += 3;
-        pout += 3;
+        case TupleKind::Point:
+          vtkLinearTransformTuples<TupleKind::Point>(
+            job.In, job.Out, job.Matrix, job.Offset, begin, end);
+          break;
+        case TupleKind::Vector:
+          vtkLinearTransformTuples<TupleKind::Vector>(
+            job.In, job.Out, job.Matrix, job.Offset, begin, end);
+          break;
+        case TupleKind::Normal:
+          vtkLinearTransformTuples<TupleKind::Normal>(
+            job.In, job.Out, job.Matrix, job.Offset, begin, end);
+          break;
       }
-    });
+    }
+  };
+
+  // Switch based on the number of tuples to transform: serial processing is
+  // faster for a smaller number of transformations.
+  if (n * static_cast<vtkIdType>(jobs.size()) >= VTK_SMP_THRESHOLD)
+  {
+    vtkSMPTools::For(0, n, transformRange);
   }
   else
   {
-    for (vtkIdType i = 0; i < n; i++)
-    {
-      // matrix has been transposed & inverted, so use TransformVector
-      vtkLinearTransformVector(matrix, in, out);
-      vtkMath::Normalize(out);
-      in += 3;
-      out += 3;
-    }
+    transformRange(0, n);
   }
 }
 
+//------------------------------------------------------------------------------
+// The matrix transforming the normals: the transposed inverse of the matrix.
+void vtkLinearTransformNormalMatrix(vtkMatrix4x4* matrix, double normalMatrix[4][4])
+{
+  vtkMatrix4x4::DeepCopy(*normalMatrix, matrix);
+  vtkMatrix4x4::Invert(*normalMatrix, *normalMatrix);
+  vtkMatrix4x4::Transpose(*normalMatrix, *normalMatrix);
+}
+
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -237,169 +302,65 @@ void vtkLinearTransform::TransformPointsNormalsVectors(vtkPoints* inPts, vtkPoin
   vtkDataArray* inNms, vtkDataArray* outNms, vtkDataArray* inVrs, vtkDataArray* outVrs,
   int nOptionalVectors, vtkDataArray** inVrsArr, vtkDataArray** outVrsArr)
 {
-  this->TransformPoints(inPts, outPts);
+  this->Update();
+
+  const double(*matrix)[4] = this->Matrix->Element;
+  double normalMatrix[4][4];
+  vtkLinearTransformNormalMatrix(this->Matrix, normalMatrix);
+
+  std::vector<TransformJob> jobs;
+  jobs.emplace_back(inPts->GetData(), outPts->GetData(), matrix, TupleKind::Point);
   if (inNms)
   {
-    this->TransformNormals(inNms, outNms);
+    jobs.emplace_back(inNms, outNms, normalMatrix, TupleKind::Normal);
   }
   if (inVrs)
   {
-    this->TransformVectors(inVrs, outVrs);
+    jobs.emplace_back(inVrs, outVrs, matrix, TupleKind::Vector);
   }
   if (inVrsArr)
   {
     for (int iArr = 0; iArr < nOptionalVectors; iArr++)
     {
-      this->TransformVectors(inVrsArr[iArr], outVrsArr[iArr]);
+      jobs.emplace_back(inVrsArr[iArr], outVrsArr[iArr], matrix, TupleKind::Vector);
     }
   }
+  vtkLinearTransformJobs(jobs, inPts->GetNumberOfPoints());
+  outPts->Modified();
 }
 
 //------------------------------------------------------------------------------
 void vtkLinearTransform::TransformPoints(vtkPoints* inPts, vtkPoints* outPts)
 {
-  vtkIdType n = inPts->GetNumberOfPoints();
-  vtkIdType m = outPts->GetNumberOfPoints();
-  double(*matrix)[4] = this->Matrix->Element;
-
   this->Update();
 
-  // operate directly on the memory to avoid GetPoint()/SetPoint() calls.
-  vtkDataArray* inArray = inPts->GetData();
-  vtkDataArray* outArray = outPts->GetData();
-  int inType = inArray->GetDataType();
-  int outType = outArray->GetDataType();
-  void* inPtr = inArray->GetVoidPointer(0);
-  void* outPtr = outArray->WriteVoidPointer(3 * m, 3 * n);
-
-  if (inType == VTK_FLOAT && outType == VTK_FLOAT)
-  {
-    vtkLinearTransformPoints(matrix, static_cast<float*>(inPtr), static_cast<float*>(outPtr), n);
-  }
-  else if (inType == VTK_FLOAT && outType == VTK_DOUBLE)
-  {
-    vtkLinearTransformPoints(matrix, static_cast<float*>(inPtr), static_cast<double*>(outPtr), n);
-  }
-  else if (inType == VTK_DOUBLE && outType == VTK_FLOAT)
-  {
-    vtkLinearTransformPoints(matrix, static_cast<double*>(inPtr), static_cast<float*>(outPtr), n);
-  }
-  else if (inType == VTK_DOUBLE && outType == VTK_DOUBLE)
-  {
-    vtkLinearTransformPoints(matrix, static_cast<double*>(inPtr), static_cast<double*>(outPtr), n);
-  }
-  else
-  {
-    double point[3];
-
-    for (vtkIdType i = 0; i < n; i++)
-    {
-      inPts->GetPoint(i, point);
-
-      vtkLinearTransformPoint(matrix, point, point);
-
-      outPts->SetPoint(m + i, point);
-    }
-  }
+  // operate directly on the arrays to avoid GetPoint()/SetPoint() calls.
+  vtkLinearTransformJobs(
+    { TransformJob(inPts->GetData(), outPts->GetData(), this->Matrix->Element, TupleKind::Point) },
+    inPts->GetNumberOfPoints());
+  outPts->Modified();
 }
 
 //------------------------------------------------------------------------------
 void vtkLinearTransform::TransformNormals(vtkDataArray* inNms, vtkDataArray* outNms)
 {
-  vtkIdType n = inNms->GetNumberOfTuples();
-  vtkIdType m = outNms->GetNumberOfTuples();
-  double matrix[4][4];
-
   this->Update();
 
   // to transform the normal, multiply by the transposed inverse matrix
-  vtkMatrix4x4::DeepCopy(*matrix, this->Matrix);
-  vtkMatrix4x4::Invert(*matrix, *matrix);
-  vtkMatrix4x4::Transpose(*matrix, *matrix);
-
-  // operate directly on the memory to avoid GetTuple()/SetPoint() calls.
-  int inType = inNms->GetDataType();
-  int outType = outNms->GetDataType();
-  void* inPtr = inNms->GetVoidPointer(0);
-  void* outPtr = outNms->WriteVoidPointer(3 * m, 3 * n);
-
-  if (inType == VTK_FLOAT && outType == VTK_FLOAT)
-  {
-    vtkLinearTransformNormals(matrix, static_cast<float*>(inPtr), static_cast<float*>(outPtr), n);
-  }
-  else if (inType == VTK_FLOAT && outType == VTK_DOUBLE)
-  {
-    vtkLinearTransformNormals(matrix, static_cast<float*>(inPtr), static_cast<double*>(outPtr), n);
-  }
-  else if (inType == VTK_DOUBLE && outType == VTK_FLOAT)
-  {
-    vtkLinearTransformNormals(matrix, static_cast<double*>(inPtr), static_cast<float*>(outPtr), n);
-  }
-  else if (inType == VTK_DOUBLE && outType == VTK_DOUBLE)
-  {
-    vtkLinearTransformNormals(matrix, static_cast<double*>(inPtr), static_cast<double*>(outPtr), n);
-  }
-  else
-  {
-    for (vtkIdType i = 0; i < n; i++)
-    {
-      double norm[3];
-
-      inNms->GetTuple(i, norm);
-
-      // use TransformVector because matrix is already transposed & inverted
-      vtkLinearTransformVector(matrix, norm, norm);
-      vtkMath::Normalize(norm);
+  double matrix[4][4];
+  vtkLinearTransformNormalMatrix(this->Matrix, matrix);
 
-      outNms->SetTuple(m + i, norm);
-    }
-  }
+  vtkLinearTransformJobs(
+    { TransformJob(inNms, outNms, matrix, TupleKind::Normal) }, inNms->GetNumberOfTuples());
 }
 
 //------------------------------------------------------------------------------
 void vtkLinearTransform::TransformVectors(vtkDataArray* inVrs, vtkDataArray* outVrs)
 {
-  vtkIdType n = inVrs->GetNumberOfTuples();
-  vtkIdType m = outVrs->GetNumberOfTuples();
-
-  double(*matrix)[4] = this->Matrix->Element;
-
   this->Update();
 
-  // operate directly on the memory to avoid GetTuple()/SetTuple() calls.
-  int inType = inVrs->GetDataType();
-  int outType = outVrs->GetDataType();
-  void* inPtr = inVrs->GetVoidPointer(0);
-  void* outPtr = outVrs->WriteVoidPointer(3 * m, 3 * n);
-
-  if (inType == VTK_FLOAT && outType == VTK_FLOAT)
-  {
-    vtkLinearTransformVectors(matrix, static_cast<float*>(inPtr), static_cast<float*>(outPtr), n);
-  }
-  else if (inType == VTK_FLOAT && outType == VTK_DOUBLE)
-  {
-    vtkLinearTransformVectors(matrix, static_cast<float*>(inPtr), static_cast<double*>(outPtr), n);
-  }
-  else if (inType == VTK_DOUBLE && outType == VTK_FLOAT)
-  {
-    vtkLinearTransformVectors(matrix, static_cast<double*>(inPtr), static_cast<float*>(outPtr), n);
-  }
-  else if (inType == VTK_DOUBLE && outType == VTK_DOUBLE)
-  {
-    vtkLinearTransformVectors(matrix, static_cast<double*>(inPtr), static_cast<double*>(outPtr), n);
-  }
-  else
-  {
-    for (vtkIdType i = 0; i < n; i++)
-    {
-      double vec[3];
-
-      inVrs->GetTuple(i, vec);
-
-      vtkLinearTransformVector(matrix, vec, vec);
-
-      outVrs->SetTuple(m + i, vec);
-    }
-  }
+  vtkLinearTransformJobs(
+    { TransformJob(inVrs, outVrs, this->Matrix->Element, TupleKind::Vector) },
+    inVrs->GetNumberOfTuples());
 }
 VTK_ABI_NAMESPACE_END
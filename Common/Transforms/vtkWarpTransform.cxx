@@ -1,7 +1,12 @@
 // SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkWarpTransform.h"
+#include "vtkDataArray.h"
 #include "vtkMath.h"
+#include "vtkPoints.h"
+#include "vtkSMPTools.h"
+
+#include <vector>
 
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
@@ -234,6 +239,105 @@ void vtkWarpTransform::InverseTransformDerivative(
   vtkWarpInverseTransformPoint(this, point, output, derivative);
 }
 
+//------------------------------------------------------------------------------
+// The InternalTransformPoint() and InternalTransformDerivative() methods only
+// read the state of the transform once it is up to date, so that the points
+// can be transformed by several threads.
+void vtkWarpTransform::TransformPoints(vtkPoints* inPts, vtkPoints* outPts)
+{
+  this->Update();
+
+  const vtkIdType n = inPts->GetNumberOfPoints();
+  const vtkIdType m = outPts->GetNumberOfPoints();
+  outPts->SetNumberOfPoints(m + n);
+
+  vtkSMPTools::For(0, n, [&](vtkIdType begin, vtkIdType end) {
+    double point[3];
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      inPts->GetPoint(i, point);
+      this->InternalTransformPoint(point, point);
+      outPts->SetPoint(m + i, point);
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+// Normals are multiplied by the inverse transpose of the derivative of the
+// transformation, while vectors are simply multiplied by the derivative.
+void vtkWarpTransform::TransformPointsNormalsVectors(vtkPoints* inPts, vtkPoints* outPts,
+  vtkDataArray* inNms, vtkDataArray* outNms, vtkDataArray* inVrs, vtkDataArray* outVrs,
+  int nOptionalVectors, vtkDataArray** inVrsArr, vtkDataArray** outVrsArr)
+{
+  this->Update();
+
+  std::vector<vtkDataArray*> inVectors;
+  std::vector<vtkDataArray*> outVectors;
+  if (inVrs)
+  {
+    inVectors.push_back(inVrs);
+    outVectors.push_back(outVrs);
+  }
+  if (inVrsArr)
+  {
+    inVectors.insert(inVectors.end(), inVrsArr, inVrsArr + nOptionalVectors);
+    outVectors.insert(outVectors.end(), outVrsArr, outVrsArr + nOptionalVectors);
+  }
+
+  // The outputs are resized up front and the transformed tuples appended to
+  // the existing ones.
+  const vtkIdType n = inPts->GetNumberOfPoints();
+  const vtkIdType m = outPts->GetNumberOfPoints();
+  outPts->SetNumberOfPoints(m + n);
+  const vtkIdType mNms = inNms ? outNms->GetNumberOfTuples() : 0;
+  if (inNms)
+  {
+    if (mNms == 0)
+    {
+      outNms->SetNumberOfComponents(3);
+    }
+    outNms->SetNumberOfTuples(mNms + n);
+  }
+  std::vector<vtkIdType> mVectors(outVectors.size());
+  for (size_t iArr = 0; iArr < outVectors.size(); ++iArr)
+  {
+    mVectors[iArr] = outVectors[iArr]->GetNumberOfTuples();
+    if (mVectors[iArr] == 0)
+    {
+      outVectors[iArr]->SetNumberOfComponents(3);
+    }
+    outVectors[iArr]->SetNumberOfTuples(mVectors[iArr] + n);
+  }
+
+  vtkSMPTools::For(0, n, [&](vtkIdType begin, vtkIdType end) {
+    double matrix[3][3];
+    double point[3];
+    double coord[3];
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      inPts->GetPoint(i, point);
+      this->InternalTransformDerivative(point, point, matrix);
+      outPts->SetPoint(m + i, point);
+
+      for (size_t iArr = 0; iArr < inVectors.size(); ++iArr)
+      {
+        inVectors[iArr]->GetTuple(i, coord);
+        vtkMath::Multiply3x3(matrix, coord, coord);
+        outVectors[iArr]->SetTuple(mVectors[iArr] + i, coord);
+      }
+
+      if (inNms)
+      {
+        inNms->GetTuple(i, coord);
+        vtkMath::Transpose3x3(matrix, matrix);
+        vtkMath::LinearSolve3x3(matrix, coord, coord);
+        vtkMath::Normalize(coord);
+        outNms->SetTuple(mNms + i, coord);
+      }
+    }
+  });
+}
+
 //------------------------------------------------------------------------------
 // To invert the transformation, just set the InverseFlag.
 void vtkWarpTransform::Inverse()
@@ -61,6 +61,20 @@ public:
   vtkGetMacro(InverseIterations, int);
   ///@}
 
+  /**
+   * Apply the transformation to a series of points, and append the
+   * results to outPts.  The points are transformed in parallel.
+   */
+  void TransformPoints(vtkPoints* inPts, vtkPoints* outPts) override;
+
+  /**
+   * Apply the transformation to a combination of points, normals
+   * and vectors, in a single parallel pass over the points.
+   */
+  void TransformPointsNormalsVectors(vtkPoints* inPts, vtkPoints* outPts, vtkDataArray* inNms,
+    vtkDataArray* outNms, vtkDataArray* inVrs, vtkDataArray* outVrs, int nOptionalVectors = 0,
+    vtkDataArray** inVrsArr = nullptr, vtkDataArray** outVrsArr = nullptr) override;
+
   ///@{
   /**
    * This will calculate the transformation without calling Update.
@@ -8,18 +8,38 @@
 #include "vtkMolecule.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
-#include "vtkOctreePointLocator.h"
 #include "vtkPeriodicTable.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
+#include "vtkStaticPointLocator.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTrivialProducer.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnsignedShortArray.h"
 
+#include <algorithm>
 #include <vector>
 
+namespace
+{
+// A bond found between two atoms, the first one having the smallest id.
+struct PerceivedBond
+{
+  vtkIdType Atoms[2];
+  unsigned char Ghost;
+
+  bool operator<(const PerceivedBond& other) const
+  {
+    return this->Atoms[0] < other.Atoms[0] ||
+      (this->Atoms[0] == other.Atoms[0] && this->Atoms[1] < other.Atoms[1]);
+  }
+};
+}
+
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
 vtkObjectFactoryNewMacro(vtkSimpleBondPerceiver);
@@ -90,7 +110,7 @@ void vtkSimpleBondPerceiver::ComputeBonds(vtkMolecule* molecule)
 
   vtkNew<vtkPolyData> moleculePolyData;
   moleculePolyData->SetPoints(atomPositions);
-  vtkNew<vtkOctreePointLocator> locator;
+  vtkNew<vtkStaticPointLocator> locator;
   locator->SetDataSet(moleculePolyData.Get());
   locator->BuildLocator();
 
@@ -98,80 +118,106 @@ void vtkSimpleBondPerceiver::ComputeBonds(vtkMolecule* molecule)
   vtkUnsignedCharArray* ghostBonds = molecule->GetBondGhostArray();
 
   vtkIdType nbAtoms = molecule->GetNumberOfAtoms();
-  vtkNew<vtkIdList> neighborsIdsList;
   vtkNew<vtkPeriodicTable> periodicTable;
   int nbElementsPeriodicTable = periodicTable->GetNumberOfElements();
 
+  // Covalent radii with tolerance of the elements, and the largest of them to
+  // bound the search of the neighbors of an atom.
+  std::vector<double> covalentRadii(nbElementsPeriodicTable + 1, 0.0);
+  double maxCovalentRadius = 0.0;
+  for (int atomicNumber = 1; atomicNumber <= nbElementsPeriodicTable; ++atomicNumber)
+  {
+    covalentRadii[atomicNumber] =
+      this->GetCovalentRadiusWithTolerance(periodicTable, atomicNumber);
+    maxCovalentRadius = std::max(maxCovalentRadius, covalentRadii[atomicNumber]);
+  }
+
   /**
    * Main algorithm:
-   *  - loop on each atom.
-   *  - use locator to determine potential pair: consider atoms in a radius of 2*covalentRadius
-   *  - for each potential pair, compute atomic radius (with tolerance) and distance
-   *  - if (d < r1 + r2) add a bond. Do not add twice a same bond. Do not create bond between two
-   * ghost atoms.
+   *  - loop on each atom in parallel.
+   *  - use locator to determine potential pair: consider atoms in a radius of
+   *    covalentRadius + maxCovalentRadius, any bonded neighbor is within it.
+   *  - for each potential pair with a neighbor of larger id, so that each pair is only considered
+   *    once, compute atomic radius (with tolerance) and distance
+   *  - if (d < r1 + r2) add a bond. Do not create bond between two ghost atoms.
    *  - if one of the two atoms is a ghost, mark bond as ghost
+   * Bonds are gathered per thread then appended sorted by atom ids, so that the result does not
+   * depend on the number of threads.
    */
-  for (vtkIdType i = 0; i < nbAtoms; i++)
-  {
-    bool isGhostAtom = (ghostAtoms ? (ghostAtoms->GetTuple1(i) != 0) : false);
-    vtkIdType atomicNumber = molecule->GetAtomAtomicNumber(i);
-
-    if (atomicNumber < 1 || atomicNumber > nbElementsPeriodicTable)
-    {
-      continue;
-    }
-
-    double covalentRadius = this->GetCovalentRadiusWithTolerance(periodicTable, atomicNumber);
-    double atomPosition[3];
-    atomPositions->GetPoint(i, atomPosition);
-    neighborsIdsList->SetNumberOfIds(0);
-    locator->FindPointsWithinRadius(2 * covalentRadius, atomPosition, neighborsIdsList.Get());
-
-    vtkIdType nbNeighbors = neighborsIdsList->GetNumberOfIds();
-    vtkIdType* neighborsPtr = neighborsIdsList->GetPointer(0);
-    for (vtkIdType j = 0; j < nbNeighbors; ++j)
+  vtkSMPThreadLocalObject<vtkIdList> threadNeighbors;
+  vtkSMPThreadLocal<std::vector<PerceivedBond>> threadBonds;
+  vtkSMPTools::For(0, nbAtoms, [&](vtkIdType begin, vtkIdType end) {
+    vtkIdList* neighborsIdsList = threadNeighbors.Local();
+    std::vector<PerceivedBond>& bonds = threadBonds.Local();
+    for (vtkIdType i = begin; i < end; i++)
     {
-      vtkIdType neighId = neighborsPtr[j];
-      bool isGhostNeigh = (ghostAtoms ? (ghostAtoms->GetTuple1(neighId) != 0) : false);
-      vtkIdType atomicNumberNeigh = molecule->GetAtomAtomicNumber(neighId);
+      bool isGhostAtom = (ghostAtoms ? (ghostAtoms->GetValue(i) != 0) : false);
+      vtkIdType atomicNumber = molecule->GetAtomAtomicNumber(i);
 
-      if (atomicNumberNeigh < 1 || (atomicNumberNeigh > nbElementsPeriodicTable) ||
-        (isGhostAtom && isGhostNeigh))
+      if (atomicNumber < 1 || atomicNumber > nbElementsPeriodicTable)
       {
         continue;
       }
 
-      double covalentRadiusNeigh =
-        this->GetCovalentRadiusWithTolerance(periodicTable, atomicNumberNeigh);
-      double radiusSumSquare =
-        (covalentRadius + covalentRadiusNeigh) * (covalentRadius + covalentRadiusNeigh);
-      double doubleNeighbourRadiusSquare = 4 * covalentRadiusNeigh * covalentRadiusNeigh;
-      double atomPositionNeigh[3];
-      molecule->GetAtom(neighId).GetPosition(atomPositionNeigh);
-      double distanceSquare = vtkMath::Distance2BetweenPoints(atomPosition, atomPositionNeigh);
-
-      /**
-       * Bond may have already been created:
-       *  - neighId <= i : we already check bonds for atom 'neighId' in a previous iteration.
-       *  - distanceSquare <= doubleNeighbourRadiusSquare : atom 'i' was in the list for potential
-       *    pair with neighId.
-       *  So if the bond i-neighId is possible, it was added the first time and we can continue.
-       *
-       * Distance can be to big:
-       *  - distanceSquare > radiusSumSquare
-       */
-      if ((neighId <= i && distanceSquare <= doubleNeighbourRadiusSquare) ||
-        distanceSquare > radiusSumSquare)
-      {
-        continue;
-      }
+      double covalentRadius = covalentRadii[atomicNumber];
+      double atomPosition[3];
+      atomPositions->GetPoint(i, atomPosition);
+      neighborsIdsList->SetNumberOfIds(0);
+      locator->FindPointsWithinRadius(
+        covalentRadius + maxCovalentRadius, atomPosition, neighborsIdsList);
 
-      molecule->AppendBond(i, neighId);
-      if (ghostBonds)
+      vtkIdType nbNeighbors = neighborsIdsList->GetNumberOfIds();
+      vtkIdType* neighborsPtr = neighborsIdsList->GetPointer(0);
+      for (vtkIdType j = 0; j < nbNeighbors; ++j)
       {
-        ghostBonds->InsertNextValue(isGhostAtom || isGhostNeigh ? 1 : 0);
+        vtkIdType neighId = neighborsPtr[j];
+        if (neighId <= i)
+        {
+          continue;
+        }
+        bool isGhostNeigh = (ghostAtoms ? (ghostAtoms->GetValue(neighId) != 0) : false);
+        vtkIdType atomicNumberNeigh = molecule->GetAtomAtomicNumber(neighId);
+
+        if (atomicNumberNeigh < 1 || (atomicNumberNeigh > nbElementsPeriodicTable) ||
+          (isGhostAtom && isGhostNeigh))
+        {
+          continue;
+        }
+
+        double covalentRadiusNeigh = covalentRadii[atomicNumberNeigh];
+        double radiusSumSquare =
+          (covalentRadius + covalentRadiusNeigh) * (covalentRadius + covalentRadiusNeigh);
+        double atomPositionNeigh[3];
+        atomPositions->GetPoint(neighId, atomPositionNeigh);
+        double distanceSquare = vtkMath::Distance2BetweenPoints(atomPosition, atomPositionNeigh);
+        if (distanceSquare > radiusSumSquare)
+        {
+          continue;
+        }
+
+        PerceivedBond bond;
+        bond.Atoms[0] = i;
+        bond.Atoms[1] = neighId;
+        bond.Ghost = isGhostAtom || isGhostNeigh ? 1 : 0;
+        bonds.push_back(bond);
       }
     }
+  });
+
+  std::vector<PerceivedBond> bonds;
+  for (const auto& localBonds : threadBonds)
+  {
+    bonds.insert(bonds.end(), localBonds.begin(), localBonds.end());
+  }
+  vtkSMPTools::Sort(bonds.begin(), bonds.end());
+
+  for (const PerceivedBond& bond : bonds)
+  {
+    molecule->AppendBond(bond.Atoms[0], bond.Atoms[1]);
+    if (ghostBonds)
+    {
+      ghostBonds->InsertNextValue(bond.Ghost);
+    }
   }
 }
 
@@ -12,6 +12,10 @@
  * interatomic distance is less than the sum of the two atom's covalent radii
  * plus a tolerance, a single bond is added.
  *
+ * The candidate pairs are found with a vtkStaticPointLocator and the atoms
+ * are processed in parallel with vtkSMPTools. The bonds are appended sorted
+ * by the ids of their atoms.
+ *
  *
  * @warning
  * This algorithm does not consider valences, hybridization, aromaticity, or
@@ -20,23 +20,192 @@
 #include "vtkObjectFactory.h"
 #include "vtkOverlappingAMR.h"
 #include "vtkPointData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUniformGrid.h"
 #include "vtkUniformGridPartitioner.h"
 
-#include "vtkTimerLog.h"
 
 #include <algorithm>
 #include <cassert>
 #include <cmath>
-#include <sstream>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkAMRResampleFilter);
 vtkCxxSetObjectMacro(vtkAMRResampleFilter, Controller, vtkMultiProcessController);
 
+//------------------------------------------------------------------------------
+// Uniform binning of the bounds of the AMR boxes of each level, with about one
+// box per bin. The ids of the boxes overlapping a bin are stored in ascending
+// order so that testing the candidates of a bin finds the same grid as testing
+// all the grids of the level.
+class vtkAMRResampleFilter::vtkLevelBoxIndex
+{
+public:
+  bool IsBuiltFor(vtkOverlappingAMR* amrds) const
+  {
+    return this->Source == amrds && this->SourceMTime == amrds->GetMTime();
+  }
+
+  void Build(vtkOverlappingAMR* amrds)
+  {
+    this->Source = amrds;
+    this->SourceMTime = amrds->GetMTime();
+    this->Levels.clear();
+    this->Levels.resize(amrds->GetNumberOfLevels());
+    vtkSMPTools::For(0, static_cast<vtkIdType>(this->Levels.size()),
+      [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType level = begin; level < end; ++level)
+        {
+          this->BuildLevel(amrds, static_cast<unsigned int>(level));
+        }
+      });
+  }
+
+  void Clear()
+  {
+    this->Source = nullptr;
+    this->SourceMTime = 0;
+    this->Levels.clear();
+  }
+
+  /**
+   * Returns the range of the ids of the boxes of the level that may contain q,
+   * or false if the level is not indexed.
+   */
+  bool GetCandidates(unsigned int level, const double q[3], const unsigned int*& begin,
+    const unsigned int*& end) const
+  {
+    if (level >= this->Levels.size())
+    {
+      return false;
+    }
+    const Level& lvl = this->Levels[level];
+    begin = end = nullptr;
+    if (lvl.Ids.empty() || !lvl.Bounds.ContainsPoint(q))
+    {
+      return true;
+    }
+    int ijk[3];
+    for (int dim = 0; dim < 3; ++dim)
+    {
+      ijk[dim] = lvl.GetBin(q[dim], dim);
+    }
+    const vtkIdType bin = ijk[0] + lvl.Dims[0] * (ijk[1] + lvl.Dims[1] * ijk[2]);
+    begin = lvl.Ids.data() + lvl.Offsets[bin];
+    end = lvl.Ids.data() + lvl.Offsets[bin + 1];
+    return true;
+  }
+
+private:
+  struct Level
+  {
+    vtkBoundingBox Bounds;
+    double Origin[3] = { 0.0, 0.0, 0.0 };
+    double InvBinSize[3] = { 0.0, 0.0, 0.0 };
+    int Dims[3] = { 1, 1, 1 };
+    std::vector<vtkIdType> Offsets;
+    std::vector<unsigned int> Ids;
+
+    // Monotonic in x, so a point within the bounds of a box always falls in
+    // one of the bins the box was inserted in.
+    int GetBin(double x, int dim) const
+    {
+      const double t = (x - this->Origin[dim]) * this->InvBinSize[dim];
+      if (t <= 0.0)
+      {
+        return 0;
+      }
+      return t >= this->Dims[dim] - 1 ? this->Dims[dim] - 1 : static_cast<int>(t);
+    }
+  };
+
+  void BuildLevel(vtkOverlappingAMR* amrds, unsigned int level)
+  {
+    Level& lvl = this->Levels[level];
+    const unsigned int numBoxes = amrds->GetNumberOfDataSets(level);
+    if (numBoxes == 0)
+    {
+      return;
+    }
+    std::vector<double> boxBounds(6 * static_cast<std::size_t>(numBoxes));
+    for (unsigned int id = 0; id < numBoxes; ++id)
+    {
+      amrds->GetAMRInfo()->GetBounds(level, id, &boxBounds[6 * id]);
+      lvl.Bounds.AddBounds(&boxBounds[6 * id]);
+    }
+
+    int numDims = 0;
+    for (int dim = 0; dim < 3; ++dim)
+    {
+      numDims += lvl.Bounds.GetLength(dim) > 0.0 ? 1 : 0;
+    }
+    const int res = numDims == 0
+      ? 1
+      : std::max(1, static_cast<int>(std::ceil(std::pow(numBoxes, 1.0 / numDims))));
+    lvl.Bounds.GetMinPoint(lvl.Origin);
+    for (int dim = 0; dim < 3; ++dim)
+    {
+      const double length = lvl.Bounds.GetLength(dim);
+      lvl.Dims[dim] = length > 0.0 ? res : 1;
+      lvl.InvBinSize[dim] = length > 0.0 ? res / length : 0.0;
+    }
+
+    // Count the boxes of each bin, then fill the bins in the order of the ids
+    const vtkIdType numBins = static_cast<vtkIdType>(lvl.Dims[0]) * lvl.Dims[1] * lvl.Dims[2];
+    lvl.Offsets.assign(numBins + 1, 0);
+    for (int pass = 0; pass < 2; ++pass)
+    {
+      std::vector<vtkIdType> cursor;
+      if (pass == 1)
+      {
+        for (vtkIdType bin = 0; bin < numBins; ++bin)
+        {
+          lvl.Offsets[bin + 1] += lvl.Offsets[bin];
+        }
+        lvl.Ids.resize(lvl.Offsets[numBins]);
+        cursor.assign(lvl.Offsets.begin(), lvl.Offsets.end() - 1);
+      }
+      for (unsigned int id = 0; id < numBoxes; ++id)
+      {
+        const double* bb = &boxBounds[6 * id];
+        int lo[3], hi[3];
+        for (int dim = 0; dim < 3; ++dim)
+        {
+          lo[dim] = lvl.GetBin(bb[2 * dim], dim);
+          hi[dim] = lvl.GetBin(bb[2 * dim + 1], dim);
+        }
+        for (int k = lo[2]; k <= hi[2]; ++k)
+        {
+          for (int j = lo[1]; j <= hi[1]; ++j)
+          {
+            for (int i = lo[0]; i <= hi[0]; ++i)
+            {
+              const vtkIdType bin = i + lvl.Dims[0] * (j + static_cast<vtkIdType>(lvl.Dims[1]) * k);
+              if (pass == 0)
+              {
+                ++lvl.Offsets[bin + 1];
+              }
+              else
+              {
+                lvl.Ids[cursor[bin]++] = id;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  vtkOverlappingAMR* Source = nullptr;
+  vtkMTimeType SourceMTime = 0;
+  std::vector<Level> Levels;
+};
+
 //------------------------------------------------------------------------------
 vtkAMRResampleFilter::vtkAMRResampleFilter()
+  : BoxIndex(new vtkLevelBoxIndex)
 {
   this->TransferToNodes = 1;
   this->DemandDrivenMode = 0;
@@ -357,24 +526,41 @@ void vtkAMRResampleFilter::TransferToCellCenters(vtkUniformGrid* g, vtkOverlappi
 
 //------------------------------------------------------------------------------
 bool vtkAMRResampleFilter::SearchForDonorGridAtLevel(double q[3], vtkOverlappingAMR* amrds,
-  unsigned int level, unsigned int& donorGridId, int& donorCellIdx)
+  unsigned int level, unsigned int& donorGridId, int& donorCellIdx, SearchStatistics& stats)
 {
   assert("pre: AMR dataset is nullptr" && (amrds != nullptr));
-  this->NumberOfBlocksTestedForLevel = 0;
-  std::ostringstream oss;
-  oss << "SearchLevel-" << level;
-
-  vtkTimerLog::MarkStartEvent(oss.str().c_str());
+  stats.NumberOfBlocksTestedForLevel = 0;
+
+  // Only test the grids near the point when the level is indexed, the
+  // candidates are sorted by id so the first grid found is the same as with
+  // a linear search of the level.
+  const unsigned int* candidate = nullptr;
+  const unsigned int* lastCandidate = nullptr;
+  if (this->BoxIndex->IsBuiltFor(amrds) &&
+    this->BoxIndex->GetCandidates(level, q, candidate, lastCandidate))
+  {
+    for (; candidate != lastCandidate; ++candidate)
+    {
+      donorCellIdx = -1;
+      stats.NumberOfBlocksTestedForLevel++;
+      if (amrds->GetAMRInfo()->FindCell(q, level, *candidate, donorCellIdx))
+      {
+        assert("pre: donorCellIdx is invalid" && (donorCellIdx >= 0));
+        donorGridId = *candidate;
+        return true;
+      }
+    }
+    return false;
+  }
 
   for (donorGridId = 0; donorGridId < amrds->GetNumberOfDataSets(level); ++donorGridId)
   {
     donorCellIdx = -1;
-    this->NumberOfBlocksTestedForLevel++;
+    stats.NumberOfBlocksTestedForLevel++;
     if (amrds->GetAMRInfo()->FindCell(q, level, donorGridId, donorCellIdx))
     {
       assert("pre: donorCellIdx is invalid" && (donorCellIdx >= 0)); //  &&
       // (donorCellIdx < donorGrid->GetNumberOfCells()) );
-      vtkTimerLog::MarkEndEvent(oss.str().c_str());
       return true;
     } // END if
 
@@ -382,13 +568,13 @@ bool vtkAMRResampleFilter::SearchForDonorGridAtLevel(double q[3], vtkOverlapping
 
   // No suitable grid is found at the requested level, set donorGrid to nullptr
   // to indicate that to the caller.
-  vtkTimerLog::MarkEndEvent(oss.str().c_str());
   return false;
 }
 
 //------------------------------------------------------------------------------
 int vtkAMRResampleFilter::ProbeGridPointInAMR(double q[3], unsigned int& donorLevel,
-  unsigned int& donorGridId, vtkOverlappingAMR* amrds, unsigned int maxLevel, bool hadDonorGrid)
+  unsigned int& donorGridId, vtkOverlappingAMR* amrds, unsigned int maxLevel, bool hadDonorGrid,
+  SearchStatistics& stats)
 {
   assert("pre: AMR dataset is nullptr" && amrds != nullptr);
 
@@ -402,14 +588,15 @@ int vtkAMRResampleFilter::ProbeGridPointInAMR(double q[3], unsigned int& donorLe
   // STEP 0: Check the previously cached donor-grid
   if (hadDonorGrid)
   {
-    this->NumberOfBlocksTested++;
+    stats.NumberOfBlocksTested++;
     bool res(true);
     if (!amrds->GetAMRInfo()->FindCell(q, donorLevel, donorGridId, donorCellIdx))
     {
       // Lets see if the point is contained by a grid at the same donar level
-      res = this->SearchForDonorGridAtLevel(q, amrds, donorLevel, donorGridId, donorCellIdx);
+      res =
+        this->SearchForDonorGridAtLevel(q, amrds, donorLevel, donorGridId, donorCellIdx, stats);
       donorGrid = res ? amrds->GetDataSet(donorLevel, donorGridId) : nullptr;
-      this->NumberOfBlocksTested += this->NumberOfBlocksTestedForLevel;
+      stats.NumberOfBlocksTested += stats.NumberOfBlocksTestedForLevel;
     }
 
     // If donorGrid is still not nullptr then we found the grid and potential starting
@@ -419,7 +606,7 @@ int vtkAMRResampleFilter::ProbeGridPointInAMR(double q[3], unsigned int& donorLe
       assert("pre: donorCellIdx is invalid" && (donorCellIdx >= 0) &&
         (donorCellIdx < donorGrid->GetNumberOfCells()));
 
-      this->NumberOfTimesFoundOnDonorLevel++;
+      stats.NumberOfTimesFoundOnDonorLevel++;
 
       // Initialize values for step 1 s.t. that the search will start from the
       // current donorLevel
@@ -433,7 +620,7 @@ int vtkAMRResampleFilter::ProbeGridPointInAMR(double q[3], unsigned int& donorLe
     {
       // if we are here then the point is not contained in any of the level 0
       // blocks!
-      this->NumberOfFailedPoints++;
+      stats.NumberOfFailedPoints++;
       donorGrid = nullptr;
       donorLevel = 0;
       return -1;
@@ -473,16 +660,16 @@ int vtkAMRResampleFilter::ProbeGridPointInAMR(double q[3], unsigned int& donorLe
   {
     if (incLevel == 1)
     {
-      this->NumberOfTimesLevelUp++;
+      stats.NumberOfTimesLevelUp++;
     }
     else
     {
-      this->NumberOfTimesLevelDown++;
+      stats.NumberOfTimesLevelDown++;
     }
-    bool res = this->SearchForDonorGridAtLevel(q, amrds, level, donorGridId, donorCellIdx);
+    bool res = this->SearchForDonorGridAtLevel(q, amrds, level, donorGridId, donorCellIdx, stats);
     donorGrid = res ? amrds->GetDataSet(level, donorGridId) : nullptr;
 
-    this->NumberOfBlocksTested += this->NumberOfBlocksTestedForLevel;
+    stats.NumberOfBlocksTested += stats.NumberOfBlocksTestedForLevel;
     if (res)
     {
       donorLevel = level;
@@ -513,7 +700,7 @@ int vtkAMRResampleFilter::ProbeGridPointInAMR(double q[3], unsigned int& donorLe
       // resolution, so we will use the solution we found previously
       // THIS SHOULD NOW NOT HAPPEN!!
       // vtkErrorMacro("Could not find point in an unblanked cell.");
-      this->NumberOfBlocksVisSkipped += this->NumberOfBlocksTestedForLevel;
+      stats.NumberOfBlocksVisSkipped += stats.NumberOfBlocksTestedForLevel;
       donorGrid = currentGrid;
       donorCellIdx = currentCellIdx;
       donorLevel = currentLevel;
@@ -525,7 +712,7 @@ int vtkAMRResampleFilter::ProbeGridPointInAMR(double q[3], unsigned int& donorLe
     {
       // we are not able to find a grid/cell that contains the query point, in
       // this case we will just return.
-      this->NumberOfFailedPoints++;
+      stats.NumberOfFailedPoints++;
       donorCellIdx = -1;
       donorGrid = nullptr;
       donorLevel = 0;
@@ -537,14 +724,14 @@ int vtkAMRResampleFilter::ProbeGridPointInAMR(double q[3], unsigned int& donorLe
 }
 
 //------------------------------------------------------------------------------
-bool vtkAMRResampleFilter::SearchGridAncestors(
-  double q[3], vtkOverlappingAMR* amrds, unsigned int& level, unsigned int& gridId, int& cellId)
+bool vtkAMRResampleFilter::SearchGridAncestors(double q[3], vtkOverlappingAMR* amrds,
+  unsigned int& level, unsigned int& gridId, int& cellId, SearchStatistics& stats)
 {
   assert("pre: AMR dataset is nullptr" && (amrds != nullptr));
   unsigned int *parents, plevel;
   for (; level > 0; --level)
   {
-    ++this->NumberOfTimesLevelUp;
+    ++stats.NumberOfTimesLevelUp;
     // Get the parents of the grid
 
     unsigned int numParents;
@@ -570,7 +757,8 @@ bool vtkAMRResampleFilter::SearchGridAncestors(
 
 //------------------------------------------------------------------------------
 void vtkAMRResampleFilter::SearchGridDecendants(double q[3], vtkOverlappingAMR* amrds,
-  unsigned int maxLevel, unsigned int& level, unsigned int& gridId, int& cellId)
+  unsigned int maxLevel, unsigned int& level, unsigned int& gridId, int& cellId,
+  SearchStatistics& stats)
 {
   assert("pre: AMR dataset is nullptr" && (amrds != nullptr));
   unsigned int *children, clevel, n, i;
@@ -593,7 +781,7 @@ void vtkAMRResampleFilter::SearchGridDecendants(double q[3], vtkOverlappingAMR*
         // children and can instead search that grid's
         // children
         gridId = children[i];
-        ++this->NumberOfTimesLevelDown;
+        ++stats.NumberOfTimesLevelDown;
         break;
       }
     }
@@ -601,7 +789,7 @@ void vtkAMRResampleFilter::SearchGridDecendants(double q[3], vtkOverlappingAMR*
     {
       // We tested some children that we didn't need to if
       // we had visibility info
-      this->NumberOfBlocksVisSkipped += n;
+      stats.NumberOfBlocksVisSkipped += n;
       // If we are here then no child contains the point
       // so don't search any further
       return;
@@ -611,7 +799,8 @@ void vtkAMRResampleFilter::SearchGridDecendants(double q[3], vtkOverlappingAMR*
 
 //------------------------------------------------------------------------------
 int vtkAMRResampleFilter::ProbeGridPointInAMRGraph(double q[3], unsigned int& donorLevel,
-  unsigned int& donorGridId, vtkOverlappingAMR* amrds, unsigned int maxLevel, bool useCached)
+  unsigned int& donorGridId, vtkOverlappingAMR* amrds, unsigned int maxLevel, bool useCached,
+  SearchStatistics& stats)
 {
   assert("pre: AMR dataset is nullptr" && amrds != nullptr);
 
@@ -624,13 +813,14 @@ int vtkAMRResampleFilter::ProbeGridPointInAMRGraph(double q[3], unsigned int& do
     if (!amrds->GetAMRInfo()->FindCell(q, donorLevel, donorGridId, donorCellIdx))
     {
       // Lets find the grid's ancestor that contains the point
-      bool res = this->SearchGridAncestors(q, amrds, donorLevel, donorGridId, donorCellIdx);
+      bool res =
+        this->SearchGridAncestors(q, amrds, donorLevel, donorGridId, donorCellIdx, stats);
       donorGrid = res ? amrds->GetDataSet(donorLevel, donorGridId) : nullptr;
     }
     else
     {
       donorGrid = amrds->GetDataSet(donorLevel, donorGridId);
-      ++this->NumberOfTimesFoundOnDonorLevel;
+      ++stats.NumberOfTimesFoundOnDonorLevel;
     }
     // if the point is not contained in an ancestor then lets just assume its on level
     // 0 which is the default
@@ -639,19 +829,19 @@ int vtkAMRResampleFilter::ProbeGridPointInAMRGraph(double q[3], unsigned int& do
   // If there is no initial donor grid then search level 0
   if (donorGrid == nullptr)
   {
-    bool res = SearchForDonorGridAtLevel(q, amrds, 0, donorGridId, donorCellIdx);
+    bool res = this->SearchForDonorGridAtLevel(q, amrds, 0, donorGridId, donorCellIdx, stats);
     // If we still can't find a grid then the point is not contained in the
     // AMR Data
     if (!res)
     {
-      this->NumberOfFailedPoints++;
+      stats.NumberOfFailedPoints++;
       donorLevel = 0;
       return -1;
     }
   }
 
   // Now search the descendants of the donor grid
-  this->SearchGridDecendants(q, amrds, maxLevel, donorLevel, donorGridId, donorCellIdx);
+  this->SearchGridDecendants(q, amrds, maxLevel, donorLevel, donorGridId, donorCellIdx, stats);
   return (donorCellIdx);
 }
 
@@ -699,63 +889,76 @@ void vtkAMRResampleFilter::TransferToGridNodes(vtkUniformGrid* g, vtkOverlapping
     maxLevelToLoad = amrds->GetNumberOfLevels();
   }
 
-  // STEP 3: Loop through all the points and find the donors.
-  unsigned int donorLevel = 0;
-  unsigned int donorGridId = 0;
-  double qPoint[3];
-  vtkIdType pIdx;
-  int donorCellIdx;
-  bool useCached(false);
-  // Do we have parent/child meta information (yes, we always do)
-  if (this->AMRMetaData)
+  // STEP 3: Loop through all the points and find the donors. Each row of
+  // nodes along x is processed by a single thread that caches the donor grid
+  // of the previous node, so the donors do not depend on the number of threads.
+  if (!this->BoxIndex->IsBuiltFor(amrds))
   {
-    for (pIdx = 0; pIdx < g->GetNumberOfPoints(); ++pIdx)
+    this->BoxIndex->Build(amrds);
+  }
+  int dims[3];
+  g->GetDimensions(dims);
+  const vtkIdType rowSize = dims[0];
+  const vtkIdType numRows = rowSize > 0 ? g->GetNumberOfPoints() / rowSize : 0;
+  // Do we have parent/child meta information (yes, we always do)
+  const bool useGraph = this->AMRMetaData != nullptr;
+
+  vtkSMPThreadLocal<SearchStatistics> localStats;
+  vtkSMPThreadLocal<std::vector<vtkIdType>> localOutsidePoints;
+  vtkSMPTools::For(0, numRows, [&](vtkIdType beginRow, vtkIdType endRow) {
+    SearchStatistics& stats = localStats.Local();
+    std::vector<vtkIdType>& outsidePoints = localOutsidePoints.Local();
+    double qPoint[3];
+    for (vtkIdType row = beginRow; row < endRow; ++row)
     {
-      g->GetPoint(pIdx, qPoint);
-      donorCellIdx = this->ProbeGridPointInAMRGraph(
-        qPoint, donorLevel, donorGridId, amrds, maxLevelToLoad, useCached);
-      if (donorCellIdx != -1)
+      unsigned int donorLevel = 0;
+      unsigned int donorGridId = 0;
+      bool useCached(false);
+      for (vtkIdType pIdx = row * rowSize; pIdx < (row + 1) * rowSize; ++pIdx)
       {
-        useCached = true;
-        vtkUniformGrid* amrGrid = amrds->GetDataSet(donorLevel, donorGridId);
-        this->AverageLevel += donorLevel;
-        CD = amrGrid->GetCellData();
-        this->CopyData(PD, pIdx, CD, donorCellIdx);
-      }
-      else
-      {
-        useCached = false;
-        // Point is outside the domain, blank it
-        g->BlankPoint(pIdx);
-      }
-    } // END for all grid nodes
+        g->GetPoint(pIdx, qPoint);
+        int donorCellIdx = useGraph
+          ? this->ProbeGridPointInAMRGraph(
+              qPoint, donorLevel, donorGridId, amrds, maxLevelToLoad, useCached, stats)
+          : this->ProbeGridPointInAMR(
+              qPoint, donorLevel, donorGridId, amrds, maxLevelToLoad, useCached, stats);
+
+        if (donorCellIdx != -1)
+        {
+          useCached = true;
+          stats.AverageLevel += donorLevel;
+          vtkUniformGrid* donorGrid = amrds->GetDataSet(donorLevel, donorGridId);
+          assert(donorGrid != nullptr);
+          this->CopyData(PD, pIdx, donorGrid->GetCellData(), donorCellIdx);
+        }
+        else
+        {
+          useCached = false;
+          // Point is outside the domain, it is blanked once all rows are done
+          outsidePoints.push_back(pIdx);
+        }
+      } // END for all nodes of the row
+    }   // END for all rows
+  });
+
+  for (const SearchStatistics& stats : localStats)
+  {
+    this->NumberOfBlocksTested += stats.NumberOfBlocksTested;
+    this->NumberOfBlocksVisSkipped += stats.NumberOfBlocksVisSkipped;
+    this->NumberOfTimesFoundOnDonorLevel += stats.NumberOfTimesFoundOnDonorLevel;
+    this->NumberOfTimesLevelUp += stats.NumberOfTimesLevelUp;
+    this->NumberOfTimesLevelDown += stats.NumberOfTimesLevelDown;
+    this->NumberOfFailedPoints += stats.NumberOfFailedPoints;
+    this->AverageLevel += stats.AverageLevel;
   }
-  else
+  for (const std::vector<vtkIdType>& outsidePoints : localOutsidePoints)
   {
-    for (pIdx = 0; pIdx < g->GetNumberOfPoints(); ++pIdx)
+    for (vtkIdType pIdx : outsidePoints)
     {
-      g->GetPoint(pIdx, qPoint);
-
-      donorCellIdx = this->ProbeGridPointInAMR(
-        qPoint, donorLevel, donorGridId, amrds, maxLevelToLoad, useCached);
-
-      if (donorCellIdx != -1)
-      {
-        useCached = true;
-        this->AverageLevel += donorLevel;
-        vtkUniformGrid* donorGrid = amrds->GetDataSet(donorLevel, donorGridId);
-        assert(donorGrid != nullptr);
-        CD = donorGrid->GetCellData();
-        this->CopyData(PD, pIdx, CD, donorCellIdx);
-      }
-      else
-      {
-        useCached = false;
-        // Point is outside the domain, blank it
-        g->BlankPoint(pIdx);
-      }
-    } // END for all grid nodes
+      g->BlankPoint(pIdx);
+    }
   }
+
   std::cerr << "********* Resample Stats *************\n";
   double c = this->NumberOfSamples[0] * this->NumberOfSamples[1] * this->NumberOfSamples[2];
   double b = g->GetNumberOfPoints();
@@ -832,6 +1035,7 @@ void vtkAMRResampleFilter::ExtractRegion(
       mbds->SetBlock(block, nullptr);
     }
   } // END for all blocks
+  this->BoxIndex->Clear();
 }
 
 //------------------------------------------------------------------------------
@@ -23,6 +23,7 @@
 
 #include "vtkFiltersAMRModule.h" // For export macro
 #include "vtkMultiBlockDataSetAlgorithm.h"
+#include <memory> // For std::unique_ptr
 #include <vector> // For STL vector
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -171,6 +172,23 @@ protected:
 
   std::vector<int> BlocksToLoad; // Holds the ids of the blocks to load.
 
+  /**
+   * Counters of the donor searches done while transferring the solution.
+   * Each thread of the transfer accumulates its own counters, they are summed
+   * into the debugging ivars above once all the points are processed.
+   */
+  struct SearchStatistics
+  {
+    int NumberOfBlocksTestedForLevel = 0;
+    int NumberOfBlocksTested = 0;
+    int NumberOfBlocksVisSkipped = 0;
+    int NumberOfTimesFoundOnDonorLevel = 0;
+    int NumberOfTimesLevelUp = 0;
+    int NumberOfTimesLevelDown = 0;
+    int NumberOfFailedPoints = 0;
+    double AverageLevel = 0.0;
+  };
+
   /**
    * Checks if this filter instance is running on more than one processes
    */
@@ -215,10 +233,11 @@ protected:
   /**
    * Given a query point q and a target level, this method finds a suitable
    * grid at the given level that contains the point if one exists. If a grid
-   * is not found, donorGrid is set to nullptr.
+   * is not found, donorGrid is set to nullptr. Only the grids whose bounds
+   * overlap the bin of q in the spatial index of the level are tested.
    */
   bool SearchForDonorGridAtLevel(double q[3], vtkOverlappingAMR* amrds, unsigned int level,
-    unsigned int& gridId, int& donorCellIdx);
+    unsigned int& gridId, int& donorCellIdx, SearchStatistics& stats);
 
   /**
    * Finds the AMR grid that contains the point q. If donorGrid points to a
@@ -227,7 +246,8 @@ protected:
    * contains the probe point q.
    */
   int ProbeGridPointInAMR(double q[3], unsigned int& donorLevel, unsigned int& donorGridId,
-    vtkOverlappingAMR* amrds, unsigned int maxLevel, bool hadDonorGrid);
+    vtkOverlappingAMR* amrds, unsigned int maxLevel, bool hadDonorGrid,
+    SearchStatistics& stats);
 
   /**
    * Finds the AMR grid that contains the point q. If donorGrid points to a
@@ -236,7 +256,7 @@ protected:
    * contains the probe point q. - Makes use of Parent/Child Info
    */
   int ProbeGridPointInAMRGraph(double q[3], unsigned int& donorLevel, unsigned int& donorGridId,
-    vtkOverlappingAMR* amrds, unsigned int maxLevel, bool useCached);
+    vtkOverlappingAMR* amrds, unsigned int maxLevel, bool useCached, SearchStatistics& stats);
 
   /**
    * Transfers the solution from the AMR dataset to the cell-centers of
@@ -246,7 +266,8 @@ protected:
 
   /**
    * Transfer the solution from the AMR dataset to the nodes of the
-   * given uniform grid.
+   * given uniform grid. The rows of nodes of the grid are processed in
+   * parallel.
    */
   void TransferToGridNodes(vtkUniformGrid* g, vtkOverlappingAMR* amrds);
 
@@ -350,18 +371,22 @@ protected:
    * The search is limited to levels < maxLevel
    */
   void SearchGridDecendants(double q[3], vtkOverlappingAMR* amrds, unsigned int maxLevel,
-    unsigned int& level, unsigned int& gridId, int& id);
+    unsigned int& level, unsigned int& gridId, int& id, SearchStatistics& stats);
 
   /**
    * Find an ancestor of the specified grid that contains the point.
    * If none is found then the original grid information is returned
    */
-  bool SearchGridAncestors(
-    double q[3], vtkOverlappingAMR* amrds, unsigned int& level, unsigned int& gridId, int& id);
+  bool SearchGridAncestors(double q[3], vtkOverlappingAMR* amrds, unsigned int& level,
+    unsigned int& gridId, int& id, SearchStatistics& stats);
 
 private:
   vtkAMRResampleFilter(const vtkAMRResampleFilter&) = delete;
   void operator=(const vtkAMRResampleFilter&) = delete;
+
+  // Per-level spatial index of the AMR boxes used by the donor searches.
+  class vtkLevelBoxIndex;
+  std::unique_ptr<vtkLevelBoxIndex> BoxIndex;
 };
 
 VTK_ABI_NAMESPACE_END
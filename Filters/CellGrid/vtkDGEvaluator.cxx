@@ -14,6 +14,9 @@
 #include "vtkInterpolateCalculator.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkStaticPointLocator.h"
 #include "vtkStringToken.h"
 #include "vtkTypeInt64Array.h"
@@ -24,6 +27,7 @@
 #include VTK_EIGEN(Eigen)
 
 #include <unordered_set>
+#include <utility>
 
 // Switch the following to #define to get debug printouts. Beware, these are in a tight loop.
 #undef VTK_DBG_DGEVAL
@@ -194,9 +198,6 @@ bool vtkDGEvaluator::ClassifyPoints(
     return false;
   }
   vtkIdType numCells = conn->GetNumberOfTuples();
-  vtkVector3d center;
-  double radius;
-  vtkNew<vtkIdList> searchPoints;
   // A classifier for determining whether a point is inside or outside a DG cell.
   // We rely on the fact that the DG cells are easy to bound with related convex planes.
   // If the point is inside every boundary's half-space, the point is inside.
@@ -211,10 +212,6 @@ bool vtkDGEvaluator::ClassifyPoints(
   int numCorners = dgCell->GetNumberOfCorners();
   int dim = dgCell->GetDimension();
   auto cellShape = dgCell->GetShape();
-  std::vector<vtkTypeInt64Array::ValueType> cellConn;
-  std::vector<vtkVector3d> cellCorners;
-  cellConn.resize(numCorners);
-  cellCorners.resize(numCorners);
   auto classifier = [&](vtkTypeUInt64 cellId, const vtkVector3d& testPoint,
                       const std::vector<vtkVector3d>& cellCornerData) {
     (void)cellId;
@@ -263,35 +260,46 @@ bool vtkDGEvaluator::ClassifyPoints(
   };
   auto& alloc = query->GetAllocationsForCellType(cellType->GetClassName());
   auto* inputPoints = query->GetInputPoints();
-  vtkNew<vtkIdList> testPointIDs;
-  vtkVector3d testPoint;
-  for (vtkIdType ii = 0; ii < numCells; ++ii)
-  {
-    // Get corner point IDs
-    conn->GetTypedTuple(ii, cellConn.data());
-    // Get corner point coordinates
-    for (int jj = 0; jj < numCorners; ++jj)
-    {
-      coords->GetTuple(cellConn[jj], cellCorners[jj].GetData());
-    }
-    centerAndRadiusOfCellPoints(cellCorners, center, radius);
-    locator->FindPointsWithinRadius(radius, center.GetData(), testPointIDs);
-    for (const auto& testPointID : *testPointIDs)
+  // Cells are classified in parallel; each thread collects the (point, cell)
+  // pairs it finds and they are merged into \a alloc afterward. Since
+  // \a alloc orders points and cells, the result does not depend on threading.
+  vtkSMPThreadLocal<std::vector<std::pair<vtkIdType, vtkIdType>>> containment;
+  vtkSMPThreadLocalObject<vtkIdList> testPointIDs;
+  vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+    auto& found = containment.Local();
+    auto* candidates = testPointIDs.Local();
+    std::vector<vtkTypeInt64Array::ValueType> cellConn(numCorners);
+    std::vector<vtkVector3d> cellCorners(numCorners);
+    vtkVector3d center;
+    double radius;
+    vtkVector3d testPoint;
+    for (vtkIdType ii = begin; ii < end; ++ii)
     {
-      inputPoints->GetTuple(testPointID, testPoint.GetData());
-      if (classifier(ii, testPoint, cellCorners))
+      // Get corner point IDs
+      conn->GetTypedTuple(ii, cellConn.data());
+      // Get corner point coordinates
+      for (int jj = 0; jj < numCorners; ++jj)
+      {
+        coords->GetTuple(cellConn[jj], cellCorners[jj].GetData());
+      }
+      centerAndRadiusOfCellPoints(cellCorners, center, radius);
+      locator->FindPointsWithinRadius(radius, center.GetData(), candidates);
+      for (const auto& testPointID : *candidates)
       {
-        alloc.InputPoints[testPointID].insert(ii);
-        if (alloc.InputPoints.size() == static_cast<std::size_t>(inputPoints->GetNumberOfTuples()))
+        inputPoints->GetTuple(testPointID, testPoint.GetData());
+        if (classifier(ii, testPoint, cellCorners))
         {
-          // We have consumed all the input points with already-processed cells.
-          // NB: If a point lies in multiple cells (i.e., cells overlap or one
-          // cell forms the boundary of another), then returning now will fail
-          // to report all the containing cells).
-          // return true;
+          found.emplace_back(testPointID, ii);
         }
       }
     }
+  });
+  for (auto& found : containment)
+  {
+    for (const auto& entry : found)
+    {
+      alloc.InputPoints[entry.first].insert(entry.second);
+    }
   }
   return true;
 }
@@ -316,30 +324,37 @@ bool vtkDGEvaluator::EvaluatePositions(
   auto cellIds = query->GetClassifierCellIndices();
   auto pointParams = query->GetClassifierPointParameters();
   auto& alloc = query->GetAllocationsForCellType(dgCell->GetClassName());
-  vtkIdType outputPointId = alloc.Offset;
-  int numCorners = dgCell->GetNumberOfCorners();
-  std::vector<vtkTypeInt64Array::ValueType> cellConn;
-  std::vector<vtkVector3d> cellCorners;
-  cellConn.resize(numCorners);
-  cellCorners.resize(numCorners);
-  vtkVector3d testPoint;
+  // Flatten the (point, cell) pairs so each output row is known up front and
+  // the Newton iterations can run in parallel.
+  std::vector<std::pair<vtkIdType, vtkIdType>> pairs;
+  pairs.reserve(alloc.GetNumberOfOutputPoints());
   for (const auto& entry : alloc.InputPoints)
   {
-    inputPoints->GetTuple(entry.first, testPoint.GetData());
-    vtkTypeUInt64 outputPointValue = entry.first;
     for (const auto& cellId : entry.second)
     {
+      pairs.emplace_back(entry.first, cellId);
+    }
+  }
+  vtkSMPTools::For(0, static_cast<vtkIdType>(pairs.size()), [&](vtkIdType begin, vtkIdType end) {
+    std::vector<double> xyz(3, 0.0);
+    std::vector<double> jacobian(9, 0.0);
+    vtkVector3d testPoint;
+    for (vtkIdType pp = begin; pp < end; ++pp)
+    {
+      const vtkIdType outputPointId = alloc.Offset + pp;
+      const vtkIdType pointId = pairs[pp].first;
+      const vtkIdType cellId = pairs[pp].second;
+      inputPoints->GetTuple(pointId, testPoint.GetData());
+      vtkTypeUInt64 outputPointValue = pointId;
       vtkTypeUInt64 outputCellValue = cellId;
       pointIds->SetTypedTuple(outputPointId, &outputPointValue);
       cellIds->SetTypedTuple(outputPointId, &outputCellValue);
 
       // Compute the parametric coordinates of \a testPoint by Newton iteration.
       vtkVector3d rst(0., 0., 0.);
-      std::vector<double> xyz(3, 0.0);
-      std::vector<double> jacobian(9, 0.0);
       bool done = false;
 #ifdef VTK_DBG_DGEVAL
-      std::cout << "Test point " << entry.first << " " << testPoint << " cell " << cellId << ":\n";
+      std::cout << "Test point " << pointId << " " << testPoint << " cell " << cellId << ":\n";
 #endif
       // Iterate at most 20 times before giving up:
       for (int ii = 0; !done && ii < 20; ++ii)
@@ -388,10 +403,8 @@ bool vtkDGEvaluator::EvaluatePositions(
         std::cout << "        failure to " << outputPointId << " " << rst << "\n";
 #endif
       }
-
-      ++outputPointId;
     }
-  }
+  });
   return true;
 }
 
@@ -416,20 +429,9 @@ bool vtkDGEvaluator::InterpolatePoints(
   auto pointParams = query->GetClassifierPointParameters();
   auto values = query->GetInterpolatedValues();
   auto& alloc = query->GetAllocationsForCellType(dgCell->GetClassName());
-  vtkIdType outputPointId = alloc.Offset; // The start of the output points we will interpolate
-  vtkIdType numberOfPoints = alloc.GetNumberOfOutputPoints(); // The number of points to process.
-  vtkVector3d rst;
-  vtkTypeUInt64 cellId;
-  std::vector<double> value;
-  value.resize(attribute->GetNumberOfComponents());
-
-  for (const vtkIdType end = outputPointId + numberOfPoints; outputPointId < end; ++outputPointId)
-  {
-    cellIds->GetTypedTuple(outputPointId, &cellId);
-    pointParams->GetTuple(outputPointId, rst.GetData());
-    calc->Evaluate(cellId, rst, value);
-    values->SetTuple(outputPointId, &value[0]);
-  }
+  // Points are evaluated in parallel; the calculator may group them by cell.
+  calc->EvaluateBatch(
+    cellIds, pointParams, values, alloc.Offset, alloc.Offset + alloc.GetNumberOfOutputPoints());
 
   return true;
 }
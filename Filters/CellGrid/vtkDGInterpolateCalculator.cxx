@@ -6,9 +6,14 @@
 #include "vtkCellMetadata.h"
 #include "vtkDoubleArray.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkTypeInt64Array.h"
+#include "vtkTypeUInt64Array.h"
 #include "vtkVectorOperators.h"
 
+#include <algorithm>
+#include <numeric>
+
 using namespace vtk::literals;
 
 #define vtkDGInvokeBasis(basisMethod, shape)                                                       \
@@ -876,6 +881,87 @@ void vtkDGInterpolateCalculator::Evaluate(
   }
 }
 
+void vtkDGInterpolateCalculator::EvaluateBatch(vtkTypeUInt64Array* cellIds,
+  vtkDataArray* pointParameters, vtkDataArray* values, vtkIdType begin, vtkIdType end)
+{
+  auto tokenId = this->FunctionSpace.GetId();
+  const bool isConstant = (tokenId == "DG constant C0"_hash);
+  const bool isContinuous = (tokenId == "CG HGRAD C1"_hash);
+  if (!cellIds || !pointParameters || !values || end <= begin || !this->FieldValues ||
+    (isContinuous && !this->FieldConnectivity) ||
+    (!isConstant && !isContinuous && tokenId != "DG HGRAD C1"_hash))
+  {
+    // H(curl) and H(div) values must be transformed by the inverse Jacobian
+    // of each point, so there is nothing to share among points of a cell.
+    this->Superclass::EvaluateBatch(cellIds, pointParameters, values, begin, end);
+    return;
+  }
+
+  const int numberOfBasisFunctions = this->NumberOfBasisFunctions;
+  const int fieldComponents = this->FieldValues->GetNumberOfComponents();
+  // See Evaluate() for the layout of coefficients in each function space.
+  const int coeffSize =
+    (isConstant || isContinuous) ? fieldComponents : fieldComponents / numberOfBasisFunctions;
+  const int valueSize = std::max(coeffSize, values->GetNumberOfComponents());
+
+  // Group the points by cell so each cell's coefficients are fetched once.
+  // Ties are broken by point index to keep the traversal deterministic.
+  std::vector<vtkIdType> order(end - begin);
+  std::iota(order.begin(), order.end(), begin);
+  vtkSMPTools::Sort(order.begin(), order.end(), [cellIds](vtkIdType aa, vtkIdType bb) {
+    const auto ca = cellIds->GetValue(aa);
+    const auto cb = cellIds->GetValue(bb);
+    return ca < cb || (ca == cb && aa < bb);
+  });
+
+  vtkSMPTools::For(0, static_cast<vtkIdType>(order.size()), [&](vtkIdType first, vtkIdType last) {
+    std::vector<double> coefficients(numberOfBasisFunctions * coeffSize);
+    std::vector<double> basis(numberOfBasisFunctions, 1.0);
+    std::vector<vtkTypeInt64> conn(numberOfBasisFunctions);
+    std::vector<double> value(valueSize, 0.);
+    vtkVector3d rst;
+    bool haveCell = false;
+    vtkTypeUInt64 currentCellId = 0;
+    for (vtkIdType ii = first; ii < last; ++ii)
+    {
+      const vtkIdType pointId = order[ii];
+      const vtkTypeUInt64 cellId = cellIds->GetValue(pointId);
+      if (!haveCell || cellId != currentCellId)
+      {
+        if (isContinuous)
+        {
+          this->FieldConnectivity->GetTypedTuple(static_cast<vtkIdType>(cellId), conn.data());
+          for (int jj = 0; jj < numberOfBasisFunctions; ++jj)
+          {
+            this->FieldValues->GetTuple(conn[jj], &coefficients[jj * coeffSize]);
+          }
+        }
+        else
+        {
+          this->FieldValues->GetTuple(static_cast<vtkIdType>(cellId), coefficients.data());
+        }
+        currentCellId = cellId;
+        haveCell = true;
+      }
+      if (!isConstant)
+      {
+        pointParameters->GetTuple(pointId, rst.GetData());
+        vtkDGInvokeBasisForShapes(DGHGradBasis, this->CellShape);
+      }
+      std::fill(value.begin(), value.end(), 0.);
+      for (int jj = 0; jj < numberOfBasisFunctions; ++jj)
+      {
+        const double* cc = &coefficients[jj * coeffSize];
+        for (int kk = 0; kk < coeffSize; ++kk)
+        {
+          value[kk] += cc[kk] * basis[jj];
+        }
+      }
+      values->SetTuple(pointId, value.data());
+    }
+  });
+}
+
 bool vtkDGInterpolateCalculator::AnalyticDerivative() const
 {
   // XXX(c++14)
@@ -18,6 +18,7 @@ VTK_ABI_NAMESPACE_BEGIN
 class vtkCellAttribute;
 class vtkDataArray;
 class vtkTypeInt64Array;
+class vtkTypeUInt64Array;
 
 /**\brief Calculate field values at a point in a cell's parametric space.
  *
@@ -30,6 +31,13 @@ public:
   void PrintSelf(ostream& os, vtkIndent indent) override;
 
   void Evaluate(vtkIdType cellId, const vtkVector3d& rst, std::vector<double>& value) override;
+  /// Evaluate many points at once.
+  ///
+  /// Points of H(grad) and constant fields are sorted by cell so that the
+  /// coefficients of each cell are fetched once for all the points inside it.
+  /// Other function spaces are evaluated one point at a time in parallel.
+  void EvaluateBatch(vtkTypeUInt64Array* cellIds, vtkDataArray* pointParameters,
+    vtkDataArray* values, vtkIdType begin, vtkIdType end) override;
   bool AnalyticDerivative() const override;
   void EvaluateDerivative(vtkIdType cellId, const vtkVector3d& rst, std::vector<double>& jacobian,
     double neighborhood) override;
@@ -6,6 +6,8 @@
 #include "vtkCellAttribute.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
+#include "vtkTypeUInt64Array.h"
 #include "vtkVectorOperators.h"
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -38,4 +40,28 @@ void vtkInterpolateCalculator::EvaluateDerivative(
   }
 }
 
+void vtkInterpolateCalculator::EvaluateBatch(vtkTypeUInt64Array* cellIds, vtkDataArray* rst,
+  vtkDataArray* values, vtkIdType begin, vtkIdType end)
+{
+  if (!cellIds || !rst || !values || end <= begin)
+  {
+    return;
+  }
+  const std::size_t numberOfComponents = static_cast<std::size_t>(values->GetNumberOfComponents());
+  vtkSMPTools::For(begin, end, [&](vtkIdType first, vtkIdType last) {
+    vtkVector3d pointParams;
+    std::vector<double> value;
+    for (vtkIdType ii = first; ii < last; ++ii)
+    {
+      rst->GetTuple(ii, pointParams.GetData());
+      this->Evaluate(static_cast<vtkIdType>(cellIds->GetValue(ii)), pointParams, value);
+      if (value.size() < numberOfComponents)
+      {
+        value.resize(numberOfComponents, 0.);
+      }
+      values->SetTuple(ii, value.data());
+    }
+  });
+}
+
 VTK_ABI_NAMESPACE_END
@@ -16,6 +16,8 @@
 #include <string>
 
 VTK_ABI_NAMESPACE_BEGIN
+class vtkDataArray;
+class vtkTypeUInt64Array;
 
 /**\brief Calculate field values at a point in a cell's parametric space.
  *
@@ -29,6 +31,20 @@ public:
   /// Subclasses must override this method to perform evaluation.
   virtual void Evaluate(vtkIdType cellId, const vtkVector3d& rst, std::vector<double>& value) = 0;
 
+  /// Evaluate the function at many points at once.
+  ///
+  /// Tuples \a begin up to (but excluding) \a end of \a cellIds and \a rst hold
+  /// the cell and parametric coordinates of each point; the matching tuples of
+  /// \a values are overwritten with the result. All three arrays must already be
+  /// allocated.
+  ///
+  /// The default implementation calls Evaluate() for each point from the threads
+  /// of vtkSMPTools, so subclasses must either make Evaluate() safe to call
+  /// concurrently or override this method. Subclasses may also override it to
+  /// share work among points that lie in the same cell.
+  virtual void EvaluateBatch(vtkTypeUInt64Array* cellIds, vtkDataArray* rst, vtkDataArray* values,
+    vtkIdType begin, vtkIdType end);
+
   /// Return true if the function has an analytic derivative.
   virtual bool AnalyticDerivative() const { return false; }
 
@@ -0,0 +1,240 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Append many small partitions with vtkAppendPolyData and vtkAppendFilter,
+// which copy the inputs concurrently, and check the points, cells and
+// attributes of the outputs.
+
+#include "vtkAppendFilter.h"
+#include "vtkAppendPolyData.h"
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkImageData.h"
+#include "vtkIntArray.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkStringArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cstdlib>
+#include <string>
+
+namespace
+{
+const int NumberOfPartitions = 500;
+
+// A strip of quads along x, with a line and a vertex, offset by partition
+vtkSmartPointer<vtkPolyData> CreatePartition(int partition)
+{
+  const int numQuads = 1 + partition % 7;
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkIntArray> pointPartitions;
+  pointPartitions->SetName("Partition");
+  for (int i = 0; i <= numQuads; ++i)
+  {
+    points->InsertNextPoint(i, 0, partition);
+    points->InsertNextPoint(i, 1, partition);
+    pointPartitions->InsertNextValue(partition);
+    pointPartitions->InsertNextValue(partition);
+  }
+  vtkNew<vtkCellArray> polys;
+  for (vtkIdType i = 0; i < numQuads; ++i)
+  {
+    polys->InsertNextCell({ 2 * i, 2 * i + 2, 2 * i + 3, 2 * i + 1 });
+  }
+  vtkNew<vtkCellArray> lines;
+  lines->InsertNextCell({ 0, 2 });
+  vtkNew<vtkCellArray> verts;
+  verts->InsertNextCell({ 1 });
+
+  vtkNew<vtkDoubleArray> cellValues;
+  cellValues->SetName("CellValues");
+  vtkNew<vtkStringArray> cellNames;
+  cellNames->SetName("CellNames");
+  // cells are numbered verts, lines, polys
+  for (int cellId = 0; cellId < numQuads + 2; ++cellId)
+  {
+    cellValues->InsertNextValue(1000.0 * partition + cellId);
+    cellNames->InsertNextValue(std::to_string(partition));
+  }
+
+  auto polyData = vtkSmartPointer<vtkPolyData>::New();
+  polyData->SetPoints(points);
+  polyData->SetVerts(verts);
+  polyData->SetLines(lines);
+  polyData->SetPolys(polys);
+  polyData->GetPointData()->AddArray(pointPartitions);
+  polyData->GetCellData()->AddArray(cellValues);
+  polyData->GetCellData()->AddArray(cellNames);
+  return polyData;
+}
+
+bool CheckPoints(vtkDataSet* output)
+{
+  vtkIntArray* pointPartitions =
+    vtkIntArray::SafeDownCast(output->GetPointData()->GetArray("Partition"));
+  if (!pointPartitions || pointPartitions->GetNumberOfValues() != output->GetNumberOfPoints())
+  {
+    vtkLog(ERROR, "Missing point data");
+    return false;
+  }
+  double x[3];
+  for (vtkIdType ptId = 0; ptId < output->GetNumberOfPoints(); ++ptId)
+  {
+    output->GetPoint(ptId, x);
+    if (x[2] != pointPartitions->GetValue(ptId))
+    {
+      vtkLog(ERROR, "Wrong point or point data " << ptId);
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TestAppendPolyData()
+{
+  vtkNew<vtkAppendPolyData> append;
+  vtkIdType numPts = 0;
+  vtkIdType numPolys = 0;
+  for (int partition = 0; partition < NumberOfPartitions; ++partition)
+  {
+    vtkSmartPointer<vtkPolyData> input = CreatePartition(partition);
+    numPts += input->GetNumberOfPoints();
+    numPolys += input->GetNumberOfPolys();
+    append->AddInputData(input);
+  }
+  append->Update();
+  vtkPolyData* output = append->GetOutput();
+  if (output->GetNumberOfPoints() != numPts || output->GetNumberOfVerts() != NumberOfPartitions ||
+    output->GetNumberOfLines() != NumberOfPartitions || output->GetNumberOfPolys() != numPolys ||
+    !CheckPoints(output))
+  {
+    vtkLog(ERROR, "Wrong vtkAppendPolyData output");
+    return false;
+  }
+
+  // Verts, then lines, then polys: cell data follows the same order
+  vtkDoubleArray* cellValues =
+    vtkDoubleArray::SafeDownCast(output->GetCellData()->GetArray("CellValues"));
+  vtkStringArray* cellNames =
+    vtkStringArray::SafeDownCast(output->GetCellData()->GetAbstractArray("CellNames"));
+  if (!cellValues || !cellNames || cellNames->GetNumberOfValues() != output->GetNumberOfCells())
+  {
+    vtkLog(ERROR, "Missing cell data");
+    return false;
+  }
+  vtkIdType npts;
+  const vtkIdType* pts;
+  vtkIdType polyId = 0;
+  double x[3];
+  for (int partition = 0; partition < NumberOfPartitions; ++partition)
+  {
+    output->GetVerts()->GetCellAtId(partition, npts, pts);
+    output->GetPoint(pts[0], x);
+    if (x[0] != 0 || x[1] != 1 || x[2] != partition ||
+      cellValues->GetValue(partition) != 1000.0 * partition ||
+      cellNames->GetValue(partition) != std::to_string(partition))
+    {
+      vtkLog(ERROR, "Wrong vertex " << partition);
+      return false;
+    }
+    output->GetLines()->GetCellAtId(partition, npts, pts);
+    output->GetPoint(pts[1], x);
+    if (npts != 2 || x[0] != 1 || x[2] != partition ||
+      cellValues->GetValue(NumberOfPartitions + partition) != 1000.0 * partition + 1)
+    {
+      vtkLog(ERROR, "Wrong line " << partition);
+      return false;
+    }
+    for (int i = 0; i < 1 + partition % 7; ++i, ++polyId)
+    {
+      output->GetPolys()->GetCellAtId(polyId, npts, pts);
+      output->GetPoint(pts[2], x);
+      if (npts != 4 || x[0] != i + 1 || x[1] != 1 || x[2] != partition ||
+        cellValues->GetValue(2 * NumberOfPartitions + polyId) != 1000.0 * partition + 2 + i)
+      {
+        vtkLog(ERROR, "Wrong polygon " << polyId);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool TestAppendFilter()
+{
+  vtkNew<vtkAppendFilter> append;
+  vtkIdType numPts = 0;
+  vtkIdType numCells = 0;
+  for (int partition = 0; partition < NumberOfPartitions; ++partition)
+  {
+    vtkSmartPointer<vtkPolyData> input = CreatePartition(partition);
+    numPts += input->GetNumberOfPoints();
+    numCells += input->GetNumberOfCells();
+    append->AddInputData(input);
+  }
+  // an image data among the partitions
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(3, 3, 1);
+  image->SetOrigin(0, 0, NumberOfPartitions);
+  vtkNew<vtkIntArray> imagePartitions;
+  imagePartitions->SetName("Partition");
+  imagePartitions->SetNumberOfValues(9);
+  imagePartitions->FillValue(NumberOfPartitions);
+  image->GetPointData()->AddArray(imagePartitions);
+  append->AddInputData(image);
+  numPts += 9;
+  numCells += 4;
+
+  append->Update();
+  vtkUnstructuredGrid* output = append->GetOutput();
+  if (output->GetNumberOfPoints() != numPts || output->GetNumberOfCells() != numCells ||
+    !CheckPoints(output) || output->GetCellData()->GetArray("CellValues"))
+  {
+    vtkLog(ERROR, "Wrong vtkAppendFilter output");
+    return false;
+  }
+
+  // Cells are appended in the order of the inputs, with the point ids shifted
+  vtkIdType cellId = 0;
+  vtkIdType ptOffset = 0;
+  vtkNew<vtkIdList> ptIds;
+  for (int partition = 0; partition < NumberOfPartitions; ++partition)
+  {
+    vtkSmartPointer<vtkPolyData> input = CreatePartition(partition);
+    for (vtkIdType inCellId = 0; inCellId < input->GetNumberOfCells(); ++inCellId, ++cellId)
+    {
+      output->GetCellPoints(cellId, ptIds);
+      vtkIdType npts;
+      const vtkIdType* pts;
+      input->GetCellPoints(inCellId, npts, pts);
+      if (output->GetCellType(cellId) != input->GetCellType(inCellId) ||
+        ptIds->GetNumberOfIds() != npts || ptIds->GetId(npts - 1) != pts[npts - 1] + ptOffset)
+      {
+        vtkLog(ERROR, "Wrong cell " << cellId);
+        return false;
+      }
+    }
+    ptOffset += input->GetNumberOfPoints();
+  }
+  if (output->GetCellType(cellId) != VTK_PIXEL)
+  {
+    vtkLog(ERROR, "Wrong image cell");
+    return false;
+  }
+  return true;
+}
+}
+
+int TestAppendPartitions(int, char*[])
+{
+  if (!TestAppendPolyData() || !TestAppendFilter())
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that vtkCleanPolyData produces the same output whether it uses its
+// incremental algorithm (a locator is specified) or delegates the work to the
+// threaded vtkStaticCleanPolyData (no locator).
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkCleanPolyData.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkLogger.h"
+#include "vtkMergePoints.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkTestUtilities.h"
+
+#include <cstdlib>
+
+namespace
+{
+// Points are snapped to a coarse lattice so that many of them coincide, and
+// cells of every kind are built with random sizes and points, which creates
+// all sorts of degenerate cells.
+vtkSmartPointer<vtkPolyData> CreatePolyData(vtkIdType numPts, vtkIdType numCellsPerKind)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(1);
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToDouble();
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("Scalars");
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    double x[3];
+    for (int j = 0; j < 3; ++j)
+    {
+      x[j] = static_cast<int>(random->GetNextRangeValue(0, 5));
+    }
+    points->InsertNextPoint(x);
+    scalars->InsertNextValue(ptId);
+  }
+
+  vtkNew<vtkIdTypeArray> cellIds;
+  cellIds->SetName("CellIds");
+  vtkSmartPointer<vtkCellArray> cells[4];
+  const int maxSizes[4] = { 3, 5, 6, 7 };
+  vtkIdType cellId = 0;
+  for (int kind = 0; kind < 4; ++kind)
+  {
+    cells[kind] = vtkSmartPointer<vtkCellArray>::New();
+    for (vtkIdType i = 0; i < numCellsPerKind; ++i, ++cellId)
+    {
+      const int npts = 1 + static_cast<int>(random->GetNextRangeValue(0, maxSizes[kind]));
+      cells[kind]->InsertNextCell(npts);
+      vtkIdType ptId = static_cast<vtkIdType>(random->GetNextRangeValue(0, numPts));
+      for (int j = 0; j < npts; ++j)
+      {
+        // repeat the previous point once in a while
+        if (random->GetNextValue() > 0.2)
+        {
+          ptId = static_cast<vtkIdType>(random->GetNextRangeValue(0, numPts));
+        }
+        cells[kind]->InsertCellPoint(ptId);
+      }
+      cellIds->InsertNextValue(cellId);
+    }
+  }
+
+  auto polyData = vtkSmartPointer<vtkPolyData>::New();
+  polyData->SetPoints(points);
+  polyData->SetVerts(cells[0]);
+  polyData->SetLines(cells[1]);
+  polyData->SetPolys(cells[2]);
+  polyData->SetStrips(cells[3]);
+  polyData->GetPointData()->SetScalars(scalars);
+  polyData->GetCellData()->AddArray(cellIds);
+  return polyData;
+}
+}
+
+int TestCleanPolyDataThreaded(int, char*[])
+{
+  vtkSmartPointer<vtkPolyData> input = CreatePolyData(1000, 2000);
+
+  vtkNew<vtkCleanPolyData> threaded;
+  threaded->SetInputData(input);
+  vtkNew<vtkCleanPolyData> incremental;
+  incremental->SetInputData(input);
+  vtkNew<vtkMergePoints> locator;
+  incremental->SetLocator(locator);
+
+  for (int config = 0; config < 16; ++config)
+  {
+    const bool pointMerging = (config & 1) != 0;
+    const bool convertLinesToPoints = (config & 2) != 0;
+    const bool convertPolysToLines = (config & 4) != 0;
+    const bool convertStripsToPolys = (config & 8) != 0;
+    for (vtkCleanPolyData* clean : { threaded.Get(), incremental.Get() })
+    {
+      clean->SetPointMerging(pointMerging);
+      clean->SetConvertLinesToPoints(convertLinesToPoints);
+      clean->SetConvertPolysToLines(convertPolysToLines);
+      clean->SetConvertStripsToPolys(convertStripsToPolys);
+      clean->Update();
+    }
+    if (!vtkTestUtilities::CompareDataObjects(incremental->GetOutput(), threaded->GetOutput()))
+    {
+      vtkLog(ERROR, "Threaded output differs for configuration " << config);
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
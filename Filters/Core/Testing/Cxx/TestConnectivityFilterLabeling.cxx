@@ -0,0 +1,178 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the parallel labeling of all regions used by vtkConnectivityFilter
+// and vtkPolyDataConnectivityFilter matches the serial traversal. The serial
+// traversal is forced by a scalar connectivity accepting every cell.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkConnectivityFilter.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkLogger.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataConnectivityFilter.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cstdlib>
+
+namespace
+{
+// Triangles picked at random in small clusters of points, so that the cells
+// of the regions are interleaved. Some points are not used by any cell.
+void CreateTriangles(vtkPolyData* polyData, vtkUnstructuredGrid* grid)
+{
+  const vtkIdType numClusters = 500;
+  const vtkIdType clusterSize = 12;
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(7);
+
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkDoubleArray> scalars;
+  for (vtkIdType i = 0; i < numClusters * clusterSize; ++i)
+  {
+    points->InsertNextPoint(
+      random->GetNextValue(), random->GetNextValue(), random->GetNextValue());
+    scalars->InsertNextValue(random->GetNextValue());
+  }
+  vtkNew<vtkCellArray> triangles;
+  for (vtkIdType i = 0; i < 4 * numClusters; ++i)
+  {
+    vtkIdType cluster = static_cast<vtkIdType>(random->GetNextValue() * numClusters);
+    vtkIdType triangle[3];
+    for (int j = 0; j < 3; ++j)
+    {
+      triangle[j] = cluster * clusterSize +
+        static_cast<vtkIdType>(random->GetNextValue() * (clusterSize - 1));
+    }
+    triangles->InsertNextCell(3, triangle);
+  }
+
+  polyData->SetPoints(points);
+  polyData->SetPolys(triangles);
+  polyData->GetPointData()->SetScalars(scalars);
+  grid->SetPoints(points);
+  grid->SetCells(VTK_TRIANGLE, triangles);
+  grid->GetPointData()->SetScalars(scalars);
+}
+
+template <typename TFilter>
+bool CompareNumberOfRegions(TFilter* parallel, TFilter* serial)
+{
+  if (parallel->GetNumberOfExtractedRegions() != serial->GetNumberOfExtractedRegions())
+  {
+    vtkLog(ERROR,
+      "Expected " << serial->GetNumberOfExtractedRegions() << " regions, got "
+                  << parallel->GetNumberOfExtractedRegions());
+    return false;
+  }
+  return true;
+}
+
+template <typename TFilter>
+void ForceSerialTraversal(TFilter* filter)
+{
+  filter->ScalarConnectivityOn();
+  filter->SetScalarRange(-1.0, 2.0);
+}
+}
+
+int TestConnectivityFilterLabeling(int, char*[])
+{
+  vtkNew<vtkPolyData> polyData;
+  vtkNew<vtkUnstructuredGrid> grid;
+  CreateTriangles(polyData, grid);
+
+  // vtkConnectivityFilter: all regions are colored identically
+  vtkNew<vtkConnectivityFilter> parallel;
+  parallel->SetInputData(grid);
+  parallel->SetExtractionModeToAllRegions();
+  parallel->ColorRegionsOn();
+  parallel->Update();
+  vtkNew<vtkConnectivityFilter> serial;
+  serial->SetInputData(grid);
+  serial->SetExtractionModeToAllRegions();
+  serial->ColorRegionsOn();
+  ForceSerialTraversal(serial.Get());
+  serial->Update();
+
+  if (!CompareNumberOfRegions(parallel.Get(), serial.Get()))
+  {
+    return EXIT_FAILURE;
+  }
+  vtkDataSet* parallelOutput = parallel->GetOutput();
+  vtkDataSet* serialOutput = serial->GetOutput();
+  if (parallelOutput->GetNumberOfPoints() != serialOutput->GetNumberOfPoints() ||
+    parallelOutput->GetNumberOfCells() != serialOutput->GetNumberOfCells())
+  {
+    vtkLog(ERROR, "Different number of points or cells extracted.");
+    return EXIT_FAILURE;
+  }
+  auto parallelIds =
+    vtkIdTypeArray::SafeDownCast(parallelOutput->GetCellData()->GetArray("RegionId"));
+  auto serialIds = vtkIdTypeArray::SafeDownCast(serialOutput->GetCellData()->GetArray("RegionId"));
+  for (vtkIdType cellId = 0; cellId < serialOutput->GetNumberOfCells(); ++cellId)
+  {
+    if (parallelIds->GetValue(cellId) != serialIds->GetValue(cellId))
+    {
+      vtkLog(ERROR, "Different region id for cell " << cellId);
+      return EXIT_FAILURE;
+    }
+  }
+
+  // vtkConnectivityFilter: largest region with region sizes ordering
+  parallel->SetExtractionModeToLargestRegion();
+  parallel->SetRegionIdAssignmentMode(vtkConnectivityFilter::CELL_COUNT_DESCENDING);
+  parallel->Update();
+  serial->SetExtractionModeToLargestRegion();
+  serial->SetRegionIdAssignmentMode(vtkConnectivityFilter::CELL_COUNT_DESCENDING);
+  serial->Update();
+  if (!CompareNumberOfRegions(parallel.Get(), serial.Get()) ||
+    parallel->GetOutput()->GetNumberOfCells() != serial->GetOutput()->GetNumberOfCells())
+  {
+    vtkLog(ERROR, "Different largest region extracted.");
+    return EXIT_FAILURE;
+  }
+
+  // vtkPolyDataConnectivityFilter: specified regions
+  vtkNew<vtkPolyDataConnectivityFilter> parallelPolyData;
+  parallelPolyData->SetInputData(polyData);
+  parallelPolyData->SetExtractionModeToSpecifiedRegions();
+  parallelPolyData->AddSpecifiedRegion(3);
+  parallelPolyData->AddSpecifiedRegion(10);
+  parallelPolyData->Update();
+  vtkNew<vtkPolyDataConnectivityFilter> serialPolyData;
+  serialPolyData->SetInputData(polyData);
+  serialPolyData->SetExtractionModeToSpecifiedRegions();
+  serialPolyData->AddSpecifiedRegion(3);
+  serialPolyData->AddSpecifiedRegion(10);
+  ForceSerialTraversal(serialPolyData.Get());
+  serialPolyData->Update();
+  if (!CompareNumberOfRegions(parallelPolyData.Get(), serialPolyData.Get()))
+  {
+    return EXIT_FAILURE;
+  }
+  for (int i = 0; i < serialPolyData->GetNumberOfExtractedRegions(); ++i)
+  {
+    if (parallelPolyData->GetRegionSizes()->GetValue(i) !=
+      serialPolyData->GetRegionSizes()->GetValue(i))
+    {
+      vtkLog(ERROR, "Different size for region " << i);
+      return EXIT_FAILURE;
+    }
+  }
+  if (parallelPolyData->GetOutput()->GetNumberOfCells() !=
+      serialPolyData->GetOutput()->GetNumberOfCells() ||
+    parallelPolyData->GetOutput()->GetNumberOfPoints() !=
+      serialPolyData->GetOutput()->GetNumberOfPoints())
+  {
+    vtkLog(ERROR, "Different specified regions extracted.");
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
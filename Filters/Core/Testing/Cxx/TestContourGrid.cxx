@@ -0,0 +1,151 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the parallel execution of vtkContourGrid produces the same
+// contour as the sequential one on a grid mixing linear, quadratic, polyhedral
+// and 2D cells.
+
+#include "vtkAppendFilter.h"
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkCellTypeSource.h"
+#include "vtkContourGrid.h"
+#include "vtkDataArrayRange.h"
+#include "vtkIdTypeArray.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace
+{
+std::vector<std::array<double, 3>> SortedPoints(vtkPolyData* contour)
+{
+  std::vector<std::array<double, 3>> points(contour->GetNumberOfPoints());
+  for (vtkIdType ptId = 0; ptId < contour->GetNumberOfPoints(); ++ptId)
+  {
+    contour->GetPoint(ptId, points[ptId].data());
+  }
+  std::sort(points.begin(), points.end());
+  return points;
+}
+
+// Contour cells given as the sorted list of (original cell id, point coordinates).
+std::vector<std::vector<double>> SortedCells(vtkPolyData* contour)
+{
+  vtkIdTypeArray* originalIds =
+    vtkIdTypeArray::SafeDownCast(contour->GetCellData()->GetArray("OriginalIds"));
+  std::vector<std::vector<double>> cells;
+  for (vtkIdType cellId = 0; cellId < contour->GetNumberOfCells(); ++cellId)
+  {
+    std::vector<double> cell{ static_cast<double>(contour->GetCellType(cellId)),
+      static_cast<double>(originalIds->GetValue(cellId)) };
+    vtkIdType npts;
+    const vtkIdType* pts;
+    contour->GetCellPoints(cellId, npts, pts);
+    std::vector<std::array<double, 3>> points(npts);
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      contour->GetPoint(pts[i], points[i].data());
+    }
+    // The first point of a cell is arbitrary.
+    std::rotate(points.begin(), std::min_element(points.begin(), points.end()), points.end());
+    for (const auto& point : points)
+    {
+      cell.insert(cell.end(), point.begin(), point.end());
+    }
+    cells.push_back(cell);
+  }
+  std::sort(cells.begin(), cells.end());
+  return cells;
+}
+}
+
+int TestContourGrid(int, char*[])
+{
+  vtkNew<vtkAppendFilter> append;
+  for (int cellType :
+    { VTK_HEXAHEDRON, VTK_QUADRATIC_TETRA, VTK_LAGRANGE_HEXAHEDRON, VTK_POLYHEDRON, VTK_TRIANGLE })
+  {
+    vtkNew<vtkCellTypeSource> source;
+    source->SetCellType(cellType);
+    source->SetBlocksDimensions(6, 6, 6);
+    source->Update();
+    vtkNew<vtkUnstructuredGrid> grid;
+    grid->ShallowCopy(source->GetOutput());
+    append->AddInputData(grid);
+  }
+  append->Update();
+  vtkUnstructuredGrid* input = append->GetOutput();
+
+  // Cell data must follow the contour cells.
+  vtkNew<vtkIdTypeArray> originalIds;
+  originalIds->SetName("OriginalIds");
+  originalIds->SetNumberOfValues(input->GetNumberOfCells());
+  for (vtkIdType cellId = 0; cellId < input->GetNumberOfCells(); ++cellId)
+  {
+    originalIds->SetValue(cellId, cellId);
+  }
+  input->GetCellData()->AddArray(originalIds);
+
+  vtkSMPTools::Initialize(4);
+
+  vtkSmartPointer<vtkPolyData> contours[2];
+  for (int sequential = 0; sequential < 2; ++sequential)
+  {
+    vtkNew<vtkContourGrid> contour;
+    contour->SetInputData(input);
+    contour->SetInputArrayToProcess(
+      0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, "DistanceToCenter");
+    contour->GenerateValues(3, 1.0, 3.0);
+    contour->SetSequentialProcessing(sequential);
+    contour->Update();
+    contours[sequential] = contour->GetOutput();
+  }
+
+  vtkPolyData* parallel = contours[0];
+  vtkPolyData* sequential = contours[1];
+  if (sequential->GetNumberOfPolys() == 0 || sequential->GetNumberOfLines() == 0)
+  {
+    vtkLog(ERROR, "Expected the contour to have polygons and lines.");
+    return EXIT_FAILURE;
+  }
+  if (parallel->GetNumberOfPoints() != sequential->GetNumberOfPoints() ||
+    parallel->GetNumberOfLines() != sequential->GetNumberOfLines() ||
+    parallel->GetNumberOfPolys() != sequential->GetNumberOfPolys())
+  {
+    vtkLog(ERROR,
+      "Parallel contour has " << parallel->GetNumberOfPoints() << " points, "
+                              << parallel->GetNumberOfLines() << " lines and "
+                              << parallel->GetNumberOfPolys() << " polys, expected "
+                              << sequential->GetNumberOfPoints() << ", "
+                              << sequential->GetNumberOfLines() << " and "
+                              << sequential->GetNumberOfPolys() << ".");
+    return EXIT_FAILURE;
+  }
+  if (SortedPoints(parallel) != SortedPoints(sequential))
+  {
+    vtkLog(ERROR, "Parallel and sequential contour points differ.");
+    return EXIT_FAILURE;
+  }
+  if (SortedCells(parallel) != SortedCells(sequential))
+  {
+    vtkLog(ERROR, "Parallel and sequential contour cells differ.");
+    return EXIT_FAILURE;
+  }
+  if (parallel->GetPointData()->GetArray("DistanceToCenter") == nullptr)
+  {
+    vtkLog(ERROR, "Missing interpolated point data.");
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -4,13 +4,19 @@
 #include "vtkDataSetTriangleFilter.h"
 #include "vtkImageDataToPointSet.h"
 #include "vtkPlane.h"
+#include "vtkPointData.h"
 #include "vtkPointDataToCellData.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkPolygonBuilder.h"
 #include "vtkRTAnalyticSource.h"
 #include "vtkSmartPointer.h"
+#include "vtkSphere.h"
+
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <vector>
 
 bool TestStructured(int type)
 {
@@ -93,6 +99,74 @@ bool TestUnstructured()
   return true;
 }
 
+std::vector<std::array<double, 3>> SortedPoints(vtkPolyData* output)
+{
+  std::vector<std::array<double, 3>> points(output->GetNumberOfPoints());
+  for (vtkIdType ptId = 0; ptId < output->GetNumberOfPoints(); ++ptId)
+  {
+    output->GetPoint(ptId, points[ptId].data());
+  }
+  std::sort(points.begin(), points.end());
+  return points;
+}
+
+// Cut an unstructured grid with a sphere, which is done in parallel unless
+// sequential processing is forced.
+bool TestUnstructuredSphere()
+{
+  vtkSmartPointer<vtkRTAnalyticSource> imageSource = vtkSmartPointer<vtkRTAnalyticSource>::New();
+  imageSource->SetWholeExtent(-6, 6, -6, 6, -6, 6);
+
+  vtkSmartPointer<vtkDataSetTriangleFilter> tetraFilter =
+    vtkSmartPointer<vtkDataSetTriangleFilter>::New();
+  tetraFilter->SetInputConnection(imageSource->GetOutputPort());
+
+  vtkSmartPointer<vtkSphere> sphere = vtkSmartPointer<vtkSphere>::New();
+  sphere->SetCenter(0.5, -0.25, 0.0);
+  sphere->SetRadius(1.0);
+
+  vtkSmartPointer<vtkCutter> cutter = vtkSmartPointer<vtkCutter>::New();
+  cutter->SetCutFunction(sphere);
+  cutter->SetInputConnection(0, tetraFilter->GetOutputPort());
+  cutter->SetNumberOfContours(3);
+  cutter->SetValue(0, 4.0);
+  cutter->SetValue(1, 9.0);
+  cutter->SetValue(2, 16.0);
+
+  for (int generateCutScalars = 0; generateCutScalars < 2; ++generateCutScalars)
+  {
+    cutter->SetGenerateCutScalars(generateCutScalars);
+    cutter->SequentialProcessingOn();
+    cutter->Update();
+    vtkSmartPointer<vtkPolyData> expected = vtkSmartPointer<vtkPolyData>::New();
+    expected->ShallowCopy(cutter->GetOutput());
+
+    cutter->SequentialProcessingOff();
+    cutter->Update();
+    vtkPolyData* output = cutter->GetOutput();
+    if (output->GetNumberOfPoints() == 0 ||
+      output->GetNumberOfPoints() != expected->GetNumberOfPoints() ||
+      output->GetNumberOfCells() != expected->GetNumberOfCells() || output->CheckAttributes())
+    {
+      return false;
+    }
+    if (SortedPoints(output) != SortedPoints(expected))
+    {
+      return false;
+    }
+
+    vtkDataArray* scalars = output->GetPointData()->GetScalars();
+    vtkDataArray* expectedScalars = expected->GetPointData()->GetScalars();
+    if (!scalars || !expectedScalars ||
+      (scalars->GetName() == nullptr) != (expectedScalars->GetName() == nullptr) ||
+      output->GetPointData()->GetArray("vtkCutterScalars"))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 int TestCutter(int, char*[])
 {
   for (int type = 0; type < 2; type++)
@@ -110,5 +184,11 @@ int TestCutter(int, char*[])
     return EXIT_FAILURE;
   }
 
+  if (!TestUnstructuredSphere())
+  {
+    cerr << "Cutting Unstructured with a sphere failed" << endl;
+    return EXIT_FAILURE;
+  }
+
   return EXIT_SUCCESS;
 }
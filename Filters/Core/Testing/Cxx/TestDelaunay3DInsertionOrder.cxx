@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Compare the triangulations of random points inserted in input order and in
+// BRIO order by vtkDelaunay3D.
+
+#include "vtkCellArray.h"
+#include "vtkDelaunay3D.h"
+#include "vtkLogger.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkTetra.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+double TotalVolume(vtkUnstructuredGrid* mesh)
+{
+  double volume = 0.0;
+  double p[4][3];
+  vtkNew<vtkIdList> ids;
+  for (vtkIdType cellId = 0; cellId < mesh->GetNumberOfCells(); ++cellId)
+  {
+    mesh->GetCellPoints(cellId, ids);
+    for (int i = 0; i < 4; ++i)
+    {
+      mesh->GetPoint(ids->GetId(i), p[i]);
+    }
+    volume += std::abs(vtkTetra::ComputeVolume(p[0], p[1], p[2], p[3]));
+  }
+  return volume;
+}
+}
+
+int TestDelaunay3DInsertionOrder(int, char*[])
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(1);
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToDouble();
+  const vtkIdType numPts = 20000;
+  points->SetNumberOfPoints(numPts);
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    double x[3];
+    for (int j = 0; j < 3; ++j)
+    {
+      x[j] = random->GetNextValue();
+    }
+    points->SetPoint(i, x);
+  }
+  vtkNew<vtkPolyData> input;
+  input->SetPoints(points);
+
+  vtkNew<vtkDelaunay3D> delaunay;
+  delaunay->SetInputData(input);
+  delaunay->SetTolerance(0.0);
+  delaunay->Update();
+  const vtkIdType numTetras = delaunay->GetOutput()->GetNumberOfCells();
+  const double volume = TotalVolume(delaunay->GetOutput());
+
+  delaunay->SetInsertionOrderToBRIOOrder();
+  delaunay->Update();
+  vtkUnstructuredGrid* output = delaunay->GetOutput();
+
+  bool success = true;
+  if (output->GetNumberOfPoints() != numPts)
+  {
+    vtkLog(ERROR, "Expected " << numPts << " points, got " << output->GetNumberOfPoints());
+    success = false;
+  }
+  // Random points are in general position, so the triangulation is unique.
+  if (output->GetNumberOfCells() != numTetras)
+  {
+    vtkLog(ERROR,
+      "Expected " << numTetras << " tetras in BRIO order, got " << output->GetNumberOfCells());
+    success = false;
+  }
+  const double brioVolume = TotalVolume(output);
+  if (std::abs(brioVolume - volume) > 1e-6 * volume)
+  {
+    vtkLog(ERROR, "Expected a volume of " << volume << " in BRIO order, got " << brioVolume);
+    success = false;
+  }
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that vtkGlyph3D and vtkTensorGlyph generate the same glyphs with
+// several threads as with a single thread.
+
+#include "vtkCubeSource.h"
+#include "vtkDoubleArray.h"
+#include "vtkGlyph3D.h"
+#include "vtkLogger.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSphereSource.h"
+#include "vtkTensorGlyph.h"
+#include "vtkTestUtilities.h"
+
+#include <cstdlib>
+
+namespace
+{
+vtkSmartPointer<vtkPolyData> CreateInput(vtkIdType numPts)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(3);
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("Scalars");
+  vtkNew<vtkDoubleArray> vectors;
+  vectors->SetName("Vectors");
+  vectors->SetNumberOfComponents(3);
+  vtkNew<vtkDoubleArray> tensors;
+  tensors->SetName("Tensors");
+  tensors->SetNumberOfComponents(9);
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    points->InsertNextPoint(
+      random->GetNextValue(), random->GetNextValue(), random->GetNextValue());
+    scalars->InsertNextValue(random->GetNextValue());
+    vectors->InsertNextTuple3(
+      random->GetNextValue() - 0.5, random->GetNextValue() - 0.5, random->GetNextValue() - 0.5);
+    double tensor[9];
+    for (int j = 0; j < 9; ++j)
+    {
+      tensor[j] = random->GetNextValue() - 0.5;
+    }
+    tensors->InsertNextTuple(tensor);
+  }
+
+  auto input = vtkSmartPointer<vtkPolyData>::New();
+  input->SetPoints(points);
+  input->GetPointData()->SetScalars(scalars);
+  input->GetPointData()->SetVectors(vectors);
+  input->GetPointData()->SetTensors(tensors);
+  return input;
+}
+
+bool CompareWithSingleThread(vtkAlgorithm* filter)
+{
+  vtkNew<vtkPolyData> serial;
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ 1 }, [&]() { filter->Update(); });
+  serial->DeepCopy(vtkPolyData::SafeDownCast(filter->GetOutputDataObject(0)));
+  filter->Modified();
+  filter->Update();
+  return vtkTestUtilities::CompareDataObjects(serial, filter->GetOutputDataObject(0));
+}
+}
+
+int TestGlyph3DThreaded(int, char*[])
+{
+  const vtkIdType numPts = 5000;
+  vtkSmartPointer<vtkPolyData> input = CreateInput(numPts);
+
+  vtkNew<vtkCubeSource> cube;
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(6);
+  sphere->SetPhiResolution(5);
+  cube->Update();
+  sphere->Update();
+
+  // A single glyph with texture coordinates, oriented and scaled by vector
+  vtkNew<vtkGlyph3D> glyphs;
+  glyphs->SetInputData(input);
+  glyphs->SetSourceConnection(cube->GetOutputPort());
+  glyphs->SetScaleModeToScaleByVector();
+  glyphs->SetColorModeToColorByScalar();
+  glyphs->FillCellDataOn();
+  glyphs->GeneratePointIdsOn();
+  glyphs->Update();
+  if (glyphs->GetOutput()->GetNumberOfPoints() != numPts * cube->GetOutput()->GetNumberOfPoints() ||
+    glyphs->GetOutput()->GetNumberOfCells() != numPts * cube->GetOutput()->GetNumberOfCells())
+  {
+    vtkLog(ERROR, "Unexpected number of glyph points or cells.");
+    return EXIT_FAILURE;
+  }
+  if (!CompareWithSingleThread(glyphs))
+  {
+    vtkLog(ERROR, "Threaded glyphs differ.");
+    return EXIT_FAILURE;
+  }
+
+  // A table of glyphs indexed by scalar
+  glyphs->SetSourceConnection(0, sphere->GetOutputPort());
+  glyphs->SetSourceConnection(1, cube->GetOutputPort());
+  glyphs->SetIndexModeToScalar();
+  glyphs->SetRange(0.0, 1.0);
+  glyphs->SetScaleModeToDataScalingOff();
+  if (!CompareWithSingleThread(glyphs))
+  {
+    vtkLog(ERROR, "Threaded indexed glyphs differ.");
+    return EXIT_FAILURE;
+  }
+
+  // Tensor glyphs with several directions
+  vtkNew<vtkTensorGlyph> tensorGlyphs;
+  tensorGlyphs->SetInputData(input);
+  tensorGlyphs->SetSourceConnection(sphere->GetOutputPort());
+  tensorGlyphs->ThreeGlyphsOn();
+  tensorGlyphs->SymmetricOn();
+  tensorGlyphs->SetColorModeToEigenvalues();
+  tensorGlyphs->Update();
+  if (tensorGlyphs->GetOutput()->GetNumberOfPoints() !=
+    6 * numPts * sphere->GetOutput()->GetNumberOfPoints())
+  {
+    vtkLog(ERROR, "Unexpected number of tensor glyph points.");
+    return EXIT_FAILURE;
+  }
+  if (!CompareWithSingleThread(tensorGlyphs))
+  {
+    vtkLog(ERROR, "Threaded tensor glyphs differ.");
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -5,6 +5,7 @@
 // directly above an edge of a cube)
 
 #include "vtkCubeSource.h"
+#include "vtkDoubleArray.h"
 #include "vtkImplicitPolyDataDistance.h"
 #include "vtkNew.h"
 #include "vtkPolyData.h"
@@ -40,6 +41,8 @@ int TestImplicitPolyDataDistanceCube(int vtkNotUsed(argc), char* vtkNotUsed(argv
   int numSteps = static_cast<int>(2 * length / step) + 1;
 
   // Iterate through a grid of points around the cube
+  vtkNew<vtkDoubleArray> points;
+  points->SetNumberOfComponents(3);
   for (int i = 0; i < numSteps; ++i)
   {
     const double z = -length + i * step;
@@ -54,9 +57,25 @@ int TestImplicitPolyDataDistanceCube(int vtkNotUsed(argc), char* vtkNotUsed(argv
         {
           return EXIT_FAILURE;
         }
+        points->InsertNextTuple3(x, y, z);
       }
     }
   }
 
+  // The batch evaluation gives the same distances
+  vtkNew<vtkDoubleArray> distances;
+  signedDistance->FunctionValue(points, distances);
+  if (distances->GetNumberOfTuples() != points->GetNumberOfTuples())
+  {
+    return EXIT_FAILURE;
+  }
+  for (vtkIdType ptId = 0; ptId < points->GetNumberOfTuples(); ++ptId)
+  {
+    if (distances->GetValue(ptId) != signedDistance->EvaluateFunction(points->GetTuple3(ptId)))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
   return EXIT_SUCCESS;
 }
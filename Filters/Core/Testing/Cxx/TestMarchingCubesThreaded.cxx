@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that vtkMarchingCubes produces the same output with its threaded
+// implementation (default vtkMergePoints locator), whatever the slab size, and
+// with its serial implementation (any other locator).
+
+#include "vtkImageData.h"
+#include "vtkLogger.h"
+#include "vtkMarchingCubes.h"
+#include "vtkMergePoints.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPointLocator.h"
+#include "vtkPolyData.h"
+#include "vtkShortArray.h"
+#include "vtkSmartPointer.h"
+#include "vtkTestUtilities.h"
+
+#include <cstdlib>
+
+namespace
+{
+// A locator merging points exactly like vtkMergePoints, without being one,
+// which makes vtkMarchingCubes use its serial implementation.
+class SerialMergePoints : public vtkPointLocator
+{
+public:
+  static SerialMergePoints* New();
+  vtkTypeMacro(SerialMergePoints, vtkPointLocator);
+
+  int InitPointInsertion(vtkPoints* newPts, const double bounds[6], vtkIdType estSize) override
+  {
+    return this->Merger->InitPointInsertion(newPts, bounds, estSize);
+  }
+  int InsertUniquePoint(const double x[3], vtkIdType& ptId) override
+  {
+    return this->Merger->InsertUniquePoint(x, ptId);
+  }
+  void Initialize() override { this->Merger->Initialize(); }
+
+private:
+  vtkNew<vtkMergePoints> Merger;
+};
+vtkStandardNewMacro(SerialMergePoints);
+
+// Integral scalars with plateaus, so that contour values hit grid points
+// exactly and generate points at voxel corners and degenerate triangles.
+vtkSmartPointer<vtkImageData> CreateVolume()
+{
+  auto image = vtkSmartPointer<vtkImageData>::New();
+  image->SetExtent(-3, 17, 2, 20, 5, 26);
+  vtkNew<vtkShortArray> scalars;
+  scalars->SetName("Scalars");
+  scalars->SetNumberOfTuples(image->GetNumberOfPoints());
+  vtkIdType ptId = 0;
+  for (int k = 5; k <= 26; ++k)
+  {
+    for (int j = 2; j <= 20; ++j)
+    {
+      for (int i = -3; i <= 17; ++i, ++ptId)
+      {
+        const int d2 = (i - 7) * (i - 7) + (j - 11) * (j - 11) + 2 * (k - 15) * (k - 15);
+        scalars->SetValue(ptId, static_cast<short>(d2 / 8 + (i * j) % 3));
+      }
+    }
+  }
+  image->GetPointData()->SetScalars(scalars);
+  return image;
+}
+
+vtkSmartPointer<vtkPolyData> Contour(vtkImageData* image, vtkIncrementalPointLocator* locator,
+  int slabSize)
+{
+  vtkNew<vtkMarchingCubes> contour;
+  contour->SetInputData(image);
+  contour->SetValue(0, 4.0);
+  contour->SetValue(1, 9.5);
+  contour->SetValue(2, 16.0);
+  contour->SetValue(3, 9.5);
+  contour->ComputeNormalsOn();
+  contour->ComputeGradientsOn();
+  contour->ComputeScalarsOn();
+  contour->SetLocator(locator);
+  contour->SetSlabSize(slabSize);
+  contour->Update();
+  return contour->GetOutput();
+}
+}
+
+int TestMarchingCubesThreaded(int, char*[])
+{
+  vtkSmartPointer<vtkImageData> image = CreateVolume();
+
+  vtkNew<SerialMergePoints> serialLocator;
+  vtkSmartPointer<vtkPolyData> serial = Contour(image, serialLocator, 0);
+  vtkLog(INFO, "Serial implementation: " << serial->GetNumberOfPoints() << " points, "
+                                         << serial->GetNumberOfPolys() << " triangles.");
+  if (serial->GetNumberOfPolys() == 0)
+  {
+    vtkLog(ERROR, "Empty serial output.");
+    return EXIT_FAILURE;
+  }
+
+  for (int slabSize : { 0, 1, 2, 5, 100 })
+  {
+    vtkSmartPointer<vtkPolyData> threaded = Contour(image, nullptr, slabSize);
+    if (!vtkTestUtilities::CompareDataObjects(serial, threaded))
+    {
+      vtkLog(ERROR, "Threaded output with slab size " << slabSize << " differs.");
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
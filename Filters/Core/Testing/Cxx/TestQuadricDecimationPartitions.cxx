@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Compare the parallel decimation of a sphere by vtkQuadricDecimation to its
+// sequential decimation.
+
+#include "vtkDoubleArray.h"
+#include "vtkFeatureEdges.h"
+#include "vtkLogger.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkQuadricDecimation.h"
+#include "vtkSphereSource.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+vtkIdType CountBoundaryEdges(vtkPolyData* mesh)
+{
+  vtkNew<vtkFeatureEdges> edges;
+  edges->SetInputData(mesh);
+  edges->BoundaryEdgesOn();
+  edges->FeatureEdgesOff();
+  edges->NonManifoldEdgesOn();
+  edges->ManifoldEdgesOff();
+  edges->Update();
+  return edges->GetOutput()->GetNumberOfLines();
+}
+
+double MaximumRadiusError(vtkPolyData* mesh)
+{
+  double error = 0.0;
+  double x[3];
+  for (vtkIdType i = 0; i < mesh->GetNumberOfPoints(); ++i)
+  {
+    mesh->GetPoint(i, x);
+    error = std::max(error, std::abs(vtkMath::Norm(x) - 1.0));
+  }
+  return error;
+}
+}
+
+int TestQuadricDecimationPartitions(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetRadius(1.0);
+  sphere->SetThetaResolution(300);
+  sphere->SetPhiResolution(300);
+  sphere->Update();
+  vtkPolyData* input = sphere->GetOutput();
+
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("Height");
+  scalars->SetNumberOfTuples(input->GetNumberOfPoints());
+  for (vtkIdType i = 0; i < input->GetNumberOfPoints(); ++i)
+  {
+    scalars->SetValue(i, input->GetPoint(i)[2]);
+  }
+  input->GetPointData()->SetScalars(scalars);
+  const vtkIdType inputBoundaryEdges = CountBoundaryEdges(input);
+
+  vtkNew<vtkQuadricDecimation> decimator;
+  decimator->SetInputData(input);
+  decimator->SetTargetReduction(0.9);
+  decimator->MapPointDataOn();
+  decimator->Update();
+  const double sequentialError = MaximumRadiusError(decimator->GetOutput());
+
+  bool success = true;
+  for (int numberOfPartitions : { 0, 2, 7 })
+  {
+    decimator->SetNumberOfPartitions(numberOfPartitions);
+    decimator->Update();
+    vtkPolyData* output = decimator->GetOutput();
+
+    const double reduction = decimator->GetActualReduction();
+    if (reduction < 0.89 || reduction > 0.91)
+    {
+      vtkLog(ERROR,
+        "Reduction " << reduction << " with " << numberOfPartitions << " partitions.");
+      success = false;
+    }
+    if (CountBoundaryEdges(output) != inputBoundaryEdges)
+    {
+      vtkLog(ERROR, "The partitions are not merged with " << numberOfPartitions << " partitions.");
+      success = false;
+    }
+    const double error = MaximumRadiusError(output);
+    if (error > 2.0 * sequentialError)
+    {
+      vtkLog(ERROR,
+        "Error " << error << " with " << numberOfPartitions << " partitions, "
+                 << sequentialError << " sequentially.");
+      success = false;
+    }
+    vtkDataArray* outScalars = output->GetPointData()->GetScalars();
+    if (!outScalars || outScalars->GetNumberOfTuples() != output->GetNumberOfPoints())
+    {
+      vtkLog(ERROR, "Point data not mapped with " << numberOfPartitions << " partitions.");
+      success = false;
+    }
+  }
+
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
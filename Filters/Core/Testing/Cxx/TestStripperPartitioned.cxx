@@ -0,0 +1,181 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check the threaded vtkTriangleFilter on cells of every kind, and that
+// vtkStripper stripping partitions concurrently covers every input triangle
+// exactly once with the right original cell ids.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkFieldData.h"
+#include "vtkIdTypeArray.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPlaneSource.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkStripper.h"
+#include "vtkTriangleFilter.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+using Triangle = std::array<vtkIdType, 3>;
+
+Triangle SortedTriangle(vtkIdType p0, vtkIdType p1, vtkIdType p2)
+{
+  Triangle tri = { p0, p1, p2 };
+  std::sort(tri.begin(), tri.end());
+  return tri;
+}
+
+bool TestTriangleFilter()
+{
+  vtkNew<vtkPoints> points;
+  points->InsertNextPoint(0, 0, 0);
+  points->InsertNextPoint(2, 0, 0);
+  points->InsertNextPoint(2, 2, 0);
+  points->InsertNextPoint(1, 1, 0); // makes a concave polygon
+  points->InsertNextPoint(0, 2, 0);
+  points->InsertNextPoint(1, 3, 0);
+
+  vtkNew<vtkCellArray> verts;
+  verts->InsertNextCell({ 0, 1, 2 });
+  vtkNew<vtkCellArray> lines;
+  lines->InsertNextCell({ 0, 1, 2, 3 });
+  vtkNew<vtkCellArray> polys;
+  polys->InsertNextCell({ 0, 1, 2 });
+  polys->InsertNextCell({ 0, 1, 2, 3, 4 });
+  vtkNew<vtkCellArray> strips;
+  strips->InsertNextCell({ 0, 1, 4, 2, 5 });
+
+  vtkNew<vtkIdTypeArray> cellIds;
+  cellIds->SetName("CellIds");
+  for (vtkIdType cellId = 0; cellId < 5; ++cellId)
+  {
+    cellIds->InsertNextValue(cellId);
+  }
+  vtkNew<vtkPolyData> input;
+  input->SetPoints(points);
+  input->SetVerts(verts);
+  input->SetLines(lines);
+  input->SetPolys(polys);
+  input->SetStrips(strips);
+  input->GetCellData()->AddArray(cellIds);
+
+  vtkNew<vtkTriangleFilter> triangulate;
+  triangulate->SetInputData(input);
+  triangulate->Update();
+  vtkPolyData* output = triangulate->GetOutput();
+
+  // 3 verts, 3 lines, 1 + 3 triangles from the polygons, 3 from the strip
+  const vtkIdType expectedIds[] = { 0, 0, 0, 1, 1, 1, 2, 3, 3, 3, 4, 4, 4 };
+  vtkIdTypeArray* outIds =
+    vtkIdTypeArray::SafeDownCast(output->GetCellData()->GetArray("CellIds"));
+  if (output->GetNumberOfVerts() != 3 || output->GetNumberOfLines() != 3 ||
+    output->GetNumberOfPolys() != 7 || !outIds || outIds->GetNumberOfValues() != 13 ||
+    !std::equal(expectedIds, expectedIds + 13, outIds->GetPointer(0)))
+  {
+    vtkLog(ERROR, "Wrong triangulation of the cells");
+    return false;
+  }
+
+  // the second triangle of the strip is flipped to keep its orientation
+  vtkIdType npts;
+  const vtkIdType* pts;
+  output->GetPolys()->GetCellAtId(5, npts, pts);
+  if (npts != 3 || pts[0] != 4 || pts[1] != 1 || pts[2] != 2)
+  {
+    vtkLog(ERROR, "Wrong orientation of the strip triangles");
+    return false;
+  }
+
+  triangulate->PassVertsOff();
+  triangulate->PassLinesOff();
+  triangulate->Update();
+  output = triangulate->GetOutput();
+  if (output->GetNumberOfVerts() != 0 || output->GetNumberOfLines() != 0 ||
+    output->GetNumberOfPolys() != 7)
+  {
+    vtkLog(ERROR, "Verts or lines passed when they should not");
+    return false;
+  }
+  return true;
+}
+
+bool TestPartitionedStripper()
+{
+  vtkNew<vtkPlaneSource> plane;
+  plane->SetResolution(200, 150);
+  vtkNew<vtkTriangleFilter> triangulate;
+  triangulate->SetInputConnection(plane->GetOutputPort());
+  triangulate->Update();
+  vtkPolyData* triangles = triangulate->GetOutput();
+  const vtkIdType numTriangles = triangles->GetNumberOfPolys();
+  if (numTriangles != 2 * 200 * 150)
+  {
+    vtkLog(ERROR, "Wrong number of triangles " << numTriangles);
+    return false;
+  }
+
+  vtkNew<vtkStripper> stripper;
+  stripper->SetInputData(triangles);
+  stripper->SetNumberOfPartitions(4);
+  stripper->PassThroughCellIdsOn();
+  stripper->Update();
+  vtkPolyData* output = stripper->GetOutput();
+  vtkIdTypeArray* originalIds =
+    vtkIdTypeArray::SafeDownCast(output->GetFieldData()->GetArray("vtkOriginalCellIds"));
+  if (!originalIds || originalIds->GetNumberOfValues() != numTriangles ||
+    output->GetNumberOfPolys() != 0)
+  {
+    vtkLog(ERROR, "Wrong original cell ids");
+    return false;
+  }
+
+  // Every triangle of the strips must be the input triangle of its original
+  // id, and every input triangle must be used once.
+  std::vector<int> uses(numTriangles, 0);
+  vtkIdType idIndex = 0;
+  vtkIdType npts;
+  const vtkIdType* pts;
+  vtkCellArray* strips = output->GetStrips();
+  for (vtkIdType stripId = 0; stripId < strips->GetNumberOfCells(); ++stripId)
+  {
+    strips->GetCellAtId(stripId, npts, pts);
+    for (vtkIdType i = 0; i < npts - 2; ++i, ++idIndex)
+    {
+      const vtkIdType inputId = originalIds->GetValue(idIndex);
+      vtkIdType numInputPts;
+      const vtkIdType* inputPts;
+      triangles->GetPolys()->GetCellAtId(inputId, numInputPts, inputPts);
+      if (SortedTriangle(pts[i], pts[i + 1], pts[i + 2]) !=
+        SortedTriangle(inputPts[0], inputPts[1], inputPts[2]))
+      {
+        vtkLog(ERROR, "Strip triangle does not match input cell " << inputId);
+        return false;
+      }
+      uses[inputId]++;
+    }
+  }
+  if (std::any_of(uses.begin(), uses.end(), [](int use) { return use != 1; }))
+  {
+    vtkLog(ERROR, "Input triangles are not all stripped once");
+    return false;
+  }
+  return true;
+}
+}
+
+int TestStripperPartitioned(int, char*[])
+{
+  if (!TestTriangleFilter() || !TestPartitionedStripper())
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
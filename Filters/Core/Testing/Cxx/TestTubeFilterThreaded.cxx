@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the tubes of many polylines generated by vtkTubeFilter with
+// several threads are identical to the ones generated with a single thread.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkLogger.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkTestUtilities.h"
+#include "vtkTubeFilter.h"
+
+#include <cstdlib>
+
+namespace
+{
+vtkSmartPointer<vtkPolyData> CreateLines(vtkIdType numLines, vtkIdType numPtsPerLine)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(1);
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToDouble();
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("Scalars");
+  vtkNew<vtkCellArray> lines;
+  vtkNew<vtkDoubleArray> cellScalars;
+  cellScalars->SetName("CellScalars");
+  for (vtkIdType lineId = 0; lineId < numLines; ++lineId)
+  {
+    double x[3] = { random->GetNextValue(), random->GetNextValue(), random->GetNextValue() };
+    lines->InsertNextCell(numPtsPerLine);
+    for (vtkIdType i = 0; i < numPtsPerLine; ++i)
+    {
+      for (int j = 0; j < 3; ++j)
+      {
+        x[j] += 0.1 * random->GetNextValue();
+      }
+      // duplicate some points to exercise the removal of degenerate segments
+      if (i != 3)
+      {
+        points->InsertNextPoint(x);
+        scalars->InsertNextValue(random->GetNextValue());
+      }
+      lines->InsertCellPoint(points->GetNumberOfPoints() - 1);
+    }
+    cellScalars->InsertNextValue(lineId);
+  }
+  // a degenerate line that is not tubed
+  lines->InsertNextCell(2);
+  lines->InsertCellPoint(0);
+  lines->InsertCellPoint(0);
+  cellScalars->InsertNextValue(-1);
+
+  auto polyData = vtkSmartPointer<vtkPolyData>::New();
+  polyData->SetPoints(points);
+  polyData->SetLines(lines);
+  polyData->GetPointData()->SetScalars(scalars);
+  polyData->GetCellData()->SetScalars(cellScalars);
+  return polyData;
+}
+}
+
+int TestTubeFilterThreaded(int, char*[])
+{
+  // A single polyline with 4 points, tubed with 6 sides and capped
+  vtkSmartPointer<vtkPolyData> line = CreateLines(1, 5);
+  vtkNew<vtkTubeFilter> tubes;
+  tubes->SetInputData(line);
+  tubes->SetNumberOfSides(6);
+  tubes->CappingOn();
+  tubes->Update();
+  if (tubes->GetOutput()->GetNumberOfPoints() != 4 * 6 + 2 * 6 ||
+    tubes->GetOutput()->GetNumberOfCells() != 6 + 2)
+  {
+    vtkLog(ERROR,
+      "Unexpected tube of " << tubes->GetOutput()->GetNumberOfPoints() << " points and "
+                            << tubes->GetOutput()->GetNumberOfCells() << " cells.");
+    return EXIT_FAILURE;
+  }
+
+  tubes->SetInputData(CreateLines(2000, 20));
+  tubes->SetGenerateTCoordsToNormalizedLength();
+  tubes->SetVaryRadiusToVaryRadiusByScalar();
+  for (int sidesShareVertices = 0; sidesShareVertices < 2; ++sidesShareVertices)
+  {
+    tubes->SetSidesShareVertices(sidesShareVertices);
+    tubes->SetOnRatio(1 + sidesShareVertices);
+
+    vtkNew<vtkPolyData> serial;
+    vtkSMPTools::LocalScope(vtkSMPTools::Config{ 1 }, [&]() { tubes->Update(); });
+    serial->DeepCopy(tubes->GetOutput());
+
+    tubes->Modified();
+    tubes->Update();
+    if (!vtkTestUtilities::CompareDataObjects(serial, tubes->GetOutput()))
+    {
+      vtkLog(ERROR, "Threaded tubes differ with SidesShareVertices " << sidesShareVertices);
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -39,6 +39,7 @@
 
 #include <algorithm>
 #include <numeric>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtk3DLinearGridPlaneCutter);
@@ -524,6 +525,7 @@ struct ProducePDAttributes
   {
     bool isFirst = vtkSMPTools::GetSingleThread();
     vtkIdType checkAbortInterval = std::min((endPtId - ptId) / 10 + 1, (vtkIdType)1000);
+    ArrayList::EdgeBatch batch(this->Arrays);
     for (; ptId < endPtId; ++ptId)
     {
       if (ptId % checkAbortInterval == 0)
@@ -541,8 +543,9 @@ struct ProducePDAttributes
       TIds v0 = mergeTuple.V0;
       TIds v1 = mergeTuple.V1;
       float t = mergeTuple.Data.T;
-      this->Arrays->InterpolateEdge(v0, v1, t, ptId);
+      batch.Add(v0, v1, t, ptId);
     }
+    batch.Flush();
   }
 };
 
@@ -565,6 +568,11 @@ struct ProduceCDAttributes
   {
     bool isFirst = vtkSMPTools::GetSingleThread();
     vtkIdType checkAbortInterval = std::min((endCellId - cellId) / 10 + 1, (vtkIdType)1000);
+    // Gather the cell data in blocks to process the arrays one at a time.
+    const vtkIdType blockSize = 1024;
+    vtkIdType startCellId = cellId;
+    std::vector<vtkIdType> inCellIds;
+    inCellIds.reserve(std::min(endCellId - cellId, blockSize));
     for (; cellId < endCellId; ++cellId)
     {
       if (cellId % checkAbortInterval == 0)
@@ -579,8 +587,16 @@ struct ProduceCDAttributes
         }
       }
       // retrieve CellData for the corresponding cell
-      this->Arrays->Copy(this->Cells[cellId], cellId);
+      inCellIds.push_back(this->Cells[cellId]);
+      if (static_cast<vtkIdType>(inCellIds.size()) == blockSize)
+      {
+        this->Arrays->CopyTuples(blockSize, inCellIds.data(), startCellId);
+        startCellId += blockSize;
+        inCellIds.clear();
+      }
     }
+    this->Arrays->CopyTuples(
+      static_cast<vtkIdType>(inCellIds.size()), inCellIds.data(), startCellId);
   }
 };
 
@@ -768,6 +784,7 @@ struct ProduceMergedAttributes
     float t;
     bool isFirst = vtkSMPTools::GetSingleThread();
     vtkIdType checkAbortInterval = std::min((endPtId - ptId) / 10 + 1, (vtkIdType)1000);
+    ArrayList::EdgeBatch batch(this->Arrays);
 
     for (; ptId < endPtId; ++ptId)
     {
@@ -786,8 +803,9 @@ struct ProduceMergedAttributes
       v0 = mergeTuple->V0;
       v1 = mergeTuple->V1;
       t = mergeTuple->Data.T;
-      this->Arrays->InterpolateEdge(v0, v1, t, ptId);
+      batch.Add(v0, v1, t, ptId);
     }
+    batch.Flush();
   }
 };
 
@@ -0,0 +1,163 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkAppendDataInternal
+ * @brief   parallel copy of the data of appended datasets
+ *
+ * vtkAppendDataInternal copies the cells and ranges of tuples of the point or
+ * cell attributes of several inputs into presized outputs. The copies of
+ * every input range and every array are independent, so they are performed
+ * concurrently with vtkSMPTools. Large ranges are split so that a single
+ * large input does not serialize the copy.
+ *
+ * @warning
+ * This file is meant as a private include file to avoid code duplication. At
+ * this time it is not meant to define a public API (the API is likely to change
+ * in the future). If you write code that depends on this include, be prepared to
+ * change it in the future (without complaint).
+ *
+ * @sa
+ * vtkAppendFilter vtkAppendPolyData
+ */
+
+#ifndef vtkAppendDataInternal_h
+#define vtkAppendDataInternal_h
+
+#include "vtkAbstractArray.h"
+#include "vtkArrayDispatch.h"
+#include "vtkCellArray.h"
+#include "vtkDataArray.h"
+#include "vtkDataArrayRange.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{ // anonymous namespace
+
+// Number of tuples above which a range is copied in several pieces
+const vtkIdType APPEND_PIECE_SIZE = 65536;
+
+// Copy of NumberOfTuples tuples of Input, starting at SourceStart, to the
+// output at DestinationStart. InputIndex is the index of Input in the field
+// list describing the output arrays.
+struct AppendRange
+{
+  int InputIndex;
+  vtkDataSetAttributes* Input;
+  vtkIdType SourceStart;
+  vtkIdType NumberOfTuples;
+  vtkIdType DestinationStart;
+};
+
+struct AppendTuplesWorker
+{
+  template <typename DestArrayT, typename SourceArrayT>
+  void operator()(DestArrayT* dest, SourceArrayT* source, vtkIdType sourceStart,
+    vtkIdType numTuples, vtkIdType destStart)
+  {
+    const auto sourceTuples =
+      vtk::DataArrayTupleRange(source, sourceStart, sourceStart + numTuples);
+    auto destTuples = vtk::DataArrayTupleRange(dest, destStart, destStart + numTuples);
+    std::copy(sourceTuples.cbegin(), sourceTuples.cend(), destTuples.begin());
+  }
+};
+
+// Copy the cells of a cell array at the given location of the output offsets
+// and connectivity, shifting the offsets and the point ids.
+struct AppendCellsImpl
+{
+  template <typename CellStateT>
+  void operator()(CellStateT& state, vtkIdType* outOffsets, vtkIdType* outConnectivity,
+    vtkIdType connectivityOffset, vtkIdType pointOffset)
+  {
+    const auto offsets = vtk::DataArrayValueRange<1>(state.GetOffsets());
+    const auto connectivity = vtk::DataArrayValueRange<1>(state.GetConnectivity());
+    const vtkIdType numCells = static_cast<vtkIdType>(offsets.size()) - 1;
+    for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+    {
+      outOffsets[cellId] = static_cast<vtkIdType>(offsets[cellId]) + connectivityOffset;
+    }
+    vtkIdType* outPtId = outConnectivity;
+    for (const auto ptId : connectivity)
+    {
+      *outPtId++ = static_cast<vtkIdType>(ptId) + pointOffset;
+    }
+  }
+};
+
+/**
+ * Copy the ranges of tuples of the inputs to output, which is resized to
+ * numTuples tuples. Data arrays are copied concurrently; other arrays (e.g.
+ * string arrays) are copied serially.
+ */
+void AppendAttributes(const vtkDataSetAttributes::FieldList& fieldList,
+  const std::vector<AppendRange>& ranges, vtkDataSetAttributes* output, vtkIdType numTuples)
+{
+  for (int i = 0; i < output->GetNumberOfArrays(); ++i)
+  {
+    output->GetAbstractArray(i)->SetNumberOfTuples(numTuples);
+  }
+
+  struct CopyTask
+  {
+    vtkAbstractArray* Source;
+    vtkAbstractArray* Destination;
+    vtkIdType SourceStart;
+    vtkIdType NumberOfTuples;
+    vtkIdType DestinationStart;
+  };
+  std::vector<CopyTask> tasks;
+  for (const AppendRange& range : ranges)
+  {
+    if (range.NumberOfTuples <= 0)
+    {
+      continue;
+    }
+    fieldList.TransformData(range.InputIndex, range.Input, output,
+      [&](vtkAbstractArray* source, vtkAbstractArray* dest) {
+        if (!vtkDataArray::SafeDownCast(source) || !vtkDataArray::SafeDownCast(dest))
+        {
+          dest->InsertTuples(
+            range.DestinationStart, range.NumberOfTuples, range.SourceStart, source);
+          return;
+        }
+        for (vtkIdType begin = 0; begin < range.NumberOfTuples; begin += APPEND_PIECE_SIZE)
+        {
+          tasks.push_back(CopyTask{ source, dest, range.SourceStart + begin,
+            std::min(APPEND_PIECE_SIZE, range.NumberOfTuples - begin),
+            range.DestinationStart + begin });
+        }
+      });
+  }
+
+  vtkSMPTools::For(0, static_cast<vtkIdType>(tasks.size()), 1,
+    [&tasks](vtkIdType taskId, vtkIdType endTaskId) {
+      AppendTuplesWorker worker;
+      for (; taskId < endTaskId; ++taskId)
+      {
+        const CopyTask& task = tasks[taskId];
+        auto source = static_cast<vtkDataArray*>(task.Source);
+        auto dest = static_cast<vtkDataArray*>(task.Destination);
+        if (!vtkArrayDispatch::Dispatch2SameValueType::Execute(dest, source, worker,
+              task.SourceStart, task.NumberOfTuples, task.DestinationStart))
+        {
+          // Use vtkDataArray API when fast-path dispatch fails.
+          worker(dest, source, task.SourceStart, task.NumberOfTuples, task.DestinationStart);
+        }
+      }
+    });
+
+  // The values were written directly, let the arrays know they changed
+  for (int i = 0; i < output->GetNumberOfArrays(); ++i)
+  {
+    output->GetAbstractArray(i)->Modified();
+  }
+}
+
+} // anonymous namespace
+
+#endif
+// VTK-HeaderTest-Exclude: vtkAppendDataInternal.h
@@ -2,8 +2,10 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkAppendFilter.h"
 
+#include "vtkAppendDataInternal.h"
 #include "vtkBoundingBox.h"
 #include "vtkCell.h"
+#include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkDataSetCollection.h"
 #include "vtkIdTypeArray.h"
@@ -13,16 +15,163 @@
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkPointSet.h"
+#include "vtkPoints.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkAppendFilter);
 
+namespace
+{
+// Append the points and cells of inputs to the presized newPts and to output
+// without merging points. The inputs are copied concurrently, each at the
+// offsets given by the sizes of the inputs before it.
+void AppendInParallel(vtkAlgorithm* self, const std::vector<vtkDataSet*>& inputs,
+  vtkPoints* newPts, vtkUnstructuredGrid* output)
+{
+  const vtkIdType numInputs = static_cast<vtkIdType>(inputs.size());
+
+  // Build the cell map and cell types of the inputs that are not unstructured
+  // grids (those are copied from their cell arrays), so that the concurrent
+  // GetCellType() and GetCellPoints() calls below only read them.
+  vtkNew<vtkIdList> ptIds;
+  for (vtkDataSet* dataSet : inputs)
+  {
+    if (dataSet->GetNumberOfCells() > 0 && !vtkUnstructuredGrid::SafeDownCast(dataSet))
+    {
+      dataSet->GetCellType(0);
+      dataSet->GetCellPoints(0, ptIds);
+    }
+  }
+
+  // The offsets of every input in the output points, cells and connectivity
+  std::vector<vtkIdType> pointOffsets(numInputs + 1, 0);
+  std::vector<vtkIdType> cellOffsets(numInputs + 1, 0);
+  std::vector<vtkIdType> connectivityOffsets(numInputs + 1, 0);
+  vtkSMPThreadLocalObject<vtkIdList> tlPtIds;
+  vtkSMPTools::For(0, numInputs, 1, [&](vtkIdType inputId, vtkIdType endInputId) {
+    vtkIdList* cellPtIds = tlPtIds.Local();
+    vtkIdType npts;
+    const vtkIdType* pts;
+    for (; inputId < endInputId; ++inputId)
+    {
+      vtkDataSet* dataSet = inputs[inputId];
+      pointOffsets[inputId] = dataSet->GetNumberOfPoints();
+      cellOffsets[inputId] = dataSet->GetNumberOfCells();
+      vtkUnstructuredGrid* ug = vtkUnstructuredGrid::SafeDownCast(dataSet);
+      if (ug && ug->GetCells())
+      {
+        connectivityOffsets[inputId] = ug->GetCells()->GetNumberOfConnectivityIds();
+        continue;
+      }
+      for (vtkIdType cellId = 0; cellId < dataSet->GetNumberOfCells(); ++cellId)
+      {
+        dataSet->GetCellPoints(cellId, npts, pts, cellPtIds);
+        connectivityOffsets[inputId] += npts;
+      }
+    }
+  });
+  for (std::vector<vtkIdType>* offsets : { &pointOffsets, &cellOffsets, &connectivityOffsets })
+  {
+    vtkSMPTools::ExclusiveScan(offsets->begin(), offsets->end(), offsets->begin(), vtkIdType(0));
+  }
+
+  vtkNew<vtkUnsignedCharArray> types;
+  types->SetNumberOfValues(cellOffsets[numInputs]);
+  vtkNew<vtkIdTypeArray> offsets;
+  offsets->SetNumberOfValues(cellOffsets[numInputs] + 1);
+  offsets->SetValue(cellOffsets[numInputs], connectivityOffsets[numInputs]);
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfValues(connectivityOffsets[numInputs]);
+
+  vtkSMPTools::For(0, numInputs, 1, [&](vtkIdType inputId, vtkIdType endInputId) {
+    vtkIdList* cellPtIds = tlPtIds.Local();
+    vtkIdType npts;
+    const vtkIdType* pts;
+    double p[3];
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; inputId < endInputId; ++inputId)
+    {
+      if (isFirst)
+      {
+        self->CheckAbort();
+      }
+      if (self->GetAbortOutput())
+      {
+        break;
+      }
+      vtkDataSet* dataSet = inputs[inputId];
+      const vtkIdType ptOffset = pointOffsets[inputId];
+      const vtkIdType cellOffset = cellOffsets[inputId];
+      const vtkIdType connOffset = connectivityOffsets[inputId];
+
+      // copy points
+      vtkPointSet* ps = vtkPointSet::SafeDownCast(dataSet);
+      if (ps && ps->GetPoints())
+      {
+        vtkDataArray* source = ps->GetPoints()->GetData();
+        vtkDataArray* dest = newPts->GetData();
+        AppendTuplesWorker worker;
+        if (!vtkArrayDispatch::Dispatch2SameValueType::Execute(
+              dest, source, worker, 0, ps->GetNumberOfPoints(), ptOffset))
+        {
+          // Use vtkDataArray API when fast-path dispatch fails.
+          worker(dest, source, 0, ps->GetNumberOfPoints(), ptOffset);
+        }
+      }
+      else
+      {
+        for (vtkIdType ptId = 0; ptId < dataSet->GetNumberOfPoints(); ++ptId)
+        {
+          dataSet->GetPoint(ptId, p);
+          newPts->SetPoint(ptId + ptOffset, p);
+        }
+      }
+
+      // copy cells
+      if (auto ug = vtkUnstructuredGrid::SafeDownCast(dataSet))
+      {
+        if (ug->GetNumberOfCells() > 0)
+        {
+          std::copy_n(ug->GetCellTypesArray()->GetPointer(0), ug->GetNumberOfCells(),
+            types->GetPointer(cellOffset));
+          ug->GetCells()->Visit(AppendCellsImpl{}, offsets->GetPointer(cellOffset),
+            connectivity->GetPointer(connOffset), connOffset, ptOffset);
+        }
+        continue;
+      }
+      vtkIdType* outPtId = connectivity->GetPointer(connOffset);
+      for (vtkIdType cellId = 0; cellId < dataSet->GetNumberOfCells(); ++cellId)
+      {
+        dataSet->GetCellPoints(cellId, npts, pts, cellPtIds);
+        types->SetValue(
+          cellOffset + cellId, static_cast<unsigned char>(dataSet->GetCellType(cellId)));
+        offsets->SetValue(cellOffset + cellId, outPtId - connectivity->GetPointer(0));
+        for (vtkIdType i = 0; i < npts; ++i)
+        {
+          *outPtId++ = pts[i] + ptOffset;
+        }
+      }
+    }
+  });
+
+  vtkNew<vtkCellArray> cells;
+  cells->SetData(offsets, connectivity);
+  output->SetCells(types, cells);
+}
+} // anonymous namespace
+
 //------------------------------------------------------------------------------
 vtkAppendFilter::vtkAppendFilter()
 {
@@ -220,6 +369,35 @@ int vtkAppendFilter::RequestData(vtkInformation* vtkNotUsed(request),
     newPts->SetNumberOfPoints(totalNumPts);
   }
 
+  // Without point merging, the output sizes are known from the inputs and
+  // the inputs are copied concurrently. Polyhedra, whose faces are stored
+  // apart from the connectivity, are appended serially.
+  std::vector<vtkDataSet*> inputList;
+  bool appendInParallel = !reallyMergePoints;
+  inputs->InitTraversal(iter);
+  while ((dataSet = inputs->GetNextDataSet(iter)))
+  {
+    vtkUnstructuredGrid* ug = vtkUnstructuredGrid::SafeDownCast(dataSet);
+    appendInParallel = appendInParallel && !(ug && ug->GetFaces());
+    inputList.push_back(dataSet);
+  }
+  if (appendInParallel)
+  {
+    AppendInParallel(this, inputList, newPts, output);
+    this->UpdateProgress(0.5);
+    if (!this->CheckAbort())
+    {
+      output->GetPointData()->CopyAllOn(vtkDataSetAttributes::COPYTUPLE);
+      output->GetCellData()->CopyAllOn(vtkDataSetAttributes::COPYTUPLE);
+      this->AppendArrays(vtkDataObject::POINT, inputVector, nullptr, output, totalNumPts);
+      this->UpdateProgress(0.75);
+      this->AppendArrays(vtkDataObject::CELL, inputVector, nullptr, output, totalNumCells);
+      this->UpdateProgress(1.0);
+    }
+    output->SetPoints(newPts);
+    return 1;
+  }
+
   vtkSmartPointer<vtkIdList> ptIds = vtkSmartPointer<vtkIdList>::New();
   ptIds->Allocate(VTK_CELL_SIZE);
   vtkSmartPointer<vtkIdList> newPtIds = vtkSmartPointer<vtkIdList>::New();
@@ -446,9 +624,11 @@ void vtkAppendFilter::AppendArrays(int attributesType, vtkInformationVector** in
   vtkDataSetAttributes* outputData = output->GetAttributes(attributesType);
   outputData->CopyAllocate(fieldList, totalNumberOfElements);
 
-  // copy arrays.
+  // copy arrays. Without global ids, the inputs are copied concurrently in
+  // consecutive ranges of the output.
   int inputIndex;
   vtkIdType offset = 0;
+  std::vector<AppendRange> ranges;
   for (inputIndex = 0, dataSet = nullptr, inputs->InitTraversal(iter);
        (dataSet = inputs->GetNextDataSet(iter));)
   {
@@ -464,12 +644,16 @@ void vtkAppendFilter::AppendArrays(int attributesType, vtkInformationVector** in
       }
       else
       {
-        fieldList.CopyData(inputIndex, inputData, 0, numberOfInputTuples, outputData, offset);
+        ranges.push_back(AppendRange{ inputIndex, inputData, 0, numberOfInputTuples, offset });
       }
       offset += numberOfInputTuples;
       ++inputIndex;
     }
   }
+  if (globalIds == nullptr)
+  {
+    AppendAttributes(fieldList, ranges, outputData, totalNumberOfElements);
+  }
 }
 
 //------------------------------------------------------------------------------
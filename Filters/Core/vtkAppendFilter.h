@@ -17,6 +17,10 @@
  * "GlobalPointIds"), then two points are merged if they share the same point global id,
  * without checking for coincident point.
  *
+ * When points are not merged, the output is allocated from the sizes of the
+ * inputs and the inputs are copied concurrently with vtkSMPTools, unless
+ * an input holds polyhedra.
+ *
  * @sa
  * vtkAppendPolyData
  */
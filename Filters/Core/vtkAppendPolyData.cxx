@@ -3,22 +3,28 @@
 #include "vtkAppendPolyData.h"
 
 #include "vtkAlgorithmOutput.h"
+#include "vtkAppendDataInternal.h"
 #include "vtkArrayDispatch.h"
 #include "vtkAssume.h"
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkDataArrayRange.h"
 #include "vtkDataSetAttributes.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTrivialProducer.h"
 
 #include <cassert>
 #include <cstdlib>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkAppendPolyData);
@@ -113,13 +119,8 @@ int vtkAppendPolyData::ExecuteAppend(vtkPolyData* output, vtkPolyData* inputs[],
 {
   int idx;
   vtkPolyData* ds;
-  vtkPoints* inPts;
   vtkPoints* newPts;
-  vtkCellArray *inVerts, *newVerts;
-  vtkCellArray *inLines, *newLines;
-  vtkCellArray *inPolys, *newPolys;
   vtkIdType sizePolys, numPolys;
-  vtkCellArray *inStrips, *newStrips;
   vtkIdType numPts, numCells;
   vtkPointData* inPD = nullptr;
   vtkCellData* inCD = nullptr;
@@ -276,40 +277,54 @@ int vtkAppendPolyData::ExecuteAppend(vtkPolyData* output, vtkPolyData* inputs[],
 
   newPts->SetNumberOfPoints(numPts);
 
-  newVerts = vtkCellArray::New();
-  bool allocated = newVerts->AllocateExact(numVerts, sizeVerts);
-
-  if (sizeVerts > 0 && !allocated)
-  {
-    vtkErrorMacro(<< "Memory allocation failed in append filter");
-    return 0;
-  }
-
-  newLines = vtkCellArray::New();
-  allocated = newLines->AllocateExact(numLines, sizeLines);
-
-  if (sizeLines > 0 && !allocated)
-  {
-    vtkErrorMacro(<< "Memory allocation failed in append filter");
-    return 0;
-  }
-
-  newPolys = vtkCellArray::New();
-  allocated = newPolys->AllocateExact(numPolys, sizePolys);
-
-  if (sizePolys > 0 && !allocated)
+  // The offsets of every input in the output points, and in the cells and
+  // connectivity of each kind of cell (verts, lines, polys and strips).
+  struct InputOffsets
+  {
+    vtkIdType Points;
+    vtkIdType Cells[4];
+    vtkIdType Connectivity[4];
+  };
+  std::vector<InputOffsets> inputOffsets(numInputs);
+  const vtkIdType numCellsOfKind[4] = { numVerts, numLines, numPolys, numStrips };
+  const vtkIdType connectivitySizes[4] = { sizeVerts, sizeLines, sizePolys, sizeStrips };
+  const vtkIdType kindStarts[4] = { 0, numVerts, numVerts + numLines,
+    numVerts + numLines + numPolys };
+  InputOffsets nextOffsets = { 0, { 0, 0, 0, 0 }, { 0, 0, 0, 0 } };
+  for (idx = 0; idx < numInputs; ++idx)
   {
-    vtkErrorMacro(<< "Memory allocation failed in append filter");
-    return 0;
+    inputOffsets[idx] = nextOffsets;
+    ds = inputs[idx];
+    if (ds != nullptr && (ds->GetNumberOfPoints() > 0 || ds->GetNumberOfCells() > 0))
+    {
+      nextOffsets.Points += ds->GetNumberOfPoints();
+      if (ds->GetNumberOfCells() > 0)
+      {
+        vtkCellArray* inCells[4] = { ds->GetVerts(), ds->GetLines(), ds->GetPolys(),
+          ds->GetStrips() };
+        for (int kind = 0; kind < 4; ++kind)
+        {
+          nextOffsets.Cells[kind] += inCells[kind]->GetNumberOfCells();
+          nextOffsets.Connectivity[kind] += inCells[kind]->GetNumberOfConnectivityIds();
+        }
+      }
+    }
   }
 
-  newStrips = vtkCellArray::New();
-  allocated = newStrips->AllocateExact(numStrips, sizeStrips);
-
-  if (sizeStrips > 0 && !allocated)
+  vtkSmartPointer<vtkIdTypeArray> offsets[4];
+  vtkSmartPointer<vtkIdTypeArray> connectivity[4];
+  for (int kind = 0; kind < 4; ++kind)
   {
-    vtkErrorMacro(<< "Memory allocation failed in append filter");
-    return 0;
+    offsets[kind] = vtkSmartPointer<vtkIdTypeArray>::New();
+    connectivity[kind] = vtkSmartPointer<vtkIdTypeArray>::New();
+    if (!offsets[kind]->SetNumberOfValues(numCellsOfKind[kind] + 1) ||
+      !connectivity[kind]->SetNumberOfValues(connectivitySizes[kind]))
+    {
+      vtkErrorMacro(<< "Memory allocation failed in append filter");
+      newPts->Delete();
+      return 0;
+    }
+    offsets[kind]->SetValue(numCellsOfKind[kind], connectivitySizes[kind]);
   }
 
   // Since points are cells are not merged,
@@ -321,109 +336,121 @@ int vtkAppendPolyData::ExecuteAppend(vtkPolyData* output, vtkPolyData* inputs[],
   outputPD->CopyAllocate(ptList, numPts);
   outputCD->CopyAllocate(cellList, numCells);
 
-  // loop over all input sets
-  vtkIdType ptOffset = 0;
-  vtkIdType vertOffset = 0;
-  vtkIdType linesOffset = numVerts;
-  vtkIdType polysOffset = numVerts + numLines;
-  vtkIdType stripsOffset = numVerts + numLines + numPolys;
-  countPD = countCD = 0;
-  int checkAbortInterval = std::min(numInputs / 10 + 1, 1000);
-  for (idx = 0; idx < numInputs; ++idx)
+  // The points and cells of the inputs are copied concurrently at their
+  // offsets in the presized output, the point ids of the cells being shifted
+  // by the offset of the points of their input.
+  vtkIdType* offsetsPtrs[4];
+  vtkIdType* connectivityPtrs[4];
+  for (int kind = 0; kind < 4; ++kind)
   {
-    if (idx % checkAbortInterval == 0 && this->CheckAbort())
-    {
-      break;
-    }
-    this->UpdateProgress(0.2 + 0.8 * idx / numInputs);
-    ds = inputs[idx];
-    // this check is not necessary, but I'll put it in anyway
-    if (ds != nullptr)
+    offsetsPtrs[kind] = offsets[kind]->GetPointer(0);
+    connectivityPtrs[kind] = connectivity[kind]->GetPointer(0);
+  }
+  vtkSMPTools::For(0, numInputs, 1, [&](vtkIdType inputId, vtkIdType endInputId) {
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; inputId < endInputId; ++inputId)
     {
-      numPts = ds->GetNumberOfPoints();
-      numCells = ds->GetNumberOfCells();
-      if (numPts <= 0 && numCells <= 0)
+      if (isFirst)
+      {
+        this->CheckAbort();
+      }
+      if (this->GetAbortOutput())
+      {
+        break;
+      }
+      vtkPolyData* input = inputs[inputId];
+      if (input == nullptr || (input->GetNumberOfPoints() <= 0 && input->GetNumberOfCells() <= 0))
       {
         continue; // no input, just skip
       }
-
-      inPD = ds->GetPointData();
-      inCD = ds->GetCellData();
-
-      inPts = ds->GetPoints();
-      inVerts = ds->GetVerts();
-      inLines = ds->GetLines();
-      inPolys = ds->GetPolys();
-      inStrips = ds->GetStrips();
-
-      if (ds->GetNumberOfPoints() > 0)
+      const InputOffsets& inputOffset = inputOffsets[inputId];
+      if (input->GetNumberOfPoints() > 0)
       {
         // copy points directly
-        this->AppendData(newPts->GetData(), inPts->GetData(), ptOffset);
-        outputPD->CopyData(ptList, inPD, countPD, ptOffset, numPts, 0);
-        ++countPD;
+        this->AppendData(newPts->GetData(), input->GetPoints()->GetData(), inputOffset.Points);
       }
+      if (input->GetNumberOfCells() > 0)
+      {
+        vtkCellArray* inCells[4] = { input->GetVerts(), input->GetLines(), input->GetPolys(),
+          input->GetStrips() };
+        for (int kind = 0; kind < 4; ++kind)
+        {
+          inCells[kind]->Visit(AppendCellsImpl{}, offsetsPtrs[kind] + inputOffset.Cells[kind],
+            connectivityPtrs[kind] + inputOffset.Connectivity[kind],
+            inputOffset.Connectivity[kind], inputOffset.Points);
+        }
+      }
+    }
+  });
+  this->UpdateProgress(0.6);
+  if (this->CheckAbort())
+  {
+    newPts->Delete();
+    return 1;
+  }
 
-      if (ds->GetNumberOfCells() > 0)
+  // copy point and cell data
+  std::vector<AppendRange> pointRanges;
+  std::vector<AppendRange> cellRanges;
+  countPD = countCD = 0;
+  for (idx = 0; idx < numInputs; ++idx)
+  {
+    ds = inputs[idx];
+    if (ds == nullptr)
+    {
+      continue;
+    }
+    const InputOffsets& inputOffset = inputOffsets[idx];
+    if (ds->GetNumberOfPoints() > 0)
+    {
+      pointRanges.push_back(
+        AppendRange{ countPD, ds->GetPointData(), 0, ds->GetNumberOfPoints(), inputOffset.Points });
+      ++countPD;
+    }
+    if (ds->GetNumberOfCells() > 0)
+    {
+      // These are the cellIDs at which each of the cell types start.
+      vtkIdType kindIndex = 0;
+      const vtkIdType numInputCells[4] = { ds->GetNumberOfVerts(), ds->GetNumberOfLines(),
+        ds->GetNumberOfPolys(), ds->GetNumberOfStrips() };
+      for (int kind = 0; kind < 4; ++kind)
       {
-        // These are the cellIDs at which each of the cell types start.
-        vtkIdType vertsIndex = 0;
-        vtkIdType linesIndex = ds->GetNumberOfVerts();
-        vtkIdType polysIndex = linesIndex + ds->GetNumberOfLines();
-        vtkIdType stripsIndex = polysIndex + ds->GetNumberOfPolys();
-
-        // copy the cells
-        this->AppendCells(newVerts, inVerts, ptOffset);
-        this->AppendCells(newLines, inLines, ptOffset);
-        this->AppendCells(newPolys, inPolys, ptOffset);
-        this->AppendCells(newStrips, inStrips, ptOffset);
-
-        // copy cell data
-        outputCD->CopyData(cellList, inCD, countCD, vertOffset, ds->GetNumberOfVerts(), vertsIndex);
-        vertOffset += ds->GetNumberOfVerts();
-        outputCD->CopyData(
-          cellList, inCD, countCD, linesOffset, ds->GetNumberOfLines(), linesIndex);
-        linesOffset += ds->GetNumberOfLines();
-        outputCD->CopyData(
-          cellList, inCD, countCD, polysOffset, ds->GetNumberOfPolys(), polysIndex);
-        polysOffset += ds->GetNumberOfPolys();
-        outputCD->CopyData(
-          cellList, inCD, countCD, stripsOffset, ds->GetNumberOfStrips(), stripsIndex);
-        stripsOffset += ds->GetNumberOfStrips();
-        ++countCD;
+        cellRanges.push_back(AppendRange{ countCD, ds->GetCellData(), kindIndex,
+          numInputCells[kind], kindStarts[kind] + inputOffset.Cells[kind] });
+        kindIndex += numInputCells[kind];
       }
-      ptOffset += numPts;
+      ++countCD;
     }
   }
+  AppendAttributes(ptList, pointRanges, outputPD, numPts);
+  AppendAttributes(cellList, cellRanges, outputCD, numCells);
 
   // Update ourselves and release memory
   //
   output->SetPoints(newPts);
   newPts->Delete();
 
-  if (newVerts->GetNumberOfCells() > 0)
+  vtkNew<vtkCellArray> newCells[4];
+  for (int kind = 0; kind < 4; ++kind)
   {
-    output->SetVerts(newVerts);
+    newCells[kind]->SetData(offsets[kind], connectivity[kind]);
   }
-  newVerts->Delete();
-
-  if (newLines->GetNumberOfCells() > 0)
+  if (numVerts > 0)
   {
-    output->SetLines(newLines);
+    output->SetVerts(newCells[0]);
   }
-  newLines->Delete();
-
-  if (newPolys->GetNumberOfCells() > 0)
+  if (numLines > 0)
   {
-    output->SetPolys(newPolys);
+    output->SetLines(newCells[1]);
   }
-  newPolys->Delete();
-
-  if (newStrips->GetNumberOfCells() > 0)
+  if (numPolys > 0)
+  {
+    output->SetPolys(newCells[2]);
+  }
+  if (numStrips > 0)
   {
-    output->SetStrips(newStrips);
+    output->SetStrips(newCells[3]);
   }
-  newStrips->Delete();
 
   // When all optimizations are complete, this squeeze will be unnecessary.
   // (But it does not seem to cost much.)
@@ -12,6 +12,10 @@
  * attributes available.  (For example, if one dataset has point scalars but
  * another does not, point scalars will not be appended.)
  *
+ * The output is allocated from the sizes of the inputs, and the points,
+ * cells and attributes of the inputs are copied concurrently with
+ * vtkSMPTools.
+ *
  * @warning
  * The related filter vtkRemovePolyData enables the subtraction, or removal
  * of the cells of a vtkPolyData. Hence vtkRemovePolyData functions like the
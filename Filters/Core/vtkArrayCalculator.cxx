@@ -6,6 +6,7 @@
 #include "vtkCellData.h"
 #include "vtkCompositeDataIterator.h"
 #include "vtkCompositeDataSet.h"
+#include "vtkDataArrayRange.h"
 #include "vtkDataSet.h"
 #include "vtkDoubleArray.h"
 #include "vtkExprTkFunctionParser.h"
@@ -18,6 +19,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPointSet.h"
+#include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkSMPTools.h"
 #include "vtkTable.h"
@@ -94,6 +96,24 @@ typedef enum
 } ResultType;
 static ResultType resultType = SCALAR_RESULT;
 
+//------------------------------------------------------------------------------
+// Copy components of a range of tuples, interleaved, to a buffer of doubles
+struct vtkArrayCalculatorGatherWorker
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* array, vtkIdType begin, vtkIdType end, const int* components,
+    int numComponents, double* values) const
+  {
+    for (const auto tuple : vtk::DataArrayTupleRange(array, begin, end))
+    {
+      for (int c = 0; c < numComponents; c++)
+      {
+        *values++ = static_cast<double>(tuple[components[c]]);
+      }
+    }
+  }
+};
+
 //------------------------------------------------------------------------------
 template <typename TFunctionParser, typename TResultArray>
 class vtkArrayCalculatorFunctor
@@ -317,6 +337,173 @@ public:
   }
 
   void operator()(vtkIdType begin, vtkIdType end)
+  {
+    // Evaluate blocks of tuples at once when the parser supports it, and tuple by tuple
+    // otherwise or when the evaluation of a block fails.
+    const vtkIdType blockSize = 1024;
+    auto& functionParser = this->FunctionParser.Local();
+    for (vtkIdType blockBegin = begin; blockBegin < end; blockBegin += blockSize)
+    {
+      const vtkIdType blockEnd = std::min(blockBegin + blockSize, end);
+      if (!this->EvaluateBlock(functionParser.GetPointer(), blockBegin, blockEnd))
+      {
+        this->EvaluateTuples(blockBegin, blockEnd);
+      }
+    }
+  }
+
+  void Reduce() {}
+
+private:
+  /**
+   * Values of the variables gathered for a block of tuples.
+   */
+  struct BlockValues
+  {
+    std::vector<std::vector<double>> Columns;
+    std::vector<const double*> Scalars;
+    std::vector<const double*> Vectors;
+    std::vector<double> Points;
+    std::vector<double> Result;
+  };
+  vtkSMPThreadLocal<BlockValues> Block;
+
+  bool EvaluateBlock(vtkExprTkFunctionParser*, vtkIdType, vtkIdType) { return false; }
+
+  bool EvaluateBlock(vtkFunctionParser* functionParser, vtkIdType begin, vtkIdType end)
+  {
+    const vtkIdType n = end - begin;
+    auto& block = this->Block.Local();
+    const int numScalars = functionParser->GetNumberOfScalarVariables();
+    const int numVectors = functionParser->GetNumberOfVectorVariables();
+    block.Scalars.assign(static_cast<size_t>(numScalars), nullptr);
+    block.Vectors.assign(static_cast<size_t>(numVectors), nullptr);
+    size_t numColumns = 0;
+    auto newColumn = [&](vtkIdType size) {
+      if (numColumns == block.Columns.size())
+      {
+        block.Columns.emplace_back();
+      }
+      std::vector<double>& column = block.Columns[numColumns++];
+      column.resize(static_cast<size_t>(size));
+      return column.data();
+    };
+    vtkArrayCalculatorGatherWorker gather;
+    using Dispatcher = vtkArrayDispatch::Dispatch;
+
+    int j;
+    for (j = 0; j < this->ScalarArrayNamesSize; j++)
+    {
+      vtkDataArray* array = this->ScalarArrays[j];
+      const int idx = this->ScalarArrayIndices[j];
+      if (array && idx >= 0 && idx < numScalars)
+      {
+        double* column = newColumn(n);
+        const int* component = &this->SelectedScalarComponents[j];
+        if (!Dispatcher::Execute(array, gather, begin, end, component, 1, column))
+        {
+          gather(array, begin, end, component, 1, column);
+        }
+        block.Scalars[idx] = column;
+      }
+    }
+    for (j = 0; j < this->VectorArrayNamesSize; j++)
+    {
+      vtkDataArray* array = this->VectorArrays[j];
+      const int idx = this->VectorArrayIndices[j];
+      if (array && idx >= 0 && idx < numVectors)
+      {
+        double* column = newColumn(3 * n);
+        const int* components = this->SelectedVectorComponents[j].GetData();
+        if (!Dispatcher::Execute(array, gather, begin, end, components, 3, column))
+        {
+          gather(array, begin, end, components, 3, column);
+        }
+        block.Vectors[idx] = column;
+      }
+    }
+    if ((this->AttributeType == vtkDataObject::POINT ||
+          this->AttributeType == vtkDataObject::VERTEX) &&
+      (this->CoordinateScalarVariableNamesSize > 0 || this->CoordinateVectorVariableNamesSize > 0))
+    {
+      block.Points.resize(static_cast<size_t>(3 * n));
+      double* pt = block.Points.data();
+      vtkPointSet* pointSet = vtkPointSet::SafeDownCast(this->DsInput);
+      if (pointSet && pointSet->GetPoints())
+      {
+        const int xyz[3] = { 0, 1, 2 };
+        vtkDataArray* points = pointSet->GetPoints()->GetData();
+        if (!Dispatcher::Execute(points, gather, begin, end, xyz, 3, pt))
+        {
+          gather(points, begin, end, xyz, 3, pt);
+        }
+      }
+      else
+      {
+        for (vtkIdType i = begin; i < end; i++, pt += 3)
+        {
+          if (this->DsInput)
+          {
+            this->DsInput->GetPoint(i, pt);
+          }
+          else
+          {
+            this->GraphInput->GetPoint(i, pt);
+          }
+        }
+      }
+      const double* points = block.Points.data();
+      for (j = 0; j < this->CoordinateScalarVariableNamesSize; j++)
+      {
+        const int idx = j + this->ScalarArrayNamesSize;
+        if (idx < numScalars)
+        {
+          double* column = newColumn(n);
+          const int component = this->SelectedCoordinateScalarComponents[j];
+          for (vtkIdType i = 0; i < n; i++)
+          {
+            column[i] = points[3 * i + component];
+          }
+          block.Scalars[idx] = column;
+        }
+      }
+      for (j = 0; j < this->CoordinateVectorVariableNamesSize; j++)
+      {
+        const int idx = j + this->VectorArrayNamesSize;
+        if (idx < numVectors)
+        {
+          double* column = newColumn(3 * n);
+          const vtkTuple<int, 3>& components = this->SelectedCoordinateVectorComponents[j];
+          for (vtkIdType i = 0; i < n; i++)
+          {
+            column[3 * i] = points[3 * i + components[0]];
+            column[3 * i + 1] = points[3 * i + components[1]];
+            column[3 * i + 2] = points[3 * i + components[2]];
+          }
+          block.Vectors[idx] = column;
+        }
+      }
+    }
+
+    block.Result.resize(static_cast<size_t>(3 * n));
+    if (!functionParser->EvaluateBatch(
+          n, block.Scalars.data(), block.Vectors.data(), block.Result.data()))
+    {
+      return false;
+    }
+    const int numComponents = resultType == SCALAR_RESULT ? 1 : 3;
+    const double* value = block.Result.data();
+    for (auto tuple : vtk::DataArrayTupleRange(this->ResultArray, begin, end))
+    {
+      for (int c = 0; c < numComponents; c++)
+      {
+        tuple[c] = *value++;
+      }
+    }
+    return true;
+  }
+
+  void EvaluateTuples(vtkIdType begin, vtkIdType end)
   {
     auto resultArrayItr = vtk::DataArrayTupleRange(this->ResultArray, begin, end).begin();
     auto& functionParser = this->FunctionParser.Local();
@@ -384,8 +571,6 @@ public:
       }
     }
   }
-
-  void Reduce() {}
 };
 
 //------------------------------------------------------------------------------
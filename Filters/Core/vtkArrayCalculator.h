@@ -289,6 +289,9 @@ public:
   /**
    * Set/Get the FunctionParser type that will be used.
    * vtkFunctionParser = 0, vtkExprTkFunctionParser = 1. Default is 1.
+   * vtkFunctionParser evaluates the function for blocks of tuples at once
+   * (see vtkFunctionParser::EvaluateBatch), which is faster on large arrays
+   * for the functions both parsers support.
    */
   vtkSetEnumMacro(FunctionParserType, FunctionParserTypes);
   void SetFunctionParserTypeToFunctionParser()
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkCellCenters.h"
 
+#include "vtkArrayDispatch.h"
 #include "vtkCell.h"
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
@@ -9,19 +10,29 @@
 #include "vtkDataSet.h"
 #include "vtkDataSetAttributes.h"
 #include "vtkDoubleArray.h"
+#include "vtkForEachCell.h"
 #include "vtkGenericCell.h"
+#include "vtkHexahedron.h"
 #include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
+#include "vtkLine.h"
 #include "vtkLogger.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkPointSet.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkPyramid.h"
+#include "vtkQuad.h"
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
+#include "vtkTetra.h"
+#include "vtkTriangle.h"
 #include "vtkUnsignedCharArray.h"
+#include "vtkVertex.h"
+#include "vtkWedge.h"
 
 #include <atomic>
 
@@ -83,6 +94,85 @@ public:
   }
 };
 
+//==============================================================================
+// The center of a linear cell with a fixed number of points is the weighted
+// sum of its points, with weights that only depend on the cell type.
+struct CellCenterWeights
+{
+  std::vector<double> Weights[VTK_NUMBER_OF_CELL_TYPES];
+
+  CellCenterWeights()
+  {
+    this->Add<vtkVertex>();
+    this->Add<vtkLine>();
+    this->Add<vtkTriangle>();
+    this->Add<vtkQuad>();
+    this->Add<vtkTetra>();
+    this->Add<vtkHexahedron>();
+    this->Add<vtkWedge>();
+    this->Add<vtkPyramid>();
+  }
+
+  template <typename CellT>
+  void Add()
+  {
+    vtkNew<CellT> cell;
+    double pcoords[3];
+    cell->GetParametricCenter(pcoords);
+    std::vector<double>& weights = this->Weights[cell->GetCellType()];
+    weights.resize(cell->GetNumberOfPoints());
+    cell->InterpolateFunctions(pcoords, weights.data());
+  }
+};
+
+//==============================================================================
+// Compute the cell centers of a dataset with explicit points. The points of
+// the cells are read straight from the dataset, and only the cells without
+// constant center weights are instantiated.
+struct CellCentersWorker
+{
+  template <typename PointsArrayT>
+  void operator()(PointsArrayT* pointsArray, vtkDataSet* dataSet, vtkDoubleArray* centers) const
+  {
+    const CellCenterWeights centerWeights;
+    const auto points = vtk::DataArrayTupleRange<3>(pointsArray);
+    const vtkIdType maxCellSize = dataSet->GetMaxCellSize();
+    vtkSMPThreadLocalObject<vtkGenericCell> tlCell;
+    vtkSMPThreadLocal<std::vector<double>> tlWeights;
+
+    vtkSMPTools::For(0, dataSet->GetNumberOfCells(), [&](vtkIdType begin, vtkIdType end) {
+      vtkGenericCell* cell = tlCell.Local();
+      std::vector<double>& weights = tlWeights.Local();
+      weights.resize(maxCellSize);
+      vtk::ForEachCell(dataSet, begin, end,
+        [&](vtkIdType cellId, int cellType, vtkIdType npts, const vtkIdType* pts) {
+          double x[3] = { 0.0, 0.0, 0.0 };
+          const std::vector<double>* cellWeights =
+            cellType < VTK_NUMBER_OF_CELL_TYPES ? &centerWeights.Weights[cellType] : nullptr;
+          if (cellWeights && static_cast<vtkIdType>(cellWeights->size()) == npts)
+          {
+            for (vtkIdType i = 0; i < npts; ++i)
+            {
+              const auto p = points[pts[i]];
+              const double w = (*cellWeights)[i];
+              x[0] += p[0] * w;
+              x[1] += p[1] * w;
+              x[2] += p[2] * w;
+            }
+          }
+          else if (cellType != VTK_EMPTY_CELL)
+          {
+            dataSet->GetCell(cellId, cell);
+            double pcoords[3];
+            int subId = cell->GetParametricCenter(pcoords);
+            cell->EvaluateLocation(subId, pcoords, x, weights.data());
+          }
+          centers->SetTypedTuple(cellId, x);
+        });
+    });
+  }
+};
+
 //==============================================================================
 struct InputGhostCellFinder
 {
@@ -156,8 +246,6 @@ struct GhostCellsToGhostPointsConverter
 //------------------------------------------------------------------------------
 void vtkCellCenters::ComputeCellCenters(vtkDataSet* dataset, vtkDoubleArray* centers)
 {
-  CellCenterFunctor functor(dataset, centers);
-
   // Call this once one the main thread before calling on multiple threads.
   // According to the documentation for vtkDataSet::GetCell(vtkIdType, vtkGenericCell*),
   // this is required to make this call subsequently thread safe
@@ -167,7 +255,23 @@ void vtkCellCenters::ComputeCellCenters(vtkDataSet* dataset, vtkDoubleArray* cen
     dataset->GetCell(0, cell);
   }
 
+  // Datasets with explicit points are visited cell by cell without copying
+  // the cells, the other ones go through GetCell().
+  vtkPointSet* pointSet = vtkPointSet::SafeDownCast(dataset);
+  if (pointSet && pointSet->GetPoints())
+  {
+    vtkDataArray* pointsArray = pointSet->GetPoints()->GetData();
+    CellCentersWorker worker;
+    using Dispatcher = vtkArrayDispatch::DispatchByValueType<vtkArrayDispatch::Reals>;
+    if (!Dispatcher::Execute(pointsArray, worker, dataset, centers))
+    {
+      worker(pointsArray, dataset, centers);
+    }
+    return;
+  }
+
   // Now split the work among threads.
+  CellCenterFunctor functor(dataset, centers);
   vtkSMPTools::For(0, dataset->GetNumberOfCells(), functor);
 }
 
@@ -9,6 +9,7 @@
 #include "vtkCellData.h"
 #include "vtkDataArrayRange.h"
 #include "vtkDataSet.h"
+#include "vtkForEachCell.h"
 #include "vtkIdList.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -154,28 +155,28 @@ struct Spread
     // accumulate
     if (contributingCellOption != vtkCellDataToPointData::Patch)
     {
-      vtkNew<vtkIdList> pointIds;
       checkAbortInterval = std::min(ncells / 10 + 1, (vtkIdType)1000);
-      for (vtkIdType cid = 0; cid < ncells; ++cid)
+      for (vtkIdType begin = 0; begin < ncells; begin += checkAbortInterval)
       {
-        if (cid % checkAbortInterval == 0 && filter->CheckAbort())
+        if (filter->CheckAbort())
         {
           break;
         }
-        int dimension = vtkCellTypes::GetDimension(src->GetCellType(cid));
-        if (dimension >= highestCellDimension)
-        {
-          const auto srcTuple = srcTuples[cid];
-          src->GetCellPoints(cid, pointIds);
-          for (vtkIdType i = 0, I = pointIds->GetNumberOfIds(); i < I; ++i)
-          {
-            const vtkIdType ptId = pointIds->GetId(i);
-            auto dstTuple = dstTuples[ptId];
-            // accumulate cell data to point data <==> point_data += cell_data
-            std::transform(srcTuple.cbegin(), srcTuple.cend(), dstTuple.cbegin(), dstTuple.begin(),
-              std::plus<T>());
-          }
-        }
+        const vtkIdType end = std::min(begin + checkAbortInterval, ncells);
+        vtk::ForEachCell(src, begin, end,
+          [&](vtkIdType cid, int cellType, vtkIdType npts, const vtkIdType* pts) {
+            if (vtkCellTypes::GetDimension(cellType) >= highestCellDimension)
+            {
+              const auto srcTuple = srcTuples[cid];
+              for (vtkIdType i = 0; i < npts; ++i)
+              {
+                auto dstTuple = dstTuples[pts[i]];
+                // accumulate cell data to point data <==> point_data += cell_data
+                std::transform(srcTuple.cbegin(), srcTuple.cend(), dstTuple.cbegin(),
+                  dstTuple.begin(), std::plus<T>());
+              }
+            }
+          });
       }
       // average
 
@@ -216,7 +217,7 @@ struct Spread
         for (vtkIdType pc = 0; pc < numPatchCells; pc++)
         {
           vtkIdType cellId = cellsOnPoint->GetId(pc);
-          int cellDimension = src->GetCell(cellId)->GetCellDimension();
+          int cellDimension = vtkCellTypes::GetDimension(src->GetCellType(cellId));
           numPointCells[cellDimension] += 1;
           const auto srcTuple = srcTuples[cellId];
           for (int comp = 0; comp < ncomps; comp++)
@@ -664,19 +665,16 @@ int vtkCellDataToPointData::RequestDataForUnstructuredData(
         }
       }
     }
-    vtkNew<vtkIdList> pids;
-    for (vtkIdType cid = 0; cid < numberOfCells; ++cid)
-    {
-      if (input->GetCell(cid)->GetCellDimension() >= highestCellDimension)
-      {
-        input->GetCellPoints(cid, pids);
-        for (vtkIdType i = 0, I = pids->GetNumberOfIds(); i < I; ++i)
+    vtk::ForEachCell(input, 0, numberOfCells,
+      [&](vtkIdType, int cellType, vtkIdType npts, const vtkIdType* pts) {
+        if (vtkCellTypes::GetDimension(cellType) >= highestCellDimension)
         {
-          vtkIdType const pid = pids->GetId(i);
-          num->SetValue(pid, num->GetValue(pid) + 1);
+          for (vtkIdType i = 0; i < npts; ++i)
+          {
+            num->SetValue(pts[i], num->GetValue(pts[i]) + 1);
+          }
         }
-      }
-    }
+      });
   }
 
   const auto nfields = processedCellData->GetNumberOfArrays();
@@ -9,12 +9,15 @@
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMergePoints.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkStaticCleanPolyData.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
+#include <typeinfo>
 #include <unordered_map>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -140,6 +143,32 @@ int vtkCleanPolyData::RequestData(vtkInformation* vtkNotUsed(request),
     vtkDebugMacro(<< "No data to Operate On!");
     return 1;
   }
+
+  // Without a user-specified locator, the threaded vtkStaticCleanPolyData
+  // produces the same output. Global ids and subclasses overriding
+  // OperateOnPoint() require the incremental algorithm below.
+  if (this->Locator == nullptr && typeid(*this) == typeid(vtkCleanPolyData) &&
+    (!this->PointMerging || !vtkIdTypeArray::SafeDownCast(input->GetPointData()->GetGlobalIds())))
+  {
+    vtkNew<vtkPolyData> inputCopy;
+    inputCopy->ShallowCopy(input);
+    vtkNew<vtkStaticCleanPolyData> cleaner;
+    cleaner->SetContainerAlgorithm(this);
+    cleaner->EmulateCleanPolyDataOn();
+    cleaner->SetPointMerging(this->PointMerging != 0);
+    cleaner->SetToleranceIsAbsolute(this->ToleranceIsAbsolute != 0);
+    cleaner->SetTolerance(this->Tolerance);
+    cleaner->SetAbsoluteTolerance(this->AbsoluteTolerance);
+    cleaner->SetConvertLinesToPoints(this->ConvertLinesToPoints != 0);
+    cleaner->SetConvertPolysToLines(this->ConvertPolysToLines != 0);
+    cleaner->SetConvertStripsToPolys(this->ConvertStripsToPolys != 0);
+    cleaner->SetOutputPointsPrecision(this->OutputPointsPrecision);
+    cleaner->SetInputData(inputCopy);
+    cleaner->Update();
+    output->ShallowCopy(cleaner->GetOutput());
+    return 1;
+  }
+
   vtkIdType* updatedPts = new vtkIdType[input->GetMaxCellSize()];
 
   vtkIdType numNewPts;
@@ -61,6 +61,16 @@
  * difference in the traversal order in the point merging process, the output
  * of the filters may be different.
  *
+ * @warning
+ * When no locator has been specified (see SetLocator()) and the merging does
+ * not rely on point global ids, this filter delegates its work to
+ * vtkStaticCleanPolyData with EmulateCleanPolyData enabled, which is threaded.
+ * With a zero tolerance the output is identical to the incremental
+ * algorithm; with a non-zero tolerance the merged points may differ since
+ * the incremental result depends on the insertion order. Subclasses (which
+ * may override OperateOnPoint()) always use the incremental algorithm, as
+ * does specifying a locator.
+ *
  * @sa
  * vtkQuantizePolyDataPoints vtkStaticCleanPolyData
  * vtkStaticCleanUnstructuredGrid
@@ -4,6 +4,7 @@
 
 #include "vtkCell.h"
 #include "vtkCellData.h"
+#include "vtkConnectivityLabelingInternal.h"
 #include "vtkDataSet.h"
 #include "vtkDemandDrivenPipeline.h"
 #include "vtkFloatArray.h"
@@ -18,7 +19,9 @@
 #include "vtkPolyData.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
 #include <map>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkObjectFactoryNewMacro(vtkConnectivityFilter);
@@ -227,9 +230,31 @@ int vtkConnectivityFilter::RequestData(vtkInformation* vtkNotUsed(request),
   this->PointIds->Allocate(8, VTK_CELL_SIZE);
 
   if (this->ExtractionMode != VTK_EXTRACT_POINT_SEEDED_REGIONS &&
+    this->ExtractionMode != VTK_EXTRACT_CELL_SEEDED_REGIONS &&
+    this->ExtractionMode != VTK_EXTRACT_CLOSEST_POINT_REGION && !this->InScalars)
+  { // label all regions at once, the labels do not depend on a seed
+    std::vector<vtkIdType> regionSizes;
+    this->PointNumber = LabelConnectedRegions(this, input, this->Visited, this->PointMap,
+      this->NewScalars->GetPointer(0), regionSizes);
+    std::copy_n(this->Visited, numCells, this->NewCellScalars->GetPointer(0));
+    this->RegionNumber = static_cast<vtkIdType>(regionSizes.size());
+    this->RegionSizes->SetNumberOfValues(this->RegionNumber);
+    for (vtkIdType regionId = 0; regionId < this->RegionNumber; ++regionId)
+    {
+      this->RegionSizes->SetValue(regionId, regionSizes[regionId]);
+      if (regionSizes[regionId] > maxCellsInRegion)
+      {
+        maxCellsInRegion = regionSizes[regionId];
+        largestRegionId = regionId;
+      }
+    }
+    this->UpdateProgress(0.9);
+  }
+  else if (this->ExtractionMode != VTK_EXTRACT_POINT_SEEDED_REGIONS &&
     this->ExtractionMode != VTK_EXTRACT_CELL_SEEDED_REGIONS &&
     this->ExtractionMode != VTK_EXTRACT_CLOSEST_POINT_REGION)
-  { // visit all cells marking with region number
+  { // visit all cells marking with region number, the scalar criterion
+    // depends on the traversal order
     for (cellId = 0; cellId < numCells; cellId++)
     {
       if (cellId && !(cellId % 5000))
@@ -38,6 +38,12 @@
  * was processed and has no other significance with respect to the size of
  * or number of cells.
  *
+ * When the regions do not depend on seeds (largest, specified and all
+ * regions extraction modes) and ScalarConnectivity is off, the regions are
+ * labeled in parallel with a union-find over the points. The region ids are
+ * then the ones of the serial traversal, but the output points are ordered by
+ * increasing input point id instead of traversal order.
+ *
  * @sa
  * vtkPolyDataConnectivityFilter
  */
@@ -0,0 +1,243 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkConnectivityLabelingInternal
+ * @brief   parallel labeling of the regions of cells sharing points
+ *
+ * vtkConnectivityLabelingInternal labels the connected regions of a dataset,
+ * two cells being connected when they share a point. The labeling is a
+ * lock-free union-find over the points of the dataset: every cell links its
+ * points together with vtkSMPTools, the union-find trees are then
+ * compressed, and the regions are numbered by increasing smallest cell id,
+ * which is the numbering produced by a serial traversal visiting the cells
+ * in order. The points used by the cells are numbered by increasing input
+ * id.
+ *
+ * @warning
+ * This file is meant as a private include file to avoid code duplication. At
+ * this time it is not meant to define a public API (the API is likely to change
+ * in the future). If you write code that depends on this include, be prepared to
+ * change it in the future (without complaint).
+ *
+ * @sa
+ * vtkConnectivityFilter vtkPolyDataConnectivityFilter
+ */
+
+#ifndef vtkConnectivityLabelingInternal_h
+#define vtkConnectivityLabelingInternal_h
+
+#include "vtkAlgorithm.h"
+#include "vtkDataSet.h"
+#include "vtkIdList.h"
+#include "vtkNew.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace
+{ // anonymous namespace
+
+// Lock-free union-find over the point ids. Roots are always linked to the
+// smaller root so that concurrent links cannot create cycles.
+struct PointUnionFind
+{
+  std::unique_ptr<std::atomic<vtkIdType>[]> Parents;
+
+  PointUnionFind(vtkIdType numPts)
+    : Parents(new std::atomic<vtkIdType>[numPts])
+  {
+    vtkSMPTools::For(0, numPts, [this](vtkIdType ptId, vtkIdType endPtId) {
+      for (; ptId < endPtId; ++ptId)
+      {
+        this->Parents[ptId].store(ptId, std::memory_order_relaxed);
+      }
+    });
+  }
+
+  vtkIdType Find(vtkIdType ptId) const
+  {
+    vtkIdType parent = this->Parents[ptId].load(std::memory_order_relaxed);
+    while (parent != ptId)
+    {
+      // Path halving: a stale write only makes the path longer, never wrong
+      vtkIdType grandParent = this->Parents[parent].load(std::memory_order_relaxed);
+      this->Parents[ptId].compare_exchange_weak(parent, grandParent, std::memory_order_relaxed);
+      ptId = parent;
+      parent = this->Parents[ptId].load(std::memory_order_relaxed);
+    }
+    return ptId;
+  }
+
+  void Union(vtkIdType ptId0, vtkIdType ptId1)
+  {
+    for (;;)
+    {
+      ptId0 = this->Find(ptId0);
+      ptId1 = this->Find(ptId1);
+      if (ptId0 == ptId1)
+      {
+        return;
+      }
+      if (ptId0 < ptId1)
+      {
+        std::swap(ptId0, ptId1);
+      }
+      vtkIdType expected = ptId0;
+      if (this->Parents[ptId0].compare_exchange_strong(expected, ptId1))
+      {
+        return;
+      }
+    }
+  }
+};
+
+/**
+ * Label the connected regions of the cells of input. On return,
+ * cellRegionIds[cellId] is the region of every cell, pointMap[ptId] is the
+ * new id of every point used by a cell (-1 for unused points),
+ * pointRegionIds[newPtId] the region of every used point, and regionSizes
+ * the number of cells of every region. Cells without points form their own
+ * region. The number of used points is returned. Input must be safe to query
+ * with the thread-safe vtkDataSet::GetCellPoints() once it has been called
+ * from a single thread.
+ */
+vtkIdType LabelConnectedRegions(vtkAlgorithm* self, vtkDataSet* input, vtkIdType* cellRegionIds,
+  vtkIdType* pointMap, vtkIdType* pointRegionIds, std::vector<vtkIdType>& regionSizes)
+{
+  const vtkIdType numPts = input->GetNumberOfPoints();
+  const vtkIdType numCells = input->GetNumberOfCells();
+
+  // The callers skip BuildLinks(), so build the cell map of a vtkPolyData here
+  // rather than from within the concurrent GetCellPoints() calls.
+  vtkNew<vtkIdList> cellPtIds;
+  input->GetCellPoints(0, cellPtIds);
+
+  vtkSMPThreadLocalObject<vtkIdList> tlPtIds;
+  PointUnionFind unionFind(numPts);
+  vtkSMPTools::For(0, numCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+    vtkIdList* ptIds = tlPtIds.Local();
+    vtkIdType npts;
+    const vtkIdType* pts;
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; cellId < endCellId; ++cellId)
+    {
+      if (isFirst)
+      {
+        self->CheckAbort();
+      }
+      if (self->GetAbortOutput())
+      {
+        break;
+      }
+      input->GetCellPoints(cellId, npts, pts, ptIds);
+      for (vtkIdType i = 1; i < npts; ++i)
+      {
+        unionFind.Union(pts[0], pts[i]);
+      }
+    }
+  });
+
+  // Compress the trees and find the smallest cell id of every root. The
+  // root of a cell is temporarily stored as its region id.
+  std::vector<vtkIdType> roots(numPts);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    for (; ptId < endPtId; ++ptId)
+    {
+      roots[ptId] = unionFind.Find(ptId);
+    }
+  });
+  std::unique_ptr<std::atomic<vtkIdType>[]> minCellIds(new std::atomic<vtkIdType>[numPts]);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    for (; ptId < endPtId; ++ptId)
+    {
+      minCellIds[ptId].store(numCells, std::memory_order_relaxed);
+    }
+  });
+  vtkSMPTools::For(0, numCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+    vtkIdList* ptIds = tlPtIds.Local();
+    vtkIdType npts;
+    const vtkIdType* pts;
+    for (; cellId < endCellId; ++cellId)
+    {
+      input->GetCellPoints(cellId, npts, pts, ptIds);
+      if (npts < 1)
+      {
+        cellRegionIds[cellId] = -1;
+        continue;
+      }
+      vtkIdType root = roots[pts[0]];
+      cellRegionIds[cellId] = root;
+      vtkIdType minCellId = minCellIds[root].load(std::memory_order_relaxed);
+      while (cellId < minCellId &&
+        !minCellIds[root].compare_exchange_weak(minCellId, cellId, std::memory_order_relaxed))
+      {
+      }
+    }
+  });
+
+  // Regions are numbered in the order of their first cell
+  std::vector<vtkIdType> regionOffsets(numCells);
+  vtkSMPTools::For(0, numCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+    for (; cellId < endCellId; ++cellId)
+    {
+      vtkIdType root = cellRegionIds[cellId];
+      regionOffsets[cellId] =
+        (root < 0 || minCellIds[root].load(std::memory_order_relaxed) == cellId) ? 1 : 0;
+    }
+  });
+  const vtkIdType lastIsFirst = regionOffsets.back();
+  vtkSMPTools::ExclusiveScan(
+    regionOffsets.begin(), regionOffsets.end(), regionOffsets.begin(), vtkIdType(0));
+  vtkSMPTools::For(0, numCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+    for (; cellId < endCellId; ++cellId)
+    {
+      vtkIdType root = cellRegionIds[cellId];
+      cellRegionIds[cellId] = root < 0
+        ? regionOffsets[cellId]
+        : regionOffsets[minCellIds[root].load(std::memory_order_relaxed)];
+    }
+  });
+  regionSizes.assign(regionOffsets.back() + lastIsFirst, 0);
+  for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+  {
+    regionSizes[cellRegionIds[cellId]]++;
+  }
+
+  // Number the points used by at least one cell
+  std::vector<vtkIdType> pointOffsets(numPts);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    for (; ptId < endPtId; ++ptId)
+    {
+      pointOffsets[ptId] =
+        minCellIds[roots[ptId]].load(std::memory_order_relaxed) < numCells ? 1 : 0;
+    }
+  });
+  const vtkIdType lastUsed = pointOffsets.back();
+  vtkSMPTools::ExclusiveScan(
+    pointOffsets.begin(), pointOffsets.end(), pointOffsets.begin(), vtkIdType(0));
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    for (; ptId < endPtId; ++ptId)
+    {
+      vtkIdType minCellId = minCellIds[roots[ptId]].load(std::memory_order_relaxed);
+      if (minCellId < numCells)
+      {
+        pointMap[ptId] = pointOffsets[ptId];
+        pointRegionIds[pointOffsets[ptId]] = cellRegionIds[minCellId];
+      }
+      else
+      {
+        pointMap[ptId] = -1;
+      }
+    }
+  });
+
+  return pointOffsets.back() + lastUsed;
+}
+
+} // anonymous namespace
+
+#endif
+// VTK-HeaderTest-Exclude: vtkConnectivityLabelingInternal.h
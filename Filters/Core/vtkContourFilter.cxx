@@ -64,6 +64,7 @@ vtkContourFilter::vtkContourFilter()
   this->GenerateTriangles = 1;
   this->ArrayComponent = 0;
   this->FastMode = false;
+  this->SequentialProcessing = false;
 
   this->ContourGrid->SetContainerAlgorithm(this);
   this->Contour3DLinearGrid->SetContainerAlgorithm(this);
@@ -393,6 +394,7 @@ int vtkContourFilter::RequestData(
       this->Contour3DLinearGrid->SetComputeScalars(this->ComputeScalars);
       this->Contour3DLinearGrid->SetOutputPointsPrecision(this->OutputPointsPrecision);
       this->Contour3DLinearGrid->SetUseScalarTree(this->UseScalarTree);
+      this->Contour3DLinearGrid->SetSequentialProcessing(this->SequentialProcessing);
       this->ContourGrid->SetScalarTree(this->ScalarTree);
 
       bool mergePoints = !this->GetLocator()->IsA("vtkNonMergingPointLocator");
@@ -409,6 +411,7 @@ int vtkContourFilter::RequestData(
       this->ContourGrid->SetOutputPointsPrecision(this->OutputPointsPrecision);
       this->ContourGrid->SetGenerateTriangles(this->GenerateTriangles);
       this->ContourGrid->SetUseScalarTree(this->UseScalarTree);
+      this->ContourGrid->SetSequentialProcessing(this->SequentialProcessing);
       if (this->UseScalarTree) // special treatment to reuse it
       {
         if (this->ScalarTree == nullptr)
@@ -755,6 +758,7 @@ void vtkContourFilter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Precision of the output points: " << this->OutputPointsPrecision << "\n";
   os << indent << "ArrayComponent: " << this->ArrayComponent << "\n";
   os << indent << "Fast Mode: " << (this->FastMode ? "On\n" : "Off\n");
+  os << indent << "Sequential Processing: " << (this->SequentialProcessing ? "On\n" : "Off\n");
 }
 
 //------------------------------------------------------------------------------
@@ -206,6 +206,17 @@ public:
   vtkBooleanMacro(FastMode, bool);
   ///@}
 
+  ///@{
+  /**
+   * Force sequential processing (i.e. single thread) of the contouring of
+   * unstructured grids by vtkContourGrid and vtkContour3DLinearGrid. By
+   * default, sequential processing is off.
+   */
+  vtkSetMacro(SequentialProcessing, vtkTypeBool);
+  vtkGetMacro(SequentialProcessing, vtkTypeBool);
+  vtkBooleanMacro(SequentialProcessing, vtkTypeBool);
+  ///@}
+
 protected:
   vtkContourFilter();
   ~vtkContourFilter() override;
@@ -228,6 +239,7 @@ protected:
   int ArrayComponent;
   vtkTypeBool GenerateTriangles;
   bool FastMode;
+  vtkTypeBool SequentialProcessing;
 
   vtkNew<vtkContourGrid> ContourGrid;
   vtkNew<vtkContour3DLinearGrid> Contour3DLinearGrid;
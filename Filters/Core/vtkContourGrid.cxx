@@ -18,19 +18,26 @@
 #include "vtkInformationVector.h"
 #include "vtkMergePoints.h"
 #include "vtkNew.h"
+#include "vtkNonMergingPointLocator.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPointLocator.h"
 #include "vtkPolyData.h"
 #include "vtkPolyDataNormals.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkSimpleScalarTree.h"
 #include "vtkSmartPointer.h"
+#include "vtkStaticPointLocator.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkUnstructuredGrid.h"
 #include "vtkUnstructuredGridBase.h"
 
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <memory>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkContourGrid);
@@ -53,6 +60,8 @@ vtkContourGrid::vtkContourGrid()
 
   this->OutputPointsPrecision = DEFAULT_PRECISION;
 
+  this->SequentialProcessing = false;
+
   // by default process active point scalars
   this->SetInputArrayToProcess(
     0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, vtkDataSetAttributes::SCALARS);
@@ -97,29 +106,18 @@ vtkMTimeType vtkContourGrid::GetMTime()
   return mTime;
 }
 
+namespace
+{
 //------------------------------------------------------------------------------
-void vtkContourGridExecute(vtkContourGrid* self, vtkDataSet* input, vtkPolyData* output,
-  vtkDataArray* inScalars, vtkIdType numContours, double* values, vtkTypeBool computeScalars,
-  int useScalarTree, vtkScalarTree* scalarTree, bool generateTriangles)
+vtkSmartPointer<vtkPointData> vtkContourGridPointData(vtkDataSet* input, vtkDataArray* inScalars)
 {
-  vtkIdType i;
-  bool abortExecute = false;
-  vtkIncrementalPointLocator* locator = self->GetLocator();
-  vtkNew<vtkGenericCell> cell;
-  vtkCellArray *newVerts, *newLines, *newPolys;
-  vtkPoints* newPts;
-  vtkIdType numCells, estimatedSize;
-  vtkNew<vtkDoubleArray> cellScalars;
-
-  vtkPointData* inPdOriginal = input->GetPointData();
-
   // We don't want to change the active scalars in the input, but we
   // need to set the active scalars to match the input array to
   // process so that the point data copying works as expected. Create
   // a shallow copy of point data so that we can do this without
   // changing the input.
   vtkSmartPointer<vtkPointData> inPd = vtkSmartPointer<vtkPointData>::New();
-  inPd->ShallowCopy(inPdOriginal);
+  inPd->ShallowCopy(input->GetPointData());
 
   // Keep track of the old active scalars because when we set the new
   // scalars, the old scalars are removed from the point data entirely
@@ -130,6 +128,25 @@ void vtkContourGridExecute(vtkContourGrid* self, vtkDataSet* input, vtkPolyData*
   {
     inPd->AddArray(oldScalars);
   }
+  return inPd;
+}
+}
+
+//------------------------------------------------------------------------------
+void vtkContourGridExecute(vtkContourGrid* self, vtkDataSet* input, vtkPolyData* output,
+  vtkDataArray* inScalars, vtkIdType numContours, double* values, vtkTypeBool computeScalars,
+  int useScalarTree, vtkScalarTree* scalarTree, bool generateTriangles)
+{
+  vtkIdType i;
+  bool abortExecute = false;
+  vtkIncrementalPointLocator* locator = self->GetLocator();
+  vtkNew<vtkGenericCell> cell;
+  vtkCellArray *newVerts, *newLines, *newPolys;
+  vtkPoints* newPts;
+  vtkIdType numCells, estimatedSize;
+  vtkNew<vtkDoubleArray> cellScalars;
+
+  vtkSmartPointer<vtkPointData> inPd = vtkContourGridPointData(input, inScalars);
   vtkPointData* outPd = output->GetPointData();
 
   vtkCellData* inCd = input->GetCellData();
@@ -217,8 +234,20 @@ void vtkContourGridExecute(vtkContourGrid* self, vtkDataSet* input, vtkPolyData*
     unsigned char cellTypeDimensions[VTK_NUMBER_OF_CELL_TYPES];
     vtkCutter::GetCellTypeDimensions(cellTypeDimensions);
     int dimensionality;
+    // When all the cells have the same type, only the pass of their dimension
+    // is needed.
+    int minDimensionality = 1;
+    int maxDimensionality = 3;
+    vtkUnstructuredGrid* ugrid = vtkUnstructuredGrid::SafeDownCast(input);
+    const int homogeneousCellType = ugrid ? ugrid->GetHomogeneousCellType() : -1;
+    if (homogeneousCellType >= 0 && homogeneousCellType < VTK_NUMBER_OF_CELL_TYPES)
+    {
+      minDimensionality = std::max(1, static_cast<int>(cellTypeDimensions[homogeneousCellType]));
+      maxDimensionality = cellTypeDimensions[homogeneousCellType];
+    }
     // We skip 0d cells (points), because they cannot be cut (generate no data).
-    for (dimensionality = 1; dimensionality <= 3; ++dimensionality)
+    for (dimensionality = minDimensionality; dimensionality <= maxDimensionality;
+         ++dimensionality)
     {
       // Loop over all cells; get scalar values for all cell points
       // and process each cell.
@@ -361,6 +390,379 @@ void vtkContourGridExecute(vtkContourGrid* self, vtkDataSet* input, vtkPolyData*
   output->Squeeze();
 }
 
+namespace
+{
+//------------------------------------------------------------------------------
+// Data produced by each thread of the parallel execution: the contour of the
+// cells processed by the thread, with points merged by its own locator.
+struct vtkContourGridLocalData
+{
+  vtkSmartPointer<vtkPoints> Points;
+  vtkSmartPointer<vtkIncrementalPointLocator> Locator;
+  vtkSmartPointer<vtkCellArray> Verts;
+  vtkSmartPointer<vtkCellArray> Lines;
+  vtkSmartPointer<vtkCellArray> Polys;
+  vtkSmartPointer<vtkPointData> PointData;
+  vtkSmartPointer<vtkCellData> CellData;
+  vtkSmartPointer<vtkGenericCell> Cell;
+  vtkSmartPointer<vtkIdList> PointIds;
+  vtkSmartPointer<vtkDoubleArray> CellScalars;
+  std::shared_ptr<vtkContourHelper> Helper;
+};
+
+//------------------------------------------------------------------------------
+// Contour the cells of one dimensionality, each thread accumulating its
+// output in its local data. The functor is executed once per dimensionality
+// with the same local data, so that every thread outputs its verts, lines and
+// polys in order.
+struct vtkContourGridWorker
+{
+  vtkContourGrid* Filter;
+  vtkUnstructuredGrid* Input;
+  vtkDataArray* InScalars;
+  vtkPointData* InPd;
+  vtkCellData* InCd;
+  vtkIdType NumberOfContours;
+  const double* Values;
+  const unsigned char* CellTypeDimensions;
+  int Dimensionality = 0;
+  int PointsDataType;
+  bool MergePoints;
+  vtkTypeBool ComputeScalars;
+  bool GenerateTriangles;
+  vtkIdType EstimatedSize;
+  double Bounds[6];
+  vtkSMPThreadLocal<vtkContourGridLocalData> LocalData;
+
+  vtkContourGridWorker(vtkContourGrid* filter, vtkUnstructuredGrid* input, vtkDataArray* inScalars,
+    vtkPointData* inPd, vtkIdType numContours, const double* values,
+    const unsigned char* cellTypeDimensions, bool mergePoints)
+    : Filter(filter)
+    , Input(input)
+    , InScalars(inScalars)
+    , InPd(inPd)
+    , InCd(input->GetCellData())
+    , NumberOfContours(numContours)
+    , Values(values)
+    , CellTypeDimensions(cellTypeDimensions)
+    , MergePoints(mergePoints)
+    , ComputeScalars(filter->GetComputeScalars())
+    , GenerateTriangles(filter->GetGenerateTriangles() != 0)
+  {
+    switch (filter->GetOutputPointsPrecision())
+    {
+      case vtkAlgorithm::SINGLE_PRECISION:
+        this->PointsDataType = VTK_FLOAT;
+        break;
+      case vtkAlgorithm::DOUBLE_PRECISION:
+        this->PointsDataType = VTK_DOUBLE;
+        break;
+      default:
+        this->PointsDataType = input->GetPoints()->GetDataType();
+    }
+
+    vtkIdType numCells = input->GetNumberOfCells();
+    vtkIdType numThreads = std::max(1, vtkSMPTools::GetEstimatedNumberOfThreads());
+    this->EstimatedSize = static_cast<vtkIdType>(pow(static_cast<double>(numCells), .75));
+    this->EstimatedSize *= numContours;
+    this->EstimatedSize = std::max(this->EstimatedSize / numThreads / 1024 * 1024, vtkIdType(1024));
+
+    // GetBounds() and GetCell() are not thread safe on their first call.
+    input->GetBounds(this->Bounds);
+    vtkNew<vtkGenericCell> cell;
+    input->GetCell(0, cell);
+  }
+
+  void Initialize()
+  {
+    vtkContourGridLocalData& local = this->LocalData.Local();
+    if (local.Points)
+    {
+      // Already initialized when contouring a lower dimensionality.
+      return;
+    }
+    vtkIdType estimatedSize = this->EstimatedSize;
+    local.Points = vtkSmartPointer<vtkPoints>::New();
+    local.Points->SetDataType(this->PointsDataType);
+    local.Points->Allocate(estimatedSize, estimatedSize);
+    if (this->MergePoints)
+    {
+      local.Locator = vtkSmartPointer<vtkMergePoints>::New();
+    }
+    else
+    {
+      local.Locator = vtkSmartPointer<vtkNonMergingPointLocator>::New();
+    }
+    local.Locator->InitPointInsertion(local.Points, this->Bounds, estimatedSize);
+    local.Verts = vtkSmartPointer<vtkCellArray>::New();
+    local.Verts->AllocateEstimate(estimatedSize, 1);
+    local.Lines = vtkSmartPointer<vtkCellArray>::New();
+    local.Lines->AllocateEstimate(estimatedSize, 2);
+    local.Polys = vtkSmartPointer<vtkCellArray>::New();
+    local.Polys->AllocateEstimate(estimatedSize, 4);
+    local.PointData = vtkSmartPointer<vtkPointData>::New();
+    if (!this->ComputeScalars)
+    {
+      local.PointData->CopyScalarsOff();
+    }
+    local.PointData->InterpolateAllocate(this->InPd, estimatedSize, estimatedSize);
+    local.CellData = vtkSmartPointer<vtkCellData>::New();
+    local.CellData->CopyAllocate(this->InCd, estimatedSize, estimatedSize);
+    local.Cell = vtkSmartPointer<vtkGenericCell>::New();
+    local.PointIds = vtkSmartPointer<vtkIdList>::New();
+    local.CellScalars = vtkSmartPointer<vtkDoubleArray>::New();
+    local.CellScalars->SetNumberOfComponents(this->InScalars->GetNumberOfComponents());
+    local.CellScalars->Allocate(VTK_CELL_SIZE * this->InScalars->GetNumberOfComponents());
+    local.Helper = std::make_shared<vtkContourHelper>(local.Locator, local.Verts, local.Lines,
+      local.Polys, this->InPd, this->InCd, local.PointData, local.CellData,
+      static_cast<int>(estimatedSize), this->GenerateTriangles);
+  }
+
+  void operator()(vtkIdType cellId, vtkIdType endCellId)
+  {
+    vtkContourGridLocalData& local = this->LocalData.Local();
+    vtkDoubleArray* cellScalars = local.CellScalars;
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    vtkIdType checkAbortInterval = std::min((endCellId - cellId) / 10 + 1, (vtkIdType)1000);
+
+    for (; cellId < endCellId; ++cellId)
+    {
+      if (cellId % checkAbortInterval == 0)
+      {
+        if (isFirst)
+        {
+          this->Filter->CheckAbort();
+        }
+        if (this->Filter->GetAbortOutput())
+        {
+          break;
+        }
+      }
+
+      int cellType = this->Input->GetCellType(cellId);
+      if (cellType >= VTK_NUMBER_OF_CELL_TYPES ||
+        this->CellTypeDimensions[cellType] != this->Dimensionality)
+      {
+        continue;
+      }
+
+      this->Input->GetCellPoints(cellId, local.PointIds);
+      cellScalars->SetNumberOfTuples(local.PointIds->GetNumberOfIds());
+      this->InScalars->GetTuples(local.PointIds, cellScalars);
+
+      double range[2] = { std::numeric_limits<double>::max(),
+        std::numeric_limits<double>::lowest() };
+      for (const double val : vtk::DataArrayValueRange(cellScalars))
+      {
+        range[0] = std::min(range[0], val);
+        range[1] = std::max(range[1], val);
+      }
+
+      bool needCell = false;
+      for (vtkIdType i = 0; i < this->NumberOfContours && !needCell; ++i)
+      {
+        needCell = this->Values[i] >= range[0] && this->Values[i] <= range[1];
+      }
+      if (!needCell)
+      {
+        continue;
+      }
+
+      this->Input->GetCell(cellId, local.Cell);
+      this->Input->SetCellOrderAndRationalWeights(cellId, local.Cell);
+      for (vtkIdType i = 0; i < this->NumberOfContours; ++i)
+      {
+        if (this->Values[i] >= range[0] && this->Values[i] <= range[1])
+        {
+          local.Helper->Contour(local.Cell, this->Values[i], cellScalars, cellId);
+        }
+      }
+    }
+  }
+
+  void Reduce() {}
+};
+
+//------------------------------------------------------------------------------
+// Map the point ids of a cell array through a point map.
+struct vtkContourGridRenumberPoints
+{
+  template <typename CellStateT>
+  void operator()(CellStateT& state, const vtkIdType* pointMap)
+  {
+    using ValueType = typename CellStateT::ValueType;
+    auto connectivity = vtk::DataArrayValueRange<1>(state.GetConnectivity());
+    vtkSMPTools::For(0, connectivity.size(), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        connectivity[i] = static_cast<ValueType>(pointMap[connectivity[i]]);
+      }
+    });
+  }
+};
+
+//------------------------------------------------------------------------------
+// Parallel version of vtkContourGridExecute(). The thread outputs are
+// appended, verts, lines and polys of all the threads in turn to keep the
+// cell data ordered, and the points shared by the threads are then merged
+// by a vtkStaticPointLocator.
+void vtkContourGridExecuteParallel(vtkContourGrid* self, vtkUnstructuredGrid* input,
+  vtkPolyData* output, vtkDataArray* inScalars, vtkIdType numContours, const double* values,
+  bool mergePoints)
+{
+  vtkSmartPointer<vtkPointData> inPd = vtkContourGridPointData(input, inScalars);
+
+  // Polyhedra are contoured from faces and edges built once for the whole
+  // grid, which also keeps the threads from generating them for every cell.
+  if (input->GetFaces())
+  {
+    input->BuildPolyhedronTopology();
+  }
+
+  unsigned char cellTypeDimensions[VTK_NUMBER_OF_CELL_TYPES];
+  vtkCutter::GetCellTypeDimensions(cellTypeDimensions);
+  int minDimensionality = 1;
+  int maxDimensionality = 3;
+  const int homogeneousCellType = input->GetHomogeneousCellType();
+  if (homogeneousCellType >= 0 && homogeneousCellType < VTK_NUMBER_OF_CELL_TYPES)
+  {
+    minDimensionality = std::max(1, static_cast<int>(cellTypeDimensions[homogeneousCellType]));
+    maxDimensionality = cellTypeDimensions[homogeneousCellType];
+  }
+
+  vtkContourGridWorker worker(
+    self, input, inScalars, inPd, numContours, values, cellTypeDimensions, mergePoints);
+  for (int dimensionality = minDimensionality; dimensionality <= maxDimensionality;
+       ++dimensionality)
+  {
+    worker.Dimensionality = dimensionality;
+    vtkSMPTools::For(0, input->GetNumberOfCells(), worker);
+    self->UpdateProgress(0.9 * dimensionality / maxDimensionality);
+  }
+
+  std::vector<vtkContourGridLocalData*> localData;
+  vtkIdType numPts = 0, numVerts = 0, numLines = 0, numPolys = 0;
+  for (vtkContourGridLocalData& local : worker.LocalData)
+  {
+    if (local.Points && local.Points->GetNumberOfPoints() > 0)
+    {
+      localData.push_back(&local);
+      numPts += local.Points->GetNumberOfPoints();
+      numVerts += local.Verts->GetNumberOfCells();
+      numLines += local.Lines->GetNumberOfCells();
+      numPolys += local.Polys->GetNumberOfCells();
+    }
+  }
+  if (localData.empty() || self->GetAbortOutput())
+  {
+    return;
+  }
+
+  vtkNew<vtkPoints> newPts;
+  newPts->SetDataType(worker.PointsDataType);
+  newPts->SetNumberOfPoints(numPts);
+  vtkNew<vtkCellArray> newVerts, newLines, newPolys;
+  vtkPointData* outPd = output->GetPointData();
+  vtkCellData* outCd = output->GetCellData();
+  outPd->CopyAllocate(localData[0]->PointData, numPts);
+  outCd->CopyAllocate(localData[0]->CellData, numVerts + numLines + numPolys);
+
+  vtkIdType ptOffset = 0;
+  vtkIdType vertOffset = 0, lineOffset = numVerts, polyOffset = numVerts + numLines;
+  for (vtkContourGridLocalData* local : localData)
+  {
+    vtkIdType localPts = local->Points->GetNumberOfPoints();
+    newPts->GetData()->InsertTuples(ptOffset, localPts, 0, local->Points->GetData());
+    outPd->CopyData(local->PointData, ptOffset, localPts, 0);
+
+    vtkIdType localVerts = local->Verts->GetNumberOfCells();
+    vtkIdType localLines = local->Lines->GetNumberOfCells();
+    vtkIdType localPolys = local->Polys->GetNumberOfCells();
+    newVerts->Append(local->Verts, ptOffset);
+    newLines->Append(local->Lines, ptOffset);
+    newPolys->Append(local->Polys, ptOffset);
+    outCd->CopyData(local->CellData, vertOffset, localVerts, 0);
+    outCd->CopyData(local->CellData, lineOffset, localLines, localVerts);
+    outCd->CopyData(local->CellData, polyOffset, localPolys, localVerts + localLines);
+
+    ptOffset += localPts;
+    vertOffset += localVerts;
+    lineOffset += localLines;
+    polyOffset += localPolys;
+  }
+  // Release the thread outputs as soon as they are appended.
+  for (vtkContourGridLocalData& local : worker.LocalData)
+  {
+    local = vtkContourGridLocalData();
+  }
+
+  if (mergePoints && localData.size() > 1)
+  {
+    // Points on the boundaries between the cells processed by different
+    // threads are duplicated. Contour points are merged when exactly
+    // coincident, as vtkMergePoints does.
+    vtkNew<vtkPolyData> pointSet;
+    pointSet->SetPoints(newPts);
+    vtkNew<vtkStaticPointLocator> mergeLocator;
+    mergeLocator->SetDataSet(pointSet);
+    mergeLocator->BuildLocator();
+    std::vector<vtkIdType> pointMap(numPts);
+    mergeLocator->MergePoints(0.0, pointMap.data());
+
+    vtkNew<vtkIdList> mergedIds;
+    std::vector<vtkIdType> newIds(numPts);
+    for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+    {
+      if (pointMap[ptId] == ptId)
+      {
+        newIds[ptId] = mergedIds->GetNumberOfIds();
+        mergedIds->InsertNextId(ptId);
+      }
+    }
+    vtkIdType numMergedPts = mergedIds->GetNumberOfIds();
+    if (numMergedPts < numPts)
+    {
+      vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+        for (; ptId < endPtId; ++ptId)
+        {
+          pointMap[ptId] = newIds[pointMap[ptId]];
+        }
+      });
+      for (vtkCellArray* cells : { newVerts.Get(), newLines.Get(), newPolys.Get() })
+      {
+        cells->Visit(vtkContourGridRenumberPoints{}, pointMap.data());
+      }
+
+      vtkNew<vtkPoints> mergedPts;
+      mergedPts->SetDataType(worker.PointsDataType);
+      mergedPts->SetNumberOfPoints(numMergedPts);
+      mergedPts->GetData()->InsertTuplesStartingAt(0, mergedIds, newPts->GetData());
+      newPts->ShallowCopy(mergedPts);
+
+      vtkNew<vtkPointData> mergedPd;
+      mergedPd->CopyAllocate(outPd, numMergedPts);
+      mergedPd->CopyData(outPd, mergedIds);
+      outPd->ShallowCopy(mergedPd);
+    }
+  }
+
+  output->SetPoints(newPts);
+  if (numVerts)
+  {
+    output->SetVerts(newVerts);
+  }
+  if (numLines)
+  {
+    output->SetLines(newLines);
+  }
+  if (numPolys)
+  {
+    output->SetPolys(newPolys);
+  }
+  output->Squeeze();
+}
+}
+
 //------------------------------------------------------------------------------
 // Contouring filter for unstructured grids.
 //
@@ -410,8 +812,20 @@ int vtkContourGrid::RequestData(vtkInformation* vtkNotUsed(request),
     scalarTree->SetScalars(inScalars);
   }
 
-  vtkContourGridExecute(this, input, output, inScalars, numContours, values, computeScalars,
-    useScalarTree, scalarTree, this->GenerateTriangles != 0);
+  // The parallel execution merges points like vtkMergePoints, it is used
+  // unless another kind of locator was given.
+  vtkUnstructuredGrid* ugrid = vtkUnstructuredGrid::SafeDownCast(input);
+  bool mergePoints = this->Locator->IsA("vtkMergePoints") != 0;
+  if (!this->SequentialProcessing && !useScalarTree && ugrid &&
+    (mergePoints || this->Locator->IsA("vtkNonMergingPointLocator")))
+  {
+    vtkContourGridExecuteParallel(this, ugrid, output, inScalars, numContours, values, mergePoints);
+  }
+  else
+  {
+    vtkContourGridExecute(this, input, output, inScalars, numContours, values, computeScalars,
+      useScalarTree, scalarTree, this->GenerateTriangles != 0);
+  }
 
   if (this->ComputeNormals)
   {
@@ -536,5 +950,6 @@ void vtkContourGrid::PrintSelf(ostream& os, vtkIndent indent)
   }
 
   os << indent << "Precision of the output points: " << this->OutputPointsPrecision << "\n";
+  os << indent << "Sequential Processing: " << (this->SequentialProcessing ? "true\n" : "false\n");
 }
 VTK_ABI_NAMESPACE_END
@@ -22,6 +22,14 @@
  * contours are being extracted. If you want to use a scalar tree,
  * invoke the method UseScalarTreeOn().
  *
+ * Cells of vtkUnstructuredGrid inputs, including quadratic, higher order
+ * cells and polyhedra, are contoured in parallel using vtkSMPTools unless
+ * SequentialProcessing is on, a scalar tree is used, or the locator is
+ * neither a vtkMergePoints nor a vtkNonMergingPointLocator. Each thread
+ * merges its own points and the points shared between threads are merged
+ * afterwards, so the output matches the sequential output up to the order
+ * of its points and cells.
+ *
  * @warning
  * If the input vtkUnstructuredGrid contains 3D linear cells, the class
  * vtkContour3DLinearGrid is much faster and may be preferred in certain
@@ -159,6 +167,19 @@ public:
   int GetOutputPointsPrecision() const;
   ///@}
 
+  ///@{
+  /**
+   * Force sequential processing (i.e. single thread) of the contouring
+   * process. By default, sequential processing is off. Note this flag only
+   * applies if the class has been compiled with VTK_SMP_IMPLEMENTATION_TYPE
+   * set to something other than Sequential. This flag is typically used for
+   * benchmarking purposes.
+   */
+  vtkSetMacro(SequentialProcessing, vtkTypeBool);
+  vtkGetMacro(SequentialProcessing, vtkTypeBool);
+  vtkBooleanMacro(SequentialProcessing, vtkTypeBool);
+  ///@}
+
 protected:
   vtkContourGrid();
   ~vtkContourGrid() override;
@@ -177,6 +198,7 @@ protected:
   vtkScalarTree* ScalarTree;
 
   int OutputPointsPrecision;
+  vtkTypeBool SequentialProcessing;
   vtkEdgeTable* EdgeTable;
 
 private:
@@ -7,6 +7,7 @@
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkCellIterator.h"
+#include "vtkContourGrid.h"
 #include "vtkContourHelper.h"
 #include "vtkContourValues.h"
 #include "vtkDataSet.h"
@@ -22,6 +23,7 @@
 #include "vtkInformationVector.h"
 #include "vtkMergePoints.h"
 #include "vtkNew.h"
+#include "vtkNonMergingPointLocator.h"
 #include "vtkObjectFactory.h"
 #include "vtkPlane.h"
 #include "vtkPlaneCutter.h"
@@ -34,6 +36,7 @@
 #include "vtkStructuredGrid.h"
 #include "vtkSynchronizedTemplates3D.h"
 #include "vtkSynchronizedTemplatesCutter3D.h"
+#include "vtkUnstructuredGrid.h"
 #include "vtkUnstructuredGridBase.h"
 
 #include <algorithm>
@@ -55,8 +58,10 @@ vtkCutter::vtkCutter(vtkImplicitFunction* cf)
   this->Locator = nullptr;
   this->GenerateTriangles = 1;
   this->OutputPointsPrecision = DEFAULT_PRECISION;
+  this->SequentialProcessing = false;
 
   this->PlaneCutter->SetContainerAlgorithm(this);
+  this->ContourGrid->SetContainerAlgorithm(this);
   this->SynchronizedTemplates3D->SetContainerAlgorithm(this);
   this->SynchronizedTemplatesCutter3D->SetContainerAlgorithm(this);
   this->GridSynchronizedTemplates->SetContainerAlgorithm(this);
@@ -734,6 +739,21 @@ void vtkCutter::DataSetCutter(vtkDataSet* input, vtkPolyData* output)
 //------------------------------------------------------------------------------
 void vtkCutter::UnstructuredGridCutter(vtkDataSet* input, vtkPolyData* output)
 {
+  // The threaded vtkContourGrid produces the same output as the loop below,
+  // up to the order of the points and cells, when the cells are sorted by
+  // value and the locator only merges coincident points.
+  if (this->Locator == nullptr)
+  {
+    this->CreateDefaultLocator();
+  }
+  vtkUnstructuredGrid* ugrid = vtkUnstructuredGrid::SafeDownCast(input);
+  if (!this->SequentialProcessing && ugrid && this->SortBy == VTK_SORT_BY_VALUE &&
+    (this->Locator->IsA("vtkMergePoints") || this->Locator->IsA("vtkNonMergingPointLocator")))
+  {
+    this->UnstructuredGridContour(ugrid, output);
+    return;
+  }
+
   vtkIdType i;
   int iter;
   vtkDoubleArray* cellScalars;
@@ -1041,6 +1061,72 @@ void vtkCutter::UnstructuredGridCutter(vtkDataSet* input, vtkPolyData* output)
   output->Squeeze();
 }
 
+//------------------------------------------------------------------------------
+// Evaluate the cut function on all the points at once, then contour the cut
+// scalars in parallel with vtkContourGrid.
+void vtkCutter::UnstructuredGridContour(vtkUnstructuredGrid* input, vtkPolyData* output)
+{
+  vtkNew<vtkDoubleArray> cutScalars;
+  this->CutFunction->FunctionValue(input->GetPoints()->GetData(), cutScalars);
+
+  vtkNew<vtkUnstructuredGrid> cutInput;
+  cutInput->ShallowCopy(input);
+  vtkPointData* cutPD = cutInput->GetPointData();
+  vtkDataArray* inScalars = input->GetPointData()->GetScalars();
+  if (this->GenerateCutScalars)
+  {
+    // The cut scalars replace the input scalars, as in UnstructuredGridCutter().
+    cutPD->SetScalars(cutScalars);
+    this->ContourGrid->SetInputArrayToProcess(0, 0, 0,
+      vtkDataObject::FIELD_ASSOCIATION_POINTS, vtkDataSetAttributes::SCALARS);
+  }
+  else
+  {
+    // vtkContourGrid does not output the contoured array when it does not
+    // compute scalars, the other arrays are interpolated.
+    cutScalars->SetName("vtkCutterScalars");
+    cutPD->AddArray(cutScalars);
+    this->ContourGrid->SetInputArrayToProcess(
+      0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, cutScalars->GetName());
+  }
+
+  const int numContours = static_cast<int>(this->ContourValues->GetNumberOfContours());
+  this->ContourGrid->SetNumberOfContours(numContours);
+  for (int i = 0; i < numContours; ++i)
+  {
+    this->ContourGrid->SetValue(i, this->ContourValues->GetValue(i));
+  }
+  if (this->Locator->IsA("vtkNonMergingPointLocator"))
+  {
+    if (!vtkNonMergingPointLocator::SafeDownCast(this->ContourGrid->GetLocator()))
+    {
+      vtkNew<vtkNonMergingPointLocator> locator;
+      this->ContourGrid->SetLocator(locator);
+    }
+  }
+  else if (!vtkMergePoints::SafeDownCast(this->ContourGrid->GetLocator()))
+  {
+    vtkNew<vtkMergePoints> locator;
+    this->ContourGrid->SetLocator(locator);
+  }
+  this->ContourGrid->SetComputeScalars(this->GenerateCutScalars);
+  this->ContourGrid->ComputeNormalsOff();
+  this->ContourGrid->UseScalarTreeOff();
+  this->ContourGrid->SequentialProcessingOff();
+  this->ContourGrid->SetGenerateTriangles(this->GenerateTriangles);
+  this->ContourGrid->SetOutputPointsPrecision(this->OutputPointsPrecision);
+  this->ContourGrid->SetInputData(cutInput);
+  this->ContourGrid->Update();
+  output->ShallowCopy(this->ContourGrid->GetOutput());
+  this->ContourGrid->SetInputData(nullptr);
+
+  // vtkContourGrid passes the input scalars as a regular array.
+  if (!this->GenerateCutScalars && inScalars && inScalars->GetName())
+  {
+    output->GetPointData()->SetActiveScalars(inScalars->GetName());
+  }
+}
+
 //------------------------------------------------------------------------------
 // Specify a spatial locator for merging points. By default,
 // an instance of vtkMergePoints is used.
@@ -1092,5 +1178,6 @@ void vtkCutter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Generate Cut Scalars: " << (this->GenerateCutScalars ? "On\n" : "Off\n");
 
   os << indent << "Precision of the output points: " << this->OutputPointsPrecision << "\n";
+  os << indent << "Sequential Processing: " << (this->SequentialProcessing ? "true\n" : "false\n");
 }
 VTK_ABI_NAMESPACE_END
@@ -30,6 +30,14 @@
  * it's specialized for planes and it's faster because it's multithreaded, and in some
  * cases also algorithmically faster.
  *
+ * vtkUnstructuredGrid inputs cut with other functions, or with a plane when
+ * generating cut scalars or polygons, are processed in parallel: the cut
+ * function is evaluated in batch and the resulting scalars are contoured by
+ * the threaded vtkContourGrid. This requires sorting by value and a
+ * vtkMergePoints or vtkNonMergingPointLocator locator, and can be disabled
+ * with SequentialProcessing. The output then matches the sequential output up
+ * to the order of its points and cells.
+ *
  * @sa
  * vtkImplicitFunction vtkClipPolyData vtkPlaneCutter
  */
@@ -46,6 +54,7 @@
 #define VTK_SORT_BY_CELL 1
 
 VTK_ABI_NAMESPACE_BEGIN
+class vtkContourGrid;
 class vtkGridSynchronizedTemplates3D;
 class vtkImplicitFunction;
 class vtkIncrementalPointLocator;
@@ -53,6 +62,7 @@ class vtkPlaneCutter;
 class vtkRectilinearSynchronizedTemplates;
 class vtkSynchronizedTemplates3D;
 class vtkSynchronizedTemplatesCutter3D;
+class vtkUnstructuredGrid;
 
 class VTKFILTERSCORE_EXPORT vtkCutter : public vtkPolyDataAlgorithm
 {
@@ -213,6 +223,17 @@ public:
   vtkGetMacro(OutputPointsPrecision, int);
   ///@}
 
+  ///@{
+  /**
+   * Force sequential processing (i.e. single thread) of the cutting of
+   * vtkUnstructuredGrid inputs by non-plane functions. By default, sequential
+   * processing is off. This flag is typically used for benchmarking purposes.
+   */
+  vtkSetMacro(SequentialProcessing, vtkTypeBool);
+  vtkGetMacro(SequentialProcessing, vtkTypeBool);
+  vtkBooleanMacro(SequentialProcessing, vtkTypeBool);
+  ///@}
+
 protected:
   vtkCutter(vtkImplicitFunction* cf = nullptr);
   ~vtkCutter() override;
@@ -221,6 +242,7 @@ protected:
   int RequestUpdateExtent(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
   int FillInputPortInformation(int port, vtkInformation* info) override;
   void UnstructuredGridCutter(vtkDataSet* input, vtkPolyData* output);
+  void UnstructuredGridContour(vtkUnstructuredGrid* input, vtkPolyData* output);
   void DataSetCutter(vtkDataSet* input, vtkPolyData* output);
   void StructuredPointsCutter(
     vtkDataSet*, vtkPolyData*, vtkInformation*, vtkInformationVector**, vtkInformationVector*);
@@ -234,12 +256,14 @@ protected:
   vtkNew<vtkGridSynchronizedTemplates3D> GridSynchronizedTemplates;
   vtkNew<vtkRectilinearSynchronizedTemplates> RectilinearSynchronizedTemplates;
   vtkNew<vtkPlaneCutter> PlaneCutter;
+  vtkNew<vtkContourGrid> ContourGrid;
 
   vtkIncrementalPointLocator* Locator;
   int SortBy;
   vtkNew<vtkContourValues> ContourValues;
   vtkTypeBool GenerateCutScalars;
   int OutputPointsPrecision;
+  vtkTypeBool SequentialProcessing;
 
 private:
   vtkCutter(const vtkCutter&) = delete;
@@ -13,10 +13,99 @@
 #include "vtkPointData.h"
 #include "vtkPointLocator.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 #include "vtkTetra.h"
 #include "vtkTriangle.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+// Minimum number of points of the first round of a BRIO order.
+const vtkIdType BRIO_MIN_ROUND_SIZE = 1000;
+
+// Spread the 21 lowest bits of v so that they occupy every third bit.
+uint64_t SpreadBits(uint64_t v)
+{
+  v &= 0x1fffff;
+  v = (v | v << 32) & 0x1f00000000ffffULL;
+  v = (v | v << 16) & 0x1f0000ff0000ffULL;
+  v = (v | v << 8) & 0x100f00f00f00f00fULL;
+  v = (v | v << 4) & 0x10c30c30c30c30c3ULL;
+  v = (v | v << 2) & 0x1249249249249249ULL;
+  return v;
+}
+
+struct PointCode
+{
+  uint64_t Code;
+  vtkIdType PointId;
+
+  bool operator<(const PointCode& other) const
+  {
+    return this->Code < other.Code || (this->Code == other.Code && this->PointId < other.PointId);
+  }
+};
+
+// Compute a biased randomized insertion order (Amenta, Choi and Rote): the
+// points are shuffled and split into rounds of doubling size, and the points
+// of each round are sorted along a Morton curve.
+void ComputeBRIOOrder(vtkPoints* points, const double bounds[6], std::vector<vtkIdType>& order)
+{
+  const vtkIdType numPts = points->GetNumberOfPoints();
+  order.resize(numPts);
+  std::iota(order.begin(), order.end(), 0);
+  std::mt19937 generator(0);
+  std::shuffle(order.begin(), order.end(), generator);
+
+  double scale[3];
+  for (int i = 0; i < 3; ++i)
+  {
+    const double length = bounds[2 * i + 1] - bounds[2 * i];
+    scale[i] = length > 0.0 ? 2097151.0 / length : 0.0;
+  }
+
+  std::vector<PointCode> codes(numPts);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType i, vtkIdType end) {
+    double x[3];
+    for (; i < end; ++i)
+    {
+      const vtkIdType ptId = order[i];
+      points->GetPoint(ptId, x);
+      uint64_t code = 0;
+      for (int j = 0; j < 3; ++j)
+      {
+        const double c = std::min(std::max((x[j] - bounds[2 * j]) * scale[j], 0.0), 2097151.0);
+        code |= SpreadBits(static_cast<uint64_t>(c)) << j;
+      }
+      codes[i] = PointCode{ code, ptId };
+    }
+  });
+
+  // The last round holds half of the points, the one before a quarter, and
+  // so on down to the first round.
+  vtkIdType end = numPts;
+  while (end > 0)
+  {
+    const vtkIdType begin = end / 2 >= BRIO_MIN_ROUND_SIZE ? end / 2 : 0;
+    vtkSMPTools::Sort(codes.begin() + begin, codes.begin() + end);
+    end = begin;
+  }
+
+  vtkSMPTools::For(0, numPts, [&](vtkIdType i, vtkIdType endId) {
+    for (; i < endId; ++i)
+    {
+      order[i] = codes[i].PointId;
+    }
+  });
+}
+}
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkDelaunay3D);
 
@@ -193,22 +282,34 @@ vtkIdType vtkDelaunay3D::FindEnclosingFaces(double x[3], vtkUnstructuredGrid* Me
     return 0;
   }
 
-  closestPoint = locator->FindClosestInsertedPoint(x);
-  vtkCellLinks* links = static_cast<vtkCellLinks*>(Mesh->GetLinks());
-  int numCells = links->GetNcells(closestPoint);
-  vtkIdType* cells = links->GetCells(closestPoint);
-  if (numCells <= 0) // shouldn't happen
+  // When the points are spatially ordered, the previous point is close by:
+  // walk from the last created tetra, and only fall back to the closest
+  // point when the walk fails.
+  tetraId = -1;
+  if (this->InsertionOrder == BRIO_ORDER && this->LastTetraId >= 0)
   {
-    this->NumberOfDegeneracies++;
-    return 0;
+    tetraId = this->FindTetra(Mesh, xd, this->LastTetraId, 0);
   }
-  else
+
+  if (tetraId < 0)
   {
-    tetraId = cells[0];
-  }
+    closestPoint = locator->FindClosestInsertedPoint(x);
+    vtkCellLinks* links = static_cast<vtkCellLinks*>(Mesh->GetLinks());
+    int numCells = links->GetNcells(closestPoint);
+    vtkIdType* cells = links->GetCells(closestPoint);
+    if (numCells <= 0) // shouldn't happen
+    {
+      this->NumberOfDegeneracies++;
+      return 0;
+    }
+    else
+    {
+      tetraId = cells[0];
+    }
 
-  // Okay, walk towards the containing tetrahedron
-  tetraId = this->FindTetra(Mesh, xd, tetraId, 0);
+    // Okay, walk towards the containing tetrahedron
+    tetraId = this->FindTetra(Mesh, xd, tetraId, 0);
+  }
   if (tetraId < 0)
   {
     this->NumberOfDegeneracies++;
@@ -481,20 +582,29 @@ int vtkDelaunay3D::RequestData(vtkInformation* vtkNotUsed(request),
 
   Mesh = this->InitPointInsertion(center, this->Offset * tol, numPoints, points);
 
+  std::vector<vtkIdType> order;
+  if (this->InsertionOrder == BRIO_ORDER)
+  {
+    double bounds[6];
+    inPoints->GetBounds(bounds);
+    ComputeBRIOOrder(inPoints, bounds, order);
+  }
+
   // Insert each point into triangulation. Points laying "inside"
   // of tetra cause tetra to be deleted, leaving a void with bounding
   // faces. Combination of point and each face is used to form new
   // tetrahedra.
-  for (ptId = 0; ptId < numPoints; ptId++)
+  for (i = 0; i < numPoints; i++)
   {
+    ptId = order.empty() ? i : order[i];
     inPoints->GetPoint(ptId, x);
 
     this->InsertPoint(Mesh, points, ptId, x, holeTetras);
 
-    if (!(ptId % 250))
+    if (!(i % 250))
     {
-      vtkDebugMacro(<< "point #" << ptId);
-      this->UpdateProgress(static_cast<double>(ptId) / numPoints);
+      vtkDebugMacro(<< "point #" << i);
+      this->UpdateProgress(static_cast<double>(i) / numPoints);
       if (this->CheckAbort())
       {
         break;
@@ -787,6 +897,7 @@ vtkUnstructuredGrid* vtkDelaunay3D::InitPointInsertion(
 
   this->NumberOfDuplicatePoints = 0;
   this->NumberOfDegeneracies = 0;
+  this->LastTetraId = -1;
 
   if (length <= 0.0)
   {
@@ -952,6 +1063,7 @@ void vtkDelaunay3D::InsertPoint(
       }
 
       this->InsertTetra(Mesh, points, tetraId);
+      this->LastTetraId = tetraId;
 
     } // for each face
 
@@ -1051,6 +1163,8 @@ void vtkDelaunay3D::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Tolerance: " << this->Tolerance << "\n";
   os << indent << "Offset: " << this->Offset << "\n";
   os << indent << "Bounding Triangulation: " << (this->BoundingTriangulation ? "On\n" : "Off\n");
+  os << indent << "Insertion Order: "
+     << (this->InsertionOrder == BRIO_ORDER ? "BRIO Order\n" : "Input Order\n");
 
   if (this->Locator)
   {
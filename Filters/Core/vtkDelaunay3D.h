@@ -75,6 +75,13 @@
  * will be found. However, in degenerate cases an enclosing tetrahedron may
  * not be found and the point will be rejected.
  *
+ * @warning
+ * Large point sets should be inserted in BRIO order (see InsertionOrder):
+ * consecutive insertions are then spatially close, so that the search for
+ * the enclosing tetrahedron starts from the last created tetrahedron and
+ * the mesh is traversed coherently in memory. The insertion itself is
+ * sequential.
+ *
  * @sa
  * vtkDelaunay2D vtkGaussianSplatter vtkUnstructuredGrid
  */
@@ -186,6 +193,32 @@ public:
   vtkBooleanMacro(BoundingTriangulation, vtkTypeBool);
   ///@}
 
+  /**
+   * Orders in which the points are inserted in the triangulation.
+   */
+  enum InsertionOrderType
+  {
+    INPUT_ORDER = 0,
+    BRIO_ORDER = 1
+  };
+
+  ///@{
+  /**
+   * Specify the order in which the input points are inserted. INPUT_ORDER
+   * (the default) inserts them in the order of the input. BRIO_ORDER inserts
+   * them in a biased randomized insertion order: the points are shuffled
+   * into rounds of doubling size, and the points of each round are sorted
+   * along a space filling curve. This ordering, computed in parallel with
+   * vtkSMPTools, greatly reduces the cost of locating the points in the
+   * triangulation for large point sets. Note that degenerate point sets may
+   * be triangulated differently depending on the order.
+   */
+  vtkSetClampMacro(InsertionOrder, int, INPUT_ORDER, BRIO_ORDER);
+  vtkGetMacro(InsertionOrder, int);
+  void SetInsertionOrderToInputOrder() { this->SetInsertionOrder(INPUT_ORDER); }
+  void SetInsertionOrderToBRIOOrder() { this->SetInsertionOrder(BRIO_ORDER); }
+  ///@}
+
   ///@{
   /**
    * Set / get a spatial locator for merging points. By default,
@@ -267,6 +300,7 @@ protected:
   vtkTypeBool BoundingTriangulation;
   double Offset;
   int OutputPointsPrecision;
+  int InsertionOrder = INPUT_ORDER;
 
   vtkIncrementalPointLocator* Locator; // help locate points faster
 
@@ -281,6 +315,10 @@ protected:
   // Keep track of number of references to points to avoid new/delete calls
   int* References;
 
+  // Last tetra created by InsertPoint(), used as the starting point of the
+  // search of the next point when the points are spatially ordered.
+  vtkIdType LastTetraId = -1;
+
   vtkIdType FindEnclosingFaces(double x[3], vtkUnstructuredGrid* Mesh, vtkIdList* tetras,
     vtkIdList* faces, vtkIncrementalPointLocator* Locator);
 
@@ -15,11 +15,14 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTriangleStrip.h"
 #include "vtkUnsignedCharArray.h"
 
 #include <map>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkFeatureEdges);
@@ -28,6 +31,19 @@ namespace
 {
 constexpr unsigned char CELL_NOT_VISIBLE =
   vtkDataSetAttributes::HIDDENCELL | vtkDataSetAttributes::DUPLICATECELL;
+
+// Classification of the edges of the polygons, one per connectivity entry
+enum EdgeType : signed char
+{
+  NOT_EXTRACTED = -1,
+  BOUNDARY_EDGE,
+  NON_MANIFOLD_EDGE,
+  FEATURE_EDGE,
+  MANIFOLD_EDGE
+};
+
+// Values of the "Edge Types" scalars, indexed by EdgeType
+constexpr double EDGE_TYPE_SCALARS[] = { 0.0, 0.222222, 0.444444, 0.666667 };
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -78,18 +94,15 @@ int vtkFeatureEdges::RequestData(vtkInformation* vtkNotUsed(request),
   vtkFloatArray* newScalars = nullptr;
   vtkCellArray* newLines;
   vtkPolyData* Mesh;
-  int i;
-  vtkIdType j, numNei;
   vtkIdType numBEdges, numNonManifoldEdges, numFedges, numManifoldEdges;
-  double scalar, n[3], x1[3], x2[3];
+  double x1[3], x2[3];
   double cosAngle = 0;
   vtkIdType lineIds[2];
   vtkIdType npts = 0;
   const vtkIdType* pts = nullptr;
   vtkCellArray *inPolys, *inStrips, *newPolys;
   vtkFloatArray* polyNormals = nullptr;
-  vtkIdType numPts, numCells, numPolys, numStrips, numLines, nei;
-  vtkIdList* neighbors;
+  vtkIdType numPts, numCells, numPolys, numStrips, numLines;
   vtkIdType p1, p2, newId;
   vtkPointData *pd = input->GetPointData(), *outPD = output->GetPointData();
   vtkCellData *cd = input->GetCellData(), *outCD = output->GetCellData();
@@ -253,27 +266,151 @@ int vtkFeatureEdges::RequestData(vtkInformation* vtkNotUsed(request),
   // Loop over all polygons generating boundary, non-manifold,
   // and feature edges
   //
+  const vtkIdType numNewPolys = newPolys->GetNumberOfCells();
+  vtkSMPThreadLocalObject<vtkIdList> tlPtIds;
   if (this->FeatureEdges)
   {
     polyNormals = vtkFloatArray::New();
     polyNormals->SetNumberOfComponents(3);
-    polyNormals->Allocate(3 * newPolys->GetNumberOfCells());
+    polyNormals->SetNumberOfTuples(numNewPolys);
+
+    vtkSMPTools::For(0, numNewPolys, [&](vtkIdType cellId, vtkIdType endCellId) {
+      vtkIdList* ptIds = tlPtIds.Local();
+      vtkIdType ncpts;
+      const vtkIdType* cpts;
+      double n[3];
+      for (; cellId < endCellId; ++cellId)
+      {
+        newPolys->GetCellAtId(cellId, ncpts, cpts, ptIds);
+        vtkPolygon::ComputeNormal(inPts, ncpts, cpts, n);
+        polyNormals->SetTuple(cellId, n);
+      }
+    });
 
-    vtkIdType cellId;
-    for (cellId = 0, newPolys->InitTraversal(); newPolys->GetNextCell(npts, pts); cellId++)
+    cosAngle = cos(vtkMath::RadiansFromDegrees(this->FeatureAngle));
+  }
+
+  // Map the polygons of Mesh to the cells of the input
+  auto inputCellId = [&](vtkIdType polyId) -> vtkIdType {
+    if (numPolys == numCells) // Input only has Polys
     {
-      vtkPolygon::ComputeNormal(inPts, npts, pts, n);
-      polyNormals->InsertTuple(cellId, n);
+      return polyId;
     }
+    else if (polyId < numPolys) // Input has mixed types, and we currently are on a Poly
+    {
+      return polyIdToCellIdMap->GetId(polyId);
+    }
+    // Input has mixed types and we are dealing with triangle strips
+    auto it = decomposedStripIdToStripIdMap.lower_bound(polyId + 1);
+    return stripIdToCellIdMap->GetId(it->second);
+  };
+
+  // Classify the edges of the polygons concurrently. The type of an edge is
+  // stored at the connectivity entry of its first point, and the output is
+  // generated afterwards by visiting the polygons in order.
+  std::vector<signed char> edgeTypes(newPolys->GetNumberOfConnectivityIds(), NOT_EXTRACTED);
+  vtkSMPThreadLocalObject<vtkIdList> tlNeighbors;
+  vtkSMPThreadLocalObject<vtkIdList> tlEdgesRemapping;
+  vtkSMPTools::For(0, numNewPolys, [&](vtkIdType newCellId, vtkIdType endCellId) {
+    vtkIdList* ptIds = tlPtIds.Local();
+    vtkIdList* neighbors = tlNeighbors.Local();
+    // Used with non manifold edges when there are ghost cells in the input
+    vtkIdList* edgesRemapping = tlEdgesRemapping.Local();
+    vtkIdType ncpts, j, nei;
+    const vtkIdType* cpts;
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; newCellId < endCellId; ++newCellId)
+    {
+      if (isFirst)
+      {
+        this->CheckAbort();
+      }
+      if (this->GetAbortOutput())
+      {
+        break;
+      }
+      if (ghosts && ghosts[inputCellId(newCellId)] & CELL_NOT_VISIBLE)
+      {
+        continue;
+      }
 
-    cosAngle = cos(vtkMath::RadiansFromDegrees(this->FeatureAngle));
-  }
+      newPolys->GetCellAtId(newCellId, ncpts, cpts, ptIds);
+      signed char* cellEdgeTypes = edgeTypes.data() + newPolys->GetOffset(newCellId);
+      edgesRemapping->Reset();
+      for (vtkIdType i = 0; i < ncpts; i++)
+      {
+        Mesh->GetCellEdgeNeighbors(newCellId, cpts[i], cpts[(i + 1) % ncpts], neighbors);
+        const vtkIdType numNei = neighbors->GetNumberOfIds();
+
+        vtkIdType numNeiWithoutGhosts = numNei;
+        vtkIdType firstNeighbor = 0;
+        if (ghosts)
+        {
+          for (j = 0; j < numNei; ++j)
+          {
+            if (ghosts[inputCellId(neighbors->GetId(j))] & CELL_NOT_VISIBLE)
+            {
+              if (this->NonManifoldEdges)
+              {
+                edgesRemapping->InsertNextId(j);
+              }
+              if (j == firstNeighbor)
+              {
+                ++firstNeighbor;
+              }
+              --numNeiWithoutGhosts;
+            }
+          }
+        }
+        // Ignoring edges that are not visible
+        if (numNeiWithoutGhosts != numNei && this->RemoveGhostInterfaces)
+        {
+          continue;
+        }
 
-  neighbors = vtkIdList::New();
-  neighbors->Allocate(VTK_CELL_SIZE);
+        if (this->BoundaryEdges && numNeiWithoutGhosts < 1)
+        {
+          cellEdgeTypes[i] = BOUNDARY_EDGE;
+        }
+        else if (this->NonManifoldEdges && numNeiWithoutGhosts > 1)
+        {
+          // check to make sure that this edge hasn't been created before
+          for (j = 0; j < (ghosts ? edgesRemapping->GetNumberOfIds() : numNei); j++)
+          {
+            if (neighbors->GetId(ghosts ? edgesRemapping->GetId(j) : j) < newCellId)
+            {
+              break;
+            }
+          }
+          edgesRemapping->Reset();
+          if (j >= numNeiWithoutGhosts)
+          {
+            cellEdgeTypes[i] = NON_MANIFOLD_EDGE;
+          }
+        }
+        else if (this->FeatureEdges && numNeiWithoutGhosts == 1 &&
+          (nei = neighbors->GetId(firstNeighbor)) > newCellId)
+        {
+          double neiTuple[3];
+          double cellTuple[3];
+          polyNormals->GetTuple(nei, neiTuple);
+          polyNormals->GetTuple(newCellId, cellTuple);
+          if (vtkMath::Dot(neiTuple, cellTuple) <= cosAngle)
+          {
+            cellEdgeTypes[i] = FEATURE_EDGE;
+          }
+        }
+        else if (this->ManifoldEdges && numNeiWithoutGhosts == 1 &&
+          neighbors->GetId(firstNeighbor) > newCellId)
+        {
+          cellEdgeTypes[i] = MANIFOLD_EDGE;
+        }
+      }
+    }
+  });
 
-  bool abort = false;
-  vtkIdType progressInterval = newPolys->GetNumberOfCells() / 20 + 1;
+  bool abort = this->GetAbortOutput();
+  vtkIdType progressInterval = numNewPolys / 20 + 1;
 
   numBEdges = numNonManifoldEdges = numFedges = numManifoldEdges = 0;
   vtkIdType newCellId, cellId;
@@ -322,8 +459,7 @@ int vtkFeatureEdges::RequestData(vtkInformation* vtkNotUsed(request),
     }
   }
 
-  for (newCellId = 0, newPolys->InitTraversal(); newPolys->GetNextCell(npts, pts) && !abort;
-       newCellId++)
+  for (newCellId = 0; newCellId < numNewPolys && !abort; newCellId++)
   {
     if (!(newCellId % progressInterval)) // manage progress / early abort
     {
@@ -331,131 +467,31 @@ int vtkFeatureEdges::RequestData(vtkInformation* vtkNotUsed(request),
       abort = this->CheckAbort();
     }
 
-    if (numPolys == numCells) // Input only has Polys
-    {
-      cellId = newCellId;
-    }
-    else if (newCellId < numPolys) // Input has mixed types, and we currently are on a Poly
-    {
-      cellId = polyIdToCellIdMap->GetId(newCellId);
-    }
-    else // Input has mixed types and we are dealing with triangle strips
-    {
-      auto it = decomposedStripIdToStripIdMap.lower_bound(newCellId + 1);
-      cellId = stripIdToCellIdMap->GetId(it->second);
-    }
-
-    if (ghosts && ghosts[cellId] & CELL_NOT_VISIBLE)
-    {
-      continue;
-    }
-
-    // Used with non manifold edges when there are ghost cells in the input
-    vtkNew<vtkIdList> edgesRemapping;
+    newPolys->GetCellAtId(newCellId, npts, pts);
+    const signed char* cellEdgeTypes = edgeTypes.data() + newPolys->GetOffset(newCellId);
+    cellId = inputCellId(newCellId);
 
-    for (i = 0; i < npts; i++)
+    for (vtkIdType i = 0; i < npts; i++)
     {
-      p1 = pts[i];
-      p2 = pts[(i + 1) % npts];
-
-      Mesh->GetCellEdgeNeighbors(newCellId, p1, p2, neighbors);
-      numNei = neighbors->GetNumberOfIds();
-
-      vtkIdType numNeiWithoutGhosts = numNei;
-      vtkIdType firstNeighbor = 0;
-      if (ghosts)
-      {
-        for (j = 0; j < numNei; ++j)
-        {
-          vtkIdType neiId = neighbors->GetId(j);
-          vtkIdType neighborCellIdInInput;
-          if (numPolys == numCells)
-          {
-            neighborCellIdInInput = neiId;
-          }
-          else if (neiId < numPolys)
-          {
-            neighborCellIdInInput = polyIdToCellIdMap->GetId(neiId);
-          }
-          else
-          {
-            auto it = decomposedStripIdToStripIdMap.lower_bound(neiId + 1);
-            neighborCellIdInInput = stripIdToCellIdMap->GetId(it->second);
-          }
-          if (ghosts[neighborCellIdInInput] & CELL_NOT_VISIBLE)
-          {
-            if (this->NonManifoldEdges)
-            {
-              edgesRemapping->InsertNextId(j);
-            }
-            if (j == firstNeighbor)
-            {
-              ++firstNeighbor;
-            }
-            --numNeiWithoutGhosts;
-          }
-        }
-      }
-      // Ignoring edges that are not visible
-      if (numNeiWithoutGhosts != numNei && this->RemoveGhostInterfaces)
-      {
-        continue;
-      }
-
-      if (this->BoundaryEdges && numNeiWithoutGhosts < 1)
-      {
-        numBEdges++;
-        scalar = 0.0;
-      }
-
-      else if (this->NonManifoldEdges && numNeiWithoutGhosts > 1)
+      switch (cellEdgeTypes[i])
       {
-        // check to make sure that this edge hasn't been created before
-        for (j = 0; j < (ghosts ? edgesRemapping->GetNumberOfIds() : numNei); j++)
-        {
-          if (neighbors->GetId(ghosts ? edgesRemapping->GetId(j) : j) < newCellId)
-          {
-            break;
-          }
-        }
-        edgesRemapping->Reset();
-        if (j >= numNeiWithoutGhosts)
-        {
+        case BOUNDARY_EDGE:
+          numBEdges++;
+          break;
+        case NON_MANIFOLD_EDGE:
           numNonManifoldEdges++;
-          scalar = 0.222222;
-        }
-        else
-        {
-          continue;
-        }
-      }
-      else if (this->FeatureEdges && numNeiWithoutGhosts == 1 &&
-        (nei = neighbors->GetId(firstNeighbor)) > newCellId)
-      {
-        double neiTuple[3];
-        double cellTuple[3];
-        polyNormals->GetTuple(nei, neiTuple);
-        polyNormals->GetTuple(newCellId, cellTuple);
-        if (vtkMath::Dot(neiTuple, cellTuple) <= cosAngle)
-        {
+          break;
+        case FEATURE_EDGE:
           numFedges++;
-          scalar = 0.444444;
-        }
-        else
-        {
+          break;
+        case MANIFOLD_EDGE:
+          numManifoldEdges++;
+          break;
+        default:
           continue;
-        }
-      }
-      else if (this->ManifoldEdges && numNeiWithoutGhosts == 1 &&
-        neighbors->GetId(firstNeighbor) > newCellId)
-      {
-        numManifoldEdges++;
-        scalar = 0.666667;
-      }
-      else
-      {
-        continue;
       }
+      p1 = pts[i];
+      p2 = pts[(i + 1) % npts];
 
       // Add edge to output
       Mesh->GetPoint(p1, x1);
@@ -475,7 +511,7 @@ int vtkFeatureEdges::RequestData(vtkInformation* vtkNotUsed(request),
       outCD->CopyData(cd, cellId, newId);
       if (this->Coloring)
       {
-        newScalars->InsertTuple(newId, &scalar);
+        newScalars->InsertTuple1(newId, EDGE_TYPE_SCALARS[cellEdgeTypes[i]]);
       }
     }
   }
@@ -497,7 +533,6 @@ int vtkFeatureEdges::RequestData(vtkInformation* vtkNotUsed(request),
 
   output->SetPoints(newPts);
   newPts->Delete();
-  neighbors->Delete();
 
   output->SetLines(newLines);
   newLines->Delete();
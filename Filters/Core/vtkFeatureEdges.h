@@ -15,6 +15,10 @@
  * based on edge type. The cell coloring is assigned to the cell data of
  * the extracted edges.
  *
+ * The normals of the polygons and the types of their edges are computed in
+ * parallel using vtkSMPTools; the edges are then output in the order of the
+ * polygons, as a serial traversal would.
+ *
  * @warning
  * To see the coloring of the lines you may have to set the ScalarMode
  * instance variable of the mapper to SetScalarModeToUseCellData(). (This
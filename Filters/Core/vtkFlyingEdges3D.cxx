@@ -127,7 +127,8 @@ public:
   // The three main passes of the algorithm.
   void ProcessXEdge(double value, T const* inPtr, vtkIdType row, vtkIdType slice); // PASS 1
   void ProcessYZEdges(vtkIdType row, vtkIdType slice);                             // PASS 2
-  void GenerateOutput(double value, T* inPtr, vtkIdType row, vtkIdType slice);     // PASS 4
+  void GenerateOutput(double value, T* inPtr, vtkIdType row, vtkIdType slice,
+    ArrayList::EdgeBatch* batch); // PASS 4
 
   // Optional copying of cell data
   void InterpolateCellData(ArrayList* cellArrays, vtkIdType row, vtkIdType slice);
@@ -218,7 +219,7 @@ public:
 
   // Interpolate along a voxel axes edge.
   void InterpolateAxesEdge(double t, unsigned char loc, T const* const s, const int incs[3],
-    vtkIdType vId, vtkIdType ijk0[3], vtkIdType ijk1[3], float g0[3])
+    vtkIdType vId, vtkIdType ijk0[3], vtkIdType ijk1[3], float g0[3], ArrayList::EdgeBatch* batch)
   {
     float* x = this->NewPoints + 3 * vId;
     x[0] = ijk0[0] + t * (ijk1[0] - ijk0[0]) + this->Min0;
@@ -256,7 +257,7 @@ public:
     {
       vtkIdType v0 = ijk0[0] + ijk0[1] * incs[1] + ijk0[2] * incs[2];
       vtkIdType v1 = ijk1[0] + ijk1[1] * incs[1] + ijk1[2] * incs[2];
-      this->Arrays.InterpolateEdge(v0, v1, t, vId);
+      batch->Add(v0, v1, t, vId);
     }
   }
 
@@ -268,11 +269,14 @@ public:
   // volume boundary. This means careful computation of stuff requiring
   // neighborhood information (e.g., gradients).
   void InterpolateEdge(double value, vtkIdType ijk[3], T const* s, const int incs[3],
-    unsigned char edgeNum, unsigned char const* edgeUses, vtkIdType* eIds);
+    unsigned char edgeNum, unsigned char const* edgeUses, vtkIdType* eIds,
+    ArrayList::EdgeBatch* batch);
 
-  // Produce the output points on the voxel axes for this voxel cell.
+  // Produce the output points on the voxel axes for this voxel cell. The
+  // attribute interpolations are accumulated in the batch.
   void GeneratePoints(double value, unsigned char loc, vtkIdType ijk[3], T const* sPtr,
-    const int incs[3], unsigned char const* edgeUses, vtkIdType* eIds);
+    const int incs[3], unsigned char const* edgeUses, vtkIdType* eIds,
+    ArrayList::EdgeBatch* batch);
 
   // Helper function to set up the point ids on voxel edges.
   unsigned char InitVoxelIds(unsigned char* ePtr[4], vtkIdType* eMD[4], vtkIdType* eIds)
@@ -409,6 +413,8 @@ public:
       TT *rowPtr, *slicePtr = this->Algo->Scalars + slice * this->Algo->Inc2;
       bool isFirst = vtkSMPTools::GetSingleThread();
       vtkIdType checkAbortInterval = std::min((end - slice) / 10 + 1, (vtkIdType)1000);
+      // Point attributes are interpolated in batches, array by array.
+      ArrayList::EdgeBatch batch(&this->Algo->Arrays);
       for (; slice < end; ++slice)
       {
         if (slice % checkAbortInterval == 0)
@@ -427,7 +433,7 @@ public:
         {
           for (row = 0, rowPtr = slicePtr; row < this->Algo->Dims[1] - 1; ++row)
           {
-            this->Algo->GenerateOutput(this->Value, rowPtr, row, slice);
+            this->Algo->GenerateOutput(this->Value, rowPtr, row, slice, &batch);
             rowPtr += this->Algo->Inc1;
           } // for all rows in this slice
         }   // if there are triangles
@@ -435,6 +441,7 @@ public:
         eMD0 = eMD1;
         eMD1 = eMD0 + 6 * this->Algo->Dims[1];
       } // for all slices in this batch
+      batch.Flush();
     }
   };
 
@@ -728,7 +735,8 @@ void vtkFlyingEdges3DAlgorithm<T>::ComputeBoundaryGradient(vtkIdType ijk[3],
 // proximity to the boundary when computing gradients, etc.
 template <class T>
 void vtkFlyingEdges3DAlgorithm<T>::InterpolateEdge(double value, vtkIdType ijk[3], T const* const s,
-  const int incs[3], unsigned char edgeNum, unsigned char const* const edgeUses, vtkIdType* eIds)
+  const int incs[3], unsigned char edgeNum, unsigned char const* const edgeUses, vtkIdType* eIds,
+  ArrayList::EdgeBatch* batch)
 {
   // if this edge is not used then get out
   if (!edgeUses[edgeNum])
@@ -794,7 +802,7 @@ void vtkFlyingEdges3DAlgorithm<T>::InterpolateEdge(double value, vtkIdType ijk[3
   {
     vtkIdType v0 = ijk0[0] + ijk0[1] * incs[1] + ijk0[2] * incs[2];
     vtkIdType v1 = ijk1[0] + ijk1[1] * incs[1] + ijk1[2] * incs[2];
-    this->Arrays.InterpolateEdge(v0, v1, t, vId);
+    batch->Add(v0, v1, t, vId);
   }
 }
 
@@ -803,7 +811,8 @@ void vtkFlyingEdges3DAlgorithm<T>::InterpolateEdge(double value, vtkIdType ijk[3
 // interpolate attributes.
 template <class T>
 void vtkFlyingEdges3DAlgorithm<T>::GeneratePoints(double value, unsigned char loc, vtkIdType ijk[3],
-  T const* const sPtr, const int incs[3], unsigned char const* const edgeUses, vtkIdType* eIds)
+  T const* const sPtr, const int incs[3], unsigned char const* const edgeUses, vtkIdType* eIds,
+  ArrayList::EdgeBatch* batch)
 {
   // Create a slightly faster path for voxel axes interior to the volume.
   float g0[3];
@@ -827,7 +836,7 @@ void vtkFlyingEdges3DAlgorithm<T>::GeneratePoints(double value, unsigned char lo
 
       T const* const sPtr2 = (sPtr + incs[i]);
       double t = (value - *sPtr) / (*sPtr2 - *sPtr);
-      this->InterpolateAxesEdge(t, loc, sPtr2, incs, eIds[i * 4], ijk, ijk1, g0);
+      this->InterpolateAxesEdge(t, loc, sPtr2, incs, eIds[i * 4], ijk, ijk1, g0, batch);
     }
   }
 
@@ -861,8 +870,8 @@ void vtkFlyingEdges3DAlgorithm<T>::GeneratePoints(double value, unsigned char lo
     case 19:
     case 22:
     case 23:
-      this->InterpolateEdge(value, ijk, sPtr, incs, 5, edgeUses, eIds);
-      this->InterpolateEdge(value, ijk, sPtr, incs, 9, edgeUses, eIds);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 5, edgeUses, eIds, batch);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 9, edgeUses, eIds, batch);
       break;
 
     //+y
@@ -874,8 +883,8 @@ void vtkFlyingEdges3DAlgorithm<T>::GeneratePoints(double value, unsigned char lo
     case 25:
     case 28:
     case 29:
-      this->InterpolateEdge(value, ijk, sPtr, incs, 1, edgeUses, eIds);
-      this->InterpolateEdge(value, ijk, sPtr, incs, 10, edgeUses, eIds);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 1, edgeUses, eIds, batch);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 10, edgeUses, eIds, batch);
       break;
 
     //+x +y
@@ -887,11 +896,11 @@ void vtkFlyingEdges3DAlgorithm<T>::GeneratePoints(double value, unsigned char lo
     case 27:
     case 30:
     case 31:
-      this->InterpolateEdge(value, ijk, sPtr, incs, 1, edgeUses, eIds);
-      this->InterpolateEdge(value, ijk, sPtr, incs, 5, edgeUses, eIds);
-      this->InterpolateEdge(value, ijk, sPtr, incs, 9, edgeUses, eIds);
-      this->InterpolateEdge(value, ijk, sPtr, incs, 10, edgeUses, eIds);
-      this->InterpolateEdge(value, ijk, sPtr, incs, 11, edgeUses, eIds);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 1, edgeUses, eIds, batch);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 5, edgeUses, eIds, batch);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 9, edgeUses, eIds, batch);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 10, edgeUses, eIds, batch);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 11, edgeUses, eIds, batch);
       break;
 
     //+z
@@ -903,8 +912,8 @@ void vtkFlyingEdges3DAlgorithm<T>::GeneratePoints(double value, unsigned char lo
     case 49:
     case 52:
     case 53:
-      this->InterpolateEdge(value, ijk, sPtr, incs, 2, edgeUses, eIds);
-      this->InterpolateEdge(value, ijk, sPtr, incs, 6, edgeUses, eIds);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 2, edgeUses, eIds, batch);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 6, edgeUses, eIds, batch);
       break;
 
     //+x +z
@@ -916,11 +925,11 @@ void vtkFlyingEdges3DAlgorithm<T>::GeneratePoints(double value, unsigned char lo
     case 51:
     case 54:
     case 55:
-      this->InterpolateEdge(value, ijk, sPtr, incs, 2, edgeUses, eIds);
-      this->InterpolateEdge(value, ijk, sPtr, incs, 5, edgeUses, eIds);
-      this->InterpolateEdge(value, ijk, sPtr, incs, 9, edgeUses, eIds);
-      this->InterpolateEdge(value, ijk, sPtr, incs, 6, edgeUses, eIds);
-      this->InterpolateEdge(value, ijk, sPtr, incs, 7, edgeUses, eIds);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 2, edgeUses, eIds, batch);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 5, edgeUses, eIds, batch);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 9, edgeUses, eIds, batch);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 6, edgeUses, eIds, batch);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 7, edgeUses, eIds, batch);
       break;
 
     //+y +z
@@ -932,11 +941,11 @@ void vtkFlyingEdges3DAlgorithm<T>::GeneratePoints(double value, unsigned char lo
     case 57:
     case 60:
     case 61:
-      this->InterpolateEdge(value, ijk, sPtr, incs, 1, edgeUses, eIds);
-      this->InterpolateEdge(value, ijk, sPtr, incs, 2, edgeUses, eIds);
-      this->InterpolateEdge(value, ijk, sPtr, incs, 3, edgeUses, eIds);
-      this->InterpolateEdge(value, ijk, sPtr, incs, 6, edgeUses, eIds);
-      this->InterpolateEdge(value, ijk, sPtr, incs, 10, edgeUses, eIds);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 1, edgeUses, eIds, batch);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 2, edgeUses, eIds, batch);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 3, edgeUses, eIds, batch);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 6, edgeUses, eIds, batch);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 10, edgeUses, eIds, batch);
       break;
 
     //+x +y +z
@@ -948,15 +957,15 @@ void vtkFlyingEdges3DAlgorithm<T>::GeneratePoints(double value, unsigned char lo
     case 59:
     case 62:
     case 63:
-      this->InterpolateEdge(value, ijk, sPtr, incs, 1, edgeUses, eIds);
-      this->InterpolateEdge(value, ijk, sPtr, incs, 2, edgeUses, eIds);
-      this->InterpolateEdge(value, ijk, sPtr, incs, 3, edgeUses, eIds);
-      this->InterpolateEdge(value, ijk, sPtr, incs, 5, edgeUses, eIds);
-      this->InterpolateEdge(value, ijk, sPtr, incs, 9, edgeUses, eIds);
-      this->InterpolateEdge(value, ijk, sPtr, incs, 10, edgeUses, eIds);
-      this->InterpolateEdge(value, ijk, sPtr, incs, 11, edgeUses, eIds);
-      this->InterpolateEdge(value, ijk, sPtr, incs, 6, edgeUses, eIds);
-      this->InterpolateEdge(value, ijk, sPtr, incs, 7, edgeUses, eIds);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 1, edgeUses, eIds, batch);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 2, edgeUses, eIds, batch);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 3, edgeUses, eIds, batch);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 5, edgeUses, eIds, batch);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 9, edgeUses, eIds, batch);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 10, edgeUses, eIds, batch);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 11, edgeUses, eIds, batch);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 6, edgeUses, eIds, batch);
+      this->InterpolateEdge(value, ijk, sPtr, incs, 7, edgeUses, eIds, batch);
       break;
 
     default: // voxels with only -x,-y,-z boundaries
@@ -1164,7 +1173,7 @@ void vtkFlyingEdges3DAlgorithm<T>::ProcessYZEdges(vtkIdType row, vtkIdType slice
 // algorithm.
 template <class T>
 void vtkFlyingEdges3DAlgorithm<T>::GenerateOutput(
-  double value, T* rowPtr, vtkIdType row, vtkIdType slice)
+  double value, T* rowPtr, vtkIdType row, vtkIdType slice, ArrayList::EdgeBatch* batch)
 {
   // Grab the edge meta data surrounding the voxel row.
   vtkIdType* eMD[4];
@@ -1252,7 +1261,7 @@ void vtkFlyingEdges3DAlgorithm<T>::GenerateOutput(
       if (this->CaseIncludesAxes(eCase) || loc != Interior)
       {
         unsigned char const* const edgeUses = this->GetEdgeUses(eCase);
-        this->GeneratePoints(value, loc, ijk, sPtr, incs, edgeUses, eIds);
+        this->GeneratePoints(value, loc, ijk, sPtr, incs, edgeUses, eIds, batch);
       }
       this->AdvanceVoxelIds(eCase, eIds);
     }
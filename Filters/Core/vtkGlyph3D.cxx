@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkGlyph3D.h"
 
+#include "vtkArrayListTemplate.h"
 #include "vtkCell.h"
+#include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkFloatArray.h"
 #include "vtkIdList.h"
@@ -10,10 +12,13 @@
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkMatrix4x4.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTransform.h"
@@ -21,7 +26,101 @@
 #include "vtkUniformGrid.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+// Number of points, and number of cells and connectivity size of every cell
+// array (verts, lines, polys and strips) generated by a glyph. Prefix sums of
+// the counts give the location of every glyph in the output.
+struct GlyphCounts
+{
+  vtkIdType Points = 0;
+  vtkIdType Cells[4] = { 0, 0, 0, 0 };
+  vtkIdType Connectivity[4] = { 0, 0, 0, 0 };
+
+  GlyphCounts operator+(const GlyphCounts& other) const
+  {
+    GlyphCounts sum;
+    sum.Points = this->Points + other.Points;
+    for (int type = 0; type < 4; ++type)
+    {
+      sum.Cells[type] = this->Cells[type] + other.Cells[type];
+      sum.Connectivity[type] = this->Connectivity[type] + other.Connectivity[type];
+    }
+    return sum;
+  }
+};
+
+// A glyph of the table, with its (transformed) points and its topology
+// gathered up front so that the glyphs can be generated concurrently.
+struct GlyphSource
+{
+  vtkPolyData* Source = nullptr;
+  std::vector<double> Points;
+  vtkDataArray* Normals = nullptr;
+  vtkDataArray* TCoords = nullptr;
+  std::vector<vtkIdType> Offsets[4];
+  std::vector<vtkIdType> Connectivity[4];
+  GlyphCounts Counts;
+
+  void Initialize(vtkPolyData* source, vtkTransform* sourceTransform)
+  {
+    this->Source = source;
+    vtkSmartPointer<vtkPoints> points = source->GetPoints();
+    const vtkIdType numPts = points ? points->GetNumberOfPoints() : 0;
+    if (sourceTransform && numPts > 0)
+    {
+      vtkNew<vtkPoints> transformedPoints;
+      transformedPoints->SetDataTypeToDouble();
+      transformedPoints->Allocate(numPts);
+      sourceTransform->TransformPoints(points, transformedPoints);
+      points = transformedPoints;
+    }
+    this->Points.resize(3 * numPts);
+    for (vtkIdType i = 0; i < numPts; ++i)
+    {
+      points->GetPoint(i, this->Points.data() + 3 * i);
+    }
+    this->Normals = source->GetPointData()->GetNormals();
+    this->TCoords = source->GetPointData()->GetTCoords();
+    this->Counts.Points = numPts;
+
+    vtkCellArray* cellArrays[4] = { source->GetVerts(), source->GetLines(), source->GetPolys(),
+      source->GetStrips() };
+    vtkNew<vtkIdList> cellPtIds;
+    for (int type = 0; type < 4; ++type)
+    {
+      const vtkIdType numCells = cellArrays[type]->GetNumberOfCells();
+      this->Offsets[type].resize(numCells + 1);
+      this->Offsets[type][0] = 0;
+      this->Connectivity[type].clear();
+      this->Connectivity[type].reserve(cellArrays[type]->GetNumberOfConnectivityIds());
+      for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+      {
+        vtkIdType npts;
+        const vtkIdType* pts;
+        cellArrays[type]->GetCellAtId(cellId, npts, pts, cellPtIds);
+        this->Connectivity[type].insert(this->Connectivity[type].end(), pts, pts + npts);
+        this->Offsets[type][cellId + 1] = static_cast<vtkIdType>(this->Connectivity[type].size());
+      }
+      this->Counts.Cells[type] = numCells;
+      this->Counts.Connectivity[type] = static_cast<vtkIdType>(this->Connectivity[type].size());
+    }
+  }
+};
+
+// Scale, vector and table index of the glyph of an input point
+struct GlyphParameters
+{
+  double Scale[3];
+  double V[3];
+  double VMag;
+  int Index;
+};
+} // anonymous namespace
+
 vtkStandardNewMacro(vtkGlyph3D);
 vtkCxxSetObjectMacro(vtkGlyph3D, SourceTransform, vtkTransform);
 
@@ -125,40 +224,23 @@ bool vtkGlyph3D::Execute(vtkDataSet* input, vtkInformationVector* sourceVector,
   vtkPointData* pd;
   vtkDataArray* inCScalars; // Scalars for Coloring
   unsigned char* inGhostLevels = nullptr;
-  vtkDataArray *inNormals, *sourceNormals = nullptr;
-  vtkDataArray* sourceTCoords = nullptr;
-  vtkIdType numPts, numSourcePts, numSourceCells, inPtId, i;
-  vtkPoints* sourcePts = nullptr;
-  vtkSmartPointer<vtkPoints> transformedSourcePts = vtkSmartPointer<vtkPoints>::New();
+  vtkDataArray* inNormals;
+  vtkIdType numPts;
   vtkPoints* newPts;
   vtkDataArray* newScalars = nullptr;
   vtkDataArray* newVectors = nullptr;
   vtkDataArray* newNormals = nullptr;
   vtkDataArray* newTCoords = nullptr;
-  double x[3], v[3], vNew[3], s = 0.0, vMag = 0.0, value, tc[3];
-  vtkTransform* trans = vtkTransform::New();
-  vtkNew<vtkIdList> pointIdList;
-  vtkIdList* cellPts;
-  int npts;
-  vtkIdList* pts;
-  vtkIdType ptIncr, cellIncr, cellId;
   int haveVectors, haveNormals, haveTCoords = 0;
-  double scalex, scaley, scalez, den;
+  double den;
   vtkPointData* outputPD = output->GetPointData();
   vtkCellData* outputCD = output->GetCellData();
   int numberOfSources = this->GetNumberOfInputConnections(1);
   vtkIdTypeArray* pointIds = nullptr;
   vtkSmartPointer<vtkPolyData> source = this->GetSource(0, sourceVector);
-  vtkNew<vtkIdList> srcPointIdList;
-  vtkNew<vtkIdList> dstPointIdList;
-  vtkNew<vtkIdList> srcCellIdList;
-  vtkNew<vtkIdList> dstCellIdList;
 
   vtkDebugMacro(<< "Generating glyphs");
 
-  pts = vtkIdList::New();
-  pts->Allocate(VTK_CELL_SIZE);
-
   pd = input->GetPointData();
   inNormals = this->GetInputArrayToProcess(2, input);
   inCScalars = this->GetInputArrayToProcess(3, input);
@@ -185,8 +267,6 @@ bool vtkGlyph3D::Execute(vtkDataSet* input, vtkInformationVector* sourceVector,
   if (numPts < 1)
   {
     vtkDebugMacro(<< "No points to glyph!");
-    pts->Delete();
-    trans->Delete();
     return true;
   }
 
@@ -216,8 +296,6 @@ bool vtkGlyph3D::Execute(vtkDataSet* input, vtkInformationVector* sourceVector,
     if (source == nullptr)
     {
       vtkErrorMacro(<< "Indexing on but don't have data to index with");
-      pts->Delete();
-      trans->Delete();
       return true;
     }
     else
@@ -227,6 +305,17 @@ bool vtkGlyph3D::Execute(vtkDataSet* input, vtkInformationVector* sourceVector,
     }
   }
 
+  vtkDataArray* array3D = nullptr;
+  if (haveVectors && this->VectorMode != VTK_FOLLOW_CAMERA_DIRECTION)
+  {
+    array3D = this->VectorMode == VTK_USE_NORMAL ? inNormals : inVectors;
+    if (array3D->GetNumberOfComponents() > 3)
+    {
+      vtkErrorMacro(<< "vtkDataArray " << array3D->GetName() << " has more than 3 components.\n");
+      return false;
+    }
+  }
+
   // Allocate storage for output PolyData
   //
   outputPD->CopyVectorsOff();
@@ -249,24 +338,21 @@ bool vtkGlyph3D::Execute(vtkDataSet* input, vtkInformationVector* sourceVector,
     source = defaultSource;
   }
 
+  // Gather the glyph table once: the geometry of every source is shared by
+  // all the glyphs using it.
+  std::vector<GlyphSource> sources;
   if (this->IndexMode != VTK_INDEXING_OFF)
   {
     pd = nullptr;
     haveNormals = 1;
-    for (numSourcePts = numSourceCells = i = 0; i < numberOfSources; i++)
+    sources.resize(numberOfSources);
+    for (int i = 0; i < numberOfSources; i++)
     {
-      source = this->GetSource(i, sourceVector);
-      if (source != nullptr)
+      vtkPolyData* indexedSource = this->GetSource(i, sourceVector);
+      if (indexedSource != nullptr)
       {
-        if (source->GetNumberOfPoints() > numSourcePts)
-        {
-          numSourcePts = source->GetNumberOfPoints();
-        }
-        if (source->GetNumberOfCells() > numSourceCells)
-        {
-          numSourceCells = source->GetNumberOfCells();
-        }
-        if (!(sourceNormals = source->GetPointData()->GetNormals()))
+        sources[i].Initialize(indexedSource, this->SourceTransform);
+        if (!sources[i].Normals)
         {
           haveNormals = 0;
         }
@@ -275,45 +361,133 @@ bool vtkGlyph3D::Execute(vtkDataSet* input, vtkInformationVector* sourceVector,
   }
   else
   {
-    sourcePts = source->GetPoints();
-    numSourcePts = sourcePts->GetNumberOfPoints();
-    numSourceCells = source->GetNumberOfCells();
+    sources.resize(1);
+    sources[0].Initialize(source, this->SourceTransform);
+    haveNormals = sources[0].Normals ? 1 : 0;
+    haveTCoords = sources[0].TCoords ? 1 : 0;
+  }
 
-    sourceNormals = source->GetPointData()->GetNormals();
-    if (sourceNormals)
+  // Compute the glyph scale, vector and source index of an input point
+  auto computeGlyph = [&](vtkIdType inPtId, GlyphParameters& glyph) {
+    double s = 0.0;
+    glyph.Scale[0] = glyph.Scale[1] = glyph.Scale[2] = 1.0;
+    glyph.VMag = 0.0;
+    if (inSScalars)
     {
-      haveNormals = 1;
+      s = inSScalars->GetComponent(inPtId, 0);
+      if (this->ScaleMode == VTK_SCALE_BY_SCALAR || this->ScaleMode == VTK_DATA_SCALING_OFF)
+      {
+        glyph.Scale[0] = glyph.Scale[1] = glyph.Scale[2] = s;
+      }
     }
-    else
+
+    if (haveVectors)
     {
-      haveNormals = 0;
+      if (this->VectorMode == VTK_FOLLOW_CAMERA_DIRECTION)
+      {
+        glyph.VMag = 1.0; // v will be set later
+      }
+      else
+      {
+        glyph.V[0] = 0;
+        glyph.V[1] = 0;
+        glyph.V[2] = 0;
+        array3D->GetTuple(inPtId, glyph.V);
+        glyph.VMag = vtkMath::Norm(glyph.V);
+        if (this->ScaleMode == VTK_SCALE_BY_VECTORCOMPONENTS)
+        {
+          glyph.Scale[0] = glyph.V[0];
+          glyph.Scale[1] = glyph.V[1];
+          glyph.Scale[2] = glyph.V[2];
+        }
+        else if (this->ScaleMode == VTK_SCALE_BY_VECTOR)
+        {
+          glyph.Scale[0] = glyph.Scale[1] = glyph.Scale[2] = glyph.VMag;
+        }
+      }
     }
 
-    sourceTCoords = source->GetPointData()->GetTCoords();
-    if (sourceTCoords)
+    // Clamp data scale if enabled
+    if (this->Clamping)
     {
-      haveTCoords = 1;
+      for (int i = 0; i < 3; i++)
+      {
+        double scale = glyph.Scale[i];
+        scale = (scale < this->Range[0] ? this->Range[0]
+                                        : (scale > this->Range[1] ? this->Range[1] : scale));
+        glyph.Scale[i] = (scale - this->Range[0]) / den;
+      }
     }
-    else
+
+    // Compute index into table of glyphs
+    glyph.Index = 0;
+    if (this->IndexMode != VTK_INDEXING_OFF)
     {
-      haveTCoords = 0;
+      double value = this->IndexMode == VTK_INDEXING_BY_SCALAR ? s : glyph.VMag;
+      int index = static_cast<int>((value - this->Range[0]) * numberOfSources / den);
+      glyph.Index = (index < 0 ? 0 : (index >= numberOfSources ? (numberOfSources - 1) : index));
     }
+  };
+
+  // First pass: find the glyph of every input point and count its output
+  std::vector<int> glyphIndices(numPts);
+  std::vector<GlyphCounts> glyphOffsets(numPts);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType inPtId, vtkIdType endPtId) {
+    GlyphParameters glyph;
+    for (; inPtId < endPtId; ++inPtId)
+    {
+      computeGlyph(inPtId, glyph);
+
+      // Make sure we're not indexing into empty glyph, and do not duplicate
+      // ghost glyphs on the borders of pieces nor glyph blanked points.
+      if (glyph.Index < 0 || glyph.Index >= static_cast<int>(sources.size()) ||
+        !sources[glyph.Index].Source ||
+        (inGhostLevels &&
+          inGhostLevels[inPtId] &
+            (vtkDataSetAttributes::DUPLICATEPOINT | vtkDataSetAttributes::HIDDENPOINT)) ||
+        (inputUG && !inputUG->IsPointVisible(inPtId)) || !this->IsPointVisible(input, inPtId))
+      {
+        glyphIndices[inPtId] = -1;
+        glyphOffsets[inPtId] = GlyphCounts();
+      }
+      else
+      {
+        glyphIndices[inPtId] = glyph.Index;
+        glyphOffsets[inPtId] = sources[glyph.Index].Counts;
+      }
+    }
+  });
+  this->UpdateProgress(0.1);
+
+  GlyphCounts totals = glyphOffsets.back();
+  vtkSMPTools::ExclusiveScan(
+    glyphOffsets.begin(), glyphOffsets.end(), glyphOffsets.begin(), GlyphCounts());
+  totals = totals + glyphOffsets.back();
+
+  // The output cells are ordered by cell array: verts, lines, polys then strips
+  vtkIdType totalCells = 0;
+  vtkIdType cellArrayStarts[4];
+  for (int type = 0; type < 4; ++type)
+  {
+    cellArrayStarts[type] = totalCells;
+    totalCells += totals.Cells[type];
+  }
 
-    // Prepare to copy output.
-    pd = input->GetPointData();
-    outputPD->CopyAllocate(pd, numPts * numSourcePts);
+  // Prepare to copy output.
+  ArrayList pointArrays;
+  ArrayList cellArrays;
+  if (pd)
+  {
+    outputPD->CopyAllocate(pd, totals.Points);
+    pointArrays.AddArrays(totals.Points, pd, outputPD, 0.0, false);
     if (this->FillCellData)
     {
       outputCD->CopyGlobalIdsOn();
-      outputCD->CopyAllocate(pd, numPts * numSourceCells);
+      outputCD->CopyAllocate(pd, totalCells);
+      cellArrays.AddArrays(totalCells, pd, outputCD, 0.0, false);
     }
   }
 
-  srcPointIdList->SetNumberOfIds(numSourcePts);
-  dstPointIdList->SetNumberOfIds(numSourcePts);
-  srcCellIdList->SetNumberOfIds(numSourceCells);
-  dstCellIdList->SetNumberOfIds(numSourceCells);
-
   newPts = vtkPoints::New();
 
   // Set the desired precision for the points in the output.
@@ -330,12 +504,12 @@ bool vtkGlyph3D::Execute(vtkDataSet* input, vtkInformationVector* sourceVector,
     newPts->SetDataType(VTK_DOUBLE);
   }
 
-  newPts->Allocate(numPts * numSourcePts);
+  newPts->SetNumberOfPoints(totals.Points);
   if (this->GeneratePointIds)
   {
     pointIds = vtkIdTypeArray::New();
     pointIds->SetName(this->PointIdsName);
-    pointIds->Allocate(numPts * numSourcePts);
+    pointIds->SetNumberOfTuples(totals.Points);
     outputPD->AddArray(pointIds);
     pointIds->Delete();
   }
@@ -343,13 +517,13 @@ bool vtkGlyph3D::Execute(vtkDataSet* input, vtkInformationVector* sourceVector,
   {
     newScalars = inCScalars->NewInstance();
     newScalars->SetNumberOfComponents(inCScalars->GetNumberOfComponents());
-    newScalars->Allocate(inCScalars->GetNumberOfComponents() * numPts * numSourcePts);
+    newScalars->SetNumberOfTuples(totals.Points);
     newScalars->SetName(inCScalars->GetName());
   }
   else if ((this->ColorMode == VTK_COLOR_BY_SCALE) && inSScalars)
   {
     newScalars = vtkFloatArray::New();
-    newScalars->Allocate(numPts * numSourcePts);
+    newScalars->SetNumberOfTuples(totals.Points);
     newScalars->SetName("GlyphScale");
     if (this->ScaleMode == VTK_SCALE_BY_SCALAR)
     {
@@ -359,203 +533,95 @@ bool vtkGlyph3D::Execute(vtkDataSet* input, vtkInformationVector* sourceVector,
   else if ((this->ColorMode == VTK_COLOR_BY_VECTOR) && haveVectors)
   {
     newScalars = vtkFloatArray::New();
-    newScalars->Allocate(numPts * numSourcePts);
+    newScalars->SetNumberOfTuples(totals.Points);
     newScalars->SetName("VectorMagnitude");
   }
   if (haveVectors)
   {
     newVectors = vtkFloatArray::New();
     newVectors->SetNumberOfComponents(3);
-    newVectors->Allocate(3 * numPts * numSourcePts);
+    newVectors->SetNumberOfTuples(totals.Points);
     newVectors->SetName("GlyphVector");
   }
   if (haveNormals)
   {
     newNormals = vtkFloatArray::New();
     newNormals->SetNumberOfComponents(3);
-    newNormals->Allocate(3 * numPts * numSourcePts);
+    newNormals->SetNumberOfTuples(totals.Points);
     newNormals->SetName("Normals");
   }
   if (haveTCoords)
   {
     newTCoords = vtkFloatArray::New();
-    int numComps = sourceTCoords->GetNumberOfComponents();
-    newTCoords->SetNumberOfComponents(numComps);
-    newTCoords->Allocate(numComps * numPts * numSourcePts);
+    newTCoords->SetNumberOfComponents(sources[0].TCoords->GetNumberOfComponents());
+    newTCoords->SetNumberOfTuples(totals.Points);
     newTCoords->SetName("TCoords");
   }
 
-  // Setting up for calls to PolyData::InsertNextCell()
-  output->AllocateEstimate(numPts * numSourceCells, 3);
-
-  transformedSourcePts->SetDataTypeToDouble();
-  transformedSourcePts->Allocate(numSourcePts);
-
-  // Traverse all Input points, transforming Source points and copying
-  // point attributes.
-  //
-  ptIncr = 0;
-  cellIncr = 0;
-  for (inPtId = 0; inPtId < numPts; inPtId++)
+  vtkNew<vtkIdTypeArray> cellOffsets[4];
+  vtkNew<vtkIdTypeArray> cellConnectivity[4];
+  for (int type = 0; type < 4; ++type)
   {
-    scalex = scaley = scalez = 1.0;
-    if (!(inPtId % 10000))
+    cellOffsets[type]->SetNumberOfValues(totals.Cells[type] + 1);
+    cellOffsets[type]->SetValue(totals.Cells[type], totals.Connectivity[type]);
+    cellConnectivity[type]->SetNumberOfValues(totals.Connectivity[type]);
+  }
+
+  // Second pass: traverse all input points, transforming source points and
+  // copying point attributes into the slots computed by the first pass.
+  vtkSMPThreadLocalObject<vtkTransform> localTransforms;
+  vtkSMPTools::For(0, numPts, [&](vtkIdType inPtId, vtkIdType endPtId) {
+    vtkTransform* trans = localTransforms.Local();
+    GlyphParameters glyph;
+    double x[3], vNew[3], tc[3], p[3], matrix[16], normalMatrix[16];
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; inPtId < endPtId; ++inPtId)
     {
-      this->UpdateProgress(static_cast<double>(inPtId) / numPts);
-      if (this->CheckAbort())
+      if (isFirst)
       {
-        break;
+        this->CheckAbort();
       }
-    }
-
-    // Get the scalar and vector data
-    if (inSScalars)
-    {
-      s = inSScalars->GetComponent(inPtId, 0);
-      if (this->ScaleMode == VTK_SCALE_BY_SCALAR || this->ScaleMode == VTK_DATA_SCALING_OFF)
+      if (this->GetAbortOutput())
       {
-        scalex = scaley = scalez = s;
+        break;
       }
-    }
-
-    if (haveVectors)
-    {
-      if (this->VectorMode == VTK_FOLLOW_CAMERA_DIRECTION)
+      if (glyphIndices[inPtId] < 0)
       {
-        vMag = 1.0; // v will be set later
+        continue;
       }
-      else
+      computeGlyph(inPtId, glyph);
+      const GlyphSource& glyphSource = sources[glyphIndices[inPtId]];
+      const GlyphCounts& offsets = glyphOffsets[inPtId];
+      const vtkIdType numSourcePts = glyphSource.Counts.Points;
+      const vtkIdType ptIncr = offsets.Points;
+      double* v = glyph.V;
+
+      // Copy all topology (transformation independent)
+      for (int type = 0; type < 4; ++type)
       {
-        vtkDataArray* array3D = this->VectorMode == VTK_USE_NORMAL ? inNormals : inVectors;
-        if (array3D->GetNumberOfComponents() > 3)
+        const std::vector<vtkIdType>& srcOffsets = glyphSource.Offsets[type];
+        const std::vector<vtkIdType>& srcConn = glyphSource.Connectivity[type];
+        const vtkIdType numCells = glyphSource.Counts.Cells[type];
+        vtkIdType* outOffsets = cellOffsets[type]->GetPointer(offsets.Cells[type]);
+        vtkIdType* outConn = cellConnectivity[type]->GetPointer(offsets.Connectivity[type]);
+        for (vtkIdType i = 0; i < numCells; i++)
         {
-          vtkErrorMacro(<< "vtkDataArray " << array3D->GetName()
-                        << " has more than 3 components.\n");
-          pts->Delete();
-          trans->Delete();
-          if (newPts)
-          {
-            newPts->Delete();
-          }
-          if (newVectors)
-          {
-            newVectors->Delete();
-          }
-          return false;
+          outOffsets[i] = srcOffsets[i] + offsets.Connectivity[type];
         }
-
-        v[0] = 0;
-        v[1] = 0;
-        v[2] = 0;
-        array3D->GetTuple(inPtId, v);
-        vMag = vtkMath::Norm(v);
-        if (this->ScaleMode == VTK_SCALE_BY_VECTORCOMPONENTS)
-        {
-          scalex = v[0];
-          scaley = v[1];
-          scalez = v[2];
-        }
-        else if (this->ScaleMode == VTK_SCALE_BY_VECTOR)
+        for (std::size_t i = 0; i < srcConn.size(); i++)
         {
-          scalex = scaley = scalez = vMag;
+          outConn[i] = srcConn[i] + ptIncr;
         }
       }
-    }
 
-    // Clamp data scale if enabled
-    if (this->Clamping)
-    {
-      scalex = (scalex < this->Range[0] ? this->Range[0]
-                                        : (scalex > this->Range[1] ? this->Range[1] : scalex));
-      scalex = (scalex - this->Range[0]) / den;
-      scaley = (scaley < this->Range[0] ? this->Range[0]
-                                        : (scaley > this->Range[1] ? this->Range[1] : scaley));
-      scaley = (scaley - this->Range[0]) / den;
-      scalez = (scalez < this->Range[0] ? this->Range[0]
-                                        : (scalez > this->Range[1] ? this->Range[1] : scalez));
-      scalez = (scalez - this->Range[0]) / den;
-    }
+      // Now begin copying/transforming glyph
+      trans->Identity();
 
-    // Compute index into table of glyphs
-    if (this->IndexMode != VTK_INDEXING_OFF)
-    {
-      if (this->IndexMode == VTK_INDEXING_BY_SCALAR)
-      {
-        value = s;
-      }
-      else
-      {
-        value = vMag;
-      }
-
-      int index = static_cast<int>((value - this->Range[0]) * numberOfSources / den);
-      index = (index < 0 ? 0 : (index >= numberOfSources ? (numberOfSources - 1) : index));
-
-      source = this->GetSource(index, sourceVector);
-      if (source != nullptr)
-      {
-        sourcePts = source->GetPoints();
-        sourceNormals = source->GetPointData()->GetNormals();
-        numSourcePts = sourcePts->GetNumberOfPoints();
-        numSourceCells = source->GetNumberOfCells();
-      }
-    }
-
-    // Make sure we're not indexing into empty glyph
-    if (source == nullptr)
-    {
-      continue;
-    }
-
-    // Check ghost points.
-    // If we are processing a piece, we do not want to duplicate glyphs on the borders.
-    if (inGhostLevels &&
-      inGhostLevels[inPtId] &
-        (vtkDataSetAttributes::DUPLICATEPOINT | vtkDataSetAttributes::HIDDENPOINT))
-    {
-      continue;
-    }
-
-    if (inputUG && !inputUG->IsPointVisible(inPtId))
-    {
-      // input is a vtkUniformGrid and the current point is blanked. Don't glyph
-      // it.
-      continue;
-    }
-
-    if (!this->IsPointVisible(input, inPtId))
-    {
-      continue;
-    }
-
-    // Now begin copying/transforming glyph
-    trans->Identity();
+      // translate Source to Input point
+      input->GetPoint(inPtId, x);
+      trans->Translate(x[0], x[1], x[2]);
 
-    // Copy all topology (transformation independent)
-    for (cellId = 0; cellId < numSourceCells; cellId++)
-    {
-      source->GetCellPoints(cellId, pointIdList);
-      cellPts = pointIdList;
-      npts = cellPts->GetNumberOfIds();
-      for (pts->Reset(), i = 0; i < npts; i++)
-      {
-        pts->InsertId(i, cellPts->GetId(i) + ptIncr);
-      }
-      output->InsertNextCell(source->GetCellType(cellId), pts);
-    }
-
-    // translate Source to Input point
-    input->GetPoint(inPtId, x);
-    trans->Translate(x[0], x[1], x[2]);
-
-    if (haveVectors)
-    {
-      // Copy Input vector
-      for (i = 0; i < numSourcePts; i++)
-      {
-        newVectors->InsertTuple(i + ptIncr, v);
-      }
-      if (this->Orient)
+      if (haveVectors)
       {
         if (this->VectorMode == VTK_FOLLOW_CAMERA_DIRECTION)
         {
@@ -564,156 +630,176 @@ bool vtkGlyph3D::Execute(vtkDataSet* input, vtkInformationVector* sourceVector,
           v[1] = this->FollowedCameraPosition[1] - x[1];
           v[2] = this->FollowedCameraPosition[2] - x[2];
           vtkMath::Normalize(v);
-          double glyphRight_World[3]; // glyph right direction in World coordinate system
-          vtkMath::Cross(this->FollowedCameraViewUp, v, glyphRight_World);
-          // glyph up direction in World coordinate system
-          // (approximately the same as this->FollowedCameraViewUp, but slightly adjusted to be
-          // orthogonal to the normal direction)
-          double glyphUp_World[3];
-          vtkMath::Cross(v, glyphRight_World, glyphUp_World);
-          double glyphToWorld[16] = { glyphRight_World[0], glyphUp_World[0], v[0], 0.0,
-            glyphRight_World[1], glyphUp_World[1], v[1], 0.0, glyphRight_World[2], glyphUp_World[2],
-            v[2], 0.0, 0.0, 0.0, 0.0, 1.0 };
-          trans->Concatenate(glyphToWorld);
         }
-        else if (vMag > 0.0)
+
+        // Copy Input vector
+        for (vtkIdType i = 0; i < numSourcePts; i++)
         {
-          // if there is no y or z component
-          if (v[1] == 0.0 && v[2] == 0.0)
+          newVectors->SetTuple(i + ptIncr, v);
+        }
+        if (this->Orient)
+        {
+          if (this->VectorMode == VTK_FOLLOW_CAMERA_DIRECTION)
           {
-            if (v[0] < 0) // just flip x if we need to
-            {
-              trans->RotateWXYZ(180.0, 0, 1, 0);
-            }
+            double glyphRight_World[3]; // glyph right direction in World coordinate system
+            vtkMath::Cross(this->FollowedCameraViewUp, v, glyphRight_World);
+            // glyph up direction in World coordinate system
+            // (approximately the same as this->FollowedCameraViewUp, but slightly adjusted to be
+            // orthogonal to the normal direction)
+            double glyphUp_World[3];
+            vtkMath::Cross(v, glyphRight_World, glyphUp_World);
+            double glyphToWorld[16] = { glyphRight_World[0], glyphUp_World[0], v[0], 0.0,
+              glyphRight_World[1], glyphUp_World[1], v[1], 0.0, glyphRight_World[2],
+              glyphUp_World[2], v[2], 0.0, 0.0, 0.0, 0.0, 1.0 };
+            trans->Concatenate(glyphToWorld);
           }
-          else
+          else if (glyph.VMag > 0.0)
           {
-            vNew[0] = (v[0] + vMag) / 2.0;
-            vNew[1] = v[1] / 2.0;
-            vNew[2] = v[2] / 2.0;
-            trans->RotateWXYZ(180.0, vNew[0], vNew[1], vNew[2]);
+            // if there is no y or z component
+            if (v[1] == 0.0 && v[2] == 0.0)
+            {
+              if (v[0] < 0) // just flip x if we need to
+              {
+                trans->RotateWXYZ(180.0, 0, 1, 0);
+              }
+            }
+            else
+            {
+              vNew[0] = (v[0] + glyph.VMag) / 2.0;
+              vNew[1] = v[1] / 2.0;
+              vNew[2] = v[2] / 2.0;
+              trans->RotateWXYZ(180.0, vNew[0], vNew[1], vNew[2]);
+            }
           }
         }
       }
-    }
 
-    if (haveTCoords)
-    {
-      for (i = 0; i < numSourcePts; i++)
+      if (haveTCoords)
       {
-        sourceTCoords->GetTuple(i, tc);
-        newTCoords->InsertTuple(i + ptIncr, tc);
+        for (vtkIdType i = 0; i < numSourcePts; i++)
+        {
+          glyphSource.TCoords->GetTuple(i, tc);
+          newTCoords->SetTuple(i + ptIncr, tc);
+        }
       }
-    }
 
-    // determine scale factor from scalars if appropriate
-    // Copy scalar value
-    if (inSScalars && (this->ColorMode == VTK_COLOR_BY_SCALE))
-    {
-      for (i = 0; i < numSourcePts; i++)
+      // determine scale factor from scalars if appropriate
+      // Copy scalar value
+      if (inSScalars && (this->ColorMode == VTK_COLOR_BY_SCALE))
       {
-        newScalars->InsertTuple(i + ptIncr, &scalex); // = scaley = scalez
+        for (vtkIdType i = 0; i < numSourcePts; i++)
+        {
+          newScalars->SetTuple(i + ptIncr, glyph.Scale); // = scaley = scalez
+        }
       }
-    }
-    else if (inCScalars && (this->ColorMode == VTK_COLOR_BY_SCALAR))
-    {
-      for (i = 0; i < numSourcePts; i++)
+      else if (inCScalars && (this->ColorMode == VTK_COLOR_BY_SCALAR))
       {
-        outputPD->CopyTuple(inCScalars, newScalars, inPtId, ptIncr + i);
+        for (vtkIdType i = 0; i < numSourcePts; i++)
+        {
+          newScalars->SetTuple(ptIncr + i, inPtId, inCScalars);
+        }
       }
-    }
-    if (haveVectors && this->ColorMode == VTK_COLOR_BY_VECTOR)
-    {
-      for (i = 0; i < numSourcePts; i++)
+      if (haveVectors && this->ColorMode == VTK_COLOR_BY_VECTOR)
       {
-        newScalars->InsertTuple(i + ptIncr, &vMag);
+        for (vtkIdType i = 0; i < numSourcePts; i++)
+        {
+          newScalars->SetTuple(i + ptIncr, &glyph.VMag);
+        }
       }
-    }
 
-    // scale data if appropriate
-    if (this->Scaling)
-    {
-      if (this->ScaleMode == VTK_DATA_SCALING_OFF)
+      // scale data if appropriate
+      if (this->Scaling)
       {
-        scalex = scaley = scalez = this->ScaleFactor;
-      }
-      else
-      {
-        scalex *= this->ScaleFactor;
-        scaley *= this->ScaleFactor;
-        scalez *= this->ScaleFactor;
+        for (int i = 0; i < 3; i++)
+        {
+          double& scale = glyph.Scale[i];
+          scale = this->ScaleMode == VTK_DATA_SCALING_OFF ? this->ScaleFactor
+                                                          : scale * this->ScaleFactor;
+          if (scale == 0.0)
+          {
+            scale = 1.0e-10;
+          }
+        }
+        trans->Scale(glyph.Scale[0], glyph.Scale[1], glyph.Scale[2]);
       }
 
-      if (scalex == 0.0)
-      {
-        scalex = 1.0e-10;
-      }
-      if (scaley == 0.0)
-      {
-        scaley = 1.0e-10;
-      }
-      if (scalez == 0.0)
+      // multiply points and normals by resulting matrix
+      vtkMatrix4x4::DeepCopy(matrix, trans->GetMatrix());
+      const double* srcPts = glyphSource.Points.data();
+      for (vtkIdType i = 0; i < numSourcePts; i++, srcPts += 3)
       {
-        scalez = 1.0e-10;
+        for (int j = 0; j < 3; j++)
+        {
+          p[j] = matrix[4 * j] * srcPts[0] + matrix[4 * j + 1] * srcPts[1] +
+            matrix[4 * j + 2] * srcPts[2] + matrix[4 * j + 3];
+        }
+        newPts->SetPoint(ptIncr + i, p);
       }
-      trans->Scale(scalex, scaley, scalez);
-    }
-
-    // multiply points and normals by resulting matrix
-    if (this->SourceTransform)
-    {
-      transformedSourcePts->Reset();
-      this->SourceTransform->TransformPoints(sourcePts, transformedSourcePts);
-      trans->TransformPoints(transformedSourcePts, newPts);
-    }
-    else
-    {
-      trans->TransformPoints(sourcePts, newPts);
-    }
 
-    if (haveNormals)
-    {
-      trans->TransformNormals(sourceNormals, newNormals);
-    }
-
-    // Copy point data from source (if possible)
-    if (pd)
-    {
-      for (i = 0; i < numSourcePts; ++i)
+      if (haveNormals)
       {
-        srcPointIdList->SetId(i, inPtId);
-        dstPointIdList->SetId(i, ptIncr + i);
+        // to transform the normal, multiply by the transposed inverse matrix
+        vtkMatrix4x4::Invert(matrix, normalMatrix);
+        vtkMatrix4x4::Transpose(normalMatrix, normalMatrix);
+        for (vtkIdType i = 0; i < numSourcePts; i++)
+        {
+          glyphSource.Normals->GetTuple(i, tc);
+          for (int j = 0; j < 3; j++)
+          {
+            p[j] = normalMatrix[4 * j] * tc[0] + normalMatrix[4 * j + 1] * tc[1] +
+              normalMatrix[4 * j + 2] * tc[2];
+          }
+          vtkMath::Normalize(p);
+          newNormals->SetTuple(ptIncr + i, p);
+        }
       }
-      outputPD->CopyData(pd, srcPointIdList, dstPointIdList);
-      if (this->FillCellData)
+
+      // Copy point data from source (if possible)
+      if (pd)
       {
-        for (i = 0; i < numSourceCells; ++i)
+        for (vtkIdType i = 0; i < numSourcePts; ++i)
         {
-          srcCellIdList->SetId(i, inPtId);
-          dstCellIdList->SetId(i, cellIncr + i);
+          pointArrays.Copy(inPtId, ptIncr + i);
+        }
+        if (this->FillCellData)
+        {
+          for (int type = 0; type < 4; ++type)
+          {
+            vtkIdType cellIncr = cellArrayStarts[type] + offsets.Cells[type];
+            for (vtkIdType i = 0; i < glyphSource.Counts.Cells[type]; ++i)
+            {
+              cellArrays.Copy(inPtId, cellIncr + i);
+            }
+          }
         }
-        outputCD->CopyData(pd, srcCellIdList, dstCellIdList);
       }
-    }
 
-    // If point ids are to be generated, do it here
-    if (this->GeneratePointIds)
-    {
-      for (i = 0; i < numSourcePts; i++)
+      // If point ids are to be generated, do it here
+      if (this->GeneratePointIds)
       {
-        pointIds->InsertNextValue(inPtId);
+        for (vtkIdType i = 0; i < numSourcePts; i++)
+        {
+          pointIds->SetValue(ptIncr + i, inPtId);
+        }
       }
     }
-
-    ptIncr += numSourcePts;
-    cellIncr += numSourceCells;
-  }
+  });
 
   // Update ourselves and release memory
   //
   output->SetPoints(newPts);
   newPts->Delete();
 
+  vtkNew<vtkCellArray> newCells[4];
+  for (int type = 0; type < 4; ++type)
+  {
+    newCells[type]->SetData(cellOffsets[type], cellConnectivity[type]);
+  }
+  output->SetVerts(newCells[0]);
+  output->SetLines(newCells[1]);
+  output->SetPolys(newCells[2]);
+  output->SetStrips(newCells[3]);
+
   if (newScalars)
   {
     int idx = outputPD->AddArray(newScalars);
@@ -740,8 +826,6 @@ bool vtkGlyph3D::Execute(vtkDataSet* input, vtkInformationVector* sourceVector,
   }
 
   output->Squeeze();
-  trans->Delete();
-  pts->Delete();
 
   return true;
 }
@@ -34,6 +34,11 @@
  * process includes clamping the scale value between (0,1).
  *
  * @warning
+ * The glyphs are generated in parallel with vtkSMPTools: a first pass finds
+ * the glyph of every input point and computes its location in the output,
+ * and a second pass transforms the glyphs directly into place.
+ *
+ * @warning
  * Typically this object operates on input data with scalar and/or vector
  * data. However, scalar and/or vector aren't necessary, and it can be used
  * to copy data from a single source to each point. In this case the scale
@@ -292,7 +297,9 @@ public:
 
   /**
    * This can be overwritten by subclass to return 0 when a point is
-   * blanked. Default implementation is to always return 1;
+   * blanked. Default implementation is to always return 1; Note that the
+   * glyphs are generated with vtkSMPTools, so this method is called
+   * concurrently from several threads and must be thread safe.
    */
   virtual int IsPointVisible(vtkDataSet*, vtkIdType) { return 1; }
 
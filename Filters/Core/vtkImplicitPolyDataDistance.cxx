@@ -2,19 +2,48 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkImplicitPolyDataDistance.h"
 
+#include "vtkArrayDispatch.h"
 #include "vtkCellData.h"
 #include "vtkCellLocator.h"
 #include "vtkCleanPolyData.h"
+#include "vtkDataArrayRange.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkTriangleFilter.h"
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkImplicitPolyDataDistance);
 
+namespace
+{
+struct DistanceFunctionWorker
+{
+  vtkImplicitPolyDataDistance* Self;
+
+  template <typename InputArrayType, typename OutputArrayType>
+  void operator()(InputArrayType* input, OutputArrayType* output)
+  {
+    const auto srcTuples = vtk::DataArrayTupleRange<3>(input);
+    auto dstValues = vtk::DataArrayValueRange<1>(output);
+    using DstValueT = typename decltype(dstValues)::ValueType;
+
+    vtkImplicitPolyDataDistance* self = this->Self;
+    vtkSMPTools::For(0, input->GetNumberOfTuples(), [&](vtkIdType begin, vtkIdType end) {
+      double tuple[3];
+      for (vtkIdType pointId = begin; pointId < end; ++pointId)
+      {
+        srcTuples.GetTuple(pointId, tuple);
+        dstValues[pointId] = static_cast<DstValueT>(self->EvaluateFunction(tuple));
+      }
+    });
+  }
+};
+} // end anon namespace
+
 //------------------------------------------------------------------------------
 vtkImplicitPolyDataDistance::vtkImplicitPolyDataDistance()
 {
@@ -113,6 +142,35 @@ double vtkImplicitPolyDataDistance::EvaluateFunction(double x[3])
     x, g, p); // get distance value returned, normal and closest point not used
 }
 
+//------------------------------------------------------------------------------
+void vtkImplicitPolyDataDistance::EvaluateFunction(vtkDataArray* input, vtkDataArray* output)
+{
+  output->SetNumberOfComponents(1);
+  output->SetNumberOfTuples(input->GetNumberOfTuples());
+
+  if (this->Input == nullptr || this->Input->GetNumberOfCells() == 0)
+  {
+    vtkErrorMacro(<< "No polygons to evaluate function!");
+    output->Fill(this->NoValue);
+    return;
+  }
+
+  // Rebuild the locator here if the input changed, so that the parallel
+  // queries below only read it.
+  this->Locator->BuildLocator();
+
+  DistanceFunctionWorker worker{ this };
+  typedef vtkTypeList::Create<float, double> InputTypes;
+  typedef vtkTypeList::Create<float, double> OutputTypes;
+  typedef vtkArrayDispatch::Dispatch2ByValueTypeUsingArrays<vtkArrayDispatch::AllArrays, InputTypes,
+    OutputTypes>
+    MyDispatch;
+  if (!MyDispatch::Execute(input, output, worker))
+  {
+    worker(input, output); // Use vtkDataArray API if dispatch fails.
+  }
+}
+
 //------------------------------------------------------------------------------
 double vtkImplicitPolyDataDistance::EvaluateFunctionAndGetClosestPoint(
   double x[3], double closestPoint[3])
@@ -49,11 +49,16 @@ public:
    */
   vtkMTimeType GetMTime() override;
 
+  ///@{
   /**
-   * Evaluate plane equation of nearest triangle to point x[3].
+   * Evaluate plane equation of nearest triangle to point x[3]. The batch
+   * evaluation makes sure the locator is up to date, then evaluates the points
+   * in parallel with the thread safe locator queries.
    */
   using vtkImplicitFunction::EvaluateFunction;
+  void EvaluateFunction(vtkDataArray* input, vtkDataArray* output) override;
   double EvaluateFunction(double x[3]) override;
+  ///@}
 
   /**
    * Evaluate function gradient of nearest triangle to point x[3].
@@ -20,7 +20,9 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 #include "vtkShortArray.h"
+#include "vtkStaticEdgeLocatorTemplate.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStructuredPoints.h"
 #include "vtkUnsignedCharArray.h"
@@ -28,6 +30,10 @@
 #include "vtkUnsignedLongArray.h"
 #include "vtkUnsignedShortArray.h"
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkMarchingCubes);
 
@@ -41,6 +47,7 @@ vtkMarchingCubes::vtkMarchingCubes()
   this->ComputeGradients = 0;
   this->ComputeScalars = 1;
   this->Locator = nullptr;
+  this->SlabSize = 0;
 }
 
 vtkMarchingCubes::~vtkMarchingCubes()
@@ -149,7 +156,7 @@ void vtkMarchingCubesComputePointGradient(
 struct ComputeGradientWorker
 {
   template <class ScalarArrayT>
-  void operator()(ScalarArrayT* scalarsArray, vtkMarchingCubes* self, int dims[3],
+  void operator()(ScalarArrayT* scalarsArray, vtkMarchingCubes* self, int dims[3], int extent[6],
     vtkIncrementalPointLocator* locator, vtkDataArray* newScalars, vtkDataArray* newGradients,
     vtkDataArray* newNormals, vtkCellArray* newPolys, double* values, vtkIdType numValues) const
   {
@@ -168,15 +175,11 @@ struct ComputeGradientWorker
     vtkTypeBool ComputeGradients = newGradients != nullptr;
     vtkTypeBool ComputeScalars = newScalars != nullptr;
     int NeedGradients;
-    int extent[6];
     double t, *x1, *x2, x[3], *n1, *n2, n[3], min, max;
     double pts[8][3], gradients[8][3], xp, yp, zp;
     static int edges[12][2] = { { 0, 1 }, { 1, 2 }, { 3, 2 }, { 0, 3 }, { 4, 5 }, { 5, 6 },
       { 7, 6 }, { 4, 7 }, { 0, 4 }, { 1, 5 }, { 3, 7 }, { 2, 6 } };
 
-    vtkInformation* inInfo = self->GetExecutive()->GetInputInformation(0, 0);
-    inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), extent);
-
     triCases = vtkMarchingCubesTriangleCases::GetCases();
 
     //
@@ -362,6 +365,353 @@ struct ComputeGradientWorker
   }
 };
 
+// Threaded implementation, used when points are merged with vtkMergePoints.
+// The voxels are visited slab by slab. Within a slab, the voxel layers are
+// processed in parallel, each layer recording the vertices of its triangles
+// in the order of the serial traversal. The recorded vertices are then merged
+// with vtkStaticEdgeLocatorTemplate, and point ids are given in the order of
+// the first occurrence of each point, so the output matches the one of the
+// serial implementation.
+
+// Axis of each voxel edge (the edges are oriented towards increasing indices).
+const int EdgeAxes[12] = { 0, 1, 0, 1, 0, 1, 0, 1, 2, 2, 2, 2 };
+
+// The vertex of a generated triangle. (V0,V1) is the voxel edge it lies on
+// and T its parametric coordinate along the edge. Points are merged like
+// vtkMergePoints does, i.e. when their single precision coordinates are
+// equal: a point coinciding with an end of its edge is identified by the
+// vertex (Key0 = 4 * vertex + 3, Key1 = 0), other points by their edge and
+// coordinate along the edge (Key0 = 4 * V0 + axis, Key1 = coordinate bits).
+struct MarchingCubesTriangleVertex
+{
+  vtkTypeInt64 Key0;
+  vtkTypeInt64 Key1;
+  vtkIdType V0;
+  vtkIdType V1;
+  double T;
+  int Contour;
+};
+
+using MarchingCubesMerger = vtkStaticEdgeLocatorTemplate<vtkTypeInt64, vtkIdType>;
+using MarchingCubesKey = MarchingCubesMerger::EdgeTupleType;
+
+// Make sure an array has room for numTuples tuples, growing its storage
+// geometrically as the slabs are appended.
+void GrowTuples(vtkDataArray* array, vtkIdType numTuples)
+{
+  if (array && numTuples > array->GetNumberOfTuples())
+  {
+    if (numTuples * array->GetNumberOfComponents() > array->GetSize())
+    {
+      array->Resize(std::max(numTuples, 2 * array->GetNumberOfTuples()));
+    }
+    array->SetNumberOfTuples(numTuples);
+  }
+}
+
+struct ThreadedMarchingCubesWorker
+{
+  template <class ScalarArrayT>
+  void operator()(ScalarArrayT* scalarsArray, vtkMarchingCubes* self, int dims[3],
+    int extent[6], int slabSize, vtkPoints* newPts, vtkDataArray* newScalars,
+    vtkDataArray* newGradients, vtkDataArray* newNormals, vtkCellArray* newPolys,
+    double* values, vtkIdType numValues) const
+  {
+    const auto scalars = vtk::DataArrayValueRange<1>(scalarsArray);
+    if (numValues < 1)
+    {
+      return;
+    }
+    const double min = *std::min_element(values, values + numValues);
+    const double max = *std::max_element(values, values + numValues);
+    const bool needGradients = newGradients || newNormals;
+    const vtkIdType sliceSize = static_cast<vtkIdType>(dims[0]) * dims[1];
+    const vtkIdType vertOffsets[8] = { 0, 1, 1 + dims[0], dims[0], sliceSize, 1 + sliceSize,
+      1 + dims[0] + sliceSize, dims[0] + sliceSize };
+    static const int edges[12][2] = { { 0, 1 }, { 1, 2 }, { 3, 2 }, { 0, 3 }, { 4, 5 },
+      { 5, 6 }, { 7, 6 }, { 4, 7 }, { 0, 4 }, { 1, 5 }, { 3, 7 }, { 2, 6 } };
+    vtkMarchingCubesTriangleCases* triCases = vtkMarchingCubesTriangleCases::GetCases();
+
+    // Index space coordinates of a point of the volume.
+    auto pointCoordinates = [&](vtkIdType ptId, double x[3]) {
+      x[0] = ptId % dims[0] + extent[0];
+      x[1] = (ptId / dims[0]) % dims[1] + extent[2];
+      x[2] = ptId / sliceSize + extent[4];
+    };
+    // Whether a merging key designates a point lying in the kth point slice.
+    auto inSlice = [&](const MarchingCubesKey& key, vtkIdType k) {
+      return (key.V0 >> 2) / sliceSize == k && (key.V0 & 3) != 2;
+    };
+
+    const int numLayers = dims[2] - 1;
+    if (slabSize <= 0 || slabSize > numLayers)
+    {
+      slabSize = numLayers;
+    }
+
+    // Keys and ids of the points of the last processed slab lying on its top
+    // slice, sorted by key, so that the next slab reuses them.
+    std::vector<MarchingCubesKey> sharedPoints;
+    vtkIdType numPts = 0;
+    for (int slabBegin = 0; slabBegin < numLayers && !self->GetAbortOutput();
+         slabBegin += slabSize)
+    {
+      self->UpdateProgress(slabBegin / static_cast<double>(numLayers));
+      const int slabEnd = std::min(slabBegin + slabSize, numLayers);
+
+      // Record the triangle vertices of each voxel layer of the slab.
+      std::vector<std::vector<MarchingCubesTriangleVertex>> layers(slabEnd - slabBegin);
+      vtkSMPTools::For(slabBegin, slabEnd, 1, [&](vtkIdType kBegin, vtkIdType kEnd) {
+        bool isFirst = vtkSMPTools::GetSingleThread();
+        for (vtkIdType k = kBegin; k < kEnd; ++k)
+        {
+          if (isFirst)
+          {
+            self->CheckAbort();
+          }
+          if (self->GetAbortOutput())
+          {
+            break;
+          }
+          std::vector<MarchingCubesTriangleVertex>& layer = layers[k - slabBegin];
+          double s[8], pts[8][3], x[3];
+          for (int j = 0; j < dims[1] - 1; ++j)
+          {
+            for (int i = 0; i < dims[0] - 1; ++i)
+            {
+              const vtkIdType idx = i + j * static_cast<vtkIdType>(dims[0]) + k * sliceSize;
+              for (int ii = 0; ii < 8; ++ii)
+              {
+                s[ii] = scalars[idx + vertOffsets[ii]];
+              }
+              if (std::all_of(s, s + 8, [min](double v) { return v < min; }) ||
+                std::all_of(s, s + 8, [max](double v) { return v > max; }))
+              {
+                continue; // no contours possible
+              }
+              for (int ii = 0; ii < 8; ++ii)
+              {
+                pointCoordinates(idx + vertOffsets[ii], pts[ii]);
+              }
+              for (int contNum = 0; contNum < numValues; ++contNum)
+              {
+                const double value = values[contNum];
+                int index = 0;
+                for (int ii = 0; ii < 8; ++ii)
+                {
+                  if (s[ii] >= value)
+                  {
+                    index |= 1 << ii;
+                  }
+                }
+                if (index == 0 || index == 255) // no surface
+                {
+                  continue;
+                }
+                for (const int* edge = triCases[index].edges; *edge > -1; ++edge)
+                {
+                  const int* vert = edges[*edge];
+                  const int axis = EdgeAxes[*edge];
+                  MarchingCubesTriangleVertex tv;
+                  tv.V0 = idx + vertOffsets[vert[0]];
+                  tv.V1 = idx + vertOffsets[vert[1]];
+                  tv.T = (value - s[vert[0]]) / (s[vert[1]] - s[vert[0]]);
+                  tv.Contour = contNum;
+                  const double* x1 = pts[vert[0]];
+                  const double* x2 = pts[vert[1]];
+                  x[axis] = x1[axis] + tv.T * (x2[axis] - x1[axis]);
+                  const float f = static_cast<float>(x[axis]);
+                  if (f == static_cast<float>(x1[axis]))
+                  {
+                    tv.Key0 = 4 * static_cast<vtkTypeInt64>(tv.V0) + 3;
+                    tv.Key1 = 0;
+                  }
+                  else if (f == static_cast<float>(x2[axis]))
+                  {
+                    tv.Key0 = 4 * static_cast<vtkTypeInt64>(tv.V1) + 3;
+                    tv.Key1 = 0;
+                  }
+                  else
+                  {
+                    vtkTypeUInt32 bits;
+                    std::memcpy(&bits, &f, sizeof(bits));
+                    tv.Key0 = 4 * static_cast<vtkTypeInt64>(tv.V0) + axis;
+                    tv.Key1 = bits;
+                  }
+                  layer.push_back(tv);
+                }
+              }
+            }
+          }
+        }
+      });
+
+      // Concatenate the layers in traversal order.
+      std::vector<vtkIdType> layerOffsets(layers.size() + 1, 0);
+      for (size_t l = 0; l < layers.size(); ++l)
+      {
+        layerOffsets[l + 1] = layerOffsets[l] + static_cast<vtkIdType>(layers[l].size());
+      }
+      const vtkIdType numVerts = layerOffsets.back();
+      std::vector<MarchingCubesTriangleVertex> verts(numVerts);
+      std::vector<MarchingCubesKey> keys(numVerts);
+      vtkSMPTools::For(0, static_cast<vtkIdType>(layers.size()), [&](vtkIdType l, vtkIdType end) {
+        for (; l < end; ++l)
+        {
+          vtkIdType vId = layerOffsets[l];
+          for (const MarchingCubesTriangleVertex& tv : layers[l])
+          {
+            keys[vId].V0 = tv.Key0;
+            keys[vId].V1 = tv.Key1;
+            keys[vId].Data = vId;
+            verts[vId++] = tv;
+          }
+          std::vector<MarchingCubesTriangleVertex>().swap(layers[l]);
+        }
+      });
+
+      // Group identical points. A group is a new point unless it was shared
+      // with the previous slab; new points are numbered by first occurrence.
+      MarchingCubesMerger merger;
+      vtkIdType numGroups;
+      const vtkTypeInt64* groups = merger.MergeEdges(numVerts, keys.data(), numGroups);
+      std::vector<vtkIdType> groupIds(numGroups);
+      std::vector<unsigned char> isNew(numVerts, 0);
+      vtkSMPTools::For(0, numGroups, [&](vtkIdType group, vtkIdType endGroup) {
+        for (; group < endGroup; ++group)
+        {
+          const MarchingCubesKey* first = keys.data() + groups[group];
+          const MarchingCubesKey* last = keys.data() + groups[group + 1];
+          groupIds[group] = -1;
+          if (inSlice(*first, slabBegin))
+          {
+            auto shared = std::lower_bound(sharedPoints.begin(), sharedPoints.end(), *first);
+            if (shared != sharedPoints.end() && *shared == *first)
+            {
+              groupIds[group] = shared->Data;
+            }
+          }
+          if (groupIds[group] < 0)
+          {
+            vtkIdType firstOccurrence = first->Data;
+            for (; first < last; ++first)
+            {
+              firstOccurrence = std::min(firstOccurrence, first->Data);
+            }
+            isNew[firstOccurrence] = 1;
+          }
+        }
+      });
+      std::vector<vtkIdType> ptIds(numVerts);
+      for (vtkIdType vId = 0; vId < numVerts; ++vId)
+      {
+        if (isNew[vId])
+        {
+          ptIds[vId] = numPts++;
+        }
+      }
+      vtkSMPTools::For(0, numGroups, [&](vtkIdType group, vtkIdType endGroup) {
+        for (; group < endGroup; ++group)
+        {
+          vtkIdType ptId = groupIds[group];
+          if (ptId < 0)
+          {
+            for (vtkIdType vId = groups[group]; vId < groups[group + 1]; ++vId)
+            {
+              if (isNew[keys[vId].Data])
+              {
+                ptId = ptIds[keys[vId].Data];
+                break;
+              }
+            }
+          }
+          for (vtkIdType vId = groups[group]; vId < groups[group + 1]; ++vId)
+          {
+            ptIds[keys[vId].Data] = ptId;
+          }
+          groupIds[group] = ptId;
+        }
+      });
+
+      // Generate the new points and their attributes.
+      GrowTuples(newPts->GetData(), numPts);
+      GrowTuples(newScalars, numPts);
+      GrowTuples(newGradients, numPts);
+      GrowTuples(newNormals, numPts);
+      vtkSMPTools::For(0, numVerts, [&](vtkIdType vId, vtkIdType end) {
+        double x1[3], x2[3], x[3], n1[3], n2[3], n[3];
+        for (; vId < end; ++vId)
+        {
+          if (!isNew[vId])
+          {
+            continue;
+          }
+          const MarchingCubesTriangleVertex& tv = verts[vId];
+          const vtkIdType ptId = ptIds[vId];
+          const double t = tv.T;
+          pointCoordinates(tv.V0, x1);
+          pointCoordinates(tv.V1, x2);
+          for (int c = 0; c < 3; ++c)
+          {
+            x[c] = x1[c] + t * (x2[c] - x1[c]);
+          }
+          newPts->SetPoint(ptId, x);
+          if (needGradients)
+          {
+            vtkMarchingCubesComputePointGradient(static_cast<int>(x1[0] - extent[0]),
+              static_cast<int>(x1[1] - extent[2]), static_cast<int>(x1[2] - extent[4]), scalars,
+              dims, sliceSize, n1);
+            vtkMarchingCubesComputePointGradient(static_cast<int>(x2[0] - extent[0]),
+              static_cast<int>(x2[1] - extent[2]), static_cast<int>(x2[2] - extent[4]), scalars,
+              dims, sliceSize, n2);
+            for (int c = 0; c < 3; ++c)
+            {
+              n[c] = n1[c] + t * (n2[c] - n1[c]);
+            }
+          }
+          if (newScalars)
+          {
+            newScalars->SetTuple(ptId, values + tv.Contour);
+          }
+          if (newGradients)
+          {
+            newGradients->SetTuple(ptId, n);
+          }
+          if (newNormals)
+          {
+            vtkMath::Normalize(n);
+            newNormals->SetTuple(ptId, n);
+          }
+        }
+      });
+
+      // Append the triangles, skipping the degenerate ones.
+      for (vtkIdType vId = 0; vId < numVerts; vId += 3)
+      {
+        const vtkIdType* tri = ptIds.data() + vId;
+        if (tri[0] != tri[1] && tri[0] != tri[2] && tri[1] != tri[2])
+        {
+          newPolys->InsertNextCell(3, tri);
+        }
+      }
+
+      // Keep the points of the top slice for the next slab.
+      std::vector<MarchingCubesKey> topPoints;
+      for (vtkIdType group = 0; group < numGroups; ++group)
+      {
+        MarchingCubesKey key = keys[groups[group]];
+        if (inSlice(key, slabEnd))
+        {
+          key.Data = groupIds[group];
+          topPoints.push_back(key);
+        }
+      }
+      sharedPoints.swap(topPoints);
+    }
+    newPts->Modified();
+  }
+};
+
 } // end anon namespace
 
 //
@@ -429,8 +779,9 @@ int vtkMarchingCubes::RequestData(vtkInformation* vtkNotUsed(request),
     return 1;
   }
   input->GetDimensions(dims);
-
-  inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), extent);
+  // Use the extent of the input rather than the whole extent, so that the
+  // update extent requested downstream is contoured at the right location.
+  input->GetExtent(extent);
 
   // estimate the number of points from the volume dimensions
   estimatedSize = static_cast<vtkIdType>(pow(1.0 * dims[0] * dims[1] * dims[2], 0.75));
@@ -452,7 +803,14 @@ int vtkMarchingCubes::RequestData(vtkInformation* vtkNotUsed(request),
   {
     this->CreateDefaultLocator();
   }
-  this->Locator->InitPointInsertion(newPts, bounds, estimatedSize);
+  // The threaded implementation merges coincident points exactly like
+  // vtkMergePoints. Other locators may merge points within a tolerance, they
+  // are used by the serial implementation.
+  const bool threaded = this->Locator->IsA("vtkMergePoints") != 0;
+  if (!threaded)
+  {
+    this->Locator->InitPointInsertion(newPts, bounds, estimatedSize);
+  }
 
   if (this->ComputeNormals)
   {
@@ -490,12 +848,25 @@ int vtkMarchingCubes::RequestData(vtkInformation* vtkNotUsed(request),
   }
 
   using Dispatcher = vtkArrayDispatch::Dispatch;
-  ComputeGradientWorker worker;
-  if (!Dispatcher::Execute(inScalars, worker, this, dims, this->Locator, newScalars, newGradients,
-        newNormals, newPolys, values, numContours))
-  { // Fallback to slow path for unknown arrays:
-    worker(inScalars, this, dims, this->Locator, newScalars, newGradients, newNormals, newPolys,
-      values, numContours);
+  if (threaded)
+  {
+    ThreadedMarchingCubesWorker worker;
+    if (!Dispatcher::Execute(inScalars, worker, this, dims, extent, this->SlabSize, newPts,
+          newScalars, newGradients, newNormals, newPolys, values, numContours))
+    { // Fallback to slow path for unknown arrays:
+      worker(inScalars, this, dims, extent, this->SlabSize, newPts, newScalars, newGradients,
+        newNormals, newPolys, values, numContours);
+    }
+  }
+  else
+  {
+    ComputeGradientWorker worker;
+    if (!Dispatcher::Execute(inScalars, worker, this, dims, extent, this->Locator, newScalars,
+          newGradients, newNormals, newPolys, values, numContours))
+    { // Fallback to slow path for unknown arrays:
+      worker(inScalars, this, dims, extent, this->Locator, newScalars, newGradients, newNormals,
+        newPolys, values, numContours);
+    }
   }
 
   vtkDebugMacro(<< "Created: " << newPts->GetNumberOfPoints() << " points, "
@@ -585,6 +956,7 @@ void vtkMarchingCubes::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Compute Normals: " << (this->ComputeNormals ? "On\n" : "Off\n");
   os << indent << "Compute Gradients: " << (this->ComputeGradients ? "On\n" : "Off\n");
   os << indent << "Compute Scalars: " << (this->ComputeScalars ? "On\n" : "Off\n");
+  os << indent << "Slab Size: " << this->SlabSize << "\n";
 
   if (this->Locator)
   {
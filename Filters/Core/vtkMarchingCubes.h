@@ -15,6 +15,13 @@
  * contouring other types of data, use the general vtkContourFilter. If you
  * want to contour an image (i.e., a volume slice), use vtkMarchingSquares.
  *
+ * @warning
+ * This filter has been threaded with vtkSMPTools when points are merged with
+ * the default vtkMergePoints locator; the output is the same as the one of
+ * the serial implementation. Other locators use the serial implementation.
+ * The volume is processed by slabs of SlabSize voxel slices, which bounds the
+ * temporary memory used by the threaded implementation.
+ *
  * @sa
  * Much faster implementations for isocontouring are available. In
  * particular, vtkFlyingEdges3D and vtkFlyingEdges2D are much faster
@@ -98,6 +105,17 @@ public:
   vtkBooleanMacro(ComputeScalars, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get the number of voxel slices processed at once by the threaded
+   * implementation. The temporary memory used is proportional to the number
+   * of triangles generated in a slab, and the output does not depend on the
+   * slab size. A value of 0 (the default) processes the whole volume at once.
+   */
+  vtkSetClampMacro(SlabSize, int, 0, VTK_INT_MAX);
+  vtkGetMacro(SlabSize, int);
+  ///@}
+
   ///@{
   /**
    * override the default locator.  Useful for changing the number of
@@ -125,6 +143,7 @@ protected:
   vtkTypeBool ComputeGradients;
   vtkTypeBool ComputeScalars;
   vtkIncrementalPointLocator* Locator;
+  int SlabSize;
 
 private:
   vtkMarchingCubes(const vtkMarchingCubes&) = delete;
@@ -5,6 +5,7 @@
 #include "vtkCell.h"
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
+#include "vtkConnectivityLabelingInternal.h"
 #include "vtkFloatArray.h"
 #include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
@@ -16,6 +17,7 @@
 #include "vtkPolyData.h"
 
 #include <algorithm> // for fill_n
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkPolyDataConnectivityFilter);
@@ -118,11 +120,20 @@ int vtkPolyDataConnectivityFilter::RequestData(vtkInformation* vtkNotUsed(reques
     }
   }
 
+  // Regions that do not depend on a seed nor on the traversal order are
+  // labeled in parallel, which does not need the cell links.
+  const bool labelAllRegions = this->ExtractionMode != VTK_EXTRACT_POINT_SEEDED_REGIONS &&
+    this->ExtractionMode != VTK_EXTRACT_CELL_SEEDED_REGIONS &&
+    this->ExtractionMode != VTK_EXTRACT_CLOSEST_POINT_REGION && !this->InScalars;
+
   // Build cell structure
   //
   this->Mesh = vtkPolyData::New();
   this->Mesh->CopyStructure(input);
-  this->Mesh->BuildLinks();
+  if (!labelAllRegions)
+  {
+    this->Mesh->BuildLinks();
+  }
   this->UpdateProgress(0.10);
 
   // Remove all visited point ids
@@ -174,10 +185,29 @@ int vtkPolyDataConnectivityFilter::RequestData(vtkInformation* vtkNotUsed(reques
   this->PointIds->Allocate(8, VTK_CELL_SIZE);
   vtkIdType checkAbortInterval = 0;
 
-  if (this->ExtractionMode != VTK_EXTRACT_POINT_SEEDED_REGIONS &&
+  if (labelAllRegions)
+  { // label all regions at once
+    std::vector<vtkIdType> regionSizes;
+    this->PointNumber = LabelConnectedRegions(this, this->Mesh, this->Visited, this->PointMap,
+      vtkArrayDownCast<vtkIdTypeArray>(this->NewScalars)->GetPointer(0), regionSizes);
+    this->RegionNumber = static_cast<vtkIdType>(regionSizes.size());
+    this->RegionSizes->SetNumberOfValues(this->RegionNumber);
+    for (vtkIdType regionId = 0; regionId < this->RegionNumber; ++regionId)
+    {
+      this->RegionSizes->SetValue(regionId, regionSizes[regionId]);
+      if (regionSizes[regionId] > maxCellsInRegion)
+      {
+        maxCellsInRegion = regionSizes[regionId];
+        largestRegionId = regionId;
+      }
+    }
+    this->UpdateProgress(0.9);
+  }
+  else if (this->ExtractionMode != VTK_EXTRACT_POINT_SEEDED_REGIONS &&
     this->ExtractionMode != VTK_EXTRACT_CELL_SEEDED_REGIONS &&
     this->ExtractionMode != VTK_EXTRACT_CLOSEST_POINT_REGION)
-  { // visit all cells marking with region number
+  { // visit all cells marking with region number, the scalar criterion
+    // depends on the traversal order
     for (cellId = 0; cellId < numCells; cellId++)
     {
       if (cellId && !(cellId % 5000))
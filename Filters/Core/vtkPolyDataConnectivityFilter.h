@@ -31,6 +31,12 @@
  * This use of ScalarConnectivity is particularly useful for selecting cells
  * for later processing.
  *
+ * When the regions do not depend on seeds (largest, specified and all
+ * regions extraction modes) and ScalarConnectivity is off, the regions are
+ * labeled in parallel with a union-find over the points, which does not need
+ * the cell links. The output points are then ordered by increasing input
+ * point id instead of traversal order.
+ *
  * @sa
  * vtkConnectivityFilter
  */
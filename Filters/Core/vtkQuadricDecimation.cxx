@@ -37,12 +37,25 @@
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPriorityQueue.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 #include "vtkTriangle.h"
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+// Minimum number of triangles of the partitions of a parallel decimation.
+const vtkIdType MIN_PARTITION_SIZE = 5000;
+}
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkQuadricDecimation);
 
@@ -225,6 +238,37 @@ int vtkQuadricDecimation::RequestData(vtkInformation* vtkNotUsed(request),
   vtkPolyData* input = vtkPolyData::SafeDownCast(inInfo->Get(vtkDataObject::DATA_OBJECT()));
   vtkPolyData* output = vtkPolyData::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
 
+  // check some assumptions about the data
+  if (input->GetPolys() == nullptr || input->GetPoints() == nullptr ||
+    input->GetPointData() == nullptr || input->GetFieldData() == nullptr)
+  {
+    vtkErrorMacro("Nothing to decimate");
+    return 1;
+  }
+
+  if (input->GetPolys()->GetMaxCellSize() > 3)
+  {
+    vtkErrorMacro("Can only decimate triangles");
+    return 1;
+  }
+
+  vtkIdType numPartitions = this->NumberOfPartitions > 0
+    ? this->NumberOfPartitions
+    : vtkSMPTools::GetEstimatedNumberOfThreads();
+  numPartitions = std::min(numPartitions, input->GetNumberOfPolys() / MIN_PARTITION_SIZE);
+  if (numPartitions > 1)
+  {
+    return this->ParallelDecimate(input, output, static_cast<int>(numPartitions));
+  }
+
+  this->Decimate(input, output, this->TargetReduction, nullptr, nullptr);
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkQuadricDecimation::Decimate(vtkPolyData* input, vtkPolyData* output,
+  double targetReduction, const unsigned char* lockedPoints, vtkIdList* pointMap)
+{
   vtkIdType numPts = input->GetNumberOfPoints();
   vtkIdType numTris = input->GetNumberOfPolys();
   vtkIdType edgeId, i;
@@ -240,20 +284,6 @@ int vtkQuadricDecimation::RequestData(vtkInformation* vtkNotUsed(request),
   const vtkIdType* pts;
   vtkIdType numDeletedTris = 0;
 
-  // check some assumptions about the data
-  if (input->GetPolys() == nullptr || input->GetPoints() == nullptr ||
-    input->GetPointData() == nullptr || input->GetFieldData() == nullptr)
-  {
-    vtkErrorMacro("Nothing to decimate");
-    return 1;
-  }
-
-  if (input->GetPolys()->GetMaxCellSize() > 3)
-  {
-    vtkErrorMacro("Can only decimate triangles");
-    return 1;
-  }
-
   polys = vtkCellArray::New();
   points = vtkPoints::New();
   outputCellList = vtkIdList::New();
@@ -272,6 +302,7 @@ int vtkQuadricDecimation::RequestData(vtkInformation* vtkNotUsed(request),
   }
   this->Mesh->GetFieldData()->PassData(input->GetFieldData());
   this->Mesh->BuildCells();
+  this->Mesh->EditableOn();
   this->Mesh->BuildLinks();
 
   this->ErrorQuadrics = new vtkQuadricDecimation::ErrorQuadric[numPts];
@@ -347,7 +378,12 @@ int vtkQuadricDecimation::RequestData(vtkInformation* vtkNotUsed(request),
     {
       cost = this->ComputeCost(i, x);
     }
-    this->EdgeCosts->Insert(cost, i);
+    // edges using a locked point are never collapsed
+    if (!lockedPoints ||
+      !(lockedPoints[this->EndPoint1List->GetId(i)] || lockedPoints[this->EndPoint2List->GetId(i)]))
+    {
+      this->EdgeCosts->Insert(cost, i);
+    }
     this->TargetPoints->InsertTuple(i, x);
   }
   this->UpdateProgress(0.20);
@@ -359,7 +395,7 @@ int vtkQuadricDecimation::RequestData(vtkInformation* vtkNotUsed(request),
 
   bool abort = false;
   while (
-    !abort && edgeId >= 0 && cost < VTK_DOUBLE_MAX && this->ActualReduction < this->TargetReduction)
+    !abort && edgeId >= 0 && cost < VTK_DOUBLE_MAX && this->ActualReduction < targetReduction)
   {
     if (!(this->NumberOfEdgeCollapses % 10000))
     {
@@ -370,6 +406,12 @@ int vtkQuadricDecimation::RequestData(vtkInformation* vtkNotUsed(request),
 
     endPtIds[0] = this->EndPoint1List->GetId(edgeId);
     endPtIds[1] = this->EndPoint2List->GetId(edgeId);
+    if (lockedPoints && (lockedPoints[endPtIds[0]] || lockedPoints[endPtIds[1]]))
+    {
+      // the edge now uses a locked point after the collapse of a neighbor edge
+      edgeId = this->EdgeCosts->Pop(0, cost);
+      continue;
+    }
     this->TargetPoints->GetTuple(edgeId, x);
 
     // check for a poorly placed point
@@ -435,6 +477,25 @@ int vtkQuadricDecimation::RequestData(vtkInformation* vtkNotUsed(request),
   output->GetPointData()->CopyAllocate(this->Mesh->GetPointData(), 1);
   output->CopyCells(this->Mesh, outputCellList);
 
+  if (pointMap)
+  {
+    // CopyCells numbers the points in the order the output cells use them
+    pointMap->SetNumberOfIds(numPts);
+    pointMap->Fill(-1);
+    vtkIdType numOutputPts = 0;
+    for (i = 0; i < outputCellList->GetNumberOfIds(); i++)
+    {
+      this->Mesh->GetCellPoints(outputCellList->GetId(i), npts, pts);
+      for (j = 0; j < npts; j++)
+      {
+        if (pointMap->GetId(pts[j]) < 0)
+        {
+          pointMap->SetId(pts[j], numOutputPts++);
+        }
+      }
+    }
+  }
+
   this->Mesh->DeleteLinks();
   this->Mesh->Delete();
   outputCellList->Delete();
@@ -451,6 +512,335 @@ int vtkQuadricDecimation::RequestData(vtkInformation* vtkNotUsed(request),
     }
     // might want to add clamping texture coordinates??
   }
+}
+
+//------------------------------------------------------------------------------
+int vtkQuadricDecimation::ParallelDecimate(
+  vtkPolyData* input, vtkPolyData* output, int numberOfPartitions)
+{
+  vtkCellArray* inPolys = input->GetPolys();
+  vtkPoints* inPoints = input->GetPoints();
+  vtkPointData* inPD = input->GetPointData();
+  const vtkIdType numPts = input->GetNumberOfPoints();
+  const vtkIdType numTris = inPolys->GetNumberOfCells();
+  const bool copyPointData = this->AttributeErrorMetric || this->MapPointData;
+
+  // Partition the triangles by recursive bisection of their centroids along
+  // the largest dimension of the bounding box of the centroids.
+  vtkDebugMacro(<< "Partitioning " << numTris << " triangles");
+  std::vector<float> centroids(3 * numTris);
+  vtkSMPTools::For(0, numTris, [&](vtkIdType triId, vtkIdType endTriId) {
+    vtkNew<vtkIdList> cellIds;
+    vtkIdType npts;
+    const vtkIdType* pts;
+    double x[3];
+    for (; triId < endTriId; ++triId)
+    {
+      inPolys->GetCellAtId(triId, npts, pts, cellIds);
+      double c[3] = { 0.0, 0.0, 0.0 };
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        inPoints->GetPoint(pts[i], x);
+        c[0] += x[0];
+        c[1] += x[1];
+        c[2] += x[2];
+      }
+      for (int j = 0; j < 3; ++j)
+      {
+        centroids[3 * triId + j] = static_cast<float>(npts > 0 ? c[j] / npts : 0.0);
+      }
+    }
+  });
+
+  struct Range
+  {
+    vtkIdType Begin;
+    vtkIdType End;
+    int NumberOfPartitions;
+  };
+  std::vector<vtkIdType> triIds(numTris);
+  std::iota(triIds.begin(), triIds.end(), 0);
+  std::vector<Range> ranges(1, Range{ 0, numTris, numberOfPartitions });
+  while (static_cast<int>(ranges.size()) < numberOfPartitions)
+  {
+    std::vector<Range> splitRanges(2 * ranges.size());
+    vtkSMPTools::For(0, static_cast<vtkIdType>(ranges.size()), 1,
+      [&](vtkIdType rangeId, vtkIdType endRangeId) {
+        for (; rangeId < endRangeId; ++rangeId)
+        {
+          const Range& range = ranges[rangeId];
+          if (range.NumberOfPartitions == 1)
+          {
+            splitRanges[2 * rangeId] = range;
+            splitRanges[2 * rangeId + 1] = Range{ range.End, range.End, 0 };
+            continue;
+          }
+          float bounds[6] = { VTK_FLOAT_MAX, -VTK_FLOAT_MAX, VTK_FLOAT_MAX, -VTK_FLOAT_MAX,
+            VTK_FLOAT_MAX, -VTK_FLOAT_MAX };
+          for (vtkIdType i = range.Begin; i < range.End; ++i)
+          {
+            const float* c = centroids.data() + 3 * triIds[i];
+            for (int j = 0; j < 3; ++j)
+            {
+              bounds[2 * j] = std::min(bounds[2 * j], c[j]);
+              bounds[2 * j + 1] = std::max(bounds[2 * j + 1], c[j]);
+            }
+          }
+          int axis = 0;
+          for (int j = 1; j < 3; ++j)
+          {
+            if (bounds[2 * j + 1] - bounds[2 * j] > bounds[2 * axis + 1] - bounds[2 * axis])
+            {
+              axis = j;
+            }
+          }
+          const int numLeft = range.NumberOfPartitions / 2;
+          const vtkIdType middle =
+            range.Begin + (range.End - range.Begin) * numLeft / range.NumberOfPartitions;
+          std::nth_element(triIds.begin() + range.Begin, triIds.begin() + middle,
+            triIds.begin() + range.End, [&centroids, axis](vtkIdType a, vtkIdType b) {
+              return centroids[3 * a + axis] < centroids[3 * b + axis];
+            });
+          splitRanges[2 * rangeId] = Range{ range.Begin, middle, numLeft };
+          splitRanges[2 * rangeId + 1] =
+            Range{ middle, range.End, range.NumberOfPartitions - numLeft };
+        }
+      });
+    ranges.clear();
+    for (const Range& range : splitRanges)
+    {
+      if (range.NumberOfPartitions > 0)
+      {
+        ranges.push_back(range);
+      }
+    }
+  }
+  std::vector<float>().swap(centroids);
+  this->UpdateProgress(0.05);
+
+  // The points used by several partitions are locked: they are not moved while
+  // decimating the partitions so that the partitions still match afterwards.
+  std::vector<int> pointPartitions(numPts, -1);
+  std::vector<unsigned char> lockedPoints(numPts, 0);
+  for (int partId = 0; partId < numberOfPartitions; ++partId)
+  {
+    const vtkIdType* pts;
+    vtkIdType npts;
+    for (vtkIdType i = ranges[partId].Begin; i < ranges[partId].End; ++i)
+    {
+      inPolys->GetCellAtId(triIds[i], npts, pts);
+      for (vtkIdType j = 0; j < npts; ++j)
+      {
+        if (pointPartitions[pts[j]] < 0)
+        {
+          pointPartitions[pts[j]] = partId;
+        }
+        else if (pointPartitions[pts[j]] != partId)
+        {
+          lockedPoints[pts[j]] = 1;
+        }
+      }
+    }
+  }
+  std::vector<int>().swap(pointPartitions);
+  this->UpdateProgress(0.1);
+  if (this->CheckAbort())
+  {
+    return 1;
+  }
+
+  // Decimate the partitions concurrently.
+  struct Partition
+  {
+    vtkSmartPointer<vtkPolyData> Output;
+    // input id of each point of Output
+    std::vector<vtkIdType> InputPointIds;
+  };
+  std::vector<Partition> partitions(numberOfPartitions);
+  vtkSMPTools::For(0, numberOfPartitions, 1, [&](vtkIdType partId, vtkIdType endPartId) {
+    for (; partId < endPartId; ++partId)
+    {
+      if (this->GetAbortOutput())
+      {
+        break;
+      }
+      const Range& range = ranges[partId];
+      vtkNew<vtkIdList> cellIds;
+      vtkIdType npts;
+      const vtkIdType* pts;
+
+      // gather the sorted input ids of the points of the partition
+      std::vector<vtkIdType> inputPointIds;
+      inputPointIds.reserve(3 * (range.End - range.Begin));
+      for (vtkIdType i = range.Begin; i < range.End; ++i)
+      {
+        inPolys->GetCellAtId(triIds[i], npts, pts, cellIds);
+        inputPointIds.insert(inputPointIds.end(), pts, pts + npts);
+      }
+      std::sort(inputPointIds.begin(), inputPointIds.end());
+      inputPointIds.erase(
+        std::unique(inputPointIds.begin(), inputPointIds.end()), inputPointIds.end());
+      const vtkIdType numPartPts = static_cast<vtkIdType>(inputPointIds.size());
+
+      vtkNew<vtkPolyData> mesh;
+      vtkNew<vtkPoints> points;
+      points->SetDataType(inPoints->GetDataType());
+      points->SetNumberOfPoints(numPartPts);
+      std::vector<unsigned char> partLockedPoints(numPartPts);
+      double x[3];
+      for (vtkIdType i = 0; i < numPartPts; ++i)
+      {
+        inPoints->GetPoint(inputPointIds[i], x);
+        points->SetPoint(i, x);
+        partLockedPoints[i] = lockedPoints[inputPointIds[i]];
+      }
+      mesh->SetPoints(points);
+      if (copyPointData)
+      {
+        vtkPointData* pd = mesh->GetPointData();
+        pd->CopyAllocate(inPD, numPartPts);
+        for (vtkIdType i = 0; i < numPartPts; ++i)
+        {
+          pd->CopyData(inPD, inputPointIds[i], i);
+        }
+      }
+
+      vtkNew<vtkCellArray> polys;
+      polys->AllocateExact(range.End - range.Begin, 3 * (range.End - range.Begin));
+      vtkIdType ids[3];
+      for (vtkIdType i = range.Begin; i < range.End; ++i)
+      {
+        inPolys->GetCellAtId(triIds[i], npts, pts, cellIds);
+        for (vtkIdType j = 0; j < npts; ++j)
+        {
+          ids[j] = std::lower_bound(inputPointIds.begin(), inputPointIds.end(), pts[j]) -
+            inputPointIds.begin();
+        }
+        polys->InsertNextCell(npts, ids);
+      }
+      mesh->SetPolys(polys);
+
+      vtkNew<vtkQuadricDecimation> decimator;
+      decimator->AttributeErrorMetric = this->AttributeErrorMetric;
+      decimator->VolumePreservation = this->VolumePreservation;
+      decimator->MapPointData = this->MapPointData;
+      decimator->ScalarsAttribute = this->ScalarsAttribute;
+      decimator->VectorsAttribute = this->VectorsAttribute;
+      decimator->NormalsAttribute = this->NormalsAttribute;
+      decimator->TCoordsAttribute = this->TCoordsAttribute;
+      decimator->TensorsAttribute = this->TensorsAttribute;
+      decimator->ScalarsWeight = this->ScalarsWeight;
+      decimator->VectorsWeight = this->VectorsWeight;
+      decimator->NormalsWeight = this->NormalsWeight;
+      decimator->TCoordsWeight = this->TCoordsWeight;
+      decimator->TensorsWeight = this->TensorsWeight;
+      decimator->Regularize = this->Regularize;
+      decimator->Regularization = this->Regularization;
+      decimator->WeighBoundaryConstraintsByLength = this->WeighBoundaryConstraintsByLength;
+      decimator->BoundaryWeightFactor = this->BoundaryWeightFactor;
+      if (vtkSMPTools::GetSingleThread())
+      {
+        // only the main thread forwards the abort requests
+        decimator->SetContainerAlgorithm(this);
+      }
+
+      Partition& partition = partitions[partId];
+      partition.Output = vtkSmartPointer<vtkPolyData>::New();
+      vtkNew<vtkIdList> pointMap;
+      decimator->Decimate(
+        mesh, partition.Output, this->TargetReduction, partLockedPoints.data(), pointMap);
+      partition.InputPointIds.resize(partition.Output->GetNumberOfPoints());
+      for (vtkIdType i = 0; i < numPartPts; ++i)
+      {
+        if (pointMap->GetId(i) >= 0)
+        {
+          partition.InputPointIds[pointMap->GetId(i)] = inputPointIds[i];
+        }
+      }
+    }
+  });
+  std::vector<vtkIdType>().swap(triIds);
+  this->UpdateProgress(0.8);
+  if (this->CheckAbort())
+  {
+    return 1;
+  }
+
+  // Merge the decimated partitions. The locked points are shared by the
+  // partitions and kept their input coordinates and attributes.
+  vtkDebugMacro(<< "Merging " << numberOfPartitions << " partitions");
+  vtkNew<vtkPolyData> merged;
+  vtkNew<vtkPoints> mergedPoints;
+  mergedPoints->SetDataType(inPoints->GetDataType());
+  vtkNew<vtkCellArray> mergedPolys;
+  vtkPointData* mergedPD = merged->GetPointData();
+  if (copyPointData)
+  {
+    mergedPD->CopyAllocate(inPD);
+  }
+  std::vector<vtkIdType> lockedPointIds(numPts, -1);
+  std::vector<vtkIdType> pointIds;
+  for (const Partition& partition : partitions)
+  {
+    vtkPolyData* partOutput = partition.Output;
+    const vtkIdType numPartPts = partOutput->GetNumberOfPoints();
+    pointIds.resize(numPartPts);
+    double x[3];
+    for (vtkIdType i = 0; i < numPartPts; ++i)
+    {
+      const vtkIdType inputPointId = partition.InputPointIds[i];
+      if (lockedPoints[inputPointId] && lockedPointIds[inputPointId] >= 0)
+      {
+        pointIds[i] = lockedPointIds[inputPointId];
+        continue;
+      }
+      partOutput->GetPoint(i, x);
+      pointIds[i] = mergedPoints->InsertNextPoint(x);
+      if (copyPointData)
+      {
+        mergedPD->CopyData(partOutput->GetPointData(), i, pointIds[i]);
+      }
+      if (lockedPoints[inputPointId])
+      {
+        lockedPointIds[inputPointId] = pointIds[i];
+      }
+    }
+    vtkCellArray* partPolys = partOutput->GetPolys();
+    vtkIdType npts;
+    const vtkIdType* pts;
+    vtkIdType ids[3];
+    for (partPolys->InitTraversal(); partPolys->GetNextCell(npts, pts);)
+    {
+      for (vtkIdType j = 0; j < npts; ++j)
+      {
+        ids[j] = pointIds[pts[j]];
+      }
+      mergedPolys->InsertNextCell(npts, ids);
+    }
+  }
+  partitions.clear();
+  merged->SetPoints(mergedPoints);
+  merged->SetPolys(mergedPolys);
+  merged->GetFieldData()->PassData(input->GetFieldData());
+  mergedPD->Squeeze();
+
+  // Decimate the merged mesh to remove the seams between the partitions and
+  // reach the target reduction.
+  const vtkIdType numMergedTris = merged->GetNumberOfPolys();
+  const double targetTris = (1.0 - this->TargetReduction) * numTris;
+  const double seamReduction = numMergedTris > 0 ? 1.0 - targetTris / numMergedTris : 0.0;
+  this->UpdateProgress(0.85);
+  if (seamReduction > 0.0)
+  {
+    vtkDebugMacro(<< "Decimating the seams of " << numMergedTris << " triangles");
+    this->Decimate(merged, output, seamReduction, nullptr, nullptr);
+  }
+  else
+  {
+    output->ShallowCopy(merged);
+  }
+  this->ActualReduction =
+    1.0 - static_cast<double>(output->GetNumberOfPolys()) / static_cast<double>(numTris);
 
   return 1;
 }
@@ -1547,5 +1937,6 @@ void vtkQuadricDecimation::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Normals Weight: " << this->NormalsWeight << "\n";
   os << indent << "TCoords Weight: " << this->TCoordsWeight << "\n";
   os << indent << "Tensors Weight: " << this->TensorsWeight << "\n";
+  os << indent << "Number Of Partitions: " << this->NumberOfPartitions << "\n";
 }
 VTK_ABI_NAMESPACE_END
@@ -36,6 +36,12 @@
  * Attributes" is also a good take on the subject especially as it pertains
  * to the error metric applied to attributes.
  *
+ * The mesh may be decimated in parallel by setting NumberOfPartitions. The
+ * triangles are then split into spatially coherent partitions by recursive
+ * bisection of their centroids. The partitions are decimated concurrently
+ * with their shared points locked, and a final pass over the merged mesh
+ * removes the seams between the partitions.
+ *
  * @par Thanks:
  * Thanks to Bradley Lowekamp of the National Library of Medicine/NIH for
  * contributing this class.
@@ -186,6 +192,20 @@ public:
   vtkGetMacro(TensorsWeight, double);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get the number of partitions decimated concurrently. 1 decimates the
+   * whole mesh at once with a single priority queue. 0 uses one partition per
+   * thread, as reported by vtkSMPTools::GetEstimatedNumberOfThreads(). Fewer
+   * partitions are used for small meshes. The quadrics of the final pass over
+   * the seams are computed from the decimated partitions and attributes are
+   * scaled per partition when AttributeErrorMetric is on, so the output
+   * differs slightly from the sequential decimation. Default is 1.
+   */
+  vtkSetClampMacro(NumberOfPartitions, int, 0, VTK_INT_MAX);
+  vtkGetMacro(NumberOfPartitions, int);
+  ///@}
+
   ///@{
   /**
    * Get the actual reduction. This value is only valid after the
@@ -279,6 +299,7 @@ protected:
   vtkTypeBool VolumePreservation;
 
   bool MapPointData = false;
+  int NumberOfPartitions = 1;
 
   vtkTypeBool ScalarsAttribute;
   vtkTypeBool VectorsAttribute;
@@ -331,6 +352,19 @@ protected:
   double* TempData;
 
 private:
+  /**
+   * Decimate the triangles of input into output. Edges using a point flagged
+   * in lockedPoints, if given, are not collapsed. If pointMap is given, it is
+   * filled with the output id of each input point, -1 for removed points.
+   */
+  void Decimate(vtkPolyData* input, vtkPolyData* output, double targetReduction,
+    const unsigned char* lockedPoints, vtkIdList* pointMap);
+
+  /**
+   * Decimate the partitions of input concurrently, then their seams.
+   */
+  int ParallelDecimate(vtkPolyData* input, vtkPolyData* output, int numberOfPartitions);
+
   vtkQuadricDecimation(const vtkQuadricDecimation&) = delete;
   void operator=(const vtkQuadricDecimation&) = delete;
 };
@@ -6,6 +6,7 @@
 #include "vtkCellData.h"
 #include "vtkCellLocator.h"
 #include "vtkFloatArray.h"
+#include "vtkGenericCell.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
@@ -13,11 +14,17 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTriangleFilter.h"
 
+#include <algorithm>
+#include <array>
 #include <limits>
 #include <memory>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkSmoothPolyDataFilter);
@@ -117,6 +124,7 @@ vtkSmoothPolyDataFilter::vtkSmoothPolyDataFilter()
 
   this->GenerateErrorScalars = 0;
   this->GenerateErrorVectors = 0;
+  this->SimultaneousUpdate = 0;
 
   this->OutputPointsPrecision = vtkAlgorithm::DEFAULT_PRECISION;
 
@@ -177,13 +185,16 @@ struct vtkSPDF_InternalParams
   vtkMeshVertexPtr vertexPtr;
   vtkPolyData* source;
   vtkSmoothPoints* SmoothPoints;
-  double* w;
   vtkCellLocator* cellLocator;
 };
 
+// The points are moved in place, one after the other: a point sees the new
+// position of the points moved before it in the same pass.
 template <typename T>
-void vtkSPDF_MovePoints(vtkSPDF_InternalParams<T>& params)
+void vtkSPDF_MovePointsInPlace(vtkSPDF_InternalParams<T>& params)
 {
+  std::vector<double> w(params.source ? params.source->GetMaxCellSize() : 0);
+
   int iterationNumber = 0;
   for (T maxDist = std::numeric_limits<T>::max();
        maxDist > params.conv && iterationNumber < params.numberOfIterations; ++iterationNumber)
@@ -247,7 +258,7 @@ void vtkSPDF_MovePoints(vtkSPDF_InternalParams<T>& params)
           }
 
           if (!cell ||
-            cell->EvaluatePosition(xNew, closestPt, sPtr->subId, sPtr->p, dist2, params.w) == 0)
+            cell->EvaluatePosition(xNew, closestPt, sPtr->subId, sPtr->p, dist2, w.data()) == 0)
           { // not in cell anymore
             params.cellLocator->FindClosestPoint(xNew, closestPt, sPtr->cellId, sPtr->subId, dist2);
           }
@@ -274,6 +285,139 @@ void vtkSPDF_MovePoints(vtkSPDF_InternalParams<T>& params)
   vtkDebugWithObjectMacro(params.spdf, << "Performed " << iterationNumber << " smoothing passes");
 }
 
+// The points are moved simultaneously: every pass reads the coordinates
+// produced by the previous pass and writes the new ones to a second buffer,
+// so that the points are processed concurrently and the result does not
+// depend on the number of threads.
+template <typename T>
+void vtkSPDF_MovePointsSimultaneously(vtkSPDF_InternalParams<T>& params)
+{
+  T* newPtsCoords = static_cast<T*>(params.newPts->GetVoidPointer(0));
+  std::vector<T> buffer(newPtsCoords, newPtsCoords + 3 * params.numPts);
+  T* current = newPtsCoords;
+  T* next = buffer.data();
+
+  const int maxCellSize = params.source ? params.source->GetMaxCellSize() : 0;
+  vtkSMPThreadLocalObject<vtkGenericCell> tlCell;
+  vtkSMPThreadLocal<std::vector<double>> tlWeights;
+
+  int iterationNumber = 0;
+  for (T maxDist = std::numeric_limits<T>::max();
+       maxDist > params.conv && iterationNumber < params.numberOfIterations; ++iterationNumber)
+  {
+    if (iterationNumber && !(iterationNumber % 5))
+    {
+      params.spdf->UpdateProgress(0.5 + 0.5 * iterationNumber / params.numberOfIterations);
+      if (params.spdf->CheckAbort())
+      {
+        break;
+      }
+    }
+
+    // For each non-fixed vertex of the mesh, move the point toward the mean
+    // position of its connected neighbors using the relaxation factor.
+    vtkSMPThreadLocal<T> tlMaxDist(0);
+    vtkSMPTools::For(0, params.numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+      T& localMaxDist = tlMaxDist.Local();
+      vtkGenericCell* cell = tlCell.Local();
+      std::vector<double>& weights = tlWeights.Local();
+      weights.resize(maxCellSize);
+      vtkIdType npts;
+      T dist, deltaX[3];
+      double dist2, xNew[3], closestPt[3];
+
+      for (; ptId < endPtId; ++ptId)
+      {
+        const vtkMeshVertex& vertex = params.vertexPtr[ptId];
+        const T* x = current + 3 * ptId;
+        T* xNext = next + 3 * ptId;
+        if (vertex.type == VTK_FIXED_VERTEX || !vertex.edges ||
+          (npts = vertex.edges->GetNumberOfIds()) == 0)
+        {
+          std::copy(x, x + 3, xNext);
+          continue;
+        }
+
+        // Compute the mean (cumulated) direction vector
+        deltaX[0] = deltaX[1] = deltaX[2] = 0.0;
+        const vtkIdType* edgeIdPtr = vertex.edges->GetPointer(0);
+        for (vtkIdType j = 0; j < npts; ++j)
+        {
+          for (unsigned short k = 0; k < 3; ++k)
+          {
+            deltaX[k] += current[3 * edgeIdPtr[j] + k];
+          }
+        } // for all connected points
+
+        // Move the point
+        for (unsigned short k = 0; k < 3; ++k)
+        {
+          xNext[k] = x[k] + params.factor * (deltaX[k] / npts - x[k]);
+          xNew[k] = xNext[k];
+        }
+
+        // Constrain point to surface
+        if (params.source)
+        {
+          vtkSmoothPoint* sPtr = params.SmoothPoints->GetSmoothPoint(ptId);
+          bool inCell = false;
+
+          if (sPtr->cellId >= 0) // in cell
+          {
+            params.source->GetCell(sPtr->cellId, cell);
+            inCell = cell->EvaluatePosition(
+                       xNew, closestPt, sPtr->subId, sPtr->p, dist2, weights.data()) != 0;
+          }
+
+          if (!inCell)
+          { // not in cell anymore
+            params.cellLocator->FindClosestPoint(
+              xNew, closestPt, cell, sPtr->cellId, sPtr->subId, dist2);
+          }
+          for (unsigned short k = 0; k < 3; ++k)
+          {
+            xNext[k] = static_cast<T>(closestPt[k]);
+          }
+        }
+
+        if ((dist = vtkMath::Norm(deltaX)) > localMaxDist)
+        {
+          localMaxDist = dist;
+        }
+      } // for all points
+    });
+
+    maxDist = 0.0;
+    for (T localMaxDist : tlMaxDist)
+    {
+      maxDist = std::max(maxDist, localMaxDist);
+    }
+    std::swap(current, next);
+  } // for not converged or within iteration count
+
+  if (current != newPtsCoords)
+  {
+    vtkSMPTools::For(0, params.numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+      std::copy(current + 3 * ptId, current + 3 * endPtId, newPtsCoords + 3 * ptId);
+    });
+  }
+
+  vtkDebugWithObjectMacro(params.spdf, << "Performed " << iterationNumber << " smoothing passes");
+}
+
+template <typename T>
+void vtkSPDF_MovePoints(vtkSPDF_InternalParams<T>& params)
+{
+  if (params.spdf->GetSimultaneousUpdate())
+  {
+    vtkSPDF_MovePointsSimultaneously(params);
+  }
+  else
+  {
+    vtkSPDF_MovePointsInPlace(params);
+  }
+}
+
 } // namespace
 
 //------------------------------------------------------------------------------
@@ -295,15 +439,14 @@ int vtkSmoothPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(request),
   vtkPolyData* output = vtkPolyData::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
 
   vtkIdType numPts, numCells, i, numPolys, numStrips;
-  int j, k;
+  int j;
   vtkIdType npts = 0;
   const vtkIdType* pts = nullptr;
   vtkIdType p1, p2;
   double conv;
-  double x1[3], x2[3], x3[3], l1[3], l2[3];
+  double x2[3], x3[3];
   double CosFeatureAngle; // Cosine of angle between adjacent polys
   double CosEdgeAngle;    // Cosine of angle between adjacent edges
-  double closestPt[3], dist2;
   vtkIdType numSimple = 0, numBEdges = 0, numFixed = 0, numFEdges = 0;
   vtkPolyData* Mesh;
   vtkPoints* inPts;
@@ -421,13 +564,7 @@ int vtkSmoothPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(request),
   { // build cell structure
     vtkCellArray* polys;
     vtkIdType cellId;
-    int numNei, nei, edge;
-    vtkIdType numNeiPts;
-    const vtkIdType* neiPts;
-    double normal[3], neiNormal[3];
-
-    vtkNew<vtkIdList> neighbors;
-    neighbors->Allocate(VTK_CELL_SIZE);
+    int edge;
 
     vtkNew<vtkPolyData> inMesh;
     inMesh->SetPoints(inPts);
@@ -448,73 +585,113 @@ int vtkSmoothPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(request),
     polys = Mesh->GetPolys();
     this->UpdateProgress(0.375);
 
-    checkAbortInterval = std::min(polys->GetNumberOfCells() / 10 + 1, (vtkIdType)1000);
-
-    for (cellId = 0, polys->InitTraversal(); polys->GetNextCell(npts, pts); cellId++)
-    {
-      if (cellId % checkAbortInterval == 0 && this->CheckAbort())
+    // Classify the edges of the polygons concurrently. The classification of
+    // an edge is stored at the connectivity entry of its first point, and the
+    // vertices are updated afterwards by visiting the edges in order since
+    // the result depends on the order of the cells.
+    const signed char visitedEdge = -1;
+    const vtkIdType numMeshPolys = polys->GetNumberOfCells();
+    std::vector<signed char> edgeTypes(polys->GetNumberOfConnectivityIds(), visitedEdge);
+    vtkSMPThreadLocalObject<vtkIdList> tlNeighbors;
+    vtkSMPThreadLocalObject<vtkIdList> tlPtIds;
+    vtkSMPThreadLocalObject<vtkIdList> tlNeiPtIds;
+    vtkSMPTools::For(0, numMeshPolys, [&](vtkIdType polyId, vtkIdType endPolyId) {
+      vtkIdList* neighbors = tlNeighbors.Local();
+      vtkIdList* ptIds = tlPtIds.Local();
+      vtkIdList* neiPtIds = tlNeiPtIds.Local();
+      vtkIdType ncpts, numNei, nei, numNeiPts;
+      const vtkIdType* cpts;
+      const vtkIdType* neiPts;
+      double normal[3], neiNormal[3];
+      bool isFirst = vtkSMPTools::GetSingleThread();
+      for (; polyId < endPolyId; ++polyId)
       {
-        break;
-      }
-      for (i = 0; i < npts; i++)
-      {
-        p1 = pts[i];
-        p2 = pts[(i + 1) % npts];
-
-        if (Verts[p1].edges == nullptr)
+        if (isFirst)
         {
-          Verts[p1].edges = vtkIdList::New();
-          Verts[p1].edges->Allocate(16, 6);
+          this->CheckAbort();
         }
-        if (Verts[p2].edges == nullptr)
+        if (this->GetAbortOutput())
         {
-          Verts[p2].edges = vtkIdList::New();
-          Verts[p2].edges->Allocate(16, 6);
+          break;
         }
+        polys->GetCellAtId(polyId, ncpts, cpts, ptIds);
+        signed char* cellEdgeTypes = edgeTypes.data() + polys->GetOffset(polyId);
+        for (vtkIdType k = 0; k < ncpts; k++)
+        {
+          Mesh->GetCellEdgeNeighbors(polyId, cpts[k], cpts[(k + 1) % ncpts], neighbors);
+          numNei = neighbors->GetNumberOfIds();
 
-        Mesh->GetCellEdgeNeighbors(cellId, p1, p2, neighbors);
-        numNei = neighbors->GetNumberOfIds();
+          signed char edgeType = VTK_SIMPLE_VERTEX;
+          if (numNei == 0)
+          {
+            edgeType = VTK_BOUNDARY_EDGE_VERTEX;
+          }
 
-        edge = VTK_SIMPLE_VERTEX;
-        if (numNei == 0)
-        {
-          edge = VTK_BOUNDARY_EDGE_VERTEX;
-        }
+          else if (numNei >= 2)
+          {
+            // check to make sure that this edge hasn't been marked already
+            vtkIdType n;
+            for (n = 0; n < numNei; n++)
+            {
+              if (neighbors->GetId(n) < polyId)
+              {
+                break;
+              }
+            }
+            if (n >= numNei)
+            {
+              edgeType = VTK_FEATURE_EDGE_VERTEX;
+            }
+          }
 
-        else if (numNei >= 2)
-        {
-          // check to make sure that this edge hasn't been marked already
-          for (j = 0; j < numNei; j++)
+          else if (numNei == 1 && (nei = neighbors->GetId(0)) > polyId)
           {
-            if (neighbors->GetId(j) < cellId)
+            if (this->FeatureEdgeSmoothing)
             {
-              break;
+              vtkPolygon::ComputeNormal(inPts, ncpts, cpts, normal);
+              polys->GetCellAtId(nei, numNeiPts, neiPts, neiPtIds);
+              vtkPolygon::ComputeNormal(inPts, numNeiPts, neiPts, neiNormal);
+
+              if (vtkMath::Dot(normal, neiNormal) <= CosFeatureAngle)
+              {
+                edgeType = VTK_FEATURE_EDGE_VERTEX;
+              }
             }
           }
-          if (j >= numNei)
+          else // a visited edge; skip rest of analysis
           {
-            edge = VTK_FEATURE_EDGE_VERTEX;
+            edgeType = visitedEdge;
           }
+          cellEdgeTypes[k] = edgeType;
         }
+      }
+    });
 
-        else if (numNei == 1 && (nei = neighbors->GetId(0)) > cellId)
-        {
-          if (this->FeatureEdgeSmoothing)
-          {
-            vtkPolygon::ComputeNormal(inPts, npts, pts, normal);
-            Mesh->GetCellPoints(nei, numNeiPts, neiPts);
-            vtkPolygon::ComputeNormal(inPts, numNeiPts, neiPts, neiNormal);
+    for (cellId = 0; cellId < numMeshPolys && !this->GetAbortOutput(); cellId++)
+    {
+      polys->GetCellAtId(cellId, npts, pts);
+      const signed char* cellEdgeTypes = edgeTypes.data() + polys->GetOffset(cellId);
+      for (i = 0; i < npts; i++)
+      {
+        p1 = pts[i];
+        p2 = pts[(i + 1) % npts];
 
-            if (vtkMath::Dot(normal, neiNormal) <= CosFeatureAngle)
-            {
-              edge = VTK_FEATURE_EDGE_VERTEX;
-            }
-          }
+        if (Verts[p1].edges == nullptr)
+        {
+          Verts[p1].edges = vtkIdList::New();
+          Verts[p1].edges->Allocate(16, 6);
+        }
+        if (Verts[p2].edges == nullptr)
+        {
+          Verts[p2].edges = vtkIdList::New();
+          Verts[p2].edges->Allocate(16, 6);
         }
-        else // a visited edge; skip rest of analysis
+
+        if (cellEdgeTypes[i] == visitedEdge)
         {
           continue;
         }
+        edge = cellEdgeTypes[i];
 
         if (edge && Verts[p1].type == VTK_SIMPLE_VERTEX)
         {
@@ -555,71 +732,94 @@ int vtkSmoothPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(request),
 
   this->UpdateProgress(0.50);
 
-  checkAbortInterval = std::min(numPts / 10 + 1, (vtkIdType)1000);
-
   // post-process edge vertices to make sure we can smooth them
-  for (i = 0; i < numPts; i++)
+  enum
   {
-    if (i % checkAbortInterval == 0 && this->CheckAbort())
+    SIMPLE_COUNT,
+    FIXED_COUNT,
+    FEATURE_EDGE_COUNT,
+    BOUNDARY_EDGE_COUNT
+  };
+  vtkSMPThreadLocal<std::array<vtkIdType, 4>> tlCounts(std::array<vtkIdType, 4>{});
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    std::array<vtkIdType, 4>& counts = tlCounts.Local();
+    double y1[3], y2[3], y3[3], m1[3], m2[3];
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; ptId < endPtId; ptId++)
     {
-      break;
-    }
-    if (Verts[i].type == VTK_SIMPLE_VERTEX)
-    {
-      numSimple++;
-    }
-
-    else if (Verts[i].type == VTK_FIXED_VERTEX)
-    {
-      numFixed++;
-    }
-
-    else if (Verts[i].type == VTK_FEATURE_EDGE_VERTEX || Verts[i].type == VTK_BOUNDARY_EDGE_VERTEX)
-    { // see how many edges; if two, what the angle is
-
-      if (!this->BoundarySmoothing && Verts[i].type == VTK_BOUNDARY_EDGE_VERTEX)
+      if (isFirst)
       {
-        Verts[i].type = VTK_FIXED_VERTEX;
-        numBEdges++;
+        this->CheckAbort();
       }
-
-      else if ((npts = Verts[i].edges->GetNumberOfIds()) != 2)
+      if (this->GetAbortOutput())
       {
-        Verts[i].type = VTK_FIXED_VERTEX;
-        numFixed++;
+        break;
+      }
+      vtkMeshVertex& vertex = Verts[ptId];
+      if (vertex.type == VTK_SIMPLE_VERTEX)
+      {
+        counts[SIMPLE_COUNT]++;
       }
 
-      else // check angle between edges
+      else if (vertex.type == VTK_FIXED_VERTEX)
       {
-        inPts->GetPoint(Verts[i].edges->GetId(0), x1);
-        inPts->GetPoint(i, x2);
-        inPts->GetPoint(Verts[i].edges->GetId(1), x3);
+        counts[FIXED_COUNT]++;
+      }
 
-        for (k = 0; k < 3; k++)
+      else if (vertex.type == VTK_FEATURE_EDGE_VERTEX || vertex.type == VTK_BOUNDARY_EDGE_VERTEX)
+      { // see how many edges; if two, what the angle is
+
+        if (!this->BoundarySmoothing && vertex.type == VTK_BOUNDARY_EDGE_VERTEX)
         {
-          l1[k] = x2[k] - x1[k];
-          l2[k] = x3[k] - x2[k];
+          vertex.type = VTK_FIXED_VERTEX;
+          counts[BOUNDARY_EDGE_COUNT]++;
         }
-        if (vtkMath::Normalize(l1) >= 0.0 && vtkMath::Normalize(l2) >= 0.0 &&
-          vtkMath::Dot(l1, l2) < CosEdgeAngle)
+
+        else if (vertex.edges->GetNumberOfIds() != 2)
         {
-          numFixed++;
-          Verts[i].type = VTK_FIXED_VERTEX;
+          vertex.type = VTK_FIXED_VERTEX;
+          counts[FIXED_COUNT]++;
         }
-        else
+
+        else // check angle between edges
         {
-          if (Verts[i].type == VTK_FEATURE_EDGE_VERTEX)
+          inPts->GetPoint(vertex.edges->GetId(0), y1);
+          inPts->GetPoint(ptId, y2);
+          inPts->GetPoint(vertex.edges->GetId(1), y3);
+
+          for (int n = 0; n < 3; n++)
           {
-            numFEdges++;
+            m1[n] = y2[n] - y1[n];
+            m2[n] = y3[n] - y2[n];
+          }
+          if (vtkMath::Normalize(m1) >= 0.0 && vtkMath::Normalize(m2) >= 0.0 &&
+            vtkMath::Dot(m1, m2) < CosEdgeAngle)
+          {
+            counts[FIXED_COUNT]++;
+            vertex.type = VTK_FIXED_VERTEX;
           }
           else
           {
-            numBEdges++;
+            if (vertex.type == VTK_FEATURE_EDGE_VERTEX)
+            {
+              counts[FEATURE_EDGE_COUNT]++;
+            }
+            else
+            {
+              counts[BOUNDARY_EDGE_COUNT]++;
+            }
           }
-        }
-      } // if along edge
-    }   // if edge vertex
-  }     // for all points
+        } // if along edge
+      }   // if edge vertex
+    }     // for all points
+  });
+  for (const auto& counts : tlCounts)
+  {
+    numSimple += counts[SIMPLE_COUNT];
+    numFixed += counts[FIXED_COUNT];
+    numFEdges += counts[FEATURE_EDGE_COUNT];
+    numBEdges += counts[BOUNDARY_EDGE_COUNT];
+  }
 
   vtkDebugMacro(<< "Found\n\t" << numSimple << " simple vertices\n\t" << numFEdges
                 << " feature edge vertices\n\t" << numBEdges << " boundary edge vertices\n\t"
@@ -653,39 +853,51 @@ int vtkSmoothPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(request),
 
   // If a Source is defined, we do constrained smoothing (that is, points are
   // constrained to the surface of the mesh object).
-  std::unique_ptr<double[]> w;
   vtkSmartPointer<vtkCellLocator> cellLocator;
+  vtkSMPThreadLocalObject<vtkGenericCell> tlCell;
   if (source)
   {
     this->SmoothPoints = std::unique_ptr<vtkSmoothPoints>(new vtkSmoothPoints);
-    vtkSmoothPoint* sPtr;
+    this->SmoothPoints->InsertSmoothPoint(numPts - 1);
     cellLocator.TakeReference(vtkCellLocator::New());
-    auto maxCellSize = source->GetMaxCellSize();
-    w.reset(new double[maxCellSize]);
     cellLocator->SetDataSet(source);
     cellLocator->BuildLocator();
 
-    for (i = 0; i < numPts; i++)
+    // Build the cell map of the source, which GetCell() would otherwise build
+    // lazily from within the concurrent FindClosestPoint() calls.
+    if (source->GetNumberOfCells() > 0)
     {
-      sPtr = this->SmoothPoints->InsertSmoothPoint(i);
-      cellLocator->FindClosestPoint(
-        inPts->GetPoint(i), closestPt, sPtr->cellId, sPtr->subId, dist2);
-      newPts->SetPoint(i, closestPt);
+      source->GetCell(0, tlCell.Local());
     }
+
+    vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+      vtkGenericCell* cell = tlCell.Local();
+      double x[3], closestPt[3], dist2;
+      for (; ptId < endPtId; ptId++)
+      {
+        vtkSmoothPoint* sPtr = this->SmoothPoints->GetSmoothPoint(ptId);
+        inPts->GetPoint(ptId, x);
+        cellLocator->FindClosestPoint(x, closestPt, cell, sPtr->cellId, sPtr->subId, dist2);
+        newPts->SetPoint(ptId, closestPt);
+      }
+    });
   }
   else // smooth normally
   {
-    for (i = 0; i < numPts; i++) // initialize to old coordinates
-    {
-      newPts->SetPoint(i, inPts->GetPoint(i));
-    }
+    vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+      double x[3];
+      for (; ptId < endPtId; ptId++) // initialize to old coordinates
+      {
+        inPts->GetPoint(ptId, x);
+        newPts->SetPoint(ptId, x);
+      }
+    });
   }
 
   if (newPts->GetDataType() == VTK_DOUBLE)
   {
     vtkSPDF_InternalParams<double> params = { this, this->NumberOfIterations, newPts,
-      this->RelaxationFactor, conv, numPts, Verts, source, this->SmoothPoints.get(), w.get(),
-      cellLocator };
+      this->RelaxationFactor, conv, numPts, Verts, source, this->SmoothPoints.get(), cellLocator };
 
     vtkSPDF_MovePoints(params);
   }
@@ -693,7 +905,7 @@ int vtkSmoothPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(request),
   {
     vtkSPDF_InternalParams<float> params = { this, this->NumberOfIterations, newPts,
       static_cast<float>(this->RelaxationFactor), static_cast<float>(conv), numPts, Verts, source,
-      this->SmoothPoints.get(), w.get(), cellLocator };
+      this->SmoothPoints.get(), cellLocator };
 
     vtkSPDF_MovePoints(params);
   }
@@ -710,12 +922,15 @@ int vtkSmoothPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(request),
   {
     vtkNew<vtkFloatArray> newScalars;
     newScalars->SetNumberOfTuples(numPts);
-    for (i = 0; i < numPts; i++)
-    {
-      inPts->GetPoint(i, x1);
-      newPts->GetPoint(i, x2);
-      newScalars->SetComponent(i, 0, sqrt(vtkMath::Distance2BetweenPoints(x1, x2)));
-    }
+    vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+      double y1[3], y2[3];
+      for (; ptId < endPtId; ptId++)
+      {
+        inPts->GetPoint(ptId, y1);
+        newPts->GetPoint(ptId, y2);
+        newScalars->SetValue(ptId, sqrt(vtkMath::Distance2BetweenPoints(y1, y2)));
+      }
+    });
     int idx = output->GetPointData()->AddArray(newScalars);
     output->GetPointData()->SetActiveAttribute(idx, vtkDataSetAttributes::SCALARS);
   }
@@ -725,16 +940,19 @@ int vtkSmoothPolyDataFilter::RequestData(vtkInformation* vtkNotUsed(request),
     vtkNew<vtkFloatArray> newVectors;
     newVectors->SetNumberOfComponents(3);
     newVectors->SetNumberOfTuples(numPts);
-    for (i = 0; i < numPts; i++)
-    {
-      inPts->GetPoint(i, x1);
-      newPts->GetPoint(i, x2);
-      for (j = 0; j < 3; j++)
+    vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+      double y1[3], y2[3], y3[3];
+      for (; ptId < endPtId; ptId++)
       {
-        x3[j] = x2[j] - x1[j];
+        inPts->GetPoint(ptId, y1);
+        newPts->GetPoint(ptId, y2);
+        for (int n = 0; n < 3; n++)
+        {
+          y3[n] = y2[n] - y1[n];
+        }
+        newVectors->SetTuple(ptId, y3);
       }
-      newVectors->SetTuple(i, x3);
-    }
+    });
     output->GetPointData()->SetVectors(newVectors);
   }
 
@@ -787,6 +1005,7 @@ void vtkSmoothPolyDataFilter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Boundary Smoothing: " << (this->BoundarySmoothing ? "On\n" : "Off\n");
   os << indent << "Generate Error Scalars: " << (this->GenerateErrorScalars ? "On\n" : "Off\n");
   os << indent << "Generate Error Vectors: " << (this->GenerateErrorVectors ? "On\n" : "Off\n");
+  os << indent << "Simultaneous Update: " << (this->SimultaneousUpdate ? "On\n" : "Off\n");
   if (this->GetSource())
   {
     os << indent << "Source: " << static_cast<void*>(this->GetSource()) << "\n";
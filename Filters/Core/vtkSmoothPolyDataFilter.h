@@ -20,7 +20,13 @@
  * relaxation factor is available to control the amount of displacement of
  * v).  The process repeats for each vertex. This pass over the list of
  * vertices is a single iteration. Many iterations (generally around 20 or
- * so) are repeated until the desired result is obtained.
+ * so) are repeated until the desired result is obtained. By default the
+ * vertices are moved in place one after the other, so a vertex sees the new
+ * positions of the vertices moved before it in the same iteration. When
+ * SimultaneousUpdate is on, all the vertices of an iteration are moved from
+ * the positions of the previous iteration instead, so that they are processed
+ * in parallel (using vtkSMPTools) and the result does not depend on the
+ * number of threads.
  *
  * There are some special instance variables used to control the execution
  * of this filter. (These ivars basically control what vertices can be
@@ -193,6 +199,21 @@ public:
   vtkBooleanMacro(GenerateErrorVectors, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * Turn on/off the simultaneous update of the points. When off (the
+   * default), the points of an iteration are moved in place one after the
+   * other, serially. When on, they are all moved from the positions of the
+   * previous iteration and processed in parallel, and the result does not
+   * depend on the number of threads. Both converge to similar but not
+   * identical results, and the simultaneous update needs a second copy of the
+   * points.
+   */
+  vtkSetMacro(SimultaneousUpdate, vtkTypeBool);
+  vtkGetMacro(SimultaneousUpdate, vtkTypeBool);
+  vtkBooleanMacro(SimultaneousUpdate, vtkTypeBool);
+  ///@}
+
   ///@{
   /**
    * Specify the source object which is used to constrain smoothing. The
@@ -229,6 +250,7 @@ protected:
   vtkTypeBool BoundarySmoothing;
   vtkTypeBool GenerateErrorScalars;
   vtkTypeBool GenerateErrorVectors;
+  vtkTypeBool SimultaneousUpdate;
   int OutputPointsPrecision;
 
   std::unique_ptr<vtkSmoothPoints> SmoothPoints;
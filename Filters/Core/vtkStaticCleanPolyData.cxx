@@ -4,21 +4,29 @@
 
 #include "vtkArrayDispatch.h"
 #include "vtkArrayListTemplate.h" // For processing attribute data
+#include "vtkBatch.h"
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkDataArrayRange.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMergePoints.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
 #include "vtkStaticCleanUnstructuredGrid.h"
 #include "vtkStaticPointLocator.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
 #include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkStaticCleanPolyData);
@@ -26,10 +34,458 @@ vtkStandardNewMacro(vtkStaticCleanPolyData);
 // This filter uses methods found in vtkStaticCleanUnstructuredGrid.
 using PointUses = unsigned char;
 
+namespace
+{ // anonymous
+
+// The kinds of polydata cells. Input and output cells are numbered across
+// the verts, lines, polys and strips, in this order.
+enum CellKind
+{
+  VertKind = 0,
+  LineKind = 1,
+  PolyKind = 2,
+  StripKind = 3,
+  NumberOfKinds = 4
+};
+
+// Per-batch counts of the output. After BuildOffsetsAndGetGlobalSum() these
+// become the offsets at which each batch writes its output.
+struct CleanBatchData
+{
+  vtkIdType NumberOfPoints = 0; // used with EmulateCleanPolyData only
+  vtkIdType NumberOfCells[NumberOfKinds] = { 0, 0, 0, 0 };
+  vtkIdType ConnectivitySize[NumberOfKinds] = { 0, 0, 0, 0 };
+
+  CleanBatchData& operator+=(const CleanBatchData& other)
+  {
+    this->NumberOfPoints += other.NumberOfPoints;
+    for (int kind = 0; kind < NumberOfKinds; ++kind)
+    {
+      this->NumberOfCells[kind] += other.NumberOfCells[kind];
+      this->ConnectivitySize[kind] += other.ConnectivitySize[kind];
+    }
+    return *this;
+  }
+  CleanBatchData operator+(const CleanBatchData& other) const
+  {
+    CleanBatchData result = *this;
+    result += other;
+    return result;
+  }
+};
+using CleanBatch = vtkBatch<CleanBatchData>;
+using CleanBatches = vtkBatches<CleanBatchData>;
+
+// Remove the duplicate points of a cell and decide what the cleaned cell
+// becomes. Clean() returns the kind of the output cell, or -1 if the cell is
+// discarded; the cleaned points are written in outPts. Comparing merge map
+// values rather than output point ids gives the same answer, which is what
+// allows to count the output before the points are renumbered.
+struct CellCleaner
+{
+  bool ConvertLinesToPoints;
+  bool ConvertPolysToLines;
+  bool ConvertStripsToPolys;
+  bool EmulateCleanPolyData;
+
+  int Clean(int kind, vtkIdType npts, const vtkIdType* pts, const vtkIdType* ptMap,
+    vtkIdType* outPts, vtkIdType& numOutPts) const
+  {
+    numOutPts = 0;
+    if (this->EmulateCleanPolyData)
+    {
+      // vtkCleanPolyData only removes consecutive duplicates, and leaves
+      // vertex cells untouched.
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        vtkIdType ptId = ptMap[pts[i]];
+        if (kind == VertKind || numOutPts == 0 || ptId != outPts[numOutPts - 1])
+        {
+          outPts[numOutPts++] = ptId;
+        }
+      }
+      if (((kind == PolyKind && numOutPts > 2) || (kind == StripKind && numOutPts > 1)) &&
+        outPts[0] == outPts[numOutPts - 1])
+      {
+        numOutPts--;
+      }
+    }
+    else
+    {
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        vtkIdType ptId = ptMap[pts[i]];
+        if (std::find(outPts, outPts + numOutPts, ptId) == outPts + numOutPts)
+        {
+          outPts[numOutPts++] = ptId;
+        }
+      }
+    }
+
+    // When emulating vtkCleanPolyData, cells which already had a degenerate
+    // size on input keep their reduced type.
+    const bool unchanged = this->EmulateCleanPolyData && numOutPts == npts;
+    switch (kind)
+    {
+      case VertKind:
+        return numOutPts > 0 ? VertKind : -1;
+      case LineKind:
+        if (numOutPts > 1)
+        {
+          return LineKind;
+        }
+        break;
+      case PolyKind:
+        if (numOutPts > 2)
+        {
+          return PolyKind;
+        }
+        if (numOutPts == 2 && (unchanged || this->ConvertPolysToLines))
+        {
+          return LineKind;
+        }
+        break;
+      default: // StripKind
+        if (numOutPts > 3)
+        {
+          return StripKind;
+        }
+        if (numOutPts == 3 && (unchanged || this->ConvertStripsToPolys))
+        {
+          return PolyKind;
+        }
+        if (numOutPts == 2 && (unchanged || this->ConvertPolysToLines))
+        {
+          return LineKind;
+        }
+        break;
+    }
+    return (numOutPts == 1 && (unchanged || this->ConvertLinesToPoints)) ? VertKind : -1;
+  }
+};
+
+// Common machinery to traverse the input cells by batches.
+struct CleanCellsBase
+{
+  vtkCellArray* InCells[NumberOfKinds];
+  vtkIdType CellOffsets[NumberOfKinds + 1];
+  vtkIdType ConnectivityOffsets[NumberOfKinds + 1];
+  vtkIdType MaxCellSize;
+  const CellCleaner& Cleaner;
+  CleanBatches& Batches;
+  vtkStaticCleanPolyData* Filter;
+  vtkSMPThreadLocalObject<vtkIdList> PtIds;
+  vtkSMPThreadLocal<std::vector<vtkIdType>> CellPts;
+
+  CleanCellsBase(vtkPolyData* input, const CellCleaner& cleaner, CleanBatches& batches,
+    vtkStaticCleanPolyData* filter)
+    : Cleaner(cleaner)
+    , Batches(batches)
+    , Filter(filter)
+  {
+    this->InCells[VertKind] = input->GetVerts();
+    this->InCells[LineKind] = input->GetLines();
+    this->InCells[PolyKind] = input->GetPolys();
+    this->InCells[StripKind] = input->GetStrips();
+    this->CellOffsets[0] = 0;
+    this->ConnectivityOffsets[0] = 0;
+    for (int kind = 0; kind < NumberOfKinds; ++kind)
+    {
+      this->CellOffsets[kind + 1] =
+        this->CellOffsets[kind] + this->InCells[kind]->GetNumberOfCells();
+      this->ConnectivityOffsets[kind + 1] =
+        this->ConnectivityOffsets[kind] + this->InCells[kind]->GetNumberOfConnectivityIds();
+    }
+    this->MaxCellSize = input->GetMaxCellSize();
+  }
+
+  vtkIdType GetNumberOfCells() const { return this->CellOffsets[NumberOfKinds]; }
+
+  // Invoke func(cellId, kind, npts, pts, position) on the cells of a batch,
+  // in order. position is the index of the first point of the cell in the
+  // connectivity of all the input cells.
+  template <typename TFunc>
+  void ForEachCell(const CleanBatch& batch, TFunc&& func)
+  {
+    vtkIdList* ptIds = this->PtIds.Local();
+    vtkIdType npts;
+    const vtkIdType* pts;
+    int kind = 0;
+    vtkIdType position = 0;
+    for (vtkIdType cellId = batch.BeginId; cellId < batch.EndId; ++cellId)
+    {
+      while (cellId >= this->CellOffsets[kind + 1])
+      {
+        ++kind;
+      }
+      vtkIdType localId = cellId - this->CellOffsets[kind];
+      if (cellId == batch.BeginId)
+      {
+        position = this->ConnectivityOffsets[kind] +
+          static_cast<vtkIdType>(this->InCells[kind]->GetOffsetsArray()->GetComponent(localId, 0));
+      }
+      this->InCells[kind]->GetCellAtId(localId, npts, pts, ptIds);
+      func(cellId, kind, npts, pts, position);
+      position += npts;
+    }
+  }
+
+  bool IsAborted(bool isFirst)
+  {
+    if (isFirst)
+    {
+      this->Filter->CheckAbort();
+    }
+    return this->Filter->GetAbortOutput();
+  }
+};
+
+// With EmulateCleanPolyData, output points are numbered in the order of their
+// first use by the cells. Record for every merged point the first position in
+// the input connectivity at which it is used.
+struct MarkFirstUses : public CleanCellsBase
+{
+  const vtkIdType* MergeMap;
+  std::atomic<vtkIdType>* FirstUses;
+
+  MarkFirstUses(vtkPolyData* input, const CellCleaner& cleaner, CleanBatches& batches,
+    vtkStaticCleanPolyData* filter, const vtkIdType* mergeMap, std::atomic<vtkIdType>* firstUses)
+    : CleanCellsBase(input, cleaner, batches, filter)
+    , MergeMap(mergeMap)
+    , FirstUses(firstUses)
+  {
+  }
+
+  void Initialize() {}
+
+  void operator()(vtkIdType batchId, vtkIdType endBatchId)
+  {
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; batchId < endBatchId; ++batchId)
+    {
+      if (this->IsAborted(isFirst))
+      {
+        break;
+      }
+      this->ForEachCell(this->Batches[batchId],
+        [&](vtkIdType, int, vtkIdType npts, const vtkIdType* pts, vtkIdType position) {
+          for (vtkIdType i = 0; i < npts; ++i, ++position)
+          {
+            std::atomic<vtkIdType>& firstUse = this->FirstUses[this->MergeMap[pts[i]]];
+            vtkIdType current = firstUse.load(std::memory_order_relaxed);
+            while (position < current &&
+              !firstUse.compare_exchange_weak(current, position, std::memory_order_relaxed))
+            {
+            }
+          }
+        });
+    }
+  }
+
+  void Reduce() {}
+};
+
+// Count, for each batch, the output cells and connectivity of each kind, and
+// the output points first used in the batch.
+struct CountOutput : public CleanCellsBase
+{
+  const vtkIdType* MergeMap;
+  const std::atomic<vtkIdType>* FirstUses;
+
+  CountOutput(vtkPolyData* input, const CellCleaner& cleaner, CleanBatches& batches,
+    vtkStaticCleanPolyData* filter, const vtkIdType* mergeMap,
+    const std::atomic<vtkIdType>* firstUses)
+    : CleanCellsBase(input, cleaner, batches, filter)
+    , MergeMap(mergeMap)
+    , FirstUses(firstUses)
+  {
+  }
+
+  void Initialize() { this->CellPts.Local().resize(this->MaxCellSize); }
+
+  void operator()(vtkIdType batchId, vtkIdType endBatchId)
+  {
+    vtkIdType* outPts = this->CellPts.Local().data();
+    vtkIdType numOutPts;
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; batchId < endBatchId; ++batchId)
+    {
+      if (this->IsAborted(isFirst))
+      {
+        break;
+      }
+      CleanBatch& batch = this->Batches[batchId];
+      this->ForEachCell(
+        batch, [&](vtkIdType, int kind, vtkIdType npts, const vtkIdType* pts, vtkIdType position) {
+          if (this->FirstUses)
+          {
+            for (vtkIdType i = 0; i < npts; ++i)
+            {
+              if (this->FirstUses[this->MergeMap[pts[i]]].load(std::memory_order_relaxed) ==
+                position + i)
+              {
+                batch.Data.NumberOfPoints++;
+              }
+            }
+          }
+          int outKind = this->Cleaner.Clean(kind, npts, pts, this->MergeMap, outPts, numOutPts);
+          if (outKind >= 0)
+          {
+            batch.Data.NumberOfCells[outKind]++;
+            batch.Data.ConnectivitySize[outKind] += numOutPts;
+          }
+        });
+    }
+  }
+
+  void Reduce() {}
+};
+
+// Number the output points in the order of their first use, and remember the
+// input point each output point comes from.
+struct NumberFirstUses : public CleanCellsBase
+{
+  const vtkIdType* MergeMap;
+  const std::atomic<vtkIdType>* FirstUses;
+  vtkIdType* MergedPtIds; // output id of every merged point
+  vtkIdType* SourcePtIds; // input point of every output point
+
+  NumberFirstUses(vtkPolyData* input, const CellCleaner& cleaner, CleanBatches& batches,
+    vtkStaticCleanPolyData* filter, const vtkIdType* mergeMap,
+    const std::atomic<vtkIdType>* firstUses, vtkIdType* mergedPtIds, vtkIdType* sourcePtIds)
+    : CleanCellsBase(input, cleaner, batches, filter)
+    , MergeMap(mergeMap)
+    , FirstUses(firstUses)
+    , MergedPtIds(mergedPtIds)
+    , SourcePtIds(sourcePtIds)
+  {
+  }
+
+  void Initialize() {}
+
+  void operator()(vtkIdType batchId, vtkIdType endBatchId)
+  {
+    for (; batchId < endBatchId; ++batchId)
+    {
+      const CleanBatch& batch = this->Batches[batchId];
+      vtkIdType newPtId = batch.Data.NumberOfPoints;
+      this->ForEachCell(
+        batch, [&](vtkIdType, int, vtkIdType npts, const vtkIdType* pts, vtkIdType position) {
+        for (vtkIdType i = 0; i < npts; ++i)
+        {
+          const vtkIdType mergedPtId = this->MergeMap[pts[i]];
+          if (this->FirstUses[mergedPtId].load(std::memory_order_relaxed) == position + i)
+          {
+            this->MergedPtIds[mergedPtId] = newPtId;
+            this->SourcePtIds[newPtId++] = pts[i];
+          }
+        }
+      });
+    }
+  }
+
+  void Reduce() {}
+};
+
+// Write the cleaned cells and their cell data at the offsets of their batch.
+struct GenerateCells : public CleanCellsBase
+{
+  const vtkIdType* PtMap;
+  vtkIdType* Offsets[NumberOfKinds];
+  vtkIdType* Connectivity[NumberOfKinds];
+  vtkIdType OutCellOffsets[NumberOfKinds];
+  ArrayList* CellArrays;
+
+  GenerateCells(vtkPolyData* input, const CellCleaner& cleaner, CleanBatches& batches,
+    vtkStaticCleanPolyData* filter, const vtkIdType* ptMap, vtkIdTypeArray* offsets[NumberOfKinds],
+    vtkIdTypeArray* connectivity[NumberOfKinds], const CleanBatchData& totals,
+    ArrayList* cellArrays)
+    : CleanCellsBase(input, cleaner, batches, filter)
+    , PtMap(ptMap)
+    , CellArrays(cellArrays)
+  {
+    vtkIdType outCellOffset = 0;
+    for (int kind = 0; kind < NumberOfKinds; ++kind)
+    {
+      this->Offsets[kind] = offsets[kind]->GetPointer(0);
+      this->Connectivity[kind] = connectivity[kind]->GetPointer(0);
+      this->OutCellOffsets[kind] = outCellOffset;
+      outCellOffset += totals.NumberOfCells[kind];
+    }
+  }
+
+  void Initialize() { this->CellPts.Local().resize(this->MaxCellSize); }
+
+  void operator()(vtkIdType batchId, vtkIdType endBatchId)
+  {
+    vtkIdType* outPts = this->CellPts.Local().data();
+    vtkIdType numOutPts;
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; batchId < endBatchId; ++batchId)
+    {
+      if (this->IsAborted(isFirst))
+      {
+        break;
+      }
+      const CleanBatch& batch = this->Batches[batchId];
+      CleanBatchData offsets = batch.Data;
+      this->ForEachCell(
+        batch, [&](vtkIdType cellId, int kind, vtkIdType npts, const vtkIdType* pts, vtkIdType) {
+          int outKind = this->Cleaner.Clean(kind, npts, pts, this->PtMap, outPts, numOutPts);
+          if (outKind < 0)
+          {
+            return;
+          }
+          vtkIdType& outCellId = offsets.NumberOfCells[outKind];
+          vtkIdType& connOffset = offsets.ConnectivitySize[outKind];
+          this->Offsets[outKind][outCellId] = connOffset;
+          std::copy_n(outPts, numOutPts, this->Connectivity[outKind] + connOffset);
+          this->CellArrays->Copy(cellId, this->OutCellOffsets[outKind] + outCellId);
+          outCellId++;
+          connOffset += numOutPts;
+        });
+    }
+  }
+
+  void Reduce() {}
+};
+
+// Copy the coordinates and point data of the input point each output point
+// comes from.
+struct CopySourcePointsWorker
+{
+  template <typename InArrayT, typename OutArrayT>
+  void operator()(InArrayT* inPts, OutArrayT* outPts, const vtkIdType* sourcePtIds,
+    vtkPointData* inPD, vtkPointData* outPD)
+  {
+    using OutValueT = vtk::GetAPIType<OutArrayT>;
+    const vtkIdType numNewPts = outPts->GetNumberOfTuples();
+    ArrayList arrays;
+    arrays.AddArrays(numNewPts, inPD, outPD, 0.0, false);
+
+    vtkSMPTools::For(0, numNewPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+      const auto inPoints = vtk::DataArrayTupleRange<3>(inPts);
+      auto outPoints = vtk::DataArrayTupleRange<3>(outPts);
+      arrays.CopyTuples(endPtId - ptId, sourcePtIds + ptId, ptId);
+      for (; ptId < endPtId; ++ptId)
+      {
+        const auto inP = inPoints[sourcePtIds[ptId]];
+        auto outP = outPoints[ptId];
+        outP[0] = static_cast<OutValueT>(inP[0]);
+        outP[1] = static_cast<OutValueT>(inP[1]);
+        outP[2] = static_cast<OutValueT>(inP[2]);
+      }
+    });
+  }
+};
+
+} // anonymous namespace
+
 //------------------------------------------------------------------------------
 // Construct object with initial Tolerance of 0.0
 vtkStaticCleanPolyData::vtkStaticCleanPolyData()
 {
+  this->PointMerging = true;
   this->ToleranceIsAbsolute = false;
   this->Tolerance = 0.0;
   this->AbsoluteTolerance = 0.0;
@@ -44,6 +500,7 @@ vtkStaticCleanPolyData::vtkStaticCleanPolyData()
   this->RemoveUnusedPoints = true;
   this->ProduceMergeMap = false;
   this->AveragePointData = false;
+  this->EmulateCleanPolyData = false;
   this->OutputPointsPrecision = vtkAlgorithm::DEFAULT_PRECISION;
   this->PieceInvariant = true;
 
@@ -107,69 +564,80 @@ int vtkStaticCleanPolyData::RequestData(vtkInformation* vtkNotUsed(request),
     return 1;
   }
 
-  // we'll be needing these
-  vtkIdType newId;
-  vtkIdType i;
-  vtkIdType ptId;
-  vtkIdType npts = 0;
-  const vtkIdType* pts = nullptr;
-
-  vtkCellArray* inVerts = input->GetVerts();
-  vtkSmartPointer<vtkCellArray> newVerts;
-  vtkCellArray* inLines = input->GetLines();
-  vtkSmartPointer<vtkCellArray> newLines;
-  vtkCellArray* inPolys = input->GetPolys();
-  vtkSmartPointer<vtkCellArray> newPolys;
-  vtkCellArray* inStrips = input->GetStrips();
-  vtkSmartPointer<vtkCellArray> newStrips;
-
   vtkPointData* inPD = input->GetPointData();
   vtkCellData* inCD = input->GetCellData();
   vtkPointData* outPD = output->GetPointData();
   vtkCellData* outCD = output->GetCellData();
 
-  // The merge map indicates which points are merged with what points
-  this->Locator->SetDataSet(input);
-  this->Locator->BuildLocator();
-  this->UpdateProgress(0.25);
-
   // Compute the tolerance
   double tol =
     (this->ToleranceIsAbsolute ? this->AbsoluteTolerance : this->Tolerance * input->GetLength());
 
-  // Now merge the points to create a merge map. The order of traversal can
-  // be specified through the locator, the default is BIN_ORDER when the
-  // tolerance is non-zero. Also, check whether merging data is enabled.
+  // The merge map indicates which points are merged with what points. Without
+  // point merging, every point is only merged with itself.
   std::vector<vtkIdType> mergeMap(numPts);
-  vtkDataArray* mergingData = nullptr;
-  if (this->MergingArray)
+  if (this->PointMerging)
   {
-    if ((mergingData = inPD->GetArray(this->MergingArray)))
+    this->Locator->SetDataSet(input);
+    this->Locator->BuildLocator();
+    this->UpdateProgress(0.25);
+
+    // Now merge the points to create a merge map. The order of traversal can
+    // be specified through the locator, the default is BIN_ORDER when the
+    // tolerance is non-zero. Also, check whether merging data is enabled.
+    vtkDataArray* mergingData = nullptr;
+    if (this->MergingArray)
+    {
+      if ((mergingData = inPD->GetArray(this->MergingArray)))
+      {
+        this->Locator->MergePointsWithData(mergingData, mergeMap.data());
+      }
+    }
+    if (!mergingData)
     {
-      this->Locator->MergePointsWithData(mergingData, mergeMap.data());
+      this->Locator->MergePoints(tol, mergeMap.data());
     }
   }
-  if (!mergingData)
+  else
   {
-    this->Locator->MergePoints(tol, mergeMap.data());
+    vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+      for (; ptId < endPtId; ++ptId)
+      {
+        mergeMap[ptId] = ptId;
+      }
+    });
   }
   this->UpdateProgress(0.5);
 
-  // If removing unused points, traverse the connectivity array to mark the
-  // points that are used by one or more cells. This requires processing all
-  // for input arrays.
-  std::unique_ptr<PointUses[]> uPtUses; // reference counted to prevent leakage
-  PointUses* ptUses = nullptr;
-  if (this->RemoveUnusedPoints)
+  // The cells are processed in batches: a first pass counts the output of
+  // each batch, the counts are turned into offsets, and a second pass writes
+  // the output cells in place. Cells keep the order of the input within each
+  // output cell array.
+  CellCleaner cleaner{ this->ConvertLinesToPoints, this->ConvertPolysToLines,
+    this->ConvertStripsToPolys, this->EmulateCleanPolyData };
+  CleanBatches batches;
+  CountOutput countOutput(input, cleaner, batches, this, mergeMap.data(), nullptr);
+  const vtkIdType numCells = countOutput.GetNumberOfCells();
+  batches.Initialize(numCells);
+
+  // With EmulateCleanPolyData, points are numbered by their first use.
+  std::unique_ptr<std::atomic<vtkIdType>[]> firstUses;
+  if (this->EmulateCleanPolyData)
   {
-    uPtUses = std::unique_ptr<PointUses[]>(new PointUses[numPts]);
-    ptUses = uPtUses.get();
-    std::fill_n(ptUses, numPts, 0);
-    vtkStaticCleanUnstructuredGrid::MarkPointUses(inVerts, mergeMap.data(), ptUses);
-    vtkStaticCleanUnstructuredGrid::MarkPointUses(inLines, mergeMap.data(), ptUses);
-    vtkStaticCleanUnstructuredGrid::MarkPointUses(inPolys, mergeMap.data(), ptUses);
-    vtkStaticCleanUnstructuredGrid::MarkPointUses(inStrips, mergeMap.data(), ptUses);
+    firstUses.reset(new std::atomic<vtkIdType>[numPts]);
+    vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+      for (; ptId < endPtId; ++ptId)
+      {
+        firstUses[ptId].store(VTK_ID_MAX, std::memory_order_relaxed);
+      }
+    });
+    MarkFirstUses markFirstUses(input, cleaner, batches, this, mergeMap.data(), firstUses.get());
+    vtkSMPTools::For(0, batches.GetNumberOfBatches(), markFirstUses);
+    countOutput.FirstUses = firstUses.get();
   }
+  vtkSMPTools::For(0, batches.GetNumberOfBatches(), countOutput);
+  const CleanBatchData totals = batches.BuildOffsetsAndGetGlobalSum();
+  this->UpdateProgress(0.6);
 
   // Create a map that maps old point ids into new, renumbered point
   // ids.
@@ -183,8 +651,45 @@ int vtkStaticCleanPolyData::RequestData(vtkInformation* vtkNotUsed(request),
   }
 
   // Build the map from old points to new points.
-  vtkIdType numNewPts =
-    vtkStaticCleanUnstructuredGrid::BuildPointMap(numPts, pmap, ptUses, mergeMap);
+  vtkIdType numNewPts;
+  std::vector<vtkIdType> sourcePtIds;
+  if (this->EmulateCleanPolyData)
+  {
+    numNewPts = totals.NumberOfPoints;
+    sourcePtIds.resize(numNewPts);
+    std::vector<vtkIdType> mergedPtIds(numPts);
+    NumberFirstUses numberFirstUses(input, cleaner, batches, this, mergeMap.data(),
+      firstUses.get(), mergedPtIds.data(), sourcePtIds.data());
+    vtkSMPTools::For(0, batches.GetNumberOfBatches(), numberFirstUses);
+    vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+      for (; ptId < endPtId; ++ptId)
+      {
+        const vtkIdType mergedPtId = mergeMap[ptId];
+        pmap[ptId] = firstUses[mergedPtId].load(std::memory_order_relaxed) == VTK_ID_MAX
+          ? -1
+          : mergedPtIds[mergedPtId];
+      }
+    });
+  }
+  else
+  {
+    // If removing unused points, traverse the connectivity array to mark the
+    // points that are used by one or more cells. This requires processing all
+    // for input arrays.
+    std::unique_ptr<PointUses[]> uPtUses; // reference counted to prevent leakage
+    PointUses* ptUses = nullptr;
+    if (this->RemoveUnusedPoints)
+    {
+      uPtUses = std::unique_ptr<PointUses[]>(new PointUses[numPts]);
+      ptUses = uPtUses.get();
+      std::fill_n(ptUses, numPts, 0);
+      vtkStaticCleanUnstructuredGrid::MarkPointUses(input->GetVerts(), mergeMap.data(), ptUses);
+      vtkStaticCleanUnstructuredGrid::MarkPointUses(input->GetLines(), mergeMap.data(), ptUses);
+      vtkStaticCleanUnstructuredGrid::MarkPointUses(input->GetPolys(), mergeMap.data(), ptUses);
+      vtkStaticCleanUnstructuredGrid::MarkPointUses(input->GetStrips(), mergeMap.data(), ptUses);
+    }
+    numNewPts = vtkStaticCleanUnstructuredGrid::BuildPointMap(numPts, pmap, ptUses, mergeMap);
+  }
 
   // Create new points of the appropriate type
   vtkNew<vtkPoints> newPts;
@@ -211,298 +716,83 @@ int vtkStaticCleanPolyData::RequestData(vtkInformation* vtkNotUsed(request),
   {
     vtkStaticCleanUnstructuredGrid::AveragePoints(inPts, inPD, newPts, outPD, pmap, tol);
   }
-  else
+  else if (this->EmulateCleanPolyData)
   {
-    vtkStaticCleanUnstructuredGrid::CopyPoints(inPts, inPD, newPts, outPD, pmap);
+    CopySourcePointsWorker worker;
+    using Dispatcher =
+      vtkArrayDispatch::Dispatch2ByValueType<vtkArrayDispatch::Reals, vtkArrayDispatch::Reals>;
+    if (!Dispatcher::Execute(
+          inPts->GetData(), newPts->GetData(), worker, sourcePtIds.data(), inPD, outPD))
+    { // Fallback to slow path for unusual types:
+      worker(inPts->GetData(), newPts->GetData(), sourcePtIds.data(), inPD, outPD);
+    }
   }
-  this->UpdateProgress(0.6);
-
-  // Finally, remap the topology to use new point ids. Celldata needs to be
-  // copied correctly. If a poly is converted to a line, or a line to a
-  // point, then using a CellCounter will not do, as the cells should be
-  // ordered verts, lines, polys, strips. We need to maintain separate cell
-  // data lists so we can copy them all correctly. Tedious but easy to
-  // implement. We can use outCD for vertex cell data, then add the rest
-  // at the end.
-  vtkSmartPointer<vtkCellData> outLineData;
-  vtkSmartPointer<vtkCellData> outPolyData;
-  vtkSmartPointer<vtkCellData> outStrpData;
-  outCD->CopyAllocate(inCD);
-
-  // Begin to adjust topology. We need to cull out duplicate points and see
-  // what's left.  Just use a vector to keep track of unique ids - it's a
-  // small set so find() will execute relatively fast.
-  std::vector<vtkIdType> cellIds;
-  vtkIdType inCellID = 0;
-  vtkIdType progressCounter = 0;
-  vtkIdType checkAbortInterval = 0;
-
-  //
-  // Vertices are renumbered and we remove duplicates
-  if (!this->CheckAbort() && inVerts->GetNumberOfCells() > 0)
+  else
   {
-    newVerts.TakeReference(vtkCellArray::New());
-    newVerts->AllocateEstimate(inVerts->GetNumberOfCells(), 1);
-    checkAbortInterval = std::min(inVerts->GetNumberOfCells() / 10 + 1, (vtkIdType)1000);
-
-    vtkDebugMacro(<< "Starting Verts " << inCellID);
-    for (inVerts->InitTraversal(); inVerts->GetNextCell(npts, pts); inCellID++)
-    {
-      if (progressCounter % checkAbortInterval == 0 && this->CheckAbort())
-      {
-        break;
-      }
-
-      cellIds.clear();
-      for (i = 0; i < npts; i++)
-      {
-        ptId = pmap[pts[i]];
-        if (std::find(cellIds.begin(), cellIds.end(), ptId) == cellIds.end())
-        {
-          cellIds.push_back(ptId);
-        }
-      } // for all points of vertex cell
-
-      if (!cellIds.empty())
-      {
-        newId = newVerts->InsertNextCell(cellIds.size(), cellIds.data());
-        outCD->CopyData(inCD, inCellID, newId);
-      }
-    }
+    vtkStaticCleanUnstructuredGrid::CopyPoints(inPts, inPD, newPts, outPD, pmap);
   }
   this->UpdateProgress(0.7);
 
-  // lines reduced to one point are eliminated or made into verts
-  if (!this->CheckAbort() && inLines->GetNumberOfCells() > 0)
-  {
-    newLines.TakeReference(vtkCellArray::New());
-    newLines->AllocateEstimate(inLines->GetNumberOfCells(), 2);
-    outLineData.TakeReference(vtkCellData::New());
-    outLineData->CopyAllocate(inCD);
-    checkAbortInterval = std::min(inLines->GetNumberOfCells() / 10 + 1, (vtkIdType)1000);
-    progressCounter = 0;
-    //
-    vtkDebugMacro(<< "Starting Lines " << inCellID);
-    for (inLines->InitTraversal(); inLines->GetNextCell(npts, pts); inCellID++)
-    {
-      if (progressCounter % checkAbortInterval == 0 && this->CheckAbort())
-      {
-        break;
-      }
-      cellIds.clear();
-      for (i = 0; i < npts; i++)
-      {
-        ptId = pmap[pts[i]];
-        if (std::find(cellIds.begin(), cellIds.end(), ptId) == cellIds.end())
-        {
-          cellIds.push_back(ptId);
-        }
-      } // for all cell points
-
-      if (cellIds.size() > 1)
-      {
-        newId = newLines->InsertNextCell(cellIds.size(), cellIds.data());
-        outLineData->CopyData(inCD, inCellID, newId);
-      }
-      else if (cellIds.size() == 1 && this->ConvertLinesToPoints)
-      {
-        if (!newVerts)
-        {
-          newVerts.TakeReference(vtkCellArray::New());
-          newVerts->AllocateEstimate(5, 1);
-        }
-        newId = newVerts->InsertNextCell(cellIds.size(), cellIds.data());
-        outCD->CopyData(inCD, inCellID, newId);
-      }
-    }
-    vtkDebugMacro(<< "Removed " << inLines->GetNumberOfCells() - newLines->GetNumberOfCells()
-                  << " lines");
-  }
-  this->UpdateProgress(0.8);
-
-  // polygons reduced to two points or less are either eliminated
-  // or converted to lines or points if enabled
-  if (!this->CheckAbort() && inPolys->GetNumberOfCells() > 0)
+  // Finally, remap the topology to use new point ids. Degenerate cells may
+  // change kind (e.g., a poly converted to a line), so each batch writes its
+  // cells at the offsets computed for every output cell array. The cell data
+  // is ordered verts, lines, polys, strips as the output cells are.
+  vtkSmartPointer<vtkIdTypeArray> offsets[NumberOfKinds];
+  vtkSmartPointer<vtkIdTypeArray> connectivity[NumberOfKinds];
+  vtkIdTypeArray* offsetsPtrs[NumberOfKinds];
+  vtkIdTypeArray* connectivityPtrs[NumberOfKinds];
+  vtkIdType numOutCells = 0;
+  for (int kind = 0; kind < NumberOfKinds; ++kind)
   {
-    newPolys.TakeReference(vtkCellArray::New());
-    newPolys->AllocateCopy(inPolys);
-    outPolyData.TakeReference(vtkCellData::New());
-    outPolyData->CopyAllocate(inCD);
-    checkAbortInterval = std::min(inPolys->GetNumberOfCells() / 10 + 1, (vtkIdType)1000);
-    progressCounter = 0;
-
-    vtkDebugMacro(<< "Starting Polys " << inCellID);
-    for (inPolys->InitTraversal(); inPolys->GetNextCell(npts, pts); inCellID++)
-    {
-      if (progressCounter % checkAbortInterval == 0 && this->CheckAbort())
-      {
-        break;
-      }
-
-      cellIds.clear();
-      for (i = 0; i < npts; i++)
-      {
-        ptId = pmap[pts[i]];
-        if (std::find(cellIds.begin(), cellIds.end(), ptId) == cellIds.end())
-        {
-          cellIds.push_back(ptId);
-        }
-      } // for points in cell
-
-      if (cellIds.size() > 2)
-      {
-        newId = newPolys->InsertNextCell(cellIds.size(), cellIds.data());
-        outPolyData->CopyData(inCD, inCellID, newId);
-      }
-      else if (cellIds.size() == 2 && this->ConvertPolysToLines)
-      {
-        if (!newLines)
-        {
-          newLines.TakeReference(vtkCellArray::New());
-          newLines->AllocateEstimate(5, 2);
-          outLineData.TakeReference(vtkCellData::New());
-          outLineData->CopyAllocate(inCD);
-        }
-        newId = newLines->InsertNextCell(cellIds.size(), cellIds.data());
-        outLineData->CopyData(inCD, inCellID, newId);
-      }
-      else if (cellIds.size() == 1 && this->ConvertLinesToPoints)
-      {
-        if (!newVerts)
-        {
-          newVerts.TakeReference(vtkCellArray::New());
-          newVerts->AllocateEstimate(5, 1);
-        }
-        newId = newVerts->InsertNextCell(cellIds.size(), cellIds.data());
-        outCD->CopyData(inCD, inCellID, newId);
-      }
-    }
-    vtkDebugMacro(<< "Removed " << inPolys->GetNumberOfCells() - newPolys->GetNumberOfCells()
-                  << " polys");
+    offsets[kind] = vtkSmartPointer<vtkIdTypeArray>::New();
+    offsets[kind]->SetNumberOfValues(totals.NumberOfCells[kind] + 1);
+    offsets[kind]->SetValue(totals.NumberOfCells[kind], totals.ConnectivitySize[kind]);
+    connectivity[kind] = vtkSmartPointer<vtkIdTypeArray>::New();
+    connectivity[kind]->SetNumberOfValues(totals.ConnectivitySize[kind]);
+    offsetsPtrs[kind] = offsets[kind];
+    connectivityPtrs[kind] = connectivity[kind];
+    numOutCells += totals.NumberOfCells[kind];
   }
-  this->UpdateProgress(0.9);
+  outCD->CopyAllocate(inCD, numOutCells);
+  ArrayList cellArrays;
+  cellArrays.AddArrays(numOutCells, inCD, outCD, 0.0, false);
 
-  // triangle strips can reduced to polys/lines/points etc
-  if (!this->CheckAbort() && inStrips->GetNumberOfCells() > 0)
-  {
-    newStrips.TakeReference(vtkCellArray::New());
-    newStrips->AllocateCopy(inStrips);
-    outStrpData.TakeReference(vtkCellData::New());
-    outStrpData->CopyAllocate(inCD);
-    checkAbortInterval = std::min(inStrips->GetNumberOfCells() / 10 + 1, (vtkIdType)1000);
-    progressCounter = 0;
+  GenerateCells generateCells(
+    input, cleaner, batches, this, pmap, offsetsPtrs, connectivityPtrs, totals, &cellArrays);
+  vtkSMPTools::For(0, batches.GetNumberOfBatches(), generateCells);
 
-    for (inStrips->InitTraversal(); inStrips->GetNextCell(npts, pts); inCellID++)
-    {
-      if (progressCounter % checkAbortInterval == 0 && this->CheckAbort())
-      {
-        break;
-      }
-
-      cellIds.clear();
-      for (i = 0; i < npts; i++)
-      {
-        ptId = pmap[pts[i]];
-        if (std::find(cellIds.begin(), cellIds.end(), ptId) == cellIds.end())
-        {
-          cellIds.push_back(ptId);
-        }
-      }
-      if (cellIds.size() > 3)
-      {
-        newId = newStrips->InsertNextCell(cellIds.size(), cellIds.data());
-        outStrpData->CopyData(inCD, inCellID, newId);
-      }
-      else if (cellIds.size() == 3 && this->ConvertStripsToPolys)
-      {
-        if (!newPolys)
-        {
-          newPolys.TakeReference(vtkCellArray::New());
-          newPolys->AllocateEstimate(5, 3);
-          outPolyData.TakeReference(vtkCellData::New());
-          outPolyData->CopyAllocate(inCD);
-        }
-        newId = newPolys->InsertNextCell(cellIds.size(), cellIds.data());
-        outPolyData->CopyData(inCD, inCellID, newId);
-      }
-      else if (cellIds.size() == 2 && this->ConvertPolysToLines)
-      {
-        if (!newLines)
-        {
-          newLines.TakeReference(vtkCellArray::New());
-          newLines->AllocateEstimate(5, 2);
-          outLineData.TakeReference(vtkCellData::New());
-          outLineData->CopyAllocate(inCD);
-        }
-        newId = newLines->InsertNextCell(cellIds.size(), cellIds.data());
-        outLineData->CopyData(inCD, inCellID, newId);
-      }
-      else if (cellIds.size() == 1 && this->ConvertLinesToPoints)
-      {
-        if (!newVerts)
-        {
-          newVerts.TakeReference(vtkCellArray::New());
-          newVerts->AllocateEstimate(5, 1);
-        }
-        newId = newVerts->InsertNextCell(cellIds.size(), cellIds.data());
-        outCD->CopyData(inCD, inCellID, newId);
-      }
-    }
-    vtkDebugMacro(<< "Removed " << inStrips->GetNumberOfCells() - newStrips->GetNumberOfCells()
-                  << " strips");
-  }
-
-  vtkDebugMacro(<< "Removed " << numNewPts - newPts->GetNumberOfPoints() << " points");
+  vtkDebugMacro(<< "Removed " << numCells - numOutCells << " cells");
+  vtkDebugMacro(<< "Removed " << numPts - numNewPts << " points");
 
   // Update ourselves and release memory
   //
   this->Locator->Initialize(); // release memory.
 
-  // Now transfer all CellData from Lines/Polys/Strips into final
-  // cell attribute data. The vertex cell data has already been inserted.
-  vtkIdType cellCounter = (newVerts == nullptr ? 0 : newVerts->GetNumberOfCells());
-  vtkIdType lineCounter = (newLines == nullptr ? 0 : newLines->GetNumberOfCells());
-  vtkIdType polyCounter = (newPolys == nullptr ? 0 : newPolys->GetNumberOfCells());
-  vtkIdType strpCounter = (newStrips == nullptr ? 0 : newStrips->GetNumberOfCells());
-
-  if (newLines)
-  {
-    for (i = 0; i < lineCounter; ++i, ++cellCounter)
-    {
-      outCD->CopyData(outLineData, i, cellCounter);
-    }
-  }
-  if (newPolys)
-  {
-    for (i = 0; i < polyCounter; ++i, ++cellCounter)
-    {
-      outCD->CopyData(outPolyData, i, cellCounter);
-    }
-  }
-  if (newStrips)
+  // Update the output connectivity
+  vtkSmartPointer<vtkCellArray> newCells[NumberOfKinds];
+  for (int kind = 0; kind < NumberOfKinds; ++kind)
   {
-    for (i = 0; i < strpCounter; ++i, ++cellCounter)
+    if (totals.NumberOfCells[kind] > 0)
     {
-      outCD->CopyData(outStrpData, i, cellCounter);
+      newCells[kind] = vtkSmartPointer<vtkCellArray>::New();
+      newCells[kind]->SetData(offsets[kind], connectivity[kind]);
     }
   }
-
-  // Update the output connectivity
-  if (newVerts)
+  if (newCells[VertKind])
   {
-    output->SetVerts(newVerts);
+    output->SetVerts(newCells[VertKind]);
   }
-  if (newLines)
+  if (newCells[LineKind])
   {
-    output->SetLines(newLines);
+    output->SetLines(newCells[LineKind]);
   }
-  if (newPolys)
+  if (newCells[PolyKind])
   {
-    output->SetPolys(newPolys);
+    output->SetPolys(newCells[PolyKind]);
   }
-  if (newStrips)
+  if (newCells[StripKind])
   {
-    output->SetStrips(newStrips);
+    output->SetStrips(newCells[StripKind]);
   }
 
   return 1;
@@ -521,6 +811,7 @@ void vtkStaticCleanPolyData::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
 
+  os << indent << "Point Merging: " << (this->PointMerging ? "On\n" : "Off\n");
   os << indent << "ToleranceIsAbsolute: " << (this->ToleranceIsAbsolute ? "On\n" : "Off\n");
   os << indent << "Tolerance: " << (this->Tolerance ? "On\n" : "Off\n");
   os << indent << "AbsoluteTolerance: " << (this->AbsoluteTolerance ? "On\n" : "Off\n");
@@ -549,6 +840,7 @@ void vtkStaticCleanPolyData::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Remove Unused Points: " << (this->RemoveUnusedPoints ? "On\n" : "Off\n");
   os << indent << "Produce Merge Map: " << (this->ProduceMergeMap ? "On\n" : "Off\n");
   os << indent << "Average Point Data: " << (this->AveragePointData ? "On\n" : "Off\n");
+  os << indent << "Emulate Clean PolyData: " << (this->EmulateCleanPolyData ? "On\n" : "Off\n");
   os << indent << "Output Points Precision: " << this->OutputPointsPrecision << "\n";
   os << indent << "PieceInvariant: " << (this->PieceInvariant ? "On\n" : "Off\n");
 }
@@ -34,14 +34,17 @@
  * Large tolerances (of size > locator bin width) may generate poor results.
  *
  * @warning
- * Unlike vtkCleanPolyData, point merging is always performed (i.e., there
- * is no PointMergingOff()).
- *
- * @warning
  * Unlike vtkCleanPolyData, conversion from one cell type to another is
  * disabled/off. This produces more predictable behavior in many applications.
  *
  * @warning
+ * When EmulateCleanPolyData is enabled, the degenerate cells and the point
+ * ordering follow the rules of vtkCleanPolyData, so that with a zero
+ * tolerance both filters produce the same output. vtkCleanPolyData
+ * delegates its work to this filter in that mode when no locator has been
+ * specified.
+ *
+ * @warning
  * The vtkStaticCleanPolyData filter is similar in operation to
  * vtkCleanPolyData. However, vtkStaticCleanPolyData is non-incremental and
  * uses a much faster (especially for larger datasets) threading approach and
@@ -78,6 +81,17 @@ public:
   vtkTypeMacro(vtkStaticCleanPolyData, vtkPolyDataAlgorithm);
   ///@}
 
+  ///@{
+  /**
+   * Turn on/off merging of coincident points. When off, points are only
+   * renumbered (unused points being removed if RemoveUnusedPoints is on) and
+   * degenerate cells are still cleaned. Default is On.
+   */
+  vtkSetMacro(PointMerging, bool);
+  vtkBooleanMacro(PointMerging, bool);
+  vtkGetMacro(PointMerging, bool);
+  ///@}
+
   ///@{
   /**
    * By default ToleranceIsAbsolute is false and Tolerance is
@@ -188,6 +202,25 @@ public:
   vtkGetMacro(AveragePointData, bool);
   ///@}
 
+  ///@{
+  /**
+   * Indicate whether the output should reproduce the rules of
+   * vtkCleanPolyData: only consecutive duplicate points are removed from
+   * lines, polygons and strips (the closing point of polygons and strips
+   * being dropped when it repeats the first one), vertex cells are left
+   * untouched, cells that were already of a degenerate size (e.g., a polygon
+   * with two points) keep their reduced type whatever the Convert* flags are,
+   * and the output points are numbered in the order they are first used by
+   * the cells, taking their coordinates and data from that first use. Unused
+   * points are always removed in this mode. With a non-zero tolerance the
+   * merged points may still differ from vtkCleanPolyData, whose incremental
+   * locator depends on the insertion order. By default this is off.
+   */
+  vtkSetMacro(EmulateCleanPolyData, bool);
+  vtkBooleanMacro(EmulateCleanPolyData, bool);
+  vtkGetMacro(EmulateCleanPolyData, bool);
+  ///@}
+
   ///@{
   /**
    * Set/get the desired precision for the output types. See the documentation
@@ -228,6 +261,7 @@ protected:
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
   int RequestUpdateExtent(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
 
+  bool PointMerging;
   double Tolerance;
   double AbsoluteTolerance;
   char* MergingArray;
@@ -238,6 +272,7 @@ protected:
   bool RemoveUnusedPoints;
   bool ProduceMergeMap;
   bool AveragePointData;
+  bool EmulateCleanPolyData;
   int OutputPointsPrecision;
   bool PieceInvariant;
 
@@ -84,6 +84,9 @@ struct CopyPointsAlgorithm
     const auto inPoints = vtk::DataArrayTupleRange<3>(this->InPts);
     auto outPoints = vtk::DataArrayTupleRange<3>(this->OutPts);
 
+    // Copy the attribute data of the whole range at once, one array at a time
+    this->Arrays.CopyTuples(endPtId - outPtId, this->ReversePtMap.data() + outPtId, outPtId);
+
     // Loop over all new (output) points and copy data from the input
     for (; outPtId < endPtId; ++outPtId)
     {
@@ -93,7 +96,6 @@ struct CopyPointsAlgorithm
       outP[0] = static_cast<OutValueT>(inP[0]);
       outP[1] = static_cast<OutValueT>(inP[1]);
       outP[2] = static_cast<OutValueT>(inP[2]);
-      this->Arrays.Copy(inPtId, outPtId);
     }
   }
 };
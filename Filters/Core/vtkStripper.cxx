@@ -11,13 +11,153 @@
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
+#include "vtkTypeInt64Array.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkStripper);
 
+namespace
+{
+// Minimum number of cells of the partitions of a parallel stripping.
+const vtkIdType MIN_PARTITION_SIZE = 5000;
+
+// Join the poly-lines of newLines that are contiguous. In some cases it may be
+// possible to optimize the output polylines a bit. The stripping algorithm
+// sometimes outputs polylines that could be joined together but are not.
+vtkSmartPointer<vtkCellArray> JoinContiguousLines(vtkCellArray* newLines)
+{
+  vtkIdType i;
+
+  // compressedLines will be our output line set, possibly
+  // with some lines joined together.
+  vtkSmartPointer<vtkCellArray> compressedLines = vtkSmartPointer<vtkCellArray>::New();
+
+  bool* used = new bool[newLines->GetNumberOfCells()];
+  for (i = 0; i < newLines->GetNumberOfCells(); i++)
+  {
+    used[i] = false;
+  }
+
+  bool done = false;
+  while (!done)
+  {
+    int out_n = 0;
+    const size_t out_p_size = static_cast<size_t>(
+      newLines->GetNumberOfCells() + newLines->GetNumberOfConnectivityIds());
+    vtkIdType* out_p = new vtkIdType[out_p_size];
+
+    newLines->InitTraversal();
+    int id = -1;
+    vtkIdType n;
+    const vtkIdType* p;
+
+    // Find a line from the original set that has not yet been used
+    do
+    {
+      if (newLines->GetNextCell(n, p) == 0)
+      {
+        done = true;
+      }
+      id++;
+    } while (!done && (used[id] == 1));
+
+    if (!done)
+    {
+      // Write it into our output line
+      memcpy(out_p + out_n, p, n * sizeof(vtkIdType));
+      out_n += n;
+      used[id] = true;
+
+      // Now add any unused lines that adjoin this current line
+      bool finished_new_line = false;
+      while (!finished_new_line)
+      {
+        // Here's the start and end of our current line
+        vtkIdType ca = out_p[0];
+        vtkIdType cb = out_p[out_n - 1];
+
+        vtkIdType ta;
+        vtkIdType tb;
+        bool found = false;
+
+        // Look for any lines which adjoin this one
+        while (!finished_new_line && !found)
+        {
+          if (newLines->GetNextCell(n, p) == 0)
+          {
+            finished_new_line = true;
+          }
+          id++;
+
+          if (!finished_new_line && (used[id] == 0))
+          {
+            ta = p[0];
+            tb = p[n - 1];
+            if ((ca == ta) || (ca == tb) || (cb == ta) || (cb == tb))
+            {
+              found = true;
+              // Here's a line which adjoins this one somehow; add it in
+              vtkIdType* add_to;
+
+              if (ca == ta || ca == tb)
+              {
+                // This line will go in before our current one; move
+                // the current one forwards to make room
+                memmove(out_p + n, out_p, out_n * sizeof(vtkIdType));
+                add_to = out_p;
+              }
+              else
+              {
+                // This line will go in after our current one
+                add_to = out_p + out_n;
+              }
+
+              // Add the new line to our current one, either forwards
+              // or backwards as appropriate
+              if (ca == ta || cb == tb)
+              {
+                for (vtkIdType x = 0; x < n; x++)
+                {
+                  add_to[x] = p[n - x - 1];
+                }
+              }
+              else
+              {
+                memcpy(add_to, p, n * sizeof(vtkIdType));
+              }
+              out_n += n;
+              used[id] = true;
+            }
+            else
+            {
+              finished_new_line = true;
+            }
+          }
+        }
+      }
+
+      // We've finished this new line, so add it to the list
+      compressedLines->InsertNextCell(out_n, out_p);
+    }
+
+    delete[] out_p;
+  }
+
+  compressedLines->Squeeze();
+  delete[] used;
+  return compressedLines;
+}
+} // anonymous namespace
+
 // Construct object with MaximumLength set to 1000.
 vtkStripper::vtkStripper()
 {
@@ -39,6 +179,22 @@ int vtkStripper::RequestData(vtkInformation* vtkNotUsed(request),
   vtkPolyData* input = vtkPolyData::SafeDownCast(inInfo->Get(vtkDataObject::DATA_OBJECT()));
   vtkPolyData* output = vtkPolyData::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
 
+  vtkIdType numPartitions = this->NumberOfPartitions > 0
+    ? this->NumberOfPartitions
+    : vtkSMPTools::GetEstimatedNumberOfThreads();
+  numPartitions = std::min(
+    numPartitions, (input->GetNumberOfLines() + input->GetNumberOfPolys()) / MIN_PARTITION_SIZE);
+  if (numPartitions > 1)
+  {
+    return this->PartitionedStrip(input, output, static_cast<int>(numPartitions));
+  }
+
+  return this->Strip(input, output);
+}
+
+//------------------------------------------------------------------------------
+int vtkStripper::Strip(vtkPolyData* input, vtkPolyData* output)
+{
   vtkIdType cellId, numCells, i;
   int longestStrip, longestLine, j, numPts;
   vtkIdType numLines, numStrips, nei;
@@ -499,129 +655,7 @@ int vtkStripper::RequestData(vtkInformation* vtkNotUsed(request),
   {
     if (this->JoinContiguousSegments)
     {
-      // In some cases it may be possible to optimize the output
-      // polylines a bit.  The algorithm thus-far sometimes outputs
-      // polylines that could be joined together but are not.  We now
-      // go through joining any lines that we can.
-
-      // compressedLines will be our output line set, possibly
-      // with some lines joined together.
-      vtkSmartPointer<vtkCellArray> compressedLines = vtkSmartPointer<vtkCellArray>::New();
-
-      bool* used = new bool[newLines->GetNumberOfCells()];
-      for (i = 0; i < newLines->GetNumberOfCells(); i++)
-      {
-        used[i] = false;
-      }
-
-      bool done = false;
-      while (!done)
-      {
-        int out_n = 0;
-        const size_t out_p_size = static_cast<size_t>(
-          newLines->GetNumberOfCells() + newLines->GetNumberOfConnectivityIds());
-        vtkIdType* out_p = new vtkIdType[out_p_size];
-
-        newLines->InitTraversal();
-        int id = -1;
-        vtkIdType n;
-        const vtkIdType* p;
-
-        // Find a line from the original set that has not yet been used
-        do
-        {
-          if (newLines->GetNextCell(n, p) == 0)
-          {
-            done = true;
-          }
-          id++;
-        } while (!done && (used[id] == 1));
-
-        if (!done)
-        {
-          // Write it into our output line
-          memcpy(out_p + out_n, p, n * sizeof(vtkIdType));
-          out_n += n;
-          used[id] = true;
-
-          // Now add any unused lines that adjoin this current line
-          bool finished_new_line = false;
-          while (!finished_new_line)
-          {
-            // Here's the start and end of our current line
-            vtkIdType ca = out_p[0];
-            vtkIdType cb = out_p[out_n - 1];
-
-            vtkIdType ta;
-            vtkIdType tb;
-            bool found = false;
-
-            // Look for any lines which adjoin this one
-            while (!finished_new_line && !found)
-            {
-              if (newLines->GetNextCell(n, p) == 0)
-              {
-                finished_new_line = true;
-              }
-              id++;
-
-              if (!finished_new_line && (used[id] == 0))
-              {
-                ta = p[0];
-                tb = p[n - 1];
-                if ((ca == ta) || (ca == tb) || (cb == ta) || (cb == tb))
-                {
-                  found = true;
-                  // Here's a line which adjoins this one somehow; add it in
-                  vtkIdType* add_to;
-
-                  if (ca == ta || ca == tb)
-                  {
-                    // This line will go in before our current one; move
-                    // the current one forwards to make room
-                    memmove(out_p + n, out_p, out_n * sizeof(vtkIdType));
-                    add_to = out_p;
-                  }
-                  else
-                  {
-                    // This line will go in after our current one
-                    add_to = out_p + out_n;
-                  }
-
-                  // Add the new line to our current one, either forwards
-                  // or backwards as appropriate
-                  if (ca == ta || cb == tb)
-                  {
-                    for (vtkIdType x = 0; x < n; x++)
-                    {
-                      add_to[x] = p[n - x - 1];
-                    }
-                  }
-                  else
-                  {
-                    memcpy(add_to, p, n * sizeof(vtkIdType));
-                  }
-                  out_n += n;
-                  used[id] = true;
-                }
-                else
-                {
-                  finished_new_line = true;
-                }
-              }
-            }
-          }
-
-          // We've finished this new line, so add it to the list
-          compressedLines->InsertNextCell(out_n, out_p);
-        }
-
-        delete[] out_p;
-      }
-
-      compressedLines->Squeeze();
-      output->SetLines(compressedLines);
-      delete[] used;
+      output->SetLines(JoinContiguousLines(newLines));
     }
     else
     {
@@ -725,6 +759,350 @@ int vtkStripper::RequestData(vtkInformation* vtkNotUsed(request),
   return 1;
 }
 
+//------------------------------------------------------------------------------
+int vtkStripper::PartitionedStrip(vtkPolyData* input, vtkPolyData* output, int numberOfPartitions)
+{
+  vtkPoints* inPoints = input->GetPoints();
+  vtkCellData* cd = input->GetCellData();
+  vtkCellArray* inLines = input->GetLines();
+  vtkCellArray* inPolys = input->GetPolys();
+  vtkCellArray* inStrips = input->GetStrips();
+  const vtkIdType inNumVerts = input->GetVerts()->GetNumberOfCells();
+  const vtkIdType inNumLines = inLines->GetNumberOfCells();
+  const vtkIdType numCells = inNumLines + input->GetPolys()->GetNumberOfCells();
+  vtkUnsignedCharArray* ghostCells = cd->GetGhostArray();
+
+  // The lines and polygons (numbered lines first, as in the stripped mesh) are
+  // partitioned by recursive bisection of their centroids along the largest
+  // dimension of the bounding box of the centroids. Ghost cells are skipped.
+  vtkDebugMacro(<< "Partitioning " << numCells << " cells");
+  auto getCellPoints = [&](vtkIdType meshId, vtkIdType& npts, const vtkIdType*& pts,
+                         vtkIdList* ptIds) {
+    if (meshId < inNumLines)
+    {
+      inLines->GetCellAtId(meshId, npts, pts, ptIds);
+    }
+    else
+    {
+      inPolys->GetCellAtId(meshId - inNumLines, npts, pts, ptIds);
+    }
+  };
+  std::vector<float> centroids(3 * numCells);
+  vtkSMPTools::For(0, numCells, [&](vtkIdType meshId, vtkIdType endMeshId) {
+    vtkNew<vtkIdList> ptIds;
+    vtkIdType npts;
+    const vtkIdType* pts;
+    double x[3];
+    for (; meshId < endMeshId; ++meshId)
+    {
+      getCellPoints(meshId, npts, pts, ptIds);
+      double c[3] = { 0.0, 0.0, 0.0 };
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        inPoints->GetPoint(pts[i], x);
+        c[0] += x[0];
+        c[1] += x[1];
+        c[2] += x[2];
+      }
+      for (int j = 0; j < 3; ++j)
+      {
+        centroids[3 * meshId + j] = static_cast<float>(npts > 0 ? c[j] / npts : 0.0);
+      }
+    }
+  });
+
+  struct Range
+  {
+    vtkIdType Begin;
+    vtkIdType End;
+    int NumberOfPartitions;
+  };
+  std::vector<vtkIdType> meshIds;
+  meshIds.reserve(numCells);
+  for (vtkIdType meshId = 0; meshId < numCells; ++meshId)
+  {
+    if (!ghostCells || !ghostCells->GetValue(inNumVerts + meshId))
+    {
+      meshIds.push_back(meshId);
+    }
+  }
+  std::vector<Range> ranges(
+    1, Range{ 0, static_cast<vtkIdType>(meshIds.size()), numberOfPartitions });
+  while (static_cast<int>(ranges.size()) < numberOfPartitions)
+  {
+    std::vector<Range> splitRanges(2 * ranges.size());
+    vtkSMPTools::For(0, static_cast<vtkIdType>(ranges.size()), 1,
+      [&](vtkIdType rangeId, vtkIdType endRangeId) {
+        for (; rangeId < endRangeId; ++rangeId)
+        {
+          const Range& range = ranges[rangeId];
+          if (range.NumberOfPartitions == 1)
+          {
+            splitRanges[2 * rangeId] = range;
+            splitRanges[2 * rangeId + 1] = Range{ range.End, range.End, 0 };
+            continue;
+          }
+          float bounds[6] = { VTK_FLOAT_MAX, -VTK_FLOAT_MAX, VTK_FLOAT_MAX, -VTK_FLOAT_MAX,
+            VTK_FLOAT_MAX, -VTK_FLOAT_MAX };
+          for (vtkIdType i = range.Begin; i < range.End; ++i)
+          {
+            const float* c = centroids.data() + 3 * meshIds[i];
+            for (int j = 0; j < 3; ++j)
+            {
+              bounds[2 * j] = std::min(bounds[2 * j], c[j]);
+              bounds[2 * j + 1] = std::max(bounds[2 * j + 1], c[j]);
+            }
+          }
+          int axis = 0;
+          for (int j = 1; j < 3; ++j)
+          {
+            if (bounds[2 * j + 1] - bounds[2 * j] > bounds[2 * axis + 1] - bounds[2 * axis])
+            {
+              axis = j;
+            }
+          }
+          const int numLeft = range.NumberOfPartitions / 2;
+          const vtkIdType middle =
+            range.Begin + (range.End - range.Begin) * numLeft / range.NumberOfPartitions;
+          std::nth_element(meshIds.begin() + range.Begin, meshIds.begin() + middle,
+            meshIds.begin() + range.End, [&centroids, axis](vtkIdType a, vtkIdType b) {
+              return centroids[3 * a + axis] < centroids[3 * b + axis];
+            });
+          splitRanges[2 * rangeId] = Range{ range.Begin, middle, numLeft };
+          splitRanges[2 * rangeId + 1] =
+            Range{ middle, range.End, range.NumberOfPartitions - numLeft };
+        }
+      });
+    ranges.clear();
+    for (const Range& range : splitRanges)
+    {
+      if (range.NumberOfPartitions > 0)
+      {
+        ranges.push_back(range);
+      }
+    }
+  }
+  std::vector<float>().swap(centroids);
+  this->UpdateProgress(0.1);
+
+  // Strip the partitions concurrently. Each partition is a mesh of its lines
+  // and polygons, in input order, with its points renumbered. The output cells
+  // are then given back their input point ids, and the ids of the input cells
+  // they come from.
+  struct Partition
+  {
+    vtkSmartPointer<vtkPolyData> Output;
+    // input cell id of each entry of the original cell ids of Output
+    std::vector<vtkIdType> InputCellIds;
+  };
+  std::vector<Partition> partitions(numberOfPartitions);
+  vtkSMPTools::For(0, numberOfPartitions, 1, [&](vtkIdType partId, vtkIdType endPartId) {
+    for (; partId < endPartId; ++partId)
+    {
+      if (this->GetAbortOutput())
+      {
+        break;
+      }
+      const Range& range = ranges[partId];
+      std::sort(meshIds.begin() + range.Begin, meshIds.begin() + range.End);
+      vtkNew<vtkIdList> ptIds;
+      vtkIdType npts;
+      const vtkIdType* pts;
+
+      // gather the sorted input ids of the points of the partition
+      std::vector<vtkIdType> inputPointIds;
+      for (vtkIdType i = range.Begin; i < range.End; ++i)
+      {
+        getCellPoints(meshIds[i], npts, pts, ptIds);
+        inputPointIds.insert(inputPointIds.end(), pts, pts + npts);
+      }
+      std::sort(inputPointIds.begin(), inputPointIds.end());
+      inputPointIds.erase(
+        std::unique(inputPointIds.begin(), inputPointIds.end()), inputPointIds.end());
+      const vtkIdType numPartPts = static_cast<vtkIdType>(inputPointIds.size());
+
+      vtkNew<vtkPolyData> mesh;
+      vtkNew<vtkPoints> points;
+      points->SetDataType(inPoints->GetDataType());
+      points->SetNumberOfPoints(numPartPts);
+      double x[3];
+      for (vtkIdType i = 0; i < numPartPts; ++i)
+      {
+        inPoints->GetPoint(inputPointIds[i], x);
+        points->SetPoint(i, x);
+      }
+      mesh->SetPoints(points);
+      vtkNew<vtkCellArray> lines;
+      vtkNew<vtkCellArray> polys;
+      std::vector<vtkIdType> ids;
+      for (vtkIdType i = range.Begin; i < range.End; ++i)
+      {
+        getCellPoints(meshIds[i], npts, pts, ptIds);
+        ids.resize(npts);
+        for (vtkIdType j = 0; j < npts; ++j)
+        {
+          ids[j] = std::lower_bound(inputPointIds.begin(), inputPointIds.end(), pts[j]) -
+            inputPointIds.begin();
+        }
+        (meshIds[i] < inNumLines ? lines : polys)->InsertNextCell(npts, ids.data());
+      }
+      mesh->SetLines(lines);
+      mesh->SetPolys(polys);
+
+      vtkNew<vtkStripper> stripper;
+      stripper->MaximumLength = this->MaximumLength;
+      stripper->PassThroughCellIds = 1;
+      if (vtkSMPTools::GetSingleThread())
+      {
+        // only the main thread forwards the abort requests
+        stripper->SetContainerAlgorithm(this);
+      }
+      Partition& partition = partitions[partId];
+      partition.Output = vtkSmartPointer<vtkPolyData>::New();
+      stripper->Strip(mesh, partition.Output);
+
+      for (vtkCellArray* cells : { partition.Output->GetLines(), partition.Output->GetPolys(),
+             partition.Output->GetStrips() })
+      {
+        if (cells->GetNumberOfCells() == 0)
+        {
+          // may be the container shared by all the empty polydata
+          continue;
+        }
+        cells->ConvertTo64BitStorage();
+        vtkTypeInt64Array* conn = cells->GetConnectivityArray64();
+        for (vtkIdType i = 0; i < conn->GetNumberOfValues(); ++i)
+        {
+          conn->SetValue(i, inputPointIds[conn->GetValue(i)]);
+        }
+      }
+      vtkIdTypeArray* cellIds = vtkIdTypeArray::SafeDownCast(
+        partition.Output->GetFieldData()->GetArray("vtkOriginalCellIds"));
+      const vtkIdType numIds = cellIds ? cellIds->GetNumberOfValues() : 0;
+      partition.InputCellIds.resize(numIds);
+      for (vtkIdType i = 0; i < numIds; ++i)
+      {
+        partition.InputCellIds[i] = inNumVerts + meshIds[range.Begin + cellIds->GetValue(i)];
+      }
+    }
+  });
+  this->UpdateProgress(0.9);
+  if (this->CheckAbort())
+  {
+    return 1;
+  }
+
+  // Merge the partitions. The input strips are passed first, as when the
+  // input is stripped as a whole. The cell data of the output cells is
+  // gathered as original cell ids, ordered as the cells: verts, lines, polys
+  // and strips.
+  vtkDebugMacro(<< "Merging " << numberOfPartitions << " partitions");
+  std::vector<vtkIdType> lineIds, polyIds, stripIds, stripDataIds;
+  vtkNew<vtkCellArray> newLines;
+  vtkNew<vtkCellArray> newPolys;
+  vtkNew<vtkCellArray> newStrips;
+  vtkIdType cellId = inNumVerts + numCells;
+  vtkIdType numStripPts;
+  const vtkIdType* stripPts;
+  for (inStrips->InitTraversal(); inStrips->GetNextCell(numStripPts, stripPts); cellId++)
+  {
+    if (ghostCells && ghostCells->GetValue(cellId))
+    {
+      continue;
+    }
+    newStrips->InsertNextCell(numStripPts, stripPts);
+    stripIds.push_back(cellId);
+    for (vtkIdType i = 2; i < numStripPts; i++)
+    {
+      stripIds.push_back(cellId);
+      stripDataIds.push_back(cellId);
+    }
+  }
+  for (const Partition& partition : partitions)
+  {
+    vtkPolyData* partOutput = partition.Output;
+    const vtkIdType numLines = partOutput->GetLines()->GetNumberOfCells();
+    const vtkIdType numPolys = partOutput->GetPolys()->GetNumberOfCells();
+    newLines->Append(partOutput->GetLines());
+    newPolys->Append(partOutput->GetPolys());
+    newStrips->Append(partOutput->GetStrips());
+    auto begin = partition.InputCellIds.begin();
+    lineIds.insert(lineIds.end(), begin, begin + numLines);
+    polyIds.insert(polyIds.end(), begin + numLines, begin + numLines + numPolys);
+    stripIds.insert(stripIds.end(), begin + numLines + numPolys, partition.InputCellIds.end());
+    stripDataIds.insert(
+      stripDataIds.end(), begin + numLines + numPolys, partition.InputCellIds.end());
+  }
+  partitions.clear();
+
+  output->SetPoints(inPoints);
+  output->GetPointData()->PassData(input->GetPointData());
+  if (this->PassThroughPointIds)
+  {
+    // make a 1:1 mapping
+    vtkNew<vtkIdTypeArray> originalPointIds;
+    originalPointIds->SetName("vtkOriginalPointIds");
+    originalPointIds->SetNumberOfValues(output->GetNumberOfPoints());
+    std::iota(originalPointIds->GetPointer(0),
+      originalPointIds->GetPointer(0) + output->GetNumberOfPoints(), 0);
+    output->GetPointData()->AddArray(originalPointIds);
+  }
+  output->SetVerts(input->GetVerts());
+  if (newLines->GetNumberOfCells() > 0)
+  {
+    output->SetLines(this->JoinContiguousSegments ? JoinContiguousLines(newLines)
+                                                  : vtkSmartPointer<vtkCellArray>(newLines));
+  }
+  if (newPolys->GetNumberOfCells() > 0)
+  {
+    output->SetPolys(newPolys);
+  }
+  if (newStrips->GetNumberOfCells() > 0)
+  {
+    output->SetStrips(newStrips);
+  }
+
+  if (this->PassCellDataAsFieldData)
+  {
+    vtkNew<vtkFieldData> newfd;
+    newfd->CopyStructure(cd);
+    newfd->Allocate(inNumVerts + lineIds.size() + polyIds.size() + stripDataIds.size());
+    for (vtkIdType i = 0; i < inNumVerts; i++)
+    {
+      newfd->InsertNextTuple(i, cd);
+    }
+    for (const std::vector<vtkIdType>* inputIds : { &lineIds, &polyIds, &stripDataIds })
+    {
+      for (vtkIdType inputId : *inputIds)
+      {
+        newfd->InsertNextTuple(inputId, cd);
+      }
+    }
+    output->SetFieldData(newfd);
+  }
+
+  if (this->PassThroughCellIds)
+  {
+    vtkNew<vtkIdTypeArray> originalCellIds;
+    originalCellIds->SetName("vtkOriginalCellIds");
+    originalCellIds->Allocate(inNumVerts + lineIds.size() + polyIds.size() + stripIds.size());
+    for (vtkIdType i = 0; i < inNumVerts; i++)
+    {
+      originalCellIds->InsertNextValue(i);
+    }
+    for (const std::vector<vtkIdType>* inputIds : { &lineIds, &polyIds, &stripIds })
+    {
+      for (vtkIdType inputId : *inputIds)
+      {
+        originalCellIds->InsertNextValue(inputId);
+      }
+    }
+    output->GetFieldData()->AddArray(originalCellIds);
+  }
+
+  return 1;
+}
+
 void vtkStripper::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
@@ -734,5 +1112,6 @@ void vtkStripper::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "PassThroughCellIds: " << this->PassThroughCellIds << endl;
   os << indent << "PassThroughPointIds: " << this->PassThroughPointIds << endl;
   os << indent << "JoinContiguousSegments: " << this->JoinContiguousSegments << endl;
+  os << indent << "Number Of Partitions: " << this->NumberOfPartitions << endl;
 }
 VTK_ABI_NAMESPACE_END
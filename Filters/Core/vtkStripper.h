@@ -32,6 +32,11 @@
  *    the input.
  * The field data order is same as cell data i.e. (verts,line,polys,tsrips).
  *
+ * The lines and polygons may be stripped in parallel by setting
+ * NumberOfPartitions. They are then split into spatially coherent partitions
+ * by recursive bisection of their centroids, and the partitions are stripped
+ * concurrently.
+ *
  * If there is a ghost cell array in the input, the ghost array is discarded.
  * Any cell tagged as ghost is skipped when stripping. Ghost points are kept.
  *
@@ -117,6 +122,19 @@ public:
   vtkBooleanMacro(JoinContiguousSegments, vtkTypeBool);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get the number of partitions stripped concurrently. 1 strips the
+   * whole mesh at once. 0 uses one partition per thread, as reported by
+   * vtkSMPTools::GetEstimatedNumberOfThreads(). Fewer partitions are used for
+   * small meshes. Strips and poly-lines do not cross the boundaries of the
+   * partitions, so the output has slightly more cells than the sequential
+   * stripping. Default is 1.
+   */
+  vtkSetClampMacro(NumberOfPartitions, int, 0, VTK_INT_MAX);
+  vtkGetMacro(NumberOfPartitions, int);
+  ///@}
+
 protected:
   vtkStripper();
   ~vtkStripper() override = default;
@@ -129,8 +147,12 @@ protected:
   vtkTypeBool PassThroughCellIds;
   vtkTypeBool PassThroughPointIds;
   vtkTypeBool JoinContiguousSegments;
+  int NumberOfPartitions = 1;
 
 private:
+  int Strip(vtkPolyData* input, vtkPolyData* output);
+  int PartitionedStrip(vtkPolyData* input, vtkPolyData* output, int numberOfPartitions);
+
   vtkStripper(const vtkStripper&) = delete;
   void operator=(const vtkStripper&) = delete;
 };
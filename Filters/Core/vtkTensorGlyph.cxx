@@ -2,20 +2,28 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkTensorGlyph.h"
 
-#include "vtkCell.h"
+#include "vtkArrayListTemplate.h"
 #include "vtkCellArray.h"
 #include "vtkDataSet.h"
 #include "vtkExecutive.h"
 #include "vtkFloatArray.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkMatrix4x4.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTransform.h"
 
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkTensorGlyph);
 
@@ -92,42 +100,17 @@ int vtkTensorGlyph::RequestData(vtkInformation* vtkNotUsed(request),
   vtkPolyData* output = vtkPolyData::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
 
   vtkDataArray* inTensors;
-  double tensor[9];
   vtkDataArray* inScalars;
-  vtkIdType numPts, numSourcePts, numSourceCells, inPtId, i;
-  int j;
+  vtkIdType numPts, numSourcePts;
   vtkPoints* sourcePts;
   vtkDataArray* sourceNormals;
-  vtkCellArray *sourceCells, *cells;
   vtkPoints* newPts;
   vtkFloatArray* newScalars = nullptr;
   vtkFloatArray* newNormals = nullptr;
-  double x[3], s;
-  vtkTransform* trans;
-  vtkCell* cell;
-  vtkIdList* cellPts;
-  int npts;
-  vtkIdType* pts;
-  vtkIdType ptIncr, cellId;
-  vtkIdType subIncr;
-  int numDirs, dir, eigen_dir, symmetric_dir;
-  vtkMatrix4x4* matrix;
-  double *m[3], w[3], *v[3];
-  double m0[3], m1[3], m2[3];
-  double v0[3], v1[3], v2[3];
-  double xv[3], yv[3], zv[3];
-  double maxScale;
+  int numDirs;
 
   numDirs = (this->ThreeGlyphs ? 3 : 1) * (this->Symmetric + 1);
 
-  // set up working matrices
-  m[0] = m0;
-  m[1] = m1;
-  m[2] = m2;
-  v[0] = v0;
-  v[1] = v1;
-  v[2] = v2;
-
   vtkDebugMacro(<< "Generating tensor glyphs");
 
   vtkPointData* outPD = output->GetPointData();
@@ -141,59 +124,60 @@ int vtkTensorGlyph::RequestData(vtkInformation* vtkNotUsed(request),
     return 1;
   }
 
-  pts = new vtkIdType[source->GetMaxCellSize()];
-  trans = vtkTransform::New();
-  matrix = vtkMatrix4x4::New();
-
   //
   // Allocate storage for output PolyData
   //
   sourcePts = source->GetPoints();
   numSourcePts = sourcePts->GetNumberOfPoints();
-  numSourceCells = source->GetNumberOfCells();
+  const vtkIdType numOutPts = numDirs * numPts * numSourcePts;
 
   newPts = vtkPoints::New();
-  newPts->Allocate(numDirs * numPts * numSourcePts);
-
-  // Setting up for calls to PolyData::InsertNextCell()
-  if ((sourceCells = source->GetVerts())->GetNumberOfCells() > 0)
-  {
-    cells = vtkCellArray::New();
-    cells->AllocateEstimate(sourceCells->GetNumberOfCells(), numDirs * numPts);
-    output->SetVerts(cells);
-    cells->Delete();
-  }
-  if ((sourceCells = this->GetSource()->GetLines())->GetNumberOfCells() > 0)
-  {
-    cells = vtkCellArray::New();
-    cells->AllocateEstimate(sourceCells->GetNumberOfCells(), numDirs * numPts);
-    output->SetLines(cells);
-    cells->Delete();
-  }
-  if ((sourceCells = this->GetSource()->GetPolys())->GetNumberOfCells() > 0)
-  {
-    cells = vtkCellArray::New();
-    cells->AllocateEstimate(sourceCells->GetNumberOfCells(), numDirs * numPts);
-    output->SetPolys(cells);
-    cells->Delete();
-  }
-  if ((sourceCells = this->GetSource()->GetStrips())->GetNumberOfCells() > 0)
+  newPts->SetNumberOfPoints(numOutPts);
+
+  // Every input point generates numDirs copies of every source cell, so
+  // the output cell arrays have a fixed size known up front.
+  vtkCellArray* sourceCells[4] = { source->GetVerts(), source->GetLines(), source->GetPolys(),
+    source->GetStrips() };
+  std::vector<vtkIdType> sourceOffsets[4];
+  std::vector<vtkIdType> sourceConnectivity[4];
+  vtkIdTypeArray* newOffsets[4] = { nullptr, nullptr, nullptr, nullptr };
+  vtkIdTypeArray* newConnectivity[4] = { nullptr, nullptr, nullptr, nullptr };
+  vtkNew<vtkIdList> cellPtIds;
+  for (int type = 0; type < 4; ++type)
   {
-    cells = vtkCellArray::New();
-    cells->AllocateEstimate(sourceCells->GetNumberOfCells(), numDirs * numPts);
-    output->SetStrips(cells);
-    cells->Delete();
+    const vtkIdType numCells = sourceCells[type]->GetNumberOfCells();
+    if (numCells == 0)
+    {
+      continue;
+    }
+    sourceOffsets[type].resize(numCells + 1);
+    sourceOffsets[type][0] = 0;
+    for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+    {
+      vtkIdType npts;
+      const vtkIdType* pts;
+      sourceCells[type]->GetCellAtId(cellId, npts, pts, cellPtIds);
+      sourceConnectivity[type].insert(sourceConnectivity[type].end(), pts, pts + npts);
+      sourceOffsets[type][cellId + 1] = static_cast<vtkIdType>(sourceConnectivity[type].size());
+    }
+    const vtkIdType glyphConnSize = numDirs * sourceOffsets[type].back();
+    newOffsets[type] = vtkIdTypeArray::New();
+    newOffsets[type]->SetNumberOfValues(numDirs * numPts * numCells + 1);
+    newOffsets[type]->SetValue(numDirs * numPts * numCells, numPts * glyphConnSize);
+    newConnectivity[type] = vtkIdTypeArray::New();
+    newConnectivity[type]->SetNumberOfValues(numPts * glyphConnSize);
   }
 
   // only copy scalar data through
   vtkPointData* pd = this->GetSource()->GetPointData();
+  ArrayList pointArrays;
   // generate scalars if eigenvalues are chosen or if scalars exist.
   if (this->ColorGlyphs &&
     ((this->ColorMode == COLOR_BY_EIGENVALUES) ||
       (inScalars && (this->ColorMode == COLOR_BY_SCALARS))))
   {
     newScalars = vtkFloatArray::New();
-    newScalars->Allocate(numDirs * numPts * numSourcePts);
+    newScalars->SetNumberOfTuples(numOutPts);
     if (this->ColorMode == COLOR_BY_EIGENVALUES)
     {
       newScalars->SetName("MaxEigenvalue");
@@ -207,263 +191,343 @@ int vtkTensorGlyph::RequestData(vtkInformation* vtkNotUsed(request),
   {
     outPD->CopyAllOff();
     outPD->CopyScalarsOn();
-    outPD->CopyAllocate(pd, numDirs * numPts * numSourcePts);
+    outPD->CopyAllocate(pd, numOutPts);
+    pointArrays.AddArrays(numOutPts, pd, outPD, 0.0, false);
   }
   if ((sourceNormals = pd->GetNormals()))
   {
     newNormals = vtkFloatArray::New();
     newNormals->SetNumberOfComponents(3);
     newNormals->SetName("Normals");
-    newNormals->Allocate(numDirs * 3 * numPts * numSourcePts);
+    newNormals->SetNumberOfTuples(numOutPts);
   }
+
   //
-  // First copy all topology (transformation independent)
+  // Traverse all Input points, transforming glyph at Source points. Every
+  // input point writes its own slice of the preallocated output.
   //
-  for (inPtId = 0; inPtId < numPts; inPtId++)
-  {
-    ptIncr = numDirs * inPtId * numSourcePts;
-    for (cellId = 0; cellId < numSourceCells; cellId++)
+  vtkSMPThreadLocalObject<vtkTransform> localTransforms;
+  vtkSMPTools::For(0, numPts, [&](vtkIdType inPtId, vtkIdType endPtId) {
+    vtkTransform* trans = localTransforms.Local();
+    trans->PreMultiply();
+    vtkNew<vtkMatrix4x4> matrix;
+    double tensor[9];
+    double *m[3], w[3], *v[3];
+    double m0[3], m1[3], m2[3];
+    double v0[3], v1[3], v2[3];
+    double xv[3], yv[3], zv[3];
+    double x[3], p[3], n[3], s;
+    double pointMatrix[16], normalMatrix[16];
+    double maxScale;
+    int i, j;
+
+    // set up working matrices
+    m[0] = m0;
+    m[1] = m1;
+    m[2] = m2;
+    v[0] = v0;
+    v[1] = v1;
+    v[2] = v2;
+
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; inPtId < endPtId; inPtId++)
     {
-      cell = this->GetSource()->GetCell(cellId);
-      cellPts = cell->GetPointIds();
-      npts = cellPts->GetNumberOfIds();
-      for (dir = 0; dir < numDirs; dir++)
+      if (isFirst)
       {
-        // This variable may be removed, but that
-        // will not improve readability
-        subIncr = ptIncr + dir * numSourcePts;
-        for (i = 0; i < npts; i++)
-        {
-          pts[i] = cellPts->GetId(i) + subIncr;
-        }
-        output->InsertNextCell(cell->GetCellType(), npts, pts);
+        this->CheckAbort();
       }
-    }
-  }
-  //
-  // Traverse all Input points, transforming glyph at Source points
-  //
-  trans->PreMultiply();
-
-  int checkAbortInterval = std::min(numPts / 10 + 1, (vtkIdType)1000);
-
-  for (inPtId = 0; inPtId < numPts; inPtId++)
-  {
-    if (inPtId % checkAbortInterval == 0 && this->CheckAbort())
-    {
-      break;
-    }
-    ptIncr = numDirs * inPtId * numSourcePts;
-
-    // Translation is postponed
-    // Symmetric tensor support
-    inTensors->GetTuple(inPtId, tensor);
-    if (inTensors->GetNumberOfComponents() == 6)
-    {
-      vtkMath::TensorFromSymmetricTensor(tensor);
-    }
+      if (this->GetAbortOutput())
+      {
+        break;
+      }
+      vtkIdType ptIncr = numDirs * inPtId * numSourcePts;
 
-    // compute orientation vectors and scale factors from tensor
-    if (this->ExtractEigenvalues) // extract appropriate eigenfunctions
-    {
-      // We are interested in the symmetrical part of the tensor only, since
-      // eigenvalues are real if and only if the matrice of reals is symmetrical
-      for (j = 0; j < 3; j++)
+      // Copy all topology (transformation independent)
+      for (int type = 0; type < 4; ++type)
       {
-        for (i = 0; i < 3; i++)
+        if (!newOffsets[type])
+        {
+          continue;
+        }
+        const vtkIdType numCells = static_cast<vtkIdType>(sourceOffsets[type].size()) - 1;
+        const vtkIdType glyphConnSize = sourceOffsets[type].back();
+        vtkIdType* outOffsets = newOffsets[type]->GetPointer(numDirs * inPtId * numCells);
+        vtkIdType connIncr = numDirs * inPtId * glyphConnSize;
+        vtkIdType* outConn = newConnectivity[type]->GetPointer(connIncr);
+        for (vtkIdType cellId = 0; cellId < numCells; cellId++)
         {
-          m[i][j] = 0.5 * (tensor[i + 3 * j] + tensor[j + 3 * i]);
+          const vtkIdType* pts = sourceConnectivity[type].data() + sourceOffsets[type][cellId];
+          const vtkIdType npts = sourceOffsets[type][cellId + 1] - sourceOffsets[type][cellId];
+          for (int dir = 0; dir < numDirs; dir++)
+          {
+            vtkIdType subIncr = ptIncr + dir * numSourcePts;
+            *outOffsets++ = connIncr;
+            for (vtkIdType k = 0; k < npts; k++)
+            {
+              *outConn++ = pts[k] + subIncr;
+            }
+            connIncr += npts;
+          }
         }
       }
-      vtkMath::Jacobi(m, w, v);
-
-      // copy eigenvectors
-      xv[0] = v[0][0];
-      xv[1] = v[1][0];
-      xv[2] = v[2][0];
-      yv[0] = v[0][1];
-      yv[1] = v[1][1];
-      yv[2] = v[2][1];
-      zv[0] = v[0][2];
-      zv[1] = v[1][2];
-      zv[2] = v[2][2];
-    }
-    else // use tensor columns as eigenvectors
-    {
-      for (i = 0; i < 3; i++)
+
+      // Translation is postponed
+      // Symmetric tensor support
+      inTensors->GetTuple(inPtId, tensor);
+      if (inTensors->GetNumberOfComponents() == 6)
       {
-        xv[i] = tensor[i];
-        yv[i] = tensor[i + 3];
-        zv[i] = tensor[i + 6];
+        vtkMath::TensorFromSymmetricTensor(tensor);
       }
-      w[0] = vtkMath::Normalize(xv);
-      w[1] = vtkMath::Normalize(yv);
-      w[2] = vtkMath::Normalize(zv);
-    }
-
-    // compute scale factors
-    w[0] *= this->ScaleFactor;
-    w[1] *= this->ScaleFactor;
-    w[2] *= this->ScaleFactor;
 
-    if (this->ClampScaling)
-    {
-      for (maxScale = 0.0, i = 0; i < 3; i++)
+      // compute orientation vectors and scale factors from tensor
+      if (this->ExtractEigenvalues) // extract appropriate eigenfunctions
       {
-        if (maxScale < fabs(w[i]))
+        // We are interested in the symmetrical part of the tensor only, since
+        // eigenvalues are real if and only if the matrice of reals is symmetrical
+        for (j = 0; j < 3; j++)
         {
-          maxScale = fabs(w[i]);
+          for (i = 0; i < 3; i++)
+          {
+            m[i][j] = 0.5 * (tensor[i + 3 * j] + tensor[j + 3 * i]);
+          }
         }
+        vtkMath::Jacobi(m, w, v);
+
+        // copy eigenvectors
+        xv[0] = v[0][0];
+        xv[1] = v[1][0];
+        xv[2] = v[2][0];
+        yv[0] = v[0][1];
+        yv[1] = v[1][1];
+        yv[2] = v[2][1];
+        zv[0] = v[0][2];
+        zv[1] = v[1][2];
+        zv[2] = v[2][2];
       }
-      if (maxScale > this->MaxScaleFactor)
+      else // use tensor columns as eigenvectors
       {
-        maxScale = this->MaxScaleFactor / maxScale;
         for (i = 0; i < 3; i++)
         {
-          w[i] *= maxScale; // preserve overall shape of glyph
+          xv[i] = tensor[i];
+          yv[i] = tensor[i + 3];
+          zv[i] = tensor[i + 6];
         }
+        w[0] = vtkMath::Normalize(xv);
+        w[1] = vtkMath::Normalize(yv);
+        w[2] = vtkMath::Normalize(zv);
       }
-    }
 
-    // normalization is postponed
+      // compute scale factors
+      w[0] *= this->ScaleFactor;
+      w[1] *= this->ScaleFactor;
+      w[2] *= this->ScaleFactor;
 
-    // make sure scale is okay (non-zero) and scale data
-    for (maxScale = 0.0, i = 0; i < 3; i++)
-    {
-      if (w[i] > maxScale)
-      {
-        maxScale = w[i];
-      }
-    }
-    if (maxScale == 0.0)
-    {
-      maxScale = 1.0;
-    }
-    for (i = 0; i < 3; i++)
-    {
-      if (w[i] == 0.0)
+      if (this->ClampScaling)
       {
-        w[i] = maxScale * 1.0e-06;
+        for (maxScale = 0.0, i = 0; i < 3; i++)
+        {
+          if (maxScale < fabs(w[i]))
+          {
+            maxScale = fabs(w[i]);
+          }
+        }
+        if (maxScale > this->MaxScaleFactor)
+        {
+          maxScale = this->MaxScaleFactor / maxScale;
+          for (i = 0; i < 3; i++)
+          {
+            w[i] *= maxScale; // preserve overall shape of glyph
+          }
+        }
       }
-    }
-
-    // Now do the real work for each "direction"
-
-    for (dir = 0; dir < numDirs; dir++)
-    {
-      eigen_dir = dir % (this->ThreeGlyphs ? 3 : 1);
-      symmetric_dir = dir / (this->ThreeGlyphs ? 3 : 1);
 
-      // Remove previous scales ...
-      trans->Identity();
-
-      // translate Source to Input point
-      input->GetPoint(inPtId, x);
-      trans->Translate(x[0], x[1], x[2]);
-
-      // normalized eigenvectors rotate object for eigen direction 0
-      matrix->Element[0][0] = xv[0];
-      matrix->Element[0][1] = yv[0];
-      matrix->Element[0][2] = zv[0];
-      matrix->Element[1][0] = xv[1];
-      matrix->Element[1][1] = yv[1];
-      matrix->Element[1][2] = zv[1];
-      matrix->Element[2][0] = xv[2];
-      matrix->Element[2][1] = yv[2];
-      matrix->Element[2][2] = zv[2];
-      trans->Concatenate(matrix);
-
-      if (eigen_dir == 1)
-      {
-        trans->RotateZ(90.0);
-      }
+      // normalization is postponed
 
-      if (eigen_dir == 2)
+      // make sure scale is okay (non-zero) and scale data
+      for (maxScale = 0.0, i = 0; i < 3; i++)
       {
-        trans->RotateY(-90.0);
+        if (w[i] > maxScale)
+        {
+          maxScale = w[i];
+        }
       }
-
-      if (this->ThreeGlyphs)
+      if (maxScale == 0.0)
       {
-        trans->Scale(w[eigen_dir], this->ScaleFactor, this->ScaleFactor);
+        maxScale = 1.0;
       }
-      else
+      for (i = 0; i < 3; i++)
       {
-        trans->Scale(w[0], w[1], w[2]);
+        if (w[i] == 0.0)
+        {
+          w[i] = maxScale * 1.0e-06;
+        }
       }
 
-      // Mirror second set to the symmetric position
-      if (symmetric_dir == 1)
-      {
-        trans->Scale(-1., 1., 1.);
-      }
+      // Now do the real work for each "direction"
+      input->GetPoint(inPtId, x);
 
-      // if the eigenvalue is negative, shift to reverse direction.
-      // The && is there to ensure that we do not change the
-      // old behaviour of vtkTensorGlyphs (which only used one dir),
-      // in case there is an oriented glyph, e.g. an arrow.
-      if (w[eigen_dir] < 0 && numDirs > 1)
+      for (int dir = 0; dir < numDirs; dir++)
       {
-        trans->Translate(-this->Length, 0., 0.);
-      }
+        int eigen_dir = dir % (this->ThreeGlyphs ? 3 : 1);
+        int symmetric_dir = dir / (this->ThreeGlyphs ? 3 : 1);
+
+        // Remove previous scales ...
+        trans->Identity();
+
+        // translate Source to Input point
+        trans->Translate(x[0], x[1], x[2]);
+
+        // normalized eigenvectors rotate object for eigen direction 0
+        matrix->Element[0][0] = xv[0];
+        matrix->Element[0][1] = yv[0];
+        matrix->Element[0][2] = zv[0];
+        matrix->Element[1][0] = xv[1];
+        matrix->Element[1][1] = yv[1];
+        matrix->Element[1][2] = zv[1];
+        matrix->Element[2][0] = xv[2];
+        matrix->Element[2][1] = yv[2];
+        matrix->Element[2][2] = zv[2];
+        trans->Concatenate(matrix);
+
+        if (eigen_dir == 1)
+        {
+          trans->RotateZ(90.0);
+        }
 
-      // multiply points (and normals if available) by resulting
-      // matrix
-      trans->TransformPoints(sourcePts, newPts);
+        if (eigen_dir == 2)
+        {
+          trans->RotateY(-90.0);
+        }
 
-      // Apply the transformation to a series of points,
-      // and append the results to outPts.
-      if (newNormals)
-      {
-        // a negative determinant means the transform turns the
-        // glyph surface inside out, and its surface normals all
-        // point inward. The following scale corrects the surface
-        // normals to point outward.
-        if (trans->GetMatrix()->Determinant() < 0)
+        if (this->ThreeGlyphs)
         {
-          trans->Scale(-1.0, -1.0, -1.0);
+          trans->Scale(w[eigen_dir], this->ScaleFactor, this->ScaleFactor);
+        }
+        else
+        {
+          trans->Scale(w[0], w[1], w[2]);
         }
-        trans->TransformNormals(sourceNormals, newNormals);
-      }
 
-      // Copy point data from source
-      if (this->ColorGlyphs && inScalars && (this->ColorMode == COLOR_BY_SCALARS))
-      {
-        s = inScalars->GetComponent(inPtId, 0);
-        for (i = 0; i < numSourcePts; i++)
+        // Mirror second set to the symmetric position
+        if (symmetric_dir == 1)
         {
-          newScalars->InsertTuple(ptIncr + i, &s);
+          trans->Scale(-1., 1., 1.);
         }
-      }
-      else if (this->ColorGlyphs && (this->ColorMode == COLOR_BY_EIGENVALUES))
-      {
-        // If ThreeGlyphs is false we use the first (largest)
-        // eigenvalue as scalar.
-        s = w[eigen_dir];
-        for (i = 0; i < numSourcePts; i++)
+
+        // if the eigenvalue is negative, shift to reverse direction.
+        // The && is there to ensure that we do not change the
+        // old behaviour of vtkTensorGlyphs (which only used one dir),
+        // in case there is an oriented glyph, e.g. an arrow.
+        if (w[eigen_dir] < 0 && numDirs > 1)
         {
-          newScalars->InsertTuple(ptIncr + i, &s);
+          trans->Translate(-this->Length, 0., 0.);
         }
-      }
-      else
-      {
+
+        // multiply points (and normals if available) by resulting
+        // matrix
+        vtkMatrix4x4::DeepCopy(pointMatrix, trans->GetMatrix());
         for (i = 0; i < numSourcePts; i++)
         {
-          outPD->CopyData(pd, i, ptIncr + i);
+          sourcePts->GetPoint(i, n);
+          for (j = 0; j < 3; j++)
+          {
+            p[j] = pointMatrix[4 * j] * n[0] + pointMatrix[4 * j + 1] * n[1] +
+              pointMatrix[4 * j + 2] * n[2] + pointMatrix[4 * j + 3];
+          }
+          newPts->SetPoint(ptIncr + i, p);
+        }
+
+        // Apply the transformation to a series of points,
+        // and append the results to outPts.
+        if (newNormals)
+        {
+          // a negative determinant means the transform turns the
+          // glyph surface inside out, and its surface normals all
+          // point inward. The following scale corrects the surface
+          // normals to point outward.
+          if (vtkMatrix4x4::Determinant(pointMatrix) < 0)
+          {
+            trans->Scale(-1.0, -1.0, -1.0);
+          }
+          // to transform the normal, multiply by the transposed inverse matrix
+          vtkMatrix4x4::Invert(*trans->GetMatrix()->Element, normalMatrix);
+          vtkMatrix4x4::Transpose(normalMatrix, normalMatrix);
+          for (i = 0; i < numSourcePts; i++)
+          {
+            sourceNormals->GetTuple(i, n);
+            for (j = 0; j < 3; j++)
+            {
+              p[j] = normalMatrix[4 * j] * n[0] + normalMatrix[4 * j + 1] * n[1] +
+                normalMatrix[4 * j + 2] * n[2];
+            }
+            vtkMath::Normalize(p);
+            newNormals->SetTuple(ptIncr + i, p);
+          }
+        }
+
+        // Copy point data from source
+        if (this->ColorGlyphs && inScalars && (this->ColorMode == COLOR_BY_SCALARS))
+        {
+          s = inScalars->GetComponent(inPtId, 0);
+          for (i = 0; i < numSourcePts; i++)
+          {
+            newScalars->SetTuple(ptIncr + i, &s);
+          }
         }
+        else if (this->ColorGlyphs && (this->ColorMode == COLOR_BY_EIGENVALUES))
+        {
+          // If ThreeGlyphs is false we use the first (largest)
+          // eigenvalue as scalar.
+          s = w[eigen_dir];
+          for (i = 0; i < numSourcePts; i++)
+          {
+            newScalars->SetTuple(ptIncr + i, &s);
+          }
+        }
+        else
+        {
+          for (i = 0; i < numSourcePts; i++)
+          {
+            pointArrays.Copy(i, ptIncr + i);
+          }
+        }
+        ptIncr += numSourcePts;
       }
-      ptIncr += numSourcePts;
     }
-  }
+  });
   vtkDebugMacro(<< "Generated " << numPts << " tensor glyphs");
   //
   // Update output and release memory
   //
-  delete[] pts;
-
   output->SetPoints(newPts);
   newPts->Delete();
 
+  for (int type = 0; type < 4; ++type)
+  {
+    if (newOffsets[type])
+    {
+      vtkNew<vtkCellArray> cells;
+      cells->SetData(newOffsets[type], newConnectivity[type]);
+      newOffsets[type]->Delete();
+      newConnectivity[type]->Delete();
+      switch (type)
+      {
+        case 0:
+          output->SetVerts(cells);
+          break;
+        case 1:
+          output->SetLines(cells);
+          break;
+        case 2:
+          output->SetPolys(cells);
+          break;
+        default:
+          output->SetStrips(cells);
+          break;
+      }
+    }
+  }
+
   if (newScalars)
   {
     int idx = outPD->AddArray(newScalars);
@@ -478,8 +542,6 @@ int vtkTensorGlyph::RequestData(vtkInformation* vtkNotUsed(request),
   }
 
   output->Squeeze();
-  trans->Delete();
-  matrix->Delete();
 
   return 1;
 }
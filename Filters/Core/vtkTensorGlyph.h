@@ -62,6 +62,10 @@
  * additional capability over the vtkGlyph3D object. That is, the
  * glyph can be oriented in three directions instead of one.
  *
+ * Every input point generates the same number of glyph points and cells, so
+ * the output is preallocated and the glyphs are generated in parallel with
+ * vtkSMPTools.
+ *
  * @par Thanks:
  * Thanks to Jose Paulo Moitinho de Almeida for enhancements.
  *
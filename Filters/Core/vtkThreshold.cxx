@@ -110,6 +110,7 @@ struct vtkThreshold::EvaluateCellsFunctor
   vtkUnsignedCharArray* GhostArray;
   bool UsePointScalars;
   vtkIdType NumberOfCells;
+  bool CheckCellTypes;
 
   vtkSMPThreadLocal<vtkSmartPointer<vtkIdList>> TLCellIds;
 
@@ -124,8 +125,16 @@ struct vtkThreshold::EvaluateCellsFunctor
     , GhostArray(ghostArray)
     , UsePointScalars(usePointScalars)
     , NumberOfCells(input->GetNumberOfCells())
+    , CheckCellTypes(true)
     , KeptCellsList(keptCellsList)
   {
+    // No need to look for empty cells in grids where all the cells have the
+    // same, non empty, type.
+    if (vtkUnstructuredGrid* ugrid = vtkUnstructuredGrid::SafeDownCast(input))
+    {
+      const int cellType = ugrid->GetHomogeneousCellType();
+      this->CheckCellTypes = cellType < 0 || cellType == VTK_EMPTY_CELL;
+    }
     this->InsidenessArray->SetNumberOfComponents(1);
     this->InsidenessArray->SetNumberOfTuples(this->NumberOfCells);
     if (this->NumberOfCells > 0)
@@ -168,8 +177,7 @@ struct vtkThreshold::EvaluateCellsFunctor
         insideness[cellId] = 0;
         continue;
       }
-      int cellType = this->Input->GetCellType(cellId);
-      if (cellType == VTK_EMPTY_CELL)
+      if (this->CheckCellTypes && this->Input->GetCellType(cellId) == VTK_EMPTY_CELL)
       {
         insideness[cellId] = 0;
         continue;
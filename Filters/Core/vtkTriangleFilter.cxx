@@ -2,218 +2,399 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkTriangleFilter.h"
 
+#include "vtkArrayListTemplate.h" // For processing attribute data
+#include "vtkBatch.h"
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
-#include "vtkTriangleStrip.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkTriangleFilter);
 
-//-------------------------------------------------------------------------
-int vtkTriangleFilter::RequestData(vtkInformation* vtkNotUsed(request),
-  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+namespace
 {
-  // get the info objects
-  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
-  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+// The kinds of output cells, with their number of points.
+enum OutputKind
+{
+  VertKind = 0,
+  LineKind = 1,
+  TriangleKind = 2,
+  NumberOfKinds = 3
+};
 
-  // get the input and output
-  vtkPolyData* input = vtkPolyData::SafeDownCast(inInfo->Get(vtkDataObject::DATA_OBJECT()));
-  vtkPolyData* output = vtkPolyData::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
+// Per-batch number of output cells of every kind. After
+// BuildOffsetsAndGetGlobalSum() these become the ids of the first output cell
+// of each batch.
+struct TriangulateBatchData
+{
+  vtkIdType NumberOfCells[NumberOfKinds] = { 0, 0, 0 };
 
-  vtkIdType numCells = input->GetNumberOfCells();
-  vtkIdType cellNum = 0;
-  vtkIdType numPts, newId;
-  vtkIdType npts = 0;
-  const vtkIdType* pts = nullptr;
-  int i, j;
-  vtkCellData* inCD = input->GetCellData();
-  vtkCellData* outCD = output->GetCellData();
-  vtkIdType updateInterval;
-  vtkCellArray* cells;
-  vtkPoints* inPts = input->GetPoints();
+  TriangulateBatchData& operator+=(const TriangulateBatchData& other)
+  {
+    for (int kind = 0; kind < NumberOfKinds; ++kind)
+    {
+      this->NumberOfCells[kind] += other.NumberOfCells[kind];
+    }
+    return *this;
+  }
+  TriangulateBatchData operator+(const TriangulateBatchData& other) const
+  {
+    TriangulateBatchData result = *this;
+    result += other;
+    return result;
+  }
+};
+using TriangulateBatch = vtkBatch<TriangulateBatchData>;
+using TriangulateBatches = vtkBatches<TriangulateBatchData>;
 
-  bool abort = false;
-  updateInterval = numCells / 100 + 1;
-  outCD->CopyAllocate(inCD, numCells);
+// Common machinery to traverse the input cells by batches. Input cells are
+// numbered across the verts, lines, polys and strips, in this order.
+struct TriangulateBase
+{
+  vtkCellArray* InCells[4];
+  vtkIdType CellOffsets[5];
+  TriangulateBatches& Batches;
+  vtkTriangleFilter* Filter;
+  vtkSMPThreadLocalObject<vtkIdList> PtIds;
 
-  // Do each of the verts, lines, polys, and strips separately
-  // verts
-  if (input->GetVerts()->GetNumberOfCells() > 0)
+  TriangulateBase(vtkPolyData* input, TriangulateBatches& batches, vtkTriangleFilter* filter)
+    : Batches(batches)
+    , Filter(filter)
   {
-    cells = input->GetVerts();
-    if (this->PassVerts)
+    this->InCells[0] = input->GetVerts();
+    this->InCells[1] = input->GetLines();
+    this->InCells[2] = input->GetPolys();
+    this->InCells[3] = input->GetStrips();
+    this->CellOffsets[0] = 0;
+    for (int i = 0; i < 4; ++i)
     {
-      newId = output->GetNumberOfCells();
-      vtkNew<vtkCellArray> newCells;
-      newCells->AllocateCopy(cells);
-      for (cells->InitTraversal(); cells->GetNextCell(npts, pts) && !abort; cellNum++)
+      this->CellOffsets[i + 1] = this->CellOffsets[i] + this->InCells[i]->GetNumberOfCells();
+    }
+  }
+
+  vtkIdType GetNumberOfCells() const { return this->CellOffsets[4]; }
+
+  // Invoke func(cellId, type, npts, pts) on the cells of a batch, in order.
+  // type is 0 for verts, 1 for lines, 2 for polys and 3 for strips.
+  template <typename TFunc>
+  void ForEachCell(const TriangulateBatch& batch, TFunc&& func)
+  {
+    vtkIdList* ptIds = this->PtIds.Local();
+    vtkIdType npts;
+    const vtkIdType* pts;
+    int type = 0;
+    for (vtkIdType cellId = batch.BeginId; cellId < batch.EndId; ++cellId)
+    {
+      while (cellId >= this->CellOffsets[type + 1])
       {
-        if (!(cellNum % updateInterval)) // manage progress reports / early abort
-        {
-          this->UpdateProgress((float)cellNum / numCells);
-          abort = this->CheckAbort();
-        }
-        if (npts > 1)
-        {
-          for (i = 0; i < npts; i++)
-          {
-            newCells->InsertNextCell(1, pts + i);
-            outCD->CopyData(inCD, cellNum, newId++);
-          }
-        }
-        else
-        {
-          newCells->InsertNextCell(1, pts);
-          outCD->CopyData(inCD, cellNum, newId++);
-        }
+        ++type;
       }
-      output->SetVerts(newCells);
+      this->InCells[type]->GetCellAtId(cellId - this->CellOffsets[type], npts, pts, ptIds);
+      func(cellId, type, npts, pts);
     }
-    else
+  }
+
+  bool IsAborted(bool isFirst)
+  {
+    if (isFirst)
     {
-      cellNum += cells->GetNumberOfCells(); // skip over verts
+      this->Filter->CheckAbort();
     }
+    return this->Filter->GetAbortOutput();
+  }
+};
+
+// Count the output cells of every batch. Polygons that are not triangles are
+// triangulated here, and their triangles are kept per batch, prefixed by
+// their number, for the second pass.
+struct CountCells : public TriangulateBase
+{
+  vtkPoints* InPoints;
+  vtkTypeBool PassVerts;
+  vtkTypeBool PassLines;
+  double Tolerance;
+  std::vector<std::vector<vtkIdType>>& Triangulations;
+  vtkSMPThreadLocalObject<vtkPolygon> Polygon;
+  vtkSMPThreadLocalObject<vtkIdList> TriIds;
+
+  CountCells(vtkPolyData* input, TriangulateBatches& batches, vtkTriangleFilter* filter,
+    std::vector<std::vector<vtkIdType>>& triangulations)
+    : TriangulateBase(input, batches, filter)
+    , InPoints(input->GetPoints())
+    , PassVerts(filter->GetPassVerts())
+    , PassLines(filter->GetPassLines())
+    , Tolerance(filter->GetTolerance())
+    , Triangulations(triangulations)
+  {
   }
 
-  // lines
-  if (!abort && input->GetLines()->GetNumberOfCells() > 0)
+  void Initialize()
   {
-    cells = input->GetLines();
-    if (this->PassLines)
+    // It may be necessary to specify a custom tessellation tolerance.
+    if (this->Tolerance > 0.0)
     {
-      newId = output->GetNumberOfCells();
-      vtkNew<vtkCellArray> newCells;
-      newCells->AllocateCopy(cells);
-      for (cells->InitTraversal(); cells->GetNextCell(npts, pts) && !abort; cellNum++)
+      this->Polygon.Local()->SetTolerance(this->Tolerance); // Tighten tessellation tolerance
+    }
+  }
+
+  void operator()(vtkIdType batchId, vtkIdType endBatchId)
+  {
+    vtkPolygon* poly = this->Polygon.Local();
+    vtkIdList* triIds = this->TriIds.Local();
+    double x[3];
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; batchId < endBatchId; ++batchId)
+    {
+      if (this->IsAborted(isFirst))
       {
-        if (!(cellNum % updateInterval)) // manage progress reports / early abort
+        break;
+      }
+      TriangulateBatch& batch = this->Batches[batchId];
+      std::vector<vtkIdType>& triangulation = this->Triangulations[batchId];
+      this->ForEachCell(batch, [&](vtkIdType, int type, vtkIdType npts, const vtkIdType* pts) {
+        if (type == 0 && this->PassVerts && npts > 0)
+        {
+          batch.Data.NumberOfCells[VertKind] += npts;
+        }
+        else if (type == 1 && this->PassLines && npts > 1)
         {
-          this->UpdateProgress((float)cellNum / numCells);
-          abort = this->CheckAbort();
+          batch.Data.NumberOfCells[LineKind] += npts - 1;
         }
-        if (npts > 2)
+        else if (type == 2 && npts == 3)
         {
-          for (i = 0; i < (npts - 1); i++)
+          batch.Data.NumberOfCells[TriangleKind]++;
+        }
+        else if (type == 2 && npts > 0)
+        {
+          // triangulate polygon
+          poly->PointIds->SetNumberOfIds(npts);
+          poly->Points->SetNumberOfPoints(npts);
+          for (vtkIdType i = 0; i < npts; i++)
+          {
+            poly->PointIds->SetId(i, pts[i]);
+            this->InPoints->GetPoint(pts[i], x);
+            poly->Points->SetPoint(i, x);
+          }
+          poly->TriangulateLocalIds(0, triIds);
+          const vtkIdType numTris = triIds->GetNumberOfIds() / 3;
+          triangulation.push_back(numTris);
+          for (vtkIdType i = 0; i < 3 * numTris; i++)
           {
-            newCells->InsertNextCell(2, pts + i);
-            outCD->CopyData(inCD, cellNum, newId++);
+            triangulation.push_back(pts[triIds->GetId(i)]);
           }
+          batch.Data.NumberOfCells[TriangleKind] += numTris;
         }
-        else
+        else if (type == 3 && npts > 2)
         {
-          newCells->InsertNextCell(2, pts);
-          outCD->CopyData(inCD, cellNum, newId++);
+          batch.Data.NumberOfCells[TriangleKind] += npts - 2;
         }
-      } // for all lines
-      output->SetLines(newCells);
-    }
-    else
-    {
-      cellNum += cells->GetNumberOfCells(); // skip over lines
+      });
     }
   }
 
-  // Output from polygons and triangle strips cell arrays are placed
-  // in newPolys.
-  vtkSmartPointer<vtkCellArray> newPolys;
-  if (!abort && input->GetPolys()->GetNumberOfCells() > 0)
+  void Reduce() {}
+};
+
+// Write the output cells of every batch at the offsets computed from the
+// counts. All the output cells have a fixed size, so the offsets of the cell
+// arrays follow from the cell ids.
+struct GenerateCells : public TriangulateBase
+{
+  vtkTypeBool PassVerts;
+  vtkTypeBool PassLines;
+  const std::vector<std::vector<vtkIdType>>& Triangulations;
+  vtkIdType* Connectivity[NumberOfKinds];
+  vtkIdType OutCellOffsets[NumberOfKinds];
+  ArrayList* CellArrays;
+
+  GenerateCells(vtkPolyData* input, TriangulateBatches& batches, vtkTriangleFilter* filter,
+    const std::vector<std::vector<vtkIdType>>& triangulations,
+    vtkIdTypeArray* connectivity[NumberOfKinds], const TriangulateBatchData& totals,
+    ArrayList* cellArrays)
+    : TriangulateBase(input, batches, filter)
+    , PassVerts(filter->GetPassVerts())
+    , PassLines(filter->GetPassLines())
+    , Triangulations(triangulations)
+    , CellArrays(cellArrays)
   {
-    cells = input->GetPolys();
-    newId = output->GetNumberOfCells();
-    newPolys = vtkSmartPointer<vtkCellArray>::New();
-    newPolys->AllocateCopy(cells);
-    output->SetPolys(newPolys);
-    vtkNew<vtkIdList> ptIds;
-    ptIds->Allocate(VTK_CELL_SIZE);
-    int numSimplices;
-    vtkIdType triPts[3];
-    // It may be necessary to specify a custom tessellation
-    // tolerance.
-    vtkNew<vtkPolygon> poly;
-    if (this->Tolerance > 0.0)
+    vtkIdType outCellOffset = 0;
+    for (int kind = 0; kind < NumberOfKinds; ++kind)
     {
-      poly->SetTolerance(this->Tolerance); // Tighten tessellation tolerance
+      this->Connectivity[kind] = connectivity[kind]->GetPointer(0);
+      this->OutCellOffsets[kind] = outCellOffset;
+      outCellOffset += totals.NumberOfCells[kind];
     }
+  }
+
+  void Initialize() {}
 
-    for (cells->InitTraversal(); cells->GetNextCell(npts, pts) && !abort; cellNum++)
+  void operator()(vtkIdType batchId, vtkIdType endBatchId)
+  {
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; batchId < endBatchId; ++batchId)
     {
-      if (!(cellNum % updateInterval)) // manage progress reports / early abort
-      {
-        this->UpdateProgress((float)cellNum / numCells);
-        abort = this->CheckAbort();
-      }
-      if (npts == 0)
-      {
-        continue;
-      }
-      if (npts == 3)
+      if (this->IsAborted(isFirst))
       {
-        newPolys->InsertNextCell(3, pts);
-        outCD->CopyData(inCD, cellNum, newId++);
+        break;
       }
-      else // triangulate polygon
-      {
-        // initialize polygon
-        poly->PointIds->SetNumberOfIds(npts);
-        poly->Points->SetNumberOfPoints(npts);
-        for (i = 0; i < npts; i++)
+      const TriangulateBatch& batch = this->Batches[batchId];
+      TriangulateBatchData offsets = batch.Data;
+      const vtkIdType* triangulation = this->Triangulations[batchId].data();
+      auto insertCell = [&](vtkIdType cellId, int kind, vtkIdType p0, vtkIdType p1, vtkIdType p2) {
+        vtkIdType& outCellId = offsets.NumberOfCells[kind];
+        vtkIdType* outPts = this->Connectivity[kind] + (kind + 1) * outCellId;
+        const vtkIdType cellPts[3] = { p0, p1, p2 };
+        for (int i = 0; i <= kind; ++i)
         {
-          poly->PointIds->SetId(i, pts[i]);
-          poly->Points->SetPoint(i, inPts->GetPoint(pts[i]));
+          outPts[i] = cellPts[i];
         }
-        poly->TriangulateLocalIds(0, ptIds);
-        numPts = ptIds->GetNumberOfIds();
-        numSimplices = numPts / 3;
-        for (i = 0; i < numSimplices; i++)
-        {
-          for (j = 0; j < 3; j++)
+        this->CellArrays->Copy(cellId, this->OutCellOffsets[kind] + outCellId);
+        outCellId++;
+      };
+      this->ForEachCell(
+        batch, [&](vtkIdType cellId, int type, vtkIdType npts, const vtkIdType* pts) {
+          if (type == 0 && this->PassVerts)
+          {
+            for (vtkIdType i = 0; i < npts; i++)
+            {
+              insertCell(cellId, VertKind, pts[i], -1, -1);
+            }
+          }
+          else if (type == 1 && this->PassLines)
           {
-            triPts[j] = poly->PointIds->GetId(ptIds->GetId(3 * i + j));
+            for (vtkIdType i = 0; i < (npts - 1); i++)
+            {
+              insertCell(cellId, LineKind, pts[i], pts[i + 1], -1);
+            }
           }
-          newPolys->InsertNextCell(3, triPts);
-          outCD->CopyData(inCD, cellNum, newId++);
-        } // for each simplex
-      }   // triangulate polygon
+          else if (type == 2 && npts == 3)
+          {
+            insertCell(cellId, TriangleKind, pts[0], pts[1], pts[2]);
+          }
+          else if (type == 2 && npts > 0)
+          {
+            const vtkIdType numTris = *triangulation++;
+            for (vtkIdType i = 0; i < numTris; i++, triangulation += 3)
+            {
+              insertCell(
+                cellId, TriangleKind, triangulation[0], triangulation[1], triangulation[2]);
+            }
+          }
+          else if (type == 3)
+          {
+            // flip the ordering of every other triangle to preserve consistency
+            for (vtkIdType i = 0; i < (npts - 2); i++)
+            {
+              if (i % 2)
+              {
+                insertCell(cellId, TriangleKind, pts[i + 1], pts[i], pts[i + 2]);
+              }
+              else
+              {
+                insertCell(cellId, TriangleKind, pts[i], pts[i + 1], pts[i + 2]);
+              }
+            }
+          }
+        });
     }
   }
 
-  // strips
-  if (!abort && input->GetStrips()->GetNumberOfCells() > 0)
+  void Reduce() {}
+};
+} // anonymous namespace
+
+//-------------------------------------------------------------------------
+int vtkTriangleFilter::RequestData(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  // get the info objects
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+
+  // get the input and output
+  vtkPolyData* input = vtkPolyData::SafeDownCast(inInfo->Get(vtkDataObject::DATA_OBJECT()));
+  vtkPolyData* output = vtkPolyData::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
+
+  vtkCellData* inCD = input->GetCellData();
+  vtkCellData* outCD = output->GetCellData();
+
+  // The cells are processed in batches: a first pass counts the output cells
+  // of each batch (triangulating the polygons), the counts are turned into
+  // offsets, and a second pass writes the output cells in place. Output
+  // cells are ordered as the input cells they come from: verts, lines, then
+  // triangles from the polys and the strips.
+  TriangulateBatches batches;
+  std::vector<std::vector<vtkIdType>> triangulations;
+  CountCells countCells(input, batches, this, triangulations);
+  const vtkIdType numCells = countCells.GetNumberOfCells();
+  if (numCells > 0)
+  {
+    batches.Initialize(numCells);
+    triangulations.resize(batches.GetNumberOfBatches());
+    vtkSMPTools::For(0, batches.GetNumberOfBatches(), countCells);
+  }
+  const TriangulateBatchData totals = batches.BuildOffsetsAndGetGlobalSum();
+  this->UpdateProgress(0.5);
+
+  vtkSmartPointer<vtkIdTypeArray> connectivity[NumberOfKinds];
+  vtkIdTypeArray* connectivityPtrs[NumberOfKinds];
+  vtkIdType numOutCells = 0;
+  for (int kind = 0; kind < NumberOfKinds; ++kind)
+  {
+    connectivity[kind] = vtkSmartPointer<vtkIdTypeArray>::New();
+    connectivity[kind]->SetNumberOfValues((kind + 1) * totals.NumberOfCells[kind]);
+    connectivityPtrs[kind] = connectivity[kind];
+    numOutCells += totals.NumberOfCells[kind];
+  }
+  outCD->CopyAllocate(inCD, numOutCells);
+  ArrayList cellArrays;
+  cellArrays.AddArrays(numOutCells, inCD, outCD, 0.0, false);
+
+  if (numCells > 0 && !this->CheckAbort())
+  {
+    GenerateCells generateCells(
+      input, batches, this, triangulations, connectivityPtrs, totals, &cellArrays);
+    vtkSMPTools::For(0, batches.GetNumberOfBatches(), generateCells);
+  }
+
+  // Update output
+  for (int kind = 0; kind < NumberOfKinds; ++kind)
   {
-    cells = input->GetStrips();
-    newId = output->GetNumberOfCells();
-    if (newPolys == nullptr)
+    if (totals.NumberOfCells[kind] == 0)
     {
-      newPolys = vtkSmartPointer<vtkCellArray>::New();
-      newPolys->AllocateCopy(cells);
-      output->SetPolys(newPolys);
+      continue;
     }
-    for (cells->InitTraversal(); cells->GetNextCell(npts, pts) && !abort; cellNum++)
+    vtkNew<vtkCellArray> newCells;
+    newCells->SetData(kind + 1, connectivity[kind]);
+    if (kind == VertKind)
     {
-      if (!(cellNum % updateInterval)) // manage progress reports / early abort
-      {
-        this->UpdateProgress((float)cellNum / numCells);
-        abort = this->CheckAbort();
-      }
-      vtkTriangleStrip::DecomposeStrip(npts, pts, newPolys);
-      for (i = 0; i < (npts - 2); i++)
-      {
-        outCD->CopyData(inCD, cellNum, newId++);
-      }
-    } // for all strips
+      output->SetVerts(newCells);
+    }
+    else if (kind == LineKind)
+    {
+      output->SetLines(newCells);
+    }
+    else
+    {
+      output->SetPolys(newCells);
+    }
   }
-
-  // Update output
   output->SetPoints(input->GetPoints());
   output->GetPointData()->PassData(input->GetPointData());
-  output->Squeeze();
 
   vtkDebugMacro(<< "Converted " << input->GetNumberOfCells() << "input cells to "
                 << output->GetNumberOfCells() << " output cells");
@@ -8,6 +8,10 @@
  * strips.  It also generates line segments from polylines unless PassLines
  * is off, and generates individual vertex cells from vtkVertex point lists
  * unless PassVerts is off.
+ *
+ * The cells are processed in parallel with vtkSMPTools. The output cells
+ * keep the order of the input cells they come from: vertices first, then
+ * lines, then the triangles of the polygons and of the strips.
  */
 
 #ifndef vtkTriangleFilter_h
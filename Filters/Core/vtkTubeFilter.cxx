@@ -2,18 +2,25 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkTubeFilter.h"
 
+#include "vtkArrayListTemplate.h"
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
+#include "vtkDoubleArray.h"
 #include "vtkFloatArray.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPolyLine.h"
+#include "vtkSMPTools.h"
 
 #include <algorithm>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkTubeFilter);
@@ -71,6 +78,81 @@ struct IdPointsEqual
   vtkPoints* Points;
 };
 
+// Scratch data used to tube one polyline at a time. Each thread uses its
+// own instance.
+struct LineScratch
+{
+  vtkNew<vtkIdList> CellIds;
+  std::vector<vtkIdType> Pts;
+  vtkNew<vtkPoints> Points;
+  vtkNew<vtkCellArray> Line;
+  vtkNew<vtkDoubleArray> Normals;
+
+  LineScratch()
+  {
+    this->Points->SetDataTypeToDouble();
+    this->Normals->SetNumberOfComponents(3);
+  }
+
+  // Copy the point ids of a polyline without its duplicate consecutive
+  // points, and compute the normals of these points. Each polyline computes
+  // its normals independently, avoiding conflicts at shared vertices.
+  // Returns the number of points of the polyline.
+  vtkIdType PrepareLine(vtkCellArray* lines, vtkIdType lineId, vtkPoints* inPts,
+    vtkDataArray* inNormals, const double defaultNormal[3], bool generateNormals)
+  {
+    vtkIdType npts;
+    const vtkIdType* pts;
+    lines->GetCellAtId(lineId, npts, pts, this->CellIds);
+    if (npts < 2)
+    {
+      return 0;
+    }
+    this->Pts.assign(pts, pts + npts);
+
+    // remove degenerate lines to avoid warnings
+    npts = static_cast<vtkIdType>(
+      std::unique(this->Pts.begin(), this->Pts.end(), IdPointsEqual(inPts)) - this->Pts.begin());
+    if (npts < 2)
+    {
+      return 0;
+    }
+
+    this->Normals->SetNumberOfTuples(npts);
+    if (generateNormals)
+    {
+      this->Points->SetNumberOfPoints(npts);
+      this->Line->Reset();
+      this->Line->InsertNextCell(static_cast<int>(npts));
+      double x[3];
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        inPts->GetPoint(this->Pts[i], x);
+        this->Points->SetPoint(i, x);
+        this->Line->InsertCellPoint(i);
+      }
+      vtkPolyLine::GenerateSlidingNormals(this->Points, this->Line, this->Normals);
+    }
+    else
+    {
+      double n[3];
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        if (inNormals)
+        {
+          inNormals->GetTuple(this->Pts[i], n);
+          this->Normals->SetTuple(i, n);
+        }
+        else
+        {
+          this->Normals->SetTuple(i, defaultNormal);
+        }
+      }
+    }
+    return npts;
+  }
+};
+
 }
 
 int vtkTubeFilter::RequestData(vtkInformation* vtkNotUsed(request),
@@ -96,19 +178,12 @@ int vtkTubeFilter::RequestData(vtkInformation* vtkNotUsed(request),
   vtkPoints* inPts;
   vtkIdType numPts;
   vtkIdType numLines;
-  vtkIdType numNewPts, numNewCells;
+  vtkIdType numNewPts, numNewCells, connSize;
   vtkPoints* newPts;
-  int deleteNormals = 0;
   vtkFloatArray* newNormals;
-  vtkIdType i;
   double range[2], maxSpeed = 0;
   vtkCellArray* newStrips;
-  vtkIdType npts = 0;
-  const vtkIdType* ptsOrig = nullptr;
-  vtkIdType offset = 0;
   vtkFloatArray* newTCoords = nullptr;
-  bool abort = false;
-  vtkIdType inCellId;
   double oldRadius = 1.0;
 
   // Check input and initialize
@@ -121,68 +196,17 @@ int vtkTubeFilter::RequestData(vtkInformation* vtkNotUsed(request),
     return 1;
   }
 
-  // Create the geometry and topology
-  numNewPts = numPts * this->NumberOfSides;
-  newPts = vtkPoints::New();
-
-  // Set the desired precision for the points in the output.
-  if (this->OutputPointsPrecision == vtkAlgorithm::DEFAULT_PRECISION)
-  {
-    newPts->SetDataType(inPts->GetDataType());
-  }
-  else if (this->OutputPointsPrecision == vtkAlgorithm::SINGLE_PRECISION)
-  {
-    newPts->SetDataType(VTK_FLOAT);
-  }
-  else if (this->OutputPointsPrecision == vtkAlgorithm::DOUBLE_PRECISION)
-  {
-    newPts->SetDataType(VTK_DOUBLE);
-  }
-
-  newPts->Allocate(numNewPts);
-  newNormals = vtkFloatArray::New();
-  newNormals->SetName("TubeNormals");
-  newNormals->SetNumberOfComponents(3);
-  newNormals->Allocate(3 * numNewPts);
-  newStrips = vtkCellArray::New();
-  newStrips->AllocateEstimate(1, numNewPts);
-  vtkCellArray* singlePolyline = vtkCellArray::New();
-
-  // Point data: copy scalars, vectors, tcoords. Normals may be computed here.
-  outPD->CopyNormalsOff();
-  if ((this->GenerateTCoords == VTK_TCOORDS_FROM_SCALARS && inScalars) ||
-    this->GenerateTCoords == VTK_TCOORDS_FROM_LENGTH ||
-    this->GenerateTCoords == VTK_TCOORDS_FROM_NORMALIZED_LENGTH)
+  bool generateNormals = false;
+  if (this->UseDefaultNormal)
   {
-    newTCoords = vtkFloatArray::New();
-    newTCoords->SetNumberOfComponents(2);
-    newTCoords->Allocate(numNewPts);
-    outPD->CopyTCoordsOff();
+    inNormals = nullptr;
   }
-  outPD->CopyAllocate(pd, numNewPts);
-
-  int generateNormals = 0;
-  if (!(inNormals = pd->GetNormals()) || this->UseDefaultNormal)
+  else if (!(inNormals = pd->GetNormals()))
   {
-    deleteNormals = 1;
-    inNormals = vtkFloatArray::New();
-    inNormals->SetNumberOfComponents(3);
-    inNormals->SetNumberOfTuples(numPts);
-
-    if (this->UseDefaultNormal)
-    {
-      for (i = 0; i < numPts; i++)
-      {
-        inNormals->SetTuple(i, this->DefaultNormal);
-      }
-    }
-    else
-    {
-      // Normal generation has been moved to lower in the function.
-      // This allows each different polylines to share vertices, but have
-      // their normals (and hence their tubes) calculated independently
-      generateNormals = 1;
-    }
+    // Normals are generated for each polyline independently. This allows
+    // different polylines to share vertices, but have their normals (and
+    // hence their tubes) calculated independently.
+    generateNormals = true;
   }
 
   // If varying width, get appropriate info.
@@ -214,83 +238,159 @@ int vtkTubeFilter::RequestData(vtkInformation* vtkNotUsed(request),
     maxSpeed = inVectors->GetMaxNorm();
   }
 
-  // Copy selected parts of cell data; certainly don't want normals
-  //
-  numNewCells = inLines->GetNumberOfCells() * this->NumberOfSides + 2;
-  outCD->CopyNormalsOff();
-  outCD->CopyAllocate(cd, numNewCells);
-
-  //  Create points along each polyline that are connected into NumberOfSides
-  //  triangle strips. Texture coordinates are optionally generated.
-  //
   this->Theta = 2.0 * vtkMath::Pi() / this->NumberOfSides;
-  vtkPolyLine* lineNormalGenerator = vtkPolyLine::New();
-  // the line cellIds start after the last vert cellId
-  inCellId = input->GetNumberOfVerts();
-  int checkAbortInterval = std::min(numLines / 10 + 1, (vtkIdType)1000);
-  int progressCounter = 0;
-  for (inLines->InitTraversal(); inLines->GetNextCell(npts, ptsOrig) && !abort; inCellId++)
+
+  // First pass: count the points, cells and connectivity entries generated
+  // by each polyline. Polylines that cannot be tubed generate nothing.
+  std::vector<vtkIdType> pointOffsets(numLines + 1, 0);
+  std::vector<vtkIdType> cellOffsets(numLines + 1, 0);
+  std::vector<vtkIdType> connOffsets(numLines + 1, 0);
+  vtkSMPTools::For(0, numLines, [&](vtkIdType lineId, vtkIdType endLineId) {
+    LineScratch scratch;
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; lineId < endLineId; ++lineId)
+    {
+      if (isFirst)
+      {
+        this->CheckAbort();
+      }
+      if (this->GetAbortOutput())
+      {
+        break;
+      }
+      vtkIdType npts = scratch.PrepareLine(
+        inLines, lineId, inPts, inNormals, this->DefaultNormal, generateNormals);
+      if (npts < 2)
+      {
+        continue; // skip tubing this polyline
+      }
+      if (!this->GeneratePoints(0, npts, scratch.Pts.data(), inPts, nullptr, nullptr, nullptr,
+            inScalars, range, inVectors, maxSpeed, scratch.Normals))
+      {
+        vtkWarningMacro(<< "Could not generate points!");
+        continue; // skip tubing this polyline
+      }
+      pointOffsets[lineId] = this->ComputeOffset(0, npts);
+      cellOffsets[lineId] = this->ComputeNumberOfCells();
+      connOffsets[lineId] = this->ComputeConnectivitySize(npts);
+    }
+  });
+  this->UpdateProgress(0.1);
+  if (this->GetAbortOutput())
   {
-    this->UpdateProgress((double)inCellId / numLines);
-    if (progressCounter % checkAbortInterval == 0 && this->CheckAbort())
+    if (this->VaryRadius == VTK_VARY_RADIUS_BY_ABSOLUTE_SCALAR)
     {
-      abort = this->CheckAbort();
-      break;
+      this->Radius = oldRadius;
     }
-    progressCounter++;
+    return 1;
+  }
 
-    // Make a copy of point indices to avoid modifying input polydata cells
-    // while removing degenerate lines.
-    if (npts < 2)
-    {
-      continue; // skip tubing this polyline
-    }
-    std::vector<vtkIdType> ptsCopy(ptsOrig, ptsOrig + npts);
-    vtkIdType* pts = ptsCopy.data();
+  vtkSMPTools::ExclusiveScan(
+    pointOffsets.begin(), pointOffsets.end(), pointOffsets.begin(), vtkIdType(0));
+  vtkSMPTools::ExclusiveScan(
+    cellOffsets.begin(), cellOffsets.end(), cellOffsets.begin(), vtkIdType(0));
+  vtkSMPTools::ExclusiveScan(
+    connOffsets.begin(), connOffsets.end(), connOffsets.begin(), vtkIdType(0));
+  numNewPts = pointOffsets[numLines];
+  numNewCells = cellOffsets[numLines];
+  connSize = connOffsets[numLines];
 
-    // remove degenerate lines to avoid warnings
-    npts = static_cast<vtkIdType>(std::unique(pts, pts + npts, IdPointsEqual(inPts)) - pts);
-    if (npts < 2)
-    {
-      continue; // skip tubing this polyline
-    }
+  // Create the geometry and topology
+  newPts = vtkPoints::New();
 
-    // If necessary calculate normals, each polyline calculates its
-    // normals independently, avoiding conflicts at shared vertices.
-    if (generateNormals)
-    {
-      singlePolyline->Reset(); // avoid instantiation
-      singlePolyline->InsertNextCell(npts, pts);
-      vtkPolyLine::GenerateSlidingNormals(inPts, singlePolyline, inNormals);
-    }
+  // Set the desired precision for the points in the output.
+  if (this->OutputPointsPrecision == vtkAlgorithm::DEFAULT_PRECISION)
+  {
+    newPts->SetDataType(inPts->GetDataType());
+  }
+  else if (this->OutputPointsPrecision == vtkAlgorithm::SINGLE_PRECISION)
+  {
+    newPts->SetDataType(VTK_FLOAT);
+  }
+  else if (this->OutputPointsPrecision == vtkAlgorithm::DOUBLE_PRECISION)
+  {
+    newPts->SetDataType(VTK_DOUBLE);
+  }
 
-    // Generate the points around the polyline. The tube is not stripped
-    // if the polyline is bad.
-    //
-    if (!this->GeneratePoints(offset, npts, pts, inPts, newPts, pd, outPD, newNormals, inScalars,
-          range, inVectors, maxSpeed, inNormals))
-    {
-      vtkWarningMacro(<< "Could not generate points!");
-      continue; // skip tubing this polyline
-    }
+  newPts->SetNumberOfPoints(numNewPts);
+  newNormals = vtkFloatArray::New();
+  newNormals->SetName("TubeNormals");
+  newNormals->SetNumberOfComponents(3);
+  newNormals->SetNumberOfTuples(numNewPts);
+  vtkNew<vtkIdTypeArray> stripOffsets;
+  stripOffsets->SetNumberOfValues(numNewCells + 1);
+  stripOffsets->SetValue(numNewCells, connSize);
+  vtkNew<vtkIdTypeArray> stripConn;
+  stripConn->SetNumberOfValues(connSize);
 
-    // Generate the strips for this polyline (including caps)
-    //
-    this->GenerateStrips(offset, npts, pts, inCellId, cd, outCD, newStrips);
+  // Point data: copy scalars, vectors, tcoords. Normals may be computed here.
+  outPD->CopyNormalsOff();
+  if ((this->GenerateTCoords == VTK_TCOORDS_FROM_SCALARS && inScalars) ||
+    this->GenerateTCoords == VTK_TCOORDS_FROM_LENGTH ||
+    this->GenerateTCoords == VTK_TCOORDS_FROM_NORMALIZED_LENGTH)
+  {
+    newTCoords = vtkFloatArray::New();
+    newTCoords->SetNumberOfComponents(2);
+    newTCoords->SetNumberOfTuples(numNewPts);
+    outPD->CopyTCoordsOff();
+  }
+  outPD->CopyAllocate(pd, numNewPts);
+  ArrayList pointArrays;
+  pointArrays.AddArrays(numNewPts, pd, outPD, 0.0, false);
 
-    // Generate the texture coordinates for this polyline
-    //
-    if (newTCoords)
-    {
-      this->GenerateTextureCoords(offset, npts, pts, inPts, inScalars, newTCoords);
-    }
+  // Copy selected parts of cell data; certainly don't want normals
+  //
+  outCD->CopyNormalsOff();
+  outCD->CopyAllocate(cd, numNewCells);
+  ArrayList cellArrays;
+  cellArrays.AddArrays(numNewCells, cd, outCD, 0.0, false);
+
+  //  Second pass: create points along each polyline that are connected into
+  //  NumberOfSides triangle strips. Texture coordinates are optionally
+  //  generated. The line cellIds start after the last vert cellId.
+  //
+  const vtkIdType numVerts = input->GetNumberOfVerts();
+  vtkSMPTools::For(0, numLines, [&](vtkIdType lineId, vtkIdType endLineId) {
+    LineScratch scratch;
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    vtkIdType checkAbortInterval = std::min((endLineId - lineId) / 10 + 1, (vtkIdType)1000);
+    for (vtkIdType progressCounter = 0; lineId < endLineId; ++lineId, ++progressCounter)
+    {
+      if (progressCounter % checkAbortInterval == 0)
+      {
+        if (isFirst)
+        {
+          this->CheckAbort();
+        }
+        if (this->GetAbortOutput())
+        {
+          break;
+        }
+      }
+      const vtkIdType offset = pointOffsets[lineId];
+      if (pointOffsets[lineId + 1] == offset)
+      {
+        continue; // this polyline is not tubed
+      }
+      vtkIdType npts = scratch.PrepareLine(
+        inLines, lineId, inPts, inNormals, this->DefaultNormal, generateNormals);
+      const vtkIdType* pts = scratch.Pts.data();
 
-    // Compute the new offset for the next polyline
-    offset = this->ComputeOffset(offset, npts);
+      // Generate the points around the polyline.
+      this->GeneratePoints(offset, npts, pts, inPts, newPts, &pointArrays, newNormals, inScalars,
+        range, inVectors, maxSpeed, scratch.Normals);
 
-  } // for all polylines
+      // Generate the strips for this polyline (including caps)
+      this->GenerateStrips(offset, npts, numVerts + lineId, cellOffsets[lineId],
+        connOffsets[lineId], &cellArrays, stripOffsets->GetPointer(0), stripConn->GetPointer(0));
 
-  singlePolyline->Delete();
+      // Generate the texture coordinates for this polyline
+      if (newTCoords)
+      {
+        this->GenerateTextureCoords(offset, npts, pts, inPts, inScalars, newTCoords);
+      }
+    }
+  });
 
   // reset the radius to ite original value if necessary
   if (this->VaryRadius == VTK_VARY_RADIUS_BY_ABSOLUTE_SCALAR)
@@ -300,11 +400,6 @@ int vtkTubeFilter::RequestData(vtkInformation* vtkNotUsed(request),
 
   // Update ourselves
   //
-  if (deleteNormals)
-  {
-    inNormals->Delete();
-  }
-
   if (newTCoords)
   {
     outPD->SetTCoords(newTCoords);
@@ -314,12 +409,13 @@ int vtkTubeFilter::RequestData(vtkInformation* vtkNotUsed(request),
   output->SetPoints(newPts);
   newPts->Delete();
 
+  newStrips = vtkCellArray::New();
+  newStrips->SetData(stripOffsets, stripConn);
   output->SetStrips(newStrips);
   newStrips->Delete();
 
   outPD->SetNormals(newNormals);
   newNormals->Delete();
-  lineNormalGenerator->Delete();
 
   output->Squeeze();
 
@@ -327,9 +423,9 @@ int vtkTubeFilter::RequestData(vtkInformation* vtkNotUsed(request),
 }
 
 int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdType* pts,
-  vtkPoints* inPts, vtkPoints* newPts, vtkPointData* pd, vtkPointData* outPD,
-  vtkFloatArray* newNormals, vtkDataArray* inScalars, double range[2], vtkDataArray* inVectors,
-  double maxSpeed, vtkDataArray* inNormals)
+  vtkPoints* inPts, vtkPoints* newPts, ArrayList* pointArrays, vtkFloatArray* newNormals,
+  vtkDataArray* inScalars, double range[2], vtkDataArray* inVectors, double maxSpeed,
+  vtkDataArray* lineNormals)
 {
   vtkIdType j;
   int i, k;
@@ -388,7 +484,7 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
       }
     }
 
-    inNormals->GetTuple(pts[j], n);
+    lineNormals->GetTuple(j, n);
 
     if (vtkMath::Normalize(sNext) == 0.0)
     {
@@ -468,6 +564,11 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
       }
     }
 
+    if (!newPts)
+    {
+      continue; // only checking the polyline
+    }
+
     // create points around line
     if (this->SidesShareVertices)
     {
@@ -478,9 +579,9 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
           normal[i] = w[i] * cos((double)k * this->Theta) + nP[i] * sin((double)k * this->Theta);
           s[i] = p[i] + this->Radius * sFactor * normal[i];
         }
-        newPts->InsertPoint(ptId, s);
-        newNormals->InsertTuple(ptId, normal);
-        outPD->CopyData(pd, pts[j], ptId);
+        newPts->SetPoint(ptId, s);
+        newNormals->SetTuple(ptId, normal);
+        pointArrays->Copy(pts[j], ptId);
         ptId++;
       } // for each side
     }
@@ -505,19 +606,19 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
             nP[i] * sin((double)(k + 0.5) * this->Theta);
           s[i] = p[i] + this->Radius * sFactor * normal[i];
         }
-        newPts->InsertPoint(ptId, s);
-        newNormals->InsertTuple(ptId, n_right);
-        outPD->CopyData(pd, pts[j], ptId);
-        newPts->InsertPoint(ptId + 1, s);
-        newNormals->InsertTuple(ptId + 1, n_left);
-        outPD->CopyData(pd, pts[j], ptId + 1);
+        newPts->SetPoint(ptId, s);
+        newNormals->SetTuple(ptId, n_right);
+        pointArrays->Copy(pts[j], ptId);
+        newPts->SetPoint(ptId + 1, s);
+        newNormals->SetTuple(ptId + 1, n_left);
+        pointArrays->Copy(pts[j], ptId + 1);
         ptId += 2;
       } // for each side
     }   // else separate vertices
   }     // for all points in polyline
 
   // Produce end points for cap. They are placed at tail end of points.
-  if (this->Capping)
+  if (this->Capping && newPts)
   {
     int numCapSides = this->NumberOfSides;
     int capIncr = 1;
@@ -531,9 +632,9 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
     for (k = 0; k < numCapSides; k += capIncr)
     {
       newPts->GetPoint(offset + k, s);
-      newPts->InsertPoint(ptId, s);
-      newNormals->InsertTuple(ptId, startCapNorm);
-      outPD->CopyData(pd, pts[0], ptId);
+      newPts->SetPoint(ptId, s);
+      newNormals->SetTuple(ptId, startCapNorm);
+      pointArrays->Copy(pts[0], ptId);
       ptId++;
     }
     // the end cap
@@ -545,9 +646,9 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
     for (k = 0; k < numCapSides; k += capIncr)
     {
       newPts->GetPoint(endOffset + k, s);
-      newPts->InsertPoint(ptId, s);
-      newNormals->InsertTuple(ptId, endCapNorm);
-      outPD->CopyData(pd, pts[npts - 1], ptId);
+      newPts->SetPoint(ptId, s);
+      newNormals->SetTuple(ptId, endCapNorm);
+      pointArrays->Copy(pts[npts - 1], ptId);
       ptId++;
     }
   } // if capping
@@ -555,11 +656,12 @@ int vtkTubeFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdT
   return 1;
 }
 
-void vtkTubeFilter::GenerateStrips(vtkIdType offset, vtkIdType npts,
-  const vtkIdType* vtkNotUsed(pts), vtkIdType inCellId, vtkCellData* cd, vtkCellData* outCD,
-  vtkCellArray* newStrips)
+void vtkTubeFilter::GenerateStrips(vtkIdType offset, vtkIdType npts, vtkIdType inCellId,
+  vtkIdType outCellId, vtkIdType connOffset, ArrayList* cellArrays, vtkIdType* stripOffsets,
+  vtkIdType* stripConn)
 {
-  vtkIdType i, outCellId;
+  vtkIdType i;
+  vtkIdType* conn = stripConn + connOffset;
   int k;
   int i1, i2, i3;
 
@@ -569,13 +671,13 @@ void vtkTubeFilter::GenerateStrips(vtkIdType offset, vtkIdType npts,
     {
       i1 = k % this->NumberOfSides;
       i2 = (k + 1) % this->NumberOfSides;
-      outCellId = newStrips->InsertNextCell(npts * 2);
-      outCD->CopyData(cd, inCellId, outCellId);
+      stripOffsets[outCellId] = conn - stripConn;
+      cellArrays->Copy(inCellId, outCellId++);
       for (i = 0; i < npts; i++)
       {
         i3 = i * this->NumberOfSides;
-        newStrips->InsertCellPoint(offset + i2 + i3);
-        newStrips->InsertCellPoint(offset + i1 + i3);
+        *conn++ = offset + i2 + i3;
+        *conn++ = offset + i1 + i3;
       }
     } // for each side of the tube
   }
@@ -585,13 +687,13 @@ void vtkTubeFilter::GenerateStrips(vtkIdType offset, vtkIdType npts,
     {
       i1 = 2 * (k % this->NumberOfSides) + 1;
       i2 = 2 * ((k + 1) % this->NumberOfSides);
-      outCellId = newStrips->InsertNextCell(npts * 2);
-      outCD->CopyData(cd, inCellId, outCellId);
+      stripOffsets[outCellId] = conn - stripConn;
+      cellArrays->Copy(inCellId, outCellId++);
       for (i = 0; i < npts; i++)
       {
         i3 = i * 2 * this->NumberOfSides;
-        newStrips->InsertCellPoint(offset + i2 + i3);
-        newStrips->InsertCellPoint(offset + i1 + i3);
+        *conn++ = offset + i2 + i3;
+        *conn++ = offset + i1 + i3;
       }
     } // for each side of the tube
   }
@@ -609,44 +711,44 @@ void vtkTubeFilter::GenerateStrips(vtkIdType offset, vtkIdType npts,
     }
 
     // The start cap
-    outCellId = newStrips->InsertNextCell(this->NumberOfSides);
-    outCD->CopyData(cd, inCellId, outCellId);
-    newStrips->InsertCellPoint(startIdx);
-    newStrips->InsertCellPoint(startIdx + 1);
+    stripOffsets[outCellId] = conn - stripConn;
+    cellArrays->Copy(inCellId, outCellId++);
+    *conn++ = startIdx;
+    *conn++ = startIdx + 1;
     for (i1 = this->NumberOfSides - 1, i2 = 2, k = 0; k < (this->NumberOfSides - 2); k++)
     {
       if ((k % 2))
       {
         idx = startIdx + i2;
-        newStrips->InsertCellPoint(idx);
+        *conn++ = idx;
         i2++;
       }
       else
       {
         idx = startIdx + i1;
-        newStrips->InsertCellPoint(idx);
+        *conn++ = idx;
         i1--;
       }
     }
 
     // The end cap - reversed order to be consistent with normal
     startIdx += this->NumberOfSides;
-    outCellId = newStrips->InsertNextCell(this->NumberOfSides);
-    outCD->CopyData(cd, inCellId, outCellId);
-    newStrips->InsertCellPoint(startIdx);
-    newStrips->InsertCellPoint(startIdx + this->NumberOfSides - 1);
+    stripOffsets[outCellId] = conn - stripConn;
+    cellArrays->Copy(inCellId, outCellId++);
+    *conn++ = startIdx;
+    *conn++ = startIdx + this->NumberOfSides - 1;
     for (i1 = this->NumberOfSides - 2, i2 = 1, k = 0; k < (this->NumberOfSides - 2); k++)
     {
       if ((k % 2))
       {
         idx = startIdx + i1;
-        newStrips->InsertCellPoint(idx);
+        *conn++ = idx;
         i1--;
       }
       else
       {
         idx = startIdx + i2;
-        newStrips->InsertCellPoint(idx);
+        *conn++ = idx;
         i2++;
       }
     }
@@ -677,7 +779,7 @@ void vtkTubeFilter::GenerateTextureCoords(vtkIdType offset, vtkIdType npts, cons
       for (k = 0; k < numSides; k++)
       {
         double tcy = static_cast<double>(k) / (numSides - 1);
-        newTCoords->InsertTuple2(offset + i * numSides + k, tc, tcy);
+        newTCoords->SetTuple2(offset + i * numSides + k, tc, tcy);
       }
     }
   }
@@ -693,7 +795,7 @@ void vtkTubeFilter::GenerateTextureCoords(vtkIdType offset, vtkIdType npts, cons
       for (k = 0; k < numSides; k++)
       {
         double tcy = static_cast<double>(k) / (numSides - 1);
-        newTCoords->InsertTuple2(offset + i * numSides + k, tc, tcy);
+        newTCoords->SetTuple2(offset + i * numSides + k, tc, tcy);
       }
 
       xPrev[0] = x[0];
@@ -723,7 +825,7 @@ void vtkTubeFilter::GenerateTextureCoords(vtkIdType offset, vtkIdType npts, cons
       for (k = 0; k < numSides; k++)
       {
         double tcy = static_cast<double>(k) / (numSides - 1);
-        newTCoords->InsertTuple2(offset + i * numSides + k, tc, tcy);
+        newTCoords->SetTuple2(offset + i * numSides + k, tc, tcy);
       }
       xPrev[0] = x[0];
       xPrev[1] = x[1];
@@ -740,13 +842,13 @@ void vtkTubeFilter::GenerateTextureCoords(vtkIdType offset, vtkIdType npts, cons
     // start cap
     for (ik = 0; ik < this->NumberOfSides; ik++)
     {
-      newTCoords->InsertTuple2(startIdx + ik, 0.0, 0.0);
+      newTCoords->SetTuple2(startIdx + ik, 0.0, 0.0);
     }
 
     // end cap
     for (ik = 0; ik < this->NumberOfSides; ik++)
     {
-      newTCoords->InsertTuple2(startIdx + this->NumberOfSides + ik, tc, 0.0);
+      newTCoords->SetTuple2(startIdx + this->NumberOfSides + ik, tc, 0.0);
     }
   }
 }
@@ -771,6 +873,29 @@ vtkIdType vtkTubeFilter::ComputeOffset(vtkIdType offset, vtkIdType npts)
   return offset;
 }
 
+// Compute the number of cells of this tube
+vtkIdType vtkTubeFilter::ComputeNumberOfCells()
+{
+  // the sides of the tube are generated every OnRatio side
+  vtkIdType numCells = (this->NumberOfSides + this->OnRatio - 1) / this->OnRatio;
+  if (this->Capping)
+  {
+    numCells += 2;
+  }
+  return numCells;
+}
+
+// Compute the size of the connectivity of the cells of this tube
+vtkIdType vtkTubeFilter::ComputeConnectivitySize(vtkIdType npts)
+{
+  vtkIdType size = 2 * npts * ((this->NumberOfSides + this->OnRatio - 1) / this->OnRatio);
+  if (this->Capping)
+  {
+    size += 2 * this->NumberOfSides;
+  }
+  return size;
+}
+
 // Description:
 // Return the method of varying tube radius descriptive character string.
 const char* vtkTubeFilter::GetVaryRadiusAsString()
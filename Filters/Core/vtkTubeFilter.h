@@ -19,6 +19,11 @@
  * interesting effects such as marking the tube with stripes corresponding
  * to length or time.
  *
+ * The polylines are tubed in parallel with vtkSMPTools: a first pass
+ * counts the points and cells generated by each polyline, and a second pass
+ * fills the output at the offsets given by the prefix sums of these counts.
+ * The output is identical to a sequential execution.
+ *
  * This filter is typically used to create thick or dramatic lines. Another
  * common use is to combine this filter with vtkStreamTracer to generate
  * streamtubes.
@@ -64,6 +69,7 @@ class vtkDataArray;
 class vtkFloatArray;
 class vtkPointData;
 class vtkPoints;
+struct ArrayList;
 
 class VTKFILTERSCORE_EXPORT vtkTubeFilter : public vtkPolyDataAlgorithm
 {
@@ -241,17 +247,26 @@ protected:
   int OutputPointsPrecision;
   double TextureLength; // this length is mapped to [0,1) texture space
 
-  // Helper methods
+  // Helper methods. The outputs are allocated beforehand and each polyline
+  // is written at the given offsets, so that polylines can be processed
+  // concurrently. lineNormals holds the normals of the npts points of the
+  // polyline. If newPts is nullptr, GeneratePoints() only checks whether the
+  // polyline can be tubed.
   int GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdType* pts, vtkPoints* inPts,
-    vtkPoints* newPts, vtkPointData* pd, vtkPointData* outPD, vtkFloatArray* newNormals,
+    vtkPoints* newPts, ArrayList* pointArrays, vtkFloatArray* newNormals,
     vtkDataArray* inScalars, double range[2], vtkDataArray* inVectors, double maxSpeed,
-    vtkDataArray* inNormals);
-  void GenerateStrips(vtkIdType offset, vtkIdType npts, const vtkIdType* pts, vtkIdType inCellId,
-    vtkCellData* cd, vtkCellData* outCD, vtkCellArray* newStrips);
+    vtkDataArray* lineNormals);
+  void GenerateStrips(vtkIdType offset, vtkIdType npts, vtkIdType inCellId, vtkIdType outCellId,
+    vtkIdType connOffset, ArrayList* cellArrays, vtkIdType* stripOffsets, vtkIdType* stripConn);
   void GenerateTextureCoords(vtkIdType offset, vtkIdType npts, const vtkIdType* pts,
     vtkPoints* inPts, vtkDataArray* inScalars, vtkFloatArray* newTCoords);
   vtkIdType ComputeOffset(vtkIdType offset, vtkIdType npts);
 
+  // Number of cells and of connectivity entries generated for a polyline
+  // of npts points.
+  vtkIdType ComputeNumberOfCells();
+  vtkIdType ComputeConnectivitySize(vtkIdType npts);
+
   // Helper data members
   double Theta;
 
@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Edit a selection of cell indices several times and check that the
+// incremental vtkExtractSelection extracts the same cells as a full execution.
+
+#include "vtkCellData.h"
+#include "vtkDataArray.h"
+#include "vtkDataSet.h"
+#include "vtkExtractSelection.h"
+#include "vtkIdTypeArray.h"
+#include "vtkImageData.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkSelection.h"
+#include "vtkSelectionNode.h"
+#include "vtkTestUtilities.h"
+
+#include <cstdlib>
+#include <initializer_list>
+
+namespace
+{
+bool Compare(vtkExtractSelection* incremental, vtkExtractSelection* full, const char* arrayName)
+{
+  incremental->Update();
+  full->Update();
+  vtkDataSet* output = vtkDataSet::SafeDownCast(incremental->GetOutput());
+  vtkDataSet* expected = vtkDataSet::SafeDownCast(full->GetOutput());
+  vtkDataArray* array = output ? output->GetCellData()->GetArray(arrayName) : nullptr;
+  vtkDataArray* expectedArray = expected ? expected->GetCellData()->GetArray(arrayName) : nullptr;
+  if (!array || !expectedArray)
+  {
+    vtkLog(ERROR, "Missing " << arrayName);
+    return false;
+  }
+  return vtkTestUtilities::CompareAbstractArray(array, expectedArray);
+}
+}
+
+int TestExtractSelectionIncremental(int, char*[])
+{
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(51, 51, 51);
+
+  vtkNew<vtkIdTypeArray> ids;
+  for (vtkIdType i = 0; i < 1000; ++i)
+  {
+    ids->InsertNextValue((i * 7919) % 125000);
+  }
+  vtkNew<vtkSelectionNode> node;
+  node->SetFieldType(vtkSelectionNode::CELL);
+  node->SetContentType(vtkSelectionNode::INDICES);
+  node->SetSelectionList(ids);
+  vtkNew<vtkSelection> selection;
+  selection->AddNode(node);
+
+  vtkNew<vtkExtractSelection> incremental;
+  incremental->SetInputDataObject(0, image);
+  incremental->SetInputDataObject(1, selection);
+  incremental->IncrementalOn();
+  vtkNew<vtkExtractSelection> full;
+  full->SetInputDataObject(0, image);
+  full->SetInputDataObject(1, selection);
+
+  for (bool preserveTopology : { false, true })
+  {
+    incremental->SetPreserveTopology(preserveTopology);
+    full->SetPreserveTopology(preserveTopology);
+    const char* arrayName = preserveTopology ? "vtkInsidedness" : "vtkOriginalCellIds";
+    if (!Compare(incremental, full, arrayName))
+    {
+      return EXIT_FAILURE;
+    }
+
+    // Add, remove and duplicate some ids
+    for (int edit = 0; edit < 5; ++edit)
+    {
+      for (vtkIdType i = 0; i < 100; ++i)
+      {
+        ids->SetValue((edit * 100 + i) % ids->GetNumberOfValues(), (edit * 31337 + i) % 125000);
+      }
+      ids->InsertNextValue(ids->GetValue(0));
+      ids->Modified();
+      selection->Modified();
+      if (!Compare(incremental, full, arrayName))
+      {
+        vtkLog(ERROR, "Wrong incremental extraction after edit " << edit);
+        return EXIT_FAILURE;
+      }
+    }
+
+    // A modified input is processed from scratch
+    image->SetDimensions(41, 41, 41);
+    if (!Compare(incremental, full, arrayName))
+    {
+      vtkLog(ERROR, "Wrong extraction after the input changed");
+      return EXIT_FAILURE;
+    }
+    image->SetDimensions(51, 51, 51);
+  }
+
+  return EXIT_SUCCESS;
+}
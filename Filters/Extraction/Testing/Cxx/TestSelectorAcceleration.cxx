@@ -0,0 +1,184 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check the value, range and frustum selections on large data sets against
+// the elements they must select: the value and range selections against a
+// brute force evaluation, the frustum selection of the points of a point set
+// against the one of an image data with the same points.
+
+#include "vtkDataArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkExtractSelection.h"
+#include "vtkImageData.h"
+#include "vtkIntArray.h"
+#include "vtkLogger.h"
+#include "vtkLongLongArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSelection.h"
+#include "vtkSelectionNode.h"
+#include "vtkSignedCharArray.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <set>
+#include <vector>
+
+namespace
+{
+// Return the insidedness of the points of input for the selection list
+std::vector<signed char> Select(vtkDataObject* input, vtkAbstractArray* selectionList, int content)
+{
+  vtkNew<vtkSelectionNode> node;
+  node->SetFieldType(vtkSelectionNode::POINT);
+  node->SetContentType(content);
+  node->SetSelectionList(selectionList);
+  vtkNew<vtkSelection> selection;
+  selection->AddNode(node);
+
+  vtkNew<vtkExtractSelection> extract;
+  extract->SetInputDataObject(0, input);
+  extract->SetInputDataObject(1, selection);
+  extract->PreserveTopologyOn();
+  extract->Update();
+
+  std::vector<signed char> result;
+  vtkDataSet* output = vtkDataSet::SafeDownCast(extract->GetOutput());
+  vtkDataArray* insidedness = output ? output->GetPointData()->GetArray("vtkInsidedness") : nullptr;
+  for (vtkIdType i = 0; insidedness && i < insidedness->GetNumberOfTuples(); ++i)
+  {
+    result.push_back(static_cast<signed char>(insidedness->GetComponent(i, 0)));
+  }
+  return result;
+}
+
+bool Check(const std::vector<signed char>& result, const std::vector<signed char>& expected,
+  const char* name)
+{
+  if (result.size() != expected.size())
+  {
+    vtkLog(ERROR, "Wrong number of insidedness values for " << name);
+    return false;
+  }
+  vtkIdType numSelected = 0;
+  for (size_t i = 0; i < result.size(); ++i)
+  {
+    if (result[i] != expected[i])
+    {
+      vtkLog(ERROR, "Wrong insidedness of point " << i << " for " << name);
+      return false;
+    }
+    numSelected += result[i];
+  }
+  if (numSelected == 0 || numSelected == static_cast<vtkIdType>(result.size()))
+  {
+    vtkLog(ERROR, "Trivial selection for " << name);
+    return false;
+  }
+  return true;
+}
+}
+
+int TestSelectorAcceleration(int, char*[])
+{
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(64, 64, 64);
+  image->SetOrigin(-1, -1, -1);
+  image->SetSpacing(2.0 / 63, 2.0 / 63, 2.0 / 63);
+  const vtkIdType numPts = image->GetNumberOfPoints();
+
+  vtkNew<vtkIntArray> dense;
+  dense->SetName("Dense");
+  dense->SetNumberOfTuples(numPts);
+  vtkNew<vtkLongLongArray> sparse;
+  sparse->SetName("Sparse");
+  sparse->SetNumberOfTuples(numPts);
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("Scalars");
+  scalars->SetNumberOfTuples(numPts);
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    dense->SetValue(ptId, static_cast<int>(ptId % 5000));
+    sparse->SetValue(ptId, ptId * 1000003LL);
+    scalars->SetValue(ptId, std::sin(0.001 * ptId));
+  }
+  image->GetPointData()->AddArray(dense);
+  image->GetPointData()->AddArray(sparse);
+  image->GetPointData()->AddArray(scalars);
+
+  // Values, unsorted and with duplicates
+  vtkNew<vtkIntArray> denseValues;
+  denseValues->SetName("Dense");
+  vtkNew<vtkLongLongArray> sparseValues;
+  sparseValues->SetName("Sparse");
+  std::set<vtkIdType> selectedIds;
+  for (vtkIdType i = 0; i < 2000; ++i)
+  {
+    const vtkIdType id = (i * 7919) % 4000;
+    denseValues->InsertNextValue(static_cast<int>(id));
+    sparseValues->InsertNextValue(id * 37 * 1000003LL);
+    selectedIds.insert(id);
+  }
+  std::vector<signed char> expectedDense(numPts), expectedSparse(numPts);
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    expectedDense[ptId] = selectedIds.count(ptId % 5000) ? 1 : 0;
+    expectedSparse[ptId] = (ptId % 37 == 0 && selectedIds.count(ptId / 37)) ? 1 : 0;
+  }
+  if (!Check(Select(image, denseValues, vtkSelectionNode::VALUES), expectedDense, "dense") ||
+    !Check(Select(image, sparseValues, vtkSelectionNode::VALUES), expectedSparse, "sparse"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Overlapping ranges
+  vtkNew<vtkDoubleArray> ranges;
+  ranges->SetName("Scalars");
+  ranges->SetNumberOfComponents(2);
+  const double rangeValues[][2] = { { 0.5, 0.6 }, { -0.2, 0.1 }, { 0.55, 0.7 }, { -0.9, -0.8 } };
+  std::vector<signed char> expectedRanges(numPts, 0);
+  for (const auto& range : rangeValues)
+  {
+    ranges->InsertNextTuple(range);
+    for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+    {
+      const double value = scalars->GetValue(ptId);
+      expectedRanges[ptId] |= (value >= range[0] && value <= range[1]) ? 1 : 0;
+    }
+  }
+  if (!Check(Select(image, ranges, vtkSelectionNode::THRESHOLDS), expectedRanges, "ranges"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Skewed frustum, corner i is on the right if bit 2 is set, on the top if
+  // bit 1 is set and on the far side if bit 0 is set
+  vtkNew<vtkDoubleArray> corners;
+  corners->SetNumberOfComponents(4);
+  for (int i = 0; i < 8; ++i)
+  {
+    const double z = (i & 1) ? 1.5 : -0.3;
+    const double halfWidth = (i & 1) ? 0.9 : 0.3;
+    const double x = 0.2 + ((i & 4) ? halfWidth : -halfWidth);
+    const double y = -0.1 + ((i & 2) ? halfWidth : -halfWidth) + 0.2 * z;
+    corners->InsertNextTuple4(x, y, z, 1.0);
+  }
+  vtkNew<vtkPolyData> pointSet;
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToDouble();
+  points->SetNumberOfPoints(numPts);
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    points->SetPoint(ptId, image->GetPoint(ptId));
+  }
+  pointSet->SetPoints(points);
+  if (!Check(Select(pointSet, corners, vtkSelectionNode::FRUSTUM),
+        Select(image, corners, vtkSelectionNode::FRUSTUM), "frustum"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
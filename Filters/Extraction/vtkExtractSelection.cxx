@@ -9,6 +9,7 @@
 #include "vtkCell.h"
 #include "vtkCellData.h"
 #include "vtkCompositeDataSet.h"
+#include "vtkDataArrayRange.h"
 #include "vtkDataObjectTree.h"
 #include "vtkDataSet.h"
 #include "vtkExtractCells.h"
@@ -34,8 +35,10 @@
 #include "vtkUnstructuredGrid.h"
 #include "vtkValueSelector.h"
 
+#include <algorithm>
 #include <array>
 #include <cassert>
+#include <iterator>
 #include <map>
 #include <vector>
 
@@ -70,9 +73,30 @@ bool SanitizeHTGMask(vtkHyperTreeGridNonOrientedCursor* cursor)
 }
 
 VTK_ABI_NAMESPACE_BEGIN
+//------------------------------------------------------------------------------
+// State kept between two incremental executions
+class vtkExtractSelection::vtkInternals
+{
+public:
+  vtkSmartPointer<vtkDataObject> Input;
+  vtkMTimeType InputMTime = 0;
+  int Association = -1;
+  // Sorted selected ids and their insidedness
+  std::vector<vtkIdType> Ids;
+  vtkSmartPointer<vtkSignedCharArray> Insidedness;
+
+  void Reset()
+  {
+    this->Input = nullptr;
+    this->Ids.clear();
+    this->Insidedness = nullptr;
+  }
+};
+
 vtkStandardNewMacro(vtkExtractSelection);
 //------------------------------------------------------------------------------
 vtkExtractSelection::vtkExtractSelection()
+  : Internals(new vtkInternals())
 {
   this->SetNumberOfInputPorts(2);
 }
@@ -272,6 +296,12 @@ int vtkExtractSelection::RequestData(vtkInformation* vtkNotUsed(request),
     return 0;
   }
 
+  if (this->Incremental && this->ExecuteIncrementally(input, selection, assoc, output))
+  {
+    return 1;
+  }
+  this->Internals->Reset();
+
   // Create operators for each of vtkSelectionNode instances and initialize them.
   std::map<std::string, vtkSmartPointer<vtkSelector>> selectors;
   for (unsigned int cc = 0, max = selection->GetNumberOfNodes(); cc < max; ++cc)
@@ -483,6 +513,122 @@ int vtkExtractSelection::RequestData(vtkInformation* vtkNotUsed(request),
   return 1;
 }
 
+//------------------------------------------------------------------------------
+bool vtkExtractSelection::ExecuteIncrementally(vtkDataObject* input, vtkSelection* selection,
+  vtkDataObject::AttributeTypes assoc, vtkDataObject* output)
+{
+  // Only a plain list of indices on a non-composite input is handled
+  vtkSelectionNode* node = selection->GetNumberOfNodes() == 1 ? selection->GetNode(0) : nullptr;
+  vtkInformation* properties = node ? node->GetProperties() : nullptr;
+  vtkDataArray* list = node ? vtkArrayDownCast<vtkDataArray>(node->GetSelectionList()) : nullptr;
+  if (!list || list->GetNumberOfComponents() != 1 ||
+    node->GetContentType() != vtkSelectionNode::INDICES ||
+    node->GetSelectionData()->GetNumberOfArrays() != 1 ||
+    properties->Get(vtkSelectionNode::CONNECTED_LAYERS()) != 0 ||
+    (properties->Has(vtkSelectionNode::INVERSE()) &&
+      properties->Get(vtkSelectionNode::INVERSE())) ||
+    (properties->Has(vtkSelectionNode::CONTAINING_CELLS()) &&
+      properties->Get(vtkSelectionNode::CONTAINING_CELLS())) ||
+    !(vtkDataSet::SafeDownCast(input) || vtkTable::SafeDownCast(input)))
+  {
+    return false;
+  }
+  const vtkIdType numElements = input->GetNumberOfElements(assoc);
+  if (numElements <= 0)
+  {
+    return false;
+  }
+
+  std::vector<vtkIdType> ids;
+  ids.reserve(list->GetNumberOfTuples());
+  for (const auto value : vtk::DataArrayValueRange<1>(list))
+  {
+    const auto id = static_cast<vtkIdType>(value);
+    if (id >= 0 && id < numElements)
+    {
+      ids.push_back(id);
+    }
+  }
+  std::sort(ids.begin(), ids.end());
+  ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+  auto& internals = *this->Internals;
+  auto& insidedness = internals.Insidedness;
+  if (internals.Input == input && internals.InputMTime == input->GetMTime() &&
+    internals.Association == assoc && insidedness &&
+    insidedness->GetNumberOfTuples() == numElements)
+  {
+    // Apply the difference with the previous selection
+    std::vector<vtkIdType> changed;
+    std::set_difference(internals.Ids.begin(), internals.Ids.end(), ids.begin(), ids.end(),
+      std::back_inserter(changed));
+    for (vtkIdType id : changed)
+    {
+      insidedness->SetValue(id, 0);
+    }
+    changed.clear();
+    std::set_difference(ids.begin(), ids.end(), internals.Ids.begin(), internals.Ids.end(),
+      std::back_inserter(changed));
+    for (vtkIdType id : changed)
+    {
+      insidedness->SetValue(id, 1);
+    }
+    insidedness->Modified();
+  }
+  else
+  {
+    insidedness = vtkSmartPointer<vtkSignedCharArray>::New();
+    insidedness->SetNumberOfTuples(numElements);
+    insidedness->FillValue(0);
+    for (vtkIdType id : ids)
+    {
+      insidedness->SetValue(id, 1);
+    }
+    internals.Input = input;
+    internals.InputMTime = input->GetMTime();
+    internals.Association = assoc;
+  }
+  internals.Ids = std::move(ids);
+
+  EvaluationResult evaluationResult = EvaluationResult::MIXED;
+  if (internals.Ids.empty())
+  {
+    evaluationResult = EvaluationResult::NONE;
+  }
+  else if (static_cast<vtkIdType>(internals.Ids.size()) == numElements)
+  {
+    evaluationResult = EvaluationResult::ALL;
+  }
+
+  vtkSmartPointer<vtkDataObject> clone;
+  if (this->PreserveTopology)
+  {
+    clone.TakeReference(input->NewInstance());
+    clone->ShallowCopy(input);
+  }
+  else if (assoc != vtkDataObject::ROW)
+  {
+    clone = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  }
+  else
+  {
+    clone = vtkSmartPointer<vtkTable>::New();
+  }
+  insidedness->SetName("__vtkInsidedness__");
+  if (evaluationResult != EvaluationResult::NONE)
+  {
+    clone->GetAttributes(assoc)->AddArray(insidedness);
+  }
+
+  vtkLogStartScope(TRACE, "extract output");
+  if (auto extractResult = this->ExtractElements(input, assoc, evaluationResult, clone))
+  {
+    output->ShallowCopy(extractResult);
+  }
+  vtkLogEndScope("extract output");
+  return true;
+}
+
 //------------------------------------------------------------------------------
 vtkSmartPointer<vtkSelector> vtkExtractSelection::NewSelectionOperator(
   vtkSelectionNode::SelectionContent contentType)
@@ -1123,5 +1269,6 @@ void vtkExtractSelection::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
   os << indent << "PreserveTopology: " << this->PreserveTopology << endl;
+  os << indent << "Incremental: " << this->Incremental << endl;
 }
 VTK_ABI_NAMESPACE_END
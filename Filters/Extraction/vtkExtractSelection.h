@@ -29,6 +29,8 @@
 #include "vtkSelectionNode.h" // for vtkSelectionNode::SelectionContent
 #include "vtkSmartPointer.h"  // for smart pointer
 
+#include <memory> // for std::unique_ptr
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkUnsignedCharArray;
 class vtkSignedCharArray;
@@ -77,6 +79,24 @@ public:
   vtkBooleanMacro(HyperTreeGridToUnstructuredGrid, bool);
   ///@}
 
+  ///@{
+  /**
+   * When on, the insidedness of the elements selected by a selection made of a
+   * single INDICES vtkSelectionNode on a non-composite input is kept from one
+   * execution to the next. As long as the input and the field type of the
+   * selection do not change, only the elements added to or removed from the
+   * selection are updated, so that interactively editing a selection, e.g.
+   * when brushing, costs in proportion to the change instead of the size of
+   * the input. The insidedness array of the output is then updated in place.
+   * Other selections are executed as usual.
+   *
+   * Default is false.
+   */
+  vtkSetMacro(Incremental, bool);
+  vtkGetMacro(Incremental, bool);
+  vtkBooleanMacro(Incremental, bool);
+  ///@}
+
 protected:
   vtkExtractSelection();
   ~vtkExtractSelection() override;
@@ -171,11 +191,24 @@ protected:
     vtkTable* input, vtkTable* output, vtkSignedCharArray* rowsInside, bool extractAll);
 
   bool PreserveTopology = false;
+  bool Incremental = false;
 
 private:
   vtkExtractSelection(const vtkExtractSelection&) = delete;
   void operator=(const vtkExtractSelection&) = delete;
 
+  /**
+   * Update the insidedness kept from the previous execution with the changes
+   * of the selection and extract the output from it. Returns false, without
+   * modifying the output, when the selection or the input cannot be handled
+   * incrementally.
+   */
+  bool ExecuteIncrementally(vtkDataObject* input, vtkSelection* selection,
+    vtkDataObject::AttributeTypes assoc, vtkDataObject* output);
+
+  class vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+
   /// Boolean controlling whether to extract HTG input as a UG (true) or a masked HTG (false)
   bool HyperTreeGridToUnstructuredGrid = false;
 };
@@ -3,6 +3,7 @@
 // Funded by CEA, DAM, DIF, F-91297 Arpajon, France
 #include "vtkFrustumSelector.h"
 
+#include "vtkArrayDispatch.h"
 #include "vtkDataArrayRange.h"
 #include "vtkDataSet.h"
 #include "vtkDoubleArray.h"
@@ -13,6 +14,7 @@
 #include "vtkNew.h"
 #include "vtkPlane.h"
 #include "vtkPlanes.h"
+#include "vtkPointSet.h"
 #include "vtkPoints.h"
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
@@ -21,6 +23,8 @@
 #include "vtkSignedCharArray.h"
 #include "vtkVectorOperators.h"
 
+#include <algorithm>
+#include <array>
 #include <bitset>
 #include <vector>
 
@@ -88,6 +92,93 @@ struct FrustumPlanesType : public std::array<vtkSmartPointer<vtkPlane>, MAX_PLAN
   }
 };
 
+//------------------------------------------------------------------------------
+// Select the points of a point set inside the frustum. The points are
+// processed in blocks whose bounding box is tested first: with a spatially
+// coherent point ordering, most blocks are entirely inside or outside the
+// frustum and their points do not need to be tested one by one.
+struct ComputePointsInFrustumWorker
+{
+  static constexpr vtkIdType BlockSize = 1024;
+
+  template <typename PointsArrayT>
+  void operator()(PointsArrayT* points, vtkPlanes* frustum, vtkSignedCharArray* pointSelected)
+  {
+    // Normal and origin of every plane, as evaluated by vtkPlanes::EvaluateFunction
+    const int numPlanes = frustum->GetNumberOfPlanes();
+    std::vector<std::array<double, 6>> planes(numPlanes);
+    for (int i = 0; i < numPlanes; ++i)
+    {
+      frustum->GetNormals()->GetTuple(i, planes[i].data());
+      frustum->GetPoints()->GetPoint(i, planes[i].data() + 3);
+    }
+    auto evaluate = [&planes](const double x[3]) {
+      double maxVal = -VTK_DOUBLE_MAX;
+      for (const auto& p : planes)
+      {
+        const double val =
+          p[0] * (x[0] - p[3]) + p[1] * (x[1] - p[4]) + p[2] * (x[2] - p[5]);
+        maxVal = std::max(maxVal, val);
+      }
+      return maxVal;
+    };
+
+    vtkSMPTools::For(0, points->GetNumberOfTuples(), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType blockBegin = begin; blockBegin < end; blockBegin += BlockSize)
+      {
+        const vtkIdType blockEnd = std::min(end, blockBegin + BlockSize);
+        const auto block = vtk::DataArrayTupleRange<3>(points, blockBegin, blockEnd);
+        auto selected = vtk::DataArrayValueRange<1>(pointSelected, blockBegin, blockEnd);
+
+        double bounds[6] = { VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX, VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX,
+          VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX };
+        for (const auto point : block)
+        {
+          for (int i = 0; i < 3; ++i)
+          {
+            const double x = static_cast<double>(point[i]);
+            bounds[2 * i] = std::min(bounds[2 * i], x);
+            bounds[2 * i + 1] = std::max(bounds[2 * i + 1], x);
+          }
+        }
+
+        // The block is outside if its nearest corner is outside of a plane,
+        // and inside if its farthest corner is inside of every plane
+        bool outside = false;
+        bool inside = true;
+        for (const auto& p : planes)
+        {
+          double nearest[3], farthest[3];
+          for (int i = 0; i < 3; ++i)
+          {
+            nearest[i] = p[i] > 0 ? bounds[2 * i] : bounds[2 * i + 1];
+            farthest[i] = p[i] > 0 ? bounds[2 * i + 1] : bounds[2 * i];
+          }
+          const double nearVal = p[0] * (nearest[0] - p[3]) + p[1] * (nearest[1] - p[4]) +
+            p[2] * (nearest[2] - p[5]);
+          const double farVal = p[0] * (farthest[0] - p[3]) + p[1] * (farthest[1] - p[4]) +
+            p[2] * (farthest[2] - p[5]);
+          outside = outside || nearVal >= 0.0;
+          inside = inside && farVal < 0.0;
+        }
+
+        if (outside || inside)
+        {
+          std::fill(selected.begin(), selected.end(), inside && !outside ? 1 : 0);
+          continue;
+        }
+        auto selectedIter = selected.begin();
+        for (const auto point : block)
+        {
+          const double x[3] = { static_cast<double>(point[0]), static_cast<double>(point[1]),
+            static_cast<double>(point[2]) };
+          *selectedIter++ = evaluate(x) < 0.0 ? 1 : 0;
+        }
+      }
+    });
+  }
+};
+
 //------------------------------------------------------------------------------
 class ComputeCellsInFrustumFunctor
 {
@@ -919,6 +1010,20 @@ void vtkFrustumSelector::ComputeSelectedPoints(vtkDataSet* input, vtkSignedCharA
     return;
   }
 
+  // Point sets give a direct access to their points
+  vtkPointSet* pointSet = vtkPointSet::SafeDownCast(input);
+  if (pointSet && pointSet->GetPoints() && this->Frustum->GetNumberOfPlanes() > 0)
+  {
+    vtkDataArray* points = pointSet->GetPoints()->GetData();
+    ComputePointsInFrustumWorker worker;
+    if (!vtkArrayDispatch::DispatchByValueType<vtkArrayDispatch::Reals>::Execute(
+          points, worker, this->Frustum, pointSelected))
+    {
+      worker(points, this->Frustum, pointSelected);
+    }
+    return;
+  }
+
   // Hacky PrepareForMultithreadedAccess()
   // call everything we will call on the data object on the main thread first
   // so that it can build its caching structures
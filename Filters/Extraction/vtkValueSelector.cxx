@@ -15,8 +15,11 @@
 #include "vtkSortDataArray.h"
 #include "vtkStringArray.h"
 
+#include <algorithm>
 #include <cassert>
 #include <type_traits>
+#include <utility>
+#include <vector>
 VTK_ABI_NAMESPACE_BEGIN
 namespace
 {
@@ -48,6 +51,150 @@ public:
   }
 };
 
+//------------------------------------------------------------------------------
+// Sort the values of a 1-component selection list in parallel and remove the
+// duplicates, so that they can be looked up with a binary search.
+struct SortUniqueWorker
+{
+  template <typename SelectionListArrayType>
+  void operator()(SelectionListArrayType* selList)
+  {
+    const auto range = vtk::DataArrayValueRange<1>(selList);
+    std::vector<vtk::GetAPIType<SelectionListArrayType>> values(range.cbegin(), range.cend());
+    vtkSMPTools::Sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+    selList->SetNumberOfValues(static_cast<vtkIdType>(values.size()));
+    auto sorted = vtk::DataArrayValueRange<1>(selList);
+    std::copy(values.cbegin(), values.cend(), sorted.begin());
+  }
+};
+
+//------------------------------------------------------------------------------
+// Look up values in a sorted list without duplicates. Integral lists whose
+// values are dense enough are turned into a bitmap for constant time lookups,
+// the others use a binary search after an early rejection of the values out
+// of the range of the list.
+template <typename ValueType, bool IsIntegral = std::is_integral<ValueType>::value>
+class SortedValueLookup
+{
+public:
+  SortedValueLookup(const ValueType* begin, const ValueType* end)
+    : Begin(begin)
+    , End(end)
+  {
+  }
+
+  bool Contains(ValueType value) const
+  {
+    return this->Begin != this->End && !(value < *this->Begin) && !(*(this->End - 1) < value) &&
+      std::binary_search(this->Begin, this->End, value);
+  }
+
+private:
+  const ValueType* Begin;
+  const ValueType* End;
+};
+
+template <typename ValueType>
+class SortedValueLookup<ValueType, true>
+{
+public:
+  SortedValueLookup(const ValueType* begin, const ValueType* end)
+    : Begin(begin)
+    , End(end)
+  {
+    if (begin == end)
+    {
+      return;
+    }
+    this->Minimum = *begin;
+    this->Maximum = *(end - 1);
+    // Only use a bitmap if it is not much larger than the list itself
+    const auto span = static_cast<unsigned long long>(this->Maximum) -
+      static_cast<unsigned long long>(this->Minimum);
+    const auto numValues = static_cast<unsigned long long>(end - begin);
+    if (span < 8 * numValues + 4096)
+    {
+      this->Bitmap.resize(static_cast<std::size_t>(span) + 1, 0);
+      for (const ValueType* it = begin; it != end; ++it)
+      {
+        this->Bitmap[this->GetOffset(*it)] = 1;
+      }
+    }
+  }
+
+  bool Contains(ValueType value) const
+  {
+    if (this->Begin == this->End || value < this->Minimum || value > this->Maximum)
+    {
+      return false;
+    }
+    return this->Bitmap.empty() ? std::binary_search(this->Begin, this->End, value)
+                                : this->Bitmap[this->GetOffset(value)] != 0;
+  }
+
+private:
+  std::size_t GetOffset(ValueType value) const
+  {
+    return static_cast<std::size_t>(static_cast<unsigned long long>(value) -
+      static_cast<unsigned long long>(this->Minimum));
+  }
+
+  const ValueType* Begin;
+  const ValueType* End;
+  ValueType Minimum{};
+  ValueType Maximum{};
+  std::vector<unsigned char> Bitmap;
+};
+
+//------------------------------------------------------------------------------
+// Merge the ranges of a 2-component selection list into sorted disjoint
+// ranges, so that a value is looked up with a binary search instead of
+// testing every range.
+template <typename ValueType>
+class SortedRangeLookup
+{
+public:
+  template <typename SelectionListArrayType>
+  SortedRangeLookup(SelectionListArrayType* selList)
+  {
+    for (const auto range : vtk::DataArrayTupleRange<2>(selList))
+    {
+      // empty (or NaN) ranges never match
+      if (range[0] <= range[1])
+      {
+        this->Ranges.emplace_back(range[0], range[1]);
+      }
+    }
+    std::sort(this->Ranges.begin(), this->Ranges.end());
+    std::size_t last = 0;
+    for (std::size_t i = 1; i < this->Ranges.size(); ++i)
+    {
+      if (!(this->Ranges[last].second < this->Ranges[i].first))
+      {
+        this->Ranges[last].second = std::max(this->Ranges[last].second, this->Ranges[i].second);
+      }
+      else
+      {
+        this->Ranges[++last] = this->Ranges[i];
+      }
+    }
+    this->Ranges.resize(this->Ranges.empty() ? 0 : last + 1);
+  }
+
+  bool Contains(ValueType value) const
+  {
+    auto iter = std::upper_bound(this->Ranges.begin(), this->Ranges.end(), value,
+      [](ValueType val, const std::pair<ValueType, ValueType>& range) {
+        return val < range.first;
+      });
+    return iter != this->Ranges.begin() && value <= (--iter)->second;
+  }
+
+private:
+  std::vector<std::pair<ValueType, ValueType>> Ranges;
+};
+
 //------------------------------------------------------------------------------
 // This is used for the cases where the SelectionList is a 1-component array,
 // implying that the values are exact matches.
@@ -83,14 +230,14 @@ struct ArrayValueMatchFunctor
     VTK_ASSUME(insidednessArray->GetNumberOfTuples() == fArray->GetNumberOfTuples());
     if (comp >= 0)
     {
-      vtkSMPTools::For(0, fArray->GetNumberOfTuples(), [=](vtkIdType begin, vtkIdType end) {
+      const SortedValueLookup<ValueType> lookup(haystack_begin, haystack_end);
+      vtkSMPTools::For(0, fArray->GetNumberOfTuples(), [&](vtkIdType begin, vtkIdType end) {
         const auto fRange = vtk::DataArrayTupleRange(fArray, begin, end);
         auto insideRange = vtk::DataArrayValueRange<1>(insidednessArray, begin, end);
         auto insideIter = insideRange.begin();
         for (auto i = fRange.cbegin(); i != fRange.cend(); ++i, ++insideIter)
         {
-          auto result = std::binary_search(haystack_begin, haystack_end, (*i)[comp]);
-          *insideIter = result ? 1 : 0;
+          *insideIter = lookup.Contains((*i)[comp]) ? 1 : 0;
         }
       });
     }
@@ -168,22 +315,18 @@ struct ArrayValueRangeFunctor
 
     if (comp >= 0)
     {
+      const SortedRangeLookup<ValueType> lookup(selList);
       vtkSMPTools::For(0, fArray->GetNumberOfTuples(),
-        [this, comp, fArray, selList](vtkIdType begin, vtkIdType end) {
+        [this, comp, fArray, &lookup](vtkIdType begin, vtkIdType end) {
           const auto fRange = vtk::DataArrayTupleRange(fArray, begin, end);
-          const auto selRange = vtk::DataArrayTupleRange<2>(selList);
           auto insideRange = vtk::DataArrayValueRange<1>(this->InsidednessArray, begin, end);
 
           using FTupleCRefType = typename decltype(fRange)::ConstTupleReferenceType;
-          using STupleCRefType = typename decltype(selRange)::ConstTupleReferenceType;
 
           auto insideIter = insideRange.begin();
           for (FTupleCRefType fTuple : fRange)
           {
-            const ValueType val = fTuple[comp];
-            auto matchIter = std::find_if(selRange.cbegin(), selRange.cend(),
-              [&](STupleCRefType range) -> bool { return val >= range[0] && val <= range[1]; });
-            *insideIter++ = matchIter != selRange.cend() ? 1 : 0;
+            *insideIter++ = lookup.Contains(fTuple[comp]) ? 1 : 0;
           }
         });
     }
@@ -306,7 +449,11 @@ private:
       // we sort the selection list to speed up extraction later.
       this->SelectionList.TakeReference(selectionList->NewInstance());
       this->SelectionList->DeepCopy(selectionList);
-      vtkSortDataArray::Sort(this->SelectionList);
+      vtkDataArray* dataList = vtkDataArray::SafeDownCast(this->SelectionList);
+      if (!dataList || !vtkArrayDispatch::Dispatch::Execute(dataList, SortUniqueWorker{}))
+      {
+        vtkSortDataArray::Sort(this->SelectionList);
+      }
     }
     else
     {
@@ -0,0 +1,150 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Track particles through a breaking surface with vtkLagrangianParticleTracker,
+// and check that the threaded execution, where the particles created by the
+// surface interactions are integrated as soon as a thread is free, produces
+// as many paths and interactions as the serial execution.
+
+#include "vtkCellData.h"
+#include "vtkDataSetSurfaceFilter.h"
+#include "vtkDoubleArray.h"
+#include "vtkImageData.h"
+#include "vtkLagrangianMatidaIntegrationModel.h"
+#include "vtkLagrangianParticleTracker.h"
+#include "vtkLogger.h"
+#include "vtkMultiBlockDataGroupFilter.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPlaneSource.h"
+#include "vtkPointData.h"
+#include "vtkPointSource.h"
+#include "vtkPolyData.h"
+#include "vtkRTAnalyticSource.h"
+#include "vtkRungeKutta2.h"
+#include "vtkSMPTools.h"
+
+#include <cstdlib>
+#include <initializer_list>
+
+namespace
+{
+void AddArray(vtkDataSetAttributes* data, const char* name, vtkIdType numTuples,
+  std::initializer_list<double> values)
+{
+  vtkNew<vtkDoubleArray> array;
+  array->SetName(name);
+  array->SetNumberOfComponents(static_cast<int>(values.size()));
+  array->SetNumberOfTuples(numTuples);
+  int comp = 0;
+  for (double value : values)
+  {
+    array->FillComponent(comp++, value);
+  }
+  data->AddArray(array);
+}
+}
+
+int TestLagrangianParticleTrackerThreaded(int, char*[])
+{
+  // Seeds on both sides of a breaking plane, moving upward
+  vtkNew<vtkPointSource> seeds;
+  seeds->SetNumberOfPoints(200);
+  seeds->SetRadius(4);
+  seeds->Update();
+  vtkPolyData* seedPD = seeds->GetOutput();
+  const vtkIdType numSeeds = seedPD->GetNumberOfPoints();
+  AddArray(seedPD->GetPointData(), "InitialVelocity", numSeeds, { 2, 5, 1 });
+  AddArray(seedPD->GetPointData(), "ParticleDensity", numSeeds, { 1920 });
+  AddArray(seedPD->GetPointData(), "ParticleDiameter", numSeeds, { 0.1 });
+
+  // Flow
+  vtkNew<vtkRTAnalyticSource> wavelet;
+  wavelet->Update();
+  vtkImageData* waveletImg = wavelet->GetOutput();
+  const vtkIdType numCells = waveletImg->GetNumberOfCells();
+  AddArray(waveletImg->GetCellData(), "FlowVelocity", numCells, { -0.3, -0.3, -0.3 });
+  AddArray(waveletImg->GetCellData(), "FlowDensity", numCells, { 1000 });
+  AddArray(waveletImg->GetCellData(), "FlowDynamicViscosity", numCells, { 0.894 });
+
+  // Surfaces: the boundary of the flow terminates the particles and a plane
+  // breaks them
+  vtkNew<vtkDataSetSurfaceFilter> surface;
+  surface->SetInputData(waveletImg);
+  surface->Update();
+  vtkPolyData* surfacePd = surface->GetOutput();
+  AddArray(surfacePd->GetCellData(), "SurfaceType", surfacePd->GetNumberOfCells(),
+    { vtkLagrangianBasicIntegrationModel::SURFACE_TYPE_TERM });
+
+  vtkNew<vtkPlaneSource> surfaceBreak;
+  surfaceBreak->SetOrigin(-10, -10, 0);
+  surfaceBreak->SetPoint1(10, -10, 0);
+  surfaceBreak->SetPoint2(-10, 10, 0);
+  surfaceBreak->Update();
+  vtkPolyData* breakPd = surfaceBreak->GetOutput();
+  AddArray(breakPd->GetCellData(), "SurfaceType", breakPd->GetNumberOfCells(),
+    { vtkLagrangianBasicIntegrationModel::SURFACE_TYPE_BREAK });
+
+  vtkNew<vtkMultiBlockDataGroupFilter> groupSurface;
+  groupSurface->AddInputDataObject(surfacePd);
+  groupSurface->AddInputDataObject(breakPd);
+
+  vtkNew<vtkLagrangianMatidaIntegrationModel> integrationModel;
+  integrationModel->SetInputArrayToProcess(
+    0, 1, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, "InitialVelocity");
+  integrationModel->SetInputArrayToProcess(
+    2, 0, 0, vtkDataObject::FIELD_ASSOCIATION_CELLS, "SurfaceType");
+  integrationModel->SetInputArrayToProcess(
+    3, 0, 0, vtkDataObject::FIELD_ASSOCIATION_CELLS, "FlowVelocity");
+  integrationModel->SetInputArrayToProcess(
+    4, 0, 0, vtkDataObject::FIELD_ASSOCIATION_CELLS, "FlowDensity");
+  integrationModel->SetInputArrayToProcess(
+    5, 0, 0, vtkDataObject::FIELD_ASSOCIATION_CELLS, "FlowDynamicViscosity");
+  integrationModel->SetInputArrayToProcess(
+    6, 1, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, "ParticleDiameter");
+  integrationModel->SetInputArrayToProcess(
+    7, 1, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, "ParticleDensity");
+
+  vtkNew<vtkRungeKutta2> integrator;
+  vtkNew<vtkLagrangianParticleTracker> tracker;
+  tracker->SetIntegrator(integrator);
+  tracker->SetIntegrationModel(integrationModel);
+  tracker->SetInputData(waveletImg);
+  tracker->SetSourceData(seedPD);
+  tracker->SetSurfaceConnection(groupSurface->GetOutputPort());
+  tracker->SetStepFactor(0.1);
+  tracker->SetStepFactorMin(0.1);
+  tracker->SetStepFactorMax(0.1);
+  tracker->SetMaximumNumberOfSteps(300);
+
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ 1 }, [&]() { tracker->Update(); });
+  vtkNew<vtkPolyData> serialPaths;
+  serialPaths->DeepCopy(vtkPolyData::SafeDownCast(tracker->GetOutput()));
+  const vtkIdType serialNumInteractions =
+    vtkMultiBlockDataSet::SafeDownCast(tracker->GetOutput(1))->GetNumberOfPoints();
+
+  tracker->Modified();
+  tracker->Update();
+  vtkPolyData* paths = vtkPolyData::SafeDownCast(tracker->GetOutput());
+  const vtkIdType numInteractions =
+    vtkMultiBlockDataSet::SafeDownCast(tracker->GetOutput(1))->GetNumberOfPoints();
+
+  if (serialPaths->GetNumberOfLines() == 0 || serialNumInteractions == 0)
+  {
+    vtkLog(ERROR, "No particle paths or interactions");
+    return EXIT_FAILURE;
+  }
+  if (paths->GetNumberOfLines() != serialPaths->GetNumberOfLines() ||
+    paths->GetNumberOfPoints() != serialPaths->GetNumberOfPoints() ||
+    numInteractions != serialNumInteractions)
+  {
+    vtkLog(ERROR,
+      "Threaded output differs from the serial one: "
+        << paths->GetNumberOfLines() << " paths and " << numInteractions
+        << " interactions instead of " << serialPaths->GetNumberOfLines() << " and "
+        << serialNumInteractions);
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
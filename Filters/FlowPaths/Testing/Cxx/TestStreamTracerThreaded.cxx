@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Trace many streamlines from random seeds with vtkStreamTracer, and check
+// that the threaded execution, which processes the seeds in a spatially
+// coherent order, produces the same output as the serial execution.
+
+#include "vtkImageGradient.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPointSource.h"
+#include "vtkPolyData.h"
+#include "vtkRTAnalyticSource.h"
+#include "vtkStreamTracer.h"
+#include "vtkTestUtilities.h"
+
+#include <cstdlib>
+
+int TestStreamTracerThreaded(int, char*[])
+{
+  vtkNew<vtkRTAnalyticSource> wavelet;
+  wavelet->SetWholeExtent(-10, 10, -10, 10, -10, 10);
+  vtkNew<vtkImageGradient> gradient;
+  gradient->SetDimensionality(3);
+  gradient->SetInputConnection(wavelet->GetOutputPort());
+
+  vtkNew<vtkPointSource> seeds;
+  seeds->SetNumberOfPoints(500);
+  seeds->SetRadius(8.0);
+  seeds->Update();
+
+  vtkNew<vtkStreamTracer> tracer;
+  tracer->SetInputConnection(gradient->GetOutputPort());
+  tracer->SetSourceConnection(seeds->GetOutputPort());
+  tracer->SetInputArrayToProcess(
+    0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, "RTDataGradient");
+  tracer->SetIntegrationDirectionToBoth();
+  tracer->SetIntegratorTypeToRungeKutta45();
+  tracer->SetMaximumPropagation(20.0);
+  tracer->SetComputeVorticity(true);
+
+  tracer->ForceSerialExecutionOn();
+  tracer->Update();
+  vtkNew<vtkPolyData> serial;
+  serial->DeepCopy(tracer->GetOutput());
+
+  tracer->ForceSerialExecutionOff();
+  tracer->Update();
+  vtkPolyData* output = tracer->GetOutput();
+
+  if (output->GetNumberOfLines() < 500)
+  {
+    vtkLog(ERROR, "Too few streamlines: " << output->GetNumberOfLines());
+    return EXIT_FAILURE;
+  }
+  if (!vtkTestUtilities::CompareDataObjects(serial, output))
+  {
+    vtkLog(ERROR, "Threaded output differs from the serial one");
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -1212,6 +1212,21 @@ void vtkLagrangianBasicIntegrationModel::FinalizeThreadedData(vtkLagrangianThrea
   data = nullptr;
 }
 
+//------------------------------------------------------------------------------
+vtkLagrangianParticle* vtkLagrangianBasicIntegrationModel::PopParticle(
+  std::queue<vtkLagrangianParticle*>& particles)
+{
+  // Mutex Locked Area
+  std::lock_guard<std::mutex> guard(this->ParticleQueueMutex);
+  if (particles.empty())
+  {
+    return nullptr;
+  }
+  vtkLagrangianParticle* particle = particles.front();
+  particles.pop();
+  return particle;
+}
+
 //------------------------------------------------------------------------------
 void vtkLagrangianBasicIntegrationModel::InitializeParticleData(
   vtkFieldData* particleData, int maxTuple)
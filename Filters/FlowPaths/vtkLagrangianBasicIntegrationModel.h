@@ -365,6 +365,15 @@ public:
    */
   virtual void FinalizeThreadedData(vtkLagrangianThreadedData*& data);
 
+  /**
+   * Remove the next particle from the particles queue and return it,
+   * or return nullptr if the queue is empty.
+   * This method is thread-safe and uses vtkLagrangianBasicIntegrationModel::ParticleQueueMutex,
+   * so that the LPT can take particles from the queue while the surface interactions
+   * add new particles to it.
+   */
+  vtkLagrangianParticle* PopParticle(std::queue<vtkLagrangianParticle*>& particles);
+
   /**
    * Enable model post process on output
    * Return true if successful, false otherwise
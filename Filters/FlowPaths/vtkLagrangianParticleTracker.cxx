@@ -95,6 +95,25 @@ struct IntegratingFunctor
     }
   }
 
+  void IntegrateParticle(vtkLagrangianParticle* particle)
+  {
+    vtkLagrangianThreadedData* localData = this->LocalData.Local();
+
+    // Set threaded data on the particle
+    particle->SetThreadedData(localData);
+
+    // Create polyLine output cell
+    vtkNew<vtkPolyLine> particlePath;
+
+    // Integrate
+    this->Tracker->Integrate(localData->Integrator, particle, this->ParticlesQueue,
+      localData->ParticlePathsOutput, particlePath, localData->InteractionOutput);
+
+    this->Tracker->IntegratedParticleCounter += this->Tracker->IntegratedParticleCounterIncrement;
+
+    this->Tracker->DeleteParticle(particle);
+  }
+
   void operator()(vtkIdType partId, vtkIdType endPartId)
   {
     bool isFirst = vtkSMPTools::GetSingleThread();
@@ -108,22 +127,7 @@ struct IntegratingFunctor
       {
         break;
       }
-      vtkLagrangianParticle* particle = this->ParticlesVec[id];
-      vtkLagrangianThreadedData* localData = this->LocalData.Local();
-
-      // Set threaded data on the particle
-      particle->SetThreadedData(localData);
-
-      // Create polyLine output cell
-      vtkNew<vtkPolyLine> particlePath;
-
-      // Integrate
-      this->Tracker->Integrate(localData->Integrator, particle, this->ParticlesQueue,
-        localData->ParticlePathsOutput, particlePath, localData->InteractionOutput);
-
-      this->Tracker->IntegratedParticleCounter += this->Tracker->IntegratedParticleCounterIncrement;
-
-      this->Tracker->DeleteParticle(particle);
+      this->IntegrateParticle(this->ParticlesVec[id]);
 
       // Special case to show progress in serial
       if (this->Serial)
@@ -134,6 +138,22 @@ struct IntegratingFunctor
       }
     }
     if (!this->Serial)
+    {
+      // In multithread, the particles created by surface interactions are
+      // integrated right away by the first thread that is free, instead of
+      // waiting for all the particles of this batch to be integrated.
+      vtkLagrangianParticle* particle;
+      while (!this->Tracker->GetAbortOutput() &&
+        (particle = this->Tracker->IntegrationModel->PopParticle(this->ParticlesQueue)))
+      {
+        if (isFirst)
+        {
+          this->Tracker->CheckAbort();
+        }
+        this->IntegrateParticle(particle);
+      }
+    }
+    if (!this->Serial)
     {
       // In multithread, protect the progress event with a mutex
       std::lock_guard<std::mutex> guard(this->Tracker->ProgressMutex);
@@ -555,7 +575,12 @@ int vtkLagrangianParticleTracker::RequestData(vtkInformation* vtkNotUsed(request
     // Integrate all available particles
     IntegratingFunctor functor(this, particlesVec, particlesQueue, particlePathsOutput, surfaces,
       interactionOutput, vtkSMPTools::GetEstimatedNumberOfThreads() == 1);
-    vtkSMPTools::For(0, static_cast<vtkIdType>(particlesVec.size()), functor);
+    // Particles may have very different lifetimes, so distribute them in
+    // small batches that idle threads can pick up.
+    const vtkIdType numParticles = static_cast<vtkIdType>(particlesVec.size());
+    const vtkIdType grain =
+      std::max<vtkIdType>(1, numParticles / (32 * vtkSMPTools::GetEstimatedNumberOfThreads()));
+    vtkSMPTools::For(0, numParticles, grain, functor);
   }
 
   // Delete the SerialThreadedData
@@ -35,6 +35,8 @@
 #include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 
+#include <algorithm>
+#include <utility>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -818,6 +820,64 @@ struct TracerOffset
 
 using TracerOffsets = std::vector<TracerOffset>;
 
+// Order the seeds along a Morton (Z-order) curve over their bounding box, so
+// that the seeds processed one after the other by a thread start in the same
+// blocks and cells. This improves the reuse of the cached cell and of the
+// data touched by the cell search of each thread. The output is not affected
+// since it is ordered by seed number.
+void SortSeedsByLocation(
+  vtkDataArray* seedSource, vtkIdList* seedIds, std::vector<vtkIdType>& seedOrder)
+{
+  const vtkIdType numSeeds = seedIds->GetNumberOfIds();
+  double bounds[6] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MIN, VTK_DOUBLE_MAX, VTK_DOUBLE_MIN,
+    VTK_DOUBLE_MAX, VTK_DOUBLE_MIN };
+  double x[3];
+  for (vtkIdType seedNum = 0; seedNum < numSeeds; ++seedNum)
+  {
+    seedSource->GetTuple(seedIds->GetId(seedNum), x);
+    for (int i = 0; i < 3; ++i)
+    {
+      bounds[2 * i] = std::min(bounds[2 * i], x[i]);
+      bounds[2 * i + 1] = std::max(bounds[2 * i + 1], x[i]);
+    }
+  }
+
+  // Quantize the seeds on a 1024^3 grid and interleave the bits of the
+  // grid coordinates. Ties are broken by seed number.
+  const int numBits = 10;
+  const double maxCoord = static_cast<double>((1 << numBits) - 1);
+  std::vector<std::pair<vtkTypeUInt32, vtkIdType>> codes(numSeeds);
+  vtkSMPTools::For(0, numSeeds, [&](vtkIdType seedNum, vtkIdType endSeedNum) {
+    double y[3];
+    for (; seedNum < endSeedNum; ++seedNum)
+    {
+      seedSource->GetTuple(seedIds->GetId(seedNum), y);
+      vtkTypeUInt32 code = 0;
+      for (int i = 0; i < 3; ++i)
+      {
+        const double length = bounds[2 * i + 1] - bounds[2 * i];
+        const vtkTypeUInt32 coord = length > 0.0
+          ? static_cast<vtkTypeUInt32>(maxCoord * (y[i] - bounds[2 * i]) / length)
+          : 0;
+        for (int bit = 0; bit < numBits; ++bit)
+        {
+          code |= ((coord >> bit) & 1u) << (3 * bit + i);
+        }
+      }
+      codes[seedNum] = std::make_pair(code, seedNum);
+    }
+  });
+  vtkSMPTools::Sort(codes.begin(), codes.end());
+
+  seedOrder.resize(numSeeds);
+  vtkSMPTools::For(0, numSeeds, [&](vtkIdType orderNum, vtkIdType endOrderNum) {
+    for (; orderNum < endOrderNum; ++orderNum)
+    {
+      seedOrder[orderNum] = codes[orderNum].second;
+    }
+  });
+}
+
 // The following class performs the threaded streamline integration.  The
 // data members below control the propagation of streamlines based on the
 // state of the vtkStreamTracer. Because threads may execute in a different
@@ -839,6 +899,7 @@ struct TracerIntegrator
   vtkDataArray* SeedSource;
   vtkIdList* SeedIds;
   vtkIntArray* IntegrationDirections;
+  const vtkIdType* SeedOrder; // order of processing of the seeds, may be nullptr
   TracerOffsets& Offsets;
   vtkAbstractInterpolatedVelocityField* FuncPrototype;
   vtkSmartPointer<vtkInitialValueProblemSolver> Integrator;
@@ -865,7 +926,8 @@ struct TracerIntegrator
 
   TracerIntegrator(vtkStreamTracer* streamTracer, vtkCompositeDataSet* inputData, bool matchingAttr,
     vtkDataSetAttributes* protoPD, vtkDataArray* seedSource, vtkIdList* seedIds,
-    vtkIntArray* intDirs, TracerOffsets& offsets, vtkAbstractInterpolatedVelocityField* func,
+    vtkIntArray* intDirs, const vtkIdType* seedOrder, TracerOffsets& offsets,
+    vtkAbstractInterpolatedVelocityField* func,
     vtkInitialValueProblemSolver* integrator, int maxCellSize, double inPropagation,
     vtkIdType inNumSteps, double inIntegrationTime, int vecType, const char* vecName,
     bool genNormals, vtkPolyData* output,
@@ -878,6 +940,7 @@ struct TracerIntegrator
     , SeedSource(seedSource)
     , SeedIds(seedIds)
     , IntegrationDirections(intDirs)
+    , SeedOrder(seedOrder)
     , Offsets(offsets)
     , FuncPrototype(func)
     , Integrator(integrator)
@@ -936,7 +999,7 @@ struct TracerIntegrator
       this->ProtoPD, this->MaximumNumberOfSteps);
   }
 
-  void operator()(vtkIdType seedNum, vtkIdType endSeedNum)
+  void operator()(vtkIdType orderNum, vtkIdType endOrderNum)
   {
     // Symbolic shortcuts to thread local data
     vtkLocalThreadOutput& localOutput = this->LocalThreadOutput.Local();
@@ -993,7 +1056,7 @@ struct TracerIntegrator
     // the output (unless they are turned off). Note that we are using only
     // the first input, if there are more than one, the attributes have to match.
     double velocity[3];
-    for (; seedNum < endSeedNum; ++seedNum)
+    for (; orderNum < endOrderNum; ++orderNum)
     {
       if (isFirst)
       {
@@ -1003,6 +1066,7 @@ struct TracerIntegrator
       {
         break;
       }
+      const vtkIdType seedNum = this->SeedOrder ? this->SeedOrder[orderNum] : orderNum;
       if (seedNum == 0) // only update the first streamline, otherwise zero
       {
         propagation = this->InPropagation;
@@ -1612,12 +1676,21 @@ void vtkStreamTracer::Integrate(vtkPointData* input0Data, vtkPolyData* output,
 
   bool runSequential = numSeeds < VTK_ST_THREADING_THRESHOLD || this->SerialExecution;
 
+  // When threading, the seeds are processed in an order where neighboring
+  // seeds are handled together, so that each thread keeps working in the
+  // same region of the input.
+  std::vector<vtkIdType> seedOrder;
+  if (!runSequential)
+  {
+    SortSeedsByLocation(seedSource, seedIds, seedOrder);
+  }
+
   // Generate streamlines.
   TracerIntegrator ti(this, this->InputData, this->HasMatchingPointAttributes, protoPD, seedSource,
-    seedIds, intDirs, offsets, func, integrator, maxCellSize, inPropagation, inNumSteps,
-    inIntegrationTime, vecType, vecName, this->GenerateNormalsInIntegrate, output,
-    customTerminationCallback, customTerminationClientData, customReasonForTermination,
-    runSequential);
+    seedIds, intDirs, seedOrder.empty() ? nullptr : seedOrder.data(), offsets, func, integrator,
+    maxCellSize, inPropagation, inNumSteps, inIntegrationTime, vecType, vecName,
+    this->GenerateNormalsInIntegrate, output, customTerminationCallback,
+    customTerminationClientData, customReasonForTermination, runSequential);
 
   if (runSequential)
   { // Serial
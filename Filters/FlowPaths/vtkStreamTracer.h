@@ -62,7 +62,10 @@
  * streamline (corresponding to the initial seeds) is processed in a
  * separate thread. Consequently, if threading is enabled and many
  * streamlines are generated, significant performance improvement is
- * possible.
+ * possible. The seeds are processed in an order that keeps neighboring seeds
+ * together (along a Morton curve), so that the streamlines traced by a
+ * thread mostly go through the same blocks and cells. The output is ordered
+ * by seed and does not depend on this processing order.
  *
  * @note Field data is shallow copied to the output. When the input is a
  * composite data set, field data associated with the root block is shallow-
@@ -288,7 +288,7 @@ void vtkTemporalInterpolatedVelocityField::InitializeWithLocators(
       }
       else if (auto polyData = vtkPolyData::SafeDownCast(datasetInfo.DataSet))
       {
-        polyData->SetLinks(vtkCellLinks::SafeDownCast(links[i]));
+        polyData->SetLinks(links[i]);
       }
     }
   }
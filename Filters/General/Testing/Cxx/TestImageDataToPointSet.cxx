@@ -3,7 +3,9 @@
 
 #include <vtkImageDataToPointSet.h>
 
+#include <vtkDoubleArray.h>
 #include <vtkImageData.h>
+#include <vtkPoints.h>
 #include <vtkRTAnalyticSource.h>
 #include <vtkStructuredGrid.h>
 
@@ -71,5 +73,32 @@ int TestImageDataToPointSet(int, char*[])
     }
   }
 
+  // Implicit points must match the explicit ones without storing coordinates.
+  vtkNew<vtkImageDataToPointSet> implicitImage2points;
+  implicitImage2points->SetInputData(image);
+  implicitImage2points->UseImplicitArraysOn();
+  implicitImage2points->Update();
+
+  vtkStructuredGrid* implicitData = implicitImage2points->GetOutput();
+  if (implicitData->GetNumberOfPoints() != numPoints ||
+    vtkDoubleArray::FastDownCast(implicitData->GetPoints()->GetData()))
+  {
+    std::cout << "Expected an implicit points array." << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (vtkIdType pointId = 0; pointId < numPoints; pointId++)
+  {
+    double outPoint[3];
+    double implicitPoint[3];
+    outData->GetPoint(pointId, outPoint);
+    implicitData->GetPoint(pointId, implicitPoint);
+    if ((outPoint[0] != implicitPoint[0]) || (outPoint[1] != implicitPoint[1]) ||
+      (outPoint[2] != implicitPoint[2]))
+    {
+      std::cout << "Got mismatched implicit point coordinates." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
   return EXIT_SUCCESS;
 }
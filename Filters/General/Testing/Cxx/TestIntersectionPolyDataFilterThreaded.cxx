@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the intersection of two spheres computed by
+// vtkIntersectionPolyDataFilter with several threads is identical to the one
+// computed with a single thread.
+
+#include "vtkIntersectionPolyDataFilter.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSphereSource.h"
+#include "vtkTestUtilities.h"
+
+#include <cstdlib>
+
+int TestIntersectionPolyDataFilterThreaded(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere0;
+  sphere0->SetThetaResolution(60);
+  sphere0->SetPhiResolution(60);
+  sphere0->SetCenter(0.0, 0.0, 0.0);
+  vtkNew<vtkSphereSource> sphere1;
+  sphere1->SetThetaResolution(50);
+  sphere1->SetPhiResolution(50);
+  sphere1->SetCenter(0.3, 0.1, 0.05);
+
+  vtkNew<vtkIntersectionPolyDataFilter> intersection;
+  intersection->SetInputConnection(0, sphere0->GetOutputPort());
+  intersection->SetInputConnection(1, sphere1->GetOutputPort());
+
+  vtkNew<vtkPolyData> serial[3];
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ 1 }, [&]() { intersection->Update(); });
+  for (int i = 0; i < 3; ++i)
+  {
+    serial[i]->DeepCopy(intersection->GetOutput(i));
+  }
+  if (serial[0]->GetNumberOfLines() == 0)
+  {
+    vtkLog(ERROR, "No intersection lines");
+    return EXIT_FAILURE;
+  }
+
+  intersection->Modified();
+  intersection->Update();
+  const char* names[3] = { "intersection", "first surface", "second surface" };
+  for (int i = 0; i < 3; ++i)
+  {
+    if (!vtkTestUtilities::CompareDataObjects(serial[i], intersection->GetOutput(i)))
+    {
+      vtkLog(ERROR, "Threaded output differs for the " << names[i]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that vtkSmoothPolyDataFilter, vtkCurvatures and vtkFeatureEdges
+// produce the same output with several threads as with a single thread, on
+// a noisy open sphere.
+
+#include "vtkCurvatures.h"
+#include "vtkDataArray.h"
+#include "vtkFeatureEdges.h"
+#include "vtkLogger.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkSmoothPolyDataFilter.h"
+#include "vtkSphereSource.h"
+#include "vtkTestUtilities.h"
+
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+bool CompareSerialAndThreaded(vtkPolyDataAlgorithm* filter, const char* name)
+{
+  vtkNew<vtkPolyData> serial;
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ 1 }, [&]() { filter->Update(); });
+  serial->DeepCopy(filter->GetOutput());
+  filter->Modified();
+  filter->Update();
+  if (!vtkTestUtilities::CompareDataObjects(serial, filter->GetOutput()))
+  {
+    vtkLog(ERROR, "Threaded output differs for " << name);
+    return false;
+  }
+  return true;
+}
+
+// An open sphere whose points are moved randomly along the radius
+vtkSmartPointer<vtkPolyData> CreateNoisySphere()
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(80);
+  sphere->SetPhiResolution(60);
+  sphere->SetEndTheta(300.0);
+  sphere->Update();
+
+  auto noisy = vtkSmartPointer<vtkPolyData>::New();
+  noisy->DeepCopy(sphere->GetOutput());
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(1);
+  vtkPoints* points = noisy->GetPoints();
+  double x[3];
+  for (vtkIdType ptId = 0; ptId < points->GetNumberOfPoints(); ++ptId)
+  {
+    points->GetPoint(ptId, x);
+    const double scale = random->GetNextRangeValue(0.95, 1.05);
+    points->SetPoint(ptId, scale * x[0], scale * x[1], scale * x[2]);
+  }
+  return noisy;
+}
+}
+
+int TestMeshFiltersThreaded(int, char*[])
+{
+  vtkSmartPointer<vtkPolyData> input = CreateNoisySphere();
+
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(40);
+  sphere->SetPhiResolution(40);
+  for (int simultaneous = 0; simultaneous < 2; ++simultaneous)
+  {
+    vtkNew<vtkSmoothPolyDataFilter> smooth;
+    smooth->SetInputData(input);
+    smooth->SetNumberOfIterations(30);
+    smooth->SetRelaxationFactor(0.1);
+    smooth->FeatureEdgeSmoothingOn();
+    smooth->GenerateErrorScalarsOn();
+    smooth->GenerateErrorVectorsOn();
+    smooth->SetSimultaneousUpdate(simultaneous);
+    if (!CompareSerialAndThreaded(smooth, "vtkSmoothPolyDataFilter"))
+    {
+      return EXIT_FAILURE;
+    }
+
+    // Smoothing constrained to the surface of a sphere
+    smooth->SetInputConnection(1, sphere->GetOutputPort());
+    if (!CompareSerialAndThreaded(smooth, "constrained vtkSmoothPolyDataFilter"))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
+  vtkNew<vtkCurvatures> curvatures;
+  curvatures->SetInputData(input);
+  for (int type : { VTK_CURVATURE_GAUSS, VTK_CURVATURE_MEAN, VTK_CURVATURE_MAXIMUM,
+         VTK_CURVATURE_MINIMUM })
+  {
+    curvatures->SetCurvatureType(type);
+    if (!CompareSerialAndThreaded(curvatures, "vtkCurvatures"))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
+  // The Gauss curvature of a sphere of radius 0.5 is 4
+  sphere->Update();
+  curvatures->SetInputData(sphere->GetOutput());
+  curvatures->SetCurvatureType(VTK_CURVATURE_GAUSS);
+  curvatures->Update();
+  vtkDataArray* gauss = curvatures->GetOutput()->GetPointData()->GetArray("Gauss_Curvature");
+  const vtkIdType ptId = 2 + 19; // after the poles, near the equator
+  if (!gauss || std::abs(gauss->GetComponent(ptId, 0) - 4.0) > 0.4)
+  {
+    vtkLog(ERROR, "Wrong Gauss curvature of a sphere");
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkFeatureEdges> edges;
+  edges->SetInputData(input);
+  edges->ExtractAllEdgeTypesOn();
+  edges->SetFeatureAngle(10.0);
+  if (!CompareSerialAndThreaded(edges, "vtkFeatureEdges") ||
+    edges->GetOutput()->GetNumberOfLines() == 0)
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check the average, minimum, maximum and standard deviation computed by
+// vtkTemporalStatistics against the values computed from every time step.
+
+#include "vtkDataArray.h"
+#include "vtkDataSet.h"
+#include "vtkInformation.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkTemporalStatistics.h"
+#include "vtkTimeSourceExample.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+bool CheckArray(vtkDataSet* output, const char* name, const std::vector<double>& expected)
+{
+  vtkDataArray* array = output->GetPointData()->GetArray(name);
+  if (!array || array->GetNumberOfTuples() != static_cast<vtkIdType>(expected.size()))
+  {
+    vtkLog(ERROR, "Missing or wrong array " << name);
+    return false;
+  }
+  for (vtkIdType ptId = 0; ptId < array->GetNumberOfTuples(); ++ptId)
+  {
+    if (std::abs(array->GetComponent(ptId, 0) - expected[ptId]) > 1e-10)
+    {
+      vtkLog(ERROR,
+        "Wrong value " << array->GetComponent(ptId, 0) << " instead of " << expected[ptId]
+                       << " for point " << ptId << " of " << name);
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestTemporalStatistics(int, char*[])
+{
+  vtkNew<vtkTimeSourceExample> source;
+  source->SetXAmplitude(10);
+  source->SetYAmplitude(5);
+  source->UpdateInformation();
+  vtkInformation* info = source->GetOutputInformation(0);
+  const double* timeSteps = info->Get(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+  const int numSteps = info->Length(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+
+  // Reference statistics of "Point X" over the time steps
+  std::vector<double> sum, sum2, minimum, maximum;
+  for (int step = 0; step < numSteps; ++step)
+  {
+    source->UpdateTimeStep(timeSteps[step]);
+    vtkDataArray* values = source->GetOutput()->GetPointData()->GetArray("Point X");
+    const vtkIdType numPts = values->GetNumberOfTuples();
+    if (step == 0)
+    {
+      sum.assign(numPts, 0.0);
+      sum2.assign(numPts, 0.0);
+      minimum.assign(numPts, VTK_DOUBLE_MAX);
+      maximum.assign(numPts, VTK_DOUBLE_MIN);
+    }
+    for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+    {
+      const double value = values->GetComponent(ptId, 0);
+      sum[ptId] += value;
+      sum2[ptId] += value * value;
+      minimum[ptId] = std::min(minimum[ptId], value);
+      maximum[ptId] = std::max(maximum[ptId], value);
+    }
+  }
+  std::vector<double> average(sum.size()), stddev(sum.size());
+  for (size_t i = 0; i < sum.size(); ++i)
+  {
+    average[i] = sum[i] / numSteps;
+    stddev[i] = std::sqrt(std::max(0.0, sum2[i] / numSteps - average[i] * average[i]));
+  }
+
+  vtkNew<vtkTemporalStatistics> statistics;
+  statistics->SetInputConnection(source->GetOutputPort());
+  statistics->Update();
+  vtkDataSet* output = vtkDataSet::SafeDownCast(statistics->GetOutputDataObject(0));
+  if (!CheckArray(output, "Point X_average", average) ||
+    !CheckArray(output, "Point X_minimum", minimum) ||
+    !CheckArray(output, "Point X_maximum", maximum) ||
+    !CheckArray(output, "Point X_stddev", stddev))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // The standard deviation alone also accumulates the average
+  statistics->ComputeAverageOff();
+  statistics->Update();
+  output = vtkDataSet::SafeDownCast(statistics->GetOutputDataObject(0));
+  if (output->GetPointData()->GetArray("Point X_average") ||
+    !CheckArray(output, "Point X_stddev", stddev))
+  {
+    vtkLog(ERROR, "Wrong standard deviation without the average");
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -1,11 +1,14 @@
 // SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
 // SPDX-License-Identifier: BSD-3-Clause
 
+#include <vtkDoubleArray.h>
 #include <vtkFloatArray.h>
+#include <vtkImageData.h>
 #include <vtkMinimalStandardRandomSequence.h>
 #include <vtkPointData.h>
 #include <vtkPolyData.h>
 #include <vtkSmartPointer.h>
+#include <vtkStructuredGrid.h>
 #include <vtkTransform.h>
 #include <vtkTransformFilter.h>
 
@@ -102,6 +105,60 @@ vtkSmartPointer<vtkPointSet> TransformPointSet(int dataType, int outputPointsPre
   return outputPointSet;
 }
 
+bool TestImplicitImagePoints()
+{
+  vtkSmartPointer<vtkImageData> image = vtkSmartPointer<vtkImageData>::New();
+  image->SetExtent(-2, 3, 0, 4, 1, 2);
+  image->SetOrigin(0.5, -1.0, 2.0);
+  image->SetSpacing(0.25, 2.0, 1.0);
+
+  vtkSmartPointer<vtkTransform> transform = vtkSmartPointer<vtkTransform>::New();
+  transform->Translate(1.0, 2.0, -3.0);
+  transform->Scale(2.0, -0.5, 3.0);
+
+  vtkSmartPointer<vtkTransformFilter> explicitFilter = vtkSmartPointer<vtkTransformFilter>::New();
+  explicitFilter->SetTransform(transform);
+  explicitFilter->SetInputData(image);
+  explicitFilter->Update();
+
+  vtkSmartPointer<vtkTransformFilter> implicitFilter = vtkSmartPointer<vtkTransformFilter>::New();
+  implicitFilter->SetTransform(transform);
+  implicitFilter->SetInputData(image);
+  implicitFilter->UseImplicitArraysOn();
+  implicitFilter->Update();
+
+  vtkPointSet* explicitOutput = explicitFilter->GetOutput();
+  vtkStructuredGrid* implicitOutput = vtkStructuredGrid::SafeDownCast(implicitFilter->GetOutput());
+  if (!implicitOutput || vtkDoubleArray::FastDownCast(implicitOutput->GetPoints()->GetData()) ||
+    implicitOutput->GetNumberOfPoints() != explicitOutput->GetNumberOfPoints())
+  {
+    std::cerr << "Expected implicit points for a scaled and translated image." << std::endl;
+    return false;
+  }
+  for (vtkIdType i = 0; i < explicitOutput->GetNumberOfPoints(); ++i)
+  {
+    double expected[3];
+    double actual[3];
+    explicitOutput->GetPoint(i, expected);
+    implicitOutput->GetPoint(i, actual);
+    if (expected[0] != actual[0] || expected[1] != actual[1] || expected[2] != actual[2])
+    {
+      std::cerr << "Implicit point " << i << " differs from the transformed point." << std::endl;
+      return false;
+    }
+  }
+
+  // Rotations cannot be represented by axis coordinates.
+  transform->RotateZ(30.0);
+  implicitFilter->Update();
+  if (!vtkDoubleArray::FastDownCast(implicitFilter->GetOutput()->GetPoints()->GetData()))
+  {
+    std::cerr << "Expected explicit points for a rotated image." << std::endl;
+    return false;
+  }
+  return true;
+}
+
 int TestTransformFilter(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
 {
   vtkSmartPointer<vtkPointSet> pointSet =
@@ -153,5 +210,10 @@ int TestTransformFilter(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
     return EXIT_FAILURE;
   }
 
+  if (!TestImplicitImagePoints())
+  {
+    return EXIT_FAILURE;
+  }
+
   return EXIT_SUCCESS;
 }
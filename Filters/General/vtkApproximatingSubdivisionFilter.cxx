@@ -186,60 +186,19 @@ vtkIdType vtkApproximatingSubdivisionFilter::InterpolatePosition(
   return outputPts->InsertNextPoint(x);
 }
 
-void vtkApproximatingSubdivisionFilter::GenerateSubdivisionCells(
-  vtkPolyData* inputDS, vtkIntArray* edgeData, vtkCellArray* outputPolys, vtkCellData* outputCD)
+void vtkApproximatingSubdivisionFilter::InterpolatePosition(vtkPoints* inputPts,
+  vtkPoints* outputPts, vtkIdType outputId, vtkIdList* stencil, const double* weights)
 {
-  vtkIdType numCells = inputDS->GetNumberOfCells();
-  vtkIdType cellId, newId, id;
-  vtkIdType npts;
-  const vtkIdType* pts;
-  double edgePts[3];
-  vtkIdType newCellPts[3];
-  vtkCellData* inputCD = inputDS->GetCellData();
-
-  // Now create new cells from existing points and generated edge points
-  for (cellId = 0; cellId < numCells; cellId++)
+  double xx[3], x[3] = { 0.0, 0.0, 0.0 };
+  for (vtkIdType i = 0; i < stencil->GetNumberOfIds(); i++)
   {
-    if (this->CheckAbort())
-    {
-      break;
-    }
-    if (inputDS->GetCellType(cellId) != VTK_TRIANGLE)
+    inputPts->GetPoint(stencil->GetId(i), xx);
+    for (int j = 0; j < 3; j++)
     {
-      continue;
+      x[j] += xx[j] * weights[i];
     }
-    // get the original point ids and the ids stored as edge data
-    inputDS->GetCellPoints(cellId, npts, pts);
-    edgeData->GetTuple(cellId, edgePts);
-
-    id = 0;
-    newCellPts[id++] = pts[0];
-    newCellPts[id++] = static_cast<int>(edgePts[1]);
-    newCellPts[id++] = static_cast<int>(edgePts[0]);
-    newId = outputPolys->InsertNextCell(3, newCellPts);
-    outputCD->CopyData(inputCD, cellId, newId);
-
-    id = 0;
-    newCellPts[id++] = static_cast<int>(edgePts[1]);
-    newCellPts[id++] = pts[1];
-    newCellPts[id++] = static_cast<int>(edgePts[2]);
-    newId = outputPolys->InsertNextCell(3, newCellPts);
-    outputCD->CopyData(inputCD, cellId, newId);
-
-    id = 0;
-    newCellPts[id++] = static_cast<int>(edgePts[2]);
-    newCellPts[id++] = pts[2];
-    newCellPts[id++] = static_cast<int>(edgePts[0]);
-    newId = outputPolys->InsertNextCell(3, newCellPts);
-    outputCD->CopyData(inputCD, cellId, newId);
-
-    id = 0;
-    newCellPts[id++] = static_cast<int>(edgePts[1]);
-    newCellPts[id++] = static_cast<int>(edgePts[2]);
-    newCellPts[id++] = static_cast<int>(edgePts[0]);
-    newId = outputPolys->InsertNextCell(3, newCellPts);
-    outputCD->CopyData(inputCD, cellId, newId);
   }
+  outputPts->SetPoint(outputId, x);
 }
 
 void vtkApproximatingSubdivisionFilter::PrintSelf(ostream& os, vtkIndent indent)
@@ -39,12 +39,12 @@ protected:
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
   virtual int GenerateSubdivisionPoints(
     vtkPolyData* inputDS, vtkIntArray* edgeData, vtkPoints* outputPts, vtkPointData* outputPD) = 0;
-  void GenerateSubdivisionCells(
-    vtkPolyData* inputDS, vtkIntArray* edgeData, vtkCellArray* outputPolys, vtkCellData* outputCD);
   int FindEdge(vtkPolyData* mesh, vtkIdType cellId, vtkIdType p1, vtkIdType p2,
     vtkIntArray* edgeData, vtkIdList* cellIds);
   vtkIdType InterpolatePosition(
     vtkPoints* inputPts, vtkPoints* outputPts, vtkIdList* stencil, double* weights);
+  void InterpolatePosition(vtkPoints* inputPts, vtkPoints* outputPts, vtkIdType outputId,
+    vtkIdList* stencil, const double* weights);
 
 private:
   vtkApproximatingSubdivisionFilter(const vtkApproximatingSubdivisionFilter&) = delete;
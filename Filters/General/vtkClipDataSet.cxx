@@ -334,6 +334,13 @@ int vtkClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
     outCD[1]->CopyAllocate(inCD, estimatedSize, estimatedSize / 2);
   }
 
+  // Polyhedra are clipped from faces and edges built once for the whole grid
+  vtkUnstructuredGrid* inputGrid = vtkUnstructuredGrid::SafeDownCast(input);
+  if (inputGrid && inputGrid->GetFaces())
+  {
+    inputGrid->BuildPolyhedronTopology();
+  }
+
   // Process all cells and clip each in turn
   //
   bool abort = false;
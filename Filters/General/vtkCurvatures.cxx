@@ -16,15 +16,85 @@
 #include "vtkPolyData.h"
 #include "vtkPolyDataNormals.h"
 #include "vtkPolygon.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkStaticCellLinksTemplate.h"
 #include "vtkTriangle.h"
 #include "vtkTriangleFilter.h"
 #include "vtkTriangleStrip.h"
 
-#include <memory> // For unique_ptr
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkCurvatures);
 
+namespace
+{
+//-------------------------------------------------------//
+// Compute the maximum (k_max = h + sqrt(h^2 - k)) or minimum
+// (k_min = h - sqrt(h^2 - k)) principal curvature of every point. The points
+// where the Gauss and mean curvatures are inconsistent are reported in order
+// once all the points are processed.
+void ComputePrincipalCurvature(vtkCurvatures* self, vtkDoubleArray* gauss, vtkDoubleArray* mean,
+  vtkDoubleArray* principal, bool maximum)
+{
+  const vtkIdType numPts = principal->GetNumberOfTuples();
+  const double* gaussData = gauss->GetPointer(0);
+  const double* meanData = mean->GetPointer(0);
+  double* principalData = principal->GetPointer(0);
+
+  vtkSMPThreadLocal<std::vector<vtkIdType>> tlInaccuratePts;
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    std::vector<vtkIdType>& inaccuratePts = tlInaccuratePts.Local();
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; ptId < endPtId; ++ptId)
+    {
+      if (isFirst)
+      {
+        self->CheckAbort();
+      }
+      if (self->GetAbortOutput())
+      {
+        break;
+      }
+
+      const double h = meanData[ptId];
+      const double tmp = h * h - gaussData[ptId];
+      if (tmp >= 0)
+      {
+        principalData[ptId] = maximum ? h + sqrt(tmp) : h - sqrt(tmp);
+      }
+      else
+      {
+        principalData[ptId] = h;
+        if (tmp < -0.1)
+        {
+          inaccuratePts.push_back(ptId);
+        }
+      }
+    }
+  });
+
+  std::vector<vtkIdType> inaccuratePts;
+  for (const auto& localPts : tlInaccuratePts)
+  {
+    inaccuratePts.insert(inaccuratePts.end(), localPts.begin(), localPts.end());
+  }
+  std::sort(inaccuratePts.begin(), inaccuratePts.end());
+  for (vtkIdType ptId : inaccuratePts)
+  {
+    vtkWarningWithObjectMacro(self,
+      << "The Gaussian or mean curvature at point " << ptId
+      << " have a large computation error... The " << (maximum ? "maximum" : "minimum")
+      << " curvature is likely off.");
+  }
+}
+} // anonymous namespace
+
 //-------------------------------------------------------//
 vtkCurvatures::vtkCurvatures()
 {
@@ -62,12 +132,8 @@ void vtkCurvatures::GetMeanCurvature(vtkPolyData* mesh)
     return;
   }
 
-  int numPts = polyData->GetNumberOfPoints();
+  const vtkIdType numPts = polyData->GetNumberOfPoints();
 
-  //     create-allocate
-  const vtkNew<vtkIdList> vertices;
-  const vtkNew<vtkIdList> vertices_n;
-  const vtkNew<vtkIdList> neighbours;
   const vtkNew<vtkDoubleArray> meanCurvature;
   meanCurvature->SetName("Mean_Curvature");
   meanCurvature->SetNumberOfComponents(1);
@@ -75,130 +141,192 @@ void vtkCurvatures::GetMeanCurvature(vtkPolyData* mesh)
   // Get the array so we can write to it directly
   double* meanCurvatureData = meanCurvature->GetPointer(0);
 
-  //     create-allocate
-  double n_f[3]; // normal of facet (could be stored for later?)
-  double n_n[3]; // normal of edge
-  double t[3];   // to store the cross product of n_f n_n
-  double ore[3]; // origin of e
-  double end[3]; // end of e
-  double oth[3]; //     third vertex necessary for comp of n
-  double vn0[3];
-  double vn1[3]; // vertices for computation of neighbour's n
-  double vn2[3];
-  double e[3]; // edge (oriented)
-
+  // BuildLinks() builds the cells too, the threaded loops below only read them
   polyData->BuildLinks();
   // data init
-  const int F = polyData->GetNumberOfCells();
-  // init, preallocate the mean curvature
-  const std::unique_ptr<int[]> num_neighb(new int[numPts]);
-  for (int v = 0; v < numPts; v++)
-  {
-    meanCurvatureData[v] = 0.0;
-    num_neighb[v] = 0;
-  }
+  const vtkIdType F = polyData->GetNumberOfCells();
+
+  // The edges of facet f are stored from edgeOffsets[f] on
+  std::vector<vtkIdType> edgeOffsets(F + 1);
+  vtkSMPTools::For(0, F, [&](vtkIdType f, vtkIdType endF) {
+    for (; f < endF; ++f)
+    {
+      edgeOffsets[f] = polyData->GetCellSize(f);
+    }
+  });
+  edgeOffsets[F] = 0;
+  vtkSMPTools::ExclusiveScan(
+    edgeOffsets.begin(), edgeOffsets.end(), edgeOffsets.begin(), vtkIdType(0));
 
   //     main loop
   vtkDebugMacro(<< "Main loop: loop over facets such that id > id of neighb");
   vtkDebugMacro(<< "so that every edge comes only once");
 
-  for (vtkIdType f = 0; f < F; ++f)
-  {
-    if (this->CheckAbort())
+  // The facets compute the contribution of their edges concurrently. The
+  // contributions are then gathered by every point in the order of the
+  // facets, so that the sums do not depend on the number of threads.
+  std::vector<double> edgeHf(edgeOffsets[F]);
+  std::vector<unsigned char> edgeHasHf(edgeOffsets[F], 0);
+  vtkSMPThreadLocalObject<vtkIdList> tlVertices;
+  vtkSMPThreadLocalObject<vtkIdList> tlVerticesN;
+  vtkSMPThreadLocalObject<vtkIdList> tlNeighbours;
+  vtkSMPTools::For(0, F, [&](vtkIdType f, vtkIdType endF) {
+    vtkIdList* vertices = tlVertices.Local();
+    vtkIdList* vertices_n = tlVerticesN.Local();
+    vtkIdList* neighbours = tlNeighbours.Local();
+    vtkIdType nv, nv_n;
+    const vtkIdType* pts;
+    const vtkIdType* pts_n;
+
+    double n_f[3]; // normal of facet (could be stored for later?)
+    double n_n[3]; // normal of edge
+    double t[3];   // to store the cross product of n_f n_n
+    double ore[3]; // origin of e
+    double end[3]; // end of e
+    double oth[3]; //     third vertex necessary for comp of n
+    double vn0[3];
+    double vn1[3]; // vertices for computation of neighbour's n
+    double vn2[3];
+    double e[3]; // edge (oriented)
+
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; f < endF; ++f)
     {
-      break;
-    }
-    polyData->GetCellPoints(f, vertices);
-    const vtkIdType nv = vertices->GetNumberOfIds();
+      if (isFirst)
+      {
+        this->CheckAbort();
+      }
+      if (this->GetAbortOutput())
+      {
+        break;
+      }
+      polyData->GetCellPoints(f, nv, pts, vertices);
 
-    for (vtkIdType v = 0; v < nv; v++)
-    {
-      // get neighbour
-      const vtkIdType v_l = vertices->GetId(v);
-      const vtkIdType v_r = vertices->GetId((v + 1) % nv);
-      const vtkIdType v_o = vertices->GetId((v + 2) % nv);
-      polyData->GetCellEdgeNeighbors(f, v_l, v_r, neighbours);
-
-      vtkIdType n; // n short for neighbor
-
-      // compute only if there is really ONE neighbour
-      // AND meanCurvature has not been computed yet!
-      // (ensured by n > f)
-      if (neighbours->GetNumberOfIds() == 1 && (n = neighbours->GetId(0)) > f)
+      for (vtkIdType v = 0; v < nv; v++)
       {
-        double Hf; // temporary store
-
-        // find 3 corners of f: in order!
-        polyData->GetPoint(v_l, ore);
-        polyData->GetPoint(v_r, end);
-        polyData->GetPoint(v_o, oth);
-        // compute normal of f
-        vtkTriangle::ComputeNormal(ore, end, oth, n_f);
-        // compute common edge
-        e[0] = end[0];
-        e[1] = end[1];
-        e[2] = end[2];
-        e[0] -= ore[0];
-        e[1] -= ore[1];
-        e[2] -= ore[2];
-        const double length = vtkMath::Normalize(e);
-        double Af = vtkTriangle::TriangleArea(ore, end, oth);
-        // find 3 corners of n: in order!
-        polyData->GetCellPoints(n, vertices_n);
-        polyData->GetPoint(vertices_n->GetId(0), vn0);
-        polyData->GetPoint(vertices_n->GetId(1), vn1);
-        polyData->GetPoint(vertices_n->GetId(2), vn2);
-        Af += double(vtkTriangle::TriangleArea(vn0, vn1, vn2));
-        // compute normal of n
-        vtkTriangle::ComputeNormal(vn0, vn1, vn2, n_n);
-        // the cosine is n_f * n_n
-        const double cs = vtkMath::Dot(n_f, n_n);
-        // the sin is (n_f x n_n) * e
-        vtkMath::Cross(n_f, n_n, t);
-        const double sn = vtkMath::Dot(t, e);
-        // signed angle in [-pi,pi]
-        if (sn != 0.0 || cs != 0.0)
+        // get neighbour
+        const vtkIdType v_l = pts[v];
+        const vtkIdType v_r = pts[(v + 1) % nv];
+        const vtkIdType v_o = pts[(v + 2) % nv];
+        polyData->GetCellEdgeNeighbors(f, v_l, v_r, neighbours);
+
+        vtkIdType n; // n short for neighbor
+
+        // compute only if there is really ONE neighbour
+        // AND meanCurvature has not been computed yet!
+        // (ensured by n > f)
+        if (neighbours->GetNumberOfIds() == 1 && (n = neighbours->GetId(0)) > f)
         {
-          const double angle = atan2(sn, cs);
-          Hf = length * angle;
+          double Hf; // temporary store
+
+          // find 3 corners of f: in order!
+          polyData->GetPoint(v_l, ore);
+          polyData->GetPoint(v_r, end);
+          polyData->GetPoint(v_o, oth);
+          // compute normal of f
+          vtkTriangle::ComputeNormal(ore, end, oth, n_f);
+          // compute common edge
+          e[0] = end[0];
+          e[1] = end[1];
+          e[2] = end[2];
+          e[0] -= ore[0];
+          e[1] -= ore[1];
+          e[2] -= ore[2];
+          const double length = vtkMath::Normalize(e);
+          double Af = vtkTriangle::TriangleArea(ore, end, oth);
+          // find 3 corners of n: in order!
+          polyData->GetCellPoints(n, nv_n, pts_n, vertices_n);
+          polyData->GetPoint(pts_n[0], vn0);
+          polyData->GetPoint(pts_n[1], vn1);
+          polyData->GetPoint(pts_n[2], vn2);
+          Af += double(vtkTriangle::TriangleArea(vn0, vn1, vn2));
+          // compute normal of n
+          vtkTriangle::ComputeNormal(vn0, vn1, vn2, n_n);
+          // the cosine is n_f * n_n
+          const double cs = vtkMath::Dot(n_f, n_n);
+          // the sin is (n_f x n_n) * e
+          vtkMath::Cross(n_f, n_n, t);
+          const double sn = vtkMath::Dot(t, e);
+          // signed angle in [-pi,pi]
+          if (sn != 0.0 || cs != 0.0)
+          {
+            const double angle = atan2(sn, cs);
+            Hf = length * angle;
+          }
+          else
+          {
+            Hf = 0.0;
+          }
+          // weighted Hf is added to scalar at v_l and v_r
+          if (Af != 0.0)
+          {
+            (Hf /= Af) *= 3.0;
+          }
+          edgeHf[edgeOffsets[f] + v] = Hf;
+          edgeHasHf[edgeOffsets[f] + v] = 1;
         }
-        else
+      }
+    }
+  });
+
+  // put curvature in vtkArray
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    vtkIdList* vertices = tlVertices.Local();
+    vtkIdType ncells, nv;
+    vtkIdType* cells;
+    const vtkIdType* pts;
+    for (; ptId < endPtId; ++ptId)
+    {
+      double H = 0.0;
+      int num_neighb = 0;
+      polyData->GetPointCells(ptId, ncells, cells);
+      for (vtkIdType i = 0; i < ncells; ++i)
+      {
+        // degenerate facets are linked several times to the same point
+        const vtkIdType f = cells[i];
+        if (i > 0 && f == cells[i - 1])
         {
-          Hf = 0.0;
+          continue;
         }
-        // add weighted Hf to scalar at v_l and v_r
-        if (Af != 0.0)
+        polyData->GetCellPoints(f, nv, pts, vertices);
+        for (vtkIdType v = 0; v < nv; v++)
         {
-          (Hf /= Af) *= 3.0;
+          if (!edgeHasHf[edgeOffsets[f] + v])
+          {
+            continue;
+          }
+          const double Hf = edgeHf[edgeOffsets[f] + v];
+          if (pts[v] == ptId)
+          {
+            H += Hf;
+            num_neighb++;
+          }
+          if (pts[(v + 1) % nv] == ptId)
+          {
+            H += Hf;
+            num_neighb++;
+          }
         }
-        meanCurvatureData[v_l] += Hf;
-        meanCurvatureData[v_r] += Hf;
-        num_neighb[v_l] += 1;
-        num_neighb[v_r] += 1;
       }
-    }
-  }
 
-  // put curvature in vtkArray
-  for (int v = 0; v < numPts; v++)
-  {
-    if (num_neighb[v] > 0)
-    {
-      const double Hf = 0.5 * meanCurvatureData[v] / num_neighb[v];
-      if (this->InvertMeanCurvature)
+      if (num_neighb > 0)
       {
-        meanCurvatureData[v] = -Hf;
+        const double Hf = 0.5 * H / num_neighb;
+        if (this->InvertMeanCurvature)
+        {
+          meanCurvatureData[ptId] = -Hf;
+        }
+        else
+        {
+          meanCurvatureData[ptId] = Hf;
+        }
       }
       else
       {
-        meanCurvatureData[v] = Hf;
+        meanCurvatureData[ptId] = 0.0;
       }
     }
-    else
-    {
-      meanCurvatureData[v] = 0.0;
-    }
-  }
+  });
 
   mesh->GetPointData()->AddArray(meanCurvature);
   mesh->GetPointData()->SetActiveScalars("Mean_Curvature");
@@ -261,80 +389,114 @@ void vtkCurvatures::GetGaussCurvature(vtkPolyData* output)
 void vtkCurvatures::ComputeGaussCurvature(
   vtkCellArray* facets, vtkPolyData* output, double* gaussCurvatureData)
 {
-  double v0[3], v1[3], v2[3], e0[3], e1[3], e2[3];
-
-  double A, alpha0, alpha1, alpha2;
-
-  vtkIdType f;
-  const vtkIdType* vert = nullptr;
-
-  // other data
-  vtkIdType Nv = output->GetNumberOfPoints();
-
-  const std::unique_ptr<double[]> K(new double[Nv]);
-  const std::unique_ptr<double[]> dA(new double[Nv]);
-  double pi2 = 2.0 * vtkMath::Pi();
-  for (int k = 0; k < Nv; k++)
-  {
-    K[k] = pi2;
-    dA[k] = 0.0;
-  }
-
-  facets->InitTraversal();
-  while (facets->GetNextCell(f, vert))
-  {
-    if (this->CheckAbort())
+  const vtkIdType Nv = output->GetNumberOfPoints();
+  const vtkIdType numFacets = facets->GetNumberOfCells();
+
+  // The area and the angles of every facet are computed concurrently
+  std::vector<std::array<double, 4>> facetTerms(numFacets);
+  vtkSMPThreadLocalObject<vtkIdList> tlPtIds;
+  vtkSMPTools::For(0, numFacets, [&](vtkIdType f, vtkIdType endF) {
+    vtkIdList* ptIds = tlPtIds.Local();
+    vtkIdType npts;
+    const vtkIdType* vert;
+    double v0[3], v1[3], v2[3], e0[3], e1[3], e2[3];
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; f < endF; ++f)
     {
-      break;
+      if (isFirst)
+      {
+        this->CheckAbort();
+      }
+      if (this->GetAbortOutput())
+      {
+        break;
+      }
+      facets->GetCellAtId(f, npts, vert, ptIds);
+      if (npts < 3)
+      {
+        facetTerms[f] = { 0.0, 0.0, 0.0, 0.0 };
+        continue;
+      }
+      output->GetPoint(vert[0], v0);
+      output->GetPoint(vert[1], v1);
+      output->GetPoint(vert[2], v2);
+      // edges
+      e0[0] = v1[0];
+      e0[1] = v1[1];
+      e0[2] = v1[2];
+      e0[0] -= v0[0];
+      e0[1] -= v0[1];
+      e0[2] -= v0[2];
+
+      e1[0] = v2[0];
+      e1[1] = v2[1];
+      e1[2] = v2[2];
+      e1[0] -= v1[0];
+      e1[1] -= v1[1];
+      e1[2] -= v1[2];
+
+      e2[0] = v0[0];
+      e2[1] = v0[1];
+      e2[2] = v0[2];
+      e2[0] -= v2[0];
+      e2[1] -= v2[1];
+      e2[2] -= v2[2];
+
+      // surf. area, then alpha0, alpha1, alpha2
+      facetTerms[f] = { double(vtkTriangle::TriangleArea(v0, v1, v2)),
+        vtkMath::Pi() - vtkMath::AngleBetweenVectors(e1, e2),
+        vtkMath::Pi() - vtkMath::AngleBetweenVectors(e2, e0),
+        vtkMath::Pi() - vtkMath::AngleBetweenVectors(e0, e1) };
     }
-    output->GetPoint(vert[0], v0);
-    output->GetPoint(vert[1], v1);
-    output->GetPoint(vert[2], v2);
-    // edges
-    e0[0] = v1[0];
-    e0[1] = v1[1];
-    e0[2] = v1[2];
-    e0[0] -= v0[0];
-    e0[1] -= v0[1];
-    e0[2] -= v0[2];
-
-    e1[0] = v2[0];
-    e1[1] = v2[1];
-    e1[2] = v2[2];
-    e1[0] -= v1[0];
-    e1[1] -= v1[1];
-    e1[2] -= v1[2];
-
-    e2[0] = v0[0];
-    e2[1] = v0[1];
-    e2[2] = v0[2];
-    e2[0] -= v2[0];
-    e2[1] -= v2[1];
-    e2[2] -= v2[2];
-
-    alpha0 = vtkMath::Pi() - vtkMath::AngleBetweenVectors(e1, e2);
-    alpha1 = vtkMath::Pi() - vtkMath::AngleBetweenVectors(e2, e0);
-    alpha2 = vtkMath::Pi() - vtkMath::AngleBetweenVectors(e0, e1);
-
-    // surf. area
-    A = double(vtkTriangle::TriangleArea(v0, v1, v2));
-    // UPDATE
-    dA[vert[0]] += A;
-    dA[vert[1]] += A;
-    dA[vert[2]] += A;
-    K[vert[0]] -= alpha1;
-    K[vert[1]] -= alpha2;
-    K[vert[2]] -= alpha0;
+  });
+  if (this->GetAbortOutput())
+  {
+    return;
   }
 
-  // put curvature in vtkArray
-  for (int v = 0; v < Nv; v++)
-  {
-    if (dA[v] > 0.0)
+  // Every point gathers the terms of its facets in the order of the facets,
+  // so that the sums do not depend on the number of threads.
+  vtkStaticCellLinksTemplate<vtkIdType> links;
+  links.ThreadedBuildLinks(Nv, numFacets, facets);
+  const double pi2 = 2.0 * vtkMath::Pi();
+  vtkSMPTools::For(0, Nv, [&](vtkIdType ptId, vtkIdType endPtId) {
+    vtkIdList* ptIds = tlPtIds.Local();
+    vtkIdType npts;
+    const vtkIdType* vert;
+    for (; ptId < endPtId; ++ptId)
     {
-      gaussCurvatureData[v] = 3.0 * K[v] / dA[v];
+      double K = pi2;
+      double dA = 0.0;
+      const vtkIdType ncells = links.GetNcells(ptId);
+      vtkIdType* cells = links.GetCells(ptId);
+      std::sort(cells, cells + ncells);
+      for (vtkIdType i = 0; i < ncells; ++i)
+      {
+        // degenerate facets are linked several times to the same point
+        const vtkIdType f = cells[i];
+        if (i > 0 && f == cells[i - 1])
+        {
+          continue;
+        }
+        facets->GetCellAtId(f, npts, vert, ptIds);
+        const std::array<double, 4>& terms = facetTerms[f];
+        for (vtkIdType j = 0; j < std::min<vtkIdType>(npts, 3); ++j)
+        {
+          if (vert[j] == ptId)
+          {
+            dA += terms[0];
+            K -= terms[1 + (j + 1) % 3];
+          }
+        }
+      }
+
+      // put curvature in vtkArray
+      if (dA > 0.0)
+      {
+        gaussCurvatureData[ptId] = 3.0 * K / dA;
+      }
     }
-  }
+  });
 }
 
 void vtkCurvatures::GetMaximumCurvature(vtkPolyData* input, vtkPolyData* output)
@@ -352,37 +514,14 @@ void vtkCurvatures::GetMaximumCurvature(vtkPolyData* input, vtkPolyData* output)
   output->GetPointData()->SetActiveScalars("Maximum_Curvature");
 
   vtkDoubleArray* gauss =
-    static_cast<vtkDoubleArray*>(output->GetPointData()->GetArray("Gauss_Curvature"));
+    vtkArrayDownCast<vtkDoubleArray>(output->GetPointData()->GetArray("Gauss_Curvature"));
   vtkDoubleArray* mean =
-    static_cast<vtkDoubleArray*>(output->GetPointData()->GetArray("Mean_Curvature"));
-  double k, h, k_max, tmp;
-
-  for (vtkIdType i = 0; i < numPts; i++)
+    vtkArrayDownCast<vtkDoubleArray>(output->GetPointData()->GetArray("Mean_Curvature"));
+  if (!gauss || !mean)
   {
-    if (this->CheckAbort())
-    {
-      break;
-    }
-
-    k = gauss->GetComponent(i, 0);
-    h = mean->GetComponent(i, 0);
-    tmp = h * h - k;
-    if (tmp >= 0)
-    {
-      k_max = h + sqrt(tmp);
-    }
-    else
-    {
-      k_max = h;
-      if (tmp < -0.1)
-      {
-        vtkWarningMacro(
-          << "The Gaussian or mean curvature at point " << i
-          << " have a large computation error... The maximum curvature is likely off.");
-      }
-    }
-    maximumCurvature->SetComponent(i, 0, k_max);
+    return;
   }
+  ComputePrincipalCurvature(this, gauss, mean, maximumCurvature, true);
 }
 
 void vtkCurvatures::GetMinimumCurvature(vtkPolyData* input, vtkPolyData* output)
@@ -400,37 +539,14 @@ void vtkCurvatures::GetMinimumCurvature(vtkPolyData* input, vtkPolyData* output)
   output->GetPointData()->SetActiveScalars("Minimum_Curvature");
 
   vtkDoubleArray* gauss =
-    static_cast<vtkDoubleArray*>(output->GetPointData()->GetArray("Gauss_Curvature"));
+    vtkArrayDownCast<vtkDoubleArray>(output->GetPointData()->GetArray("Gauss_Curvature"));
   vtkDoubleArray* mean =
-    static_cast<vtkDoubleArray*>(output->GetPointData()->GetArray("Mean_Curvature"));
-  double k, h, k_min, tmp;
-
-  for (vtkIdType i = 0; i < numPts; i++)
+    vtkArrayDownCast<vtkDoubleArray>(output->GetPointData()->GetArray("Mean_Curvature"));
+  if (!gauss || !mean)
   {
-    if (this->CheckAbort())
-    {
-      break;
-    }
-
-    k = gauss->GetComponent(i, 0);
-    h = mean->GetComponent(i, 0);
-    tmp = h * h - k;
-    if (tmp >= 0)
-    {
-      k_min = h - sqrt(tmp);
-    }
-    else
-    {
-      k_min = h;
-      if (tmp < -0.1)
-      {
-        vtkWarningMacro(
-          << "The Gaussian or mean curvature at point " << i
-          << " have a large computation error... The minimum curvature is likely off.");
-      }
-    }
-    minimumCurvature->SetComponent(i, 0, k_min);
+    return;
   }
+  ComputePrincipalCurvature(this, gauss, mean, minimumCurvature, false);
 }
 
 //-------------------------------------------------------
@@ -41,6 +41,10 @@
  *  can be set and the Curvature reported by the Mean calculation will
  * be inverted.
  *
+ * The curvatures are computed in parallel using vtkSMPTools. The
+ * contributions of the facets are summed at every point in the order of the
+ * facets, so that the result does not depend on the number of threads.
+ *
  * For a little more information see
  * <a href="https://public.kitware.com/pipermail/vtkusers/2002-July/012198.html"
  * >Computing curvature of a surface</a>
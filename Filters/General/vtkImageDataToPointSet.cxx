@@ -25,6 +25,7 @@ vtkImageDataToPointSet::~vtkImageDataToPointSet() = default;
 void vtkImageDataToPointSet::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "UseImplicitArrays: " << (this->UseImplicitArrays ? "On" : "Off") << endl;
 }
 
 //------------------------------------------------------------------------------
@@ -62,19 +63,28 @@ int vtkImageDataToPointSet::RequestData(vtkInformation* vtkNotUsed(request),
   outData->GetCellData()->PassData(inData->GetCellData());
 
   // Extract points coordinates from the image
-  vtkIdType nbPoints = inData->GetNumberOfPoints();
   vtkNew<vtkPoints> points;
-  points->SetDataTypeToDouble();
-  points->SetNumberOfPoints(nbPoints);
-  for (vtkIdType i = 0; i < nbPoints; i++)
+  if (this->UseImplicitArrays)
   {
-    if (this->CheckAbort())
+    // The image already describes its points with an implicit array computed
+    // from its origin, spacing and direction: share it.
+    points->SetData(inData->GetPoints()->GetData());
+  }
+  else
+  {
+    vtkIdType nbPoints = inData->GetNumberOfPoints();
+    points->SetDataTypeToDouble();
+    points->SetNumberOfPoints(nbPoints);
+    for (vtkIdType i = 0; i < nbPoints; i++)
     {
-      break;
+      if (this->CheckAbort())
+      {
+        break;
+      }
+      double p[3];
+      inData->GetPoint(i, p);
+      points->SetPoint(i, p);
     }
-    double p[3];
-    inData->GetPoint(i, p);
-    points->SetPoint(i, p);
   }
   outData->SetPoints(points);
 
@@ -33,6 +33,19 @@ public:
 
   static vtkImageDataToPointSet* New();
 
+  ///@{
+  /**
+   * Get/Set whether the output points are stored in an implicit array computed
+   * from the image coordinates instead of an explicit array of 3-component tuples.
+   * This avoids allocating memory for the coordinates of each point, but the
+   * output points cannot be modified in place.
+   * Default is false.
+   */
+  vtkSetMacro(UseImplicitArrays, bool);
+  vtkGetMacro(UseImplicitArrays, bool);
+  vtkBooleanMacro(UseImplicitArrays, bool);
+  ///@}
+
 protected:
   vtkImageDataToPointSet();
   ~vtkImageDataToPointSet() override;
@@ -42,6 +55,8 @@ protected:
 
   int FillInputPortInformation(int port, vtkInformation* info) override;
 
+  bool UseImplicitArrays = false;
+
 private:
   vtkImageDataToPointSet(const vtkImageDataToPointSet&) = delete;
   void operator=(const vtkImageDataToPointSet&) = delete;
@@ -175,57 +175,19 @@ vtkIdType vtkInterpolatingSubdivisionFilter::InterpolatePosition(
   return outputPts->InsertNextPoint(x);
 }
 
-void vtkInterpolatingSubdivisionFilter::GenerateSubdivisionCells(
-  vtkPolyData* inputDS, vtkIntArray* edgeData, vtkCellArray* outputPolys, vtkCellData* outputCD)
+void vtkInterpolatingSubdivisionFilter::InterpolatePosition(vtkPoints* inputPts,
+  vtkPoints* outputPts, vtkIdType outputId, vtkIdList* stencil, const double* weights)
 {
-  vtkIdType numCells = inputDS->GetNumberOfCells();
-  vtkIdType cellId, newId;
-  int id;
-  vtkIdType npts;
-  const vtkIdType* pts;
-  double edgePts[3];
-  vtkIdType newCellPts[3];
-  vtkCellData* inputCD = inputDS->GetCellData();
-
-  // Now create new cells from existing points and generated edge points
-  for (cellId = 0; cellId < numCells; cellId++)
+  double xx[3], x[3] = { 0.0, 0.0, 0.0 };
+  for (vtkIdType i = 0; i < stencil->GetNumberOfIds(); i++)
   {
-    if (inputDS->GetCellType(cellId) != VTK_TRIANGLE)
+    inputPts->GetPoint(stencil->GetId(i), xx);
+    for (int j = 0; j < 3; j++)
     {
-      continue;
+      x[j] += xx[j] * weights[i];
     }
-    // get the original point ids and the ids stored as cell data
-    inputDS->GetCellPoints(cellId, npts, pts);
-    edgeData->GetTuple(cellId, edgePts);
-
-    id = 0;
-    newCellPts[id++] = pts[0];
-    newCellPts[id++] = (int)edgePts[1];
-    newCellPts[id] = (int)edgePts[0];
-    newId = outputPolys->InsertNextCell(3, newCellPts);
-    outputCD->CopyData(inputCD, cellId, newId);
-
-    id = 0;
-    newCellPts[id++] = (int)edgePts[1];
-    newCellPts[id++] = pts[1];
-    newCellPts[id] = (int)edgePts[2];
-    newId = outputPolys->InsertNextCell(3, newCellPts);
-    outputCD->CopyData(inputCD, cellId, newId);
-
-    id = 0;
-    newCellPts[id++] = (int)edgePts[2];
-    newCellPts[id++] = pts[2];
-    newCellPts[id] = (int)edgePts[0];
-    newId = outputPolys->InsertNextCell(3, newCellPts);
-    outputCD->CopyData(inputCD, cellId, newId);
-
-    id = 0;
-    newCellPts[id++] = (int)edgePts[1];
-    newCellPts[id++] = (int)edgePts[2];
-    newCellPts[id] = (int)edgePts[0];
-    newId = outputPolys->InsertNextCell(3, newCellPts);
-    outputCD->CopyData(inputCD, cellId, newId);
   }
+  outputPts->SetPoint(outputId, x);
 }
 
 void vtkInterpolatingSubdivisionFilter::PrintSelf(ostream& os, vtkIndent indent)
@@ -42,6 +42,11 @@
  * indicating if the cell has any free edges. A watertight surface will have
  * 0 everywhere for this array!
  *
+ * The candidate triangle pairs found by the OBB trees of the two inputs are
+ * intersected concurrently with vtkSMPTools. The intersection lines are then
+ * assembled in the order of the tree traversal, so the output does not depend
+ * on the number of threads.
+ *
  * @author Adam Updegrove updega2@gmail.com
  *
  * @warning This filter is not designed to perform 2D boolean operations,
@@ -7,15 +7,30 @@
 #include "vtkLine.h"
 #include "vtkMath.h"
 #include "vtkMatrix4x4.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkTriangle.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <utility>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+// The cells of a node are processed by chunks of this size when computing its
+// OBB. The moments are summed per chunk and then over the chunks in order, so
+// that the tree does not depend on the number of threads.
+const vtkIdType OBB_CHUNK_SIZE = 1024;
+}
+
 //------------------------------------------------------------------------------
 vtkStandardNewMacro(vtkOBBTree);
 
@@ -70,8 +85,6 @@ vtkOBBTree::vtkOBBTree()
   this->MaxLevel = 12;
   this->Tolerance = 0.01;
   this->Tree = nullptr;
-  this->PointsList = nullptr;
-  this->InsertedPoints = nullptr;
   this->OBBCount = 0;
 }
 
@@ -230,18 +243,23 @@ void vtkOBBTree::ComputeOBB(
 void vtkOBBTree::ComputeOBB(
   vtkDataSet* input, double corner[3], double max[3], double mid[3], double min[3], double size[3])
 {
-  vtkIdType numPts, numCells, i;
+  vtkIdType numCells;
   vtkIdList* cellList;
   vtkDataSet* origDataSet;
 
   vtkDebugMacro(<< "Computing OBB");
 
-  if (input == nullptr || (numPts = input->GetNumberOfPoints()) < 1 ||
-    (input->GetNumberOfCells()) < 1)
+  if (input == nullptr || input->GetNumberOfPoints() < 1 || (input->GetNumberOfCells()) < 1)
   {
     vtkErrorMacro(<< "Can't compute OBB - no data available!");
     return;
   }
+  if (input->GetDataObjectType() != VTK_POLY_DATA &&
+    input->GetDataObjectType() != VTK_UNSTRUCTURED_GRID)
+  {
+    vtkErrorMacro(<< "DataSet " << input->GetClassName() << " not supported.");
+    return;
+  }
   numCells = input->GetNumberOfCells();
 
   // save previous value of DataSet and reset after calling ComputeOBB because
@@ -249,28 +267,13 @@ void vtkOBBTree::ComputeOBB(
   origDataSet = this->DataSet;
   this->DataSet = input;
 
-  // these are other member variables that ComputeOBB requires
-  this->OBBCount = 0;
-  this->InsertedPoints = new int[numPts];
-  for (i = 0; i < numPts; i++)
-  {
-    this->InsertedPoints[i] = 0;
-  }
-  this->PointsList = vtkPoints::New();
-  this->PointsList->Allocate(numPts);
-
   cellList = vtkIdList::New();
-  cellList->Allocate(numCells);
-  for (i = 0; i < numCells; i++)
-  {
-    cellList->InsertId(i, i);
-  }
+  cellList->SetNumberOfIds(numCells);
+  std::iota(cellList->begin(), cellList->end(), 0);
 
   this->ComputeOBB(cellList, corner, max, mid, min, size);
 
   this->DataSet = origDataSet;
-  delete[] this->InsertedPoints;
-  this->PointsList->Delete();
   cellList->Delete();
 }
 
@@ -281,110 +284,112 @@ void vtkOBBTree::ComputeOBB(
 void vtkOBBTree::ComputeOBB(
   vtkIdList* cells, double corner[3], double max[3], double mid[3], double min[3], double size[3])
 {
-  vtkIdType numCells, i, j, cellId, ptId, pId, qId, rId;
-  int k, type;
-  vtkIdType numPts = 0;
-  const vtkIdType* ptIds = nullptr;
-  double p[3], q[3], r[3], mean[3], xp[3], *v[3], v0[3], v1[3], v2[3];
+  vtkIdType i, j;
+  double *v[3], v0[3], v1[3], v2[3];
   double *a[3], a0[3], a1[3], a2[3];
-  double tMin[3], tMax[3], closest[3], t;
-  double dp0[3], dp1[3], tri_mass, tot_mass, c[3];
-
-  this->OBBCount++;
-  this->PointsList->Reset();
-  //
-  // Compute mean & moments
-  //
+  double mean[3], tMin[3], tMax[3], tot_mass;
 
-  numCells = cells->GetNumberOfIds();
-  mean[0] = mean[1] = mean[2] = 0.0;
-  tot_mass = 0.0;
-  a[0] = a0;
-  a[1] = a1;
-  a[2] = a2;
-  for (i = 0; i < 3; i++)
+  // The first GetCellPoints() call builds the cell map of a vtkPolyData, which
+  // the chunks below would otherwise race to build.
+  vtkIdType numCells = cells->GetNumberOfIds();
+  vtkNew<vtkIdList> cellPts;
+  if (numCells > 0)
   {
-    a0[i] = a1[i] = a2[i] = 0.0;
+    this->DataSet->GetCellPoints(cells->GetId(0), cellPts);
   }
 
-  for (i = 0; i < numCells; i++)
-  {
-    cellId = cells->GetId(i);
-    type = this->DataSet->GetCellType(cellId);
-    switch (this->DataSet->GetDataObjectType())
-    {
-      case VTK_POLY_DATA:
-        ((vtkPolyData*)this->DataSet)->GetCellPoints(cellId, numPts, ptIds);
-        break;
-      case VTK_UNSTRUCTURED_GRID:
-        ((vtkUnstructuredGrid*)this->DataSet)->GetCellPoints(cellId, numPts, ptIds);
-        break;
-      default:
-        vtkErrorMacro(<< "DataSet " << this->DataSet->GetClassName() << " not supported.");
-        break;
-    }
-    for (j = 0; j < numPts - 2; j++)
+  //
+  // Compute mean & moments. The moments are summed per chunk of cells, then
+  // over the chunks in order.
+  //
+  const vtkIdType numChunks = (numCells + OBB_CHUNK_SIZE - 1) / OBB_CHUNK_SIZE;
+  std::vector<std::array<double, 10>> chunkMoments(numChunks);
+  vtkSMPThreadLocalObject<vtkIdList> tlCellPts;
+  vtkSMPTools::For(0, numChunks, [&](vtkIdType chunk, vtkIdType endChunk) {
+    vtkIdList* ptIdList = tlCellPts.Local();
+    vtkIdType numPts, pId, qId, rId;
+    const vtkIdType* ptIds;
+    double p[3], q[3], r[3], xp[3], dp0[3], dp1[3], c[3], tri_mass;
+    for (; chunk < endChunk; ++chunk)
     {
-      vtkCELLTRIANGLES(ptIds, type, j, pId, qId, rId);
-      if (pId < 0)
+      // mass, mean, then the moments a00 a11 a22 a01 a02 a12
+      std::array<double, 10>& m = chunkMoments[chunk];
+      m.fill(0.0);
+      const vtkIdType endId = std::min(numCells, (chunk + 1) * OBB_CHUNK_SIZE);
+      for (vtkIdType id = chunk * OBB_CHUNK_SIZE; id < endId; ++id)
       {
-        continue;
-      }
-      this->DataSet->GetPoint(pId, p);
-      this->DataSet->GetPoint(qId, q);
-      this->DataSet->GetPoint(rId, r);
-      // p, q, and r are the oriented triangle points.
-      // Compute the components of the moment of inertia tensor.
-      for (k = 0; k < 3; k++)
-      {
-        // two edge vectors
-        dp0[k] = q[k] - p[k];
-        dp1[k] = r[k] - p[k];
-        // centroid
-        c[k] = (p[k] + q[k] + r[k]) / 3;
-      }
-      vtkMath::Cross(dp0, dp1, xp);
-      tri_mass = 0.5 * vtkMath::Norm(xp);
-      tot_mass += tri_mass;
-      for (k = 0; k < 3; k++)
-      {
-        mean[k] += tri_mass * c[k];
-      }
+        vtkIdType cellId = cells->GetId(id);
+        int type = this->DataSet->GetCellType(cellId);
+        this->DataSet->GetCellPoints(cellId, numPts, ptIds, ptIdList);
+        for (vtkIdType k = 0; k < numPts - 2; k++)
+        {
+          vtkCELLTRIANGLES(ptIds, type, k, pId, qId, rId);
+          if (pId < 0)
+          {
+            continue;
+          }
+          this->DataSet->GetPoint(pId, p);
+          this->DataSet->GetPoint(qId, q);
+          this->DataSet->GetPoint(rId, r);
+          // p, q, and r are the oriented triangle points.
+          // Compute the components of the moment of inertia tensor.
+          for (int l = 0; l < 3; l++)
+          {
+            // two edge vectors
+            dp0[l] = q[l] - p[l];
+            dp1[l] = r[l] - p[l];
+            // centroid
+            c[l] = (p[l] + q[l] + r[l]) / 3;
+          }
+          vtkMath::Cross(dp0, dp1, xp);
+          tri_mass = 0.5 * vtkMath::Norm(xp);
+          m[0] += tri_mass;
+          for (int l = 0; l < 3; l++)
+          {
+            m[1 + l] += tri_mass * c[l];
+          }
+
+          // on-diagonal terms
+          m[4] += tri_mass * (9 * c[0] * c[0] + p[0] * p[0] + q[0] * q[0] + r[0] * r[0]) / 12;
+          m[5] += tri_mass * (9 * c[1] * c[1] + p[1] * p[1] + q[1] * q[1] + r[1] * r[1]) / 12;
+          m[6] += tri_mass * (9 * c[2] * c[2] + p[2] * p[2] + q[2] * q[2] + r[2] * r[2]) / 12;
+
+          // off-diagonal terms
+          m[7] += tri_mass * (9 * c[0] * c[1] + p[0] * p[1] + q[0] * q[1] + r[0] * r[1]) / 12;
+          m[8] += tri_mass * (9 * c[0] * c[2] + p[0] * p[2] + q[0] * q[2] + r[0] * r[2]) / 12;
+          m[9] += tri_mass * (9 * c[1] * c[2] + p[1] * p[2] + q[1] * q[2] + r[1] * r[2]) / 12;
+        } // end foreach triangle
+      }   // end foreach cell
+    }
+  });
 
-      // on-diagonal terms
-      a0[0] += tri_mass * (9 * c[0] * c[0] + p[0] * p[0] + q[0] * q[0] + r[0] * r[0]) / 12;
-      a1[1] += tri_mass * (9 * c[1] * c[1] + p[1] * p[1] + q[1] * q[1] + r[1] * r[1]) / 12;
-      a2[2] += tri_mass * (9 * c[2] * c[2] + p[2] * p[2] + q[2] * q[2] + r[2] * r[2]) / 12;
-
-      // off-diagonal terms
-      a0[1] += tri_mass * (9 * c[0] * c[1] + p[0] * p[1] + q[0] * q[1] + r[0] * r[1]) / 12;
-      a0[2] += tri_mass * (9 * c[0] * c[2] + p[0] * p[2] + q[0] * q[2] + r[0] * r[2]) / 12;
-      a1[2] += tri_mass * (9 * c[1] * c[2] + p[1] * p[2] + q[1] * q[2] + r[1] * r[2]) / 12;
-    } // end foreach triangle
-
-    // While computing cell moments, gather all the cell's
-    // point coordinates into a single list.
-    //
-    for (j = 0; j < numPts; j++)
+  std::array<double, 10> moments;
+  moments.fill(0.0);
+  for (const auto& m : chunkMoments)
+  {
+    for (i = 0; i < 10; i++)
     {
-      if (this->InsertedPoints[ptIds[j]] != this->OBBCount)
-      {
-        this->InsertedPoints[ptIds[j]] = this->OBBCount;
-        this->PointsList->InsertNextPoint(this->DataSet->GetPoint(ptIds[j]));
-      }
-    } // for all points of this cell
-  }   // end foreach cell
+      moments[i] += m[i];
+    }
+  }
 
   // normalize data
+  tot_mass = moments[0];
   for (i = 0; i < 3; i++)
   {
-    mean[i] = mean[i] / tot_mass;
+    mean[i] = moments[1 + i] / tot_mass;
   }
 
   // matrix is symmetric
-  a1[0] = a0[1];
-  a2[0] = a0[2];
-  a2[1] = a1[2];
+  a[0] = a0;
+  a[1] = a1;
+  a[2] = a2;
+  a0[0] = moments[4];
+  a1[1] = moments[5];
+  a2[2] = moments[6];
+  a0[1] = a1[0] = moments[7];
+  a0[2] = a2[0] = moments[8];
+  a1[2] = a2[1] = moments[9];
 
   // get covariance from moments
   for (i = 0; i < 3; i++)
@@ -420,28 +425,50 @@ void vtkOBBTree::ComputeOBB(
   }
 
   //
-  // Create oriented bounding box by projecting points onto eigenvectors.
+  // Create oriented bounding box by projecting the points of the cells onto
+  // eigenvectors. Points shared by several cells are projected several times,
+  // which does not change the extent of the box.
   //
+  std::vector<std::array<double, 6>> chunkRanges(numChunks);
+  vtkSMPTools::For(0, numChunks, [&](vtkIdType chunk, vtkIdType endChunk) {
+    vtkIdList* ptIdList = tlCellPts.Local();
+    vtkIdType numPts;
+    const vtkIdType* ptIds;
+    double p[3], closest[3], t;
+    for (; chunk < endChunk; ++chunk)
+    {
+      // tMin then tMax along the three axes
+      std::array<double, 6>& range = chunkRanges[chunk];
+      range = { VTK_DOUBLE_MAX, VTK_DOUBLE_MAX, VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX,
+        -VTK_DOUBLE_MAX };
+      const vtkIdType endId = std::min(numCells, (chunk + 1) * OBB_CHUNK_SIZE);
+      for (vtkIdType id = chunk * OBB_CHUNK_SIZE; id < endId; ++id)
+      {
+        this->DataSet->GetCellPoints(cells->GetId(id), numPts, ptIds, ptIdList);
+        for (vtkIdType k = 0; k < numPts; k++)
+        {
+          this->DataSet->GetPoint(ptIds[k], p);
+          for (int l = 0; l < 3; l++)
+          {
+            vtkLine::DistanceToLine(p, mean, a[l], t, closest);
+            range[l] = std::min(range[l], t);
+            range[3 + l] = std::max(range[3 + l], t);
+          }
+        }
+      } // for all cells
+    }
+  });
+
   tMin[0] = tMin[1] = tMin[2] = VTK_DOUBLE_MAX;
   tMax[0] = tMax[1] = tMax[2] = -VTK_DOUBLE_MAX;
-
-  numPts = this->PointsList->GetNumberOfPoints();
-  for (ptId = 0; ptId < numPts; ptId++)
+  for (const auto& range : chunkRanges)
   {
-    this->PointsList->GetPoint(ptId, p);
     for (i = 0; i < 3; i++)
     {
-      vtkLine::DistanceToLine(p, mean, a[i], t, closest);
-      if (t < tMin[i])
-      {
-        tMin[i] = t;
-      }
-      if (t > tMax[i])
-      {
-        tMax[i] = t;
-      }
+      tMin[i] = std::min(tMin[i], range[i]);
+      tMax[i] = std::max(tMax[i], range[3 + i]);
     }
-  } // for all points
+  }
 
   for (i = 0; i < 3; i++)
   {
@@ -1066,7 +1093,7 @@ void vtkOBBTree::ForceBuildLocator()
 //------------------------------------------------------------------------------
 void vtkOBBTree::BuildLocatorInternal()
 {
-  vtkIdType numPts, numCells, i;
+  vtkIdType numPts, numCells;
   vtkIdList* cellList;
 
   vtkDebugMacro(<< "Building OBB tree");
@@ -1078,31 +1105,67 @@ void vtkOBBTree::BuildLocatorInternal()
     vtkErrorMacro(<< "Can't build OBB tree - no data available!");
     return;
   }
-
-  this->OBBCount = 0;
-  this->InsertedPoints = new int[numPts];
-  for (i = 0; i < numPts; i++)
+  if (this->DataSet->GetDataObjectType() != VTK_POLY_DATA &&
+    this->DataSet->GetDataObjectType() != VTK_UNSTRUCTURED_GRID)
   {
-    this->InsertedPoints[i] = 0;
+    vtkErrorMacro(<< "DataSet " << this->DataSet->GetClassName() << " not supported.");
+    return;
   }
-  this->PointsList = vtkPoints::New();
-  this->PointsList->Allocate(numPts);
 
   //
-  // Begin recursively creating OBB's
+  // Begin creating OBB's, one level of the tree at a time
   //
   cellList = vtkIdList::New();
-  cellList->Allocate(numCells);
-  for (i = 0; i < numCells; i++)
-  {
-    cellList->InsertId(i, i);
-  }
+  cellList->SetNumberOfIds(numCells);
+  std::iota(cellList->begin(), cellList->end(), 0);
 
   this->FreeSearchStructure();
 
   this->Tree = new vtkOBBNode;
+  this->Tree->Cells = cellList;
   this->Level = 0;
-  this->BuildTree(cellList, this->Tree, 0);
+  this->OBBCount = 0;
+
+  // The nodes of a level are built concurrently when there are enough of
+  // them, otherwise they are built one after the other with threaded loops
+  // over their cells. vtkSMPTools::TaskGraph does not fit this recursion: the
+  // kids of a node are only known once it is split, and tasks cannot add
+  // tasks to the graph they belong to.
+  const size_t numThreads = static_cast<size_t>(vtkSMPTools::GetEstimatedNumberOfThreads());
+  std::vector<vtkOBBNode*> nodes(1, this->Tree);
+  for (int level = 0; !nodes.empty(); level++)
+  {
+    this->Level = level;
+    this->OBBCount += static_cast<int>(nodes.size());
+    if (nodes.size() < numThreads)
+    {
+      for (vtkOBBNode* node : nodes)
+      {
+        this->BuildTree(node->Cells, node, level);
+      }
+    }
+    else
+    {
+      vtkSMPTools::For(0, static_cast<vtkIdType>(nodes.size()), 1,
+        [&](vtkIdType nodeId, vtkIdType endNodeId) {
+          for (; nodeId < endNodeId; ++nodeId)
+          {
+            this->BuildTree(nodes[nodeId]->Cells, nodes[nodeId], level);
+          }
+        });
+    }
+
+    std::vector<vtkOBBNode*> kids;
+    for (vtkOBBNode* node : nodes)
+    {
+      if (node->Kids)
+      {
+        kids.push_back(node->Kids[0]);
+        kids.push_back(node->Kids[1]);
+      }
+    }
+    nodes.swap(kids);
+  }
 
   vtkDebugMacro(<< "# Cells: " << numCells << ", Deepest tree level: " << this->Level
                 << ", Created: " << this->OBBCount << " OBB nodes");
@@ -1116,33 +1179,22 @@ void vtkOBBTree::BuildLocatorInternal()
     cout.flush();
   }
 
-  //
-  // Clean up
-  //
-  delete[] this->InsertedPoints;
-  this->PointsList->Delete();
-
   this->BuildTime.Modified();
 }
 
 //------------------------------------------------------------------------------
-// NOTE: for better memory usage this recursive method
-// frees its first argument
+// NOTE: for better memory usage this method frees its first argument. The
+// kids of a split node are returned with their list of cells, to be built at
+// the next level.
 void vtkOBBTree::BuildTree(vtkIdList* cells, vtkOBBNode* OBBptr, int level)
 {
-  vtkIdType i, j, numCells = cells->GetNumberOfIds();
-  vtkIdType cellId;
-  vtkIdType ptId;
-  vtkIdList* cellPts = vtkIdList::New();
+  vtkIdType i, numCells = cells->GetNumberOfIds();
   double size[3];
 
-  if (level > this->Level)
-  {
-    this->Level = level;
-  }
   //
   // Now compute the OBB
   //
+  OBBptr->Cells = nullptr;
   this->ComputeOBB(cells, OBBptr->Corner, OBBptr->Axes[0], OBBptr->Axes[1], OBBptr->Axes[2], size);
 
   //
@@ -1151,14 +1203,13 @@ void vtkOBBTree::BuildTree(vtkIdList* cells, vtkOBBNode* OBBptr, int level)
   //
   if (level < this->MaxLevel && numCells > this->NumberOfCellsPerNode)
   {
-    vtkIdList* LHlist = vtkIdList::New();
-    LHlist->Allocate(cells->GetNumberOfIds() / 2);
-    vtkIdList* RHlist = vtkIdList::New();
-    RHlist->Allocate(cells->GetNumberOfIds() / 2);
-    double n[3], p[3], c[3], x[3], val, ratio, bestRatio;
-    int negative, positive, splitAcceptable, splitPlane;
-    int foundBestSplit, bestPlane = 0, numPts;
-    int numInLHnode, numInRHnode;
+    double n[3], p[3], ratio, bestRatio;
+    int splitAcceptable, splitPlane;
+    int foundBestSplit, bestPlane = 0;
+    vtkIdType numInLHnode, numInRHnode;
+    // side of the split plane of every cell, 1 for the left hand side
+    std::vector<unsigned char> leftHandSide(numCells);
+    vtkSMPThreadLocalObject<vtkIdList> tlCellPts;
 
     // loop over three split planes to find acceptable one
     for (i = 0; i < 3; i++) // compute split point
@@ -1178,61 +1229,52 @@ void vtkOBBTree::BuildTree(vtkIdList* cells, vtkOBBNode* OBBptr, int level)
       }
       vtkMath::Normalize(n);
 
-      // traverse cells, assigning to appropriate child list as necessary
-      for (i = 0; i < numCells; i++)
-      {
-        cellId = cells->GetId(i);
-        this->DataSet->GetCellPoints(cellId, cellPts);
-        c[0] = c[1] = c[2] = 0.0;
-        numPts = cellPts->GetNumberOfIds();
-        for (negative = positive = j = 0; j < numPts; j++)
+      // traverse cells, assigning to appropriate child as necessary
+      vtkSMPTools::For(0, numCells, [&](vtkIdType id, vtkIdType endId) {
+        vtkIdList* cellPts = tlCellPts.Local();
+        double c[3], x[3], val;
+        int negative, positive;
+        for (; id < endId; ++id)
         {
-          ptId = cellPts->GetId(j);
-          this->DataSet->GetPoint(ptId, x);
-          val = n[0] * (x[0] - p[0]) + n[1] * (x[1] - p[1]) + n[2] * (x[2] - p[2]);
-          c[0] += x[0];
-          c[1] += x[1];
-          c[2] += x[2];
-          if (val < 0.0)
+          this->DataSet->GetCellPoints(cells->GetId(id), cellPts);
+          c[0] = c[1] = c[2] = 0.0;
+          vtkIdType numPts = cellPts->GetNumberOfIds();
+          negative = positive = 0;
+          for (vtkIdType j = 0; j < numPts; j++)
           {
-            negative = 1;
-          }
-          else
-          {
-            positive = 1;
+            this->DataSet->GetPoint(cellPts->GetId(j), x);
+            val = n[0] * (x[0] - p[0]) + n[1] * (x[1] - p[1]) + n[2] * (x[2] - p[2]);
+            c[0] += x[0];
+            c[1] += x[1];
+            c[2] += x[2];
+            if (val < 0.0)
+            {
+              negative = 1;
+            }
+            else
+            {
+              positive = 1;
+            }
           }
-        }
 
-        if (negative && positive)
-        { // Use centroid to decide straddle cases
-          c[0] /= numPts;
-          c[1] /= numPts;
-          c[2] /= numPts;
-          if (n[0] * (c[0] - p[0]) + n[1] * (c[1] - p[1]) + n[2] * (c[2] - p[2]) < 0.0)
-          {
-            LHlist->InsertNextId(cellId);
+          if (negative && positive)
+          { // Use centroid to decide straddle cases
+            c[0] /= numPts;
+            c[1] /= numPts;
+            c[2] /= numPts;
+            leftHandSide[id] =
+              n[0] * (c[0] - p[0]) + n[1] * (c[1] - p[1]) + n[2] * (c[2] - p[2]) < 0.0;
           }
           else
           {
-            RHlist->InsertNextId(cellId);
+            leftHandSide[id] = negative;
           }
         }
-        else
-        {
-          if (negative)
-          {
-            LHlist->InsertNextId(cellId);
-          }
-          else
-          {
-            RHlist->InsertNextId(cellId);
-          }
-        }
-      } // for all cells
+      }); // for all cells
 
       // evaluate this split
-      numInLHnode = LHlist->GetNumberOfIds();
-      numInRHnode = RHlist->GetNumberOfIds();
+      numInLHnode = std::count(leftHandSide.begin(), leftHandSide.end(), 1);
+      numInRHnode = numCells - numInLHnode;
       ratio = fabs(((double)numInRHnode - numInLHnode) / numCells);
 
       // see whether we've found acceptable split plane
@@ -1242,8 +1284,6 @@ void vtkOBBTree::BuildTree(vtkIdList* cells, vtkOBBNode* OBBptr, int level)
       }
       else
       { // not a great split try another
-        LHlist->Reset();
-        RHlist->Reset();
         if (ratio < bestRatio)
         {
           bestRatio = ratio;
@@ -1260,6 +1300,22 @@ void vtkOBBTree::BuildTree(vtkIdList* cells, vtkOBBNode* OBBptr, int level)
 
     if (splitAcceptable) // otherwise recursion terminates
     {
+      vtkIdList* LHlist = vtkIdList::New();
+      LHlist->SetNumberOfIds(numInLHnode);
+      vtkIdList* RHlist = vtkIdList::New();
+      RHlist->SetNumberOfIds(numInRHnode);
+      for (vtkIdType id = 0, LHId = 0, RHId = 0; id < numCells; id++)
+      {
+        if (leftHandSide[id])
+        {
+          LHlist->SetId(LHId++, cells->GetId(id));
+        }
+        else
+        {
+          RHlist->SetId(RHId++, cells->GetId(id));
+        }
+      }
+
       vtkOBBNode* LHnode = new vtkOBBNode;
       vtkOBBNode* RHnode = new vtkOBBNode;
       OBBptr->Kids = new vtkOBBNode*[2];
@@ -1267,17 +1323,11 @@ void vtkOBBTree::BuildTree(vtkIdList* cells, vtkOBBNode* OBBptr, int level)
       OBBptr->Kids[1] = RHnode;
       LHnode->Parent = OBBptr;
       RHnode->Parent = OBBptr;
+      LHnode->Cells = LHlist;
+      RHnode->Cells = RHlist;
 
       cells->Delete();
       cells = nullptr; // don't need to keep anymore
-      this->BuildTree(LHlist, LHnode, level + 1);
-      this->BuildTree(RHlist, RHnode, level + 1);
-    }
-    else
-    {
-      // free up local objects
-      LHlist->Delete();
-      RHlist->Delete();
     }
   } // if should build tree
 
@@ -1290,7 +1340,6 @@ void vtkOBBTree::BuildTree(vtkIdList* cells, vtkOBBNode* OBBptr, int level)
   {
     cells->Delete();
   }
-  cellPts->Delete();
 }
 
 //------------------------------------------------------------------------------
@@ -1823,82 +1872,121 @@ int vtkOBBTree::IntersectWithOBBTree(vtkOBBTree* OBBTreeB, vtkMatrix4x4* XformBt
   int (*function)(vtkOBBNode* nodeA, vtkOBBNode* nodeB, vtkMatrix4x4* Xform, void* arg),
   void* data_arg)
 {
-  int maxdepth, mindepth, depth, returnValue = 0, count = 0, maxStackDepth;
-  vtkOBBNode **OBBstackA, **OBBstackB, *nodeA, *nodeB;
-
-  // Intersect OBBs and process intersecting leaf nodes.
-  maxdepth = this->GetLevel();
-  if ((mindepth = OBBTreeB->GetLevel()) > maxdepth)
-  {
-    mindepth = maxdepth;
-    maxdepth = OBBTreeB->GetLevel();
-  }
-  // Compute maximum theoretical recursion depth.
-  maxStackDepth = 3 * mindepth + 2 * (maxdepth - mindepth) + 1;
-
-  OBBstackA = new vtkOBBNode*[maxStackDepth];
-  OBBstackB = new vtkOBBNode*[maxStackDepth];
-  OBBstackA[0] = this->Tree;
-  OBBstackB[0] = OBBTreeB->Tree;
-  depth = 1;
-  while (depth > 0 && returnValue > -1)
-  { // simulate recursion without overhead of real recursion.
-    depth--;
-    nodeA = OBBstackA[depth];
-    nodeB = OBBstackB[depth];
-    if (!this->DisjointOBBNodes(nodeA, nodeB, XformBtoA))
+  using NodePair = std::pair<vtkOBBNode*, vtkOBBNode*>;
+  int returnValue = 0, count = 0;
+
+  // Expand the pairs of nodes breadth first until there are enough of them
+  // to keep the threads busy. The kids of a pair are listed in the order in
+  // which a depth first traversal visits them, so that the intersecting leaf
+  // nodes are processed in the same order as by a serial traversal.
+  const size_t numPairsPerThread = 8;
+  const size_t targetNumberOfPairs =
+    numPairsPerThread * static_cast<size_t>(vtkSMPTools::GetEstimatedNumberOfThreads());
+  std::vector<NodePair> pairs(1, NodePair(this->Tree, OBBTreeB->Tree));
+  bool expanded = true;
+  while (expanded && pairs.size() < targetNumberOfPairs)
+  {
+    expanded = false;
+    std::vector<NodePair> nextPairs;
+    for (const NodePair& pair : pairs)
     {
+      vtkOBBNode* nodeA = pair.first;
+      vtkOBBNode* nodeB = pair.second;
+      if (this->DisjointOBBNodes(nodeA, nodeB, XformBtoA))
+      {
+        continue;
+      }
+      if (nodeA->Kids == nullptr && nodeB->Kids == nullptr)
+      {
+        nextPairs.push_back(pair);
+        continue;
+      }
+      expanded = true;
       if (nodeA->Kids == nullptr)
       {
-        if (nodeB->Kids == nullptr)
-        { // then this is a pair of intersecting leaf nodes to process
-          returnValue = (*function)(nodeA, nodeB, XformBtoA, data_arg);
-          if (returnValue >= 0)
+        nextPairs.emplace_back(nodeA, nodeB->Kids[1]);
+        nextPairs.emplace_back(nodeA, nodeB->Kids[0]);
+      }
+      else if (nodeB->Kids == nullptr)
+      {
+        nextPairs.emplace_back(nodeA->Kids[1], nodeB);
+        nextPairs.emplace_back(nodeA->Kids[0], nodeB);
+      }
+      else
+      {
+        nextPairs.emplace_back(nodeA->Kids[1], nodeB->Kids[1]);
+        nextPairs.emplace_back(nodeA->Kids[0], nodeB->Kids[1]);
+        nextPairs.emplace_back(nodeA->Kids[1], nodeB->Kids[0]);
+        nextPairs.emplace_back(nodeA->Kids[0], nodeB->Kids[0]);
+      }
+    }
+    pairs.swap(nextPairs);
+  }
+
+  // Find the intersecting leaf nodes below every pair concurrently
+  std::vector<std::vector<NodePair>> leafPairs(pairs.size());
+  vtkSMPTools::For(0, static_cast<vtkIdType>(pairs.size()), 1,
+    [&](vtkIdType pairId, vtkIdType endPairId) {
+      std::vector<NodePair> stack;
+      for (; pairId < endPairId; ++pairId)
+      {
+        stack.push_back(pairs[pairId]);
+        while (!stack.empty())
+        { // simulate recursion without overhead of real recursion.
+          vtkOBBNode* nodeA = stack.back().first;
+          vtkOBBNode* nodeB = stack.back().second;
+          stack.pop_back();
+          if (this->DisjointOBBNodes(nodeA, nodeB, XformBtoA))
           {
-            count += returnValue;
+            continue;
+          }
+          if (nodeA->Kids == nullptr)
+          {
+            if (nodeB->Kids == nullptr)
+            { // then this is a pair of intersecting leaf nodes to process
+              leafPairs[pairId].emplace_back(nodeA, nodeB);
+            }
+            else
+            { // A is a leaf, but B goes deeper.
+              stack.emplace_back(nodeA, nodeB->Kids[0]);
+              stack.emplace_back(nodeA, nodeB->Kids[1]);
+            }
           }
           else
           {
-            count = returnValue;
+            if (nodeB->Kids == nullptr)
+            { // B is a leaf, but A goes deeper.
+              stack.emplace_back(nodeA->Kids[0], nodeB);
+              stack.emplace_back(nodeA->Kids[1], nodeB);
+            }
+            else
+            { // neither A nor B are leaves. Go to the next level.
+              stack.emplace_back(nodeA->Kids[0], nodeB->Kids[0]);
+              stack.emplace_back(nodeA->Kids[1], nodeB->Kids[0]);
+              stack.emplace_back(nodeA->Kids[0], nodeB->Kids[1]);
+              stack.emplace_back(nodeA->Kids[1], nodeB->Kids[1]);
+            }
           }
         }
-        else
-        { // A is a leaf, but B goes deeper.
-          OBBstackA[depth] = nodeA;
-          OBBstackB[depth] = nodeB->Kids[0];
-          OBBstackA[depth + 1] = nodeA;
-          OBBstackB[depth + 1] = nodeB->Kids[1];
-          depth += 2;
-        }
+      }
+    });
+
+  // Process the intersecting leaf nodes in order
+  for (const auto& pairLeaves : leafPairs)
+  {
+    for (const NodePair& leaves : pairLeaves)
+    {
+      returnValue = (*function)(leaves.first, leaves.second, XformBtoA, data_arg);
+      if (returnValue >= 0)
+      {
+        count += returnValue;
       }
       else
       {
-        if (nodeB->Kids == nullptr)
-        { // B is a leaf, but A goes deeper.
-          OBBstackB[depth] = nodeB;
-          OBBstackA[depth] = nodeA->Kids[0];
-          OBBstackB[depth + 1] = nodeB;
-          OBBstackA[depth + 1] = nodeA->Kids[1];
-          depth += 2;
-        }
-        else
-        { // neither A nor B are leaves. Go to the next level.
-          OBBstackA[depth] = nodeA->Kids[0];
-          OBBstackB[depth] = nodeB->Kids[0];
-          OBBstackA[depth + 1] = nodeA->Kids[1];
-          OBBstackB[depth + 1] = nodeB->Kids[0];
-          OBBstackA[depth + 2] = nodeA->Kids[0];
-          OBBstackB[depth + 2] = nodeB->Kids[1];
-          OBBstackA[depth + 3] = nodeA->Kids[1];
-          OBBstackB[depth + 3] = nodeB->Kids[1];
-          depth += 4;
-        }
+        return returnValue;
       }
     }
   }
-  // cleanup
-  delete[] OBBstackA;
-  delete[] OBBstackB;
 
   return (count);
 }
@@ -1916,23 +2004,6 @@ void vtkOBBTree::PrintSelf(ostream& os, vtkIndent indent)
   {
     os << indent << "Tree: (null)\n";
   }
-  if (this->PointsList)
-  {
-    os << indent << "PointsList " << this->PointsList << "\n";
-  }
-  else
-  {
-    os << indent << "PointsList: (null)\n";
-  }
-  if (this->InsertedPoints)
-  {
-    os << indent << "InsertedPoints " << this->InsertedPoints << "\n";
-  }
-  else
-  {
-    os << indent << "InsertedPoints: (null)\n";
-  }
-
   os << indent << "OBBCount " << this->OBBCount << "\n";
 }
 VTK_ABI_NAMESPACE_END
@@ -17,6 +17,9 @@
  * is found that (approximately) divides the number cells in half. These are
  * then assigned to the children OBB's. This process then continues until
  * the MaxLevel ivar limits the recursion, or no split plane can be found.
+ * The tree is built one level at a time with vtkSMPTools: the nodes of a level
+ * are built concurrently, and the covariance and split of the large nodes
+ * near the root are computed with threaded loops over their cells.
  *
  * A good reference for OBB-trees is Gottschalk & Manocha in Proceedings of
  * Siggraph `96.
@@ -166,6 +169,9 @@ public:
   /**
    * For each intersecting leaf node pair, call function.
    * OBBTreeB is optionally transformed by XformBtoA before testing.
+   * The intersecting leaf node pairs are found concurrently, then function is
+   * called from the calling thread, in the order of a depth first traversal of
+   * the trees.
    */
   int IntersectWithOBBTree(vtkOBBTree* OBBTreeB, vtkMatrix4x4* XformBtoA,
     int (*function)(vtkOBBNode* nodeA, vtkOBBNode* nodeB, vtkMatrix4x4* Xform, void* arg),
@@ -204,9 +210,9 @@ protected:
     double size[3]);
 
   vtkOBBNode* Tree;
+  // Compute the OBB of a node from its cells and, if the node is split, create
+  // its two kids with their cells. The tree is built one level at a time.
   void BuildTree(vtkIdList* cells, vtkOBBNode* parent, int level);
-  vtkPoints* PointsList;
-  int* InsertedPoints;
   int OBBCount;
 
   void DeleteTree(vtkOBBNode* OBBptr);
@@ -9,6 +9,8 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSmartPointer.h"
+#include "vtkStructuredData.h"
 #include "vtkStructuredGrid.h"
 
 #include "vtkNew.h"
@@ -24,6 +26,7 @@ vtkRectilinearGridToPointSet::~vtkRectilinearGridToPointSet() = default;
 void vtkRectilinearGridToPointSet::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "UseImplicitArrays: " << (this->UseImplicitArrays ? "On" : "Off") << endl;
 }
 
 //------------------------------------------------------------------------------
@@ -50,6 +53,21 @@ int vtkRectilinearGridToPointSet::CopyStructure(
 
   outData->SetExtent(extent);
 
+  if (this->UseImplicitArrays)
+  {
+    // Copy the (small) coordinate arrays so that the output does not change
+    // if the input coordinates are modified in place later on.
+    vtkSmartPointer<vtkDataArray> coords[3] = { vtk::TakeSmartPointer(xcoord->NewInstance()),
+      vtk::TakeSmartPointer(ycoord->NewInstance()), vtk::TakeSmartPointer(zcoord->NewInstance()) };
+    coords[0]->DeepCopy(xcoord);
+    coords[1]->DeepCopy(ycoord);
+    coords[2]->DeepCopy(zcoord);
+    double identity[9] = { 1., 0., 0., 0., 1., 0., 0., 0., 1. };
+    outData->SetPoints(
+      vtkStructuredData::GetPoints(coords[0], coords[1], coords[2], extent, identity));
+    return 1;
+  }
+
   vtkNew<vtkPoints> points;
   points->SetDataTypeToDouble();
   points->SetNumberOfPoints(inData->GetNumberOfPoints());
@@ -34,6 +34,19 @@ public:
 
   static vtkRectilinearGridToPointSet* New();
 
+  ///@{
+  /**
+   * Get/Set whether the output points are stored in an implicit array computed
+   * from the rectilinear grid coordinates instead of an explicit array of 3-component tuples.
+   * This avoids allocating memory for the coordinates of each point, but the
+   * output points cannot be modified in place.
+   * Default is false.
+   */
+  vtkSetMacro(UseImplicitArrays, bool);
+  vtkGetMacro(UseImplicitArrays, bool);
+  vtkBooleanMacro(UseImplicitArrays, bool);
+  ///@}
+
 protected:
   vtkRectilinearGridToPointSet();
   ~vtkRectilinearGridToPointSet() override;
@@ -43,6 +56,8 @@ protected:
 
   int FillInputPortInformation(int port, vtkInformation* info) override;
 
+  bool UseImplicitArrays = false;
+
 private:
   vtkRectilinearGridToPointSet(const vtkRectilinearGridToPointSet&) = delete;
   void operator=(const vtkRectilinearGridToPointSet&) = delete;
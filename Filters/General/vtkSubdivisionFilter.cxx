@@ -8,13 +8,20 @@
 #include "vtkCellIterator.h"
 #include "vtkEdgeTable.h"
 #include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkStaticEdgeLocatorTemplate.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
 #include <map>
 #include <sstream>
 
@@ -87,6 +94,152 @@ int vtkSubdivisionFilter::RequestData(vtkInformation* vtkNotUsed(request),
   }
   return 1;
 }
+//------------------------------------------------------------------------------
+vtkIdType vtkSubdivisionFilter::NumberEdges(vtkPolyData* inputDS, vtkIdType firstId,
+  vtkIntArray* edgeData, std::vector<vtkIdType>& edgePoints)
+{
+  using EdgeLocatorType = vtkStaticEdgeLocatorTemplate<vtkIdType, vtkIdType>;
+  using EdgeTupleType = EdgeLocatorType::EdgeTupleType;
+
+  vtkCellArray* polys = inputDS->GetPolys();
+  const vtkIdType numPolys = polys->GetNumberOfCells();
+  const vtkIdType numUses = 3 * numPolys;
+  int* edgeIds = edgeData->GetPointer(0);
+
+  // Every use of an edge is tagged with 3 * polyId + i. Polygons with less
+  // than three points have no edges to subdivide.
+  std::vector<EdgeTupleType> edges(numUses);
+  vtkSMPThreadLocalObject<vtkIdList> tlPtIds;
+  vtkSMPTools::For(0, numPolys, [&](vtkIdType polyId, vtkIdType endPolyId) {
+    vtkIdList* ptIds = tlPtIds.Local();
+    vtkIdType npts;
+    const vtkIdType* pts;
+    for (; polyId < endPolyId; ++polyId)
+    {
+      polys->GetCellAtId(polyId, npts, pts, ptIds);
+      for (vtkIdType i = 0; i < 3; ++i)
+      {
+        const vtkIdType use = 3 * polyId + i;
+        edges[use] = npts < 3 ? EdgeTupleType(-1, -1, use)
+                              : EdgeTupleType(pts[(i + 2) % 3], pts[i], use);
+        edgeIds[use] = -1;
+      }
+    }
+  });
+
+  // Group the uses of every edge and find the first use of every group
+  EdgeLocatorType locator;
+  vtkIdType numGroups;
+  const vtkIdType* offsets = locator.MergeEdges(numUses, edges.data(), numGroups);
+  std::vector<vtkIdType> firstUses(numGroups);
+  std::vector<vtkIdType> newIds(numUses + 1, 0);
+  vtkSMPTools::For(0, numGroups, [&](vtkIdType group, vtkIdType endGroup) {
+    for (; group < endGroup; ++group)
+    {
+      vtkIdType firstUse = edges[offsets[group]].Data;
+      for (vtkIdType i = offsets[group] + 1; i < offsets[group + 1]; ++i)
+      {
+        firstUse = std::min(firstUse, edges[i].Data);
+      }
+      firstUses[group] = firstUse;
+      newIds[firstUse] = edges[offsets[group]].V0 < 0 ? 0 : 1;
+    }
+  });
+
+  // New points are numbered in the order of the first uses of the edges
+  vtkSMPTools::ExclusiveScan(newIds.begin(), newIds.end(), newIds.begin(), vtkIdType(0));
+  const vtkIdType numEdges = newIds[numUses];
+  edgePoints.resize(2 * numEdges);
+  vtkSMPThreadLocalObject<vtkIdList> tlEdgePtIds;
+  vtkSMPTools::For(0, numGroups, [&](vtkIdType group, vtkIdType endGroup) {
+    vtkIdList* ptIds = tlEdgePtIds.Local();
+    vtkIdType npts;
+    const vtkIdType* pts;
+    for (; group < endGroup; ++group)
+    {
+      if (edges[offsets[group]].V0 < 0)
+      {
+        continue;
+      }
+      const vtkIdType firstUse = firstUses[group];
+      const vtkIdType edgeId = newIds[firstUse];
+      for (vtkIdType i = offsets[group]; i < offsets[group + 1]; ++i)
+      {
+        edgeIds[edges[i].Data] = static_cast<int>(firstId + edgeId);
+      }
+      polys->GetCellAtId(firstUse / 3, npts, pts, ptIds);
+      edgePoints[2 * edgeId] = pts[(firstUse % 3 + 2) % 3];
+      edgePoints[2 * edgeId + 1] = pts[firstUse % 3];
+    }
+  });
+
+  return numEdges;
+}
+
+//------------------------------------------------------------------------------
+void vtkSubdivisionFilter::GenerateSubdivisionCells(
+  vtkPolyData* inputDS, vtkIntArray* edgeData, vtkCellArray* outputPolys, vtkCellData* outputCD)
+{
+  vtkCellArray* polys = inputDS->GetPolys();
+  const vtkIdType numPolys = polys->GetNumberOfCells();
+  const vtkIdType firstPolyId = inputDS->GetNumberOfVerts() + inputDS->GetNumberOfLines();
+  vtkCellData* inputCD = inputDS->GetCellData();
+  const int* edgeIds = edgeData->GetPointer(0);
+
+  // Only triangles are subdivided, each into four triangles
+  std::vector<vtkIdType> triOffsets(numPolys + 1, 0);
+  vtkSMPTools::For(0, numPolys, [&](vtkIdType polyId, vtkIdType endPolyId) {
+    for (; polyId < endPolyId; ++polyId)
+    {
+      triOffsets[polyId] = polys->GetCellSize(polyId) == 3 ? 1 : 0;
+    }
+  });
+  vtkSMPTools::ExclusiveScan(
+    triOffsets.begin(), triOffsets.end(), triOffsets.begin(), vtkIdType(0));
+  const vtkIdType numTris = triOffsets[numPolys];
+
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfValues(12 * numTris);
+  vtkIdType* newPts = connectivity->GetPointer(0);
+  outputCD->SetNumberOfTuples(4 * numTris);
+
+  vtkSMPThreadLocalObject<vtkIdList> tlPtIds;
+  vtkSMPTools::For(0, numPolys, [&](vtkIdType polyId, vtkIdType endPolyId) {
+    vtkIdList* ptIds = tlPtIds.Local();
+    vtkIdType npts;
+    const vtkIdType* pts;
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; polyId < endPolyId; ++polyId)
+    {
+      if (isFirst)
+      {
+        this->CheckAbort();
+      }
+      if (this->GetAbortOutput())
+      {
+        break;
+      }
+      if (triOffsets[polyId] == triOffsets[polyId + 1])
+      {
+        continue;
+      }
+      // get the original point ids and the ids stored as edge data
+      polys->GetCellAtId(polyId, npts, pts, ptIds);
+      const int* edgePts = edgeIds + 3 * polyId;
+      const vtkIdType newCellPts[12] = { pts[0], edgePts[1], edgePts[0], edgePts[1], pts[1],
+        edgePts[2], edgePts[2], pts[2], edgePts[0], edgePts[1], edgePts[2], edgePts[0] };
+      const vtkIdType newId = 4 * triOffsets[polyId];
+      std::copy(newCellPts, newCellPts + 12, newPts + 3 * newId);
+      for (vtkIdType i = 0; i < 4; ++i)
+      {
+        outputCD->CopyData(inputCD, firstPolyId + polyId, newId + i);
+      }
+    }
+  });
+
+  outputPolys->SetData(3, connectivity);
+}
+
 void vtkSubdivisionFilter::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
@@ -7,6 +7,11 @@
  * vtkSubdivisionFilter is an abstract class that defines
  * the protocol for subdivision surface filters.
  *
+ * The edges of every level are numbered with vtkStaticEdgeLocatorTemplate
+ * and the four triangles replacing every triangle are generated with
+ * vtkSMPTools. The new points are numbered in the order their edges are
+ * first met when traversing the triangles, so the output does not depend on
+ * the number of threads.
  */
 
 #ifndef vtkSubdivisionFilter_h
@@ -15,6 +20,8 @@
 #include "vtkFiltersGeneralModule.h" // For export macro
 #include "vtkPolyDataAlgorithm.h"
 
+#include <vector> // For std::vector
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkCellArray;
 class vtkCellData;
@@ -22,6 +29,7 @@ class vtkIdList;
 class vtkIntArray;
 class vtkPoints;
 class vtkPointData;
+class vtkPolyData;
 
 class VTKFILTERSGENERAL_EXPORT vtkSubdivisionFilter : public vtkPolyDataAlgorithm
 {
@@ -55,6 +63,26 @@ protected:
 
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
 
+  /**
+   * Number the points inserted on the edges of the polygons of inputDS,
+   * starting at firstId, in the order the edges are first met when
+   * traversing the polygons. Edge i of a polygon joins its points (i + 2) % 3
+   * and i. On return, edgeData holds the ids of the points inserted on the
+   * three edges of every polygon, and edgePoints the two end points of the
+   * edge of every new point, in the order of the polygon that first uses the
+   * edge. The number of new points is returned.
+   */
+  vtkIdType NumberEdges(vtkPolyData* inputDS, vtkIdType firstId, vtkIntArray* edgeData,
+    std::vector<vtkIdType>& edgePoints);
+
+  /**
+   * Replace every triangle of inputDS by four triangles using the points
+   * inserted on its edges, as numbered in edgeData, and copy the cell data of
+   * the triangle to the new triangles.
+   */
+  void GenerateSubdivisionCells(
+    vtkPolyData* inputDS, vtkIntArray* edgeData, vtkCellArray* outputPolys, vtkCellData* outputCD);
+
   int NumberOfSubdivisions;
   vtkTypeBool CheckForTriangles;
 
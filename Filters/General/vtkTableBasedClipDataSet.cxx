@@ -25,6 +25,7 @@
 #include "vtkPolyData.h"
 #include "vtkPolyDataToUnstructuredGrid.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPThreadLocalArena.h"
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
@@ -34,7 +35,9 @@
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
 #include <cstring>
+#include <new>
 #include <unordered_set>
 #include <vector>
 
@@ -534,6 +537,45 @@ using TableBasedCellBatches = vtkBatches<TableBasedCellBatchData>;
 template <typename TInputIdType>
 using EdgeType = EdgeTuple<TInputIdType, double>;
 
+//-----------------------------------------------------------------------------
+// Thread local list of edges stored in fixed size chunks allocated from a
+// vtkSMPThreadLocalArena, so that appending edges never reallocates/copies
+// and does not go through the global heap for each growth.
+template <typename TEdge>
+struct EdgeChunkList
+{
+  static constexpr size_t ChunkSize = 4096;
+
+  std::vector<TEdge*> Chunks;
+  size_t Size = 0;
+
+  template <typename TInputIdType>
+  void EmplaceBack(
+    vtkSMPThreadLocalArena& arena, TInputIdType pointIndex1, TInputIdType pointIndex2, double weight)
+  {
+    const size_t localIndex = this->Size % ChunkSize;
+    if (localIndex == 0)
+    {
+      this->Chunks.push_back(arena.Allocate<TEdge>(ChunkSize));
+    }
+    new (this->Chunks.back() + localIndex) TEdge(pointIndex1, pointIndex2, weight);
+    this->Size++;
+  }
+
+  template <typename TIter>
+  void CopyTo(TIter output) const
+  {
+    for (size_t chunkId = 0; chunkId < this->Chunks.size(); ++chunkId)
+    {
+      const size_t chunkSize = std::min(ChunkSize, this->Size - chunkId * ChunkSize);
+      output = std::copy(this->Chunks[chunkId], this->Chunks[chunkId] + chunkSize, output);
+    }
+  }
+};
+
+template <typename TEdge>
+constexpr size_t EdgeChunkList<TEdge>::ChunkSize;
+
 //-----------------------------------------------------------------------------
 // Edge Locator to store and search edges
 template <typename TInputIdType>
@@ -555,7 +597,8 @@ struct EvaluateCells
   vtkTableBasedClipDataSet* Filter;
 
   vtkSMPThreadLocalObject<vtkIdList> TLIdList;
-  vtkSMPThreadLocal<std::vector<TEdge>> TLEdges;
+  vtkSMPThreadLocalArena EdgesArena;
+  vtkSMPThreadLocal<EdgeChunkList<TEdge>> TLEdges;
   vtkSMPThreadLocal<std::unordered_set<int>> TLUnsupportedCellTypes;
 
   TableBasedCellBatches CellBatches;
@@ -593,8 +636,6 @@ struct EvaluateCells
   {
     // initialize list size
     this->TLIdList.Local()->Allocate(MAX_CELL_SIZE);
-    // initialize edges
-    this->TLEdges.Local().reserve(static_cast<size_t>(this->Input->GetNumberOfPoints() * 0.001));
   }
 
   void operator()(vtkIdType beginBatchId, vtkIdType endBatchId)
@@ -706,7 +747,7 @@ struct EvaluateCells
                 point1Weight = 1.0 - point1Weight;
               }
 
-              edges.emplace_back(pointIndex1, pointIndex2, point1Weight);
+              edges.EmplaceBack(this->EdgesArena, pointIndex1, pointIndex2, point1Weight);
             }
           }
           if (shape != TBCCases::ST_PNT) // normal cell
@@ -746,14 +787,14 @@ struct EvaluateCells
     size_t totalSizeOfEdges = 0;
     for (auto& tlEdges : tlEdgesVector)
     {
-      totalSizeOfEdges += tlEdges->size();
+      totalSizeOfEdges += tlEdges->Size;
     }
 
     // compute begin indices
     std::vector<size_t> beginIndices(this->TLEdges.size(), 0);
     for (size_t i = 1; i < tlEdgesVector.size(); ++i)
     {
-      beginIndices[i] = beginIndices[i - 1] + tlEdgesVector[i - 1]->size();
+      beginIndices[i] = beginIndices[i - 1] + tlEdgesVector[i - 1]->Size;
     }
 
     // merge thread local edges
@@ -762,8 +803,7 @@ struct EvaluateCells
       0, static_cast<vtkIdType>(tlEdgesVector.size()), [&](vtkIdType begin, vtkIdType end) {
         for (vtkIdType threadId = begin; threadId < end; ++threadId)
         {
-          auto& edges = *tlEdgesVector[threadId];
-          std::copy(edges.begin(), edges.end(), this->Edges.begin() + beginIndices[threadId]);
+          tlEdgesVector[threadId]->CopyTo(this->Edges.begin() + beginIndices[threadId]);
         }
       });
 
@@ -18,12 +18,13 @@
 #include "vtkMultiBlockDataSet.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
 #include "vtkSmartPointer.h"
 
 #include <algorithm>
-#include <functional>
+#include <cmath>
 
 //=============================================================================
 VTK_ABI_NAMESPACE_BEGIN
@@ -46,18 +47,22 @@ inline std::string vtkTemporalStatisticsMangleName(const char* originalName, con
 }
 
 //------------------------------------------------------------------------------
+// The accumulation kernels below are threaded over the values of the arrays
+// since every value is accumulated independently of the others.
 struct AccumulateAverage
 {
   template <typename InArrayT, typename OutArrayT>
   void operator()(InArrayT* inArray, OutArrayT* outArray) const
   {
-    // These share APIType:
-    using T = vtk::GetAPIType<InArrayT>;
-
     const auto in = vtk::DataArrayValueRange(inArray);
     auto out = vtk::DataArrayValueRange(outArray);
 
-    std::transform(in.cbegin(), in.cend(), out.cbegin(), out.begin(), std::plus<T>{});
+    vtkSMPTools::For(0, in.size(), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        out[i] += in[i];
+      }
+    });
   }
 };
 
@@ -72,8 +77,12 @@ struct AccumulateMinimum
     const auto in = vtk::DataArrayValueRange(inArray);
     auto out = vtk::DataArrayValueRange(outArray);
 
-    std::transform(in.cbegin(), in.cend(), out.cbegin(), out.begin(),
-      [](T v1, T v2) -> T { return std::min(v1, v2); });
+    vtkSMPTools::For(0, in.size(), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        out[i] = std::min<T>(in[i], out[i]);
+      }
+    });
   }
 };
 
@@ -88,14 +97,19 @@ struct AccumulateMaximum
     const auto in = vtk::DataArrayValueRange(inArray);
     auto out = vtk::DataArrayValueRange(outArray);
 
-    std::transform(in.cbegin(), in.cend(), out.cbegin(), out.begin(),
-      [](T v1, T v2) -> T { return std::max(v1, v2); });
+    vtkSMPTools::For(0, in.size(), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        out[i] = std::max<T>(in[i], out[i]);
+      }
+    });
   }
 };
 
 // standard deviation one-pass algorithm from
 // http://www.cs.berkeley.edu/~mhoemmen/cs194/Tutorials/variance.pdf
 // this is numerically stable!
+// The sum used for the average is updated in the same pass.
 struct AccumulateStdDev
 {
   template <typename InArrayT, typename OutArrayT, typename PrevArrayT>
@@ -107,14 +121,18 @@ struct AccumulateStdDev
     const double pass = static_cast<double>(passIn);
 
     const auto inValues = vtk::DataArrayValueRange(inArray);
-    const auto prevValues = vtk::DataArrayValueRange(prevArray);
+    auto prevValues = vtk::DataArrayValueRange(prevArray);
     auto outValues = vtk::DataArrayValueRange(outArray);
 
-    for (vtkIdType i = 0; i < inValues.size(); ++i)
-    {
-      const double temp = inValues[i] - (prevValues[i] / pass);
-      outValues[i] += static_cast<T>(pass * temp * temp / (pass + 1.));
-    }
+    vtkSMPTools::For(0, inValues.size(), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        const T value = inValues[i];
+        const double temp = value - (prevValues[i] / pass);
+        outValues[i] += static_cast<T>(pass * temp * temp / (pass + 1.));
+        prevValues[i] += value;
+      }
+    });
   }
 };
 
@@ -125,11 +143,12 @@ struct FinishAverage
   void operator()(ArrayT* array, int sumSize) const
   {
     auto range = vtk::DataArrayValueRange(array);
-    using RefT = typename decltype(range)::ReferenceType;
-    for (RefT ref : range)
-    {
-      ref /= sumSize;
-    }
+    vtkSMPTools::For(0, range.size(), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        range[i] /= sumSize;
+      }
+    });
   }
 };
 
@@ -141,12 +160,13 @@ struct FinishStdDev
   {
     const double sumSize = static_cast<double>(sumSizeIn);
     auto range = vtk::DataArrayValueRange(array);
-    using RefT = typename decltype(range)::ReferenceType;
     using ValueT = typename decltype(range)::ValueType;
-    for (RefT ref : range)
-    {
-      ref = static_cast<ValueT>(std::sqrt(static_cast<double>(ref) / sumSize));
-    }
+    vtkSMPTools::For(0, range.size(), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        range[i] = static_cast<ValueT>(std::sqrt(static_cast<double>(range[i]) / sumSize));
+      }
+    });
   }
 };
 } // anonymous namespace
@@ -559,6 +579,7 @@ void vtkTemporalStatistics::AccumulateArrays(
       vtkDataArray* stdevOutArray = this->GetArray(outFd, inArray, STANDARD_DEVIATION_SUFFIX);
       if (stdevOutArray)
       {
+        // Accumulates both the standard deviation and the average
         using Dispatcher = vtkArrayDispatch::Dispatch3SameValueType;
         AccumulateStdDev worker;
         if (!Dispatcher::Execute(inArray, stdevOutArray, outArray, worker, currentTimeIndex))
@@ -569,12 +590,14 @@ void vtkTemporalStatistics::AccumulateArrays(
         // Alert change in data.
         stdevOutArray->DataChanged();
       }
-
-      using Dispatcher = vtkArrayDispatch::Dispatch2SameValueType;
-      AccumulateAverage worker;
-      if (!Dispatcher::Execute(inArray, outArray, worker))
-      { // Fallback to slow path:
-        worker(inArray, outArray);
+      else
+      {
+        using Dispatcher = vtkArrayDispatch::Dispatch2SameValueType;
+        AccumulateAverage worker;
+        if (!Dispatcher::Execute(inArray, outArray, worker))
+        { // Fallback to slow path:
+          worker(inArray, outArray);
+        }
       }
 
       // Alert change in data.
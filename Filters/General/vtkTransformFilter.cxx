@@ -10,6 +10,8 @@
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkLinearTransform.h"
+#include "vtkMatrix3x3.h"
+#include "vtkMatrix4x4.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
@@ -17,11 +19,79 @@
 #include "vtkRectilinearGrid.h"
 #include "vtkRectilinearGridToPointSet.h"
 #include "vtkSmartPointer.h"
+#include "vtkStructuredData.h"
 #include "vtkStructuredGrid.h"
 
+#include <algorithm>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+//------------------------------------------------------------------------------
+// Return the points of an image or rectilinear grid moved by a transform that
+// only scales and translates along the axes, stored in an implicit array built
+// from the transformed axis coordinates. Return nullptr for any other transform.
+vtkSmartPointer<vtkPoints> TransformStructuredPoints(
+  vtkAbstractTransform* transform, vtkImageData* image, vtkRectilinearGrid* rect)
+{
+  vtkLinearTransform* lt = vtkLinearTransform::SafeDownCast(transform);
+  if (!lt || (!image && !rect) || (image && !image->GetDirectionMatrix()->IsIdentity()))
+  {
+    return nullptr;
+  }
+  vtkMatrix4x4* matrix = lt->GetMatrix();
+  for (int row = 0; row < 4; ++row)
+  {
+    for (int col = 0; col < 3; ++col)
+    {
+      if (row != col && matrix->GetElement(row, col) != 0.0)
+      {
+        return nullptr;
+      }
+    }
+  }
+  if (matrix->GetElement(3, 3) != 1.0)
+  {
+    return nullptr;
+  }
+
+  int extent[6];
+  if (image)
+  {
+    image->GetExtent(extent);
+  }
+  else
+  {
+    rect->GetExtent(extent);
+  }
+  vtkDataArray* rectCoords[3] = { nullptr, nullptr, nullptr };
+  if (rect)
+  {
+    rectCoords[0] = rect->GetXCoordinates();
+    rectCoords[1] = rect->GetYCoordinates();
+    rectCoords[2] = rect->GetZCoordinates();
+  }
+  vtkNew<vtkDoubleArray> coords[3];
+  for (int dim = 0; dim < 3; ++dim)
+  {
+    const double scale = matrix->GetElement(dim, dim);
+    const double translation = matrix->GetElement(dim, 3);
+    const int size = std::max(extent[2 * dim + 1] - extent[2 * dim] + 1, 0);
+    coords[dim]->SetNumberOfValues(size);
+    for (int ii = 0; ii < size; ++ii)
+    {
+      const double value = image
+        ? image->GetOrigin()[dim] + image->GetSpacing()[dim] * (extent[2 * dim] + ii)
+        : rectCoords[dim]->GetComponent(ii, 0);
+      coords[dim]->SetValue(ii, scale * value + translation);
+    }
+  }
+  double identity[9] = { 1., 0., 0., 0., 1., 0., 0., 0., 1. };
+  return vtkStructuredData::GetPoints(coords[0], coords[1], coords[2], extent, identity);
+}
+}
+
 vtkStandardNewMacro(vtkTransformFilter);
 vtkCxxSetObjectMacro(vtkTransformFilter, Transform, vtkAbstractTransform);
 
@@ -31,6 +101,7 @@ vtkTransformFilter::vtkTransformFilter()
   this->Transform = nullptr;
   this->OutputPointsPrecision = vtkAlgorithm::DEFAULT_PRECISION;
   this->TransformAllInputVectors = false;
+  this->UseImplicitArrays = false;
 }
 
 //------------------------------------------------------------------------------
@@ -78,14 +149,19 @@ int vtkTransformFilter::RequestData(vtkInformation* vtkNotUsed(request),
 {
   vtkSmartPointer<vtkPointSet> input = vtkPointSet::GetData(inputVector[0]);
   vtkPointSet* output = vtkPointSet::GetData(outputVector);
+  vtkImageData* inImage = nullptr;
+  vtkRectilinearGrid* inRect = nullptr;
 
+  // The points of converted inputs are only read, so they are kept implicit
+  // to avoid allocating a temporary copy of the coordinates.
   if (!input)
   {
     // Try converting image data.
-    vtkImageData* inImage = vtkImageData::GetData(inputVector[0]);
+    inImage = vtkImageData::GetData(inputVector[0]);
     if (inImage)
     {
       vtkNew<vtkImageDataToPointSet> image2points;
+      image2points->UseImplicitArraysOn();
       image2points->SetInputData(inImage);
       image2points->SetContainerAlgorithm(this);
       image2points->Update();
@@ -96,10 +172,11 @@ int vtkTransformFilter::RequestData(vtkInformation* vtkNotUsed(request),
   if (!input)
   {
     // Try converting rectilinear grid.
-    vtkRectilinearGrid* inRect = vtkRectilinearGrid::GetData(inputVector[0]);
+    inRect = vtkRectilinearGrid::GetData(inputVector[0]);
     if (inRect)
     {
       vtkNew<vtkRectilinearGridToPointSet> rect2points;
+      rect2points->UseImplicitArraysOn();
       rect2points->SetInputData(inRect);
       rect2points->SetContainerAlgorithm(this);
       rect2points->Update();
@@ -147,22 +224,32 @@ int vtkTransformFilter::RequestData(vtkInformation* vtkNotUsed(request),
   numPts = inPts->GetNumberOfPoints();
   numCells = input->GetNumberOfCells();
 
-  // Allocate transformed points
-  vtkNew<vtkPoints> newPts;
-  // Set the desired precision for the points in the output.
-  if (this->OutputPointsPrecision == vtkAlgorithm::DEFAULT_PRECISION)
+  // Allocate transformed points, unless they can be computed implicitly from
+  // the transformed axis coordinates of a structured input.
+  vtkSmartPointer<vtkPoints> newPts;
+  if (this->UseImplicitArrays && this->OutputPointsPrecision != vtkAlgorithm::SINGLE_PRECISION)
   {
-    newPts->SetDataType(inPts->GetDataType());
+    newPts = ::TransformStructuredPoints(this->Transform, inImage, inRect);
   }
-  else if (this->OutputPointsPrecision == vtkAlgorithm::SINGLE_PRECISION)
+  const bool implicitPoints = newPts != nullptr;
+  if (!implicitPoints)
   {
-    newPts->SetDataType(VTK_FLOAT);
-  }
-  else if (this->OutputPointsPrecision == vtkAlgorithm::DOUBLE_PRECISION)
-  {
-    newPts->SetDataType(VTK_DOUBLE);
+    newPts = vtkSmartPointer<vtkPoints>::New();
+    // Set the desired precision for the points in the output.
+    if (this->OutputPointsPrecision == vtkAlgorithm::DEFAULT_PRECISION)
+    {
+      newPts->SetDataType(inPts->GetDataType());
+    }
+    else if (this->OutputPointsPrecision == vtkAlgorithm::SINGLE_PRECISION)
+    {
+      newPts->SetDataType(VTK_FLOAT);
+    }
+    else if (this->OutputPointsPrecision == vtkAlgorithm::DOUBLE_PRECISION)
+    {
+      newPts->SetDataType(VTK_DOUBLE);
+    }
+    newPts->Allocate(numPts);
   }
-  newPts->Allocate(numPts);
 
   vtkSmartPointer<vtkDataArray> newVectors;
   if (inVectors)
@@ -214,7 +301,24 @@ int vtkTransformFilter::RequestData(vtkInformation* vtkNotUsed(request),
     }
   }
 
-  if (inVectors || inNormals || nInputVectors > 0)
+  if (implicitPoints)
+  {
+    // The points are already transformed and the transform is linear.
+    vtkLinearTransform* lt = static_cast<vtkLinearTransform*>(this->Transform);
+    if (inNormals)
+    {
+      lt->TransformNormals(inNormals, newNormals);
+    }
+    if (inVectors)
+    {
+      lt->TransformVectors(inVectors, newVectors);
+    }
+    for (int i = 0; i < nInputVectors; i++)
+    {
+      lt->TransformVectors(inVrsArr[i], outVrsArr[i]);
+    }
+  }
+  else if (inVectors || inNormals || nInputVectors > 0)
   {
     this->Transform->TransformPointsNormalsVectors(inPts, newPts, inNormals, newNormals, inVectors,
       newVectors, nInputVectors, inVrsArr.data(), outVrsArr.data());
@@ -401,5 +505,6 @@ void vtkTransformFilter::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "Transform: " << this->Transform << "\n";
   os << indent << "Output Points Precision: " << this->OutputPointsPrecision << "\n";
+  os << indent << "Use Implicit Arrays: " << (this->UseImplicitArrays ? "On" : "Off") << "\n";
 }
 VTK_ABI_NAMESPACE_END
@@ -80,6 +80,21 @@ public:
   vtkBooleanMacro(TransformAllInputVectors, bool);
   ///@}
 
+  ///@{
+  /**
+   * If on, and the input is a vtkImageData (with an identity direction
+   * matrix) or a vtkRectilinearGrid transformed by a linear transform that
+   * only scales and translates along the axes, the output points are stored
+   * in an implicit array computed from the transformed axis coordinates
+   * instead of an explicit array of 3-component tuples. The output points
+   * then cannot be modified in place. Single precision output points are
+   * always explicit. Default is off.
+   */
+  vtkSetMacro(UseImplicitArrays, bool);
+  vtkGetMacro(UseImplicitArrays, bool);
+  vtkBooleanMacro(UseImplicitArrays, bool);
+  ///@}
+
 protected:
   vtkTransformFilter();
   ~vtkTransformFilter() override;
@@ -97,6 +112,7 @@ protected:
   vtkAbstractTransform* Transform;
   int OutputPointsPrecision;
   bool TransformAllInputVectors;
+  bool UseImplicitArrays;
 
 private:
   vtkTransformFilter(const vtkTransformFilter&) = delete;
@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check the boundary of grids of nonlinear cells extracted by vtkDataSetSurfaceFilter
+// and the original cell and point ids it passes through.
+
+#include "vtkCellData.h"
+#include "vtkCellType.h"
+#include "vtkCellTypeSource.h"
+#include "vtkDataSetSurfaceFilter.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cstdlib>
+#include <set>
+
+namespace
+{
+bool TestCellType(int cellType, vtkIdType expectedNumberOfBoundaryCells)
+{
+  vtkNew<vtkCellTypeSource> source;
+  source->SetCellType(cellType);
+  source->SetBlocksDimensions(3, 3, 3);
+  source->Update();
+  vtkUnstructuredGrid* input = source->GetOutput();
+
+  vtkNew<vtkDataSetSurfaceFilter> surface;
+  surface->SetInputData(input);
+  surface->SetNonlinearSubdivisionLevel(1);
+  surface->PassThroughCellIdsOn();
+  surface->PassThroughPointIdsOn();
+  surface->Update();
+  vtkPolyData* output = surface->GetOutput();
+
+  vtkIdTypeArray* cellIds = vtkIdTypeArray::SafeDownCast(
+    output->GetCellData()->GetArray(surface->GetOriginalCellIdsName()));
+  vtkIdTypeArray* pointIds = vtkIdTypeArray::SafeDownCast(
+    output->GetPointData()->GetArray(surface->GetOriginalPointIdsName()));
+  if (output->GetNumberOfCells() == 0 || !cellIds || !pointIds)
+  {
+    vtkLog(ERROR, "Missing surface or original ids for cell type " << cellType << ".");
+    return false;
+  }
+
+  // The points of each output cell coming from input points must belong to the
+  // input cell the output cell comes from.
+  std::set<vtkIdType> boundaryCells;
+  vtkNew<vtkIdList> inputPointIds;
+  for (vtkIdType cellId = 0; cellId < output->GetNumberOfCells(); ++cellId)
+  {
+    const vtkIdType inputCellId = cellIds->GetValue(cellId);
+    if (inputCellId < 0 || inputCellId >= input->GetNumberOfCells())
+    {
+      vtkLog(ERROR, "Wrong original cell id " << inputCellId << ".");
+      return false;
+    }
+    boundaryCells.insert(inputCellId);
+    input->GetCellPoints(inputCellId, inputPointIds);
+    vtkIdType npts;
+    const vtkIdType* pts;
+    output->GetCellPoints(cellId, npts, pts);
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      const vtkIdType inputPointId = pointIds->GetValue(pts[i]);
+      if (inputPointId < 0)
+      {
+        continue;
+      }
+      double p[3], q[3];
+      output->GetPoint(pts[i], p);
+      input->GetPoint(inputPointId, q);
+      if (inputPointIds->IsId(inputPointId) < 0 || p[0] != q[0] || p[1] != q[1] ||
+        p[2] != q[2])
+      {
+        vtkLog(ERROR,
+          "Point " << pts[i] << " does not come from input cell " << inputCellId << ".");
+        return false;
+      }
+    }
+  }
+
+  if (static_cast<vtkIdType>(boundaryCells.size()) != expectedNumberOfBoundaryCells)
+  {
+    vtkLog(ERROR,
+      "Expected " << expectedNumberOfBoundaryCells << " boundary cells for cell type "
+                  << cellType << ", got " << boundaryCells.size() << ".");
+    return false;
+  }
+  return true;
+}
+}
+
+int TestDataSetSurfaceFilterNonlinearCells(int, char*[])
+{
+  bool success = true;
+  // All the hexahedra but the center one touch the boundary.
+  success &= TestCellType(VTK_QUADRATIC_HEXAHEDRON, 26);
+  success &= TestCellType(VTK_LAGRANGE_HEXAHEDRON, 26);
+  // 12 tetrahedra per block, 2 of them on each boundary block face.
+  success &= TestCellType(VTK_QUADRATIC_TETRA, 2 * 6 * 9);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -28,7 +28,11 @@
 #include "vtkPyramid.h"
 #include "vtkRectilinearGrid.h"
 #include "vtkRectilinearGridGeometryFilter.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
+#include "vtkStaticFaceHashLinksTemplate.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStructuredData.h"
 #include "vtkStructuredGrid.h"
@@ -48,6 +52,8 @@
 #include <cassert>
 #include <numeric>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace
 {
@@ -280,6 +286,251 @@ bool StructuredExecuteWithBlanking(
 
 }
 
+namespace
+{
+//------------------------------------------------------------------------------
+// Threaded extraction of the boundary of an unstructured grid, used instead of
+// vtkUnstructuredGridGeometryFilter before subdividing nonlinear cells. The
+// output has the points and point data of the input, and is made of its
+// visible 0D, 1D and 2D cells, in order, followed by the faces of its 3D cells
+// that are not shared with another 3D cell. Faces are grouped with
+// vtkStaticFaceHashLinksTemplate and matched by their corner points; they are
+// given by vtkCell::GetFace(), so faces of nonlinear cells are nonlinear.
+// The id of the cell each output cell comes from is returned in
+// originalCellIds.
+template <typename TInputIdType, typename TFaceIdType>
+vtkSmartPointer<vtkUnstructuredGrid> ExtractBoundaryCells(vtkDataSetSurfaceFilter* self,
+  vtkUnstructuredGrid* input, vtkIdTypeArray* originalCellIds)
+{
+  vtkStaticFaceHashLinksTemplate<TInputIdType, TFaceIdType> links;
+  links.BuildHashLinks(input);
+  const vtkIdType numHashes = links.GetNumberOfHashes();
+  // The 0D, 1D and 2D cells all have the last hash.
+  const vtkIdType lowerDimHash = numHashes - 1;
+  const TInputIdType* cellIdOfFaces = links.GetCellIdOfFacesInHash(0);
+
+  vtkUnsignedCharArray* ghosts = input->GetCellGhostArray();
+  const unsigned char* cellGhosts = ghosts ? ghosts->GetPointer(0) : nullptr;
+  auto isHidden = [cellGhosts](vtkIdType cellId) {
+    return cellGhosts && (cellGhosts[cellId] & vtkDataSetAttributes::HIDDENCELL);
+  };
+  const bool matchIgnoringCellOrder = self->GetMatchBoundariesIgnoringCellOrder() != 0;
+
+  // Visible lower dimensional cells are output first, in order.
+  TInputIdType* lowerDimCells = links.GetCellIdOfFacesInHash(lowerDimHash);
+  vtkSMPTools::Sort(lowerDimCells, lowerDimCells + links.GetNumberOfFacesInHash(lowerDimHash));
+  std::vector<vtkIdType> lowerDimCellIds;
+  std::vector<vtkIdType> lowerDimConnectivityOffsets(1, 0);
+  for (vtkIdType i = 0; i < links.GetNumberOfFacesInHash(lowerDimHash); ++i)
+  {
+    vtkIdType cellId = lowerDimCells[i];
+    if (!isHidden(cellId))
+    {
+      lowerDimCellIds.push_back(cellId);
+      lowerDimConnectivityOffsets.push_back(
+        lowerDimConnectivityOffsets.back() + input->GetCellSize(cellId));
+    }
+  }
+
+  // A face of a hash is on the boundary when no other face of the hash has the
+  // same corner points and type. The number of boundary faces of each hash and
+  // their connectivity size are turned into offsets afterwards.
+  struct FaceKey
+  {
+    bool Hidden;
+    int Type;
+    vtkIdType NumberOfPoints;
+    std::vector<vtkIdType> Corners;
+  };
+  std::vector<unsigned char> isBoundary(links.GetNumberOfFaces(), 0);
+  std::vector<vtkIdType> cellOffsets(numHashes, 0);
+  std::vector<vtkIdType> connectivityOffsets(numHashes, 0);
+  vtkSMPThreadLocalObject<vtkGenericCell> tlCell;
+  vtkSMPThreadLocal<std::vector<FaceKey>> tlFaceKeys;
+  vtkSMPTools::For(0, lowerDimHash, [&](vtkIdType hash, vtkIdType endHash) {
+    vtkGenericCell* cell = tlCell.Local();
+    std::vector<FaceKey>& faceKeys = tlFaceKeys.Local();
+    std::vector<std::pair<TInputIdType, TFaceIdType>> faces;
+    const bool isFirst = vtkSMPTools::GetSingleThread();
+    const vtkIdType checkAbortInterval = std::min((endHash - hash) / 10 + 1, (vtkIdType)1000);
+    for (; hash < endHash; ++hash)
+    {
+      if (hash % checkAbortInterval == 0)
+      {
+        if (isFirst)
+        {
+          self->CheckAbort();
+        }
+        if (self->GetAbortOutput())
+        {
+          break;
+        }
+      }
+      const vtkIdType numFaces = links.GetNumberOfFacesInHash(hash);
+      if (numFaces == 0)
+      {
+        continue;
+      }
+      TInputIdType* cellIds = links.GetCellIdOfFacesInHash(hash);
+      TFaceIdType* faceIds = links.GetFaceIdOfFacesInHash(hash);
+      // Sort the faces so that the output does not depend on the threads.
+      faces.resize(numFaces);
+      for (vtkIdType i = 0; i < numFaces; ++i)
+      {
+        faces[i] = std::make_pair(cellIds[i], faceIds[i]);
+      }
+      std::sort(faces.begin(), faces.end());
+      faceKeys.resize(numFaces);
+      for (vtkIdType i = 0; i < numFaces; ++i)
+      {
+        cellIds[i] = faces[i].first;
+        faceIds[i] = faces[i].second;
+        FaceKey& key = faceKeys[i];
+        key.Hidden = isHidden(cellIds[i]);
+        if (key.Hidden)
+        {
+          continue;
+        }
+        input->GetCell(cellIds[i], cell);
+        vtkCell* face = cell->GetFace(faceIds[i]);
+        key.NumberOfPoints = face->GetNumberOfPoints();
+        const vtkIdType numCorners =
+          face->IsLinear() ? key.NumberOfPoints : face->GetNumberOfEdges();
+        key.Type = matchIgnoringCellOrder ? static_cast<int>(numCorners) : face->GetCellType();
+        const vtkIdType* pts = face->GetPointIds()->GetPointer(0);
+        key.Corners.assign(pts, pts + numCorners);
+        std::sort(key.Corners.begin(), key.Corners.end());
+      }
+
+      const vtkIdType offset = cellIds - cellIdOfFaces;
+      for (vtkIdType i = 0; i < numFaces; ++i)
+      {
+        const FaceKey& key = faceKeys[i];
+        bool matched = key.Hidden;
+        for (vtkIdType j = 0; j < numFaces && !matched; ++j)
+        {
+          matched = j != i && !faceKeys[j].Hidden && faceKeys[j].Type == key.Type &&
+            faceKeys[j].Corners == key.Corners;
+        }
+        if (!matched)
+        {
+          isBoundary[offset + i] = 1;
+          ++cellOffsets[hash];
+          connectivityOffsets[hash] += key.NumberOfPoints;
+        }
+      }
+    }
+  });
+  if (self->GetAbortOutput())
+  {
+    return nullptr;
+  }
+
+  const vtkIdType numLowerDimCells = static_cast<vtkIdType>(lowerDimCellIds.size());
+  const vtkIdType lowerDimConnectivitySize = lowerDimConnectivityOffsets.back();
+  vtkIdType numCells = numLowerDimCells;
+  vtkIdType connectivitySize = lowerDimConnectivitySize;
+  for (vtkIdType hash = 0; hash < lowerDimHash; ++hash)
+  {
+    const vtkIdType hashCells = cellOffsets[hash];
+    const vtkIdType hashConnectivity = connectivityOffsets[hash];
+    cellOffsets[hash] = numCells;
+    connectivityOffsets[hash] = connectivitySize;
+    numCells += hashCells;
+    connectivitySize += hashConnectivity;
+  }
+
+  vtkNew<vtkIdTypeArray> offsets;
+  offsets->SetNumberOfValues(numCells + 1);
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfValues(connectivitySize);
+  vtkNew<vtkUnsignedCharArray> types;
+  types->SetNumberOfValues(numCells);
+  originalCellIds->SetNumberOfValues(numCells);
+  vtkIdType* offsetsPtr = offsets->GetPointer(0);
+  vtkIdType* connectivityPtr = connectivity->GetPointer(0);
+  unsigned char* typesPtr = types->GetPointer(0);
+  vtkIdType* originalIdsPtr = originalCellIds->GetPointer(0);
+  offsetsPtr[numCells] = connectivitySize;
+
+  vtkSMPThreadLocalObject<vtkIdList> tlIds;
+  vtkSMPTools::For(0, numLowerDimCells, [&](vtkIdType i, vtkIdType end) {
+    vtkIdList* ids = tlIds.Local();
+    for (; i < end; ++i)
+    {
+      const vtkIdType cellId = lowerDimCellIds[i];
+      vtkIdType npts;
+      const vtkIdType* pts;
+      input->GetCellPoints(cellId, npts, pts, ids);
+      offsetsPtr[i] = lowerDimConnectivityOffsets[i];
+      std::copy_n(pts, npts, connectivityPtr + offsetsPtr[i]);
+      typesPtr[i] = static_cast<unsigned char>(input->GetCellType(cellId));
+      originalIdsPtr[i] = cellId;
+    }
+  });
+  vtkSMPTools::For(0, lowerDimHash, [&](vtkIdType hash, vtkIdType endHash) {
+    vtkGenericCell* cell = tlCell.Local();
+    for (; hash < endHash; ++hash)
+    {
+      const vtkIdType numFaces = links.GetNumberOfFacesInHash(hash);
+      const TInputIdType* cellIds = links.GetCellIdOfFacesInHash(hash);
+      const TFaceIdType* faceIds = links.GetFaceIdOfFacesInHash(hash);
+      const vtkIdType offset = cellIds - cellIdOfFaces;
+      vtkIdType outCellId = cellOffsets[hash];
+      vtkIdType outOffset = connectivityOffsets[hash];
+      for (vtkIdType i = 0; i < numFaces; ++i)
+      {
+        if (!isBoundary[offset + i])
+        {
+          continue;
+        }
+        input->GetCell(cellIds[i], cell);
+        vtkCell* face = cell->GetFace(faceIds[i]);
+        const vtkIdType npts = face->GetNumberOfPoints();
+        offsetsPtr[outCellId] = outOffset;
+        std::copy_n(face->GetPointIds()->GetPointer(0), npts, connectivityPtr + outOffset);
+        typesPtr[outCellId] = static_cast<unsigned char>(face->GetCellType());
+        originalIdsPtr[outCellId] = cellIds[i];
+        ++outCellId;
+        outOffset += npts;
+      }
+    }
+  });
+
+  vtkNew<vtkCellArray> cells;
+  cells->SetData(offsets, connectivity);
+  vtkSmartPointer<vtkUnstructuredGrid> output = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  output->SetPoints(input->GetPoints());
+  output->SetCells(types, cells);
+  output->GetPointData()->ShallowCopy(input->GetPointData());
+  output->GetFieldData()->ShallowCopy(input->GetFieldData());
+  vtkNew<vtkIdList> sourceIds;
+  sourceIds->SetArray(originalIdsPtr, numCells, false);
+  output->GetCellData()->CopyAllocate(input->GetCellData(), numCells);
+  output->GetCellData()->CopyData(input->GetCellData(), sourceIds);
+  return output;
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkUnstructuredGrid> ExtractBoundaryCells(
+  vtkDataSetSurfaceFilter* self, vtkUnstructuredGrid* input, vtkIdTypeArray* originalCellIds)
+{
+#ifdef VTK_USE_64BIT_IDS
+  if (input->GetNumberOfPoints() > VTK_TYPE_INT32_MAX ||
+    input->GetNumberOfCells() > VTK_TYPE_INT32_MAX)
+  {
+    return input->GetFaces()
+      ? ExtractBoundaryCells<vtkTypeInt64, vtkTypeInt32>(self, input, originalCellIds)
+      : ExtractBoundaryCells<vtkTypeInt64, vtkTypeInt8>(self, input, originalCellIds);
+  }
+#endif
+  return input->GetFaces()
+    ? ExtractBoundaryCells<vtkTypeInt32, vtkTypeInt32>(self, input, originalCellIds)
+    : ExtractBoundaryCells<vtkTypeInt32, vtkTypeInt8>(self, input, originalCellIds);
+}
+}
+
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkDataSetSurfaceFilter::vtkEdgeInterpolationMap
 {
@@ -1393,11 +1644,29 @@ int vtkDataSetSurfaceFilter::UnstructuredGridExecuteInternal(
   vtkUnstructuredGridBase* input, vtkPolyData* output, bool handleSubdivision)
 {
   vtkSmartPointer<vtkUnstructuredGrid> tempInput;
-  if (handleSubdivision)
+  // Ids of the input cells and points the cells and points of tempInput come from.
+  vtkSmartPointer<vtkIdTypeArray> tempInputCellIds;
+  vtkSmartPointer<vtkIdTypeArray> tempInputPointIds;
+  vtkUnstructuredGrid* grid = vtkUnstructuredGrid::SafeDownCast(input);
+  if (handleSubdivision && grid && !grid->GetCellData()->GetHigherOrderDegrees())
+  {
+    // Since this filter only properly subdivides 2D cells past
+    // level 1, we convert 3D cells to their boundary faces, extracted in
+    // parallel. The points of the input are kept.
+    tempInputCellIds = vtkSmartPointer<vtkIdTypeArray>::New();
+    tempInput = ::ExtractBoundaryCells(this, grid, tempInputCellIds);
+    if (!tempInput)
+    {
+      return 1;
+    }
+    input = tempInput;
+  }
+  else if (handleSubdivision)
   {
     // Since this filter only properly subdivides 2D cells past
     // level 1, we convert 3D cells to 2D by using
-    // vtkUnstructuredGridGeometryFilter.
+    // vtkUnstructuredGridGeometryFilter. It is used for higher order cells
+    // with explicit degrees, that it passes to their faces.
     vtkNew<vtkUnstructuredGridGeometryFilter> uggf;
     vtkNew<vtkUnstructuredGrid> clone;
     clone->ShallowCopy(input);
@@ -1417,6 +1686,16 @@ int vtkDataSetSurfaceFilter::UnstructuredGridExecuteInternal(
     tempInput = vtkSmartPointer<vtkUnstructuredGrid>::New();
     tempInput->ShallowCopy(uggf->GetOutputDataObject(0));
     input = tempInput;
+    if (this->PassThroughCellIds)
+    {
+      tempInputCellIds = vtkIdTypeArray::SafeDownCast(
+        tempInput->GetCellData()->GetArray(this->GetOriginalCellIdsName()));
+    }
+    if (this->PassThroughPointIds)
+    {
+      tempInputPointIds = vtkIdTypeArray::SafeDownCast(
+        tempInput->GetPointData()->GetArray(this->GetOriginalPointIdsName()));
+    }
 
     if (this->CheckAbort())
     {
@@ -2204,6 +2483,22 @@ int vtkDataSetSurfaceFilter::UnstructuredGridExecuteInternal(
     outputCD->CopyData(inputCD, q->SourceId, this->NumberOfNewCells++);
   }
 
+  // Report the ids of the cells and points of the original input rather
+  // than of the boundary extracted for subdivision.
+  if (this->OriginalCellIds && tempInputCellIds)
+  {
+    vtkSMPTools::Transform(this->OriginalCellIds->GetPointer(0),
+      this->OriginalCellIds->GetPointer(0) + this->OriginalCellIds->GetNumberOfValues(),
+      this->OriginalCellIds->GetPointer(0),
+      [&](vtkIdType cellId) { return tempInputCellIds->GetValue(cellId); });
+  }
+  if (this->OriginalPointIds && tempInputPointIds)
+  {
+    vtkSMPTools::Transform(this->OriginalPointIds->GetPointer(0),
+      this->OriginalPointIds->GetPointer(0) + this->OriginalPointIds->GetNumberOfValues(),
+      this->OriginalPointIds->GetPointer(0),
+      [&](vtkIdType ptId) { return ptId < 0 ? ptId : tempInputPointIds->GetValue(ptId); });
+  }
   if (this->PassThroughCellIds)
   {
     outputCD->AddArray(this->OriginalCellIds);
@@ -2790,6 +2790,21 @@ vtkGeometryFilterHelper* vtkGeometryFilterHelper::CharacterizeUnstructuredGrid(
 {
   vtkGeometryFilterHelper* info = new vtkGeometryFilterHelper;
 
+  // Unstructured grids cache their distinct cell types, which avoids a
+  // traversal of all the cells (e.g. for grids made of a single cell type).
+  if (vtkUnstructuredGrid* ugrid = vtkUnstructuredGrid::SafeDownCast(input))
+  {
+    vtkUnsignedCharArray* distinctCellTypes = ugrid->GetDistinctCellTypesArray();
+    std::fill(info->CellTypesInfo.begin(), info->CellTypesInfo.end(), false);
+    for (vtkIdType i = 0; i < distinctCellTypes->GetNumberOfValues(); ++i)
+    {
+      CharacterizeGrid::AssignCellTypeInfo(distinctCellTypes->GetValue(i), info->CellTypesInfo);
+    }
+    info->IsLinear = static_cast<unsigned char>(
+      !info->CellTypesInfo[vtkGeometryFilterHelper::CellType::NON_LINEAR_CELLS]);
+    return info;
+  }
+
   // Check to see if the data actually has nonlinear cells.  Handling
   // nonlinear cells requires delegation to the appropriate filter.
   CharacterizeGrid characterize(input);
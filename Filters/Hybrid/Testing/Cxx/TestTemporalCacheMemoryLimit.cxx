@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that vtkTemporalDataSetCache shares the arrays that do not change
+// between time steps when ShareUnchangedArrays is on, and that it stays
+// within its CacheMemoryLimit.
+
+#include "vtkDataArray.h"
+#include "vtkDataSet.h"
+#include "vtkInformation.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkTemporalDataSetCache.h"
+#include "vtkTimeSourceExample.h"
+
+#include <cstdlib>
+
+namespace
+{
+// Update every time step and check the "Point Value" of the output
+bool UpdateTimeSteps(vtkTimeSourceExample* source, vtkTemporalDataSetCache* cache)
+{
+  source->UpdateInformation();
+  vtkInformation* info = source->GetOutputInformation(0);
+  const double* timeSteps = info->Get(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+  const int numSteps = info->Length(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+  for (int step = 0; step < numSteps; ++step)
+  {
+    source->UpdateTimeStep(timeSteps[step]);
+    const double expected =
+      vtkDataSet::SafeDownCast(source->GetOutputDataObject(0))->GetPointData()->GetArray(
+        "Point Value")->GetComponent(0, 0);
+    cache->UpdateTimeStep(timeSteps[step]);
+    vtkDataSet* output = vtkDataSet::SafeDownCast(cache->GetOutputDataObject(0));
+    if (!output || output->GetPointData()->GetArray("Point Value")->GetComponent(0, 0) != expected)
+    {
+      vtkLog(ERROR, "Wrong output for time step " << step);
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestTemporalCacheMemoryLimit(int, char*[])
+{
+  // Static points, changing values
+  vtkNew<vtkTimeSourceExample> source;
+  vtkNew<vtkTemporalDataSetCache> cache;
+  cache->SetInputConnection(source->GetOutputPort());
+  cache->SetCacheSize(100);
+
+  if (!UpdateTimeSteps(source, cache))
+  {
+    return EXIT_FAILURE;
+  }
+  const unsigned long copiedSize = cache->GetCacheMemorySize();
+
+  cache->ShareUnchangedArraysOn();
+  if (!UpdateTimeSteps(source, cache))
+  {
+    return EXIT_FAILURE;
+  }
+  const unsigned long sharedSize = cache->GetCacheMemorySize();
+  if (sharedSize == 0 || sharedSize >= copiedSize)
+  {
+    vtkLog(ERROR, "Arrays not shared: " << sharedSize << " KiB instead of " << copiedSize);
+    return EXIT_FAILURE;
+  }
+
+  // The least recently used time steps are removed to stay within the limit
+  const unsigned long limit = copiedSize / 4;
+  cache->ShareUnchangedArraysOff();
+  cache->SetCacheMemoryLimit(limit);
+  if (!UpdateTimeSteps(source, cache))
+  {
+    return EXIT_FAILURE;
+  }
+  if (cache->GetCacheMemorySize() > limit)
+  {
+    vtkLog(ERROR, "Cache uses " << cache->GetCacheMemorySize() << " KiB over the limit " << limit);
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that vtkTemporalInterpolator shares the points and arrays that are
+// the same in both time steps, and interpolates the others.
+
+#include "vtkDataArray.h"
+#include "vtkGenerateTimeSteps.h"
+#include "vtkInformation.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPointSet.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSphereSource.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkTemporalInterpolator.h"
+#include "vtkTimeSourceExample.h"
+
+#include <cmath>
+#include <cstdlib>
+
+int TestTemporalInterpolatorStaticMesh(int, char*[])
+{
+  // The same sphere at every time step
+  vtkNew<vtkSphereSource> sphere;
+  sphere->Update();
+  vtkNew<vtkGenerateTimeSteps> generateTimeSteps;
+  generateTimeSteps->SetInputConnection(sphere->GetOutputPort());
+  generateTimeSteps->GenerateTimeStepValues(0, 10, 2);
+
+  vtkNew<vtkTemporalInterpolator> interpolator;
+  interpolator->SetInputConnection(generateTimeSteps->GetOutputPort());
+  interpolator->UpdateTimeStep(3.0);
+  vtkPointSet* output = vtkPointSet::SafeDownCast(interpolator->GetOutputDataObject(0));
+  vtkPolyData* input = sphere->GetOutput();
+  if (!output || output->GetPoints()->GetData() != input->GetPoints()->GetData() ||
+    output->GetPointData()->GetArray("Normals") != input->GetPointData()->GetArray("Normals"))
+  {
+    vtkLog(ERROR, "The static points and normals are not shared");
+    return EXIT_FAILURE;
+  }
+
+  // Moving points
+  vtkNew<vtkTimeSourceExample> source;
+  source->SetXAmplitude(10);
+  source->UpdateInformation();
+  vtkInformation* info = source->GetOutputInformation(0);
+  const double* timeSteps = info->Get(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
+  source->UpdateTimeStep(timeSteps[2]);
+  vtkNew<vtkPoints> points2;
+  points2->DeepCopy(vtkPointSet::SafeDownCast(source->GetOutputDataObject(0))->GetPoints());
+  source->UpdateTimeStep(timeSteps[3]);
+  vtkNew<vtkPoints> points3;
+  points3->DeepCopy(vtkPointSet::SafeDownCast(source->GetOutputDataObject(0))->GetPoints());
+
+  interpolator->SetInputConnection(source->GetOutputPort());
+  interpolator->UpdateTimeStep(0.25 * timeSteps[2] + 0.75 * timeSteps[3]);
+  output = vtkPointSet::SafeDownCast(interpolator->GetOutputDataObject(0));
+  if (!output || output->GetNumberOfPoints() != points2->GetNumberOfPoints())
+  {
+    vtkLog(ERROR, "Wrong number of interpolated points");
+    return EXIT_FAILURE;
+  }
+  double x[3], x2[3], x3[3];
+  for (vtkIdType ptId = 0; ptId < output->GetNumberOfPoints(); ++ptId)
+  {
+    output->GetPoint(ptId, x);
+    points2->GetPoint(ptId, x2);
+    points3->GetPoint(ptId, x3);
+    for (int i = 0; i < 3; ++i)
+    {
+      if (std::abs(x[i] - (0.25 * x2[i] + 0.75 * x3[i])) > 1e-5)
+      {
+        vtkLog(ERROR, "Wrong interpolated point " << ptId);
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -20,6 +20,10 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkProp3D.h"
+#include "vtkRadixSort.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkShortArray.h"
 #include "vtkSignedCharArray.h"
 #include "vtkTransform.h"
@@ -27,37 +31,17 @@
 #include "vtkUnsignedLongArray.h"
 #include "vtkUnsignedLongLongArray.h"
 #include "vtkUnsignedShortArray.h"
+#include "vtkWeakPointer.h"
 
 #include <algorithm>
 #include <cstdlib>
 #include <limits>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 namespace
 {
 
-template <typename T>
-struct greaterf
-{
-  greaterf(const T* az)
-    : z(az)
-  {
-  }
-  bool operator()(vtkIdType l, vtkIdType r) const { return z[l] > z[r]; }
-  const T* z;
-};
-
-template <typename T>
-struct lessf
-{
-  lessf(const T* az)
-    : z(az)
-  {
-  }
-  bool operator()(vtkIdType l, vtkIdType r) const { return z[l] < z[r]; }
-  const T* z;
-};
-
 template <typename T>
 T getCellBoundsCenter(const vtkIdType* pids, vtkIdType nPids, const T* px)
 {
@@ -72,118 +56,104 @@ T getCellBoundsCenter(const vtkIdType* pids, vtkIdType nPids, const T* px)
   return (mn + mx) / T(2);
 }
 
+// Compute the position each cell is sorted by: its first point or the
+// center of its bounds.
 template <typename T>
-void getCellCenterDepth(vtkPolyData* pds, vtkDataArray* gpts, vtkIdType nCells, double* origin,
-  double* direction, T*& depth)
+void getCellPositions(
+  vtkPolyData* pds, vtkDataArray* gpts, vtkIdType nCells, bool firstPoint, double* positions)
 {
-  if (nCells < 1)
-  {
-    return;
-  }
-
-  T* ppts = static_cast<T*>(gpts->GetVoidPointer(0));
-  T* px = ppts;
-  T* py = ppts + 1;
-  T* pz = ppts + 2;
+  const T* px = static_cast<T*>(gpts->GetVoidPointer(0));
 
   // this call insures that BuildCells gets done if it's
-  // needed and we can use the faster GetCellPoints api
-  // that doesn't check
+  // needed and the cells can then be traversed by several threads
   if (pds->NeedToBuildCells())
   {
     pds->BuildCells();
   }
 
-  // compute cell centers
-  T* cx = new T[nCells];
-  T* cy = new T[nCells];
-  T* cz = new T[nCells];
-  for (vtkIdType cid = 0; cid < nCells; ++cid)
-  {
-    // get the cell point ids using the fast api
-    const vtkIdType* pids = nullptr;
-    vtkIdType nPids = 0;
-    pds->GetCellPoints(cid, nPids, pids);
-
-    // compute the center of the cell bounds
-    cx[cid] = getCellBoundsCenter(pids, nPids, px);
-    cy[cid] = getCellBoundsCenter(pids, nPids, py);
-    cz[cid] = getCellBoundsCenter(pids, nPids, pz);
-  }
-
-  // compute the distance to the cell center
-  T x0 = static_cast<T>(origin[0]);
-  T y0 = static_cast<T>(origin[1]);
-  T z0 = static_cast<T>(origin[2]);
-  T vx = static_cast<T>(direction[0]);
-  T vy = static_cast<T>(direction[1]);
-  T vz = static_cast<T>(direction[2]);
-  depth = new T[nCells];
-  for (vtkIdType cid = 0; cid < nCells; ++cid)
-  {
-    depth[cid] = (cx[cid] - x0) * vx + (cy[cid] - y0) * vy + (cz[cid] - z0) * vz;
-  }
-
-  delete[] cx;
-  delete[] cy;
-  delete[] cz;
+  vtkSMPThreadLocalObject<vtkIdList> tlCellPointIds;
+  vtkSMPTools::For(0, nCells, [&](vtkIdType begin, vtkIdType end) {
+    vtkIdList* cellPointIds = tlCellPointIds.Local();
+    for (vtkIdType cid = begin; cid < end; ++cid)
+    {
+      const vtkIdType* pids = nullptr;
+      vtkIdType nPids = 0;
+      pds->GetCellPoints(cid, nPids, pids, cellPointIds);
+      double* position = positions + 3 * cid;
+      for (int k = 0; k < 3; ++k)
+      {
+        position[k] = firstPoint ? static_cast<double>(px[3 * pids[0] + k])
+                                 : static_cast<double>(getCellBoundsCenter(pids, nPids, px + k));
+      }
+    }
+  });
 }
 
-template <typename T>
-void getCellPoint0Depth(vtkPolyData* pds, vtkDataArray* gpts, vtkIdType nCells, double* origin,
-  double* direction, T*& depth)
+// Compute the position of the parametric center of each cell.
+void getCellParametricCenters(vtkPolyData* pds, vtkIdType nCells, double* positions)
 {
-  if (nCells < 1)
-  {
-    return;
-  }
-
-  T* ppts = static_cast<T*>(gpts->GetVoidPointer(0));
-  T* px = ppts;
-  T* py = ppts + 1;
-  T* pz = ppts + 2;
-
-  // this call insures that BuildCells gets done if it's
-  // needed and we can use the faster GetCellPoints api
   if (pds->NeedToBuildCells())
   {
     pds->BuildCells();
   }
 
-  T* cx = new T[nCells];
-  T* cy = new T[nCells];
-  T* cz = new T[nCells];
-  const vtkIdType* pids = nullptr;
-  vtkIdType nPids = 0;
-  for (vtkIdType cid = 0; cid < nCells; ++cid)
+  const int maxCellSize = pds->GetMaxCellSize();
+  vtkSMPThreadLocalObject<vtkGenericCell> tlCell;
+  vtkSMPThreadLocal<std::vector<double>> tlWeights;
+  vtkSMPTools::For(0, nCells, [&](vtkIdType begin, vtkIdType end) {
+    vtkGenericCell* cell = tlCell.Local();
+    std::vector<double>& weights = tlWeights.Local();
+    weights.resize(maxCellSize);
+    double p[3];
+    for (vtkIdType cid = begin; cid < end; ++cid)
+    {
+      pds->GetCell(cid, cell);
+      int subId = cell->GetParametricCenter(p);
+      cell->EvaluateLocation(subId, p, positions + 3 * cid, weights.data());
+    }
+  });
+}
+
+// Sort the cells by the distance of their position along the direction.
+// With resort, order holds the previous order which is likely to be almost
+// sorted already.
+template <typename TDepth>
+void sortCells(const double* positions, vtkIdType nCells, const double origin[3],
+  const double direction[3], bool descending, bool resort, vtkIdType* order)
+{
+  std::vector<TDepth> depth(nCells);
+  vtkSMPTools::For(0, nCells, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType cid = begin; cid < end; ++cid)
+    {
+      const double* x = positions + 3 * cid;
+      depth[cid] = static_cast<TDepth>((x[0] - origin[0]) * direction[0] +
+        (x[1] - origin[1]) * direction[1] + (x[2] - origin[2]) * direction[2]);
+    }
+  });
+
+  if (resort)
   {
-    // get the cell point ids using the fast api
-    pds->GetCellPoints(cid, nPids, pids);
-    vtkIdType ii = pids[0];
-    cx[cid] = px[3 * ii];
-    cy[cid] = py[3 * ii];
-    cz[cid] = pz[3 * ii];
-  }
-
-  // compute the distance to the cell's first point
-  T x0 = static_cast<T>(origin[0]);
-  T y0 = static_cast<T>(origin[1]);
-  T z0 = static_cast<T>(origin[2]);
-  T vx = static_cast<T>(direction[0]);
-  T vy = static_cast<T>(direction[1]);
-  T vz = static_cast<T>(direction[2]);
-  depth = new T[nCells];
-  for (vtkIdType cid = 0; cid < nCells; ++cid)
+    vtkRadixSort::ResortIdsByKey(depth.data(), order, nCells, descending);
+  }
+  else
   {
-    depth[cid] = (cx[cid] - x0) * vx + (cy[cid] - y0) * vy + (cz[cid] - z0) * vz;
+    vtkRadixSort::SortIdsByKey(depth.data(), order, nCells, descending);
   }
-
-  delete[] cx;
-  delete[] cy;
-  delete[] cz;
 }
 }
 
+// Cell positions and order kept from the previous execution, so that only
+// the depths are recomputed and the cells resorted when only the view
+// direction changed.
+struct vtkDepthSortPolyData::vtkInternals
+{
+  vtkWeakPointer<vtkPolyData> Input;
+  vtkTimeStamp PositionsTime;
+  int PositionsMode = -1;
+  std::vector<double> Positions;
+  std::vector<vtkIdType> Order;
+};
+
 vtkStandardNewMacro(vtkDepthSortPolyData);
 
 vtkCxxSetObjectMacro(vtkDepthSortPolyData, Camera, vtkCamera);
@@ -195,6 +165,7 @@ vtkDepthSortPolyData::vtkDepthSortPolyData()
   , Prop3D(nullptr)
   , Transform(vtkTransform::New())
   , SortScalars(0)
+  , Internals(new vtkInternals)
 {
   std::fill_n(this->Vector, 3, 0.0);
   std::fill_n(this->Origin, 3, 0.0);
@@ -278,69 +249,58 @@ int vtkDepthSortPolyData::RequestData(vtkInformation* vtkNotUsed(request),
 
   if (nCells)
   {
-    if ((this->DepthSortMode == VTK_SORT_FIRST_POINT) ||
-      (this->DepthSortMode == VTK_SORT_BOUNDS_CENTER))
+    // The cell positions only depend on the input and the sort mode
+    vtkInternals& internals = *this->Internals;
+    const bool positionsValid = internals.Input == input &&
+      internals.PositionsMode == this->DepthSortMode &&
+      internals.PositionsTime.GetMTime() > input->GetMTime() &&
+      static_cast<vtkIdType>(internals.Positions.size()) == 3 * nCells;
+    if (!positionsValid)
     {
+      internals.Positions.resize(3 * nCells);
+      internals.Order.clear();
       vtkDataArray* pts = tmpInput->GetPoints()->GetData();
-      switch (pts->GetDataType())
+      if ((this->DepthSortMode == VTK_SORT_FIRST_POINT) ||
+        (this->DepthSortMode == VTK_SORT_BOUNDS_CENTER))
       {
-        vtkTemplateMacro(
-
-          // compute the cell's depth
-          VTK_TT* depth = nullptr; if (this->DepthSortMode == VTK_SORT_FIRST_POINT) {
-            ::getCellPoint0Depth(tmpInput, pts, nCells, origin, direction, depth);
-          } else { ::getCellCenterDepth(tmpInput, pts, nCells, origin, direction, depth); }
-
-          // sort cell ids by depth
-          if (this->Direction == VTK_DIRECTION_FRONT_TO_BACK) {
-            ::lessf<VTK_TT> comp(depth);
-            std::sort(order, order + nCells, comp);
-          } else {
-            ::greaterf<VTK_TT> comp(depth);
-            std::sort(order, order + nCells, comp);
-          }
-
-          delete[] depth;);
+        const bool firstPoint = this->DepthSortMode == VTK_SORT_FIRST_POINT;
+        switch (pts->GetDataType())
+        {
+          vtkTemplateMacro(::getCellPositions<VTK_TT>(
+            tmpInput, pts, nCells, firstPoint, internals.Positions.data()));
+        }
       }
-    }
-    else // VTK_SORT_PARAMETRIC_CENTER
-    {
-      vtkGenericCell* cell = vtkGenericCell::New();
-
-      double x[3] = { 0.0 };
-      double p[3] = { 0.0 };
-
-      size_t maxCellSize = input->GetMaxCellSize();
-      double* weight = new double[maxCellSize];
-      double* depth = new double[nCells];
-
-      for (vtkIdType cid = 0; cid < nCells; ++cid)
+      else // VTK_SORT_PARAMETRIC_CENTER
       {
-        tmpInput->GetCell(cid, cell);
-        int subId = cell->GetParametricCenter(p);
-        cell->EvaluateLocation(subId, p, x, weight);
-
-        // compute the distance
-        depth[cid] = (x[0] - origin[0]) * direction[0] + (x[1] - origin[1]) * direction[1] +
-          (x[2] - origin[2]) * direction[2];
+        ::getCellParametricCenters(tmpInput, nCells, internals.Positions.data());
       }
+      internals.Input = input;
+      internals.PositionsMode = this->DepthSortMode;
+      internals.PositionsTime.Modified();
+    }
 
-      // sort
-      if (this->Direction == VTK_DIRECTION_FRONT_TO_BACK)
-      {
-        ::lessf<double> comp(depth);
-        std::sort(order, order + nCells, comp);
-      }
-      else
-      {
-        ::greaterf<double> comp(depth);
-        std::sort(order, order + nCells, comp);
-      }
+    // Start from the previous order when there is one, it is usually almost
+    // sorted for the new view direction.
+    const bool resort = static_cast<vtkIdType>(internals.Order.size()) == nCells;
+    if (resort)
+    {
+      std::copy(internals.Order.begin(), internals.Order.end(), order);
+    }
 
-      delete[] weight;
-      delete[] depth;
-      cell->Delete();
+    // Sort cell ids by depth. The depths keep the precision of float points.
+    const bool descending = this->Direction != VTK_DIRECTION_FRONT_TO_BACK;
+    if (this->DepthSortMode != VTK_SORT_PARAMETRIC_CENTER &&
+      tmpInput->GetPoints()->GetDataType() == VTK_FLOAT)
+    {
+      ::sortCells<float>(
+        internals.Positions.data(), nCells, origin, direction, descending, resort, order);
+    }
+    else
+    {
+      ::sortCells<double>(
+        internals.Positions.data(), nCells, origin, direction, descending, resort, order);
     }
+    internals.Order.assign(order, order + nCells);
   }
 
   // construct the output
@@ -11,6 +11,12 @@
  * specifying a camera and/or prop to define a view direction; or
  * explicitly set a view direction.
  *
+ * The cell positions and depths are computed in parallel with vtkSMPTools
+ * and the cells are sorted with a parallel radix sort. The cell positions
+ * and the resulting order are kept between executions: when only the view
+ * direction changed, the depths are recomputed and the previous order,
+ * usually almost sorted already, is resorted incrementally.
+ *
  * @warning
  * The sort operation will not work well for long, thin primitives, or cells
  * that intersect, overlap, or interpenetrate each other.
@@ -22,6 +28,8 @@
 #include "vtkFiltersHybridModule.h" // For export macro
 #include "vtkPolyDataAlgorithm.h"
 
+#include <memory> // For std::unique_ptr
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkCamera;
 class vtkProp3D;
@@ -153,6 +161,9 @@ protected:
   vtkTypeBool SortScalars;
 
 private:
+  struct vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+
   vtkDepthSortPolyData(const vtkDepthSortPolyData&) = delete;
   void operator=(const vtkDepthSortPolyData&) = delete;
 };
@@ -2,18 +2,28 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkTemporalDataSetCache.h"
 
+#include "vtkCellData.h"
 #include "vtkCompositeDataIterator.h"
 #include "vtkCompositeDataPipeline.h"
 #include "vtkCompositeDataSet.h"
+#include "vtkDataArray.h"
+#include "vtkDataSet.h"
 #include "vtkFeatures.h" // for VTK_USE_MEMKIND
+#include "vtkFieldData.h"
 #include "vtkImageData.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPointSet.h"
+#include "vtkPoints.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <set>
 #include <vector>
 
 // A helper class to to turn on memkind, if enabled, while ensuring it always is restored
@@ -45,6 +55,135 @@ public:
   vtkTDSCMemkindRAII(vtkTDSCMemkindRAII const&) = default;
 };
 
+namespace
+{
+//------------------------------------------------------------------------------
+// Call the functor on every dataset of a dataset or of a composite dataset.
+template <typename Functor>
+void ForEachDataSet(vtkDataObject* dobj, Functor&& functor)
+{
+  if (auto cds = vtkCompositeDataSet::SafeDownCast(dobj))
+  {
+    vtkSmartPointer<vtkCompositeDataIterator> iter;
+    iter.TakeReference(cds->NewIterator());
+    for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+    {
+      if (auto ds = vtkDataSet::SafeDownCast(iter->GetCurrentDataObject()))
+      {
+        functor(ds);
+      }
+    }
+  }
+  else if (auto ds = vtkDataSet::SafeDownCast(dobj))
+  {
+    functor(ds);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Call the functor on the points and on the data arrays of a dataset.
+template <typename Functor>
+void ForEachArray(vtkDataSet* ds, Functor&& functor)
+{
+  vtkPointSet* ps = vtkPointSet::SafeDownCast(ds);
+  if (ps && ps->GetPoints())
+  {
+    functor(ps->GetPoints()->GetData());
+  }
+  for (vtkFieldData* fd : { ds->GetFieldData(), static_cast<vtkFieldData*>(ds->GetPointData()),
+         static_cast<vtkFieldData*>(ds->GetCellData()) })
+  {
+    for (int i = 0; i < fd->GetNumberOfArrays(); ++i)
+    {
+      functor(fd->GetAbstractArray(i));
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Whether two arrays hold the same values, for arrays with a standard memory
+// layout.
+bool SameArrays(vtkAbstractArray* a1, vtkAbstractArray* a2)
+{
+  if (a1 == a2)
+  {
+    return true;
+  }
+  vtkDataArray* da1 = vtkDataArray::SafeDownCast(a1);
+  vtkDataArray* da2 = vtkDataArray::SafeDownCast(a2);
+  if (!da1 || !da2 || !da1->HasStandardMemoryLayout() || !da2->HasStandardMemoryLayout() ||
+    da1->GetDataType() != da2->GetDataType() ||
+    da1->GetNumberOfComponents() != da2->GetNumberOfComponents() ||
+    da1->GetNumberOfTuples() != da2->GetNumberOfTuples())
+  {
+    return false;
+  }
+  const size_t numBytes = static_cast<size_t>(da1->GetNumberOfValues()) * da1->GetDataTypeSize();
+  return numBytes == 0 ||
+    std::memcmp(da1->GetVoidPointer(0), da2->GetVoidPointer(0), numBytes) == 0;
+}
+
+//------------------------------------------------------------------------------
+// Replace the points and the named arrays of ds that are equal to the ones of
+// reference with the ones of reference.
+void ShareDataSetArrays(vtkDataSet* ds, vtkDataSet* reference)
+{
+  vtkPointSet* ps = vtkPointSet::SafeDownCast(ds);
+  vtkPointSet* refPs = vtkPointSet::SafeDownCast(reference);
+  if (ps && refPs && ps->GetPoints() && refPs->GetPoints() &&
+    SameArrays(ps->GetPoints()->GetData(), refPs->GetPoints()->GetData()))
+  {
+    ps->SetPoints(refPs->GetPoints());
+  }
+
+  vtkFieldData* fds[3] = { ds->GetFieldData(), ds->GetPointData(), ds->GetCellData() };
+  vtkFieldData* refFds[3] = { reference->GetFieldData(), reference->GetPointData(),
+    reference->GetCellData() };
+  for (int f = 0; f < 3; ++f)
+  {
+    for (int i = 0; i < fds[f]->GetNumberOfArrays(); ++i)
+    {
+      vtkAbstractArray* array = fds[f]->GetAbstractArray(i);
+      if (!array->GetName())
+      {
+        continue;
+      }
+      vtkAbstractArray* refArray = refFds[f]->GetAbstractArray(array->GetName());
+      if (refArray && refArray != array && SameArrays(array, refArray))
+      {
+        // replaces the array with the same name, keeping its attribute type
+        fds[f]->AddArray(refArray);
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void ShareArrays(vtkDataObject* dobj, vtkDataObject* reference)
+{
+  vtkCompositeDataSet* cds = vtkCompositeDataSet::SafeDownCast(dobj);
+  vtkCompositeDataSet* refCds = vtkCompositeDataSet::SafeDownCast(reference);
+  if (cds && refCds && cds->IsA(refCds->GetClassName()))
+  {
+    vtkSmartPointer<vtkCompositeDataIterator> iter;
+    iter.TakeReference(cds->NewIterator());
+    for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+    {
+      vtkDataSet* ds = vtkDataSet::SafeDownCast(iter->GetCurrentDataObject());
+      vtkDataSet* refDs = vtkDataSet::SafeDownCast(refCds->GetDataSet(iter));
+      if (ds && refDs)
+      {
+        ShareDataSetArrays(ds, refDs);
+      }
+    }
+  }
+  else if (vtkDataSet::SafeDownCast(dobj) && vtkDataSet::SafeDownCast(reference))
+  {
+    ShareDataSetArrays(vtkDataSet::SafeDownCast(dobj), vtkDataSet::SafeDownCast(reference));
+  }
+}
+}
+
 //------------------------------------------------------------------------------
 vtkStandardNewMacro(vtkTemporalDataSetCache);
 
@@ -52,6 +191,8 @@ vtkStandardNewMacro(vtkTemporalDataSetCache);
 vtkTemporalDataSetCache::vtkTemporalDataSetCache()
 {
   this->CacheSize = 10;
+  this->CacheMemoryLimit = 0;
+  this->ShareUnchangedArrays = false;
   this->SetNumberOfInputPorts(1);
   this->SetNumberOfOutputPorts(1);
   this->CacheInMemkind = false;
@@ -128,6 +269,8 @@ void vtkTemporalDataSetCache::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
 
   os << indent << "CacheSize: " << this->CacheSize << endl;
+  os << indent << "CacheMemoryLimit: " << this->CacheMemoryLimit << endl;
+  os << indent << "ShareUnchangedArrays: " << this->ShareUnchangedArrays << endl;
 }
 
 //------------------------------------------------------------------------------
@@ -440,36 +583,22 @@ int vtkTemporalDataSetCache::RequestData(vtkInformation* vtkNotUsed(request),
     CacheType::iterator pos1 = this->Cache.find(inTime);
     if (pos1 == this->Cache.end())
     {
-      // if we have room in the Cache then just add the new data
-      if (this->Cache.size() < static_cast<unsigned long>(this->CacheSize))
+      // if there is no room in the cache, we need to get rid of the oldest
+      // data in the cache, if there is old data
+      bool hasRoom = true;
+      while (hasRoom && this->Cache.size() >= static_cast<unsigned long>(this->CacheSize))
       {
-        this->ReplaceCacheItem(input, inTime, outputUpdateTime);
+        hasRoom = this->EjectOldestCacheItem(outputUpdateTime);
       }
-      // if there is no room in the cache, we need to get rid of something
-      else
+      if (hasRoom)
       {
-        // get rid of the oldest data in the cache
-        CacheType::iterator pos2 = this->Cache.begin();
-        CacheType::iterator oldestpos = this->Cache.begin();
-        for (; pos2 != this->Cache.end(); ++pos2)
-        {
-          if (pos2->second.first < oldestpos->second.first)
-          {
-            oldestpos = pos2;
-          }
-        }
-        // was there old data?
-        if (oldestpos->second.first < outputUpdateTime)
-        {
-          this->SetEjected(oldestpos->second.second);
-          oldestpos->second.second->UnRegister(this);
-          this->Cache.erase(oldestpos);
+        this->ReplaceCacheItem(input, inTime, outputUpdateTime);
 
-          this->ReplaceCacheItem(input, inTime, outputUpdateTime);
-        }
-        else
+        // then make room in memory, keeping at least the new data
+        while (this->CacheMemoryLimit > 0 && this->Cache.size() > 1 &&
+          this->GetCacheMemorySize() > this->CacheMemoryLimit &&
+          this->EjectOldestCacheItem(outputUpdateTime))
         {
-          // if no old data and no room then we are done
         }
       }
     }
@@ -493,9 +622,73 @@ void vtkTemporalDataSetCache::ReplaceCacheItem(
   {
     cachedData->DeepCopy(input);
   }
+
+  // share the unchanged arrays with the closest cached time step
+  if (this->ShareUnchangedArrays && !this->Cache.empty())
+  {
+    CacheType::iterator closest = this->Cache.begin();
+    for (CacheType::iterator pos = this->Cache.begin(); pos != this->Cache.end(); ++pos)
+    {
+      if (std::abs(pos->first - inTime) < std::abs(closest->first - inTime))
+      {
+        closest = pos;
+      }
+    }
+    ShareArrays(cachedData, closest->second.second);
+  }
+
   this->Cache[inTime] = std::pair<unsigned long, vtkDataObject*>(outputUpdateTime, cachedData);
 }
 
+//------------------------------------------------------------------------------
+bool vtkTemporalDataSetCache::EjectOldestCacheItem(vtkMTimeType outputUpdateTime)
+{
+  if (this->Cache.empty())
+  {
+    return false;
+  }
+  CacheType::iterator oldestpos = this->Cache.begin();
+  for (CacheType::iterator pos = this->Cache.begin(); pos != this->Cache.end(); ++pos)
+  {
+    if (pos->second.first < oldestpos->second.first)
+    {
+      oldestpos = pos;
+    }
+  }
+  // was there old data?
+  if (oldestpos->second.first >= outputUpdateTime)
+  {
+    return false;
+  }
+  this->SetEjected(oldestpos->second.second);
+  oldestpos->second.second->UnRegister(this);
+  this->Cache.erase(oldestpos);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+unsigned long vtkTemporalDataSetCache::GetCacheMemorySize()
+{
+  unsigned long size = 0;
+  std::set<vtkAbstractArray*> arrays;
+  for (const auto& item : this->Cache)
+  {
+    vtkDataObject* dobj = item.second.second;
+    size += dobj->GetActualMemorySize();
+
+    // do not count the arrays shared with other time steps twice
+    ForEachDataSet(dobj, [&](vtkDataSet* ds) {
+      ForEachArray(ds, [&](vtkAbstractArray* array) {
+        if (!arrays.insert(array).second)
+        {
+          size -= std::min(size, array->GetActualMemorySize());
+        }
+      });
+    });
+  }
+  return size;
+}
+
 //------------------------------------------------------------------------------
 void vtkTemporalDataSetCache::SetEjected(vtkDataObject* victim)
 {
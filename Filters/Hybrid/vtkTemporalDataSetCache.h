@@ -6,6 +6,13 @@
  *
  * vtkTemporalDataSetCache cache time step requests of a temporal dataset,
  * when cached data is requested it is returned using a shallow copy.
+ *
+ * The cache is limited by a number of time steps (CacheSize) and optionally
+ * by an amount of memory (CacheMemoryLimit). When either limit is reached,
+ * the least recently used time steps are removed from the cache. For data
+ * whose mesh or some arrays do not change over time, ShareUnchangedArrays
+ * makes the cached time steps share the unchanged points and arrays instead
+ * of storing a copy of them for every time step.
  * @par Thanks:
  * Ken Martin (Kitware) and John Bidiscombe of
  * CSCS - Swiss National Supercomputing Centre
@@ -42,6 +49,34 @@ public:
   vtkGetMacro(CacheSize, int);
   ///@}
 
+  ///@{
+  /**
+   * This is the maximum amount of memory, in kibibytes, that the cached time
+   * steps can use. Arrays shared between time steps are counted once. It
+   * defaults to 0, which means that the memory used is not limited.
+   */
+  vtkSetMacro(CacheMemoryLimit, unsigned long);
+  vtkGetMacro(CacheMemoryLimit, unsigned long);
+  ///@}
+
+  ///@{
+  /**
+   * When on, the points and the data arrays of a new cached time step that
+   * are equal to the ones of the closest cached time step are shared with it
+   * rather than copied. This reduces the memory used by the cache when the
+   * mesh or some arrays do not change over time. Off by default.
+   */
+  vtkSetMacro(ShareUnchangedArrays, bool);
+  vtkGetMacro(ShareUnchangedArrays, bool);
+  vtkBooleanMacro(ShareUnchangedArrays, bool);
+  ///@}
+
+  /**
+   * Return the memory, in kibibytes, used by the cached time steps. Arrays
+   * shared between time steps are counted once.
+   */
+  unsigned long GetCacheMemorySize();
+
   ///@{
   /**
    * Tells the filter that it should store the dataobjects it holds in memkind
@@ -67,6 +102,8 @@ protected:
   ~vtkTemporalDataSetCache() override;
 
   int CacheSize;
+  unsigned long CacheMemoryLimit;
+  bool ShareUnchangedArrays;
 
   typedef std::map<double, std::pair<unsigned long, vtkDataObject*>> CacheType;
   CacheType Cache;
@@ -95,6 +132,9 @@ private:
   void operator=(const vtkTemporalDataSetCache&) = delete;
 
   void ReplaceCacheItem(vtkDataObject* input, double inTime, vtkMTimeType outputUpdateTime);
+  // Remove the least recently used time step if it was used before
+  // outputUpdateTime. Return false if nothing was removed.
+  bool EjectOldestCacheItem(vtkMTimeType outputUpdateTime);
   bool CacheInMemkind;
   bool IsASource;
 
@@ -16,6 +16,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPointSet.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
@@ -402,7 +403,12 @@ vtkDataSet* vtkTemporalInterpolator ::InterpolateDataSet(
   vtkPointSet* inPointSet1 = vtkPointSet::SafeDownCast(input[0]);
   vtkPointSet* inPointSet2 = vtkPointSet::SafeDownCast(input[1]);
   vtkPointSet* outPointSet = vtkPointSet::SafeDownCast(output);
-  if (inPointSet1 && inPointSet2)
+  if (inPointSet1 && inPointSet2 && inPointSet1->GetPoints() &&
+    inPointSet1->GetPoints() == inPointSet2->GetPoints())
+  {
+    // static mesh: the points copied with the structure are shared
+  }
+  else if (inPointSet1 && inPointSet2)
   {
     vtkDataArray* outarray = nullptr;
     vtkPoints* outpoints;
@@ -576,10 +582,12 @@ struct vtkTemporalExecute
     auto in2 = vtk::DataArrayValueRange(input2);
     auto out = vtk::DataArrayValueRange(output);
 
-    for (vtkIdType i = 0; i < in1.size(); i++)
-    {
-      out[i] = static_cast<T>(in1[i] * oneMinusRatio + in2[i] * ratio);
-    }
+    vtkSMPTools::For(0, in1.size(), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; i++)
+      {
+        out[i] = static_cast<T>(in1[i] * oneMinusRatio + in2[i] * ratio);
+      }
+    });
   }
 };
 }
@@ -588,6 +596,15 @@ struct vtkTemporalExecute
 vtkDataArray* vtkTemporalInterpolator ::InterpolateDataArray(
   double ratio, vtkDataArray** arrays, vtkIdType numTuples)
 {
+  //
+  // An array shared by both time steps does not change, share it too
+  //
+  if (arrays[0] == arrays[1])
+  {
+    arrays[0]->Register(nullptr);
+    return arrays[0];
+  }
+
   //
   // Create the output
   //
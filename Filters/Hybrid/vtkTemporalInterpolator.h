@@ -26,6 +26,10 @@
  * will produce an irregular sequence of regular steps between
  * each of the original irregular steps (clear enough, yes?).
  *
+ * The points and arrays that are the same objects in both time steps, as
+ * for a static mesh, are shared with the output rather than interpolated.
+ * The other arrays are interpolated using vtkSMPTools.
+ *
  * @todo
  * Higher order interpolation schemes will require changes to the API
  * as most calls assume only two timesteps are used.
@@ -123,7 +127,8 @@ protected:
 
   /**
    * Interpolate a single vtkDataArray. Called from the Interpolation routine
-   * on the points and pointdata/celldata
+   * on the points and pointdata/celldata. When both time steps hold the same
+   * array, it is returned (with a new reference) instead of being interpolated.
    */
   virtual vtkDataArray* InterpolateDataArray(double ratio, vtkDataArray** arrays, vtkIdType N);
 
@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that vtkHyperTreeGridContour and vtkHyperTreeGridGeometry, which
+// process ranges of trees concurrently, produce the same output as their
+// serial execution.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDataArray.h"
+#include "vtkHyperTreeGrid.h"
+#include "vtkHyperTreeGridContour.h"
+#include "vtkHyperTreeGridGeometry.h"
+#include "vtkHyperTreeGridSource.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkTestUtilities.h"
+
+#include <cstdlib>
+
+namespace
+{
+// Compare the polygons and the "Depth" point or cell data of the outputs
+bool SameOutputs(vtkAlgorithm* filter, int association, const char* name)
+{
+  vtkNew<vtkPolyData> serial;
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ 1 }, [&]() {
+    filter->Modified();
+    filter->Update();
+  });
+  serial->DeepCopy(vtkPolyData::SafeDownCast(filter->GetOutputDataObject(0)));
+
+  filter->Modified();
+  filter->Update();
+  vtkPolyData* output = vtkPolyData::SafeDownCast(filter->GetOutputDataObject(0));
+
+  if (serial->GetNumberOfCells() == 0)
+  {
+    vtkLog(ERROR, "Empty output for " << name);
+    return false;
+  }
+  if (!vtkTestUtilities::CompareAbstractArray(
+        serial->GetPoints()->GetData(), output->GetPoints()->GetData()) ||
+    !vtkTestUtilities::CompareAbstractArray(
+      serial->GetPolys()->GetOffsetsArray(), output->GetPolys()->GetOffsetsArray()) ||
+    !vtkTestUtilities::CompareAbstractArray(
+      serial->GetPolys()->GetConnectivityArray(), output->GetPolys()->GetConnectivityArray()) ||
+    !vtkTestUtilities::CompareAbstractArray(serial->GetAttributes(association)->GetArray("Depth"),
+      output->GetAttributes(association)->GetArray("Depth")))
+  {
+    vtkLog(ERROR, "Threaded output differs from the serial one for " << name);
+    return false;
+  }
+  return true;
+}
+}
+
+int TestHyperTreeGridThreaded(int, char*[])
+{
+  vtkNew<vtkHyperTreeGridSource> htGrid;
+  htGrid->SetMaxDepth(5);
+  htGrid->SetDimensions(4, 4, 3);
+  htGrid->SetGridScale(1.5, 1., .7);
+  htGrid->SetBranchFactor(2);
+  htGrid->SetDescriptor(
+    "RRR .R. .RR ..R ..R .R.|R....... ........ ........ ...R.... .RRRR.R. RRRRR.RR ........ "
+    "........ ........|........ ........ ........ RR.RR.RR ........ RR...... ........ ........ "
+    "........ ........ ........ ........ ........ ..RRR...|........ ..R..... ........ ........ "
+    "........ ........ ........ ........ ........ ........ ........|........");
+  htGrid->Update();
+  vtkHyperTreeGrid* htg = vtkHyperTreeGrid::SafeDownCast(htGrid->GetOutput());
+  htg->GetCellData()->SetScalars(htg->GetCellData()->GetArray("Depth"));
+
+  vtkNew<vtkHyperTreeGridContour> contour;
+  contour->SetInputConnection(htGrid->GetOutputPort());
+  contour->SetNumberOfContours(3);
+  contour->SetValue(0, 1.2);
+  contour->SetValue(1, 2.2);
+  contour->SetValue(2, 3.2);
+  if (!SameOutputs(contour, vtkDataObject::POINT, "contour"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkHyperTreeGridGeometry> geometry;
+  geometry->SetInputConnection(htGrid->GetOutputPort());
+  if (!SameOutputs(geometry, vtkDataObject::CELL, "geometry"))
+  {
+    return EXIT_FAILURE;
+  }
+  geometry->SetMerging(true);
+  if (!SameOutputs(geometry, vtkDataObject::CELL, "merged geometry"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
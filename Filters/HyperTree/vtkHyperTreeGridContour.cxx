@@ -6,6 +6,7 @@
 #include "vtkArrayDispatch.h"
 #include "vtkBitArray.h"
 #include "vtkCellArray.h"
+#include "vtkCellArrayIterator.h"
 #include "vtkCellData.h"
 #include "vtkCellIterator.h"
 #include "vtkCompositeArray.h"
@@ -18,6 +19,8 @@
 #include "vtkHyperTreeGridNonOrientedCursor.h"
 #include "vtkHyperTreeGridNonOrientedGeometryCursor.h"
 #include "vtkHyperTreeGridNonOrientedMooreSuperCursor.h"
+#include "vtkHyperTreeGridScales.h"
+#include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
 #include "vtkIncrementalPointLocator.h"
 #include "vtkIndexedArray.h"
@@ -29,15 +32,19 @@
 #include "vtkObjectFactory.h"
 #include "vtkPixel.h"
 #include "vtkPointData.h"
+#include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkPolyhedron.h"
 #include "vtkPolyhedronUtilities.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 #include "vtkVoxel.h"
 
 #include <algorithm>
 #include <memory>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 
@@ -253,11 +260,52 @@ void ReplaceWithIndexedArray(const std::string& contourArrayName, vtkContourValu
     vtkErrorWithObjectMacro(nullptr, "Unable to dispatch the contour array " << contourArrayName);
   }
 }
+
+// Append the cells of src to dst, renumbering their points with pointMap
+void AppendCells(vtkCellArray* dst, vtkCellArray* src, const std::vector<vtkIdType>& pointMap)
+{
+  vtkIdType npts;
+  const vtkIdType* pts;
+  std::vector<vtkIdType> ids;
+  auto iter = vtk::TakeSmartPointer(src->NewIterator());
+  for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal(); iter->GoToNextCell())
+  {
+    iter->GetCurrentCell(npts, pts);
+    ids.resize(npts);
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      ids[i] = pointMap[pts[i]];
+    }
+    dst->InsertNextCell(npts, ids.data());
+  }
+}
 }
 
 //------------------------------------------------------------------------------
-struct vtkHyperTreeGridContour::vtkInternals
+struct vtkHyperTreeGridContour::vtkLocalData
 {
+  // Cursor used to traverse the trees of the range
+  vtkNew<vtkHyperTreeGridNonOrientedMooreSuperCursor> SuperCursor;
+
+  // Output of the range, and locator merging its points
+  vtkSmartPointer<vtkIncrementalPointLocator> Locator;
+  vtkSmartPointer<vtkPoints> Points;
+  vtkSmartPointer<vtkCellArray> Verts;
+  vtkSmartPointer<vtkCellArray> Lines;
+  vtkSmartPointer<vtkCellArray> Polys;
+  vtkSmartPointer<vtkPointData> OutPointData;
+
+  // Structures for isocontouring
+  std::unique_ptr<vtkContourHelper> Helper;
+  vtkSmartPointer<vtkDataArray> CellScalars;
+  vtkNew<vtkLine> Line;
+  vtkNew<vtkPixel> Pixel;
+  vtkNew<vtkVoxel> Voxel;
+  vtkNew<vtkIdList> Leaves;
+
+  // Keep track of current index in output polydata
+  vtkIdType CurrentId = 0;
+
   // Temporary data structures related to USE_DECOMPOSED_POLYHEDRA strategy
   std::vector<vtkIdType> Faces;
   vtkNew<vtkPolyhedron> Polyhedron;
@@ -270,7 +318,6 @@ vtkStandardNewMacro(vtkHyperTreeGridContour);
 
 //------------------------------------------------------------------------------
 vtkHyperTreeGridContour::vtkHyperTreeGridContour()
-  : Internals(new vtkHyperTreeGridContour::vtkInternals())
 {
   // Initialize storage for contour values
   this->ContourValues = vtkContourValues::New();
@@ -283,17 +330,6 @@ vtkHyperTreeGridContour::vtkHyperTreeGridContour()
 
   // Initialize per-cell quantities of interest
   this->CellSigns = nullptr;
-  this->CellScalars = nullptr;
-
-  // Initialize structures for isocontouring
-  this->Helper = nullptr;
-  this->Leaves = vtkIdList::New();
-  this->Line = vtkLine::New();
-  this->Pixel = vtkPixel::New();
-  this->Voxel = vtkVoxel::New();
-
-  // Output indices begin at 0
-  this->CurrentId = 0;
 
   // Process active point scalars by default
   this->SetInputArrayToProcess(
@@ -301,11 +337,6 @@ vtkHyperTreeGridContour::vtkHyperTreeGridContour()
 
   // Input scalars point to null by default
   this->InScalars = nullptr;
-
-  // Initialize temporal structures related to USE_DECOMPOSED_POLYHEDRA strategy
-  this->Internals->Polyhedron->GetPointIds()->SetNumberOfIds(::POLY_POINTS_NB);
-  this->Internals->Polyhedron->GetPoints()->SetNumberOfPoints(::POLY_POINTS_NB);
-  this->Internals->Faces.reserve(::POLY_FACES_SIZE);
 }
 
 //------------------------------------------------------------------------------
@@ -322,30 +353,6 @@ vtkHyperTreeGridContour::~vtkHyperTreeGridContour()
     this->Locator->Delete();
     this->Locator = nullptr;
   }
-
-  if (this->Line)
-  {
-    this->Line->Delete();
-    this->Line = nullptr;
-  }
-
-  if (this->Pixel)
-  {
-    this->Pixel->Delete();
-    this->Pixel = nullptr;
-  }
-
-  if (this->Voxel)
-  {
-    this->Voxel->Delete();
-    this->Voxel = nullptr;
-  }
-
-  if (this->Leaves)
-  {
-    this->Leaves->Delete();
-    this->Leaves = nullptr;
-  }
 }
 
 //------------------------------------------------------------------------------
@@ -355,8 +362,6 @@ void vtkHyperTreeGridContour::PrintSelf(ostream& os, vtkIndent indent)
 
   this->ContourValues->PrintSelf(os, indent.GetNextIndent());
 
-  os << indent << "CurrentId: " << this->CurrentId << endl;
-
   if (this->InScalars)
   {
     os << indent << "InScalars:\n";
@@ -376,41 +381,8 @@ void vtkHyperTreeGridContour::PrintSelf(ostream& os, vtkIndent indent)
     os << indent << "Locator: (none)\n";
   }
 
-  if (this->Line)
-  {
-    os << indent << ": " << this->Line << "\n";
-  }
-  else
-  {
-    os << indent << ": (none)\n";
-  }
-
-  if (this->Pixel)
-  {
-    os << indent << ": " << this->Pixel << "\n";
-  }
-  else
-  {
-    os << indent << ": (none)\n";
-  }
-
-  if (this->Voxel)
-  {
-    os << indent << ": " << this->Voxel << "\n";
-  }
-  else
-  {
-    os << indent << ": (none)\n";
-  }
-
-  if (this->Leaves)
-  {
-    os << indent << ": " << this->Leaves << "\n";
-  }
-  else
-  {
-    os << indent << ": (none)\n";
-  }
+  os << indent << "Strategy3D: " << this->Strategy3D << endl;
+  os << indent << "UseImplicitArrays: " << this->UseImplicitArrays << endl;
 }
 
 //------------------------------------------------------------------------------
@@ -503,9 +475,6 @@ int vtkHyperTreeGridContour::ProcessTrees(vtkHyperTreeGrid* input, vtkDataObject
   this->OutData = output->GetPointData();
   this->OutData->CopyAllocate(this->InData);
 
-  // Output indices begin at 0
-  this->CurrentId = 0;
-
   // Retrieve material mask
   this->InMask = input->HasMask() ? input->GetMask() : nullptr;
 
@@ -524,7 +493,7 @@ int vtkHyperTreeGridContour::ProcessTrees(vtkHyperTreeGrid* input, vtkDataObject
   }
 
   // Create storage for output points
-  vtkPoints* newPts = vtkPoints::New();
+  vtkNew<vtkPoints> newPts;
   newPts->Allocate(estimatedSize, estimatedSize);
 
   // Create storage for output vertices
@@ -539,11 +508,6 @@ int vtkHyperTreeGridContour::ProcessTrees(vtkHyperTreeGrid* input, vtkDataObject
   vtkNew<vtkCellArray> newPolys;
   newPolys->AllocateExact(estimatedSize, estimatedSize);
 
-  // Create storage for output scalar values
-  this->CellScalars = this->InScalars->NewInstance();
-  this->CellScalars->SetNumberOfComponents(this->InScalars->GetNumberOfComponents());
-  this->CellScalars->Allocate(this->CellScalars->GetNumberOfComponents() * 8);
-
   // Initialize point locator
   if (!this->Locator)
   {
@@ -557,10 +521,6 @@ int vtkHyperTreeGridContour::ProcessTrees(vtkHyperTreeGrid* input, vtkDataObject
   vtkNew<vtkPointData> dualPointData;
   dualPointData->PassData(input->GetCellData());
 
-  // Instantiate a contour helper for convenience, with triangle generation on
-  this->Helper = new vtkContourHelper(this->Locator, newVerts, newLines, newPolys, dualPointData,
-    nullptr, output->GetPointData(), nullptr, estimatedSize, true);
-
   // Create storage to keep track of selected cells
   this->SelectedCells = vtkBitArray::New();
   this->SelectedCells->SetNumberOfTuples(numCells);
@@ -576,6 +536,7 @@ int vtkHyperTreeGridContour::ProcessTrees(vtkHyperTreeGrid* input, vtkDataObject
   }
 
   // First pass across tree roots to evince cells intersected by contours
+  std::vector<vtkIdType> treeIds;
   vtkIdType index;
   vtkHyperTreeGrid::vtkHyperTreeGridIterator it;
   input->InitializeTreeIterator(it);
@@ -590,22 +551,125 @@ int vtkHyperTreeGridContour::ProcessTrees(vtkHyperTreeGrid* input, vtkDataObject
     input->InitializeNonOrientedCursor(cursor, index);
     // Pre-process tree recursively
     this->RecursivelyPreProcessTree(cursor);
+    treeIds.push_back(index);
+
+    // Cell scales are computed lazily and may be shared by the trees,
+    // compute them for all levels before the trees are contoured concurrently
+    vtkHyperTree* tree = cursor->GetTree();
+    if (tree && tree->HasScales())
+    {
+      tree->GetScales()->GetScale(input->GetNumberOfLevels());
+    }
   } // it
 
+  // Split the trees into ranges contoured concurrently. Each range has its own
+  // output, merged afterwards. A single range writes directly into the output.
+  const vtkIdType numTrees = static_cast<vtkIdType>(treeIds.size());
+  const vtkIdType numThreads = vtkSMPTools::GetEstimatedNumberOfThreads();
+  const vtkIdType numRanges =
+    std::max<vtkIdType>(1, numThreads > 1 ? std::min(numTrees, 4 * numThreads) : 1);
+  std::vector<vtkLocalData> localData(numRanges);
+  for (vtkLocalData& local : localData)
+  {
+    if (numRanges == 1)
+    {
+      local.Locator = this->Locator;
+      local.Points = newPts;
+      local.Verts = newVerts;
+      local.Lines = newLines;
+      local.Polys = newPolys;
+      local.OutPointData = output->GetPointData();
+    }
+    else
+    {
+      const vtkIdType localSize = std::max<vtkIdType>(1024, estimatedSize / numRanges);
+      local.Points = vtkSmartPointer<vtkPoints>::New();
+      local.Points->Allocate(localSize, localSize);
+      local.Locator = vtk::TakeSmartPointer(this->Locator->NewInstance());
+      local.Locator->SetTolerance(this->Locator->GetTolerance());
+      local.Locator->InitPointInsertion(local.Points, input->GetBounds(), localSize);
+      local.Verts = vtkSmartPointer<vtkCellArray>::New();
+      local.Lines = vtkSmartPointer<vtkCellArray>::New();
+      local.Polys = vtkSmartPointer<vtkCellArray>::New();
+      local.OutPointData = vtkSmartPointer<vtkPointData>::New();
+      local.OutPointData->CopyAllocate(this->InData, localSize);
+    }
+
+    // Instantiate a contour helper for convenience, with triangle generation on.
+    // The helpers are created here since they keep weak references to the
+    // dual point data, which cannot be registered concurrently.
+    local.Helper.reset(new vtkContourHelper(local.Locator, local.Verts, local.Lines, local.Polys,
+      dualPointData, nullptr, local.OutPointData, nullptr, estimatedSize, true));
+
+    // Create storage for output scalar values
+    local.CellScalars = vtk::TakeSmartPointer(this->InScalars->NewInstance());
+    local.CellScalars->SetNumberOfComponents(this->InScalars->GetNumberOfComponents());
+    local.CellScalars->SetNumberOfTuples(8);
+
+    // Initialize temporal structures related to USE_DECOMPOSED_POLYHEDRA strategy
+    local.Polyhedron->GetPointIds()->SetNumberOfIds(::POLY_POINTS_NB);
+    local.Polyhedron->GetPoints()->SetNumberOfPoints(::POLY_POINTS_NB);
+    local.Faces.reserve(::POLY_FACES_SIZE);
+  }
+
   // Second pass across tree roots: now compute isocontours recursively
-  input->InitializeTreeIterator(it);
-  vtkNew<vtkHyperTreeGridNonOrientedMooreSuperCursor> supercursor;
-  while (it.GetNextTree(index))
+  vtkSMPTools::For(0, numRanges, 1, [&](vtkIdType beginRange, vtkIdType endRange) {
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (vtkIdType range = beginRange; range < endRange; ++range)
+    {
+      vtkLocalData& local = localData[range];
+      const vtkIdType endTree = (range + 1) * numTrees / numRanges;
+      for (vtkIdType treeNum = range * numTrees / numRanges; treeNum < endTree; ++treeNum)
+      {
+        if (isFirst)
+        {
+          this->CheckAbort();
+        }
+        if (this->GetAbortOutput())
+        {
+          return;
+        }
+        // Initialize new Moore cursor at root of current tree
+        input->InitializeNonOrientedMooreSuperCursor(local.SuperCursor, treeIds[treeNum]);
+        // Compute contours recursively
+        this->RecursivelyProcessTree(local.SuperCursor, local, dualPointData);
+      }
+    }
+  });
+
+  // Merge the outputs of the ranges in order, so that the points and cells are
+  // numbered as if the trees had been contoured serially
+  if (numRanges > 1)
   {
-    if (this->CheckAbort())
+    vtkNew<vtkIdList> srcIds;
+    vtkNew<vtkIdList> dstIds;
+    std::vector<vtkIdType> pointMap;
+    for (vtkLocalData& local : localData)
     {
-      break;
+      const vtkIdType numPts = local.Points->GetNumberOfPoints();
+      pointMap.resize(numPts);
+      srcIds->Reset();
+      dstIds->Reset();
+      double x[3];
+      for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+      {
+        local.Points->GetPoint(ptId, x);
+        if (this->Locator->InsertUniquePoint(x, pointMap[ptId]))
+        {
+          srcIds->InsertNextId(ptId);
+          dstIds->InsertNextId(pointMap[ptId]);
+        }
+      }
+      for (int arrayIdx = 0; arrayIdx < this->OutData->GetNumberOfArrays(); ++arrayIdx)
+      {
+        this->OutData->GetAbstractArray(arrayIdx)->InsertTuples(
+          dstIds, srcIds, local.OutPointData->GetAbstractArray(arrayIdx));
+      }
+      ::AppendCells(newVerts, local.Verts, pointMap);
+      ::AppendCells(newLines, local.Lines, pointMap);
+      ::AppendCells(newPolys, local.Polys, pointMap);
     }
-    // Initialize new Moore cursor at root of current tree
-    input->InitializeNonOrientedMooreSuperCursor(supercursor, index);
-    // Compute contours recursively
-    this->RecursivelyProcessTree(supercursor, newVerts, newLines, newPolys, dualPointData);
-  } // it
+  }
 
   // Set output
   output->SetPoints(newPts);
@@ -639,9 +703,6 @@ int vtkHyperTreeGridContour::ProcessTrees(vtkHyperTreeGrid* input, vtkDataObject
     }
   } // c
   free(this->CellSigns);
-  delete this->Helper;
-  this->CellScalars->Delete();
-  newPts->Delete();
   this->Locator->Initialize();
 
   // Squeeze output
@@ -743,13 +804,14 @@ bool vtkHyperTreeGridContour::RecursivelyPreProcessTree(vtkHyperTreeGridNonOrien
 
 //------------------------------------------------------------------------------
 void vtkHyperTreeGridContour::RecursivelyProcessTree(
-  vtkHyperTreeGridNonOrientedMooreSuperCursor* supercursor, vtkCellArray* newVerts,
-  vtkCellArray* newLines, vtkCellArray* newPolys, vtkPointData* inPd)
+  vtkHyperTreeGridNonOrientedMooreSuperCursor* supercursor, vtkLocalData& local,
+  vtkPointData* inPd)
 {
   // Retrieve global index of input cursor
   vtkIdType id = supercursor->GetGlobalNodeIndex();
 
-  if (this->InGhostArray && this->InGhostArray->GetTuple1(id))
+  // The arrays are read with GetValue, that is safe to call concurrently
+  if (this->InGhostArray && this->InGhostArray->GetValue(id))
   {
     return;
   }
@@ -760,13 +822,13 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
   if (!supercursor->IsLeaf())
   {
     // Selected cells are determined in RecursivelyPreProcessTree
-    bool selected = (this->SelectedCells->GetTuple1(id) == 1.0);
+    bool selected = this->SelectedCells->GetValue(id) != 0;
 
     // Iterate over contours
     for (vtkIdType c = 0; c < this->ContourValues->GetNumberOfContours() && !selected; ++c)
     {
       // Retrieve sign with respect to contour value at current cursor
-      bool sign = (this->CellSigns[c]->GetTuple1(id) != 0.0);
+      bool sign = this->CellSigns[c]->GetValue(id) != 0;
 
       // Iterate over all cursors of Moore neighborhood around center
       unsigned int nn = supercursor->GetNumberOfCursors() - 1;
@@ -779,9 +841,9 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
           vtkIdType idN = supercursor->GetGlobalNodeIndex(icursorN);
 
           // Decide whether neighbor was selected or must be retained because of a sign change
-          selected = this->SelectedCells->GetTuple1(idN) == 1 ||
-            ((this->CellSigns[c]->GetTuple1(idN) != 0.0) != sign) ||
-            (this->InGhostArray && this->InGhostArray->GetTuple1(idN));
+          selected = this->SelectedCells->GetValue(idN) != 0 ||
+            ((this->CellSigns[c]->GetValue(idN) != 0) != sign) ||
+            (this->InGhostArray && this->InGhostArray->GetValue(idN));
         }
         else
         {
@@ -799,24 +861,24 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
         // Create child cursor from parent in input grid
         supercursor->ToChild(child);
         // Recurse
-        this->RecursivelyProcessTree(supercursor, newVerts, newLines, newPolys, inPd);
+        this->RecursivelyProcessTree(supercursor, local, inPd);
         supercursor->ToParent();
       }
     }
   }
-  else if ((!this->InMask || !this->InMask->GetTuple1(id)))
+  else if (!this->InMask || !this->InMask->GetValue(id))
   {
     // Cell is not masked, iterate over its corners
     unsigned int numLeavesCorners = 1 << dim;
     for (unsigned int cornerIdx = 0; cornerIdx < numLeavesCorners; ++cornerIdx)
     {
       bool owner = true;
-      this->Leaves->SetNumberOfIds(numLeavesCorners);
+      local.Leaves->SetNumberOfIds(numLeavesCorners);
 
       // Iterate over every leaf touching the corner and check ownership
       for (unsigned int leafIdx = 0; leafIdx < numLeavesCorners && owner; ++leafIdx)
       {
-        owner = supercursor->GetCornerCursors(cornerIdx, leafIdx, this->Leaves);
+        owner = supercursor->GetCornerCursors(cornerIdx, leafIdx, local.Leaves);
       } // leafIdx
 
       // If cell owns dual cell, compute contours thereof
@@ -834,13 +896,13 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
         switch (dim)
         {
           case 1:
-            cell = this->Line;
+            cell = local.Line;
             break;
           case 2:
-            cell = this->Pixel;
+            cell = local.Pixel;
             break;
           case 3:
-            cell = this->Voxel;
+            cell = local.Voxel;
             break;
           default:
             vtkErrorMacro("Unsupported cell dimension had been encountered (must be 1, 2 or 3).");
@@ -854,7 +916,7 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
         for (unsigned int _cornerIdx = 0; _cornerIdx < numLeavesCorners; ++_cornerIdx)
         {
           // Get cursor corresponding to this corner
-          vtkIdType cursorId = this->Leaves->GetId(_cornerIdx);
+          vtkIdType cursorId = local.Leaves->GetId(_cornerIdx);
 
           // Retrieve neighbor coordinates and store them
           supercursor->GetPoint(cursorId, x);
@@ -865,7 +927,7 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
           cell->PointIds->SetId(_cornerIdx, idN);
 
           // Assign scalar value attached to this contour item
-          this->CellScalars->SetTuple(_cornerIdx, this->InScalars->GetTuple(idN));
+          local.CellScalars->SetTuple(_cornerIdx, idN, this->InScalars);
         } // cornerIdx
 
         /* If we are in 3D and the contour strategy is set to USE_DECOMPOSED_POLYHEDRA,
@@ -882,35 +944,28 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
           // Insert points and global point IDs
           for (int i = 0; i < ::POLY_POINTS_NB; ++i)
           {
-            this->Internals->Polyhedron->GetPointIds()->SetId(i, cell->GetPointId(i));
-            this->Internals->Polyhedron->GetPoints()->SetPoint(i, cell->GetPoints()->GetPoint(i));
+            local.Polyhedron->GetPointIds()->SetId(i, cell->GetPointId(i));
+            local.Polyhedron->GetPoints()->SetPoint(i, cell->GetPoints()->GetPoint(i));
           }
 
           // Construct faces from voxel point ids (global ids)
-          this->Internals->Faces.clear();
-          this->Internals->Faces.emplace_back(::POLY_FACES_NB);
+          local.Faces.clear();
+          local.Faces.emplace_back(::POLY_FACES_NB);
           for (int faceId = 0, canonicalId = 0; faceId < ::POLY_FACES_NB; faceId++)
           {
-            this->Internals->Faces.emplace_back(::POLY_FACES_POINTS_NB);
+            local.Faces.emplace_back(::POLY_FACES_POINTS_NB);
             for (int i = 0; i < ::POLY_FACES_POINTS_NB; i++, canonicalId++)
             {
-              this->Internals->Faces.emplace_back(cell->GetPointId(::CANONICAL_FACES[canonicalId]));
+              local.Faces.emplace_back(cell->GetPointId(::CANONICAL_FACES[canonicalId]));
             }
           }
 
-          this->Internals->Polyhedron->SetFaces(this->Internals->Faces.data());
-          this->Internals->Polyhedron->Initialize();
-
-          // Decompose the this->Internals->Polyhedron
-          auto resultUG = vtkPolyhedronUtilities::Decompose(
-            this->Internals->Polyhedron, inPd, this->CurrentId, nullptr);
+          local.Polyhedron->SetFaces(local.Faces.data());
+          local.Polyhedron->Initialize();
 
-          auto outPointData = vtkPointData::SafeDownCast(this->OutData);
-          if (!outPointData)
-          {
-            vtkErrorMacro("Unable to retrieve the output point data.");
-            return;
-          }
+          // Decompose the polyhedron
+          auto resultUG =
+            vtkPolyhedronUtilities::Decompose(local.Polyhedron, inPd, local.CurrentId, nullptr);
 
           /* Estimated size: estimated number of generated triangles (before merging them).
            * Only used in that case. Unused here because we choose to output triangles.
@@ -921,8 +976,8 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
            * Needed because we have to change the input point data (now indexed on resultUG point
            * ids)
            */
-          vtkContourHelper helper(this->Locator, newVerts, newLines, newPolys,
-            resultUG->GetPointData(), nullptr, outPointData, nullptr, estimatedSize, true);
+          vtkContourHelper helper(local.Locator, local.Verts, local.Lines, local.Polys,
+            resultUG->GetPointData(), nullptr, local.OutPointData, nullptr, estimatedSize, true);
 
           // Retrieve the contouring array in the resultUG
           auto contourScalars = resultUG->GetPointData()->GetArray(this->InScalars->GetName());
@@ -941,18 +996,18 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
             iter.TakeReference(resultUG->NewCellIterator());
             for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextCell())
             {
-              iter->GetCell(this->Internals->Tetra);
+              iter->GetCell(local.Tetra);
 
               // Scalars used for contouring need to be indexed on tetrahedron local ids
-              this->Internals->TetraScalars->Reset();
-              this->Internals->TetraScalars->SetNumberOfComponents(
+              local.TetraScalars->Reset();
+              local.TetraScalars->SetNumberOfComponents(
                 contourScalars->GetNumberOfComponents());
-              this->Internals->TetraScalars->SetNumberOfTuples(iter->GetNumberOfPoints());
-              contourScalars->GetTuples(iter->GetPointIds(), this->Internals->TetraScalars);
+              local.TetraScalars->SetNumberOfTuples(iter->GetNumberOfPoints());
+              contourScalars->GetTuples(iter->GetPointIds(), local.TetraScalars);
 
               vtkIdType cellId = iter->GetCellId();
               helper.Contour(
-                this->Internals->Tetra, values[c], this->Internals->TetraScalars, cellId);
+                local.Tetra, values[c], local.TetraScalars, cellId);
             }
           }
         }
@@ -961,12 +1016,12 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
           // Compute cell isocontour for each isovalue
           for (int c = 0; c < numContours; ++c)
           {
-            this->Helper->Contour(cell, values[c], this->CellScalars, this->CurrentId);
+            local.Helper->Contour(cell, values[c], local.CellScalars, local.CurrentId);
           }
         }
 
         // Increment output cell counter
-        ++this->CurrentId;
+        ++local.CurrentId;
       } // if ( owner )
     }   // cornerIdx
   }     // else if ( ! this->InMask || this->InMask->GetTuple1( id ) )
@@ -11,6 +11,11 @@
  * value for the active scalar is within a specified range (inclusive).
  * The output remains a hyper tree grid.
  *
+ * The trees are contoured concurrently using vtkSMPTools, each thread
+ * contouring a range of trees with its own cursor, locator and output. The
+ * outputs of the ranges are then merged in tree order, so that the result
+ * does not depend on the number of threads.
+ *
  * @sa
  * vtkHyperTreeGrid vtkHyperTreeGridAlgorithm vtkContourFilter
  *
@@ -37,15 +42,10 @@
 VTK_ABI_NAMESPACE_BEGIN
 class vtkBitArray;
 class vtkCellData;
-class vtkContourHelper;
 class vtkDataArray;
 class vtkHyperTreeGrid;
-class vtkIdList;
 class vtkIncrementalPointLocator;
-class vtkLine;
-class vtkPixel;
 class vtkUnsignedCharArray;
-class vtkVoxel;
 class vtkHyperTreeGridNonOrientedCursor;
 class vtkHyperTreeGridNonOrientedMooreSuperCursor;
 
@@ -139,13 +139,19 @@ protected:
    */
   bool RecursivelyPreProcessTree(vtkHyperTreeGridNonOrientedCursor*);
 
+  /**
+   * Cursor, temporary cells and output used to contour a range of trees.
+   * Defined in the implementation file.
+   */
+  struct vtkLocalData;
+
   /**
    * Recursively descend into the tree down to the leaves to construct the contour (verts, lines,
-   * polys). dualPointData represents the point data of the dual mesh, i.e. HTG cell data used for
-   * contouring.
+   * polys) in the output of the given local data. dualPointData represents the point data of the
+   * dual mesh, i.e. HTG cell data used for contouring.
    */
-  void RecursivelyProcessTree(vtkHyperTreeGridNonOrientedMooreSuperCursor*, vtkCellArray* verts,
-    vtkCellArray* lines, vtkCellArray* polys, vtkPointData* dualPointData);
+  void RecursivelyProcessTree(vtkHyperTreeGridNonOrientedMooreSuperCursor*, vtkLocalData& local,
+    vtkPointData* dualPointData);
 
   /**
    * Storage for contour values.
@@ -167,28 +173,11 @@ protected:
    */
   vtkIncrementalPointLocator* Locator;
 
-  ///@{
-  /**
-   * Pointers needed to perform isocontouring
-   */
-  vtkContourHelper* Helper;
-  vtkDataArray* CellScalars;
-  vtkLine* Line;
-  vtkPixel* Pixel;
-  vtkVoxel* Voxel;
-  vtkIdList* Leaves;
-  ///@}
-
   /**
    * Storage for signs relative to current contour value
    */
   std::vector<bool> Signs;
 
-  /**
-   * Keep track of current index in output polydata
-   */
-  vtkIdType CurrentId;
-
   /**
    * Keep track of selected input scalars
    */
@@ -206,9 +195,6 @@ private:
 
   // Use implicit arrays to store contour values
   bool UseImplicitArrays = false;
-
-  struct vtkInternals;
-  std::unique_ptr<vtkInternals> Internals;
 };
 
 /**
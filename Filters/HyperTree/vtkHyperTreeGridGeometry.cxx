@@ -2,23 +2,116 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkHyperTreeGridGeometry.h"
 #include "vtkCellArray.h"
+#include "vtkCellArrayIterator.h"
 #include "vtkCellData.h"
 #include "vtkDataSetAttributes.h"
+#include "vtkHyperTree.h"
 #include "vtkHyperTreeGrid.h"
 #include "vtkHyperTreeGridGeometry1DImpl.h"
 #include "vtkHyperTreeGridGeometry2DImpl.h"
 #include "vtkHyperTreeGridGeometry3DImpl.h"
 #include "vtkHyperTreeGridGeometryImpl.h"
+#include "vtkHyperTreeGridScales.h"
 #include "vtkInformation.h"
+#include "vtkMergePoints.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 
+namespace
+{
+// Output of a range of trees, generated concurrently with the other ranges
+struct RangeOutput
+{
+  vtkNew<vtkPoints> Points;
+  vtkNew<vtkCellArray> Cells;
+  vtkNew<vtkCellData> CellData;
+  std::unique_ptr<vtkHyperTreeGridGeometryImpl> Implementation;
+};
+
+// Append the outputs of the ranges in order, so that the points and cells are
+// numbered as if the trees had been processed serially. Coincident points are
+// merged again when merging is on, since each range only merged its own points.
+void MergeRanges(std::vector<RangeOutput>& ranges, bool merging, const double bounds[6],
+  vtkPoints* outPoints, vtkCellArray* outCells, vtkDataSetAttributes* outCellData)
+{
+  // Cell data: the arrays of all ranges are created in the same order
+  vtkIdType numCells = 0;
+  for (RangeOutput& range : ranges)
+  {
+    numCells += range.Cells->GetNumberOfCells();
+  }
+  outCellData->ShallowCopy(ranges[0].CellData);
+  for (int arrayIdx = 0; arrayIdx < outCellData->GetNumberOfArrays(); ++arrayIdx)
+  {
+    vtkAbstractArray* array = outCellData->GetAbstractArray(arrayIdx);
+    array->Resize(numCells);
+    vtkIdType cellOffset = ranges[0].Cells->GetNumberOfCells();
+    for (std::size_t rangeIdx = 1; rangeIdx < ranges.size(); ++rangeIdx)
+    {
+      const vtkIdType rangeNumCells = ranges[rangeIdx].Cells->GetNumberOfCells();
+      array->InsertTuples(
+        cellOffset, rangeNumCells, 0, ranges[rangeIdx].CellData->GetAbstractArray(arrayIdx));
+      cellOffset += rangeNumCells;
+    }
+  }
+
+  if (!merging)
+  {
+    // Points and cells are appended, the point ids being offset
+    vtkIdType numPoints = 0;
+    for (RangeOutput& range : ranges)
+    {
+      numPoints += range.Points->GetNumberOfPoints();
+    }
+    outPoints->SetNumberOfPoints(numPoints);
+    vtkIdType pointOffset = 0;
+    for (RangeOutput& range : ranges)
+    {
+      const vtkIdType rangeNumPoints = range.Points->GetNumberOfPoints();
+      outPoints->GetData()->InsertTuples(pointOffset, rangeNumPoints, 0, range.Points->GetData());
+      outCells->Append(range.Cells, pointOffset);
+      pointOffset += rangeNumPoints;
+    }
+    return;
+  }
+
+  vtkNew<vtkMergePoints> locator;
+  locator->InitPointInsertion(outPoints, bounds);
+  std::vector<vtkIdType> pointMap;
+  std::vector<vtkIdType> cellPointIds;
+  for (RangeOutput& range : ranges)
+  {
+    pointMap.resize(range.Points->GetNumberOfPoints());
+    double x[3];
+    for (vtkIdType ptId = 0; ptId < range.Points->GetNumberOfPoints(); ++ptId)
+    {
+      range.Points->GetPoint(ptId, x);
+      locator->InsertUniquePoint(x, pointMap[ptId]);
+    }
+
+    vtkIdType npts;
+    const vtkIdType* pts;
+    auto iter = vtk::TakeSmartPointer(range.Cells->NewIterator());
+    for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal(); iter->GoToNextCell())
+    {
+      iter->GetCurrentCell(npts, pts);
+      cellPointIds.resize(npts);
+      std::transform(
+        pts, pts + npts, cellPointIds.begin(), [&](vtkIdType ptId) { return pointMap[ptId]; });
+      outCells->InsertNextCell(npts, cellPointIds.data());
+    }
+  }
+}
+}
+
 //------------------------------------------------------------------------------
 vtkStandardNewMacro(vtkHyperTreeGridGeometry);
 
@@ -58,36 +151,87 @@ int vtkHyperTreeGridGeometry::ProcessTrees(vtkHyperTreeGrid* input, vtkDataObjec
   this->OutData = output->GetCellData();
   this->OutData->CopyAllocate(this->InData);
 
+  if (dimension < 1 || dimension > 3)
+  {
+    vtkErrorMacro("Incorrect dimension of input: " << dimension);
+    return 0;
+  }
+
   vtkNew<vtkPoints> outPoints;
   vtkNew<vtkCellArray> outCells;
 
-  std::unique_ptr<vtkHyperTreeGridGeometryImpl> implementation;
-
   // Create a custom internal class depending on the dimension of the input HTG.
-  switch (dimension)
+  auto createImplementation = [&](vtkPoints* points, vtkCellArray* cells,
+                                vtkDataSetAttributes* cellData)
+    -> std::unique_ptr<vtkHyperTreeGridGeometryImpl> {
+    switch (dimension)
+    {
+      case 1:
+        return std::unique_ptr<vtkHyperTreeGridGeometry1DImpl>(
+          new vtkHyperTreeGridGeometry1DImpl(input, points, cells, this->InData, cellData,
+            this->PassThroughCellIds, this->OriginalCellIdArrayName));
+      case 2:
+        return std::unique_ptr<vtkHyperTreeGridGeometry2DImpl>(
+          new vtkHyperTreeGridGeometry2DImpl(input, points, cells, this->InData, cellData,
+            this->PassThroughCellIds, this->OriginalCellIdArrayName));
+      case 3:
+        return std::unique_ptr<vtkHyperTreeGridGeometry3DImpl>(
+          new vtkHyperTreeGridGeometry3DImpl(this->Merging, input, points, cells, this->InData,
+            cellData, this->PassThroughCellIds, this->OriginalCellIdArrayName));
+      default:
+        return nullptr;
+    } // switch ( dimension )
+  };
+
+  // Collect the trees. Cell scales are computed lazily and may be shared by
+  // the trees, compute them for all levels before processing trees concurrently.
+  std::vector<vtkIdType> treeIds;
+  vtkIdType treeId;
+  vtkHyperTreeGrid::vtkHyperTreeGridIterator it;
+  input->InitializeTreeIterator(it);
+  while (vtkHyperTree* tree = it.GetNextTree(treeId))
   {
-    case 1:
-      implementation = std::unique_ptr<vtkHyperTreeGridGeometry1DImpl>(
-        new vtkHyperTreeGridGeometry1DImpl(input, outPoints, outCells, this->InData, this->OutData,
-          this->PassThroughCellIds, this->OriginalCellIdArrayName));
-      break;
-    case 2:
-      implementation = std::unique_ptr<vtkHyperTreeGridGeometry2DImpl>(
-        new vtkHyperTreeGridGeometry2DImpl(input, outPoints, outCells, this->InData, this->OutData,
-          this->PassThroughCellIds, this->OriginalCellIdArrayName));
-      break;
-    case 3:
-      implementation = std::unique_ptr<vtkHyperTreeGridGeometry3DImpl>(
-        new vtkHyperTreeGridGeometry3DImpl(this->Merging, input, outPoints, outCells, this->InData,
-          this->OutData, this->PassThroughCellIds, this->OriginalCellIdArrayName));
-      break;
-    default:
-      vtkErrorMacro("Incorrect dimension of input: " << dimension);
-      return 0;
-  } // switch ( dimension )
-
-  // Execute
-  implementation->GenerateGeometry();
+    treeIds.push_back(treeId);
+    if (tree->HasScales())
+    {
+      tree->GetScales()->GetScale(input->GetNumberOfLevels());
+    }
+  }
+
+  // Split the trees into ranges processed concurrently, each one with its own
+  // implementation and output. A single range writes directly into the output.
+  const vtkIdType numTrees = static_cast<vtkIdType>(treeIds.size());
+  const vtkIdType numThreads = vtkSMPTools::GetEstimatedNumberOfThreads();
+  const vtkIdType numRanges =
+    std::max<vtkIdType>(1, numThreads > 1 ? std::min(numTrees, 4 * numThreads) : 1);
+  if (numRanges == 1)
+  {
+    createImplementation(outPoints, outCells, this->OutData)
+      ->GenerateGeometry(treeIds.data(), numTrees);
+  }
+  else
+  {
+    // The implementations are created serially since they may compute the
+    // pure mask of the input
+    std::vector<RangeOutput> ranges(numRanges);
+    for (RangeOutput& range : ranges)
+    {
+      range.CellData->CopyAllocate(this->InData);
+      range.Implementation = createImplementation(range.Points, range.Cells, range.CellData);
+    }
+    vtkSMPTools::For(0, numRanges, 1, [&](vtkIdType beginRange, vtkIdType endRange) {
+      for (vtkIdType range = beginRange; range < endRange; ++range)
+      {
+        const vtkIdType beginTree = range * numTrees / numRanges;
+        const vtkIdType endTree = (range + 1) * numTrees / numRanges;
+        ranges[range].Implementation->GenerateGeometry(
+          treeIds.data() + beginTree, endTree - beginTree);
+      }
+    });
+
+    ::MergeRanges(ranges, this->Merging && dimension == 3, input->GetBounds(), outPoints,
+      outCells, this->OutData);
+  }
 
   // Set output geometry and topology
   output->SetPoints(outPoints);
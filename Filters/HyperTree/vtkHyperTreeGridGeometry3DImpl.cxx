@@ -93,18 +93,15 @@ vtkHyperTreeGridGeometry3DImpl::vtkHyperTreeGridGeometry3DImpl(bool mergePoints,
 vtkHyperTreeGridGeometry3DImpl::~vtkHyperTreeGridGeometry3DImpl() = default;
 
 //----------------------------------------------------------------------------------------------
-void vtkHyperTreeGridGeometry3DImpl::GenerateGeometry()
+void vtkHyperTreeGridGeometry3DImpl::GenerateGeometry(
+  const vtkIdType* treeIds, vtkIdType numberOfTrees)
 {
-  vtkHyperTreeGrid::vtkHyperTreeGridIterator it;
-  this->Input->InitializeTreeIterator(it);
-
-  vtkIdType hyperTreeId;
   vtkNew<vtkHyperTreeGridNonOrientedVonNeumannSuperCursor> cursor;
 
-  // Recursively process all HyperTrees
-  while (it.GetNextTree(hyperTreeId))
+  // Recursively process the given HyperTrees
+  for (vtkIdType treeNum = 0; treeNum < numberOfTrees; ++treeNum)
   {
-    this->Input->InitializeNonOrientedVonNeumannSuperCursor(cursor, hyperTreeId);
+    this->Input->InitializeNonOrientedVonNeumannSuperCursor(cursor, treeIds[treeNum]);
     this->RecursivelyProcessTree(cursor, ::TREAT_ALL_FACES);
   }
 }
@@ -944,11 +941,12 @@ bool vtkHyperTreeGridGeometry3DImpl::GetHasInterface(vtkIdType cellId) const
   }
 
   bool ret =
-    (this->InIntercepts && ((this->InIntercepts->GetTuple(cellId))[2] < 2) && this->InNormals);
+    (this->InIntercepts && this->InIntercepts->GetComponent(cellId, 2) < 2 && this->InNormals);
   if (ret)
   {
-    double* normal = this->InNormals->GetTuple(cellId);
-    ret = !(normal[0] == 0. && normal[1] == 0. && normal[2] == 0.);
+    ret = !(this->InNormals->GetComponent(cellId, 0) == 0. &&
+      this->InNormals->GetComponent(cellId, 1) == 0. &&
+      this->InNormals->GetComponent(cellId, 2) == 0.);
   }
   return ret;
 }
@@ -31,9 +31,9 @@ public:
   ~vtkHyperTreeGridGeometry3DImpl() override;
 
   /**
-   * Generate the external surface of the input vtkHyperTreeGrid.
+   * Generate the external surface of the given trees of the input vtkHyperTreeGrid.
    */
-  void GenerateGeometry() override;
+  void GenerateGeometry(const vtkIdType* treeIds, vtkIdType numberOfTrees) override;
 
 protected:
   /**
@@ -88,9 +88,10 @@ void vtkHyperTreeGridGeometryImpl::CreateNewCellAndCopyData(
 bool vtkHyperTreeGridGeometryImpl::IsMaskedOrGhost(vtkIdType globalNodeId) const
 {
   // This method determines if the globalNodeId offset cell is masked or ghosted.
-  return ((this->InMaskArray && this->InMaskArray->GetTuple1(globalNodeId))
+  // GetValue is used since it can be called concurrently.
+  return ((this->InMaskArray && this->InMaskArray->GetValue(globalNodeId))
       ? true
-      : (this->InGhostArray && this->InGhostArray->GetTuple1(globalNodeId)));
+      : (this->InGhostArray && this->InGhostArray->GetValue(globalNodeId)));
 }
 
 //----------------------------------------------------------------------------------------------
@@ -115,16 +116,10 @@ bool vtkHyperTreeGridGeometryImpl::ProbeForCellInterface(vtkIdType cellId, bool
     this->CellInterfaceType = 2; // we consider pure cell
     return false;
   }
-  double* intercepts = this->InIntercepts->GetTuple(cellId);
-  if (intercepts == nullptr)
-  {
-    this->HasInterfaceOnThisCell = false;
-    this->CellInterfaceType = 2; // we consider pure cell
-    return false;
-  }
-  this->CellIntercepts[0] = intercepts[0];
-  this->CellIntercepts[1] = intercepts[1];
-  this->CellIntercepts[2] = intercepts[2];
+  // The components are read one by one since GetTuple cannot be called concurrently
+  this->CellIntercepts[0] = this->InIntercepts->GetComponent(cellId, 0);
+  this->CellIntercepts[1] = this->InIntercepts->GetComponent(cellId, 1);
+  this->CellIntercepts[2] = this->InIntercepts->GetComponent(cellId, 2);
   this->CellInterfaceType = static_cast<int>(this->CellIntercepts[2]);
   if (this->CellInterfaceType >= 2)
   {
@@ -132,12 +127,10 @@ bool vtkHyperTreeGridGeometryImpl::ProbeForCellInterface(vtkIdType cellId, bool
     this->CellInterfaceType = 2; // we consider pure cell
     return false;
   }
-  double* normal = this->InNormals->GetTuple(cellId);
-  if (normal == nullptr)
+  double normal[3];
+  for (int comp = 0; comp < 3; ++comp)
   {
-    this->HasInterfaceOnThisCell = false;
-    this->CellInterfaceType = 2; // we consider pure cell
-    return false;
+    normal[comp] = this->InNormals->GetComponent(cellId, comp);
   }
   if (normal[0] == 0. && normal[1] == 0. && normal[2] == 0.)
   {
@@ -39,10 +39,14 @@ public:
   virtual ~vtkHyperTreeGridGeometryImpl() = default;
 
   /**
-   * Generate the external surface of the input vtkHyperTreeGrid.
+   * Generate the external surface of the given trees of the input vtkHyperTreeGrid,
+   * in the order of treeIds.
    * This method is implemented by subclasses, depending on the dimension of the HTG.
+   *
+   * Instances using distinct outputs can generate the surface of distinct trees
+   * concurrently, the input being only read.
    */
-  virtual void GenerateGeometry() = 0;
+  virtual void GenerateGeometry(const vtkIdType* treeIds, vtkIdType numberOfTrees) = 0;
 
 protected:
   ///@{
@@ -22,21 +22,17 @@ vtkHyperTreeGridGeometrySmallDimensionsImpl::vtkHyperTreeGridGeometrySmallDimens
 }
 
 //----------------------------------------------------------------------------------------------
-void vtkHyperTreeGridGeometrySmallDimensionsImpl::GenerateGeometry()
+void vtkHyperTreeGridGeometrySmallDimensionsImpl::GenerateGeometry(
+  const vtkIdType* treeIds, vtkIdType numberOfTrees)
 {
-  // initialize iterator on HypterTrees (HT) of an HyperTreeGrid (HTG)
-  vtkHyperTreeGrid::vtkHyperTreeGridIterator it;
-  this->Input->InitializeTreeIterator(it);
-  // index of current HT
-  vtkIdType hyperTreeId;
   // non oriented geometry cursor describe one cell on HT
   vtkNew<vtkHyperTreeGridNonOrientedGeometryCursor> cursor;
 
-  // traversal on HTG for describe a current HT
-  while (it.GetNextTree(hyperTreeId))
+  // traversal on the given HTs
+  for (vtkIdType treeNum = 0; treeNum < numberOfTrees; ++treeNum)
   {
     // initialize cursor on first cell (root)  of current HT
-    this->Input->InitializeNonOrientedGeometryCursor(cursor, hyperTreeId);
+    this->Input->InitializeNonOrientedGeometryCursor(cursor, treeIds[treeNum]);
 
     // traversal recursively
     this->RecursivelyProcessTree(cursor);
@@ -34,9 +34,9 @@ public:
   ~vtkHyperTreeGridGeometrySmallDimensionsImpl() override = default;
 
   /**
-   * Generate the external surface of the input vtkHyperTreeGrid.
+   * Generate the external surface of the given trees of the input vtkHyperTreeGrid.
    */
-  void GenerateGeometry() override;
+  void GenerateGeometry(const vtkIdType* treeIds, vtkIdType numberOfTrees) override;
 
 protected:
   /**
@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the contacts found by vtkCollisionDetectionFilter, which builds
+// and intersects its OBB trees with several threads, are identical to the ones
+// found with a single thread.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkCollisionDetectionFilter.h"
+#include "vtkFieldData.h"
+#include "vtkLogger.h"
+#include "vtkMatrix4x4.h"
+#include "vtkNew.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSphereSource.h"
+#include "vtkTestUtilities.h"
+
+#include <cstdlib>
+
+int TestCollisionDetectionThreaded(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere0;
+  sphere0->SetRadius(5.0);
+  sphere0->SetThetaResolution(150);
+  sphere0->SetPhiResolution(150);
+  vtkNew<vtkSphereSource> sphere1;
+  sphere1->SetRadius(5.0);
+  sphere1->SetThetaResolution(120);
+  sphere1->SetPhiResolution(120);
+  sphere1->SetCenter(4.9, 0.3, 0.1);
+
+  vtkNew<vtkMatrix4x4> matrix0;
+  vtkNew<vtkMatrix4x4> matrix1;
+  matrix1->SetElement(0, 3, 0.2);
+  vtkNew<vtkCollisionDetectionFilter> collide;
+  collide->SetInputConnection(0, sphere0->GetOutputPort());
+  collide->SetInputConnection(1, sphere1->GetOutputPort());
+  collide->SetMatrix(0, matrix0);
+  collide->SetMatrix(1, matrix1);
+  collide->SetBoxTolerance(0.0);
+  collide->SetCellTolerance(0.0);
+  collide->SetNumberOfCellsPerNode(2);
+  collide->GenerateScalarsOn();
+
+  for (int mode = vtkCollisionDetectionFilter::VTK_ALL_CONTACTS;
+       mode <= vtkCollisionDetectionFilter::VTK_HALF_CONTACTS; ++mode)
+  {
+    collide->SetCollisionMode(mode);
+    vtkNew<vtkPolyData> serial[3];
+    int serialBoxTests = 0;
+    vtkSMPTools::LocalScope(vtkSMPTools::Config{ 1 }, [&]() {
+      collide->Modified();
+      collide->Update();
+      serialBoxTests = collide->GetNumberOfBoxTests();
+    });
+    for (int i = 0; i < 3; ++i)
+    {
+      serial[i]->DeepCopy(collide->GetOutput(i));
+    }
+    if (collide->GetNumberOfContacts() < 1 ||
+      (mode == vtkCollisionDetectionFilter::VTK_FIRST_CONTACT &&
+        collide->GetNumberOfContacts() != 1))
+    {
+      vtkLog(ERROR, "Wrong number of contacts " << collide->GetNumberOfContacts());
+      return EXIT_FAILURE;
+    }
+
+    collide->Modified();
+    collide->Update();
+    vtkPolyData* contacts = collide->GetContactsOutput();
+    vtkCellArray* serialCells = mode == vtkCollisionDetectionFilter::VTK_ALL_CONTACTS
+      ? serial[2]->GetLines()
+      : serial[2]->GetVerts();
+    vtkCellArray* cells = mode == vtkCollisionDetectionFilter::VTK_ALL_CONTACTS
+      ? contacts->GetLines()
+      : contacts->GetVerts();
+    if (collide->GetNumberOfBoxTests() != serialBoxTests ||
+      !vtkTestUtilities::CompareAbstractArray(
+        serial[2]->GetPoints()->GetData(), contacts->GetPoints()->GetData()) ||
+      !vtkTestUtilities::CompareAbstractArray(
+        serialCells->GetConnectivityArray(), cells->GetConnectivityArray()))
+    {
+      vtkLog(ERROR, "Threaded contacts differ in mode " << collide->GetCollisionModeAsString());
+      return EXIT_FAILURE;
+    }
+    for (int i = 0; i < 2; ++i)
+    {
+      if (!vtkTestUtilities::CompareAbstractArray(
+            serial[i]->GetFieldData()->GetArray("ContactCells"), collide->GetContactCells(i)) ||
+        !vtkTestUtilities::CompareAbstractArray(serial[i]->GetCellData()->GetScalars(),
+          collide->GetOutput(i)->GetCellData()->GetScalars()))
+      {
+        vtkLog(ERROR, "Threaded contact cells differ in mode "
+            << collide->GetCollisionModeAsString());
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Fill many holes of a plane with vtkFillHolesFilter, and check that the
+// holes are filled the same way with several threads as with a single
+// thread. Some holes touch at a point, which splits their loops.
+
+#include "vtkCellArray.h"
+#include "vtkFillHolesFilter.h"
+#include "vtkIdList.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPlaneSource.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkTestUtilities.h"
+
+#include <cstdlib>
+
+namespace
+{
+const int Resolution = 60;
+
+// Quads (i, j) are removed: single quads at i % 5 == 1 and j % 5 == 1, pairs
+// of quads at i % 5 == 3 and j % 5 == 3, and diagonal neighbors in a corner.
+bool IsHole(int i, int j)
+{
+  if (i >= 50 || j >= 50)
+  {
+    return (i == 52 && j == 52) || (i == 53 && j == 53);
+  }
+  return (i % 5 == 1 && j % 5 == 1) || ((i % 5 == 3 || i % 5 == 4) && j % 5 == 3);
+}
+
+vtkSmartPointer<vtkPolyData> CreatePlaneWithHoles()
+{
+  vtkNew<vtkPlaneSource> plane;
+  plane->SetResolution(Resolution, Resolution);
+  plane->Update();
+
+  vtkNew<vtkCellArray> polys;
+  vtkNew<vtkIdList> ptIds;
+  for (int j = 0; j < Resolution; ++j)
+  {
+    for (int i = 0; i < Resolution; ++i)
+    {
+      if (!IsHole(i, j))
+      {
+        plane->GetOutput()->GetCellPoints(j * Resolution + i, ptIds);
+        polys->InsertNextCell(ptIds);
+      }
+    }
+  }
+  auto input = vtkSmartPointer<vtkPolyData>::New();
+  input->SetPoints(plane->GetOutput()->GetPoints());
+  input->SetPolys(polys);
+  return input;
+}
+}
+
+int TestFillHolesFilterThreaded(int, char*[])
+{
+  vtkSmartPointer<vtkPolyData> input = CreatePlaneWithHoles();
+
+  vtkNew<vtkFillHolesFilter> fill;
+  fill->SetInputData(input);
+  // large enough for the small holes, too small for the outer boundary
+  fill->SetHoleSize(0.1);
+  vtkNew<vtkPolyData> serial;
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ 1 }, [&]() { fill->Update(); });
+  serial->DeepCopy(fill->GetOutput());
+  fill->Modified();
+  fill->Update();
+  vtkPolyData* output = fill->GetOutput();
+
+  if (!vtkTestUtilities::CompareDataObjects(serial, output))
+  {
+    vtkLog(ERROR, "Threaded output differs");
+    return EXIT_FAILURE;
+  }
+
+  // 100 single quads are filled with 2 triangles, 100 pairs of quads with 4
+  const vtkIdType numFilled = output->GetNumberOfPolys() - input->GetNumberOfPolys();
+  if (numFilled < 100 * 2 + 100 * 4 || numFilled > 100 * 2 + 100 * 4 + 4)
+  {
+    vtkLog(ERROR, "Wrong number of triangles filling the holes: " << numFilled);
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
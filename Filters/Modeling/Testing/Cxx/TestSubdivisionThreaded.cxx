@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the Loop, butterfly and linear subdivision filters produce the
+// same output with several threads as with a single thread, on an open
+// sphere with point and cell data.
+
+#include "vtkButterflySubdivisionFilter.h"
+#include "vtkCellData.h"
+#include "vtkDataArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkIntArray.h"
+#include "vtkLinearSubdivisionFilter.h"
+#include "vtkLogger.h"
+#include "vtkLoopSubdivisionFilter.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+#include "vtkTestUtilities.h"
+
+#include <cstdlib>
+
+namespace
+{
+// An open sphere, so that the boundary stencils are used too
+vtkSmartPointer<vtkPolyData> CreateInput()
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(40);
+  sphere->SetPhiResolution(30);
+  sphere->SetEndTheta(300.0);
+  sphere->Update();
+
+  auto input = vtkSmartPointer<vtkPolyData>::New();
+  input->CopyStructure(sphere->GetOutput());
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("Scalars");
+  double x[3];
+  for (vtkIdType ptId = 0; ptId < input->GetNumberOfPoints(); ++ptId)
+  {
+    input->GetPoint(ptId, x);
+    scalars->InsertNextValue(x[0] + 2.0 * x[1] + 3.0 * x[2]);
+  }
+  input->GetPointData()->SetScalars(scalars);
+  vtkNew<vtkIntArray> cellIds;
+  cellIds->SetName("CellIds");
+  for (vtkIdType cellId = 0; cellId < input->GetNumberOfCells(); ++cellId)
+  {
+    cellIds->InsertNextValue(static_cast<int>(cellId));
+  }
+  input->GetCellData()->AddArray(cellIds);
+  return input;
+}
+
+bool TestFilter(vtkSubdivisionFilter* filter, vtkPolyData* input)
+{
+  filter->SetInputData(input);
+  filter->SetNumberOfSubdivisions(2);
+  vtkNew<vtkPolyData> serial;
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ 1 }, [&]() { filter->Update(); });
+  serial->DeepCopy(filter->GetOutput());
+  filter->Modified();
+  filter->Update();
+  vtkPolyData* output = filter->GetOutput();
+  if (output->GetNumberOfPolys() != 16 * input->GetNumberOfPolys())
+  {
+    vtkLog(ERROR, "Wrong number of triangles for " << filter->GetClassName());
+    return false;
+  }
+  if (!vtkTestUtilities::CompareDataObjects(serial, output))
+  {
+    vtkLog(ERROR, "Threaded output differs for " << filter->GetClassName());
+    return false;
+  }
+
+  // Every triangle is subdivided into four triangles with its cell data
+  vtkDataArray* cellIds = output->GetCellData()->GetArray("CellIds");
+  for (vtkIdType cellId = 0; cellId < output->GetNumberOfCells(); ++cellId)
+  {
+    if (cellIds->GetComponent(cellId, 0) != cellId / 16)
+    {
+      vtkLog(ERROR, "Wrong cell data for " << filter->GetClassName());
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestSubdivisionThreaded(int, char*[])
+{
+  vtkSmartPointer<vtkPolyData> input = CreateInput();
+
+  vtkNew<vtkLoopSubdivisionFilter> loop;
+  vtkNew<vtkButterflySubdivisionFilter> butterfly;
+  vtkNew<vtkLinearSubdivisionFilter> linear;
+  if (!TestFilter(loop, input) || !TestFilter(butterfly, input) || !TestFilter(linear, input))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Interpolating schemes keep the input points first
+  double x[3], y[3];
+  for (vtkIdType ptId = 0; ptId < input->GetNumberOfPoints(); ++ptId)
+  {
+    input->GetPoint(ptId, x);
+    butterfly->GetOutput()->GetPoint(ptId, y);
+    if (x[0] != y[0] || x[1] != y[1] || x[2] != y[2])
+    {
+      vtkLog(ERROR, "Input point " << ptId << " moved by vtkButterflySubdivisionFilter");
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
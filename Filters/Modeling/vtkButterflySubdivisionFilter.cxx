@@ -3,14 +3,18 @@
 #include "vtkButterflySubdivisionFilter.h"
 
 #include "vtkCellArray.h"
-#include "vtkEdgeTable.h"
 #include "vtkIdList.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 
+#include <atomic>
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkButterflySubdivisionFilter);
 
@@ -25,121 +29,120 @@ static const double butterflyWeights[8] = { .5, .5, .125, .125, -.0625, -.0625,
 int vtkButterflySubdivisionFilter::GenerateSubdivisionPoints(
   vtkPolyData* inputDS, vtkIntArray* edgeData, vtkPoints* outputPts, vtkPointData* outputPD)
 {
-  const vtkIdType* pts = nullptr;
-  vtkIdType cellId, newId, i, j;
-  int edgeId;
-  vtkIdType npts = 0;
-  vtkIdType p1, p2;
-  int valence1, valence2;
-  vtkCellArray* inputPolys = inputDS->GetPolys();
-  vtkSmartPointer<vtkEdgeTable> edgeTable = vtkSmartPointer<vtkEdgeTable>::New();
-  vtkSmartPointer<vtkIdList> cellIds = vtkSmartPointer<vtkIdList>::New();
-  vtkSmartPointer<vtkIdList> p1CellIds = vtkSmartPointer<vtkIdList>::New();
-  vtkSmartPointer<vtkIdList> p2CellIds = vtkSmartPointer<vtkIdList>::New();
-  vtkSmartPointer<vtkIdList> stencil = vtkSmartPointer<vtkIdList>::New();
-  vtkSmartPointer<vtkIdList> stencil1 = vtkSmartPointer<vtkIdList>::New();
-  vtkSmartPointer<vtkIdList> stencil2 = vtkSmartPointer<vtkIdList>::New();
   vtkPoints* inputPts = inputDS->GetPoints();
   vtkPointData* inputPD = inputDS->GetPointData();
-
-  double weights[256];
-  double weights1[256];
-  double weights2[256];
-
-  // Create an edge table to keep track of which edges we've processed
-  edgeTable->InitEdgeInsertion(inputDS->GetNumberOfPoints());
-  bool abort = false;
-
-  // Generate new points for subdivisions surface
-  for (cellId = 0, inputPolys->InitTraversal(); !abort && inputPolys->GetNextCell(npts, pts);
-       cellId++)
-  {
-    p1 = pts[2];
-    p2 = pts[0];
-
-    for (edgeId = 0; edgeId < 3; edgeId++)
+  const vtkIdType numPts = inputDS->GetNumberOfPoints();
+
+  // The new points, inserted on the edges, follow the old points
+  std::vector<vtkIdType> edgePoints;
+  const vtkIdType numEdges = this->NumberEdges(inputDS, numPts, edgeData, edgePoints);
+  outputPts->SetNumberOfPoints(numPts + numEdges);
+  outputPD->SetNumberOfTuples(numPts + numEdges);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    for (; ptId < endPtId; ptId++)
     {
-      abort = this->CheckAbort();
-      if (abort)
+      outputPD->CopyData(inputPD, ptId, ptId);
+    }
+  });
+
+  // Generate new points for subdivisions surface. The first non-manifold
+  // edge is reported.
+  std::atomic<vtkIdType> nonManifoldEdge(numEdges);
+  vtkSMPThreadLocalObject<vtkIdList> tlCellIds;
+  vtkSMPThreadLocalObject<vtkIdList> tlP1CellIds;
+  vtkSMPThreadLocalObject<vtkIdList> tlP2CellIds;
+  vtkSMPThreadLocalObject<vtkIdList> tlStencil;
+  vtkSMPThreadLocalObject<vtkIdList> tlStencil1;
+  vtkSMPThreadLocalObject<vtkIdList> tlStencil2;
+  vtkSMPTools::For(0, numEdges, [&](vtkIdType edgeId, vtkIdType endEdgeId) {
+    vtkIdList* cellIds = tlCellIds.Local();
+    vtkIdList* p1CellIds = tlP1CellIds.Local();
+    vtkIdList* p2CellIds = tlP2CellIds.Local();
+    vtkIdList* stencil = tlStencil.Local();
+    vtkIdList* stencil1 = tlStencil1.Local();
+    vtkIdList* stencil2 = tlStencil2.Local();
+    double weights[256];
+    double weights1[256];
+    double weights2[256];
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; edgeId < endEdgeId; edgeId++)
+    {
+      if (isFirst)
+      {
+        this->CheckAbort();
+      }
+      if (this->GetAbortOutput())
       {
         break;
       }
-      // Do we need to create a point on this edge?
-      if (edgeTable->IsEdge(p1, p2) == -1)
+      const vtkIdType p1 = edgePoints[2 * edgeId];
+      const vtkIdType p2 = edgePoints[2 * edgeId + 1];
+      inputDS->GetCellEdgeNeighbors(-1, p1, p2, cellIds);
+      // If this is a boundary edge. we need to use a special subdivision rule
+      if (cellIds->GetNumberOfIds() == 1)
+      {
+        // Compute new Position and PointData using the same subdivision scheme
+        this->GenerateBoundaryStencil(p1, p2, inputDS, stencil, weights);
+      } // boundary edge
+      else if (cellIds->GetNumberOfIds() == 2)
       {
-        outputPD->CopyData(inputPD, p1, p1);
-        outputPD->CopyData(inputPD, p2, p2);
-        edgeTable->InsertEdge(p1, p2);
+        // find the valence of the two points
+        inputDS->GetPointCells(p1, p1CellIds);
+        const vtkIdType valence1 = p1CellIds->GetNumberOfIds();
+        inputDS->GetPointCells(p2, p2CellIds);
+        const vtkIdType valence2 = p2CellIds->GetNumberOfIds();
 
-        inputDS->GetCellEdgeNeighbors(-1, p1, p2, cellIds);
-        // If this is a boundary edge. we need to use a special subdivision rule
-        if (cellIds->GetNumberOfIds() == 1)
+        if (valence1 == 6 && valence2 == 6)
         {
-          // Compute new Position and PointData using the same subdivision scheme
-          this->GenerateBoundaryStencil(p1, p2, inputDS, stencil, weights);
-        } // boundary edge
-        else if (cellIds->GetNumberOfIds() == 2)
+          this->GenerateButterflyStencil(p1, p2, inputDS, stencil, weights);
+        }
+        else if (valence1 == 6 && valence2 != 6)
         {
-          // find the valence of the two points
-          inputDS->GetPointCells(p1, p1CellIds);
-          valence1 = p1CellIds->GetNumberOfIds();
-          inputDS->GetPointCells(p2, p2CellIds);
-          valence2 = p2CellIds->GetNumberOfIds();
-
-          if (valence1 == 6 && valence2 == 6)
-          {
-            this->GenerateButterflyStencil(p1, p2, inputDS, stencil, weights);
-          }
-          else if (valence1 == 6 && valence2 != 6)
-          {
-            this->GenerateLoopStencil(p2, p1, inputDS, stencil, weights);
-          }
-          else if (valence1 != 6 && valence2 == 6)
+          this->GenerateLoopStencil(p2, p1, inputDS, stencil, weights);
+        }
+        else if (valence1 != 6 && valence2 == 6)
+        {
+          this->GenerateLoopStencil(p1, p2, inputDS, stencil, weights);
+        }
+        else
+        {
+          // Edge connects two extraordinary vertices
+          this->GenerateLoopStencil(p2, p1, inputDS, stencil1, weights1);
+          this->GenerateLoopStencil(p1, p2, inputDS, stencil2, weights2);
+          // combine the two stencils and halve the weights
+          vtkIdType total = stencil1->GetNumberOfIds() + stencil2->GetNumberOfIds();
+          stencil->SetNumberOfIds(total);
+
+          vtkIdType j = 0;
+          for (vtkIdType i = 0; i < stencil1->GetNumberOfIds(); i++)
           {
-            this->GenerateLoopStencil(p1, p2, inputDS, stencil, weights);
+            stencil->InsertId(j, stencil1->GetId(i));
+            weights[j++] = weights1[i] * .5;
           }
-          else
+          for (vtkIdType i = 0; i < stencil2->GetNumberOfIds(); i++)
           {
-            // Edge connects two extraordinary vertices
-            this->GenerateLoopStencil(p2, p1, inputDS, stencil1, weights1);
-            this->GenerateLoopStencil(p1, p2, inputDS, stencil2, weights2);
-            // combine the two stencils and halve the weights
-            vtkIdType total = stencil1->GetNumberOfIds() + stencil2->GetNumberOfIds();
-            stencil->SetNumberOfIds(total);
-
-            j = 0;
-            for (i = 0; i < stencil1->GetNumberOfIds(); i++)
-            {
-              stencil->InsertId(j, stencil1->GetId(i));
-              weights[j++] = weights1[i] * .5;
-            }
-            for (i = 0; i < stencil2->GetNumberOfIds(); i++)
-            {
-              stencil->InsertId(j, stencil2->GetId(i));
-              weights[j++] = weights2[i] * .5;
-            }
+            stencil->InsertId(j, stencil2->GetId(i));
+            weights[j++] = weights2[i] * .5;
           }
         }
-        else
-        {
-          vtkErrorMacro("Dataset is non-manifold and cannot be subdivided.");
-          return 0;
-        }
-        newId = this->InterpolatePosition(inputPts, outputPts, stencil, weights);
-        outputPD->InterpolatePoint(inputPD, newId, stencil, weights);
       }
-      else // we have already created a point on this edge. find it
+      else
       {
-        newId = this->FindEdge(inputDS, cellId, p1, p2, edgeData, cellIds);
-      }
-      edgeData->InsertComponent(cellId, edgeId, newId);
-      p1 = p2;
-      if (edgeId < 2)
-      {
-        p2 = pts[edgeId + 1];
+        vtkIdType firstEdgeId = nonManifoldEdge.load(std::memory_order_relaxed);
+        while (edgeId < firstEdgeId && !nonManifoldEdge.compare_exchange_weak(firstEdgeId, edgeId))
+        {
+        }
+        continue;
       }
-    } // each interior edge
-  }   // each cell
+      this->InterpolatePosition(inputPts, outputPts, numPts + edgeId, stencil, weights);
+      outputPD->InterpolatePoint(inputPD, numPts + edgeId, stencil, weights);
+    }
+  });
+  if (nonManifoldEdge < numEdges)
+  {
+    vtkErrorMacro("Dataset is non-manifold and cannot be subdivided.");
+    return 0;
+  }
 
   return 1;
 }
@@ -149,7 +152,9 @@ void vtkButterflySubdivisionFilter::GenerateLoopStencil(
   vtkIdType p1, vtkIdType p2, vtkPolyData* polys, vtkIdList* stencilIds, double* weights)
 {
   vtkSmartPointer<vtkIdList> cellIds = vtkSmartPointer<vtkIdList>::New();
-  vtkCell* cell;
+  vtkSmartPointer<vtkIdList> ptIds = vtkSmartPointer<vtkIdList>::New();
+  vtkIdType npts;
+  const vtkIdType* pts;
   vtkIdType startCell, nextCell, tp2, p;
   int shift[255];
   int processed = 0;
@@ -168,11 +173,11 @@ void vtkButterflySubdivisionFilter::GenerateLoopStencil(
   tp2 = p2;
   while (nextCell != startCell)
   {
-    cell = polys->GetCell(nextCell);
+    polys->GetCellPoints(nextCell, npts, pts, ptIds);
     p = -1;
     for (int i = 0; i < 3; i++)
     {
-      if ((p = cell->GetPointId(i)) != p1 && cell->GetPointId(i) != tp2)
+      if ((p = pts[i]) != p1 && pts[i] != tp2)
       {
         break;
       }
@@ -225,11 +230,11 @@ void vtkButterflySubdivisionFilter::GenerateLoopStencil(
   }
   else
   { // K == 2. p1 must be on a boundary edge,
-    cell = polys->GetCell(startCell);
+    polys->GetCellPoints(startCell, npts, pts, ptIds);
     p = -1;
     for (int i = 0; i < 3; i++)
     {
-      if ((p = cell->GetPointId(i)) != p1 && cell->GetPointId(i) != p2)
+      if ((p = pts[i]) != p1 && pts[i] != p2)
       {
         break;
       }
@@ -250,6 +255,7 @@ void vtkButterflySubdivisionFilter::GenerateBoundaryStencil(
   vtkIdType p1, vtkIdType p2, vtkPolyData* polys, vtkIdList* stencilIds, double* weights)
 {
   vtkSmartPointer<vtkIdList> cellIds = vtkSmartPointer<vtkIdList>::New();
+  vtkSmartPointer<vtkIdList> ptIds = vtkSmartPointer<vtkIdList>::New();
   vtkIdType* cells;
   vtkIdType ncells;
   const vtkIdType* pts;
@@ -262,7 +268,7 @@ void vtkButterflySubdivisionFilter::GenerateBoundaryStencil(
   p0 = -1;
   for (i = 0; i < ncells && p0 == -1; i++)
   {
-    polys->GetCellPoints(cells[i], npts, pts);
+    polys->GetCellPoints(cells[i], npts, pts, ptIds);
     for (j = 0; j < npts; j++)
     {
       if (pts[j] == p1 || pts[j] == p2)
@@ -282,7 +288,7 @@ void vtkButterflySubdivisionFilter::GenerateBoundaryStencil(
   p3 = -1;
   for (i = 0; i < ncells && p3 == -1; i++)
   {
-    polys->GetCellPoints(cells[i], npts, pts);
+    polys->GetCellPoints(cells[i], npts, pts, ptIds);
     for (j = 0; j < npts; j++)
     {
       if (pts[j] == p1 || pts[j] == p2 || pts[j] == p0)
@@ -321,7 +327,9 @@ void vtkButterflySubdivisionFilter::GenerateButterflyStencil(
   vtkIdType p1, vtkIdType p2, vtkPolyData* polys, vtkIdList* stencilIds, double* weights)
 {
   vtkSmartPointer<vtkIdList> cellIds = vtkSmartPointer<vtkIdList>::New();
-  vtkCell* cell;
+  vtkSmartPointer<vtkIdList> ptIds = vtkSmartPointer<vtkIdList>::New();
+  vtkIdType npts;
+  const vtkIdType* pts;
   int i;
   vtkIdType cell0, cell1;
   vtkIdType p, p3, p4, p5, p6, p7, p8;
@@ -330,21 +338,21 @@ void vtkButterflySubdivisionFilter::GenerateButterflyStencil(
   cell0 = cellIds->GetId(0);
   cell1 = cellIds->GetId(1);
 
-  cell = polys->GetCell(cell0);
+  polys->GetCellPoints(cell0, npts, pts, ptIds);
   p3 = -1;
   for (i = 0; i < 3; i++)
   {
-    if ((p = cell->GetPointId(i)) != p1 && cell->GetPointId(i) != p2)
+    if ((p = pts[i]) != p1 && pts[i] != p2)
     {
       p3 = p;
       break;
     }
   }
-  cell = polys->GetCell(cell1);
+  polys->GetCellPoints(cell1, npts, pts, ptIds);
   p4 = -1;
   for (i = 0; i < 3; i++)
   {
-    if ((p = cell->GetPointId(i)) != p1 && cell->GetPointId(i) != p2)
+    if ((p = pts[i]) != p1 && pts[i] != p2)
     {
       p4 = p;
       break;
@@ -355,10 +363,10 @@ void vtkButterflySubdivisionFilter::GenerateButterflyStencil(
   p5 = -1;
   if (cellIds->GetNumberOfIds() > 0)
   {
-    cell = polys->GetCell(cellIds->GetId(0));
+    polys->GetCellPoints(cellIds->GetId(0), npts, pts, ptIds);
     for (i = 0; i < 3; i++)
     {
-      if ((p = cell->GetPointId(i)) != p1 && cell->GetPointId(i) != p3)
+      if ((p = pts[i]) != p1 && pts[i] != p3)
       {
         p5 = p;
         break;
@@ -370,10 +378,10 @@ void vtkButterflySubdivisionFilter::GenerateButterflyStencil(
   p6 = -1;
   if (cellIds->GetNumberOfIds() > 0)
   {
-    cell = polys->GetCell(cellIds->GetId(0));
+    polys->GetCellPoints(cellIds->GetId(0), npts, pts, ptIds);
     for (i = 0; i < 3; i++)
     {
-      if ((p = cell->GetPointId(i)) != p2 && cell->GetPointId(i) != p3)
+      if ((p = pts[i]) != p2 && pts[i] != p3)
       {
         p6 = p;
         break;
@@ -385,10 +393,10 @@ void vtkButterflySubdivisionFilter::GenerateButterflyStencil(
   p7 = -1;
   if (cellIds->GetNumberOfIds() > 0)
   {
-    cell = polys->GetCell(cellIds->GetId(0));
+    polys->GetCellPoints(cellIds->GetId(0), npts, pts, ptIds);
     for (i = 0; i < 3; i++)
     {
-      if ((p = cell->GetPointId(i)) != p1 && cell->GetPointId(i) != p4)
+      if ((p = pts[i]) != p1 && pts[i] != p4)
       {
         p7 = p;
         break;
@@ -400,10 +408,10 @@ void vtkButterflySubdivisionFilter::GenerateButterflyStencil(
   polys->GetCellEdgeNeighbors(cell1, p2, p4, cellIds);
   if (cellIds->GetNumberOfIds() > 0)
   {
-    cell = polys->GetCell(cellIds->GetId(0));
+    polys->GetCellPoints(cellIds->GetId(0), npts, pts, ptIds);
     for (i = 0; i < 3; i++)
     {
-      if ((p = cell->GetPointId(i)) != p2 && cell->GetPointId(i) != p4)
+      if ((p = pts[i]) != p2 && pts[i] != p4)
       {
         p8 = p;
         break;
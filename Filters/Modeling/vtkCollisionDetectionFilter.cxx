@@ -23,6 +23,8 @@
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTransform.h"
@@ -30,6 +32,11 @@
 #include "vtkTrivialProducer.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
+#include <atomic>
+#include <utility>
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkCollisionDetectionFilter);
 
@@ -241,168 +248,151 @@ vtkMatrix4x4* vtkCollisionDetectionFilter::GetMatrix(int i)
   return this->Matrix[i];
 }
 
-static int ComputeCollisions(
-  vtkOBBNode* nodeA, vtkOBBNode* nodeB, vtkMatrix4x4* Xform, void* clientdata)
+namespace
 {
-  // This is hard-coded for triangles but could be easily changed to allow for allow n-sided
-  // polygons
-  int numIdsA, numIdsB;
-  vtkIdList *IdsA, *IdsB, *pointIdsA, *pointIdsB;
-  vtkCellArray* cells;
-  vtkIdType cellPtIds[2];
-  vtkIdTypeArray *contactcells1, *contactcells2;
-  vtkPoints* contactpoints;
-  IdsA = nodeA->Cells;
-  IdsB = nodeB->Cells;
-  numIdsA = IdsA->GetNumberOfIds();
-  numIdsB = IdsB->GetNumberOfIds();
-
-  // clientdata is a pointer to this object... need to cast it as such
-  vtkCollisionDetectionFilter* self = reinterpret_cast<vtkCollisionDetectionFilter*>(clientdata);
-
-  // Turn off debugging here if its on... otherwise there's squawks every update/box test
-  int DebugWasOn = 0;
-  int FirstContact = 0;
-  if (self->GetDebug())
-  {
-    self->DebugOff();
-    DebugWasOn = 1;
-  }
-  vtkPolyData* inputA = vtkPolyData::SafeDownCast(self->GetInput(0));
-  vtkPolyData* inputB = vtkPolyData::SafeDownCast(self->GetInput(1));
-  contactcells1 = self->GetContactCells(0);
-  contactcells2 = self->GetContactCells(1);
-  contactpoints = self->GetOutput(2)->GetPoints();
-
-  if (self->GetCollisionMode() == vtkCollisionDetectionFilter::VTK_ALL_CONTACTS)
-  {
-    cells = self->GetOutput(2)->GetLines();
-  }
-  else
-  {
-    cells = self->GetOutput(2)->GetVerts();
-  }
+using NodePair = std::pair<vtkOBBNode*, vtkOBBNode*>;
 
-  float Tolerance = self->GetCellTolerance();
-  if (self->GetCollisionMode() == vtkCollisionDetectionFilter::VTK_FIRST_CONTACT)
-  {
-    FirstContact = 1;
-  }
-  vtkIdType cellIdA, cellIdB;
-
-  double x1[4], x2[4], xnew[4];
-  double ptsA[9], ptsB[9];
-  double boundsA[6], boundsB[6];
-  vtkIdType i, j, k, m, n, p, v;
-  double *point, in[4], out[4];
+// Contact between a cell of each input, in world coordinates
+struct Contact
+{
+  vtkIdType CellIdA;
+  vtkIdType CellIdB;
+  double X1[3];
+  double X2[3];
+};
 
-  // Loop thru the cells/points in IdsA
-  for (i = 0; i < numIdsA; i++)
-  {
-    cellIdA = IdsA->GetId(i);
-    pointIdsA = inputA->GetCell(cellIdA)->GetPointIds();
-    inputA->GetCellBounds(cellIdA, boundsA);
+int CollectLeafNodes(vtkOBBNode* nodeA, vtkOBBNode* nodeB, vtkMatrix4x4*, void* clientdata)
+{
+  std::vector<NodePair>* pairs = static_cast<std::vector<NodePair>*>(clientdata);
+  pairs->emplace_back(nodeA, nodeB);
+  return 1;
+}
 
-    // Initialize ptsA
-    // It might speed things up if ptsA and ptsB only had to be an
-    // array of pointers to the cell vertices, rather than allocating here.
-    for (j = 0; j < 3; j++)
-    {
-      for (k = 0; k < 3; k++)
-      {
-        ptsA[j * 3 + k] = inputA->GetPoints()->GetPoint(pointIdsA->GetId(j))[k];
-      }
-    }
+void TransformPoint(vtkMatrix4x4* matrix, const double x[3], double xnew[3])
+{
+  double in[4] = { x[0], x[1], x[2], 1.0 };
+  double out[4];
+  matrix->MultiplyPoint(in, out);
+  xnew[0] = out[0] / out[3];
+  xnew[1] = out[1] / out[3];
+  xnew[2] = out[2] / out[3];
+}
 
-    // Loop thru each cell IdsB and test for collision
-    for (m = 0; m < numIdsB; m++)
+// Test the cells of every pair of intersecting leaf nodes concurrently.
+// The contacts of a pair are listed in the order of the cells of its nodes.
+// In FirstContact mode, the pairs following the first pair having a contact
+// are skipped, and the index of this pair is returned (the number of pairs
+// otherwise).
+vtkIdType ComputeCollisions(vtkCollisionDetectionFilter* self, vtkPolyData* inputA,
+  vtkPolyData* inputB, vtkMatrix4x4* Xform, const std::vector<NodePair>& pairs,
+  std::vector<std::vector<Contact>>& contacts)
+{
+  // This is hard-coded for triangles but could be easily changed to allow for allow n-sided
+  // polygons
+  const vtkIdType numPairs = static_cast<vtkIdType>(pairs.size());
+  const int collisionMode = self->GetCollisionMode();
+  const bool firstContact = collisionMode == vtkCollisionDetectionFilter::VTK_FIRST_CONTACT;
+  const float tolerance = self->GetCellTolerance();
+  vtkMatrix4x4* matrix0 = self->GetMatrix(0);
+  std::atomic<vtkIdType> firstPair(numPairs);
+
+  contacts.resize(numPairs);
+  if (numPairs == 0)
+  {
+    return 0;
+  }
+
+  // GetCellBounds() builds the cell map of each input on first use, do it here
+  // rather than concurrently in the loop over the pairs.
+  double bounds[6];
+  inputA->GetCellBounds(0, bounds);
+  inputB->GetCellBounds(0, bounds);
+
+  vtkSMPThreadLocalObject<vtkIdList> tlPtIds;
+  vtkSMPTools::For(0, numPairs, [&](vtkIdType pairId, vtkIdType endPairId) {
+    vtkIdList* ptIds = tlPtIds.Local();
+    vtkIdType npts;
+    const vtkIdType* pts;
+    double x1[3], x2[3];
+    double ptsA[9], ptsB[9];
+    double boundsA[6], boundsB[6];
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; pairId < endPairId; ++pairId)
     {
-      cellIdB = IdsB->GetId(m);
-      pointIdsB = inputB->GetCell(cellIdB)->GetPointIds();
-      inputB->GetCellBounds(cellIdB, boundsB);
-
-      // Initialize ptsB
-      for (n = 0; n < 3; n++)
+      if (isFirst)
       {
-        point = inputB->GetPoints()->GetPoint(pointIdsB->GetId(n));
-        // transform the vertex
-        in[0] = point[0];
-        in[1] = point[1];
-        in[2] = point[2];
-        in[3] = 1.0;
-        Xform->MultiplyPoint(in, out);
-        out[0] = out[0] / out[3];
-        out[1] = out[1] / out[3];
-        out[2] = out[2] / out[3];
-        for (p = 0; p < 3; p++)
-        {
-          ptsB[n * 3 + p] = out[p];
-        }
+        self->CheckAbort();
       }
-      // Calculate the bounds for the xformed cell
-      boundsB[0] = boundsB[2] = boundsB[4] = VTK_DOUBLE_MAX;
-      boundsB[1] = boundsB[3] = boundsB[5] = VTK_DOUBLE_MIN;
-      for (v = 0; v < 9; v = v + 3)
+      if (self->GetAbortOutput() || pairId > firstPair.load(std::memory_order_relaxed))
       {
-        if (ptsB[v] < boundsB[0])
-          boundsB[0] = ptsB[v];
-        if (ptsB[v] > boundsB[1])
-          boundsB[1] = ptsB[v];
-        if (ptsB[v + 1] < boundsB[2])
-          boundsB[2] = ptsB[v + 1];
-        if (ptsB[v + 1] > boundsB[3])
-          boundsB[3] = ptsB[v + 1];
-        if (ptsB[v + 2] < boundsB[4])
-          boundsB[4] = ptsB[v + 2];
-        if (ptsB[v + 2] > boundsB[5])
-          boundsB[5] = ptsB[v + 2];
+        break;
       }
-      // Test for intersection
-      if (contactcells1 && contactcells2 &&
-        self->IntersectPolygonWithPolygon(
-          3, ptsA, boundsA, 3, ptsB, boundsB, Tolerance, x1, x2, self->GetCollisionMode()))
+      vtkIdList* IdsA = pairs[pairId].first->Cells;
+      vtkIdList* IdsB = pairs[pairId].second->Cells;
+      bool found = false;
+
+      // Loop thru the cells/points in IdsA
+      for (vtkIdType i = 0; i < IdsA->GetNumberOfIds() && !found; i++)
       {
-        contactcells1->InsertNextValue(cellIdA);
-        contactcells2->InsertNextValue(cellIdB);
-        // transform x back to "world space"
-        // could speed this up by testing for identity matrix
-        // and skipping the next transform.
-        x1[3] = x2[3] = 1.0;
-        self->GetMatrix(0)->MultiplyPoint(x1, xnew);
-        xnew[0] = xnew[0] / xnew[3];
-        xnew[1] = xnew[1] / xnew[3];
-        xnew[2] = xnew[2] / xnew[3];
-        cellPtIds[0] = contactpoints->InsertNextPoint(xnew);
-        if (self->GetCollisionMode() == vtkCollisionDetectionFilter::VTK_ALL_CONTACTS)
-        {
-          self->GetMatrix(0)->MultiplyPoint(x2, xnew);
-          xnew[0] = xnew[0] / xnew[3];
-          xnew[1] = xnew[1] / xnew[3];
-          xnew[2] = xnew[2] / xnew[3];
-          cellPtIds[1] = contactpoints->InsertNextPoint(xnew);
-          // insert a new line
-          cells->InsertNextCell(2, cellPtIds);
-        }
-        else
+        vtkIdType cellIdA = IdsA->GetId(i);
+        inputA->GetCellPoints(cellIdA, npts, pts, ptIds);
+        inputA->GetCellBounds(cellIdA, boundsA);
+        for (vtkIdType j = 0; j < 3; j++)
         {
-          // insert a new vert
-          cells->InsertNextCell(1, cellPtIds);
+          inputA->GetPoint(pts[j], ptsA + 3 * j);
         }
 
-        if (FirstContact)
+        // Loop thru each cell IdsB and test for collision
+        for (vtkIdType m = 0; m < IdsB->GetNumberOfIds() && !found; m++)
         {
-          // return the negative of the number of box tests to find first contact
-          // this will call a halt to the proceedings
-          if (DebugWasOn)
-            self->DebugOn();
-          return (-1 - self->GetNumberOfBoxTests());
+          vtkIdType cellIdB = IdsB->GetId(m);
+          inputB->GetCellPoints(cellIdB, npts, pts, ptIds);
+
+          // transform the vertices and calculate the bounds for the xformed cell
+          boundsB[0] = boundsB[2] = boundsB[4] = VTK_DOUBLE_MAX;
+          boundsB[1] = boundsB[3] = boundsB[5] = VTK_DOUBLE_MIN;
+          for (vtkIdType n = 0; n < 3; n++)
+          {
+            double* ptB = ptsB + 3 * n;
+            inputB->GetPoint(pts[n], ptB);
+            TransformPoint(Xform, ptB, ptB);
+            for (int k = 0; k < 3; k++)
+            {
+              boundsB[2 * k] = std::min(boundsB[2 * k], ptB[k]);
+              boundsB[2 * k + 1] = std::max(boundsB[2 * k + 1], ptB[k]);
+            }
+          }
+
+          // Test for intersection
+          if (self->IntersectPolygonWithPolygon(
+                3, ptsA, boundsA, 3, ptsB, boundsB, tolerance, x1, x2, collisionMode))
+          {
+            // transform x back to "world space"
+            Contact contact;
+            contact.CellIdA = cellIdA;
+            contact.CellIdB = cellIdB;
+            TransformPoint(matrix0, x1, contact.X1);
+            if (collisionMode == vtkCollisionDetectionFilter::VTK_ALL_CONTACTS)
+            {
+              TransformPoint(matrix0, x2, contact.X2);
+            }
+            contacts[pairId].push_back(contact);
+
+            if (firstContact)
+            {
+              found = true;
+              vtkIdType first = firstPair.load(std::memory_order_relaxed);
+              while (pairId < first && !firstPair.compare_exchange_weak(first, pairId))
+              {
+              }
+            }
+          }
         }
       }
     }
-  }
-  if (DebugWasOn)
-    self->DebugOn();
-  return 1;
+  });
+  return firstPair.load();
+}
 }
 
 // Description:
@@ -501,13 +491,43 @@ int vtkCollisionDetectionFilter::RequestData(vtkInformation* vtkNotUsed(request)
   Tree1->SetTolerance(this->BoxTolerance);
 
   // Do the collision detection...
-  int boxTests = Tree0->IntersectWithOBBTree(Tree1, matrix, ComputeCollisions, this);
+  std::vector<NodePair> pairs;
+  Tree0->IntersectWithOBBTree(Tree1, matrix, CollectLeafNodes, &pairs);
+  std::vector<std::vector<Contact>> contacts;
+  vtkIdType firstPair = ComputeCollisions(this, input[0], input[1], matrix, pairs, contacts);
+
+  // Add the contacts to the outputs in the order of the pairs
+  vtkCellArray* cells = this->CollisionMode == vtkCollisionDetectionFilter::VTK_ALL_CONTACTS
+    ? output[2]->GetLines()
+    : output[2]->GetVerts();
+  const vtkIdType numPairs = static_cast<vtkIdType>(pairs.size());
+  for (vtkIdType pairId = 0; pairId < numPairs && pairId <= firstPair; pairId++)
+  {
+    for (const Contact& contact : contacts[pairId])
+    {
+      contactcells0->InsertNextValue(contact.CellIdA);
+      contactcells1->InsertNextValue(contact.CellIdB);
+      vtkIdType cellPtIds[2];
+      cellPtIds[0] = contactsPoints->InsertNextPoint(contact.X1);
+      if (this->CollisionMode == vtkCollisionDetectionFilter::VTK_ALL_CONTACTS)
+      {
+        // insert a new line
+        cellPtIds[1] = contactsPoints->InsertNextPoint(contact.X2);
+        cells->InsertNextCell(2, cellPtIds);
+      }
+      else
+      {
+        // insert a new vert
+        cells->InsertNextCell(1, cellPtIds);
+      }
+    }
+  }
 
   matrix->Delete();
   tmpMatrix->Delete();
 
   vtkDebugMacro(<< "Collision detection finished");
-  this->NumberOfBoxTests = std::abs(boxTests);
+  this->NumberOfBoxTests = static_cast<int>(firstPair < numPairs ? firstPair + 1 : numPairs);
 
   // Generate the scalars if needed
   if (GenerateScalars)
@@ -16,6 +16,11 @@
  *  This class can be used to clip one polydata surface with another,
  *  using the Contacts output as a loop set in vtkSelectPolyData
  *
+ *  The cells of the intersecting leaf nodes of the two trees are tested
+ *  concurrently with vtkSMPTools. The contacts are output in the order of a
+ *  serial traversal of the trees, so the output does not depend on the
+ *  number of threads.
+ *
  * @authors Goodwin Lawlor, Bill Lorensen
  */
 
@@ -200,7 +205,9 @@ public:
 
   ///@{Description:
   /*
-   * Get the number of box tests
+   * Get the number of box tests, i.e. the number of pairs of intersecting
+   * leaf nodes whose cells were tested. In FirstContact mode, the pairs
+   * following the one holding the first contact are not counted.
    */
   vtkGetMacro(NumberOfBoxTests, int);
   ///@}
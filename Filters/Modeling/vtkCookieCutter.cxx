@@ -1318,6 +1318,7 @@ void vtkCookieCutterHelper::CropPoly(vtkIdType cellId, vtkIdType cellOffset, vtk
       }
     }
   }
+  pData->EditableOn();
   pData->BuildLinks();
 
   // Check the topology of the edges and ensure that it is valid.  If there
@@ -5,19 +5,86 @@
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkDoubleArray.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSphere.h"
 #include "vtkTriangleStrip.h"
 
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkFillHolesFilter);
 
+namespace
+{
+// Lock-free union-find over the free edges. Roots are always linked to the
+// smaller root, so that the root of a set is its smallest edge.
+struct LineUnionFind
+{
+  std::unique_ptr<std::atomic<vtkIdType>[]> Parents;
+
+  LineUnionFind(vtkIdType numLines)
+    : Parents(new std::atomic<vtkIdType>[numLines])
+  {
+    vtkSMPTools::For(0, numLines, [this](vtkIdType lineId, vtkIdType endLineId) {
+      for (; lineId < endLineId; ++lineId)
+      {
+        this->Parents[lineId].store(lineId, std::memory_order_relaxed);
+      }
+    });
+  }
+
+  vtkIdType Find(vtkIdType lineId) const
+  {
+    vtkIdType parent = this->Parents[lineId].load(std::memory_order_relaxed);
+    while (parent != lineId)
+    {
+      // Path halving: a stale write only makes the path longer, never wrong
+      vtkIdType grandParent = this->Parents[parent].load(std::memory_order_relaxed);
+      this->Parents[lineId].compare_exchange_weak(
+        parent, grandParent, std::memory_order_relaxed);
+      lineId = parent;
+      parent = this->Parents[lineId].load(std::memory_order_relaxed);
+    }
+    return lineId;
+  }
+
+  void Union(vtkIdType lineId0, vtkIdType lineId1)
+  {
+    for (;;)
+    {
+      lineId0 = this->Find(lineId0);
+      lineId1 = this->Find(lineId1);
+      if (lineId0 == lineId1)
+      {
+        return;
+      }
+      if (lineId0 < lineId1)
+      {
+        std::swap(lineId0, lineId1);
+      }
+      vtkIdType expected = lineId0;
+      if (this->Parents[lineId0].compare_exchange_strong(expected, lineId1))
+      {
+        return;
+      }
+    }
+  }
+};
+}
+
 //------------------------------------------------------------------------------
 vtkFillHolesFilter::vtkFillHolesFilter()
 {
@@ -85,137 +152,235 @@ int vtkFillHolesFilter::RequestData(vtkInformation* vtkNotUsed(request),
   }
   Mesh->BuildLinks();
 
-  // Allocate storage for lines/points (arbitrary allocation sizes)
-  //
-  vtkPolyData* Lines = vtkPolyData::New();
-  vtkCellArray* newLines = vtkCellArray::New();
-  newLines->AllocateEstimate(numPts / 10, 1);
-  Lines->SetLines(newLines);
-  Lines->SetPoints(inPts);
-
-  // grab all free edges and place them into a temporary polydata
-  bool abort = false;
-  vtkIdType cellId, p1, p2, numNei, i, numCells = newPolys->GetNumberOfCells();
-  vtkIdType progressInterval = numCells / 20 + 1;
-  vtkIdList* neighbors = vtkIdList::New();
-  neighbors->Allocate(VTK_CELL_SIZE);
-  for (cellId = 0, newPolys->InitTraversal(); newPolys->GetNextCell(npts, pts) && !abort; cellId++)
-  {
-    if (!(cellId % progressInterval)) // manage progress / early abort
+  // grab all free edges and place them into a temporary polydata. The free
+  // edges of every polygon are flagged concurrently, then written in order.
+  const vtkIdType numCells = newPolys->GetNumberOfCells();
+  std::vector<char> freeEdges(newPolys->GetNumberOfConnectivityIds());
+  std::vector<vtkIdType> lineOffsets(numCells + 1, 0);
+  vtkSMPThreadLocalObject<vtkIdList> tlNeighbors;
+  vtkSMPThreadLocalObject<vtkIdList> tlPtIds;
+  vtkSMPTools::For(0, numCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+    vtkIdList* neighbors = tlNeighbors.Local();
+    vtkIdList* ptIds = tlPtIds.Local();
+    vtkIdType cellSize;
+    const vtkIdType* cellPts;
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; cellId < endCellId; cellId++)
     {
-      this->UpdateProgress(static_cast<double>(cellId) / numCells);
-      abort = this->CheckAbort();
+      if (isFirst)
+      {
+        this->CheckAbort();
+      }
+      if (this->GetAbortOutput())
+      {
+        break;
+      }
+      newPolys->GetCellAtId(cellId, cellSize, cellPts, ptIds);
+      char* cellFreeEdges = freeEdges.data() + newPolys->GetOffset(cellId);
+      for (vtkIdType i = 0; i < cellSize; i++)
+      {
+        Mesh->GetCellEdgeNeighbors(cellId, cellPts[i], cellPts[(i + 1) % cellSize], neighbors);
+        cellFreeEdges[i] = neighbors->GetNumberOfIds() < 1 ? 1 : 0;
+        lineOffsets[cellId] += cellFreeEdges[i];
+      }
     }
+  });
+  vtkSMPTools::ExclusiveScan(
+    lineOffsets.begin(), lineOffsets.end(), lineOffsets.begin(), vtkIdType(0));
+  const vtkIdType numLines = lineOffsets[numCells];
 
-    for (i = 0; i < npts; i++)
+  vtkNew<vtkIdTypeArray> lineConnectivity;
+  lineConnectivity->SetNumberOfValues(2 * numLines);
+  vtkSMPTools::For(0, numCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+    vtkIdList* ptIds = tlPtIds.Local();
+    vtkIdType cellSize;
+    const vtkIdType* cellPts;
+    for (; cellId < endCellId; cellId++)
     {
-      p1 = pts[i];
-      p2 = pts[(i + 1) % npts];
-
-      Mesh->GetCellEdgeNeighbors(cellId, p1, p2, neighbors);
-      numNei = neighbors->GetNumberOfIds();
-
-      if (numNei < 1)
+      if (lineOffsets[cellId] == lineOffsets[cellId + 1])
       {
-        newLines->InsertNextCell(2);
-        newLines->InsertCellPoint(p1);
-        newLines->InsertCellPoint(p2);
+        continue;
+      }
+      newPolys->GetCellAtId(cellId, cellSize, cellPts, ptIds);
+      const char* cellFreeEdges = freeEdges.data() + newPolys->GetOffset(cellId);
+      vtkIdType* linePts = lineConnectivity->GetPointer(2 * lineOffsets[cellId]);
+      for (vtkIdType i = 0; i < cellSize; i++)
+      {
+        if (cellFreeEdges[i])
+        {
+          *linePts++ = cellPts[i];
+          *linePts++ = cellPts[(i + 1) % cellSize];
+        }
       }
     }
-  }
+  });
+  vtkNew<vtkCellArray> newLines;
+  newLines->SetData(2, lineConnectivity);
+  vtkNew<vtkPolyData> Lines;
+  Lines->SetLines(newLines);
+  Lines->SetPoints(inPts);
 
   // Track all free edges and see whether polygons can be built from them.
   // For each polygon of appropriate HoleSize, triangulate the hole and
   // add to the output list of cells
-  numCells = newLines->GetNumberOfCells();
   vtkCellArray* newCells = nullptr;
-  if (numCells >= 3) // only do the work if there are free edges
+  if (numLines >= 3 && !this->GetAbortOutput()) // only do the work if there are free edges
   {
-    double sphere[4];
-    vtkIdType startId, neiId, currentCellId, hints[2];
-    hints[0] = 0;
-    hints[1] = 0;
-    vtkPolygon* polygon = vtkPolygon::New();
-    polygon->Points->SetDataTypeToDouble();
-    vtkIdList* endId = vtkIdList::New();
-    endId->SetNumberOfIds(1);
-    char* visited = new char[numCells];
-    memset(visited, 0, numCells);
     Lines->BuildLinks(); // build the neighbor data structure
-    newCells = vtkCellArray::New();
-    newCells->DeepCopy(inPolys);
 
-    for (cellId = 0; cellId < numCells && !abort; cellId++)
-    {
-      abort = this->CheckAbort();
-      if (!visited[cellId])
+    // A loop only goes from a line to the next one when they are the only
+    // lines using their common point. The lines joined this way form chains
+    // that are walked independently, and concurrently.
+    LineUnionFind chains(numLines);
+    vtkSMPThreadLocalObject<vtkIdList> tlEndId;
+    vtkSMPTools::For(0, numLines, [&](vtkIdType lineId, vtkIdType endLineId) {
+      vtkIdList* neighbors = tlNeighbors.Local();
+      vtkIdList* endId = tlEndId.Local();
+      endId->SetNumberOfIds(1);
+      const vtkIdType* linePts = lineConnectivity->GetPointer(0);
+      for (; lineId < endLineId; lineId++)
       {
-        visited[cellId] = 1;
-        // Setup the polygon
-        Lines->GetCellPoints(cellId, npts, pts);
-        startId = pts[0];
-        polygon->PointIds->Reset();
-        polygon->Points->Reset();
-        polygon->PointIds->InsertId(0, pts[0]);
-        polygon->Points->InsertPoint(0, inPts->GetPoint(pts[0]));
-
-        // Work around the loop and terminate when the loop ends
-        endId->SetId(0, pts[1]);
-        int valid = 1;
-        currentCellId = cellId;
-        while (startId != endId->GetId(0) && valid)
+        for (vtkIdType i = 0; i < 2; i++)
         {
-          polygon->PointIds->InsertNextId(endId->GetId(0));
-          polygon->Points->InsertNextPoint(inPts->GetPoint(endId->GetId(0)));
-          Lines->GetCellNeighbors(currentCellId, endId, neighbors);
-          if (neighbors->GetNumberOfIds() == 0)
-          {
-            valid = 0;
-          }
-          else if (neighbors->GetNumberOfIds() > 1)
+          endId->SetId(0, linePts[2 * lineId + i]);
+          Lines->GetCellNeighbors(lineId, endId, neighbors);
+          if (neighbors->GetNumberOfIds() == 1)
           {
-            // have to logically split this vertex
-            valid = 0;
+            chains.Union(lineId, neighbors->GetId(0));
           }
-          else
+        }
+      }
+    });
+
+    // Sort the lines by chain. The root of a chain is its smallest line.
+    std::vector<std::pair<vtkIdType, vtkIdType>> chainLines(numLines);
+    vtkSMPTools::For(0, numLines, [&](vtkIdType lineId, vtkIdType endLineId) {
+      for (; lineId < endLineId; lineId++)
+      {
+        chainLines[lineId] = std::make_pair(chains.Find(lineId), lineId);
+      }
+    });
+    vtkSMPTools::Sort(chainLines.begin(), chainLines.end());
+    std::vector<vtkIdType> chainOffsets;
+    for (vtkIdType i = 0; i < numLines; i++)
+    {
+      if (i == 0 || chainLines[i].first != chainLines[i - 1].first)
+      {
+        chainOffsets.push_back(i);
+      }
+    }
+    chainOffsets.push_back(numLines);
+    const vtkIdType numChains = static_cast<vtkIdType>(chainOffsets.size()) - 1;
+
+    // Walk the loops of every chain, starting from its lines in increasing
+    // order. The triangles filling a loop are stored with its first line.
+    std::vector<char> visited(numLines, 0);
+    std::vector<std::vector<vtkIdType>> loopTriangles(numLines);
+    vtkSMPThreadLocalObject<vtkPolygon> tlPolygon;
+    vtkSMPThreadLocalObject<vtkIdList> tlTriangles;
+    vtkSMPTools::For(0, numChains, [&](vtkIdType chainId, vtkIdType endChainId) {
+      vtkIdList* neighbors = tlNeighbors.Local();
+      vtkIdList* endId = tlEndId.Local();
+      endId->SetNumberOfIds(1);
+      vtkIdList* triangles = tlTriangles.Local();
+      vtkPolygon* polygon = tlPolygon.Local();
+      polygon->Points->SetDataTypeToDouble();
+      const vtkIdType* linePts = lineConnectivity->GetPointer(0);
+      double sphere[4], x[3];
+      vtkIdType startId, neiId, currentCellId, hints[2];
+      hints[0] = 0;
+      hints[1] = 0;
+      bool isFirst = vtkSMPTools::GetSingleThread();
+      for (; chainId < endChainId; chainId++)
+      {
+        if (isFirst)
+        {
+          this->CheckAbort();
+        }
+        if (this->GetAbortOutput())
+        {
+          break;
+        }
+        for (vtkIdType i = chainOffsets[chainId]; i < chainOffsets[chainId + 1]; i++)
+        {
+          const vtkIdType cellId = chainLines[i].second;
+          if (visited[cellId])
           {
-            neiId = neighbors->GetId(0);
-            visited[neiId] = 1;
-            Lines->GetCellPoints(neiId, npts, pts);
-            endId->SetId(0, (pts[0] != endId->GetId(0) ? pts[0] : pts[1]));
-            currentCellId = neiId;
+            continue;
           }
-        } // while loop connected
+          visited[cellId] = 1;
+          // Setup the polygon
+          const vtkIdType* pts = linePts + 2 * cellId;
+          startId = pts[0];
+          polygon->PointIds->Reset();
+          polygon->Points->Reset();
+          polygon->PointIds->InsertId(0, pts[0]);
+          inPts->GetPoint(pts[0], x);
+          polygon->Points->InsertPoint(0, x);
 
-        // Evaluate the size of the loop and see if it is small enough
-        if (valid)
-        {
-          vtkSphere::ComputeBoundingSphere(
-            static_cast<vtkDoubleArray*>(polygon->Points->GetData())->GetPointer(0),
-            polygon->PointIds->GetNumberOfIds(), sphere, hints);
-          if (sphere[3] <= this->HoleSize)
+          // Work around the loop and terminate when the loop ends
+          endId->SetId(0, pts[1]);
+          int valid = 1;
+          currentCellId = cellId;
+          while (startId != endId->GetId(0) && valid)
           {
-            // Now triangulate the loop and pass to the output
-            polygon->NonDegenerateTriangulate(neighbors);
-            for (i = 0; i < neighbors->GetNumberOfIds(); i += 3)
+            polygon->PointIds->InsertNextId(endId->GetId(0));
+            inPts->GetPoint(endId->GetId(0), x);
+            polygon->Points->InsertNextPoint(x);
+            Lines->GetCellNeighbors(currentCellId, endId, neighbors);
+            if (neighbors->GetNumberOfIds() == 0)
             {
-              newCells->InsertNextCell(3);
-              newCells->InsertCellPoint(polygon->PointIds->GetId(neighbors->GetId(i)));
-              newCells->InsertCellPoint(polygon->PointIds->GetId(neighbors->GetId(i + 1)));
-              newCells->InsertCellPoint(polygon->PointIds->GetId(neighbors->GetId(i + 2)));
+              valid = 0;
             }
-          } // if hole small enough
-        }   // if a valid loop
-      }     // if not yet visited a line
-    }       // for all lines
-    polygon->Delete();
-    endId->Delete();
-    delete[] visited;
+            else if (neighbors->GetNumberOfIds() > 1)
+            {
+              // have to logically split this vertex
+              valid = 0;
+            }
+            else
+            {
+              neiId = neighbors->GetId(0);
+              visited[neiId] = 1;
+              pts = linePts + 2 * neiId;
+              endId->SetId(0, (pts[0] != endId->GetId(0) ? pts[0] : pts[1]));
+              currentCellId = neiId;
+            }
+          } // while loop connected
+
+          // Evaluate the size of the loop and see if it is small enough
+          if (valid)
+          {
+            vtkSphere::ComputeBoundingSphere(
+              static_cast<vtkDoubleArray*>(polygon->Points->GetData())->GetPointer(0),
+              polygon->PointIds->GetNumberOfIds(), sphere, hints);
+            if (sphere[3] <= this->HoleSize)
+            {
+              // Now triangulate the loop
+              polygon->NonDegenerateTriangulate(triangles);
+              std::vector<vtkIdType>& loop = loopTriangles[cellId];
+              loop.resize(triangles->GetNumberOfIds());
+              for (vtkIdType j = 0; j < triangles->GetNumberOfIds(); j++)
+              {
+                loop[j] = polygon->PointIds->GetId(triangles->GetId(j));
+              }
+            } // if hole small enough
+          }   // if a valid loop
+        }     // for all lines of the chain
+      }       // for all chains
+    });
+
+    // Pass the triangles to the output in the order of the loops
+    newCells = vtkCellArray::New();
+    newCells->DeepCopy(inPolys);
+    for (const auto& loop : loopTriangles)
+    {
+      for (size_t j = 0; j < loop.size(); j += 3)
+      {
+        newCells->InsertNextCell({ loop[j], loop[j + 1], loop[j + 2] });
+      }
+    }
   } // if loops present in the input
 
-  // Clean up
-  neighbors->Delete();
-  Lines->Delete();
 
   // No new points are created, so the points and point data can be passed
   // through to the output.
@@ -239,7 +404,6 @@ int vtkFillHolesFilter::RequestData(vtkInformation* vtkNotUsed(request),
   output->SetStrips(input->GetStrips());
 
   Mesh->Delete();
-  newLines->Delete();
   return 1;
 }
 
@@ -10,6 +10,11 @@
  * triangulating the resulting loops. Note that you can specify
  * an approximate limit to the size of the hole that can be filled.
  *
+ * The boundary edges are identified with vtkSMPTools, and the loops are
+ * assembled and triangulated concurrently. Boundary edges meeting at points
+ * used by exactly two of them form chains that are walked independently,
+ * so the holes are filled exactly as with a serial traversal of the edges.
+ *
  * @warning
  * Note that any mesh with boundary edges by definition has a
  * topological hole. This even includes a reactangular grid
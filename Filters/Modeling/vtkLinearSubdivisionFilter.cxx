@@ -3,11 +3,15 @@
 #include "vtkLinearSubdivisionFilter.h"
 
 #include "vtkCellArray.h"
-#include "vtkEdgeTable.h"
 #include "vtkIdList.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+
+#include <atomic>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkLinearSubdivisionFilter);
@@ -20,75 +24,62 @@ void vtkLinearSubdivisionFilter::PrintSelf(ostream& os, vtkIndent indent)
 int vtkLinearSubdivisionFilter::GenerateSubdivisionPoints(
   vtkPolyData* inputDS, vtkIntArray* edgeData, vtkPoints* outputPts, vtkPointData* outputPD)
 {
-  const vtkIdType* pts = nullptr;
-  int edgeId;
-  vtkIdType npts, cellId, newId;
-  vtkIdType p1, p2;
-  vtkCellArray* inputPolys = inputDS->GetPolys();
-  vtkSmartPointer<vtkIdList> cellIds = vtkSmartPointer<vtkIdList>::New();
-  vtkSmartPointer<vtkIdList> pointIds = vtkSmartPointer<vtkIdList>::New();
-  vtkSmartPointer<vtkEdgeTable> edgeTable = vtkSmartPointer<vtkEdgeTable>::New();
   vtkPoints* inputPts = inputDS->GetPoints();
   vtkPointData* inputPD = inputDS->GetPointData();
+  const vtkIdType numPts = inputDS->GetNumberOfPoints();
   static double weights[2] = { .5, .5 };
 
-  // Create an edge table to keep track of which edges we've processed
-  edgeTable->InitEdgeInsertion(inputDS->GetNumberOfPoints());
-
-  pointIds->SetNumberOfIds(2);
-
-  double total = inputPolys->GetNumberOfCells();
-  double curr = 0;
-  bool abort = false;
+  // The new points, inserted on the edges, follow the old points
+  std::vector<vtkIdType> edgePoints;
+  const vtkIdType numEdges = this->NumberEdges(inputDS, numPts, edgeData, edgePoints);
+  outputPts->SetNumberOfPoints(numPts + numEdges);
+  outputPD->SetNumberOfTuples(numPts + numEdges);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    for (; ptId < endPtId; ptId++)
+    {
+      outputPD->CopyData(inputPD, ptId, ptId);
+    }
+  });
 
   // Generate new points for subdivisions surface
-  for (cellId = 0, inputPolys->InitTraversal(); !abort && inputPolys->GetNextCell(npts, pts);
-       cellId++)
-  {
-    p1 = pts[2];
-    p2 = pts[0];
-
-    for (edgeId = 0; edgeId < 3; edgeId++)
+  std::atomic<bool> nonManifold(false);
+  vtkSMPThreadLocalObject<vtkIdList> tlCellIds;
+  vtkSMPThreadLocalObject<vtkIdList> tlPointIds;
+  vtkSMPTools::For(0, numEdges, [&](vtkIdType edgeId, vtkIdType endEdgeId) {
+    vtkIdList* cellIds = tlCellIds.Local();
+    vtkIdList* pointIds = tlPointIds.Local();
+    pointIds->SetNumberOfIds(2);
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; edgeId < endEdgeId; edgeId++)
     {
-      abort = this->CheckAbort();
-      if (abort)
+      if (isFirst)
       {
-        break;
+        this->CheckAbort();
       }
-      outputPD->CopyData(inputPD, p1, p1);
-      outputPD->CopyData(inputPD, p2, p2);
-
-      // Do we need to create a point on this edge?
-      if (edgeTable->IsEdge(p1, p2) == -1)
-      {
-        edgeTable->InsertEdge(p1, p2);
-
-        inputDS->GetCellEdgeNeighbors(-1, p1, p2, cellIds);
-        if (cellIds->GetNumberOfIds() > 2)
-        {
-          vtkErrorMacro("Dataset is non-manifold and cannot be subdivided.");
-          return 0;
-        }
-        // Compute Position andnew PointData using the same subdivision scheme
-        pointIds->SetId(0, p1);
-        pointIds->SetId(1, p2);
-        newId = this->InterpolatePosition(inputPts, outputPts, pointIds, weights);
-        outputPD->InterpolatePoint(inputPD, newId, pointIds, weights);
-      }
-      else // we have already created a point on this edge. find it
+      if (this->GetAbortOutput())
       {
-        newId = this->FindEdge(inputDS, cellId, p1, p2, edgeData, cellIds);
+        break;
       }
-      edgeData->InsertComponent(cellId, edgeId, newId);
-      p1 = p2;
-      if (edgeId < 2)
+      const vtkIdType p1 = edgePoints[2 * edgeId];
+      const vtkIdType p2 = edgePoints[2 * edgeId + 1];
+      inputDS->GetCellEdgeNeighbors(-1, p1, p2, cellIds);
+      if (cellIds->GetNumberOfIds() > 2)
       {
-        p2 = pts[edgeId + 1];
+        nonManifold.store(true, std::memory_order_relaxed);
+        continue;
       }
-    } // each edge
-    this->UpdateProgress(curr / total);
-    curr += 1;
-  } // each cell
+      // Compute Position andnew PointData using the same subdivision scheme
+      pointIds->SetId(0, p1);
+      pointIds->SetId(1, p2);
+      this->InterpolatePosition(inputPts, outputPts, numPts + edgeId, pointIds, weights);
+      outputPD->InterpolatePoint(inputPD, numPts + edgeId, pointIds, weights);
+    }
+  });
+  if (nonManifold)
+  {
+    vtkErrorMacro("Dataset is non-manifold and cannot be subdivided.");
+    return 0;
+  }
 
   return 1;
 }
@@ -2,20 +2,24 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkLoopSubdivisionFilter.h"
 
-#include "vtkCell.h"
 #include "vtkCellArray.h"
 #include "vtkCellIterator.h"
-#include "vtkEdgeTable.h"
 #include "vtkIdList.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
+#include <atomic>
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkLoopSubdivisionFilter);
 
@@ -30,98 +34,102 @@ static const double LoopWeights[4] = { .375, .375, .125, .125 };
 int vtkLoopSubdivisionFilter::GenerateSubdivisionPoints(
   vtkPolyData* inputDS, vtkIntArray* edgeData, vtkPoints* outputPts, vtkPointData* outputPD)
 {
-  const vtkIdType* pts = nullptr;
-  vtkIdType numPts, cellId, newId;
-  int edgeId;
-  vtkIdType npts;
-  vtkIdType p1, p2;
-  vtkCellArray* inputPolys = inputDS->GetPolys();
-  vtkSmartPointer<vtkIdList> cellIds = vtkSmartPointer<vtkIdList>::New();
-  vtkSmartPointer<vtkIdList> stencil = vtkSmartPointer<vtkIdList>::New();
-  vtkSmartPointer<vtkEdgeTable> edgeTable = vtkSmartPointer<vtkEdgeTable>::New();
   vtkPoints* inputPts = inputDS->GetPoints();
   vtkPointData* inputPD = inputDS->GetPointData();
+  const vtkIdType numPts = inputDS->GetNumberOfPoints();
 
-  double weights[256];
-  bool abort = false;
-
-  // Create an edge table to keep track of which edges we've processed
-  edgeTable->InitEdgeInsertion(inputDS->GetNumberOfPoints());
+  // The odd points, inserted on the edges, follow the even points
+  std::vector<vtkIdType> edgePoints;
+  const vtkIdType numEdges = this->NumberEdges(inputDS, numPts, edgeData, edgePoints);
+  outputPts->SetNumberOfPoints(numPts + numEdges);
+  outputPD->SetNumberOfTuples(numPts + numEdges);
 
   // Generate even points. these are derived from the old points
-  numPts = inputDS->GetNumberOfPoints();
-  for (vtkIdType ptId = 0; ptId < numPts; ptId++)
-  {
-    abort = this->CheckAbort();
-    if (abort)
+  std::atomic<bool> failed(false);
+  vtkSMPThreadLocalObject<vtkIdList> tlStencil;
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    vtkIdList* stencil = tlStencil.Local();
+    double weights[256];
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; ptId < endPtId && !failed.load(std::memory_order_relaxed); ptId++)
     {
-      break;
-    }
-    if (this->GenerateEvenStencil(ptId, inputDS, stencil, weights))
-    {
-      this->InterpolatePosition(inputPts, outputPts, stencil, weights);
+      if (isFirst)
+      {
+        this->CheckAbort();
+      }
+      if (this->GetAbortOutput())
+      {
+        break;
+      }
+      if (!this->GenerateEvenStencil(ptId, inputDS, stencil, weights))
+      {
+        failed.store(true, std::memory_order_relaxed);
+        break;
+      }
+      this->InterpolatePosition(inputPts, outputPts, ptId, stencil, weights);
       outputPD->InterpolatePoint(inputPD, ptId, stencil, weights);
     }
-    else
-    {
-      return 0;
-    }
-  }
-
-  // Generate odd points. These will be inserted into the new dataset
-  for (cellId = 0, inputPolys->InitTraversal(); !abort && inputPolys->GetNextCell(npts, pts);
-       cellId++)
+  });
+  if (failed)
   {
-    // start with one edge
-    p1 = pts[2];
-    p2 = pts[0];
+    return 0;
+  }
 
-    for (edgeId = 0; edgeId < 3; edgeId++)
+  // Generate odd points. The first non-manifold edge is reported.
+  std::atomic<vtkIdType> nonManifoldEdge(numEdges);
+  vtkSMPThreadLocalObject<vtkIdList> tlCellIds;
+  vtkSMPTools::For(0, numEdges, [&](vtkIdType edgeId, vtkIdType endEdgeId) {
+    vtkIdList* cellIds = tlCellIds.Local();
+    vtkIdList* stencil = tlStencil.Local();
+    double weights[4];
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; edgeId < endEdgeId; edgeId++)
     {
-      abort = this->CheckAbort();
-      if (abort)
+      if (isFirst)
       {
-        break;
+        this->CheckAbort();
       }
-      // Do we need to create a point on this edge?
-      if (edgeTable->IsEdge(p1, p2) == -1)
+      if (this->GetAbortOutput())
       {
-        edgeTable->InsertEdge(p1, p2);
-        inputDS->GetCellEdgeNeighbors(-1, p1, p2, cellIds);
-        if (cellIds->GetNumberOfIds() == 1)
-        {
-          // Compute new Position and PointData using the same subdivision scheme
-          stencil->SetNumberOfIds(2);
-          stencil->SetId(0, p1);
-          stencil->SetId(1, p2);
-          weights[0] = .5;
-          weights[1] = .5;
-        } // boundary edge
-        else if (cellIds->GetNumberOfIds() == 2)
-        {
-          this->GenerateOddStencil(p1, p2, inputDS, stencil, weights);
-        }
-        else
-        {
-          vtkErrorMacro("Dataset is non-manifold and cannot be subdivided. Edge shared by "
-            << cellIds->GetNumberOfIds() << " cells");
-          return 0;
-        }
-        newId = this->InterpolatePosition(inputPts, outputPts, stencil, weights);
-        outputPD->InterpolatePoint(inputPD, newId, stencil, weights);
+        break;
       }
-      else // we have already created a point on this edge. find it
+      const vtkIdType p1 = edgePoints[2 * edgeId];
+      const vtkIdType p2 = edgePoints[2 * edgeId + 1];
+      inputDS->GetCellEdgeNeighbors(-1, p1, p2, cellIds);
+      if (cellIds->GetNumberOfIds() == 1)
       {
-        newId = this->FindEdge(inputDS, cellId, p1, p2, edgeData, cellIds);
+        // Compute new Position and PointData using the same subdivision scheme
+        stencil->SetNumberOfIds(2);
+        stencil->SetId(0, p1);
+        stencil->SetId(1, p2);
+        weights[0] = .5;
+        weights[1] = .5;
+      } // boundary edge
+      else if (cellIds->GetNumberOfIds() == 2)
+      {
+        this->GenerateOddStencil(p1, p2, inputDS, stencil, weights);
       }
-      edgeData->InsertComponent(cellId, edgeId, newId);
-      p1 = p2;
-      if (edgeId < 2)
+      else
       {
-        p2 = pts[edgeId + 1];
+        vtkIdType firstEdgeId = nonManifoldEdge.load(std::memory_order_relaxed);
+        while (edgeId < firstEdgeId && !nonManifoldEdge.compare_exchange_weak(firstEdgeId, edgeId))
+        {
+        }
+        continue;
       }
-    } // each interior edge
-  }   // each cell
+      this->InterpolatePosition(inputPts, outputPts, numPts + edgeId, stencil, weights);
+      outputPD->InterpolatePoint(inputPD, numPts + edgeId, stencil, weights);
+    }
+  });
+  if (nonManifoldEdge < numEdges)
+  {
+    vtkNew<vtkIdList> cellIds;
+    const vtkIdType edgeId = nonManifoldEdge;
+    inputDS->GetCellEdgeNeighbors(-1, edgePoints[2 * edgeId], edgePoints[2 * edgeId + 1], cellIds);
+    vtkErrorMacro("Dataset is non-manifold and cannot be subdivided. Edge shared by "
+      << cellIds->GetNumberOfIds() << " cells");
+    return 0;
+  }
 
   return 1;
 }
@@ -132,7 +140,8 @@ int vtkLoopSubdivisionFilter::GenerateEvenStencil(
 {
   vtkSmartPointer<vtkIdList> cellIds = vtkSmartPointer<vtkIdList>::New();
   vtkSmartPointer<vtkIdList> ptIds = vtkSmartPointer<vtkIdList>::New();
-  vtkCell* cell;
+  vtkIdType npts;
+  const vtkIdType* pts;
 
   int i;
   vtkIdType j;
@@ -179,11 +188,11 @@ int vtkLoopSubdivisionFilter::GenerateEvenStencil(
   // walk around the loop counter-clockwise and get cells
   for (j = 0; j < numCellsInLoop; j++)
   {
-    cell = polys->GetCell(nextCell);
+    polys->GetCellPoints(nextCell, npts, pts, ptIds);
     p = -1;
     for (i = 0; i < 3; i++)
     {
-      if ((p = cell->GetPointId(i)) != p1 && cell->GetPointId(i) != p2)
+      if ((p = pts[i]) != p1 && pts[i] != p2)
       {
         break;
       }
@@ -206,11 +215,11 @@ int vtkLoopSubdivisionFilter::GenerateEvenStencil(
   p2 = bp1;
   for (; j < numCellsInLoop && startCell != -1; j++)
   {
-    cell = polys->GetCell(nextCell);
+    polys->GetCellPoints(nextCell, npts, pts, ptIds);
     p = -1;
     for (i = 0; i < 3; i++)
     {
-      if ((p = cell->GetPointId(i)) != p1 && cell->GetPointId(i) != p2)
+      if ((p = pts[i]) != p1 && pts[i] != p2)
       {
         break;
       }
@@ -267,7 +276,9 @@ void vtkLoopSubdivisionFilter::GenerateOddStencil(
   vtkIdType p1, vtkIdType p2, vtkPolyData* polys, vtkIdList* stencilIds, double* weights)
 {
   vtkSmartPointer<vtkIdList> cellIds = vtkSmartPointer<vtkIdList>::New();
-  vtkCell* cell;
+  vtkSmartPointer<vtkIdList> ptIds = vtkSmartPointer<vtkIdList>::New();
+  vtkIdType npts;
+  const vtkIdType* pts;
   int i;
   vtkIdType cell0, cell1;
   vtkIdType p3 = 0, p4 = 0;
@@ -276,18 +287,18 @@ void vtkLoopSubdivisionFilter::GenerateOddStencil(
   cell0 = cellIds->GetId(0);
   cell1 = cellIds->GetId(1);
 
-  cell = polys->GetCell(cell0);
+  polys->GetCellPoints(cell0, npts, pts, ptIds);
   for (i = 0; i < 3; i++)
   {
-    if ((p3 = cell->GetPointId(i)) != p1 && cell->GetPointId(i) != p2)
+    if ((p3 = pts[i]) != p1 && pts[i] != p2)
     {
       break;
     }
   }
-  cell = polys->GetCell(cell1);
+  polys->GetCellPoints(cell1, npts, pts, ptIds);
   for (i = 0; i < 3; i++)
   {
-    if ((p4 = cell->GetPointId(i)) != p1 && cell->GetPointId(i) != p2)
+    if ((p4 = pts[i]) != p1 && pts[i] != p2)
     {
       break;
     }
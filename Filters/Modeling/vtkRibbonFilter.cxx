@@ -2,17 +2,25 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkRibbonFilter.h"
 
+#include "vtkArrayListTemplate.h"
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
+#include "vtkDoubleArray.h"
 #include "vtkFloatArray.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkPolyLine.h"
+#include "vtkSMPTools.h"
+
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkRibbonFilter);
@@ -45,6 +53,63 @@ vtkRibbonFilter::vtkRibbonFilter()
 
 vtkRibbonFilter::~vtkRibbonFilter() = default;
 
+namespace
+{
+// Scratch data used to ribbon one polyline at a time. Each thread uses its
+// own instance.
+struct LineScratch
+{
+  vtkNew<vtkIdList> CellIds;
+  vtkNew<vtkPoints> Points;
+  vtkNew<vtkCellArray> Line;
+  vtkNew<vtkDoubleArray> Normals;
+
+  LineScratch()
+  {
+    this->Points->SetDataTypeToDouble();
+    this->Normals->SetNumberOfComponents(3);
+  }
+
+  // Compute the normals of the points of a polyline. Each polyline computes
+  // its normals independently, avoiding conflicts at shared vertices.
+  void ComputeNormals(vtkIdType npts, const vtkIdType* pts, vtkPoints* inPts,
+    vtkDataArray* inNormals, const double defaultNormal[3], bool generateNormals)
+  {
+    this->Normals->SetNumberOfTuples(npts);
+    if (generateNormals)
+    {
+      this->Points->SetNumberOfPoints(npts);
+      this->Line->Reset();
+      this->Line->InsertNextCell(static_cast<int>(npts));
+      double x[3];
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        inPts->GetPoint(pts[i], x);
+        this->Points->SetPoint(i, x);
+        this->Line->InsertCellPoint(i);
+      }
+      vtkPolyLine::GenerateSlidingNormals(this->Points, this->Line, this->Normals);
+    }
+    else
+    {
+      double n[3];
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        if (inNormals)
+        {
+          inNormals->GetTuple(pts[i], n);
+          this->Normals->SetTuple(i, n);
+        }
+        else
+        {
+          this->Normals->SetTuple(i, defaultNormal);
+        }
+      }
+    }
+  }
+};
+}
+
 int vtkRibbonFilter::RequestData(vtkInformation* vtkNotUsed(request),
   vtkInformationVector** inputVector, vtkInformationVector* outputVector)
 {
@@ -69,17 +134,10 @@ int vtkRibbonFilter::RequestData(vtkInformation* vtkNotUsed(request),
   vtkIdType numLines;
   vtkIdType numNewPts, numNewCells;
   vtkPoints* newPts;
-  int deleteNormals = 0;
   vtkFloatArray* newNormals;
-  vtkIdType i;
   double range[2];
   vtkCellArray* newStrips;
-  vtkIdType npts = 0;
-  const vtkIdType* pts = nullptr;
-  vtkIdType offset = 0;
   vtkFloatArray* newTCoords = nullptr;
-  bool abort = false;
-  vtkIdType inCellId;
 
   // Check input and initialize
   //
@@ -91,53 +149,18 @@ int vtkRibbonFilter::RequestData(vtkInformation* vtkNotUsed(request),
     return 1;
   }
 
-  // Create the geometry and topology
-  numNewPts = 2 * numPts;
-  newPts = vtkPoints::New();
-  newPts->Allocate(numNewPts);
-  newNormals = vtkFloatArray::New();
-  newNormals->SetNumberOfComponents(3);
-  newNormals->Allocate(3 * numNewPts);
-  newStrips = vtkCellArray::New();
-  newStrips->AllocateEstimate(1, numNewPts);
-  vtkCellArray* singlePolyline = vtkCellArray::New();
-
-  // Point data: copy scalars, vectors, tcoords. Normals may be computed here.
-  outPD->CopyNormalsOff();
-  if ((this->GenerateTCoords == VTK_TCOORDS_FROM_SCALARS && inScalars) ||
-    this->GenerateTCoords == VTK_TCOORDS_FROM_LENGTH ||
-    this->GenerateTCoords == VTK_TCOORDS_FROM_NORMALIZED_LENGTH)
+  bool generateNormals = false;
+  inNormals = this->GetInputArrayToProcess(1, inputVector);
+  if (this->UseDefaultNormal)
   {
-    newTCoords = vtkFloatArray::New();
-    newTCoords->SetNumberOfComponents(2);
-    newTCoords->Allocate(numNewPts);
-    outPD->CopyTCoordsOff();
+    inNormals = nullptr;
   }
-  outPD->CopyAllocate(pd, numNewPts);
-
-  int generateNormals = 0;
-  inNormals = this->GetInputArrayToProcess(1, inputVector);
-  if (!inNormals || this->UseDefaultNormal)
+  else if (!inNormals)
   {
-    deleteNormals = 1;
-    inNormals = vtkFloatArray::New();
-    inNormals->SetNumberOfComponents(3);
-    inNormals->SetNumberOfTuples(numPts);
-
-    if (this->UseDefaultNormal)
-    {
-      for (i = 0; i < numPts; i++)
-      {
-        inNormals->SetTuple(i, this->DefaultNormal);
-      }
-    }
-    else
-    {
-      // Normal generation has been moved to lower in the function.
-      // This allows each different polylines to share vertices, but have
-      // their normals (and hence their ribbons) calculated independently
-      generateNormals = 1;
-    }
+    // Normals are generated for each polyline independently. This allows
+    // different polylines to share vertices, but have their normals (and
+    // hence their ribbons) calculated independently.
+    generateNormals = true;
   }
 
   // If varying width, get appropriate info.
@@ -152,77 +175,136 @@ int vtkRibbonFilter::RequestData(vtkInformation* vtkNotUsed(request),
     }
   }
 
-  // Copy selected parts of cell data; certainly don't want normals
-  //
-  numNewCells = inLines->GetNumberOfCells();
-  outCD->CopyNormalsOff();
-  outCD->CopyAllocate(cd, numNewCells);
-
-  //  Create points along each polyline that are connected into NumberOfSides
-  //  triangle strips. Texture coordinates are optionally generated.
-  //
   this->Theta = vtkMath::RadiansFromDegrees(this->Angle);
-  vtkPolyLine* lineNormalGenerator = vtkPolyLine::New();
-  for (inCellId = 0, inLines->InitTraversal(); inLines->GetNextCell(npts, pts) && !abort;
-       inCellId++)
-  {
-    this->UpdateProgress((double)inCellId / numLines);
-    abort = this->CheckAbort();
 
-    if (npts < 2)
+  // First pass: count the points generated by each polyline. Polylines that
+  // cannot be ribboned generate nothing.
+  std::vector<vtkIdType> pointOffsets(numLines + 1, 0);
+  std::vector<vtkIdType> cellOffsets(numLines + 1, 0);
+  vtkSMPTools::For(0, numLines, [&](vtkIdType lineId, vtkIdType endLineId) {
+    LineScratch scratch;
+    vtkIdType npts;
+    const vtkIdType* pts;
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; lineId < endLineId; ++lineId)
     {
-      vtkWarningMacro(<< "Less than two points in line!");
-      continue; // skip tubing this polyline
-    }
-
-    // If necessary calculate normals, each polyline calculates its
-    // normals independently, avoiding conflicts at shared vertices.
-    if (generateNormals)
-    {
-      singlePolyline->Reset(); // avoid instantiation
-      singlePolyline->InsertNextCell(npts, pts);
-      if (!vtkPolyLine::GenerateSlidingNormals(inPts, singlePolyline, inNormals))
+      if (isFirst)
+      {
+        this->CheckAbort();
+      }
+      if (this->GetAbortOutput())
+      {
+        break;
+      }
+      inLines->GetCellAtId(lineId, npts, pts, scratch.CellIds);
+      if (npts < 2)
       {
-        vtkWarningMacro(<< "No normals for line!");
+        vtkWarningMacro(<< "Less than two points in line!");
         continue; // skip tubing this polyline
       }
+      scratch.ComputeNormals(npts, pts, inPts, inNormals, this->DefaultNormal, generateNormals);
+      if (!this->GeneratePoints(
+            0, npts, pts, inPts, nullptr, nullptr, nullptr, inScalars, range, scratch.Normals))
+      {
+        vtkWarningMacro(<< "Could not generate points!");
+        continue; // skip ribboning this polyline
+      }
+      pointOffsets[lineId] = this->ComputeOffset(0, npts);
+      cellOffsets[lineId] = 1;
     }
+  });
+  this->UpdateProgress(0.1);
+  if (this->GetAbortOutput())
+  {
+    return 1;
+  }
 
-    // Generate the points around the polyline. The strip is not created
-    // if the polyline is bad.
-    //
-    if (!this->GeneratePoints(
-          offset, npts, pts, inPts, newPts, pd, outPD, newNormals, inScalars, range, inNormals))
-    {
-      vtkWarningMacro(<< "Could not generate points!");
-      continue; // skip ribboning this polyline
-    }
+  vtkSMPTools::ExclusiveScan(
+    pointOffsets.begin(), pointOffsets.end(), pointOffsets.begin(), vtkIdType(0));
+  vtkSMPTools::ExclusiveScan(
+    cellOffsets.begin(), cellOffsets.end(), cellOffsets.begin(), vtkIdType(0));
+  numNewPts = pointOffsets[numLines];
+  numNewCells = cellOffsets[numLines];
 
-    // Generate the strip for this polyline
-    //
-    this->GenerateStrip(offset, npts, pts, inCellId, cd, outCD, newStrips);
+  // Create the geometry and topology. Each strip uses all the points of its
+  // polyline, so the strip offsets are the point offsets.
+  newPts = vtkPoints::New();
+  newPts->SetNumberOfPoints(numNewPts);
+  newNormals = vtkFloatArray::New();
+  newNormals->SetNumberOfComponents(3);
+  newNormals->SetNumberOfTuples(numNewPts);
+  vtkNew<vtkIdTypeArray> stripOffsets;
+  stripOffsets->SetNumberOfValues(numNewCells + 1);
+  stripOffsets->SetValue(numNewCells, numNewPts);
+  vtkNew<vtkIdTypeArray> stripConn;
+  stripConn->SetNumberOfValues(numNewPts);
 
-    // Generate the texture coordinates for this polyline
-    //
-    if (newTCoords)
+  // Point data: copy scalars, vectors, tcoords. Normals may be computed here.
+  outPD->CopyNormalsOff();
+  if ((this->GenerateTCoords == VTK_TCOORDS_FROM_SCALARS && inScalars) ||
+    this->GenerateTCoords == VTK_TCOORDS_FROM_LENGTH ||
+    this->GenerateTCoords == VTK_TCOORDS_FROM_NORMALIZED_LENGTH)
+  {
+    newTCoords = vtkFloatArray::New();
+    newTCoords->SetNumberOfComponents(2);
+    newTCoords->SetNumberOfTuples(numNewPts);
+    outPD->CopyTCoordsOff();
+  }
+  outPD->CopyAllocate(pd, numNewPts);
+  ArrayList pointArrays;
+  pointArrays.AddArrays(numNewPts, pd, outPD, 0.0, false);
+
+  // Copy selected parts of cell data; certainly don't want normals
+  //
+  outCD->CopyNormalsOff();
+  outCD->CopyAllocate(cd, numNewCells);
+  ArrayList cellArrays;
+  cellArrays.AddArrays(numNewCells, cd, outCD, 0.0, false);
+
+  //  Second pass: create points along each polyline that are connected into
+  //  a triangle strip. Texture coordinates are optionally generated.
+  //
+  vtkSMPTools::For(0, numLines, [&](vtkIdType lineId, vtkIdType endLineId) {
+    LineScratch scratch;
+    vtkIdType npts;
+    const vtkIdType* pts;
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; lineId < endLineId; ++lineId)
     {
-      this->GenerateTextureCoords(offset, npts, pts, inPts, inScalars, newTCoords);
-    }
+      if (isFirst)
+      {
+        this->CheckAbort();
+      }
+      if (this->GetAbortOutput())
+      {
+        break;
+      }
+      const vtkIdType offset = pointOffsets[lineId];
+      if (pointOffsets[lineId + 1] == offset)
+      {
+        continue; // this polyline is not ribboned
+      }
+      inLines->GetCellAtId(lineId, npts, pts, scratch.CellIds);
+      scratch.ComputeNormals(npts, pts, inPts, inNormals, this->DefaultNormal, generateNormals);
 
-    // Compute the new offset for the next polyline
-    offset = this->ComputeOffset(offset, npts);
+      // Generate the points around the polyline.
+      this->GeneratePoints(offset, npts, pts, inPts, newPts, &pointArrays, newNormals, inScalars,
+        range, scratch.Normals);
 
-  } // for all polylines
+      // Generate the strip for this polyline
+      this->GenerateStrip(offset, npts, lineId, cellOffsets[lineId], &cellArrays,
+        stripOffsets->GetPointer(0), stripConn->GetPointer(0));
 
-  singlePolyline->Delete();
+      // Generate the texture coordinates for this polyline
+      if (newTCoords)
+      {
+        this->GenerateTextureCoords(offset, npts, pts, inPts, inScalars, newTCoords);
+      }
+    }
+  });
 
   // Update ourselves
   //
-  if (deleteNormals)
-  {
-    inNormals->Delete();
-  }
-
   if (newTCoords)
   {
     outPD->SetTCoords(newTCoords);
@@ -232,12 +314,13 @@ int vtkRibbonFilter::RequestData(vtkInformation* vtkNotUsed(request),
   output->SetPoints(newPts);
   newPts->Delete();
 
+  newStrips = vtkCellArray::New();
+  newStrips->SetData(stripOffsets, stripConn);
   output->SetStrips(newStrips);
   newStrips->Delete();
 
   outPD->SetNormals(newNormals);
   newNormals->Delete();
-  lineNormalGenerator->Delete();
 
   output->Squeeze();
 
@@ -245,8 +328,8 @@ int vtkRibbonFilter::RequestData(vtkInformation* vtkNotUsed(request),
 }
 
 int vtkRibbonFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdType* pts,
-  vtkPoints* inPts, vtkPoints* newPts, vtkPointData* pd, vtkPointData* outPD,
-  vtkFloatArray* newNormals, vtkDataArray* inScalars, double range[2], vtkDataArray* inNormals)
+  vtkPoints* inPts, vtkPoints* newPts, ArrayList* pointArrays, vtkFloatArray* newNormals,
+  vtkDataArray* inScalars, double range[2], vtkDataArray* lineNormals)
 {
   vtkIdType j;
   int i;
@@ -299,7 +382,7 @@ int vtkRibbonFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkI
       }
     }
 
-    inNormals->GetTuple(pts[j], n);
+    lineNormals->GetTuple(j, n);
 
     if (vtkMath::Normalize(sNext) == 0.0)
     {
@@ -357,38 +440,42 @@ int vtkRibbonFilter::GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkI
           (range[1] - range[0]));
     }
 
+    if (!newPts)
+    {
+      continue; // only checking the polyline
+    }
+
     for (i = 0; i < 3; i++)
     {
       v[i] = (w[i] * cos(this->Theta) + nP[i] * sin(this->Theta));
       sp[i] = p[i] + this->Width * sFactor * v[i];
       sm[i] = p[i] - this->Width * sFactor * v[i];
     }
-    newPts->InsertPoint(ptId, sm);
-    newNormals->InsertTuple(ptId, nP);
-    outPD->CopyData(pd, pts[j], ptId);
+    newPts->SetPoint(ptId, sm);
+    newNormals->SetTuple(ptId, nP);
+    pointArrays->Copy(pts[j], ptId);
     ptId++;
-    newPts->InsertPoint(ptId, sp);
-    newNormals->InsertTuple(ptId, nP);
-    outPD->CopyData(pd, pts[j], ptId);
+    newPts->SetPoint(ptId, sp);
+    newNormals->SetTuple(ptId, nP);
+    pointArrays->Copy(pts[j], ptId);
     ptId++;
   } // for all points in polyline
 
   return 1;
 }
 
-void vtkRibbonFilter::GenerateStrip(vtkIdType offset, vtkIdType npts,
-  const vtkIdType* vtkNotUsed(pts), vtkIdType inCellId, vtkCellData* cd, vtkCellData* outCD,
-  vtkCellArray* newStrips)
+void vtkRibbonFilter::GenerateStrip(vtkIdType offset, vtkIdType npts, vtkIdType inCellId,
+  vtkIdType outCellId, ArrayList* cellArrays, vtkIdType* stripOffsets, vtkIdType* stripConn)
 {
-  vtkIdType i, idx, outCellId;
+  vtkIdType i, idx;
 
-  outCellId = newStrips->InsertNextCell(npts * 2);
-  outCD->CopyData(cd, inCellId, outCellId);
+  stripOffsets[outCellId] = offset;
+  cellArrays->Copy(inCellId, outCellId);
   for (i = 0; i < npts; i++)
   {
     idx = 2 * i;
-    newStrips->InsertCellPoint(offset + idx);
-    newStrips->InsertCellPoint(offset + idx + 1);
+    stripConn[offset + idx] = offset + idx;
+    stripConn[offset + idx + 1] = offset + idx + 1;
   }
 }
 
@@ -403,7 +490,7 @@ void vtkRibbonFilter::GenerateTextureCoords(vtkIdType offset, vtkIdType npts, co
   // The first texture coordinate is always 0.
   for (k = 0; k < 2; k++)
   {
-    newTCoords->InsertTuple2(offset + k, 0.0, 0.0);
+    newTCoords->SetTuple2(offset + k, 0.0, 0.0);
   }
   if (this->GenerateTCoords == VTK_TCOORDS_FROM_SCALARS && inScalars)
   {
@@ -414,7 +501,7 @@ void vtkRibbonFilter::GenerateTextureCoords(vtkIdType offset, vtkIdType npts, co
       tc = (s - s0) / this->TextureLength;
       for (k = 0; k < 2; k++)
       {
-        newTCoords->InsertTuple2(offset + i * 2 + k, tc, 0.0);
+        newTCoords->SetTuple2(offset + i * 2 + k, tc, 0.0);
       }
     }
   }
@@ -429,7 +516,7 @@ void vtkRibbonFilter::GenerateTextureCoords(vtkIdType offset, vtkIdType npts, co
       tc = len / this->TextureLength;
       for (k = 0; k < 2; k++)
       {
-        newTCoords->InsertTuple2(offset + i * 2 + k, tc, 0.0);
+        newTCoords->SetTuple2(offset + i * 2 + k, tc, 0.0);
       }
       xPrev[0] = x[0];
       xPrev[1] = x[1];
@@ -457,7 +544,7 @@ void vtkRibbonFilter::GenerateTextureCoords(vtkIdType offset, vtkIdType npts, co
       tc = len / length;
       for (k = 0; k < 2; k++)
       {
-        newTCoords->InsertTuple2(offset + i * 2 + k, tc, 0.0);
+        newTCoords->SetTuple2(offset + i * 2 + k, tc, 0.0);
       }
       xPrev[0] = x[0];
       xPrev[1] = x[1];
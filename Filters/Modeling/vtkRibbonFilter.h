@@ -11,6 +11,11 @@
  * the local line segment. An offset angle can be specified to rotate the
  * ribbon with respect to the normal.
  *
+ * The polylines are processed in parallel with vtkSMPTools, in two passes:
+ * the first one counts the points generated by each polyline, the second
+ * one fills the output at the offsets given by the prefix sum of these
+ * counts.
+ *
  * @warning
  * The input line must not have duplicate points, or normals at points that
  * are parallel to the incoming/outgoing line segments. (Duplicate points
@@ -39,6 +44,7 @@ class vtkDataArray;
 class vtkFloatArray;
 class vtkPointData;
 class vtkPoints;
+struct ArrayList;
 
 class VTKFILTERSMODELING_EXPORT vtkRibbonFilter : public vtkPolyDataAlgorithm
 {
@@ -150,12 +156,16 @@ protected:
   int GenerateTCoords;  // control texture coordinate generation
   double TextureLength; // this length is mapped to [0,1) texture space
 
-  // Helper methods
+  // Helper methods. The outputs are allocated beforehand and each polyline
+  // is written at the given offsets, so that polylines can be processed
+  // concurrently. lineNormals holds the normals of the npts points of the
+  // polyline. If newPts is nullptr, GeneratePoints() only checks whether the
+  // polyline can be ribboned.
   int GeneratePoints(vtkIdType offset, vtkIdType npts, const vtkIdType* pts, vtkPoints* inPts,
-    vtkPoints* newPts, vtkPointData* pd, vtkPointData* outPD, vtkFloatArray* newNormals,
-    vtkDataArray* inScalars, double range[2], vtkDataArray* inNormals);
-  void GenerateStrip(vtkIdType offset, vtkIdType npts, const vtkIdType* pts, vtkIdType inCellId,
-    vtkCellData* cd, vtkCellData* outCD, vtkCellArray* newStrips);
+    vtkPoints* newPts, ArrayList* pointArrays, vtkFloatArray* newNormals,
+    vtkDataArray* inScalars, double range[2], vtkDataArray* lineNormals);
+  void GenerateStrip(vtkIdType offset, vtkIdType npts, vtkIdType inCellId, vtkIdType outCellId,
+    ArrayList* cellArrays, vtkIdType* stripOffsets, vtkIdType* stripConn);
   void GenerateTextureCoords(vtkIdType offset, vtkIdType npts, const vtkIdType* pts,
     vtkPoints* inPts, vtkDataArray* inScalars, vtkFloatArray* newTCoords);
   vtkIdType ComputeOffset(vtkIdType offset, vtkIdType npts);
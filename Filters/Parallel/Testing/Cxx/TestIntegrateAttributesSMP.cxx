@@ -0,0 +1,179 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Integrate a multiblock made of hexahedra, wedges, voxels and pyramids, check
+// the volume and the integrated attributes against their exact value, and
+// check that the result is the same whatever the number of threads.
+
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkImageData.h"
+#include "vtkIntegrateAttributes.h"
+#include "vtkLogger.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkSMPTools.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+//------------------------------------------------------------------------------
+// Add the "x" point data array and the "one" cell data array.
+void AddArrays(vtkDataSet* ds)
+{
+  vtkNew<vtkDoubleArray> x;
+  x->SetName("x");
+  x->SetNumberOfTuples(ds->GetNumberOfPoints());
+  for (vtkIdType ptId = 0; ptId < ds->GetNumberOfPoints(); ++ptId)
+  {
+    x->SetValue(ptId, ds->GetPoint(ptId)[0]);
+  }
+  ds->GetPointData()->AddArray(x);
+
+  vtkNew<vtkDoubleArray> one;
+  one->SetName("one");
+  one->SetNumberOfTuples(ds->GetNumberOfCells());
+  one->Fill(1.0);
+  ds->GetCellData()->AddArray(one);
+}
+
+//------------------------------------------------------------------------------
+// Cube [0, 2]^3 split in 8^3 hexahedra, every other one split in two wedges.
+vtkSmartPointer<vtkUnstructuredGrid> CreateHexahedraAndWedges()
+{
+  const int n = 8;
+  vtkNew<vtkPoints> points;
+  for (int k = 0; k <= n; ++k)
+  {
+    for (int j = 0; j <= n; ++j)
+    {
+      for (int i = 0; i <= n; ++i)
+      {
+        points->InsertNextPoint(2.0 * i / n, 2.0 * j / n, 2.0 * k / n);
+      }
+    }
+  }
+  auto grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  grid->SetPoints(points);
+  auto id = [n](int i, int j, int k) { return i + (n + 1) * (j + (n + 1) * k); };
+  for (int k = 0; k < n; ++k)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      for (int i = 0; i < n; ++i)
+      {
+        const vtkIdType hex[8] = { id(i, j, k), id(i + 1, j, k), id(i + 1, j + 1, k),
+          id(i, j + 1, k), id(i, j, k + 1), id(i + 1, j, k + 1), id(i + 1, j + 1, k + 1),
+          id(i, j + 1, k + 1) };
+        if ((i + j + k) % 2 == 0)
+        {
+          grid->InsertNextCell(VTK_HEXAHEDRON, 8, hex);
+        }
+        else
+        {
+          const vtkIdType wedge1[6] = { hex[0], hex[2], hex[1], hex[4], hex[6], hex[5] };
+          const vtkIdType wedge2[6] = { hex[0], hex[3], hex[2], hex[4], hex[7], hex[6] };
+          grid->InsertNextCell(VTK_WEDGE, 6, wedge1);
+          grid->InsertNextCell(VTK_WEDGE, 6, wedge2);
+        }
+      }
+    }
+  }
+  AddArrays(grid);
+  return grid;
+}
+
+//------------------------------------------------------------------------------
+// Pyramids of height 0.5 on the 4x4 squares of [0, 2]^2.
+vtkSmartPointer<vtkUnstructuredGrid> CreatePyramids()
+{
+  vtkNew<vtkPoints> points;
+  auto grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  grid->SetPoints(points);
+  for (int j = 0; j < 4; ++j)
+  {
+    for (int i = 0; i < 4; ++i)
+    {
+      const double x = 0.5 * i, y = 0.5 * j;
+      const vtkIdType pyramid[5] = { points->InsertNextPoint(x, y, 0.0),
+        points->InsertNextPoint(x + 0.5, y, 0.0), points->InsertNextPoint(x + 0.5, y + 0.5, 0.0),
+        points->InsertNextPoint(x, y + 0.5, 0.0),
+        points->InsertNextPoint(x + 0.25, y + 0.25, 0.5) };
+      grid->InsertNextCell(VTK_PYRAMID, 5, pyramid);
+    }
+  }
+  AddArrays(grid);
+  return grid;
+}
+
+//------------------------------------------------------------------------------
+// Integrate with the given number of threads and return "volume", "x" and "one".
+void Integrate(vtkDataObject* input, int numberOfThreads, double results[3])
+{
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ numberOfThreads },
+    [&]()
+    {
+      vtkNew<vtkIntegrateAttributes> integrate;
+      integrate->SetInputData(input);
+      integrate->Update();
+      vtkUnstructuredGrid* output = integrate->GetOutput();
+      results[0] = vtkDoubleArray::SafeDownCast(output->GetCellData()->GetArray("Volume"))
+                     ->GetValue(0);
+      results[1] = output->GetPointData()->GetArray("x")->GetComponent(0, 0);
+      results[2] = output->GetCellData()->GetArray("one")->GetComponent(0, 0);
+    });
+}
+}
+
+//------------------------------------------------------------------------------
+int TestIntegrateAttributesSMP(int, char*[])
+{
+  // cube [2, 4] x [0, 2] x [0, 2] of 32^3 voxels
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(33, 33, 33);
+  image->SetOrigin(2.0, 0.0, 0.0);
+  image->SetSpacing(1.0 / 16, 1.0 / 16, 1.0 / 16);
+  AddArrays(image);
+
+  vtkNew<vtkMultiBlockDataSet> input;
+  input->SetBlock(0, CreateHexahedraAndWedges());
+  input->SetBlock(1, image);
+  input->SetBlock(2, CreatePyramids());
+
+  const double expected[3] = { 8.0 + 8.0 + 2.0 / 3.0, 8.0 + 24.0 + 2.0 / 3.0,
+    8.0 + 8.0 + 2.0 / 3.0 };
+  const char* names[3] = { "volume", "integral of x", "integral of one" };
+  double reference[3];
+  Integrate(input, 1, reference);
+  int retVal = EXIT_SUCCESS;
+  for (int cc = 0; cc < 3; ++cc)
+  {
+    if (std::abs(reference[cc] - expected[cc]) > 1e-10)
+    {
+      vtkLog(ERROR, "Wrong " << names[cc] << ": " << reference[cc] << " instead of "
+                             << expected[cc]);
+      retVal = EXIT_FAILURE;
+    }
+  }
+
+  for (int numberOfThreads : { 2, 3, 8 })
+  {
+    double results[3];
+    Integrate(input, numberOfThreads, results);
+    for (int cc = 0; cc < 3; ++cc)
+    {
+      if (results[cc] != reference[cc])
+      {
+        vtkLog(ERROR, "The " << names[cc] << " with " << numberOfThreads << " threads differs: "
+                             << results[cc] << " instead of " << reference[cc]);
+        retVal = EXIT_FAILURE;
+      }
+    }
+  }
+  return retVal;
+}
@@ -13,10 +13,14 @@
 #include "vtkMath.h"
 #include "vtkMultiProcessController.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkUniformHyperTreeGrid.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <map>
 #include <unordered_map>
 #include <utility>
@@ -95,7 +99,40 @@ struct RecvBuffer
 
 const int HTGGCG_SIZE_EXCHANGE_TAG = 5098;
 const int HTGGCG_DATA_EXCHANGE_TAG = 5099;
-const int HTGGCG_DATA2_EXCHANGE_TAG = 5100;
+
+//------------------------------------------------------------------------------
+// Number of bytes of count bits packed as in a vtkBitArray
+vtkIdType BitBytes(vtkIdType count)
+{
+  return (count + 7) / 8;
+}
+
+//------------------------------------------------------------------------------
+// Number of bytes sent for a tree interface of count nodes: the isParent bits,
+// the mask bits if the sender has a mask, then the values of the cell arrays.
+vtkIdType TreeMessageSize(vtkIdType count, bool withMask, vtkIdType nbValuesPerNode)
+{
+  if (!count)
+  {
+    return 0;
+  }
+  return (withMask ? 2 : 1) * BitBytes(count) +
+    count * nbValuesPerNode * static_cast<vtkIdType>(sizeof(double));
+}
+
+//------------------------------------------------------------------------------
+// Number of double values exchanged per node, the components of all the cell
+// data arrays.
+vtkIdType GetNumberOfValuesPerNode(vtkCellData* cellData)
+{
+  vtkIdType nbValues = 0;
+  for (int iArray = 0; iArray < cellData->GetNumberOfArrays(); ++iArray)
+  {
+    vtkDataArray* array = cellData->GetArray(iArray);
+    nbValues += array ? array->GetNumberOfComponents() : 0;
+  }
+  return nbValues;
+}
 }
 
 //------------------------------------------------------------------------------
@@ -197,7 +234,6 @@ int vtkHyperTreeGridGhostCellsGenerator::ProcessTrees(
   enum FlagType
   {
     NOT_TREATED,
-    INITIALIZE_TREE,
     INITIALIZE_FIELD
   };
   std::unordered_map<unsigned, FlagType> flags;
@@ -291,6 +327,37 @@ int vtkHyperTreeGridGhostCellsGenerator::ProcessTrees(
     }
   }
 
+  // Extracting the interface of my trees with each of their neighbors, all the
+  // interfaces at once since they are independent.
+  std::vector<std::pair<vtkIdType, SendBuffer*>> sendTrees;
+  for (auto&& sendProcessPair : sendBuffer)
+  {
+    for (auto&& sendTreeBufferPair : sendProcessPair.second)
+    {
+      sendTrees.emplace_back(sendTreeBufferPair.first, &sendTreeBufferPair.second);
+    }
+  }
+  vtkSMPThreadLocalObject<vtkHyperTreeGridNonOrientedCursor> threadCursors;
+  vtkSMPTools::For(0, static_cast<vtkIdType>(sendTrees.size()),
+    [&](vtkIdType begin, vtkIdType end) {
+      vtkHyperTreeGridNonOrientedCursor* cursor = threadCursors.Local();
+      for (vtkIdType iTree = begin; iTree < end; ++iTree)
+      {
+        SendBuffer& sendTreeBuffer = *sendTrees[iTree].second;
+        input->InitializeNonOrientedCursor(cursor, sendTrees[iTree].first);
+        sendTreeBuffer.count = 0;
+        vtkHyperTree* tree = cursor->GetTree();
+        if (tree)
+        {
+          // We store the isParent profile along the interface to know when to subdivide later
+          // indices store the indices in the input of the nodes on the interface
+          sendTreeBuffer.indices.resize(tree->GetNumberOfVertices());
+          this->ExtractInterface(cursor, sendTreeBuffer.isParent, sendTreeBuffer.indices, input,
+            sendTreeBuffer.mask, sendTreeBuffer.count);
+        }
+      }
+    });
+
   // Exchanging size with my neighbors
   for (int id = 0; id < numberOfProcesses; ++id)
   {
@@ -300,30 +367,16 @@ int vtkHyperTreeGridGhostCellsGenerator::ProcessTrees(
       if (sendIt != sendBuffer.end())
       {
         SendTreeBufferMap& sendTreeMap = sendIt->second;
-        std::vector<vtkIdType> counts(sendTreeMap.size());
-        int cpt = 0;
+        std::vector<vtkIdType> counts;
+        counts.reserve(sendTreeMap.size());
         for (auto&& sendTreeBufferPair : sendTreeMap)
         {
-          vtkIdType treeId = sendTreeBufferPair.first;
-          auto&& sendTreeBuffer = sendTreeBufferPair.second;
-          input->InitializeNonOrientedCursor(inCursor, treeId);
-          // Extracting the tree interface with its neighbors
-          sendTreeBuffer.count = 0;
-          vtkHyperTree* tree = inCursor->GetTree();
-          if (tree)
-          {
-            // We store the isParent profile along the interface to know when to subdivide later
-            // indices store the indices in the input of the nodes on the interface
-            vtkIdType nbVertices = tree->GetNumberOfVertices();
-            sendTreeBuffer.indices.resize(nbVertices);
-            ExtractInterface(inCursor, sendTreeBuffer.isParent, sendTreeBuffer.indices, input,
-              sendTreeBuffer.mask, sendTreeBuffer.count);
-          }
           // Telling my neighbors how much data I will send later
-          counts[cpt++] = sendTreeBuffer.count;
+          counts.push_back(sendTreeBufferPair.second.count);
         }
         vtkDebugMacro("Send: data size to " << id);
-        controller->Send(counts.data(), cpt, id, HTGGCG_SIZE_EXCHANGE_TAG);
+        controller->Send(
+          counts.data(), static_cast<vtkIdType>(counts.size()), id, HTGGCG_SIZE_EXCHANGE_TAG);
       }
     }
     else
@@ -363,59 +416,99 @@ int vtkHyperTreeGridGhostCellsGenerator::ProcessTrees(
   vtkDebugMacro("Barrier");
   controller->Barrier();
 
-  // Sending masks and parent state of each node
-  for (int id = 0; id < numberOfProcesses; ++id)
+  // Packing, for each neighbor, the parent state, the mask and the cell data of the nodes of
+  // all the interfaces in a single message. The interfaces are packed in parallel at offsets
+  // known from their sizes.
+  const bool inputHasMask = input->HasMask();
+  vtkCellData* inCellData = input->GetCellData();
+  const vtkIdType nbValuesPerNode = ::GetNumberOfValuesPerNode(inCellData);
+  std::map<unsigned int, std::vector<unsigned char>> sendMessages;
+  std::vector<unsigned char*> sendTreeMessages(sendTrees.size(), nullptr);
   {
-    if (id != processId)
+    std::size_t iTree = 0;
+    for (auto&& sendProcessPair : sendBuffer)
     {
-      auto sendIt = sendBuffer.find(id);
-      if (sendIt != sendBuffer.end())
+      std::vector<unsigned char>& message = sendMessages[sendProcessPair.first];
+      std::vector<vtkIdType> offsets;
+      vtkIdType len = 0;
+      for (auto&& sendTreeBufferPair : sendProcessPair.second)
       {
-        SendTreeBufferMap& sendTreeMap = sendIt->second;
-        std::vector<unsigned char> buf;
-        // Accumulated length
-        vtkIdType len = 0;
-        for (auto&& sendTreeBufferPair : sendTreeMap)
+        offsets.push_back(len);
+        len += ::TreeMessageSize(sendTreeBufferPair.second.count, inputHasMask, nbValuesPerNode);
+      }
+      message.resize(len);
+      for (vtkIdType offset : offsets)
+      {
+        sendTreeMessages[iTree++] = message.data() + offset;
+      }
+    }
+  }
+  vtkBitArray* inputMaskArray = inputHasMask ? input->GetMask() : nullptr;
+  vtkSMPTools::For(0, static_cast<vtkIdType>(sendTrees.size()),
+    [&](vtkIdType begin, vtkIdType end) {
+      std::vector<double> tuple;
+      for (vtkIdType iTree = begin; iTree < end; ++iTree)
+      {
+        const SendBuffer& sendTreeBuffer = *sendTrees[iTree].second;
+        const vtkIdType count = sendTreeBuffer.count;
+        if (!count)
+        {
+          continue;
+        }
+        unsigned char* buf = sendTreeMessages[iTree];
+        const vtkIdType bitBytes = ::BitBytes(count);
+        std::memcpy(buf, sendTreeBuffer.isParent->GetPointer(0), bitBytes);
+        buf += bitBytes;
+        if (inputMaskArray)
         {
-          auto&& sendTreeBuffer = sendTreeBufferPair.second;
-          if (sendTreeBuffer.count)
+          // Packing the mask bits the way vtkBitArray does
+          std::fill(buf, buf + bitBytes, 0);
+          for (vtkIdType m = 0; m < count; ++m)
           {
-            // We send the bits packed in unsigned char
-            vtkIdType dlen = sendTreeBuffer.count / sizeof(unsigned char) + 1;
-            if (input->HasMask())
-            {
-              dlen *= 2;
-            }
-            buf.resize(len + dlen);
-            memcpy(buf.data() + len, sendTreeBuffer.isParent->GetPointer(0),
-              sendTreeBuffer.count / sizeof(unsigned char) + 1);
-            if (input->HasMask())
+            if (inputMaskArray->GetValue(sendTreeBuffer.indices[m]))
             {
-              unsigned char* mask = buf.data() + len + dlen / 2;
-              for (vtkIdType ii = 0; ii < dlen / 2; ++ii)
-              {
-                mask[ii] = 0;
-              }
-              vtkBitArray* bmask = input->GetMask();
-              // Filling the mask with bits at the appropriate location
-              for (vtkIdType m = 0; m < sendTreeBuffer.count; ++m)
-              {
-                *mask |= static_cast<unsigned char>(bmask->GetValue(sendTreeBuffer.indices[m]))
-                  << (sizeof(unsigned char) - 1 - (m % sizeof(unsigned char)));
-                // Incrementing the pointer when unsigned char overflows
-                mask += !((m + 1) % sizeof(unsigned char));
-              }
+              buf[m / 8] |= static_cast<unsigned char>(0x80 >> (m % 8));
             }
-            len += dlen;
+          }
+          buf += bitBytes;
+        }
+        for (int iArray = 0; iArray < inCellData->GetNumberOfArrays(); ++iArray)
+        {
+          vtkDataArray* inArray = inCellData->GetArray(iArray);
+          if (!inArray)
+          {
+            continue;
+          }
+          const int nbComps = inArray->GetNumberOfComponents();
+          tuple.resize(nbComps);
+          for (vtkIdType m = 0; m < count; ++m)
+          {
+            inArray->GetTuple(sendTreeBuffer.indices[m], tuple.data());
+            std::memcpy(buf, tuple.data(), nbComps * sizeof(double));
+            buf += nbComps * sizeof(double);
           }
         }
+      }
+    });
+
+  // Sending the interfaces to my neighbors and creating the ghost trees from theirs
+  vtkCellData* outCellData = output->GetCellData();
+  std::vector<double> tuple;
+  for (int id = 0; id < numberOfProcesses; ++id)
+  {
+    if (id != processId)
+    {
+      auto sendIt = sendMessages.find(id);
+      if (sendIt != sendMessages.end())
+      {
+        std::vector<unsigned char>& buf = sendIt->second;
         vtkDebugMacro("Send: data to " << id);
-        this->Internals->Controller->Send(buf.data(), len, id, HTGGCG_DATA_EXCHANGE_TAG);
+        controller->Send(
+          buf.data(), static_cast<vtkIdType>(buf.size()), id, HTGGCG_DATA_EXCHANGE_TAG);
       }
     }
     else
     {
-      // Receiving masks
       std::size_t iRecv = 0;
       for (auto itRecvBuffer = recvBuffer.begin(); itRecvBuffer != recvBuffer.end(); ++itRecvBuffer)
       {
@@ -437,185 +530,92 @@ int vtkHyperTreeGridGhostCellsGenerator::ProcessTrees(
         // we prepare for receiving with appropriate length
         if (flags[process] == NOT_TREATED)
         {
+          const bool processHasMask = hyperTreesMapToProcesses[nbHTs + process] != 0;
           vtkIdType len = 0;
           for (auto&& recvTreeBufferPair : recvTreeMap)
           {
-            auto&& recvTreeBuffer = recvTreeBufferPair.second;
-            if (recvTreeBuffer.count != 0)
-            {
-              // bit message is packed in unsigned char, getting the correct length of the message
-              len += recvTreeBuffer.count / sizeof(unsigned char) + 1;
-              if (input->HasMask())
-              {
-                len += recvTreeBuffer.count / sizeof(unsigned char) + 1;
-              }
-            }
+            len +=
+              ::TreeMessageSize(recvTreeBufferPair.second.count, processHasMask, nbValuesPerNode);
           }
           std::vector<unsigned char> buf(len);
 
           vtkDebugMacro("Receive: data from " << process);
-          this->Internals->Controller->Receive(buf.data(), len, process, HTGGCG_DATA_EXCHANGE_TAG);
+          controller->Receive(buf.data(), len, process, HTGGCG_DATA_EXCHANGE_TAG);
 
-          vtkIdType cpt = 0;
+          const unsigned char* cpt = buf.data();
           // Distributing receive data among my trees, i.e. creating my ghost trees with this data
           // Remember: we only have the nodes / leaves at the inverface with our neighbor
           for (auto&& recvTreeBufferPair : recvTreeMap)
           {
             vtkIdType treeId = recvTreeBufferPair.first;
             auto&& recvTreeBuffer = recvTreeBufferPair.second;
-            if (recvTreeBuffer.count != 0)
+            const vtkIdType count = recvTreeBuffer.count;
+            if (count == 0)
             {
-              output->InitializeNonOrientedCursor(outCursor, treeId, true);
-              vtkNew<vtkBitArray> isParent;
+              continue;
+            }
+            const vtkIdType bitBytes = ::BitBytes(count);
+            output->InitializeNonOrientedCursor(outCursor, treeId, true);
+            vtkNew<vtkBitArray> isParent;
 
-              // Stealing ownership of buf in isParent to have vtkBitArray interface
-              isParent->SetArray(buf.data() + cpt,
-                input->HasMask() ? 2 * recvTreeBuffer.count : recvTreeBuffer.count, 1);
+            // Borrowing buf in isParent to have vtkBitArray interface
+            isParent->SetArray(const_cast<unsigned char*>(cpt), count, 1);
+            cpt += bitBytes;
 
-              recvTreeBuffer.offset = numberOfValues;
-              recvTreeBuffer.indices.resize(recvTreeBuffer.count);
+            recvTreeBuffer.offset = numberOfValues;
+            recvTreeBuffer.indices.resize(count);
 
-              outCursor->SetGlobalIndexStart(numberOfValues);
+            outCursor->SetGlobalIndexStart(numberOfValues);
 
-              if (!outputMask && hyperTreesMapToProcesses[nbHTs + process])
+            if (!outputMask && processHasMask)
+            {
+              outputMask = vtkBitArray::New();
+              outputMask->Resize(numberOfValues);
+              for (vtkIdType ii = 0; ii < numberOfValues; ++ii)
               {
-                outputMask = vtkBitArray::New();
-                outputMask->Resize(numberOfValues);
-                for (vtkIdType ii = 0; ii < numberOfValues; ++ii)
-                {
-                  outputMask->SetValue(ii, 0);
-                }
+                outputMask->SetValue(ii, 0);
               }
+            }
 
-              numberOfValues +=
-                this->CreateGhostTree(outCursor, isParent, recvTreeBuffer.indices.data());
-
-              // TODO Bug potentiel si localement on n'a pas de masque... mais le voisin si :D
-              if (hyperTreesMapToProcesses[nbHTs + process])
-              {
-                vtkNew<vtkBitArray> mask;
-                // Stealing ownership of buf for mask handling to have vtkBitArray interface
+            numberOfValues +=
+              this->CreateGhostTree(outCursor, isParent, recvTreeBuffer.indices.data());
 
-                mask->SetArray(buf.data() + cpt + recvTreeBuffer.count / sizeof(unsigned char) + 1,
-                  recvTreeBuffer.count, 1);
+            if (processHasMask)
+            {
+              vtkNew<vtkBitArray> mask;
+              // Borrowing buf for mask handling to have vtkBitArray interface
+              mask->SetArray(const_cast<unsigned char*>(cpt), count, 1);
+              cpt += bitBytes;
 
-                for (vtkIdType m = 0; m < recvTreeBuffer.count; ++m)
-                {
-                  outputMask->InsertValue(recvTreeBuffer.indices[m], mask->GetValue(m));
-                }
-                cpt += 2 * (recvTreeBuffer.count / sizeof(unsigned char) + 1);
-              }
-              else
+              for (vtkIdType m = 0; m < count; ++m)
               {
-                if (outputMask)
-                {
-                  for (vtkIdType m = 0; m < recvTreeBuffer.count; ++m)
-                  {
-                    outputMask->InsertValue(recvTreeBuffer.indices[m], 0);
-                  }
-                }
-                cpt += recvTreeBuffer.count / sizeof(unsigned char) + 1;
+                outputMask->InsertValue(recvTreeBuffer.indices[m], mask->GetValue(m));
               }
             }
-          }
-          flags[process] = INITIALIZE_TREE;
-        }
-        iRecv++;
-      }
-    }
-  }
-
-  // Synchronizing
-  vtkDebugMacro("Barrier");
-  this->Internals->Controller->Barrier();
-
-  // We now send the data store on each node
-  for (int id = 0; id < numberOfProcesses; ++id)
-  {
-    if (id != processId)
-    {
-      auto sendIt = sendBuffer.find(id);
-      if (sendIt != sendBuffer.end())
-      {
-        SendTreeBufferMap& sendTreeMap = sendIt->second;
-        std::vector<double> buf;
-        vtkIdType len = 0;
-        for (auto&& sendTreeBufferPair : sendTreeMap)
-        {
-          auto&& sendTreeBuffer = sendTreeBufferPair.second;
-          if (sendTreeBuffer.count)
-          {
-            vtkCellData* pd = input->GetCellData();
-            int nbArray = pd->GetNumberOfArrays();
-            len += sendTreeBuffer.count * nbArray;
-            buf.resize(len);
-            double* arr = buf.data() + len - sendTreeBuffer.count * nbArray;
-            for (int iArray = 0; iArray < nbArray; ++iArray)
+            else if (outputMask)
             {
-              vtkDataArray* inArray = pd->GetArray(iArray);
-              for (vtkIdType m = 0; m < sendTreeBuffer.count; ++m)
+              for (vtkIdType m = 0; m < count; ++m)
               {
-                arr[iArray * sendTreeBuffer.count + m] =
-                  inArray->GetTuple1(sendTreeBuffer.indices[m]);
+                outputMask->InsertValue(recvTreeBuffer.indices[m], 0);
               }
             }
-          }
-        }
-        vtkDebugMacro("Send: data2 from " << id);
-        this->Internals->Controller->Send(buf.data(), len, id, HTGGCG_DATA2_EXCHANGE_TAG);
-      }
-    }
-    else
-    {
-      // We receive the data
-      std::size_t iRecv = 0;
-      for (auto itRecvBuffer = recvBuffer.begin(); itRecvBuffer != recvBuffer.end(); ++itRecvBuffer)
-      {
-        auto targetRecvBuffer = itRecvBuffer;
-        if (controller->CanProbe())
-        {
-          targetRecvBuffer = ::ProbeFind(controller, HTGGCG_DATA2_EXCHANGE_TAG, recvBuffer);
-          if (targetRecvBuffer == recvBuffer.end())
-          {
-            vtkErrorMacro("Reception probe on process " << processId << " failed on " << iRecv
-                                                        << "th iteration.");
-            return 0;
-          }
-        }
-        int process = targetRecvBuffer->first;
-        auto&& recvTreeMap = targetRecvBuffer->second;
-        if (flags[process] == INITIALIZE_TREE)
-        {
-          unsigned long len = 0;
-          for (auto&& recvTreeBufferPair : recvTreeMap)
-          {
-            vtkCellData* pd = output->GetCellData();
-            int nbArray = pd->GetNumberOfArrays();
-            len += recvTreeBufferPair.second.count * nbArray;
-          }
-          std::vector<double> buf(len);
-
-          vtkDebugMacro("Receive: data2 from " << process);
-          this->Internals->Controller->Receive(buf.data(), len, process, HTGGCG_DATA2_EXCHANGE_TAG);
-          vtkIdType cpt = 0;
-
-          for (auto&& recvTreeBufferPair : recvTreeMap)
-          {
-            auto&& recvTreeBuffer = recvTreeBufferPair.second;
-            vtkCellData* pd = output->GetCellData();
-            int nbArray = pd->GetNumberOfArrays();
-            double* arr = buf.data() + cpt;
 
-            for (int d = 0; d < nbArray; ++d)
+            for (int d = 0; d < outCellData->GetNumberOfArrays(); ++d)
             {
-              vtkDataArray* outArray = pd->GetArray(d);
-              for (vtkIdType m = 0; m < recvTreeBuffer.count; ++m)
+              vtkDataArray* outArray = outCellData->GetArray(d);
+              if (!outArray)
+              {
+                continue;
+              }
+              const int nbComps = outArray->GetNumberOfComponents();
+              tuple.resize(nbComps);
+              for (vtkIdType m = 0; m < count; ++m)
               {
-                outArray->InsertTuple1(
-                  recvTreeBuffer.indices[m], arr[d * recvTreeBuffer.count + m]);
+                std::memcpy(tuple.data(), cpt, nbComps * sizeof(double));
+                cpt += nbComps * sizeof(double);
+                outArray->InsertTuple(recvTreeBuffer.indices[m], tuple.data());
               }
             }
-            cpt += recvTreeBuffer.count * nbArray;
           }
           flags[process] = INITIALIZE_FIELD;
         }
@@ -12,6 +12,10 @@
  * This filter should be used in a multi-processes environment, and is only required if wanting to
  * filter a vtkHyperTreeGrid with algorithms using Von Neumann or Moore supercursors afterwards.
  *
+ * Processes only communicate with the processes owning neighbor trees of the coarse grid. The
+ * interfaces of the trees are extracted and packed in parallel with vtkSMPTools, and all the
+ * interfaces sent to a neighbor, with their mask and cell data, travel in a single message.
+ *
  * @par Thanks:
  * This class was written by Jacques-Bernard Lekien, 2019
  * This work was supported by Commissariat a l'Energie Atomique
@@ -9,11 +9,13 @@
 #include "vtkCompositeDataSet.h"
 #include "vtkDataSet.h"
 #include "vtkDoubleArray.h"
+#include "vtkGenericCell.h"
 #include "vtkIdList.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
 #include "vtkMultiProcessController.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolygon.h"
@@ -23,7 +25,11 @@
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <map>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkIntegrateAttributes);
@@ -107,286 +113,327 @@ int vtkIntegrateAttributes::CompareIntegrationDimension(vtkDataSet* output, int
 }
 
 //------------------------------------------------------------------------------
+// Integrates the cells of all the blocks in chunks of fixed size. Each chunk has
+// its own results, summed in order once all chunks are done, so that the results
+// do not depend on the number of threads nor on the scheduling of the chunks.
 class vtkIntegrateAttributes::vtkIntegrateAttributesFunctor
 {
+public:
+  // An input array integrated into the results, starting at Offset.
+  struct ArrayIntegration
+  {
+    vtkDataArray* Input;
+    int Offset;
+  };
+
+  struct Block
+  {
+    vtkDataSet* Input;
+    unsigned char* Ghost;
+    std::vector<ArrayIntegration> PointArrays;
+    std::vector<ArrayIntegration> CellArrays;
+    vtkIdType FirstChunk;
+  };
+
+  static constexpr vtkIdType ChunkSize = 1024;
+
 private:
   // inputs
   vtkIntegrateAttributes* Self;
-  vtkDataSet* Input;
-  vtkUnstructuredGrid* Output;
   int TotalIntegrationDimension;
-  int FieldListIndex;
-  vtkFieldList& PointFieldList;
-  vtkFieldList& CellFieldList;
-
-  // input information
-  unsigned char* Ghost;
+  std::vector<Block> Blocks;
+  std::map<vtkAbstractArray*, int> Offsets;
 
   // thread local data
-  vtkSMPThreadLocalObject<vtkUnstructuredGrid> TLOutput;
   vtkSMPThreadLocalObject<vtkGenericCell> TLCell;
   vtkSMPThreadLocalObject<vtkIdList> TLCellPointIds;
-  vtkSMPThreadLocal<double> TLSum;
-  vtkSMPThreadLocal<std::array<double, 3>> TLSumCenter;
 
-  // results
-  double Sum;
-  double SumCenter[3];
+  // results of each chunk: sum, sum center, then the integrated point and cell data
+  vtkIdType NumberOfChunks = 0;
+  int ResultSize = 4;
+  std::vector<double> Results;
 
 public:
-  vtkIntegrateAttributesFunctor(vtkIntegrateAttributes* self, vtkDataSet* input,
-    vtkUnstructuredGrid* output, int totalIntegrationDimension, int fieldListIndex,
-    vtkFieldList& pdList, vtkFieldList& cdList)
+  vtkIntegrateAttributesFunctor(
+    vtkIntegrateAttributes* self, vtkUnstructuredGrid* output, int totalIntegrationDimension)
     : Self(self)
-    , Input(input)
-    , Output(output)
     , TotalIntegrationDimension(totalIntegrationDimension)
-    , FieldListIndex(fieldListIndex)
-    , PointFieldList(pdList)
-    , CellFieldList(cdList)
-    , Ghost(input->GetCellGhostArray() ? input->GetCellGhostArray()->GetPointer(0) : nullptr)
   {
-    if (this->Input->GetNumberOfCells() > 0)
+    for (vtkDataSetAttributes* outda : { static_cast<vtkDataSetAttributes*>(output->GetPointData()),
+           static_cast<vtkDataSetAttributes*>(output->GetCellData()) })
+    {
+      for (int cc = 0; cc < outda->GetNumberOfArrays(); ++cc)
+      {
+        vtkAbstractArray* array = outda->GetAbstractArray(cc);
+        this->Offsets[array] = this->ResultSize;
+        this->ResultSize += array->GetNumberOfComponents();
+      }
+    }
+  }
+
+  void AddBlock(vtkDataSet* input, vtkUnstructuredGrid* output, int fieldListIndex,
+    vtkFieldList& pdList, vtkFieldList& cdList)
+  {
+    Block block;
+    block.Input = input;
+    block.Ghost =
+      input->GetCellGhostArray() ? input->GetCellGhostArray()->GetPointer(0) : nullptr;
+    block.FirstChunk = this->NumberOfChunks;
+    auto addArrays = [this](std::vector<ArrayIntegration>& arrays) {
+      return [this, &arrays](vtkAbstractArray* ainArray, vtkAbstractArray* aoutArray) {
+        vtkDataArray* inArray = vtkDataArray::FastDownCast(ainArray);
+        if (inArray && vtkDoubleArray::FastDownCast(aoutArray) &&
+          inArray->GetNumberOfComponents() == aoutArray->GetNumberOfComponents())
+        {
+          arrays.push_back({ inArray, this->Offsets[aoutArray] });
+        }
+      };
+    };
+    pdList.TransformData(fieldListIndex, input->GetPointData(), output->GetPointData(),
+      addArrays(block.PointArrays));
+    cdList.TransformData(fieldListIndex, input->GetCellData(), output->GetCellData(),
+      addArrays(block.CellArrays));
+
+    if (input->GetNumberOfCells() > 0)
     {
       // initialize internal data structures
       vtkNew<vtkGenericCell> cell;
-      this->Input->GetCell(0, cell);
+      input->GetCell(0, cell);
     }
+    this->NumberOfChunks += (input->GetNumberOfCells() + ChunkSize - 1) / ChunkSize;
+    this->Blocks.emplace_back(std::move(block));
   }
 
-private:
-  void IntegratePolyLine(vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId,
-    vtkIdType numPts, const vtkIdType* cellPtIds, double& sum, double sumCenter[3]);
-  void IntegratePolygon(vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId,
-    vtkIdType numPts, const vtkIdType* cellPtIds, double& sum, double sumCenter[3]);
-  void IntegrateTriangleStrip(vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId,
-    vtkIdType numPts, const vtkIdType* cellPtIds, double& sum, double sumCenter[3]);
-  void IntegrateTriangle(vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId,
-    vtkIdType pt1Id, vtkIdType pt2Id, vtkIdType pt3Id, double& sum, double sumCenter[3]);
-  void IntegrateTetrahedron(vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId,
-    vtkIdType pt1Id, vtkIdType pt2Id, vtkIdType pt3Id, vtkIdType pt4Id, double& sum,
-    double sumCenter[3]);
-  void IntegratePixel(vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId,
-    vtkIdType numPts, const vtkIdType* cellPtIds, double& sum, double sumCenter[3]);
-  void IntegrateVoxel(vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId,
-    vtkIdType numPts, const vtkIdType* cellPtIds, double& sum, double sumCenter[3]);
-  void IntegrateGeneral1DCell(vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId,
-    vtkIdType numPts, const vtkIdType* cellPtIds, double& sum, double sumCenter[3]);
-  void IntegrateGeneral2DCell(vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId,
-    vtkIdType numPts, const vtkIdType* cellPtIds, double& sum, double sumCenter[3]);
-  void IntegrateGeneral3DCell(vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId,
-    vtkIdType numPts, const vtkIdType* cellPtIds, double& sum, double sumCenter[3]);
-
-  static void IntegrateData1(vtkDataSetAttributes* inda, vtkDataSetAttributes* outda,
-    vtkIdType pt1Id, double k, vtkFieldList& fieldlist, int fieldlist_index);
-  static void IntegrateData2(vtkDataSetAttributes* inda, vtkDataSetAttributes* outda,
-    vtkIdType pt1Id, vtkIdType pt2Id, double k, vtkFieldList& fieldlist, int fieldlist_index);
-  static void IntegrateData3(vtkDataSetAttributes* inda, vtkDataSetAttributes* outda,
-    vtkIdType pt1Id, vtkIdType pt2Id, vtkIdType pt3Id, double k, vtkFieldList& fieldlist,
-    int fieldlist_index);
-  static void IntegrateData4(vtkDataSetAttributes* inda, vtkDataSetAttributes* outda,
-    vtkIdType pt1Id, vtkIdType pt2Id, vtkIdType pt3Id, vtkIdType pt4Id, double k,
-    vtkFieldList& fieldlist, int fieldlist_index);
+  void Execute()
+  {
+    this->Results.assign(this->NumberOfChunks * this->ResultSize, 0.0);
+    vtkSMPTools::For(0, this->NumberOfChunks, 1, *this);
+  }
 
-public:
-  void Initialize()
+  // Sum the results of the chunks in order, with a compensated summation, and add
+  // them to the output.
+  void Reduce(vtkUnstructuredGrid* output, double& totalSum, double totalSumCenter[3])
   {
-    this->TLSum.Local() = 0;
-    auto sumCenter = this->TLSumCenter.Local();
-    sumCenter[0] = sumCenter[1] = sumCenter[2] = 0.0;
-    auto output = this->TLOutput.Local();
-    output->GetPointData()->DeepCopy(this->Output->GetPointData());
-    vtkIntegrateAttributes::InitializeAttributes(output->GetPointData());
-    output->GetCellData()->DeepCopy(this->Output->GetCellData());
-    vtkIntegrateAttributes::InitializeAttributes(output->GetCellData());
+    std::vector<double> totals(this->ResultSize, 0.0);
+    std::vector<double> compensations(this->ResultSize, 0.0);
+    for (vtkIdType chunk = 0; chunk < this->NumberOfChunks; ++chunk)
+    {
+      const double* result = this->Results.data() + chunk * this->ResultSize;
+      for (int cc = 0; cc < this->ResultSize; ++cc)
+      {
+        const double total = totals[cc] + result[cc];
+        compensations[cc] += std::abs(totals[cc]) >= std::abs(result[cc])
+          ? (totals[cc] - total) + result[cc]
+          : (result[cc] - total) + totals[cc];
+        totals[cc] = total;
+      }
+    }
+    for (int cc = 0; cc < this->ResultSize; ++cc)
+    {
+      totals[cc] += compensations[cc];
+    }
+
+    totalSum += totals[0];
+    for (int cc = 0; cc < 3; ++cc)
+    {
+      totalSumCenter[cc] += totals[cc + 1];
+    }
+    for (const auto& offset : this->Offsets)
+    {
+      auto outArray = vtkDoubleArray::FastDownCast(offset.first);
+      for (int cc = 0; cc < outArray->GetNumberOfComponents(); ++cc)
+      {
+        outArray->SetTypedComponent(
+          0, cc, outArray->GetTypedComponent(0, cc) + totals[offset.second + cc]);
+      }
+    }
   }
 
-  void operator()(vtkIdType begin, vtkIdType end)
+private:
+  void IntegratePolyLine(const Block& block, vtkIdType cellId, vtkIdType numPts,
+    const vtkIdType* cellPtIds, double* result);
+  void IntegratePolygon(const Block& block, vtkIdType cellId, vtkIdType numPts,
+    const vtkIdType* cellPtIds, double* result);
+  void IntegrateTriangleStrip(const Block& block, vtkIdType cellId, vtkIdType numPts,
+    const vtkIdType* cellPtIds, double* result);
+  void IntegrateTriangle(const Block& block, vtkIdType cellId, vtkIdType pt1Id, vtkIdType pt2Id,
+    vtkIdType pt3Id, double* result);
+  void IntegrateTetrahedron(const Block& block, vtkIdType cellId, vtkIdType pt1Id,
+    vtkIdType pt2Id, vtkIdType pt3Id, vtkIdType pt4Id, double* result);
+  void IntegratePixel(const Block& block, vtkIdType cellId, vtkIdType numPts,
+    const vtkIdType* cellPtIds, double* result);
+  void IntegrateVoxel(const Block& block, vtkIdType cellId, vtkIdType numPts,
+    const vtkIdType* cellPtIds, double* result);
+  void IntegrateLinear3DCell(const Block& block, vtkIdType cellId, int cellType,
+    const vtkIdType* cellPtIds, double* result);
+  void IntegrateGeneral1DCell(const Block& block, vtkIdType cellId, vtkIdType numPts,
+    const vtkIdType* cellPtIds, double* result);
+  void IntegrateGeneral2DCell(const Block& block, vtkIdType cellId, vtkIdType numPts,
+    const vtkIdType* cellPtIds, double* result);
+  void IntegrateGeneral3DCell(const Block& block, vtkIdType cellId, vtkIdType numPts,
+    const vtkIdType* cellPtIds, double* result);
+
+  static void IntegrateData1(
+    const std::vector<ArrayIntegration>& arrays, vtkIdType pt1Id, double k, double* result);
+  static void IntegrateData2(const std::vector<ArrayIntegration>& arrays, vtkIdType pt1Id,
+    vtkIdType pt2Id, double k, double* result);
+  static void IntegrateData3(const std::vector<ArrayIntegration>& arrays, vtkIdType pt1Id,
+    vtkIdType pt2Id, vtkIdType pt3Id, double k, double* result);
+  static void IntegrateData4(const std::vector<ArrayIntegration>& arrays, vtkIdType pt1Id,
+    vtkIdType pt2Id, vtkIdType pt3Id, vtkIdType pt4Id, double k, double* result);
+
+public:
+  void operator()(vtkIdType beginChunk, vtkIdType endChunk)
   {
-    auto& output = this->TLOutput.Local();
     auto& cell = this->TLCell.Local();
     auto& cellPointIds = this->TLCellPointIds.Local();
-    auto& sum = this->TLSum.Local();
-    auto sumCenter = this->TLSumCenter.Local().data();
     vtkIdType npts;
     const vtkIdType* pts;
     int cellType, cellDim;
 
     const bool isFirst = vtkSMPTools::GetSingleThread();
-    const auto checkAbortInterval = std::min((end - begin) / 10 + 1, (vtkIdType)1000);
-    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    for (vtkIdType chunk = beginChunk; chunk < endChunk; ++chunk)
     {
-      if (cellId % checkAbortInterval == 0)
+      if (isFirst)
       {
-        if (isFirst)
-        {
-          this->Self->CheckAbort();
-        }
-        if (this->Self->GetAbortOutput())
-        {
-          break;
-        }
+        this->Self->CheckAbort();
       }
-      // Make sure we are not integrating ghost/blanked cells.
-      if (this->Ghost &&
-        (this->Ghost[cellId] &
-          (vtkDataSetAttributes::DUPLICATECELL | vtkDataSetAttributes::HIDDENCELL)))
+      if (this->Self->GetAbortOutput())
       {
-        continue;
-      }
-
-      // get cell type
-      cellType = this->Input->GetCellType(cellId);
-      // skip cells that have different(lower) dimension compared to the max spatial dimension
-      cellDim = vtkCellTypes::GetDimension(cellType);
-      if (cellDim == 0 || this->TotalIntegrationDimension != cellDim)
-      {
-        continue;
+        break;
       }
 
-      switch (cellType)
+      auto blockIter = std::upper_bound(this->Blocks.begin(), this->Blocks.end(), chunk,
+        [](vtkIdType value, const Block& block) { return value < block.FirstChunk; });
+      const Block& block = *(blockIter - 1);
+      vtkDataSet* input = block.Input;
+      double* result = this->Results.data() + chunk * this->ResultSize;
+      const vtkIdType begin = (chunk - block.FirstChunk) * ChunkSize;
+      const vtkIdType end = std::min(begin + ChunkSize, input->GetNumberOfCells());
+      for (vtkIdType cellId = begin; cellId < end; ++cellId)
       {
-        // skip empty or 0D Cells
-        case VTK_EMPTY_CELL:
-        case VTK_VERTEX:
-        case VTK_POLY_VERTEX:
-          break;
-
-        case VTK_POLY_LINE:
-        case VTK_LINE:
+        // Make sure we are not integrating ghost/blanked cells.
+        if (block.Ghost &&
+          (block.Ghost[cellId] &
+            (vtkDataSetAttributes::DUPLICATECELL | vtkDataSetAttributes::HIDDENCELL)))
         {
-          this->Input->GetCellPoints(cellId, npts, pts, cellPointIds);
-          this->IntegratePolyLine(this->Input, output, cellId, npts, pts, sum, sumCenter);
+          continue;
         }
-        break;
 
-        case VTK_TRIANGLE:
+        // get cell type
+        cellType = input->GetCellType(cellId);
+        // skip cells that have different(lower) dimension compared to the max spatial dimension
+        cellDim = vtkCellTypes::GetDimension(cellType);
+        if (cellDim == 0 || this->TotalIntegrationDimension != cellDim)
         {
-          this->Input->GetCellPoints(cellId, npts, pts, cellPointIds);
-          this->IntegrateTriangle(
-            this->Input, output, cellId, pts[0], pts[1], pts[2], sum, sumCenter);
+          continue;
         }
-        break;
 
-        case VTK_TRIANGLE_STRIP:
+        switch (cellType)
         {
-          this->Input->GetCellPoints(cellId, npts, pts, cellPointIds);
-          this->IntegrateTriangleStrip(this->Input, output, cellId, npts, pts, sum, sumCenter);
-        }
-        break;
+          // skip empty or 0D Cells
+          case VTK_EMPTY_CELL:
+          case VTK_VERTEX:
+          case VTK_POLY_VERTEX:
+            break;
+
+          case VTK_POLY_LINE:
+          case VTK_LINE:
+          {
+            input->GetCellPoints(cellId, npts, pts, cellPointIds);
+            this->IntegratePolyLine(block, cellId, npts, pts, result);
+          }
+          break;
 
-        case VTK_POLYGON:
-        {
-          this->Input->GetCellPoints(cellId, npts, pts, cellPointIds);
-          this->IntegratePolygon(this->Input, output, cellId, npts, pts, sum, sumCenter);
-        }
-        break;
+          case VTK_TRIANGLE:
+          {
+            input->GetCellPoints(cellId, npts, pts, cellPointIds);
+            this->IntegrateTriangle(block, cellId, pts[0], pts[1], pts[2], result);
+          }
+          break;
 
-        case VTK_PIXEL:
-        {
-          this->Input->GetCellPoints(cellId, npts, pts, cellPointIds);
-          this->IntegratePixel(this->Input, output, cellId, npts, pts, sum, sumCenter);
-        }
-        break;
+          case VTK_TRIANGLE_STRIP:
+          {
+            input->GetCellPoints(cellId, npts, pts, cellPointIds);
+            this->IntegrateTriangleStrip(block, cellId, npts, pts, result);
+          }
+          break;
 
-        case VTK_QUAD:
-        {
-          this->Input->GetCellPoints(cellId, npts, pts, cellPointIds);
-          this->IntegrateTriangle(
-            this->Input, output, cellId, pts[0], pts[1], pts[2], sum, sumCenter);
-          this->IntegrateTriangle(
-            this->Input, output, cellId, pts[0], pts[3], pts[2], sum, sumCenter);
-        }
-        break;
+          case VTK_POLYGON:
+          {
+            input->GetCellPoints(cellId, npts, pts, cellPointIds);
+            this->IntegratePolygon(block, cellId, npts, pts, result);
+          }
+          break;
 
-        case VTK_VOXEL:
-        {
-          this->Input->GetCellPoints(cellId, npts, pts, cellPointIds);
-          this->IntegrateVoxel(this->Input, output, cellId, npts, pts, sum, sumCenter);
-        }
-        break;
+          case VTK_PIXEL:
+          {
+            input->GetCellPoints(cellId, npts, pts, cellPointIds);
+            this->IntegratePixel(block, cellId, npts, pts, result);
+          }
+          break;
 
-        case VTK_TETRA:
-        {
-          this->Input->GetCellPoints(cellId, npts, pts, cellPointIds);
-          this->IntegrateTetrahedron(
-            this->Input, output, cellId, pts[0], pts[1], pts[2], pts[3], sum, sumCenter);
-        }
-        break;
+          case VTK_QUAD:
+          {
+            input->GetCellPoints(cellId, npts, pts, cellPointIds);
+            this->IntegrateTriangle(block, cellId, pts[0], pts[1], pts[2], result);
+            this->IntegrateTriangle(block, cellId, pts[0], pts[3], pts[2], result);
+          }
+          break;
 
-        default:
-        {
-          // We need to explicitly get the cell
-          this->Input->GetCell(cellId, cell);
+          case VTK_VOXEL:
+          {
+            input->GetCellPoints(cellId, npts, pts, cellPointIds);
+            this->IntegrateVoxel(block, cellId, npts, pts, result);
+          }
+          break;
+
+          case VTK_TETRA:
+          {
+            input->GetCellPoints(cellId, npts, pts, cellPointIds);
+            this->IntegrateTetrahedron(block, cellId, pts[0], pts[1], pts[2], pts[3], result);
+          }
+          break;
+
+          case VTK_HEXAHEDRON:
+          case VTK_WEDGE:
+          case VTK_PYRAMID:
+          {
+            input->GetCellPoints(cellId, npts, pts, cellPointIds);
+            this->IntegrateLinear3DCell(block, cellId, cellType, pts, result);
+          }
+          break;
 
-          cell->TriangulateIds(1, cellPointIds);
-          switch (cellDim)
+          default:
           {
-            case 1:
-              this->IntegrateGeneral1DCell(this->Input, output, cellId,
-                cellPointIds->GetNumberOfIds(), cellPointIds->GetPointer(0), sum, sumCenter);
-              break;
-            case 2:
-              this->IntegrateGeneral2DCell(this->Input, output, cellId,
-                cellPointIds->GetNumberOfIds(), cellPointIds->GetPointer(0), sum, sumCenter);
-              break;
-            case 3:
-              this->IntegrateGeneral3DCell(this->Input, output, cellId,
-                cellPointIds->GetNumberOfIds(), cellPointIds->GetPointer(0), sum, sumCenter);
-              break;
-            default:
-              vtkWarningWithObjectMacro(this->Self, "Unsupported Cell Dimension = " << cellDim);
+            // We need to explicitly get the cell
+            input->GetCell(cellId, cell);
+
+            cell->TriangulateIds(1, cellPointIds);
+            switch (cellDim)
+            {
+              case 1:
+                this->IntegrateGeneral1DCell(block, cellId, cellPointIds->GetNumberOfIds(),
+                  cellPointIds->GetPointer(0), result);
+                break;
+              case 2:
+                this->IntegrateGeneral2DCell(block, cellId, cellPointIds->GetNumberOfIds(),
+                  cellPointIds->GetPointer(0), result);
+                break;
+              case 3:
+                this->IntegrateGeneral3DCell(block, cellId, cellPointIds->GetNumberOfIds(),
+                  cellPointIds->GetPointer(0), result);
+                break;
+              default:
+                vtkWarningWithObjectMacro(this->Self, "Unsupported Cell Dimension = " << cellDim);
+            }
           }
         }
       }
     }
   }
-
-  void Reduce()
-  {
-    // compute sum
-    this->Sum = 0;
-    for (const auto& sum : this->TLSum)
-    {
-      this->Sum += sum;
-    }
-    // compute sum center
-    this->SumCenter[0] = this->SumCenter[1] = this->SumCenter[2] = 0.0;
-    for (const auto& sumCenter : this->TLSumCenter)
-    {
-      vtkMath::Add(sumCenter, this->SumCenter, this->SumCenter);
-    }
-    // compute point/cell data
-    for (const auto& output : this->TLOutput)
-    {
-      vtkIntegrateAttributes::IntegrateSatelliteData(
-        output->GetPointData(), this->Output->GetPointData());
-      vtkIntegrateAttributes::IntegrateSatelliteData(
-        output->GetCellData(), this->Output->GetCellData());
-    }
-  }
-
-  double GetSum() { return this->Sum; }
-
-  double* GetSumCenter() { return this->SumCenter; }
 };
 
-//------------------------------------------------------------------------------
-void vtkIntegrateAttributes::ExecuteBlock(vtkDataSet* input, vtkUnstructuredGrid* output,
-  int fieldset_index, vtkIntegrateAttributes::vtkFieldList& pdList,
-  vtkIntegrateAttributes::vtkFieldList& cdList, double& totalSum, double totalSumCenter[3],
-  int totalIntegrationDimension)
-{
-  vtkIntegrateAttributesFunctor functor(
-    this, input, output, totalIntegrationDimension, fieldset_index, pdList, cdList);
-  vtkSMPTools::For(0, input->GetNumberOfCells(), functor);
-
-  const auto blockSum = functor.GetSum();
-  const auto blockSumCenter = functor.GetSumCenter();
-  totalSum += blockSum;
-  vtkMath::Add(blockSumCenter, totalSumCenter, totalSumCenter);
-}
-
 //------------------------------------------------------------------------------
 int vtkIntegrateAttributes::RequestData(
   vtkInformation*, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
@@ -441,18 +488,20 @@ int vtkIntegrateAttributes::RequestData(
     vtkIntegrateAttributes::AllocateAttributes(pdList, output->GetPointData());
     vtkIntegrateAttributes::AllocateAttributes(cdList, output->GetCellData());
 
+    // Now integrate the cells of all the blocks together.
+    vtkIntegrateAttributesFunctor functor(this, output, totalIntegrationDimension);
     int index = 0;
-    // Now execute for each block.
     for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
     {
       auto ds = vtkDataSet::SafeDownCast(iter->GetCurrentDataObject());
       if (ds && ds->GetNumberOfPoints() > 0)
       {
-        this->ExecuteBlock(
-          ds, output, index, pdList, cdList, totalSum, totalSumCenter, totalIntegrationDimension);
+        functor.AddBlock(ds, output, index, pdList, cdList);
         index++;
       }
     }
+    functor.Execute();
+    functor.Reduce(output, totalSum, totalSumCenter);
   }
   else if (dsInput)
   {
@@ -468,8 +517,10 @@ int vtkIntegrateAttributes::RequestData(
     cdList.InitializeFieldList(dsInput->GetCellData());
     this->AllocateAttributes(pdList, output->GetPointData());
     this->AllocateAttributes(cdList, output->GetCellData());
-    this->ExecuteBlock(
-      dsInput, output, 0, pdList, cdList, totalSum, totalSumCenter, totalIntegrationDimension);
+    vtkIntegrateAttributesFunctor functor(this, output, totalIntegrationDimension);
+    functor.AddBlock(dsInput, output, 0, pdList, cdList);
+    functor.Execute();
+    functor.Reduce(output, totalSum, totalSumCenter);
   }
   else
   {
@@ -700,111 +751,77 @@ void vtkIntegrateAttributes::ZeroAttributes(vtkDataSetAttributes* outda)
 
 //------------------------------------------------------------------------------
 void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegrateData1(
-  vtkDataSetAttributes* inda, vtkDataSetAttributes* outda, vtkIdType pt1Id, double k,
-  vtkIntegrateAttributes::vtkFieldList& fieldList, int index)
+  const std::vector<ArrayIntegration>& arrays, vtkIdType pt1Id, double k, double* result)
 {
-  auto f = [pt1Id, k](vtkAbstractArray* ainArray, vtkAbstractArray* aoutArray) {
-    vtkDataArray* inArray = vtkDataArray::FastDownCast(ainArray);
-    vtkDoubleArray* outArray = vtkDoubleArray::FastDownCast(aoutArray);
-    if (inArray && outArray)
+  for (const auto& array : arrays)
+  {
+    // We could template for speed.
+    const int numComponents = array.Input->GetNumberOfComponents();
+    for (int j = 0; j < numComponents; ++j)
     {
-      // We could template for speed.
-      const int numComponents = inArray->GetNumberOfComponents();
-      for (int j = 0; j < numComponents; ++j)
-      {
-        const double vIn1 = inArray->GetComponent(pt1Id, j);
-        const double dv = vIn1;
-        const double vOut = (dv * k) + outArray->GetTypedComponent(0, j);
-        outArray->SetTypedComponent(0, j, vOut);
-      }
+      const double vIn1 = array.Input->GetComponent(pt1Id, j);
+      result[array.Offset + j] += vIn1 * k;
     }
-  };
-
-  fieldList.TransformData(index, inda, outda, f);
+  }
 }
 
 //------------------------------------------------------------------------------
 void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegrateData2(
-  vtkDataSetAttributes* inda, vtkDataSetAttributes* outda, vtkIdType pt1Id, vtkIdType pt2Id,
-  double k, vtkIntegrateAttributes::vtkFieldList& fieldList, int index)
+  const std::vector<ArrayIntegration>& arrays, vtkIdType pt1Id, vtkIdType pt2Id, double k,
+  double* result)
 {
-  auto f = [pt1Id, pt2Id, k](vtkAbstractArray* ainArray, vtkAbstractArray* aoutArray) {
-    vtkDataArray* inArray = vtkDataArray::FastDownCast(ainArray);
-    vtkDoubleArray* outArray = vtkDoubleArray::FastDownCast(aoutArray);
-    if (inArray && outArray)
+  for (const auto& array : arrays)
+  {
+    const int numComponents = array.Input->GetNumberOfComponents();
+    for (int j = 0; j < numComponents; ++j)
     {
-      // We could template for speed.
-      const int numComponents = inArray->GetNumberOfComponents();
-      for (int j = 0; j < numComponents; ++j)
-      {
-        const double vIn1 = inArray->GetComponent(pt1Id, j);
-        const double vIn2 = inArray->GetComponent(pt2Id, j);
-        const double dv = 0.5 * (vIn1 + vIn2);
-        const double vOut = (dv * k) + outArray->GetTypedComponent(0, j);
-        outArray->SetTypedComponent(0, j, vOut);
-      }
+      const double vIn1 = array.Input->GetComponent(pt1Id, j);
+      const double vIn2 = array.Input->GetComponent(pt2Id, j);
+      const double dv = 0.5 * (vIn1 + vIn2);
+      result[array.Offset + j] += dv * k;
     }
-  };
-
-  fieldList.TransformData(index, inda, outda, f);
+  }
 }
 
 //------------------------------------------------------------------------------
 // Is the extra performance worth duplicating this code with IntergrateData2.
 void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegrateData3(
-  vtkDataSetAttributes* inda, vtkDataSetAttributes* outda, vtkIdType pt1Id, vtkIdType pt2Id,
-  vtkIdType pt3Id, double k, vtkIntegrateAttributes::vtkFieldList& fieldList, int index)
+  const std::vector<ArrayIntegration>& arrays, vtkIdType pt1Id, vtkIdType pt2Id, vtkIdType pt3Id,
+  double k, double* result)
 {
-  auto f = [pt1Id, pt2Id, pt3Id, k](vtkAbstractArray* ainArray, vtkAbstractArray* aoutArray) {
-    vtkDataArray* inArray = vtkDataArray::FastDownCast(ainArray);
-    vtkDoubleArray* outArray = vtkDoubleArray::FastDownCast(aoutArray);
-    if (inArray && outArray)
+  for (const auto& array : arrays)
+  {
+    const int numComponents = array.Input->GetNumberOfComponents();
+    for (int j = 0; j < numComponents; ++j)
     {
-      // We could template for speed.
-      const int numComponents = inArray->GetNumberOfComponents();
-      for (int j = 0; j < numComponents; ++j)
-      {
-        const double vIn1 = inArray->GetComponent(pt1Id, j);
-        const double vIn2 = inArray->GetComponent(pt2Id, j);
-        const double vIn3 = inArray->GetComponent(pt3Id, j);
-        const double dv = (vIn1 + vIn2 + vIn3) / 3.0;
-        const double vOut = (dv * k) + outArray->GetTypedComponent(0, j);
-        outArray->SetTypedComponent(0, j, vOut);
-      }
+      const double vIn1 = array.Input->GetComponent(pt1Id, j);
+      const double vIn2 = array.Input->GetComponent(pt2Id, j);
+      const double vIn3 = array.Input->GetComponent(pt3Id, j);
+      const double dv = (vIn1 + vIn2 + vIn3) / 3.0;
+      result[array.Offset + j] += dv * k;
     }
-  };
-  fieldList.TransformData(index, inda, outda, f);
+  }
 }
 
 //------------------------------------------------------------------------------
 // Is the extra performance worth duplicating this code with IntergrateData2.
 void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegrateData4(
-  vtkDataSetAttributes* inda, vtkDataSetAttributes* outda, vtkIdType pt1Id, vtkIdType pt2Id,
-  vtkIdType pt3Id, vtkIdType pt4Id, double k, vtkIntegrateAttributes::vtkFieldList& fieldList,
-  int index)
+  const std::vector<ArrayIntegration>& arrays, vtkIdType pt1Id, vtkIdType pt2Id, vtkIdType pt3Id,
+  vtkIdType pt4Id, double k, double* result)
 {
-  auto f = [pt1Id, pt2Id, pt3Id, pt4Id, k](
-             vtkAbstractArray* ainArray, vtkAbstractArray* aoutArray) {
-    vtkDataArray* inArray = vtkDataArray::FastDownCast(ainArray);
-    vtkDoubleArray* outArray = vtkDoubleArray::FastDownCast(aoutArray);
-    if (inArray && outArray)
+  for (const auto& array : arrays)
+  {
+    const int numComponents = array.Input->GetNumberOfComponents();
+    for (int j = 0; j < numComponents; ++j)
     {
-      // We could template for speed.
-      const int numComponents = inArray->GetNumberOfComponents();
-      for (int j = 0; j < numComponents; ++j)
-      {
-        const double vIn1 = inArray->GetComponent(pt1Id, j);
-        const double vIn2 = inArray->GetComponent(pt2Id, j);
-        const double vIn3 = inArray->GetComponent(pt3Id, j);
-        const double vIn4 = inArray->GetComponent(pt4Id, j);
-        const double dv = (vIn1 + vIn2 + vIn3 + vIn4) * 0.25;
-        const double vOut = (dv * k) + outArray->GetTypedComponent(0, j);
-        outArray->SetTypedComponent(0, j, vOut);
-      }
+      const double vIn1 = array.Input->GetComponent(pt1Id, j);
+      const double vIn2 = array.Input->GetComponent(pt2Id, j);
+      const double vIn3 = array.Input->GetComponent(pt3Id, j);
+      const double vIn4 = array.Input->GetComponent(pt4Id, j);
+      const double dv = (vIn1 + vIn2 + vIn3 + vIn4) * 0.25;
+      result[array.Offset + j] += dv * k;
     }
-  };
-
-  fieldList.TransformData(index, inda, outda, f);
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -855,10 +872,13 @@ void vtkIntegrateAttributes::IntegrateSatelliteData(
 }
 
 //------------------------------------------------------------------------------
-void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegratePolyLine(vtkDataSet* input,
-  vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdType numPts, const vtkIdType* cellPtIds,
-  double& sum, double sumCenter[3])
+void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegratePolyLine(const Block& block,
+  vtkIdType cellId, vtkIdType numPts, const vtkIdType* cellPtIds, double* result)
 {
+  vtkDataSet* input = block.Input;
+  double& sum = result[0];
+  double* sumCenter = result + 1;
+
   double length;
   double pt1[3], pt2[3], mid[3];
   vtkIdType numLines, lineIdx;
@@ -886,18 +906,20 @@ void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegratePolyLine(vt
     sumCenter[2] += mid[2] * length;
 
     // Now integrate the rest of the attributes.
-    vtkIntegrateAttributesFunctor::IntegrateData2(input->GetPointData(), output->GetPointData(),
-      pt1Id, pt2Id, length, this->PointFieldList, this->FieldListIndex);
-    vtkIntegrateAttributesFunctor::IntegrateData1(input->GetCellData(), output->GetCellData(),
-      cellId, length, this->CellFieldList, this->FieldListIndex);
+    vtkIntegrateAttributesFunctor::IntegrateData2(block.PointArrays, pt1Id, pt2Id, length, result);
+    vtkIntegrateAttributesFunctor::IntegrateData1(block.CellArrays, cellId, length, result);
   }
 }
 
 //------------------------------------------------------------------------------
 void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegrateGeneral1DCell(
-  vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdType numPts,
-  const vtkIdType* cellPtIds, double& sum, double sumCenter[3])
+  const Block& block, vtkIdType cellId, vtkIdType numPts, const vtkIdType* cellPtIds,
+  double* result)
 {
+  vtkDataSet* input = block.Input;
+  double& sum = result[0];
+  double* sumCenter = result + 1;
+
   // There should be an even number of points from the triangulation
   if (numPts % 2)
   {
@@ -929,17 +951,16 @@ void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegrateGeneral1DCe
     sumCenter[2] += mid[2] * length;
 
     // Now integrate the rest of the attributes.
-    vtkIntegrateAttributesFunctor::IntegrateData2(input->GetPointData(), output->GetPointData(),
-      cellPtIds[pid], cellPtIds[pid + 1], length, this->PointFieldList, this->FieldListIndex);
-    vtkIntegrateAttributesFunctor::IntegrateData1(input->GetCellData(), output->GetCellData(),
-      cellId, length, this->CellFieldList, this->FieldListIndex);
+    vtkIntegrateAttributesFunctor::IntegrateData2(
+      block.PointArrays, cellPtIds[pid], cellPtIds[pid + 1], length, result);
+    vtkIntegrateAttributesFunctor::IntegrateData1(block.CellArrays, cellId, length, result);
   }
 }
 
 //------------------------------------------------------------------------------
 void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegrateTriangleStrip(
-  vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdType numPts,
-  const vtkIdType* cellPtIds, double& sum, double sumCenter[3])
+  const Block& block, vtkIdType cellId, vtkIdType numPts, const vtkIdType* cellPtIds,
+  double* result)
 {
   vtkIdType numTris, triIdx;
   vtkIdType pt1Id, pt2Id, pt3Id;
@@ -950,15 +971,14 @@ void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegrateTriangleStr
     pt1Id = cellPtIds[triIdx];
     pt2Id = cellPtIds[triIdx + 1];
     pt3Id = cellPtIds[triIdx + 2];
-    this->IntegrateTriangle(input, output, cellId, pt1Id, pt2Id, pt3Id, sum, sumCenter);
+    this->IntegrateTriangle(block, cellId, pt1Id, pt2Id, pt3Id, result);
   }
 }
 
 //------------------------------------------------------------------------------
 // Works for convex polygons, and interpoaltion is not correct.
-void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegratePolygon(vtkDataSet* input,
-  vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdType numPts, const vtkIdType* cellPtIds,
-  double& sum, double sumCenter[3])
+void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegratePolygon(const Block& block,
+  vtkIdType cellId, vtkIdType numPts, const vtkIdType* cellPtIds, double* result)
 {
   vtkIdType numTris, triIdx;
   vtkIdType pt1Id, pt2Id, pt3Id;
@@ -969,16 +989,19 @@ void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegratePolygon(vtk
   {
     pt2Id = cellPtIds[triIdx + 1];
     pt3Id = cellPtIds[triIdx + 2];
-    this->IntegrateTriangle(input, output, cellId, pt1Id, pt2Id, pt3Id, sum, sumCenter);
+    this->IntegrateTriangle(block, cellId, pt1Id, pt2Id, pt3Id, result);
   }
 }
 
 //------------------------------------------------------------------------------
 // For axis aligned rectangular cells
-void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegratePixel(vtkDataSet* input,
-  vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdType vtkNotUsed(numPts),
-  const vtkIdType* cellPtIds, double& sum, double sumCenter[3])
+void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegratePixel(const Block& block,
+  vtkIdType cellId, vtkIdType vtkNotUsed(numPts), const vtkIdType* cellPtIds, double* result)
 {
+  vtkDataSet* input = block.Input;
+  double& sum = result[0];
+  double* sumCenter = result + 1;
+
   double pts[4][3];
   input->GetPoint(cellPtIds[0], pts[0]);
   input->GetPoint(cellPtIds[1], pts[1]);
@@ -1005,18 +1028,19 @@ void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegratePixel(vtkDa
   sumCenter[2] += mid[2] * a;
 
   // Now integrate the rest of the attributes.
-  vtkIntegrateAttributesFunctor::IntegrateData4(input->GetPointData(), output->GetPointData(),
-    cellPtIds[0], cellPtIds[1], cellPtIds[2], cellPtIds[3], a, this->PointFieldList,
-    this->FieldListIndex);
-  vtkIntegrateAttributesFunctor::IntegrateData1(input->GetCellData(), output->GetCellData(), cellId,
-    a, this->CellFieldList, this->FieldListIndex);
+  vtkIntegrateAttributesFunctor::IntegrateData4(
+    block.PointArrays, cellPtIds[0], cellPtIds[1], cellPtIds[2], cellPtIds[3], a, result);
+  vtkIntegrateAttributesFunctor::IntegrateData1(block.CellArrays, cellId, a, result);
 }
 
 //------------------------------------------------------------------------------
-void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegrateTriangle(vtkDataSet* input,
-  vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdType pt1Id, vtkIdType pt2Id, vtkIdType pt3Id,
-  double& sum, double sumCenter[3])
+void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegrateTriangle(const Block& block,
+  vtkIdType cellId, vtkIdType pt1Id, vtkIdType pt2Id, vtkIdType pt3Id, double* result)
 {
+  vtkDataSet* input = block.Input;
+  double& sum = result[0];
+  double* sumCenter = result + 1;
+
   double pt1[3], pt2[3], pt3[3];
   double mid[3], v1[3], v2[3];
   double cross[3];
@@ -1054,16 +1078,14 @@ void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegrateTriangle(vt
   sumCenter[2] += mid[2] * k;
 
   // Now integrate the rest of the attributes.
-  vtkIntegrateAttributesFunctor::IntegrateData3(input->GetPointData(), output->GetPointData(),
-    pt1Id, pt2Id, pt3Id, k, this->PointFieldList, this->FieldListIndex);
-  vtkIntegrateAttributesFunctor::IntegrateData1(input->GetCellData(), output->GetCellData(), cellId,
-    k, this->CellFieldList, this->FieldListIndex);
+  vtkIntegrateAttributesFunctor::IntegrateData3(block.PointArrays, pt1Id, pt2Id, pt3Id, k, result);
+  vtkIntegrateAttributesFunctor::IntegrateData1(block.CellArrays, cellId, k, result);
 }
 
 //------------------------------------------------------------------------------
 void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegrateGeneral2DCell(
-  vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdType numPts,
-  const vtkIdType* cellPtIds, double& sum, double sumCenter[3])
+  const Block& block, vtkIdType cellId, vtkIdType numPts, const vtkIdType* cellPtIds,
+  double* result)
 {
   // There should be a number of points that is a multiple of 3
   // from the triangulation
@@ -1081,16 +1103,20 @@ void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegrateGeneral2DCe
     pt1Id = cellPtIds[triIdx++];
     pt2Id = cellPtIds[triIdx++];
     pt3Id = cellPtIds[triIdx++];
-    this->IntegrateTriangle(input, output, cellId, pt1Id, pt2Id, pt3Id, sum, sumCenter);
+    this->IntegrateTriangle(block, cellId, pt1Id, pt2Id, pt3Id, result);
   }
 }
 
 //------------------------------------------------------------------------------
 // For Tetrahedral cells
-void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegrateTetrahedron(vtkDataSet* input,
-  vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdType pt1Id, vtkIdType pt2Id, vtkIdType pt3Id,
-  vtkIdType pt4Id, double& sum, double sumCenter[3])
+void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegrateTetrahedron(const Block& block,
+  vtkIdType cellId, vtkIdType pt1Id, vtkIdType pt2Id, vtkIdType pt3Id, vtkIdType pt4Id,
+  double* result)
 {
+  vtkDataSet* input = block.Input;
+  double& sum = result[0];
+  double* sumCenter = result + 1;
+
   double pts[4][3];
   input->GetPoint(pt1Id, pts[0]);
   input->GetPoint(pt2Id, pts[1]);
@@ -1119,20 +1145,22 @@ void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegrateTetrahedron
   sumCenter[2] += mid[2] * v;
 
   // Integrate the attributes on the cell itself
-  vtkIntegrateAttributesFunctor::IntegrateData1(input->GetCellData(), output->GetCellData(), cellId,
-    v, this->CellFieldList, this->FieldListIndex);
+  vtkIntegrateAttributesFunctor::IntegrateData1(block.CellArrays, cellId, v, result);
 
   // Integrate the attributes associated with the points
-  vtkIntegrateAttributesFunctor::IntegrateData4(input->GetPointData(), output->GetPointData(),
-    pt1Id, pt2Id, pt3Id, pt4Id, v, this->PointFieldList, this->FieldListIndex);
+  vtkIntegrateAttributesFunctor::IntegrateData4(
+    block.PointArrays, pt1Id, pt2Id, pt3Id, pt4Id, v, result);
 }
 
 //------------------------------------------------------------------------------
 // For axis aligned hexahedral cells
-void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegrateVoxel(vtkDataSet* input,
-  vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdType vtkNotUsed(numPts),
-  const vtkIdType* cellPtIds, double& sum, double sumCenter[3])
+void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegrateVoxel(const Block& block,
+  vtkIdType cellId, vtkIdType vtkNotUsed(numPts), const vtkIdType* cellPtIds, double* result)
 {
+  vtkDataSet* input = block.Input;
+  double& sum = result[0];
+  double* sumCenter = result + 1;
+
   vtkIdType pt1Id, pt2Id, pt3Id, pt4Id, pt5Id;
   double pts[5][3];
   pt1Id = cellPtIds[0];
@@ -1161,15 +1189,14 @@ void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegrateVoxel(vtkDa
   mid[2] = (pts[0][2] + pts[1][2] + pts[2][2] + pts[3][2]) * 0.125;
 
   // Integrate the attributes on the cell itself
-  vtkIntegrateAttributesFunctor::IntegrateData1(input->GetCellData(), output->GetCellData(), cellId,
-    v, this->CellFieldList, this->FieldListIndex);
+  vtkIntegrateAttributesFunctor::IntegrateData1(block.CellArrays, cellId, v, result);
 
   // Integrate the attributes associated with the points on the bottom face
   // note that since IntegrateData4 is going to weigh everything by 1/4
   // we need to pass down 1/2 the volume so they will be weighted by 1/8
 
-  vtkIntegrateAttributesFunctor::IntegrateData4(input->GetPointData(), output->GetPointData(),
-    pt1Id, pt2Id, pt3Id, pt4Id, v * 0.5, this->PointFieldList, this->FieldListIndex);
+  vtkIntegrateAttributesFunctor::IntegrateData4(
+    block.PointArrays, pt1Id, pt2Id, pt3Id, pt4Id, v * 0.5, result);
 
   // Now process the top face points
   pt1Id = cellPtIds[5];
@@ -1191,14 +1218,61 @@ void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegrateVoxel(vtkDa
   // Integrate the attributes associated with the points on the top face
   // note that since IntegrateData4 is going to weigh everything by 1/4
   // we need to pass down 1/2 the volume so they will be weighted by 1/8
-  vtkIntegrateAttributesFunctor::IntegrateData4(input->GetPointData(), output->GetPointData(),
-    pt1Id, pt2Id, pt3Id, pt5Id, v * 0.5, this->PointFieldList, this->FieldListIndex);
+  vtkIntegrateAttributesFunctor::IntegrateData4(
+    block.PointArrays, pt1Id, pt2Id, pt3Id, pt5Id, v * 0.5, result);
+}
+
+//------------------------------------------------------------------------------
+// For linear hexahedra, wedges and pyramids, split in tetrahedra like their
+// TriangulateIds() without building the cell.
+void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegrateLinear3DCell(
+  const Block& block, vtkIdType cellId, int cellType, const vtkIdType* cellPtIds, double* result)
+{
+  static constexpr int hexahedronTetras[20] = { 0, 1, 3, 4, 1, 4, 5, 6, 1, 4, 6, 3, 1, 3, 6, 2, 3,
+    6, 7, 4 };
+  static constexpr int wedgeTetras[12] = { 0, 2, 1, 3, 1, 3, 5, 4, 1, 2, 5, 3 };
+  static constexpr int pyramidTetras[2][8] = { { 0, 1, 2, 4, 0, 2, 3, 4 },
+    { 0, 1, 3, 4, 1, 2, 3, 4 } };
+
+  const int* tetras;
+  int numTetras;
+  switch (cellType)
+  {
+    case VTK_HEXAHEDRON:
+      tetras = hexahedronTetras;
+      numTetras = 5;
+      break;
+    case VTK_WEDGE:
+      tetras = wedgeTetras;
+      numTetras = 3;
+      break;
+    default:
+    {
+      // split the base along its shortest diagonal
+      double pts[4][3];
+      for (int i = 0; i < 4; ++i)
+      {
+        block.Input->GetPoint(cellPtIds[i], pts[i]);
+      }
+      const bool firstDiagonal = vtkMath::Distance2BetweenPoints(pts[0], pts[2]) <
+        vtkMath::Distance2BetweenPoints(pts[1], pts[3]);
+      tetras = pyramidTetras[firstDiagonal ? 0 : 1];
+      numTetras = 2;
+    }
+  }
+
+  for (int tetIdx = 0; tetIdx < numTetras; ++tetIdx)
+  {
+    const int* tetra = tetras + 4 * tetIdx;
+    this->IntegrateTetrahedron(block, cellId, cellPtIds[tetra[0]], cellPtIds[tetra[1]],
+      cellPtIds[tetra[2]], cellPtIds[tetra[3]], result);
+  }
 }
 
 //------------------------------------------------------------------------------
 void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegrateGeneral3DCell(
-  vtkDataSet* input, vtkUnstructuredGrid* output, vtkIdType cellId, vtkIdType numPts,
-  const vtkIdType* cellPtIds, double& sum, double sumCenter[3])
+  const Block& block, vtkIdType cellId, vtkIdType numPts, const vtkIdType* cellPtIds,
+  double* result)
 {
 
   // There should be a number of points that is a multiple of 4
@@ -1218,7 +1292,7 @@ void vtkIntegrateAttributes::vtkIntegrateAttributesFunctor::IntegrateGeneral3DCe
     pt2Id = cellPtIds[tetIdx++];
     pt3Id = cellPtIds[tetIdx++];
     pt4Id = cellPtIds[tetIdx++];
-    this->IntegrateTetrahedron(input, output, cellId, pt1Id, pt2Id, pt3Id, pt4Id, sum, sumCenter);
+    this->IntegrateTetrahedron(block, cellId, pt1Id, pt2Id, pt3Id, pt4Id, result);
   }
 }
 
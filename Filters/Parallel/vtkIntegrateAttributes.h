@@ -11,6 +11,10 @@
  * The output of this filter is a single point and vertex.  The attributes
  * for this point and cell will contain the integration results
  * for the corresponding input attributes.
+ *
+ * The cells of all the blocks of a composite dataset are integrated together
+ * with vtkSMPTools, in chunks of a fixed number of cells whose partial sums
+ * are added in order. The result does not depend on the number of threads.
  */
 
 #ifndef vtkIntegrateAttributes_h
@@ -96,9 +100,6 @@ private:
 
   static void AllocateAttributes(vtkFieldList& fieldList, vtkDataSetAttributes* outda);
   static void InitializeAttributes(vtkDataSetAttributes* outda);
-  void ExecuteBlock(vtkDataSet* input, vtkUnstructuredGrid* output, int fieldset_index,
-    vtkFieldList& pdList, vtkFieldList& cdList, double& totalSum, double totalSumCenter[3],
-    int integrationDimension);
 
 public:
   enum CommunicationIds
@@ -0,0 +1,163 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Locate the closest points and the points within a radius among random points
+// distributed over the processes with vtkDistributedPointLocator, and check the
+// results against a brute force search. Then give the k-d tree of the locator
+// to vtkPKdTree.
+
+#include "vtkBSPCuts.h"
+#include "vtkCellArray.h"
+#include "vtkDistributedPointLocator.h"
+#include "vtkIdTypeArray.h"
+#include "vtkIntArray.h"
+#include "vtkLogger.h"
+#include "vtkMath.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPKdTree.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+#include "vtkMPIController.h"
+#else
+#include "vtkDummyController.h"
+#endif
+
+#include <cstdlib>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace
+{
+//------------------------------------------------------------------------------
+// Points of a process, denser around a corner that depends on the process.
+vtkSmartPointer<vtkPoints> CreatePoints(int rank, vtkIdType numberOfPoints)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(1234 + rank);
+  auto points = vtkSmartPointer<vtkPoints>::New();
+  points->SetDataTypeToDouble();
+  points->SetNumberOfPoints(numberOfPoints);
+  for (vtkIdType ptId = 0; ptId < numberOfPoints; ++ptId)
+  {
+    double x[3];
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      const double value = random->GetNextValue();
+      x[axis] = (rank >> axis) % 2 ? 1.0 - value * value : value * value;
+    }
+    points->SetPoint(ptId, x);
+  }
+  return points;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestDistributedPointLocator(int argc, char* argv[])
+{
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+  vtkNew<vtkMPIController> contr;
+#else
+  vtkNew<vtkDummyController> contr;
+#endif
+  contr->Initialize(&argc, &argv);
+  vtkMultiProcessController::SetGlobalController(contr);
+  const int myId = contr->GetLocalProcessId();
+  const int numProcs = contr->GetNumberOfProcesses();
+  const double radius = 0.05;
+
+  std::vector<vtkSmartPointer<vtkPoints>> allPoints;
+  for (int rank = 0; rank < numProcs; ++rank)
+  {
+    allPoints.push_back(::CreatePoints(rank, 2000 + 500 * rank));
+  }
+  auto queries = ::CreatePoints(numProcs + myId, 300);
+
+  vtkNew<vtkDistributedPointLocator> locator;
+  locator->SetController(contr);
+  locator->SetPoints(allPoints[myId]);
+  locator->SetNumberOfSamples(64);
+  locator->BuildLocator();
+
+  vtkNew<vtkIntArray> processIds;
+  vtkNew<vtkIdTypeArray> pointIds;
+  locator->FindClosestPoints(queries, processIds, pointIds);
+  vtkNew<vtkIdTypeArray> offsets;
+  vtkNew<vtkIntArray> radiusProcessIds;
+  vtkNew<vtkIdTypeArray> radiusPointIds;
+  locator->FindPointsWithinRadius(radius, queries, offsets, radiusProcessIds, radiusPointIds);
+
+  int retVal = EXIT_SUCCESS;
+  for (vtkIdType cc = 0; cc < queries->GetNumberOfPoints() && retVal == EXIT_SUCCESS; ++cc)
+  {
+    double query[3];
+    queries->GetPoint(cc, query);
+    double closest = VTK_DOUBLE_MAX;
+    std::set<std::pair<int, vtkIdType>> within;
+    for (int rank = 0; rank < numProcs; ++rank)
+    {
+      for (vtkIdType ptId = 0; ptId < allPoints[rank]->GetNumberOfPoints(); ++ptId)
+      {
+        const double distance2 =
+          vtkMath::Distance2BetweenPoints(allPoints[rank]->GetPoint(ptId), query);
+        closest = std::min(closest, distance2);
+        if (distance2 <= radius * radius)
+        {
+          within.insert(std::make_pair(rank, ptId));
+        }
+      }
+    }
+
+    const int process = processIds->GetValue(cc);
+    if (process < 0 || process >= numProcs ||
+      vtkMath::Distance2BetweenPoints(
+        allPoints[process]->GetPoint(pointIds->GetValue(cc)), query) != closest)
+    {
+      vtkLog(ERROR, "Wrong closest point for query " << cc << " on process " << myId);
+      retVal = EXIT_FAILURE;
+    }
+
+    std::set<std::pair<int, vtkIdType>> found;
+    for (vtkIdType kk = offsets->GetValue(cc); kk < offsets->GetValue(cc + 1); ++kk)
+    {
+      found.insert(std::make_pair(radiusProcessIds->GetValue(kk), radiusPointIds->GetValue(kk)));
+    }
+    if (found != within)
+    {
+      vtkLog(ERROR,
+        "Found " << found.size() << " points within the radius of query " << cc
+                 << " instead of " << within.size() << " on process " << myId);
+      retVal = EXIT_FAILURE;
+    }
+  }
+
+  // the tree of the locator can replace the collective select of vtkPKdTree.
+  vtkBSPCuts* cuts = locator->GetCuts();
+  vtkNew<vtkCellArray> vertices;
+  for (vtkIdType ptId = 0; ptId < allPoints[myId]->GetNumberOfPoints(); ++ptId)
+  {
+    vertices->InsertNextCell(1, &ptId);
+  }
+  vtkNew<vtkPolyData> polyData;
+  polyData->SetPoints(allPoints[myId]);
+  polyData->SetVerts(vertices);
+  vtkNew<vtkPKdTree> kdTree;
+  kdTree->SetController(contr);
+  kdTree->SetCuts(cuts);
+  kdTree->SetDataSet(polyData);
+  kdTree->BuildLocator();
+  if (!cuts || kdTree->GetNumberOfRegions() != vtkMath::NearestPowerOfTwo(numProcs))
+  {
+    vtkLog(ERROR, "Wrong number of regions in the k-d tree: " << kdTree->GetNumberOfRegions());
+    retVal = EXIT_FAILURE;
+  }
+
+  int globalRetVal = retVal;
+  contr->AllReduce(&retVal, &globalRetVal, 1, vtkCommunicator::MAX_OP);
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  contr->Finalize();
+  return globalRetVal;
+}
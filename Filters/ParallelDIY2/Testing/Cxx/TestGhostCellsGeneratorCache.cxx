@@ -0,0 +1,211 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Generate ghosts on image and unstructured partitions over several time steps
+// with CacheTopology, and check that the output matches the output generated
+// without cache, that the cached topology is reused while only the fields
+// change, and that it is rebuilt when the geometry changes.
+
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+#include "vtkMPIController.h"
+#else
+#include "vtkDummyController.h"
+#endif
+
+#include "vtkAppendFilter.h"
+#include "vtkCellData.h"
+#include "vtkDataArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkGhostCellsGenerator.h"
+#include "vtkImageData.h"
+#include "vtkLogger.h"
+#include "vtkMultiProcessController.h"
+#include "vtkNew.h"
+#include "vtkPartitionedDataSet.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkTestUtilities.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+constexpr int NumberOfPartitionsPerRank = 3;
+
+//----------------------------------------------------------------------------
+// Partitions of a 12x4x3 image along x, several per rank.
+vtkSmartPointer<vtkPartitionedDataSet> CreatePartitions(
+  vtkMultiProcessController* controller, bool unstructured)
+{
+  const int numberOfPartitions = NumberOfPartitionsPerRank * controller->GetNumberOfProcesses();
+  const int width = 12;
+  auto pds = vtkSmartPointer<vtkPartitionedDataSet>::New();
+  for (int id = 0; id < NumberOfPartitionsPerRank; ++id)
+  {
+    const int partition = controller->GetLocalProcessId() * NumberOfPartitionsPerRank + id;
+    vtkNew<vtkImageData> image;
+    image->SetExtent(partition * width / numberOfPartitions,
+      (partition + 1) * width / numberOfPartitions, 0, 4, 0, 3);
+    image->SetSpacing(0.5, 1.0, 2.0);
+    if (unstructured)
+    {
+      vtkNew<vtkAppendFilter> append;
+      append->AddInputData(image);
+      append->Update();
+      pds->SetPartition(id, append->GetOutput());
+    }
+    else
+    {
+      pds->SetPartition(id, image);
+    }
+  }
+  return pds;
+}
+
+//----------------------------------------------------------------------------
+// Replace the point and cell fields with values depending on the position and the time.
+void SetFields(vtkPartitionedDataSet* pds, double time)
+{
+  for (unsigned int id = 0; id < pds->GetNumberOfPartitions(); ++id)
+  {
+    vtkDataSet* ds = pds->GetPartition(id);
+    vtkNew<vtkDoubleArray> temperature;
+    temperature->SetName("temperature");
+    temperature->SetNumberOfTuples(ds->GetNumberOfPoints());
+    for (vtkIdType pointId = 0; pointId < ds->GetNumberOfPoints(); ++pointId)
+    {
+      const double* x = ds->GetPoint(pointId);
+      temperature->SetValue(pointId, x[0] + 10.0 * x[1] + 100.0 * x[2] + time);
+    }
+    ds->GetPointData()->SetScalars(temperature);
+
+    vtkNew<vtkFloatArray> velocity;
+    velocity->SetName("velocity");
+    velocity->SetNumberOfComponents(2);
+    velocity->SetNumberOfTuples(ds->GetNumberOfCells());
+    for (vtkIdType cellId = 0; cellId < ds->GetNumberOfCells(); ++cellId)
+    {
+      double bounds[6];
+      ds->GetCellBounds(cellId, bounds);
+      velocity->SetTypedComponent(cellId, 0, static_cast<float>(bounds[0] * time));
+      velocity->SetTypedComponent(cellId, 1, static_cast<float>(bounds[2] + bounds[4] - time));
+    }
+    ds->GetCellData()->AddArray(velocity);
+  }
+}
+
+//----------------------------------------------------------------------------
+bool CompareOutputs(vtkPartitionedDataSet* pds, vtkPartitionedDataSet* refPDS)
+{
+  if (!pds || !refPDS || !vtkTestUtilities::CompareDataObjects(pds, refPDS))
+  {
+    return false;
+  }
+  for (unsigned int id = 0; id < pds->GetNumberOfPartitions(); ++id)
+  {
+    vtkDataSet* ds = pds->GetPartition(id);
+    if (!ds->GetPointData()->GetScalars() ||
+      strcmp(ds->GetPointData()->GetScalars()->GetName(), "temperature") != 0)
+    {
+      vtkLog(ERROR, "Active scalars not passed for partition " << id);
+      return false;
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool TestCache(vtkMultiProcessController* controller, bool unstructured, int numberOfGhostLayers)
+{
+  vtkSmartPointer<vtkPartitionedDataSet> pds = CreatePartitions(controller, unstructured);
+
+  vtkNew<vtkGhostCellsGenerator> cached;
+  cached->SetInputData(pds);
+  cached->CacheTopologyOn();
+  cached->BuildIfRequiredOff();
+  cached->SetNumberOfGhostLayers(numberOfGhostLayers);
+
+  vtkNew<vtkGhostCellsGenerator> reference;
+  reference->SetInputData(pds);
+  reference->BuildIfRequiredOff();
+  reference->SetNumberOfGhostLayers(numberOfGhostLayers);
+
+  vtkSmartPointer<vtkUnsignedCharArray> ghosts;
+  for (int step = 0; step < 4; ++step)
+  {
+    SetFields(pds, step);
+    if (step == 3)
+    {
+      // move the geometry, the topology has to be computed again
+      for (unsigned int id = 0; id < pds->GetNumberOfPartitions(); ++id)
+      {
+        if (auto image = vtkImageData::SafeDownCast(pds->GetPartition(id)))
+        {
+          image->SetOrigin(1.0, 0.0, 0.0);
+        }
+        else if (auto ug = vtkUnstructuredGrid::SafeDownCast(pds->GetPartition(id)))
+        {
+          ug->GetPoints()->Modified();
+        }
+      }
+    }
+    pds->Modified();
+    cached->Update();
+    reference->Update();
+
+    auto output = vtkPartitionedDataSet::SafeDownCast(cached->GetOutputDataObject(0));
+    auto refOutput = vtkPartitionedDataSet::SafeDownCast(reference->GetOutputDataObject(0));
+    if (!CompareOutputs(output, refOutput))
+    {
+      vtkLog(ERROR,
+        "Wrong output at step " << step << " for " << (unstructured ? "unstructured" : "image")
+                                << " partitions with " << numberOfGhostLayers << " layers");
+      return false;
+    }
+
+    // the cached ghost arrays are reused only while the geometry is unchanged
+    vtkUnsignedCharArray* outputGhosts = output->GetPartition(0)->GetCellData()->GetGhostArray();
+    if ((step == 1 || step == 2) != (outputGhosts == ghosts))
+    {
+      vtkLog(ERROR,
+        "The cached topology was " << (outputGhosts == ghosts ? "" : "not ") << "used at step "
+                                   << step);
+      return false;
+    }
+    ghosts = outputGhosts;
+  }
+  return true;
+}
+}
+
+//----------------------------------------------------------------------------
+int TestGhostCellsGeneratorCache(int argc, char* argv[])
+{
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+  vtkNew<vtkMPIController> controller;
+#else
+  vtkNew<vtkDummyController> controller;
+#endif
+  controller->Initialize(&argc, &argv);
+  vtkMultiProcessController::SetGlobalController(controller);
+
+  int retVal = EXIT_SUCCESS;
+  for (bool unstructured : { false, true })
+  {
+    for (int numberOfGhostLayers = 1; numberOfGhostLayers < 3; ++numberOfGhostLayers)
+    {
+      if (!TestCache(controller, unstructured, numberOfGhostLayers))
+      {
+        retVal = EXIT_FAILURE;
+      }
+    }
+  }
+
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  controller->Finalize();
+  return retVal;
+}
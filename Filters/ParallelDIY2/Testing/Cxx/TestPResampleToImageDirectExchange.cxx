@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Resample a distributed clipped wavelet with vtkPResampleToImage using the
+// direct exchange of the sampled points, and check the block of each process
+// against the serial resampling of the whole dataset.
+
+#include "vtkPResampleToImage.h"
+
+#include "vtkCharArray.h"
+#include "vtkClipDataSet.h"
+#include "vtkDataArray.h"
+#include "vtkImageData.h"
+#include "vtkLogger.h"
+#include "vtkMPIController.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkRTAnalyticSource.h"
+#include "vtkResampleToImage.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cmath>
+#include <cstdlib>
+
+int TestPResampleToImageDirectExchange(int argc, char* argv[])
+{
+  vtkNew<vtkMPIController> controller;
+  controller->Initialize(&argc, &argv);
+  vtkMultiProcessController::SetGlobalController(controller);
+  const int myId = controller->GetLocalProcessId();
+  const int numProcs = controller->GetNumberOfProcesses();
+
+  vtkNew<vtkRTAnalyticSource> wavelet;
+  wavelet->SetWholeExtent(0, 31, 0, 31, 0, 31);
+  wavelet->SetCenter(16, 16, 16);
+  vtkNew<vtkClipDataSet> clip;
+  clip->SetInputConnection(wavelet->GetOutputPort());
+  clip->SetValue(157);
+
+  // serial resampling of the whole clipped wavelet
+  clip->Update();
+  vtkNew<vtkUnstructuredGrid> whole;
+  whole->ShallowCopy(clip->GetOutput());
+  vtkNew<vtkResampleToImage> serial;
+  serial->SetSamplingDimensions(48, 48, 48);
+  serial->SetInputDataObject(whole);
+  serial->Update();
+  vtkImageData* reference = serial->GetOutput();
+
+  // parallel resampling of the pieces
+  clip->UpdatePiece(myId, numProcs, 0);
+  vtkNew<vtkUnstructuredGrid> piece;
+  piece->ShallowCopy(clip->GetOutput());
+  vtkNew<vtkPResampleToImage> resample;
+  resample->SetController(controller);
+  resample->SetSamplingDimensions(48, 48, 48);
+  resample->UseDirectExchangeOn();
+  resample->SetInputDataObject(piece);
+  resample->Update();
+  vtkImageData* output = resample->GetOutput();
+
+  int retVal = EXIT_SUCCESS;
+  const char* maskName = resample->GetMaskArrayName();
+  auto mask = vtkArrayDownCast<vtkCharArray>(output->GetPointData()->GetArray(maskName));
+  auto refMask = vtkArrayDownCast<vtkCharArray>(reference->GetPointData()->GetArray(maskName));
+  vtkDataArray* values = output->GetPointData()->GetArray("RTData");
+  vtkDataArray* refValues = reference->GetPointData()->GetArray("RTData");
+  if (!mask || !refMask || !values || !refValues)
+  {
+    vtkLog(ERROR, "Missing arrays in the output of process " << myId);
+    retVal = EXIT_FAILURE;
+  }
+  else
+  {
+    int extent[6];
+    output->GetExtent(extent);
+    vtkIdType numberOfValidPoints = 0;
+    for (int k = extent[4]; k <= extent[5]; ++k)
+    {
+      for (int j = extent[2]; j <= extent[3]; ++j)
+      {
+        for (int i = extent[0]; i <= extent[1]; ++i)
+        {
+          int ijk[3] = { i, j, k };
+          const vtkIdType id = output->ComputePointId(ijk);
+          const vtkIdType refId = reference->ComputePointId(ijk);
+          if (mask->GetValue(id) != refMask->GetValue(refId) ||
+            (mask->GetValue(id) &&
+              std::abs(values->GetTuple1(id) - refValues->GetTuple1(refId)) > 1e-4))
+          {
+            vtkLog(ERROR, "Wrong point " << i << " " << j << " " << k << " on process " << myId);
+            retVal = EXIT_FAILURE;
+            i = extent[1];
+            j = extent[3];
+            k = extent[5];
+          }
+          numberOfValidPoints += mask->GetValue(id) ? 1 : 0;
+        }
+      }
+    }
+    vtkLog(INFO, "Process " << myId << " has " << numberOfValidPoints << " valid points");
+  }
+
+  int globalRetVal;
+  controller->AllReduce(&retVal, &globalRetVal, 1, vtkCommunicator::MAX_OP);
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  controller->Finalize();
+  return globalRetVal;
+}
@@ -0,0 +1,165 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Partition an image whose cells have very different costs, given by a cell
+// weights array or a cost function, with the native and the space-filling
+// curve strategies, and check that the cost of the partitions is balanced.
+
+#include "vtkCellData.h"
+#include "vtkDataSet.h"
+#include "vtkDoubleArray.h"
+#include "vtkDummyController.h"
+#include "vtkIdTypeArray.h"
+#include "vtkImageData.h"
+#include "vtkLogger.h"
+#include "vtkNativePartitioningStrategy.h"
+#include "vtkNew.h"
+#include "vtkPartitionedDataSet.h"
+#include "vtkPartitionedDataSetCollection.h"
+#include "vtkRedistributeDataSetFilter.h"
+#include "vtkSpaceFillingCurvePartitioningStrategy.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+//----------------------------------------------------------------------------
+// Cells in the corner x < 10, y < 20 cost 100 times more than the others.
+double GetCost(vtkDataSet* ds, vtkIdType cellId)
+{
+  double bounds[6];
+  ds->GetCellBounds(cellId, bounds);
+  return bounds[0] < 10.0 && bounds[2] < 20.0 ? 100.0 : 1.0;
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkPartitionedDataSetCollection> CreateCollection()
+{
+  // two partitions covering a 40x40x20 image
+  auto collection = vtkSmartPointer<vtkPartitionedDataSetCollection>::New();
+  vtkNew<vtkPartitionedDataSet> pds;
+  for (int id = 0; id < 2; ++id)
+  {
+    vtkNew<vtkImageData> image;
+    image->SetExtent(0, 40, 0, 40, id * 10, id * 10 + 10);
+    vtkNew<vtkDoubleArray> costs;
+    costs->SetName("cost");
+    costs->SetNumberOfTuples(image->GetNumberOfCells());
+    for (vtkIdType cellId = 0; cellId < image->GetNumberOfCells(); ++cellId)
+    {
+      costs->SetValue(cellId, GetCost(image, cellId));
+    }
+    image->GetCellData()->AddArray(costs);
+    pds->SetPartition(id, image);
+  }
+  collection->SetPartitionedDataSet(0, pds);
+  return collection;
+}
+
+//----------------------------------------------------------------------------
+// Check that the cost of the largest partition is within `tolerance` of the average cost.
+bool CheckBalance(vtkPartitioningStrategy* strategy, vtkPartitionedDataSetCollection* collection,
+  vtkIdType numberOfPartitions, double tolerance, const char* name)
+{
+  auto infos = strategy->ComputePartition(collection);
+  vtkPartitionedDataSet* pds = collection->GetPartitionedDataSet(0);
+  if (infos.size() != pds->GetNumberOfPartitions())
+  {
+    vtkLog(ERROR, "Wrong number of partition information for " << name);
+    return false;
+  }
+
+  std::vector<double> costs(numberOfPartitions, 0.0);
+  double total = 0.0;
+  for (unsigned int id = 0; id < pds->GetNumberOfPartitions(); ++id)
+  {
+    vtkDataSet* ds = pds->GetPartition(id);
+    const auto& info = infos[id];
+    if (info.NumberOfPartitions != numberOfPartitions ||
+      info.TargetPartitions->GetNumberOfTuples() != ds->GetNumberOfCells())
+    {
+      vtkLog(ERROR, "Wrong partition information for " << name);
+      return false;
+    }
+    for (vtkIdType cellId = 0; cellId < ds->GetNumberOfCells(); ++cellId)
+    {
+      const vtkIdType part = info.TargetPartitions->GetValue(cellId);
+      if (part < 0 || part >= numberOfPartitions)
+      {
+        vtkLog(ERROR, "Wrong partition " << part << " for " << name);
+        return false;
+      }
+      costs[part] += GetCost(ds, cellId);
+      total += GetCost(ds, cellId);
+    }
+  }
+
+  const double average = total / numberOfPartitions;
+  const double maximum = *std::max_element(costs.begin(), costs.end());
+  if (maximum > (1.0 + tolerance) * average)
+  {
+    vtkLog(ERROR,
+      "Imbalanced partitions for " << name << ": maximum cost " << maximum << " for an average of "
+                                   << average);
+    return false;
+  }
+  return true;
+}
+}
+
+//----------------------------------------------------------------------------
+int TestPartitioningStrategyWeights(int argc, char* argv[])
+{
+  vtkNew<vtkDummyController> controller;
+  controller->Initialize(&argc, &argv);
+  vtkMultiProcessController::SetGlobalController(controller);
+
+  vtkSmartPointer<vtkPartitionedDataSetCollection> collection = CreateCollection();
+  bool success = true;
+
+  // the native cuts are planes between layers of cells, which limits their balance. Without the
+  // weights, a single partition would hold most of the costly cells.
+  vtkNew<vtkNativePartitioningStrategy> native;
+  native->SetController(controller);
+  native->SetNumberOfPartitions(8);
+  native->SetCellWeightsArrayName("cost");
+  success &= CheckBalance(native, collection, 8, 0.2, "native strategy with weights array");
+
+  vtkNew<vtkSpaceFillingCurvePartitioningStrategy> curve;
+  curve->SetController(controller);
+  curve->SetNumberOfPartitions(7);
+  curve->SetCellWeightsArrayName("cost");
+  for (int type : { vtkSpaceFillingCurvePartitioningStrategy::MORTON,
+         vtkSpaceFillingCurvePartitioningStrategy::HILBERT })
+  {
+    curve->SetCurve(type);
+    success &= CheckBalance(curve, collection, 7, 0.01, "curve strategy with weights array");
+  }
+
+  // the cost function takes precedence over the weights array
+  collection->GetPartitionedDataSet(0)->GetPartition(0)->GetCellData()->RemoveArray("cost");
+  native->SetCellCostFunction(GetCost);
+  success &= CheckBalance(native, collection, 8, 0.2, "native strategy with cost function");
+  curve->SetCellCostFunction(GetCost);
+  success &= CheckBalance(curve, collection, 7, 0.01, "curve strategy with cost function");
+
+  // redistribute with the space-filling curve
+  vtkNew<vtkRedistributeDataSetFilter> redistribute;
+  redistribute->SetController(controller);
+  redistribute->SetStrategy(curve);
+  redistribute->SetInputData(collection);
+  redistribute->Update();
+  auto output = vtkPartitionedDataSetCollection::SafeDownCast(redistribute->GetOutputDataObject(0));
+  if (!output || output->GetPartitionedDataSet(0)->GetNumberOfPartitions() != 7 ||
+    output->GetNumberOfCells() != 40 * 40 * 20)
+  {
+    vtkLog(ERROR, "Wrong output of the redistribution with the curve strategy");
+    success = false;
+  }
+
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  controller->Finalize();
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -4,14 +4,17 @@
 #include "vtkDIYKdTreeUtilities.h"
 
 #include "vtkAppendFilter.h"
+#include "vtkBSPCuts.h"
 #include "vtkBoundingBox.h"
 #include "vtkCellData.h"
 #include "vtkCompositeDataSet.h"
 #include "vtkDIYExplicitAssigner.h"
 #include "vtkDIYUtilities.h"
 #include "vtkIdTypeArray.h"
+#include "vtkKdNode.h"
 #include "vtkLogger.h"
 #include "vtkMath.h"
+#include "vtkMultiProcessController.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPartitionedDataSet.h"
@@ -21,8 +24,11 @@
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
+#include <array>
 #include <iterator>
 #include <map>
+#include <numeric>
 #include <memory>
 #include <tuple>
 
@@ -74,6 +80,81 @@ struct BlockT
   }
 };
 
+//------------------------------------------------------------------------------
+// Release a tree of vtkKdNode, whose nodes reference their parent.
+void DeleteKdTree(vtkKdNode* node)
+{
+  vtkKdNode* left = node->GetLeft();
+  vtkKdNode* right = node->GetRight();
+  if (left)
+  {
+    left->Register(nullptr);
+    right->Register(nullptr);
+    node->DeleteChildNodes();
+    DeleteKdTree(left);
+    DeleteKdTree(right);
+  }
+  node->Delete();
+}
+
+//------------------------------------------------------------------------------
+// Create the node of the k-d tree covering the leaves [begin, end) of `cuts`,
+// or nullptr when the boxes do not form a k-d tree.
+vtkKdNode* CreateKdNode(const std::vector<vtkBoundingBox>& cuts, int begin, int end)
+{
+  vtkBoundingBox bbox;
+  for (int cc = begin; cc < end; ++cc)
+  {
+    bbox.AddBox(cuts[cc]);
+  }
+  double bds[6];
+  bbox.GetBounds(bds);
+  vtkKdNode* node = vtkKdNode::New();
+  node->SetBounds(bds);
+  node->SetDataBounds(bds[0], bds[1], bds[2], bds[3], bds[4], bds[5]);
+  node->SetMinID(begin);
+  node->SetMaxID(end - 1);
+  if (end - begin == 1)
+  {
+    node->SetID(begin);
+    node->SetDim(3);
+    return node;
+  }
+
+  // the two halves must be separated by a plane normal to one of the axes.
+  vtkKdNode* left = CreateKdNode(cuts, begin, (begin + end) / 2);
+  vtkKdNode* right = CreateKdNode(cuts, (begin + end) / 2, end);
+  int dim = -1;
+  for (int axis = 0; left && right && axis < 3 && dim < 0; ++axis)
+  {
+    bool separated = left->GetMaxBounds()[axis] == right->GetMinBounds()[axis];
+    for (int other = 0; separated && other < 3; ++other)
+    {
+      separated = other == axis ||
+        (left->GetMinBounds()[other] == right->GetMinBounds()[other] &&
+          left->GetMaxBounds()[other] == right->GetMaxBounds()[other]);
+    }
+    dim = separated ? axis : -1;
+  }
+  if (dim < 0)
+  {
+    if (left)
+    {
+      DeleteKdTree(left);
+    }
+    if (right)
+    {
+      DeleteKdTree(right);
+    }
+    node->Delete();
+    return nullptr;
+  }
+  node->SetDim(dim);
+  node->AddChildNodes(left, right);
+  left->Delete();
+  right->Delete();
+  return node;
+}
 }
 
 //------------------------------------------------------------------------------
@@ -271,6 +352,347 @@ std::vector<vtkBoundingBox> vtkDIYKdTreeUtilities::GenerateCuts(
   return cuts;
 }
 
+//------------------------------------------------------------------------------
+std::vector<vtkBoundingBox> vtkDIYKdTreeUtilities::GenerateCuts(
+  const std::vector<vtkSmartPointer<vtkPoints>>& points,
+  const std::vector<std::vector<double>>& weights, int number_of_partitions,
+  vtkMultiProcessController* controller, const double* local_bounds /*=nullptr*/)
+{
+  if (number_of_partitions == 0)
+  {
+    return std::vector<vtkBoundingBox>();
+  }
+
+  vtkBoundingBox bbox;
+  if (local_bounds != nullptr)
+  {
+    bbox.SetBounds(local_bounds);
+  }
+  if (!bbox.IsValid())
+  {
+    for (auto& pts : points)
+    {
+      if (pts)
+      {
+        double bds[6];
+        pts->GetBounds(bds);
+        bbox.AddBounds(bds);
+      }
+    }
+  }
+
+  diy::mpi::communicator comm = vtkDIYUtilities::GetCommunicator(controller);
+  vtkDIYUtilities::AllReduce(comm, bbox);
+  if (!bbox.IsValid())
+  {
+    return std::vector<vtkBoundingBox>();
+  }
+  if (number_of_partitions == 1)
+  {
+    return std::vector<vtkBoundingBox>{ bbox };
+  }
+
+  // gather the weighted points along with the index of the box they lie in.
+  std::vector<std::array<double, 3>> coords;
+  std::vector<double> pointWeights;
+  for (size_t idx = 0; idx < points.size(); ++idx)
+  {
+    vtkPoints* pts = points[idx];
+    for (vtkIdType cc = 0, max = pts ? pts->GetNumberOfPoints() : 0; cc < max; ++cc)
+    {
+      const double weight =
+        idx < weights.size() && !weights[idx].empty() ? weights[idx][cc] : 1.0;
+      if (weight > 0)
+      {
+        coords.emplace_back();
+        pts->GetPoint(cc, coords.back().data());
+        pointWeights.push_back(weight);
+      }
+    }
+  }
+  std::vector<int> boxIds(coords.size(), 0);
+
+  const bool parallel = controller && controller->GetNumberOfProcesses() > 1;
+  const int num_cuts = vtkMath::NearestPowerOfTwo(number_of_partitions);
+  constexpr int numberOfBins = 256;
+  constexpr int numberOfRefinements = 3;
+
+  std::vector<vtkBoundingBox> boxes{ bbox };
+  while (static_cast<int>(boxes.size()) < num_cuts)
+  {
+    const size_t numberOfBoxes = boxes.size();
+    std::vector<int> axes(numberOfBoxes);
+    std::vector<double> lower(numberOfBoxes), width(numberOfBoxes);
+    std::vector<double> cuts(numberOfBoxes);
+    std::vector<bool> done(numberOfBoxes, false);
+    for (size_t box = 0; box < numberOfBoxes; ++box)
+    {
+      double lengths[3];
+      boxes[box].GetLengths(lengths);
+      axes[box] = static_cast<int>(std::max_element(lengths, lengths + 3) - lengths);
+      lower[box] = boxes[box].GetMinPoint()[axes[box]];
+      width[box] = boxes[box].GetLength(axes[box]);
+      cuts[box] = lower[box] + 0.5 * width[box];
+    }
+
+    // refine the bin holding the weighted median of each box: the first and last
+    // bins of a box histogram hold the weight below and above the refined range.
+    const int stride = numberOfBins + 2;
+    std::vector<double> histograms(numberOfBoxes * stride), globalHistograms;
+    for (int refinement = 0; refinement < numberOfRefinements; ++refinement)
+    {
+      std::fill(histograms.begin(), histograms.end(), 0.0);
+      for (size_t cc = 0; cc < coords.size(); ++cc)
+      {
+        const int box = boxIds[cc];
+        const double x = coords[cc][axes[box]] - lower[box];
+        int bin;
+        if (x < 0)
+        {
+          bin = 0;
+        }
+        else if (x >= width[box])
+        {
+          bin = numberOfBins + 1;
+        }
+        else
+        {
+          bin = 1 + std::min(numberOfBins - 1, static_cast<int>(x / width[box] * numberOfBins));
+        }
+        histograms[box * stride + bin] += pointWeights[cc];
+      }
+      if (parallel)
+      {
+        globalHistograms.resize(histograms.size());
+        controller->AllReduce(histograms.data(), globalHistograms.data(),
+          static_cast<vtkIdType>(histograms.size()), vtkCommunicator::SUM_OP);
+        histograms.swap(globalHistograms);
+      }
+
+      for (size_t box = 0; box < numberOfBoxes; ++box)
+      {
+        const double* histogram = histograms.data() + box * stride;
+        const double total = std::accumulate(histogram, histogram + stride, 0.0);
+        if (done[box] || total <= 0)
+        {
+          done[box] = true;
+          continue;
+        }
+        const double half = 0.5 * total;
+        double cumulated = histogram[0];
+        const double binWidth = width[box] / numberOfBins;
+        int bin = 0;
+        while (bin < numberOfBins - 1 && cumulated + histogram[bin + 1] < half)
+        {
+          cumulated += histogram[++bin];
+        }
+        // interpolate the median within its bin for the last refinement
+        const double binWeight = histogram[bin + 1];
+        const double ratio = binWeight > 0 ? (half - cumulated) / binWeight : 0.5;
+        cuts[box] = lower[box] + (bin + std::max(0.0, std::min(1.0, ratio))) * binWidth;
+        lower[box] += bin * binWidth;
+        width[box] = binWidth;
+      }
+    }
+
+    std::vector<vtkBoundingBox> children(2 * numberOfBoxes);
+    for (size_t box = 0; box < numberOfBoxes; ++box)
+    {
+      double bds[6];
+      boxes[box].GetBounds(bds);
+      double left[6], right[6];
+      std::copy(bds, bds + 6, left);
+      std::copy(bds, bds + 6, right);
+      left[2 * axes[box] + 1] = cuts[box];
+      right[2 * axes[box]] = cuts[box];
+      children[2 * box].SetBounds(left);
+      children[2 * box + 1].SetBounds(right);
+    }
+    for (size_t cc = 0; cc < coords.size(); ++cc)
+    {
+      const int box = boxIds[cc];
+      boxIds[cc] = 2 * box + (coords[cc][axes[box]] >= cuts[box] ? 1 : 0);
+    }
+    boxes.swap(children);
+  }
+
+  return boxes;
+}
+
+//------------------------------------------------------------------------------
+std::vector<vtkBoundingBox> vtkDIYKdTreeUtilities::GenerateSampledCuts(
+  const std::vector<vtkSmartPointer<vtkPoints>>& points, int number_of_partitions,
+  int number_of_samples, vtkMultiProcessController* controller,
+  const double* local_bounds /*=nullptr*/)
+{
+  if (number_of_partitions == 0)
+  {
+    return std::vector<vtkBoundingBox>();
+  }
+
+  vtkBoundingBox bbox;
+  if (local_bounds != nullptr)
+  {
+    bbox.SetBounds(local_bounds);
+  }
+  if (!bbox.IsValid())
+  {
+    for (auto& pts : points)
+    {
+      if (pts)
+      {
+        double bds[6];
+        pts->GetBounds(bds);
+        bbox.AddBounds(bds);
+      }
+    }
+  }
+
+  diy::mpi::communicator comm = vtkDIYUtilities::GetCommunicator(controller);
+  vtkDIYUtilities::AllReduce(comm, bbox);
+  if (!bbox.IsValid())
+  {
+    return std::vector<vtkBoundingBox>();
+  }
+  if (number_of_partitions == 1)
+  {
+    return std::vector<vtkBoundingBox>{ bbox };
+  }
+
+  std::vector<std::array<double, 3>> coords;
+  for (auto& pts : points)
+  {
+    for (vtkIdType cc = 0, max = pts ? pts->GetNumberOfPoints() : 0; cc < max; ++cc)
+    {
+      coords.emplace_back();
+      pts->GetPoint(cc, coords.back().data());
+    }
+  }
+  std::vector<int> boxIds(coords.size(), 0);
+
+  const int num_cuts = vtkMath::NearestPowerOfTwo(number_of_partitions);
+  number_of_samples = std::max(1, number_of_samples);
+
+  std::vector<vtkBoundingBox> boxes{ bbox };
+  while (static_cast<int>(boxes.size()) < num_cuts)
+  {
+    const size_t numberOfBoxes = boxes.size();
+    std::vector<int> axes(numberOfBoxes);
+    std::vector<std::vector<vtkIdType>> members(numberOfBoxes);
+    std::vector<vtkIdType> localCounts(numberOfBoxes), globalCounts;
+    for (size_t cc = 0; cc < coords.size(); ++cc)
+    {
+      members[boxIds[cc]].push_back(static_cast<vtkIdType>(cc));
+    }
+    for (size_t box = 0; box < numberOfBoxes; ++box)
+    {
+      double lengths[3];
+      boxes[box].GetLengths(lengths);
+      axes[box] = static_cast<int>(std::max_element(lengths, lengths + 3) - lengths);
+      localCounts[box] = static_cast<vtkIdType>(members[box].size());
+    }
+    diy::mpi::all_reduce(comm, localCounts, globalCounts, std::plus<vtkIdType>());
+
+    // (box, coordinate, weight) triplets, each sample standing for the local
+    // points of its box around it.
+    std::vector<double> samples;
+    for (size_t box = 0; box < numberOfBoxes; ++box)
+    {
+      const vtkIdType count = localCounts[box];
+      if (count == 0)
+      {
+        continue;
+      }
+      const vtkIdType numberOfLocalSamples = std::min(
+        count, std::max<vtkIdType>(1, number_of_samples * count / globalCounts[box]));
+      for (vtkIdType cc = 0; cc < numberOfLocalSamples; ++cc)
+      {
+        const vtkIdType ptId = members[box][(2 * cc + 1) * count / (2 * numberOfLocalSamples)];
+        samples.push_back(static_cast<double>(box));
+        samples.push_back(coords[ptId][axes[box]]);
+        samples.push_back(static_cast<double>(count) / numberOfLocalSamples);
+      }
+    }
+    std::vector<std::vector<double>> allSamples;
+    diy::mpi::all_gather(comm, samples, allSamples);
+
+    std::vector<std::vector<std::pair<double, double>>> boxSamples(numberOfBoxes);
+    for (const auto& rankSamples : allSamples)
+    {
+      for (size_t cc = 0; cc + 2 < rankSamples.size(); cc += 3)
+      {
+        boxSamples[static_cast<size_t>(rankSamples[cc])].emplace_back(
+          rankSamples[cc + 1], rankSamples[cc + 2]);
+      }
+    }
+
+    std::vector<vtkBoundingBox> children(2 * numberOfBoxes);
+    std::vector<double> cuts(numberOfBoxes);
+    for (size_t box = 0; box < numberOfBoxes; ++box)
+    {
+      double bds[6];
+      boxes[box].GetBounds(bds);
+      auto& values = boxSamples[box];
+      if (values.empty())
+      {
+        cuts[box] = 0.5 * (bds[2 * axes[box]] + bds[2 * axes[box] + 1]);
+      }
+      else
+      {
+        // weighted median of the samples
+        std::sort(values.begin(), values.end());
+        double half = 0.0;
+        for (const auto& value : values)
+        {
+          half += 0.5 * value.second;
+        }
+        double cumulated = 0.0;
+        size_t median = 0;
+        while (median + 1 < values.size() && cumulated + values[median].second < half)
+        {
+          cumulated += values[median++].second;
+        }
+        cuts[box] = values[median].first;
+      }
+
+      double left[6], right[6];
+      std::copy(bds, bds + 6, left);
+      std::copy(bds, bds + 6, right);
+      left[2 * axes[box] + 1] = cuts[box];
+      right[2 * axes[box]] = cuts[box];
+      children[2 * box].SetBounds(left);
+      children[2 * box + 1].SetBounds(right);
+    }
+    for (size_t cc = 0; cc < coords.size(); ++cc)
+    {
+      const int box = boxIds[cc];
+      boxIds[cc] = 2 * box + (coords[cc][axes[box]] >= cuts[box] ? 1 : 0);
+    }
+    boxes.swap(children);
+  }
+
+  return boxes;
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkBSPCuts> vtkDIYKdTreeUtilities::CreateBSPCuts(
+  const std::vector<vtkBoundingBox>& cuts)
+{
+  if (cuts.empty() || !vtkMath::IsPowerOfTwo(static_cast<vtkTypeUInt64>(cuts.size())))
+  {
+    return nullptr;
+  }
+  vtkKdNode* top = ::CreateKdNode(cuts, 0, static_cast<int>(cuts.size()));
+  if (!top)
+  {
+    return nullptr;
+  }
+  auto bspCuts = vtkSmartPointer<vtkBSPCuts>::New();
+  bspCuts->CreateCuts(top);
+  ::DeleteKdTree(top);
+  return bspCuts;
+}
+
 //------------------------------------------------------------------------------
 vtkSmartPointer<vtkPartitionedDataSet> vtkDIYKdTreeUtilities::Exchange(
   vtkPartitionedDataSet* localParts, vtkMultiProcessController* controller,
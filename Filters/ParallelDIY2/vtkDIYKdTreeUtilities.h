@@ -22,6 +22,7 @@
 #include <vector> // for std::vector
 
 VTK_ABI_NAMESPACE_BEGIN
+class vtkBSPCuts;
 class vtkDataObject;
 class vtkDataSet;
 class vtkIntArray;
@@ -78,6 +79,45 @@ public:
     const std::vector<vtkSmartPointer<vtkPoints>>& points, int number_of_partitions,
     vtkMultiProcessController* controller = nullptr, const double* local_bounds = nullptr);
 
+  /**
+   * Variant of GenerateCuts that balances the total weight of the points instead
+   * of their number. `weights` has one vector per element of `points`, with one
+   * weight per point; an empty vector gives a weight of 1 to each point of the
+   * corresponding element, and points with a null or negative weight are ignored.
+   *
+   * The domain is recursively bisected along the longest axis of each box, at
+   * the weighted median computed from global histograms refined a few times.
+   * Like the unweighted variant, the number of boxes is the power of two
+   * greater than or equal to `number_of_partitions`.
+   */
+  static std::vector<vtkBoundingBox> GenerateCuts(
+    const std::vector<vtkSmartPointer<vtkPoints>>& points,
+    const std::vector<std::vector<double>>& weights, int number_of_partitions,
+    vtkMultiProcessController* controller = nullptr, const double* local_bounds = nullptr);
+
+  /**
+   * Variant of GenerateCuts that chooses each split value from samples of the
+   * points instead of global histograms. At each level of the tree, every rank
+   * takes evenly spaced samples of its points in each box, in proportion to its
+   * share of the points of that box, for a total of about `number_of_samples`
+   * per box. The split value is the weighted median of the samples gathered
+   * from all the ranks. Boxes are bisected along their longest axis and, like
+   * the other variants, the number of boxes is the power of two greater than or
+   * equal to `number_of_partitions`.
+   */
+  static std::vector<vtkBoundingBox> GenerateSampledCuts(
+    const std::vector<vtkSmartPointer<vtkPoints>>& points, int number_of_partitions,
+    int number_of_samples, vtkMultiProcessController* controller = nullptr,
+    const double* local_bounds = nullptr);
+
+  /**
+   * Convert the cuts returned by `GenerateCuts` or `GenerateSampledCuts` into
+   * a vtkBSPCuts, e.g. to give them to vtkPKdTree::SetCuts. The number of cuts
+   * must be a power of two, and the leaf of the tree with ID `i` is `cuts[i]`.
+   * Returns nullptr if the cuts are empty or do not form a k-d tree.
+   */
+  static vtkSmartPointer<vtkBSPCuts> CreateBSPCuts(const std::vector<vtkBoundingBox>& cuts);
+
   /**
    * Exchange parts in the partitioned dataset among ranks in the parallel group
    * defined by the `controller`. The parts are assigned to ranks in a
@@ -0,0 +1,485 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkDistributedPointLocator.h"
+
+#include "vtkBSPCuts.h"
+#include "vtkBoundingBox.h"
+#include "vtkDIYKdTreeUtilities.h"
+#include "vtkDIYUtilities.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkIntArray.h"
+#include "vtkKdNode.h"
+#include "vtkMath.h"
+#include "vtkMultiProcessController.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkStaticPointLocator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+#include <vector>
+
+// clang-format off
+#include "vtk_diy2.h"
+#include VTK_DIY2(diy/mpi.hpp)
+#include VTK_DIY2(diy/master.hpp)
+#include VTK_DIY2(diy/assigner.hpp)
+#include VTK_DIY2(diy/decomposition.hpp)
+#include VTK_DIY2(diy/reduce-operations.hpp)
+// clang-format on
+
+namespace
+{
+// A point moved to the process owning its region.
+struct PointRecord
+{
+  double Coords[3];
+  int Process;
+  vtkIdType Id;
+};
+
+// A query sent to a process, looking for points within sqrt(Radius2).
+struct QueryRecord
+{
+  double Coords[3];
+  double Radius2;
+  vtkIdType Index;
+};
+
+// A point found for a query.
+struct AnswerRecord
+{
+  double Distance2;
+  vtkIdType Index;
+  int Process;
+  vtkIdType Id;
+
+  bool operator<(const AnswerRecord& other) const
+  {
+    return std::tie(this->Distance2, this->Process, this->Id) <
+      std::tie(other.Distance2, other.Process, other.Id);
+  }
+};
+
+//------------------------------------------------------------------------------
+// Send `outgoing[rank]` to each rank and return what each rank sent to this one.
+template <typename T>
+std::vector<std::vector<T>> ExchangeRecords(
+  diy::mpi::communicator& comm, std::vector<std::vector<T>>& outgoing)
+{
+  using BlockT = std::vector<std::vector<T>>;
+  diy::Master master(
+    comm, 1, -1, []() { return static_cast<void*>(new BlockT()); },
+    [](void* b) { delete static_cast<BlockT*>(b); });
+  diy::ContiguousAssigner assigner(comm.size(), comm.size());
+  diy::RegularDecomposer<diy::DiscreteBounds> decomposer(
+    /*dim*/ 1, diy::interval(0, comm.size() - 1), comm.size());
+  decomposer.decompose(comm.rank(), assigner, master);
+
+  const int myrank = comm.rank();
+  diy::all_to_all(master, assigner,
+    [&outgoing, myrank](BlockT* block, const diy::ReduceProxy& rp)
+    {
+      if (rp.in_link().size() == 0)
+      {
+        block->resize(outgoing.size());
+        // short-circuit messages to self.
+        (*block)[myrank].swap(outgoing[myrank]);
+        for (int rank = 0; rank < static_cast<int>(outgoing.size()); ++rank)
+        {
+          if (rank != myrank && !outgoing[rank].empty())
+          {
+            rp.enqueue(rp.out_link().target(rank), outgoing[rank]);
+          }
+        }
+      }
+      else
+      {
+        for (int i = 0; i < rp.in_link().size(); ++i)
+        {
+          const int gid = rp.in_link().target(i).gid;
+          while (rp.incoming(gid))
+          {
+            std::vector<T> records;
+            rp.dequeue(rp.in_link().target(i), records);
+            auto& received = (*block)[gid];
+            received.insert(received.end(), records.begin(), records.end());
+          }
+        }
+      }
+    });
+
+  BlockT result;
+  result.swap(*master.block<BlockT>(0));
+  result.resize(outgoing.size());
+  return result;
+}
+
+//------------------------------------------------------------------------------
+// Squared distance from a point to a box, 0 inside.
+double GetDistance2(const vtkBoundingBox& box, const double x[3])
+{
+  double distance2 = 0.0;
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    const double delta = std::max(
+      { 0.0, box.GetMinPoint()[axis] - x[axis], x[axis] - box.GetMaxPoint()[axis] });
+    distance2 += delta * delta;
+  }
+  return distance2;
+}
+}
+
+VTK_ABI_NAMESPACE_BEGIN
+struct vtkDistributedPointLocator::vtkInternals
+{
+  vtkSmartPointer<vtkBSPCuts> Cuts;
+  bool Built = false;
+
+  // points owned by this process, with the process and id they came from.
+  vtkNew<vtkPolyData> LocalPoints;
+  std::vector<int> Processes;
+  std::vector<vtkIdType> Ids;
+  vtkNew<vtkStaticPointLocator> Locator;
+
+  // bounds of the points owned by each process.
+  std::vector<vtkBoundingBox> ProcessBounds;
+
+  // Answer the queries received from the other processes, and return the
+  // answers to send back to each of them.
+  template <typename Search>
+  std::vector<std::vector<AnswerRecord>> Answer(
+    const std::vector<std::vector<QueryRecord>>& incoming, Search search)
+  {
+    std::vector<std::vector<AnswerRecord>> answers(incoming.size());
+    if (this->LocalPoints->GetNumberOfPoints() == 0)
+    {
+      return answers;
+    }
+    vtkSMPThreadLocalObject<vtkIdList> tlIds;
+    for (size_t rank = 0; rank < incoming.size(); ++rank)
+    {
+      const auto& queries = incoming[rank];
+      std::vector<std::vector<AnswerRecord>> found(queries.size());
+      vtkSMPTools::For(0, static_cast<vtkIdType>(queries.size()),
+        [&](vtkIdType begin, vtkIdType end)
+        {
+          vtkIdList* ids = tlIds.Local();
+          for (vtkIdType cc = begin; cc < end; ++cc)
+          {
+            ids->Reset();
+            search(queries[cc], ids);
+            for (vtkIdType kk = 0; kk < ids->GetNumberOfIds(); ++kk)
+            {
+              const vtkIdType ptId = ids->GetId(kk);
+              double x[3];
+              this->LocalPoints->GetPoint(ptId, x);
+              found[cc].push_back(AnswerRecord{ vtkMath::Distance2BetweenPoints(x,
+                                                  queries[cc].Coords),
+                queries[cc].Index, this->Processes[ptId], this->Ids[ptId] });
+            }
+          }
+        });
+      for (const auto& queryAnswers : found)
+      {
+        answers[rank].insert(answers[rank].end(), queryAnswers.begin(), queryAnswers.end());
+      }
+    }
+    return answers;
+  }
+};
+
+vtkStandardNewMacro(vtkDistributedPointLocator);
+vtkCxxSetObjectMacro(vtkDistributedPointLocator, Controller, vtkMultiProcessController);
+vtkCxxSetObjectMacro(vtkDistributedPointLocator, Points, vtkPoints);
+
+//------------------------------------------------------------------------------
+vtkDistributedPointLocator::vtkDistributedPointLocator()
+  : Internals(new vtkInternals())
+{
+  this->SetController(vtkMultiProcessController::GetGlobalController());
+}
+
+//------------------------------------------------------------------------------
+vtkDistributedPointLocator::~vtkDistributedPointLocator()
+{
+  this->SetController(nullptr);
+  this->SetPoints(nullptr);
+}
+
+//------------------------------------------------------------------------------
+vtkBSPCuts* vtkDistributedPointLocator::GetCuts()
+{
+  return this->Internals->Cuts;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkDistributedPointLocator::GetNumberOfLocalPoints()
+{
+  return this->Internals->LocalPoints->GetNumberOfPoints();
+}
+
+//------------------------------------------------------------------------------
+void vtkDistributedPointLocator::BuildLocator()
+{
+  auto& internals = *this->Internals;
+  diy::mpi::communicator comm = vtkDIYUtilities::GetCommunicator(this->Controller);
+  const int numProcs = comm.size();
+  const int myrank = comm.rank();
+
+  // one region or more per process, each process owning a subtree.
+  const std::vector<vtkSmartPointer<vtkPoints>> points{ this->Points };
+  const auto cuts = vtkDIYKdTreeUtilities::GenerateSampledCuts(
+    points, numProcs, this->NumberOfSamples, this->Controller);
+  internals.Cuts = vtkDIYKdTreeUtilities::CreateBSPCuts(cuts);
+  const std::vector<int> assignments = cuts.empty()
+    ? std::vector<int>()
+    : vtkDIYKdTreeUtilities::ComputeAssignments(static_cast<int>(cuts.size()), numProcs);
+
+  std::vector<std::vector<PointRecord>> outgoing(numProcs);
+  if (internals.Cuts && this->Points)
+  {
+    vtkKdNode* top = internals.Cuts->GetKdNodeTree();
+    for (vtkIdType ptId = 0; ptId < this->Points->GetNumberOfPoints(); ++ptId)
+    {
+      PointRecord record;
+      this->Points->GetPoint(ptId, record.Coords);
+      record.Process = myrank;
+      record.Id = ptId;
+      vtkKdNode* node = top;
+      while (node->GetLeft())
+      {
+        node = record.Coords[node->GetDim()] < node->GetDivisionPosition() ? node->GetLeft()
+                                                                          : node->GetRight();
+      }
+      outgoing[assignments[node->GetID()]].push_back(record);
+    }
+  }
+  const auto incoming = ::ExchangeRecords(comm, outgoing);
+
+  vtkNew<vtkPoints> localPoints;
+  localPoints->SetDataTypeToDouble();
+  internals.Processes.clear();
+  internals.Ids.clear();
+  vtkBoundingBox localBounds;
+  for (const auto& records : incoming)
+  {
+    for (const auto& record : records)
+    {
+      localPoints->InsertNextPoint(record.Coords);
+      internals.Processes.push_back(record.Process);
+      internals.Ids.push_back(record.Id);
+      localBounds.AddPoint(record.Coords[0], record.Coords[1], record.Coords[2]);
+    }
+  }
+  internals.LocalPoints->SetPoints(localPoints);
+  internals.Locator->Initialize();
+  internals.Locator->SetDataSet(internals.LocalPoints);
+  if (localPoints->GetNumberOfPoints() > 0)
+  {
+    internals.Locator->BuildLocator();
+  }
+
+  std::vector<double> bounds(6);
+  localBounds.GetBounds(bounds.data());
+  std::vector<std::vector<double>> allBounds;
+  diy::mpi::all_gather(comm, bounds, allBounds);
+  internals.ProcessBounds.assign(numProcs, vtkBoundingBox());
+  for (int rank = 0; rank < numProcs; ++rank)
+  {
+    internals.ProcessBounds[rank].SetBounds(allBounds[rank].data());
+  }
+  internals.Built = true;
+}
+
+//------------------------------------------------------------------------------
+void vtkDistributedPointLocator::FindClosestPoints(
+  vtkPoints* queries, vtkIntArray* processIds, vtkIdTypeArray* pointIds)
+{
+  auto& internals = *this->Internals;
+  if (!internals.Built)
+  {
+    vtkErrorMacro("BuildLocator must be called before querying points.");
+    return;
+  }
+  diy::mpi::communicator comm = vtkDIYUtilities::GetCommunicator(this->Controller);
+  const int numProcs = comm.size();
+  const vtkIdType numberOfQueries = queries ? queries->GetNumberOfPoints() : 0;
+
+  std::vector<AnswerRecord> best(
+    numberOfQueries, AnswerRecord{ VTK_DOUBLE_MAX, -1, VTK_INT_MAX, VTK_ID_MAX });
+  auto merge = [&best](const std::vector<std::vector<AnswerRecord>>& answers)
+  {
+    for (const auto& rankAnswers : answers)
+    {
+      for (const auto& answer : rankAnswers)
+      {
+        best[answer.Index] = std::min(best[answer.Index], answer);
+      }
+    }
+  };
+
+  // First ask the process whose points are the closest to each query, then the
+  // processes that may have points at least as close as the point found.
+  std::vector<int> firstProcess(numberOfQueries, -1);
+  std::vector<std::vector<QueryRecord>> outgoing(numProcs);
+  for (vtkIdType cc = 0; cc < numberOfQueries; ++cc)
+  {
+    QueryRecord query;
+    queries->GetPoint(cc, query.Coords);
+    query.Radius2 = VTK_DOUBLE_MAX;
+    query.Index = cc;
+    double closest = VTK_DOUBLE_MAX;
+    for (int rank = 0; rank < numProcs; ++rank)
+    {
+      const auto& box = internals.ProcessBounds[rank];
+      if (box.IsValid() && ::GetDistance2(box, query.Coords) < closest)
+      {
+        closest = ::GetDistance2(box, query.Coords);
+        firstProcess[cc] = rank;
+      }
+    }
+    if (firstProcess[cc] >= 0)
+    {
+      outgoing[firstProcess[cc]].push_back(query);
+    }
+  }
+  auto incoming = ::ExchangeRecords(comm, outgoing);
+  auto answers = internals.Answer(incoming,
+    [&internals](const QueryRecord& query, vtkIdList* ids)
+    {
+      // also return the other points at the same distance for the tie break.
+      const vtkIdType closest = internals.Locator->FindClosestPoint(query.Coords);
+      double x[3];
+      internals.LocalPoints->GetPoint(closest, x);
+      const double distance = std::sqrt(vtkMath::Distance2BetweenPoints(x, query.Coords));
+      internals.Locator->FindPointsWithinRadius(distance, query.Coords, ids);
+      ids->InsertNextId(closest);
+    });
+  merge(::ExchangeRecords(comm, answers));
+
+  outgoing.assign(numProcs, std::vector<QueryRecord>());
+  for (vtkIdType cc = 0; cc < numberOfQueries; ++cc)
+  {
+    if (firstProcess[cc] < 0)
+    {
+      continue;
+    }
+    QueryRecord query;
+    queries->GetPoint(cc, query.Coords);
+    query.Radius2 = best[cc].Distance2;
+    query.Index = cc;
+    for (int rank = 0; rank < numProcs; ++rank)
+    {
+      const auto& box = internals.ProcessBounds[rank];
+      if (rank != firstProcess[cc] && box.IsValid() &&
+        ::GetDistance2(box, query.Coords) <= query.Radius2)
+      {
+        outgoing[rank].push_back(query);
+      }
+    }
+  }
+  incoming = ::ExchangeRecords(comm, outgoing);
+  answers = internals.Answer(incoming,
+    [&internals](const QueryRecord& query, vtkIdList* ids)
+    { internals.Locator->FindPointsWithinRadius(std::sqrt(query.Radius2), query.Coords, ids); });
+  merge(::ExchangeRecords(comm, answers));
+
+  processIds->SetNumberOfComponents(1);
+  processIds->SetNumberOfTuples(numberOfQueries);
+  pointIds->SetNumberOfComponents(1);
+  pointIds->SetNumberOfTuples(numberOfQueries);
+  for (vtkIdType cc = 0; cc < numberOfQueries; ++cc)
+  {
+    const bool found = best[cc].Index >= 0;
+    processIds->SetValue(cc, found ? best[cc].Process : -1);
+    pointIds->SetValue(cc, found ? best[cc].Id : -1);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkDistributedPointLocator::FindPointsWithinRadius(double radius, vtkPoints* queries,
+  vtkIdTypeArray* offsets, vtkIntArray* processIds, vtkIdTypeArray* pointIds)
+{
+  auto& internals = *this->Internals;
+  if (!internals.Built)
+  {
+    vtkErrorMacro("BuildLocator must be called before querying points.");
+    return;
+  }
+  diy::mpi::communicator comm = vtkDIYUtilities::GetCommunicator(this->Controller);
+  const int numProcs = comm.size();
+  const vtkIdType numberOfQueries = queries ? queries->GetNumberOfPoints() : 0;
+
+  std::vector<std::vector<QueryRecord>> outgoing(numProcs);
+  for (vtkIdType cc = 0; cc < numberOfQueries; ++cc)
+  {
+    QueryRecord query;
+    queries->GetPoint(cc, query.Coords);
+    query.Radius2 = radius * radius;
+    query.Index = cc;
+    for (int rank = 0; rank < numProcs; ++rank)
+    {
+      const auto& box = internals.ProcessBounds[rank];
+      if (box.IsValid() && ::GetDistance2(box, query.Coords) <= query.Radius2)
+      {
+        outgoing[rank].push_back(query);
+      }
+    }
+  }
+  const auto incoming = ::ExchangeRecords(comm, outgoing);
+  auto answers = internals.Answer(incoming,
+    [&internals, radius](const QueryRecord& query, vtkIdList* ids)
+    { internals.Locator->FindPointsWithinRadius(radius, query.Coords, ids); });
+  answers = ::ExchangeRecords(comm, answers);
+
+  std::vector<std::vector<AnswerRecord>> found(numberOfQueries);
+  for (const auto& rankAnswers : answers)
+  {
+    for (const auto& answer : rankAnswers)
+    {
+      found[answer.Index].push_back(answer);
+    }
+  }
+  offsets->SetNumberOfComponents(1);
+  offsets->SetNumberOfTuples(numberOfQueries + 1);
+  offsets->SetValue(0, 0);
+  for (vtkIdType cc = 0; cc < numberOfQueries; ++cc)
+  {
+    std::sort(found[cc].begin(), found[cc].end());
+    offsets->SetValue(cc + 1, offsets->GetValue(cc) + static_cast<vtkIdType>(found[cc].size()));
+  }
+  const vtkIdType total = offsets->GetValue(numberOfQueries);
+  processIds->SetNumberOfComponents(1);
+  processIds->SetNumberOfTuples(total);
+  pointIds->SetNumberOfComponents(1);
+  pointIds->SetNumberOfTuples(total);
+  for (vtkIdType cc = 0; cc < numberOfQueries; ++cc)
+  {
+    vtkIdType index = offsets->GetValue(cc);
+    for (const auto& answer : found[cc])
+    {
+      processIds->SetValue(index, answer.Process);
+      pointIds->SetValue(index++, answer.Id);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkDistributedPointLocator::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Controller: " << this->Controller << endl;
+  os << indent << "Points: " << this->Points << endl;
+  os << indent << "NumberOfSamples: " << this->NumberOfSamples << endl;
+  os << indent << "NumberOfLocalPoints: " << this->Internals->LocalPoints->GetNumberOfPoints()
+     << endl;
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class vtkDistributedPointLocator
+ * @brief locate points distributed among the processes of a parallel group
+ *
+ * vtkDistributedPointLocator answers nearest-neighbor and radius queries on a
+ * point cloud split among the processes of a controller, without gathering the
+ * points anywhere. BuildLocator partitions space with a k-d tree whose split
+ * values are chosen from samples of the points (see
+ * vtkDIYKdTreeUtilities::GenerateSampledCuts) and moves each point to the
+ * process owning its region. A query is then only sent to the processes whose
+ * points may be close enough, and every point found is identified by the
+ * process that provided it and its id in the points given to SetPoints there.
+ *
+ * BuildLocator and the queries are collective: all the processes of the
+ * controller must call them, possibly with no points or no queries.
+ *
+ * The k-d tree returned by GetCuts can also be given to vtkPKdTree::SetCuts,
+ * to skip the collective select of vtkPKdTree::BuildLocator.
+ *
+ * @sa vtkPKdTree vtkDIYKdTreeUtilities vtkStaticPointLocator
+ */
+
+#ifndef vtkDistributedPointLocator_h
+#define vtkDistributedPointLocator_h
+
+#include "vtkFiltersParallelDIY2Module.h" // for export macros
+#include "vtkObject.h"
+
+#include <memory> // for std::unique_ptr
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkBSPCuts;
+class vtkIdTypeArray;
+class vtkIntArray;
+class vtkMultiProcessController;
+class vtkPoints;
+
+class VTKFILTERSPARALLELDIY2_EXPORT vtkDistributedPointLocator : public vtkObject
+{
+public:
+  static vtkDistributedPointLocator* New();
+  vtkTypeMacro(vtkDistributedPointLocator, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Get/Set the controller of the processes sharing the points. Defaults to
+   * the global controller.
+   */
+  virtual void SetController(vtkMultiProcessController*);
+  vtkGetObjectMacro(Controller, vtkMultiProcessController);
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set the points of this process.
+   */
+  virtual void SetPoints(vtkPoints*);
+  vtkGetObjectMacro(Points, vtkPoints);
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set the number of points sampled in each box of the k-d tree to choose
+   * its split value. Defaults to 256.
+   */
+  vtkSetClampMacro(NumberOfSamples, int, 1, VTK_INT_MAX);
+  vtkGetMacro(NumberOfSamples, int);
+  ///@}
+
+  /**
+   * Build the k-d tree and move the points to the processes owning their
+   * region. This is a collective operation.
+   */
+  void BuildLocator();
+
+  /**
+   * Get the k-d tree built by BuildLocator, or nullptr if there are no points.
+   * The region with ID `i` is owned by process
+   * `vtkDIYKdTreeUtilities::ComputeAssignments(numberOfRegions, numberOfProcesses)[i]`.
+   */
+  vtkBSPCuts* GetCuts();
+
+  /**
+   * Get the number of points owned by this process after BuildLocator.
+   */
+  vtkIdType GetNumberOfLocalPoints();
+
+  /**
+   * For each point of `queries`, find the closest point among the points of all
+   * the processes. `processIds` and `pointIds` are resized to the number of
+   * queries and hold the process that provided the point and its id on that
+   * process, or -1 when there are no points at all. Ties are broken by the
+   * lowest process then point id. This is a collective operation.
+   */
+  void FindClosestPoints(vtkPoints* queries, vtkIntArray* processIds, vtkIdTypeArray* pointIds);
+
+  /**
+   * For each point of `queries`, find the points of all the processes within
+   * `radius`, sorted by distance then process and point id. The points found
+   * for query `i` are at indices [offsets[i], offsets[i + 1]) of `processIds`
+   * and `pointIds`, and `offsets` has one more value than the number of
+   * queries. This is a collective operation.
+   */
+  void FindPointsWithinRadius(double radius, vtkPoints* queries, vtkIdTypeArray* offsets,
+    vtkIntArray* processIds, vtkIdTypeArray* pointIds);
+
+protected:
+  vtkDistributedPointLocator();
+  ~vtkDistributedPointLocator() override;
+
+  vtkMultiProcessController* Controller = nullptr;
+  vtkPoints* Points = nullptr;
+  int NumberOfSamples = 256;
+
+private:
+  vtkDistributedPointLocator(const vtkDistributedPointLocator&) = delete;
+  void operator=(const vtkDistributedPointLocator&) = delete;
+
+  struct vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
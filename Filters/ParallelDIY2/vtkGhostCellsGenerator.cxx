@@ -3,39 +3,676 @@
 
 #include "vtkGhostCellsGenerator.h"
 
+#include "vtkCellData.h"
+#include "vtkCommunicator.h"
 #include "vtkCompositeDataIterator.h"
 #include "vtkCompositeDataSet.h"
 #include "vtkDIYGhostUtilities.h"
+#include "vtkDataArray.h"
+#include "vtkFieldData.h"
 #include "vtkDataObjectTreeIterator.h"
 #include "vtkDataObjectTreeRange.h"
 #include "vtkExplicitStructuredGrid.h"
 #include "vtkGenerateGlobalIds.h"
 #include "vtkGenerateProcessIds.h"
 #include "vtkHyperTreeGrid.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkImageData.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkLogger.h"
+#include "vtkMatrix3x3.h"
 #include "vtkMultiProcessController.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPartitionedDataSet.h"
 #include "vtkPartitionedDataSetCollection.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkRange.h"
 #include "vtkRectilinearGrid.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStructuredGrid.h"
+#include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <numeric>
+#include <string>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+// Point and cell data array holding, during a full execution with CacheTopology, the process,
+// the leaf index and the id of the input point or cell each output point and cell comes from.
+constexpr char SourceIdsArrayName[] = "vtkGhostCellsGeneratorSourceIds";
+
+// Chunks of the exchanged buffers are aligned so that arrays can be wrapped in place.
+constexpr vtkIdType ChunkAlignment = 8;
+
+//----------------------------------------------------------------------------
+vtkDataSetAttributes* GetAttributes(vtkDataSet* ds, int association)
+{
+  return association == 0 ? static_cast<vtkDataSetAttributes*>(ds->GetPointData())
+                          : static_cast<vtkDataSetAttributes*>(ds->GetCellData());
+}
+
+//----------------------------------------------------------------------------
+vtkIdType GetNumberOfTuples(vtkDataSet* ds, int association)
+{
+  return association == 0 ? ds->GetNumberOfPoints() : ds->GetNumberOfCells();
+}
+
+//----------------------------------------------------------------------------
+// Arrays exchanged when the topology is reused. Ghost arrays are part of the cached geometry.
+std::vector<vtkDataArray*> GetExchangedArrays(vtkDataSetAttributes* dsa)
+{
+  std::vector<vtkDataArray*> arrays;
+  for (int id = 0; id < dsa->GetNumberOfArrays(); ++id)
+  {
+    vtkAbstractArray* array = dsa->GetAbstractArray(id);
+    const char* name = array->GetName();
+    if (!name || (strcmp(name, vtkDataSetAttributes::GhostArrayName()) != 0 &&
+                   strcmp(name, SourceIdsArrayName) != 0))
+    {
+      arrays.push_back(vtkDataArray::SafeDownCast(array));
+    }
+  }
+  return arrays;
+}
+
+//----------------------------------------------------------------------------
+// Describes the names, types and number of components of the exchanged arrays. Returns false if
+// some arrays cannot be exchanged as raw values.
+bool AppendArrayLayout(vtkDataSet* ds, std::string& layout)
+{
+  for (int association = 0; association < 2; ++association)
+  {
+    for (vtkDataArray* array : GetExchangedArrays(GetAttributes(ds, association)))
+    {
+      if (!array || array->GetDataType() == VTK_BIT || !array->GetName())
+      {
+        return false;
+      }
+      layout += array->GetName();
+      layout += '\n' + std::to_string(array->GetDataType()) + ' ' +
+        std::to_string(array->GetNumberOfComponents()) + '\n';
+    }
+    layout += '\n';
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// Bytes of the values that change when the geometry of the data set or the input of the ghost
+// generation change.
+std::vector<unsigned char> ComputeGeometryKey(vtkDataSet* ds)
+{
+  std::vector<unsigned char> key;
+  auto append = [&key](const void* data, std::size_t size)
+  {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    key.insert(key.end(), bytes, bytes + size);
+  };
+  auto appendMTime = [&append](vtkObject* object)
+  {
+    vtkMTimeType mtime = object ? object->GetMTime() : 0;
+    append(&mtime, sizeof(mtime));
+  };
+
+  const int type = ds->GetDataObjectType();
+  const vtkIdType sizes[2] = { ds->GetNumberOfPoints(), ds->GetNumberOfCells() };
+  append(&type, sizeof(type));
+  append(sizes, sizeof(sizes));
+  if (auto ug = vtkUnstructuredGrid::SafeDownCast(ds))
+  {
+    vtkMTimeType mtime = ug->GetMeshMTime();
+    append(&mtime, sizeof(mtime));
+  }
+  else if (auto pd = vtkPolyData::SafeDownCast(ds))
+  {
+    vtkMTimeType mtime = pd->GetMeshMTime();
+    append(&mtime, sizeof(mtime));
+  }
+  else if (auto sg = vtkStructuredGrid::SafeDownCast(ds))
+  {
+    append(sg->GetExtent(), 6 * sizeof(int));
+    appendMTime(sg->GetPoints() ? sg->GetPoints()->GetData() : nullptr);
+  }
+  else if (auto rg = vtkRectilinearGrid::SafeDownCast(ds))
+  {
+    append(rg->GetExtent(), 6 * sizeof(int));
+    appendMTime(rg->GetXCoordinates());
+    appendMTime(rg->GetYCoordinates());
+    appendMTime(rg->GetZCoordinates());
+  }
+  else if (auto image = vtkImageData::SafeDownCast(ds))
+  {
+    append(image->GetExtent(), 6 * sizeof(int));
+    append(image->GetOrigin(), 3 * sizeof(double));
+    append(image->GetSpacing(), 3 * sizeof(double));
+    append(image->GetDirectionMatrix()->GetData(), 9 * sizeof(double));
+  }
+  else
+  {
+    appendMTime(ds);
+  }
+
+  // Input ghosts are peeled off, and point global ids connect unstructured partitions.
+  for (int association = 0; association < 2; ++association)
+  {
+    vtkDataSetAttributes* dsa = GetAttributes(ds, association);
+    appendMTime(dsa->GetGhostArray());
+    appendMTime(dsa->GetGlobalIds());
+  }
+  return key;
+}
+
+//----------------------------------------------------------------------------
+vtkIdType GetChunkSize(vtkDataArray* array, vtkIdType numberOfTuples)
+{
+  const vtkIdType size =
+    numberOfTuples * array->GetNumberOfComponents() * array->GetDataTypeSize();
+  return (size + ChunkAlignment - 1) / ChunkAlignment * ChunkAlignment;
+}
+
+//----------------------------------------------------------------------------
+// Array of the type of `array` using `buffer` as storage, without copying it.
+vtkSmartPointer<vtkDataArray> WrapChunk(vtkDataArray* array, char* buffer, vtkIdType numberOfTuples)
+{
+  auto chunk = vtkSmartPointer<vtkDataArray>::Take(
+    vtkDataArray::CreateDataArray(array->GetDataType()));
+  chunk->SetNumberOfComponents(array->GetNumberOfComponents());
+  chunk->SetVoidArray(buffer, numberOfTuples * array->GetNumberOfComponents(), 1);
+  return chunk;
+}
+}
+
+//----------------------------------------------------------------------------
+struct vtkGhostCellsGenerator::vtkInternals
+{
+  // Tuples of an output leaf copied from an input leaf of this process.
+  struct LocalCopy
+  {
+    int Association;
+    int SourceLeaf;
+    int TargetLeaf;
+    vtkSmartPointer<vtkIdList> SourceIds;
+    vtkSmartPointer<vtkIdList> TargetIds;
+  };
+
+  // Tuples sent to a neighbor from one of our input leaves, or received from a neighbor into
+  // one of our output leaves. Received tuples are stored in order in the buffer.
+  struct Segment
+  {
+    int Association;
+    int Leaf;
+    vtkSmartPointer<vtkIdList> Ids;
+    vtkSmartPointer<vtkIdList> BufferIds;
+  };
+
+  struct Neighbor
+  {
+    int Rank;
+    std::vector<Segment> SendSegments;
+    std::vector<Segment> ReceiveSegments;
+  };
+
+  bool Valid = false;
+  vtkMultiProcessController* Controller = nullptr;
+  vtkSmartPointer<vtkMultiProcessController> NeighborController;
+  int NumberOfGhostLayers = -1;
+  std::vector<std::vector<unsigned char>> Keys;
+  std::vector<vtkSmartPointer<vtkDataSet>> Outputs;
+  std::vector<LocalCopy> LocalCopies;
+  std::vector<Neighbor> Neighbors;
+
+  //----------------------------------------------------------------------------
+  void Clear()
+  {
+    this->Valid = false;
+    this->Keys.clear();
+    this->Outputs.clear();
+    this->LocalCopies.clear();
+    this->Neighbors.clear();
+  }
+
+  //----------------------------------------------------------------------------
+  // Collectively decide if the cached topology can be reused for this input.
+  bool CanReuse(vtkDataObject* inputDO, vtkDataObject* modifInputDO,
+    vtkMultiProcessController* controller, int numberOfGhostLayers)
+  {
+    std::vector<vtkDataSet*> inputs = vtkCompositeDataSet::GetDataSets<vtkDataSet>(inputDO);
+    std::vector<vtkDataSet*> modifInputs =
+      vtkCompositeDataSet::GetDataSets<vtkDataSet>(modifInputDO);
+
+    bool changed = !this->Valid || this->Controller != controller ||
+      this->NumberOfGhostLayers != numberOfGhostLayers || inputs.size() != this->Keys.size() ||
+      modifInputs.size() != inputs.size();
+    for (std::size_t leaf = 0; !changed && leaf < inputs.size(); ++leaf)
+    {
+      changed = ComputeGeometryKey(inputs[leaf]) != this->Keys[leaf];
+    }
+
+    // All leaves of all processes must exchange the same arrays.
+    std::string layout;
+    for (std::size_t leaf = 0; !changed && leaf < modifInputs.size(); ++leaf)
+    {
+      std::string leafLayout;
+      changed = !AppendArrayLayout(modifInputs[leaf], leafLayout) ||
+        (leaf && leafLayout != layout);
+      layout = leafLayout;
+    }
+    const vtkTypeInt64 hash =
+      static_cast<vtkTypeInt64>(std::hash<std::string>{}(layout) & VTK_TYPE_INT32_MAX);
+    const vtkTypeInt64 none = VTK_TYPE_INT64_MIN;
+    vtkTypeInt64 local[3] = { changed, modifInputs.empty() ? none : hash,
+      modifInputs.empty() ? none : -hash };
+    vtkTypeInt64 global[3];
+    controller->AllReduce(local, global, 3, vtkCommunicator::MAX_OP);
+    return !global[0] && (global[1] == none || global[1] == -global[2]);
+  }
+
+  //----------------------------------------------------------------------------
+  // Tag the input points and cells with their process, leaf and id.
+  void AddSourceIds(vtkDataObject* modifInputDO, int rank)
+  {
+    std::vector<vtkDataSet*> leaves = vtkCompositeDataSet::GetDataSets<vtkDataSet>(modifInputDO);
+    for (std::size_t leaf = 0; leaf < leaves.size(); ++leaf)
+    {
+      for (int association = 0; association < 2; ++association)
+      {
+        const vtkIdType numberOfTuples = GetNumberOfTuples(leaves[leaf], association);
+        vtkNew<vtkIdTypeArray> sourceIds;
+        sourceIds->SetName(SourceIdsArrayName);
+        sourceIds->SetNumberOfComponents(3);
+        sourceIds->SetNumberOfTuples(numberOfTuples);
+        for (vtkIdType id = 0; id < numberOfTuples; ++id)
+        {
+          sourceIds->SetTypedTuple(id, std::array<vtkIdType, 3>{ rank,
+                                         static_cast<vtkIdType>(leaf), id }
+                                         .data());
+        }
+        GetAttributes(leaves[leaf], association)->AddArray(sourceIds);
+      }
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Build the exchange plan from the source ids of the output, and remove them. This is
+  // collective, the cache is valid only if all processes succeed.
+  void Build(vtkDataObject* inputDO, vtkDataObject* modifInputDO, vtkDataObject* outputDO,
+    vtkMultiProcessController* controller, int numberOfGhostLayers, bool success)
+  {
+    this->Clear();
+    std::vector<vtkDataSet*> inputs = vtkCompositeDataSet::GetDataSets<vtkDataSet>(inputDO);
+    std::vector<vtkDataSet*> modifInputs =
+      vtkCompositeDataSet::GetDataSets<vtkDataSet>(modifInputDO);
+    std::vector<vtkDataSet*> outputs = vtkCompositeDataSet::GetDataSets<vtkDataSet>(outputDO);
+    const int rank = controller->GetLocalProcessId();
+    const int numberOfProcesses = controller->GetNumberOfProcesses();
+    success &= inputs.size() == outputs.size() && modifInputs.size() == outputs.size();
+
+    // Tuples of each output leaf grouped by source process, association, source leaf and
+    // target leaf.
+    using Key = std::array<int, 4>;
+    std::map<Key, std::array<vtkSmartPointer<vtkIdList>, 2>> groups;
+    for (std::size_t target = 0; success && target < outputs.size(); ++target)
+    {
+      for (int association = 0; success && association < 2; ++association)
+      {
+        vtkDataSetAttributes* dsa = GetAttributes(outputs[target], association);
+        auto sourceIds = vtkIdTypeArray::SafeDownCast(dsa->GetArray(SourceIdsArrayName));
+        const vtkIdType numberOfTuples = GetNumberOfTuples(outputs[target], association);
+        if (!sourceIds || sourceIds->GetNumberOfComponents() != 3 ||
+          sourceIds->GetNumberOfTuples() != numberOfTuples)
+        {
+          success = false;
+          break;
+        }
+        auto group = groups.end();
+        for (vtkIdType id = 0; id < numberOfTuples; ++id)
+        {
+          const vtkIdType* source = sourceIds->GetPointer(3 * id);
+          if (source[0] < 0 || source[0] >= numberOfProcesses || source[1] < 0 ||
+            source[1] > VTK_INT_MAX || source[2] < 0 ||
+            (source[0] == rank &&
+              (source[1] >= static_cast<vtkIdType>(modifInputs.size()) ||
+                source[2] >= GetNumberOfTuples(modifInputs[source[1]], association))))
+          {
+            success = false;
+            break;
+          }
+          const Key key{ static_cast<int>(source[0]), association, static_cast<int>(source[1]),
+            static_cast<int>(target) };
+          if (group == groups.end() || group->first != key)
+          {
+            group = groups.emplace(key, std::array<vtkSmartPointer<vtkIdList>, 2>{}).first;
+            if (!group->second[0])
+            {
+              group->second[0] = vtkSmartPointer<vtkIdList>::New();
+              group->second[1] = vtkSmartPointer<vtkIdList>::New();
+            }
+          }
+          group->second[0]->InsertNextId(source[2]);
+          group->second[1]->InsertNextId(id);
+        }
+      }
+    }
+    for (vtkDataSet* output : outputs)
+    {
+      output->GetPointData()->RemoveArray(SourceIdsArrayName);
+      output->GetCellData()->RemoveArray(SourceIdsArrayName);
+    }
+
+    // Requests sent to each process: association, source leaf, number of ids, and the ids of
+    // each segment.
+    std::vector<std::vector<vtkIdType>> requests(numberOfProcesses);
+    std::vector<std::vector<Segment>> receiveSegments(numberOfProcesses);
+    for (const auto& group : groups)
+    {
+      const int source = group.first[0];
+      vtkIdList* sourceIds = group.second[0];
+      vtkIdList* targetIds = group.second[1];
+      if (source == rank)
+      {
+        this->LocalCopies.push_back(
+          LocalCopy{ group.first[1], group.first[2], group.first[3], sourceIds, targetIds });
+        continue;
+      }
+      std::vector<vtkIdType>& request = requests[source];
+      request.push_back(group.first[1]);
+      request.push_back(group.first[2]);
+      request.push_back(sourceIds->GetNumberOfIds());
+      request.insert(request.end(), sourceIds->begin(), sourceIds->end());
+      vtkNew<vtkIdList> bufferIds;
+      bufferIds->SetNumberOfIds(targetIds->GetNumberOfIds());
+      std::iota(bufferIds->begin(), bufferIds->end(), 0);
+      receiveSegments[source].push_back(
+        Segment{ group.first[1], group.first[3], targetIds, bufferIds });
+    }
+
+    // Tell each process which of its tuples we need.
+    std::vector<vtkIdType> ones(numberOfProcesses, 1), offsets(numberOfProcesses);
+    std::vector<vtkIdType> sendLengths(numberOfProcesses), recvLengths(numberOfProcesses);
+    std::iota(offsets.begin(), offsets.end(), 0);
+    for (int process = 0; process < numberOfProcesses; ++process)
+    {
+      sendLengths[process] = static_cast<vtkIdType>(requests[process].size());
+    }
+    auto request = controller->NoBlockAllToAllV(sendLengths.data(), ones.data(), offsets.data(),
+      recvLengths.data(), ones.data(), offsets.data());
+    if (!request || !request->Wait())
+    {
+      success = false;
+    }
+
+    std::vector<vtkIdType> sendOffsets(numberOfProcesses), recvOffsets(numberOfProcesses);
+    std::vector<vtkIdType> sendBuffer, recvBuffer;
+    for (int process = 0; process < numberOfProcesses; ++process)
+    {
+      sendOffsets[process] = static_cast<vtkIdType>(sendBuffer.size());
+      sendBuffer.insert(sendBuffer.end(), requests[process].begin(), requests[process].end());
+      recvOffsets[process] = process ? recvOffsets[process - 1] + recvLengths[process - 1] : 0;
+    }
+    recvBuffer.resize(recvOffsets.back() + recvLengths.back());
+    request = controller->NoBlockAllToAllV(sendBuffer.data(), sendLengths.data(),
+      sendOffsets.data(), recvBuffer.data(), recvLengths.data(), recvOffsets.data());
+    if (!request || !request->Wait())
+    {
+      success = false;
+    }
+
+    for (int process = 0; process < numberOfProcesses; ++process)
+    {
+      std::vector<Segment> sendSegments;
+      const vtkIdType* values = recvBuffer.data() + recvOffsets[process];
+      const vtkIdType* end = values + recvLengths[process];
+      while (success && values != end)
+      {
+        if (end - values < 3 || values[0] < 0 || values[0] > 1 || values[1] < 0 ||
+          values[1] >= static_cast<vtkIdType>(modifInputs.size()) || values[2] < 0 ||
+          values[2] > end - values - 3)
+        {
+          success = false;
+          break;
+        }
+        const int association = static_cast<int>(values[0]);
+        const int leaf = static_cast<int>(values[1]);
+        const vtkIdType numberOfIds = values[2];
+        values += 3;
+        const vtkIdType numberOfTuples = GetNumberOfTuples(modifInputs[leaf], association);
+        vtkNew<vtkIdList> ids;
+        ids->SetNumberOfIds(numberOfIds);
+        for (vtkIdType id = 0; id < numberOfIds; ++id, ++values)
+        {
+          success &= *values < numberOfTuples;
+          ids->SetId(id, *values);
+        }
+        sendSegments.push_back(Segment{ association, leaf, ids, nullptr });
+      }
+      if (!sendSegments.empty() || !receiveSegments[process].empty())
+      {
+        this->Neighbors.push_back(
+          Neighbor{ process, std::move(sendSegments), std::move(receiveSegments[process]) });
+      }
+    }
+
+    int globalSuccess = 0, localSuccess = success;
+    controller->AllReduce(&localSuccess, &globalSuccess, 1, vtkCommunicator::MIN_OP);
+    if (!globalSuccess)
+    {
+      this->Clear();
+      return;
+    }
+
+    // Neighborhood exchanges are done on a private communicator so that the neighbors of the
+    // controller are left untouched.
+    if (!this->NeighborController || this->Controller != controller)
+    {
+      this->NeighborController =
+        vtkSmartPointer<vtkMultiProcessController>::Take(controller->PartitionController(0, rank));
+    }
+    std::vector<int> ranks;
+    for (const Neighbor& neighbor : this->Neighbors)
+    {
+      ranks.push_back(neighbor.Rank);
+    }
+    if (!this->NeighborController ||
+      !this->NeighborController->SetNeighbors(static_cast<int>(ranks.size()), ranks.data()))
+    {
+      this->NeighborController = nullptr;
+      this->Clear();
+      return;
+    }
+
+    for (vtkDataSet* input : inputs)
+    {
+      this->Keys.push_back(ComputeGeometryKey(input));
+    }
+    for (vtkDataSet* output : outputs)
+    {
+      auto cached = vtkSmartPointer<vtkDataSet>::Take(output->NewInstance());
+      cached->ShallowCopy(output);
+      this->Outputs.push_back(cached);
+    }
+    this->Controller = controller;
+    this->NumberOfGhostLayers = numberOfGhostLayers;
+    this->Valid = true;
+  }
+
+  //----------------------------------------------------------------------------
+  // Byte size of the tuples of the given segments for the given arrays of each association.
+  static vtkIdType GetBufferSize(
+    const std::vector<Segment>& segments, const std::vector<vtkDataArray*> arrays[2])
+  {
+    vtkIdType size = 0;
+    for (const Segment& segment : segments)
+    {
+      for (vtkDataArray* array : arrays[segment.Association])
+      {
+        size += GetChunkSize(array, segment.Ids->GetNumberOfIds());
+      }
+    }
+    return size;
+  }
+
+  //----------------------------------------------------------------------------
+  // Generate the output from the cached topology, copying or exchanging only the point and
+  // cell data.
+  int Reuse(vtkDataObject* modifInputDO, vtkDataObject* outputDO)
+  {
+    std::vector<vtkDataSet*> inputs = vtkCompositeDataSet::GetDataSets<vtkDataSet>(modifInputDO);
+    std::vector<vtkSmartPointer<vtkDataSet>> outputs;
+    for (std::size_t leaf = 0; leaf < inputs.size(); ++leaf)
+    {
+      vtkDataSet* input = inputs[leaf];
+      vtkDataSet* cached = this->Outputs[leaf];
+      auto output = vtkSmartPointer<vtkDataSet>::Take(input->NewInstance());
+      output->CopyStructure(cached);
+      output->GetFieldData()->ShallowCopy(input->GetFieldData());
+      for (int association = 0; association < 2; ++association)
+      {
+        vtkDataSetAttributes* inputDSA = GetAttributes(input, association);
+        vtkDataSetAttributes* outputDSA = GetAttributes(output, association);
+        for (vtkDataArray* array : GetExchangedArrays(inputDSA))
+        {
+          auto outputArray = vtkSmartPointer<vtkDataArray>::Take(
+            vtkDataArray::CreateDataArray(array->GetDataType()));
+          outputArray->SetName(array->GetName());
+          outputArray->SetNumberOfComponents(array->GetNumberOfComponents());
+          outputArray->CopyComponentNames(array);
+          outputArray->SetNumberOfTuples(GetNumberOfTuples(cached, association));
+          outputDSA->AddArray(outputArray);
+        }
+        for (int attribute = 0; attribute < vtkDataSetAttributes::NUM_ATTRIBUTES; ++attribute)
+        {
+          vtkAbstractArray* array = inputDSA->GetAbstractAttribute(attribute);
+          if (array && array->GetName())
+          {
+            outputDSA->SetActiveAttribute(array->GetName(), attribute);
+          }
+        }
+        if (vtkUnsignedCharArray* ghosts = GetAttributes(cached, association)->GetGhostArray())
+        {
+          outputDSA->AddArray(ghosts);
+        }
+      }
+      outputs.push_back(output);
+    }
+
+    std::vector<vtkDataArray*> arrays[2];
+    if (!inputs.empty())
+    {
+      arrays[0] = GetExchangedArrays(inputs[0]->GetPointData());
+      arrays[1] = GetExchangedArrays(inputs[0]->GetCellData());
+    }
+
+    // Pack the requested tuples, one buffer per neighbor.
+    const std::size_t numberOfNeighbors = this->Neighbors.size();
+    std::vector<vtkIdType> sendLengths(numberOfNeighbors), sendOffsets(numberOfNeighbors);
+    std::vector<vtkIdType> recvLengths(numberOfNeighbors), recvOffsets(numberOfNeighbors);
+    vtkIdType sendSize = 0, recvSize = 0;
+    for (std::size_t id = 0; id < numberOfNeighbors; ++id)
+    {
+      sendOffsets[id] = sendSize;
+      sendLengths[id] = GetBufferSize(this->Neighbors[id].SendSegments, arrays);
+      sendSize += sendLengths[id];
+      recvOffsets[id] = recvSize;
+      recvLengths[id] = GetBufferSize(this->Neighbors[id].ReceiveSegments, arrays);
+      recvSize += recvLengths[id];
+    }
+    std::vector<char> sendBuffer(sendSize), recvBuffer(recvSize);
+    for (std::size_t id = 0; id < numberOfNeighbors; ++id)
+    {
+      char* buffer = sendBuffer.data() + sendOffsets[id];
+      for (const Segment& segment : this->Neighbors[id].SendSegments)
+      {
+        vtkDataSetAttributes* dsa = GetAttributes(inputs[segment.Leaf], segment.Association);
+        const std::vector<vtkDataArray*> sources = GetExchangedArrays(dsa);
+        for (vtkDataArray* source : sources)
+        {
+          const vtkIdType numberOfIds = segment.Ids->GetNumberOfIds();
+          source->GetTuples(segment.Ids, WrapChunk(source, buffer, numberOfIds));
+          buffer += GetChunkSize(source, numberOfIds);
+        }
+      }
+    }
+
+    auto request = this->NeighborController->NoBlockNeighborAllToAllV(sendBuffer.data(),
+      sendLengths.data(), sendOffsets.data(), recvBuffer.data(), recvLengths.data(),
+      recvOffsets.data());
+
+    // Local copies overlap with the exchange.
+    for (const LocalCopy& copy : this->LocalCopies)
+    {
+      const std::vector<vtkDataArray*> sources =
+        GetExchangedArrays(GetAttributes(inputs[copy.SourceLeaf], copy.Association));
+      const std::vector<vtkDataArray*> targets =
+        GetExchangedArrays(GetAttributes(outputs[copy.TargetLeaf], copy.Association));
+      for (std::size_t id = 0; id < sources.size() && id < targets.size(); ++id)
+      {
+        targets[id]->InsertTuples(copy.TargetIds, copy.SourceIds, sources[id]);
+      }
+    }
+
+    if (!request || !request->Wait())
+    {
+      return 0;
+    }
+
+    for (std::size_t id = 0; id < numberOfNeighbors; ++id)
+    {
+      char* buffer = recvBuffer.data() + recvOffsets[id];
+      for (const Segment& segment : this->Neighbors[id].ReceiveSegments)
+      {
+        vtkDataSetAttributes* dsa = GetAttributes(outputs[segment.Leaf], segment.Association);
+        for (vtkDataArray* target : GetExchangedArrays(dsa))
+        {
+          const vtkIdType numberOfIds = segment.Ids->GetNumberOfIds();
+          target->InsertTuples(
+            segment.Ids, segment.BufferIds, WrapChunk(target, buffer, numberOfIds));
+          buffer += GetChunkSize(target, numberOfIds);
+        }
+      }
+    }
+
+    auto outputDS = vtkDataSet::SafeDownCast(outputDO);
+    if (outputDS && !outputs.empty())
+    {
+      outputDS->ShallowCopy(outputs[0]);
+    }
+    else if (auto outputCDS = vtkCompositeDataSet::SafeDownCast(outputDO))
+    {
+      outputCDS->CopyStructure(vtkCompositeDataSet::SafeDownCast(modifInputDO));
+      auto iter = vtkSmartPointer<vtkCompositeDataIterator>::Take(
+        vtkCompositeDataSet::SafeDownCast(modifInputDO)->NewIterator());
+      std::size_t leaf = 0;
+      for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+      {
+        if (vtkDataSet::SafeDownCast(iter->GetCurrentDataObject()))
+        {
+          outputCDS->SetDataSet(iter, outputs[leaf++]);
+        }
+      }
+    }
+    return 1;
+  }
+};
+
 vtkStandardNewMacro(vtkGhostCellsGenerator);
 vtkCxxSetObjectMacro(vtkGhostCellsGenerator, Controller, vtkMultiProcessController);
 
 //----------------------------------------------------------------------------
 vtkGhostCellsGenerator::vtkGhostCellsGenerator()
+  : Internals(new vtkInternals)
 {
   this->SetController(vtkMultiProcessController::GetGlobalController());
 }
@@ -88,6 +725,18 @@ int vtkGhostCellsGenerator::Execute(vtkDataObject* inputDO, vtkInformationVector
   vtkSmartPointer<vtkDataObject> modifInputDO =
     vtkSmartPointer<vtkDataObject>::Take(inputDO->NewInstance());
   modifInputDO->ShallowCopy(inputDO);
+
+  int reqGhostLayers =
+    outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_GHOST_LEVELS());
+  int numberOfGhostLayersToCompute =
+    this->BuildIfRequired ? reqGhostLayers : std::max(reqGhostLayers, this->NumberOfGhostLayers);
+
+  const bool cacheTopology = this->CacheTopology && !this->SynchronizeOnly && this->Controller;
+  if (!cacheTopology)
+  {
+    this->Internals->Clear();
+  }
+
   if (this->GenerateProcessIds)
   {
     vtkNew<vtkGenerateProcessIds> pidGenerator;
@@ -105,6 +754,16 @@ int vtkGhostCellsGenerator::Execute(vtkDataObject* inputDO, vtkInformationVector
     modifInputDO->ShallowCopy(gidGenerator->GetOutputDataObject(0));
   }
 
+  if (cacheTopology)
+  {
+    if (this->Internals->CanReuse(
+          inputDO, modifInputDO, this->Controller, numberOfGhostLayersToCompute))
+    {
+      return this->Internals->Reuse(modifInputDO, outputDO);
+    }
+    this->Internals->AddSourceIds(modifInputDO, this->Controller->GetLocalProcessId());
+  }
+
   std::vector<vtkDataObject*> inputPDSs, outputPDSs;
 
   if (auto inputPDSC = vtkPartitionedDataSetCollection::SafeDownCast(modifInputDO))
@@ -193,12 +852,6 @@ int vtkGhostCellsGenerator::Execute(vtkDataObject* inputDO, vtkInformationVector
     }
     else
     {
-      int reqGhostLayers =
-        outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_GHOST_LEVELS());
-      int numberOfGhostLayersToCompute = this->BuildIfRequired
-        ? reqGhostLayers
-        : std::max(reqGhostLayers, this->NumberOfGhostLayers);
-
       std::vector<vtkImageData*> inputsID =
         vtkCompositeDataSet::GetDataSets<vtkImageData>(inputPartition);
       std::vector<vtkImageData*> outputsID =
@@ -243,6 +896,12 @@ int vtkGhostCellsGenerator::Execute(vtkDataObject* inputDO, vtkInformationVector
     }
   }
 
+  if (cacheTopology)
+  {
+    this->Internals->Build(inputDO, modifInputDO, outputDO, this->Controller,
+      numberOfGhostLayersToCompute, retVal && !error);
+  }
+
   return retVal && !error;
 }
 
@@ -276,5 +935,6 @@ void vtkGhostCellsGenerator::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
   os << indent << "Controller: " << this->Controller << endl;
+  os << indent << "CacheTopology: " << this->CacheTopology << endl;
 }
 VTK_ABI_NAMESPACE_END
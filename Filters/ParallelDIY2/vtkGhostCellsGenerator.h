@@ -39,6 +39,11 @@
  * to generate GlobalIds and ProcessIds on points/cells, via `GenerateGlobalIds` and
  * `GenerateProcessIds`.
  *
+ * For time-varying fields on a static mesh, `CacheTopology` can be enabled. The filter then
+ * remembers where each output point and cell comes from, and on subsequent executions with
+ * unchanged input geometry, it reuses the output geometry and only exchanges the point and
+ * cell data with the neighbor processes.
+ *
  * If the input is a `vtkUnstructuredGrid`, if the input `vtkPointData` has global ids, then the
  * values of those global ids are used instead of point position in 3D to connect 2 partitions.
  * If not, point position of the outer surface are used to connect them. The precision of such
@@ -78,6 +83,8 @@
 #include "vtkFiltersParallelDIY2Module.h" // for export macros
 #include "vtkWeakPointer.h"               // for vtkWeakPointer
 
+#include <memory> // for std::unique_ptr
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkDataObject;
 class vtkMultiProcessController;
@@ -162,6 +169,24 @@ public:
   vtkBooleanMacro(SynchronizeOnly, bool);
   ///@}
 
+  ///@{
+  /**
+   * Specify if the filter should cache the ghost topology between executions.
+   * When enabled, the first execution records the input point or cell each output
+   * point and cell is copied from. The following executions skip the ghost generation
+   * if the input geometry is unchanged on all processes, i.e. same mesh modification
+   * times, extents, and input ghost and global id arrays, and if the point and cell
+   * data arrays have the same names, types and number of components. In that case,
+   * the output geometry and ghost arrays are reused, and the point and cell data are
+   * copied locally or exchanged with one buffer per neighbor process.
+   * This is ignored when `SynchronizeOnly` is on.
+   * Default is FALSE.
+   */
+  vtkSetMacro(CacheTopology, bool);
+  vtkGetMacro(CacheTopology, bool);
+  vtkBooleanMacro(CacheTopology, bool);
+  ///@}
+
 protected:
   vtkGhostCellsGenerator();
   ~vtkGhostCellsGenerator() override;
@@ -199,6 +224,10 @@ private:
   bool GenerateGlobalIds = false;
   bool GenerateProcessIds = false;
   bool SynchronizeOnly = false;
+  bool CacheTopology = false;
+
+  struct vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
 };
 
 VTK_ABI_NAMESPACE_END
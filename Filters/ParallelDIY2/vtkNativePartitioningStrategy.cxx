@@ -4,9 +4,11 @@
 
 #include "vtkBoundingBox.h"
 #include "vtkCellData.h"
+#include "vtkCompositeDataSet.h"
 #include "vtkDIYKdTreeUtilities.h"
 #include "vtkDIYUtilities.h"
 #include "vtkDataSetAttributes.h"
+#include "vtkDoubleArray.h"
 #include "vtkGenericCell.h"
 #include "vtkIdTypeArray.h"
 #include "vtkKdNode.h"
@@ -15,6 +17,7 @@
 #include "vtkPartitionedDataSet.h"
 #include "vtkPartitionedDataSetCollection.h"
 #include "vtkPartitioningStrategy.h"
+#include "vtkPoints.h"
 #include "vtkRedistributeDataSetFilter.h"
 #include "vtkSMPThreadLocal.h"
 #include "vtkSMPThreadLocalObject.h"
@@ -415,6 +418,40 @@ std::vector<vtkBoundingBox> vtkNativePartitioningStrategy::GenerateCuts(vtkDataO
 
   double bds[6];
   bbox.GetBounds(bds);
+
+  // balance the cell costs instead of the number of cells when some are given on any rank
+  const auto datasets = vtkCompositeDataSet::GetDataSets(dobj);
+  std::vector<std::vector<double>> weights(datasets.size());
+  int weighted = 0;
+  for (size_t cc = 0; cc < datasets.size(); ++cc)
+  {
+    weighted |= this->ComputeCellWeights(datasets[cc], weights[cc]) ? 1 : 0;
+  }
+  if (controller && controller->GetNumberOfProcesses() > 1)
+  {
+    int globalWeighted = 0;
+    controller->AllReduce(&weighted, &globalWeighted, 1, vtkCommunicator::MAX_OP);
+    weighted = globalWeighted;
+  }
+  if (weighted)
+  {
+    std::vector<vtkSmartPointer<vtkPoints>> points;
+    std::vector<double> centers;
+    for (vtkDataSet* ds : datasets)
+    {
+      vtkPartitioningStrategy::ComputeCellCenters(ds, centers);
+      vtkNew<vtkDoubleArray> coords;
+      coords->SetNumberOfComponents(3);
+      coords->SetNumberOfTuples(ds->GetNumberOfCells());
+      std::copy(centers.begin(), centers.end(), coords->GetPointer(0));
+      auto pts = vtkSmartPointer<vtkPoints>::New();
+      pts->SetData(coords);
+      points.emplace_back(pts);
+    }
+    return vtkDIYKdTreeUtilities::GenerateCuts(
+      points, weights, std::max(1, num_partitions), controller, bds);
+  }
+
   return vtkDIYKdTreeUtilities::GenerateCuts(
     dobj, std::max(1, num_partitions), /*use_cell_centers=*/true, controller, bds);
 }
@@ -18,6 +18,10 @@
  * bounding boxes for the kdtree leaf nodes are then used to redistribute the
  * data.
  *
+ * When cell costs are given (see `vtkPartitioningStrategy::SetCellWeightsArrayName` and
+ * `vtkPartitioningStrategy::SetCellCostFunction`), the kdtree balances the total cost of the
+ * cells of each partition instead of their number, using a weighted recursive bisection.
+ *
  * Alternatively a collection of bounding boxes may be provided that can be used
  * to distribute the data instead of computing them (see `UseExplicitCuts` and
  * `SetExplicitCuts`). When explicit cuts are specified, it is possible use
@@ -35,6 +35,7 @@
 // clang-format on
 
 #include <algorithm>
+#include <array>
 #include <iterator>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -246,8 +247,9 @@ inline void DestroyBlock(void* blockp)
 }
 
 //------------------------------------------------------------------------------
-// Creates a PointList of all the valid points in img
-inline void GetPointsFromImage(vtkImageData* img, const char* maskArrayName, PointList* points)
+// Creates a PointList of all the valid points of img inside extent
+inline void GetPointsFromImage(
+  vtkImageData* img, const int extent[6], const char* maskArrayName, PointList* points)
 {
   if (img->GetNumberOfPoints() <= 0)
   {
@@ -261,8 +263,6 @@ inline void GetPointsFromImage(vtkImageData* img, const char* maskArrayName, Poi
   // use diy's serialization facilities
   diy::MemoryBuffer bb;
 
-  int extent[6];
-  img->GetExtent(extent);
   for (int k = extent[4]; k <= extent[5]; ++k)
   {
     for (int j = extent[2]; j <= extent[3]; ++j)
@@ -284,14 +284,11 @@ inline void GetPointsFromImage(vtkImageData* img, const char* maskArrayName, Poi
   points->Data.swap(bb.buffer); // get the serialized data buffer
 }
 
-// Sets the points from the PointList (points) to img. 'points' is modified
-// in the process.
-void SetPointsToImage(
-  const std::vector<FieldMetaData>& fieldMetaData, PointList& points, vtkImageData* img)
+// Copies the points from the PointList (points) to img, whose point data is
+// already initialized. 'points' is modified in the process.
+void CopyPointsToImage(PointList& points, vtkImageData* img)
 {
   vtkPointData* pd = img->GetPointData();
-  InitializeFieldData(fieldMetaData, img->GetNumberOfPoints(), pd);
-
   diy::MemoryBuffer bb;
   bb.buffer.swap(points.Data);
   std::size_t numPoints = points.Indices.size();
@@ -304,6 +301,15 @@ void SetPointsToImage(
   points.Indices.clear(); // reset the points structure to a valid empty state
 }
 
+// Sets the points from the PointList (points) to img. 'points' is modified
+// in the process.
+void SetPointsToImage(
+  const std::vector<FieldMetaData>& fieldMetaData, PointList& points, vtkImageData* img)
+{
+  InitializeFieldData(fieldMetaData, img->GetNumberOfPoints(), img->GetPointData());
+  CopyPointsToImage(points, img);
+}
+
 inline void GetGlobalFieldMetaData(
   diy::mpi::communicator& comm, vtkDataSetAttributes* data, std::vector<FieldMetaData>* metadata)
 {
@@ -414,12 +420,169 @@ void Redistribute(
   b->Extent[2 * axis + 1] = std::min(b->Extent[2 * axis] + length, maxIdx);
 }
 
+//------------------------------------------------------------------------------
+// Computes the intersection of two extents, returns false when it is empty.
+inline bool IntersectExtents(const int a[6], const int b[6], int result[6])
+{
+  for (int i = 0; i < 3; ++i)
+  {
+    result[2 * i] = std::max(a[2 * i], b[2 * i]);
+    result[2 * i + 1] = std::min(a[2 * i + 1], b[2 * i + 1]);
+    if (result[2 * i] > result[2 * i + 1])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Extent of block gid of a regular decomposition of extent along divisions.
+// Neighboring blocks share their boundary points.
+inline void GetBlockExtent(
+  const int extent[6], const std::vector<int>& divisions, int gid, int blockExtent[6])
+{
+  for (int i = 0; i < 3; ++i)
+  {
+    const int coord = gid % divisions[i];
+    gid /= divisions[i];
+    const int length = extent[2 * i + 1] - extent[2 * i];
+    blockExtent[2 * i] = extent[2 * i] + length * coord / divisions[i];
+    blockExtent[2 * i + 1] = extent[2 * i] + length * (coord + 1) / divisions[i];
+  }
+}
+
+// Copies the valid points of source inside extent to target. The point data of
+// target must have the arrays described by the field meta data.
+void CopyValidPoints(vtkImageData* source, const int extent[6], const char* maskArrayName,
+  const std::vector<FieldMetaData>& fieldMetaData, vtkImageData* target)
+{
+  vtkPointData* inPD = source->GetPointData();
+  vtkPointData* outPD = target->GetPointData();
+  vtkCharArray* maskArray = vtkArrayDownCast<vtkCharArray>(inPD->GetArray(maskArrayName));
+  if (!maskArray || inPD->GetNumberOfArrays() != static_cast<int>(fieldMetaData.size()))
+  {
+    return;
+  }
+  const char* mask = maskArray->GetPointer(0);
+
+  for (int k = extent[4]; k <= extent[5]; ++k)
+  {
+    for (int j = extent[2]; j <= extent[3]; ++j)
+    {
+      for (int i = extent[0]; i <= extent[1]; ++i)
+      {
+        int ijk[3] = { i, j, k };
+        const vtkIdType inId = source->ComputePointId(ijk);
+        if (mask[inId])
+        {
+          const vtkIdType outId = target->ComputePointId(ijk);
+          for (int cc = 0; cc < outPD->GetNumberOfArrays(); ++cc)
+          {
+            outPD->GetArray(cc)->SetTuple(outId, inId, inPD->GetArray(cc));
+          }
+        }
+      }
+    }
+  }
+}
+
+// Sends the valid points of piece directly to the processes whose block of the
+// regular decomposition of extent contains them, and fills output with the
+// block of this process. Only the processes whose pieces and blocks overlap
+// communicate.
+void ExchangeDirectly(diy::mpi::communicator& comm, vtkImageData* piece, const int extent[6],
+  const char* maskArrayName, const std::vector<FieldMetaData>& fieldMetaData,
+  vtkImageData* output)
+{
+  diy::DiscreteBounds domain(3);
+  for (int i = 0; i < 3; ++i)
+  {
+    domain.min[i] = extent[2 * i];
+    domain.max[i] = extent[2 * i + 1];
+  }
+  diy::RegularDecomposer<diy::DiscreteBounds> decomposer(3, domain, comm.size());
+  std::vector<std::array<int, 6>> blockExtents(comm.size());
+  for (int gid = 0; gid < comm.size(); ++gid)
+  {
+    GetBlockExtent(extent, decomposer.divisions, gid, blockExtents[gid].data());
+  }
+  const int myGid = comm.rank();
+  const int* myBlockExtent = blockExtents[myGid].data();
+
+  std::vector<int> pieceExtent(piece->GetExtent(), piece->GetExtent() + 6);
+  std::vector<std::vector<int>> pieceExtents;
+  diy::mpi::all_gather(comm, pieceExtent, pieceExtents);
+
+  // the neighbors are the processes whose piece overlaps the block of this
+  // process, or whose block overlaps the piece of this process
+  diy::Link* link = new diy::Link;
+  for (int gid = 0; gid < comm.size(); ++gid)
+  {
+    int overlap[6];
+    if (gid != myGid &&
+      (IntersectExtents(pieceExtent.data(), blockExtents[gid].data(), overlap) ||
+        IntersectExtents(pieceExtents[gid].data(), myBlockExtent, overlap)))
+    {
+      diy::BlockID bid;
+      bid.gid = bid.proc = gid;
+      link->add_neighbor(bid);
+    }
+  }
+
+  Block block;
+  diy::Master master(comm, 1);
+  master.add(myGid, &block, link);
+
+  const vtkIdType dataSize = ComputeSerializedFieldDataSize(fieldMetaData);
+  master.foreach ([&](Block*, const diy::Master::ProxyWithLink& cp) {
+    for (int i = 0; i < cp.link()->size(); ++i)
+    {
+      const diy::BlockID neighbor = cp.link()->target(i);
+      PointList points;
+      int overlap[6];
+      if (IntersectExtents(pieceExtent.data(), blockExtents[neighbor.gid].data(), overlap))
+      {
+        GetPointsFromImage(piece, overlap, maskArrayName, &points);
+      }
+      cp.enqueue(neighbor, points.Indices.size());
+      cp.enqueue(neighbor, points.Indices.data(), points.Indices.size());
+      cp.enqueue(neighbor, points.Data.data(), points.Data.size());
+    }
+  });
+  master.exchange();
+
+  output->SetExtent(const_cast<int*>(myBlockExtent));
+  InitializeFieldData(fieldMetaData, output->GetNumberOfPoints(), output->GetPointData());
+  int overlap[6];
+  if (IntersectExtents(pieceExtent.data(), myBlockExtent, overlap))
+  {
+    CopyValidPoints(piece, overlap, maskArrayName, fieldMetaData, output);
+  }
+
+  master.foreach ([&](Block*, const diy::Master::ProxyWithLink& cp) {
+    for (int i = 0; i < cp.link()->size(); ++i)
+    {
+      const int gid = cp.link()->target(i).gid;
+      std::size_t numPoints;
+      cp.dequeue(gid, numPoints);
+      PointList points;
+      points.DataSize = dataSize;
+      points.Indices.resize(numPoints);
+      points.Data.resize(numPoints * dataSize);
+      cp.dequeue(gid, points.Indices.data(), numPoints);
+      cp.dequeue(gid, points.Data.data(), points.Data.size());
+      CopyPointsToImage(points, output);
+    }
+  });
+}
+
 } // anonymous namespace
 
 VTK_ABI_NAMESPACE_BEGIN
 //------------------------------------------------------------------------------
 vtkPResampleToImage::vtkPResampleToImage()
   : Controller(nullptr)
+  , UseDirectExchange(false)
 {
   this->SetController(vtkMultiProcessController::GetGlobalController());
 }
@@ -434,6 +597,7 @@ vtkPResampleToImage::~vtkPResampleToImage()
 void vtkPResampleToImage::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "UseDirectExchange: " << this->UseDirectExchange << endl;
   if (this->Controller)
   {
     this->Controller->PrintSelf(os, indent);
@@ -489,11 +653,21 @@ int vtkPResampleToImage::RequestData(
   std::vector<FieldMetaData> pointFieldMetaData;
   GetGlobalFieldMetaData(comm, mypiece->GetPointData(), &pointFieldMetaData);
 
+  int* updateExtent = this->GetUpdateExtent();
+  if (this->UseDirectExchange)
+  {
+    output->SetOrigin(mypiece->GetOrigin());
+    output->SetSpacing(mypiece->GetSpacing());
+    ExchangeDirectly(
+      comm, mypiece, updateExtent, this->GetMaskArrayName(), pointFieldMetaData, output);
+    this->SetBlankPointsAndCells(output);
+    return 1;
+  }
+
   // perform swap-reduce partitioning on probed points to decompose the domain
   // into non-overlapping rectangular regions
   diy::RoundRobinAssigner assigner(comm.size(), comm.size());
 
-  int* updateExtent = this->GetUpdateExtent();
   diy::DiscreteBounds domain(3);
   for (int i = 0; i < 3; ++i)
   {
@@ -510,7 +684,7 @@ int vtkPResampleToImage::RequestData(
   Block* block = master.block<Block>(0);
   std::copy(updateExtent, updateExtent + 6, block->Extent);
   block->Points.DataSize = ComputeSerializedFieldDataSize(pointFieldMetaData);
-  GetPointsFromImage(mypiece, this->GetMaskArrayName(), &block->Points);
+  GetPointsFromImage(mypiece, mypiece->GetExtent(), this->GetMaskArrayName(), &block->Points);
 
   diy::RegularSwapPartners partners(decomposer, 2, false);
   diy::reduce(master, assigner, partners, &Redistribute);
@@ -6,6 +6,14 @@
  *
  * vtkPResampleToImage is a parallel filter that resamples the input dataset on
  * a uniform grid. It internally uses vtkProbeFilter to do the probing.
+ *
+ * Each process samples its own cells on the part of the grid covered by its
+ * input, then the sampled points are redistributed so that each process
+ * outputs a block of a regular decomposition of the grid. By default the
+ * points are redistributed with swap-reduce rounds. When UseDirectExchange is
+ * on, each process sends its points directly to the processes owning them, so
+ * that points already in the block of their process are never sent and only
+ * processes whose input overlaps the block of another process communicate.
  * @sa
  * vtkResampleToImage vtkProbeFilter
  */
@@ -38,6 +46,18 @@ public:
   vtkGetObjectMacro(Controller, vtkMultiProcessController);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get whether the sampled points are sent directly to the processes
+   * owning them instead of going through swap-reduce rounds. The blocks of the
+   * output may differ from the ones given by the swap-reduce rounds.
+   * Default is false.
+   */
+  vtkSetMacro(UseDirectExchange, bool);
+  vtkGetMacro(UseDirectExchange, bool);
+  vtkBooleanMacro(UseDirectExchange, bool);
+  ///@}
+
 protected:
   vtkPResampleToImage();
   ~vtkPResampleToImage() override;
@@ -45,6 +65,7 @@ protected:
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
 
   vtkMultiProcessController* Controller;
+  bool UseDirectExchange;
 
 private:
   vtkPResampleToImage(const vtkPResampleToImage&) = delete;
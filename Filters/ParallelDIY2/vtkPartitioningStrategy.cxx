@@ -2,10 +2,19 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkPartitioningStrategy.h"
 
+#include "vtkCellData.h"
+#include "vtkDataArray.h"
+#include "vtkDataSet.h"
+#include "vtkGenericCell.h"
 #include "vtkMultiProcessController.h"
+#include "vtkNew.h"
 #include "vtkRedistributeDataSetFilter.h"
+#include "vtkSMPTools.h"
+#include "vtkUnsignedCharArray.h"
 #include "vtk_diy2.h"
 
+#include <utility>
+
 VTK_ABI_NAMESPACE_BEGIN
 //------------------------------------------------------------------------------
 vtkCxxSetObjectMacro(vtkPartitioningStrategy, Controller, vtkMultiProcessController);
@@ -14,6 +23,10 @@ void vtkPartitioningStrategy::PrintSelf(std::ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
   os << indent.GetNextIndent() << "NumberOfPartitions: " << this->NumberOfPartitions << std::endl;
+  os << indent.GetNextIndent() << "CellWeightsArrayName: " << this->CellWeightsArrayName
+     << std::endl;
+  os << indent.GetNextIndent() << "CellCostFunction: " << (this->CostFunction ? "set" : "none")
+     << std::endl;
   if (this->Controller)
   {
     this->Controller->PrintSelf(os, indent.GetNextIndent());
@@ -35,4 +48,82 @@ vtkPartitioningStrategy::~vtkPartitioningStrategy()
 {
   this->SetController(nullptr);
 }
+
+//------------------------------------------------------------------------------
+void vtkPartitioningStrategy::SetCellCostFunction(CellCostFunction function)
+{
+  this->CostFunction = std::move(function);
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+bool vtkPartitioningStrategy::ComputeCellWeights(vtkDataSet* dataset, std::vector<double>& weights)
+{
+  weights.clear();
+  if (!dataset)
+  {
+    return false;
+  }
+  vtkDataArray* array = !this->CostFunction && !this->CellWeightsArrayName.empty()
+    ? dataset->GetCellData()->GetArray(this->CellWeightsArrayName.c_str())
+    : nullptr;
+  if (!this->CostFunction && !array)
+  {
+    return false;
+  }
+
+  const vtkIdType numCells = dataset->GetNumberOfCells();
+  weights.resize(numCells);
+  if (this->CostFunction && numCells > 0)
+  {
+    // call GetCell once to make it thread safe (see vtkDataSet::GetCell).
+    vtkNew<vtkGenericCell> cell;
+    dataset->GetCell(0, cell);
+  }
+  vtkUnsignedCharArray* ghosts = dataset->GetCellData()->GetGhostArray();
+  vtkSMPTools::For(0, numCells,
+    [&](vtkIdType first, vtkIdType last)
+    {
+      for (vtkIdType cellId = first; cellId < last; ++cellId)
+      {
+        if (ghosts && (ghosts->GetValue(cellId) & vtkDataSetAttributes::DUPLICATECELL))
+        {
+          weights[cellId] = 0.0;
+        }
+        else
+        {
+          weights[cellId] = this->CostFunction ? this->CostFunction(dataset, cellId)
+                                               : array->GetComponent(cellId, 0);
+        }
+      }
+    });
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkPartitioningStrategy::ComputeCellCenters(vtkDataSet* dataset, std::vector<double>& centers)
+{
+  const vtkIdType numCells = dataset->GetNumberOfCells();
+  centers.resize(3 * numCells);
+  if (numCells == 0)
+  {
+    return;
+  }
+  // call GetCellBounds once to make it thread safe (see vtkDataSet::GetCell).
+  double bds[6];
+  dataset->GetCellBounds(0, bds);
+  vtkSMPTools::For(0, numCells,
+    [&](vtkIdType first, vtkIdType last)
+    {
+      double bounds[6];
+      for (vtkIdType cellId = first; cellId < last; ++cellId)
+      {
+        dataset->GetCellBounds(cellId, bounds);
+        for (int dim = 0; dim < 3; ++dim)
+        {
+          centers[3 * cellId + dim] = 0.5 * (bounds[2 * dim] + bounds[2 * dim + 1]);
+        }
+      }
+    });
+}
 VTK_ABI_NAMESPACE_END
@@ -18,6 +18,10 @@
  * std::vectors of PartitionInformation (one for each current partition in the
  * vtkPartitionedDataSetCollection) to the vtkRedistributeDataSetFilter
  *
+ * Strategies balance the total cost of the cells of each partition. By default all cells have
+ * the same cost, the cost can be read from a cell data array with `CellWeightsArrayName`, or
+ * computed by a cost model set with `SetCellCostFunction`.
+ *
  * @sa
  * vtkRedistributeDataSetFilter
  */
@@ -29,7 +33,12 @@
 #include "vtkObject.h"
 #include "vtkSmartPointer.h" // for member variables
 
+#include <functional> // for std::function
+#include <string>     // for std::string
+#include <vector>     // for std::vector
+
 VTK_ABI_NAMESPACE_BEGIN
+class vtkDataSet;
 class vtkIdTypeArray;
 class vtkMultiProcessController;
 class vtkPartitionedDataSetCollection;
@@ -119,14 +128,55 @@ public:
   vtkSetMacro(NumberOfPartitions, vtkIdType);
   ///@}
 
+  ///@{
+  /**
+   * Get/Set the name of a cell data array holding the cost of each cell, read from its first
+   * component. Cells with a null or negative cost are still distributed but do not count in the
+   * balance. Ignored when a cell cost function is set. Default is empty, all cells then have the
+   * same cost.
+   */
+  vtkSetMacro(CellWeightsArrayName, std::string);
+  vtkGetMacro(CellWeightsArrayName, std::string);
+  ///@}
+
+  /**
+   * Cost model returning the cost of a cell of a data set, for instance from its type, its
+   * order or its number of points. It is called concurrently from several threads.
+   */
+  using CellCostFunction = std::function<double(vtkDataSet*, vtkIdType)>;
+
+  ///@{
+  /**
+   * Get/Set the cost model used to balance the partitions. It takes precedence over
+   * `CellWeightsArrayName`. Default is empty.
+   */
+  void SetCellCostFunction(CellCostFunction function);
+  const CellCostFunction& GetCellCostFunction() const { return this->CostFunction; }
+  ///@}
+
+  /**
+   * Compute the cost of each cell of `dataset` with the cost model or the cell weights array.
+   * Duplicate ghost cells have a null cost as they are distributed by the process owning them.
+   * Returns false, leaving `weights` empty, when all cells have the same cost.
+   */
+  bool ComputeCellWeights(vtkDataSet* dataset, std::vector<double>& weights);
+
 protected:
   vtkPartitioningStrategy();
   ~vtkPartitioningStrategy() override;
 
+  /**
+   * Compute the center of the bounding box of each cell of `dataset`, as 3 values per cell.
+   */
+  static void ComputeCellCenters(vtkDataSet* dataset, std::vector<double>& centers);
+
   vtkMultiProcessController* Controller = nullptr;
 
   vtkIdType NumberOfPartitions = -1;
 
+  std::string CellWeightsArrayName;
+  CellCostFunction CostFunction;
+
 private:
   vtkPartitioningStrategy(const vtkPartitioningStrategy&) = delete;
   void operator=(const vtkPartitioningStrategy&) = delete;
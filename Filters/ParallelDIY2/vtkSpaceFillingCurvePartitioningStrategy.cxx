@@ -0,0 +1,370 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkSpaceFillingCurvePartitioningStrategy.h"
+
+#include "vtkBoundingBox.h"
+#include "vtkCellData.h"
+#include "vtkDIYUtilities.h"
+#include "vtkDataSet.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkIdTypeArray.h"
+#include "vtkMultiProcessController.h"
+#include "vtkObjectFactory.h"
+#include "vtkPartitionedDataSet.h"
+#include "vtkPartitionedDataSetCollection.h"
+#include "vtkSMPTools.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace
+{
+constexpr int BitsPerDimension = 21;
+constexpr vtkTypeUInt64 CurveLength = vtkTypeUInt64(1) << (3 * BitsPerDimension);
+constexpr vtkTypeUInt64 NumberOfBins = 256;
+
+//------------------------------------------------------------------------------
+// Transform coordinates into the transposed Hilbert index (J. Skilling, "Programming the
+// Hilbert curve", AIP Conference Proceedings 707, 2004).
+void AxesToTranspose(vtkTypeUInt32 x[3])
+{
+  const vtkTypeUInt32 m = vtkTypeUInt32(1) << (BitsPerDimension - 1);
+  for (vtkTypeUInt32 q = m; q > 1; q >>= 1)
+  {
+    const vtkTypeUInt32 p = q - 1;
+    for (int i = 0; i < 3; ++i)
+    {
+      if (x[i] & q)
+      {
+        x[0] ^= p;
+      }
+      else
+      {
+        const vtkTypeUInt32 t = (x[0] ^ x[i]) & p;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+  x[1] ^= x[0];
+  x[2] ^= x[1];
+  vtkTypeUInt32 t = 0;
+  for (vtkTypeUInt32 q = m; q > 1; q >>= 1)
+  {
+    if (x[2] & q)
+    {
+      t ^= q - 1;
+    }
+  }
+  for (int i = 0; i < 3; ++i)
+  {
+    x[i] ^= t;
+  }
+}
+
+//------------------------------------------------------------------------------
+// A cut along the curve, refined within [Lower, Lower + Width) until Width is 0.
+struct CurveCut
+{
+  vtkTypeUInt64 Lower = 0;
+  vtkTypeUInt64 Width = CurveLength;
+  double Below = 0.0;
+  double Target = 0.0;
+};
+}
+
+VTK_ABI_NAMESPACE_BEGIN
+//------------------------------------------------------------------------------
+vtkStandardNewMacro(vtkSpaceFillingCurvePartitioningStrategy);
+
+//------------------------------------------------------------------------------
+void vtkSpaceFillingCurvePartitioningStrategy::PrintSelf(std::ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent.GetNextIndent() << "Curve: " << (this->Curve == MORTON ? "Morton" : "Hilbert")
+     << std::endl;
+  os << indent.GetNextIndent() << "Tolerance: " << this->Tolerance << std::endl;
+}
+
+//------------------------------------------------------------------------------
+vtkTypeUInt64 vtkSpaceFillingCurvePartitioningStrategy::ComputeCurveIndex(
+  int curve, const double point[3])
+{
+  constexpr double scale = static_cast<double>(vtkTypeUInt32(1) << BitsPerDimension);
+  constexpr vtkTypeUInt32 maximum = (vtkTypeUInt32(1) << BitsPerDimension) - 1;
+  vtkTypeUInt32 x[3];
+  for (int dim = 0; dim < 3; ++dim)
+  {
+    const double value = point[dim] * scale;
+    x[dim] = value <= 0 ? 0 : std::min(maximum, static_cast<vtkTypeUInt32>(value));
+  }
+  if (curve == HILBERT)
+  {
+    ::AxesToTranspose(x);
+  }
+
+  vtkTypeUInt64 index = 0;
+  for (int bit = BitsPerDimension - 1; bit >= 0; --bit)
+  {
+    for (int dim = 0; dim < 3; ++dim)
+    {
+      index = (index << 1) | ((x[dim] >> bit) & 1);
+    }
+  }
+  return index;
+}
+
+//------------------------------------------------------------------------------
+std::vector<vtkPartitioningStrategy::PartitionInformation>
+vtkSpaceFillingCurvePartitioningStrategy::ComputePartition(
+  vtkPartitionedDataSetCollection* collection)
+{
+  std::vector<PartitionInformation> res;
+  if (!collection)
+  {
+    vtkErrorMacro("Collection is nullptr!");
+    return res;
+  }
+
+  auto controller = this->GetController();
+  const bool parallel = controller && controller->GetNumberOfProcesses() > 1;
+  const vtkIdType numberOfPartitions = std::max<vtkIdType>(1,
+    (controller && this->NumberOfPartitions < 0) ? controller->GetNumberOfProcesses()
+                                                 : this->NumberOfPartitions);
+
+  // the partition information is laid out like in vtkNativePartitioningStrategy, with the same
+  // number of entries on all ranks.
+  std::vector<vtkDataSet*> datasets;
+  for (unsigned int part = 0, max = collection->GetNumberOfPartitionedDataSets(); part < max;
+       ++part)
+  {
+    auto inputPTD = collection->GetPartitionedDataSet(part);
+    if (!inputPTD)
+    {
+      vtkWarningMacro("Found nullptr partitioned data set");
+      continue;
+    }
+    for (unsigned int cc = 0; cc < inputPTD->GetNumberOfPartitions(); ++cc)
+    {
+      auto ds = inputPTD->GetPartition(cc);
+      datasets.emplace_back(ds && ds->GetNumberOfCells() > 0 ? ds : nullptr);
+    }
+    if (parallel)
+    {
+      vtkIdType locsize = static_cast<vtkIdType>(datasets.size());
+      vtkIdType allsize = 0;
+      controller->AllReduce(&locsize, &allsize, 1, vtkCommunicator::MAX_OP);
+      datasets.resize(allsize, nullptr);
+    }
+  }
+  res.resize(datasets.size());
+
+  auto comm = vtkDIYUtilities::GetCommunicator(controller);
+  vtkBoundingBox gbounds = vtkDIYUtilities::GetLocalBounds(collection);
+  vtkDIYUtilities::AllReduce(comm, gbounds);
+  double origin[3] = { 0.0, 0.0, 0.0 }, lengths[3] = { 1.0, 1.0, 1.0 };
+  if (gbounds.IsValid())
+  {
+    gbounds.GetMinPoint(origin);
+    gbounds.GetLengths(lengths);
+  }
+
+  // curve index and cost of each cell
+  std::vector<std::vector<vtkTypeUInt64>> indices(datasets.size());
+  std::vector<std::vector<double>> weights(datasets.size());
+  double localTotal = 0.0;
+  for (size_t idx = 0; idx < datasets.size(); ++idx)
+  {
+    vtkDataSet* ds = datasets[idx];
+    if (!ds)
+    {
+      continue;
+    }
+    const vtkIdType numCells = ds->GetNumberOfCells();
+    if (!this->ComputeCellWeights(ds, weights[idx]))
+    {
+      weights[idx].assign(numCells, 1.0);
+      if (vtkUnsignedCharArray* ghosts = ds->GetCellData()->GetGhostArray())
+      {
+        for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+        {
+          if (ghosts->GetValue(cellId) & vtkDataSetAttributes::DUPLICATECELL)
+          {
+            weights[idx][cellId] = 0.0;
+          }
+        }
+      }
+    }
+    for (double& weight : weights[idx])
+    {
+      weight = std::max(0.0, weight);
+    }
+    localTotal = std::accumulate(weights[idx].begin(), weights[idx].end(), localTotal);
+
+    std::vector<double> centers;
+    vtkPartitioningStrategy::ComputeCellCenters(ds, centers);
+    indices[idx].resize(numCells);
+    const int curve = this->Curve;
+    vtkSMPTools::For(0, numCells,
+      [&](vtkIdType first, vtkIdType last)
+      {
+        for (vtkIdType cellId = first; cellId < last; ++cellId)
+        {
+          double point[3];
+          for (int dim = 0; dim < 3; ++dim)
+          {
+            point[dim] = lengths[dim] > 0
+              ? (centers[3 * cellId + dim] - origin[dim]) / lengths[dim]
+              : 0.0;
+          }
+          indices[idx][cellId] = ComputeCurveIndex(curve, point);
+        }
+      });
+  }
+  double total = localTotal;
+  if (parallel)
+  {
+    controller->AllReduce(&localTotal, &total, 1, vtkCommunicator::SUM_OP);
+  }
+
+  // refine the position of the cuts along the curve with global histograms. The cuts being
+  // refined share their range or have disjoint ranges, so each cell falls in at most one range.
+  const double tolerance = this->Tolerance * total / numberOfPartitions;
+  std::vector<::CurveCut> cuts(numberOfPartitions - 1);
+  for (size_t cc = 0; cc < cuts.size(); ++cc)
+  {
+    cuts[cc].Target = total * (cc + 1) / numberOfPartitions;
+  }
+  std::vector<vtkTypeUInt64> lowers;
+  std::vector<double> histograms, globalHistograms;
+  while (true)
+  {
+    lowers.clear();
+    for (const auto& cut : cuts)
+    {
+      if (cut.Width > 0 && (lowers.empty() || lowers.back() != cut.Lower))
+      {
+        lowers.push_back(cut.Lower);
+      }
+    }
+    if (lowers.empty())
+    {
+      break;
+    }
+
+    // all cuts of a range have the same width
+    std::vector<vtkTypeUInt64> widths(lowers.size());
+    for (const auto& cut : cuts)
+    {
+      if (cut.Width > 0)
+      {
+        widths[std::lower_bound(lowers.begin(), lowers.end(), cut.Lower) - lowers.begin()] =
+          cut.Width;
+      }
+    }
+
+    histograms.assign(lowers.size() * NumberOfBins, 0.0);
+    for (size_t idx = 0; idx < datasets.size(); ++idx)
+    {
+      for (size_t cellId = 0; cellId < indices[idx].size(); ++cellId)
+      {
+        const vtkTypeUInt64 index = indices[idx][cellId];
+        auto iter = std::upper_bound(lowers.begin(), lowers.end(), index);
+        if (iter == lowers.begin())
+        {
+          continue;
+        }
+        const size_t range = (iter - lowers.begin()) - 1;
+        const vtkTypeUInt64 offset = index - lowers[range];
+        if (offset < widths[range])
+        {
+          const vtkTypeUInt64 binWidth = (widths[range] + NumberOfBins - 1) / NumberOfBins;
+          histograms[range * NumberOfBins + offset / binWidth] += weights[idx][cellId];
+        }
+      }
+    }
+    if (parallel)
+    {
+      globalHistograms.resize(histograms.size());
+      controller->AllReduce(histograms.data(), globalHistograms.data(),
+        static_cast<vtkIdType>(histograms.size()), vtkCommunicator::SUM_OP);
+      histograms.swap(globalHistograms);
+    }
+
+    for (auto& cut : cuts)
+    {
+      if (cut.Width == 0)
+      {
+        continue;
+      }
+      const size_t range =
+        std::lower_bound(lowers.begin(), lowers.end(), cut.Lower) - lowers.begin();
+      const double* histogram = histograms.data() + range * NumberOfBins;
+      const vtkTypeUInt64 binWidth = (cut.Width + NumberOfBins - 1) / NumberOfBins;
+      const vtkTypeUInt64 numberOfBins = (cut.Width + binWidth - 1) / binWidth;
+      double cumulated = cut.Below;
+      vtkTypeUInt64 bin = 0;
+      while (bin < numberOfBins - 1 && cumulated + histogram[bin] < cut.Target)
+      {
+        cumulated += histogram[bin++];
+      }
+      const vtkTypeUInt64 lower = cut.Lower + bin * binWidth;
+      if (binWidth == 1 || histogram[bin] <= tolerance)
+      {
+        // stop at the closest bin boundary
+        cut.Lower = cut.Target - cumulated <= cumulated + histogram[bin] - cut.Target
+          ? lower
+          : std::min(cut.Lower + cut.Width, lower + binWidth);
+        cut.Width = 0;
+      }
+      else
+      {
+        cut.Width = std::min(binWidth, cut.Lower + cut.Width - lower);
+        cut.Lower = lower;
+        cut.Below = cumulated;
+      }
+    }
+  }
+
+  // a cell goes to the partition after the last cut before its index
+  std::vector<vtkTypeUInt64> cutIndices(cuts.size());
+  std::transform(cuts.begin(), cuts.end(), cutIndices.begin(),
+    [](const ::CurveCut& cut) { return cut.Lower; });
+  for (size_t idx = 0; idx < datasets.size(); ++idx)
+  {
+    PartitionInformation& info = res[idx];
+    info.TargetEntity = vtkPartitioningStrategy::CELLS;
+    info.NumberOfPartitions = numberOfPartitions;
+    info.BoundaryNeighborPartitions->SetNumberOfComponents(2);
+    vtkDataSet* ds = datasets[idx];
+    if (!ds)
+    {
+      continue;
+    }
+    const vtkIdType numCells = ds->GetNumberOfCells();
+    vtkUnsignedCharArray* ghosts = ds->GetCellData()->GetGhostArray();
+    info.TargetPartitions->SetNumberOfComponents(1);
+    info.TargetPartitions->SetNumberOfTuples(numCells);
+    vtkSMPTools::For(0, numCells,
+      [&](vtkIdType first, vtkIdType last)
+      {
+        for (vtkIdType cellId = first; cellId < last; ++cellId)
+        {
+          vtkIdType part = std::upper_bound(cutIndices.begin(), cutIndices.end(),
+                             indices[idx][cellId]) -
+            cutIndices.begin();
+          if (ghosts && (ghosts->GetValue(cellId) & vtkDataSetAttributes::DUPLICATECELL))
+          {
+            // ghost cells are sent by the rank where they are not ghosts.
+            part = -1;
+          }
+          info.TargetPartitions->SetValue(cellId, part);
+        }
+      });
+  }
+
+  return res;
+}
+
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class vtkSpaceFillingCurvePartitioningStrategy
+ * @brief A partitioning strategy cutting a space-filling curve into segments of equal cost
+ *
+ * This strategy orders the cells along a Morton (Z-order) or Hilbert curve through the global
+ * bounds of the data, based on the center of their bounding box, and cuts the curve into
+ * `NumberOfPartitions` segments of approximately equal total cost. Unlike
+ * `vtkNativePartitioningStrategy`, the number of partitions does not need to be a power of two,
+ * and the balance is not constrained by box-shaped regions, which helps when the cell costs vary
+ * a lot across the domain.
+ *
+ * The cost of the cells is given by the cell weights array or the cost model of
+ * `vtkPartitioningStrategy`, and defaults to one per cell. The positions of the cuts along the
+ * curve are found with a few global histograms of the curve indices, refined until each cut is
+ * within `Tolerance` of its ideal position.
+ *
+ * The partitions are balanced across all the partitioned data sets of the collection, so that a
+ * given partition covers the same part of the domain in all of them. Each cell is assigned to
+ * exactly one partition, no boundary information is provided.
+ *
+ * @sa
+ * vtkPartitioningStrategy, vtkNativePartitioningStrategy, vtkRedistributeDataSetFilter
+ */
+#ifndef vtkSpaceFillingCurvePartitioningStrategy_h
+#define vtkSpaceFillingCurvePartitioningStrategy_h
+
+#include "vtkPartitioningStrategy.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKFILTERSPARALLELDIY2_EXPORT vtkSpaceFillingCurvePartitioningStrategy
+  : public vtkPartitioningStrategy
+{
+public:
+  static vtkSpaceFillingCurvePartitioningStrategy* New();
+  vtkTypeMacro(vtkSpaceFillingCurvePartitioningStrategy, vtkPartitioningStrategy);
+  void PrintSelf(std::ostream& os, vtkIndent indent) override;
+
+  /**
+   * Implementation of parent API
+   */
+  std::vector<PartitionInformation> ComputePartition(vtkPartitionedDataSetCollection*) override;
+
+  enum CurveType
+  {
+    MORTON = 0,
+    HILBERT = 1
+  };
+
+  ///@{
+  /**
+   * Get/Set the space-filling curve ordering the cells. The Hilbert curve gives more compact
+   * partitions, with smaller boundaries, than the Morton curve. Default is HILBERT.
+   */
+  vtkSetClampMacro(Curve, int, MORTON, HILBERT);
+  vtkGetMacro(Curve, int);
+  void SetCurveToMorton() { this->SetCurve(MORTON); }
+  void SetCurveToHilbert() { this->SetCurve(HILBERT); }
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set the tolerance on the cost of the partitions, as a fraction of the average cost of a
+   * partition. The cuts are refined until the cost between a cut and its ideal position is
+   * smaller than the tolerance, or until they are exact. Default is 0.001.
+   */
+  vtkSetClampMacro(Tolerance, double, 0.0, 1.0);
+  vtkGetMacro(Tolerance, double);
+  ///@}
+
+  /**
+   * Compute the index along the curve of a point of the unit cube, quantized with 21 bits per
+   * dimension.
+   */
+  static vtkTypeUInt64 ComputeCurveIndex(int curve, const double point[3]);
+
+protected:
+  vtkSpaceFillingCurvePartitioningStrategy() = default;
+  ~vtkSpaceFillingCurvePartitioningStrategy() override = default;
+
+private:
+  vtkSpaceFillingCurvePartitioningStrategy(
+    const vtkSpaceFillingCurvePartitioningStrategy&) = delete;
+  void operator=(const vtkSpaceFillingCurvePartitioningStrategy&) = delete;
+
+  int Curve = HILBERT;
+  double Tolerance = 0.001;
+};
+VTK_ABI_NAMESPACE_END
+
+#endif // vtkSpaceFillingCurvePartitioningStrategy_h
@@ -123,6 +123,42 @@ int TestPStreamGeometry(int argc, char* argv[])
     res = err < 0.02;
   }
 
+  // Same circles from several heights, handed off in batches with work stealing
+  {
+    int numBatchedTraces = 8;
+    vtkNew<vtkPolyData> batchedSeeds;
+    vtkNew<vtkPoints> seedPoints;
+    for (int i = 0; i < numBatchedTraces; i++)
+    {
+      seedPoints->InsertNextPoint(start[0], -0.9 + 1.8 * i / (numBatchedTraces - 1), start[1]);
+    }
+    batchedSeeds->SetPoints(seedPoints);
+    tracer->SetInputData(1, batchedSeeds);
+    tracer->SetMessageBatchSize(4);
+    tracer->UseWorkStealingOn();
+    traceMapper->Update();
+
+    out = tracer->GetOutput();
+    double batchedLength(0);
+    lines = out->GetLines();
+    lines->InitTraversal();
+    while (lines->GetNextCell(polyLine))
+    {
+      batchedLength += ComputeLength(polyLine, out->GetPoints());
+    }
+    double batchedLengthAll(0);
+    c->Reduce(&batchedLength, &batchedLengthAll, 1, vtkCommunicator::SUM_OP, 0);
+    if (myRank == 0)
+    {
+      double err = fabs(batchedLengthAll - numBatchedTraces * maximumPropagation) /
+        (numBatchedTraces * maximumPropagation);
+      PRINT("Error in length with batches is: " << err)
+      res = res && err < 0.02;
+    }
+    tracer->SetMessageBatchSize(1);
+    tracer->UseWorkStealingOff();
+  }
+
   // Test IntegrationTime
   tracer->SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, "Velocity");
   vtkNew<vtkPolyData> singleSeed;
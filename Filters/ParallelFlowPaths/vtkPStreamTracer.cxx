@@ -477,6 +477,20 @@ public:
   vtkSetObjectMacro(Controller, vtkMultiProcessController);
 
   bool InCurrentProcess(double* p) { return InBB(p, GetBoundingBox(Rank)); }
+  bool InProcess(int rank, double* p) { return InBB(p, GetBoundingBox(rank)); }
+  bool Overlaps(int rank)
+  {
+    double* box = GetBoundingBox(this->Rank);
+    double* other = GetBoundingBox(rank);
+    for (int i = 0; i < 3; i++)
+    {
+      if (box[2 * i] > other[2 * i + 1] || other[2 * i] > box[2 * i + 1])
+      {
+        return false;
+      }
+    }
+    return true;
+  }
   int FindNextProcess(double* p)
   {
     for (int rank = CNext(this->Rank, this->NumProcs); rank != Rank;
@@ -980,12 +994,17 @@ public:
   {
     NewTask,
     NoMoreTasks,
-    TaskFinished
+    TaskFinished,
+    StealRequest,
+    StealReply
   };
 
-  TaskManager(ProcessLocator* locator, PStreamTracerPoint* proto)
+  TaskManager(
+    ProcessLocator* locator, PStreamTracerPoint* proto, int batchSize, bool useWorkStealing)
     : Locator(locator)
     , Proto(proto)
+    , BatchSize(batchSize)
+    , UseWorkStealing(useWorkStealing && locator != nullptr)
   {
     this->Controller = nullptr;
     this->SetController(
@@ -994,9 +1013,13 @@ public:
     this->NumProcs = this->Controller->GetNumberOfProcesses();
     this->Rank = this->Controller->GetLocalProcessId();
 
+    // a message holds its type, its sender, a count then up to BatchSize tasks.
     int prototypeSize = Proto == nullptr ? 0 : Proto->GetSize();
-    this->MessageSize = prototypeSize + sizeof(Task);
+    this->MessageSize =
+      3 * static_cast<int>(sizeof(int)) + this->BatchSize * (prototypeSize + sizeof(Task));
     this->ReceiveBuffer = nullptr;
+    this->OutgoingTasks.resize(this->NumProcs);
+    this->NumMessagesSent.resize(this->NumProcs, 0);
 
     this->NumSends = 0;
     this->Timer = vtkSmartPointer<vtkTimerLog>::New();
@@ -1023,6 +1046,18 @@ public:
       }
     }
 
+    // the processes that may hold traces starting in the bounds of this one.
+    if (this->UseWorkStealing && hasData)
+    {
+      for (int i = CNext(this->Rank, this->NumProcs); i != this->Rank; i = CNext(i, NumProcs))
+      {
+        if (this->HasData[i] && this->Locator->Overlaps(i))
+        {
+          this->Victims.push_back(i);
+        }
+      }
+    }
+
     std::vector<int> processMap0(MaxId + 1, -1);
     for (int i = 0; i < numSeeds; i++)
     {
@@ -1077,8 +1112,8 @@ public:
 
       if (task->GetTraceTerminated())
       {
-        // send to the master process
-        this->Send(TaskFinished, this->Leader, task);
+        // reported to the master process with the next batch
+        this->Finish(task);
       }
       else
       {
@@ -1099,14 +1134,18 @@ public:
           if (nextProcess >= 0)
           {
             task->IncHop();
-            // send it to the next guy
-            this->Send(NewTask, NextProcess(task), task);
+            // send it to the next guy along with the other traces going there
+            this->OutgoingTasks[nextProcess].push_back(task);
+            if (static_cast<int>(this->OutgoingTasks[nextProcess].size()) >= this->BatchSize)
+            {
+              this->SendTasks(NewTask, nextProcess, this->OutgoingTasks[nextProcess]);
+            }
           }
         }
 
         if (nextProcess < 0)
         {
-          this->Send(TaskFinished, this->Leader, task); // no one can do it, norminally finished
+          this->Finish(task); // no one can do it, norminally finished
           PRINT("Bail on " << task->GetId());
         }
       }
@@ -1118,25 +1157,37 @@ public:
 
     do
     {
+      if (NTasks.empty())
+      {
+        // about to wait: nothing must stay behind in a partial batch
+        this->FlushOutgoingTasks();
+        this->FlushFinishedTasks();
+        this->RequestWork();
+      }
       this->Receive(this->TotalNumTasks != 0 && this->Msgs.empty() &&
         NTasks.empty()); // wait if there is nothing to do
       while (!this->Msgs.empty())
       {
-        Message msg = this->Msgs.back();
+        std::pair<Message, int> msg = this->Msgs.back();
         this->Msgs.pop_back();
-        switch (msg)
+        switch (msg.first)
         {
           case NewTask:
             break;
           case TaskFinished:
             AssertEq(Rank, this->Leader);
-            this->TotalNumTasks--;
             PRINT(TotalNumTasks << " tasks left");
             break;
           case NoMoreTasks:
             AssertNe(Rank, this->Leader);
             this->TotalNumTasks = 0;
             break;
+          case StealRequest:
+            this->GiveWork(msg.second);
+            break;
+          case StealReply:
+            this->StealPending = false;
+            break;
           default:
             assert(false);
         }
@@ -1168,6 +1219,26 @@ public:
     return nextTask;
   }
 
+  // Collective. With work stealing, requests and replies may still be on their
+  // way when the traces are done: receive them all so that none of them is
+  // left to a later execution.
+  void Finalize()
+  {
+    if (!this->UseWorkStealing)
+    {
+      return;
+    }
+    std::vector<int> numMessages(this->NumProcs);
+    this->Controller->AllReduce(this->NumMessagesSent.data(), numMessages.data(), this->NumProcs,
+      vtkCommunicator::SUM_OP);
+    while (this->NumMessagesReceived < numMessages[this->Rank])
+    {
+      this->Receive(true);
+    }
+    this->Msgs.clear();
+    AssertEq(this->NTasks.size(), 0);
+  }
+
   ~TaskManager()
   {
     for (BufferList::iterator itr = SendBuffers.begin(); itr != SendBuffers.end(); ++itr)
@@ -1207,7 +1278,7 @@ private:
   vtkMPIController* Controller;
   std::vector<vtkSmartPointer<Task>> NTasks;
   std::vector<vtkSmartPointer<Task>> PTasks;
-  std::vector<Message> Msgs;
+  std::vector<std::pair<Message, int>> Msgs;
   int NumProcs;
   int Rank;
   int TotalNumTasks;
@@ -1218,55 +1289,134 @@ private:
   BufferList SendBuffers;
   MessageBuffer* ReceiveBuffer;
 
-  void Send(int msg, int rank, Task* task)
-  {
-    if (task && (msg == TaskFinished))
-    {
-      PRINT("Done in " << task->Point->GetNumSteps() << " steps " << task->NumHops << " hops");
-    }
-    if (rank == this->Rank)
+  // traces waiting to be sent to each process, and traces finished here that
+  // the leader does not know about yet.
+  int BatchSize;
+  std::vector<std::vector<vtkSmartPointer<Task>>> OutgoingTasks;
+  int NumFinishedTasks = 0;
+
+  // work stealing state, and the number of messages exchanged to drain them.
+  bool UseWorkStealing;
+  std::vector<int> Victims;
+  size_t NextVictim = 0;
+  size_t NumFailedSteals = 0;
+  bool StealPending = false;
+  std::vector<int> NumMessagesSent;
+  int NumMessagesReceived = 0;
+
+  void Finish(Task* task)
+  {
+    (void)task;
+    PRINT("Done in " << task->Point->GetNumSteps() << " steps " << task->NumHops << " hops");
+    if (this->Rank == this->Leader)
     {
-      switch (msg)
-      {
-        case TaskFinished:
-          this->TotalNumTasks--;
-          PRINT(TotalNumTasks << " tasks left");
-          break;
-        default:
-          PRINT("Unhandled message " << msg);
-          assert(false);
-      }
+      this->TotalNumTasks--;
+      PRINT(TotalNumTasks << " tasks left");
     }
     else
     {
-      MessageBuffer& buf = this->NewSendBuffer();
-      MessageStream& outStream(buf.GetStream());
+      this->NumFinishedTasks++;
+    }
+  }
 
-      outStream << msg << this->Rank;
-      AssertNe(this->Rank, rank);
+  void FlushFinishedTasks()
+  {
+    if (this->NumFinishedTasks > 0)
+    {
+      this->Send(TaskFinished, this->Leader, nullptr, this->NumFinishedTasks);
+      this->NumFinishedTasks = 0;
+    }
+  }
 
-      if (task)
+  void FlushOutgoingTasks()
+  {
+    for (int i = 0; i < this->NumProcs; i++)
+    {
+      if (!this->OutgoingTasks[i].empty())
       {
-        outStream << (*task);
+        this->SendTasks(NewTask, i, this->OutgoingTasks[i]);
       }
+    }
+  }
 
-      AssertGe(this->MessageSize, outStream.GetLength());
-      this->Controller->NoBlockSend(
-        outStream.GetRawData(), outStream.GetLength(), rank, 561, buf.GetRequest());
+  // Ask the next process whose bounds overlap ours for traces waiting there,
+  // until each of them had nothing to give since we last got work.
+  void RequestWork()
+  {
+    if (!this->UseWorkStealing || this->StealPending || this->TotalNumTasks == 0 ||
+      this->NumFailedSteals >= this->Victims.size())
+    {
+      return;
+    }
+    const int victim = this->Victims[this->NextVictim];
+    this->NextVictim = (this->NextVictim + 1) % this->Victims.size();
+    this->Send(StealRequest, victim, nullptr);
+    this->StealPending = true;
+  }
 
-      NumSends++;
-      if (task)
+  // Give the oldest waiting traces that start in the bounds of `thief`, up to
+  // half of them and at most a batch.
+  void GiveWork(int thief)
+  {
+    std::vector<vtkSmartPointer<Task>> stolen;
+    size_t numCandidates = 0;
+    for (const auto& task : this->NTasks)
+    {
+      PStreamTracerPoint* point = task->GetPoint();
+      numCandidates +=
+        point->GetRank() < 0 && this->Locator->InProcess(thief, point->GetSeed()) ? 1 : 0;
+    }
+    const size_t numStolen =
+      std::min(static_cast<size_t>(this->BatchSize), (numCandidates + 1) / 2);
+    for (auto itr = this->NTasks.begin(); itr != this->NTasks.end() && stolen.size() < numStolen;)
+    {
+      PStreamTracerPoint* point = (*itr)->GetPoint();
+      if (point->GetRank() < 0 && this->Locator->InProcess(thief, point->GetSeed()))
       {
-        PRINT("Send " << msg << "; task "
-                      << task->GetId()); //<<" "<<task->Seed[0]<<" "<<task->Seed[1]<<"
-                                         //"<<task->Seed[2]<<" to "<<rank);
+        stolen.push_back(*itr);
+        itr = this->NTasks.erase(itr);
       }
       else
       {
-        PRINT("Send " << msg);
+        ++itr;
       }
     }
+    PRINT("Give " << stolen.size() << " tasks to " << thief);
+    this->SendTasks(StealReply, thief, stolen);
   }
+
+  void SendTasks(int msg, int rank, std::vector<vtkSmartPointer<Task>>& tasks)
+  {
+    this->Send(msg, rank, &tasks, static_cast<int>(tasks.size()));
+    tasks.clear();
+  }
+
+  void Send(
+    int msg, int rank, std::vector<vtkSmartPointer<Task>>* tasks, int count = 0)
+  {
+    AssertNe(this->Rank, rank);
+    MessageBuffer& buf = this->NewSendBuffer();
+    MessageStream& outStream(buf.GetStream());
+
+    outStream << msg << this->Rank << count;
+    if (tasks)
+    {
+      for (const auto& task : *tasks)
+      {
+        outStream << (*task);
+        PRINT("Send " << msg << "; task " << task->GetId() << " to " << rank);
+      }
+    }
+
+    AssertGe(this->MessageSize, outStream.GetLength());
+    this->Controller->NoBlockSend(
+      outStream.GetRawData(), outStream.GetLength(), rank, 561, buf.GetRequest());
+
+    NumSends++;
+    this->NumMessagesSent[rank]++;
+    PRINT("Send " << msg << " to " << rank);
+  }
+
   int NextProcess(Task* task)
   {
     PStreamTracerPoint* p = task->GetPoint();
@@ -1323,11 +1473,9 @@ private:
     return *buf;
   }
 
+  // Handle the messages received so far, waiting for one first if `wait`.
   void Receive(bool wait = false)
   {
-    int msg = -1;
-    int sender(0);
-
 #ifdef DEBUGTRACE
     //    this->StartTimer();
 #endif
@@ -1336,30 +1484,44 @@ private:
       ReceiveBuffer->GetRequest().Wait();
     }
 
-    if (ReceiveBuffer && ReceiveBuffer->GetRequest().Test())
+    while (ReceiveBuffer && ReceiveBuffer->GetRequest().Test())
     {
+      int msg = -1;
+      int sender(0);
+      int count(0);
       MyStream& inStream(ReceiveBuffer->GetStream());
-      inStream >> msg >> sender;
-      this->Msgs.push_back((Message)msg);
-      if (msg == NewTask)
+      inStream >> msg >> sender >> count;
+      this->NumMessagesReceived++;
+      PRINT("Received message " << msg << " from " << sender)
+      if (msg == TaskFinished)
       {
-        PRINT("Received message " << msg << " from " << sender)
-
-        vtkSmartPointer<Task> task = this->NewTaskInstance();
-        this->Read(inStream, *task);
-        PRINT("Received task "
-          << task->GetId()); //<<" "<<task->Seed[0]<<" "<<task->Seed[1]<<" "<<task->Seed[2]);
-        this->NTasks.push_back(task);
+        this->TotalNumTasks -= count;
       }
+      else
+      {
+        for (int i = 0; i < count; i++)
+        {
+          vtkSmartPointer<Task> task = this->NewTaskInstance();
+          this->Read(inStream, *task);
+          PRINT("Received task " << task->GetId());
+          this->NTasks.push_back(task);
+        }
+      }
+      if (msg == NewTask || msg == StealReply)
+      {
+        // stop stealing after a full round of requests without any work
+        this->NumFailedSteals = count > 0 ? 0 : this->NumFailedSteals + 1;
+      }
+      this->Msgs.emplace_back(static_cast<Message>(msg), sender);
+
+      // post the next receive, then look for messages already there
       delete ReceiveBuffer;
       ReceiveBuffer = nullptr;
+      this->PostReceive();
     }
     if (ReceiveBuffer == nullptr)
     {
-      ReceiveBuffer = new MessageBuffer(this->MessageSize);
-      MyStream& inStream(ReceiveBuffer->GetStream());
-      this->Controller->NoBlockReceive(inStream.GetRawData(), inStream.GetSize(),
-        vtkMultiProcessController::ANY_SOURCE, 561, ReceiveBuffer->GetRequest());
+      this->PostReceive();
     }
 
 #ifdef DEBUGTRACE
@@ -1371,6 +1533,14 @@ private:
 #endif
   }
 
+  void PostReceive()
+  {
+    ReceiveBuffer = new MessageBuffer(this->MessageSize);
+    MyStream& inStream(ReceiveBuffer->GetStream());
+    this->Controller->NoBlockReceive(inStream.GetRawData(), inStream.GetSize(),
+      vtkMultiProcessController::ANY_SOURCE, 561, ReceiveBuffer->GetRequest());
+  }
+
   int NumSends;
   double ReceiveTime;
   vtkSmartPointer<vtkTimerLog> Timer;
@@ -1543,7 +1713,8 @@ int vtkPStreamTracer::RequestData(
   typedef std::vector<vtkSmartPointer<vtkPolyData>> traceOutputsType;
   traceOutputsType traceOutputs;
 
-  TaskManager taskManager(this->Utils->GetProcessLocator(), this->Utils->GetProto());
+  TaskManager taskManager(this->Utils->GetProcessLocator(), this->Utils->GetProto(),
+    this->MessageBatchSize, this->UseWorkStealing);
   PStreamTracerPointArray seedPoints;
 
   int maxId;
@@ -1600,6 +1771,7 @@ int vtkPStreamTracer::RequestData(
     traceIds.push_back(task->GetId());
     traceOutputs.push_back(traceOut);
   }
+  taskManager.Finalize();
 
   this->Controller->Barrier();
 
@@ -1710,6 +1882,8 @@ void vtkPStreamTracer::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
   os << indent << "Controller: " << this->Controller << endl;
+  os << indent << "MessageBatchSize: " << this->MessageBatchSize << endl;
+  os << indent << "UseWorkStealing: " << (this->UseWorkStealing ? "On" : "Off") << endl;
 }
 
 //------------------------------------------------------------------------------
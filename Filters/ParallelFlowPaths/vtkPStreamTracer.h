@@ -9,6 +9,12 @@
  * be identical on all processes. If property `UseLocalSeedSource` is set to
  * false then this filter will aggregate seed sources from all ranks into a
  * single dataset.
+ *
+ * Traces leaving the bounds of a process are handed off to the next process
+ * with nonblocking sends, so that no process waits for the others between two
+ * traces. `MessageBatchSize` groups the traces sent to the same process in a
+ * single message, and `UseWorkStealing` lets an idle process take seeds waiting
+ * on the processes whose bounds overlap its own.
  * @sa
  * vtkStreamTracer
  */
@@ -54,6 +60,30 @@ public:
   vtkGetObjectMacro(Controller, vtkMultiProcessController);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get the maximum number of traces handed off to another process in a
+   * single message. The traces going to the same process are held back until
+   * the batch is full or this process runs out of traces. Larger batches send
+   * fewer messages when many traces cross the same boundaries. Defaults to 1.
+   */
+  vtkSetClampMacro(MessageBatchSize, int, 1, VTK_INT_MAX);
+  vtkGetMacro(MessageBatchSize, int);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get whether a process without traces left asks the processes whose
+   * bounds overlap its own for seeds they have not traced yet. Only seeds that
+   * lie within the bounds of the idle process are given away. This helps when
+   * the seeds are concentrated in a few processes. Ignored for AMR inputs.
+   * Defaults to false.
+   */
+  vtkSetMacro(UseWorkStealing, bool);
+  vtkGetMacro(UseWorkStealing, bool);
+  vtkBooleanMacro(UseWorkStealing, bool);
+  ///@}
+
 protected:
   vtkPStreamTracer();
   ~vtkPStreamTracer() override;
@@ -68,6 +98,9 @@ protected:
 
   int EmptyData;
 
+  int MessageBatchSize = 1;
+  bool UseWorkStealing = false;
+
 private:
   vtkPStreamTracer(const vtkPStreamTracer&) = delete;
   void operator=(const vtkPStreamTracer&) = delete;
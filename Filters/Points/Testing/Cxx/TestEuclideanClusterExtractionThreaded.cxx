@@ -0,0 +1,199 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Extract clusters from blobs of points with vtkEuclideanClusterExtraction,
+// and check that the threaded clustering used with a vtkStaticPointLocator
+// finds the same clusters as the serial traversal used with other locators,
+// with the same output for any number of threads.
+
+#include "vtkDataArray.h"
+#include "vtkEuclideanClusterExtraction.h"
+#include "vtkIntArray.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPointLocator.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkTestUtilities.h"
+
+#include <cstdlib>
+
+namespace
+{
+const int NumberOfBlobs = 27;
+
+// Blob b is a lattice of n x n x n points, n = 3 + b % 4, with a spacing of
+// 0.1. The points of the blobs are interleaved, so that blob b holds the
+// point b and the blobs are clusters numbered like the blobs.
+int BlobResolution(int blob)
+{
+  return 3 + blob % 4;
+}
+
+vtkSmartPointer<vtkPolyData> CreateBlobs()
+{
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkIntArray> blobs;
+  blobs->SetName("Blob");
+  vtkNew<vtkIntArray> scalars;
+  scalars->SetName("Scalars");
+  const int maxRes = 6;
+  for (int k = 0; k < maxRes * maxRes * maxRes; ++k)
+  {
+    for (int blob = 0; blob < NumberOfBlobs; ++blob)
+    {
+      const int res = BlobResolution(blob);
+      if (k >= res * res * res)
+      {
+        continue;
+      }
+      points->InsertNextPoint(3.0 * (blob % 3) + 0.1 * (k % res),
+        3.0 * ((blob / 3) % 3) + 0.1 * ((k / res) % res), 3.0 * (blob / 9) + 0.1 * (k / res / res));
+      blobs->InsertNextValue(blob);
+      scalars->InsertNextValue(blob % 3);
+    }
+  }
+  auto input = vtkSmartPointer<vtkPolyData>::New();
+  input->SetPoints(points);
+  input->GetPointData()->AddArray(blobs);
+  input->GetPointData()->SetScalars(scalars);
+  return input;
+}
+
+// Run the filter with a vtkPointLocator, then with the default locator with
+// one and several threads, and compare the number of clusters found and the
+// outputs of the threaded runs.
+bool CheckMode(vtkEuclideanClusterExtraction* extract, const char* name)
+{
+  vtkNew<vtkPointLocator> pointLocator;
+  vtkSmartPointer<vtkAbstractPointLocator> staticLocator = extract->GetLocator();
+  extract->SetLocator(pointLocator);
+  extract->Update();
+  const int serialNumClusters = extract->GetNumberOfExtractedClusters();
+
+  extract->SetLocator(staticLocator);
+  vtkNew<vtkPolyData> singleThread;
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ 1 }, [&]() { extract->Update(); });
+  singleThread->DeepCopy(extract->GetOutput());
+  extract->Modified();
+  extract->Update();
+  vtkPolyData* output = extract->GetOutput();
+
+  if (extract->GetNumberOfExtractedClusters() != serialNumClusters)
+  {
+    vtkLog(ERROR, "Threaded clusters differ from the serial ones for " << name);
+    return false;
+  }
+  if (!vtkTestUtilities::CompareDataObjects(singleThread, output))
+  {
+    vtkLog(ERROR, "Threaded output differs for " << name);
+    return false;
+  }
+  return true;
+}
+}
+
+int TestEuclideanClusterExtractionThreaded(int, char*[])
+{
+  vtkSmartPointer<vtkPolyData> input = CreateBlobs();
+
+  vtkNew<vtkEuclideanClusterExtraction> extract;
+  extract->SetInputData(input);
+  extract->SetRadius(0.15);
+  extract->ColorClustersOn();
+
+  // Every blob is a cluster, numbered like the blob
+  extract->SetExtractionModeToAllClusters();
+  if (!CheckMode(extract, "all clusters"))
+  {
+    return EXIT_FAILURE;
+  }
+  vtkPolyData* output = extract->GetOutput();
+  vtkDataArray* blobs = output->GetPointData()->GetArray("Blob");
+  vtkDataArray* clusterIds = output->GetPointData()->GetScalars();
+  if (extract->GetNumberOfExtractedClusters() != NumberOfBlobs ||
+    output->GetNumberOfPoints() != input->GetNumberOfPoints() ||
+    !vtkTestUtilities::CompareAbstractArray(blobs, clusterIds))
+  {
+    vtkLog(ERROR, "Wrong clusters");
+    return EXIT_FAILURE;
+  }
+
+  // The first largest blob is blob 3
+  extract->SetExtractionModeToLargestCluster();
+  if (!CheckMode(extract, "largest cluster"))
+  {
+    return EXIT_FAILURE;
+  }
+  output = extract->GetOutput();
+  blobs = output->GetPointData()->GetArray("Blob");
+  if (output->GetNumberOfPoints() != 6 * 6 * 6 || blobs->GetRange()[0] != 3 ||
+    blobs->GetRange()[1] != 3)
+  {
+    vtkLog(ERROR, "Wrong largest cluster");
+    return EXIT_FAILURE;
+  }
+
+  extract->SetExtractionModeToSpecifiedClusters();
+  extract->AddSpecifiedCluster(1);
+  extract->AddSpecifiedCluster(20);
+  if (!CheckMode(extract, "specified clusters"))
+  {
+    return EXIT_FAILURE;
+  }
+  const int res1 = BlobResolution(1), res20 = BlobResolution(20);
+  if (extract->GetOutput()->GetNumberOfPoints() != res1 * res1 * res1 + res20 * res20 * res20)
+  {
+    vtkLog(ERROR, "Wrong specified clusters");
+    return EXIT_FAILURE;
+  }
+
+  // Seeds in blobs 4 and 7 extract both blobs as a single cluster
+  extract->SetExtractionModeToPointSeededClusters();
+  extract->AddSeed(4);
+  extract->AddSeed(7);
+  extract->AddSeed(NumberOfBlobs + 4);
+  if (!CheckMode(extract, "point seeded clusters"))
+  {
+    return EXIT_FAILURE;
+  }
+  const int res4 = BlobResolution(4), res7 = BlobResolution(7);
+  if (extract->GetNumberOfExtractedClusters() != 1 ||
+    extract->GetOutput()->GetNumberOfPoints() != res4 * res4 * res4 + res7 * res7 * res7)
+  {
+    vtkLog(ERROR, "Wrong seeded clusters");
+    return EXIT_FAILURE;
+  }
+
+  extract->SetExtractionModeToClosestPointCluster();
+  extract->SetClosestPoint(3.1, 3.1, 3.1);
+  if (!CheckMode(extract, "closest point cluster"))
+  {
+    return EXIT_FAILURE;
+  }
+  const int res13 = BlobResolution(13);
+  if (extract->GetOutput()->GetNumberOfPoints() != res13 * res13 * res13)
+  {
+    vtkLog(ERROR, "Wrong closest point cluster");
+    return EXIT_FAILURE;
+  }
+
+  // Blobs with a scalar of 2 are left out
+  extract->SetExtractionModeToAllClusters();
+  extract->ScalarConnectivityOn();
+  extract->SetScalarRange(0, 1);
+  if (!CheckMode(extract, "scalar connectivity"))
+  {
+    return EXIT_FAILURE;
+  }
+  if (extract->GetNumberOfExtractedClusters() != NumberOfBlobs * 2 / 3)
+  {
+    vtkLog(ERROR, "Wrong clusters with scalar connectivity");
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
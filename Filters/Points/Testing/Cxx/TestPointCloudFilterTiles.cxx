@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the tiled execution of vtkPointCloudFilter gives the same
+// result as the untiled one, for vtkRadiusOutlierRemoval which supports
+// tiling and vtkStatisticalOutlierRemoval which does not.
+
+#include "vtkFloatArray.h"
+#include "vtkLogger.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPointCloudFilter.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkRadiusOutlierRemoval.h"
+#include "vtkStatisticalOutlierRemoval.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+bool CompareTiledAndUntiled(vtkPointCloudFilter* filter, vtkPolyData* input, const char* name)
+{
+  filter->SetInputData(input);
+  filter->GenerateOutliersOn();
+  filter->SetNumberOfTiles(1, 1, 1);
+  filter->Update();
+  const vtkIdType numPts = input->GetNumberOfPoints();
+  std::vector<vtkIdType> untiledMap(filter->GetPointMap(), filter->GetPointMap() + numPts);
+  const vtkIdType numRemoved = filter->GetNumberOfPointsRemoved();
+
+  filter->SetNumberOfTiles(3, 2, 4);
+  filter->Update();
+  if (filter->GetNumberOfPointsRemoved() != numRemoved ||
+    !std::equal(untiledMap.begin(), untiledMap.end(), filter->GetPointMap()))
+  {
+    vtkLog(ERROR, "Tiled execution differs for " << name);
+    return false;
+  }
+  vtkPolyData* output = vtkPolyData::SafeDownCast(filter->GetOutputDataObject(0));
+  vtkPolyData* outliers = vtkPolyData::SafeDownCast(filter->GetOutputDataObject(1));
+  if (output->GetNumberOfPoints() != numPts - numRemoved ||
+    outliers->GetNumberOfPoints() != numRemoved || !output->GetPointData()->GetArray("Values"))
+  {
+    vtkLog(ERROR, "Wrong tiled outputs for " << name);
+    return false;
+  }
+  return true;
+}
+}
+
+int TestPointCloudFilterTiles(int, char*[])
+{
+  // Dense points in a slab and sparse points around it
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(1);
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkFloatArray> values;
+  values->SetName("Values");
+  for (int i = 0; i < 20000; ++i)
+  {
+    const double x = random->GetNextRangeValue(0.0, 10.0);
+    const double y = random->GetNextRangeValue(0.0, 10.0);
+    const double z =
+      i % 10 ? random->GetNextRangeValue(4.5, 5.5) : random->GetNextRangeValue(0.0, 10.0);
+    points->InsertNextPoint(x, y, z);
+    values->InsertNextValue(static_cast<float>(i));
+  }
+  vtkNew<vtkPolyData> input;
+  input->SetPoints(points);
+  input->GetPointData()->AddArray(values);
+
+  vtkNew<vtkRadiusOutlierRemoval> radius;
+  radius->SetRadius(0.4);
+  radius->SetNumberOfNeighbors(4);
+  if (!CompareTiledAndUntiled(radius, input, "vtkRadiusOutlierRemoval"))
+  {
+    return EXIT_FAILURE;
+  }
+  if (radius->GetNumberOfPointsRemoved() == 0 ||
+    radius->GetNumberOfPointsRemoved() == input->GetNumberOfPoints())
+  {
+    vtkLog(ERROR, "Unexpected number of outliers " << radius->GetNumberOfPointsRemoved());
+    return EXIT_FAILURE;
+  }
+
+  // A halo larger than the tiles
+  radius->SetRadius(3.0);
+  radius->SetNumberOfNeighbors(400);
+  if (!CompareTiledAndUntiled(radius, input, "vtkRadiusOutlierRemoval with a large radius"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkStatisticalOutlierRemoval> statistical;
+  if (!CompareTiledAndUntiled(statistical, input, "vtkStatisticalOutlierRemoval"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
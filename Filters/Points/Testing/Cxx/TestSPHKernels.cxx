@@ -6,6 +6,8 @@
 // + ensuring that the kernel function is symmetric
 // + ensuring that the kernel derivative takes on the correct sign
 //   and value on either side of the central point.
+// + ensuring that the batched evaluation of the kernel matches the
+//   evaluation at a single distance.
 
 #include "vtkSPHCubicKernel.h"
 #include "vtkSPHQuarticKernel.h"
@@ -90,6 +92,26 @@ int TestSPHKernel(vtkSmartPointer<T> kernel, const std::string& description)
     status = EXIT_FAILURE;
   }
 
+  // Batched evaluation
+  const int numDists = 70;
+  double d[numDists], w[numDists], gw[numDists];
+  for (i = 0; i < numDists; ++i)
+  {
+    d[i] = 0.05 * i;
+  }
+  kernel->EvaluateFunctionWeights(numDists, d, w);
+  kernel->EvaluateDerivWeights(numDists, d, gw);
+  for (i = 0; i < numDists; ++i)
+  {
+    if (!vtkMathUtilities::FuzzyCompare(w[i], kernel->ComputeFunctionWeight(d[i]), 1.0e-12) ||
+      !vtkMathUtilities::FuzzyCompare(gw[i], kernel->ComputeDerivWeight(d[i]), 1.0e-12))
+    {
+      std::cout << "SPH " << description << " batched evaluation differs at " << d[i] << std::endl;
+      status = EXIT_FAILURE;
+      break;
+    }
+  }
+
   return status;
 }
 
@@ -3,22 +3,89 @@
 #include "vtkEuclideanClusterExtraction.h"
 
 #include "vtkAbstractPointLocator.h"
+#include "vtkDataArray.h"
 #include "vtkFloatArray.h"
 #include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPointSet.h"
 #include "vtkPoints.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkStaticPointLocator.h"
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkEuclideanClusterExtraction);
 vtkCxxSetObjectMacro(vtkEuclideanClusterExtraction, Locator, vtkAbstractPointLocator);
 
+namespace
+{
+// Lock-free union-find over the point ids. Roots are always linked to the
+// smaller root, so that the root of a cluster is its smallest point id.
+struct PointUnionFind
+{
+  std::unique_ptr<std::atomic<vtkIdType>[]> Parents;
+
+  PointUnionFind(vtkIdType numPts)
+    : Parents(new std::atomic<vtkIdType>[numPts])
+  {
+    vtkSMPTools::For(0, numPts, [this](vtkIdType ptId, vtkIdType endPtId) {
+      for (; ptId < endPtId; ++ptId)
+      {
+        this->Parents[ptId].store(ptId, std::memory_order_relaxed);
+      }
+    });
+  }
+
+  vtkIdType Find(vtkIdType ptId) const
+  {
+    vtkIdType parent = this->Parents[ptId].load(std::memory_order_relaxed);
+    while (parent != ptId)
+    {
+      // Path halving: a stale write only makes the path longer, never wrong
+      vtkIdType grandParent = this->Parents[parent].load(std::memory_order_relaxed);
+      this->Parents[ptId].compare_exchange_weak(parent, grandParent, std::memory_order_relaxed);
+      ptId = parent;
+      parent = this->Parents[ptId].load(std::memory_order_relaxed);
+    }
+    return ptId;
+  }
+
+  void Union(vtkIdType ptId0, vtkIdType ptId1)
+  {
+    for (;;)
+    {
+      ptId0 = this->Find(ptId0);
+      ptId1 = this->Find(ptId1);
+      if (ptId0 == ptId1)
+      {
+        return;
+      }
+      if (ptId0 < ptId1)
+      {
+        std::swap(ptId0, ptId1);
+      }
+      vtkIdType expected = ptId0;
+      if (this->Parents[ptId0].compare_exchange_strong(expected, ptId1))
+      {
+        return;
+      }
+    }
+  }
+};
+}
+
 //------------------------------------------------------------------------------
 // Construct with default extraction mode to extract largest cluster.
 vtkEuclideanClusterExtraction::vtkEuclideanClusterExtraction()
@@ -111,6 +178,13 @@ int vtkEuclideanClusterExtraction::RequestData(vtkInformation* vtkNotUsed(reques
     }
   }
 
+  // The queries of a vtkStaticPointLocator are thread safe once it is built
+  if (vtkStaticPointLocator::SafeDownCast(this->Locator))
+  {
+    this->ExtractClustersInParallel(input, output);
+    return 1;
+  }
+
   // Initialize.  Keep track of the points visited.
   //
   this->Visited = new char[numPts];
@@ -358,6 +432,214 @@ void vtkEuclideanClusterExtraction::TraverseAndMark(vtkPoints* inPts)
   } // while wave is not empty
 }
 
+//------------------------------------------------------------------------------
+// Threaded version of the clustering. Points within Radius of each other are
+// linked with a union-find instead of growing waves. Since points out of the
+// scalar range are never linked, the root of a cluster is its smallest point
+// id, i.e. the point the serial traversal starts the cluster from, so the
+// cluster ids and sizes are the same. Extracted points keep the input order.
+void vtkEuclideanClusterExtraction::ExtractClustersInParallel(
+  vtkPointSet* input, vtkPolyData* output)
+{
+  const vtkIdType numPts = input->GetNumberOfPoints();
+  vtkPoints* inPts = input->GetPoints();
+  vtkPointData* pd = input->GetPointData();
+  vtkPointData* outputPD = output->GetPointData();
+  vtkAbstractPointLocator* locator = this->Locator;
+  const double radius = this->Radius;
+
+  // Points out of the scalar range belong to no cluster
+  std::vector<char> inRange(numPts, 1);
+  if (vtkDataArray* inScalars = this->InScalars)
+  {
+    const double range[2] = { this->ScalarRange[0], this->ScalarRange[1] };
+    vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+      for (; ptId < endPtId; ++ptId)
+      {
+        const double s = inScalars->GetComponent(ptId, 0);
+        inRange[ptId] = (s >= range[0] && s <= range[1]) ? 1 : 0;
+      }
+    });
+  }
+
+  // Link every point to its neighbors. Each pair of neighbors is found from
+  // both of its points, so it is only linked from the smaller one.
+  PointUnionFind unionFind(numPts);
+  vtkSMPThreadLocalObject<vtkIdList> tlNeighbors;
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    vtkIdList* neighbors = tlNeighbors.Local();
+    double x[3];
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    for (; ptId < endPtId; ++ptId)
+    {
+      if (isFirst)
+      {
+        this->CheckAbort();
+      }
+      if (this->GetAbortOutput())
+      {
+        break;
+      }
+      if (!inRange[ptId])
+      {
+        continue;
+      }
+      inPts->GetPoint(ptId, x);
+      locator->FindPointsWithinRadius(radius, x, neighbors);
+      for (vtkIdType i = 0; i < neighbors->GetNumberOfIds(); ++i)
+      {
+        const vtkIdType neiId = neighbors->GetId(i);
+        if (neiId > ptId && inRange[neiId])
+        {
+          unionFind.Union(ptId, neiId);
+        }
+      }
+    }
+  });
+  this->ClusterSizes->Reset();
+  if (this->GetAbortOutput())
+  {
+    return;
+  }
+  this->UpdateProgress(0.5);
+
+  // Number the clusters by increasing root, and store the cluster of every
+  // point in range (-1 for the others).
+  std::vector<vtkIdType> clusterIds(numPts);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    for (; ptId < endPtId; ++ptId)
+    {
+      clusterIds[ptId] = (inRange[ptId] && unionFind.Find(ptId) == ptId) ? 1 : 0;
+    }
+  });
+  const vtkIdType lastIsRoot = clusterIds.back();
+  std::vector<vtkIdType> rootOffsets(numPts);
+  vtkSMPTools::ExclusiveScan(
+    clusterIds.begin(), clusterIds.end(), rootOffsets.begin(), vtkIdType(0));
+  const vtkIdType numClusters = rootOffsets.back() + lastIsRoot;
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    for (; ptId < endPtId; ++ptId)
+    {
+      clusterIds[ptId] = inRange[ptId] ? rootOffsets[unionFind.Find(ptId)] : -1;
+    }
+  });
+  std::vector<vtkIdType> clusterSizes(numClusters, 0);
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    if (clusterIds[ptId] >= 0)
+    {
+      clusterSizes[clusterIds[ptId]]++;
+    }
+  }
+
+  // Select the clusters to extract. Seeded clusters are all reported as
+  // cluster 0, as in the serial traversal.
+  std::vector<char> selected(numClusters, 0);
+  const bool seeded = this->ExtractionMode == VTK_EXTRACT_POINT_SEEDED_CLUSTERS ||
+    this->ExtractionMode == VTK_EXTRACT_CLOSEST_POINT_CLUSTER;
+  if (seeded)
+  {
+    vtkNew<vtkIdList> seeds;
+    if (this->ExtractionMode == VTK_EXTRACT_POINT_SEEDED_CLUSTERS)
+    {
+      seeds->DeepCopy(this->Seeds);
+    }
+    else
+    {
+      seeds->InsertNextId(this->Locator->FindClosestPoint(this->ClosestPoint));
+    }
+    vtkIdType numSeeded = 0;
+    for (vtkIdType i = 0; i < seeds->GetNumberOfIds(); i++)
+    {
+      const vtkIdType ptId = seeds->GetId(i);
+      if (ptId >= 0 && ptId < numPts && clusterIds[ptId] >= 0 && !selected[clusterIds[ptId]])
+      {
+        selected[clusterIds[ptId]] = 1;
+        numSeeded += clusterSizes[clusterIds[ptId]];
+      }
+    }
+    this->ClusterSizes->InsertValue(0, numSeeded);
+  }
+  else
+  {
+    vtkIdType largestClusterId = 0;
+    for (vtkIdType clusterId = 0; clusterId < numClusters; ++clusterId)
+    {
+      this->ClusterSizes->InsertValue(clusterId, clusterSizes[clusterId]);
+      if (clusterSizes[clusterId] > clusterSizes[largestClusterId])
+      {
+        largestClusterId = clusterId;
+      }
+    }
+    if (this->ExtractionMode == VTK_EXTRACT_ALL_CLUSTERS)
+    {
+      std::fill(selected.begin(), selected.end(), 1);
+    }
+    else if (this->ExtractionMode == VTK_EXTRACT_SPECIFIED_CLUSTERS)
+    {
+      for (vtkIdType i = 0; i < this->SpecifiedClusterIds->GetNumberOfIds(); i++)
+      {
+        const vtkIdType clusterId = this->SpecifiedClusterIds->GetId(i);
+        if (clusterId >= 0 && clusterId < numClusters)
+        {
+          selected[clusterId] = 1;
+        }
+      }
+    }
+    else if (numClusters > 0)
+    {
+      selected[largestClusterId] = 1;
+    }
+  }
+  vtkDebugMacro(<< "Extracted " << numClusters << " cluster(s)");
+
+  // Number the extracted points by increasing input id
+  std::vector<vtkIdType> pointMap(numPts);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    for (; ptId < endPtId; ++ptId)
+    {
+      pointMap[ptId] = (clusterIds[ptId] >= 0 && selected[clusterIds[ptId]]) ? 1 : 0;
+    }
+  });
+  const vtkIdType lastSelected = pointMap.back();
+  vtkSMPTools::ExclusiveScan(pointMap.begin(), pointMap.end(), pointMap.begin(), vtkIdType(0));
+  const vtkIdType numNewPts = pointMap.back() + lastSelected;
+
+  vtkNew<vtkPoints> newPts;
+  newPts->SetDataType(inPts->GetDataType());
+  newPts->SetNumberOfPoints(numNewPts);
+  outputPD->CopyAllocate(pd, numNewPts);
+  outputPD->SetNumberOfTuples(numNewPts);
+  vtkNew<vtkIdTypeArray> newScalars;
+  newScalars->SetName("ClusterId");
+  newScalars->SetNumberOfTuples(numNewPts);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    double x[3];
+    for (; ptId < endPtId; ++ptId)
+    {
+      const vtkIdType clusterId = clusterIds[ptId];
+      if (clusterId >= 0 && selected[clusterId])
+      {
+        const vtkIdType newPtId = pointMap[ptId];
+        inPts->GetPoint(ptId, x);
+        newPts->SetPoint(newPtId, x);
+        outputPD->CopyData(pd, ptId, newPtId);
+        newScalars->SetValue(newPtId, seeded ? 0 : clusterId);
+      }
+    }
+  });
+  this->UpdateProgress(0.9);
+
+  // if coloring clusters; send down new scalar data
+  if (this->ColorClusters)
+  {
+    int idx = outputPD->AddArray(newScalars);
+    outputPD->SetActiveAttribute(idx, vtkDataSetAttributes::SCALARS);
+  }
+  output->SetPoints(newPts);
+  vtkDebugMacro(<< "Extracted " << numNewPts << " points");
+}
+
 //------------------------------------------------------------------------------
 // Obtain the number of connected clusters.
 int vtkEuclideanClusterExtraction::GetNumberOfExtractedClusters()
@@ -32,6 +32,13 @@
  * example, by using a seed point in a known cluster, clustering will pull
  * out all points "representing" the local structure.
  *
+ * When the locator is a vtkStaticPointLocator (the default), whose queries
+ * are thread safe, the clusters are computed in parallel with vtkSMPTools:
+ * every point is linked to its neighbors within Radius by a lock-free
+ * union-find, and the clusters are numbered by their smallest point id as
+ * in the serial traversal. The extracted points are then ordered by
+ * increasing input point id. Other locators use the serial traversal.
+ *
  * @sa
  * vtkConnectivityFilter vtkPolyDataConnectivityFilter
  */
@@ -54,6 +61,7 @@ class vtkFloatArray;
 class vtkIdList;
 class vtkIdTypeArray;
 class vtkAbstractPointLocator;
+class vtkPointSet;
 
 class VTKFILTERSPOINTS_EXPORT vtkEuclideanClusterExtraction : public vtkPolyDataAlgorithm
 {
@@ -207,6 +215,9 @@ protected:
   void InsertIntoWave(vtkIdList* wave, vtkIdType ptId);
   void TraverseAndMark(vtkPoints* pts);
 
+  // Threaded clustering used with a vtkStaticPointLocator.
+  void ExtractClustersInParallel(vtkPointSet* input, vtkPolyData* output);
+
 private:
   vtkEuclideanClusterExtraction(const vtkEuclideanClusterExtraction&) = delete;
   void operator=(const vtkEuclideanClusterExtraction&) = delete;
@@ -37,17 +37,18 @@ vtkIdType vtkGaussianKernel::ComputeWeights(
   double x[3], vtkIdList* pIds, vtkDoubleArray* prob, vtkDoubleArray* weights)
 {
   vtkIdType numPts = pIds->GetNumberOfIds();
-  double d2, y[3], sum = 0.0;
+  double d2, sum = 0.0;
   weights->SetNumberOfTuples(numPts);
   double* p = (prob ? prob->GetPointer(0) : nullptr);
   double* w = weights->GetPointer(0);
   double f2 = this->F2;
 
+  // The squared distances are replaced by the weights
+  this->ComputeDistance2(x, numPts, pIds->GetPointer(0), w);
   for (vtkIdType i = 0; i < numPts; ++i)
   {
     vtkIdType id = pIds->GetId(i);
-    this->DataSet->GetPoint(id, y);
-    d2 = vtkMath::Distance2BetweenPoints(x, y);
+    d2 = w[i];
 
     if (vtkMathUtilities::FuzzyCompare(
           d2, 0.0, std::numeric_limits<double>::epsilon() * 256.0)) // precise hit on existing point
@@ -3,10 +3,34 @@
 #include "vtkInterpolationKernel.h"
 #include "vtkAbstractPointLocator.h"
 #include "vtkDataSet.h"
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkMath.h"
 #include "vtkPointData.h"
+#include "vtkPointSet.h"
+#include "vtkPoints.h"
 
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+// Squared distances to points stored in a float or double array
+template <typename T>
+void PointsDistance2(
+  const T* pts, const double x[3], vtkIdType numPts, const vtkIdType* ids, double* d2)
+{
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    const T* y = pts + 3 * ids[i];
+    const double dx = x[0] - static_cast<double>(y[0]);
+    const double dy = x[1] - static_cast<double>(y[1]);
+    const double dz = x[2] - static_cast<double>(y[2]);
+    d2[i] = dx * dx + dy * dy + dz * dz;
+  }
+}
+}
+
+//------------------------------------------------------------------------------
 vtkInterpolationKernel::vtkInterpolationKernel()
 {
   this->RequiresInitialization = true;
@@ -14,6 +38,7 @@ vtkInterpolationKernel::vtkInterpolationKernel()
   this->Locator = nullptr;
   this->DataSet = nullptr;
   this->PointData = nullptr;
+  this->PointsData = nullptr;
 }
 
 //------------------------------------------------------------------------------
@@ -42,6 +67,8 @@ void vtkInterpolationKernel::FreeStructures()
     this->PointData->Delete();
     this->PointData = nullptr;
   }
+
+  this->PointsData = nullptr;
 }
 
 //------------------------------------------------------------------------------
@@ -67,6 +94,35 @@ void vtkInterpolationKernel::Initialize(
     this->PointData = attr;
     this->PointData->Register(this);
   }
+
+  vtkPointSet* ps = vtkPointSet::SafeDownCast(ds);
+  if (ps && ps->GetPoints())
+  {
+    this->PointsData = ps->GetPoints()->GetData();
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkInterpolationKernel::ComputeDistance2(
+  const double x[3], vtkIdType numPts, const vtkIdType* ids, double* d2)
+{
+  if (vtkFloatArray* floatPts = vtkFloatArray::FastDownCast(this->PointsData))
+  {
+    PointsDistance2(floatPts->GetPointer(0), x, numPts, ids, d2);
+  }
+  else if (vtkDoubleArray* doublePts = vtkDoubleArray::FastDownCast(this->PointsData))
+  {
+    PointsDistance2(doublePts->GetPointer(0), x, numPts, ids, d2);
+  }
+  else
+  {
+    double y[3];
+    for (vtkIdType i = 0; i < numPts; ++i)
+    {
+      this->DataSet->GetPoint(ids[i], y);
+      d2[i] = vtkMath::Distance2BetweenPoints(x, y);
+    }
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -45,6 +45,7 @@
 VTK_ABI_NAMESPACE_BEGIN
 class vtkAbstractPointLocator;
 class vtkIdList;
+class vtkDataArray;
 class vtkDoubleArray;
 class vtkDataSet;
 class vtkPointData;
@@ -115,6 +116,14 @@ protected:
   vtkDataSet* DataSet;
   vtkPointData* PointData;
 
+  // The coordinates of the points when DataSet is a vtkPointSet, used to
+  // compute distances without a virtual call per point.
+  vtkDataArray* PointsData;
+
+  // Compute the squared distances d2 between x and the numPts points ids of
+  // DataSet.
+  void ComputeDistance2(const double x[3], vtkIdType numPts, const vtkIdType* ids, double* d2);
+
   // Just clear out the data. Can be overloaded by subclasses as necessary.
   virtual void FreeStructures();
 
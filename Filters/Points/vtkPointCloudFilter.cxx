@@ -7,9 +7,11 @@
 #include "vtkArrayListTemplate.h" // For processing attribute data
 #include "vtkDataArray.h"
 #include "vtkDataArrayRange.h"
+#include "vtkIdList.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPointSet.h"
@@ -19,6 +21,10 @@
 #include "vtkStaticPointLocator.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 //------------------------------------------------------------------------------
 // Helper classes to support efficient computing, and threaded execution.
 VTK_ABI_NAMESPACE_BEGIN
@@ -93,6 +99,7 @@ vtkPointCloudFilter::vtkPointCloudFilter()
   this->NumberOfPointsRemoved = 0;
   this->GenerateOutliers = false;
   this->GenerateVertices = false;
+  this->NumberOfTiles[0] = this->NumberOfTiles[1] = this->NumberOfTiles[2] = 1;
 
   // Optional second output of outliers
   this->SetNumberOfOutputPorts(2);
@@ -152,7 +159,7 @@ int vtkPointCloudFilter::RequestData(vtkInformation* vtkNotUsed(request),
 
   // Okay invoke filtering operation. This is always the initial pass.
   this->PointMap = new vtkIdType[numPts];
-  if (!this->FilterPoints(input))
+  if (!this->FilterPointsInTiles(input))
   {
     return 1;
   }
@@ -257,6 +264,138 @@ int vtkPointCloudFilter::RequestData(vtkInformation* vtkNotUsed(request),
   return 1;
 }
 
+//------------------------------------------------------------------------------
+// The points are binned into the tiles, then every tile is filtered with
+// the points of the tiles within the halo width around it. Only the result
+// at the points of the tile itself is kept.
+int vtkPointCloudFilter::FilterPointsInTiles(vtkPointSet* input)
+{
+  const double halo = this->GetTileHaloWidth();
+  int numTiles[3] = { std::max(this->NumberOfTiles[0], 1), std::max(this->NumberOfTiles[1], 1),
+    std::max(this->NumberOfTiles[2], 1) };
+  if (halo < 0.0 || numTiles[0] * numTiles[1] * numTiles[2] == 1)
+  {
+    return this->FilterPoints(input);
+  }
+
+  const vtkIdType numPts = input->GetNumberOfPoints();
+  vtkPoints* inPts = input->GetPoints();
+  double bounds[6], h[3];
+  int haloTiles[3];
+  input->GetBounds(bounds);
+  for (int i = 0; i < 3; ++i)
+  {
+    const double length = bounds[2 * i + 1] - bounds[2 * i];
+    if (length <= 0.0)
+    {
+      numTiles[i] = 1;
+    }
+    h[i] = length > 0.0 ? length / numTiles[i] : 1.0;
+    haloTiles[i] = static_cast<int>(std::ceil(halo / h[i]));
+  }
+  const vtkIdType totalTiles = static_cast<vtkIdType>(numTiles[0]) * numTiles[1] * numTiles[2];
+
+  // Bin the points into the tiles, keeping them sorted by id in every tile
+  std::vector<vtkIdType> pointTiles(numPts);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType ptId, vtkIdType endPtId) {
+    double x[3];
+    for (; ptId < endPtId; ++ptId)
+    {
+      inPts->GetPoint(ptId, x);
+      vtkIdType tileId = 0;
+      for (int i = 2; i >= 0; --i)
+      {
+        const int ijk = static_cast<int>((x[i] - bounds[2 * i]) / h[i]);
+        tileId = tileId * numTiles[i] + std::min(std::max(ijk, 0), numTiles[i] - 1);
+      }
+      pointTiles[ptId] = tileId;
+    }
+  });
+  std::vector<vtkIdType> tileOffsets(totalTiles + 1, 0);
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    tileOffsets[pointTiles[ptId] + 1]++;
+  }
+  for (vtkIdType tileId = 0; tileId < totalTiles; ++tileId)
+  {
+    tileOffsets[tileId + 1] += tileOffsets[tileId];
+  }
+  std::vector<vtkIdType> tilePoints(numPts);
+  {
+    std::vector<vtkIdType> insert(tileOffsets.begin(), tileOffsets.end() - 1);
+    for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+    {
+      tilePoints[insert[pointTiles[ptId]]++] = ptId;
+    }
+  }
+
+  // Filter the tiles one after another. The point map of a tile is
+  // temporarily used as the point map of the filter.
+  vtkIdType* pointMap = this->PointMap;
+  vtkNew<vtkIdList> ptIds;
+  vtkNew<vtkPolyData> tile;
+  int status = 1;
+  for (vtkIdType tileId = 0; tileId < totalTiles && status; ++tileId)
+  {
+    if (tileOffsets[tileId] == tileOffsets[tileId + 1])
+    {
+      continue;
+    }
+    if (this->CheckAbort())
+    {
+      break;
+    }
+    const int ijk[3] = { static_cast<int>(tileId % numTiles[0]),
+      static_cast<int>((tileId / numTiles[0]) % numTiles[1]),
+      static_cast<int>(tileId / numTiles[0] / numTiles[1]) };
+    ptIds->Reset();
+    for (int k = std::max(ijk[2] - haloTiles[2], 0);
+         k <= std::min(ijk[2] + haloTiles[2], numTiles[2] - 1); ++k)
+    {
+      for (int j = std::max(ijk[1] - haloTiles[1], 0);
+           j <= std::min(ijk[1] + haloTiles[1], numTiles[1] - 1); ++j)
+      {
+        for (int i = std::max(ijk[0] - haloTiles[0], 0);
+             i <= std::min(ijk[0] + haloTiles[0], numTiles[0] - 1); ++i)
+        {
+          const vtkIdType neiId = i + numTiles[0] * (j + static_cast<vtkIdType>(numTiles[1]) * k);
+          for (vtkIdType idx = tileOffsets[neiId]; idx < tileOffsets[neiId + 1]; ++idx)
+          {
+            ptIds->InsertNextId(tilePoints[idx]);
+          }
+        }
+      }
+    }
+    // Keep the input order of the points
+    vtkIdType* ids = ptIds->GetPointer(0);
+    vtkSMPTools::Sort(ids, ids + ptIds->GetNumberOfIds());
+
+    vtkNew<vtkPoints> points;
+    points->SetDataType(inPts->GetDataType());
+    inPts->GetPoints(ptIds, points);
+    tile->Initialize();
+    tile->SetPoints(points);
+
+    const vtkIdType numTilePts = ptIds->GetNumberOfIds();
+    this->PointMap = new vtkIdType[numTilePts];
+    status = this->FilterPoints(tile);
+    if (status)
+    {
+      for (vtkIdType idx = 0; idx < numTilePts; ++idx)
+      {
+        if (pointTiles[ids[idx]] == tileId)
+        {
+          pointMap[ids[idx]] = this->PointMap[idx] == -1 ? -1 : 1;
+        }
+      }
+    }
+    delete[] this->PointMap;
+    this->PointMap = pointMap;
+    this->UpdateProgress(static_cast<double>(tileOffsets[tileId + 1]) / numPts);
+  }
+  return status && !this->GetAbortOutput();
+}
+
 //------------------------------------------------------------------------------
 void vtkPointCloudFilter::GenerateVerticesIfRequested(vtkPolyData* output)
 {
@@ -298,5 +437,8 @@ void vtkPointCloudFilter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Generate Outliers: " << (this->GenerateOutliers ? "On\n" : "Off\n");
 
   os << indent << "Generate Vertices: " << (this->GenerateVertices ? "On\n" : "Off\n");
+
+  os << indent << "Number of Tiles: (" << this->NumberOfTiles[0] << ", " << this->NumberOfTiles[1]
+     << ", " << this->NumberOfTiles[2] << ")\n";
 }
 VTK_ABI_NAMESPACE_END
@@ -35,6 +35,15 @@
  * with the filtering operation.
  *
  * @warning
+ * Filters whose result at a point only depends on the points within a
+ * bounded distance (e.g., vtkRadiusOutlierRemoval) support a tiled
+ * execution, enabled with NumberOfTiles. The bounding box of the input is
+ * then split into tiles, which are filtered one after another together with
+ * a halo of the neighboring points, so that the locator and the other work
+ * structures only hold a tile at a time. The result is the same as the one
+ * of the untiled execution.
+ *
+ * @warning
  * It is convenient to use vtkPointGaussianMapper to render the points (since
  * this mapper does not require cells to be defined, and it is quite fast).
  *
@@ -104,6 +113,19 @@ public:
   vtkBooleanMacro(GenerateVertices, bool);
   ///@}
 
+  ///@{
+  /**
+   * Specify the number of tiles in the x-y-z directions used to split the
+   * input bounding box for a tiled execution. Each tile is filtered
+   * separately with the points around it, which bounds the memory used by
+   * the point locator and the work arrays of the filter. Tiling is only
+   * used by the filters that support it (see GetTileHaloWidth()), and is
+   * disabled by default (one tile).
+   */
+  vtkSetVector3Macro(NumberOfTiles, int);
+  vtkGetVector3Macro(NumberOfTiles, int);
+  ///@}
+
 protected:
   vtkPointCloudFilter();
   ~vtkPointCloudFilter() override;
@@ -122,11 +144,24 @@ protected:
   // Should output vertex cells be created?
   bool GenerateVertices;
 
+  // Tiled execution
+  int NumberOfTiles[3];
+
+  // Derived classes supporting the tiled execution return the distance
+  // around a tile within which the points affect the result at the points
+  // of the tile. FilterPoints() is then invoked on each tile with its halo
+  // (points only, without attributes). A negative value (the default)
+  // disables tiling.
+  virtual double GetTileHaloWidth() { return -1.0; }
+
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
   int FillInputPortInformation(int port, vtkInformation* info) override;
 
   void GenerateVerticesIfRequested(vtkPolyData* output);
 
+  // Run FilterPoints() on the whole input, or tile by tile.
+  int FilterPointsInTiles(vtkPointSet* input);
+
 private:
   vtkPointCloudFilter(const vtkPointCloudFilter&) = delete;
   void operator=(const vtkPointCloudFilter&) = delete;
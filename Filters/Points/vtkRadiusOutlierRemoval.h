@@ -24,6 +24,10 @@
  * superclass documentation for accessing the removed points through the
  * filter's second output.)
  *
+ * Since only the points within Radius of a point decide whether it is
+ * removed, the filter supports the tiled execution of vtkPointCloudFilter
+ * (see SetNumberOfTiles()), the halo of the tiles being the Radius.
+ *
  * @warning
  * This class has been threaded with vtkSMPTools. Using TBB or other
  * non-sequential type (set in the CMake variable
@@ -92,6 +96,8 @@ protected:
   int NumberOfNeighbors;
   vtkAbstractPointLocator* Locator;
 
+  double GetTileHaloWidth() override { return this->Radius; }
+
   // All derived classes must implement this method. Note that a side effect of
   // the class is to populate the PointMap. Zero is returned if there is a failure.
   int FilterPoints(vtkPointSet* input) override;
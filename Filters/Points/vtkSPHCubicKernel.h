@@ -76,6 +76,27 @@ public:
   }
   ///@}
 
+  ///@{
+  /**
+   * Batched evaluation of the weighting factors, inlining the single
+   * distance methods.
+   */
+  void EvaluateFunctionWeights(vtkIdType n, const double* d, double* w) override
+  {
+    for (vtkIdType i = 0; i < n; ++i)
+    {
+      w[i] = this->vtkSPHCubicKernel::ComputeFunctionWeight(d[i]);
+    }
+  }
+  void EvaluateDerivWeights(vtkIdType n, const double* d, double* w) override
+  {
+    for (vtkIdType i = 0; i < n; ++i)
+    {
+      w[i] = this->vtkSPHCubicKernel::ComputeDerivWeight(d[i]);
+    }
+  }
+  ///@}
+
 protected:
   vtkSPHCubicKernel();
   ~vtkSPHCubicKernel() override;
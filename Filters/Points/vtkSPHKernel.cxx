@@ -76,38 +76,39 @@ vtkIdType vtkSPHKernel::ComputeBasis(double x[3], vtkIdList* pIds, vtkIdType ptI
 }
 
 //------------------------------------------------------------------------------
+// The distances to all the basis points are computed first, then the kernel
+// is evaluated over all of them at once.
 vtkIdType vtkSPHKernel::ComputeWeights(double x[3], vtkIdList* pIds, vtkDoubleArray* weights)
 {
   vtkIdType numPts = pIds->GetNumberOfIds();
-  int i;
-  vtkIdType id;
-  double d, y[3];
+  const vtkIdType* ids = pIds->GetPointer(0);
   weights->SetNumberOfTuples(numPts);
   double* w = weights->GetPointer(0);
-  double KW, mass, density, volume;
 
-  // Compute SPH coefficients.
-  for (i = 0; i < numPts; ++i)
+  // Normalized distances, turned into SPH coefficients in place
+  this->ComputeDistance2(x, numPts, ids, w);
+  for (vtkIdType i = 0; i < numPts; ++i)
   {
-    id = pIds->GetId(i);
-    this->DataSet->GetPoint(id, y);
-    d = sqrt(vtkMath::Distance2BetweenPoints(x, y));
-
-    KW = this->ComputeFunctionWeight(d * this->DistNorm);
+    w[i] = sqrt(w[i]) * this->DistNorm;
+  }
+  this->EvaluateFunctionWeights(numPts, w, w);
 
-    if (this->UseArraysForVolume)
+  if (this->UseArraysForVolume)
+  {
+    for (vtkIdType i = 0; i < numPts; ++i)
     {
-      this->MassArray->GetTuple(id, &mass);
-      this->DensityArray->GetTuple(id, &density);
-      volume = mass / density;
+      const double mass = this->MassArray->GetComponent(ids[i], 0);
+      const double density = this->DensityArray->GetComponent(ids[i], 0);
+      w[i] = this->NormFactor * w[i] * (mass / density);
     }
-    else
+  }
+  else
+  {
+    for (vtkIdType i = 0; i < numPts; ++i)
     {
-      volume = this->DefaultVolume;
+      w[i] = this->NormFactor * w[i] * this->DefaultVolume;
     }
-
-    w[i] = this->NormFactor * KW * volume;
-  } // over all neighbor points
+  }
 
   return numPts;
 }
@@ -117,30 +118,46 @@ vtkIdType vtkSPHKernel::ComputeDerivWeights(
   double x[3], vtkIdList* pIds, vtkDoubleArray* weights, vtkDoubleArray* gradWeights)
 {
   vtkIdType numPts = pIds->GetNumberOfIds();
-  int i;
-  vtkIdType id;
-  double d, y[3];
   weights->SetNumberOfTuples(numPts);
   double* w = weights->GetPointer(0);
   gradWeights->SetNumberOfTuples(numPts);
   double* gw = gradWeights->GetPointer(0);
-  double KW, GW, volume = this->DefaultVolume;
+  double volume = this->DefaultVolume;
 
-  // Compute SPH coefficients for data and deriative data
-  for (i = 0; i < numPts; ++i)
+  // Compute SPH coefficients for data and deriative data. The normalized
+  // distances are kept in the derivative weights until they are evaluated.
+  this->ComputeDistance2(x, numPts, pIds->GetPointer(0), gw);
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    gw[i] = sqrt(gw[i]) * this->DistNorm;
+  }
+  this->EvaluateFunctionWeights(numPts, gw, w);
+  this->EvaluateDerivWeights(numPts, gw, gw);
+  for (vtkIdType i = 0; i < numPts; ++i)
   {
-    id = pIds->GetId(i);
-    this->DataSet->GetPoint(id, y);
-    d = sqrt(vtkMath::Distance2BetweenPoints(x, y));
+    w[i] = this->NormFactor * w[i] * volume;
+    gw[i] = this->NormFactor * gw[i] * volume;
+  }
 
-    KW = this->ComputeFunctionWeight(d * this->DistNorm);
-    GW = this->ComputeDerivWeight(d * this->DistNorm);
+  return numPts;
+}
 
-    w[i] = this->NormFactor * KW * volume;
-    gw[i] = this->NormFactor * GW * volume;
-  } // over all neighbor points
+//------------------------------------------------------------------------------
+void vtkSPHKernel::EvaluateFunctionWeights(vtkIdType n, const double* d, double* w)
+{
+  for (vtkIdType i = 0; i < n; ++i)
+  {
+    w[i] = this->ComputeFunctionWeight(d[i]);
+  }
+}
 
-  return numPts;
+//------------------------------------------------------------------------------
+void vtkSPHKernel::EvaluateDerivWeights(vtkIdType n, const double* d, double* w)
+{
+  for (vtkIdType i = 0; i < n; ++i)
+  {
+    w[i] = this->ComputeDerivWeight(d[i]);
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -157,6 +157,19 @@ public:
    */
   virtual double ComputeDerivWeight(double d) = 0;
 
+  ///@{
+  /**
+   * Batched versions of ComputeFunctionWeight() and ComputeDerivWeight():
+   * evaluate the weighting factors w of n normalized distances d (w and d
+   * may be the same array). By default these methods invoke the single
+   * distance methods; the kernels override them with a loop over inlined
+   * evaluations the compiler can vectorize. ComputeWeights() and
+   * ComputeDerivWeights() evaluate the whole basis with these methods.
+   */
+  virtual void EvaluateFunctionWeights(vtkIdType n, const double* d, double* w);
+  virtual void EvaluateDerivWeights(vtkIdType n, const double* d, double* w);
+  ///@}
+
   ///@{
   /**
    * Return the SPH normalization factor. This also includes the contribution
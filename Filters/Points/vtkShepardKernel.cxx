@@ -27,22 +27,23 @@ vtkIdType vtkShepardKernel::ComputeWeights(
   double x[3], vtkIdList* pIds, vtkDoubleArray* prob, vtkDoubleArray* weights)
 {
   vtkIdType numPts = pIds->GetNumberOfIds();
-  double d, y[3], sum = 0.0;
+  double d, sum = 0.0;
   weights->SetNumberOfTuples(numPts);
   double* p = (prob ? prob->GetPointer(0) : nullptr);
   double* w = weights->GetPointer(0);
 
+  // The squared distances are replaced by the weights
+  this->ComputeDistance2(x, numPts, pIds->GetPointer(0), w);
   for (vtkIdType i = 0; i < numPts; ++i)
   {
     vtkIdType id = pIds->GetId(i);
-    this->DataSet->GetPoint(id, y);
     if (this->PowerParameter == 2.0)
     {
-      d = vtkMath::Distance2BetweenPoints(x, y);
+      d = w[i];
     }
     else
     {
-      d = pow(sqrt(vtkMath::Distance2BetweenPoints(x, y)), this->PowerParameter);
+      d = pow(sqrt(w[i]), this->PowerParameter);
     }
     if (vtkMathUtilities::FuzzyCompare(
           d, 0.0, std::numeric_limits<double>::epsilon() * 256.0)) // precise hit on existing point
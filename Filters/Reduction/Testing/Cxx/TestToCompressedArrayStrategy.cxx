@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkToCompressedArrayStrategy.h"
+
+#include "vtkCompressedImplicitBackend.h"
+#include "vtkDataArrayRange.h"
+#include "vtkDoubleArray.h"
+#include "vtkImplicitArray.h"
+#include "vtkIntArray.h"
+#include "vtkSMPTools.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+constexpr vtkIdType NB_TUPLES = 10000;
+
+bool TestLossless()
+{
+  vtkNew<vtkIntArray> base;
+  base->SetNumberOfComponents(3);
+  base->SetNumberOfTuples(NB_TUPLES);
+  auto range = vtk::DataArrayValueRange<3>(base);
+  for (vtkIdType iVal = 0; iVal < range.size(); ++iVal)
+  {
+    range[iVal] = static_cast<int>(iVal % 97) - 40;
+  }
+
+  vtkNew<vtkToCompressedArrayStrategy> strat;
+  strat->SetBlockSize(1000);
+  strat->SetCacheSize(2);
+  auto opt = strat->EstimateReduction(base);
+  if (!opt.IsSome || opt.Value >= 1.0)
+  {
+    std::cout << "Could not compress a periodic int array" << std::endl;
+    return false;
+  }
+
+  vtkSmartPointer<vtkDataArray> arr = strat->Reduce(base);
+  using CompressedArray = vtkImplicitArray<vtkCompressedImplicitBackend<int>>;
+  CompressedArray* compressed = vtkArrayDownCast<CompressedArray>(arr);
+  if (!compressed || compressed->GetBackend()->GetCodec() != vtkCompressedImplicitBackend<int>::LZ4)
+  {
+    std::cout << "Reduced array is not an LZ4 compressed array" << std::endl;
+    return false;
+  }
+  if (compressed->GetNumberOfComponents() != 3 || compressed->GetNumberOfTuples() != NB_TUPLES)
+  {
+    std::cout << "Reduced array does not have the shape of the original array" << std::endl;
+    return false;
+  }
+
+  // read the values in parallel and out of order to exercise the block cache
+  std::atomic<bool> success(true);
+  vtkSMPTools::For(0, NB_TUPLES, [&](vtkIdType begin, vtkIdType end) {
+    int tuple[3];
+    for (vtkIdType iTup = end - 1; iTup >= begin; --iTup)
+    {
+      compressed->GetTypedTuple(iTup, tuple);
+      for (int iComp = 0; iComp < 3; ++iComp)
+      {
+        if (tuple[iComp] != range[iTup * 3 + iComp] ||
+          compressed->GetValue(iTup * 3 + iComp) != range[iTup * 3 + iComp])
+        {
+          success = false;
+        }
+      }
+    }
+  });
+  if (!success)
+  {
+    std::cout << "LZ4 compressed values differ from the original values" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool TestLossy()
+{
+  vtkNew<vtkDoubleArray> base;
+  base->SetNumberOfTuples(NB_TUPLES);
+  auto range = vtk::DataArrayValueRange<1>(base);
+  for (vtkIdType iVal = 0; iVal < range.size(); ++iVal)
+  {
+    range[iVal] = std::sin(0.01 * iVal);
+  }
+
+  vtkNew<vtkToCompressedArrayStrategy> strat;
+  strat->SetZFPRate(16.0);
+  auto opt = strat->EstimateReduction(base);
+  if (!opt.IsSome || opt.Value > 0.3)
+  {
+    std::cout << "ZFP at 16 bits per value should reduce doubles to a quarter of their size, got "
+              << (opt.IsSome ? opt.Value : 1.0) << std::endl;
+    return false;
+  }
+
+  vtkSmartPointer<vtkDataArray> arr = strat->Reduce(base);
+  using CompressedArray = vtkImplicitArray<vtkCompressedImplicitBackend<double>>;
+  CompressedArray* compressed = vtkArrayDownCast<CompressedArray>(arr);
+  if (!compressed ||
+    compressed->GetBackend()->GetCodec() != vtkCompressedImplicitBackend<double>::ZFP)
+  {
+    std::cout << "Reduced array is not a ZFP compressed array" << std::endl;
+    return false;
+  }
+  for (vtkIdType iVal = 0; iVal < range.size(); ++iVal)
+  {
+    if (std::abs(compressed->GetValue(iVal) - range[iVal]) > 1e-3)
+    {
+      std::cout << "ZFP compressed value " << compressed->GetValue(iVal)
+                << " too far from the original value " << range[iVal] << std::endl;
+      return false;
+    }
+  }
+
+  strat->LosslessOn();
+  arr = strat->Reduce(base);
+  if (!arr || arr->GetComponent(1234, 0) != range[1234])
+  {
+    std::cout << "Lossless compression of doubles should preserve the values" << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestToCompressedArrayStrategy(int, char*[])
+{
+  if (!::TestLossless() || !::TestLossy())
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
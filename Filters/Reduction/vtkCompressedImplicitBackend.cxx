@@ -0,0 +1,361 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCompressedImplicitBackend.h"
+
+#include "vtkArrayDispatch.h"
+#include "vtkDataArray.h"
+#include "vtkDataArrayRange.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
+#include "vtkSetGet.h"
+
+// clang-format off
+#include "vtk_lz4.h"
+#include "vtk_zfp.h"
+// clang-format on
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+//-----------------------------------------------------------------------
+// Value types supported by ZFP
+template <typename ValueType>
+struct ZFPTraits
+{
+  static constexpr bool Supported = false;
+  static zfp_type Type() { return zfp_type_none; }
+};
+
+template <>
+struct ZFPTraits<float>
+{
+  static constexpr bool Supported = true;
+  static zfp_type Type() { return zfp_type_float; }
+};
+
+template <>
+struct ZFPTraits<double>
+{
+  static constexpr bool Supported = true;
+  static zfp_type Type() { return zfp_type_double; }
+};
+
+// Keep the size of the uncompressed blocks within the range of LZ4
+constexpr vtkIdType MaximumBlockSize = 1 << 20;
+}
+
+VTK_ABI_NAMESPACE_BEGIN
+//-----------------------------------------------------------------------
+template <typename ValueType>
+struct vtkCompressedImplicitBackend<ValueType>::Internals
+{
+  using Block = std::vector<ValueType>;
+  using BlockPointer = std::shared_ptr<const Block>;
+
+  /*
+   * A compressed block, stored as is when compressing does not reduce its size
+   */
+  struct CompressedBlock
+  {
+    std::vector<unsigned char> Data;
+    bool Raw = false;
+  };
+
+  /*
+   * The last block read by a thread
+   */
+  struct LastBlock
+  {
+    vtkIdType Index = -1;
+    BlockPointer Values;
+  };
+
+  /*
+   * Copy and compress the blocks of the array in parallel
+   */
+  struct CompressWorker
+  {
+    template <typename ArrayT>
+    void operator()(ArrayT* array, Internals* self)
+    {
+      auto range = vtk::DataArrayValueRange(array);
+      const vtkIdType nBlocks = static_cast<vtkIdType>(self->Blocks.size());
+      vtkSMPTools::For(0, nBlocks, [&](vtkIdType begin, vtkIdType end) {
+        Block values;
+        for (vtkIdType iBlock = begin; iBlock < end; ++iBlock)
+        {
+          const vtkIdType first = iBlock * self->BlockSize;
+          values.resize(static_cast<std::size_t>(self->GetBlockSize(iBlock)));
+          for (std::size_t iVal = 0; iVal < values.size(); ++iVal)
+          {
+            values[iVal] = static_cast<ValueType>(range[first + iVal]);
+          }
+          self->Compress(values, self->Blocks[iBlock]);
+        }
+      });
+    }
+  };
+
+  Internals(vtkDataArray* array, int codec, double rate, vtkIdType blockSize, int cacheSize)
+    : NumberOfComponents(std::max(array->GetNumberOfComponents(), 1))
+    , NumberOfValues(array->GetNumberOfValues())
+    , Codec(ZFPTraits<ValueType>::Supported ? codec : vtkCompressedImplicitBackend::LZ4)
+    , Rate(rate)
+    , CacheSize(std::max(cacheSize, 1))
+  {
+    // blocks hold whole tuples so that mapTuple decompresses a single block
+    blockSize = std::min(std::max(blockSize, vtkIdType(1)), ::MaximumBlockSize);
+    this->BlockSize = std::max(blockSize / this->NumberOfComponents, vtkIdType(1)) *
+      this->NumberOfComponents;
+    this->Blocks.resize((this->NumberOfValues + this->BlockSize - 1) / this->BlockSize);
+
+    CompressWorker worker;
+    if (!vtkArrayDispatch::DispatchByArray<vtkArrayDispatch::AllArrays>::Execute(
+          array, worker, this))
+    {
+      worker(array, this);
+    }
+  }
+
+  vtkIdType GetBlockSize(vtkIdType iBlock) const
+  {
+    return std::min(this->BlockSize, this->NumberOfValues - iBlock * this->BlockSize);
+  }
+
+  void Compress(const Block& values, CompressedBlock& block) const
+  {
+    const std::size_t rawSize = values.size() * sizeof(ValueType);
+    std::vector<unsigned char>& data = block.Data;
+    std::size_t size = 0;
+    if (this->Codec == vtkCompressedImplicitBackend::ZFP)
+    {
+      zfp_type type = ZFPTraits<ValueType>::Type();
+      zfp_field* field = zfp_field_1d(const_cast<ValueType*>(values.data()), type,
+        static_cast<unsigned int>(values.size()));
+      zfp_stream* zfp = zfp_stream_open(nullptr);
+      zfp_stream_set_rate(zfp, this->Rate, type, 1, 0);
+      data.resize(zfp_stream_maximum_size(zfp, field));
+      bitstream* stream = stream_open(data.data(), data.size());
+      zfp_stream_set_bit_stream(zfp, stream);
+      zfp_stream_rewind(zfp);
+      size = zfp_compress(zfp, field);
+      stream_close(stream);
+      zfp_stream_close(zfp);
+      zfp_field_free(field);
+    }
+    else
+    {
+      const int bound = LZ4_compressBound(static_cast<int>(rawSize));
+      data.resize(static_cast<std::size_t>(bound));
+      const int compressed =
+        LZ4_compress_default(reinterpret_cast<const char*>(values.data()),
+          reinterpret_cast<char*>(data.data()), static_cast<int>(rawSize), bound);
+      size = compressed > 0 ? static_cast<std::size_t>(compressed) : 0;
+    }
+
+    // ZFP is lossy so its blocks are always kept, even when larger than the raw values
+    block.Raw = size == 0 ||
+      (this->Codec != vtkCompressedImplicitBackend::ZFP && size >= rawSize);
+    if (block.Raw)
+    {
+      data.resize(rawSize);
+      std::memcpy(data.data(), values.data(), rawSize);
+    }
+    else
+    {
+      data.resize(size);
+    }
+    data.shrink_to_fit();
+  }
+
+  void Decompress(vtkIdType iBlock, Block& values) const
+  {
+    const CompressedBlock& block = this->Blocks[iBlock];
+    values.resize(static_cast<std::size_t>(this->GetBlockSize(iBlock)));
+    const std::size_t rawSize = values.size() * sizeof(ValueType);
+    if (block.Raw)
+    {
+      std::memcpy(values.data(), block.Data.data(), rawSize);
+      return;
+    }
+
+    bool success = false;
+    if (this->Codec == vtkCompressedImplicitBackend::ZFP)
+    {
+      zfp_type type = ZFPTraits<ValueType>::Type();
+      zfp_field* field =
+        zfp_field_1d(values.data(), type, static_cast<unsigned int>(values.size()));
+      zfp_stream* zfp = zfp_stream_open(nullptr);
+      zfp_stream_set_rate(zfp, this->Rate, type, 1, 0);
+      bitstream* stream =
+        stream_open(const_cast<unsigned char*>(block.Data.data()), block.Data.size());
+      zfp_stream_set_bit_stream(zfp, stream);
+      zfp_stream_rewind(zfp);
+      success = zfp_decompress(zfp, field) != 0;
+      stream_close(stream);
+      zfp_stream_close(zfp);
+      zfp_field_free(field);
+    }
+    else
+    {
+      success = LZ4_decompress_safe(reinterpret_cast<const char*>(block.Data.data()),
+                  reinterpret_cast<char*>(values.data()), static_cast<int>(block.Data.size()),
+                  static_cast<int>(rawSize)) == static_cast<int>(rawSize);
+    }
+    if (!success)
+    {
+      vtkErrorWithObjectMacro(nullptr, "Could not decompress block " << iBlock << ".");
+      std::fill(values.begin(), values.end(), ValueType(0));
+    }
+  }
+
+  /*
+   * Return the decompressed values of a block, looking first at the last block read by the
+   * calling thread, then at the shared cache.
+   */
+  const Block& GetBlock(vtkIdType iBlock) const
+  {
+    LastBlock& last = this->LastBlocks.Local();
+    if (last.Index == iBlock)
+    {
+      return *last.Values;
+    }
+
+    BlockPointer values;
+    {
+      std::lock_guard<std::mutex> lock(this->CacheMutex);
+      auto found = this->CacheIndex.find(iBlock);
+      if (found != this->CacheIndex.end())
+      {
+        this->Cache.splice(this->Cache.begin(), this->Cache, found->second);
+        values = found->second->second;
+      }
+    }
+
+    if (!values)
+    {
+      // decompress outside of the lock so that threads reading different blocks do not wait
+      auto decompressed = std::make_shared<Block>();
+      this->Decompress(iBlock, *decompressed);
+      values = decompressed;
+
+      std::lock_guard<std::mutex> lock(this->CacheMutex);
+      if (this->CacheIndex.find(iBlock) == this->CacheIndex.end())
+      {
+        this->Cache.emplace_front(iBlock, values);
+        this->CacheIndex[iBlock] = this->Cache.begin();
+        while (static_cast<int>(this->Cache.size()) > this->CacheSize)
+        {
+          this->CacheIndex.erase(this->Cache.back().first);
+          this->Cache.pop_back();
+        }
+      }
+    }
+
+    last.Index = iBlock;
+    last.Values = values;
+    return *values;
+  }
+
+  std::size_t GetCompressedSize() const
+  {
+    std::size_t size = 0;
+    for (const CompressedBlock& block : this->Blocks)
+    {
+      size += block.Data.size();
+    }
+    return size;
+  }
+
+  const vtkIdType NumberOfComponents;
+  const vtkIdType NumberOfValues;
+  const int Codec;
+  const double Rate;
+  const int CacheSize;
+  vtkIdType BlockSize = 0;
+  std::vector<CompressedBlock> Blocks;
+
+  mutable vtkSMPThreadLocal<LastBlock> LastBlocks;
+  mutable std::mutex CacheMutex;
+  mutable std::list<std::pair<vtkIdType, BlockPointer>> Cache;
+  mutable std::unordered_map<vtkIdType,
+    typename std::list<std::pair<vtkIdType, BlockPointer>>::iterator>
+    CacheIndex;
+};
+
+//-----------------------------------------------------------------------
+template <typename ValueType>
+vtkCompressedImplicitBackend<ValueType>::vtkCompressedImplicitBackend(
+  vtkDataArray* array, int codec, double rate, vtkIdType blockSize, int cacheSize)
+  : Internal(new Internals(array, codec, rate, blockSize, cacheSize))
+{
+}
+
+//-----------------------------------------------------------------------
+template <typename ValueType>
+vtkCompressedImplicitBackend<ValueType>::~vtkCompressedImplicitBackend() = default;
+
+//-----------------------------------------------------------------------
+template <typename ValueType>
+ValueType vtkCompressedImplicitBackend<ValueType>::map(vtkIdType idx) const
+{
+  const vtkIdType iBlock = idx / this->Internal->BlockSize;
+  return this->Internal->GetBlock(iBlock)[idx - iBlock * this->Internal->BlockSize];
+}
+
+//-----------------------------------------------------------------------
+template <typename ValueType>
+void vtkCompressedImplicitBackend<ValueType>::mapTuple(vtkIdType idx, ValueType* tuple) const
+{
+  const vtkIdType first = idx * this->Internal->NumberOfComponents;
+  const vtkIdType iBlock = first / this->Internal->BlockSize;
+  const ValueType* values =
+    this->Internal->GetBlock(iBlock).data() + (first - iBlock * this->Internal->BlockSize);
+  std::copy(values, values + this->Internal->NumberOfComponents, tuple);
+}
+
+//-----------------------------------------------------------------------
+template <typename ValueType>
+unsigned long vtkCompressedImplicitBackend<ValueType>::getMemorySize() const
+{
+  const std::size_t cacheSize = static_cast<std::size_t>(this->Internal->CacheSize) *
+    static_cast<std::size_t>(this->Internal->BlockSize) * sizeof(ValueType);
+  const std::size_t size = this->Internal->GetCompressedSize() + cacheSize;
+  return static_cast<unsigned long>(std::ceil(static_cast<double>(size) / 1024.0));
+}
+
+//-----------------------------------------------------------------------
+template <typename ValueType>
+std::size_t vtkCompressedImplicitBackend<ValueType>::GetCompressedSize() const
+{
+  return this->Internal->GetCompressedSize();
+}
+
+//-----------------------------------------------------------------------
+template <typename ValueType>
+int vtkCompressedImplicitBackend<ValueType>::GetCodec() const
+{
+  return this->Internal->Codec;
+}
+
+template class VTKFILTERSREDUCTION_EXPORT vtkCompressedImplicitBackend<char>;
+template class VTKFILTERSREDUCTION_EXPORT vtkCompressedImplicitBackend<double>;
+template class VTKFILTERSREDUCTION_EXPORT vtkCompressedImplicitBackend<float>;
+template class VTKFILTERSREDUCTION_EXPORT vtkCompressedImplicitBackend<int>;
+template class VTKFILTERSREDUCTION_EXPORT vtkCompressedImplicitBackend<long>;
+template class VTKFILTERSREDUCTION_EXPORT vtkCompressedImplicitBackend<long long>;
+template class VTKFILTERSREDUCTION_EXPORT vtkCompressedImplicitBackend<short>;
+template class VTKFILTERSREDUCTION_EXPORT vtkCompressedImplicitBackend<signed char>;
+template class VTKFILTERSREDUCTION_EXPORT vtkCompressedImplicitBackend<unsigned char>;
+template class VTKFILTERSREDUCTION_EXPORT vtkCompressedImplicitBackend<unsigned int>;
+template class VTKFILTERSREDUCTION_EXPORT vtkCompressedImplicitBackend<unsigned long>;
+template class VTKFILTERSREDUCTION_EXPORT vtkCompressedImplicitBackend<unsigned long long>;
+template class VTKFILTERSREDUCTION_EXPORT vtkCompressedImplicitBackend<unsigned short>;
+VTK_ABI_NAMESPACE_END
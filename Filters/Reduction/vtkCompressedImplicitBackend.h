@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#ifndef vtkCompressedImplicitBackend_h
+#define vtkCompressedImplicitBackend_h
+
+/**
+ * \class vtkCompressedImplicitBackend
+ *
+ * A backend for the `vtkImplicitArray` framework storing the values of an array compressed by
+ * blocks of consecutive values. Each block is compressed independently, either with ZFP in
+ * fixed-rate mode (lossy, only for `float` and `double` values) or with LZ4 (lossless, for any
+ * value type). Accessing a value only decompresses the block holding it. The most recently used
+ * decompressed blocks are kept in a cache, so that filters and mappers reading the array in order
+ * decompress each block once.
+ *
+ * Blocks always hold whole tuples. The values of the tuples are compressed in their AOS order.
+ *
+ * Reading the array from the threads of `vtkSMPTools` is thread safe: each thread remembers the
+ * last block it read, and the shared block cache is protected by a mutex.
+ *
+ * An example of potential usage in a `vtkImplicitArray`:
+ * ```
+ * vtkNew<vtkImplicitArray<vtkCompressedImplicitBackend<float>>> compressed;
+ * compressed->SetBackend(std::make_shared<vtkCompressedImplicitBackend<float>>(
+ *   baseArray, vtkCompressedImplicitBackend<float>::ZFP, 16.0));
+ * compressed->SetNumberOfComponents(baseArray->GetNumberOfComponents());
+ * compressed->SetNumberOfTuples(baseArray->GetNumberOfTuples());
+ * ```
+ *
+ * @sa
+ * vtkImplicitArray, vtkToCompressedArrayStrategy
+ */
+
+#include "vtkFiltersReductionModule.h" // for export macro
+#include "vtkType.h"                   // for vtkIdType
+
+#include <cstddef> // for std::size_t
+#include <memory>  // for std::unique_ptr
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkDataArray;
+template <typename ValueType>
+class VTKFILTERSREDUCTION_EXPORT vtkCompressedImplicitBackend final
+{
+public:
+  /**
+   * Compression of the blocks.
+   */
+  enum Codec
+  {
+    LZ4 = 0,
+    ZFP = 1
+  };
+
+  /**
+   * Compress the values of @a array.
+   * @param array array whose values are compressed, it is not referenced afterwards
+   * @param codec compression of the blocks, ZFP falls back to LZ4 for integral value types
+   * @param rate number of compressed bits per value used by ZFP
+   * @param blockSize approximate number of values per block, rounded to whole tuples
+   * @param cacheSize maximum number of decompressed blocks kept in the shared cache
+   */
+  vtkCompressedImplicitBackend(vtkDataArray* array, int codec = LZ4, double rate = 16.0,
+    vtkIdType blockSize = 4096, int cacheSize = 16);
+  ~vtkCompressedImplicitBackend();
+
+  /**
+   * Value access respecting the backend expectations of `vtkImplicitArray`
+   */
+  ValueType map(vtkIdType idx) const;
+
+  /**
+   * Tuple access respecting the backend expectations of `vtkImplicitArray`, decompressing at most
+   * one block
+   */
+  void mapTuple(vtkIdType idx, ValueType* tuple) const;
+
+  /**
+   * Returns the smallest integer memory size in KiB needed to store the compressed blocks and a
+   * full cache of decompressed blocks.
+   * Used to implement GetActualMemorySize on `vtkImplicitArray`.
+   */
+  unsigned long getMemorySize() const;
+
+  /**
+   * Return the size in bytes of the compressed blocks.
+   */
+  std::size_t GetCompressedSize() const;
+
+  /**
+   * Return the codec actually used to compress the blocks.
+   */
+  int GetCodec() const;
+
+private:
+  struct Internals;
+  std::unique_ptr<Internals> Internal;
+};
+VTK_ABI_NAMESPACE_END
+
+#endif // vtkCompressedImplicitBackend_h
@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkToCompressedArrayStrategy.h"
+
+#include "vtkCompressedImplicitBackend.h"
+#include "vtkDataArray.h"
+#include "vtkImplicitArray.h"
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+
+namespace
+{
+//-------------------------------------------------------------------------
+template <typename ValueType>
+vtkSmartPointer<vtkDataArray> CompressArray(vtkDataArray* arr, int codec, double rate,
+  vtkIdType blockSize, int cacheSize, std::size_t& compressedSize)
+{
+  using BackendT = vtkCompressedImplicitBackend<ValueType>;
+  auto backend = std::make_shared<BackendT>(arr, codec, rate, blockSize, cacheSize);
+  compressedSize = backend->GetCompressedSize();
+  vtkNew<vtkImplicitArray<BackendT>> compressed;
+  compressed->SetBackend(backend);
+  compressed->SetNumberOfComponents(arr->GetNumberOfComponents());
+  compressed->SetNumberOfTuples(arr->GetNumberOfTuples());
+  compressed->SetName(arr->GetName());
+  return compressed;
+}
+}
+
+VTK_ABI_NAMESPACE_BEGIN
+//-------------------------------------------------------------------------
+struct vtkToCompressedArrayStrategy::vtkInternals
+{
+public:
+  /*
+   * Release the cached compressed array
+   */
+  void ClearCache()
+  {
+    this->Compressed = nullptr;
+    this->CachedArray = nullptr;
+    this->ArrayMTimeAtCaching = vtkMTimeType();
+  }
+
+  /*
+   * Compress the array and return the ratio between the compressed and original sizes
+   */
+  vtkToImplicitStrategy::Optional EstimateReduction(
+    vtkDataArray* arr, int codec, double rate, vtkIdType blockSize, int cacheSize)
+  {
+    this->ClearCache();
+    std::size_t compressedSize = 0;
+    switch (arr->GetDataType())
+    {
+      vtkTemplateMacro(this->Compressed = ::CompressArray<VTK_TT>(
+                         arr, codec, rate, blockSize, cacheSize, compressedSize));
+      default:
+        return vtkToImplicitStrategy::Optional();
+    }
+    this->CachedArray = arr;
+    this->ArrayMTimeAtCaching = arr->GetMTime();
+    const double originalSize =
+      static_cast<double>(arr->GetNumberOfValues()) * arr->GetDataTypeSize();
+    return vtkToImplicitStrategy::Optional(static_cast<double>(compressedSize) / originalSize);
+  }
+
+  /*
+   * Compress the array if it is not the one cached and return the compressed array
+   */
+  vtkSmartPointer<vtkDataArray> Reduce(
+    vtkDataArray* arr, int codec, double rate, vtkIdType blockSize, int cacheSize)
+  {
+    if (!this->Compressed || (arr != this->CachedArray) ||
+      this->ArrayMTimeAtCaching < arr->GetMTime())
+    {
+      if (!this->EstimateReduction(arr, codec, rate, blockSize, cacheSize).IsSome)
+      {
+        vtkWarningWithObjectMacro(nullptr, "Could not successfully compress array");
+        return nullptr;
+      }
+    }
+    vtkSmartPointer<vtkDataArray> res = this->Compressed;
+    this->ClearCache();
+    return res;
+  }
+
+private:
+  vtkSmartPointer<vtkDataArray> Compressed;
+  vtkDataArray* CachedArray = nullptr;
+  vtkMTimeType ArrayMTimeAtCaching = vtkMTimeType();
+};
+
+//-------------------------------------------------------------------------
+vtkObjectFactoryNewMacro(vtkToCompressedArrayStrategy);
+
+//-------------------------------------------------------------------------
+vtkToCompressedArrayStrategy::vtkToCompressedArrayStrategy()
+  : Internals(std::unique_ptr<vtkInternals>(new vtkInternals()))
+{
+}
+
+//-------------------------------------------------------------------------
+vtkToCompressedArrayStrategy::~vtkToCompressedArrayStrategy() = default;
+
+//-------------------------------------------------------------------------
+void vtkToCompressedArrayStrategy::PrintSelf(std::ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "ZFPRate: " << this->ZFPRate << std::endl;
+  os << indent << "Lossless: " << (this->Lossless ? "On" : "Off") << std::endl;
+  os << indent << "BlockSize: " << this->BlockSize << std::endl;
+  os << indent << "CacheSize: " << this->CacheSize << std::endl;
+}
+
+//-------------------------------------------------------------------------
+vtkToImplicitStrategy::Optional vtkToCompressedArrayStrategy::EstimateReduction(
+  vtkDataArray* arr)
+{
+  if (!arr)
+  {
+    vtkWarningMacro("Cannot transform nullptr to compressed array.");
+    return vtkToImplicitStrategy::Optional();
+  }
+  if (!arr->GetNumberOfValues())
+  {
+    return vtkToImplicitStrategy::Optional();
+  }
+  const int codec = this->Lossless ? vtkCompressedImplicitBackend<float>::LZ4
+                                   : vtkCompressedImplicitBackend<float>::ZFP;
+  return this->Internals->EstimateReduction(
+    arr, codec, this->ZFPRate, this->BlockSize, this->CacheSize);
+}
+
+//-------------------------------------------------------------------------
+vtkSmartPointer<vtkDataArray> vtkToCompressedArrayStrategy::Reduce(vtkDataArray* arr)
+{
+  if (!arr)
+  {
+    vtkWarningMacro("Cannot transform nullptr to compressed array.");
+    return nullptr;
+  }
+  if (!arr->GetNumberOfValues())
+  {
+    return nullptr;
+  }
+  const int codec = this->Lossless ? vtkCompressedImplicitBackend<float>::LZ4
+                                   : vtkCompressedImplicitBackend<float>::ZFP;
+  return this->Internals->Reduce(arr, codec, this->ZFPRate, this->BlockSize, this->CacheSize);
+}
+
+//-------------------------------------------------------------------------
+void vtkToCompressedArrayStrategy::ClearCache()
+{
+  this->Internals->ClearCache();
+}
+VTK_ABI_NAMESPACE_END
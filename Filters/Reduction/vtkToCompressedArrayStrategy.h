@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#ifndef vtkToCompressedArrayStrategy_h
+#define vtkToCompressedArrayStrategy_h
+
+#include "vtkFiltersReductionModule.h" // for export
+#include "vtkToImplicitStrategy.h"
+
+#include <memory>
+
+VTK_ABI_NAMESPACE_BEGIN
+/**
+ * @class vtkToCompressedArrayStrategy
+ *
+ * Strategy to be used in conjunction with `vtkToImplicitArrayFilter` to compress arrays into
+ * implicit arrays backed by a `vtkCompressedImplicitBackend`. The values are compressed by blocks
+ * and only decompressed on demand when accessed.
+ *
+ * Floating point arrays are compressed with ZFP in fixed-rate mode unless `Lossless` is on, all
+ * other arrays are compressed with LZ4. The estimated reduction is the ratio between the size of
+ * the compressed blocks and the size of the original values.
+ *
+ * The `Tolerance` of the strategy is not used: the accuracy of ZFP is controlled by `ZFPRate`.
+ *
+ * @sa
+ * vtkCompressedImplicitBackend, vtkToImplicitArrayFilter
+ */
+class VTKFILTERSREDUCTION_EXPORT vtkToCompressedArrayStrategy final : public vtkToImplicitStrategy
+{
+public:
+  static vtkToCompressedArrayStrategy* New();
+  vtkTypeMacro(vtkToCompressedArrayStrategy, vtkToImplicitStrategy);
+  void PrintSelf(std::ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Number of compressed bits per value used by ZFP for floating point arrays.
+   *
+   * Default value: 16
+   */
+  vtkSetClampMacro(ZFPRate, double, 1.0, 64.0);
+  vtkGetMacro(ZFPRate, double);
+  ///@}
+
+  ///@{
+  /**
+   * When on, floating point arrays are compressed with LZ4 instead of ZFP so that their values
+   * are preserved exactly.
+   *
+   * Default value: false
+   */
+  vtkSetMacro(Lossless, bool);
+  vtkGetMacro(Lossless, bool);
+  vtkBooleanMacro(Lossless, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Approximate number of values per compressed block.
+   *
+   * Default value: 4096
+   */
+  vtkSetClampMacro(BlockSize, vtkIdType, 1, VTK_ID_MAX);
+  vtkGetMacro(BlockSize, vtkIdType);
+  ///@}
+
+  ///@{
+  /**
+   * Maximum number of decompressed blocks kept in the cache of each compressed array.
+   *
+   * Default value: 16
+   */
+  vtkSetClampMacro(CacheSize, int, 1, VTK_INT_MAX);
+  vtkGetMacro(CacheSize, int);
+  ///@}
+
+  ///@{
+  /**
+   * Implements parent API
+   */
+  vtkToImplicitStrategy::Optional EstimateReduction(vtkDataArray*) override;
+  vtkSmartPointer<vtkDataArray> Reduce(vtkDataArray*) override;
+  ///@}
+
+  /**
+   * Destroys the compressed array created for the last array passed to `EstimateReduction`
+   */
+  void ClearCache() override;
+
+protected:
+  vtkToCompressedArrayStrategy();
+  ~vtkToCompressedArrayStrategy() override;
+
+  double ZFPRate = 16.0;
+  bool Lossless = false;
+  vtkIdType BlockSize = 4096;
+  int CacheSize = 16;
+
+private:
+  vtkToCompressedArrayStrategy(const vtkToCompressedArrayStrategy&) = delete;
+  void operator=(const vtkToCompressedArrayStrategy&) = delete;
+
+  struct vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+VTK_ABI_NAMESPACE_END
+
+#endif // vtkToCompressedArrayStrategy_h
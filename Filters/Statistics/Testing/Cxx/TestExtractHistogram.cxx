@@ -1,15 +1,20 @@
 // SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
 // SPDX-License-Identifier: BSD-3-Clause
 
+#include "vtkDoubleArray.h"
 #include "vtkExecutive.h"
 #include "vtkExtractHistogram.h"
 #include "vtkIntArray.h"
+#include "vtkMultiBlockDataSet.h"
 #include "vtkNew.h"
+#include "vtkSMPTools.h"
 #include "vtkTable.h"
 #include "vtkTestErrorObserver.h"
 
 #include <vtksys/SystemTools.hxx>
 
+#include <cmath>
+
 //------------------------------------------------------------------------------
 // randomly sampled data
 const int N_random_list = 100;
@@ -78,6 +83,66 @@ bool TestHistogramNormalization(vtkTable* table)
   return diff1 <= std::numeric_limits<double>::epsilon() * N_histogram_bins;
 }
 
+bool TestThreadedCompositeHistogram()
+{
+  // Two large blocks, binned with the averages of another column, must give the
+  // same result threaded and serial
+  vtkNew<vtkMultiBlockDataSet> blocks;
+  const vtkIdType numValues = 100000;
+  for (unsigned int block = 0; block < 2; ++block)
+  {
+    vtkNew<vtkDoubleArray> samples;
+    samples->SetName("samples");
+    samples->SetNumberOfValues(numValues);
+    vtkNew<vtkDoubleArray> doubles;
+    doubles->SetName("doubles");
+    doubles->SetNumberOfValues(numValues);
+    for (vtkIdType i = 0; i < numValues; ++i)
+    {
+      samples->SetValue(i, random_list[(i + block) % N_random_list]);
+      doubles->SetValue(i, 2 * samples->GetValue(i));
+    }
+    vtkNew<vtkTable> table;
+    table->AddColumn(samples);
+    table->AddColumn(doubles);
+    blocks->SetBlock(block, table);
+  }
+
+  vtkNew<vtkExtractHistogram> histogram;
+  histogram->SetBinCount(N_histogram_bins);
+  histogram->CalculateAveragesOn();
+  histogram->SetInputData(blocks);
+  histogram->SetInputArrayToProcess(0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_ROWS, "samples");
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ 1 }, [&]() { histogram->Update(); });
+  vtkNew<vtkTable> serial;
+  serial->DeepCopy(histogram->GetOutput());
+  histogram->Modified();
+  histogram->Update();
+  vtkTable* output = histogram->GetOutput();
+
+  vtkDataArray* bin_values =
+    vtkDataArray::SafeDownCast(output->GetColumnByName(histogram->GetBinValuesArrayName()));
+  vtkDataArray* averages = vtkDataArray::SafeDownCast(output->GetColumnByName("doubles_average"));
+  vtkDataArray* serial_averages =
+    vtkDataArray::SafeDownCast(serial->GetColumnByName("doubles_average"));
+  if (!bin_values || !averages || !serial_averages)
+  {
+    return false;
+  }
+  int sum = 0;
+  for (int i = 0; i < N_histogram_bins; i++)
+  {
+    // Every block holds the sampled data 1000 times
+    if (bin_values->GetComponent(i, 0) != 2000 * histogram_data[i] ||
+      std::abs(averages->GetComponent(i, 0) - serial_averages->GetComponent(i, 0)) > 1e-9)
+    {
+      return false;
+    }
+    sum += static_cast<int>(bin_values->GetComponent(i, 0));
+  }
+  return sum == 2 * numValues;
+}
+
 int TestExtractHistogram(int, char*[])
 {
   // Create the table containing the raw random samples
@@ -107,5 +172,11 @@ int TestExtractHistogram(int, char*[])
     return EXIT_FAILURE;
   }
 
+  if (!TestThreadedCompositeHistogram())
+  {
+    cout << "## Failure: Threaded composite histogram does not match solution data!" << endl;
+    return EXIT_FAILURE;
+  }
+
   return EXIT_SUCCESS;
 }
@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check the approximate quantiles of vtkOrderStatistics: their ranks must be
+// within the requested error, the extrema must be exact, and the histogram
+// must stay small.
+
+#include "vtkAbstractArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkLogger.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkOrderStatistics.h"
+#include "vtkTable.h"
+
+#include <cmath>
+#include <cstdlib>
+
+int TestOrderStatisticsApproximate(int, char*[])
+{
+  // A permutation of 0, ..., n - 1 so that the rank of a value is the value
+  const vtkIdType numRows = 1000000;
+  vtkNew<vtkDoubleArray> values;
+  values->SetName("Values");
+  values->SetNumberOfValues(numRows);
+  for (vtkIdType r = 0; r < numRows; ++r)
+  {
+    values->SetValue(r, static_cast<double>((r * 7919) % numRows));
+  }
+  vtkNew<vtkTable> table;
+  table->AddColumn(values);
+
+  const double relativeError = 0.01;
+  vtkNew<vtkOrderStatistics> order;
+  order->SetInputData(vtkStatisticsAlgorithm::INPUT_DATA, table);
+  order->AddColumn("Values");
+  order->SetNumberOfIntervals(10);
+  order->ApproximateQuantilesOn();
+  order->SetQuantileRelativeError(relativeError);
+  order->SetLearnOption(true);
+  order->SetDeriveOption(true);
+  order->SetAssessOption(false);
+  order->SetTestOption(false);
+  order->Update();
+
+  vtkMultiBlockDataSet* model = vtkMultiBlockDataSet::SafeDownCast(
+    order->GetOutputDataObject(vtkStatisticsAlgorithm::OUTPUT_MODEL));
+  vtkTable* histogram = vtkTable::SafeDownCast(model->GetBlock(0));
+  if (!histogram || histogram->GetNumberOfRows() > numRows / 100)
+  {
+    vtkLog(ERROR, "Histogram too large: " << (histogram ? histogram->GetNumberOfRows() : 0));
+    return EXIT_FAILURE;
+  }
+
+  vtkTable* quantiles = vtkTable::SafeDownCast(model->GetBlock(model->GetNumberOfBlocks() - 1));
+  vtkAbstractArray* column = quantiles ? quantiles->GetColumnByName("Values") : nullptr;
+  if (!column || column->GetNumberOfValues() != 11)
+  {
+    vtkLog(ERROR, "Missing quantiles");
+    return EXIT_FAILURE;
+  }
+  if (column->GetVariantValue(0).ToDouble() != 0. ||
+    column->GetVariantValue(10).ToDouble() != numRows - 1.)
+  {
+    vtkLog(ERROR, "Wrong extrema");
+    return EXIT_FAILURE;
+  }
+  for (vtkIdType q = 1; q < 10; ++q)
+  {
+    const double quantile = column->GetVariantValue(q).ToDouble();
+    const double exact = q * numRows / 10.;
+    if (std::abs(quantile - exact) > relativeError * numRows)
+    {
+      vtkLog(ERROR, "Quantile " << q << " is " << quantile << " instead of about " << exact);
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the threaded Learn phases of vtkDescriptiveStatistics and
+// vtkOrderStatistics produce the same models as the serial ones, over a table
+// large enough to be split into several chunks.
+
+#include "vtkDataArray.h"
+#include "vtkDescriptiveStatistics.h"
+#include "vtkDoubleArray.h"
+#include "vtkLogger.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkOrderStatistics.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkTable.h"
+
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+bool SameTables(vtkTable* t1, vtkTable* t2)
+{
+  if (!t1 || !t2 || t1->GetNumberOfRows() != t2->GetNumberOfRows() ||
+    t1->GetNumberOfColumns() != t2->GetNumberOfColumns())
+  {
+    vtkLog(ERROR, "Different model sizes");
+    return false;
+  }
+  for (vtkIdType r = 0; r < t1->GetNumberOfRows(); ++r)
+  {
+    for (vtkIdType c = 0; c < t1->GetNumberOfColumns(); ++c)
+    {
+      if (t1->GetValue(r, c) != t2->GetValue(r, c))
+      {
+        vtkLog(ERROR, "Different value for " << t1->GetColumnName(c) << " at row " << r);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Learn the model serially and threaded, and return its first table
+vtkSmartPointer<vtkTable> LearnModel(vtkStatisticsAlgorithm* algorithm, bool& same)
+{
+  algorithm->SetLearnOption(true);
+  algorithm->SetDeriveOption(false);
+  algorithm->SetAssessOption(false);
+  algorithm->SetTestOption(false);
+
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ 1 }, [&]() { algorithm->Update(); });
+  auto serial = vtkSmartPointer<vtkTable>::New();
+  serial->DeepCopy(vtkMultiBlockDataSet::SafeDownCast(
+    algorithm->GetOutputDataObject(vtkStatisticsAlgorithm::OUTPUT_MODEL))
+                     ->GetBlock(0));
+
+  algorithm->Modified();
+  algorithm->Update();
+  vtkTable* model = vtkTable::SafeDownCast(
+    vtkMultiBlockDataSet::SafeDownCast(
+      algorithm->GetOutputDataObject(vtkStatisticsAlgorithm::OUTPUT_MODEL))
+      ->GetBlock(0));
+  same = SameTables(serial, model);
+  return serial;
+}
+}
+
+int TestStatisticsThreaded(int, char*[])
+{
+  const vtkIdType numRows = 300000;
+  vtkNew<vtkDoubleArray> values;
+  values->SetName("Values");
+  values->SetNumberOfValues(numRows);
+  double sum = 0.;
+  for (vtkIdType r = 0; r < numRows; ++r)
+  {
+    const double value = static_cast<double>((r * 7919) % 1000) - 250.;
+    values->SetValue(r, value);
+    sum += value;
+  }
+  vtkNew<vtkTable> table;
+  table->AddColumn(values);
+  const double mean = sum / numRows;
+  double m2 = 0.;
+  for (vtkIdType r = 0; r < numRows; ++r)
+  {
+    m2 += (values->GetValue(r) - mean) * (values->GetValue(r) - mean);
+  }
+
+  vtkNew<vtkDescriptiveStatistics> descriptive;
+  descriptive->SetInputData(vtkStatisticsAlgorithm::INPUT_DATA, table);
+  descriptive->AddColumn("Values");
+  bool same = false;
+  vtkSmartPointer<vtkTable> model = LearnModel(descriptive, same);
+  if (!same)
+  {
+    vtkLog(ERROR, "Threaded descriptive statistics differ from the serial ones");
+    return EXIT_FAILURE;
+  }
+  if (model->GetValueByName(0, "Cardinality").ToLongLong() != numRows ||
+    model->GetValueByName(0, "Minimum").ToDouble() != -250. ||
+    model->GetValueByName(0, "Maximum").ToDouble() != 749. ||
+    std::abs(model->GetValueByName(0, "Mean").ToDouble() - mean) > 1e-9 ||
+    std::abs(model->GetValueByName(0, "M2").ToDouble() - m2) > 1e-9 * m2)
+  {
+    vtkLog(ERROR, "Wrong descriptive statistics");
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkOrderStatistics> order;
+  order->SetInputData(vtkStatisticsAlgorithm::INPUT_DATA, table);
+  order->AddColumn("Values");
+  model = LearnModel(order, same);
+  if (!same)
+  {
+    vtkLog(ERROR, "Threaded histogram differs from the serial one");
+    return EXIT_FAILURE;
+  }
+  if (model->GetNumberOfRows() != 1000 || model->GetValueByName(0, "Value").ToDouble() != -250. ||
+    model->GetValueByName(0, "Cardinality").ToLongLong() != numRows / 1000)
+  {
+    vtkLog(ERROR, "Wrong histogram");
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -36,6 +36,8 @@ void vtkComputeQuantiles::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
 
   os << indent << "NumberOfIntervals: " << this->NumberOfIntervals << "\n";
+  os << indent << "ApproximateQuantiles: " << this->ApproximateQuantiles << "\n";
+  os << indent << "QuantileRelativeError: " << this->QuantileRelativeError << "\n";
 }
 
 //------------------------------------------------------------------------------
@@ -147,6 +149,8 @@ void vtkComputeQuantiles::ComputeTable(
     vtkSmartPointer<vtkOrderStatistics>::Take(this->CreateOrderStatisticsFilter());
   os->SetInputData(vtkStatisticsAlgorithm::INPUT_DATA, inDescStats);
   os->SetNumberOfIntervals(this->NumberOfIntervals);
+  os->SetApproximateQuantiles(this->ApproximateQuantiles);
+  os->SetQuantileRelativeError(this->QuantileRelativeError);
 
   for (int i = 0; i < field->GetNumberOfArrays(); i++)
   {
@@ -49,6 +49,22 @@ public:
   vtkSetMacro(NumberOfIntervals, int);
   ///@}
 
+  ///@{
+  /**
+   * Set/get whether the quantiles of numeric fields are approximated with a
+   * quantile sketch of bounded size, and the targeted error of their ranks as
+   * a fraction of the number of values.
+   * Default is false and 0.01.
+   *
+   * @sa vtkOrderStatistics::SetApproximateQuantiles
+   */
+  vtkGetMacro(ApproximateQuantiles, bool);
+  vtkSetMacro(ApproximateQuantiles, bool);
+  vtkBooleanMacro(ApproximateQuantiles, bool);
+  vtkGetMacro(QuantileRelativeError, double);
+  vtkSetClampMacro(QuantileRelativeError, double, 1e-6, 0.5);
+  ///@}
+
 protected:
   vtkComputeQuantiles();
   ~vtkComputeQuantiles() override = default;
@@ -64,6 +80,8 @@ protected:
 
   int FieldAssociation = -1;
   int NumberOfIntervals = 4;
+  bool ApproximateQuantiles = false;
+  double QuantileRelativeError = 0.01;
 
 private:
   void operator=(const vtkComputeQuantiles&) = delete;
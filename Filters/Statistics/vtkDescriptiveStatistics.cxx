@@ -14,6 +14,7 @@
 #include "vtkMath.h"
 #include "vtkMultiBlockDataSet.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkStdString.h"
 #include "vtkStringArray.h"
 #include "vtkTable.h"
@@ -25,6 +26,108 @@
 #include <sstream>
 #include <vector>
 
+namespace
+{
+// Rows are processed in chunks of fixed size so that the result does not
+// depend on the number of threads
+constexpr vtkIdType LearnChunkSize = 65536;
+
+// Extremal values and centered moments of the values of a chunk of rows
+struct Moments
+{
+  vtkIdType Cardinality = 0;
+  double Minimum = std::numeric_limits<double>::max();
+  double Maximum = std::numeric_limits<double>::min();
+  double Mean = 0.;
+  double M2 = 0.;
+  double M3 = 0.;
+  double M4 = 0.;
+
+  // Merge the moments of an other chunk, as in Aggregate
+  void Add(const Moments& other)
+  {
+    if (!other.Cardinality)
+    {
+      return;
+    }
+    if (!this->Cardinality)
+    {
+      *this = other;
+      return;
+    }
+    const double n = static_cast<double>(this->Cardinality);
+    const double n_c = static_cast<double>(other.Cardinality);
+    const double N = n + n_c;
+    const double delta = other.Mean - this->Mean;
+    const double delta_sur_N = delta / N;
+    const double delta2_sur_N2 = delta_sur_N * delta_sur_N;
+    const double n2 = n * n;
+    const double n_c2 = n_c * n_c;
+    const double prod_n = n * n_c;
+
+    this->M4 += other.M4 + delta2_sur_N2 * delta2_sur_N2 * prod_n * (n * n2 + n_c * n_c2) +
+      6. * (n2 * other.M2 + n_c2 * this->M2) * delta2_sur_N2 +
+      4. * (n * other.M3 - n_c * this->M3) * delta_sur_N;
+    this->M3 += other.M3 + prod_n * (n - n_c) * delta * delta2_sur_N2 +
+      3. * (n * other.M2 - n_c * this->M2) * delta_sur_N;
+    this->M2 += other.M2 + prod_n * delta * delta_sur_N;
+    this->Mean += n_c * delta_sur_N;
+    this->Cardinality += other.Cardinality;
+    this->Minimum = std::min(this->Minimum, other.Minimum);
+    this->Maximum = std::max(this->Maximum, other.Maximum);
+  }
+};
+
+// Compute the moments of every chunk of rows of a column
+struct LearnMomentsFunctor
+{
+  vtkTable* Table;
+  const char* Name;
+  vtkDataArray* Column;
+  vtkUnsignedCharArray* Ghosts;
+  unsigned char GhostsToSkip;
+  vtkIdType NumberOfRows;
+  std::vector<Moments>& Chunks;
+
+  void operator()(vtkIdType beginChunk, vtkIdType endChunk)
+  {
+    for (vtkIdType chunk = beginChunk; chunk < endChunk; ++chunk)
+    {
+      Moments& moments = this->Chunks[chunk];
+      const vtkIdType endRow = std::min(this->NumberOfRows, (chunk + 1) * LearnChunkSize);
+      double n, inv_n, val, delta, A, B;
+      for (vtkIdType r = chunk * LearnChunkSize; r < endRow; ++r)
+      {
+        if (this->Ghosts && (this->Ghosts->GetValue(r) & this->GhostsToSkip))
+        {
+          continue;
+        }
+        n = static_cast<double>(++moments.Cardinality);
+        inv_n = 1. / n;
+
+        // Numeric columns are read directly, the others through variants
+        val = this->Column ? this->Column->GetComponent(r, 0)
+                           : this->Table->GetValueByName(r, this->Name).ToDouble();
+        delta = val - moments.Mean;
+
+        A = delta * inv_n;
+        moments.Mean += A;
+        moments.M4 += A *
+          (A * A * delta * (n - 1.) * (n * (n - 3.) + 3.) + 6. * A * moments.M2 -
+            4. * moments.M3);
+
+        B = val - moments.Mean;
+        moments.M3 += A * (B * delta * (n - 2.) - 3. * moments.M2);
+        moments.M2 += delta * B;
+
+        moments.Minimum = std::min(moments.Minimum, val);
+        moments.Maximum = std::max(moments.Maximum, val);
+      }
+    }
+  }
+};
+}
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkObjectFactoryNewMacro(vtkDescriptiveStatistics);
 
@@ -337,34 +440,38 @@ void vtkDescriptiveStatistics::Learn(
 
     if (numberOfGhostlessRow)
     {
-      double n, inv_n, val, delta, A, B;
-      vtkIdType numberOfSkippedElements = 0;
-      for (vtkIdType r = 0; r < nRow; ++r)
+      // Chunks of single component numeric columns are processed concurrently,
+      // then their moments are merged in order
+      vtkDataArray* column =
+        vtkArrayDownCast<vtkDataArray>(inData->GetColumnByName(varName.c_str()));
+      if (column && column->GetNumberOfComponents() != 1)
       {
-        if (ghosts && (ghosts->GetValue(r) & this->GhostsToSkip))
-        {
-          ++numberOfSkippedElements;
-          continue;
-        }
-        n = r + 1. - numberOfSkippedElements;
-        inv_n = 1. / n;
-
-        val = inData->GetValueByName(r, varName.c_str()).ToDouble();
-        delta = val - mean;
-
-        A = delta * inv_n;
-        mean += A;
-        mom4 += A *
-          (A * A * delta * (r - numberOfSkippedElements) * (n * (n - 3.) + 3.) + 6. * A * mom2 -
-            4. * mom3);
-
-        B = val - mean;
-        mom3 += A * (B * delta * (n - 2.) - 3. * mom2);
-        mom2 += delta * B;
+        column = nullptr;
+      }
+      const vtkIdType numberOfChunks = (nRow + LearnChunkSize - 1) / LearnChunkSize;
+      std::vector<Moments> chunks(numberOfChunks);
+      LearnMomentsFunctor functor{ inData, varName.c_str(), column, ghosts, this->GhostsToSkip,
+        nRow, chunks };
+      if (column)
+      {
+        vtkSMPTools::For(0, numberOfChunks, 1, functor);
+      }
+      else
+      {
+        functor(0, numberOfChunks);
+      }
 
-        minVal = std::min(minVal, val);
-        maxVal = std::max(maxVal, val);
+      Moments moments;
+      for (const Moments& chunk : chunks)
+      {
+        moments.Add(chunk);
       }
+      minVal = moments.Minimum;
+      maxVal = moments.Maximum;
+      mean = moments.Mean;
+      mom2 = moments.M2;
+      mom3 = moments.M3;
+      mom4 = moments.M4;
     }
 
     vtkVariantArray* row = vtkVariantArray::New();
@@ -30,6 +30,7 @@
 #include "vtkUnsignedIntArray.h"
 #include "vtkUnsignedShortArray.h"
 
+#include <algorithm>
 #include <array>
 #include <map>
 #include <string>
@@ -470,17 +471,13 @@ void vtkExtractHistogram::AccumulateBins(vtkTable* outputData)
   bin_accum->Delete();
 }
 
-//-----------------------------------------------------------------------------
-inline int vtkExtractHistogramClamp(int value, int min, int max)
-{
-  value = value < min ? min : value;
-  value = value > max ? max : value;
-  return value;
-}
-
 //-----------------------------------------------------------------------------
 namespace
 {
+// Number of tuples whose bin indices are computed at once, in a loop simple
+// enough to be vectorized by the compiler
+constexpr vtkIdType BinBlockSize = 512;
+
 template <typename ArrayT>
 class BinAnArrayFunctor
 {
@@ -489,7 +486,6 @@ private:
   vtkFieldData* Field;
   vtkIntArray* BinValues;
   vtkExtractHistogramInternal::ArrayMapType& ArrayValues;
-  const char* BinValuesArrayName;
   int BinCount;
   int Component;
   double Min;
@@ -502,19 +498,21 @@ private:
   vtkUnsignedCharArray* Blanking;
   unsigned char GhostIndicator;
 
-  vtkSMPThreadLocal<vtkSmartPointer<vtkIntArray>> TLBinValues;
-  vtkSMPThreadLocal<vtkExtractHistogramInternal::ArrayMapType> TLArrayValues;
+  // Arrays whose values are summed per bin to compute averages
+  std::vector<vtkDataArray*> AverageArrays;
+
+  vtkSMPThreadLocal<std::vector<vtkIdType>> TLBinValues;
+  // Per average array, the totals of the components of every bin
+  vtkSMPThreadLocal<std::vector<std::vector<double>>> TLArrayValues;
 
 public:
   BinAnArrayFunctor(ArrayT* dataArray, vtkFieldData* field, vtkIntArray* binValues,
-    vtkExtractHistogramInternal::ArrayMapType& arrayValues, const char* binValuesArrayName,
-    int binCount, int component, double min, double max, int calculateAverages,
-    bool centerBinsAroundMinAndMax)
+    vtkExtractHistogramInternal::ArrayMapType& arrayValues, int binCount, int component,
+    double min, double max, int calculateAverages, bool centerBinsAroundMinAndMax)
     : DataArray(dataArray)
     , Field(field)
     , BinValues(binValues)
     , ArrayValues(arrayValues)
-    , BinValuesArrayName(binValuesArrayName)
     , BinCount(binCount)
     , Component(component)
     , Min(min)
@@ -537,19 +535,32 @@ public:
     this->GhostIndicator = field->IsA("vtkPointData")
       ? (vtkDataSetAttributes::HIDDENPOINT | vtkDataSetAttributes::DUPLICATEPOINT)
       : (vtkDataSetAttributes::HIDDENCELL | vtkDataSetAttributes::DUPLICATECELL);
+
+    if (this->CalculateAverages)
+    {
+      for (int idx = 0; idx < this->Field->GetNumberOfArrays(); idx++)
+      {
+        vtkDataArray* array = this->Field->GetArray(idx);
+        if (array && array != this->DataArray && array->GetName())
+        {
+          this->AverageArrays.push_back(array);
+        }
+      }
+    }
   }
 
   void Initialize()
   {
     // initialize thread copies
-    auto& tlBinValues = this->TLBinValues.Local();
-    tlBinValues = vtkSmartPointer<vtkIntArray>::New();
-    tlBinValues->SetNumberOfComponents(1);
-    tlBinValues->SetNumberOfTuples(this->BinCount);
-    tlBinValues->SetName(this->BinValuesArrayName);
-    tlBinValues->FillComponent(0, 0.0);
-
-    this->TLArrayValues.Local();
+    this->TLBinValues.Local().assign(this->BinCount, 0);
+    auto& tlArrayValues = this->TLArrayValues.Local();
+    tlArrayValues.resize(this->AverageArrays.size());
+    for (std::size_t a = 0; a < this->AverageArrays.size(); ++a)
+    {
+      tlArrayValues[a].assign(
+        static_cast<std::size_t>(this->BinCount) * this->AverageArrays[a]->GetNumberOfComponents(),
+        0.0);
+    }
   }
 
   void operator()(vtkIdType begin, vtkIdType end)
@@ -558,61 +569,68 @@ public:
     auto& tlArrayValues = this->TLArrayValues.Local();
     const auto valueRange = vtk::DataArrayTupleRange(this->DataArray);
     const int numComponents = this->DataArray->GetNumberOfComponents();
+    const double shift = this->CenterBinsAroundMinAndMax ? this->HalfDelta : 0.;
+    const double lastBin = this->BinCount - 1;
+    double values[BinBlockSize];
+    int indices[BinBlockSize];
 
-    for (int i = begin; i < end; ++i)
+    for (vtkIdType blockBegin = begin; blockBegin < end; blockBegin += BinBlockSize)
     {
-      // Skip if the array value is blanked.
-      if (this->Blanking && this->Blanking->GetTypedComponent(i, 0) & this->GhostIndicator)
-      {
-        continue;
-      }
+      const vtkIdType blockSize = std::min(BinBlockSize, end - blockBegin);
 
-      double value;
       // if component is equal to the number of components, then the magnitude was requested.
       if (this->Component == numComponents)
       {
-        value = 0;
-        double comp;
-        for (int j = 0; j < numComponents; ++j)
+        for (vtkIdType i = 0; i < blockSize; ++i)
         {
-          comp = static_cast<double>(valueRange[i][j]);
-          value += comp * comp;
+          double value = 0;
+          for (int j = 0; j < numComponents; ++j)
+          {
+            const double comp = static_cast<double>(valueRange[blockBegin + i][j]);
+            value += comp * comp;
+          }
+          values[i] = std::sqrt(value);
         }
-        value = std::sqrt(value);
       }
       else
       {
-        value = static_cast<double>(valueRange[i][this->Component]);
+        for (vtkIdType i = 0; i < blockSize; ++i)
+        {
+          values[i] = static_cast<double>(valueRange[blockBegin + i][this->Component]);
+        }
       }
-      int index = static_cast<int>(
-        (value - this->Min + (this->CenterBinsAroundMinAndMax ? this->HalfDelta : 0.)) /
-        this->BinDelta);
 
       // If the value is equal to max, include it in the last bin.
-      index = ::vtkExtractHistogramClamp(index, 0, this->BinCount - 1);
-      tlBinValues->SetValue(index, tlBinValues->GetValue(index) + 1);
+      for (vtkIdType i = 0; i < blockSize; ++i)
+      {
+        const double position = (values[i] - this->Min + shift) / this->BinDelta;
+        indices[i] = !(position > 0.) ? 0
+                                      : (position >= lastBin ? this->BinCount - 1
+                                                             : static_cast<int>(position));
+      }
 
-      if (this->CalculateAverages)
+      for (vtkIdType i = 0; i < blockSize; ++i)
       {
-        // Get all other arrays, add their value to the bin
-        // For each bin, we will need 2 values per array ->
-        // total, num. elements
-        // at the end, divide each total by num. elements
-        int numberOfArrays = this->Field->GetNumberOfArrays();
-        for (int idx = 0; idx < numberOfArrays; idx++)
+        const vtkIdType tupleId = blockBegin + i;
+        // Skip if the array value is blanked.
+        if (this->Blanking &&
+          this->Blanking->GetTypedComponent(tupleId, 0) & this->GhostIndicator)
+        {
+          continue;
+        }
+        const int index = indices[i];
+        ++tlBinValues[index];
+
+        // Add the values of all other arrays to the bin, their totals are
+        // divided by the number of elements of the bin at the end
+        for (std::size_t a = 0; a < this->AverageArrays.size(); ++a)
         {
-          vtkDataArray* array = this->Field->GetArray(idx);
-          if (array && array != this->DataArray && array->GetName())
+          vtkDataArray* array = this->AverageArrays[a];
+          const int numComps = array->GetNumberOfComponents();
+          double* totals = tlArrayValues[a].data() + static_cast<std::size_t>(index) * numComps;
+          for (int comp = 0; comp < numComps; comp++)
           {
-            vtkExtractHistogramInternal::ArrayValuesType& arrayValues =
-              tlArrayValues[array->GetName()];
-            arrayValues.TotalValues.resize(this->BinCount);
-            int numComps = array->GetNumberOfComponents();
-            arrayValues.TotalValues[index].resize(numComps);
-            for (int comp = 0; comp < numComps; comp++)
-            {
-              arrayValues.TotalValues[index][comp] += array->GetComponent(i, comp);
-            }
+            totals[comp] += array->GetComponent(tupleId, comp);
           }
         }
       }
@@ -622,52 +640,46 @@ public:
   void Reduce()
   {
     // collect binValues results
+    vtkIdType numberOfValues = 0;
     for (auto& tlBinValues : this->TLBinValues)
     {
       for (int i = 0; i < this->BinCount; ++i)
       {
-        this->BinValues->SetValue(i, this->BinValues->GetValue(i) + tlBinValues->GetValue(i));
+        this->BinValues->SetValue(
+          i, this->BinValues->GetValue(i) + static_cast<int>(tlBinValues[i]));
+        numberOfValues += tlBinValues[i];
       }
     }
 
     // collect arrayValues results
-    if (this->CalculateAverages)
+    if (numberOfValues == 0)
     {
-      int numberOfArrays = this->Field->GetNumberOfArrays();
-      for (int idx = 0; idx < numberOfArrays; idx++)
+      return;
+    }
+    for (std::size_t a = 0; a < this->AverageArrays.size(); ++a)
+    {
+      vtkDataArray* array = this->AverageArrays[a];
+      const int numComps = array->GetNumberOfComponents();
+      vtkExtractHistogramInternal::ArrayValuesType& arrayValuesOfArray =
+        this->ArrayValues[array->GetName()];
+
+      // resizing will occur only if it's needed
+      arrayValuesOfArray.TotalValues.resize(this->BinCount);
+      for (auto& totals : arrayValuesOfArray.TotalValues)
       {
-        vtkDataArray* array = this->Field->GetArray(idx);
-        // if array is not valid move to the next one
-        if (!(array && array != this->DataArray && array->GetName()))
-        {
-          continue;
-        }
+        totals.resize(numComps);
+      }
 
-        int numComps = this->Field->GetArray(array->GetName())->GetNumberOfComponents();
-        // iterate over all thread instances
-        for (auto& tlArrayValues : this->TLArrayValues)
+      // iterate over all thread instances
+      for (auto& tlArrayValues : this->TLArrayValues)
+      {
+        const std::vector<double>& tlTotals = tlArrayValues[a];
+        for (int i = 0; i < this->BinCount; ++i)
         {
-          vtkExtractHistogramInternal::ArrayValuesType& arrayValuesOfArray =
-            this->ArrayValues[array->GetName()];
-          vtkExtractHistogramInternal::ArrayValuesType& tlArrayValuesOfArray =
-            tlArrayValues[array->GetName()];
-
-          // resizing will occur only if it's needed
-          arrayValuesOfArray.TotalValues.resize(this->BinCount);
-
-          for (int i = 0; i < this->BinCount; ++i)
+          for (int comp = 0; comp < numComps; comp++)
           {
-            if (!tlArrayValuesOfArray.TotalValues[i].empty())
-            {
-              // resizing will occur only if it's needed
-              arrayValuesOfArray.TotalValues[i].resize(tlArrayValuesOfArray.TotalValues[i].size());
-
-              for (int comp = 0; comp < numComps; comp++)
-              {
-                arrayValuesOfArray.TotalValues[i][comp] +=
-                  tlArrayValuesOfArray.TotalValues[i][comp];
-              }
-            }
+            arrayValuesOfArray.TotalValues[i][comp] +=
+              tlTotals[static_cast<std::size_t>(i) * numComps + comp];
           }
         }
       }
@@ -680,12 +692,11 @@ struct BinAnArrayWorker
 {
   template <typename ArrayT>
   void operator()(ArrayT* dataArray, vtkFieldData* field, vtkIntArray* binValues,
-    vtkExtractHistogramInternal::ArrayMapType& arrayValues, const char* binValuesArrayName,
-    int binCount, int component, double min, double max, int calculateAverages,
-    bool centerBinsAroundMinAndMax)
+    vtkExtractHistogramInternal::ArrayMapType& arrayValues, int binCount, int component,
+    double min, double max, int calculateAverages, bool centerBinsAroundMinAndMax)
   {
-    BinAnArrayFunctor<ArrayT> functor(dataArray, field, binValues, arrayValues, binValuesArrayName,
-      binCount, component, min, max, calculateAverages, centerBinsAroundMinAndMax);
+    BinAnArrayFunctor<ArrayT> functor(dataArray, field, binValues, arrayValues, binCount, component,
+      min, max, calculateAverages, centerBinsAroundMinAndMax);
     vtkSMPTools::For(0, dataArray->GetNumberOfTuples(), functor);
   }
 };
@@ -709,12 +720,11 @@ void vtkExtractHistogram::BinAnArray(
   using BinAnArrayWorkerDispatch = vtkArrayDispatch::DispatchByArray<FastArrayTypes>;
 
   if (!BinAnArrayWorkerDispatch::Execute(dataArray, BinAnArrayWorker{}, field, binValues,
-        this->Internal->ArrayValues, this->BinValuesArrayName, this->BinCount, this->Component, min,
-        max, this->CalculateAverages, this->CenterBinsAroundMinAndMax))
+        this->Internal->ArrayValues, this->BinCount, this->Component, min, max,
+        this->CalculateAverages, this->CenterBinsAroundMinAndMax))
   {
-    BinAnArrayWorker{}(dataArray, field, binValues, this->Internal->ArrayValues,
-      this->BinValuesArrayName, this->BinCount, this->Component, min, max, this->CalculateAverages,
-      this->CenterBinsAroundMinAndMax);
+    BinAnArrayWorker{}(dataArray, field, binValues, this->Internal->ArrayValues, this->BinCount,
+      this->Component, min, max, this->CalculateAverages, this->CenterBinsAroundMinAndMax);
   }
 }
 
@@ -19,8 +19,12 @@
 #include "vtkUnsignedCharArray.h"
 #include "vtkVariantArray.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
+#include <iterator>
+#include <limits>
 #include <map>
 #include <set>
 #include <vector>
@@ -61,6 +65,239 @@ struct GhostsCounter
   vtkIdType GlobalNumberOfGhosts;
   vtkSMPThreadLocal<vtkIdType> NumberOfGhosts;
 };
+
+//==============================================================================
+// Count the occurrences of the values of a numeric column, optionally
+// quantized, in thread local histograms merged at the end
+struct HistogramBuilder
+{
+  HistogramBuilder(vtkDataArray* values, vtkUnsignedCharArray* ghosts,
+    unsigned char ghostsToSkip, std::map<double, vtkIdType>& histogram)
+    : Values(values)
+    , Ghosts(ghosts)
+    , GhostsToSkip(ghostsToSkip)
+    , Histogram(histogram)
+  {
+  }
+
+  void Initialize() { this->LocalHistogram.Local().clear(); }
+
+  void operator()(vtkIdType startId, vtkIdType endId)
+  {
+    std::map<double, vtkIdType>& histogram = this->LocalHistogram.Local();
+    for (vtkIdType id = startId; id < endId; ++id)
+    {
+      if (this->Ghosts && (this->Ghosts->GetValue(id) & this->GhostsToSkip))
+      {
+        continue;
+      }
+      double reading = this->Values->GetComponent(id, 0);
+      if (this->Quantize)
+      {
+        reading = this->Minimum + std::round((reading - this->Minimum) / this->Width) * this->Width;
+      }
+      ++histogram[reading];
+    }
+  }
+
+  void Reduce()
+  {
+    this->Histogram.clear();
+    for (const std::map<double, vtkIdType>& histogram : this->LocalHistogram)
+    {
+      for (const auto& bin : histogram)
+      {
+        this->Histogram[bin.first] += bin.second;
+      }
+    }
+  }
+
+  vtkDataArray* Values;
+  vtkUnsignedCharArray* Ghosts;
+  unsigned char GhostsToSkip;
+  bool Quantize = false;
+  double Minimum = 0.;
+  double Width = 1.;
+  std::map<double, vtkIdType>& Histogram;
+  vtkSMPThreadLocal<std::map<double, vtkIdType>> LocalHistogram;
+};
+
+//==============================================================================
+// KLL quantile sketch: the values are stored in levels of increasing weight
+// (2^level). When a level is full, it is sorted and every other value is
+// promoted to the next level, so that the total weight is preserved. The
+// capacities of the levels decrease geometrically from the top one, which
+// bounds the size of the sketch to about 3 K values. Compactions keep the
+// values at odd or even positions from a pseudo-random sequence with a fixed
+// seed, so the sketch is deterministic for a given insertion order.
+class QuantileSketch
+{
+public:
+  QuantileSketch() = default;
+  explicit QuantileSketch(std::size_t k)
+    : K(std::max(k, static_cast<std::size_t>(8)))
+  {
+  }
+
+  // Capacity of the top level for a relative rank error, chosen so that the
+  // measured error of the sketch is about half the requested one
+  static std::size_t GetK(double relativeError)
+  {
+    return static_cast<std::size_t>(std::ceil(6. / relativeError));
+  }
+
+  void Insert(double value)
+  {
+    this->Minimum = std::min(this->Minimum, value);
+    this->Maximum = std::max(this->Maximum, value);
+    if (this->Levels.empty())
+    {
+      this->Levels.resize(1);
+    }
+    this->Levels[0].push_back(value);
+    if (this->Levels[0].size() >= this->GetCapacity(0))
+    {
+      this->Compress();
+    }
+  }
+
+  void Merge(const QuantileSketch& other)
+  {
+    this->Minimum = std::min(this->Minimum, other.Minimum);
+    this->Maximum = std::max(this->Maximum, other.Maximum);
+    if (other.Levels.size() > this->Levels.size())
+    {
+      this->Levels.resize(other.Levels.size());
+    }
+    for (std::size_t level = 0; level < other.Levels.size(); ++level)
+    {
+      this->Levels[level].insert(
+        this->Levels[level].end(), other.Levels[level].begin(), other.Levels[level].end());
+    }
+    this->Compress();
+  }
+
+  // Fill a histogram with the weighted values of the sketch. The extremal
+  // values may have been compacted away: they are restored by taking one unit
+  // of weight from the closest values, so that the extrema stay exact.
+  void GetHistogram(std::map<double, vtkIdType>& histogram) const
+  {
+    histogram.clear();
+    for (std::size_t level = 0; level < this->Levels.size(); ++level)
+    {
+      const vtkIdType weight = static_cast<vtkIdType>(1) << level;
+      for (double value : this->Levels[level])
+      {
+        histogram[value] += weight;
+      }
+    }
+    if (histogram.empty())
+    {
+      return;
+    }
+    if (histogram.begin()->first != this->Minimum)
+    {
+      if (--histogram.begin()->second == 0)
+      {
+        histogram.erase(histogram.begin());
+      }
+      ++histogram[this->Minimum];
+    }
+    if (histogram.rbegin()->first != this->Maximum)
+    {
+      auto last = std::prev(histogram.end());
+      if (--last->second == 0)
+      {
+        histogram.erase(last);
+      }
+      ++histogram[this->Maximum];
+    }
+  }
+
+private:
+  std::size_t GetCapacity(std::size_t level) const
+  {
+    const std::size_t depth = this->Levels.size() - level - 1;
+    return std::max(static_cast<std::size_t>(2),
+      static_cast<std::size_t>(std::ceil(this->K * std::pow(2. / 3., depth))));
+  }
+
+  void Compress()
+  {
+    for (std::size_t level = 0; level < this->Levels.size(); ++level)
+    {
+      if (this->Levels[level].size() < this->GetCapacity(level))
+      {
+        continue;
+      }
+      if (level + 1 == this->Levels.size())
+      {
+        this->Levels.emplace_back();
+      }
+      std::vector<double>& values = this->Levels[level];
+      std::sort(values.begin(), values.end());
+
+      // With an odd number of values, the largest one stays at this level
+      const std::size_t numCompacted = values.size() & ~static_cast<std::size_t>(1);
+      this->Random = this->Random * 6364136223846793005ULL + 1442695040888963407ULL;
+      const std::size_t offset = static_cast<std::size_t>(this->Random >> 63);
+      for (std::size_t i = offset; i < numCompacted; i += 2)
+      {
+        this->Levels[level + 1].push_back(values[i]);
+      }
+      values.erase(values.begin(), values.begin() + numCompacted);
+    }
+  }
+
+  std::size_t K = 200;
+  double Minimum = std::numeric_limits<double>::max();
+  double Maximum = std::numeric_limits<double>::lowest();
+  std::vector<std::vector<double>> Levels;
+  std::uint64_t Random = 0x853c49e6748fea9bULL;
+};
+
+//==============================================================================
+// Build the quantile sketch of a numeric column from thread local sketches
+struct SketchBuilder
+{
+  SketchBuilder(vtkDataArray* values, vtkUnsignedCharArray* ghosts, unsigned char ghostsToSkip,
+    std::size_t k)
+    : Values(values)
+    , Ghosts(ghosts)
+    , GhostsToSkip(ghostsToSkip)
+    , Sketch(k)
+    , LocalSketch(QuantileSketch(k))
+  {
+  }
+
+  void Initialize() {}
+
+  void operator()(vtkIdType startId, vtkIdType endId)
+  {
+    QuantileSketch& sketch = this->LocalSketch.Local();
+    for (vtkIdType id = startId; id < endId; ++id)
+    {
+      if (!this->Ghosts || !(this->Ghosts->GetValue(id) & this->GhostsToSkip))
+      {
+        sketch.Insert(this->Values->GetComponent(id, 0));
+      }
+    }
+  }
+
+  void Reduce()
+  {
+    for (const QuantileSketch& sketch : this->LocalSketch)
+    {
+      this->Sketch.Merge(sketch);
+    }
+  }
+
+  vtkDataArray* Values;
+  vtkUnsignedCharArray* Ghosts;
+  unsigned char GhostsToSkip;
+  QuantileSketch Sketch;
+  vtkSMPThreadLocal<QuantileSketch> LocalSketch;
+};
 } // anonymous namespace
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -94,6 +331,8 @@ void vtkOrderStatistics::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "QuantileDefinition: " << this->QuantileDefinition << endl;
   os << indent << "Quantize: " << this->Quantize << endl;
   os << indent << "MaximumHistogramSize: " << this->MaximumHistogramSize << endl;
+  os << indent << "ApproximateQuantiles: " << this->ApproximateQuantiles << endl;
+  os << indent << "QuantileRelativeError: " << this->QuantileRelativeError << endl;
 }
 
 //------------------------------------------------------------------------------
@@ -240,16 +479,21 @@ void vtkOrderStatistics::Learn(
 
       // Calculate histogram
       std::map<double, vtkIdType> histogram;
-      for (vtkIdType r = 0; r < nRow; ++r)
+      HistogramBuilder builder(dvals, ghosts, this->GhostsToSkip, histogram);
+      if (this->ApproximateQuantiles)
       {
-        if (!ghosts || !(ghosts->GetValue(r) & this->GhostsToSkip))
-        {
-          ++histogram[dvals->GetTuple1(r)];
-        }
+        SketchBuilder sketchBuilder(
+          dvals, ghosts, this->GhostsToSkip, QuantileSketch::GetK(this->QuantileRelativeError));
+        vtkSMPTools::For(0, nRow, sketchBuilder);
+        sketchBuilder.Sketch.GetHistogram(histogram);
+      }
+      else
+      {
+        vtkSMPTools::For(0, nRow, builder);
       }
 
       // If maximum size was requested, make sure it is satisfied
-      if (this->Quantize)
+      if (this->Quantize && !this->ApproximateQuantiles)
       {
         // Retrieve achieved histogram size
         vtkIdType Nq = static_cast<vtkIdType>(histogram.size());
@@ -266,19 +510,10 @@ void vtkOrderStatistics::Learn(
           double width = (maxi - mini) / std::round(Nq / 2.);
 
           // Now re-calculate histogram by quantizing values
-          histogram.clear();
-          double reading;
-          double quantum;
-          for (vtkIdType r = 0; r < nRow; ++r)
-          {
-            if (ghosts && (ghosts->GetValue(r) & this->GhostsToSkip))
-            {
-              continue;
-            }
-            reading = dvals->GetTuple1(r);
-            quantum = mini + std::round((reading - mini) / width) * width;
-            ++histogram[quantum];
-          }
+          builder.Quantize = true;
+          builder.Minimum = mini;
+          builder.Width = width;
+          vtkSMPTools::For(0, nRow, builder);
 
           // Update histogram size for conditional clause
           Nq = static_cast<vtkIdType>(histogram.size());
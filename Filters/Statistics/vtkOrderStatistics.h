@@ -9,7 +9,9 @@
  * Given a selection of columns of interest in an input data table, this
  * class provides the following functionalities, depending on the
  * execution mode it is executed in:
- * * Learn: calculate histogram.
+ * * Learn: calculate histogram. For numeric columns, the histogram can be
+ *   approximated by a mergeable quantile sketch of bounded size, see
+ *   ApproximateQuantiles.
  * * Derive: calculate PDFs and arbitrary quantiles. Provide specific names when 5-point
  *   statistics (minimum, 1st quartile, median, third quartile, maximum) requested.
  * * Assess: given an input data set and a set of q-quantiles, label each datum
@@ -86,6 +88,34 @@ public:
   vtkGetMacro(MaximumHistogramSize, vtkIdType);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get whether the histograms of numeric columns are replaced by a
+   * quantile sketch (KLL) of bounded size, which is built in one pass with
+   * constant memory. The sketch keeps a subset of the values, each weighted by
+   * the number of values it stands for, and is stored in the model as a
+   * histogram, so that the derived quantiles are approximate. Such models are
+   * merged like exact ones by vtkPOrderStatistics.
+   * When enabled, Quantize is ignored for numeric columns.
+   * Default is false.
+   */
+  vtkSetMacro(ApproximateQuantiles, bool);
+  vtkGetMacro(ApproximateQuantiles, bool);
+  vtkBooleanMacro(ApproximateQuantiles, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the targeted error of the approximate quantiles, as a fraction of
+   * the number of values: a derived quantile has a rank within this fraction of
+   * the exact one. The smaller, the larger the sketch.
+   * This error is used only when ApproximateQuantiles is true.
+   * Default is 0.01.
+   */
+  vtkSetClampMacro(QuantileRelativeError, double, 1e-6, 0.5);
+  vtkGetMacro(QuantileRelativeError, double);
+  ///@}
+
   /**
    * Get the quantile definition.
    */
@@ -158,6 +188,8 @@ protected:
   QuantileDefinitionType QuantileDefinition;
   bool Quantize;
   vtkIdType MaximumHistogramSize;
+  bool ApproximateQuantiles = false;
+  double QuantileRelativeError = 0.01;
   vtkIdType NumberOfGhosts;
   unsigned char GhostsToSkip;
 
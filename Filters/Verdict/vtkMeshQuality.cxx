@@ -9,15 +9,22 @@
 #include "vtkDataArray.h"
 #include "vtkDataSet.h"
 #include "vtkDoubleArray.h"
+#include "vtkForEachCell.h"
 #include "vtkGenericCell.h"
+#include "vtkHexahedron.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkLogger.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
 #include "vtkPoints.h"
+#include "vtkPyramid.h"
+#include "vtkQuad.h"
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
+#include "vtkTetra.h"
+#include "vtkTriangle.h"
+#include "vtkWedge.h"
 
 #include "vtk_verdict.h"
 
@@ -99,6 +106,65 @@ void LinearizeCell(int& cellType)
       break;
   }
 }
+
+//----------------------------------------------------------------------------
+// Per-thread linear cells holding the corner points of the cells to measure.
+// The quality measures only read the points of the cells, so the cells are
+// visited with vtk::ForEachCell() instead of being copied with GetCell().
+class vtkLinearCells
+{
+public:
+  // Return the linear cell of type cellType with the first points of pts, or
+  // nullptr if cellType is not a linear type measured by vtkMeshQuality.
+  vtkCell* Get(vtkDataSet* dataSet, int cellType, vtkIdType npts, const vtkIdType* pts)
+  {
+    vtkCell* cell;
+    switch (cellType)
+    {
+      case VTK_TRIANGLE:
+        cell = this->Triangle.Local();
+        break;
+      case VTK_QUAD:
+        cell = this->Quad.Local();
+        break;
+      case VTK_TETRA:
+        cell = this->Tetra.Local();
+        break;
+      case VTK_PYRAMID:
+        cell = this->Pyramid.Local();
+        break;
+      case VTK_WEDGE:
+        cell = this->Wedge.Local();
+        break;
+      case VTK_HEXAHEDRON:
+        cell = this->Hexahedron.Local();
+        break;
+      default:
+        return nullptr;
+    }
+    const vtkIdType numberOfCorners = cell->GetNumberOfPoints();
+    if (npts < numberOfCorners)
+    {
+      return nullptr;
+    }
+    vtkPoints* points = cell->GetPoints();
+    double x[3];
+    for (vtkIdType i = 0; i < numberOfCorners; ++i)
+    {
+      dataSet->GetPoint(pts[i], x);
+      points->SetPoint(i, x);
+    }
+    return cell;
+  }
+
+private:
+  vtkSMPThreadLocalObject<vtkTriangle> Triangle;
+  vtkSMPThreadLocalObject<vtkQuad> Quad;
+  vtkSMPThreadLocalObject<vtkTetra> Tetra;
+  vtkSMPThreadLocalObject<vtkPyramid> Pyramid;
+  vtkSMPThreadLocalObject<vtkWedge> Wedge;
+  vtkSMPThreadLocalObject<vtkHexahedron> Hexahedron;
+};
 } // anonymous namespace
 
 /**
@@ -125,7 +191,7 @@ struct CellQualityStats
 class vtkSizeFunctor
 {
 private:
-  vtkSMPThreadLocalObject<vtkGenericCell> Cell;
+  vtkLinearCells LinearCells;
   vtkDataSet* Output;
   vtkSMPThreadLocal<CellQualityStats> TLTriangleStats, TLQuadStats, TLTetStats, TLPyrStats,
     TLWedgeStats, TLHexStats;
@@ -187,19 +253,13 @@ public:
     CellQualityStats& pyrStats = this->TLPyrStats.Local();
     CellQualityStats& wedgeStats = this->TLWedgeStats.Local();
     CellQualityStats& hexStats = this->TLHexStats.Local();
-    vtkGenericCell* genericCell = this->Cell.Local();
-    vtkCell* cell;
     double area, volume; // area and volume
 
-    for (vtkIdType cellId = begin; cellId < end; ++cellId)
-    {
-      this->Output->GetCell(cellId, genericCell);
-      cell = genericCell->GetRepresentativeCell();
-
-      int cellType = cell->GetCellType();
+    auto measureCell = [&](vtkIdType, int cellType, vtkIdType npts, const vtkIdType* pts) {
       LinearizeCell(cellType);
+      vtkCell* cell = this->LinearCells.Get(this->Output, cellType, npts, pts);
 
-      switch (cellType)
+      switch (cell ? cellType : VTK_EMPTY_CELL)
       {
         case VTK_TRIANGLE:
           area = vtkMeshQuality::TriangleArea(cell);
@@ -312,7 +372,8 @@ public:
         default:
           break;
       }
-    }
+    };
+    vtk::ForEachCell(this->Output, begin, end, measureCell);
   }
   void Reduce()
   {
@@ -349,7 +410,7 @@ public:
 class vtkMeshQualityFunctor
 {
 private:
-  vtkSMPThreadLocalObject<vtkGenericCell> Cell;
+  vtkLinearCells LinearCells;
   vtkMeshQuality* MeshQuality;
   vtkDataSet* Output;
   vtkSmartPointer<vtkDoubleArray> QualityArray;
@@ -432,23 +493,16 @@ public:
     CellQualityStats& pyrStats = this->TLPyrStats.Local();
     CellQualityStats& wedgeStats = this->TLWedgeStats.Local();
     CellQualityStats& hexStats = this->TLHexStats.Local();
-    vtkGenericCell* genericCell = this->Cell.Local();
-    vtkCell* cell;
     vtkDoubleArray* qualityArrays[2] = { this->QualityArray, this->ApproxQualityArray };
     double quality;
 
-    for (vtkIdType cellId = begin; cellId < end; ++cellId)
-    {
-      this->Output->GetCell(cellId, genericCell);
-      cell = genericCell->GetRepresentativeCell();
-
+    auto measureCell = [&](vtkIdType cellId, int cellType, vtkIdType npts, const vtkIdType* pts) {
       int numberOfOutputQualities = this->MeshQuality->LinearApproximation ? 2 : 1;
 
-      int cellType = cell->GetCellType();
-
       for (int qualityId = 0; qualityId < numberOfOutputQualities; ++qualityId)
       {
-        switch (cellType)
+        vtkCell* cell = this->LinearCells.Get(this->Output, cellType, npts, pts);
+        switch (cell ? cellType : VTK_EMPTY_CELL)
         {
           case VTK_TRIANGLE:
             quality = this->TriangleQuality(cell);
@@ -577,7 +631,8 @@ public:
           LinearizeCell(cellType);
         }
       }
-    }
+    };
+    vtk::ForEachCell(this->Output, begin, end, measureCell);
   }
   void Reduce()
   {
@@ -8,9 +8,186 @@
 #include "vtkGeoProjection.h"
 #include "vtkMath.h"
 #include "vtkPoints.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 
 #include "vtk_libproj.h"
 #include <cmath>
+#include <utility>
+#include <vector>
+
+#if PROJ_VERSION_MAJOR > 6 || (PROJ_VERSION_MAJOR == 6 && PROJ_VERSION_MINOR >= 2)
+#define VTK_GEO_TRANSFORM_CAN_CLONE_PROJECTIONS
+#endif
+
+namespace
+{
+#if PROJ_VERSION_MAJOR >= 5
+// Number of points below which the points are transformed by a single thread,
+// each thread has to clone the projections before transforming its points.
+constexpr vtkIdType PARALLEL_GRAIN = 16384;
+
+//------------------------------------------------------------------------------
+// Transform the (x, y), and z if asked, coordinates of numPts points, stored
+// every stride values from x, in a single call to PROJ.
+void TransformCoordinates(
+  PJ* projection, PJ_DIRECTION direction, double* x, vtkIdType numPts, int stride, bool withZ)
+{
+  const size_t step = sizeof(*x) * stride;
+  const size_t count = static_cast<size_t>(numPts);
+  proj_trans_generic(projection, direction, x, step, count, x + 1, step, count,
+    withZ ? x + 2 : nullptr, withZ ? step : 0, withZ ? count : 0, nullptr, 0, 0);
+}
+
+//------------------------------------------------------------------------------
+// Convert the (x, y) coordinates of numPts points from degrees to radians, or
+// the other way around.
+void ConvertAngles(double* x, vtkIdType numPts, int stride, bool toRadians)
+{
+  for (vtkIdType i = 0; i < numPts; ++i, x += stride)
+  {
+    for (int j = 0; j < 2; ++j)
+    {
+      x[j] = toRadians ? vtkMath::RadiansFromDegrees(x[j]) : vtkMath::DegreesFromRadians(x[j]);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Projections applied to a range of points. When the source projection is
+// null, the points are in degrees. When the destination projection is null,
+// the points are returned in degrees. When withZ is true, the source
+// projection is a single transformation to the destination system.
+struct vtkGeoTransformStages
+{
+  PJ* Source = nullptr;
+  PJ* Destination = nullptr;
+  bool WithZ = false;
+
+  void Transform(double* x, vtkIdType numPts, int stride) const
+  {
+    if (this->WithZ)
+    {
+      ::TransformCoordinates(this->Source, PJ_FWD, x, numPts, stride, true);
+      return;
+    }
+    if (this->Source)
+    {
+      // Convert from src system to lat/long using inverse of src transform
+      ::TransformCoordinates(this->Source, PJ_INV, x, numPts, stride, false);
+    }
+    else
+    {
+      // src coords are in degrees, convert to radians
+      ::ConvertAngles(x, numPts, stride, true);
+    }
+    if (this->Destination)
+    {
+      ::TransformCoordinates(this->Destination, PJ_FWD, x, numPts, stride, false);
+    }
+    else
+    {
+      // dst coords are in radians, convert to degrees
+      ::ConvertAngles(x, numPts, stride, false);
+    }
+  }
+};
+
+#ifdef VTK_GEO_TRANSFORM_CAN_CLONE_PROJECTIONS
+//------------------------------------------------------------------------------
+// Clones of the projections of a thread, in their own context: PROJ objects
+// and contexts cannot be used by several threads at once.
+struct vtkGeoTransformThreadStages
+{
+  PJ_CONTEXT* Context = nullptr;
+  vtkGeoTransformStages Stages;
+  bool Valid = false;
+
+  bool Clone(const vtkGeoTransformStages& stages)
+  {
+    this->Context = proj_context_create();
+    this->Stages.WithZ = stages.WithZ;
+    this->Stages.Source = stages.Source ? proj_clone(this->Context, stages.Source) : nullptr;
+    this->Stages.Destination =
+      stages.Destination ? proj_clone(this->Context, stages.Destination) : nullptr;
+    this->Valid = this->Context && (!stages.Source || this->Stages.Source) &&
+      (!stages.Destination || this->Stages.Destination);
+    return this->Valid;
+  }
+
+  void Release()
+  {
+    if (this->Stages.Source)
+    {
+      proj_destroy(this->Stages.Source);
+    }
+    if (this->Stages.Destination)
+    {
+      proj_destroy(this->Stages.Destination);
+    }
+    if (this->Context)
+    {
+      proj_context_destroy(this->Context);
+    }
+    *this = vtkGeoTransformThreadStages();
+  }
+};
+#endif
+
+//------------------------------------------------------------------------------
+// Transform the points in batches, split across threads when the projections
+// can be cloned for each thread.
+void TransformInParallel(
+  const vtkGeoTransformStages& stages, double* x, vtkIdType numPts, int stride)
+{
+#ifdef VTK_GEO_TRANSFORM_CAN_CLONE_PROJECTIONS
+  bool parallel = numPts > PARALLEL_GRAIN;
+  if (parallel)
+  {
+    // Projections created from arguments rather than a definition cannot be
+    // cloned, check it once before splitting the work.
+    vtkGeoTransformThreadStages probe;
+    parallel = probe.Clone(stages);
+    probe.Release();
+  }
+  if (parallel)
+  {
+    vtkSMPThreadLocal<vtkGeoTransformThreadStages> threadStages;
+    vtkSMPThreadLocal<std::vector<std::pair<vtkIdType, vtkIdType>>> skipped;
+    vtkSMPTools::For(0, numPts, PARALLEL_GRAIN, [&](vtkIdType begin, vtkIdType end) {
+      vtkGeoTransformThreadStages& local = threadStages.Local();
+      if (!local.Valid && !local.Context)
+      {
+        local.Clone(stages);
+      }
+      if (local.Valid)
+      {
+        local.Stages.Transform(x + begin * stride, end - begin, stride);
+      }
+      else
+      {
+        skipped.Local().emplace_back(begin, end);
+      }
+    });
+    for (auto& local : threadStages)
+    {
+      local.Release();
+    }
+    // Ranges of threads that could not clone the projections
+    for (const auto& ranges : skipped)
+    {
+      for (const auto& range : ranges)
+      {
+        stages.Transform(x + range.first * stride, range.second - range.first, stride);
+      }
+    }
+    return;
+  }
+#endif
+  stages.Transform(x, numPts, stride);
+}
+#endif
+}
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkGeoTransform);
@@ -170,65 +347,13 @@ void vtkGeoTransform::InternalTransformPoints(double* x, vtkIdType numPts, int s
 #if PROJ_VERSION_MAJOR < 5
   vtkErrorMacro("VTK requires proj version >= 5.0.0 ");
 #else
-  projPJ src = this->SourceProjection ? this->SourceProjection->GetProjection() : nullptr;
-  projPJ dst = this->DestinationProjection ? this->DestinationProjection->GetProjection() : nullptr;
-  int delta = stride - 2;
+  vtkGeoTransformStages stages;
+  stages.Source = this->SourceProjection ? this->SourceProjection->GetProjection() : nullptr;
+  stages.Destination =
+    this->DestinationProjection ? this->DestinationProjection->GetProjection() : nullptr;
   if (!this->TransformZCoordinate)
   {
-    PJ_COORD c, c_out;
-    if (src)
-    {
-      // Convert from src system to lat/long using inverse of src transform
-      double* coord = x;
-      for (vtkIdType i = 0; i < numPts; ++i)
-      {
-        c.xy.x = coord[0];
-        c.xy.y = coord[1];
-        c_out = proj_trans(src, PJ_INV, c);
-        coord[0] = c_out.lp.lam;
-        coord[1] = c_out.lp.phi;
-        coord += stride;
-      }
-    }
-    else // ! src
-    {
-      // src coords are in degrees, convert to radians
-      double* coord = x;
-      for (vtkIdType i = 0; i < numPts; ++i)
-      {
-        for (int j = 0; j < 2; ++j, ++coord)
-        {
-          *coord = vtkMath::RadiansFromDegrees(*coord);
-        }
-        coord += delta;
-      }
-    }
-    if (dst)
-    {
-      double* coord = x;
-      for (vtkIdType i = 0; i < numPts; ++i)
-      {
-        c.lp.lam = coord[0];
-        c.lp.phi = coord[1];
-        c_out = proj_trans(dst, PJ_FWD, c);
-        coord[0] = c_out.xy.x;
-        coord[1] = c_out.xy.y;
-        coord += stride;
-      }
-    }
-    else // ! dst
-    {
-      // dst coords are in radians, convert to degrees
-      double* coord = x;
-      for (vtkIdType i = 0; i < numPts; ++i)
-      {
-        for (int j = 0; j < 2; ++j, ++coord)
-        {
-          *coord = vtkMath::DegreesFromRadians(*coord);
-        }
-        coord += delta;
-      }
-    }
+    ::TransformInParallel(stages, x, numPts, stride);
   }
   else
   {
@@ -257,8 +382,10 @@ void vtkGeoTransform::InternalTransformPoints(double* x, vtkIdType numPts, int s
     proj_destroy(P);
     P = P_for_GIS;
 
-    proj_trans_generic(P, PJ_FWD, x, sizeof(*x) * stride, numPts, x + 1, sizeof(*x) * stride,
-      numPts, x + 2, sizeof(*x) * stride, numPts, nullptr, 0, 0);
+    vtkGeoTransformStages crsToCrs;
+    crsToCrs.Source = P;
+    crsToCrs.WithZ = true;
+    ::TransformInParallel(crsToCrs, x, numPts, stride);
     proj_destroy(P);
   }
 #endif
@@ -75,7 +75,9 @@ public:
   ///@}
 
   /**
-   * Transform many points at once.
+   * Transform many points at once. The points are handed to PROJ in batches,
+   * split across vtkSMPTools threads for large sets of points, each thread
+   * transforming with its own clone of the projections.
    */
   void TransformPoints(vtkPoints* src, vtkPoints* dst) override;
 
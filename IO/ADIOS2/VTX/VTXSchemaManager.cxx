@@ -24,8 +24,8 @@ namespace vtx
 VTK_ABI_NAMESPACE_BEGIN
 
 // PUBLIC
-void VTXSchemaManager::Update(
-  const std::string& streamName, size_t /*step*/, const std::string& schemaName)
+void VTXSchemaManager::Update(const std::string& streamName, size_t /*step*/,
+  const std::string& schemaName, const std::string& engineType, float timeout)
 {
   // can't do it in the constructor as it need MPI initialized
   if (!this->ADIOS)
@@ -44,13 +44,26 @@ void VTXSchemaManager::Update(
 
     const std::string fileName = helper::GetFileName(this->StreamName);
     this->IO = this->ADIOS->DeclareIO(fileName);
-    this->IO.SetEngine("BPFile");
+    this->IO.SetEngine(engineType);
+    this->Streaming = helper::IsStreamingEngine(engineType);
+    if (this->Streaming)
+    {
+      // variables and attributes of a stream are only available within a step
+      this->Engine = this->IO.Open(fileName, adios2::Mode::Read);
+      if (!BeginStep(timeout))
+      {
+        throw std::runtime_error("ERROR: no step available in stream " + fileName + "\n");
+      }
+    }
+    else
+    {
 #if IOADIOS2_BP5_RANDOM_ACCESS
-    // ReadRandomAccess necessary for BP5 format, optional for BP3/4
-    this->Engine = this->IO.Open(fileName, adios2::Mode::ReadRandomAccess);
+      // ReadRandomAccess necessary for BP5 format, optional for BP3/4
+      this->Engine = this->IO.Open(fileName, adios2::Mode::ReadRandomAccess);
 #else
-    this->Engine = this->IO.Open(fileName, adios2::Mode::Read);
+      this->Engine = this->IO.Open(fileName, adios2::Mode::Read);
 #endif
+    }
     InitReader();
   }
   else
@@ -64,6 +77,47 @@ void VTXSchemaManager::Fill(vtkMultiBlockDataSet* multiBlock, size_t step)
   this->Reader->Fill(multiBlock, step);
 }
 
+bool VTXSchemaManager::BeginStep(float timeout)
+{
+  if (!this->Streaming || this->StepInProgress)
+  {
+    return this->Streaming;
+  }
+
+  this->Status = this->Engine.BeginStep(adios2::StepMode::Read, timeout);
+  if (this->Status != adios2::StepStatus::OK)
+  {
+    return false;
+  }
+  this->StepInProgress = true;
+  this->Step = this->Engine.CurrentStep();
+  // the reader is created after the first step, as it needs its schema
+  if (this->Reader)
+  {
+    this->Reader->UpdateTimes();
+  }
+  return true;
+}
+
+void VTXSchemaManager::EndStep()
+{
+  if (this->StepInProgress)
+  {
+    this->Engine.EndStep();
+    this->StepInProgress = false;
+  }
+}
+
+bool VTXSchemaManager::IsStreaming() const noexcept
+{
+  return this->Streaming;
+}
+
+bool VTXSchemaManager::IsEndOfStream() const noexcept
+{
+  return this->Status == adios2::StepStatus::EndOfStream;
+}
+
 // PRIVATE
 const std::set<std::string> VTXSchemaManager::SupportedTypes = { "ImageData", "UnstructuredGrid" };
 // TODO: , "StructuredGrid", "PolyData" };
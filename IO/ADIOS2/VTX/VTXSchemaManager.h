@@ -45,9 +45,34 @@ public:
    * @param step input current step
    * @param schemaName schema name to look for either as attribute or separate
    * file
+   * @param engineType adios2 engine type, streaming engines (e.g. SST) begin
+   * their first step to read the schema
+   * @param timeout input seconds to wait for the first step of a stream, -1
+   * waits forever
    */
-  void Update(
-    const std::string& streamName, size_t step = 0, const std::string& schemaName = "vtk.xml");
+  void Update(const std::string& streamName, size_t step = 0,
+    const std::string& schemaName = "vtk.xml", const std::string& engineType = "BPFile",
+    float timeout = -1.0f);
+
+  /**
+   * Begins the next step of a streaming engine, unless a step is in progress,
+   * and updates Step and the schema times
+   * @param timeout input seconds to wait for the step, -1 waits forever
+   * @return true: a step is in progress, false: end of stream or timeout
+   */
+  bool BeginStep(float timeout = -1.0f);
+
+  /**
+   * Ends the step in progress of a streaming engine, so that the writer can
+   * reuse it while the data read is processed
+   */
+  void EndStep();
+
+  /** true: the engine is a streaming engine read step by step */
+  bool IsStreaming() const noexcept;
+
+  /** true: the last BeginStep reached the end of the stream */
+  bool IsEndOfStream() const noexcept;
 
   /**
    * Fill multiblock data
@@ -72,6 +97,15 @@ private:
   /** carries the schema information */
   std::string SchemaName;
 
+  /** true: the engine is a streaming engine */
+  bool Streaming = false;
+
+  /** true: a step of the streaming engine is in progress */
+  bool StepInProgress = false;
+
+  /** last status returned by BeginStep */
+  adios2::StepStatus Status = adios2::StepStatus::OK;
+
   static const std::set<std::string> SupportedTypes;
 
   /** we can extend this to add more schemas */
@@ -345,6 +345,12 @@ std::string GetEngineType(const std::string& fileName) noexcept
   return engineType;
 }
 
+bool IsStreamingEngine(const std::string& engineType) noexcept
+{
+  const std::string type = vtksys::SystemTools::LowerCase(engineType);
+  return type == "sst" || type == "ssc" || type == "dataman";
+}
+
 bool EndsWith(const std::string& input, const std::string& ends) noexcept
 {
   if (input.length() >= ends.length())
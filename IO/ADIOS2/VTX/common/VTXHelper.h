@@ -201,6 +201,13 @@ std::string GetFileName(const std::string& fileName) noexcept;
  */
 std::string GetEngineType(const std::string& fileName) noexcept;
 
+/**
+ * Check if an engine type streams steps instead of reading them from files
+ * @param engineType input adios2 engine type, case insensitive (e.g. SST)
+ * @return true: steps must be read in order with BeginStep/EndStep, false: file engine
+ */
+bool IsStreamingEngine(const std::string& engineType) noexcept;
+
 /**
  * Check if input ends with a certain (ends) string
  * @param input string input
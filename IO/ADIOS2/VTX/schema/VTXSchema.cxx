@@ -33,11 +33,25 @@ void VTXSchema::Fill(vtkMultiBlockDataSet* multiBlock, size_t step)
   DoFill(multiBlock, step);
 }
 
+void VTXSchema::UpdateTimes()
+{
+  this->Times.clear();
+  InitTimes();
+}
+
 // PROTECTED
 void VTXSchema::GetTimes(const std::string& variableName)
 {
   if (variableName.empty())
   {
+    if (helper::IsStreamingEngine(this->IO.EngineType()))
+    {
+      // only the current step is available in a stream
+      const size_t step = this->Engine.CurrentStep();
+      this->Times[static_cast<double>(step)] = step;
+      return;
+    }
+
     // set default steps as "timesteps"
     const size_t steps = this->Engine.Steps();
     for (size_t step = 0; step < steps; ++step)
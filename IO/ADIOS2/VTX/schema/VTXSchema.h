@@ -66,6 +66,12 @@ public:
    */
   void Fill(vtkMultiBlockDataSet* multiBlock, size_t step = 0);
 
+  /**
+   * Refreshes Times, needed after each new step of a streaming engine as
+   * only the current step is available
+   */
+  void UpdateTimes();
+
 protected:
   adios2::IO& IO;
   adios2::Engine& Engine;
@@ -36,8 +36,9 @@ void VTXSchema::GetDataArrayCommon(
       return;
     }
   }
-  else
+  else if (!helper::IsStreamingEngine(this->IO.EngineType()))
   {
+    // a stream only gives access to its current step
     variable.SetStepSelection({ step, 1 });
   }
 
@@ -143,6 +144,14 @@ template <class T>
 void VTXSchema::GetTimesCommon(const std::string& variableName)
 {
   adios2::Variable<T> varTime = this->IO.InquireVariable<T>(variableName);
+  if (helper::IsStreamingEngine(this->IO.EngineType()))
+  {
+    // only the time of the current step is available in a stream
+    T timeValue;
+    this->Engine.Get(varTime, timeValue, adios2::Mode::Sync);
+    this->Times[static_cast<double>(timeValue)] = this->Engine.CurrentStep();
+    return;
+  }
   varTime.SetStepSelection({ 0, varTime.Steps() });
   std::vector<T> timeValues;
   this->Engine.Get(varTime, timeValues, adios2::Mode::Sync);
@@ -39,7 +39,13 @@ vtkADIOS2VTXReader::~vtkADIOS2VTXReader()
 int vtkADIOS2VTXReader::RequestInformation(vtkInformation* vtkNotUsed(inputVector),
   vtkInformationVector** vtkNotUsed(inputVector), vtkInformationVector* outputVector)
 {
-  this->SchemaManager->Update(FileName); // check if FileName changed
+  // check if FileName changed
+  this->SchemaManager->Update(FileName, 0, "vtk.xml", this->EngineType, this->StepTimeout);
+  if (this->SchemaManager->IsStreaming())
+  {
+    // steps of a stream are read in order, without random access to their times
+    return 1;
+  }
 
   // set time info
   const std::vector<double> vTimes =
@@ -59,6 +65,11 @@ int vtkADIOS2VTXReader::RequestInformation(vtkInformation* vtkNotUsed(inputVecto
 int vtkADIOS2VTXReader::RequestUpdateExtent(
   vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector)
 {
+  if (this->SchemaManager->IsStreaming())
+  {
+    return 1;
+  }
+
   vtkInformation* info = outputVector->GetInformationObject(0);
   const double newTime = info->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP());
   this->SchemaManager->Step = this->SchemaManager->Reader->Times[newTime];
@@ -73,14 +84,33 @@ int vtkADIOS2VTXReader::RequestData(vtkInformation* vtkNotUsed(inputVector),
   vtkDataObject* output = info->Get(vtkDataObject::DATA_OBJECT());
   vtkMultiBlockDataSet* multiBlock = vtkMultiBlockDataSet::SafeDownCast(output);
 
+  if (this->SchemaManager->IsStreaming())
+  {
+    // the first step is begun when opening the stream, the next ones here
+    if (!this->SchemaManager->BeginStep(this->StepTimeout))
+    {
+      return 1;
+    }
+    this->SchemaManager->Time = this->SchemaManager->Reader->Times.begin()->first;
+  }
+
   output->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(), this->SchemaManager->Time);
   this->SchemaManager->Fill(multiBlock, this->SchemaManager->Step);
+  // the data of the step is read by now, release the step to the writer
+  this->SchemaManager->EndStep();
   return 1;
 }
 
+bool vtkADIOS2VTXReader::GetEndOfStream()
+{
+  return this->SchemaManager->IsEndOfStream();
+}
+
 void vtkADIOS2VTXReader::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
   os << indent << "File Name: " << (this->FileName ? this->FileName : "(none)") << "\n";
+  os << indent << "Engine Type: " << this->EngineType << "\n";
+  os << indent << "Step Timeout: " << this->StepTimeout << "\n";
 }
 VTK_ABI_NAMESPACE_END
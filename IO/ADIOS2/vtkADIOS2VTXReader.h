@@ -15,6 +15,7 @@
 #define vtkADIOS2VTXReader_h
 
 #include <memory> // std::unique_ptr
+#include <string> // std::string
 
 #include "vtkIOADIOS2Module.h" // For export macro
 #include "vtkMultiBlockDataSetAlgorithm.h"
@@ -43,6 +44,36 @@ public:
   vtkSetFilePathMacro(FileName);
   vtkGetFilePathMacro(FileName);
 
+  ///@{
+  /**
+   * Set/Get the ADIOS2 engine type used to open FileName. Default is "BPFile".
+   * With a streaming engine such as "SST", FileName is the stream name and the
+   * steps are read in order, one step each time the reader executes: call
+   * Modified() and Update() to read the next step. Each step is released to
+   * the writer as soon as its data is read, so that the writer and the
+   * transport of the next step proceed while the output is processed. Time
+   * steps are not reported in the pipeline information for a stream.
+   */
+  vtkSetMacro(EngineType, std::string);
+  vtkGetMacro(EngineType, std::string);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the number of seconds to wait for the next step of a streaming
+   * engine. A negative value waits until the step is available, which is the
+   * default. When no step is available in time, the output is left empty.
+   */
+  vtkSetMacro(StepTimeout, float);
+  vtkGetMacro(StepTimeout, float);
+  ///@}
+
+  /**
+   * Return true when the last execution of the reader reached the end of the
+   * stream of a streaming engine.
+   */
+  bool GetEndOfStream();
+
 protected:
   vtkADIOS2VTXReader();
   ~vtkADIOS2VTXReader() override;
@@ -59,6 +90,8 @@ protected:
 
 private:
   char* FileName;
+  std::string EngineType = "BPFile";
+  float StepTimeout = -1.0f;
   std::unique_ptr<vtx::VTXSchemaManager> SchemaManager;
 };
 
@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkArrowCDataInterface.h"
+#include "vtkArrowUtilities.h"
+#include "vtkBitArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkSOADataArrayTemplate.h"
+#include "vtkStringArray.h"
+#include "vtkTable.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+namespace
+{
+int NumberOfReleases = 0;
+
+// A float column with a null value, produced the way an Arrow library would.
+struct Producer
+{
+  float Values[4] = { 1.f, 2.f, 3.f, 4.f };
+  uint8_t Validity[1] = { 0x0b }; // values 0, 1 and 3 are valid
+  const void* Buffers[2] = { Validity, Values };
+};
+
+void ReleaseProducerArray(ArrowArray* array)
+{
+  ++NumberOfReleases;
+  array->release = nullptr;
+}
+
+void ReleaseProducerSchema(ArrowSchema* schema)
+{
+  schema->release = nullptr;
+}
+
+#define CHECK(condition)                                                                           \
+  do                                                                                               \
+  {                                                                                                \
+    if (!(condition))                                                                              \
+    {                                                                                              \
+      std::cerr << "Failed check at line " << __LINE__ << ": " #condition << std::endl;           \
+      return EXIT_FAILURE;                                                                         \
+    }                                                                                              \
+  } while (false)
+}
+
+int TestArrowUtilities(int, char*[])
+{
+  vtkNew<vtkTable> table;
+  vtkNew<vtkDoubleArray> vectors;
+  vectors->SetName("vectors");
+  vectors->SetNumberOfComponents(3);
+  vtkNew<vtkIntArray> ints;
+  ints->SetName("ints");
+  vtkNew<vtkSOADataArrayTemplate<float>> soa;
+  soa->SetName("soa");
+  vtkNew<vtkStringArray> strings;
+  strings->SetName("strings");
+  vtkNew<vtkBitArray> bits;
+  bits->SetName("bits");
+  for (int i = 0; i < 10; ++i)
+  {
+    vectors->InsertNextTuple3(i, 2 * i, 3 * i);
+    ints->InsertNextValue(-i);
+    soa->InsertNextValue(0.5f * i);
+    strings->InsertNextValue(std::string(i, 'a' + i));
+    bits->InsertNextValue(i % 3 == 0);
+  }
+  table->AddColumn(vectors);
+  table->AddColumn(ints);
+  table->AddColumn(soa);
+  table->AddColumn(strings);
+  table->AddColumn(bits);
+
+  // Export, the numeric buffers being shared.
+  ArrowSchema schema;
+  ArrowArray array;
+  CHECK(vtkArrowUtilities::ExportTable(table, &schema, &array));
+  CHECK(std::strcmp(schema.format, "+s") == 0);
+  CHECK(schema.n_children == 5 && array.n_children == 5 && array.length == 10);
+  CHECK(std::strcmp(schema.children[0]->format, "+w:3") == 0);
+  CHECK(std::strcmp(schema.children[0]->name, "vectors") == 0);
+  CHECK(array.children[0]->children[0]->buffers[1] == vectors->GetPointer(0));
+  CHECK(std::strcmp(schema.children[1]->format, "i") == 0);
+  CHECK(array.children[1]->buffers[1] == ints->GetPointer(0));
+  CHECK(std::strcmp(schema.children[2]->format, "f") == 0);
+  CHECK(std::strcmp(schema.children[3]->format, "u") == 0);
+  CHECK(std::strcmp(schema.children[4]->format, "b") == 0);
+
+  // Import back, the numeric buffers being shared again.
+  vtkNew<vtkTable> imported;
+  CHECK(vtkArrowUtilities::ImportTable(&schema, &array, imported));
+  CHECK(schema.release == nullptr && array.release == nullptr);
+  CHECK(imported->GetNumberOfColumns() == 5 && imported->GetNumberOfRows() == 10);
+  vtkDoubleArray* importedVectors =
+    vtkArrayDownCast<vtkDoubleArray>(imported->GetColumnByName("vectors"));
+  CHECK(importedVectors && importedVectors->GetNumberOfComponents() == 3);
+  CHECK(importedVectors->GetPointer(0) == vectors->GetPointer(0));
+  vtkIntArray* importedInts = vtkArrayDownCast<vtkIntArray>(imported->GetColumnByName("ints"));
+  CHECK(importedInts && importedInts->GetPointer(0) == ints->GetPointer(0));
+  vtkFloatArray* importedSOA = vtkArrayDownCast<vtkFloatArray>(imported->GetColumnByName("soa"));
+  vtkStringArray* importedStrings =
+    vtkArrayDownCast<vtkStringArray>(imported->GetColumnByName("strings"));
+  vtkBitArray* importedBits = vtkArrayDownCast<vtkBitArray>(imported->GetColumnByName("bits"));
+  CHECK(importedSOA && importedStrings && importedBits);
+  for (int i = 0; i < 10; ++i)
+  {
+    CHECK(importedVectors->GetComponent(i, 2) == 3 * i);
+    CHECK(importedInts->GetValue(i) == -i);
+    CHECK(importedSOA->GetValue(i) == 0.5f * i);
+    CHECK(importedStrings->GetValue(i) == strings->GetValue(i));
+    CHECK(importedBits->GetValue(i) == bits->GetValue(i));
+  }
+
+  // Modifying an imported array copies it first.
+  importedInts->WritePointer(0, 10)[0] = 42;
+  CHECK(ints->GetValue(0) == 0);
+
+  // Null values are replaced, the producer array is released with the VTK array.
+  Producer producer;
+  ArrowArray column = { 4, 1, 0, 2, 0, producer.Buffers, nullptr, nullptr, &ReleaseProducerArray,
+    nullptr };
+  ArrowSchema columnSchema = { "f", "nulls", nullptr, ARROW_FLAG_NULLABLE, 0, nullptr, nullptr,
+    &ReleaseProducerSchema, nullptr };
+  vtkSmartPointer<vtkAbstractArray> withNulls =
+    vtkArrowUtilities::ImportArray(&columnSchema, &column);
+  vtkFloatArray* floats = vtkArrayDownCast<vtkFloatArray>(withNulls);
+  CHECK(floats && floats->GetNumberOfTuples() == 4);
+  CHECK(floats->GetValue(0) == 1.f && floats->GetValue(3) == 4.f);
+  CHECK(std::isnan(floats->GetValue(2)));
+  CHECK(columnSchema.release == nullptr);
+
+  // Without nulls the values are shared until the last VTK array is deleted.
+  producer.Buffers[0] = nullptr;
+  column = { 3, 0, 1, 2, 0, producer.Buffers, nullptr, nullptr, &ReleaseProducerArray, nullptr };
+  columnSchema.release = &ReleaseProducerSchema;
+  NumberOfReleases = 0;
+  vtkSmartPointer<vtkAbstractArray> shared = vtkArrowUtilities::ImportArray(&columnSchema, &column);
+  floats = vtkArrayDownCast<vtkFloatArray>(shared);
+  CHECK(floats && floats->GetNumberOfTuples() == 3);
+  CHECK(floats->GetPointer(0) == producer.Values + 1);
+  CHECK(NumberOfReleases == 0);
+  shared = nullptr;
+  CHECK(NumberOfReleases == 1);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @file   vtkArrowCDataInterface.h
+ * @brief  structures of the Apache Arrow C data interface
+ *
+ * The Arrow C data interface is a stable ABI made of two C structures, which
+ * lets libraries exchange columnar data without depending on each other. This
+ * header declares them as specified in
+ * https://arrow.apache.org/docs/format/CDataInterface.html and uses the same
+ * include guard as the Arrow headers, so it can be included along with
+ * `arrow/c/abi.h`.
+ *
+ * @sa
+ * vtkArrowUtilities
+ */
+
+#ifndef vtkArrowCDataInterface_h
+#define vtkArrowCDataInterface_h
+
+#include <cstdint> // For int64_t
+
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+extern "C"
+{
+  struct ArrowSchema
+  {
+    // Array type description
+    const char* format;
+    const char* name;
+    const char* metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema** children;
+    struct ArrowSchema* dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowSchema*);
+    // Opaque producer-specific data
+    void* private_data;
+  };
+
+  struct ArrowArray
+  {
+    // Array data description
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void** buffers;
+    struct ArrowArray** children;
+    struct ArrowArray* dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowArray*);
+    // Opaque producer-specific data
+    void* private_data;
+  };
+}
+
+#endif // ARROW_C_DATA_INTERFACE
+
+#endif
+// VTK-HeaderTest-Exclude: vtkArrowCDataInterface.h
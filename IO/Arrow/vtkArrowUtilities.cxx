@@ -0,0 +1,712 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkArrowUtilities.h"
+
+#include "vtkAOSDataArrayTemplate.h"
+#include "vtkArrowCDataInterface.h"
+#include "vtkBitArray.h"
+#include "vtkDataArray.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkFieldData.h"
+#include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
+#include "vtkStringArray.h"
+#include "vtkTable.h"
+
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkArrowUtilities);
+
+namespace
+{
+//------------------------------------------------------------------------------
+// Import
+//------------------------------------------------------------------------------
+
+// An imported ArrowArray, released once the last VTK array using its buffers
+// is deleted.
+using ArrowArrayOwner = std::shared_ptr<ArrowArray>;
+
+ArrowArrayOwner MoveArray(ArrowArray* array)
+{
+  ArrowArray* moved = new ArrowArray(*array);
+  array->release = nullptr;
+  return ArrowArrayOwner(moved, [](ArrowArray* owned) {
+    if (owned->release)
+    {
+      owned->release(owned);
+    }
+    delete owned;
+  });
+}
+
+void ReleaseSchema(ArrowSchema* schema)
+{
+  if (schema && schema->release)
+  {
+    schema->release(schema);
+  }
+}
+
+void ReleaseArray(ArrowArray* array)
+{
+  if (array && array->release)
+  {
+    array->release(array);
+  }
+}
+
+// The validity bitmap of count elements of an array starting at first. The
+// bitmap is dropped when none of these elements is null.
+class Validity
+{
+public:
+  Validity() = default;
+  Validity(const ArrowArray* array, int64_t first, int64_t count)
+  {
+    if (array->null_count == 0 || array->n_buffers < 1 || array->buffers[0] == nullptr)
+    {
+      return;
+    }
+    this->Bits = static_cast<const uint8_t*>(array->buffers[0]);
+    this->Start = array->offset + first;
+    for (int64_t i = 0; i < count; ++i)
+    {
+      if (!(*this)(i))
+      {
+        return;
+      }
+    }
+    this->Bits = nullptr;
+  }
+
+  bool HasNulls() const { return this->Bits != nullptr; }
+
+  bool operator()(int64_t i) const
+  {
+    const int64_t bit = this->Start + i;
+    return this->Bits == nullptr || ((this->Bits[bit >> 3] >> (bit & 7)) & 1) != 0;
+  }
+
+private:
+  const uint8_t* Bits = nullptr;
+  int64_t Start = 0;
+};
+
+// Return the VTK type of an Arrow primitive numeric format, 0 otherwise.
+int GetVTKType(const char* format)
+{
+  if (format == nullptr || format[0] == '\0' || format[1] != '\0')
+  {
+    return 0;
+  }
+  switch (format[0])
+  {
+    case 'c':
+      return VTK_TYPE_INT8;
+    case 'C':
+      return VTK_TYPE_UINT8;
+    case 's':
+      return VTK_TYPE_INT16;
+    case 'S':
+      return VTK_TYPE_UINT16;
+    case 'i':
+      return VTK_TYPE_INT32;
+    case 'I':
+      return VTK_TYPE_UINT32;
+    case 'l':
+      return VTK_TYPE_INT64;
+    case 'L':
+      return VTK_TYPE_UINT64;
+    case 'f':
+      return VTK_TYPE_FLOAT32;
+    case 'g':
+      return VTK_TYPE_FLOAT64;
+    default:
+      return 0;
+  }
+}
+
+// Return N for a fixed size list format "+w:N", 0 otherwise.
+int GetListSize(const char* format)
+{
+  if (format == nullptr || std::strncmp(format, "+w:", 3) != 0)
+  {
+    return 0;
+  }
+  char* end = nullptr;
+  const long size = std::strtol(format + 3, &end, 10);
+  return *end == '\0' && size > 0 && size <= INT_MAX ? static_cast<int>(size) : 0;
+}
+
+// Wrap or copy numberOfTuples tuples of values starting at value first.
+template <typename T>
+void ImportValues(vtkAOSDataArrayTemplate<T>* result, const ArrowArray* values, int64_t first,
+  vtkIdType numberOfTuples, const Validity& tupleValidity, const Validity& valueValidity,
+  const ArrowArrayOwner& owner)
+{
+  const int numberOfComponents = result->GetNumberOfComponents();
+  const vtkIdType numberOfValues = numberOfTuples * numberOfComponents;
+  if (numberOfValues == 0)
+  {
+    result->SetNumberOfTuples(0);
+    return;
+  }
+  const T* data = static_cast<const T*>(values->buffers[1]) + values->offset + first;
+
+  if (!tupleValidity.HasNulls() && !valueValidity.HasNulls())
+  {
+    result->SetArray(const_cast<T*>(data), numberOfValues, [owner](T*) {}, true);
+    return;
+  }
+
+  const T nullValue =
+    std::numeric_limits<T>::has_quiet_NaN ? std::numeric_limits<T>::quiet_NaN() : T(0);
+  result->SetNumberOfTuples(numberOfTuples);
+  T* output = result->GetPointer(0);
+  vtkSMPTools::For(0, numberOfTuples, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType tuple = begin; tuple < end; ++tuple)
+    {
+      const bool valid = tupleValidity(tuple);
+      for (int c = 0; c < numberOfComponents; ++c)
+      {
+        const vtkIdType v = tuple * numberOfComponents + c;
+        output[v] = valid && valueValidity(v) ? data[v] : nullValue;
+      }
+    }
+  });
+}
+
+template <typename OffsetType>
+void ImportStrings(
+  vtkStringArray* result, const ArrowArray* column, int64_t first, vtkIdType numberOfValues)
+{
+  result->SetNumberOfValues(numberOfValues);
+  if (numberOfValues == 0)
+  {
+    return;
+  }
+  const Validity validity(column, first, numberOfValues);
+  const OffsetType* offsets =
+    static_cast<const OffsetType*>(column->buffers[1]) + column->offset + first;
+  const char* characters = static_cast<const char*>(column->buffers[2]);
+  vtkStdString* output = result->GetPointer(0);
+  vtkSMPTools::For(0, numberOfValues, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      if (validity(i))
+      {
+        output[i].assign(characters + offsets[i], static_cast<size_t>(offsets[i + 1] - offsets[i]));
+      }
+    }
+  });
+  result->DataChanged();
+}
+
+void ImportBits(
+  vtkBitArray* result, const ArrowArray* column, int64_t first, vtkIdType numberOfValues)
+{
+  result->SetNumberOfValues(numberOfValues);
+  if (numberOfValues == 0)
+  {
+    return;
+  }
+  const Validity validity(column, first, numberOfValues);
+  const uint8_t* bits = static_cast<const uint8_t*>(column->buffers[1]);
+  const int64_t start = column->offset + first;
+  unsigned char* output = result->GetPointer(0);
+  std::memset(output, 0, static_cast<size_t>((numberOfValues + 7) / 8));
+  for (vtkIdType i = 0; i < numberOfValues; ++i)
+  {
+    // vtkBitArray stores the first value in the most significant bit.
+    const int64_t bit = start + i;
+    if (validity(i) && ((bits[bit >> 3] >> (bit & 7)) & 1) != 0)
+    {
+      output[i >> 3] |= static_cast<unsigned char>(0x80 >> (i & 7));
+    }
+  }
+  result->DataChanged();
+}
+
+// Import length elements of column starting at first, owner keeping the
+// buffers alive.
+vtkSmartPointer<vtkAbstractArray> ImportColumn(const ArrowSchema* schema, const ArrowArray* column,
+  int64_t first, int64_t length, const ArrowArrayOwner& owner)
+{
+  const char* name = schema->name ? schema->name : "";
+  const char* format = schema->format ? schema->format : "";
+  if (schema->dictionary != nullptr || column->dictionary != nullptr)
+  {
+    vtkGenericWarningMacro("Skipping dictionary encoded Arrow column \"" << name << "\".");
+    return nullptr;
+  }
+
+  vtkSmartPointer<vtkAbstractArray> result;
+  const vtkIdType numberOfTuples = static_cast<vtkIdType>(length);
+  if (const int vtkType = GetVTKType(format))
+  {
+    if (column->n_buffers != 2)
+    {
+      vtkGenericWarningMacro("Invalid Arrow column \"" << name << "\".");
+      return nullptr;
+    }
+    vtkSmartPointer<vtkDataArray> values =
+      vtkSmartPointer<vtkDataArray>::Take(vtkDataArray::CreateDataArray(vtkType));
+    const Validity validity(column, first, length);
+    switch (vtkType)
+    {
+      vtkTemplateMacro(ImportValues(vtkArrayDownCast<vtkAOSDataArrayTemplate<VTK_TT>>(values),
+        column, first, numberOfTuples, validity, Validity(), owner));
+    }
+    result = values;
+  }
+  else if (const int listSize = GetListSize(format))
+  {
+    const int childType = column->n_children == 1 && schema->n_children == 1
+      ? GetVTKType(schema->children[0]->format)
+      : 0;
+    const ArrowArray* child = childType ? column->children[0] : nullptr;
+    if (childType == 0 || child->n_buffers != 2 || schema->children[0]->dictionary)
+    {
+      vtkGenericWarningMacro(
+        "Skipping Arrow column \"" << name << "\" of unsupported type " << format << ".");
+      return nullptr;
+    }
+    vtkSmartPointer<vtkDataArray> values =
+      vtkSmartPointer<vtkDataArray>::Take(vtkDataArray::CreateDataArray(childType));
+    values->SetNumberOfComponents(listSize);
+    const int64_t firstValue = (column->offset + first) * listSize;
+    const Validity tupleValidity(column, first, length);
+    const Validity valueValidity(child, firstValue, length * listSize);
+    switch (childType)
+    {
+      vtkTemplateMacro(ImportValues(vtkArrayDownCast<vtkAOSDataArrayTemplate<VTK_TT>>(values),
+        child, firstValue, numberOfTuples, tupleValidity, valueValidity, owner));
+    }
+    result = values;
+  }
+  else if ((std::strcmp(format, "u") == 0 || std::strcmp(format, "U") == 0) &&
+    column->n_buffers == 3)
+  {
+    vtkNew<vtkStringArray> strings;
+    if (format[0] == 'u')
+    {
+      ImportStrings<int32_t>(strings, column, first, numberOfTuples);
+    }
+    else
+    {
+      ImportStrings<int64_t>(strings, column, first, numberOfTuples);
+    }
+    result = strings;
+  }
+  else if (std::strcmp(format, "b") == 0 && column->n_buffers == 2)
+  {
+    vtkNew<vtkBitArray> bits;
+    ImportBits(bits, column, first, numberOfTuples);
+    result = bits;
+  }
+  else
+  {
+    vtkGenericWarningMacro(
+      "Skipping Arrow column \"" << name << "\" of unsupported type " << format << ".");
+    return nullptr;
+  }
+
+  result->SetName(name);
+  return result;
+}
+
+//------------------------------------------------------------------------------
+// Export
+//------------------------------------------------------------------------------
+
+// Private data of an exported ArrowSchema, its children being released with it.
+struct ExportedSchema
+{
+  std::string Format;
+  std::string Name;
+  std::vector<ArrowSchema> Children;
+  std::vector<ArrowSchema*> ChildPointers;
+};
+
+// Private data of an exported ArrowArray, its children being released with it.
+struct ExportedArray
+{
+  // Keeps the exported values alive.
+  vtkSmartPointer<vtkAbstractArray> Array;
+  // Copied values (characters, bits) and offsets.
+  std::vector<char> Bytes;
+  std::vector<int32_t> Offsets32;
+  std::vector<int64_t> Offsets64;
+  std::vector<const void*> Buffers;
+  std::vector<ArrowArray> Children;
+  std::vector<ArrowArray*> ChildPointers;
+};
+
+void ReleaseExportedSchema(ArrowSchema* schema)
+{
+  ExportedSchema* data = static_cast<ExportedSchema*>(schema->private_data);
+  for (ArrowSchema* child : data->ChildPointers)
+  {
+    ReleaseSchema(child);
+  }
+  delete data;
+  schema->release = nullptr;
+}
+
+void ReleaseExportedArray(ArrowArray* array)
+{
+  ExportedArray* data = static_cast<ExportedArray*>(array->private_data);
+  for (ArrowArray* child : data->ChildPointers)
+  {
+    ReleaseArray(child);
+  }
+  delete data;
+  array->release = nullptr;
+}
+
+// Allocate the private data of a schema and an array with numberOfChildren
+// released children, and fill the structures from them.
+std::pair<ExportedSchema*, ExportedArray*> InitializeExport(ArrowSchema* schema,
+  ArrowArray* array, const char* format, const char* name, int64_t length,
+  size_t numberOfChildren)
+{
+  ExportedSchema* schemaData = new ExportedSchema;
+  schemaData->Format = format;
+  schemaData->Name = name ? name : "";
+  schemaData->Children.resize(numberOfChildren, ArrowSchema());
+  ExportedArray* arrayData = new ExportedArray;
+  arrayData->Children.resize(numberOfChildren, ArrowArray());
+  for (size_t i = 0; i < numberOfChildren; ++i)
+  {
+    schemaData->ChildPointers.push_back(&schemaData->Children[i]);
+    arrayData->ChildPointers.push_back(&arrayData->Children[i]);
+  }
+
+  schema->format = schemaData->Format.c_str();
+  schema->name = schemaData->Name.c_str();
+  schema->metadata = nullptr;
+  schema->flags = 0;
+  schema->n_children = static_cast<int64_t>(numberOfChildren);
+  schema->children = numberOfChildren ? schemaData->ChildPointers.data() : nullptr;
+  schema->dictionary = nullptr;
+  schema->release = &ReleaseExportedSchema;
+  schema->private_data = schemaData;
+
+  array->length = length;
+  array->null_count = 0;
+  array->offset = 0;
+  array->n_buffers = 0;
+  array->buffers = nullptr;
+  array->n_children = static_cast<int64_t>(numberOfChildren);
+  array->children = numberOfChildren ? arrayData->ChildPointers.data() : nullptr;
+  array->dictionary = nullptr;
+  array->release = &ReleaseExportedArray;
+  array->private_data = arrayData;
+  return { schemaData, arrayData };
+}
+
+void SetBuffers(ArrowArray* array, ExportedArray* data, std::vector<const void*> buffers)
+{
+  data->Buffers = std::move(buffers);
+  array->n_buffers = static_cast<int64_t>(data->Buffers.size());
+  array->buffers = data->Buffers.data();
+}
+
+template <typename T>
+const char* GetFormat()
+{
+  if (std::is_floating_point<T>::value)
+  {
+    return sizeof(T) == 4 ? "f" : "g";
+  }
+  const bool isSigned = std::is_signed<T>::value;
+  switch (sizeof(T))
+  {
+    case 1:
+      return isSigned ? "c" : "C";
+    case 2:
+      return isSigned ? "s" : "S";
+    case 4:
+      return isSigned ? "i" : "I";
+    default:
+      return isSigned ? "l" : "L";
+  }
+}
+
+template <typename OffsetType>
+void ExportStrings(vtkStringArray* input, ExportedArray* data, std::vector<OffsetType>& offsets)
+{
+  const vtkIdType numberOfValues = input->GetNumberOfValues();
+  offsets.resize(numberOfValues + 1);
+  offsets[0] = 0;
+  vtkIdType length;
+  for (vtkIdType i = 0; i < numberOfValues; ++i)
+  {
+    input->GetValueData(i, length);
+    offsets[i + 1] = offsets[i] + static_cast<OffsetType>(length);
+  }
+  data->Bytes.resize(static_cast<size_t>(offsets.back()));
+  vtkSMPTools::For(0, numberOfValues, [&](vtkIdType begin, vtkIdType end) {
+    vtkIdType valueLength;
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      const char* value = input->GetValueData(i, valueLength);
+      std::copy(value, value + valueLength, data->Bytes.begin() + offsets[i]);
+    }
+  });
+}
+
+// Export all the values of input as a flat array.
+bool ExportValues(vtkAbstractArray* input, const char* name, ArrowSchema* schema, ArrowArray* array)
+{
+  const vtkIdType numberOfValues = input->GetNumberOfValues();
+  if (vtkStringArray* strings = vtkArrayDownCast<vtkStringArray>(input))
+  {
+    size_t size = 0;
+    vtkIdType length;
+    for (vtkIdType i = 0; i < numberOfValues; ++i)
+    {
+      strings->GetValueData(i, length);
+      size += static_cast<size_t>(length);
+    }
+    const bool large = size > static_cast<size_t>(std::numeric_limits<int32_t>::max());
+    auto data = InitializeExport(schema, array, large ? "U" : "u", name, numberOfValues, 0).second;
+    const void* offsets = nullptr;
+    if (large)
+    {
+      ExportStrings(strings, data, data->Offsets64);
+      offsets = data->Offsets64.data();
+    }
+    else
+    {
+      ExportStrings(strings, data, data->Offsets32);
+      offsets = data->Offsets32.data();
+    }
+    SetBuffers(array, data, { nullptr, offsets, data->Bytes.data() });
+    return true;
+  }
+
+  if (vtkBitArray* bits = vtkArrayDownCast<vtkBitArray>(input))
+  {
+    auto data = InitializeExport(schema, array, "b", name, numberOfValues, 0).second;
+    // Arrow stores the first value in the least significant bit.
+    data->Bytes.assign(static_cast<size_t>((numberOfValues + 7) / 8), 0);
+    for (vtkIdType i = 0; i < numberOfValues; ++i)
+    {
+      if (bits->GetValue(i))
+      {
+        data->Bytes[i >> 3] = static_cast<char>(data->Bytes[i >> 3] | (1 << (i & 7)));
+      }
+    }
+    SetBuffers(array, data, { nullptr, data->Bytes.data() });
+    return true;
+  }
+
+  vtkDataArray* values = vtkArrayDownCast<vtkDataArray>(input);
+  const char* format = nullptr;
+  switch (values ? values->GetDataType() : VTK_VOID)
+  {
+    vtkTemplateMacro(format = GetFormat<VTK_TT>());
+  }
+  if (format == nullptr)
+  {
+    return false;
+  }
+
+  vtkSmartPointer<vtkDataArray> contiguous = values;
+  if (!values->HasStandardMemoryLayout())
+  {
+    contiguous =
+      vtkSmartPointer<vtkDataArray>::Take(vtkDataArray::CreateDataArray(values->GetDataType()));
+    contiguous->DeepCopy(values);
+  }
+  auto data = InitializeExport(schema, array, format, name, numberOfValues, 0).second;
+  data->Array = contiguous;
+  SetBuffers(array, data, { nullptr, numberOfValues ? contiguous->GetVoidPointer(0) : nullptr });
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkAbstractArray> vtkArrowUtilities::ImportArray(
+  ArrowSchema* schema, ArrowArray* array)
+{
+  vtkSmartPointer<vtkAbstractArray> result;
+  if (schema && schema->release && array && array->release)
+  {
+    ArrowArrayOwner owner = MoveArray(array);
+    result = ::ImportColumn(schema, owner.get(), 0, owner->length, owner);
+  }
+  ::ReleaseArray(array);
+  ::ReleaseSchema(schema);
+  return result;
+}
+
+//------------------------------------------------------------------------------
+bool vtkArrowUtilities::ImportFieldData(
+  ArrowSchema* schema, ArrowArray* array, vtkFieldData* fieldData)
+{
+  bool success = false;
+  if (fieldData && schema && schema->release && array && array->release && schema->format &&
+    std::strcmp(schema->format, "+s") == 0 && schema->n_children == array->n_children)
+  {
+    ArrowArrayOwner owner = MoveArray(array);
+    fieldData->Initialize();
+    for (int64_t i = 0; i < owner->n_children; ++i)
+    {
+      vtkSmartPointer<vtkAbstractArray> column = ::ImportColumn(
+        schema->children[i], owner->children[i], owner->offset, owner->length, owner);
+      if (column)
+      {
+        fieldData->AddArray(column);
+      }
+    }
+    success = true;
+  }
+  else
+  {
+    vtkGenericWarningMacro("Expected an Arrow struct array.");
+  }
+  ::ReleaseArray(array);
+  ::ReleaseSchema(schema);
+  return success;
+}
+
+//------------------------------------------------------------------------------
+bool vtkArrowUtilities::ImportTable(ArrowSchema* schema, ArrowArray* array, vtkTable* table)
+{
+  if (table == nullptr)
+  {
+    ::ReleaseArray(array);
+    ::ReleaseSchema(schema);
+    return false;
+  }
+  if (!vtkArrowUtilities::ImportFieldData(schema, array, table->GetRowData()))
+  {
+    return false;
+  }
+  table->Modified();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkArrowUtilities::ImportTable(
+  vtkTypeUInt64 schemaAddress, vtkTypeUInt64 arrayAddress, vtkTable* table)
+{
+  return vtkArrowUtilities::ImportTable(
+    reinterpret_cast<ArrowSchema*>(static_cast<uintptr_t>(schemaAddress)),
+    reinterpret_cast<ArrowArray*>(static_cast<uintptr_t>(arrayAddress)), table);
+}
+
+//------------------------------------------------------------------------------
+bool vtkArrowUtilities::ExportArray(vtkAbstractArray* input, ArrowSchema* schema, ArrowArray* array)
+{
+  if (schema == nullptr || array == nullptr)
+  {
+    return false;
+  }
+  schema->release = nullptr;
+  array->release = nullptr;
+  if (input == nullptr)
+  {
+    return false;
+  }
+
+  const int numberOfComponents = input->GetNumberOfComponents();
+  if (numberOfComponents == 1)
+  {
+    return ::ExportValues(input, input->GetName(), schema, array);
+  }
+
+  // Several components: a fixed size list of the flat values.
+  const std::string format = "+w:" + std::to_string(numberOfComponents);
+  auto data = ::InitializeExport(
+    schema, array, format.c_str(), input->GetName(), input->GetNumberOfTuples(), 1);
+  ::SetBuffers(array, data.second, { nullptr });
+  if (!::ExportValues(input, "item", &data.first->Children[0], &data.second->Children[0]))
+  {
+    ::ReleaseArray(array);
+    ::ReleaseSchema(schema);
+    return false;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkArrowUtilities::ExportFieldData(
+  vtkFieldData* fieldData, ArrowSchema* schema, ArrowArray* array)
+{
+  if (schema == nullptr || array == nullptr)
+  {
+    return false;
+  }
+  schema->release = nullptr;
+  array->release = nullptr;
+  if (fieldData == nullptr)
+  {
+    return false;
+  }
+
+  const int numberOfArrays = fieldData->GetNumberOfArrays();
+  const vtkIdType numberOfTuples = fieldData->GetNumberOfTuples();
+  auto data = ::InitializeExport(
+    schema, array, "+s", "", numberOfTuples, static_cast<size_t>(numberOfArrays));
+  ::SetBuffers(array, data.second, { nullptr });
+  for (int i = 0; i < numberOfArrays; ++i)
+  {
+    vtkAbstractArray* input = fieldData->GetAbstractArray(i);
+    if (input->GetNumberOfTuples() != numberOfTuples ||
+      !vtkArrowUtilities::ExportArray(
+        input, &data.first->Children[i], &data.second->Children[i]))
+    {
+      vtkGenericWarningMacro(
+        "Cannot export array \"" << (input->GetName() ? input->GetName() : "") << "\".");
+      ::ReleaseArray(array);
+      ::ReleaseSchema(schema);
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkArrowUtilities::ExportTable(vtkTable* table, ArrowSchema* schema, ArrowArray* array)
+{
+  if (table == nullptr)
+  {
+    if (schema && array)
+    {
+      schema->release = nullptr;
+      array->release = nullptr;
+    }
+    return false;
+  }
+  return vtkArrowUtilities::ExportFieldData(table->GetRowData(), schema, array);
+}
+
+//------------------------------------------------------------------------------
+bool vtkArrowUtilities::ExportTable(
+  vtkTable* table, vtkTypeUInt64 schemaAddress, vtkTypeUInt64 arrayAddress)
+{
+  return vtkArrowUtilities::ExportTable(table,
+    reinterpret_cast<ArrowSchema*>(static_cast<uintptr_t>(schemaAddress)),
+    reinterpret_cast<ArrowArray*>(static_cast<uintptr_t>(arrayAddress)));
+}
+
+//------------------------------------------------------------------------------
+void vtkArrowUtilities::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+}
+VTK_ABI_NAMESPACE_END
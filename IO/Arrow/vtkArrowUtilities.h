@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkArrowUtilities
+ * @brief   exchange tables and arrays through the Arrow C data interface
+ *
+ * vtkArrowUtilities converts vtkTable, vtkFieldData (and thus
+ * vtkDataSetAttributes) and individual arrays to and from the structures of the
+ * Apache Arrow C data interface declared in vtkArrowCDataInterface.h. A table
+ * or field data is exchanged as a struct array ("+s") with one child per
+ * column, which is how Arrow exports a record batch.
+ *
+ * Numeric columns are shared without copying the values:
+ * - on export, the Arrow buffers point to the memory of the VTK arrays, which
+ *   are kept alive until the consumer releases the structures. Arrays that do
+ *   not store their values contiguously (e.g. vtkSOADataArrayTemplate or
+ *   implicit arrays) are copied first.
+ * - on import, the VTK arrays wrap the Arrow buffers as read-only external
+ *   memory (see vtkAOSDataArrayTemplate::SetArray()), so modifying an imported
+ *   array in place copies it first. The Arrow data is released once the last
+ *   VTK array using it is deleted.
+ *
+ * Arrays with several components map to fixed size lists ("+w:N"). Strings
+ * and booleans do not have the same layout in both libraries and are copied:
+ * vtkStringArray maps to utf8 ("u") or large utf8 ("U"), vtkBitArray to
+ * boolean ("b"). Null values of imported numeric columns are replaced by NaN
+ * for floating point types and by 0 otherwise, which also requires a copy;
+ * null strings become empty strings. Columns of other Arrow types (nested,
+ * dictionary encoded, temporal...) are skipped with a warning.
+ *
+ * Following the C data interface, the import functions take ownership of the
+ * ArrowArray (it is moved and marked released) and release the ArrowSchema,
+ * whether they succeed or not. The structures filled by the export functions
+ * must be released by the consumer.
+ *
+ * The overloads taking addresses are meant for the Python wrapping, e.g. with
+ * `pyarrow.RecordBatch._export_to_c(array_address, schema_address)`.
+ *
+ * @sa
+ * vtkTable vtkFieldData vtkParquetReader
+ */
+
+#ifndef vtkArrowUtilities_h
+#define vtkArrowUtilities_h
+
+#include "vtkIOArrowModule.h" // For export macro
+#include "vtkObject.h"
+#include "vtkSmartPointer.h" // For vtkSmartPointer
+
+struct ArrowArray;
+struct ArrowSchema;
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkAbstractArray;
+class vtkFieldData;
+class vtkTable;
+
+class VTKIOARROW_EXPORT vtkArrowUtilities : public vtkObject
+{
+public:
+  static vtkArrowUtilities* New();
+  vtkTypeMacro(vtkArrowUtilities, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Replace the columns of @a table by the children of the struct array
+   * described by @a schema and @a array. Returns false when they do not
+   * describe a struct array, leaving the table unchanged.
+   */
+  static bool ImportTable(ArrowSchema* schema, ArrowArray* array, vtkTable* table);
+  static bool ImportTable(
+    vtkTypeUInt64 schemaAddress, vtkTypeUInt64 arrayAddress, vtkTable* table);
+  ///@}
+
+  ///@{
+  /**
+   * Export the columns of @a table as a struct array. Returns false, leaving
+   * @a schema and @a array released, when a column cannot be exported.
+   */
+  static bool ExportTable(vtkTable* table, ArrowSchema* schema, ArrowArray* array);
+  static bool ExportTable(
+    vtkTable* table, vtkTypeUInt64 schemaAddress, vtkTypeUInt64 arrayAddress);
+  ///@}
+
+  /**
+   * Replace the arrays of @a fieldData by the children of the struct array
+   * described by @a schema and @a array. Returns false when they do not
+   * describe a struct array, leaving @a fieldData unchanged.
+   */
+  static bool ImportFieldData(ArrowSchema* schema, ArrowArray* array, vtkFieldData* fieldData);
+
+  /**
+   * Export the arrays of @a fieldData as a struct array. All the arrays must
+   * have the same number of tuples. Returns false, leaving @a schema and
+   * @a array released, when they do not or when an array cannot be exported.
+   */
+  static bool ExportFieldData(vtkFieldData* fieldData, ArrowSchema* schema, ArrowArray* array);
+
+  /**
+   * Import a single Arrow array as a VTK array named after the schema.
+   * Returns nullptr when its type is not supported.
+   */
+  static vtkSmartPointer<vtkAbstractArray> ImportArray(ArrowSchema* schema, ArrowArray* array);
+
+  /**
+   * Export a single VTK array. Returns false, leaving @a schema and @a array
+   * released, when its type is not supported.
+   */
+  static bool ExportArray(vtkAbstractArray* input, ArrowSchema* schema, ArrowArray* array);
+
+protected:
+  vtkArrowUtilities() = default;
+  ~vtkArrowUtilities() override = default;
+
+private:
+  vtkArrowUtilities(const vtkArrowUtilities&) = delete;
+  void operator=(const vtkArrowUtilities&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
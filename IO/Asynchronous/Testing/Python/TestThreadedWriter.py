@@ -4,6 +4,8 @@ import os
 import time
 
 from vtkmodules.vtkIOAsynchronous import vtkThreadedImageWriter
+from vtkmodules.vtkIOLegacy import vtkDataSetWriter
+from vtkmodules.vtkIOXML import vtkXMLImageDataReader, vtkXMLImageDataWriter
 from vtkmodules.vtkImagingCore import vtkRTAnalyticSource
 from vtkmodules.util.misc import vtkGetTempDir
 
@@ -65,5 +67,25 @@ if (t1 - t0) > t2 - t1: # The write time should be smaller than the wait time
 # Validate data checksum
 # ...TODO
 
+# Write with any writer, with a bounded queue and deep copied inputs
+writer.SetMaxQueueSize(2)
+writer.DeepCopyInputOn()
+writer.Initialize()
+for i in range(5):
+    xmlWriter = vtkXMLImageDataWriter()
+    xmlWriter.SetFileName('%s/%s-generic.vti' % (VTK_TEMP_DIR, i))
+    writer.Write(image, xmlWriter)
+    legacyWriter = vtkDataSetWriter()
+    legacyWriter.SetFileName('%s/%s-generic.vtk' % (VTK_TEMP_DIR, i))
+    writer.Write(image, legacyWriter)
+writer.Finalize()
+
+reader = vtkXMLImageDataReader()
+reader.SetFileName('%s/4-generic.vti' % VTK_TEMP_DIR)
+reader.Update()
+if reader.GetOutput().GetNumberOfPoints() != image.GetNumberOfPoints():
+    print('Wrong number of points written by the generic write')
+    sys.exit(1)
+
 print("All good...")
 # sys.exit(0)
@@ -2,8 +2,10 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkThreadedImageWriter.h"
 
+#include "vtkAlgorithm.h"
 #include "vtkBMPWriter.h"
 #include "vtkCommand.h"
+#include "vtkDataObject.h"
 #include "vtkFloatArray.h"
 #include "vtkImageData.h"
 #include "vtkJPEGWriter.h"
@@ -16,13 +18,17 @@
 #include "vtkTIFFWriter.h"
 #include "vtkThreadedTaskQueue.h"
 #include "vtkUnsignedCharArray.h"
+#include "vtkWriter.h"
 #include "vtkXMLImageDataWriter.h"
+#include "vtkXMLWriterBase.h"
 #include "vtkZLibDataCompressor.h"
 #include "vtksys/FStream.hxx"
 
 #include <cassert>
 #include <cmath>
+#include <condition_variable>
 #include <iostream>
+#include <mutex>
 
 #include <vtksys/SystemTools.hxx>
 
@@ -108,6 +114,28 @@ void EncodeAndWrite(const vtkSmartPointer<vtkImageData>& image, const std::strin
     fileHandler.write(scalarPtr, numberOfScalars * scalarSize);
   }
 }
+
+void Write(const vtkSmartPointer<vtkDataObject>& data, const vtkSmartPointer<vtkAlgorithm>& writer)
+{
+  vtkLogF(TRACE, "writing with: %s", writer->GetClassName());
+  writer->SetInputDataObject(data);
+  if (auto legacyWriter = vtkWriter::SafeDownCast(writer))
+  {
+    legacyWriter->Write();
+  }
+  else if (auto xmlWriter = vtkXMLWriterBase::SafeDownCast(writer))
+  {
+    xmlWriter->Write();
+  }
+  else
+  {
+    // any other sink, always write even if the data hasn't changed
+    writer->Modified();
+    writer->Update();
+  }
+  // release the data as soon as it is written
+  writer->SetInputDataObject(nullptr);
+}
 }
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -115,9 +143,32 @@ VTK_ABI_NAMESPACE_BEGIN
 class vtkThreadedImageWriter::vtkInternals
 {
 private:
-  using TaskQueueType = vtkThreadedTaskQueue<void, vtkSmartPointer<vtkImageData>, std::string>;
+  using TaskQueueType = vtkThreadedTaskQueue<void, vtkSmartPointer<vtkDataObject>, std::string,
+    vtkSmartPointer<vtkAlgorithm>>;
   std::unique_ptr<TaskQueueType> Queue;
 
+  // Number of pushed writes not completed yet, used to bound the queue
+  vtkTypeUInt32 PendingTasks = 0;
+  std::mutex PendingTasksMutex;
+  std::condition_variable PendingTasksCV;
+
+  void RunTask(const vtkSmartPointer<vtkDataObject>& data, const std::string& fileName,
+    const vtkSmartPointer<vtkAlgorithm>& writer)
+  {
+    if (writer)
+    {
+      ::Write(data, writer);
+    }
+    else
+    {
+      ::EncodeAndWrite(vtkImageData::SafeDownCast(data), fileName);
+    }
+    std::unique_lock<std::mutex> lock(this->PendingTasksMutex);
+    --this->PendingTasks;
+    lock.unlock();
+    this->PendingTasksCV.notify_all();
+  }
+
 public:
   vtkInternals()
     : Queue(nullptr)
@@ -126,6 +177,8 @@ public:
 
   ~vtkInternals() { this->TerminateAllWorkers(); }
 
+  bool IsRunning() const { return this->Queue != nullptr; }
+
   void TerminateAllWorkers()
   {
     if (this->Queue)
@@ -137,15 +190,24 @@ public:
 
   void SpawnWorkers(vtkTypeUInt32 numberOfThreads)
   {
-    this->Queue.reset(new TaskQueueType(::EncodeAndWrite,
+    this->Queue.reset(new TaskQueueType(
+      [this](vtkSmartPointer<vtkDataObject> data, std::string fileName,
+        vtkSmartPointer<vtkAlgorithm> writer) { this->RunTask(data, fileName, writer); },
       /*strict_ordering=*/true,
       /*buffer_size=*/-1,
       /*max_concurrent_tasks=*/static_cast<int>(numberOfThreads)));
   }
 
-  void PushImageToQueue(vtkSmartPointer<vtkImageData>&& data, std::string&& filename)
+  void PushToQueue(vtkSmartPointer<vtkDataObject>&& data, std::string&& filename,
+    vtkSmartPointer<vtkAlgorithm>&& writer, vtkTypeUInt32 maxQueueSize)
   {
-    this->Queue->Push(std::move(data), std::move(filename));
+    // the buffer of the task queue discards older tasks, wait for a slot instead
+    std::unique_lock<std::mutex> lock(this->PendingTasksMutex);
+    this->PendingTasksCV.wait(
+      lock, [&] { return maxQueueSize == 0 || this->PendingTasks < maxQueueSize; });
+    ++this->PendingTasks;
+    lock.unlock();
+    this->Queue->Push(std::move(data), std::move(filename), std::move(writer));
   }
 };
 
@@ -194,20 +256,61 @@ void vtkThreadedImageWriter::EncodeAndWrite(vtkImageData* image, const char* fil
     vtkErrorMacro(<< "Write:Please specify an input!");
     return;
   }
+  if (!this->Internals->IsRunning())
+  {
+    vtkErrorMacro(<< "Initialize() must be called before writing.");
+    return;
+  }
+
+  this->Internals->PushToQueue(
+    this->CopyInput(image), std::string(fileName), nullptr, this->MaxQueueSize);
+}
 
+//------------------------------------------------------------------------------
+void vtkThreadedImageWriter::Write(vtkDataObject* data, vtkAlgorithm* writer)
+{
+  if (data == nullptr || writer == nullptr)
+  {
+    vtkErrorMacro(<< "Write:Please specify an input and a writer!");
+    return;
+  }
+  if (!this->Internals->IsRunning())
+  {
+    vtkErrorMacro(<< "Initialize() must be called before writing.");
+    return;
+  }
+
+  this->Internals->PushToQueue(
+    this->CopyInput(data), std::string(), writer, this->MaxQueueSize);
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkDataObject> vtkThreadedImageWriter::CopyInput(vtkDataObject* data)
+{
   // we make a shallow copy so that the caller doesn't have to take too much
-  // care when modifying image besides the standard requirements for the case
-  // where the image is propagated in the pipeline.
-  vtkSmartPointer<vtkImageData> img;
-  img.TakeReference(image->NewInstance());
-  img->ShallowCopy(image);
-  this->Internals->PushImageToQueue(std::move(img), std::string(fileName));
+  // care when modifying data besides the standard requirements for the case
+  // where the data is propagated in the pipeline. A deep copy also lets the
+  // caller modify its arrays in place.
+  vtkSmartPointer<vtkDataObject> copy;
+  copy.TakeReference(data->NewInstance());
+  if (this->DeepCopyInput)
+  {
+    copy->DeepCopy(data);
+  }
+  else
+  {
+    copy->ShallowCopy(data);
+  }
+  return copy;
 }
 
 //------------------------------------------------------------------------------
 void vtkThreadedImageWriter::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "MaxThreads: " << this->MaxThreads << endl;
+  os << indent << "MaxQueueSize: " << this->MaxQueueSize << endl;
+  os << indent << "DeepCopyInput: " << this->DeepCopyInput << endl;
 }
 
 //------------------------------------------------------------------------------
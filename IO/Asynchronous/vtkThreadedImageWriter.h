@@ -8,6 +8,12 @@
  * @details  This writer allow to encode an image data based on its file
  *           extension: tif, tiff, bpm, png, jpg, jpeg, vti, Z, ppm, raw
  *
+ *           Any data object may also be written by any writer with
+ *           Write(). Writes are done by a pool of worker threads so that
+ *           the caller only pays for the copy of the input. MaxQueueSize
+ *           bounds the number of pending writes: when it is reached, the
+ *           caller blocks until a worker completes a write.
+ *
  * @author   Patricia Kroll Fasel @ LANL
  */
 
@@ -16,8 +22,11 @@
 
 #include "vtkIOAsynchronousModule.h" // For export macro
 #include "vtkObject.h"
+#include "vtkSmartPointer.h" // For vtkSmartPointer
 
 VTK_ABI_NAMESPACE_BEGIN
+class vtkAlgorithm;
+class vtkDataObject;
 class vtkImageData;
 
 class VTKIOASYNCHRONOUS_EXPORT vtkThreadedImageWriter : public vtkObject
@@ -45,6 +54,43 @@ public:
    */
   void EncodeAndWrite(vtkImageData* image, VTK_FILEPATH const char* fileName);
 
+  /**
+   * Push a data object into the threaded writer, to be written by the given
+   * writer: a vtkWriter subclass (legacy, HDF, ...), a vtkXMLWriterBase
+   * subclass, or any other sink algorithm with one input. The writer must be
+   * fully configured (file name, options) and is then used by a worker
+   * thread: it must not be used or modified by the caller, nor pushed again,
+   * until Finalize() is called. Use a new writer for each call.
+   *
+   * The data object is shallow copied unless DeepCopyInput is on, see
+   * SetDeepCopyInput().
+   */
+  void Write(vtkDataObject* data, vtkAlgorithm* writer);
+
+  ///@{
+  /**
+   * When on, the data pushed with EncodeAndWrite() or Write() is deep copied
+   * by the calling thread, so that the caller may modify the values of its
+   * arrays in place as soon as the call returns. When off, the data is
+   * shallow copied: the caller may replace its arrays, but must not modify
+   * them in place until they are written. Default is off.
+   */
+  vtkSetMacro(DeepCopyInput, bool);
+  vtkGetMacro(DeepCopyInput, bool);
+  vtkBooleanMacro(DeepCopyInput, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Maximum number of writes that may be pending, including the ones in
+   * progress. When this number is reached, EncodeAndWrite() and Write() block
+   * until a write completes, which bounds the memory held by the copies of
+   * the inputs. 0 means unlimited, which is the default.
+   */
+  vtkSetMacro(MaxQueueSize, vtkTypeUInt32);
+  vtkGetMacro(MaxQueueSize, vtkTypeUInt32);
+  ///@}
+
   /**
    * Define the number of worker thread to use.
    * Initialize() need to be called after any thread count change.
@@ -65,9 +111,13 @@ private:
   vtkThreadedImageWriter(const vtkThreadedImageWriter&) = delete;
   void operator=(const vtkThreadedImageWriter&) = delete;
 
+  vtkSmartPointer<vtkDataObject> CopyInput(vtkDataObject* data);
+
   class vtkInternals;
   vtkInternals* Internals;
   vtkTypeUInt32 MaxThreads;
+  vtkTypeUInt32 MaxQueueSize = 0;
+  bool DeepCopyInput = false;
 };
 
 VTK_ABI_NAMESPACE_END
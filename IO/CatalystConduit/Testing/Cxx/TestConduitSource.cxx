@@ -3,6 +3,7 @@
 
 #include <vtkXMLUniformGridAMRWriter.h>
 
+#include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkCellIterator.h"
 #include "vtkCompositeDataIterator.h"
@@ -767,6 +768,11 @@ bool ValidateMeshTypeMixed2D()
   VERIFY(ug->GetNumberOfCells() == 24, "expected 24 cells, got %lld", ug->GetNumberOfCells());
   VERIFY(ug->GetNumberOfPoints() == 25, "Expected 25 points, got %lld", ug->GetNumberOfPoints());
 
+  // the connectivity is used without copy
+  auto connectivity = mesh["topologies/mesh/elements/connectivity"];
+  VERIFY(ug->GetCells()->GetConnectivityArray()->GetVoidPointer(0) == connectivity.element_ptr(0),
+    "expected the connectivity to be used without copy");
+
   // check cell types
   const auto it = vtkSmartPointer<vtkCellIterator>::Take(ug->NewCellIterator());
   int nTris(0), nQuads(0);
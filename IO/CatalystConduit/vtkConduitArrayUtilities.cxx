@@ -4,7 +4,9 @@
 
 #include "vtkArrayDispatch.h"
 #include "vtkCellArray.h"
+#include "vtkDataArrayRange.h"
 #include "vtkDataSetAttributes.h"
+#include "vtkIdTypeArray.h"
 #include "vtkLogger.h"
 #include "vtkObjectFactory.h"
 #include "vtkSOADataArrayTemplate.h"
@@ -71,6 +73,27 @@ vtkSmartPointer<ArrayT> CreateAOSArray(
   return array;
 }
 
+template <typename ArrayT>
+vtkSmartPointer<ArrayT> CreateAOSArrayCopy(
+  vtkIdType number_of_tuples, const conduit_cpp::Node& mcarray)
+{
+  using ValueType = typename ArrayT::ValueType;
+  const int number_of_components = static_cast<int>(mcarray.number_of_children());
+  auto array = vtkSmartPointer<ArrayT>::New();
+  array->SetNumberOfComponents(number_of_components);
+  array->SetNumberOfTuples(number_of_tuples);
+  for (int cc = 0; cc < number_of_components; ++cc)
+  {
+    const conduit_cpp::Node child = mcarray.child(cc);
+    for (vtkIdType tuple = 0; tuple < number_of_tuples; ++tuple)
+    {
+      array->SetTypedComponent(
+        tuple, cc, *reinterpret_cast<const ValueType*>(child.element_ptr(tuple)));
+    }
+  }
+  return array;
+}
+
 template <typename ValueT>
 vtkSmartPointer<vtkSOADataArrayTemplate<ValueT>> CreateSOArray(
   vtkIdType number_of_tuples, int number_of_components, const std::vector<void*>& raw_ptrs)
@@ -331,9 +354,9 @@ vtkSmartPointer<vtkDataArray> vtkConduitArrayUtilities::MCArrayToVTKArrayImpl(
   }
   else
   {
-    // TODO: we can do a deep-copy in this case, so we can still handle it quite easily when needed.
-    vtkLogF(ERROR, "unsupported array layout.");
-    return nullptr;
+    vtkLogF(TRACE, "deep-copying array with a strided layout, zero-copy is not possible.");
+    return vtkConduitArrayUtilities::MCArrayToVTKAOSArrayCopy(
+      conduit_cpp::c_node(&mcarray), force_signed);
   }
 
   return nullptr;
@@ -452,6 +475,52 @@ vtkSmartPointer<vtkDataArray> vtkConduitArrayUtilities::MCArrayToVTKSOAArray(
   }
 }
 
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkDataArray> vtkConduitArrayUtilities::MCArrayToVTKAOSArrayCopy(
+  const conduit_node* c_mcarray, bool force_signed)
+{
+  const conduit_cpp::Node mcarray = conduit_cpp::cpp_node(const_cast<conduit_node*>(c_mcarray));
+  const conduit_cpp::DataType dtype0 = mcarray.child(0).dtype();
+  const vtkIdType num_tuples = static_cast<vtkIdType>(dtype0.number_of_elements());
+
+  switch (internals::GetTypeId(dtype0.id(), force_signed))
+  {
+    case conduit_cpp::DataType::Id::int8:
+      return internals::CreateAOSArrayCopy<vtkTypeInt8Array>(num_tuples, mcarray);
+
+    case conduit_cpp::DataType::Id::int16:
+      return internals::CreateAOSArrayCopy<vtkTypeInt16Array>(num_tuples, mcarray);
+
+    case conduit_cpp::DataType::Id::int32:
+      return internals::CreateAOSArrayCopy<vtkTypeInt32Array>(num_tuples, mcarray);
+
+    case conduit_cpp::DataType::Id::int64:
+      return internals::CreateAOSArrayCopy<vtkTypeInt64Array>(num_tuples, mcarray);
+
+    case conduit_cpp::DataType::Id::uint8:
+      return internals::CreateAOSArrayCopy<vtkTypeUInt8Array>(num_tuples, mcarray);
+
+    case conduit_cpp::DataType::Id::uint16:
+      return internals::CreateAOSArrayCopy<vtkTypeUInt16Array>(num_tuples, mcarray);
+
+    case conduit_cpp::DataType::Id::uint32:
+      return internals::CreateAOSArrayCopy<vtkTypeUInt32Array>(num_tuples, mcarray);
+
+    case conduit_cpp::DataType::Id::uint64:
+      return internals::CreateAOSArrayCopy<vtkTypeUInt64Array>(num_tuples, mcarray);
+
+    case conduit_cpp::DataType::Id::float32:
+      return internals::CreateAOSArrayCopy<vtkTypeFloat32Array>(num_tuples, mcarray);
+
+    case conduit_cpp::DataType::Id::float64:
+      return internals::CreateAOSArrayCopy<vtkTypeFloat64Array>(num_tuples, mcarray);
+
+    default:
+      vtkLogF(ERROR, "unsupported data type '%s' ", dtype0.name().c_str());
+      return nullptr;
+  }
+}
+
 //----------------------------------------------------------------------------
 vtkSmartPointer<vtkDataArray> vtkConduitArrayUtilities::SetNumberOfComponents(
   vtkDataArray* array, int num_components)
@@ -489,7 +558,16 @@ vtkSmartPointer<vtkCellArray> vtkConduitArrayUtilities::MCArrayToVTKCellArray(
     return nullptr;
   }
 
-  // now the array matches the type accepted by vtkCellArray (in most cases).
+  // now the array matches the type accepted by vtkCellArray, unless it has 8 or 16 bit integers.
+  if (!vtkArrayDownCast<vtkTypeInt32Array>(array) && !vtkArrayDownCast<vtkTypeInt64Array>(array))
+  {
+    vtkLogF(TRACE, "deep-copying connectivity of type '%s' to vtkIdType.",
+      array->GetDataTypeAsString());
+    auto copy = vtkSmartPointer<vtkIdTypeArray>::New();
+    copy->DeepCopy(array);
+    array = copy;
+  }
+
   vtkNew<vtkCellArray> cellArray;
   cellArray->SetData(cellSize, array);
   return cellArray;
@@ -501,6 +579,46 @@ namespace
 {
 VTK_ABI_NAMESPACE_BEGIN
 
+// Creates the offsets of a vtkCellArray using the elements of a O2MRelation as
+// connectivity, when the offsets of the relation are the running sum of its sizes.
+struct O2MRelationToVTKOffsetsWorker
+{
+  vtkSmartPointer<vtkDataArray> Offsets;
+
+  template <typename ElementsArray, typename SizesArray, typename OffsetsArray>
+  void operator()(ElementsArray* elements, SizesArray* sizes, OffsetsArray* offsets)
+  {
+    using ValueType = typename ElementsArray::ValueType;
+    const vtkIdType numElements = sizes->GetNumberOfTuples();
+    if (elements->GetNumberOfComponents() != 1 || sizes->GetNumberOfComponents() != 1 ||
+      offsets->GetNumberOfComponents() != 1 || offsets->GetNumberOfTuples() != numElements)
+    {
+      return;
+    }
+
+    auto cellOffsets = vtkSmartPointer<ElementsArray>::New();
+    cellOffsets->SetNumberOfValues(numElements + 1);
+    const auto s = vtk::DataArrayValueRange<1>(sizes);
+    const auto o = vtk::DataArrayValueRange<1>(offsets);
+    ValueType offset = 0;
+    for (vtkIdType id = 0; id < numElements; ++id)
+    {
+      if (static_cast<ValueType>(o[id]) != offset)
+      {
+        return;
+      }
+      cellOffsets->SetValue(id, offset);
+      offset += static_cast<ValueType>(s[id]);
+    }
+    if (offset != elements->GetNumberOfValues())
+    {
+      return;
+    }
+    cellOffsets->SetValue(numElements, offset);
+    this->Offsets = cellOffsets;
+  }
+};
+
 struct O2MRelationToVTKCellArrayWorker
 {
   vtkNew<vtkCellArray> Cells;
@@ -565,6 +683,20 @@ vtkSmartPointer<vtkCellArray> vtkConduitArrayUtilities::O2MRelationToVTKCellArra
   auto offsets = vtkConduitArrayUtilities::MCArrayToVTKArrayImpl(
     conduit_cpp::c_node(&node_offsets), /*force_signed*/ true);
 
+  // use the elements without copy when possible
+  O2MRelationToVTKOffsetsWorker offsetsWorker;
+  using CellArrays = vtkCellArray::InputArrayList;
+  using OffsetsDispatcher = vtkArrayDispatch::Dispatch3ByArray<CellArrays, CellArrays, CellArrays>;
+  if (OffsetsDispatcher::Execute(
+        elements.GetPointer(), sizes.GetPointer(), offsets.GetPointer(), offsetsWorker) &&
+    offsetsWorker.Offsets)
+  {
+    vtkNew<vtkCellArray> cells;
+    cells->SetData(offsetsWorker.Offsets, elements);
+    return cells;
+  }
+  vtkLogF(TRACE, "deep-copying '%s' of a O2MRelation to a vtkCellArray.", leafname.c_str());
+
   O2MRelationToVTKCellArrayWorker worker;
 
   // Using a reduced type list for typical id types.
@@ -7,8 +7,9 @@
  *
  * vtkConduitArrayUtilities is intended to convert Conduit nodes satisfying the
  * `mcarray` protocol to VTK arrays. It uses zero-copy, as much as possible.
- * Currently implementation fails if zero-copy is not possible. In future, that
- * may be changed to do a deep-copy (with appropriate warnings) if necessary.
+ * When zero-copy is not possible, e.g. for components with a stride that is
+ * neither interleaved nor contiguous, the values are deep-copied and the copy
+ * is reported in the TRACE log.
  *
  * This is primarily designed for use by vtkConduitSource.
  */
@@ -57,7 +58,8 @@ public:
    * Converts an mcarray to vtkCellArray.
    *
    * This may reinterpret unsigned array as signed arrays to avoid deep-copying
-   * of data to match data type expected by vtkCellArray API.
+   * of data to match data type expected by vtkCellArray API. Connectivity of
+   * 8 or 16 bit integers is deep-copied.
    */
   static vtkSmartPointer<vtkCellArray> MCArrayToVTKCellArray(
     vtkIdType cellSize, const conduit_node* mcarray);
@@ -71,6 +73,11 @@ public:
 
   /**
    * Read a O2MRelation element
+   *
+   * When the offsets are the running sum of the sizes and the leaf is an array
+   * of 32 or 64 bit integers, the leaf is used without copy as the
+   * connectivity of the vtkCellArray, and only its offsets are created.
+   * Otherwise the cells are deep-copied.
    */
   static vtkSmartPointer<vtkCellArray> O2MRelationToVTKCellArray(
     const conduit_node* o2mrelation, const std::string& leafname);
@@ -85,6 +92,8 @@ protected:
     const conduit_node* mcarray, bool force_signed);
   static vtkSmartPointer<vtkDataArray> MCArrayToVTKSOAArray(
     const conduit_node* mcarray, bool force_signed);
+  static vtkSmartPointer<vtkDataArray> MCArrayToVTKAOSArrayCopy(
+    const conduit_node* mcarray, bool force_signed);
 
 private:
   vtkConduitArrayUtilities(const vtkConduitArrayUtilities&) = delete;
@@ -744,6 +744,32 @@ vtkSmartPointer<vtkDataSet> CreateMixedUnstructuredGrid(
     unstructured->SetPoints(CreatePoints(coords));
 
     conduit_cpp::Node t_elementShapes = topologyNode["elements/shapes"];
+    if (!hasPolyhedra)
+    {
+      // without polyhedra, the elements are a O2MRelation whose connectivity is used
+      // without copy, only the shapes are converted to cell types.
+      conduit_cpp::Node t_elements = topologyNode["elements"];
+      auto cellArray = vtkConduitArrayUtilities::O2MRelationToVTKCellArray(
+        conduit_cpp::c_node(&t_elements), "connectivity");
+      const auto elementShapesArray =
+        vtkConduitArrayUtilities::MCArrayToVTKArray(conduit_cpp::c_node(&t_elementShapes));
+      if (cellArray == nullptr || elementShapesArray == nullptr)
+      {
+        throw std::runtime_error("elements not available (nullptr)");
+      }
+
+      const auto elementShapesRange = vtk::DataArrayValueRange<1>(elementShapesArray);
+      vtkNew<vtkUnsignedCharArray> cellTypes;
+      cellTypes->SetNumberOfValues(elementShapesRange.size());
+      vtkIdType cellId = 0;
+      for (const auto cellType : elementShapesRange)
+      {
+        cellTypes->SetValue(cellId++, static_cast<unsigned char>(cellType));
+      }
+      unstructured->SetCells(cellTypes, cellArray);
+      return unstructured;
+    }
+
     conduit_cpp::Node t_elementSizes = topologyNode["elements/sizes"];
     conduit_cpp::Node t_elementOffsets = topologyNode["elements/offsets"];
     conduit_cpp::Node t_elementConnectivity = topologyNode["elements/connectivity"];
@@ -33,6 +33,7 @@
 #include "vtkPNGWriter.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 #include "vtkSelection.h"
 #include "vtkSelectionNode.h"
 #include "vtkSmartPointer.h"
@@ -534,7 +535,7 @@ void TreeInformation::Compute()
 void TreeInformation::SaveTilesBuildings(bool mergeTilePolyData, size_t mergedTextureWidth)
 {
   MergePolyDataInfo info{ mergeTilePolyData, mergedTextureWidth };
-  this->PostOrderTraversal(&TreeInformation::SaveTileBuildings, this->Root, &info);
+  this->ParallelLeafTraversal(&TreeInformation::SaveTileBuildings, &info);
 }
 
 void TreeInformation::WriteTileTexture(
@@ -563,14 +564,18 @@ void TreeInformation::SaveTilesMesh()
     textureImages[i] = GetTexture(this->TextureBaseDirectory, textureFileName);
   }
   SaveTileMeshData aux(vtkSelectionNode::CELL, textureImages);
-  this->PostOrderTraversal(&TreeInformation::SaveTileMesh, this->Root, &aux);
+  // compute the bounds of the shared points before tiles use them in parallel
+  this->Mesh->GetBounds();
+  this->ParallelLeafTraversal(&TreeInformation::SaveTileMesh, &aux);
 }
 
 //------------------------------------------------------------------------------
 void TreeInformation::SaveTilesPoints()
 {
   int selectionField = vtkSelectionNode::POINT;
-  this->PostOrderTraversal(&TreeInformation::SaveTilePoints, this->Root, &selectionField);
+  // compute the bounds of the shared points before tiles use them in parallel
+  this->Points->GetBounds();
+  this->ParallelLeafTraversal(&TreeInformation::SaveTilePoints, &selectionField);
 }
 
 //------------------------------------------------------------------------------
@@ -603,6 +608,40 @@ void TreeInformation::PreOrderTraversal(
   }
 }
 
+//------------------------------------------------------------------------------
+void TreeInformation::ParallelLeafTraversal(
+  void (TreeInformation::*Visit)(vtkIncrementalOctreeNode* node, void* aux), void* aux)
+{
+  std::vector<vtkIncrementalOctreeNode*> leaves;
+  this->GetNonEmptyLeaves(this->Root, leaves);
+  // a grain of one tile bounds the memory used to the tiles being saved
+  vtkSMPTools::For(0, static_cast<vtkIdType>(leaves.size()), 1,
+    [this, Visit, aux, &leaves](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        (this->*Visit)(leaves[i], aux);
+      }
+    });
+}
+
+//------------------------------------------------------------------------------
+void TreeInformation::GetNonEmptyLeaves(
+  vtkIncrementalOctreeNode* node, std::vector<vtkIncrementalOctreeNode*>& leaves)
+{
+  if (!node->IsLeaf())
+  {
+    for (int i = 0; i < 8; i++)
+    {
+      this->GetNonEmptyLeaves(node->GetChild(i), leaves);
+    }
+  }
+  else if (!this->EmptyNode[node->GetID()])
+  {
+    leaves.push_back(node);
+  }
+}
+
+//------------------------------------------------------------------------------
 bool TreeInformation::ForEachBuilding(
   vtkIncrementalOctreeNode* node, std::function<bool(vtkPolyData* pd)> Execute)
 {
@@ -1027,7 +1066,10 @@ void TreeInformation::SaveTileMesh(vtkIncrementalOctreeNode* node, void* voidAux
     vtkNew<vtkSelection> selection;
     selection->AddNode(selectionNode);
     vtkNew<vtkExtractSelection> extractSelection;
-    extractSelection->SetInputData(0, this->Mesh);
+    // each tile extracts from its own shallow copy, as tiles are saved in parallel
+    vtkNew<vtkPolyData> mesh;
+    mesh->ShallowCopy(this->Mesh);
+    extractSelection->SetInputData(0, mesh);
     extractSelection->SetInputData(1, selection);
     vtkNew<vtkGeometryFilter> geometryFilter;
     geometryFilter->SetInputConnection(extractSelection->GetOutputPort());
@@ -1127,7 +1169,10 @@ void TreeInformation::SaveTilePoints(vtkIncrementalOctreeNode* node, void* voidA
   {
     vtkSmartPointer<vtkIdList> pointIds = node->GetPointIds();
     vtkNew<vtkCesiumPointCloudWriter> writer;
-    writer->SetInputDataObject(this->Points);
+    // each tile writes from its own shallow copy, as tiles are saved in parallel
+    auto points = vtk::TakeSmartPointer(this->Points->NewInstance());
+    points->ShallowCopy(this->Points);
+    writer->SetInputDataObject(points);
     writer->SetPointIds(pointIds);
     std::ostringstream ostr;
     ostr << this->OutputDir << "/" << node->GetID();
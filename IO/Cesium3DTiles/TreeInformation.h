@@ -82,9 +82,15 @@ public:
    * and the geometric error.
    */
   void Compute();
+  ///@{
+  /**
+   * Save the content of the tiles. Leaf tiles are independent, so they are
+   * saved in parallel, one tile at a time per thread.
+   */
   void SaveTilesBuildings(bool mergeTilePolyData, size_t mergedTextureWidth);
   void SaveTilesMesh();
   void SaveTilesPoints();
+  ///@}
   void SaveTileset(const std::string& output);
   static void PrintBounds(const char* name, const double* bounds);
   static void PrintBounds(const std::string& name, const double* bounds)
@@ -98,6 +104,13 @@ protected:
     vtkIncrementalOctreeNode* node, void* aux);
   void PreOrderTraversal(void (TreeInformation::*Visit)(vtkIncrementalOctreeNode* node, void* aux),
     vtkIncrementalOctreeNode* node, void* aux);
+  /**
+   * Call Visit for all non empty leaves in parallel.
+   */
+  void ParallelLeafTraversal(
+    void (TreeInformation::*Visit)(vtkIncrementalOctreeNode* node, void* aux), void* aux);
+  void GetNonEmptyLeaves(
+    vtkIncrementalOctreeNode* node, std::vector<vtkIncrementalOctreeNode*>& leaves);
   void SaveTileset(vtkIncrementalOctreeNode* root, const std::string& output);
   nlohmann::json GenerateTileJson(vtkIncrementalOctreeNode* node);
   bool ConvertTileCartesianBuildings(vtkIncrementalOctreeNode* node);
@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Encode data of various lengths followed by other content, and check that
+// vtkBase64InputStream decodes them with reads of various lengths and after
+// seeking, and that vtkBase64Utilities::DecodeSafely decodes them at once.
+
+#include "vtkBase64InputStream.h"
+#include "vtkBase64Utilities.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+int TestBase64InputStream(int, char*[])
+{
+  unsigned int seed = 12345;
+  for (size_t length : { 0, 1, 2, 3, 4, 5, 1000, 12287, 12288, 12289, 100000 })
+  {
+    std::vector<unsigned char> data(length);
+    for (unsigned char& value : data)
+    {
+      seed = seed * 1664525u + 1013904223u;
+      value = static_cast<unsigned char>(seed >> 24);
+    }
+    std::vector<unsigned char> encoded(length * 2 + 8);
+    unsigned long encodedLength =
+      vtkBase64Utilities::Encode(data.data(), static_cast<unsigned long>(length), encoded.data());
+    std::string text(reinterpret_cast<char*>(encoded.data()), encodedLength);
+
+    // decode at once
+    std::vector<unsigned char> decoded(length + 3);
+    size_t decodedLength = vtkBase64Utilities::DecodeSafely(
+      encoded.data(), encodedLength, decoded.data(), decoded.size());
+    if (decodedLength != length || std::memcmp(decoded.data(), data.data(), length) != 0)
+    {
+      vtkLog(ERROR, "Wrong DecodeSafely for length " << length);
+      return EXIT_FAILURE;
+    }
+
+    // decode from a stream with other content after the data
+    std::istringstream stream("<" + text + "</DataArray>");
+    stream.get();
+    vtkNew<vtkBase64InputStream> input;
+    input->SetStream(&stream);
+    input->StartReading();
+    for (size_t readLength : { 1, 2, 5, 4096, 50000 })
+    {
+      decoded.assign(length + 3, 0);
+      if (!input->Seek(0))
+      {
+        vtkLog(ERROR, "Cannot seek for length " << length);
+        return EXIT_FAILURE;
+      }
+      size_t total = 0;
+      size_t n;
+      while ((n = input->Read(decoded.data() + total, readLength)) > 0)
+      {
+        total += n;
+        if (n < readLength)
+        {
+          break;
+        }
+      }
+      if (total != length || std::memcmp(decoded.data(), data.data(), length) != 0)
+      {
+        vtkLog(ERROR,
+          "Wrong stream decoding of length " << length << " with reads of " << readLength
+                                             << ", decoded " << total);
+        return EXIT_FAILURE;
+      }
+    }
+
+    // seek within the data
+    for (size_t offset : { length / 3, length / 2 + 1, length - length / 5 })
+    {
+      if (offset >= length)
+      {
+        continue;
+      }
+      unsigned char values[7];
+      size_t expected = std::min<size_t>(7, length - offset);
+      if (!input->Seek(static_cast<vtkTypeInt64>(offset)) ||
+        input->Read(values, expected) != expected ||
+        std::memcmp(values, data.data() + offset, expected) != 0)
+      {
+        vtkLog(ERROR, "Wrong decoding at offset " << offset << " of length " << length);
+        return EXIT_FAILURE;
+      }
+    }
+    input->EndReading();
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// .NAME Test of vtkZstdDataCompressor
+// .SECTION Description
+//
+
+#include "vtkZstdDataCompressor.h"
+#include "vtkObjectFactory.h"
+
+int TestCompressZstd(int argc, char* argv[])
+{
+  if (!vtkZstdDataCompressor::IsSupported())
+  {
+    cout << argv[0] << " VTK was built without Zstandard support" << endl;
+    return 0;
+  }
+
+  int res = 1;
+  const unsigned int start_size = 100024;
+  unsigned int cc;
+  unsigned char buffer[start_size];
+  unsigned char* cbuffer;
+  unsigned char* ucbuffer;
+  size_t nlen;
+  size_t rlen;
+
+  vtkZstdDataCompressor* compressor = vtkZstdDataCompressor::New();
+  for (cc = 0; cc < start_size; cc++)
+  {
+    buffer[cc] = static_cast<unsigned char>(cc % sizeof(unsigned char));
+  }
+  buffer[0] = 'v';
+  buffer[1] = 't';
+  buffer[2] = 'k';
+
+  for (int level = 1; level <= 9; level += 4)
+  {
+    compressor->SetCompressionLevel(level);
+    nlen = compressor->GetMaximumCompressionSpace(start_size);
+    cbuffer = new unsigned char[nlen];
+    rlen = compressor->Compress(buffer, start_size, cbuffer, nlen);
+    res = 1;
+    if (rlen > 0)
+    {
+      ucbuffer = new unsigned char[start_size];
+      rlen = compressor->Uncompress(cbuffer, rlen, ucbuffer, start_size);
+      if (rlen == start_size)
+      {
+        cout << argv[0] << " Works " << argc << " at level " << level << endl;
+        cout << ucbuffer[0] << ucbuffer[1] << ucbuffer[2] << endl;
+        res = 0;
+      }
+      delete[] ucbuffer;
+    }
+    delete[] cbuffer;
+    if (res)
+    {
+      break;
+    }
+  }
+
+  compressor->Delete();
+  return res;
+}
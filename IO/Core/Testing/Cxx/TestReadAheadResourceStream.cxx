@@ -0,0 +1,151 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Read data through vtkReadAheadResourceStream with reads of various sizes and
+// seeks, from a source stream and from a subclass fetching ranges itself, and
+// check the data and the number of fetched blocks.
+
+#include "vtkLogger.h"
+#include "vtkMemoryResourceStream.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkReadAheadResourceStream.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Fetch ranges of a string and count them
+class CountingStream : public vtkReadAheadResourceStream
+{
+public:
+  static CountingStream* New();
+  vtkTypeMacro(CountingStream, vtkReadAheadResourceStream);
+
+  std::string Data;
+  std::atomic<int> NumberOfFetches{ 0 };
+
+protected:
+  CountingStream() = default;
+  ~CountingStream() override { this->Reset(); }
+
+  vtkTypeInt64 FetchSize() override { return -1; }
+
+  std::size_t FetchRange(vtkTypeInt64 offset, void* buffer, std::size_t bytes) override
+  {
+    ++this->NumberOfFetches;
+    if (offset >= static_cast<vtkTypeInt64>(this->Data.size()))
+    {
+      return 0;
+    }
+    const std::size_t count = std::min(bytes, this->Data.size() - static_cast<size_t>(offset));
+    std::memcpy(buffer, this->Data.data() + offset, count);
+    return count;
+  }
+};
+vtkStandardNewMacro(CountingStream);
+
+// Read the whole stream with reads of the given size and compare it to data
+bool ReadAll(vtkResourceStream* stream, const std::string& data, std::size_t readSize)
+{
+  stream->Seek(0, vtkResourceStream::SeekDirection::Begin);
+  std::string result;
+  std::vector<char> buffer(readSize);
+  std::size_t count;
+  while ((count = stream->Read(buffer.data(), readSize)) > 0)
+  {
+    result.append(buffer.data(), count);
+    if (count < readSize && !stream->EndOfStream())
+    {
+      vtkLog(ERROR, "Short read without end of stream with reads of " << readSize);
+      return false;
+    }
+  }
+  if (result != data || !stream->EndOfStream())
+  {
+    vtkLog(ERROR, "Wrong data read with reads of " << readSize);
+    return false;
+  }
+  return true;
+}
+}
+
+int TestReadAheadResourceStream(int, char*[])
+{
+  std::string data(100000, ' ');
+  unsigned int seed = 12345;
+  for (char& value : data)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    value = static_cast<char>(seed >> 24);
+  }
+
+  vtkNew<vtkMemoryResourceStream> memory;
+  memory->SetBuffer(data.data(), data.size());
+  vtkNew<vtkReadAheadResourceStream> stream;
+  stream->SetSource(memory);
+  stream->SetBlockSize(1000);
+  stream->SetReadAheadBlocks(3);
+  stream->SetCacheSize(5);
+  stream->SetNumberOfThreads(3);
+
+  for (std::size_t readSize : { 1, 7, 999, 1000, 1001, 4096, 200000 })
+  {
+    if (!ReadAll(stream, data, readSize))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
+  // seek within and across blocks, and past the end
+  for (vtkTypeInt64 position : { 50000, 999, 1000, 12345, 99990, 3 })
+  {
+    char values[20];
+    const std::size_t expected =
+      std::min<std::size_t>(sizeof(values), data.size() - static_cast<std::size_t>(position));
+    if (stream->Seek(position, vtkResourceStream::SeekDirection::Begin) != position ||
+      stream->Read(values, sizeof(values)) != expected ||
+      std::memcmp(values, data.data() + position, expected) != 0 ||
+      stream->Tell() != position + static_cast<vtkTypeInt64>(expected))
+    {
+      vtkLog(ERROR, "Wrong read at " << position);
+      return EXIT_FAILURE;
+    }
+  }
+  if (stream->Seek(-10, vtkResourceStream::SeekDirection::End) != 99990 ||
+    stream->EndOfStream() ||
+    stream->Seek(20, vtkResourceStream::SeekDirection::Current) != 100010 ||
+    stream->Read(&seed, 1) != 0 || !stream->EndOfStream())
+  {
+    vtkLog(ERROR, "Wrong seek from the end");
+    return EXIT_FAILURE;
+  }
+
+  // a subclass fetching ranges of a resource of unknown size
+  vtkNew<CountingStream> counting;
+  counting->Data = data;
+  counting->SetBlockSize(4096);
+  counting->SetReadAheadBlocks(4);
+  counting->SetCacheSize(100);
+  if (!ReadAll(counting, data, 10) || !ReadAll(counting, data, 5000))
+  {
+    return EXIT_FAILURE;
+  }
+  // the blocks are kept in the cache, and the read-ahead stops past the end
+  const int numberOfBlocks = static_cast<int>(data.size() / 4096 + 1);
+  if (counting->NumberOfFetches > numberOfBlocks + 4)
+  {
+    vtkLog(ERROR,
+      "Fetched " << counting->NumberOfFetches << " blocks instead of at most "
+                 << numberOfBlocks + 4);
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
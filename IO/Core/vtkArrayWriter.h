@@ -80,7 +80,8 @@ public:
   vtkBooleanMacro(WriteToOutputString, bool);
   ///@}
 
-  int Write() override; // This is necessary to get Write() wrapped for scripting languages.
+  // This is necessary to get Write() wrapped for scripting languages.
+  VTK_UNBLOCKTHREADS int Write() override;
 
   /**
    * Writes input port 0 data to a file, using an arbitrary filename and binary flag.
@@ -4,6 +4,8 @@
 #include "vtkBase64Utilities.h"
 #include "vtkObjectFactory.h"
 
+#include <algorithm>
+
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkBase64InputStream);
@@ -110,14 +112,26 @@ size_t vtkBase64InputStream::Read(void* data_in, size_t length)
     this->BufferLength = 0;
   }
 
-  // Decode all complete triplets.
+  // Decode all complete triplets, reading the stream in chunks rather than
+  // 4 bytes at a time.  Exactly 4 bytes are read for each triplet, as the
+  // encoded data may be followed by other content.
+  unsigned char encoded[16384];
   while ((end - out) >= 3)
   {
-    int len = this->DecodeTriplet(out[0], out[1], out[2]);
+    size_t numTriplets = std::min(static_cast<size_t>(end - out) / 3, sizeof(encoded) / 4);
+    this->Stream->read(reinterpret_cast<char*>(encoded), 4 * numTriplets);
+    size_t numRead = static_cast<size_t>(this->Stream->gcount());
+    if (numRead < 4 * numTriplets)
+    {
+      // The encoded data ended before the chunk, keep the stream usable for
+      // the next seek as when reading 4 bytes at a time.
+      this->Stream->clear(this->Stream->rdstate() & std::ios::badbit);
+    }
+    size_t len = vtkBase64Utilities::DecodeSafely(encoded, numRead, out, 3 * numTriplets);
     out += len;
-    if (len < 3)
+    if (len < 3 * numTriplets)
     {
-      this->BufferLength = len - 3;
+      this->BufferLength = static_cast<int>(len % 3) - 3;
       return (out - data);
     }
   }
@@ -195,8 +195,29 @@ size_t vtkBase64Utilities::DecodeSafely(
     return 0;
   }
 
-  // Consume 4 ASCII chars of input at a time, until less than 4 left
+  // Decode the complete triplets that fit in the output, without padding.
+  // The decoded values are at most 0x3F, so an invalid character is found
+  // with a single test on all of them.
   size_t inIdx = 0, outIdx = 0;
+  while (inIdx <= inputLen - 4 && outIdx + 3 <= outputLen)
+  {
+    const unsigned char* in = input + inIdx;
+    unsigned char d0 = vtkBase64UtilitiesDecodeChar(in[0]);
+    unsigned char d1 = vtkBase64UtilitiesDecodeChar(in[1]);
+    unsigned char d2 = vtkBase64UtilitiesDecodeChar(in[2]);
+    unsigned char d3 = vtkBase64UtilitiesDecodeChar(in[3]);
+    if (((d0 | d1 | d2 | d3) & 0x80) != 0 || in[2] == '=' || in[3] == '=')
+    {
+      break;
+    }
+    output[outIdx] = static_cast<unsigned char>((d0 << 2) | (d1 >> 4));
+    output[outIdx + 1] = static_cast<unsigned char>(((d1 << 4) & 0xF0) | (d2 >> 2));
+    output[outIdx + 2] = static_cast<unsigned char>(((d2 << 6) & 0xC0) | d3);
+    inIdx += 4;
+    outIdx += 3;
+  }
+
+  // Consume 4 ASCII chars of input at a time, until less than 4 left
   while (inIdx <= inputLen - 4)
   {
     // Decode 4 ASCII characters into 0, 1, 2, or 3 bytes
@@ -0,0 +1,363 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkReadAheadResourceStream.h"
+
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+
+vtkStandardNewMacro(vtkReadAheadResourceStream);
+
+//------------------------------------------------------------------------------
+struct vtkReadAheadResourceStream::vtkInternals
+{
+  struct Block
+  {
+    std::vector<char> Data;
+    bool Ready = false;
+    std::uint64_t LastUse = 0;
+  };
+  using BlockPointer = std::shared_ptr<Block>;
+
+  vtkSmartPointer<vtkResourceStream> Source;
+  std::mutex SourceMutex;
+
+  // Shared with the threads fetching blocks
+  std::mutex Mutex;
+  std::condition_variable TaskAvailable;
+  std::condition_variable BlockFetched;
+  std::map<vtkTypeInt64, BlockPointer> Blocks;
+  std::deque<std::pair<vtkTypeInt64, BlockPointer>> Tasks;
+  std::vector<std::thread> Threads;
+  bool Stop = false;
+  std::uint64_t UseCount = 0;
+
+  // Only used by the reading thread
+  vtkTypeInt64 Position = 0;
+  vtkTypeInt64 Size = -1;
+  bool SizeFetched = false;
+  bool EndOfStream = false;
+
+  // Fetch the queued blocks until stopped
+  void FetchBlocks(vtkReadAheadResourceStream* self)
+  {
+    std::unique_lock<std::mutex> lock(this->Mutex);
+    while (true)
+    {
+      this->TaskAvailable.wait(lock, [this] { return this->Stop || !this->Tasks.empty(); });
+      if (this->Stop)
+      {
+        return;
+      }
+      auto task = std::move(this->Tasks.front());
+      this->Tasks.pop_front();
+      const std::size_t blockSize = self->BlockSize;
+      lock.unlock();
+
+      std::vector<char> data(blockSize);
+      const std::size_t fetched = self->FetchRange(
+        task.first * static_cast<vtkTypeInt64>(blockSize), data.data(), blockSize);
+      data.resize(std::min(fetched, blockSize));
+
+      lock.lock();
+      task.second->Data = std::move(data);
+      task.second->Ready = true;
+      this->BlockFetched.notify_all();
+    }
+  }
+
+  // Wait for the blocks being fetched and drop the queued ones
+  void StopThreads()
+  {
+    std::unique_lock<std::mutex> lock(this->Mutex);
+    for (const auto& task : this->Tasks)
+    {
+      this->Blocks.erase(task.first);
+    }
+    this->Tasks.clear();
+    this->Stop = true;
+    lock.unlock();
+    this->TaskAvailable.notify_all();
+
+    for (auto& thread : this->Threads)
+    {
+      thread.join();
+    }
+    this->Threads.clear();
+    this->Stop = false;
+  }
+
+  // Get a block, queue it if it is not cached. Mutex must be locked.
+  BlockPointer RequestBlock(vtkReadAheadResourceStream* self, vtkTypeInt64 index)
+  {
+    BlockPointer& block = this->Blocks[index];
+    if (!block)
+    {
+      if (this->Threads.empty())
+      {
+        for (int i = 0; i < self->NumberOfThreads; ++i)
+        {
+          this->Threads.emplace_back([this, self] { this->FetchBlocks(self); });
+        }
+      }
+      block = std::make_shared<Block>();
+      block->LastUse = ++this->UseCount;
+      this->Tasks.emplace_back(index, block);
+      this->TaskAvailable.notify_one();
+    }
+    return block;
+  }
+
+  // Release the least recently used blocks. Mutex must be locked.
+  void ReleaseBlocks(std::size_t maximumBlocks)
+  {
+    while (this->Blocks.size() > maximumBlocks)
+    {
+      auto oldest = this->Blocks.end();
+      for (auto it = this->Blocks.begin(); it != this->Blocks.end(); ++it)
+      {
+        if (it->second->Ready &&
+          (oldest == this->Blocks.end() || it->second->LastUse < oldest->second->LastUse))
+        {
+          oldest = it;
+        }
+      }
+      if (oldest == this->Blocks.end())
+      {
+        return;
+      }
+      this->Blocks.erase(oldest);
+    }
+  }
+
+  void FetchSize(vtkReadAheadResourceStream* self)
+  {
+    if (!this->SizeFetched)
+    {
+      this->Size = self->FetchSize();
+      this->SizeFetched = true;
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+vtkReadAheadResourceStream::vtkReadAheadResourceStream()
+  : vtkResourceStream{ true }
+  , Impl{ new vtkReadAheadResourceStream::vtkInternals }
+{
+}
+
+//------------------------------------------------------------------------------
+vtkReadAheadResourceStream::~vtkReadAheadResourceStream()
+{
+  this->Impl->StopThreads();
+}
+
+//------------------------------------------------------------------------------
+void vtkReadAheadResourceStream::SetSource(vtkResourceStream* source)
+{
+  if (source && !source->SupportSeek())
+  {
+    vtkErrorMacro("The source stream must support seeking.");
+    return;
+  }
+
+  this->Reset();
+  std::lock_guard<std::mutex> lock(this->Impl->SourceMutex);
+  this->Impl->Source = source;
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+vtkResourceStream* vtkReadAheadResourceStream::GetSource()
+{
+  return this->Impl->Source;
+}
+
+//------------------------------------------------------------------------------
+void vtkReadAheadResourceStream::SetBlockSize(std::size_t size)
+{
+  size = std::max<std::size_t>(size, 1);
+  if (size == this->BlockSize)
+  {
+    return;
+  }
+
+  this->Impl->StopThreads();
+  this->Impl->Blocks.clear();
+  this->BlockSize = size;
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkReadAheadResourceStream::SetNumberOfThreads(int numberOfThreads)
+{
+  numberOfThreads = std::max(numberOfThreads, 1);
+  if (numberOfThreads == this->NumberOfThreads)
+  {
+    return;
+  }
+
+  this->Impl->StopThreads();
+  this->NumberOfThreads = numberOfThreads;
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkReadAheadResourceStream::Reset()
+{
+  this->Impl->StopThreads();
+  this->Impl->Blocks.clear();
+  this->Impl->Position = 0;
+  this->Impl->Size = -1;
+  this->Impl->SizeFetched = false;
+  this->Impl->EndOfStream = false;
+}
+
+//------------------------------------------------------------------------------
+std::size_t vtkReadAheadResourceStream::Read(void* buffer, std::size_t bytes)
+{
+  if (bytes == 0)
+  {
+    return 0;
+  }
+
+  auto& impl = *this->Impl;
+  impl.FetchSize(this);
+
+  const auto blockSize = static_cast<vtkTypeInt64>(this->BlockSize);
+  char* output = static_cast<char*>(buffer);
+  std::size_t total = 0;
+
+  std::unique_lock<std::mutex> lock(impl.Mutex);
+  while (total < bytes && impl.Position >= 0 && (impl.Size < 0 || impl.Position < impl.Size))
+  {
+    const vtkTypeInt64 index = impl.Position / blockSize;
+    auto block = impl.RequestBlock(this, index);
+    for (vtkTypeInt64 next = index + 1; next <= index + this->ReadAheadBlocks; ++next)
+    {
+      if (impl.Size >= 0 && next * blockSize >= impl.Size)
+      {
+        break;
+      }
+      impl.RequestBlock(this, next);
+    }
+
+    impl.BlockFetched.wait(lock, [&block] { return block->Ready; });
+    block->LastUse = ++impl.UseCount;
+    if (impl.Size < 0 && block->Data.size() < this->BlockSize)
+    {
+      // the first short block ends a resource of unknown size
+      impl.Size = index * blockSize + static_cast<vtkTypeInt64>(block->Data.size());
+    }
+
+    const auto offset = static_cast<std::size_t>(impl.Position - index * blockSize);
+    if (offset >= block->Data.size())
+    {
+      break;
+    }
+    const std::size_t count = std::min(block->Data.size() - offset, bytes - total);
+    std::copy_n(block->Data.data() + offset, count, output + total);
+    total += count;
+    impl.Position += static_cast<vtkTypeInt64>(count);
+  }
+  impl.ReleaseBlocks(
+    static_cast<std::size_t>(std::max(this->CacheSize, this->ReadAheadBlocks + 1)));
+  lock.unlock();
+
+  if (total < bytes)
+  {
+    impl.EndOfStream = true;
+  }
+
+  return total;
+}
+
+//------------------------------------------------------------------------------
+bool vtkReadAheadResourceStream::EndOfStream()
+{
+  return this->Impl->EndOfStream;
+}
+
+//------------------------------------------------------------------------------
+vtkTypeInt64 vtkReadAheadResourceStream::Seek(vtkTypeInt64 pos, SeekDirection dir)
+{
+  auto& impl = *this->Impl;
+  switch (dir)
+  {
+    case SeekDirection::Begin:
+      impl.Position = pos;
+      break;
+    case SeekDirection::Current:
+      impl.Position += pos;
+      break;
+    case SeekDirection::End:
+      impl.FetchSize(this);
+      if (impl.Size < 0)
+      {
+        vtkErrorMacro("Cannot seek from the end of a resource of unknown size.");
+        return impl.Position;
+      }
+      impl.Position = impl.Size + pos;
+      break;
+  }
+
+  impl.EndOfStream = false;
+  return impl.Position;
+}
+
+//------------------------------------------------------------------------------
+vtkTypeInt64 vtkReadAheadResourceStream::Tell()
+{
+  return this->Impl->Position;
+}
+
+//------------------------------------------------------------------------------
+vtkTypeInt64 vtkReadAheadResourceStream::FetchSize()
+{
+  std::lock_guard<std::mutex> lock(this->Impl->SourceMutex);
+  if (!this->Impl->Source)
+  {
+    return 0;
+  }
+
+  return this->Impl->Source->Seek(0, SeekDirection::End);
+}
+
+//------------------------------------------------------------------------------
+std::size_t vtkReadAheadResourceStream::FetchRange(
+  vtkTypeInt64 offset, void* buffer, std::size_t bytes)
+{
+  std::lock_guard<std::mutex> lock(this->Impl->SourceMutex);
+  if (!this->Impl->Source)
+  {
+    return 0;
+  }
+
+  this->Impl->Source->Seek(offset, SeekDirection::Begin);
+  return this->Impl->Source->Read(buffer, bytes);
+}
+
+//------------------------------------------------------------------------------
+void vtkReadAheadResourceStream::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Source: " << this->Impl->Source << "\n";
+  os << indent << "BlockSize: " << this->BlockSize << "\n";
+  os << indent << "ReadAheadBlocks: " << this->ReadAheadBlocks << "\n";
+  os << indent << "CacheSize: " << this->CacheSize << "\n";
+  os << indent << "NumberOfThreads: " << this->NumberOfThreads << "\n";
+}
+
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,155 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#ifndef vtkReadAheadResourceStream_h
+#define vtkReadAheadResourceStream_h
+
+#include "vtkIOCoreModule.h" // For export macro
+#include "vtkResourceStream.h"
+
+#include <memory> // for std::unique_ptr
+
+VTK_ABI_NAMESPACE_BEGIN
+
+/**
+ * @brief `vtkResourceStream` reading a resource by blocks fetched ahead of time
+ *
+ * `vtkReadAheadResourceStream` reads a resource by blocks of `BlockSize` bytes,
+ * fetched by range in background threads. When a block is read, the next
+ * `ReadAheadBlocks` blocks are fetched in parallel, so that many small reads of a
+ * resource with a high latency, such as a remote file, wait at most once for each
+ * block. At most `CacheSize` blocks are kept in memory, the least recently used
+ * blocks are released first.
+ *
+ * Ranges are fetched by `FetchRange`, which by default seeks and reads the `Source`
+ * stream, one range at a time. Subclasses may reimplement `FetchSize` and
+ * `FetchRange` to fetch ranges of a remote resource, for instance with HTTP range
+ * requests to an object storage, in which case the ranges are fetched concurrently.
+ * Such a subclass can be returned for remote URIs by reimplementing
+ * `vtkURILoader::DoLoad`, and used by any reader that accepts a `vtkResourceStream`.
+ *
+ * Blocks are fetched lazily, the stream should be reset with `SetSource` or `Reset`
+ * when the resource changes.
+ */
+class VTKIOCORE_EXPORT vtkReadAheadResourceStream : public vtkResourceStream
+{
+  struct vtkInternals;
+
+public:
+  vtkTypeMacro(vtkReadAheadResourceStream, vtkResourceStream);
+  static vtkReadAheadResourceStream* New();
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * @brief Set the stream read by the default `FetchRange`
+   *
+   * The source must support seeking. Setting the source resets the stream to the
+   * initial position and releases all the blocks.
+   * This function will increase modified time.
+   */
+  void SetSource(vtkResourceStream* source);
+  vtkResourceStream* GetSource();
+  ///@}
+
+  ///@{
+  /**
+   * @brief Size in bytes of the blocks fetched from the resource
+   *
+   * Changing the block size releases all the blocks. Default is 1 MiB.
+   */
+  void SetBlockSize(std::size_t size);
+  vtkGetMacro(BlockSize, std::size_t);
+  ///@}
+
+  ///@{
+  /**
+   * @brief Number of blocks fetched after the block being read
+   *
+   * 0 disables the read-ahead. Default is 4.
+   */
+  vtkSetClampMacro(ReadAheadBlocks, int, 0, VTK_INT_MAX);
+  vtkGetMacro(ReadAheadBlocks, int);
+  ///@}
+
+  ///@{
+  /**
+   * @brief Maximum number of blocks kept in memory
+   *
+   * The blocks that are being read ahead are always kept, so the actual maximum is
+   * at least `ReadAheadBlocks + 1`. Default is 16.
+   */
+  vtkSetClampMacro(CacheSize, int, 1, VTK_INT_MAX);
+  vtkGetMacro(CacheSize, int);
+  ///@}
+
+  ///@{
+  /**
+   * @brief Number of threads fetching blocks
+   *
+   * Changing the number of threads waits for the blocks being fetched. Default is 4.
+   */
+  void SetNumberOfThreads(int numberOfThreads);
+  vtkGetMacro(NumberOfThreads, int);
+  ///@}
+
+  /**
+   * @brief Reset the stream
+   *
+   * Wait for the blocks being fetched, release all the blocks and move the stream
+   * to the initial position. The size of the resource is fetched again on next use.
+   */
+  void Reset();
+
+  ///@{
+  /**
+   * @brief Override vtkResourceStream functions
+   */
+  std::size_t Read(void* buffer, std::size_t bytes) override;
+  bool EndOfStream() override;
+  vtkTypeInt64 Seek(vtkTypeInt64 pos, SeekDirection dir) override;
+  vtkTypeInt64 Tell() override;
+  ///@}
+
+protected:
+  vtkReadAheadResourceStream();
+  ~vtkReadAheadResourceStream() override;
+  vtkReadAheadResourceStream(const vtkReadAheadResourceStream&) = delete;
+  vtkReadAheadResourceStream& operator=(const vtkReadAheadResourceStream&) = delete;
+
+  /**
+   * @brief Get the size of the resource in bytes
+   *
+   * Called once before the first read or seek. Default implementation seeks to the
+   * end of `Source`. Return -1 if the size is unknown, then the resource ends with the
+   * first block fetched with less than `BlockSize` bytes.
+   */
+  virtual vtkTypeInt64 FetchSize();
+
+  /**
+   * @brief Fetch a range of the resource
+   *
+   * Called concurrently from the threads fetching blocks, reimplementations must be
+   * thread safe. Default implementation seeks and reads `Source` under a lock.
+   * Subclasses reimplementing this function must call `Reset()` in their destructor,
+   * so that no range is being fetched when they are destroyed.
+   *
+   * @param offset Position of the range in the resource
+   * @param buffer Storage for the range, of at least `bytes` bytes
+   * @param bytes Size of the range, may extend past the end of the resource
+   * @return The number of bytes fetched, less than `bytes` only at the end of the
+   * resource.
+   */
+  virtual std::size_t FetchRange(vtkTypeInt64 offset, void* buffer, std::size_t bytes);
+
+private:
+  std::size_t BlockSize = 1 << 20;
+  int ReadAheadBlocks = 4;
+  int CacheSize = 16;
+  int NumberOfThreads = 4;
+
+  std::unique_ptr<vtkInternals> Impl;
+};
+
+VTK_ABI_NAMESPACE_END
+
+#endif
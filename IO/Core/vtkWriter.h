@@ -39,7 +39,7 @@ public:
    * well as StartMethod() and EndMethod() methods.
    * Returns 1 on success and 0 on failure.
    */
-  virtual int Write();
+  VTK_UNBLOCKTHREADS virtual int Write();
 
   /**
    * Encode the string so that the reader will not have problems.
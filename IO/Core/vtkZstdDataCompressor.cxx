@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkZstdDataCompressor.h"
+#include "vtkObjectFactory.h"
+
+#if VTK_MODULE_ENABLE_VTK_zstd
+#include "vtk_zstd.h"
+#endif
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkZstdDataCompressor);
+
+namespace
+{
+// The Zstandard levels for the compression levels 1 to 9
+const int vtkZstdDataCompressorLevels[9] = { 1, 2, 3, 4, 6, 9, 12, 15, 19 };
+}
+
+//------------------------------------------------------------------------------
+vtkZstdDataCompressor::vtkZstdDataCompressor()
+{
+  this->CompressionLevel = 3;
+}
+
+//------------------------------------------------------------------------------
+vtkZstdDataCompressor::~vtkZstdDataCompressor() = default;
+
+//------------------------------------------------------------------------------
+void vtkZstdDataCompressor::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "CompressionLevel: " << this->CompressionLevel << endl;
+}
+
+//------------------------------------------------------------------------------
+bool vtkZstdDataCompressor::IsSupported()
+{
+#if VTK_MODULE_ENABLE_VTK_zstd
+  return true;
+#else
+  return false;
+#endif
+}
+
+//------------------------------------------------------------------------------
+size_t vtkZstdDataCompressor::CompressBuffer(unsigned char const* uncompressedData,
+  size_t uncompressedSize, unsigned char* compressedData, size_t compressionSpace)
+{
+#if VTK_MODULE_ENABLE_VTK_zstd
+  size_t cs = ZSTD_compress(compressedData, compressionSpace, uncompressedData, uncompressedSize,
+    vtkZstdDataCompressorLevels[this->CompressionLevel - 1]);
+  if (ZSTD_isError(cs))
+  {
+    vtkErrorMacro("Zstd error while compressing data: " << ZSTD_getErrorName(cs));
+    return 0;
+  }
+  return cs;
+#else
+  (void)uncompressedData;
+  (void)uncompressedSize;
+  (void)compressedData;
+  (void)compressionSpace;
+  vtkErrorMacro("Cannot compress data, VTK was built without Zstandard support.");
+  return 0;
+#endif
+}
+
+//------------------------------------------------------------------------------
+size_t vtkZstdDataCompressor::UncompressBuffer(unsigned char const* compressedData,
+  size_t compressedSize, unsigned char* uncompressedData, size_t uncompressedSize)
+{
+#if VTK_MODULE_ENABLE_VTK_zstd
+  size_t us = ZSTD_decompress(uncompressedData, uncompressedSize, compressedData, compressedSize);
+  if (ZSTD_isError(us))
+  {
+    vtkErrorMacro("Zstd error while uncompressing data: " << ZSTD_getErrorName(us));
+    return 0;
+  }
+  // Make sure the output size matched that expected.
+  if (us != uncompressedSize)
+  {
+    vtkErrorMacro("Decompression produced incorrect size.\n"
+                  "Expected "
+      << uncompressedSize << " and got " << us);
+    return 0;
+  }
+  return us;
+#else
+  (void)compressedData;
+  (void)compressedSize;
+  (void)uncompressedData;
+  (void)uncompressedSize;
+  vtkErrorMacro("Cannot uncompress data, VTK was built without Zstandard support.");
+  return 0;
+#endif
+}
+
+//------------------------------------------------------------------------------
+int vtkZstdDataCompressor::GetCompressionLevel()
+{
+  vtkDebugMacro(<< this->GetClassName() << " (" << this << "): returning CompressionLevel "
+                << this->CompressionLevel);
+  return this->CompressionLevel;
+}
+
+//------------------------------------------------------------------------------
+void vtkZstdDataCompressor::SetCompressionLevel(int compressionLevel)
+{
+  int min = 1;
+  int max = 9;
+  vtkDebugMacro(<< this->GetClassName() << " (" << this << "): setting CompressionLevel to "
+                << compressionLevel);
+  if (this->CompressionLevel !=
+    (compressionLevel < min ? min : (compressionLevel > max ? max : compressionLevel)))
+  {
+    this->CompressionLevel =
+      (compressionLevel < min ? min : (compressionLevel > max ? max : compressionLevel));
+    this->Modified();
+  }
+}
+
+//------------------------------------------------------------------------------
+size_t vtkZstdDataCompressor::GetMaximumCompressionSpace(size_t size)
+{
+#if VTK_MODULE_ENABLE_VTK_zstd
+  return ZSTD_compressBound(size);
+#else
+  return size;
+#endif
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkZstdDataCompressor
+ * @brief   Data compression using Zstandard.
+ *
+ * vtkZstdDataCompressor provides a concrete vtkDataCompressor class
+ * using Zstandard for compressing and uncompressing data.  It compresses
+ * about as fast as LZ4 at the low levels, with ratios similar to or better
+ * than ZLib.
+ *
+ * Zstandard is not provided by VTK: this class is always available, but it
+ * only compresses and uncompresses data when VTK is built with VTK_USE_ZSTD
+ * and an external zstd library.  Otherwise it reports an error.
+ */
+
+#ifndef vtkZstdDataCompressor_h
+#define vtkZstdDataCompressor_h
+
+#include "vtkDataCompressor.h"
+#include "vtkIOCoreModule.h" // For export macro
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKIOCORE_EXPORT vtkZstdDataCompressor : public vtkDataCompressor
+{
+public:
+  vtkTypeMacro(vtkZstdDataCompressor, vtkDataCompressor);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  static vtkZstdDataCompressor* New();
+
+  /**
+   *  Get the maximum space that may be needed to store data of the
+   *  given uncompressed size after compression.  This is the minimum
+   *  size of the output buffer that can be passed to the four-argument
+   *  Compress method.
+   */
+  size_t GetMaximumCompressionSpace(size_t size) override;
+
+  /**
+   *  Get/Set the compression level, from 1 (fastest) to 9 (best
+   *  compression).  The levels are mapped to the Zstandard levels 1 to 19.
+   */
+  // Compression level setter required by vtkDataCompressor.
+  void SetCompressionLevel(int compressionLevel) override;
+
+  // Compression level getter required by vtkDataCompressor.
+  int GetCompressionLevel() override;
+
+  /**
+   * Return true if VTK was built with Zstandard, so that this compressor
+   * can compress and uncompress data.
+   */
+  static bool IsSupported();
+
+protected:
+  vtkZstdDataCompressor();
+  ~vtkZstdDataCompressor() override;
+
+  int CompressionLevel;
+
+  // Compression method required by vtkDataCompressor.
+  size_t CompressBuffer(unsigned char const* uncompressedData, size_t uncompressedSize,
+    unsigned char* compressedData, size_t compressionSpace) override;
+  // Decompression method required by vtkDataCompressor.
+  size_t UncompressBuffer(unsigned char const* compressedData, size_t compressedSize,
+    unsigned char* uncompressedData, size_t uncompressedSize) override;
+
+private:
+  vtkZstdDataCompressor(const vtkZstdDataCompressor&) = delete;
+  void operator=(const vtkZstdDataCompressor&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
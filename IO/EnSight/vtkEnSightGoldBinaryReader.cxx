@@ -13,6 +13,7 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPTools.h"
 #include "vtkStructuredGrid.h"
 #include "vtkUnstructuredGrid.h"
 #include "vtksys/Encoding.hxx"
@@ -20,7 +21,7 @@
 #include "vtksys/RegularExpression.hxx"
 #include "vtksys/SystemTools.hxx"
 
-#include <algorithm> /* std::remove */
+#include <algorithm> /* std::remove, std::replace */
 #include <array>
 #include <cctype>
 #include <map>
@@ -75,6 +76,36 @@ class vtkEnSightGoldBinaryReader::vtkUtilities
   }
 
 public:
+  // Read the x, y and z coordinates of numPts points, stored one after the
+  // other, and interleave them into points.
+  static bool ReadCoordinates(vtkEnSightGoldBinaryReader* self, vtkPoints* points, int numPts)
+  {
+    std::vector<float> coords(3 * static_cast<size_t>(numPts));
+    float* xCoords = coords.data();
+    float* yCoords = xCoords + numPts;
+    float* zCoords = yCoords + numPts;
+    if (!self->ReadFloatArray(xCoords, numPts) || !self->ReadFloatArray(yCoords, numPts) ||
+      !self->ReadFloatArray(zCoords, numPts))
+    {
+      return false;
+    }
+
+    vtkNew<vtkFloatArray> array;
+    array->SetNumberOfComponents(3);
+    array->SetNumberOfTuples(numPts);
+    float* xyz = array->GetPointer(0);
+    vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        xyz[3 * i] = xCoords[i];
+        xyz[3 * i + 1] = yCoords[i];
+        xyz[3 * i + 2] = zCoords[i];
+      }
+    });
+    points->SetData(array);
+    return true;
+  }
+
   static vtkSmartPointer<vtkFloatArray> ReadVariableFloats(const char* sectionHeader,
     vtkEnSightGoldBinaryReader* self, const char* description, vtkDataSetAttributes* dsa,
     vtkIdType numElements, int numComponents, int component = -1)
@@ -111,13 +142,10 @@ public:
       if (hasUndef)
       {
         const float nanfloat = std::nanf("1");
-        for (vtkIdType cc = 0; cc < numElements; ++cc)
-        {
-          if (farray->GetTypedComponent(cc, 0) == undefValue)
-          {
-            farray->SetTypedComponent(cc, 0, nanfloat);
-          }
-        }
+        float* values = farray->GetPointer(0);
+        vtkSMPTools::For(0, numElements, [&](vtkIdType begin, vtkIdType end) {
+          std::replace(values + begin, values + end, undefValue, nanfloat);
+        });
       }
     };
 
@@ -135,10 +163,18 @@ public:
           pbuffer->GetPointer(0), static_cast<int>(partialIndices->GetNumberOfIds()));
 
         // now copy the tuples over from pbuffer to buffer.
-        vtkNew<vtkIdList> srcIds;
-        srcIds->SetNumberOfIds(partialIndices->GetNumberOfIds());
-        std::iota(srcIds->begin(), srcIds->end(), 0);
-        buffer->InsertTuples(partialIndices, srcIds, pbuffer);
+        const float* src = pbuffer->GetPointer(0);
+        float* dst = buffer->GetPointer(0);
+        const vtkIdType* dstIds = partialIndices->GetPointer(0);
+        vtkSMPTools::For(0, partialIndices->GetNumberOfIds(), [&](vtkIdType begin, vtkIdType end) {
+          for (vtkIdType cc = begin; cc < end; ++cc)
+          {
+            if (dstIds[cc] >= 0 && dstIds[cc] < count)
+            {
+              dst[dstIds[cc]] = src[cc];
+            }
+          }
+        });
       }
       else
       {
@@ -1903,7 +1939,6 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
   int* nodeIdList;
   int numElements;
   int idx, cellId, cellType;
-  float *xCoords, *yCoords, *zCoords;
 
   this->NumberOfNewOutputs++;
 
@@ -1949,30 +1984,15 @@ int vtkEnSightGoldBinaryReader::CreateUnstructuredGridOutput(
       vtkPoints* points = vtkPoints::New();
       vtkDebugMacro("num. points: " << numPts);
 
-      points->Allocate(numPts);
-
       if (this->NodeIdsListed)
       {
         this->GoldIFile->seekg(sizeof(int) * numPts + this->FortranSkipBytes, ios::cur);
       }
 
-      xCoords = new float[numPts];
-      yCoords = new float[numPts];
-      zCoords = new float[numPts];
-      this->ReadFloatArray(xCoords, numPts);
-      this->ReadFloatArray(yCoords, numPts);
-      this->ReadFloatArray(zCoords, numPts);
-
-      for (i = 0; i < numPts; i++)
-      {
-        points->InsertNextPoint(xCoords[i], yCoords[i], zCoords[i]);
-      }
+      vtkUtilities::ReadCoordinates(this, points, numPts);
 
       output->SetPoints(points);
       points->Delete();
-      delete[] xCoords;
-      delete[] yCoords;
-      delete[] zCoords;
     }
     else if (strncmp(line, "point", 5) == 0)
     {
@@ -2984,7 +3004,6 @@ int vtkEnSightGoldBinaryReader::CreateStructuredGridOutput(
   int i;
   vtkPoints* points = vtkPoints::New();
   int numPts;
-  float *xCoords, *yCoords, *zCoords;
 
   this->NumberOfNewOutputs++;
 
@@ -3024,19 +3043,8 @@ int vtkEnSightGoldBinaryReader::CreateStructuredGridOutput(
     return -1;
   }
   output->SetDimensions(dimensions);
-  points->Allocate(numPts);
-
-  xCoords = new float[numPts];
-  yCoords = new float[numPts];
-  zCoords = new float[numPts];
-  this->ReadFloatArray(xCoords, numPts);
-  this->ReadFloatArray(yCoords, numPts);
-  this->ReadFloatArray(zCoords, numPts);
 
-  for (i = 0; i < numPts; i++)
-  {
-    points->InsertNextPoint(xCoords[i], yCoords[i], zCoords[i]);
-  }
+  vtkUtilities::ReadCoordinates(this, points, numPts);
   output->SetPoints(points);
   if (iblanked)
   {
@@ -3054,9 +3062,6 @@ int vtkEnSightGoldBinaryReader::CreateStructuredGridOutput(
   }
 
   points->Delete();
-  delete[] xCoords;
-  delete[] yCoords;
-  delete[] zCoords;
 
   this->GoldIFile->peek();
   if (this->GoldIFile->eof())
@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Write a block of hexahedra with vtkExodusIIWriter, uncompressed and
+// compressed, and check that vtkExodusIIReader reads back the same cells,
+// with and without squeezing the points of the block.
+
+#include "vtkCellArray.h"
+#include "vtkExodusIIReader.h"
+#include "vtkExodusIIWriter.h"
+#include "vtkIdList.h"
+#include "vtkLogger.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkTestUtilities.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cstdlib>
+#include <initializer_list>
+#include <string>
+
+int TestExodusBlockCells(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string fileNamePrefix = std::string(tempDir) + "/TestExodusBlockCells";
+  delete[] tempDir;
+
+  // a grid of n*n*n hexahedra
+  const int n = 12;
+  vtkNew<vtkPoints> points;
+  for (int k = 0; k <= n; ++k)
+  {
+    for (int j = 0; j <= n; ++j)
+    {
+      for (int i = 0; i <= n; ++i)
+      {
+        points->InsertNextPoint(i, 0.5 * j, 0.25 * k);
+      }
+    }
+  }
+  vtkNew<vtkUnstructuredGrid> grid;
+  grid->SetPoints(points);
+  grid->Allocate(n * n * n);
+  auto id = [n](int i, int j, int k) { return i + (n + 1) * (j + (n + 1) * k); };
+  for (int k = 0; k < n; ++k)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      for (int i = 0; i < n; ++i)
+      {
+        const vtkIdType hex[8] = { id(i, j, k), id(i + 1, j, k), id(i + 1, j + 1, k),
+          id(i, j + 1, k), id(i, j, k + 1), id(i + 1, j, k + 1), id(i + 1, j + 1, k + 1),
+          id(i, j + 1, k + 1) };
+        grid->InsertNextCell(VTK_HEXAHEDRON, 8, hex);
+      }
+    }
+  }
+
+  for (int level : { 0, 4 })
+  {
+    const std::string fileName = fileNamePrefix + std::to_string(level) + ".exo";
+    vtkNew<vtkExodusIIWriter> writer;
+    writer->SetInputData(grid);
+    writer->SetFileName(fileName.c_str());
+    writer->WriteAllTimeStepsOff();
+    writer->SetCompressionLevel(level);
+    if (!writer->Write())
+    {
+      vtkLog(ERROR, "Cannot write " << fileName);
+      return EXIT_FAILURE;
+    }
+
+    for (int squeeze : { 1, 0 })
+    {
+      const std::string context =
+        "squeeze " + std::to_string(squeeze) + " and compression " + std::to_string(level);
+      vtkNew<vtkExodusIIReader> reader;
+      reader->SetFileName(fileName.c_str());
+      reader->SetSqueezePoints(squeeze);
+      reader->UpdateInformation();
+      reader->SetAllArrayStatus(vtkExodusIIReader::ELEM_BLOCK, 1);
+      reader->Update();
+      vtkMultiBlockDataSet* elementBlocks =
+        vtkMultiBlockDataSet::SafeDownCast(reader->GetOutput()->GetBlock(0));
+      vtkUnstructuredGrid* output = elementBlocks
+        ? vtkUnstructuredGrid::SafeDownCast(elementBlocks->GetBlock(0))
+        : nullptr;
+      if (!output || output->GetNumberOfCells() != grid->GetNumberOfCells())
+      {
+        vtkLog(ERROR, "Wrong number of cells read with " << context);
+        return EXIT_FAILURE;
+      }
+
+      vtkNew<vtkIdList> cellIds;
+      vtkNew<vtkIdList> outCellIds;
+      for (vtkIdType c = 0; c < grid->GetNumberOfCells(); ++c)
+      {
+        grid->GetCellPoints(c, cellIds);
+        output->GetCellPoints(c, outCellIds);
+        if (output->GetCellType(c) != VTK_HEXAHEDRON ||
+          outCellIds->GetNumberOfIds() != cellIds->GetNumberOfIds())
+        {
+          vtkLog(ERROR, "Wrong cell " << c << " read with " << context);
+          return EXIT_FAILURE;
+        }
+        for (vtkIdType p = 0; p < cellIds->GetNumberOfIds(); ++p)
+        {
+          double x[3], y[3];
+          points->GetPoint(cellIds->GetId(p), x);
+          output->GetPoint(outCellIds->GetId(p), y);
+          if (x[0] != y[0] || x[1] != y[1] || x[2] != y[2])
+          {
+            vtkLog(ERROR, "Wrong point " << p << " of cell " << c << " read with " << context);
+            return EXIT_FAILURE;
+          }
+        }
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -25,6 +25,7 @@
 #include "vtkPointData.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkSortDataArray.h"
 #include "vtkStdString.h"
@@ -1258,7 +1259,32 @@ void vtkExodusIIReaderPrivate::InsertBlockCells(
     return;
   }
 
-  if (this->SqueezePoints)
+  const vtkIdType numberOfIds = static_cast<vtkIdType>(binfo->Size) * binfo->PointsPerCell;
+  if (!ent && arr->GetNumberOfValues() == numberOfIds)
+  {
+    // All the cells have the same number of points: build the cell array from the whole
+    // connectivity at once instead of inserting the cells one by one. The array read has one
+    // component per point of the cell, and stays in the cache, so it is copied.
+    vtkNew<vtkIdTypeArray> connectivity;
+    connectivity->SetNumberOfValues(numberOfIds);
+    const vtkIdType* srcIds = arr->GetPointer(0);
+    vtkIdType* dstIds = connectivity->GetPointer(0);
+    if (this->SqueezePoints)
+    {
+      for (vtkIdType i = 0; i < numberOfIds; ++i)
+      {
+        dstIds[i] = this->GetSqueezePointId(binfo, srcIds[i]);
+      }
+    }
+    else
+    {
+      std::copy(srcIds, srcIds + numberOfIds, dstIds);
+    }
+    vtkNew<vtkCellArray> cells;
+    cells->SetData(binfo->PointsPerCell, connectivity);
+    binfo->CachedConnectivity->SetCells(binfo->CellType, cells);
+  }
+  else if (this->SqueezePoints)
   {
     std::vector<vtkIdType> cellIds;
     cellIds.resize(binfo->PointsPerCell);
@@ -2390,10 +2416,13 @@ vtkDataArray* vtkExodusIIReaderPrivate::GetCacheOrRead(vtkExodusIICacheKey key)
     }
     else
     {
-      for (c = 0; c <= iarr->GetMaxId(); ++c, ++ptr)
-      {
-        *ptr = *ptr - 1;
-      }
+      // The values are independent, make them 0-based in parallel
+      vtkSMPTools::For(0, iarr->GetNumberOfValues(), [ptr](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          ptr[i] -= 1;
+        }
+      });
     }
 
     arr = iarr;
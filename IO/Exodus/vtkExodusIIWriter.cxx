@@ -22,12 +22,15 @@
 #include "vtkObjectFactory.h"
 #include "vtkPlatform.h" // for VTK_MAXPATH
 #include "vtkPointData.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
 #include "vtkThreshold.h"
 #include "vtkUnstructuredGrid.h"
 
 #include "vtk_exodusII.h"
+#include <atomic>
 #include <cctype>
 #include <ctime>
 #include <map>
@@ -83,6 +86,7 @@ vtkExodusIIWriter::vtkExodusIIWriter()
   this->LocalElementIdMap = nullptr;
   this->TopologyChanged = false;
   this->IgnoreMetaDataWarning = false;
+  this->CompressionLevel = 0;
 }
 
 vtkExodusIIWriter::~vtkExodusIIWriter()
@@ -118,6 +122,7 @@ void vtkExodusIIWriter::PrintSelf(ostream& os, vtkIndent indent)
     this->ModelMetadata->PrintSelf(os, indent.GetNextIndent());
   }
   os << indent << "IgnoreMetaDataWarning " << this->IgnoreMetaDataWarning << endl;
+  os << indent << "CompressionLevel " << this->CompressionLevel << endl;
 }
 
 //------------------------------------------------------------------------------
@@ -518,12 +523,14 @@ int vtkExodusIIWriter::CreateNewExodusFile()
 {
   int compWordSize = (this->PassDoubles ? sizeof(double) : sizeof(float));
   int IOWordSize = (this->StoreDoubles ? sizeof(double) : sizeof(float));
+  // compression requires the chunked storage of netCDF-4 files
+  int mode = this->CompressionLevel > 0 ? (EX_CLOBBER | EX_NETCDF4) : EX_CLOBBER;
 
   if (this->NumberOfProcesses == 1)
   {
     if (!this->WriteAllTimeSteps || this->CurrentTimeIndex == 0)
     {
-      this->fid = ex_create(this->FileName, EX_CLOBBER, &compWordSize, &IOWordSize);
+      this->fid = ex_create(this->FileName, mode, &compWordSize, &IOWordSize);
       if (fid <= 0)
       {
         vtkErrorMacro(<< "vtkExodusIIWriter: CreateNewExodusFile can't create " << this->FileName);
@@ -533,7 +540,7 @@ int vtkExodusIIWriter::CreateNewExodusFile()
     {
       char* myFileName = new char[VTK_MAXPATH];
       snprintf(myFileName, VTK_MAXPATH, "%s-s.%06d", this->FileName, this->CurrentTimeIndex);
-      this->fid = ex_create(myFileName, EX_CLOBBER, &compWordSize, &IOWordSize);
+      this->fid = ex_create(myFileName, mode, &compWordSize, &IOWordSize);
       if (fid <= 0)
       {
         vtkErrorMacro(<< "vtkExodusIIWriter: CreateNewExodusFile can't create " << myFileName);
@@ -558,13 +565,18 @@ int vtkExodusIIWriter::CreateNewExodusFile()
       GetNumberOfDigits(static_cast<unsigned int>(this->NumberOfProcesses - 1));
     myFileName << this->NumberOfProcesses << "." << std::setfill('0') << std::setw(numDigits)
                << this->MyRank;
-    this->fid = ex_create(myFileName.str().c_str(), EX_CLOBBER, &compWordSize, &IOWordSize);
+    this->fid = ex_create(myFileName.str().c_str(), mode, &compWordSize, &IOWordSize);
     if (this->fid <= 0)
     {
       vtkErrorMacro(<< "vtkExodusIIWriter: CreateNewExodusFile can't create " << myFileName.str());
     }
   }
   ex_set_max_name_length(this->fid, static_cast<int>(this->GetMaxNameLength()));
+  if (this->fid > 0 && this->CompressionLevel > 0)
+  {
+    ex_set_option(this->fid, EX_OPT_COMPRESSION_LEVEL, this->CompressionLevel);
+    ex_set_option(this->fid, EX_OPT_COMPRESSION_SHUFFLE, 1);
+  }
 
   // FileTimeOffset makes the time in the file relative
   // e.g., if the CurrentTimeIndex for this file is 4 and goes through 6, the
@@ -1831,77 +1843,92 @@ int vtkExodusIIWriter::WriteBlockInformation()
 
   // Prepare the pointers as flat arrays for Exodus
   // connectivity and attributes, if we need doubles.
+  // Every cell fills its own range of its block's arrays, so the cells of an
+  // input are converted in parallel.
   int pointOffset = 0;
+  vtkSMPThreadLocalObject<vtkIdList> tlCellPoints;
   for (size_t i = 0; i < this->FlattenedInput.size(); i++)
   {
-    vtkCellArray* ca = this->FlattenedInput[i]->GetCells();
+    vtkUnstructuredGrid* input = this->FlattenedInput[i];
+    vtkCellArray* ca = input->GetCells();
+    vtkIntArray* blockIds = this->BlockIdList[i];
+    const std::vector<int>& cellToElementOffset = this->CellToElementOffset[i];
 
-    int ncells = this->FlattenedInput[i]->GetNumberOfCells();
-    for (int j = 0; j < ncells; j++)
-    {
-      int blockId = this->BlockIdList[i]->GetValue(j); // CLM
-      int blockOutIndex = this->BlockInfoMap[blockId].OutputIndex;
-
-      int nodesPerElement = this->BlockInfoMap[blockId].NodesPerElement;
-      vtkIdType elementOffset = this->CellToElementOffset[i][j];
-      int offset;
-      if (nodesPerElement == 0)
-      {
-        offset = this->BlockInfoMap[blockId].EntityNodeOffsets[j];
-      }
-      else
+    vtkSMPTools::For(0, input->GetNumberOfCells(), [&](vtkIdType begin, vtkIdType end) {
+      vtkIdList* cellPoints = tlCellPoints.Local();
+      for (vtkIdType j = begin; j < end; j++)
       {
-        offset = elementOffset * nodesPerElement;
-      }
+        int blockId = blockIds->GetValue(j); // CLM
+        std::map<int, Block>::const_iterator blockIter = this->BlockInfoMap.find(blockId);
+        if (blockIter == this->BlockInfoMap.end())
+        {
+          continue;
+        }
+        const Block& block = blockIter->second;
+        int blockOutIndex = block.OutputIndex;
+
+        int nodesPerElement = block.NodesPerElement;
+        vtkIdType elementOffset = cellToElementOffset[j];
+        int offset;
+        if (nodesPerElement == 0)
+        {
+          offset = block.EntityNodeOffsets[j];
+        }
+        else
+        {
+          offset = elementOffset * nodesPerElement;
+        }
 
-      // the block connectivity array
-      vtkIdType npts;
-      const vtkIdType* ptIds;
-      ca->GetCellAtId(j, npts, ptIds);
+        // the block connectivity array
+        vtkIdType npts;
+        const vtkIdType* ptIds;
+        ca->GetCellAtId(j, npts, ptIds, cellPoints);
 
-      switch (this->FlattenedInput[i]->GetCellType(j))
-      {
-        case VTK_VOXEL: // reorder to exodus HEX type
-          connectivity[blockOutIndex][offset + 0] = pointOffset + (int)ptIds[0] + 1;
-          connectivity[blockOutIndex][offset + 1] = pointOffset + (int)ptIds[1] + 1;
-          connectivity[blockOutIndex][offset + 3] = pointOffset + (int)ptIds[2] + 1;
-          connectivity[blockOutIndex][offset + 2] = pointOffset + (int)ptIds[3] + 1;
-          connectivity[blockOutIndex][offset + 4] = pointOffset + (int)ptIds[4] + 1;
-          connectivity[blockOutIndex][offset + 5] = pointOffset + (int)ptIds[5] + 1;
-          connectivity[blockOutIndex][offset + 7] = pointOffset + (int)ptIds[6] + 1;
-          connectivity[blockOutIndex][offset + 6] = pointOffset + (int)ptIds[7] + 1;
-          break;
-        default:
-          for (vtkIdType p = 0; p < npts; p++)
-          {
-            int ExodusPointId = pointOffset + (int)ptIds[p] + 1;
-            connectivity[blockOutIndex][offset + p] = ExodusPointId;
-          }
-      }
+        int* conn = connectivity[blockOutIndex] + offset;
+        switch (input->GetCellType(j))
+        {
+          case VTK_VOXEL: // reorder to exodus HEX type
+            conn[0] = pointOffset + (int)ptIds[0] + 1;
+            conn[1] = pointOffset + (int)ptIds[1] + 1;
+            conn[3] = pointOffset + (int)ptIds[2] + 1;
+            conn[2] = pointOffset + (int)ptIds[3] + 1;
+            conn[4] = pointOffset + (int)ptIds[4] + 1;
+            conn[5] = pointOffset + (int)ptIds[5] + 1;
+            conn[7] = pointOffset + (int)ptIds[6] + 1;
+            conn[6] = pointOffset + (int)ptIds[7] + 1;
+            break;
+          default:
+            for (vtkIdType p = 0; p < npts; p++)
+            {
+              int ExodusPointId = pointOffset + (int)ptIds[p] + 1;
+              conn[p] = ExodusPointId;
+            }
+        }
 
-      // the block element attributes
-      float* att = this->BlockInfoMap[blockId].BlockAttributes;
+        // the block element attributes
+        float* att = block.BlockAttributes;
 
-      int numAtts = this->BlockInfoMap[blockId].NumAttributes;
+        int numAtts = block.NumAttributes;
 
-      if ((numAtts == 0) || (att == nullptr))
-        continue;
+        if ((numAtts == 0) || (att == nullptr))
+          continue;
 
-      int attOff = (elementOffset * numAtts); // location for the element in the block
+        int attOff = (elementOffset * numAtts); // location for the element in the block
 
-      if (this->PassDoubles)
-      {
-        for (int k = 0; k < numAtts; k++)
+        if (this->PassDoubles)
         {
-          int off = attOff + k;
-          // TODO verify the assumption that ModelMetadata stores
-          // elements in the same order we do
-          // Could probably use the global node id? but how global is global.
-          attributesD[blockOutIndex][off] = static_cast<double>(att[off]);
+          for (int k = 0; k < numAtts; k++)
+          {
+            int off = attOff + k;
+            // TODO verify the assumption that ModelMetadata stores
+            // elements in the same order we do
+            // Could probably use the global node id? but how global is global.
+            attributesD[blockOutIndex][off] = static_cast<double>(att[off]);
+          }
         }
       }
-    }
-    pointOffset += this->FlattenedInput[i]->GetNumberOfPoints();
+    });
+    pointOffset += input->GetNumberOfPoints();
   }
 
   // Now, finally, write out the block information
@@ -2853,81 +2880,86 @@ double vtkExodusIIWriter::ExtractGlobalData(const char* name, int comp, int ts)
 void vtkExodusIIWriter::ExtractCellData(const char* name, int comp, vtkDataArray* buffer)
 {
   buffer->SetNumberOfTuples(this->NumCells);
+  std::atomic<bool> outOfSync(false);
   for (size_t i = 0; i < this->FlattenedInput.size(); i++)
   {
     vtkDataArray* da = this->FlattenedInput[i]->GetCellData()->GetArray(name);
     int ncells = this->FlattenedInput[i]->GetNumberOfCells();
-    if (da)
-    {
-      vtkArrayIterator* arrayIter = da->NewIterator();
-      vtkIdType ncomp = da->GetNumberOfComponents();
-      for (vtkIdType j = 0; j < ncells; j++)
+    vtkIntArray* blockIds = this->BlockIdList[i];
+    const std::vector<int>& cellToElementOffset = this->CellToElementOffset[i];
+    vtkArrayIterator* arrayIter = da ? da->NewIterator() : nullptr;
+    vtkIdType ncomp = da ? da->GetNumberOfComponents() : 0;
+    // each cell sets its own value of the buffer
+    vtkSMPTools::For(0, ncells, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType j = begin; j < end; j++)
       {
         std::map<int, Block>::const_iterator blockIter =
-          this->BlockInfoMap.find(this->BlockIdList[i]->GetValue(j));
+          this->BlockInfoMap.find(blockIds->GetValue(j));
         if (blockIter == this->BlockInfoMap.end())
         {
-          vtkWarningMacro("vtkExodusIIWriter: The block id map has come out of sync");
+          outOfSync = true;
+          continue;
+        }
+        int index = blockIter->second.ElementStartIndex + cellToElementOffset[j];
+        if (!da)
+        {
+          buffer->SetTuple1(index, 0);
           continue;
         }
-        int index = blockIter->second.ElementStartIndex + CellToElementOffset[i][j];
         switch (da->GetDataType())
         {
           vtkArrayIteratorTemplateMacro(buffer->SetTuple1(index,
             vtkExodusIIWriterGetComponent(static_cast<VTK_TT*>(arrayIter), j * ncomp + comp)));
         }
       }
-      arrayIter->Delete();
-    }
-    else
+    });
+    if (arrayIter)
     {
-      for (vtkIdType j = 0; j < ncells; j++)
-      {
-        std::map<int, Block>::const_iterator blockIter =
-          this->BlockInfoMap.find(this->BlockIdList[i]->GetValue(j));
-        if (blockIter == this->BlockInfoMap.end())
-        {
-          vtkWarningMacro("vtkExodusIIWriter: The block id map has come out of sync");
-          continue;
-        }
-        int index = blockIter->second.ElementStartIndex + CellToElementOffset[i][j];
-        buffer->SetTuple1(index, 0);
-      }
+      arrayIter->Delete();
     }
   }
+  if (outOfSync)
+  {
+    vtkWarningMacro("vtkExodusIIWriter: The block id map has come out of sync");
+  }
 }
 
 //------------------------------------------------------------------------------
 void vtkExodusIIWriter::ExtractPointData(const char* name, int comp, vtkDataArray* buffer)
 {
   buffer->SetNumberOfTuples(this->NumPoints);
-  int index = 0;
+  vtkIdType index = 0;
   for (size_t i = 0; i < this->FlattenedInput.size(); i++)
   {
     vtkDataArray* da = this->FlattenedInput[i]->GetPointData()->GetArray(name);
+    vtkIdType npts = this->FlattenedInput[i]->GetNumberOfPoints();
     if (da)
     {
       vtkArrayIterator* iter = da->NewIterator();
       vtkIdType ncomp = da->GetNumberOfComponents();
-      vtkIdType nvals = ncomp * da->GetNumberOfTuples();
-      for (vtkIdType j = comp; j < nvals; j += ncomp)
-      {
-        switch (da->GetDataType())
+      npts = da->GetNumberOfTuples();
+      vtkSMPTools::For(0, npts, [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType j = begin; j < end; j++)
         {
-          vtkArrayIteratorTemplateMacro(buffer->SetTuple1(
-            index++, vtkExodusIIWriterGetComponent(static_cast<VTK_TT*>(iter), j)));
+          switch (da->GetDataType())
+          {
+            vtkArrayIteratorTemplateMacro(buffer->SetTuple1(index + j,
+              vtkExodusIIWriterGetComponent(static_cast<VTK_TT*>(iter), j * ncomp + comp)));
+          }
         }
-      }
+      });
       iter->Delete();
     }
     else
     {
-      vtkIdType nvals = this->FlattenedInput[i]->GetNumberOfPoints();
-      for (vtkIdType j = 0; j < nvals; j++)
-      {
-        buffer->SetTuple1(index++, 0);
-      }
+      vtkSMPTools::For(0, npts, [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType j = begin; j < end; j++)
+        {
+          buffer->SetTuple1(index + j, 0);
+        }
+      });
     }
+    index += npts;
   }
 }
 
@@ -166,6 +166,16 @@ public:
   vtkGetMacro(IgnoreMetaDataWarning, bool);
   vtkBooleanMacro(IgnoreMetaDataWarning, bool);
 
+  /**
+   * Compression level, in the range [0, 9], of the variables written to the
+   * file.  When non-zero, the file is created in the netCDF-4 format whose
+   * variables are chunked, shuffled and compressed with zlib.  The default, 0,
+   * writes uncompressed files in the classic netCDF format.
+   */
+
+  vtkSetClampMacro(CompressionLevel, int, 0, 9);
+  vtkGetMacro(CompressionLevel, int);
+
 protected:
   vtkExodusIIWriter();
   ~vtkExodusIIWriter() override;
@@ -194,6 +204,7 @@ protected:
   int FileTimeOffset;
   bool TopologyChanged;
   bool IgnoreMetaDataWarning;
+  int CompressionLevel;
 
   vtkDataObject* OriginalInput;
   std::vector<vtkSmartPointer<vtkUnstructuredGrid>> FlattenedInput;
@@ -43,7 +43,7 @@ public:
    * Write data to output. Method executes subclasses WriteData() method, as
    * well as StartWrite() and EndWrite() methods.
    */
-  virtual void Write();
+  VTK_UNBLOCKTHREADS virtual void Write();
 
   /**
    * Convenient alias for Write() method.
@@ -24,6 +24,16 @@ extern "C"
 extern "C"
 {
 #include <libavutil/imgutils.h>
+#include <libavutil/pixdesc.h>
+}
+#endif
+
+// hardware frames contexts of the encoders, from ffmpeg 4.0
+#if defined(LIBAVCODEC_VERSION_MAJOR) && LIBAVCODEC_VERSION_MAJOR >= 58
+#define VTK_FFMPEG_HAS_HW_CONFIG
+extern "C"
+{
+#include <libavutil/hwcontext.h>
 }
 #endif
 
@@ -57,6 +67,12 @@ private:
 
   AVCodecContext* avCodecContext;
 
+  SwsContext* swsContext;
+  AVBufferRef* hwDeviceContext;
+  AVFrame* hwFrame;
+
+  int WritePackets();
+
   int openedFile;
   int closedFile;
 };
@@ -77,6 +93,11 @@ vtkFFMPEGWriterInternal::vtkFFMPEGWriterInternal(vtkFFMPEGWriter* creator)
   this->rgbInput = nullptr;
   this->yuvOutput = nullptr;
 
+  this->avCodecContext = nullptr;
+  this->swsContext = nullptr;
+  this->hwDeviceContext = nullptr;
+  this->hwFrame = nullptr;
+
   this->openedFile = 0;
   this->closedFile = 1;
 
@@ -104,8 +125,18 @@ int vtkFFMPEGWriterInternal::Start()
   av_log_set_level(AV_LOG_ERROR);
 #endif
 
-  // choose avi media file format
-  this->avOutputFormat = av_guess_format("avi", nullptr, nullptr);
+  const char* encoderName = this->Writer->GetEncoder();
+  const bool namedEncoder = encoderName && *encoderName;
+
+  // choose the media file format from the file name with a named encoder, avi otherwise
+  if (namedEncoder)
+  {
+    this->avOutputFormat = av_guess_format(nullptr, this->Writer->GetFileName(), nullptr);
+  }
+  if (!this->avOutputFormat)
+  {
+    this->avOutputFormat = av_guess_format("avi", nullptr, nullptr);
+  }
   if (!this->avOutputFormat)
   {
     vtkGenericWarningMacro(<< "Could not open the avi media file format.");
@@ -124,12 +155,53 @@ int vtkFFMPEGWriterInternal::Start()
     return 0;
   }
 
-  vtk_ff_const59 AVCodec* codec;
-  if (!(codec = avcodec_find_encoder(video_codec)))
+  vtk_ff_const59 AVCodec* codec =
+    namedEncoder ? avcodec_find_encoder_by_name(encoderName) : avcodec_find_encoder(video_codec);
+  if (!codec)
   {
-    vtkGenericWarningMacro(<< "Failed to get video codec.");
+    vtkGenericWarningMacro(<< "Failed to get video codec " << (namedEncoder ? encoderName : "")
+                           << ".");
     return 0;
   }
+  video_codec = codec->id;
+
+  // the format of the frames given to the codec, converted from RGB
+  enum AVPixelFormat pixelFormat =
+    this->Writer->GetCompression() ? AV_PIX_FMT_YUVJ420P : AV_PIX_FMT_BGR24;
+  // the format of the frames in device memory for hardware encoders, if any
+  enum AVPixelFormat hwPixelFormat = AV_PIX_FMT_NONE;
+  if (namedEncoder)
+  {
+    pixelFormat = AV_PIX_FMT_NONE;
+    for (const enum AVPixelFormat* format = codec->pix_fmts;
+         format && *format != AV_PIX_FMT_NONE && pixelFormat == AV_PIX_FMT_NONE; ++format)
+    {
+      const AVPixFmtDescriptor* descriptor = av_pix_fmt_desc_get(*format);
+      if (descriptor && !(descriptor->flags & AV_PIX_FMT_FLAG_HWACCEL))
+      {
+        pixelFormat = *format;
+      }
+      else if (hwPixelFormat == AV_PIX_FMT_NONE)
+      {
+        hwPixelFormat = *format;
+      }
+    }
+    if (pixelFormat != AV_PIX_FMT_NONE)
+    {
+      // frames in system memory are accepted, as by the NVENC or VideoToolbox encoders
+      hwPixelFormat = AV_PIX_FMT_NONE;
+    }
+    else if (hwPixelFormat != AV_PIX_FMT_NONE)
+    {
+      // frames are uploaded to the device, as for the VAAPI encoders
+      pixelFormat = AV_PIX_FMT_NV12;
+    }
+    else
+    {
+      // the codec does not list its formats
+      pixelFormat = AV_PIX_FMT_YUV420P;
+    }
+  }
 
   // create a stream for that file
   this->avStream = avformat_new_stream(this->avFormatContext, codec);
@@ -150,14 +222,8 @@ int vtkFFMPEGWriterInternal::Start()
   this->avStream->codecpar->codec_type = AVMEDIA_TYPE_VIDEO;
   this->avStream->codecpar->width = this->Dim[0];
   this->avStream->codecpar->height = this->Dim[1];
-  if (this->Writer->GetCompression())
-  {
-    this->avStream->codecpar->format = AV_PIX_FMT_YUVJ420P;
-  }
-  else
-  {
-    this->avStream->codecpar->format = AV_PIX_FMT_BGR24;
-  }
+  this->avStream->codecpar->format =
+    hwPixelFormat != AV_PIX_FMT_NONE ? hwPixelFormat : pixelFormat;
   this->avStream->time_base.den = this->FrameRate;
   this->avStream->time_base.num = 1;
 
@@ -202,34 +268,78 @@ int vtkFFMPEGWriterInternal::Start()
   {
     this->avCodecContext->bit_rate_tolerance = this->Writer->GetBitRateTolerance();
   }
-  avcodec_parameters_from_context(this->avStream->codecpar, this->avCodecContext);
+  // let the software encoders choose their number of threads
+  this->avCodecContext->thread_count = 0;
 
-  if (avcodec_open2(this->avCodecContext, codec, nullptr) < 0)
+  if (hwPixelFormat != AV_PIX_FMT_NONE)
   {
-    vtkGenericWarningMacro(<< "Could not open codec.");
+#ifdef VTK_FFMPEG_HAS_HW_CONFIG
+    // find the device type of the encoder and create a pool of frames on the device
+    enum AVHWDeviceType deviceType = AV_HWDEVICE_TYPE_NONE;
+    for (int i = 0; const AVCodecHWConfig* config = avcodec_get_hw_config(codec, i); ++i)
+    {
+      if ((config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_FRAMES_CTX) &&
+        config->pix_fmt == hwPixelFormat)
+      {
+        deviceType = config->device_type;
+        break;
+      }
+    }
+    if (deviceType == AV_HWDEVICE_TYPE_NONE ||
+      av_hwdevice_ctx_create(&this->hwDeviceContext, deviceType, nullptr, nullptr, 0) < 0)
+    {
+      vtkGenericWarningMacro(<< "Could not open the device of encoder " << encoderName << ".");
+      return 0;
+    }
+    AVBufferRef* framesContextRef = av_hwframe_ctx_alloc(this->hwDeviceContext);
+    if (!framesContextRef)
+    {
+      vtkGenericWarningMacro(<< "Could not allocate the frames of encoder " << encoderName << ".");
+      return 0;
+    }
+    AVHWFramesContext* framesContext = reinterpret_cast<AVHWFramesContext*>(framesContextRef->data);
+    framesContext->format = hwPixelFormat;
+    framesContext->sw_format = pixelFormat;
+    framesContext->width = this->Dim[0];
+    framesContext->height = this->Dim[1];
+    framesContext->initial_pool_size = 4;
+    if (av_hwframe_ctx_init(framesContextRef) < 0)
+    {
+      av_buffer_unref(&framesContextRef);
+      vtkGenericWarningMacro(<< "Could not initialize the frames of encoder " << encoderName
+                             << ".");
+      return 0;
+    }
+    this->avCodecContext->hw_frames_ctx = framesContextRef;
+
+    this->hwFrame = av_frame_alloc();
+    if (!this->hwFrame)
+    {
+      vtkGenericWarningMacro(<< "Could not make hardware avframe.");
+      return 0;
+    }
+#else
+    vtkGenericWarningMacro(<< "Encoder " << encoderName << " requires ffmpeg 4.0 or later.");
     return 0;
+#endif
   }
 
-  // for the output of the writer's input...
-  this->rgbInput = av_frame_alloc();
-  if (!this->rgbInput)
+  avcodec_parameters_from_context(this->avStream->codecpar, this->avCodecContext);
+
+  if (avcodec_open2(this->avCodecContext, codec, nullptr) < 0)
   {
-    vtkGenericWarningMacro(<< "Could not make rgbInput avframe.");
+    vtkGenericWarningMacro(<< "Could not open codec.");
     return 0;
   }
-  this->rgbInput->format = AV_PIX_FMT_RGB24;
-  this->rgbInput->width = this->avCodecContext->width;
-  this->rgbInput->height = this->avCodecContext->height;
-  av_frame_get_buffer(this->rgbInput, 1);
 
-  // and for the output to the codec's input.
+  // the frames given to the codec, or uploaded to the device
   this->yuvOutput = av_frame_alloc();
   if (!this->yuvOutput)
   {
     vtkGenericWarningMacro(<< "Could not make yuvOutput avframe.");
     return 0;
   }
-  this->yuvOutput->format = this->avCodecContext->pix_fmt;
+  this->yuvOutput->format = pixelFormat;
   this->yuvOutput->width = this->avCodecContext->width;
   this->yuvOutput->height = this->avCodecContext->height;
   this->yuvOutput->pts = 0;
@@ -259,32 +369,32 @@ int vtkFFMPEGWriterInternal::Write(vtkImageData* id)
 {
   this->Writer->GetInputAlgorithm(0, 0)->UpdateWholeExtent();
 
-  // copy the image from the input to the RGB buffer while flipping Y
-  unsigned char* rgb = (unsigned char*)id->GetScalarPointer();
-  unsigned char* src;
-  for (int y = 0; y < this->avCodecContext->height; y++)
+  const int width = this->avCodecContext->width;
+  const int height = this->avCodecContext->height;
+
+  // the encoder may still reference the previous frame
+  if (av_frame_make_writable(this->yuvOutput) < 0)
   {
-    src = rgb + (this->avCodecContext->height - y - 1) * this->avCodecContext->width * 3; // flip Y
-    unsigned char* dest = &this->rgbInput->data[0][y * this->rgbInput->linesize[0]];
-    memcpy((void*)dest, (void*)src, this->avCodecContext->width * 3);
+    vtkGenericWarningMacro(<< "Could not make the frame writable.");
+    return 0;
   }
 
-  // convert that to YUV for input to the codec
-  SwsContext* convert_ctx =
-    sws_getContext(this->avCodecContext->width, this->avCodecContext->height, AV_PIX_FMT_RGB24,
-      this->avCodecContext->width, this->avCodecContext->height, this->avCodecContext->pix_fmt,
-      SWS_BICUBIC, nullptr, nullptr, nullptr);
-
-  if (convert_ctx == nullptr)
+  // convert the image to the format of the codec input while flipping Y
+  this->swsContext = sws_getCachedContext(this->swsContext, width, height, AV_PIX_FMT_RGB24,
+    width, height, static_cast<AVPixelFormat>(this->yuvOutput->format), SWS_BICUBIC, nullptr,
+    nullptr, nullptr);
+  if (this->swsContext == nullptr)
   {
     vtkGenericWarningMacro(<< "swscale context initialization failed");
     return 0;
   }
 
-  int result = sws_scale(convert_ctx, this->rgbInput->data, this->rgbInput->linesize, 0,
-    this->avCodecContext->height, this->yuvOutput->data, this->yuvOutput->linesize);
-
-  sws_freeContext(convert_ctx);
+  const unsigned char* rgb = static_cast<unsigned char*>(id->GetScalarPointer());
+  const uint8_t* const srcSlice[4] = { rgb + static_cast<size_t>(height - 1) * width * 3,
+    nullptr, nullptr, nullptr };
+  const int srcStride[4] = { -width * 3, 0, 0, 0 };
+  int result = sws_scale(this->swsContext, srcSlice, srcStride, 0, height, this->yuvOutput->data,
+    this->yuvOutput->linesize);
 
   if (!result)
   {
@@ -292,7 +402,24 @@ int vtkFFMPEGWriterInternal::Write(vtkImageData* id)
     return 0;
   }
 
-  int ret = avcodec_send_frame(this->avCodecContext, this->yuvOutput);
+  AVFrame* frame = this->yuvOutput;
+#ifdef VTK_FFMPEG_HAS_HW_CONFIG
+  if (this->hwFrame)
+  {
+    // upload the frame to the device of the encoder
+    av_frame_unref(this->hwFrame);
+    if (av_hwframe_get_buffer(this->avCodecContext->hw_frames_ctx, this->hwFrame, 0) < 0 ||
+      av_hwframe_transfer_data(this->hwFrame, this->yuvOutput, 0) < 0)
+    {
+      vtkGenericWarningMacro(<< "Could not upload the frame to the device.");
+      return 0;
+    }
+    this->hwFrame->pts = this->yuvOutput->pts;
+    frame = this->hwFrame;
+  }
+#endif
+
+  int ret = avcodec_send_frame(this->avCodecContext, frame);
   this->yuvOutput->pts++;
 
   if (ret < 0)
@@ -300,11 +427,18 @@ int vtkFFMPEGWriterInternal::Write(vtkImageData* id)
     return 1;
   }
 
+  return this->WritePackets();
+}
+
+//------------------------------------------------------------------------------
+int vtkFFMPEGWriterInternal::WritePackets()
+{
   // run the encoder
   AVPacket* pkt = av_packet_alloc();
   pkt->data = nullptr;
   pkt->size = 0;
 
+  int ret = 0;
   while (!ret)
   {
     // dump the compressed result to file
@@ -312,10 +446,12 @@ int vtkFFMPEGWriterInternal::Write(vtkImageData* id)
     if (!ret)
     {
       pkt->stream_index = this->avStream->index;
+      av_packet_rescale_ts(pkt, this->avCodecContext->time_base, this->avStream->time_base);
       int wret = av_write_frame(this->avFormatContext, pkt);
       if (wret < 0)
       {
         vtkGenericWarningMacro(<< "Problem encoding frame.");
+        av_packet_free(&pkt);
         return 0;
       }
     }
@@ -328,6 +464,27 @@ int vtkFFMPEGWriterInternal::Write(vtkImageData* id)
 //------------------------------------------------------------------------------
 void vtkFFMPEGWriterInternal::End()
 {
+  if (this->avCodecContext && this->openedFile)
+  {
+    // drain the frames delayed by the encoder
+    if (avcodec_send_frame(this->avCodecContext, nullptr) >= 0)
+    {
+      this->WritePackets();
+    }
+  }
+
+  if (this->swsContext)
+  {
+    sws_freeContext(this->swsContext);
+    this->swsContext = nullptr;
+  }
+
+  if (this->hwFrame)
+  {
+    av_frame_free(&this->hwFrame);
+    this->hwFrame = nullptr;
+  }
+
   if (this->yuvOutput)
   {
     av_frame_free(&this->yuvOutput);
@@ -368,6 +525,13 @@ void vtkFFMPEGWriterInternal::End()
     this->avCodecContext = nullptr;
   }
 
+#ifdef VTK_FFMPEG_HAS_HW_CONFIG
+  if (this->hwDeviceContext)
+  {
+    av_buffer_unref(&this->hwDeviceContext);
+  }
+#endif
+
   this->closedFile = 1;
 }
 
@@ -661,12 +825,14 @@ vtkFFMPEGWriter::vtkFFMPEGWriter()
   this->Rate = 25;
   this->BitRate = 0;
   this->BitRateTolerance = 0;
+  this->Encoder = nullptr;
 }
 
 //------------------------------------------------------------------------------
 vtkFFMPEGWriter::~vtkFFMPEGWriter()
 {
   delete this->Internals;
+  this->SetEncoder(nullptr);
 }
 
 //------------------------------------------------------------------------------
@@ -775,5 +941,6 @@ void vtkFFMPEGWriter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Rate: " << this->Rate << endl;
   os << indent << "BitRate: " << this->BitRate << endl;
   os << indent << "BitRateTolerance: " << this->BitRateTolerance << endl;
+  os << indent << "Encoder: " << (this->Encoder ? this->Encoder : "(none)") << endl;
 }
 VTK_ABI_NAMESPACE_END
@@ -87,6 +87,21 @@ public:
   vtkGetMacro(BitRateTolerance, int);
   ///@}
 
+  ///@{
+  /**
+   * Set/Get the name of the FFMPEG encoder, for instance "libx264" or a
+   * hardware encoder such as "h264_nvenc", "hevc_nvenc", "h264_vaapi" or
+   * "h264_videotoolbox". When set, Compression is ignored and the file
+   * format is guessed from the file name extension, for instance ".mp4",
+   * or is AVI if the extension is unknown. Frames are uploaded to the
+   * default device of encoders that only accept frames in device memory,
+   * such as the VAAPI ones. When not set (the default), MJPEG or raw video
+   * is written in an AVI file, depending on Compression.
+   */
+  vtkSetStringMacro(Encoder);
+  vtkGetStringMacro(Encoder);
+  ///@}
+
 protected:
   vtkFFMPEGWriter();
   ~vtkFFMPEGWriter() override;
@@ -99,6 +114,7 @@ protected:
   int BitRate;
   int BitRateTolerance;
   bool Compression;
+  char* Encoder;
 
 private:
   vtkFFMPEGWriter(const vtkFFMPEGWriter&) = delete;
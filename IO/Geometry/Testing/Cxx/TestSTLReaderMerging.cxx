@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Write a triangulated grid with a degenerate triangle in binary and ASCII
+// STL, and check that vtkSTLReader merges the points the same way without a
+// locator and with a vtkMergePoints locator, and keeps all of them when
+// merging is off.
+
+#include "vtkCellArray.h"
+#include "vtkLogger.h"
+#include "vtkMergePoints.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSTLReader.h"
+#include "vtkSTLWriter.h"
+#include "vtkTestUtilities.h"
+
+#include <cstdlib>
+#include <initializer_list>
+#include <string>
+
+int TestSTLReaderMerging(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string fileName = std::string(tempDir) + "/TestSTLReaderMerging.stl";
+  delete[] tempDir;
+
+  // a grid of n*n quads split in two triangles each
+  const int n = 40;
+  vtkNew<vtkPoints> points;
+  for (int j = 0; j <= n; ++j)
+  {
+    for (int i = 0; i <= n; ++i)
+    {
+      points->InsertNextPoint(i, j, 0.01 * i * j);
+    }
+  }
+  vtkNew<vtkCellArray> polys;
+  for (int j = 0; j < n; ++j)
+  {
+    for (int i = 0; i < n; ++i)
+    {
+      const vtkIdType p = i + (n + 1) * j;
+      const vtkIdType triangles[2][3] = { { p, p + 1, p + n + 2 }, { p, p + n + 2, p + n + 1 } };
+      polys->InsertNextCell(3, triangles[0]);
+      polys->InsertNextCell(3, triangles[1]);
+    }
+  }
+  const vtkIdType degenerate[3] = { 0, 1, 1 };
+  polys->InsertNextCell(3, degenerate);
+  vtkNew<vtkPolyData> polyData;
+  polyData->SetPoints(points);
+  polyData->SetPolys(polys);
+
+  for (int fileType : { VTK_BINARY, VTK_ASCII })
+  {
+    vtkNew<vtkSTLWriter> writer;
+    writer->SetInputData(polyData);
+    writer->SetFileName(fileName.c_str());
+    writer->SetFileType(fileType);
+    writer->Write();
+
+    vtkNew<vtkSTLReader> reader;
+    reader->SetFileName(fileName.c_str());
+    reader->Update();
+    vtkPolyData* output = reader->GetOutput();
+
+    vtkNew<vtkSTLReader> locatorReader;
+    locatorReader->SetFileName(fileName.c_str());
+    vtkNew<vtkMergePoints> locator;
+    locatorReader->SetLocator(locator);
+    locatorReader->Update();
+    vtkPolyData* locatorOutput = locatorReader->GetOutput();
+
+    if (output->GetNumberOfPoints() != points->GetNumberOfPoints() ||
+      locatorOutput->GetNumberOfPoints() != points->GetNumberOfPoints() ||
+      output->GetNumberOfPolys() != 2 * n * n || locatorOutput->GetNumberOfPolys() != 2 * n * n)
+    {
+      vtkLog(ERROR,
+        "Read " << output->GetNumberOfPoints() << " points and " << output->GetNumberOfPolys()
+                << " triangles from file type " << fileType);
+      return EXIT_FAILURE;
+    }
+    for (vtkIdType i = 0; i < output->GetNumberOfPoints(); ++i)
+    {
+      double x[3], y[3];
+      output->GetPoint(i, x);
+      locatorOutput->GetPoint(i, y);
+      if (x[0] != y[0] || x[1] != y[1] || x[2] != y[2])
+      {
+        vtkLog(ERROR, "Wrong point " << i << " from file type " << fileType);
+        return EXIT_FAILURE;
+      }
+    }
+    for (vtkIdType c = 0; c < output->GetNumberOfPolys(); ++c)
+    {
+      vtkIdType npts, locatorNpts;
+      const vtkIdType* pts;
+      const vtkIdType* locatorPts;
+      output->GetPolys()->GetCellAtId(c, npts, pts);
+      locatorOutput->GetPolys()->GetCellAtId(c, locatorNpts, locatorPts);
+      if (npts != 3 || locatorNpts != 3 || pts[0] != locatorPts[0] || pts[1] != locatorPts[1] ||
+        pts[2] != locatorPts[2])
+      {
+        vtkLog(ERROR, "Wrong triangle " << c << " from file type " << fileType);
+        return EXIT_FAILURE;
+      }
+    }
+
+    reader->MergingOff();
+    reader->Update();
+    output = reader->GetOutput();
+    const vtkIdType numTriangles = polys->GetNumberOfCells();
+    if (output->GetNumberOfPoints() != 3 * numTriangles ||
+      output->GetNumberOfPolys() != numTriangles)
+    {
+      vtkLog(ERROR, "Wrong output without merging from file type " << fileType);
+      return EXIT_FAILURE;
+    }
+    for (vtkIdType c = 0; c < numTriangles; ++c)
+    {
+      vtkIdType npts;
+      const vtkIdType* pts;
+      const vtkIdType* outPts;
+      polys->GetCellAtId(c, npts, pts);
+      output->GetPolys()->GetCellAtId(c, npts, outPts);
+      for (int k = 0; k < 3; ++k)
+      {
+        double x[3], y[3];
+        points->GetPoint(pts[k], x);
+        output->GetPoint(outPts[k], y);
+        if (outPts[k] != 3 * c + k || x[0] != y[0] || x[1] != y[1] || x[2] != y[2])
+        {
+          vtkLog(ERROR, "Wrong triangle " << c << " without merging from file type " << fileType);
+          return EXIT_FAILURE;
+        }
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -51,7 +51,7 @@ public:
   /**
    * Write data
    */
-  void Write();
+  VTK_UNBLOCKTHREADS void Write();
 
   void WriteToStream(ostream* ost);
 
@@ -8393,6 +8393,7 @@ vtkMultiBlockDataSet* vtkOpenFOAMReaderPrivate::MakeBoundaryMesh(
       // links of physical-processor shared points to avoid cracky seams
       // on fixedValue-type boundaries which are noticeable when all the
       // decomposed meshes are appended
+      this->AllBoundaries->EditableOn();
       this->AllBoundaries->BuildLinks();
       for (int pointI = 0; pointI < nAllBoundaryPoints; pointI++)
       {
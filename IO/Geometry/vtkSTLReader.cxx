@@ -7,6 +7,8 @@
 #include "vtkCellData.h"
 #include "vtkErrorCode.h"
 #include "vtkFloatArray.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkIncrementalPointLocator.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -14,17 +16,71 @@
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
+#include "vtkStaticPointLocator.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUnsignedCharArray.h"
 
 #include <algorithm>
 #include <cctype>
 #include <cstdlib>
+#include <cstring>
 #include <string>
+#include <vector>
 #include <vtksys/SystemTools.hxx>
 
 VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+// Merge the coincident points of the triangles with a vtkStaticPointLocator,
+// which bins and merges the points in parallel. The merged points are
+// numbered in the order of their first use, as an incremental locator does,
+// and the triangles that become degenerate are removed.
+void MergeWithStaticLocator(vtkPoints* newPts, vtkCellArray* newPolys, vtkFloatArray* newScalars,
+  vtkPoints* mergedPts, vtkCellArray* mergedPolys, vtkFloatArray* mergedScalars)
+{
+  const vtkIdType numPts = newPts->GetNumberOfPoints();
+  vtkNew<vtkPolyData> dataSet;
+  dataSet->SetPoints(newPts);
+  vtkNew<vtkStaticPointLocator> locator;
+  locator->SetDataSet(dataSet);
+  std::vector<vtkIdType> mergeMap(numPts);
+  locator->MergePoints(0.0, mergeMap.data());
+
+  std::vector<vtkIdType> pointIds(numPts, -1);
+  vtkNew<vtkIdList> sourceIds;
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    vtkIdType& id = pointIds[mergeMap[i]];
+    if (id < 0)
+    {
+      id = sourceIds->InsertNextId(i);
+    }
+    pointIds[i] = id;
+  }
+  mergedPts->SetDataType(newPts->GetDataType());
+  mergedPts->SetNumberOfPoints(sourceIds->GetNumberOfIds());
+  newPts->GetPoints(sourceIds, mergedPts);
+
+  vtkIdType nextCell = 0;
+  const vtkIdType* pts = nullptr;
+  vtkIdType npts;
+  for (newPolys->InitTraversal(); newPolys->GetNextCell(npts, pts); nextCell++)
+  {
+    const vtkIdType nodes[3] = { pointIds[pts[0]], pointIds[pts[1]], pointIds[pts[2]] };
+    if (nodes[0] != nodes[1] && nodes[0] != nodes[2] && nodes[1] != nodes[2])
+    {
+      mergedPolys->InsertNextCell(3, nodes);
+      if (newScalars)
+      {
+        mergedScalars->InsertNextValue(newScalars->GetValue(nextCell));
+      }
+    }
+  }
+}
+}
+
 vtkStandardNewMacro(vtkSTLReader);
 
 #define VTK_ASCII 0
@@ -157,35 +213,38 @@ int vtkSTLReader::RequestData(vtkInformation* vtkNotUsed(request),
       mergedScalars->Allocate(newPolys->GetNumberOfCells());
     }
 
-    vtkSmartPointer<vtkIncrementalPointLocator> locator = this->Locator;
     if (this->Locator == nullptr)
     {
-      locator.TakeReference(this->NewDefaultLocator());
+      ::MergeWithStaticLocator(
+        newPts, newPolys, newScalars, mergedPts, mergedPolys, mergedScalars);
     }
-    locator->InitPointInsertion(mergedPts, newPts->GetBounds());
-
-    int nextCell = 0;
-    const vtkIdType* pts = nullptr;
-    vtkIdType npts;
-    for (newPolys->InitTraversal(); newPolys->GetNextCell(npts, pts);)
+    else
     {
-      vtkIdType nodes[3];
-      for (int i = 0; i < 3; i++)
-      {
-        double x[3];
-        newPts->GetPoint(pts[i], x);
-        locator->InsertUniquePoint(x, nodes[i]);
-      }
+      this->Locator->InitPointInsertion(mergedPts, newPts->GetBounds());
 
-      if (nodes[0] != nodes[1] && nodes[0] != nodes[2] && nodes[1] != nodes[2])
+      int nextCell = 0;
+      const vtkIdType* pts = nullptr;
+      vtkIdType npts;
+      for (newPolys->InitTraversal(); newPolys->GetNextCell(npts, pts);)
       {
-        mergedPolys->InsertNextCell(3, nodes);
-        if (newScalars)
+        vtkIdType nodes[3];
+        for (int i = 0; i < 3; i++)
         {
-          mergedScalars->InsertNextValue(newScalars->GetValue(nextCell));
+          double x[3];
+          newPts->GetPoint(pts[i], x);
+          this->Locator->InsertUniquePoint(x, nodes[i]);
         }
+
+        if (nodes[0] != nodes[1] && nodes[0] != nodes[2] && nodes[1] != nodes[2])
+        {
+          mergedPolys->InsertNextCell(3, nodes);
+          if (newScalars)
+          {
+            mergedScalars->InsertNextValue(newScalars->GetValue(nextCell));
+          }
+        }
+        nextCell++;
       }
-      nextCell++;
     }
 
     vtkDebugMacro(<< "Merged to: " << mergedPts->GetNumberOfPoints() << " points, "
@@ -214,13 +273,6 @@ int vtkSTLReader::RequestData(vtkInformation* vtkNotUsed(request),
 //------------------------------------------------------------------------------
 bool vtkSTLReader::ReadBinarySTL(FILE* fp, vtkPoints* newPts, vtkCellArray* newPolys)
 {
-  struct facet_t_t
-  {
-    float n[3], v1[3], v2[3], v3[3];
-    unsigned short junk;
-  };
-  using facet_t = struct facet_t_t;
-
   vtkDebugMacro(<< "Reading BINARY STL file");
 
   //  File is read to obtain raw information as well as bounding box
@@ -272,43 +324,58 @@ bool vtkSTLReader::ReadBinarySTL(FILE* fp, vtkPoints* newPts, vtkCellArray* newP
     numTris = static_cast<int>(ulFileLength);
   }
 
-  // now we can allocate the memory we need for this STL file
-  newPts->Allocate(numTris * 3);
-  newPolys->AllocateEstimate(numTris, 3);
-
-  facet_t facet;
-  for (int i = 0; fread(&facet, 50, 1, fp) > 0; i++)
+  // Read the facets in chunks and decode each chunk in parallel, straight
+  // into the points and connectivity arrays. A facet is a normal, three
+  // vertices and a 2 byte attribute count.
+  const size_t facetSize = 50;
+  const vtkIdType chunkSize = 1 << 20;
+  std::vector<char> buffer(facetSize * std::min<vtkIdType>(std::max(numTris, 1), chunkSize));
+  vtkNew<vtkFloatArray> pointsArray;
+  pointsArray->SetNumberOfComponents(3);
+  pointsArray->SetNumberOfTuples(3 * static_cast<vtkIdType>(std::max(numTris, 0)));
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfValues(3 * static_cast<vtkIdType>(std::max(numTris, 0)));
+
+  vtkIdType readTris = 0;
+  size_t count;
+  while ((count = fread(buffer.data(), facetSize, buffer.size() / facetSize, fp)) > 0)
   {
-    vtkByteSwap::Swap4LE(facet.n);
-    vtkByteSwap::Swap4LE(facet.n + 1);
-    vtkByteSwap::Swap4LE(facet.n + 2);
-
-    vtkByteSwap::Swap4LE(facet.v1);
-    vtkByteSwap::Swap4LE(facet.v1 + 1);
-    vtkByteSwap::Swap4LE(facet.v1 + 2);
-
-    vtkByteSwap::Swap4LE(facet.v2);
-    vtkByteSwap::Swap4LE(facet.v2 + 1);
-    vtkByteSwap::Swap4LE(facet.v2 + 2);
-
-    vtkByteSwap::Swap4LE(facet.v3);
-    vtkByteSwap::Swap4LE(facet.v3 + 1);
-    vtkByteSwap::Swap4LE(facet.v3 + 2);
-
-    vtkIdType pts[3];
-    pts[0] = newPts->InsertNextPoint(facet.v1);
-    pts[1] = newPts->InsertNextPoint(facet.v2);
-    pts[2] = newPts->InsertNextPoint(facet.v3);
-
-    newPolys->InsertNextCell(3, pts);
-
-    if ((i % 100000) == 0 && i != 0)
+    const vtkIdType first = readTris;
+    readTris += static_cast<vtkIdType>(count);
+    if (3 * readTris > pointsArray->GetNumberOfTuples())
     {
-      vtkDebugMacro(<< "triangle# " << i);
-      this->UpdateProgress(static_cast<double>(i) / numTris);
+      pointsArray->Resize(3 * readTris);
+      pointsArray->SetNumberOfTuples(3 * readTris);
+      connectivity->Resize(3 * readTris);
+      connectivity->SetNumberOfValues(3 * readTris);
     }
+
+    const char* facets = buffer.data();
+    float* points = pointsArray->GetPointer(9 * first);
+    vtkIdType* conn = connectivity->GetPointer(3 * first);
+    const vtkIdType numFacets = static_cast<vtkIdType>(count);
+    vtkSMPTools::For(0, numFacets, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        // Skip the normal and keep the three vertices.
+        float* x = points + 9 * i;
+        memcpy(x, facets + facetSize * i + 3 * sizeof(float), 9 * sizeof(float));
+        vtkByteSwap::Swap4LERange(x, 9);
+        conn[3 * i] = 3 * (first + i);
+        conn[3 * i + 1] = 3 * (first + i) + 1;
+        conn[3 * i + 2] = 3 * (first + i) + 2;
+      }
+    });
+
+    vtkDebugMacro(<< "triangle# " << readTris);
+    this->UpdateProgress(static_cast<double>(readTris) / std::max(numTris, 1));
   }
 
+  pointsArray->SetNumberOfTuples(3 * readTris);
+  connectivity->SetNumberOfValues(3 * readTris);
+  newPts->SetData(pointsArray);
+  newPolys->SetData(3, connectivity);
+
   return true;
 }
 
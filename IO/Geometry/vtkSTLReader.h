@@ -69,8 +69,9 @@ public:
 
   ///@{
   /**
-   * Specify a spatial locator for merging points. By
-   * default an instance of vtkMergePoints is used.
+   * Specify a spatial locator for merging points. By default no locator is
+   * set and the points are merged in parallel with a vtkStaticPointLocator,
+   * giving the same points as an instance of vtkMergePoints.
    */
   void SetLocator(vtkIncrementalPointLocator* locator);
   vtkGetObjectMacro(Locator, vtkIncrementalPointLocator);
@@ -60,6 +60,7 @@ int TestCompositeTransient(const std::string& dataRoot);
 int TestUGTransientWithCache(const std::string& dataRoot);
 int TestImageDataTransientWithCache(const std::string& dataRoot);
 int TestPolyDataTransientWithCache(const std::string& dataRoot);
+int TestUGTransientWithChunkCache(const std::string& dataRoot);
 }
 
 //------------------------------------------------------------------------------
@@ -75,6 +76,7 @@ int TestHDFReaderTransient(int argc, char* argv[])
   res |= ::TestUGTransientWithCache(dataRoot);
   res |= ::TestImageDataTransientWithCache(dataRoot);
   res |= ::TestPolyDataTransientWithCache(dataRoot);
+  res |= ::TestUGTransientWithChunkCache(dataRoot);
   res |= ::TestCompositeTransient(dataRoot);
   return res;
 }
@@ -387,6 +389,14 @@ int TestUGTransientWithCache(const std::string& dataRoot)
   return TestUGTransientBase(opener);
 }
 
+//------------------------------------------------------------------------------
+int TestUGTransientWithChunkCache(const std::string& dataRoot)
+{
+  OpenerWorklet opener(dataRoot + "/Data/transient_sphere.hdf");
+  opener.GetReader()->SetChunkCacheSize(4 << 20);
+  return TestUGTransientBase(opener);
+}
+
 //------------------------------------------------------------------------------
 int TestImageDataTransientBase(OpenerWorklet& opener)
 {
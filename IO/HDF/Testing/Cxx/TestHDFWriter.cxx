@@ -5,6 +5,7 @@
 #include "vtkHDFWriter.h"
 #include "vtkImageData.h"
 #include "vtkNew.h"
+#include "vtkPartitionedDataSet.h"
 #include "vtkPolyData.h"
 #include "vtkSphereSource.h"
 #include "vtkTestUtilities.h"
@@ -14,6 +15,8 @@
 #include "vtkXMLPolyDataReader.h"
 #include "vtkXMLUnstructuredGridReader.h"
 
+#include <vtksys/SystemTools.hxx>
+
 #include <string>
 
 //----------------------------------------------------------------------------
@@ -75,6 +78,90 @@ bool TestSpherePolyData(const std::string& tempDir)
   return TestWriteAndRead(spherePd, filePath.c_str());
 }
 
+//----------------------------------------------------------------------------
+bool TestStreamedPieces(const std::string& tempDir)
+{
+  constexpr int numberOfPieces = 4;
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(20);
+  sphere->SetPhiResolution(20);
+
+  std::string filePath = tempDir + "/sphereStreamedPieces.vtkhdf";
+  vtkNew<vtkHDFWriter> writer;
+  writer->SetInputConnection(sphere->GetOutputPort());
+  writer->SetNumberOfPieces(numberOfPieces);
+  writer->SetFileName(filePath.c_str());
+  writer->Write();
+
+  // Each piece is written as a partition of the file
+  vtkNew<vtkHDFReader> reader;
+  reader->SetFileName(filePath.c_str());
+  reader->MergePartsOff();
+  reader->Update();
+  vtkPartitionedDataSet* output = vtkPartitionedDataSet::SafeDownCast(reader->GetOutput());
+  if (output == nullptr || output->GetNumberOfPartitions() != numberOfPieces)
+  {
+    std::cerr << "Expected " << numberOfPieces << " partitions in: " << filePath << std::endl;
+    return false;
+  }
+  for (int piece = 0; piece < numberOfPieces; ++piece)
+  {
+    sphere->UpdatePiece(piece, numberOfPieces, 0);
+    if (!vtkTestUtilities::CompareDataObjects(output->GetPartition(piece), sphere->GetOutput()))
+    {
+      std::cerr << "Partition " << piece << " does not match: " << filePath << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool TestAppendedPieces(const std::string& tempDir)
+{
+  constexpr int numberOfPieces = 3;
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(20);
+  sphere->SetPhiResolution(20);
+
+  // Each piece is appended to the file by a separate write, with automatic chunk sizes
+  std::string filePath = tempDir + "/sphereAppendedPieces.vtkhdf";
+  vtksys::SystemTools::RemoveFile(filePath);
+  for (int piece = 0; piece < numberOfPieces; ++piece)
+  {
+    sphere->UpdatePiece(piece, numberOfPieces, 0);
+    vtkNew<vtkPolyData> pieceData;
+    pieceData->ShallowCopy(sphere->GetOutput());
+    vtkNew<vtkHDFWriter> writer;
+    writer->SetInputData(pieceData);
+    writer->SetFileName(filePath.c_str());
+    writer->SetChunkSize(0);
+    writer->AppendOn();
+    writer->Write();
+  }
+
+  vtkNew<vtkHDFReader> reader;
+  reader->SetFileName(filePath.c_str());
+  reader->MergePartsOff();
+  reader->Update();
+  vtkPartitionedDataSet* output = vtkPartitionedDataSet::SafeDownCast(reader->GetOutput());
+  if (output == nullptr || output->GetNumberOfPartitions() != numberOfPieces)
+  {
+    std::cerr << "Expected " << numberOfPieces << " partitions in: " << filePath << std::endl;
+    return false;
+  }
+  for (int piece = 0; piece < numberOfPieces; ++piece)
+  {
+    sphere->UpdatePiece(piece, numberOfPieces, 0);
+    if (!vtkTestUtilities::CompareDataObjects(output->GetPartition(piece), sphere->GetOutput()))
+    {
+      std::cerr << "Appended partition " << piece << " does not match: " << filePath << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
 //----------------------------------------------------------------------------
 bool TestComplexPolyData(const std::string& tempDir, const std::string& dataRoot)
 {
@@ -155,6 +242,8 @@ int TestHDFWriter(int argc, char* argv[])
   bool testPasses = true;
   testPasses &= TestEmptyPolyData(tempDir);
   testPasses &= TestSpherePolyData(tempDir);
+  testPasses &= TestStreamedPieces(tempDir);
+  testPasses &= TestAppendedPieces(tempDir);
   testPasses &= TestComplexPolyData(tempDir, dataRoot);
   testPasses &= TestUnstructuredGrid(tempDir, dataRoot);
 
@@ -320,6 +320,8 @@ void vtkHDFReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Step: " << this->Step << "\n";
   os << indent << "TimeValue: " << this->TimeValue << "\n";
   os << indent << "TimeRange: " << this->TimeRange[0] << " - " << this->TimeRange[1] << "\n";
+  os << indent << "MemoryMapping: " << (this->MemoryMapping ? "true" : "false") << "\n";
+  os << indent << "ChunkCacheSize: " << this->ChunkCacheSize << "\n";
 }
 
 //----------------------------------------------------------------------------
@@ -157,6 +157,37 @@ public:
   vtkBooleanMacro(MergeParts, bool);
   ///@}
 
+  ///@{
+  /**
+   * Boolean property determining whether to memory map arrays instead of reading them (default is
+   * false).
+   *
+   * When true, datasets stored contiguously, without filters and with the native type in a file
+   * opened with the default file driver are mapped from the file (see
+   * vtkAOSDataArrayTemplate::MapFile()), so that their values are loaded from the page cache on
+   * access instead of being copied in memory. Other datasets are read as usual. The mapping is
+   * private: modifying the output never changes the file, but the file must not be modified while
+   * the output is in use.
+   */
+  vtkGetMacro(MemoryMapping, bool);
+  vtkSetMacro(MemoryMapping, bool);
+  vtkBooleanMacro(MemoryMapping, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Size in bytes of the HDF5 chunk cache of each dataset read (default is 0).
+   *
+   * When not 0, the datasets read are kept open with a chunk cache of this size until the file is
+   * closed, so that the chunks read for a time step or a piece are not read and decompressed again
+   * by the next reads that need them, such as the reads of the neighboring time steps of
+   * transient data. When 0, the datasets are closed after each read with the default HDF5 chunk
+   * cache. This only applies to chunked datasets.
+   */
+  vtkGetMacro(ChunkCacheSize, vtkIdType);
+  vtkSetClampMacro(ChunkCacheSize, vtkIdType, 0, VTK_ID_MAX);
+  ///@}
+
   vtkSetMacro(MaximumLevelsToReadByDefaultForAMR, unsigned int);
   vtkGetMacro(MaximumLevelsToReadByDefaultForAMR, unsigned int);
 
@@ -291,6 +322,8 @@ protected:
   Implementation* Impl;
 
   bool UseCache = false;
+  bool MemoryMapping = false;
+  vtkIdType ChunkCacheSize = 0;
   struct DataCache;
   std::shared_ptr<DataCache> Cache;
 };
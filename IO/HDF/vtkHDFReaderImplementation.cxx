@@ -406,9 +406,20 @@ int vtkHDFReader::Implementation::GetNumberOfPieces(vtkIdType step)
   return this->NumberOfPieces;
 }
 
+//------------------------------------------------------------------------------
+void vtkHDFReader::Implementation::CloseCachedDataSets()
+{
+  for (const auto& pathAndDataSet : this->CachedDataSets)
+  {
+    H5Dclose(pathAndDataSet.second);
+  }
+  this->CachedDataSets.clear();
+}
+
 //------------------------------------------------------------------------------
 void vtkHDFReader::Implementation::Close()
 {
+  this->CloseCachedDataSets();
   this->DataSetType = -1;
   this->NumberOfPieces = 0;
   std::fill(this->Version.begin(), this->Version.end(), 0);
@@ -737,7 +748,45 @@ std::vector<std::string> vtkHDFReader::Implementation::GetArrayNames(int attribu
 hid_t vtkHDFReader::Implementation::OpenDataSet(
   hid_t group, const char* name, hid_t* nativeType, std::vector<hsize_t>& dims)
 {
-  hid_t dataset = H5Dopen(group, name, H5P_DEFAULT);
+  hid_t dataset = H5I_INVALID_HID;
+  const size_t chunkCacheSize = static_cast<size_t>(this->Reader->GetChunkCacheSize());
+  if (chunkCacheSize == 0)
+  {
+    this->CloseCachedDataSets();
+    dataset = H5Dopen(group, name, H5P_DEFAULT);
+  }
+  else
+  {
+    // keep the dataset open so that its chunk cache is reused by the next reads, such as
+    // the reads of the other time steps
+    if (chunkCacheSize != this->CachedDataSetsChunkCacheSize)
+    {
+      this->CloseCachedDataSets();
+      this->CachedDataSetsChunkCacheSize = chunkCacheSize;
+    }
+    char groupName[1024];
+    if (H5Iget_name(group, groupName, sizeof(groupName)) <= 0)
+    {
+      groupName[0] = '\0';
+    }
+    const std::string path = std::string(groupName) + "/" + name;
+    auto it = this->CachedDataSets.find(path);
+    if (it == this->CachedDataSets.end())
+    {
+      vtkHDF::ScopedH5PHandle accessList = H5Pcreate(H5P_DATASET_ACCESS);
+      H5Pset_chunk_cache(accessList, H5D_CHUNK_CACHE_NSLOTS_DEFAULT, chunkCacheSize,
+        H5D_CHUNK_CACHE_W0_DEFAULT);
+      hid_t cachedDataSet = H5Dopen(group, name, accessList);
+      if (cachedDataSet >= 0)
+      {
+        it = this->CachedDataSets.emplace(path, cachedDataSet).first;
+      }
+    }
+    if (it != this->CachedDataSets.end() && H5Iinc_ref(it->second) >= 0)
+    {
+      dataset = it->second;
+    }
+  }
   if (dataset < 0)
   {
     vtkErrorWithObjectMacro(this->Reader, << std::string("Cannot open ") + name);
@@ -1004,6 +1053,16 @@ vtkDataArray* vtkHDFReader::Implementation::NewArray(
   }
   auto array = vtkAOSDataArrayTemplate<T>::SafeDownCast(NewVtkDataArray<T>());
   array->SetNumberOfComponents(numberOfComponents);
+  std::string fileName;
+  vtkTypeInt64 offset = 0;
+  if (this->Reader->GetMemoryMapping() &&
+    this->GetContiguousRegion(
+      dataset, TemplateTypeToHdfNativeType<T>(), fileExtent, fileName, offset) &&
+    array->MapFile(fileName.c_str(), offset,
+      static_cast<vtkIdType>(numberOfTuples) * static_cast<vtkIdType>(numberOfComponents), false))
+  {
+    return array;
+  }
   array->SetNumberOfTuples(numberOfTuples);
   T* data = array->GetPointer(0);
   if (!this->NewArray(dataset, fileExtent, numberOfComponents, data))
@@ -1014,6 +1073,87 @@ vtkDataArray* vtkHDFReader::Implementation::NewArray(
   return array;
 }
 
+//------------------------------------------------------------------------------
+bool vtkHDFReader::Implementation::GetContiguousRegion(hid_t dataset, hid_t nativeType,
+  const std::vector<hsize_t>& fileExtent, std::string& fileName, vtkTypeInt64& offset)
+{
+  vtkHDF::ScopedH5THandle fileType = H5Dget_type(dataset);
+  if (fileType < 0 || H5Tequal(fileType, nativeType) <= 0)
+  {
+    return false;
+  }
+  vtkHDF::ScopedH5PHandle createPlist = H5Dget_create_plist(dataset);
+  if (createPlist < 0 || H5Pget_layout(createPlist) != H5D_CONTIGUOUS ||
+    H5Pget_nfilters(createPlist) != 0 || H5Pget_external_count(createPlist) != 0)
+  {
+    return false;
+  }
+  haddr_t address = H5Dget_offset(dataset);
+  if (address == HADDR_UNDEF)
+  {
+    return false;
+  }
+
+  // Addresses are relative to the end of the user block, and only the
+  // default driver stores the file as is.
+  vtkHDF::ScopedH5FHandle file = H5Iget_file_id(dataset);
+  if (file < 0)
+  {
+    return false;
+  }
+  vtkHDF::ScopedH5PHandle accessPlist = H5Fget_access_plist(file);
+  if (accessPlist < 0 || H5Pget_driver(accessPlist) != H5FD_SEC2)
+  {
+    return false;
+  }
+  vtkHDF::ScopedH5PHandle filePlist = H5Fget_create_plist(file);
+  hsize_t userBlock = 0;
+  if (filePlist < 0 || H5Pget_userblock(filePlist, &userBlock) < 0)
+  {
+    return false;
+  }
+
+  // The slab is contiguous when all the dimensions following the first one
+  // with more than one index are read entirely.
+  vtkHDF::ScopedH5SHandle space = H5Dget_space(dataset);
+  int ndims = space < 0 ? -1 : H5Sget_simple_extent_ndims(space);
+  if (ndims <= 0 || static_cast<size_t>(ndims) < (fileExtent.size() >> 1))
+  {
+    return false;
+  }
+  std::vector<hsize_t> dims(ndims);
+  H5Sget_simple_extent_dims(space, dims.data(), nullptr);
+  std::vector<hsize_t> strides(ndims, 1);
+  for (int i = ndims - 2; i >= 0; --i)
+  {
+    strides[i] = strides[i + 1] * dims[i + 1];
+  }
+  hsize_t start = 0;
+  bool sliced = false;
+  for (size_t i = 0; i < (fileExtent.size() >> 1); ++i)
+  {
+    hsize_t first = fileExtent[i * 2];
+    hsize_t last = fileExtent[i * 2 + 1];
+    if (sliced && (first != 0 || last != dims[i]))
+    {
+      return false;
+    }
+    sliced = sliced || (last - first > 1);
+    start += first * strides[i];
+  }
+
+  ssize_t nameLength = H5Fget_name(file, nullptr, 0);
+  if (nameLength <= 0)
+  {
+    return false;
+  }
+  std::vector<char> name(nameLength + 1);
+  H5Fget_name(file, name.data(), name.size());
+  fileName = name.data();
+  offset = static_cast<vtkTypeInt64>(userBlock + address + start * H5Tget_size(nativeType));
+  return true;
+}
+
 //------------------------------------------------------------------------------
 template <typename T>
 bool vtkHDFReader::Implementation::NewArray(
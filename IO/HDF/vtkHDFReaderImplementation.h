@@ -179,7 +179,8 @@ protected:
    * Opens the hdf5 dataset given the 'group' and 'name'.
    * Returns the hdf dataset and sets 'nativeType' and 'dims'.
    * The caller needs to close the returned hid_t manually using H5Dclose or a Scoped Handle if it
-   * is not an invalid hid.
+   * is not an invalid hid. When the reader has a chunk cache size, the dataset is kept open with
+   * its chunk cache until the file is closed, and the returned hid_t is a new reference to it.
    */
   hid_t OpenDataSet(hid_t group, const char* name, hid_t* nativeType, std::vector<hsize_t>& dims);
   /**
@@ -221,6 +222,14 @@ protected:
     hid_t dataset, const std::vector<hsize_t>& fileExtent, hsize_t numberOfComponents, T* data);
   vtkStringArray* NewStringArray(hid_t dataset, hsize_t size);
   ///@}
+  /**
+   * Find where the fileExtent slab of dataset is stored when it can be memory
+   * mapped: the dataset must be stored contiguously without filters using
+   * nativeType in a file opened with the default driver, and the slab must be
+   * contiguous. Returns false otherwise.
+   */
+  bool GetContiguousRegion(hid_t dataset, hid_t nativeType,
+    const std::vector<hsize_t>& fileExtent, std::string& fileName, vtkTypeInt64& offset);
   /**
    * Builds a map between native types and GetArray routines for that type.
    */
@@ -244,6 +253,11 @@ private:
   using ArrayReader = vtkDataArray* (vtkHDFReader::Implementation::*)(hid_t dataset,
     const std::vector<hsize_t>& fileExtent, hsize_t numberOfComponents);
   std::map<TypeDescription, ArrayReader> TypeReaderMap;
+  // datasets kept open with their chunk cache, by path, when
+  // vtkHDFReader::ChunkCacheSize is not 0
+  std::map<std::string, hid_t> CachedDataSets;
+  size_t CachedDataSetsChunkCacheSize = 0;
+  void CloseCachedDataSets();
 
   bool ReadDataSetType();
 
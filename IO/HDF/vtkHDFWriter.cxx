@@ -10,14 +10,20 @@
 #include "vtkHDFWriterImplementation.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
+#include "vtkMultiProcessController.h"
 #include "vtkObjectFactory.h"
 
 #include "vtkPolyData.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <vtksys/SystemTools.hxx>
+
+#include <algorithm>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkHDFWriter);
+vtkCxxSetObjectMacro(vtkHDFWriter, Controller, vtkMultiProcessController);
 
 namespace
 {
@@ -27,19 +33,47 @@ constexpr hsize_t SINGLE_COLUMN = 1;
 // Used for chunked arrays with 4 columns (polydata primitive topologies)
 hsize_t PRIMITIVE_CHUNK[] = { 1, NUM_POLY_DATA_TOPOS };
 hsize_t SMALL_CHUNK[] = { 1, 1 }; // Used for chunked arrays where values are read one by one
+
+// Automatic chunk sizes target chunks of this size in bytes, with at least this number of rows
+constexpr hsize_t AUTOMATIC_CHUNK_BYTES = 1 << 20;
+constexpr hsize_t AUTOMATIC_CHUNK_MINIMUM_ROWS = 1024;
+
+// Tag of the message passing the file from one process to the next
+constexpr int FILE_TOKEN_TAG = 34782;
+
+/**
+ * Return the number of rows of the chunks of an extendable dataset: chunkSize when it is not 0,
+ * otherwise the number of tuples of the first write, bounded so that chunks are about
+ * AUTOMATIC_CHUNK_BYTES.
+ */
+hsize_t GetChunkSize(int chunkSize, vtkIdType numberOfTuples, hsize_t tupleSize)
+{
+  if (chunkSize > 0)
+  {
+    return static_cast<hsize_t>(chunkSize);
+  }
+  const hsize_t maximumRows =
+    std::max<hsize_t>(AUTOMATIC_CHUNK_BYTES / std::max<hsize_t>(tupleSize, 1), 1);
+  const hsize_t rows = std::max(
+    static_cast<hsize_t>(std::max<vtkIdType>(numberOfTuples, 0)), AUTOMATIC_CHUNK_MINIMUM_ROWS);
+  return std::min(rows, maximumRows);
+}
 }
 
 //------------------------------------------------------------------------------
 bool vtkHDFWriter::WriteDatasetToFile(vtkPolyData* input)
 {
-  // Root group only needs to be opened for the first timestep
-  if (this->CurrentTimeIndex == 0 && !this->Impl->OpenRoot(this->Overwrite))
+  // Root group only needs to be opened for the first timestep and piece
+  const bool firstWrite = this->CurrentTimeIndex == 0 && this->CurrentPiece == 0;
+  if (firstWrite && !this->OpenRoot("PolyData"))
   {
     vtkErrorMacro(<< "Could not open root group for " << this->FileName);
     return false;
   }
 
-  if (CurrentTimeIndex == 0 && !this->InitializeTransientData(input))
+  // The datasets of a file appended to already exist
+  const bool firstFileWrite = firstWrite && !this->IsAppending;
+  if (firstFileWrite && !this->InitializeTransientData(input))
   {
     vtkErrorMacro(<< "Transient polydata initialization failed for PolyData " << this->FileName);
     return false;
@@ -53,7 +87,7 @@ bool vtkHDFWriter::WriteDatasetToFile(vtkPolyData* input)
   bool writeSuccess = true;
   hid_t rootGroup = this->Impl->GetRoot();
 
-  if (this->CurrentTimeIndex == 0)
+  if (firstFileWrite)
   {
     writeSuccess &= this->Impl->WriteHeader("PolyData");
   }
@@ -67,14 +101,17 @@ bool vtkHDFWriter::WriteDatasetToFile(vtkPolyData* input)
 //------------------------------------------------------------------------------
 bool vtkHDFWriter::WriteDatasetToFile(vtkUnstructuredGrid* input)
 {
-  // Root group only needs to be opened for the first timestep
-  if (this->CurrentTimeIndex == 0 && !this->Impl->OpenRoot(this->Overwrite))
+  // Root group only needs to be opened for the first timestep and piece
+  const bool firstWrite = this->CurrentTimeIndex == 0 && this->CurrentPiece == 0;
+  if (firstWrite && !this->OpenRoot("UnstructuredGrid"))
   {
     vtkErrorMacro(<< "Could not open root group for " << this->FileName);
     return false;
   }
 
-  if (CurrentTimeIndex == 0 && !this->InitializeTransientData(input))
+  // The datasets of a file appended to already exist
+  const bool firstFileWrite = firstWrite && !this->IsAppending;
+  if (firstFileWrite && !this->InitializeTransientData(input))
   {
     vtkErrorMacro(<< "Transient unstructured grid initialization failed for PolyData "
                   << this->FileName);
@@ -92,7 +129,7 @@ bool vtkHDFWriter::WriteDatasetToFile(vtkUnstructuredGrid* input)
   bool writeSuccess = true;
   hid_t rootGroup = this->Impl->GetRoot();
 
-  if (this->CurrentTimeIndex == 0)
+  if (firstFileWrite)
   {
     writeSuccess &= this->Impl->WriteHeader("UnstructuredGrid");
   }
@@ -107,6 +144,24 @@ bool vtkHDFWriter::WriteDatasetToFile(vtkUnstructuredGrid* input)
   return writeSuccess;
 }
 
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::OpenRoot(const char* hdfType)
+{
+  // Processes other than the first one append their pieces to the file of the previous ones
+  this->IsAppending = this->IsStreamingPieces && (this->Append || this->Rank > 0) &&
+    vtksys::SystemTools::FileExists(this->FileName, true);
+  if (this->IsAppending)
+  {
+    if (!this->Impl->OpenExistingRoot(hdfType))
+    {
+      vtkErrorMacro(<< this->Impl->GetLastError() << " to append to " << this->FileName);
+      return false;
+    }
+    return true;
+  }
+  return this->Impl->OpenRoot(this->Overwrite);
+}
+
 //------------------------------------------------------------------------------
 bool vtkHDFWriter::UpdateStepsGroup(vtkUnstructuredGrid* input)
 {
@@ -309,7 +364,7 @@ bool vtkHDFWriter::AppendPrimitiveCells(hid_t baseGroup, vtkPolyData* input)
     // Create group
     vtkHDF::ScopedH5GHandle group;
 
-    if (this->IsTransient)
+    if (this->IsTransient || this->IsStreamingPieces)
     {
       group = H5Gopen(baseGroup, groupName, H5P_DEFAULT);
     }
@@ -379,7 +434,7 @@ bool vtkHDFWriter::AppendDataArrays(hid_t baseGroup, vtkDataObject* input)
     offsetsGroupNameStr += "Offsets";
     const char* offsetsGroupName = offsetsGroupNameStr.c_str();
 
-    if (this->CurrentTimeIndex == 0)
+    if (this->CurrentTimeIndex == 0 && this->CurrentPiece == 0 && !this->IsAppending)
     {
       vtkHDF::ScopedH5GHandle group{ H5Gcreate(
         baseGroup, groupName, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT) };
@@ -426,6 +481,22 @@ bool vtkHDFWriter::AppendDataArrays(hid_t baseGroup, vtkDataObject* input)
         return false;
       }
 
+      // When streaming pieces, the arrays of each piece are appended to extendable datasets
+      if (this->IsStreamingPieces && this->CurrentPiece == 0 && !this->IsAppending)
+      {
+        hsize_t chunkSizeComponent[] = { ::GetChunkSize(this->ChunkSize,
+                                           array->GetNumberOfTuples(),
+                                           array->GetNumberOfComponents() * H5Tget_size(dataType)),
+          static_cast<hsize_t>(array->GetNumberOfComponents()) };
+        if (this->Impl->InitDynamicDataset(group, arrayName, dataType,
+              array->GetNumberOfComponents(), chunkSizeComponent) == H5I_INVALID_HID)
+        {
+          vtkErrorMacro(<< "Could not initialize dataset for: " << arrayName
+                        << " when creating: " << this->FileName);
+          return false;
+        }
+      }
+
       // Add actual array in the dataset
       if (!this->Impl->AddOrCreateDataset(group, arrayName, dataType, array))
       {
@@ -460,6 +531,10 @@ void vtkHDFWriter::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
   os << indent << "FileName: " << (this->FileName ? this->FileName : "(none)") << "\n";
   os << indent << "Overwrite: " << (this->Overwrite ? "yes" : "no") << "\n";
+  os << indent << "NumberOfPieces: " << this->NumberOfPieces << "\n";
+  os << indent << "ChunkSize: " << this->ChunkSize << "\n";
+  os << indent << "Append: " << (this->Append ? "yes" : "no") << "\n";
+  os << indent << "Controller: " << this->Controller << "\n";
 }
 
 //------------------------------------------------------------------------------
@@ -504,73 +579,97 @@ void vtkHDFWriter::WriteData()
   vtkErrorMacro(<< "Dataset type not supported: " << input->GetClassName());
 }
 
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::InitializePointsDataset(hid_t group, vtkPointSet* input)
+{
+  // The first piece of a streamed dataset may have no points.
+  hid_t datatype = H5T_IEEE_F32LE;
+  hsize_t numberOfComponents = 3;
+  if (input->GetPoints() && input->GetPoints()->GetData())
+  {
+    vtkAbstractArray* pointArray = input->GetPoints()->GetData();
+    datatype = vtkHDFUtilities::getH5TypeFromVtkType(pointArray->GetDataType());
+    numberOfComponents = static_cast<hsize_t>(pointArray->GetNumberOfComponents());
+  }
+  hsize_t chunkSize[] = { ::GetChunkSize(this->ChunkSize, input->GetNumberOfPoints(),
+                            numberOfComponents * H5Tget_size(datatype)),
+    numberOfComponents };
+  return this->Impl->InitDynamicDataset(group, "Points", datatype, numberOfComponents,
+           chunkSize) != H5I_INVALID_HID;
+}
+
 //------------------------------------------------------------------------------
 bool vtkHDFWriter::InitializeTransientData(vtkUnstructuredGrid* input)
 {
-  if (!this->IsTransient)
+  if (!this->IsTransient && !this->IsStreamingPieces)
   {
     return true;
   }
 
-  this->Impl->CreateStepsGroup();
-  hid_t stepsGroup = this->Impl->GetStepsGroup();
-  if (!this->AppendTimeValues(stepsGroup))
-  {
-    return false;
-  }
-
   // Used for larger chunked arrays
-  hsize_t largeChunkSize[] = { static_cast<hsize_t>(this->ChunkSize), 1 };
-  // Used for larger chunked arrays of 3 components
-  hsize_t largeVectorChunkSize[] = { static_cast<hsize_t>(this->ChunkSize), 3 };
+  vtkCellArray* cells = input->GetCells();
+  const vtkIdType numberOfCells = cells ? cells->GetNumberOfCells() : 0;
+  hsize_t offsetsChunkSize[] = { ::GetChunkSize(this->ChunkSize, numberOfCells + 1, 8), 1 };
+  hsize_t typesChunkSize[] = { ::GetChunkSize(this->ChunkSize, numberOfCells, 1), 1 };
+  hsize_t connectivityChunkSize[] = { ::GetChunkSize(this->ChunkSize,
+                                        cells ? cells->GetNumberOfConnectivityIds() : 0, 8),
+    1 };
 
-  // Create empty offsets arrays, where a value is appended every step
   bool initResult = true;
-  initResult &= this->Impl->InitDynamicDataset(stepsGroup, "PointOffsets", H5T_STD_I64LE,
-                  SINGLE_COLUMN, SMALL_CHUNK) != H5I_INVALID_HID;
-  initResult &= this->Impl->InitDynamicDataset(stepsGroup, "CellOffsets", H5T_STD_I64LE,
-                  SINGLE_COLUMN, SMALL_CHUNK) != H5I_INVALID_HID;
-  initResult &= this->Impl->InitDynamicDataset(stepsGroup, "ConnectivityIdOffsets", H5T_STD_I64LE,
-                  SINGLE_COLUMN, SMALL_CHUNK) != H5I_INVALID_HID;
-  initResult &= this->Impl->InitDynamicDataset(stepsGroup, "PartOffsets", H5T_STD_I64LE,
-                  SINGLE_COLUMN, SMALL_CHUNK) != H5I_INVALID_HID;
+  if (this->IsTransient)
+  {
+    this->Impl->CreateStepsGroup();
+    hid_t stepsGroup = this->Impl->GetStepsGroup();
+    if (!this->AppendTimeValues(stepsGroup))
+    {
+      return false;
+    }
+
+    // Create empty offsets arrays, where a value is appended every step
+      initResult &= this->Impl->InitDynamicDataset(stepsGroup, "PointOffsets", H5T_STD_I64LE,
+                    SINGLE_COLUMN, SMALL_CHUNK) != H5I_INVALID_HID;
+    initResult &= this->Impl->InitDynamicDataset(stepsGroup, "CellOffsets", H5T_STD_I64LE,
+                    SINGLE_COLUMN, SMALL_CHUNK) != H5I_INVALID_HID;
+    initResult &= this->Impl->InitDynamicDataset(stepsGroup, "ConnectivityIdOffsets",
+                    H5T_STD_I64LE, SINGLE_COLUMN, SMALL_CHUNK) != H5I_INVALID_HID;
+    initResult &= this->Impl->InitDynamicDataset(stepsGroup, "PartOffsets", H5T_STD_I64LE,
+                    SINGLE_COLUMN, SMALL_CHUNK) != H5I_INVALID_HID;
 
-  // Add an initial 0 value in the offset arrays
-  initResult &= this->Impl->AddOrCreateSingleValueDataset(stepsGroup, "PointOffsets", 0);
-  initResult &= this->Impl->AddOrCreateSingleValueDataset(stepsGroup, "CellOffsets", 0);
-  initResult &= this->Impl->AddOrCreateSingleValueDataset(stepsGroup, "ConnectivityIdOffsets", 0);
-  initResult &= this->Impl->AddOrCreateSingleValueDataset(stepsGroup, "PartOffsets", 0);
+    // Add an initial 0 value in the offset arrays
+    initResult &= this->Impl->AddOrCreateSingleValueDataset(stepsGroup, "PointOffsets", 0);
+    initResult &= this->Impl->AddOrCreateSingleValueDataset(stepsGroup, "CellOffsets", 0);
+    initResult &=
+      this->Impl->AddOrCreateSingleValueDataset(stepsGroup, "ConnectivityIdOffsets", 0);
+    initResult &= this->Impl->AddOrCreateSingleValueDataset(stepsGroup, "PartOffsets", 0);
 
-  if (!initResult)
-  {
-    vtkWarningMacro(<< "Could not initialize steps offset arrays when creating: "
-                    << this->FileName);
-    return false;
+    if (!initResult)
+    {
+      vtkWarningMacro(<< "Could not initialize steps offset arrays when creating: "
+                      << this->FileName);
+      return false;
+    }
   }
 
   // Create empty datasets
   hid_t root = this->Impl->GetRoot();
-  vtkAbstractArray* pointArray = input->GetPoints()->GetData();
-  hid_t datatype = vtkHDFUtilities::getH5TypeFromVtkType(pointArray->GetDataType());
-  initResult &= this->Impl->InitDynamicDataset(root, "Points", datatype,
-                  pointArray->GetNumberOfComponents(), largeVectorChunkSize) != H5I_INVALID_HID;
+  initResult &= this->InitializePointsDataset(root, input);
 
   initResult &= this->Impl->InitDynamicDataset(root, "NumberOfPoints", H5T_STD_I64LE, SINGLE_COLUMN,
                   SMALL_CHUNK) != H5I_INVALID_HID;
 
   // Create offsets dataset
-  initResult &= this->Impl->InitDynamicDataset(
-                  root, "Offsets", H5T_STD_I64LE, SINGLE_COLUMN, largeChunkSize) != H5I_INVALID_HID;
+  initResult &= this->Impl->InitDynamicDataset(root, "Offsets", H5T_STD_I64LE, SINGLE_COLUMN,
+                  offsetsChunkSize) != H5I_INVALID_HID;
   initResult &= this->Impl->InitDynamicDataset(root, "NumberOfCells", H5T_STD_I64LE, SINGLE_COLUMN,
                   SMALL_CHUNK) != H5I_INVALID_HID;
 
   // Create types dataset
   initResult &= this->Impl->InitDynamicDataset(
-                  root, "Types", H5T_STD_U8LE, SINGLE_COLUMN, largeChunkSize) != H5I_INVALID_HID;
+                  root, "Types", H5T_STD_U8LE, SINGLE_COLUMN, typesChunkSize) != H5I_INVALID_HID;
 
   // Create connectivity datasets
   initResult &= this->Impl->InitDynamicDataset(root, "Connectivity", H5T_STD_I64LE, SINGLE_COLUMN,
-                  largeChunkSize) != H5I_INVALID_HID;
+                  connectivityChunkSize) != H5I_INVALID_HID;
   initResult &= this->Impl->InitDynamicDataset(root, "NumberOfConnectivityIds", H5T_STD_I64LE,
                   SINGLE_COLUMN, SMALL_CHUNK) != H5I_INVALID_HID;
 
@@ -585,63 +684,59 @@ bool vtkHDFWriter::InitializeTransientData(vtkUnstructuredGrid* input)
 //------------------------------------------------------------------------------
 bool vtkHDFWriter::InitializeTransientData(vtkPolyData* input)
 {
-  if (!this->IsTransient)
+  if (!this->IsTransient && !this->IsStreamingPieces)
   {
     return true;
   }
 
-  this->Impl->CreateStepsGroup();
-  hid_t stepsGroup = this->Impl->GetStepsGroup();
-  if (!this->AppendTimeValues(stepsGroup))
+  bool initResult = true;
+  if (this->IsTransient)
   {
-    return false;
-  }
-
-  // Used for larger chunked arrays
-  hsize_t largeChunkSize[] = { static_cast<hsize_t>(this->ChunkSize), 1 };
-  // Used for larger chunked arrays of 3 components
-  hsize_t largeVectorChunkSize[] = { static_cast<hsize_t>(this->ChunkSize), 3 };
+    this->Impl->CreateStepsGroup();
+    hid_t stepsGroup = this->Impl->GetStepsGroup();
+    if (!this->AppendTimeValues(stepsGroup))
+    {
+      return false;
+    }
 
-  // Create empty offsets arrays, where a value is appended every step, and add and initial 0 value.
-  bool initResult = true;
-  initResult &= this->Impl->InitDynamicDataset(stepsGroup, "PointOffsets", H5T_STD_I64LE,
-                  SINGLE_COLUMN, SMALL_CHUNK) != H5I_INVALID_HID;
-  initResult &= this->Impl->InitDynamicDataset(stepsGroup, "PartOffsets", H5T_STD_I64LE,
-                  SINGLE_COLUMN, SMALL_CHUNK) != H5I_INVALID_HID;
-  initResult &= this->Impl->AddOrCreateSingleValueDataset(stepsGroup, "PointOffsets", 0);
-  initResult &= this->Impl->AddOrCreateSingleValueDataset(stepsGroup, "PartOffsets", 0);
-
-  // Initialize datasets for primitive cells and connectivity. Fill with an empty 1*4 vector.
-  vtkHDF::ScopedH5DHandle cellOffsetsHandle = this->Impl->InitDynamicDataset(
-    stepsGroup, "CellOffsets", H5T_STD_I64LE, NUM_POLY_DATA_TOPOS, PRIMITIVE_CHUNK);
-  vtkHDF::ScopedH5DHandle connectivityOffsetsHandle = this->Impl->InitDynamicDataset(
-    stepsGroup, "ConnectivityIdOffsets", H5T_STD_I64LE, NUM_POLY_DATA_TOPOS, PRIMITIVE_CHUNK);
-  if (cellOffsetsHandle == H5I_INVALID_HID || connectivityOffsetsHandle == H5I_INVALID_HID)
-  {
-    vtkWarningMacro(<< "Could not create transient offset datasets when creating: "
-                    << this->FileName);
-    return false;
-  }
+    // Create empty offsets arrays, where a value is appended every step, and add and initial 0
+    // value.
+    initResult &= this->Impl->InitDynamicDataset(stepsGroup, "PointOffsets", H5T_STD_I64LE,
+                    SINGLE_COLUMN, SMALL_CHUNK) != H5I_INVALID_HID;
+    initResult &= this->Impl->InitDynamicDataset(stepsGroup, "PartOffsets", H5T_STD_I64LE,
+                    SINGLE_COLUMN, SMALL_CHUNK) != H5I_INVALID_HID;
+    initResult &= this->Impl->AddOrCreateSingleValueDataset(stepsGroup, "PointOffsets", 0);
+    initResult &= this->Impl->AddOrCreateSingleValueDataset(stepsGroup, "PartOffsets", 0);
+
+    // Initialize datasets for primitive cells and connectivity. Fill with an empty 1*4 vector.
+    vtkHDF::ScopedH5DHandle cellOffsetsHandle = this->Impl->InitDynamicDataset(
+      stepsGroup, "CellOffsets", H5T_STD_I64LE, NUM_POLY_DATA_TOPOS, PRIMITIVE_CHUNK);
+    vtkHDF::ScopedH5DHandle connectivityOffsetsHandle = this->Impl->InitDynamicDataset(
+      stepsGroup, "ConnectivityIdOffsets", H5T_STD_I64LE, NUM_POLY_DATA_TOPOS, PRIMITIVE_CHUNK);
+    if (cellOffsetsHandle == H5I_INVALID_HID || connectivityOffsetsHandle == H5I_INVALID_HID)
+    {
+      vtkWarningMacro(<< "Could not create transient offset datasets when creating: "
+                      << this->FileName);
+      return false;
+    }
 
-  vtkNew<vtkIntArray> emptyPrimitiveArray;
-  emptyPrimitiveArray->SetNumberOfComponents(NUM_POLY_DATA_TOPOS);
-  int emptyArray[] = { 0, 0, 0, 0 };
-  emptyPrimitiveArray->SetArray(emptyArray, NUM_POLY_DATA_TOPOS, 1);
-  initResult &= this->Impl->AddArrayToDataset(cellOffsetsHandle, emptyPrimitiveArray);
-  initResult &= this->Impl->AddArrayToDataset(connectivityOffsetsHandle, emptyPrimitiveArray);
-  if (!initResult)
-  {
-    vtkWarningMacro(<< "Could not initialize steps offset arrays when creating: "
-                    << this->FileName);
-    return false;
+    vtkNew<vtkIntArray> emptyPrimitiveArray;
+    emptyPrimitiveArray->SetNumberOfComponents(NUM_POLY_DATA_TOPOS);
+    int emptyArray[] = { 0, 0, 0, 0 };
+    emptyPrimitiveArray->SetArray(emptyArray, NUM_POLY_DATA_TOPOS, 1);
+    initResult &= this->Impl->AddArrayToDataset(cellOffsetsHandle, emptyPrimitiveArray);
+    initResult &= this->Impl->AddArrayToDataset(connectivityOffsetsHandle, emptyPrimitiveArray);
+    if (!initResult)
+    {
+      vtkWarningMacro(<< "Could not initialize steps offset arrays when creating: "
+                      << this->FileName);
+      return false;
+    }
   }
 
   // Create empty resizable datasets for Points and NumberOfPoints
   hid_t root = this->Impl->GetRoot();
-  vtkAbstractArray* pointArray = input->GetPoints()->GetData();
-  hid_t datatype = vtkHDFUtilities::getH5TypeFromVtkType(pointArray->GetDataType());
-  initResult &= this->Impl->InitDynamicDataset(root, "Points", datatype,
-                  pointArray->GetNumberOfComponents(), largeVectorChunkSize) != H5I_INVALID_HID;
+  initResult &= this->InitializePointsDataset(root, input);
   initResult &= this->Impl->InitDynamicDataset(root, "NumberOfPoints", H5T_STD_I64LE, SINGLE_COLUMN,
                   SMALL_CHUNK) != H5I_INVALID_HID;
 
@@ -659,12 +754,20 @@ bool vtkHDFWriter::InitializeTransientData(vtkPolyData* input)
       return false;
     }
 
+    // Used for larger chunked arrays
+    vtkCellArray* cells = cellArrayTopo.cellArray;
+    hsize_t offsetsChunkSize[] = {
+      ::GetChunkSize(this->ChunkSize, cells->GetNumberOfCells() + 1, 8), 1
+    };
+    hsize_t connectivityChunkSize[] = { ::GetChunkSize(
+                                          this->ChunkSize, cells->GetNumberOfConnectivityIds(), 8),
+      1 };
     initResult &= this->Impl->InitDynamicDataset(group, "Offsets", H5T_STD_I64LE, SINGLE_COLUMN,
-                    largeChunkSize) != H5I_INVALID_HID;
+                    offsetsChunkSize) != H5I_INVALID_HID;
     initResult &= this->Impl->InitDynamicDataset(group, "NumberOfCells", H5T_STD_I64LE,
                     SINGLE_COLUMN, SMALL_CHUNK) != H5I_INVALID_HID;
     initResult &= this->Impl->InitDynamicDataset(group, "Connectivity", H5T_STD_I64LE,
-                    SINGLE_COLUMN, largeChunkSize) != H5I_INVALID_HID;
+                    SINGLE_COLUMN, connectivityChunkSize) != H5I_INVALID_HID;
     initResult &= this->Impl->InitDynamicDataset(group, "NumberOfConnectivityIds", H5T_STD_I64LE,
                     SINGLE_COLUMN, SMALL_CHUNK) != H5I_INVALID_HID;
   }
@@ -687,7 +790,8 @@ bool vtkHDFWriter::AppendTransientDataArray(hid_t arrayGroup, vtkAbstractArray*
   if (this->CurrentTimeIndex == 0)
   {
     // Initialize empty dataset
-    hsize_t ChunkSizeComponent[] = { static_cast<hsize_t>(this->ChunkSize),
+    hsize_t ChunkSizeComponent[] = { ::GetChunkSize(this->ChunkSize, array->GetNumberOfTuples(),
+                                       array->GetNumberOfComponents() * H5Tget_size(dataType)),
       static_cast<unsigned long>(array->GetNumberOfComponents()) };
     if (this->Impl->InitDynamicDataset(arrayGroup, arrayName, dataType,
           array->GetNumberOfComponents(), ChunkSizeComponent) == H5I_INVALID_HID)
@@ -698,7 +802,7 @@ bool vtkHDFWriter::AppendTransientDataArray(hid_t arrayGroup, vtkAbstractArray*
     }
 
     // Initialize offsets array
-    hsize_t ChunkSize1D[] = { static_cast<hsize_t>(this->ChunkSize), 1 };
+    hsize_t ChunkSize1D[] = { ::GetChunkSize(this->ChunkSize, this->NumberOfTimeSteps, 8), 1 };
     if (this->Impl->InitDynamicDataset(offsetsGroup, arrayName, H5T_STD_I64LE, 1, ChunkSize1D) ==
       H5I_INVALID_HID)
     {
@@ -754,11 +858,20 @@ vtkTypeBool vtkHDFWriter::ProcessRequest(
 int vtkHDFWriter::RequestInformation(vtkInformation* vtkNotUsed(request),
   vtkInformationVector** inputVector, vtkInformationVector* vtkNotUsed(outputVector))
 {
+  this->NumberOfProcesses = this->Controller ? this->Controller->GetNumberOfProcesses() : 1;
+  this->Rank = this->Controller ? this->Controller->GetLocalProcessId() : 0;
+
   vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
   if (inInfo->Has(vtkStreamingDemandDrivenPipeline::TIME_STEPS()))
   {
     this->NumberOfTimeSteps = inInfo->Length(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
-    if (this->WriteAllTimeSteps)
+    if (this->WriteAllTimeSteps && this->NumberOfProcesses > 1)
+    {
+      vtkWarningMacro(<< "Writing all the timesteps is not supported with more than one process, "
+                         "only the requested timestep is written to "
+                      << (this->FileName ? this->FileName : "(none)"));
+    }
+    else if (this->WriteAllTimeSteps)
     {
       this->IsTransient = true;
     }
@@ -767,6 +880,8 @@ int vtkHDFWriter::RequestInformation(vtkInformation* vtkNotUsed(request),
   {
     this->NumberOfTimeSteps = 0;
   }
+  this->IsStreamingPieces = !this->IsTransient &&
+    (this->NumberOfPieces > 1 || this->Append || this->NumberOfProcesses > 1);
 
   return 1;
 }
@@ -783,6 +898,15 @@ int vtkHDFWriter::RequestUpdateExtent(vtkInformation* vtkNotUsed(request),
     inputVector[0]->GetInformationObject(0)->Set(
       vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP(), timeReq);
   }
+  if (this->IsStreamingPieces)
+  {
+    // Each process writes its own pieces of the input
+    inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER(),
+      this->Rank * this->NumberOfPieces + this->CurrentPiece);
+    inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES(),
+      this->NumberOfProcesses * this->NumberOfPieces);
+    inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_GHOST_LEVELS(), 0);
+  }
   return 1;
 }
 
@@ -795,6 +919,15 @@ int vtkHDFWriter::RequestData(vtkInformation* request,
     return 1;
   }
 
+  // With more than one process, wait for the previous process to have written its pieces and
+  // closed the file
+  const bool parallel = this->IsStreamingPieces && this->NumberOfProcesses > 1;
+  if (parallel && this->CurrentPiece == 0 && this->Rank > 0)
+  {
+    int token = 0;
+    this->Controller->Receive(&token, 1, this->Rank - 1, FILE_TOKEN_TAG);
+  }
+
   this->WriteData();
 
   if (this->IsTransient)
@@ -814,6 +947,43 @@ int vtkHDFWriter::RequestData(vtkInformation* request,
       this->CurrentTimeIndex = 0;
     }
   }
+  else if (this->IsStreamingPieces)
+  {
+    if (this->CurrentPiece == 0)
+    {
+      // Tell the pipeline to start looping in order to write all the pieces
+      request->Set(vtkStreamingDemandDrivenPipeline::CONTINUE_EXECUTING(), 1);
+    }
+
+    this->CurrentPiece++;
+
+    if (this->CurrentPiece >= this->NumberOfPieces)
+    {
+      // Tell the pipeline to stop looping.
+      request->Set(vtkStreamingDemandDrivenPipeline::CONTINUE_EXECUTING(), 0);
+      this->CurrentPiece = 0;
+    }
+  }
+
+  // The file stays open, flush it once all the timesteps and pieces are written
+  if (!request->Get(vtkStreamingDemandDrivenPipeline::CONTINUE_EXECUTING()) &&
+    this->Impl->GetFile() != H5I_INVALID_HID)
+  {
+    H5Fflush(this->Impl->GetFile(), H5F_SCOPE_GLOBAL);
+  }
+
+  // Close the file and pass it to the next process once all the pieces are written, so that
+  // the file is complete on all the processes when the write returns
+  if (parallel && !request->Get(vtkStreamingDemandDrivenPipeline::CONTINUE_EXECUTING()))
+  {
+    this->Impl->CloseFile();
+    if (this->Rank < this->NumberOfProcesses - 1)
+    {
+      int token = 1;
+      this->Controller->Send(&token, 1, this->Rank + 1, FILE_TOKEN_TAG);
+    }
+    this->Controller->Barrier();
+  }
 
   return 1;
 }
@@ -834,12 +1004,14 @@ int vtkHDFWriter::FillInputPortInformation(int port, vtkInformation* info)
 vtkHDFWriter::vtkHDFWriter()
   : Impl(new Implementation(this))
 {
+  this->SetController(vtkMultiProcessController::GetGlobalController());
 }
 
 //------------------------------------------------------------------------------
 vtkHDFWriter::~vtkHDFWriter()
 {
   this->SetFileName(nullptr);
+  this->SetController(nullptr);
 }
 
 VTK_ABI_NAMESPACE_END
@@ -20,6 +20,7 @@ class vtkUnstructuredGrid;
 class vtkPointSet;
 class vtkDataSet;
 class vtkCellArray;
+class vtkMultiProcessController;
 
 typedef int64_t hid_t;
 
@@ -74,12 +75,55 @@ public:
    * Configurable chunk size for transient (time-dependent) data, where arrays resized every
    * timestep, hence requiring chunking. Read more about chunks and chunk size here :
    * https://support.hdfgroup.org/HDF5/doc/Advanced/Chunking/
+   * When 0, the chunk size of each dataset is selected from the size of its first timestep or
+   * piece and from the size of its values, so that chunks are about 1 MiB.
    * Defaults to 100.
    */
-  vtkSetMacro(ChunkSize, int);
+  vtkSetClampMacro(ChunkSize, int, 0, VTK_INT_MAX);
   vtkGetMacro(ChunkSize, int);
   ///@}
 
+  ///@{
+  /**
+   * Get/set the number of pieces to request from the input. The pieces are
+   * requested and appended to the file one after the other, as partitions,
+   * so that only one piece is in memory at a time when the upstream pipeline
+   * supports streaming. All the pieces must have the same arrays. Ignored
+   * when writing all the timesteps of a transient input.
+   * Defaults to 1.
+   */
+  vtkSetClampMacro(NumberOfPieces, int, 1, VTK_INT_MAX);
+  vtkGetMacro(NumberOfPieces, int);
+  ///@}
+
+  ///@{
+  /**
+   * Get/set the flag to append the input to the file when it already exists. Each write then
+   * adds the pieces of its input as new partitions of the file, so that data produced
+   * incrementally, for instance by a simulation, can be written as it comes. The file must have
+   * been written by this writer with Append on, so that its datasets are extendable, and have the
+   * same type and arrays as the input. The file is created when it does not exist. Ignored when
+   * writing all the timesteps of a transient input.
+   * Defaults to false.
+   */
+  vtkSetMacro(Append, bool);
+  vtkGetMacro(Append, bool);
+  vtkBooleanMacro(Append, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Get/set the controller used to write the pieces of all the processes in the same file. With
+   * more than one process, each process writes its NumberOfPieces pieces of the input, as
+   * partitions appended to the file one process after the other, so that the file can be read
+   * back with any number of processes. Writing all the timesteps of a transient input is not
+   * supported with more than one process, only the requested timestep is then written.
+   * Defaults to the global controller.
+   */
+  virtual void SetController(vtkMultiProcessController*);
+  vtkGetObjectMacro(Controller, vtkMultiProcessController);
+  ///@}
+
   /**
    * Write the dataset from the input in the file specified by the filename to the vtkHDF format.
    */
@@ -128,12 +172,24 @@ private:
   ///@{
   /**
    * Initialize the `Steps` group for transient data, and extendable datasets where needed.
-   * This way, the other functions will append to existing datasets every step.
+   * This way, the other functions will append to existing datasets every step, or every
+   * piece when streaming pieces.
    */
   bool InitializeTransientData(vtkUnstructuredGrid* input);
   bool InitializeTransientData(vtkPolyData* input);
   ///@}
 
+  /**
+   * Open the file and its root group for the first timestep and piece, either by creating
+   * them, or by opening them when appending to an existing file. Sets IsAppending.
+   */
+  bool OpenRoot(const char* hdfType);
+
+  /**
+   * Create the extendable Points dataset, using the type of the points of the input if any.
+   */
+  bool InitializePointsDataset(hid_t group, vtkPointSet* input);
+
   /**
    * Add the number of points to the file
    * OpenRoot should succeed on this->Impl before calling this function
@@ -211,6 +267,20 @@ private:
   int CurrentTimeIndex = 0;
   int NumberOfTimeSteps = 0;
   int ChunkSize = 100;
+
+  // Piece streaming configuration and variables
+  int NumberOfPieces = 1;
+  int CurrentPiece = 0;
+  bool IsStreamingPieces = false;
+
+  // Append configuration and variables
+  bool Append = false;
+  bool IsAppending = false;
+
+  // Parallel configuration and variables
+  vtkMultiProcessController* Controller = nullptr;
+  int NumberOfProcesses = 1;
+  int Rank = 0;
 };
 VTK_ABI_NAMESPACE_END
 #endif
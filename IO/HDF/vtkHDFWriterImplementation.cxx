@@ -7,6 +7,9 @@
 
 #include "vtk_hdf5.h"
 
+#include <string>
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 
 //------------------------------------------------------------------------------
@@ -98,6 +101,66 @@ bool vtkHDFWriter::Implementation::OpenRoot(bool overwrite)
   return true;
 }
 
+//------------------------------------------------------------------------------
+void vtkHDFWriter::Implementation::CloseFile()
+{
+  this->StepsGroup = H5I_INVALID_HID;
+  this->Root = H5I_INVALID_HID;
+  this->File = H5I_INVALID_HID;
+}
+
+//------------------------------------------------------------------------------
+bool vtkHDFWriter::Implementation::OpenExistingRoot(const char* hdfType)
+{
+  const char* filename = this->Writer->GetFileName();
+
+  // Release the previous file first, it may be the same
+  this->StepsGroup = H5I_INVALID_HID;
+  this->Root = H5I_INVALID_HID;
+  this->File = H5I_INVALID_HID;
+
+  vtkHDF::ScopedH5FHandle file{ H5Fopen(filename, H5F_ACC_RDWR, H5P_DEFAULT) };
+  if (file == H5I_INVALID_HID)
+  {
+    this->LastError = "Can not open file";
+    return false;
+  }
+
+  vtkHDF::ScopedH5GHandle root{ H5Gopen(file, "VTKHDF", H5P_DEFAULT) };
+  if (root == H5I_INVALID_HID)
+  {
+    this->LastError = "Can not open root group";
+    return false;
+  }
+
+  // The type of the file must match the type of the data appended
+  std::string strType;
+  if (H5Aexists(root, "Type") > 0)
+  {
+    vtkHDF::ScopedH5AHandle typeAttribute{ H5Aopen(root, "Type", H5P_DEFAULT) };
+    vtkHDF::ScopedH5THandle typeOfTypeAttr{ H5Aget_type(typeAttribute) };
+    if (typeOfTypeAttr != H5I_INVALID_HID && H5Tget_class(typeOfTypeAttr) == H5T_STRING &&
+      !H5Tis_variable_str(typeOfTypeAttr))
+    {
+      std::vector<char> buffer(H5Tget_size(typeOfTypeAttr) + 1, '\0');
+      if (H5Aread(typeAttribute, typeOfTypeAttr, buffer.data()) >= 0)
+      {
+        strType = buffer.data();
+      }
+    }
+  }
+  if (strType != hdfType)
+  {
+    this->LastError = "The type of the file does not match";
+    return false;
+  }
+
+  this->File = std::move(file);
+  this->Root = std::move(root);
+
+  return true;
+}
+
 //------------------------------------------------------------------------------
 bool vtkHDFWriter::Implementation::CreateStepsGroup()
 {
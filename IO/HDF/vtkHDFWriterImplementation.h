@@ -44,6 +44,20 @@ public:
    */
   bool OpenRoot(bool overwrite = true);
 
+  /**
+   * Open the existing file from the filename for writing, and its root VTKHDF group, which must
+   * have the type hdfType
+   * This file is not closed until another root is opened or this object is destructed
+   * Returns wether the operation was successful
+   */
+  bool OpenExistingRoot(const char* hdfType);
+
+  /**
+   * Release the steps group, the root group and the file, so that another process can open
+   * the file
+   */
+  void CloseFile();
+
   /**
    * Create the steps group in the root group. Set a member variable to store the group, so it can
    * be retrieved later using `GetStepsGroup` function.
@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Write two element blocks with node fields of one and three components, and
+// check that the node fields read with UseIndexedArrays are indexed arrays
+// with the same values as the node fields read without.
+
+#include "vtkDataArray.h"
+#include "vtkDataArraySelection.h"
+#include "vtkDataSet.h"
+#include "vtkDoubleArray.h"
+#include "vtkIOSSReader.h"
+#include "vtkIOSSWriter.h"
+#include "vtkIndexedArray.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPartitionedDataSet.h"
+#include "vtkPartitionedDataSetCollection.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkTestUtilities.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cstdlib>
+#include <initializer_list>
+#include <string>
+
+namespace
+{
+// A row of n hexahedra starting at x, with node fields
+vtkSmartPointer<vtkUnstructuredGrid> MakeBlock(int n, double x)
+{
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkDoubleArray> temperature;
+  temperature->SetName("temperature");
+  vtkNew<vtkDoubleArray> velocity;
+  velocity->SetName("velocity");
+  velocity->SetNumberOfComponents(3);
+  for (int i = 0; i <= n; ++i)
+  {
+    for (int k = 0; k < 4; ++k)
+    {
+      const double y = k % 2;
+      const double z = k / 2;
+      points->InsertNextPoint(x + i, y, z);
+      temperature->InsertNextValue(x * 10.0 + i + 0.25 * k);
+      velocity->InsertNextTuple3(x + i, -y, 2.0 * z + i);
+    }
+  }
+  auto grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  grid->SetPoints(points);
+  grid->GetPointData()->AddArray(temperature);
+  grid->GetPointData()->AddArray(velocity);
+  for (int i = 0; i < n; ++i)
+  {
+    const vtkIdType hex[8] = { 4 * i, 4 * i + 4, 4 * i + 5, 4 * i + 1, 4 * i + 2, 4 * i + 6,
+      4 * i + 7, 4 * i + 3 };
+    grid->InsertNextCell(VTK_HEXAHEDRON, 8, hex);
+  }
+  return grid;
+}
+}
+
+int TestIOSSExodusIndexedArrays(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string fileName = std::string(tempDir) + "/test_ioss_exodus_indexed_arrays.ex2";
+  delete[] tempDir;
+
+  vtkNew<vtkPartitionedDataSetCollection> collection;
+  collection->SetNumberOfPartitionedDataSets(2);
+  for (unsigned int block = 0; block < 2; ++block)
+  {
+    vtkNew<vtkPartitionedDataSet> partitions;
+    partitions->SetPartition(0, ::MakeBlock(5 + block, 10.0 * block));
+    collection->SetPartitionedDataSet(block, partitions);
+  }
+  vtkNew<vtkIOSSWriter> writer;
+  writer->SetFileName(fileName.c_str());
+  writer->SetInputDataObject(collection);
+  writer->Write();
+
+  vtkNew<vtkIOSSReader> reader;
+  reader->SetFileName(fileName.c_str());
+  reader->UpdateInformation();
+  reader->GetElementBlockSelection()->EnableAllArrays();
+  reader->GetNodeBlockFieldSelection()->EnableAllArrays();
+  reader->Update();
+  vtkNew<vtkPartitionedDataSetCollection> copied;
+  copied->DeepCopy(reader->GetOutputDataObject(0));
+
+  reader->UseIndexedArraysOn();
+  reader->Update();
+  vtkPartitionedDataSetCollection* indexed =
+    vtkPartitionedDataSetCollection::SafeDownCast(reader->GetOutputDataObject(0));
+
+  if (copied->GetNumberOfPartitionedDataSets() != 2 ||
+    indexed->GetNumberOfPartitionedDataSets() != 2)
+  {
+    vtkLog(ERROR, "Expected 2 element blocks");
+    return EXIT_FAILURE;
+  }
+  for (unsigned int block = 0; block < 2; ++block)
+  {
+    vtkDataSet* copiedBlock = copied->GetPartition(block, 0);
+    vtkDataSet* indexedBlock = indexed->GetPartition(block, 0);
+    if (!copiedBlock || !indexedBlock ||
+      copiedBlock->GetNumberOfPoints() != indexedBlock->GetNumberOfPoints())
+    {
+      vtkLog(ERROR, "Wrong points for block " << block);
+      return EXIT_FAILURE;
+    }
+    for (const char* name : { "temperature", "velocity" })
+    {
+      vtkDataArray* copiedArray = copiedBlock->GetPointData()->GetArray(name);
+      vtkDataArray* indexedArray = indexedBlock->GetPointData()->GetArray(name);
+      if (!copiedArray || !indexedArray || !vtkIndexedArray<double>::SafeDownCast(indexedArray) ||
+        indexedArray->GetNumberOfTuples() != copiedArray->GetNumberOfTuples() ||
+        indexedArray->GetNumberOfComponents() != copiedArray->GetNumberOfComponents())
+      {
+        vtkLog(ERROR, "Missing or wrong array " << name << " for block " << block);
+        return EXIT_FAILURE;
+      }
+      for (vtkIdType i = 0; i < copiedArray->GetNumberOfValues(); ++i)
+      {
+        const int numComps = copiedArray->GetNumberOfComponents();
+        if (indexedArray->GetComponent(i / numComps, i % numComps) !=
+          copiedArray->GetComponent(i / numComps, i % numComps))
+        {
+          vtkLog(ERROR, "Wrong value " << i << " of " << name << " for block " << block);
+          return EXIT_FAILURE;
+        }
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -11,6 +11,7 @@
 #include "vtkDummyController.h"
 #include "vtkIOSSUtilities.h"
 #include "vtkIOSSWriter.h"
+#include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkMultiProcessController.h"
@@ -18,6 +19,7 @@
 #include "vtkPartitionedDataSet.h"
 #include "vtkPartitionedDataSetCollection.h"
 #include "vtkPointData.h"
+#include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkTable.h"
@@ -1400,8 +1402,15 @@ struct vtkEntityBlock : public vtkGroupingEntity
       auto* entityBlock = this->GetEntity(region, blockName);
 
       std::vector<int> orderingTransformation;
-      const bool needsIdsTransformation =
-        NeedsIdsTransformation(vtk_cell_type, orderingTransformation);
+      bool needsIdsTransformation = NeedsIdsTransformation(vtk_cell_type, orderingTransformation);
+      if (needsIdsTransformation &&
+        orderingTransformation.size() != static_cast<size_t>(nodeCount))
+      {
+        vtkGenericWarningMacro("Cell of type "
+          << vtk_cell_type << " has " << nodeCount << "entries but order transformation expects "
+          << orderingTransformation.size() << " entries. Skipping transform.");
+        needsIdsTransformation = false;
+      }
       // populate ids.
       std::vector<int32_t> elementIds; // these are global IDs.
       elementIds.reserve(elementCount);
@@ -1417,46 +1426,45 @@ struct vtkEntityBlock : public vtkGroupingEntity
         auto* gids = vtkIdTypeArray::SafeDownCast(ds->GetCellData()->GetGlobalIds());
         auto* pointGIDs = vtkIdTypeArray::SafeDownCast(ds->GetPointData()->GetGlobalIds());
 
-        vtkNew<vtkIdList> tempCellPointIds;
+        // select the cells of the block first, so that their ids and
+        // connectivity can then be converted in parallel.
+        std::vector<vtkIdType> cellIds;
         for (vtkIdType cc = 0, max = ds->GetNumberOfCells(); cc < max; ++cc)
         {
           const bool process = !removeGhosts || !ghost || ghost->GetValue(cc) == 0;
           if (process && ds->GetCellType(cc) == vtk_cell_type)
           {
-            elementIds.push_back(gidOffset + gids->GetValue(cc));
+            cellIds.push_back(cc);
+          }
+        }
+        const size_t start = elementIds.size();
+        elementIds.resize(start + cellIds.size());
+        connectivity.resize(elementIds.size() * nodeCount);
+
+        vtkSMPThreadLocalObject<vtkIdList> tlCellPointIds;
+        vtkSMPTools::For(0, static_cast<vtkIdType>(cellIds.size()),
+          [&](vtkIdType begin, vtkIdType end) {
+            vtkIdList* tempCellPointIds = tlCellPointIds.Local();
+            for (vtkIdType idx = begin; idx < end; ++idx)
+            {
+              const vtkIdType cc = cellIds[idx];
+              elementIds[start + idx] = static_cast<int32_t>(gidOffset + gids->GetValue(cc));
 
-            vtkIdType numPts;
-            vtkIdType const* cellPoints;
-            ds->GetCellPoints(cc, numPts, cellPoints, tempCellPointIds);
-            assert(numPts == nodeCount);
+              vtkIdType numPts;
+              vtkIdType const* cellPoints;
+              ds->GetCellPoints(cc, numPts, cellPoints, tempCellPointIds);
+              assert(numPts == nodeCount);
 
-            if (!needsIdsTransformation)
-            {
               // map cell's point to global IDs for those points.
-              std::transform(cellPoints, cellPoints + numPts, std::back_inserter(connectivity),
-                [&](vtkIdType ptid) { return gidOffset + pointGIDs->GetValue(ptid); });
-            }
-            else
-            {
-              if (orderingTransformation.size() != static_cast<size_t>(numPts))
-              {
-                vtkGenericWarningMacro("Cell of type "
-                  << vtk_cell_type << " has " << numPts
-                  << "entries but order transformation expects " << orderingTransformation.size()
-                  << " entries. Skipping transform.");
-                std::transform(cellPoints, cellPoints + numPts, std::back_inserter(connectivity),
-                  [&](vtkIdType ptid) { return gidOffset + pointGIDs->GetValue(ptid); });
-              }
-              else
+              int32_t* cellConnectivity = connectivity.data() + (start + idx) * nodeCount;
+              for (int i = 0; i < nodeCount; ++i)
               {
-                std::transform(orderingTransformation.begin(), orderingTransformation.end(),
-                  std::back_inserter(connectivity), [&](int localId) {
-                    return gidOffset + pointGIDs->GetValue(cellPoints[localId]);
-                  });
+                const vtkIdType ptid =
+                  cellPoints[needsIdsTransformation ? orderingTransformation[i] : i];
+                cellConnectivity[i] = static_cast<int32_t>(gidOffset + pointGIDs->GetValue(ptid));
               }
             }
-          }
-        }
+          });
       }
       assert(elementIds.size() == static_cast<size_t>(elementCount));
       assert(connectivity.size() == static_cast<size_t>(elementCount * nodeCount));
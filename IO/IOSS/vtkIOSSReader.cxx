@@ -4,14 +4,17 @@
 #include "vtkIOSSFilesScanner.h"
 #include "vtkIOSSUtilities.h"
 
+#include "vtkArrayDispatch.h"
 #include "vtkCellArrayIterator.h"
 #include "vtkCellData.h"
 #include "vtkDataArraySelection.h"
+#include "vtkDataArrayMeta.h"
 #include "vtkDataAssembly.h"
 #include "vtkDataSet.h"
 #include "vtkExtractGrid.h"
 #include "vtkHexahedron.h"
 #include "vtkIdList.h"
+#include "vtkIndexedArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationIntegerKey.h"
 #include "vtkInformationVector.h"
@@ -29,6 +32,7 @@
 #include "vtkPointData.h"
 #include "vtkQuad.h"
 #include "vtkRemoveUnusedPoints.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
@@ -175,6 +179,29 @@ vtkSmartPointer<vtkAbstractArray> JoinArrays(
   return result;
 }
 
+//----------------------------------------------------------------------------
+// Worker creating an indexed array viewing the values of an array, without
+// copying them.
+struct MakeIndexedArray
+{
+  vtkDataArray* ValueIds;
+  vtkSmartPointer<vtkDataArray> Result;
+
+  template <typename ArrayT>
+  void operator()(ArrayT* array)
+  {
+    using ValueType = vtk::GetAPIType<ArrayT>;
+    const int numComps = array->GetNumberOfComponents();
+    auto indexed = vtkSmartPointer<vtkIndexedArray<ValueType>>::New();
+    indexed->SetBackend(
+      std::make_shared<vtkIndexedImplicitBackend<ValueType>>(this->ValueIds, array));
+    indexed->SetName(array->GetName());
+    indexed->SetNumberOfComponents(numComps);
+    indexed->SetNumberOfTuples(this->ValueIds->GetNumberOfTuples() / numComps);
+    this->Result = indexed;
+  }
+};
+
 } // end of namespace {}
 
 class vtkIOSSReader::vtkInternals
@@ -2446,6 +2473,50 @@ vtkSmartPointer<vtkAbstractArray> vtkIOSSReader::vtkInternals::GetField(
   }
 
   auto full_field = get_field_for_entity();
+  auto full_data_array = vtkDataArray::SafeDownCast(full_field);
+  if (full_data_array != nullptr && ids_to_extract != nullptr &&
+    this->IOSSReader->GetUseIndexedArrays() &&
+    this->ConvertFieldForVTK(full_data_array) == full_data_array)
+  {
+    // view the values of the subset in the full field, which stays in the cache.
+    // The indices of the values of the tuples are shared by all the fields with
+    // the same number of components.
+    vtkSmartPointer<vtkDataArray> value_ids = ids_to_extract;
+    const int numComps = full_data_array->GetNumberOfComponents();
+    if (numComps > 1)
+    {
+      const std::string valueIdsKey =
+        "__vtk_value_ids_" + std::to_string(numComps) + "__" + cache_key_suffix;
+      value_ids = vtkIdTypeArray::SafeDownCast(cache.Find(group_entity, valueIdsKey));
+      if (value_ids == nullptr)
+      {
+        const vtkIdType numIds = ids_to_extract->GetNumberOfTuples();
+        vtkNew<vtkIdTypeArray> ids;
+        ids->SetNumberOfValues(numIds * numComps);
+        const vtkIdType* tupleIds = ids_to_extract->GetPointer(0);
+        vtkIdType* valueIds = ids->GetPointer(0);
+        vtkSMPTools::For(0, numIds, [&](vtkIdType begin, vtkIdType end) {
+          for (vtkIdType cc = begin; cc < end; ++cc)
+          {
+            for (int comp = 0; comp < numComps; ++comp)
+            {
+              valueIds[cc * numComps + comp] = tupleIds[cc] * numComps + comp;
+            }
+          }
+        });
+        cache.Insert(group_entity, valueIdsKey, ids);
+        value_ids = ids;
+      }
+    }
+
+    ::MakeIndexedArray worker{ value_ids, nullptr };
+    using Dispatch = vtkArrayDispatch::DispatchByArray<vtkIOSSUtilities::ArrayList>;
+    if (Dispatch::Execute(full_data_array, worker))
+    {
+      cache.Insert(group_entity, cacheKey, worker.Result);
+      return worker.Result;
+    }
+  }
   if (full_field != nullptr && ids_to_extract != nullptr)
   {
     // subset the field.
@@ -2820,6 +2891,7 @@ vtkIOSSReader::vtkIOSSReader()
   , ScanForRelatedFiles(true)
   , ReadIds(true)
   , RemoveUnusedPoints(true)
+  , UseIndexedArrays(false)
   , ApplyDisplacements(true)
   , ReadAllFilesToDetermineStructure(true)
   , ReadGlobalFields(true)
@@ -3354,6 +3426,18 @@ void vtkIOSSReader::SetRemoveUnusedPoints(bool val)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkIOSSReader::SetUseIndexedArrays(bool val)
+{
+  if (this->UseIndexedArrays != val)
+  {
+    // clear cache to ensure we read appropriate point data.
+    this->Internals->ClearCache();
+    this->UseIndexedArrays = val;
+    this->Modified();
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkIOSSReader::SetReadAllFilesToDetermineStructure(bool val)
 {
@@ -3605,6 +3689,7 @@ void vtkIOSSReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "FileStride: " << this->FileStride << endl;
   os << indent << "ReadIds: " << this->ReadIds << endl;
   os << indent << "RemoveUnusedPoints: " << this->RemoveUnusedPoints << endl;
+  os << indent << "UseIndexedArrays: " << this->UseIndexedArrays << endl;
   os << indent << "ApplyDisplacements: " << this->ApplyDisplacements << endl;
   os << indent << "DisplacementMagnitude: " << this->Internals->GetDisplacementMagnitude() << endl;
   os << indent << "ReadGlobalFields: " << this->ReadGlobalFields << endl;
@@ -327,6 +327,21 @@ public:
   vtkBooleanMacro(RemoveUnusedPoints, bool);
   ///@}
 
+  ///@{
+  /**
+   * When set to true, the node fields of each block or set from which unused
+   * points are removed are `vtkIndexedArray` views of the node fields shared
+   * by all the blocks and sets, instead of copies of their used values. This
+   * reduces the memory used for files with many blocks and node fields, at
+   * the cost of slower accesses to the values.
+   *
+   * Default is false, node fields are copied.
+   */
+  void SetUseIndexedArrays(bool);
+  vtkGetMacro(UseIndexedArrays, bool);
+  vtkBooleanMacro(UseIndexedArrays, bool);
+  ///@}
+
   ///@{
   /**
    * When set to true (default), if an array named 'displacement' is present in
@@ -652,6 +667,7 @@ private:
   bool ScanForRelatedFiles;
   bool ReadIds;
   bool RemoveUnusedPoints;
+  bool UseIndexedArrays;
   bool ApplyDisplacements;
   bool ReadAllFilesToDetermineStructure;
   bool ReadGlobalFields;
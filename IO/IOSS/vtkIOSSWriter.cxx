@@ -94,6 +94,7 @@ vtkIOSSWriter::vtkIOSSWriter()
   , PreserveOriginalIds(false)
   , WriteQAAndInformationRecords(true)
   , DisplacementMagnitude(1.0)
+  , CompressionLevel(0)
   , TimeStepRange{ 0, VTK_INT_MAX - 1 }
   , TimeStepStride(1)
 {
@@ -450,6 +451,13 @@ void vtkIOSSWriter::WriteData()
       properties.add(Ioss::Property("OMIT_INFO_RECORDS", true));
       properties.add(Ioss::Property("OMIT_QA_RECORDS", true));
     }
+    if (this->CompressionLevel > 0)
+    {
+      // compression requires the chunked storage of netCDF-4 files
+      properties.add(Ioss::Property("FILE_TYPE", "netcdf4"));
+      properties.add(Ioss::Property("COMPRESSION_LEVEL", this->CompressionLevel));
+      properties.add(Ioss::Property("COMPRESSION_SHUFFLE", 1));
+    }
     const auto fname = internals.RestartIndex > 0
       ? fmt::format("{}-s{:04}", this->FileName, internals.RestartIndex)
       : std::string(this->FileName);
@@ -534,6 +542,7 @@ void vtkIOSSWriter::PrintSelf(ostream& os, vtkIndent indent)
      << "WriteQAAndInformationRecords: " << (this->WriteQAAndInformationRecords ? "On" : "Off")
      << endl;
   os << indent << "DisplacementMagnitude: " << this->DisplacementMagnitude << endl;
+  os << indent << "CompressionLevel: " << this->CompressionLevel << endl;
   os << indent << "TimeStepRange: " << this->TimeStepRange[0] << ", " << this->TimeStepRange[1]
      << endl;
   os << indent << "TimeStepStride: " << this->TimeStepStride << endl;
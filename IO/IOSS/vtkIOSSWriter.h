@@ -583,6 +583,19 @@ public:
   vtkGetMacro(DisplacementMagnitude, double);
   ///@}
 
+  ///@{
+  /**
+   * Compression level, in the range [0, 9], of the variables written to the
+   * file. When non-zero, the file is written in the netCDF-4 format whose
+   * variables are chunked, shuffled and compressed with zlib. 0 writes the
+   * file uncompressed in the classic netCDF format.
+   *
+   * Defaults to 0.
+   */
+  vtkSetClampMacro(CompressionLevel, int, 0, 9);
+  vtkGetMacro(CompressionLevel, int);
+  ///@}
+
   ///@{
   /**
    * A debugging variable, set this to non-zero positive number to save at most
@@ -661,6 +674,7 @@ private:
   bool PreserveOriginalIds;
   bool WriteQAAndInformationRecords;
   double DisplacementMagnitude;
+  int CompressionLevel;
   int TimeStepRange[2];
   int TimeStepStride;
 
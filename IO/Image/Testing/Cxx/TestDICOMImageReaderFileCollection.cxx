@@ -8,8 +8,11 @@
 
 #include "vtkDICOMImageReader.h"
 
+#include "vtkDataArray.h"
 #include "vtkImageData.h"
 #include "vtkImageViewer2.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
 #include "vtkRenderWindowInteractor.h"
 #include "vtkRenderer.h"
 #include "vtkTestUtilities.h"
@@ -81,6 +84,30 @@ int TestDICOMImageReaderFileCollection(int argc, char* argv[])
   float gantryAngle = DICOMReader->GetGantryAngle();
   cout << "Gantry angle: " << gantryAngle << endl;
 
+  // Reading the directory again reuses the cached headers and must give the same volume
+  vtkNew<vtkImageData> firstRead;
+  firstRead->DeepCopy(DICOMReader->GetOutput());
+  DICOMReader->Modified();
+  DICOMReader->Update();
+  vtkDataArray* firstScalars = firstRead->GetPointData()->GetScalars();
+  vtkDataArray* scalars = DICOMReader->GetOutput()->GetPointData()->GetScalars();
+  if (!firstScalars || !scalars ||
+    firstScalars->GetNumberOfValues() != scalars->GetNumberOfValues())
+  {
+    cerr << "Reading the directory again did not give a volume of the same size" << endl;
+    return 1;
+  }
+  const int numComps = scalars->GetNumberOfComponents();
+  for (vtkIdType i = 0; i < scalars->GetNumberOfValues(); ++i)
+  {
+    if (firstScalars->GetComponent(i / numComps, i % numComps) !=
+      scalars->GetComponent(i / numComps, i % numComps))
+    {
+      cerr << "Reading the directory again gave a different value at " << i << endl;
+      return 1;
+    }
+  }
+
   // Display the center slice
   int sliceNumber =
     (DICOMReader->GetOutput()->GetExtent()[5] + DICOMReader->GetOutput()->GetExtent()[4]) / 2;
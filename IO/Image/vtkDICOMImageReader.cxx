@@ -8,10 +8,16 @@
 #include "vtkImageData.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 
 #include <vtksys/SystemTools.hxx>
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
+#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -25,6 +31,44 @@ class vtkDICOMImageReaderVector : public std::vector<std::string>
 {
 };
 
+namespace
+{
+// What the header of a file of a directory told, along with the stat of the
+// file when its header was parsed.
+struct HeaderCacheEntry
+{
+  long long ModifiedTime = 0;
+  long long Size = -1;
+  bool CanOpen = false;
+  bool IsDICOM = false;
+  DICOMFileEntry Entry;
+};
+
+// Parser and helper of a thread, DICOMParser and DICOMAppHelper instances
+// cannot be shared between threads.
+struct ThreadParser
+{
+  DICOMParser Parser;
+  DICOMAppHelper AppHelper;
+};
+
+std::shared_ptr<ThreadParser>& GetThreadParser(
+  vtkSMPThreadLocal<std::shared_ptr<ThreadParser>>& parsers)
+{
+  std::shared_ptr<ThreadParser>& parser = parsers.Local();
+  if (!parser)
+  {
+    parser = std::make_shared<ThreadParser>();
+  }
+  return parser;
+}
+}
+
+// Headers of the files of the last directory read, keyed on their path.
+class vtkDICOMImageReaderHeaderCache : public std::map<std::string, HeaderCacheEntry>
+{
+};
+
 //------------------------------------------------------------------------------
 vtkDICOMImageReader::vtkDICOMImageReader()
 {
@@ -36,6 +80,7 @@ vtkDICOMImageReader::vtkDICOMImageReader()
   this->StudyID = nullptr;
   this->TransferSyntaxUID = nullptr;
   this->DICOMFileNames = new vtkDICOMImageReaderVector();
+  this->HeaderCache = new vtkDICOMImageReaderHeaderCache();
 }
 
 //------------------------------------------------------------------------------
@@ -44,6 +89,7 @@ vtkDICOMImageReader::~vtkDICOMImageReader()
   delete this->Parser;
   delete this->AppHelper;
   delete this->DICOMFileNames;
+  delete this->HeaderCache;
 
   delete[] this->DirectoryName;
   delete[] this->PatientName;
@@ -141,6 +187,11 @@ void vtkDICOMImageReader::ExecuteInformation()
     this->DICOMFileNames->clear();
     this->AppHelper->Clear();
 
+    // Reuse the headers parsed by a previous read of the directory for the
+    // files that were not modified since, parse the others in parallel.
+    std::vector<std::string> fileNames;
+    std::vector<HeaderCacheEntry> entries;
+    std::vector<vtkIdType> toParse;
     for (vtkIdType i = 0; i < numFiles; i++)
     {
       if (strcmp(dir->GetFile(i), ".") == 0 || strcmp(dir->GetFile(i), "..") == 0)
@@ -152,23 +203,92 @@ void vtkDICOMImageReader::ExecuteInformation()
       fileString += "/";
       fileString += dir->GetFile(i);
 
-      int val = this->CanReadFile(fileString.c_str());
+      HeaderCacheEntry entry;
+      vtksys::SystemTools::Stat_t fs;
+      if (!vtksys::SystemTools::Stat(fileString, &fs))
+      {
+        entry.ModifiedTime = static_cast<long long>(fs.st_mtime);
+        entry.Size = static_cast<long long>(fs.st_size);
+      }
+      auto cached = this->HeaderCache->find(fileString);
+      if (entry.Size >= 0 && cached != this->HeaderCache->end() &&
+        cached->second.ModifiedTime == entry.ModifiedTime && cached->second.Size == entry.Size)
+      {
+        entry = cached->second;
+      }
+      else
+      {
+        toParse.push_back(static_cast<vtkIdType>(fileNames.size()));
+      }
+      fileNames.push_back(fileString);
+      entries.push_back(entry);
+    }
 
-      if (val == 1)
+    const vtkIdType numToParse = static_cast<vtkIdType>(toParse.size());
+    vtkSMPThreadLocal<std::shared_ptr<ThreadParser>> parsers;
+    vtkSMPTools::For(0, numToParse, [&](vtkIdType begin, vtkIdType end) {
+      std::shared_ptr<ThreadParser>& parser = ::GetThreadParser(parsers);
+      for (vtkIdType i = begin; i < end; ++i)
       {
-        vtkDebugMacro(<< "Adding " << fileString << " to DICOMFileNames.");
-        this->DICOMFileNames->push_back(fileString);
+        const std::string& fn = fileNames[toParse[i]];
+        HeaderCacheEntry& entry = entries[toParse[i]];
+        entry.CanOpen = parser->Parser.OpenFile(fn);
+        entry.IsDICOM = entry.CanOpen && parser->Parser.IsDICOMFile();
+        if (!entry.IsDICOM)
+        {
+          parser->Parser.CloseFile();
+          continue;
+        }
+        if (!parser->Parser.OpenFile(fn))
+        {
+          entry.IsDICOM = false;
+          continue;
+        }
+        parser->AppHelper.Clear();
+        parser->Parser.ClearAllDICOMTagCallbacks();
+        parser->AppHelper.RegisterCallbacks(&parser->Parser);
+        parser->Parser.ReadHeader();
+        parser->Parser.CloseFile();
+        entry.Entry = parser->AppHelper.GetFileEntry(fn);
+      }
+    });
+
+    this->HeaderCache->clear();
+    for (size_t i = 0; i < fileNames.size(); ++i)
+    {
+      const std::string& fileString = fileNames[i];
+      const HeaderCacheEntry& entry = entries[i];
+      if (entry.Size >= 0 && entry.CanOpen)
+      {
+        (*this->HeaderCache)[fileString] = entry;
+      }
+      if (!entry.CanOpen)
+      {
+        vtkErrorMacro("DICOMParser couldn't open : " << fileString);
+      }
+      else if (!entry.IsDICOM)
+      {
+        vtkWarningMacro("DICOMParser couldn't parse : " << fileString);
       }
       else
       {
-        vtkDebugMacro(<< fileString << " - DICOMParser CanReadFile returned : " << val);
+        vtkDebugMacro(<< "Adding " << fileString << " to DICOMFileNames.");
+        this->DICOMFileNames->push_back(fileString);
       }
     }
-    std::vector<std::string>::iterator iter;
 
-    for (iter = this->DICOMFileNames->begin(); iter != this->DICOMFileNames->end(); ++iter)
+    // The output information is the one of the last file, read its header
+    // with the parser of the reader so that it is the last one processed.
+    for (size_t i = 0; i < fileNames.size(); ++i)
     {
-      const char* fn = iter->c_str();
+      if (entries[i].IsDICOM && fileNames[i] != this->DICOMFileNames->back())
+      {
+        this->AppHelper->AddFileEntry(fileNames[i], entries[i].Entry);
+      }
+    }
+    if (!this->DICOMFileNames->empty())
+    {
+      const char* fn = this->DICOMFileNames->back().c_str();
       vtkDebugMacro(<< "Trying : " << fn);
 
       bool couldOpen = this->Parser->OpenFile(fn);
@@ -178,7 +298,6 @@ void vtkDICOMImageReader::ExecuteInformation()
         return;
       }
 
-      //
       this->Parser->ClearAllDICOMTagCallbacks();
       this->AppHelper->RegisterCallbacks(this->Parser);
 
@@ -279,62 +398,85 @@ void vtkDICOMImageReader::ExecuteDataWithInformation(vtkDataObject* output, vtkI
   else if (!this->DICOMFileNames->empty())
   {
     vtkDebugMacro(<< "Multiple files (" << static_cast<int>(this->DICOMFileNames->size()) << ")");
-    this->Parser->ClearAllDICOMTagCallbacks();
-    this->AppHelper->Clear();
-    this->AppHelper->RegisterCallbacks(this->Parser);
-    this->AppHelper->RegisterPixelDataCallback(this->Parser);
 
-    void* buffer = data->GetScalarPointer();
+    unsigned char* buffer = static_cast<unsigned char*>(data->GetScalarPointer());
     if (buffer == nullptr)
     {
       vtkErrorMacro(<< "No memory allocated for image data!");
       return;
     }
 
-    std::vector<std::string>::iterator fiter;
-
-    int count = 0;
-    vtkIdType numFiles = static_cast<int>(this->DICOMFileNames->size());
+    // Each slice is decoded by the parser of its thread straight into its
+    // place in the output.
+    const vtkIdType numFiles = std::min(static_cast<vtkIdType>(this->DICOMFileNames->size()),
+      static_cast<vtkIdType>(this->DataExtent[5] - this->DataExtent[4] + 1));
+    const vtkIdType rowLength = this->DataIncrements[1];
+    const vtkIdType sliceLength = this->DataIncrements[2];
+    std::vector<unsigned char> failed(numFiles, 0);
+    vtkSMPThreadLocal<std::shared_ptr<ThreadParser>> parsers;
+    vtkSMPTools::For(0, numFiles, [&](vtkIdType begin, vtkIdType end) {
+      std::shared_ptr<ThreadParser>& parser = ::GetThreadParser(parsers);
+      parser->Parser.ClearAllDICOMTagCallbacks();
+      parser->AppHelper.RegisterCallbacks(&parser->Parser);
+      parser->AppHelper.RegisterPixelDataCallback(&parser->Parser);
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        parser->AppHelper.Clear();
+        parser->Parser.OpenFile((*this->DICOMFileNames)[i]);
+        parser->Parser.ReadHeader();
+        parser->Parser.CloseFile();
+
+        void* imgData = nullptr;
+        DICOMParser::VRTypes dataType;
+        unsigned long imageDataLengthInBytes;
+
+        parser->AppHelper.GetImageData(imgData, dataType, imageDataLengthInBytes);
+        const vtkIdType height = parser->AppHelper.GetHeight();
+        if (!imageDataLengthInBytes ||
+          static_cast<vtkIdType>(imageDataLengthInBytes) < height * rowLength ||
+          height * rowLength > sliceLength)
+        {
+          failed[i] = 1;
+          continue;
+        }
+
+        // DICOM stores the upper left pixel as the first pixel in an
+        // image. VTK stores the lower left pixel as the first pixel in
+        // an image.  Need to flip the data.
+        unsigned char* b = buffer + i * sliceLength;
+        unsigned char* iData = static_cast<unsigned char*>(imgData);
+        iData += (imageDataLengthInBytes - rowLength); // beginning of last row
+        for (vtkIdType row = 0; row < height; ++row)
+        {
+          memcpy(b, iData, rowLength);
+          b += rowLength;
+          iData -= rowLength;
+        }
+      }
+    });
 
-    for (fiter = this->DICOMFileNames->begin(); fiter != this->DICOMFileNames->end(); ++fiter)
+    for (vtkIdType i = 0; i < numFiles; ++i)
     {
-      count++;
-      const char* file = fiter->c_str();
-      vtkDebugMacro(<< "File : " << file);
-      this->Parser->OpenFile(file);
-      this->Parser->ReadHeader();
-
-      void* imgData = nullptr;
-      DICOMParser::VRTypes dataType;
-      unsigned long imageDataLengthInBytes;
-
-      this->AppHelper->GetImageData(imgData, dataType, imageDataLengthInBytes);
-      if (!imageDataLengthInBytes)
+      if (failed[i])
       {
-        vtkErrorMacro(<< "There was a problem retrieving data from: " << file);
+        vtkErrorMacro(<< "There was a problem retrieving data from: "
+                      << (*this->DICOMFileNames)[i]);
         this->SetErrorCode(vtkErrorCode::FileFormatError);
         return;
       }
+    }
 
-      // DICOM stores the upper left pixel as the first pixel in an
-      // image. VTK stores the lower left pixel as the first pixel in
-      // an image.  Need to flip the data.
-      vtkIdType rowLength;
-      rowLength = this->DataIncrements[1];
-      unsigned char* b = (unsigned char*)buffer;
-      unsigned char* iData = (unsigned char*)imgData;
-      iData += (imageDataLengthInBytes - rowLength); // beginning of last row
-      for (int i = 0; i < this->AppHelper->GetHeight(); ++i)
-      {
-        memcpy(b, iData, rowLength);
-        b += rowLength;
-        iData -= rowLength;
-      }
-      buffer = ((char*)buffer) + imageDataLengthInBytes;
+    // Leave the header of the last slice as the last one processed, as the
+    // accessors of the reader report it.
+    this->Parser->ClearAllDICOMTagCallbacks();
+    this->AppHelper->Clear();
+    this->AppHelper->RegisterCallbacks(this->Parser);
+    this->Parser->OpenFile(this->DICOMFileNames->back());
+    this->Parser->ReadHeader();
+    this->Parser->CloseFile();
 
-      this->UpdateProgress(float(count) / float(numFiles));
-      this->SetProgressText(fiter->c_str());
-    }
+    this->UpdateProgress(1.0);
+    this->SetProgressText(this->DICOMFileNames->back().c_str());
   }
 }
 
@@ -30,6 +30,7 @@
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkDICOMImageReaderVector;
+class vtkDICOMImageReaderHeaderCache;
 class DICOMParser;
 class DICOMAppHelper;
 
@@ -72,6 +73,11 @@ public:
    * it will try to build an ordered volume from them based on
    * the slice number. The volume building will be upgraded to
    * something more sophisticated in the future.
+   *
+   * The headers and the slices of the files are parsed and decoded in
+   * parallel. The headers are cached and reused, while the modification
+   * time and the size of their file do not change, when the directory is
+   * read again.
    */
   void SetDirectoryName(VTK_FILEPATH const char* dn);
 
@@ -217,6 +223,12 @@ protected:
   vtkDICOMImageReaderVector* DICOMFileNames;
   char* DirectoryName;
 
+  //
+  // Headers of the files of the directory, reused by the next read of the
+  // directory for the files whose modification time and size did not change.
+  //
+  vtkDICOMImageReaderHeaderCache* HeaderCache;
+
   char* PatientName;
   char* StudyUID;
   char* StudyID;
@@ -71,7 +71,7 @@ public:
   /**
    * The main interface which triggers the writer to start.
    */
-  virtual void Write();
+  VTK_UNBLOCKTHREADS virtual void Write();
 
   void DeleteFiles();
 
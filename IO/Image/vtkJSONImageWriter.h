@@ -49,7 +49,7 @@ public:
   /**
    * The main interface which triggers the writer to start.
    */
-  virtual void Write();
+  VTK_UNBLOCKTHREADS virtual void Write();
 
 protected:
   vtkJSONImageWriter();
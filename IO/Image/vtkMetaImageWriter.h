@@ -92,7 +92,7 @@ public:
 
   // This is called by the superclass.
   // This is the method you should override.
-  void Write() override;
+  VTK_UNBLOCKTHREADS void Write() override;
 
 protected:
   vtkMetaImageWriter();
@@ -31,7 +31,7 @@ public:
   /**
    * The main interface which triggers the writer to start.
    */
-  void Write() override;
+  VTK_UNBLOCKTHREADS void Write() override;
 
   ///@{
   /**
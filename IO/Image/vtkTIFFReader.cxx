@@ -8,11 +8,16 @@
 #include "vtkImageData.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtksys/SystemTools.hxx"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
 #include <string>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 namespace
@@ -123,6 +128,75 @@ bool ReadTemplatedImage(T* out, Flip flip, int startCol, int endCol, int startRo
   }
   return true;
 }
+
+// Origins, in the file, of the tiles of the current directory of image that
+// hold pixels of the output extent.
+std::vector<std::array<uint32_t, 2>> GetTileOrigins(
+  TIFF* image, const int extent[6], unsigned int height, bool flip)
+{
+  std::vector<std::array<uint32_t, 2>> origins;
+  uint32_t tileWidth = 0;
+  uint32_t tileHeight = 0;
+  if (!TIFFGetField(image, TIFFTAG_TILEWIDTH, &tileWidth) ||
+    !TIFFGetField(image, TIFFTAG_TILELENGTH, &tileHeight) || tileWidth == 0 || tileHeight == 0)
+  {
+    return origins;
+  }
+  const uint32_t firstRow = flip ? height - 1 - extent[3] : extent[2];
+  const uint32_t lastRow = flip ? height - 1 - extent[2] : extent[3];
+  const uint32_t firstCol = extent[0];
+  const uint32_t lastCol = extent[1];
+  for (uint32_t row = firstRow - firstRow % tileHeight; row <= lastRow; row += tileHeight)
+  {
+    for (uint32_t col = firstCol - firstCol % tileWidth; col <= lastCol; col += tileWidth)
+    {
+      origins.push_back({ { col, row } });
+    }
+  }
+  return origins;
+}
+
+// Decode the tile of the current directory of image at origin and copy its
+// samples within the output extent to out, the pointer to the first pixel of
+// the extent.
+template <typename T>
+bool ReadTile(TIFF* image, const std::array<uint32_t, 2>& origin, T* out, const int extent[6],
+  const vtkIdType increments[3], unsigned int height, unsigned int samplesPerPixel, bool flip,
+  std::vector<unsigned char>& buffer)
+{
+  uint32_t tileWidth = 0;
+  uint32_t tileHeight = 0;
+  TIFFGetField(image, TIFFTAG_TILEWIDTH, &tileWidth);
+  TIFFGetField(image, TIFFTAG_TILELENGTH, &tileHeight);
+  buffer.resize(TIFFTileSize(image));
+  if (TIFFReadTile(image, buffer.data(), origin[0], origin[1], 0, 0) < 0)
+  {
+    return false;
+  }
+
+  const T* tile = reinterpret_cast<const T*>(buffer.data());
+  const vtkIdType numSamples = std::min<vtkIdType>(samplesPerPixel, increments[0]);
+  const int firstCol = std::max(static_cast<int>(origin[0]), extent[0]);
+  const int lastCol = std::min(static_cast<int>(origin[0] + tileWidth) - 1, extent[1]);
+  for (uint32_t yy = 0; yy < tileHeight && origin[1] + yy < height; ++yy)
+  {
+    const int fileRow = static_cast<int>(origin[1] + yy);
+    const int row = flip ? static_cast<int>(height) - fileRow - 1 : fileRow;
+    if (row < extent[2] || row > extent[3])
+    {
+      continue;
+    }
+    const T* in = tile + (yy * tileWidth + firstCol - origin[0]) * samplesPerPixel;
+    T* pixel = out + (row - extent[2]) * increments[1] + (firstCol - extent[0]) * increments[0];
+    for (int col = firstCol; col <= lastCol; ++col)
+    {
+      std::copy(in, in + numSamples, pixel);
+      in += samplesPerPixel;
+      pixel += increments[0];
+    }
+  }
+  return true;
+}
 }
 
 //------------------------------------------------------------------------------
@@ -790,6 +864,11 @@ void vtkTIFFReader::ReadVolume(T* buffer)
   int samplesPerPixel = this->InternalImage->SamplesPerPixel;
   unsigned int npages = this->InternalImage->NumberOfPages;
 
+  if (this->ReadPagesInParallel(buffer))
+  {
+    return;
+  }
+
   int outDims[3];
   vtkStructuredData::GetDimensionsFromExtent(this->OutputExtent, outDims);
 
@@ -839,119 +918,168 @@ void vtkTIFFReader::ReadVolume(T* buffer)
   }
 }
 
-/** Read a tiled tiff */
-void vtkTIFFReader::ReadTiles(void* buffer)
+//------------------------------------------------------------------------------
+template <typename T>
+bool vtkTIFFReader::ReadPagesInParallel(T* buffer)
 {
-  unsigned char* volume = reinterpret_cast<unsigned char*>(buffer);
-  unsigned char* tile = new unsigned char[TIFFTileSize(this->InternalImage->Image)];
-
-  const unsigned int width = this->InternalImage->Width;
-  const unsigned int height = this->InternalImage->Height;
-  const unsigned int tileWidth = this->InternalImage->TileWidth;
-  const unsigned int tileHeight = this->InternalImage->TileHeight;
-  const unsigned int pixelSize = this->InternalImage->SamplesPerPixel;
-  const bool rowMultiple = height % tileHeight == 0;
-  const bool colMultiple = width % tileWidth == 0;
-  const bool flip = this->InternalImage->Orientation != ORIENTATION_TOPLEFT;
+  vtkTIFFReaderInternal* internal = this->InternalImage;
+  if (!internal->CanRead() || internal->SamplesPerPixel != 1 ||
+    internal->PlanarConfig != PLANARCONFIG_CONTIG ||
+    internal->Photometrics != PHOTOMETRIC_MINISBLACK ||
+    this->GetFormat() != vtkTIFFReader::GRAYSCALE || this->OutputIncrements[0] != 1)
+  {
+    return false;
+  }
 
-  for (unsigned int slice = 0; slice < this->InternalImage->NumberOfPages; ++slice)
+  // Find the pages of the slices of the output extent, they must all be laid
+  // out as the first page.
+  std::vector<unsigned int> pages;
+  bool uniform = true;
+  int slice = 0;
+  for (unsigned int page = 0; page < internal->NumberOfPages && uniform; ++page)
   {
-    for (unsigned int row = 0; row < (rowMultiple ? height : height - tileHeight);
-         row += tileHeight)
+    if (page > 0 && !TIFFReadDirectory(internal->Image))
     {
-      const unsigned int r = flip ? height - row - tileHeight : row;
-      for (unsigned int col = 0; col < (colMultiple ? width : width - tileWidth); col += tileWidth)
-      {
-        if (TIFFReadTile(this->InternalImage->Image, tile, col, r, slice, 0) < 0)
-        {
-          vtkErrorMacro(<< "Cannot read tile : " << r << "," << col << " from file");
-          delete[] tile;
-          return;
-        }
-        // Currently not using tile depth
-        unsigned int zz = 0;
-        for (unsigned int yy = 0; yy < tileHeight; ++yy)
-        {
-          const unsigned int y = flip ? tileHeight + height % tileHeight - yy - 1 : yy;
-          memcpy(volume + (((slice + zz) * height + row + y) * width + col) * pixelSize,
-            tile + (zz * tileHeight + yy) * tileWidth * pixelSize, tileWidth * pixelSize);
-        }
-      }
+      uniform = false;
+      break;
     }
+    long subfiletype = 6;
+    if (internal->SubFiles > 0 &&
+      TIFFGetField(internal->Image, TIFFTAG_SUBFILETYPE, &subfiletype) && subfiletype != 0)
+    {
+      continue;
+    }
+    if (slice >= this->OutputExtent[4] && slice <= this->OutputExtent[5])
+    {
+      uint32_t width = 0;
+      uint32_t height = 0;
+      unsigned short bitsPerSample = 0;
+      unsigned short samplesPerPixel = 0;
+      unsigned short photometric = 0;
+      TIFFGetField(internal->Image, TIFFTAG_IMAGEWIDTH, &width);
+      TIFFGetField(internal->Image, TIFFTAG_IMAGELENGTH, &height);
+      TIFFGetFieldDefaulted(internal->Image, TIFFTAG_BITSPERSAMPLE, &bitsPerSample);
+      TIFFGetFieldDefaulted(internal->Image, TIFFTAG_SAMPLESPERPIXEL, &samplesPerPixel);
+      TIFFGetField(internal->Image, TIFFTAG_PHOTOMETRIC, &photometric);
+      uniform = width == internal->Width && height == internal->Height &&
+        bitsPerSample == internal->BitsPerSample && samplesPerPixel == 1 &&
+        photometric == PHOTOMETRIC_MINISBLACK;
+      pages.push_back(page);
+    }
+    ++slice;
   }
-  // Fill the boundaries
-  if (!colMultiple)
+  TIFFSetDirectory(internal->Image, 0);
+  if (!uniform)
   {
-    const unsigned int lenx = width % tileWidth;
-    const unsigned int col = width - lenx;
-    const unsigned int tilexWidth = lenx;
-    for (unsigned int row = 0; row < (rowMultiple ? height : height - tileHeight);
-         row += tileHeight)
+    return false;
+  }
+
+  // libtiff handles cannot be shared between threads, each thread decodes its
+  // pages with its own handle on the file.
+  const unsigned int height = internal->Height;
+  const bool flip = internal->Orientation != ORIENTATION_TOPLEFT;
+  const int* extent = this->OutputExtent;
+  const vtkIdType* increments = this->OutputIncrements;
+  vtkSMPThreadLocal<TIFF*> threadImages(nullptr);
+  vtkSMPThreadLocal<std::vector<unsigned char>> threadBuffers;
+  std::atomic<bool> failed(false);
+  vtkSMPTools::For(0, static_cast<vtkIdType>(pages.size()), [&](vtkIdType begin, vtkIdType end) {
+    TIFF*& image = threadImages.Local();
+    if (!image)
     {
-      const unsigned int r = flip ? height - row - tileHeight - 1 : row;
-      if (TIFFReadTile(this->InternalImage->Image, tile, col, r, 0, 0) < 0)
+      image = TIFFOpen(this->InternalFileName, "r");
+    }
+    std::vector<unsigned char>& tileBuffer = threadBuffers.Local();
+    for (vtkIdType idx = begin; idx < end; ++idx)
+    {
+      T* out = buffer + idx * increments[2];
+      if (!image || !TIFFSetDirectory(image, static_cast<tdir_t>(pages[idx])))
       {
-        vtkErrorMacro(<< "Cannot read tile : " << r << "," << col << " from file");
-        delete[] tile;
-        return;
+        failed = true;
+        continue;
       }
-      const unsigned int zz = 0;
-      for (unsigned int yy = 0; yy < tileHeight; ++yy)
+      if (TIFFIsTiled(image))
       {
-        const unsigned int y = flip ? tileHeight + height % tileHeight - yy - 1 : yy;
-        memcpy(volume + (((0 + zz) * height + row + y) * width + col) * pixelSize,
-          tile + (zz * tileHeight + yy) * tileWidth * pixelSize, tilexWidth * pixelSize);
+        for (const auto& origin : ::GetTileOrigins(image, extent, height, flip))
+        {
+          if (!::ReadTile(image, origin, out, extent, increments, height, 1, flip, tileBuffer))
+          {
+            failed = true;
+          }
+        }
+      }
+      else if (!(flip ? ReadTemplatedImage(out, FlipTrue(), extent[0], extent[1], extent[2],
+                          extent[3], increments[1], height, image)
+                      : ReadTemplatedImage(out, FlipFalse(), extent[0], extent[1], extent[2],
+                          extent[3], increments[1], height, image)))
+      {
+        failed = true;
       }
     }
-  }
-  if (!rowMultiple)
+  });
+  for (TIFF* image : threadImages)
   {
-    const unsigned int leny = height % tileHeight;
-    const unsigned int row = height - leny;
-    const unsigned int r = flip ? 0 : row;
-    for (unsigned int col = 0; col < (colMultiple ? width : width - tileWidth); col += tileWidth)
+    if (image)
     {
-      if (TIFFReadTile(this->InternalImage->Image, tile, col, row, 0, 0) < 0)
-      {
-        vtkErrorMacro(<< "Cannot read tile : " << r << "," << col << " from file");
-        delete[] tile;
-        return;
-      }
-      const unsigned int zz = 0;
-      for (unsigned int yy = 0; yy < leny; ++yy)
-      {
-        const unsigned int y = flip ? leny - yy - 1 : yy;
-        memcpy(volume + (((0 + zz) * height + r + y) * width + col) * pixelSize,
-          tile + (zz * tileHeight + yy) * tileWidth * pixelSize, tileWidth * pixelSize);
-      }
+      TIFFClose(image);
     }
   }
-  if (!colMultiple && !rowMultiple)
+  if (failed)
   {
-    const unsigned int lenx = width % tileWidth;
-    const unsigned int col = width - lenx;
-
-    const unsigned int leny = height % tileHeight;
-    const unsigned int row = height - leny;
-    const unsigned int tilexWidth = lenx;
+    vtkErrorMacro(<< "Problem reading slice of volume in TIFF file.");
+  }
+  this->UpdateProgress(1.0);
+  return true;
+}
 
-    const unsigned int r = flip ? 0 : row;
-    if (TIFFReadTile(this->InternalImage->Image, tile, col, row, 0, 0) < 0)
+//------------------------------------------------------------------------------
+/** Read a tiled tiff */
+template <typename T>
+void vtkTIFFReader::ReadTiles(T* buffer)
+{
+  const unsigned int height = this->InternalImage->Height;
+  const unsigned int samplesPerPixel = this->InternalImage->SamplesPerPixel;
+  const bool flip = this->InternalImage->Orientation != ORIENTATION_TOPLEFT;
+  const std::vector<std::array<uint32_t, 2>> origins =
+    ::GetTileOrigins(this->InternalImage->Image, this->OutputExtent, height, flip);
+
+  // libtiff handles cannot be shared between threads, each thread decodes its
+  // tiles with its own handle on the file.
+  vtkSMPThreadLocal<TIFF*> threadImages(nullptr);
+  vtkSMPThreadLocal<std::vector<unsigned char>> threadBuffers;
+  std::atomic<bool> failed(false);
+  vtkSMPTools::For(0, static_cast<vtkIdType>(origins.size()), [&](vtkIdType begin, vtkIdType end) {
+    TIFF*& image = threadImages.Local();
+    if (!image)
+    {
+      image = TIFFOpen(this->InternalFileName, "r");
+    }
+    if (!image)
     {
-      vtkErrorMacro(<< "Cannot read tile : " << r << "," << col << " from file");
-      delete[] tile;
+      failed = true;
       return;
     }
-    const unsigned int zz = 0;
-    unsigned int y;
-    for (unsigned int yy = 0; yy < leny; ++yy)
+    std::vector<unsigned char>& tileBuffer = threadBuffers.Local();
+    for (vtkIdType idx = begin; idx < end; ++idx)
+    {
+      if (!::ReadTile(image, origins[idx], buffer, this->OutputExtent, this->OutputIncrements,
+            height, samplesPerPixel, flip, tileBuffer))
+      {
+        failed = true;
+      }
+    }
+  });
+  for (TIFF* image : threadImages)
+  {
+    if (image)
     {
-      y = flip ? leny - yy - 1 : yy;
-      memcpy(volume + (((0 + zz) * height + r + y) * width + col) * pixelSize,
-        tile + (zz * tileHeight + yy) * tileWidth * pixelSize, tilexWidth * pixelSize);
+      TIFFClose(image);
     }
   }
-  delete[] tile;
+  if (failed)
+  {
+    vtkErrorMacro(<< "Cannot read the tiles of " << this->InternalFileName);
+  }
 }
 
 /** To Support Zeiss images that contains only 2 samples per pixel but are actually
@@ -149,9 +149,19 @@ private:
   void ReadVolume(T* buffer);
 
   /**
-   * Reads 3D data from tiled tiff
+   * Reads the pages of a multi-pages grayscale tiff in parallel, each thread
+   * decoding its pages with its own handle on the file. Returns false, without
+   * reading anything, if the pages are not all laid out as the first one.
    */
-  void ReadTiles(void* buffer);
+  template <typename T>
+  bool ReadPagesInParallel(T* buffer);
+
+  /**
+   * Reads 3D data from tiled tiff, decoding the tiles of the output extent
+   * in parallel.
+   */
+  template <typename T>
+  void ReadTiles(T* buffer);
 
   /**
    * Reads a generic image.
@@ -4,6 +4,7 @@
 #include "vtkLASReader.h"
 
 #include <vtkCellArray.h>
+#include <vtkIdTypeArray.h>
 #include <vtkInformation.h>
 #include <vtkInformationVector.h>
 #include <vtkNew.h>
@@ -11,14 +12,15 @@
 #include <vtkPointData.h>
 #include <vtkPoints.h>
 #include <vtkPolyData.h>
+#include <vtkStreamingDemandDrivenPipeline.h>
 #include <vtkUnsignedShortArray.h>
-#include <vtkVertexGlyphFilter.h>
 #include <vtksys/FStream.hxx>
 
 #include <liblas/liblas.hpp>
 
 #include <fstream>
 #include <iostream>
+#include <numeric>
 #include <valarray>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -39,6 +41,34 @@ vtkLASReader::~vtkLASReader()
   delete[] this->FileName;
 }
 
+//------------------------------------------------------------------------------
+void vtkLASReader::AddClassificationToFilter(unsigned char classification)
+{
+  if (this->ClassificationFilter.insert(classification).second)
+  {
+    this->Modified();
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkLASReader::RemoveAllClassificationsFromFilter()
+{
+  if (!this->ClassificationFilter.empty())
+  {
+    this->ClassificationFilter.clear();
+    this->Modified();
+  }
+}
+
+//------------------------------------------------------------------------------
+int vtkLASReader::RequestInformation(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** vtkNotUsed(inputVector), vtkInformationVector* outputVector)
+{
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  outInfo->Set(CAN_HANDLE_PIECE_REQUEST(), 1);
+  return 1;
+}
+
 //------------------------------------------------------------------------------
 int vtkLASReader::RequestData(vtkInformation* vtkNotUsed(request),
   vtkInformationVector** vtkNotUsed(request), vtkInformationVector* outputVector)
@@ -63,21 +93,43 @@ int vtkLASReader::RequestData(vtkInformation* vtkNotUsed(request),
   liblas::ReaderFactory readerFactory;
   liblas::Reader reader = readerFactory.CreateWithStream(ifs);
 
-  vtkNew<vtkPolyData> pointsPolyData;
-  this->ReadPointRecordData(reader, pointsPolyData);
+  // Read the point records of the requested piece only
+  int piece = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER());
+  int numPieces = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES());
+  if (numPieces < 1)
+  {
+    piece = 0;
+    numPieces = 1;
+  }
+  const vtkIdType pointRecordsCount = reader.GetHeader().GetPointRecordsCount();
+  const vtkIdType start = pointRecordsCount * piece / numPieces;
+  const vtkIdType end = pointRecordsCount * (piece + 1) / numPieces;
+
+  this->ReadPointRecordData(reader, output, start, end);
   ifs.close();
 
   // Convert points to verts in output polydata
-  vtkNew<vtkVertexGlyphFilter> vertexFilter;
-  vertexFilter->SetInputData(pointsPolyData);
-  vertexFilter->Update();
-  output->ShallowCopy(vertexFilter->GetOutput());
+  const vtkIdType numPoints = output->GetNumberOfPoints();
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfValues(numPoints);
+  std::iota(connectivity->GetPointer(0), connectivity->GetPointer(0) + numPoints, 0);
+  vtkNew<vtkCellArray> verts;
+  verts->SetData(1, connectivity);
+  output->SetVerts(verts);
 
   return VTK_OK;
 }
 
 //------------------------------------------------------------------------------
 void vtkLASReader::ReadPointRecordData(liblas::Reader& reader, vtkPolyData* pointsPolyData)
+{
+  this->ReadPointRecordData(
+    reader, pointsPolyData, 0, reader.GetHeader().GetPointRecordsCount());
+}
+
+//------------------------------------------------------------------------------
+void vtkLASReader::ReadPointRecordData(
+  liblas::Reader& reader, vtkPolyData* pointsPolyData, vtkIdType start, vtkIdType end)
 {
   vtkNew<vtkPoints> points;
   // scalars associated with points
@@ -95,12 +147,36 @@ void vtkLASReader::ReadPointRecordData(liblas::Reader& reader, vtkPolyData* poin
   std::valarray<double> scale = { header.GetScaleX(), header.GetScaleY(), header.GetScaleZ() };
   std::valarray<double> offset = { header.GetOffsetX(), header.GetOffsetY(), header.GetOffsetZ() };
   liblas::PointFormatName pointFormat = header.GetDataFormatId();
-  int pointRecordsCount = header.GetPointRecordsCount();
+  const double* bounds = this->UseFilterBounds ? this->FilterBounds : nullptr;
 
-  for (int i = 0; i < pointRecordsCount && reader.ReadNextPoint(); i++)
+  // Without filtering, each record gives a point
+  if (!bounds && this->ClassificationFilter.empty())
+  {
+    points->Allocate(end - start);
+    intensity->Allocate(end - start);
+  }
+  if (start > 0 && !reader.Seek(static_cast<std::size_t>(start)))
+  {
+    vtkErrorMacro(<< "Unable to seek to point record " << start);
+    return;
+  }
+
+  for (vtkIdType i = start; i < end && reader.ReadNextPoint(); i++)
   {
     liblas::Point const& p = reader.GetPoint();
     std::valarray<double> lasPoint = { p.GetX(), p.GetY(), p.GetZ() };
+    if (bounds &&
+      (lasPoint[0] < bounds[0] || lasPoint[0] > bounds[1] || lasPoint[1] < bounds[2] ||
+        lasPoint[1] > bounds[3] || lasPoint[2] < bounds[4] || lasPoint[2] > bounds[5]))
+    {
+      continue;
+    }
+    if (!this->ClassificationFilter.empty() &&
+      this->ClassificationFilter.find(static_cast<unsigned char>(
+        p.GetClassification().GetClass())) == this->ClassificationFilter.end())
+    {
+      continue;
+    }
     points->InsertNextPoint(&lasPoint[0]);
     // std::valarray<double> point = lasPoint * scale + offset;
     // We have seen a file where the scaled points were much smaller than the offset
@@ -161,5 +237,15 @@ void vtkLASReader::PrintSelf(ostream& os, vtkIndent indent)
   Superclass::PrintSelf(os, indent);
   os << "vtkLASReader" << std::endl;
   os << "Filename: " << this->FileName << std::endl;
+  os << indent << "UseFilterBounds: " << this->UseFilterBounds << std::endl;
+  os << indent << "FilterBounds: (" << this->FilterBounds[0] << ", " << this->FilterBounds[1]
+     << ", " << this->FilterBounds[2] << ", " << this->FilterBounds[3] << ", "
+     << this->FilterBounds[4] << ", " << this->FilterBounds[5] << ")" << std::endl;
+  os << indent << "ClassificationFilter:";
+  for (unsigned char classification : this->ClassificationFilter)
+  {
+    os << " " << static_cast<int>(classification);
+  }
+  os << std::endl;
 }
 VTK_ABI_NAMESPACE_END
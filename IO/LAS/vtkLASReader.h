@@ -11,6 +11,10 @@
  * "classification": vtkUnsignedCharArray (optional)
  * "color": vtkUnsignedShortArray (optional)
  *
+ * The reader honors piece requests by reading only the point records of the
+ * requested piece, so that a file can be streamed or read in parallel.
+ * Points can also be filtered while they are read, by bounds and by
+ * classification, to read a subset of a large survey.
  *
  * @sa
  * vtkPolyData
@@ -23,6 +27,8 @@
 
 #include <vtkPolyDataAlgorithm.h>
 
+#include <set> // For ClassificationFilter
+
 namespace liblas
 {
 class Header;
@@ -46,6 +52,29 @@ public:
   vtkSetFilePathMacro(FileName);
   vtkGetFilePathMacro(FileName);
 
+  ///@{
+  /**
+   * Only read the points that are inside FilterBounds, given as
+   * (xmin, xmax, ymin, ymax, zmin, zmax), when UseFilterBounds is on.
+   * Default is off.
+   */
+  vtkSetMacro(UseFilterBounds, bool);
+  vtkGetMacro(UseFilterBounds, bool);
+  vtkBooleanMacro(UseFilterBounds, bool);
+  vtkSetVector6Macro(FilterBounds, double);
+  vtkGetVector6Macro(FilterBounds, double);
+  ///@}
+
+  ///@{
+  /**
+   * Only read the points with one of the given classifications. When no
+   * classification is added, which is the default, points of all
+   * classifications are read.
+   */
+  void AddClassificationToFilter(unsigned char classification);
+  void RemoveAllClassificationsFromFilter();
+  ///@}
+
 protected:
   vtkLASReader();
   ~vtkLASReader() override;
@@ -61,7 +90,19 @@ protected:
    */
   void ReadPointRecordData(liblas::Reader& reader, vtkPolyData* pointsPolyData);
 
+  /**
+   * Read the point record data of the records in [start, end)
+   */
+  void ReadPointRecordData(
+    liblas::Reader& reader, vtkPolyData* pointsPolyData, vtkIdType start, vtkIdType end);
+
+  int RequestInformation(vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override;
+
   char* FileName;
+  bool UseFilterBounds = false;
+  double FilterBounds[6] = { 0.0, -1.0, 0.0, -1.0, 0.0, -1.0 };
+  std::set<unsigned char> ClassificationFilter;
 };
 
 VTK_ABI_NAMESPACE_END
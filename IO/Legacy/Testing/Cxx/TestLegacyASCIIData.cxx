@@ -0,0 +1,204 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Write polydata with arrays of various types in ASCII, with more values than
+// are parsed in one batch, and check that the legacy reader reads them back
+// with both file versions.  Also read values written with a leading '+' and
+// irregular whitespace.
+
+#include "vtkCellArray.h"
+#include "vtkCharArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkIntArray.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataReader.h"
+#include "vtkPolyDataWriter.h"
+#include "vtkShortArray.h"
+#include "vtkTypeUInt64Array.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <cstdlib>
+#include <initializer_list>
+
+namespace
+{
+// Compare the values of the arrays of the same name in two point data
+bool CompareArrays(vtkPointData* pointData, vtkPointData* reference)
+{
+  for (int a = 0; a < reference->GetNumberOfArrays(); ++a)
+  {
+    vtkDataArray* refArray = reference->GetArray(a);
+    vtkDataArray* array = pointData->GetArray(refArray->GetName());
+    if (!array || array->GetDataType() != refArray->GetDataType() ||
+      array->GetNumberOfValues() != refArray->GetNumberOfValues())
+    {
+      vtkLog(ERROR, "Missing or wrong array " << refArray->GetName());
+      return false;
+    }
+    for (vtkIdType i = 0; i < refArray->GetNumberOfValues(); ++i)
+    {
+      int numComp = refArray->GetNumberOfComponents();
+      if (array->GetComponent(i / numComp, i % numComp) !=
+        refArray->GetComponent(i / numComp, i % numComp))
+      {
+        vtkLog(ERROR, "Wrong value " << i << " of array " << refArray->GetName());
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}
+
+int TestLegacyASCIIData(int, char*[])
+{
+  const vtkIdType numPoints = 30000;
+  vtkNew<vtkPolyData> polyData;
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToDouble();
+  points->SetNumberOfPoints(numPoints);
+  vtkNew<vtkCellArray> polys;
+
+  vtkNew<vtkUnsignedCharArray> colors;
+  colors->SetName("Colors");
+  colors->SetNumberOfComponents(3);
+  colors->SetNumberOfTuples(numPoints);
+  vtkNew<vtkCharArray> chars;
+  chars->SetName("Chars");
+  chars->SetNumberOfValues(numPoints);
+  vtkNew<vtkShortArray> shorts;
+  shorts->SetName("Shorts");
+  shorts->SetNumberOfValues(numPoints);
+  vtkNew<vtkIntArray> ints;
+  ints->SetName("Ints");
+  ints->SetNumberOfValues(numPoints);
+  vtkNew<vtkIdTypeArray> ids;
+  ids->SetName("Ids");
+  ids->SetNumberOfValues(numPoints);
+  vtkNew<vtkTypeUInt64Array> largeValues;
+  largeValues->SetName("LargeValues");
+  largeValues->SetNumberOfValues(numPoints);
+  vtkNew<vtkDoubleArray> doubles;
+  doubles->SetName("Doubles");
+  doubles->SetNumberOfValues(numPoints);
+
+  unsigned int seed = 12345;
+  for (vtkIdType i = 0; i < numPoints; ++i)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    points->SetPoint(i, (seed >> 20) / 8.0, -static_cast<double>(i), (seed >> 8) % 1000 / 64.0);
+    colors->SetTypedComponent(i, 0, static_cast<unsigned char>(seed >> 24));
+    colors->SetTypedComponent(i, 1, static_cast<unsigned char>(seed >> 16));
+    colors->SetTypedComponent(i, 2, static_cast<unsigned char>(seed >> 8));
+    chars->SetValue(i, static_cast<char>(static_cast<int>(seed >> 25) - 64));
+    shorts->SetValue(i, static_cast<short>(static_cast<int>(seed >> 16) - 32768));
+    ints->SetValue(i, static_cast<int>(seed) / 3);
+    ids->SetValue(i, 7 * i - 1000);
+    largeValues->SetValue(i, (static_cast<vtkTypeUInt64>(seed) << 32) + i);
+    doubles->SetValue(i, (seed >> 12) / 16.0 - 50000.0);
+    if (i + 2 < numPoints && i % 3 == 0)
+    {
+      const vtkIdType triangle[3] = { i, i + 1, i + 2 };
+      polys->InsertNextCell(3, triangle);
+    }
+  }
+  polyData->SetPoints(points);
+  polyData->SetPolys(polys);
+  for (vtkDataArray* array : std::initializer_list<vtkDataArray*>{
+         colors, chars, shorts, ints, ids, largeValues, doubles })
+  {
+    polyData->GetPointData()->AddArray(array);
+  }
+
+  for (int version : { 42, 51 })
+  {
+    vtkNew<vtkPolyDataWriter> writer;
+    writer->SetInputData(polyData);
+    writer->SetFileTypeToASCII();
+    writer->SetFileVersion(version);
+    writer->WriteToOutputStringOn();
+    writer->Write();
+
+    vtkNew<vtkPolyDataReader> reader;
+    reader->ReadFromInputStringOn();
+    reader->SetInputString(writer->GetOutputStdString());
+    reader->Update();
+    vtkPolyData* output = reader->GetOutput();
+    if (output->GetNumberOfPoints() != numPoints ||
+      output->GetNumberOfPolys() != polys->GetNumberOfCells())
+    {
+      vtkLog(ERROR,
+        "Read " << output->GetNumberOfPoints() << " points and " << output->GetNumberOfPolys()
+                << " polygons with version " << version);
+      return EXIT_FAILURE;
+    }
+    for (vtkIdType i = 0; i < numPoints; ++i)
+    {
+      double x[3], y[3];
+      output->GetPoint(i, x);
+      points->GetPoint(i, y);
+      if (x[0] != y[0] || x[1] != y[1] || x[2] != y[2])
+      {
+        vtkLog(ERROR, "Wrong point " << i << " with version " << version);
+        return EXIT_FAILURE;
+      }
+    }
+    for (vtkIdType c = 0; c < polys->GetNumberOfCells(); ++c)
+    {
+      vtkIdType npts, outNpts;
+      const vtkIdType* pts;
+      const vtkIdType* outPts;
+      polys->GetCellAtId(c, npts, pts);
+      output->GetPolys()->GetCellAtId(c, outNpts, outPts);
+      if (outNpts != npts || outPts[0] != pts[0] || outPts[1] != pts[1] || outPts[2] != pts[2])
+      {
+        vtkLog(ERROR, "Wrong polygon " << c << " with version " << version);
+        return EXIT_FAILURE;
+      }
+    }
+    if (!CompareArrays(output->GetPointData(), polyData->GetPointData()))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
+  // values with a leading '+' and irregular whitespace
+  vtkNew<vtkPolyDataReader> reader;
+  reader->ReadFromInputStringOn();
+  reader->SetInputString("# vtk DataFile Version 4.2\n"
+                         "values\n"
+                         "ASCII\n"
+                         "DATASET POLYDATA\n"
+                         "POINTS 2 float\n"
+                         "+1.5 -2e1\t\t3\r\n"
+                         "  4 +5.25e+2\n\n 6\n"
+                         "POINT_DATA 2\n"
+                         "SCALARS Values int 1\n"
+                         "LOOKUP_TABLE default\n"
+                         "+7\n"
+                         "-8\n");
+  reader->Update();
+  vtkPolyData* output = reader->GetOutput();
+  vtkDataArray* scalars = output->GetPointData()->GetScalars();
+  double x[3] = { 0.0, 0.0, 0.0 };
+  double y[3] = { 0.0, 0.0, 0.0 };
+  if (output->GetNumberOfPoints() == 2)
+  {
+    output->GetPoint(0, x);
+    output->GetPoint(1, y);
+  }
+  if (output->GetNumberOfPoints() != 2 || x[0] != 1.5 || x[1] != -20.0 || x[2] != 3.0 ||
+    y[0] != 4.0 || y[1] != 525.0 || y[2] != 6.0 || !scalars || scalars->GetTuple1(0) != 7.0 ||
+    scalars->GetTuple1(1) != -8.0)
+  {
+    vtkLog(ERROR, "Wrong values with leading '+' or irregular whitespace");
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
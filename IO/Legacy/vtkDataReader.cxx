@@ -33,6 +33,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPointSet.h"
+#include "vtkSMPTools.h"
 #include "vtkRectilinearGrid.h"
 #include "vtkShortArray.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
@@ -44,12 +45,14 @@
 #include "vtkUnsignedIntArray.h"
 #include "vtkUnsignedLongArray.h"
 #include "vtkUnsignedShortArray.h"
+#include "vtkValueFromString.h"
 #include "vtkVariantArray.h"
 
 #include "vtksys/FStream.hxx"
 #include <vtksys/SystemTools.hxx>
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <sstream>
 #include <vector>
@@ -1510,22 +1513,126 @@ int vtkReadBinaryData(istream* IS, T* data, vtkIdType numTuples, vtkIdType numCo
   return 1;
 }
 
-// General templated function to read data of various types.
+// The type to parse ASCII values of type T as, the 8-bit values are written
+// and read as integers.
+template <class T>
+struct vtkASCIIValueType
+{
+  using Type = T;
+};
+template <>
+struct vtkASCIIValueType<char>
+{
+  using Type = int;
+};
+template <>
+struct vtkASCIIValueType<signed char>
+{
+  using Type = int;
+};
+template <>
+struct vtkASCIIValueType<unsigned char>
+{
+  using Type = int;
+};
+
+// Parse a whole token as a value of type T, with an optional leading '+'.
+template <class T>
+bool vtkParseASCIIValue(const char* begin, const char* end, T& value)
+{
+  if (begin != end && *begin == '+')
+  {
+    ++begin;
+  }
+  typename vtkASCIIValueType<T>::Type parsed;
+  if (begin == end ||
+    vtkValueFromString(begin, end, parsed) != static_cast<std::size_t>(end - begin))
+  {
+    return false;
+  }
+  value = static_cast<T>(parsed);
+  return true;
+}
+
+inline bool vtkIsASCIISpace(int c)
+{
+  return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\v' || c == '\f';
+}
+
+// General templated function to read data of various types.  The tokens of
+// a batch of values are gathered from the stream buffer, which leaves the
+// stream right after the last value as extracting them one by one would, and
+// are then parsed in parallel.
 template <class T>
 int vtkReadASCIIData(vtkDataReader* self, T* data, vtkIdType numTuples, vtkIdType numComp)
 {
-  vtkIdType i, j;
+  const vtkIdType numValues = numTuples * numComp;
+  const vtkIdType batchSize = 65536;
+  istream* is = self->GetIStream();
+  std::streambuf* buffer = is->rdbuf();
+  const int eof = std::char_traits<char>::eof();
+  std::vector<char> text;
+  std::vector<std::size_t> tokenEnds;
 
-  for (i = 0; i < numTuples; i++)
+  for (vtkIdType first = 0; first < numValues; first += batchSize)
   {
-    for (j = 0; j < numComp; j++)
+    const vtkIdType count = std::min(batchSize, numValues - first);
+    text.clear();
+    tokenEnds.clear();
+    bool valid = is->good();
+    for (vtkIdType i = 0; valid && i < count; ++i)
     {
-      if (!self->Read(data++))
+      int c = buffer->sgetc();
+      while (c != eof && vtkIsASCIISpace(c))
       {
-        vtkGenericWarningMacro(<< "Error reading ascii data. Possible mismatch of "
-                                  "datasize with declaration.");
-        return 0;
+        c = buffer->snextc();
+      }
+      if (c == eof)
+      {
+        is->setstate(std::ios::eofbit | std::ios::failbit);
+        valid = false;
+        break;
+      }
+      while (c != eof && !vtkIsASCIISpace(c))
+      {
+        text.push_back(static_cast<char>(c));
+        c = buffer->snextc();
+      }
+      if (c == eof)
+      {
+        is->setstate(std::ios::eofbit);
       }
+      tokenEnds.push_back(text.size());
+    }
+
+    if (valid)
+    {
+      std::atomic<bool> parsed(true);
+      T* values = data + first;
+      vtkSMPTools::For(0, count, [&](vtkIdType begin, vtkIdType end) {
+        const char* chars = text.data();
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          std::size_t start = (i == 0 ? 0 : tokenEnds[i - 1]);
+          if (!vtkParseASCIIValue(chars + start, chars + tokenEnds[i], values[i]))
+          {
+            parsed = false;
+            return;
+          }
+        }
+      });
+      if (!parsed)
+      {
+        is->setstate(std::ios::failbit);
+        valid = false;
+      }
+    }
+
+    if (!valid)
+    {
+      vtkGenericWarningMacro(<< "Error reading ascii data. Possible mismatch of "
+                                "datasize with declaration.");
+      return 0;
     }
   }
   return 1;
@@ -3162,7 +3269,6 @@ int vtkDataReader::ReadCells(vtkSmartPointer<vtkCellArray>& cellArray)
 int vtkDataReader::ReadCellsLegacy(vtkIdType size, int* data)
 {
   char line[256];
-  int i;
 
   if (this->FileType == VTK_BINARY)
   {
@@ -3180,15 +3286,12 @@ int vtkDataReader::ReadCellsLegacy(vtkIdType size, int* data)
   }
   else // ascii
   {
-    for (i = 0; i < size; i++)
+    if (!vtkReadASCIIData(this, data, size, 1))
     {
-      if (!this->Read(data + i))
-      {
-        const char* fname = this->CurrentFileName.c_str();
-        vtkErrorMacro(<< "Error reading ascii cell data!"
-                      << " for file: " << (fname ? fname : "(Null FileName)"));
-        return 0;
-      }
+      const char* fname = this->CurrentFileName.c_str();
+      vtkErrorMacro(<< "Error reading ascii cell data!"
+                    << " for file: " << (fname ? fname : "(Null FileName)"));
+      return 0;
     }
   }
 
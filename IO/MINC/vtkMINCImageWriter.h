@@ -65,7 +65,7 @@ public:
    * unless the whole extent of the input has already been
    * updated.
    */
-  void Write() override;
+  VTK_UNBLOCKTHREADS void Write() override;
 
   ///@{
   /**
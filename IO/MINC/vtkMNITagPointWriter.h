@@ -107,7 +107,7 @@ public:
   /**
    * Write the file.
    */
-  int Write() override;
+  VTK_UNBLOCKTHREADS int Write() override;
 
   /**
    * Get the MTime.
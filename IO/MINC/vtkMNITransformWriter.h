@@ -87,7 +87,7 @@ public:
   /**
    * Write the file.
    */
-  virtual void Write();
+  VTK_UNBLOCKTHREADS virtual void Write();
 
 protected:
   vtkMNITransformWriter();
@@ -30,6 +30,8 @@
 #include "vtkDataArraySelection.h"
 #include "vtkDataObject.h"
 #include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationDoubleVectorKey.h"
 #include "vtkInformationVector.h"
@@ -38,6 +40,8 @@
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
@@ -46,6 +50,7 @@
 #include "vtk_netcdf.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cfloat>
 #include <cmath>
 #include <cstdarg>
@@ -2204,78 +2209,97 @@ void vtkMPASReader::OutputPoints()
   double adjustedLayerThickness = this->IsAtmosphere ? static_cast<double>(-this->LayerThickness)
                                                      : static_cast<double>(this->LayerThickness);
 
-  vtkSmartPointer<vtkPoints> points = vtkSmartPointer<vtkPoints>::New();
-  points->Allocate(this->MaximumPoints);
-  output->SetPoints(points);
-
-  for (size_t j = 0; j < this->CurrentExtraPoint; j++)
+  if (this->Geometry != vtkMPASReader::Planar && this->Geometry != vtkMPASReader::Spherical &&
+    this->Geometry != vtkMPASReader::Projected)
   {
-    double x, y, z;
-
-    switch (this->Geometry)
-    {
-      case vtkMPASReader::Planar:
-      case vtkMPASReader::Spherical:
-        x = this->PointX[j];
-        y = this->PointY[j];
-        z = this->PointZ[j];
-        break;
-
-      case vtkMPASReader::Projected:
-        x = this->PointX[j] * 180.0 / vtkMath::Pi();
-        y = this->PointY[j] * 180.0 / vtkMath::Pi();
-        z = 0.0;
-        break;
+    vtkErrorMacro("Unrecognized geometry type (" << this->Geometry << ").");
+    return;
+  }
 
-      default:
-        vtkErrorMacro("Unrecognized geometry type (" << this->Geometry << ").");
-        return;
-    }
+  // Each point of the dual grid is output once, or once per level boundary
+  const size_t pointsPerColumn = this->ShowMultilayerView ? this->MaximumNVertLevels + 1 : 1;
+  vtkNew<vtkFloatArray> coordinates;
+  coordinates->SetNumberOfComponents(3);
+  coordinates->SetNumberOfTuples(static_cast<vtkIdType>(this->CurrentExtraPoint * pointsPerColumn));
+  float* coords = coordinates->GetPointer(0);
 
-    if (!this->ShowMultilayerView)
+  std::atomic<bool> layerFailed(false);
+  vtkSMPTools::For(0, static_cast<vtkIdType>(this->CurrentExtraPoint),
+    [&](vtkIdType begin, vtkIdType end)
     {
-      points->InsertNextPoint(x, y, z);
-    }
-    else
-    {
-      double rho = 0.0, rholevel = 0.0, theta = 0.0, phi = 0.0;
-      int retval = -1;
-
-      if (this->Geometry == Spherical)
+      for (vtkIdType j = begin; j < end; ++j)
       {
-        if ((x != 0.0) || (y != 0.0) || (z != 0.0))
+        double x, y, z;
+        if (this->Geometry == vtkMPASReader::Projected)
         {
-          retval = CartesianToSpherical(x, y, z, &rho, &phi, &theta);
-          if (retval)
-          {
-            vtkWarningMacro("Can't create point for layered view.");
-          }
+          x = this->PointX[j] * 180.0 / vtkMath::Pi();
+          y = this->PointY[j] * 180.0 / vtkMath::Pi();
+          z = 0.0;
+        }
+        else
+        {
+          x = this->PointX[j];
+          y = this->PointY[j];
+          z = this->PointZ[j];
         }
-      }
 
-      for (size_t levelNum = 0; levelNum < this->MaximumNVertLevels + 1; levelNum++)
-      {
+        float* point = coords + 3 * j * pointsPerColumn;
+        if (!this->ShowMultilayerView)
+        {
+          point[0] = static_cast<float>(x);
+          point[1] = static_cast<float>(y);
+          point[2] = static_cast<float>(z);
+          continue;
+        }
+
+        double rho = 0.0, rholevel = 0.0, theta = 0.0, phi = 0.0;
+        int retval = -1;
+
         if (this->Geometry == Spherical)
         {
-          if (!retval && ((x != 0.0) || (y != 0.0) || (z != 0.0)))
+          if ((x != 0.0) || (y != 0.0) || (z != 0.0))
           {
-            rholevel = rho - (adjustedLayerThickness * levelNum);
-            retval = SphericalToCartesian(rholevel, phi, theta, &x, &y, &z);
+            retval = CartesianToSpherical(x, y, z, &rho, &phi, &theta);
             if (retval)
             {
-              vtkWarningMacro("Can't create point for layered view.");
+              layerFailed = true;
             }
           }
         }
-        else
+
+        for (size_t levelNum = 0; levelNum < pointsPerColumn; levelNum++)
         {
-          z = levelNum * -adjustedLayerThickness;
+          if (this->Geometry == Spherical)
+          {
+            if (!retval && ((x != 0.0) || (y != 0.0) || (z != 0.0)))
+            {
+              rholevel = rho - (adjustedLayerThickness * levelNum);
+              retval = SphericalToCartesian(rholevel, phi, theta, &x, &y, &z);
+              if (retval)
+              {
+                layerFailed = true;
+              }
+            }
+          }
+          else
+          {
+            z = levelNum * -adjustedLayerThickness;
+          }
+          point[3 * levelNum] = static_cast<float>(x);
+          point[3 * levelNum + 1] = static_cast<float>(y);
+          point[3 * levelNum + 2] = static_cast<float>(z);
         }
-        points->InsertNextPoint(x, y, z);
       }
-    }
+    });
+  if (layerFailed)
+  {
+    vtkWarningMacro("Can't create point for layered view.");
   }
 
+  vtkNew<vtkPoints> points;
+  points->SetData(coordinates);
+  output->SetPoints(points);
+
   if (this->PointX)
   {
     delete[] this->PointX;
@@ -2339,10 +2363,7 @@ void vtkMPASReader::OutputCells()
   vtkDebugMacro(<< "In OutputCells..." << endl);
   vtkUnstructuredGrid* output = GetOutput();
 
-  output->Allocate(this->MaximumCells, this->MaximumCells);
-
   int cellType = GetCellType();
-  size_t val;
 
   size_t pointsPerPolygon;
   if (this->ShowMultilayerView)
@@ -2359,105 +2380,100 @@ void vtkMPASReader::OutputCells()
                 << " LayerThickness: " << LayerThickness << " ProjectLatLon: " << ProjectLatLon
                 << " ShowMultilayerView: " << ShowMultilayerView);
 
-  std::vector<vtkIdType> polygon(pointsPerPolygon);
+  // All cells have the same size: fill the connectivity of the cells of each
+  // column of the dual grid in parallel
+  const size_t cellsPerColumn = this->ShowMultilayerView ? this->MaximumNVertLevels : 1;
+  const int verticalLevel = this->ShowMultilayerView ? 0 : this->GetVerticalLevel();
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfValues(
+    static_cast<vtkIdType>(this->CurrentExtraCell * cellsPerColumn * pointsPerPolygon));
+  vtkIdType* polygons = connectivity->GetPointer(0);
 
-  for (size_t j = 0; j < this->CurrentExtraCell; j++)
-  {
-
-    int* conns;
-    if (this->Geometry == Projected)
+  vtkSMPTools::For(0, static_cast<vtkIdType>(this->CurrentExtraCell),
+    [&](vtkIdType begin, vtkIdType end)
     {
-      conns = this->ModConnections + (j * this->PointsPerCell);
-    }
-    else
-    {
-      conns = this->OrigConnections + (j * this->PointsPerCell);
-    }
+      for (vtkIdType cellId = begin; cellId < end; ++cellId)
+      {
+        const size_t j = static_cast<size_t>(cellId);
+        int* conns;
+        if (this->Geometry == Projected)
+        {
+          conns = this->ModConnections + (j * this->PointsPerCell);
+        }
+        else
+        {
+          conns = this->OrigConnections + (j * this->PointsPerCell);
+        }
 
-    int minLevel = 0;
+        int minLevel = 0;
 
-    if (this->IncludeTopography)
-    {
-      int* connections;
+        if (this->IncludeTopography)
+        {
+          int* connections;
 
-      // check if it is a mirror cell, if so, get original
-      if (static_cast<size_t>(j) >= this->NumberOfCells + this->CellOffset)
-      {
-        size_t origCellNum = *(this->CellMap + (j - this->NumberOfCells - this->CellOffset));
-        connections = this->OrigConnections + (origCellNum * this->PointsPerCell);
-      }
-      else
-      {
-        connections = this->OrigConnections + (j * this->PointsPerCell);
-      }
+          // check if it is a mirror cell, if so, get original
+          if (j >= this->NumberOfCells + this->CellOffset)
+          {
+            size_t origCellNum = *(this->CellMap + (j - this->NumberOfCells - this->CellOffset));
+            connections = this->OrigConnections + (origCellNum * this->PointsPerCell);
+          }
+          else
+          {
+            connections = this->OrigConnections + (j * this->PointsPerCell);
+          }
 
-      minLevel = this->MaximumLevelPoint[connections[0]];
+          minLevel = this->MaximumLevelPoint[connections[0]];
 
-      // Take the min of the this->MaximumLevelPoint of each point
-      for (size_t k = 1; k < this->PointsPerCell; k++)
-      {
-        minLevel = std::min(minLevel, this->MaximumLevelPoint[connections[k]]);
-      }
-    }
+          // Take the min of the this->MaximumLevelPoint of each point
+          for (size_t k = 1; k < this->PointsPerCell; k++)
+          {
+            minLevel = std::min(minLevel, this->MaximumLevelPoint[connections[k]]);
+          }
+        }
 
-    // singlelayer
-    if (!this->ShowMultilayerView)
-    {
-      // If that min is greater than or equal to this output level,
-      // include the cell, otherwise set all points to zero.
+        vtkIdType* polygon = polygons + j * cellsPerColumn * pointsPerPolygon;
 
-      if (this->IncludeTopography && ((minLevel - 1) < this->GetVerticalLevel()))
-      {
-        // cerr << "Setting all points to zero" << endl;
-        val = 0;
-        for (size_t k = 0; k < this->PointsPerCell; k++)
-        {
-          polygon[k] = static_cast<vtkIdType>(val);
-        }
-      }
-      else
-      {
-        for (size_t k = 0; k < this->PointsPerCell; k++)
-        {
-          polygon[k] = conns[k];
-        }
-      }
-      output->InsertNextCell(cellType, static_cast<vtkIdType>(pointsPerPolygon), polygon.data());
-    }
-    else
-    { // multilayer
-      // for each level, write the cell
-      for (size_t levelNum = 0; levelNum < this->MaximumNVertLevels; levelNum++)
-      {
-        if (this->IncludeTopography && (static_cast<size_t>(minLevel - 1) < levelNum))
+        // singlelayer
+        if (!this->ShowMultilayerView)
         {
-          // setting all points to zero
-          val = 0;
-          for (size_t k = 0; k < pointsPerPolygon; k++)
+          // If that min is greater than or equal to this output level,
+          // include the cell, otherwise set all points to zero.
+          if (this->IncludeTopography && ((minLevel - 1) < verticalLevel))
+          {
+            std::fill(polygon, polygon + this->PointsPerCell, 0);
+          }
+          else
           {
-            polygon[k] = static_cast<vtkIdType>(val);
+            std::copy(conns, conns + this->PointsPerCell, polygon);
           }
+          continue;
         }
-        else
+
+        // multilayer: for each level, write the cell
+        for (size_t levelNum = 0; levelNum < this->MaximumNVertLevels;
+             levelNum++, polygon += pointsPerPolygon)
         {
-          for (size_t k = 0; k < this->PointsPerCell; k++)
+          if (this->IncludeTopography && (static_cast<size_t>(minLevel - 1) < levelNum))
           {
-            val = (conns[k] * (this->MaximumNVertLevels + 1)) + levelNum;
-            polygon[k] = static_cast<vtkIdType>(val);
+            // setting all points to zero
+            std::fill(polygon, polygon + pointsPerPolygon, 0);
           }
-
-          for (size_t k = 0; k < this->PointsPerCell; k++)
+          else
           {
-            val = (conns[k] * (this->MaximumNVertLevels + 1)) + levelNum + 1;
-            polygon[k + this->PointsPerCell] = static_cast<vtkIdType>(val);
+            for (size_t k = 0; k < this->PointsPerCell; k++)
+            {
+              size_t val = (conns[k] * (this->MaximumNVertLevels + 1)) + levelNum;
+              polygon[k] = static_cast<vtkIdType>(val);
+              polygon[k + this->PointsPerCell] = static_cast<vtkIdType>(val + 1);
+            }
           }
         }
-        // vtkDebugMacro
-        //("InsertingCell j: " << j << " level: " << levelNum << endl);
-        output->InsertNextCell(cellType, static_cast<vtkIdType>(pointsPerPolygon), polygon.data());
       }
-    }
-  }
+    });
+
+  vtkNew<vtkCellArray> cells;
+  cells->SetData(static_cast<vtkIdType>(pointsPerPolygon), connectivity);
+  output->SetCells(cellType, cells);
 
   delete[] this->ModConnections;
   this->ModConnections = nullptr;
@@ -4,8 +4,10 @@
 
 #include "vtkNetCDFReader.h"
 
+#include "vtkArrayDispatch.h"
 #include "vtkCallbackCommand.h"
 #include "vtkCellData.h"
+#include "vtkDataArrayRange.h"
 #include "vtkDataArraySelection.h"
 #include "vtkDoubleArray.h"
 #include "vtkImageData.h"
@@ -16,6 +18,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
 #include "vtkStructuredGrid.h"
@@ -93,6 +96,36 @@ static int NetCDFTypeToVTKType(nc_type type)
   }
 }
 
+//=============================================================================
+// Replace the fill value of a variable with NaN.
+template <typename T>
+static void ReplaceFillValue(T* values, vtkIdType numberOfValues, T fillValue)
+{
+  vtkSMPTools::For(0, numberOfValues,
+    [&](vtkIdType begin, vtkIdType end)
+    { std::replace(values + begin, values + end, fillValue, static_cast<T>(vtkMath::Nan())); });
+}
+
+//=============================================================================
+// Apply the scale_factor and add_offset attributes of a variable.
+struct ScaleAndOffsetWorker
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* array, vtkDoubleArray* adjusted, double scale, double offset)
+  {
+    const auto values = vtk::DataArrayValueRange<1>(array);
+    double* adjustedValues = adjusted->GetPointer(0);
+    vtkSMPTools::For(0, array->GetNumberOfValues(),
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          adjustedValues[i] = static_cast<double>(values[i]) * scale + offset;
+        }
+      });
+  }
+};
+
 //=============================================================================
 vtkStandardNewMacro(vtkNetCDFReader);
 
@@ -876,17 +909,15 @@ int vtkNetCDFReader::LoadVariable(int ncFD, const char* varName, double time, vt
       {
         float fillValue;
         nc_get_att_float(ncFD, varId, "_FillValue", &fillValue);
-        std::replace(reinterpret_cast<float*>(dataArray->GetVoidPointer(0)),
-          reinterpret_cast<float*>(dataArray->GetVoidPointer(dataArray->GetNumberOfTuples())),
-          fillValue, static_cast<float>(vtkMath::Nan()));
+        ReplaceFillValue(
+          static_cast<float*>(dataArray->GetVoidPointer(0)), arraySize, fillValue);
       }
       else if (dataArray->GetDataType() == VTK_DOUBLE)
       {
         double fillValue;
         nc_get_att_double(ncFD, varId, "_FillValue", &fillValue);
-        std::replace(reinterpret_cast<double*>(dataArray->GetVoidPointer(0)),
-          reinterpret_cast<double*>(dataArray->GetVoidPointer(dataArray->GetNumberOfTuples())),
-          fillValue, vtkMath::Nan());
+        ReplaceFillValue(
+          static_cast<double*>(dataArray->GetVoidPointer(0)), arraySize, fillValue);
       }
       else
       {
@@ -913,9 +944,11 @@ int vtkNetCDFReader::LoadVariable(int ncFD, const char* varName, double time, vt
     VTK_CREATE(vtkDoubleArray, adjustedArray);
     adjustedArray->SetNumberOfComponents(1);
     adjustedArray->SetNumberOfTuples(arraySize);
-    for (vtkIdType i = 0; i < arraySize; i++)
+    ScaleAndOffsetWorker worker;
+    if (!vtkArrayDispatch::Dispatch::Execute(
+          dataArray.GetPointer(), worker, adjustedArray.GetPointer(), scale, offset))
     {
-      adjustedArray->SetValue(i, dataArray->GetTuple1(i) * scale + offset);
+      worker(dataArray.GetPointer(), adjustedArray.GetPointer(), scale, offset);
     }
     dataArray = adjustedArray;
   }
@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Write an image with vtkOpenVDBWriter, read it back as a sparse image volume
+// and check that each leaf image has the values of the written image.
+
+#include "vtkDataArray.h"
+#include "vtkFloatArray.h"
+#include "vtkImageData.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkOpenVDBReader.h"
+#include "vtkOpenVDBWriter.h"
+#include "vtkPartitionedDataSet.h"
+#include "vtkPartitionedDataSetCollection.h"
+#include "vtkPointData.h"
+#include "vtkTestUtilities.h"
+
+#include <cstdlib>
+#include <string>
+
+int TestOpenVDBReaderSparse(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string fileName = std::string(tempDir) + "/TestOpenVDBReaderSparse.vdb";
+  delete[] tempDir;
+
+  // the 20x20x20 voxels span 3x3x3 leaf nodes of 8x8x8 voxels
+  const int n = 20;
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(n, n, n);
+  vtkNew<vtkFloatArray> values;
+  values->SetName("values");
+  values->SetNumberOfValues(image->GetNumberOfPoints());
+  for (vtkIdType i = 0; i < image->GetNumberOfPoints(); ++i)
+  {
+    values->SetValue(i, static_cast<float>(i + 1));
+  }
+  image->GetPointData()->AddArray(values);
+
+  vtkNew<vtkOpenVDBWriter> writer;
+  writer->SetFileName(fileName.c_str());
+  writer->SetInputData(image);
+  writer->Write();
+
+  vtkNew<vtkOpenVDBReader> reader;
+  reader->SetFileName(fileName.c_str());
+  reader->SparseImageVolumesOn();
+  reader->Update();
+
+  vtkPartitionedDataSetCollection* output =
+    vtkPartitionedDataSetCollection::SafeDownCast(reader->GetOutputDataObject(0));
+  if (!output || output->GetNumberOfPartitionedDataSets() != 1 ||
+    output->GetNumberOfPartitions(0) != 27)
+  {
+    vtkLog(ERROR, "Expected one grid with 27 leaf images");
+    return EXIT_FAILURE;
+  }
+
+  for (unsigned int partition = 0; partition < 27; ++partition)
+  {
+    vtkImageData* leaf = vtkImageData::SafeDownCast(output->GetPartition(0, partition));
+    vtkDataArray* leafValues = leaf ? leaf->GetPointData()->GetArray(0) : nullptr;
+    if (!leafValues || leaf->GetNumberOfPoints() != 9 * 9 * 9)
+    {
+      vtkLog(ERROR, "Wrong leaf image " << partition);
+      return EXIT_FAILURE;
+    }
+    const int* extent = leaf->GetExtent();
+    for (int k = extent[4]; k <= extent[5]; ++k)
+    {
+      for (int j = extent[2]; j <= extent[3]; ++j)
+      {
+        for (int i = extent[0]; i <= extent[1]; ++i)
+        {
+          // voxels outside of the image have the background value
+          int ijk[3] = { i, j, k };
+          const double expected =
+            (i < n && j < n && k < n) ? values->GetValue(image->ComputePointId(ijk)) : 0.0;
+          if (leafValues->GetTuple1(leaf->ComputePointId(ijk)) != expected)
+          {
+            vtkLog(ERROR, "Wrong value at " << i << " " << j << " " << k);
+            return EXIT_FAILURE;
+          }
+        }
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
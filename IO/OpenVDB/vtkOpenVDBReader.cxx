@@ -343,6 +343,120 @@ struct PopulateImageDataArray
   }
 };
 
+//------------------------------------------------------------------------
+// functor to fill a vtkPartitionedDataSet with one vtkImageData per leaf node
+// and per active tile of a grid, so that the sparsity of the grid is kept.
+struct PopulateSparseImageData
+{
+  // partitioned dataset to fill
+  vtkPartitionedDataSet* partitions = nullptr;
+  // information about the grid
+  const OpenVDBGridInformation* gridInfo = nullptr;
+
+  // grid is the OpenVDB grid to sample, the vtk arrays are created per image
+  template <vtkIdType NComps, typename GridType, typename ArrayType>
+  void operator()(typename GridType::Ptr grid, ArrayType* vtkNotUsed(dataArray))
+  {
+    if (grid == nullptr || partitions == nullptr || gridInfo == nullptr)
+    {
+      return;
+    }
+
+    using TreeType = typename GridType::TreeType;
+    const int leafDim = TreeType::LeafNodeType::DIM;
+
+    std::vector<openvdb::Coord> leafOrigins;
+    for (auto leafIter = grid->tree().cbeginLeaf(); leafIter; ++leafIter)
+    {
+      leafOrigins.emplace_back(leafIter->origin());
+    }
+    // only visit the active tiles of the upper nodes, not the voxels of the leaves
+    std::vector<openvdb::CoordBBox> tiles;
+    auto tileIter = grid->tree().cbeginValueOn();
+    tileIter.setMaxDepth(tileIter.getLeafDepth() - 1);
+    for (; tileIter; ++tileIter)
+    {
+      openvdb::CoordBBox bbox;
+      tileIter.getBoundingBox(bbox);
+      tiles.emplace_back(bbox);
+    }
+
+    const vtkIdType numLeaves = static_cast<vtkIdType>(leafOrigins.size());
+    partitions->SetNumberOfPartitions(static_cast<unsigned int>(numLeaves + tiles.size()));
+
+    // all leaf images are expressed in the index space of the grid
+    const openvdb::Vec3d origin = grid->indexToWorld(openvdb::Coord(0, 0, 0));
+    std::vector<ArrayType*> leafArrays(numLeaves);
+    for (vtkIdType leafIdx = 0; leafIdx < numLeaves; ++leafIdx)
+    {
+      const openvdb::Coord& leafOrigin = leafOrigins[leafIdx];
+      vtkNew<vtkImageData> imgData;
+      imgData->SetOrigin(origin[0], origin[1], origin[2]);
+      imgData->SetSpacing(gridInfo->Spacing);
+      imgData->SetExtent(leafOrigin[0], leafOrigin[0] + leafDim, leafOrigin[1],
+        leafOrigin[1] + leafDim, leafOrigin[2], leafOrigin[2] + leafDim);
+
+      vtkNew<ArrayType> leafArray;
+      leafArray->SetName(gridInfo->Name.c_str());
+      leafArray->SetNumberOfComponents(NComps);
+      leafArray->SetNumberOfTuples(imgData->GetNumberOfPoints());
+      imgData->GetPointData()->AddArray(leafArray);
+      leafArrays[leafIdx] = leafArray;
+
+      partitions->SetPartition(static_cast<unsigned int>(leafIdx), imgData);
+    }
+
+    // the last layer of points of a leaf is sampled in the neighbor leaves
+    vtkSMPTools::For(0, numLeaves, [&](vtkIdType leafIdx, vtkIdType endLeafIdx) {
+      typename GridType::Accessor accessor = grid->getAccessor();
+      for (; leafIdx < endLeafIdx; ++leafIdx)
+      {
+        const openvdb::Coord& leafOrigin = leafOrigins[leafIdx];
+        vtkIdType idx = 0;
+        for (int k = 0; k <= leafDim; ++k)
+        {
+          for (int j = 0; j <= leafDim; ++j)
+          {
+            for (int i = 0; i <= leafDim; ++i, ++idx)
+            {
+              const openvdb::Coord ijk = leafOrigin.offsetBy(i, j, k);
+              ::SamplerVdbGrid<NComps, GridType, ArrayType>::SampleVdbGrid(
+                ijk, accessor, leafArrays[leafIdx], idx);
+            }
+          }
+        }
+      }
+    });
+
+    // an active tile has a constant value over its bounding box
+    typename GridType::Accessor accessor = grid->getAccessor();
+    unsigned int partitionIdx = static_cast<unsigned int>(numLeaves);
+    for (const openvdb::CoordBBox& tile : tiles)
+    {
+      const openvdb::Vec3d tileOrigin = grid->indexToWorld(tile.min());
+      const openvdb::Coord tileDim = tile.dim();
+      vtkNew<vtkImageData> imgData;
+      imgData->SetDimensions(2, 2, 2);
+      imgData->SetOrigin(tileOrigin[0], tileOrigin[1], tileOrigin[2]);
+      imgData->SetSpacing(gridInfo->Spacing[0] * tileDim[0], gridInfo->Spacing[1] * tileDim[1],
+        gridInfo->Spacing[2] * tileDim[2]);
+
+      vtkNew<ArrayType> tileArray;
+      tileArray->SetName(gridInfo->Name.c_str());
+      tileArray->SetNumberOfComponents(NComps);
+      tileArray->SetNumberOfTuples(8);
+      for (vtkIdType idx = 0; idx < 8; ++idx)
+      {
+        ::SamplerVdbGrid<NComps, GridType, ArrayType>::SampleVdbGrid(
+          tile.min(), accessor, tileArray, idx);
+      }
+      imgData->GetPointData()->AddArray(tileArray);
+
+      partitions->SetPartition(partitionIdx++, imgData);
+    }
+  }
+};
+
 //------------------------------------------------------------------------
 vtkSmartPointer<vtkDataArray> InstanciateVtkArrayType(openvdb::GridBase::Ptr grid)
 {
@@ -974,8 +1088,14 @@ int vtkOpenVDBReader::RequestData(vtkInformation* vtkNotUsed(request),
   // now we construct the vtkResDataLeafInformation
   std::vector<vtkResDataLeafInformation> imgDatasetsInfo;
   std::vector<vtkResDataLeafInformation> pointsDatasetsInfo;
+  // sparse image grids are not merged nor downsampled
+  std::vector<unsigned int> sparseGridsImage;
 
-  if (!reqGridsImage.empty())
+  if (!reqGridsImage.empty() && this->SparseImageVolumes)
+  {
+    sparseGridsImage = reqGridsImage;
+  }
+  else if (!reqGridsImage.empty())
   {
     // if we merge the image grids, there is only one vtkImageData,
     // with every requested grid inside
@@ -1051,16 +1171,28 @@ int vtkOpenVDBReader::RequestData(vtkInformation* vtkNotUsed(request),
     }
   }
 
-  // one block per vtkResDataLeafInformation
-  output->SetNumberOfPartitionedDataSets(imgDatasetsInfo.size() + pointsDatasetsInfo.size());
+  // one block per sparse image grid and per vtkResDataLeafInformation
+  output->SetNumberOfPartitionedDataSets(
+    sparseGridsImage.size() + imgDatasetsInfo.size() + pointsDatasetsInfo.size());
   for (unsigned int blockidx = 0; blockidx < output->GetNumberOfPartitionedDataSets(); blockidx++)
   {
     output->SetNumberOfPartitions(blockidx, 1);
   }
 
   int leafIdx = 0;
-  int numberImages = imgDatasetsInfo.size();
-  // images first, points after
+  int numberSparseImages = sparseGridsImage.size();
+  int numberImages = numberSparseImages + imgDatasetsInfo.size();
+  // sparse images first, then images, points after
+  for (const unsigned int& gridIdx : sparseGridsImage)
+  {
+    OpenVDBGridInformation& gridInfo = this->Internals->GetGridInformation(gridIdx);
+    PopulateSparseImageData populateSparse;
+    populateSparse.partitions = output->GetPartitionedDataSet(leafIdx);
+    populateSparse.gridInfo = &gridInfo;
+    ::processTypedGridArray(gridInfo.Grid, nullptr, populateSparse);
+    leafIdx++;
+  }
+
   for (const auto& imgDataInfo : imgDatasetsInfo)
   {
     vtkNew<vtkImageData> imgData;
@@ -1123,7 +1255,7 @@ int vtkOpenVDBReader::RequestData(vtkInformation* vtkNotUsed(request),
 
   // now we populate the different datasets
   // first the image datas
-  int imgdataIdx = 0;
+  int imgdataIdx = numberSparseImages;
   for (const auto& imgDataInfo : imgDatasetsInfo)
   {
     vtkImageData* imagedata = vtkImageData::SafeDownCast(output->GetPartition(imgdataIdx, 0));
@@ -1247,6 +1379,7 @@ void vtkOpenVDBReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "DownsamplingFactor: " << this->DownsamplingFactor << endl;
   os << indent << "MergeImageVolumes: " << this->MergeImageVolumes << endl;
   os << indent << "MergePointSets: " << this->MergePointSets << endl;
+  os << indent << "SparseImageVolumes: " << this->SparseImageVolumes << endl;
   this->GridSelection->PrintSelf(os, indent.GetNextIndent());
 }
 VTK_ABI_NAMESPACE_END
@@ -10,6 +10,8 @@
  * It is also possible to merge all image volumes into a single vtkImageData, and independently
  * merge all point clouds into a single vtkPolyData (cf vtkOpenVDBReader::SetMergeImageVolumes
  * and vtkOpenVDBReader::SetMergePointSets).
+ * Image volumes can also be read as sparse volumes, with one vtkImageData per leaf node of the
+ * grid (cf vtkOpenVDBReader::SetSparseImageVolumes).
  */
 
 #ifndef vtkOpenVDBReader_h
@@ -82,6 +84,25 @@ public:
   vtkBooleanMacro(MergeImageVolumes, bool);
   ///@}
 
+  ///@{
+  /**
+   * When enabled, the reader keeps the sparsity of the image volume grids: each requested
+   * image grid gives one vtkPartitionedDataSet with one vtkImageData per leaf node of the
+   * grid, and one per active tile of the upper nodes of the grid.
+   * A leaf node image has the points of the 8x8x8 voxels of the leaf, plus the next layer of
+   * voxels along each axis, so that contours and slices of adjacent leaves match. Its extent
+   * is the index space range of these voxels, so all the leaf images of a grid share the same
+   * origin and spacing. An active tile is a constant image with 2x2x2 points spanning the tile.
+   * The memory used is then proportional to the number of leaf nodes instead of the volume of
+   * the bounding box of the grid, which is much smaller for narrow-band level sets.
+   * DownsamplingFactor and MergeImageVolumes are not used for sparse image volumes.
+   * It is disabled by default.
+   */
+  vtkSetMacro(SparseImageVolumes, bool);
+  vtkGetMacro(SparseImageVolumes, bool);
+  vtkBooleanMacro(SparseImageVolumes, bool);
+  ///@}
+
   ///@{
   /**
    * When enabled, the reader will all the requested points cloud grids into a
@@ -141,6 +162,7 @@ protected:
 
   bool MergeImageVolumes = false;
   bool MergePointSets = false;
+  bool SparseImageVolumes = false;
 
   bool DataCorrect = true;
 
@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Write polydata with more vertices than are read in one chunk, with normals
+// and colors, in big and little endian binary and in ASCII PLY, and check
+// that vtkPLYReader reads back the same vertices and faces.
+
+#include "vtkCellArray.h"
+#include "vtkFloatArray.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPLYReader.h"
+#include "vtkPLYWriter.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkTestUtilities.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <cstdlib>
+#include <initializer_list>
+#include <string>
+
+int TestPLYReaderBinaryVertices(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string fileName = std::string(tempDir) + "/TestPLYReaderBinaryVertices.ply";
+  delete[] tempDir;
+
+  const vtkIdType numPoints = 100000;
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(numPoints);
+  vtkNew<vtkFloatArray> normals;
+  normals->SetName("Normals");
+  normals->SetNumberOfComponents(3);
+  normals->SetNumberOfTuples(numPoints);
+  vtkNew<vtkUnsignedCharArray> colors;
+  colors->SetName("Colors");
+  colors->SetNumberOfComponents(3);
+  colors->SetNumberOfTuples(numPoints);
+  vtkNew<vtkCellArray> polys;
+  unsigned int seed = 12345;
+  for (vtkIdType i = 0; i < numPoints; ++i)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    points->SetPoint(i, (seed >> 20) / 8.0, -0.5 * i, (seed >> 8) % 1000 / 64.0);
+    normals->SetTuple3(i, (seed >> 24) / 256.0, -1.0, 0.25);
+    colors->SetTuple3(i, seed >> 24, (seed >> 16) & 255, i % 256);
+    if (i + 2 < numPoints && i % 3 == 0)
+    {
+      const vtkIdType triangle[3] = { i, i + 1, i + 2 };
+      polys->InsertNextCell(3, triangle);
+    }
+  }
+  vtkNew<vtkPolyData> polyData;
+  polyData->SetPoints(points);
+  polyData->SetPolys(polys);
+  polyData->GetPointData()->SetNormals(normals);
+  polyData->GetPointData()->AddArray(colors);
+
+  for (int mode : { 0, 1, 2 })
+  {
+    vtkNew<vtkPLYWriter> writer;
+    writer->SetInputData(polyData);
+    writer->SetFileName(fileName.c_str());
+    writer->SetArrayName("Colors");
+    if (mode == 0)
+    {
+      writer->SetFileTypeToASCII();
+    }
+    else
+    {
+      writer->SetFileTypeToBinary();
+      writer->SetDataByteOrder(mode == 1 ? VTK_LITTLE_ENDIAN : VTK_BIG_ENDIAN);
+    }
+    writer->Write();
+
+    vtkNew<vtkPLYReader> reader;
+    reader->SetFileName(fileName.c_str());
+    reader->Update();
+    vtkPolyData* output = reader->GetOutput();
+    vtkDataArray* outNormals = output->GetPointData()->GetNormals();
+    vtkDataArray* outColors = output->GetPointData()->GetArray("RGB");
+    if (output->GetNumberOfPoints() != numPoints ||
+      output->GetNumberOfPolys() != polys->GetNumberOfCells() || !outNormals || !outColors)
+    {
+      vtkLog(ERROR,
+        "Read " << output->GetNumberOfPoints() << " points and " << output->GetNumberOfPolys()
+                << " polygons in mode " << mode);
+      return EXIT_FAILURE;
+    }
+    for (vtkIdType i = 0; i < numPoints; ++i)
+    {
+      double x[3], y[3];
+      output->GetPoint(i, x);
+      points->GetPoint(i, y);
+      for (int k = 0; k < 3; ++k)
+      {
+        if (x[k] != y[k] || outNormals->GetComponent(i, k) != normals->GetComponent(i, k) ||
+          outColors->GetComponent(i, k) != colors->GetComponent(i, k))
+        {
+          vtkLog(ERROR, "Wrong vertex " << i << " in mode " << mode);
+          return EXIT_FAILURE;
+        }
+      }
+    }
+    for (vtkIdType c = 0; c < polys->GetNumberOfCells(); ++c)
+    {
+      vtkIdType npts, outNpts;
+      const vtkIdType* pts;
+      const vtkIdType* outPts;
+      polys->GetCellAtId(c, npts, pts);
+      output->GetPolys()->GetCellAtId(c, outNpts, outPts);
+      if (outNpts != npts || outPts[0] != pts[0] || outPts[1] != pts[1] || outPts[2] != pts[2])
+      {
+        vtkLog(ERROR, "Wrong face " << c << " in mode " << mode);
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
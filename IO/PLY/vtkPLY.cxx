@@ -31,6 +31,7 @@ chars representing red, green and blue.
 #include "vtkFileResourceStream.h"
 #include "vtkMemoryResourceStream.h"
 #include "vtkResourceParser.h"
+#include "vtkSMPTools.h"
 
 #include <cassert>
 #include <cstddef>
@@ -76,7 +77,7 @@ void* plyAllocateMemory(size_t n)
 const char* type_names[] = { "invalid", "char", "short", "int", "int8", "int16", "int32", "uchar",
   "ushort", "uint", "uint8", "uint16", "uint32", "float", "float32", "double", "float64" };
 
-const int ply_type_size[] = { 0, 1, 2, 4, 1, 2, 4, 1, 2, 4, 1, 2, 4, 4, 4, 8 };
+const int ply_type_size[] = { 0, 1, 2, 4, 1, 2, 4, 1, 2, 4, 1, 2, 4, 4, 4, 8, 8 };
 }
 
 #define NO_OTHER_PROPS (-1)
@@ -988,6 +989,33 @@ void vtkPLY::ply_get_element(PlyFile* plyfile, void* elem_ptr)
     binary_get_element(plyfile, (char*)elem_ptr);
 }
 
+/******************************************************************************
+Read several consecutive elements from the file.  This routine assumes that
+we're reading the type of element specified in the last call to the routine
+ply_get_element_setup().  Binary elements without list properties are read
+in one block and decoded in parallel.
+
+Entry:
+  plyfile   - file identifier
+  elem_ptrs - pointer to an array of num_elems element structures
+  num_elems - number of elements to read
+  elem_size - size of an element structure
+******************************************************************************/
+
+void vtkPLY::ply_get_elements(PlyFile* plyfile, void* elem_ptrs, int num_elems, int elem_size)
+{
+  char* elem_ptr = (char*)elem_ptrs;
+  if (plyfile->file_type != PLY_ASCII &&
+    binary_get_elements(plyfile, elem_ptr, num_elems, elem_size))
+  {
+    return;
+  }
+  for (int i = 0; i < num_elems; i++)
+  {
+    ply_get_element(plyfile, elem_ptr + static_cast<std::size_t>(i) * elem_size);
+  }
+}
+
 /******************************************************************************
 Extract the comments from the header information of a PLY file.
 
@@ -1706,6 +1734,75 @@ bool vtkPLY::binary_get_element(PlyFile* plyfile, char* elem_ptr)
   return true;
 }
 
+/******************************************************************************
+Read several elements from a binary PLY file in one block, and decode them in
+parallel.  Only elements with a fixed size, i.e. without list properties and
+other properties, are read this way.
+
+Entry:
+  plyfile   - file identifier
+  elem_ptrs - pointer to an array of num_elems element structures
+  num_elems - number of elements to read
+  elem_size - size of an element structure
+
+Exit:
+  returns false if the elements have to be read one by one
+******************************************************************************/
+
+bool vtkPLY::binary_get_elements(PlyFile* plyfile, char* elem_ptrs, int num_elems, int elem_size)
+{
+  PlyElement* elem = plyfile->which_elem;
+  if (elem->other_offset != NO_OTHER_PROPS)
+  {
+    return false;
+  }
+
+  /* offsets of the properties in an element of the file */
+  std::vector<std::size_t> offsets(elem->nprops);
+  std::size_t record_size = 0;
+  for (int j = 0; j < elem->nprops; j++)
+  {
+    PlyProperty* prop = elem->props[j];
+    if (prop->is_list || prop->external_type <= PLY_START_TYPE ||
+      prop->external_type >= PLY_END_TYPE)
+    {
+      return false;
+    }
+    offsets[j] = record_size;
+    record_size += ply_type_size[prop->external_type];
+  }
+
+  std::vector<char> buffer(record_size * num_elems);
+  if (plyfile->parser->Read(buffer.data(), buffer.size()) != buffer.size())
+  {
+    vtkGenericWarningMacro("PLY error reading file."
+      << " Premature EOF while reading elements.");
+    return true;
+  }
+
+  vtkSMPTools::For(0, num_elems, [&](vtkIdType begin, vtkIdType end) {
+    int int_val;
+    unsigned int uint_val;
+    double double_val;
+    for (vtkIdType i = begin; i < end; i++)
+    {
+      const char* record = buffer.data() + i * record_size;
+      char* elem_ptr = elem_ptrs + i * elem_size;
+      for (int j = 0; j < elem->nprops; j++)
+      {
+        if (elem->store_prop[j])
+        {
+          PlyProperty* prop = elem->props[j];
+          get_binary_stored_item(record + offsets[j], prop->external_type, plyfile->file_type,
+            &int_val, &uint_val, &double_val);
+          store_item(elem_ptr + prop->offset, prop->internal_type, int_val, uint_val, double_val);
+        }
+      }
+    }
+  });
+  return true;
+}
+
 /******************************************************************************
 Write to a file the word that represents a PLY data type.
 
@@ -2230,6 +2327,43 @@ Exit:
 
 bool vtkPLY::get_binary_item(
   PlyFile* plyfile, int type, int* int_val, unsigned int* uint_val, double* double_val)
+{
+  if (type <= PLY_START_TYPE || type >= PLY_END_TYPE)
+  {
+    fprintf(stderr, "get_binary_item: bad type = %d\n", type);
+    assert(0);
+    return false;
+  }
+
+  char buffer[8];
+  const std::size_t size = ply_type_size[type];
+  if (plyfile->parser->Read(buffer, size) != size)
+  {
+    vtkGenericWarningMacro("PLY error reading file."
+      << " Premature EOF while reading " << type_names[type] << ".");
+    return false;
+  }
+  get_binary_stored_item(buffer, type, plyfile->file_type, int_val, uint_val, double_val);
+  return true;
+}
+
+/******************************************************************************
+Get the value of an item stored in memory as in a binary file, and place the
+result into an integer, an unsigned integer and a double.
+
+Entry:
+  ptr       - pointer to the item
+  type      - data type of the item
+  file_type - PLY_BINARY_BE or PLY_BINARY_LE
+
+Exit:
+  int_val    - integer value
+  uint_val   - unsigned integer value
+  double_val - double-precision floating point value
+******************************************************************************/
+
+void vtkPLY::get_binary_stored_item(const char* ptr, int type, int file_type, int* int_val,
+  unsigned int* uint_val, double* double_val)
 {
   switch (type)
   {
@@ -2237,12 +2371,7 @@ bool vtkPLY::get_binary_item(
     case PLY_INT8:
     {
       vtkTypeInt8 value = 0;
-      if (plyfile->parser->Read(reinterpret_cast<char*>(&value), sizeof(value)) != sizeof(value))
-      {
-        vtkGenericWarningMacro("PLY error reading file."
-          << " Premature EOF while reading char.");
-        return false;
-      }
+      memcpy(&value, ptr, sizeof(value));
 
       // Here value can always fit in int, unsigned int, and double.
       *int_val = static_cast<int>(value);
@@ -2254,12 +2383,7 @@ bool vtkPLY::get_binary_item(
     case PLY_UINT8:
     {
       vtkTypeUInt8 value = 0;
-      if (plyfile->parser->Read(reinterpret_cast<char*>(&value), sizeof(value)) != sizeof(value))
-      {
-        vtkGenericWarningMacro("PLY error reading file."
-          << " Premature EOF while reading uchar or uint8.");
-        return false;
-      }
+      memcpy(&value, ptr, sizeof(value));
 
       // Here value can always fit in int, unsigned int, and double.
       *int_val = static_cast<int>(value);
@@ -2271,14 +2395,8 @@ bool vtkPLY::get_binary_item(
     case PLY_INT16:
     {
       vtkTypeInt16 value = 0;
-      if (plyfile->parser->Read(reinterpret_cast<char*>(&value), sizeof(value)) != sizeof(value))
-      {
-        vtkGenericWarningMacro("PLY error reading file."
-          << " Premature EOF while reading short.");
-        return false;
-      }
-      plyfile->file_type == PLY_BINARY_BE ? vtkByteSwap::Swap2BE(&value)
-                                          : vtkByteSwap::Swap2LE(&value);
+      memcpy(&value, ptr, sizeof(value));
+      file_type == PLY_BINARY_BE ? vtkByteSwap::Swap2BE(&value) : vtkByteSwap::Swap2LE(&value);
 
       // Here value can always fit in int, unsigned int, and double.
       *int_val = static_cast<int>(value);
@@ -2290,14 +2408,8 @@ bool vtkPLY::get_binary_item(
     case PLY_UINT16:
     {
       vtkTypeUInt16 value = 0;
-      if (plyfile->parser->Read(reinterpret_cast<char*>(&value), sizeof(value)) != sizeof(value))
-      {
-        vtkGenericWarningMacro("PLY error reading file."
-          << " Premature EOF while reading ushort.");
-        return false;
-      }
-      plyfile->file_type == PLY_BINARY_BE ? vtkByteSwap::Swap2BE(&value)
-                                          : vtkByteSwap::Swap2LE(&value);
+      memcpy(&value, ptr, sizeof(value));
+      file_type == PLY_BINARY_BE ? vtkByteSwap::Swap2BE(&value) : vtkByteSwap::Swap2LE(&value);
 
       // Here value can always fit in int, unsigned int, and double.
       *int_val = static_cast<int>(value);
@@ -2309,14 +2421,8 @@ bool vtkPLY::get_binary_item(
     case PLY_INT32:
     {
       vtkTypeInt32 value = 0;
-      if (plyfile->parser->Read(reinterpret_cast<char*>(&value), sizeof(value)) != sizeof(value))
-      {
-        vtkGenericWarningMacro("PLY error reading file."
-          << " Premature EOF while reading int or int32.");
-        return false;
-      }
-      plyfile->file_type == PLY_BINARY_BE ? vtkByteSwap::Swap4BE(&value)
-                                          : vtkByteSwap::Swap4LE(&value);
+      memcpy(&value, ptr, sizeof(value));
+      file_type == PLY_BINARY_BE ? vtkByteSwap::Swap4BE(&value) : vtkByteSwap::Swap4LE(&value);
 
       // Here value can always fit in int, unsigned int, and double.
       *int_val = static_cast<int>(value);
@@ -2328,14 +2434,8 @@ bool vtkPLY::get_binary_item(
     case PLY_UINT32:
     {
       vtkTypeUInt32 value = 0;
-      if (plyfile->parser->Read(reinterpret_cast<char*>(&value), sizeof(value)) != sizeof(value))
-      {
-        vtkGenericWarningMacro("PLY error reading file."
-          << " Premature EOF while reading uint");
-        return false;
-      }
-      plyfile->file_type == PLY_BINARY_BE ? vtkByteSwap::Swap4BE(&value)
-                                          : vtkByteSwap::Swap4LE(&value);
+      memcpy(&value, ptr, sizeof(value));
+      file_type == PLY_BINARY_BE ? vtkByteSwap::Swap4BE(&value) : vtkByteSwap::Swap4LE(&value);
 
       // Here value can always fit in int, unsigned int, and double.
       *int_val = static_cast<int>(value);
@@ -2347,14 +2447,8 @@ bool vtkPLY::get_binary_item(
     case PLY_FLOAT32:
     {
       vtkTypeFloat32 value = 0.0;
-      if (plyfile->parser->Read(reinterpret_cast<char*>(&value), sizeof(value)) != sizeof(value))
-      {
-        vtkGenericWarningMacro("PLY error reading file."
-          << " Premature EOF while reading float of float32.");
-        return false;
-      }
-      plyfile->file_type == PLY_BINARY_BE ? vtkByteSwap::Swap4BE(&value)
-                                          : vtkByteSwap::Swap4LE(&value);
+      memcpy(&value, ptr, sizeof(value));
+      file_type == PLY_BINARY_BE ? vtkByteSwap::Swap4BE(&value) : vtkByteSwap::Swap4LE(&value);
 
       // INT32_MIN (-2^31) is a power of 2 and thus exactly representable as float.
       // INT32_MAX (2^31 - 1) is not exactly representable as float; closest smaller integer is 2^31
@@ -2369,14 +2463,8 @@ bool vtkPLY::get_binary_item(
     case PLY_FLOAT64:
     {
       vtkTypeFloat64 value = 0.0;
-      if (plyfile->parser->Read(reinterpret_cast<char*>(&value), sizeof(value)) != sizeof(value))
-      {
-        vtkGenericWarningMacro("PLY error reading file."
-          << " Premature EOF while reading double.");
-        return false;
-      }
-      plyfile->file_type == PLY_BINARY_BE ? vtkByteSwap::Swap8BE(&value)
-                                          : vtkByteSwap::Swap8LE(&value);
+      memcpy(&value, ptr, sizeof(value));
+      file_type == PLY_BINARY_BE ? vtkByteSwap::Swap8BE(&value) : vtkByteSwap::Swap8LE(&value);
 
       // Here we can just clamp and cast, all int32s can be exactly represented as doubles.
       *int_val =
@@ -2387,11 +2475,9 @@ bool vtkPLY::get_binary_item(
     }
     break;
     default:
-      fprintf(stderr, "get_binary_item: bad type = %d\n", type);
+      fprintf(stderr, "get_binary_stored_item: bad type = %d\n", type);
       assert(0);
-      return false;
   }
-  return true;
 }
 
 /******************************************************************************
@@ -17,6 +17,7 @@
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkPolygon.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStringArray.h"
 #include "vtkUnsignedCharArray.h"
@@ -392,30 +393,40 @@ int vtkPLYReader::RequestData(vtkInformation* vtkNotUsed(request),
         rgbPoints->SetNumberOfTuples(numPts);
       }
 
-      plyVertex vertex;
-      for (int j = 0; j < numPts; j++)
+      // Read the vertices in chunks, binary vertices being decoded in parallel.
+      const int chunkSize = 1 << 16;
+      std::vector<plyVertex> vertices(std::min(std::max(numPts, 1), chunkSize));
+      for (int first = 0; first < numPts; first += chunkSize)
       {
-        vtkPLY::ply_get_element(ply, (void*)&vertex);
-        pts->SetPoint(j, vertex.x);
-        if (texCoordsPointsAvailable)
-        {
-          texCoordsPoints->SetTuple2(j, vertex.tex[0], vertex.tex[1]);
-        }
-        if (normalPointsAvailable)
-        {
-          normals->SetTuple3(j, vertex.normal[0], vertex.normal[1], vertex.normal[2]);
-        }
-        if (rgbPointsAvailable)
-        {
-          if (rgbPointsHaveAlpha)
+        const int count = std::min(numPts - first, chunkSize);
+        vtkPLY::ply_get_elements(ply, vertices.data(), count, static_cast<int>(sizeof(plyVertex)));
+        vtkSMPTools::For(0, count, [&](vtkIdType begin, vtkIdType end) {
+          for (vtkIdType k = begin; k < end; k++)
           {
-            rgbPoints->SetTuple4(j, vertex.red, vertex.green, vertex.blue, vertex.alpha);
-          }
-          else
-          {
-            rgbPoints->SetTuple3(j, vertex.red, vertex.green, vertex.blue);
+            const plyVertex& vertex = vertices[k];
+            const vtkIdType j = first + k;
+            pts->SetPoint(j, vertex.x);
+            if (texCoordsPointsAvailable)
+            {
+              texCoordsPoints->SetTuple2(j, vertex.tex[0], vertex.tex[1]);
+            }
+            if (normalPointsAvailable)
+            {
+              normals->SetTuple3(j, vertex.normal[0], vertex.normal[1], vertex.normal[2]);
+            }
+            if (rgbPointsAvailable)
+            {
+              if (rgbPointsHaveAlpha)
+              {
+                rgbPoints->SetTuple4(j, vertex.red, vertex.green, vertex.blue, vertex.alpha);
+              }
+              else
+              {
+                rgbPoints->SetTuple3(j, vertex.red, vertex.green, vertex.blue);
+              }
+            }
           }
-        }
+        });
       }
       output->SetPoints(pts);
       pts->Delete();
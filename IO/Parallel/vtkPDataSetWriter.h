@@ -33,7 +33,7 @@ public:
   /**
    * Write the pvtk file and corresponding vtk files.
    */
-  int Write() override;
+  VTK_UNBLOCKTHREADS int Write() override;
 
   ///@{
   /**
@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Write an unstructured grid per process with vtkXMLPUnstructuredGridWriter
+// aggregating the pieces in a few files, then check the files written and read
+// them back.
+
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+#include "vtkMPIController.h"
+#else
+#include "vtkDummyController.h"
+#endif
+
+#include "vtkCellData.h"
+#include "vtkIntArray.h"
+#include "vtkLogger.h"
+#include "vtkMultiProcessController.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkTestUtilities.h"
+#include "vtkUnstructuredGrid.h"
+#include "vtkXMLPUnstructuredGridReader.h"
+#include "vtkXMLPUnstructuredGridWriter.h"
+
+#include <vtksys/SystemTools.hxx>
+
+#include <cstdlib>
+#include <string>
+
+namespace
+{
+//------------------------------------------------------------------------------
+// A row of `rank + 1` hexahedra with the rank as cell data.
+vtkSmartPointer<vtkUnstructuredGrid> CreateGrid(int rank)
+{
+  auto grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  vtkNew<vtkPoints> points;
+  for (int i = 0; i <= rank + 1; ++i)
+  {
+    for (int corner = 0; corner < 4; ++corner)
+    {
+      points->InsertNextPoint(i, corner % 2, rank + corner / 2);
+    }
+  }
+  grid->SetPoints(points);
+  vtkNew<vtkIntArray> ranks;
+  ranks->SetName("rank");
+  for (int i = 0; i <= rank; ++i)
+  {
+    const vtkIdType hex[8] = { 4 * i, 4 * i + 4, 4 * i + 5, 4 * i + 1, 4 * i + 2, 4 * i + 6,
+      4 * i + 7, 4 * i + 3 };
+    grid->InsertNextCell(VTK_HEXAHEDRON, 8, hex);
+    ranks->InsertNextValue(rank);
+  }
+  grid->GetCellData()->AddArray(ranks);
+  return grid;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestParallelAggregatedUnstructuredGridIO(int argc, char* argv[])
+{
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+  vtkNew<vtkMPIController> contr;
+#else
+  vtkNew<vtkDummyController> contr;
+#endif
+  contr->Initialize(&argc, &argv);
+  vtkMultiProcessController::SetGlobalController(contr);
+  const int myId = contr->GetLocalProcessId();
+  const int numProcs = contr->GetNumberOfProcesses();
+  const int numAggregators = (numProcs + 1) / 2;
+
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string dir = std::string(tempDir) + "/aggregated";
+  delete[] tempDir;
+  const std::string fileName = dir + "/ug.pvtu";
+
+  vtkNew<vtkXMLPUnstructuredGridWriter> writer;
+  writer->SetController(contr);
+  writer->SetInputData(CreateGrid(myId));
+  writer->SetNumberOfPieces(numProcs);
+  writer->SetStartPiece(myId);
+  writer->SetEndPiece(myId);
+  writer->SetNumberOfAggregators(numAggregators);
+  writer->SetFileName(fileName.c_str());
+  writer->Write();
+  contr->Barrier();
+
+  int retVal = EXIT_SUCCESS;
+  if (myId == 0)
+  {
+    for (int piece = 0; piece < numProcs; ++piece)
+    {
+      const std::string pieceFileName = dir + "/ug_" + std::to_string(piece) + ".vtu";
+      if (vtksys::SystemTools::FileExists(pieceFileName) != (piece < numAggregators))
+      {
+        vtkLog(ERROR, "Unexpected piece file " << pieceFileName);
+        retVal = EXIT_FAILURE;
+      }
+    }
+
+    vtkNew<vtkXMLPUnstructuredGridReader> reader;
+    reader->SetFileName(fileName.c_str());
+    reader->Update();
+    vtkUnstructuredGrid* output = reader->GetOutput();
+    vtkDataArray* ranks = output->GetCellData()->GetArray("rank");
+    if (output->GetNumberOfCells() != numProcs * (numProcs + 1) / 2 || !ranks)
+    {
+      vtkLog(ERROR, "Wrong number of cells read: " << output->GetNumberOfCells());
+      retVal = EXIT_FAILURE;
+    }
+    else
+    {
+      // every process wrote rank + 1 cells
+      std::vector<int> counts(numProcs, 0);
+      for (vtkIdType cellId = 0; cellId < output->GetNumberOfCells(); ++cellId)
+      {
+        counts[static_cast<int>(ranks->GetTuple1(cellId))]++;
+      }
+      for (int rank = 0; rank < numProcs; ++rank)
+      {
+        if (counts[rank] != rank + 1)
+        {
+          vtkLog(ERROR, "Wrong number of cells from process " << rank << ": " << counts[rank]);
+          retVal = EXIT_FAILURE;
+        }
+      }
+    }
+  }
+
+  contr->Broadcast(&retVal, 1, 0);
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  contr->Finalize();
+  return retVal;
+}
@@ -2,15 +2,146 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkXMLPUnstructuredDataWriter.h"
 
+#include "vtkAlgorithm.h"
 #include "vtkErrorCode.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
+#include "vtkMultiProcessController.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
 #include "vtkPointSet.h"
+#include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkXMLUnstructuredDataWriter.h"
 
+#include <vtksys/SystemInformation.hxx>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr int AGGREGATION_GROUP_TAG = 33001;
+constexpr int AGGREGATION_PIECE_TAG = 33002;
+
 //------------------------------------------------------------------------------
+// Split the processes in groups, the processes of a group having the same host
+// when node-aware. The first process of a group writes its pieces.
+std::vector<std::vector<int>> ComputeAggregationGroups(
+  const std::vector<unsigned long long>& hosts, int numberOfAggregators)
+{
+  std::vector<std::vector<int>> nodes;
+  std::map<unsigned long long, size_t> nodeIndices;
+  for (int rank = 0; rank < static_cast<int>(hosts.size()); ++rank)
+  {
+    auto inserted = nodeIndices.emplace(hosts[rank], nodes.size());
+    if (inserted.second)
+    {
+      nodes.emplace_back();
+    }
+    nodes[inserted.first->second].push_back(rank);
+  }
+
+  std::vector<std::vector<int>> groups;
+  for (const auto& node : nodes)
+  {
+    const int size = static_cast<int>(node.size());
+    int count = static_cast<int>(
+      std::lround(static_cast<double>(numberOfAggregators) * size / hosts.size()));
+    count = std::max(1, std::min(count, size));
+    for (int group = 0; group < count; ++group)
+    {
+      groups.emplace_back(
+        node.begin() + size * group / count, node.begin() + size * (group + 1) / count);
+    }
+  }
+  return groups;
+}
+}
+
 VTK_ABI_NAMESPACE_BEGIN
+//------------------------------------------------------------------------------
+// Produces the pieces of a group of processes, one per piece request. Piece 0
+// is the local input, the other ones are received from the processes of the
+// group when they are requested.
+class vtkXMLPUnstructuredDataWriterAggregatedPieces : public vtkAlgorithm
+{
+public:
+  static vtkXMLPUnstructuredDataWriterAggregatedPieces* New();
+  vtkTypeMacro(vtkXMLPUnstructuredDataWriterAggregatedPieces, vtkAlgorithm);
+
+  vtkDataObject* LocalPiece = nullptr;
+  vtkMultiProcessController* Controller = nullptr;
+  std::vector<int> Group;
+
+  vtkTypeBool ProcessRequest(vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    if (request->Has(vtkDemandDrivenPipeline::REQUEST_DATA_OBJECT()))
+    {
+      auto output = vtk::TakeSmartPointer(this->LocalPiece->NewInstance());
+      outInfo->Set(vtkDataObject::DATA_OBJECT(), output);
+      return 1;
+    }
+    if (request->Has(vtkDemandDrivenPipeline::REQUEST_INFORMATION()))
+    {
+      outInfo->Set(vtkAlgorithm::CAN_HANDLE_PIECE_REQUEST(), 1);
+      return 1;
+    }
+    if (request->Has(vtkDemandDrivenPipeline::REQUEST_DATA()))
+    {
+      vtkDataObject* output = outInfo->Get(vtkDataObject::DATA_OBJECT());
+      const int piece = outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER());
+      if (piece == 0)
+      {
+        output->ShallowCopy(this->LocalPiece);
+      }
+      else if (piece != this->ReceivedPiece && piece < static_cast<int>(this->Group.size()))
+      {
+        // each remote piece is sent once, keep the last one in case it is requested again
+        auto remote = vtk::TakeSmartPointer(
+          this->Controller->ReceiveDataObject(this->Group[piece], AGGREGATION_PIECE_TAG));
+        this->ReceivedPiece = piece;
+        output->Initialize();
+        if (remote)
+        {
+          output->ShallowCopy(remote);
+        }
+      }
+      return 1;
+    }
+    return this->Superclass::ProcessRequest(request, inputVector, outputVector);
+  }
+
+protected:
+  vtkXMLPUnstructuredDataWriterAggregatedPieces()
+  {
+    this->SetNumberOfInputPorts(0);
+    this->SetNumberOfOutputPorts(1);
+  }
+  ~vtkXMLPUnstructuredDataWriterAggregatedPieces() override = default;
+
+  int FillOutputPortInformation(int, vtkInformation* info) override
+  {
+    info->Set(vtkDataObject::DATA_TYPE_NAME(), "vtkPointSet");
+    return 1;
+  }
+
+  int ReceivedPiece = 0;
+
+private:
+  vtkXMLPUnstructuredDataWriterAggregatedPieces(
+    const vtkXMLPUnstructuredDataWriterAggregatedPieces&) = delete;
+  void operator=(const vtkXMLPUnstructuredDataWriterAggregatedPieces&) = delete;
+};
+vtkStandardNewMacro(vtkXMLPUnstructuredDataWriterAggregatedPieces);
+
+//------------------------------------------------------------------------------
 vtkXMLPUnstructuredDataWriter::vtkXMLPUnstructuredDataWriter() = default;
 
 //------------------------------------------------------------------------------
@@ -20,6 +151,8 @@ vtkXMLPUnstructuredDataWriter::~vtkXMLPUnstructuredDataWriter() = default;
 void vtkXMLPUnstructuredDataWriter::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfAggregators: " << this->NumberOfAggregators << "\n";
+  os << indent << "NodeAwareAggregation: " << this->NodeAwareAggregation << "\n";
 }
 
 //------------------------------------------------------------------------------
@@ -32,6 +165,15 @@ vtkPointSet* vtkXMLPUnstructuredDataWriter::GetInputAsPointSet()
 vtkXMLWriter* vtkXMLPUnstructuredDataWriter::CreatePieceWriter(int index)
 {
   vtkXMLUnstructuredDataWriter* pWriter = this->CreateUnstructuredPieceWriter();
+  if (this->AggregatedPieces)
+  {
+    // write all the pieces of the group in the file
+    pWriter->SetInputConnection(this->AggregatedPieces->GetOutputPort());
+    pWriter->SetNumberOfPieces(this->NumberOfAggregatedPieces);
+    pWriter->SetWritePiece(-1);
+    pWriter->SetGhostLevel(0);
+    return pWriter;
+  }
   pWriter->SetNumberOfPieces(this->NumberOfPieces);
   pWriter->SetWritePiece(index);
   pWriter->SetGhostLevel(this->GhostLevel);
@@ -39,6 +181,104 @@ vtkXMLWriter* vtkXMLPUnstructuredDataWriter::CreatePieceWriter(int index)
   return pWriter;
 }
 
+//------------------------------------------------------------------------------
+int vtkXMLPUnstructuredDataWriter::WritePieceInternal()
+{
+  vtkMultiProcessController* controller = this->Controller;
+  if (this->NumberOfAggregators <= 0 || !controller)
+  {
+    return this->Superclass::WritePieceInternal();
+  }
+
+  // all the processes must agree on aggregating
+  const int numProcs = controller->GetNumberOfProcesses();
+  const int myId = controller->GetLocalProcessId();
+  int canAggregate = this->StartPiece == this->EndPiece && this->NumberOfPieces >= numProcs;
+  int allCanAggregate = canAggregate;
+  controller->AllReduce(&canAggregate, &allCanAggregate, 1, vtkCommunicator::MIN_OP);
+  if (!allCanAggregate)
+  {
+    if (myId == 0)
+    {
+      vtkWarningMacro("Aggregation requires each process to write a single piece, "
+                      "writing a file per process.");
+    }
+    return this->Superclass::WritePieceInternal();
+  }
+
+  // form the groups on the first process and send each process its group
+  unsigned long long host = 0;
+  if (this->NodeAwareAggregation)
+  {
+    vtksys::SystemInformation systemInfo;
+    host = std::hash<std::string>{}(systemInfo.GetHostname());
+  }
+  std::vector<unsigned long long> hosts(myId == 0 ? numProcs : 0);
+  controller->Gather(&host, hosts.data(), 1, 0);
+
+  std::vector<std::vector<int>> groups;
+  std::vector<int> assignments(myId == 0 ? 2 * numProcs : 0);
+  if (myId == 0)
+  {
+    groups = ::ComputeAggregationGroups(hosts, this->NumberOfAggregators);
+    for (int groupIdx = 0; groupIdx < static_cast<int>(groups.size()); ++groupIdx)
+    {
+      for (int rank : groups[groupIdx])
+      {
+        assignments[2 * rank] = groupIdx;
+        assignments[2 * rank + 1] = groups[groupIdx][0];
+      }
+    }
+  }
+  int assignment[2];
+  controller->Scatter(assignments.data(), assignment, 2, 0);
+  const int groupIdx = assignment[0];
+  const int aggregator = assignment[1];
+
+  if (aggregator != myId)
+  {
+    controller->Send(this->GetInput(), aggregator, AGGREGATION_PIECE_TAG);
+    return 1;
+  }
+
+  std::vector<int> group;
+  if (myId == 0)
+  {
+    for (size_t idx = 1; idx < groups.size(); ++idx)
+    {
+      int size = static_cast<int>(groups[idx].size());
+      controller->Send(&size, 1, groups[idx][0], AGGREGATION_GROUP_TAG);
+      controller->Send(groups[idx].data(), size, groups[idx][0], AGGREGATION_GROUP_TAG);
+    }
+    group = groups[0];
+  }
+  else
+  {
+    int size;
+    controller->Receive(&size, 1, 0, AGGREGATION_GROUP_TAG);
+    group.resize(size);
+    controller->Receive(group.data(), size, 0, AGGREGATION_GROUP_TAG);
+  }
+
+  vtkNew<vtkXMLPUnstructuredDataWriterAggregatedPieces> pieces;
+  pieces->LocalPiece = this->GetInput();
+  pieces->Controller = controller;
+  pieces->Group = group;
+  this->AggregatedPieces = pieces;
+  this->NumberOfAggregatedPieces = static_cast<int>(group.size());
+  const int result = this->WritePiece(groupIdx);
+  this->AggregatedPieces = nullptr;
+  this->NumberOfAggregatedPieces = 0;
+  if (!result)
+  {
+    vtkErrorMacro("Ran out of disk space; deleting file(s) already written");
+    this->DeleteFiles();
+    return 0;
+  }
+  this->PieceWrittenFlags[groupIdx] = static_cast<unsigned char>(0x1);
+  return 1;
+}
+
 //------------------------------------------------------------------------------
 void vtkXMLPUnstructuredDataWriter::WritePData(vtkIndent indent)
 {
@@ -7,6 +7,12 @@
  * vtkXMLPUnstructuredDataWriter provides PVTK XML writing
  * functionality that is common among all the parallel unstructured
  * data formats.
+ *
+ * By default each process writes its piece in its own file. When
+ * NumberOfAggregators is positive, the processes are split in groups and the
+ * first process of each group writes the pieces of the whole group in a
+ * single file, one XML piece per process, so that the number of files does
+ * not grow with the number of processes.
  */
 
 #ifndef vtkXMLPUnstructuredDataWriter_h
@@ -25,6 +31,35 @@ public:
   vtkTypeMacro(vtkXMLPUnstructuredDataWriter, vtkXMLPDataWriter);
   void PrintSelf(ostream& os, vtkIndent indent) override;
 
+  ///@{
+  /**
+   * Get/Set the number of processes writing piece files. When positive, the
+   * processes are split in this number of groups and the first process of
+   * each group writes the pieces of all the processes of the group in one
+   * file. The pieces are received one at a time while the file is written, so
+   * the writing process holds at most one remote piece in memory. Aggregation
+   * requires each process to write a single piece, otherwise the processes
+   * write their own files.
+   * Default is 0, each process writes its own file.
+   */
+  vtkSetClampMacro(NumberOfAggregators, int, 0, VTK_INT_MAX);
+  vtkGetMacro(NumberOfAggregators, int);
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set whether the groups of processes are formed within each node,
+   * identified by the host name of the processes, so that the pieces do not
+   * leave their node before being written. Each node has at least one writing
+   * process, and the others are distributed among the nodes according to their
+   * number of processes. Only used when NumberOfAggregators is positive.
+   * Default is false.
+   */
+  vtkSetMacro(NodeAwareAggregation, bool);
+  vtkGetMacro(NodeAwareAggregation, bool);
+  vtkBooleanMacro(NodeAwareAggregation, bool);
+  ///@}
+
 protected:
   vtkXMLPUnstructuredDataWriter();
   ~vtkXMLPUnstructuredDataWriter() override;
@@ -33,10 +68,20 @@ protected:
   virtual vtkXMLUnstructuredDataWriter* CreateUnstructuredPieceWriter() = 0;
   vtkXMLWriter* CreatePieceWriter(int index) override;
   void WritePData(vtkIndent indent) override;
+  int WritePieceInternal() override;
+
+  int NumberOfAggregators = 0;
+  bool NodeAwareAggregation = false;
 
 private:
   vtkXMLPUnstructuredDataWriter(const vtkXMLPUnstructuredDataWriter&) = delete;
   void operator=(const vtkXMLPUnstructuredDataWriter&) = delete;
+
+  /**
+   * Source of the pieces of the group while this process writes them.
+   */
+  vtkAlgorithm* AggregatedPieces = nullptr;
+  int NumberOfAggregatedPieces = 0;
 };
 
 VTK_ABI_NAMESPACE_END
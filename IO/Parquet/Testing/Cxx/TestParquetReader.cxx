@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkDataArraySelection.h"
+#include "vtkDoubleArray.h"
+#include "vtkNew.h"
+#include "vtkParquetReader.h"
+#include "vtkStringArray.h"
+#include "vtkTable.h"
+#include "vtkTestUtilities.h"
+
+#include <arrow/api.h>
+#include <arrow/io/file.h>
+#include <parquet/arrow/writer.h>
+
+#include <iostream>
+#include <string>
+
+namespace
+{
+// Write 10 rows in row groups of 4 rows.
+bool WriteFile(const std::string& fileName)
+{
+  arrow::DoubleBuilder x;
+  arrow::Int64Builder id;
+  arrow::StringBuilder name;
+  arrow::Int32Builder skipped;
+  for (int i = 0; i < 10; ++i)
+  {
+    if (!x.Append(0.5 * i).ok() || !id.Append(i).ok() ||
+      !name.Append("row" + std::to_string(i)).ok() || !skipped.Append(-i).ok())
+    {
+      return false;
+    }
+  }
+  std::shared_ptr<arrow::Array> columns[4];
+  if (!x.Finish(&columns[0]).ok() || !id.Finish(&columns[1]).ok() ||
+    !name.Finish(&columns[2]).ok() || !skipped.Finish(&columns[3]).ok())
+  {
+    return false;
+  }
+  std::shared_ptr<arrow::Schema> schema =
+    arrow::schema({ arrow::field("x", arrow::float64()), arrow::field("id", arrow::int64()),
+      arrow::field("name", arrow::utf8()), arrow::field("skipped", arrow::int32()) });
+  std::shared_ptr<arrow::Table> table =
+    arrow::Table::Make(schema, { columns[0], columns[1], columns[2], columns[3] });
+
+  arrow::Result<std::shared_ptr<arrow::io::FileOutputStream>> file =
+    arrow::io::FileOutputStream::Open(fileName);
+  return file.ok() &&
+    parquet::arrow::WriteTable(*table, arrow::default_memory_pool(), *file, 4).ok() &&
+    (*file)->Close().ok();
+}
+}
+
+int TestParquetReader(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string fileName = std::string(tempDir) + "/TestParquetReader.parquet";
+  delete[] tempDir;
+  if (!WriteFile(fileName))
+  {
+    std::cerr << "Cannot write " << fileName << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!vtkParquetReader::CanReadFile(fileName.c_str()))
+  {
+    std::cerr << "Cannot read " << fileName << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkParquetReader> reader;
+  reader->SetFileName(fileName.c_str());
+  reader->UpdateInformation();
+  vtkDataArraySelection* selection = reader->GetColumnArraySelection();
+  if (selection->GetNumberOfArrays() != 4)
+  {
+    std::cerr << "Expected 4 columns, got " << selection->GetNumberOfArrays() << std::endl;
+    return EXIT_FAILURE;
+  }
+  selection->DisableArray("skipped");
+  reader->Update();
+
+  vtkTable* table = reader->GetOutput();
+  if (table->GetNumberOfColumns() != 3 || table->GetNumberOfRows() != 10)
+  {
+    std::cerr << "Expected 3 columns of 10 rows, got " << table->GetNumberOfColumns()
+              << " columns of " << table->GetNumberOfRows() << " rows" << std::endl;
+    return EXIT_FAILURE;
+  }
+  vtkDoubleArray* x = vtkArrayDownCast<vtkDoubleArray>(table->GetColumnByName("x"));
+  vtkStringArray* name = vtkArrayDownCast<vtkStringArray>(table->GetColumnByName("name"));
+  vtkDataArray* id = vtkArrayDownCast<vtkDataArray>(table->GetColumnByName("id"));
+  if (!x || !name || !id || id->GetDataType() != VTK_TYPE_INT64)
+  {
+    std::cerr << "Unexpected column types" << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (int i = 0; i < 10; ++i)
+  {
+    if (x->GetValue(i) != 0.5 * i || id->GetComponent(i, 0) != i ||
+      name->GetValue(i) != "row" + std::to_string(i))
+    {
+      std::cerr << "Unexpected values in row " << i << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
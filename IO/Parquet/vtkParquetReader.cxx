@@ -0,0 +1,207 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkParquetReader.h"
+
+#include "vtkArrowCDataInterface.h"
+#include "vtkArrowUtilities.h"
+#include "vtkCommand.h"
+#include "vtkDataArraySelection.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkObjectFactory.h"
+#include "vtkTable.h"
+
+#include <arrow/c/bridge.h>
+#include <arrow/io/file.h>
+#include <arrow/record_batch.h>
+#include <arrow/table.h>
+#include <parquet/arrow/reader.h>
+#include <parquet/arrow/schema.h>
+
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkParquetReader);
+
+namespace
+{
+arrow::Status OpenFile(const char* fileName, std::unique_ptr<parquet::arrow::FileReader>& reader)
+{
+  arrow::Result<std::shared_ptr<arrow::io::ReadableFile>> file =
+    arrow::io::ReadableFile::Open(fileName);
+  if (!file.ok())
+  {
+    return file.status();
+  }
+  parquet::arrow::FileReaderBuilder builder;
+  ARROW_RETURN_NOT_OK(builder.Open(*file));
+  return builder.Build(&reader);
+}
+
+// Append the Parquet columns storing a field, several for nested fields.
+void CollectColumns(const parquet::arrow::SchemaField& field, std::vector<int>& columns)
+{
+  if (field.is_leaf())
+  {
+    columns.push_back(field.column_index);
+  }
+  for (const parquet::arrow::SchemaField& child : field.children)
+  {
+    CollectColumns(child, columns);
+  }
+}
+}
+
+//------------------------------------------------------------------------------
+vtkParquetReader::vtkParquetReader()
+{
+  this->SetNumberOfInputPorts(0);
+  this->ColumnArraySelection->AddObserver(
+    vtkCommand::ModifiedEvent, this, &vtkParquetReader::Modified);
+}
+
+//------------------------------------------------------------------------------
+vtkParquetReader::~vtkParquetReader()
+{
+  this->SetFileName(nullptr);
+}
+
+//------------------------------------------------------------------------------
+vtkDataArraySelection* vtkParquetReader::GetColumnArraySelection()
+{
+  return this->ColumnArraySelection;
+}
+
+//------------------------------------------------------------------------------
+bool vtkParquetReader::CanReadFile(const char* fileName)
+{
+  if (fileName == nullptr)
+  {
+    return false;
+  }
+  std::ifstream file(fileName, std::ios::binary);
+  char magic[4];
+  return file.read(magic, 4) && std::memcmp(magic, "PAR1", 4) == 0;
+}
+
+//------------------------------------------------------------------------------
+int vtkParquetReader::RequestInformation(
+  vtkInformation*, vtkInformationVector**, vtkInformationVector*)
+{
+  if (this->FileName == nullptr)
+  {
+    vtkErrorMacro("A FileName must be specified.");
+    return 0;
+  }
+
+  try
+  {
+    std::unique_ptr<parquet::arrow::FileReader> reader;
+    std::shared_ptr<arrow::Schema> schema;
+    arrow::Status status = ::OpenFile(this->FileName, reader);
+    if (status.ok())
+    {
+      status = reader->GetSchema(&schema);
+    }
+    if (!status.ok())
+    {
+      vtkErrorMacro("Cannot read " << this->FileName << ": " << status.ToString());
+      return 0;
+    }
+    for (const std::shared_ptr<arrow::Field>& field : schema->fields())
+    {
+      if (!this->ColumnArraySelection->ArrayExists(field->name().c_str()))
+      {
+        this->ColumnArraySelection->AddArray(field->name().c_str());
+      }
+    }
+  }
+  catch (const std::exception& e)
+  {
+    vtkErrorMacro("Cannot read " << this->FileName << ": " << e.what());
+    return 0;
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkParquetReader::RequestData(
+  vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector)
+{
+  vtkTable* output = vtkTable::GetData(outputVector);
+  if (this->FileName == nullptr)
+  {
+    vtkErrorMacro("A FileName must be specified.");
+    return 0;
+  }
+
+  try
+  {
+    std::unique_ptr<parquet::arrow::FileReader> reader;
+    arrow::Status status = ::OpenFile(this->FileName, reader);
+    if (!status.ok())
+    {
+      vtkErrorMacro("Cannot read " << this->FileName << ": " << status.ToString());
+      return 0;
+    }
+
+    // Only decode the Parquet columns of the selected fields.
+    std::vector<int> columns;
+    for (const parquet::arrow::SchemaField& field : reader->manifest().schema_fields)
+    {
+      if (this->ColumnArraySelection->ArrayIsEnabled(field.field->name().c_str()))
+      {
+        ::CollectColumns(field, columns);
+      }
+    }
+    if (columns.empty())
+    {
+      output->Initialize();
+      return 1;
+    }
+
+    // A single batch makes the columns contiguous, Arrow copying the values
+    // only when the file holds several row groups.
+    std::shared_ptr<arrow::Table> table;
+    ArrowSchema schema;
+    ArrowArray array;
+    status = reader->ReadTable(columns, &table);
+    if (status.ok())
+    {
+      arrow::Result<std::shared_ptr<arrow::RecordBatch>> batch = table->CombineChunksToBatch();
+      status = batch.ok() ? arrow::ExportRecordBatch(**batch, &array, &schema) : batch.status();
+    }
+    if (!status.ok())
+    {
+      vtkErrorMacro("Cannot read " << this->FileName << ": " << status.ToString());
+      return 0;
+    }
+    if (!vtkArrowUtilities::ImportTable(&schema, &array, output))
+    {
+      vtkErrorMacro("Cannot convert the columns of " << this->FileName << ".");
+      return 0;
+    }
+  }
+  catch (const std::exception& e)
+  {
+    vtkErrorMacro("Cannot read " << this->FileName << ": " << e.what());
+    return 0;
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkParquetReader::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "FileName: " << (this->FileName ? this->FileName : "(none)") << endl;
+  os << indent << "ColumnArraySelection:" << endl;
+  this->ColumnArraySelection->PrintSelf(os, indent.GetNextIndent());
+}
+VTK_ABI_NAMESPACE_END
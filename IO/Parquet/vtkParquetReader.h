@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkParquetReader
+ * @brief   read an Apache Parquet file into a vtkTable
+ *
+ * vtkParquetReader reads the selected columns of a Parquet file with the Arrow
+ * C++ library and hands them to VTK through the Arrow C data interface (see
+ * vtkArrowUtilities). The numeric columns of the output therefore use the
+ * memory decoded by Arrow without another copy; when the file holds several
+ * row groups, Arrow first concatenates them so that each column is contiguous.
+ *
+ * Each top-level field of the file schema is a column of the output, the
+ * columns of unsupported types (nested, temporal, dictionary encoded...) being
+ * skipped with a warning.
+ *
+ * @sa
+ * vtkArrowUtilities vtkDelimitedTextReader
+ */
+
+#ifndef vtkParquetReader_h
+#define vtkParquetReader_h
+
+#include "vtkIOParquetModule.h" // For export macro
+#include "vtkNew.h"             // For vtkNew
+#include "vtkTableAlgorithm.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkDataArraySelection;
+
+class VTKIOPARQUET_EXPORT vtkParquetReader : public vtkTableAlgorithm
+{
+public:
+  static vtkParquetReader* New();
+  vtkTypeMacro(vtkParquetReader, vtkTableAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Specify the Parquet file to read.
+   */
+  vtkSetFilePathMacro(FileName);
+  vtkGetFilePathMacro(FileName);
+  ///@}
+
+  /**
+   * Get the selection of the columns to read. It is filled with the fields of
+   * the file schema, all enabled, when the pipeline information is updated.
+   */
+  vtkDataArraySelection* GetColumnArraySelection();
+
+  /**
+   * Return true if @a fileName starts with the Parquet magic number.
+   */
+  static bool CanReadFile(const char* fileName);
+
+protected:
+  vtkParquetReader();
+  ~vtkParquetReader() override;
+
+  int RequestInformation(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
+  char* FileName = nullptr;
+  vtkNew<vtkDataArraySelection> ColumnArraySelection;
+
+private:
+  vtkParquetReader(const vtkParquetReader&) = delete;
+  void operator=(const vtkParquetReader&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -0,0 +1,142 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Write images with arrays of many compressed blocks, with each compressor
+// and with appended and inline binary data, and check that the arrays read
+// back from the whole extent and from a sub-extent are identical.
+
+#include "vtkFloatArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkImageData.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkStringArray.h"
+#include "vtkXMLImageDataReader.h"
+#include "vtkXMLImageDataWriter.h"
+#include "vtkZstdDataCompressor.h"
+
+#include <cstdlib>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Compare the point arrays of image to those of reference over the extent of image
+bool CompareArrays(vtkImageData* image, vtkImageData* reference, const char* what)
+{
+  const int* ext = image->GetExtent();
+  for (int k = ext[4]; k <= ext[5]; ++k)
+  {
+    for (int j = ext[2]; j <= ext[3]; ++j)
+    {
+      for (int i = ext[0]; i <= ext[1]; ++i)
+      {
+        int ijk[3] = { i, j, k };
+        vtkIdType id = image->ComputePointId(ijk);
+        vtkIdType refId = reference->ComputePointId(ijk);
+        for (const char* name : { "Values", "Ids" })
+        {
+          vtkDataArray* array = image->GetPointData()->GetArray(name);
+          vtkDataArray* refArray = reference->GetPointData()->GetArray(name);
+          if (!array || array->GetTuple1(id) != refArray->GetTuple1(refId))
+          {
+            vtkLog(ERROR,
+              "Wrong " << name << " for " << what << " at " << i << " " << j << " " << k);
+            return false;
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+}
+
+int TestXMLCompressedBlocks(int, char*[])
+{
+  vtkNew<vtkImageData> image;
+  image->SetExtent(0, 79, 0, 59, 0, 29);
+  vtkIdType numPoints = image->GetNumberOfPoints();
+
+  vtkNew<vtkFloatArray> values;
+  values->SetName("Values");
+  values->SetNumberOfValues(numPoints);
+  vtkNew<vtkIdTypeArray> ids;
+  ids->SetName("Ids");
+  ids->SetNumberOfValues(numPoints);
+  vtkNew<vtkStringArray> strings;
+  strings->SetName("Strings");
+  strings->SetNumberOfValues(numPoints / 10);
+  unsigned int seed = 12345;
+  for (vtkIdType i = 0; i < numPoints; ++i)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    values->SetValue(i, static_cast<float>(seed >> 12) / 64.0f);
+    ids->SetValue(i, 3 * i + (seed >> 28));
+    if (i % 10 == 0)
+    {
+      strings->SetValue(i / 10, std::string((seed >> 24) % 40, static_cast<char>('a' + i % 26)));
+    }
+  }
+  image->GetPointData()->AddArray(values);
+  image->GetPointData()->AddArray(ids);
+  image->GetFieldData()->AddArray(strings);
+
+  std::vector<int> compressors = { vtkXMLWriter::ZLIB, vtkXMLWriter::LZ4, vtkXMLWriter::LZMA };
+  if (vtkZstdDataCompressor::IsSupported())
+  {
+    compressors.push_back(vtkXMLWriter::ZSTD);
+  }
+  for (int compressor : compressors)
+  {
+    for (int dataMode : { vtkXMLWriter::Appended, vtkXMLWriter::Binary })
+    {
+      vtkNew<vtkXMLImageDataWriter> writer;
+      writer->SetInputData(image);
+      writer->SetCompressorType(compressor);
+      writer->SetDataMode(dataMode);
+      writer->EncodeAppendedDataOff();
+      writer->SetBlockSize(4096);
+      writer->WriteToOutputStringOn();
+      if (!writer->Write())
+      {
+        vtkLog(ERROR, "Cannot write with compressor " << compressor << ", mode " << dataMode);
+        return EXIT_FAILURE;
+      }
+
+      vtkNew<vtkXMLImageDataReader> reader;
+      reader->ReadFromInputStringOn();
+      reader->SetInputString(writer->GetOutputString());
+      reader->Update();
+      vtkImageData* output = reader->GetOutput();
+      vtkStringArray* outStrings =
+        vtkStringArray::SafeDownCast(output->GetFieldData()->GetAbstractArray("Strings"));
+      if (!CompareArrays(output, image, "whole extent") || !outStrings ||
+        outStrings->GetNumberOfValues() != strings->GetNumberOfValues())
+      {
+        return EXIT_FAILURE;
+      }
+      for (vtkIdType i = 0; i < strings->GetNumberOfValues(); ++i)
+      {
+        if (outStrings->GetValue(i) != strings->GetValue(i))
+        {
+          vtkLog(ERROR, "Wrong string at " << i);
+          return EXIT_FAILURE;
+        }
+      }
+
+      // a sub-extent starts and ends within blocks
+      const int subExtent[6] = { 13, 71, 5, 46, 7, 23 };
+      vtkAlgorithm* algorithm = reader;
+      algorithm->UpdateExtent(subExtent);
+      if (!CompareArrays(reader->GetOutput(), image, "sub-extent"))
+      {
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
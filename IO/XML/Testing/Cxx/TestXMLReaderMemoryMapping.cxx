@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that vtkXMLReader::MemoryMapping maps raw appended arrays from the
+// file without changing the output nor the file.
+
+#include "vtkDoubleArray.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkTesting.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkXMLPolyDataReader.h"
+#include "vtkXMLPolyDataWriter.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace
+{
+bool SameValues(vtkDataArray* expected, vtkDataArray* actual)
+{
+  if (!actual || expected->GetNumberOfValues() != actual->GetNumberOfValues())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < expected->GetNumberOfValues(); ++i)
+  {
+    if (expected->GetComponent(i / 3, i % 3) != actual->GetComponent(i / 3, i % 3))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestXMLReaderMemoryMapping(int argc, char* argv[])
+{
+  const vtkIdType numberOfPoints = 1000;
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToDouble();
+  points->SetNumberOfPoints(numberOfPoints);
+  vtkNew<vtkUnsignedCharArray> colors;
+  colors->SetName("Colors");
+  colors->SetNumberOfComponents(3);
+  colors->SetNumberOfTuples(numberOfPoints);
+  for (vtkIdType i = 0; i < numberOfPoints; ++i)
+  {
+    points->SetPoint(i, i, 2.0 * i, 3.0 * i);
+    unsigned char color[3] = { static_cast<unsigned char>(i % 256),
+      static_cast<unsigned char>(i % 7), 42 };
+    colors->SetTypedTuple(i, color);
+  }
+  vtkNew<vtkPolyData> polyData;
+  polyData->SetPoints(points);
+  polyData->GetPointData()->AddArray(colors);
+
+  vtkNew<vtkTesting> testing;
+  testing->AddArguments(argc, argv);
+  std::string fileName = testing->GetTempDirectory();
+  fileName += "/TestXMLReaderMemoryMapping.vtp";
+
+  vtkNew<vtkXMLPolyDataWriter> writer;
+  writer->SetFileName(fileName.c_str());
+  writer->SetInputData(polyData);
+  writer->SetDataModeToAppended();
+  writer->EncodeAppendedDataOff();
+  writer->SetCompressorTypeToNone();
+  if (!writer->Write())
+  {
+    std::cerr << "Cannot write " << fileName << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkXMLPolyDataReader> reader;
+  reader->SetFileName(fileName.c_str());
+  reader->MemoryMappingOn();
+  reader->Update();
+  vtkPolyData* output = reader->GetOutput();
+  auto* mappedColors =
+    vtkUnsignedCharArray::SafeDownCast(output->GetPointData()->GetArray("Colors"));
+  if (!SameValues(points->GetData(), output->GetPoints()->GetData()) ||
+    !SameValues(colors, mappedColors))
+  {
+    std::cerr << "Memory mapped values differ from the written ones" << std::endl;
+    return EXIT_FAILURE;
+  }
+  // Single byte values are always aligned, so this array must be mapped.
+  if (!mappedColors->GetBuffer()->GetExternal())
+  {
+    std::cerr << "Colors were not memory mapped" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Modifying the output must not change the file.
+  mappedColors->SetValue(0, 255);
+  vtkNew<vtkXMLPolyDataReader> checkReader;
+  checkReader->SetFileName(fileName.c_str());
+  checkReader->Update();
+  if (!SameValues(colors, checkReader->GetOutput()->GetPointData()->GetArray("Colors")))
+  {
+    std::cerr << "Modifying a memory mapped array changed the file" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
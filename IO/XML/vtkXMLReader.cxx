@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkXMLReader.h"
 
+#include "vtkAOSDataArrayTemplate.h"
 #include "vtkArrayIteratorIncludes.h"
 #include "vtkBitArray.h"
 #include "vtkCallbackCommand.h"
@@ -34,6 +35,7 @@
 #include "vtkXMLFileReadTester.h"
 #include "vtkXMLReaderVersion.h"
 #include "vtkZLibDataCompressor.h"
+#include "vtkZstdDataCompressor.h"
 
 #include "vtksys/Encoding.hxx"
 #include "vtksys/FStream.hxx"
@@ -132,6 +134,7 @@ vtkXMLReader::vtkXMLReader()
   this->FileStream = nullptr;
   this->StringStream = nullptr;
   this->ReadFromInputString = 0;
+  this->MemoryMapping = false;
   this->InputString = "";
   this->InputArray = nullptr;
   this->XMLParser = nullptr;
@@ -230,6 +233,7 @@ void vtkXMLReader::PrintSelf(ostream& os, vtkIndent indent)
   {
     os << indent << "Stream: (none)\n";
   }
+  os << indent << "MemoryMapping: " << (this->MemoryMapping ? "On" : "Off") << "\n";
   os << indent << "TimeStep:" << this->TimeStep << "\n";
   os << indent << "ActiveTimeDataArrayName:"
      << (this->ActiveTimeDataArrayName ? this->ActiveTimeDataArrayName : "(null)") << "\n";
@@ -515,6 +519,10 @@ void vtkXMLReader::SetupCompressor(const char* type)
     {
       compressor = vtkLZMADataCompressor::New();
     }
+    else if (strcmp(type, "vtkZstdDataCompressor") == 0)
+    {
+      compressor = vtkZstdDataCompressor::New();
+    }
   }
 
   if (!compressor)
@@ -977,12 +985,21 @@ int vtkXMLReader::ReadArrayValues(vtkXMLDataElement* da, vtkIdType arrayIndex,
                                << arrayIndex + numValues << " were requested to be read");
     return 0;
   }
-  switch (array->GetDataType())
+  if (this->MemoryMapping && arrayIndex == 0 && startIndex == 0 &&
+    numValues == array->GetNumberOfValues() && this->MapArrayValues(da, array, numValues))
   {
-    vtkArrayIteratorTemplateMacro(result = vtkXMLDataReaderReadArrayValues(da, this->XMLParser,
-                                    arrayIndex, static_cast<VTK_TT*>(iter), startIndex, numValues));
-    default:
-      result = 0;
+    result = 1;
+  }
+  else
+  {
+    switch (array->GetDataType())
+    {
+      vtkArrayIteratorTemplateMacro(result = vtkXMLDataReaderReadArrayValues(da, this->XMLParser,
+                                      arrayIndex, static_cast<VTK_TT*>(iter), startIndex,
+                                      numValues));
+      default:
+        result = 0;
+    }
   }
   if (iter)
   {
@@ -1002,6 +1019,39 @@ int vtkXMLReader::ReadArrayValues(vtkXMLDataElement* da, vtkIdType arrayIndex,
   return result;
 }
 
+//------------------------------------------------------------------------------
+bool vtkXMLReader::MapArrayValues(
+  vtkXMLDataElement* da, vtkAbstractArray* array, vtkIdType numValues)
+{
+  // Only files opened by this reader can be mapped, user streams and strings
+  // have no file to map.
+  vtkTypeInt64 offset = 0;
+  if (!this->FileStream || this->Stream != this->FileStream || !this->FileName ||
+    !da->GetScalarAttribute("offset", offset))
+  {
+    return false;
+  }
+  vtkTypeUInt64 numberOfBytes = 0;
+  vtkTypeInt64 position = this->XMLParser->FindRawAppendedDataPosition(offset, numberOfBytes);
+  if (position < 0 ||
+    numberOfBytes < static_cast<vtkTypeUInt64>(numValues) * array->GetDataTypeSize())
+  {
+    return false;
+  }
+
+  // The mapping is writable and private so that readers can keep modifying
+  // the values in place, e.g. to convert ghost levels.
+  bool mapped = false;
+  switch (array->GetDataType())
+  {
+    vtkTemplateMacro({
+      auto* aos = vtkAOSDataArrayTemplate<VTK_TT>::FastDownCast(array);
+      mapped = aos && aos->MapFile(this->FileName, position, numValues, false);
+    });
+  }
+  return mapped;
+}
+
 //------------------------------------------------------------------------------
 int vtkXMLReader::ReadArrayTuples(vtkXMLDataElement* da, vtkIdType arrayTupleIndex,
   vtkAbstractArray* array, vtkIdType startTupleIndex, vtkIdType numTuples, FieldType fieldType)
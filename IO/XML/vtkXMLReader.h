@@ -198,6 +198,21 @@ public:
   vtkTypeBool ProcessRequest(vtkInformation* request, vtkInformationVector** inputVector,
     vtkInformationVector* outputVector) override;
 
+  ///@{
+  /**
+   * When on, arrays stored uncompressed in a raw encoded appended data section
+   * with the native byte order are memory mapped from the file instead of
+   * being read into memory, see vtkAOSDataArrayTemplate::MapFile(). Only
+   * arrays read entirely in one piece, whose values are suitably aligned in
+   * the file, are mapped; the other ones are read as usual. The mapping is
+   * private: modifying the output never changes the file, but the file must
+   * not be modified while the output is in use. Off by default.
+   */
+  vtkSetMacro(MemoryMapping, bool);
+  vtkGetMacro(MemoryMapping, bool);
+  vtkBooleanMacro(MemoryMapping, bool);
+  ///@}
+
   ///@{
   /**
    * Set/get the ErrorObserver for the internal reader
@@ -363,6 +378,12 @@ protected:
     vtkAbstractArray* array, vtkIdType startTupleIndex, vtkIdType numTuples,
     FieldType type = OTHER);
 
+  /**
+   * Try to memory map the numValues values of the array described by da
+   * instead of reading them, see MemoryMapping. Returns true on success.
+   */
+  bool MapArrayValues(vtkXMLDataElement* da, vtkAbstractArray* array, vtkIdType numValues);
+
   /**
    * Setup the data array selections for the input's set of arrays.
    */
@@ -418,6 +439,9 @@ protected:
   // Default is 0: read from file.
   vtkTypeBool ReadFromInputString;
 
+  // Whether raw appended arrays are memory mapped from the file.
+  bool MemoryMapping;
+
   // The input string.
   std::string InputString;
 
@@ -31,6 +31,8 @@
 #include "vtkOutputStream.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 #include "vtkStdString.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkUnsignedCharArray.h"
@@ -51,10 +53,12 @@
 #include "vtksys/FStream.hxx"
 #include <memory>
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #if !defined(_WIN32) || defined(__CYGWIN__)
 #include <unistd.h> /* unlink */
@@ -1005,6 +1009,14 @@ int vtkXMLWriter::WriteBinaryData(vtkAbstractArray* a)
       result = 0;
     }
 
+    // Compress and write the blocks that are still waiting.
+    if (result && !this->FlushCompressionBlocks())
+    {
+      result = 0;
+    }
+    this->CompressionBlocks.clear();
+    this->CompressionBlockEnds.clear();
+
     // Finish writing the data.
     if (result && !this->DataStream->EndWriting())
     {
@@ -1367,26 +1379,65 @@ int vtkXMLWriter::CreateCompressionHeader(size_t size)
 //------------------------------------------------------------------------------
 int vtkXMLWriter::WriteCompressionBlock(unsigned char* data, size_t size)
 {
-  // Compress the data.
-  vtkUnsignedCharArray* outputArray = this->Compressor->Compress(data, size);
+  // Keep a copy of the block, so that several blocks can be compressed in
+  // parallel.  The blocks are independent in the format, but they must be
+  // written in order.
+  this->CompressionBlocks.insert(this->CompressionBlocks.end(), data, data + size);
+  this->CompressionBlockEnds.push_back(this->CompressionBlocks.size());
+
+  // Wait for enough blocks to keep the threads busy.
+  size_t batchBlocks =
+    std::max<size_t>(64, 4 * static_cast<size_t>(vtkSMPTools::GetEstimatedNumberOfThreads()));
+  if (this->CompressionBlockEnds.size() < batchBlocks)
+  {
+    return 1;
+  }
+  return this->FlushCompressionBlocks();
+}
 
-  // Find the compressed size.
-  size_t outputSize = outputArray->GetNumberOfTuples();
-  unsigned char* outputPointer = outputArray->GetPointer(0);
+//------------------------------------------------------------------------------
+int vtkXMLWriter::FlushCompressionBlocks()
+{
+  size_t numBlocks = this->CompressionBlockEnds.size();
+  if (numBlocks == 0)
+  {
+    return 1;
+  }
 
-  // Write the compressed data.
-  int result = this->DataStream->Write(outputPointer, outputSize);
+  // Compress the blocks.
+  std::vector<vtkSmartPointer<vtkUnsignedCharArray>> outputArrays(numBlocks);
+  vtkSMPTools::For(0, numBlocks, 1, [this, &outputArrays](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i)
+    {
+      size_t start = (i > 0 ? this->CompressionBlockEnds[i - 1] : 0);
+      outputArrays[i].TakeReference(this->Compressor->Compress(
+        this->CompressionBlocks.data() + start, this->CompressionBlockEnds[i] - start));
+    }
+  });
+  this->CompressionBlocks.clear();
+  this->CompressionBlockEnds.clear();
+
+  // Write the compressed data in order, and store the compressed sizes in
+  // the compression header.
+  int result = 1;
+  for (size_t i = 0; i < numBlocks && result; ++i)
+  {
+    vtkUnsignedCharArray* outputArray = outputArrays[i];
+    if (!outputArray)
+    {
+      vtkErrorMacro("Error compressing block " << this->CompressionBlockNumber << ".");
+      return 0;
+    }
+    size_t outputSize = outputArray->GetNumberOfTuples();
+    result = this->DataStream->Write(outputArray->GetPointer(0), outputSize);
+    this->CompressionHeader->Set(3 + this->CompressionBlockNumber++, outputSize);
+  }
   this->Stream->flush();
   if (this->Stream->fail())
   {
     this->SetErrorCode(vtkErrorCode::GetLastSystemError());
   }
 
-  // Store the resulting compressed size in the compression header.
-  this->CompressionHeader->Set(3 + this->CompressionBlockNumber++, outputSize);
-
-  outputArray->Delete();
-
   return result;
 }
 
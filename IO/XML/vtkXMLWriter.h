@@ -22,6 +22,7 @@
 #include "vtkXMLWriterBase.h"
 
 #include <sstream> // For ostringstream ivar
+#include <vector>  // For std::vector
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkAbstractArray;
@@ -128,6 +129,11 @@ protected:
   vtkXMLDataHeader* CompressionHeader;
   vtkTypeInt64 CompressionHeaderPosition;
 
+  // The uncompressed blocks that are waiting to be compressed together, and
+  // the offset of the end of each block in the buffer.
+  std::vector<unsigned char> CompressionBlocks;
+  std::vector<size_t> CompressionBlockEnds;
+
   // The output stream used to write binary and appended data.  May
   // transparently encode the data.
   vtkOutputStream* DataStream;
@@ -243,6 +249,7 @@ protected:
   void PerformByteSwap(void* data, size_t numWords, size_t wordSize);
   int CreateCompressionHeader(size_t size);
   int WriteCompressionBlock(unsigned char* data, size_t size);
+  int FlushCompressionBlocks();
   int WriteCompressionHeader();
   size_t GetWordTypeSize(int dataType);
   const char* GetWordTypeName(int dataType);
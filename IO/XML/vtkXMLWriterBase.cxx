@@ -8,6 +8,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkXMLReaderVersion.h"
 #include "vtkZLibDataCompressor.h"
+#include "vtkZstdDataCompressor.h"
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkCxxSetObjectMacro(vtkXMLWriterBase, Compressor, vtkDataCompressor);
@@ -120,6 +121,16 @@ void vtkXMLWriterBase::SetCompressorType(int compressorType)
     this->Compressor->SetCompressionLevel(this->CompressionLevel);
     this->Modified();
   }
+  else if (compressorType == ZSTD)
+  {
+    if (this->Compressor)
+    {
+      this->Compressor->Delete();
+    }
+    this->Compressor = vtkZstdDataCompressor::New();
+    this->Compressor->SetCompressionLevel(this->CompressionLevel);
+    this->Modified();
+  }
   else
   {
     vtkWarningMacro("Invalid compressorType:" << compressorType);
@@ -139,7 +139,8 @@ public:
     NONE,
     ZLIB,
     LZ4,
-    LZMA
+    LZMA,
+    ZSTD
   };
 
   ///@{
@@ -151,6 +152,7 @@ public:
   void SetCompressorTypeToLZ4() { this->SetCompressorType(LZ4); }
   void SetCompressorTypeToZLib() { this->SetCompressorType(ZLIB); }
   void SetCompressorTypeToLZMA() { this->SetCompressorType(LZMA); }
+  void SetCompressorTypeToZstd() { this->SetCompressorType(ZSTD); }
   ///@}
 
   ///@{
@@ -207,7 +209,7 @@ public:
   /**
    * Invoke the writer.  Returns 1 for success, 0 for failure.
    */
-  int Write();
+  VTK_UNBLOCKTHREADS int Write();
 
 protected:
   vtkXMLWriterBase();
@@ -9,6 +9,7 @@
 #include "vtkEndian.h"
 #include "vtkInputStream.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkXMLDataElement.h"
 #define vtkXMLDataHeaderPrivate_DoNotInclude
 #include "vtkXMLDataHeaderPrivate.h"
@@ -624,6 +625,44 @@ unsigned char* vtkXMLDataParser::ReadBlock(vtkTypeUInt64 block)
   return decompressBuffer;
 }
 
+//------------------------------------------------------------------------------
+int vtkXMLDataParser::ReadBlocks(
+  vtkTypeUInt64 firstBlock, vtkTypeUInt64 lastBlock, unsigned char* buffer, size_t wordSize)
+{
+  // The blocks are contiguous in the stream, so read them at once.
+  size_t numBlocks = static_cast<size_t>(lastBlock - firstBlock);
+  std::vector<size_t> readOffsets(numBlocks + 1, 0);
+  for (size_t i = 0; i < numBlocks; ++i)
+  {
+    readOffsets[i + 1] = readOffsets[i] + this->BlockCompressedSizes[firstBlock + i];
+  }
+  if (!this->DataStream->Seek(this->BlockStartOffsets[firstBlock]))
+  {
+    return 0;
+  }
+  std::vector<unsigned char> readBuffer(readOffsets[numBlocks]);
+  if (this->DataStream->Read(readBuffer.data(), readBuffer.size()) < readBuffer.size())
+  {
+    return 0;
+  }
+
+  // Decompress and byte swap the blocks in parallel.
+  size_t blockSize = this->BlockUncompressedSize;
+  std::vector<unsigned char> blockResults(numBlocks, 0);
+  vtkSMPTools::For(0, numBlocks, 1, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i)
+    {
+      unsigned char* blockPointer = buffer + i * blockSize;
+      size_t compressedSize = readOffsets[i + 1] - readOffsets[i];
+      blockResults[i] = (this->Compressor->Uncompress(readBuffer.data() + readOffsets[i],
+                           compressedSize, blockPointer, blockSize) > 0);
+      this->PerformByteSwap(blockPointer, blockSize / wordSize, wordSize);
+    }
+  });
+
+  return std::find(blockResults.begin(), blockResults.end(), 0) == blockResults.end();
+}
+
 //------------------------------------------------------------------------------
 size_t vtkXMLDataParser::ReadUncompressedData(
   unsigned char* data, vtkTypeUInt64 startWord, size_t numWords, size_t wordSize)
@@ -796,21 +835,23 @@ size_t vtkXMLDataParser::ReadCompressedData(
     // Report progress.
     this->UpdateProgress(float(outputPointer - data) / length);
 
-    unsigned int currentBlock = firstBlock + 1;
-    for (; currentBlock != lastBlock && !this->Abort; ++currentBlock)
+    // Read the complete blocks in batches, with enough blocks to keep the
+    // threads busy.  Note that blockSize will always be an integer multiple
+    // of the word size.
+    vtkTypeUInt64 batchBlocks = std::max<vtkTypeUInt64>(
+      64, 4 * static_cast<vtkTypeUInt64>(vtkSMPTools::GetEstimatedNumberOfThreads()));
+    vtkTypeUInt64 currentBlock = firstBlock + 1;
+    while (currentBlock < lastBlock && !this->Abort)
     {
-      // Read this block.
-      if (!this->ReadBlock(currentBlock, outputPointer))
+      vtkTypeUInt64 batchEnd = std::min(currentBlock + batchBlocks, lastBlock);
+      if (!this->ReadBlocks(currentBlock, batchEnd, outputPointer, wordSize))
       {
         return 0;
       }
 
-      // Byte swap this block.  Note that blockSize will always be an
-      // integer multiple of the word size.
-      this->PerformByteSwap(outputPointer, blockSize / wordSize, wordSize);
-
-      // Advance the pointer to the beginning of the next block.
-      outputPointer += this->FindBlockSize(currentBlock);
+      // Advance the pointer to the beginning of the next batch.
+      outputPointer += (batchEnd - currentBlock) * blockSize;
+      currentBlock = batchEnd;
 
       // Report progress.
       this->UpdateProgress(float(outputPointer - data) / length);
@@ -958,6 +999,40 @@ size_t vtkXMLDataParser::ReadAppendedData(
   return this->ReadBinaryData(buffer, startWord, numWords, wordType);
 }
 
+//------------------------------------------------------------------------------
+vtkTypeInt64 vtkXMLDataParser::FindRawAppendedDataPosition(
+  vtkTypeInt64 offset, vtkTypeUInt64& numberOfBytes)
+{
+  numberOfBytes = 0;
+#ifdef VTK_WORDS_BIGENDIAN
+  const int nativeByteOrder = vtkXMLDataParser::BigEndian;
+#else
+  const int nativeByteOrder = vtkXMLDataParser::LittleEndian;
+#endif
+  if (this->Compressor || !this->Stream || this->AppendedDataPosition <= 0 ||
+    this->ByteOrder != nativeByteOrder ||
+    vtkBase64InputStream::SafeDownCast(this->AppendedDataStream))
+  {
+    return -1;
+  }
+
+  // Read the header giving the size of the block.
+  std::unique_ptr<vtkXMLDataHeader> uh(vtkXMLDataHeader::New(this->HeaderType, 1));
+  size_t const headerSize = uh->DataSize();
+  this->DataStream = this->AppendedDataStream;
+  this->SeekG(this->AppendedDataPosition + offset);
+  this->DataStream->SetStream(this->Stream);
+  this->DataStream->StartReading();
+  size_t r = this->DataStream->Read(uh->Data(), headerSize);
+  this->DataStream->EndReading();
+  if (r < headerSize)
+  {
+    return -1;
+  }
+  numberOfBytes = uh->Get(0);
+  return this->AppendedDataPosition + offset + static_cast<vtkTypeInt64>(headerSize);
+}
+
 //------------------------------------------------------------------------------
 //------------------------------------------------------------------------------
 // Define a parsing function template.  The extra "long" argument is used
@@ -70,6 +70,15 @@ public:
     return this->ReadAppendedData(offset, buffer, startWord, numWords, VTK_CHAR);
   }
 
+  /**
+   * Find the values of the appended data block starting at the given appended
+   * data offset when they can be used directly from the file, i.e. when the
+   * appended data is raw encoded, uncompressed and stored with the native byte
+   * order. Returns the position of the first value from the start of the
+   * stream and sets @a numberOfBytes to the size of the block, or returns -1.
+   */
+  vtkTypeInt64 FindRawAppendedDataPosition(vtkTypeInt64 offset, vtkTypeUInt64& numberOfBytes);
+
   /**
    * Read from an ascii data section starting at the current position in
    * the stream.  Returns the number of words read.
@@ -175,6 +184,8 @@ protected:
   size_t FindBlockSize(vtkTypeUInt64 block);
   int ReadBlock(vtkTypeUInt64 block, unsigned char* buffer);
   unsigned char* ReadBlock(vtkTypeUInt64 block);
+  int ReadBlocks(
+    vtkTypeUInt64 firstBlock, vtkTypeUInt64 lastBlock, unsigned char* buffer, size_t wordSize);
   size_t ReadUncompressedData(
     unsigned char* data, vtkTypeUInt64 startWord, size_t numWords, size_t wordSize);
   size_t ReadCompressedData(
@@ -55,7 +55,7 @@ public:
    * well as StartMethod() and EndMethod() methods.
    * Returns 1 on success and 0 on failure.
    */
-  virtual int Write();
+  VTK_UNBLOCKTHREADS virtual int Write();
 
   ///@{
   /**
@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Map images of 8-bit, 16-bit and float scalars through a lookup table with
+// vtkImageMapToColors, with images large enough for the colors of all the
+// values of the type to be computed once, and check each voxel against the
+// lookup table mapping of the value alone.  Also check a long array of 8-bit
+// values mapped directly by the lookup table.
+
+#include "vtkImageData.h"
+#include "vtkImageMapToColors.h"
+#include "vtkLogger.h"
+#include "vtkLookupTable.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <vector>
+
+namespace
+{
+bool CheckColors(vtkImageData* image, vtkLookupTable* table, int format)
+{
+  vtkNew<vtkImageMapToColors> mapper;
+  mapper->SetInputData(image);
+  mapper->SetLookupTable(table);
+  mapper->SetOutputFormat(format);
+  mapper->Update();
+
+  int dataType = image->GetScalarType();
+  int size = image->GetScalarSize();
+  const char* values = static_cast<const char*>(image->GetScalarPointer());
+  const unsigned char* colors =
+    static_cast<const unsigned char*>(mapper->GetOutput()->GetScalarPointer());
+  for (vtkIdType i = 0; i < image->GetNumberOfPoints(); ++i)
+  {
+    unsigned char expected[4];
+    table->MapScalarsThroughTable2(
+      const_cast<char*>(values + i * size), expected, dataType, 1, 1, format);
+    if (std::memcmp(colors + i * format, expected, format) != 0)
+    {
+      vtkLog(ERROR,
+        "Wrong color for type " << image->GetScalarTypeAsString() << ", format " << format
+                                << " at voxel " << i);
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestImageMapToColorsValues(int, char*[])
+{
+  vtkNew<vtkLookupTable> table;
+  table->SetNumberOfTableValues(200);
+  table->SetHueRange(0.0, 0.8);
+  table->SetAlphaRange(0.3, 1.0);
+  table->SetTableRange(-40.0, 180.0);
+  table->SetBelowRangeColor(0.1, 0.2, 0.3, 1.0);
+  table->UseBelowRangeColorOn();
+  table->Build();
+
+  unsigned int seed = 12345;
+  for (int dataType : { VTK_UNSIGNED_CHAR, VTK_SIGNED_CHAR, VTK_SHORT, VTK_UNSIGNED_SHORT,
+         VTK_FLOAT })
+  {
+    vtkNew<vtkImageData> image;
+    image->SetExtent(0, 299, 0, 249, 0, 0);
+    image->AllocateScalars(dataType, 1);
+    vtkDataArray* scalars = image->GetPointData()->GetScalars();
+    for (vtkIdType i = 0; i < image->GetNumberOfPoints(); ++i)
+    {
+      seed = seed * 1664525u + 1013904223u;
+      double value = static_cast<int>((seed >> 8) % 65536) - 32768;
+      if ((seed >> 4) % 2 == 0)
+      {
+        value = value / 128.0;
+      }
+      value = vtkMath::ClampValue(value, scalars->GetDataTypeMin(), scalars->GetDataTypeMax());
+      scalars->SetComponent(i, 0, value);
+    }
+
+    for (int scale : { VTK_SCALE_LINEAR, VTK_SCALE_LOG10 })
+    {
+      if (scale == VTK_SCALE_LOG10)
+      {
+        table->SetTableRange(2.0, 180.0);
+        table->SetScale(scale);
+      }
+      else
+      {
+        table->SetScale(scale);
+        table->SetTableRange(-40.0, 180.0);
+      }
+      for (double alpha : { 1.0, 0.5 })
+      {
+        table->SetAlpha(alpha);
+        for (int format : { VTK_RGBA, VTK_RGB, VTK_LUMINANCE_ALPHA, VTK_LUMINANCE })
+        {
+          if (!CheckColors(image, table, format))
+          {
+            return EXIT_FAILURE;
+          }
+        }
+      }
+    }
+  }
+
+  // the lookup table also maps long arrays of 8-bit values with their colors
+  std::vector<unsigned char> bytes(3000);
+  for (unsigned char& byte : bytes)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    byte = static_cast<unsigned char>(seed >> 24);
+  }
+  std::vector<unsigned char> colors(bytes.size() * 3);
+  table->MapScalarsThroughTable2(
+    bytes.data(), colors.data(), VTK_UNSIGNED_CHAR, static_cast<int>(bytes.size()), 1, VTK_RGB);
+  for (size_t i = 0; i < bytes.size(); ++i)
+  {
+    unsigned char expected[3];
+    table->MapScalarsThroughTable2(&bytes[i], expected, VTK_UNSIGNED_CHAR, 1, 1, VTK_RGB);
+    if (std::memcmp(&colors[3 * i], expected, 3) != 0)
+    {
+      vtkLog(ERROR, "Wrong color for the lookup table at " << i);
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Reslice a random image along oblique planes, with rows long enough to be
+// processed in strips, and check the linear and cubic interpolation of each
+// output voxel against vtkImageInterpolator.
+
+#include "vtkImageData.h"
+#include "vtkImageInterpolator.h"
+#include "vtkImageReslice.h"
+#include "vtkLogger.h"
+#include "vtkMatrix4x4.h"
+#include "vtkNew.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <initializer_list>
+
+namespace
+{
+bool CheckReslice(vtkImageData* input, int interpolationMode, vtkImageBorderMode borderMode,
+  double angle, int numSlices)
+{
+  // rotate about an oblique axis through the middle of the input
+  vtkNew<vtkMatrix4x4> axes;
+  const double c = std::cos(angle);
+  const double s = std::sin(angle);
+  const double u[3] = { 0.48, 0.6, 0.64 };
+  for (int i = 0; i < 3; ++i)
+  {
+    for (int j = 0; j < 3; ++j)
+    {
+      double e = (1 - c) * u[i] * u[j] + (i == j ? c : 0.0);
+      e += (j == (i + 1) % 3 ? -s * u[(i + 2) % 3] : 0.0);
+      e += (i == (j + 1) % 3 ? s * u[(j + 2) % 3] : 0.0);
+      axes->SetElement(i, j, e);
+    }
+  }
+  axes->SetElement(0, 3, 20.0);
+  axes->SetElement(1, 3, 18.0);
+  axes->SetElement(2, 3, 16.0);
+
+  vtkNew<vtkImageInterpolator> interpolator;
+  interpolator->SetInterpolationMode(interpolationMode);
+  interpolator->SetBorderMode(borderMode);
+
+  vtkNew<vtkImageReslice> reslice;
+  reslice->SetInputData(input);
+  reslice->SetInterpolator(interpolator);
+  reslice->SetResliceAxes(axes);
+  reslice->SetOutputScalarType(VTK_DOUBLE);
+  reslice->SetOutputOrigin(-30.0, -25.0, -0.5 * (numSlices - 1));
+  reslice->SetOutputSpacing(0.23, 0.31, 1.0);
+  reslice->SetOutputExtent(0, 260, 0, 160, 0, numSlices - 1);
+  reslice->Update();
+  vtkImageData* output = reslice->GetOutput();
+
+  // the reference interpolator, with the border thickness of vtkImageReslice
+  vtkNew<vtkImageInterpolator> reference;
+  reference->SetInterpolationMode(interpolationMode);
+  reference->SetBorderMode(borderMode);
+  reference->SetTolerance(reslice->GetBorderThickness());
+  reference->Initialize(input);
+  reference->Update();
+  const int numComps = input->GetNumberOfScalarComponents();
+  const double tol = reference->GetTolerance();
+  const int* inExt = input->GetExtent();
+
+  int outExt[6];
+  output->GetExtent(outExt);
+  vtkIdType numInside = 0;
+  for (int k = outExt[4]; k <= outExt[5]; ++k)
+  {
+    for (int j = outExt[2]; j <= outExt[3]; ++j)
+    {
+      for (int i = outExt[0]; i <= outExt[1]; ++i)
+      {
+        double x[4] = { -30.0 + 0.23 * i, -25.0 + 0.31 * j, -0.5 * (numSlices - 1) + k, 1.0 };
+        double p[4];
+        axes->MultiplyPoint(x, p);
+
+        // skip the points that are on the bounds
+        bool onBounds = false;
+        for (int a = 0; a < 3; ++a)
+        {
+          onBounds |= std::abs(p[a] - (inExt[2 * a] - tol)) < 1e-6;
+          onBounds |= std::abs(p[a] - (inExt[2 * a + 1] + tol)) < 1e-6;
+        }
+        if (onBounds)
+        {
+          continue;
+        }
+
+        double expected[4] = { 0.0, 0.0, 0.0, 0.0 };
+        if (reference->CheckBoundsIJK(p))
+        {
+          reference->InterpolateIJK(p, expected);
+          numInside++;
+        }
+        const double* value = static_cast<double*>(output->GetScalarPointer(i, j, k));
+        for (int comp = 0; comp < numComps; ++comp)
+        {
+          if (std::abs(value[comp] - expected[comp]) > 1e-6)
+          {
+            vtkLog(ERROR,
+              "Wrong value " << value[comp] << " instead of " << expected[comp]
+                             << " for interpolation mode " << interpolationMode << ", border mode "
+                             << borderMode << " at " << i << " " << j << " " << k);
+            return false;
+          }
+        }
+      }
+    }
+  }
+
+  if (numInside == 0)
+  {
+    vtkLog(ERROR, "No output voxels inside of the input");
+    return false;
+  }
+  return true;
+}
+}
+
+int TestImageResliceOblique(int, char*[])
+{
+  for (int numComps = 1; numComps <= 3; numComps += 2)
+  {
+    vtkNew<vtkImageData> image;
+    image->SetExtent(0, 39, 0, 36, 0, 32);
+    image->AllocateScalars(VTK_SHORT, numComps);
+    short* values = static_cast<short*>(image->GetScalarPointer());
+    unsigned int seed = 12345;
+    for (vtkIdType i = 0; i < image->GetNumberOfPoints() * numComps; ++i)
+    {
+      seed = seed * 1664525u + 1013904223u;
+      values[i] = static_cast<short>(static_cast<int>((seed >> 16) % 2000) - 1000);
+    }
+
+    for (int mode : { VTK_LINEAR_INTERPOLATION, VTK_CUBIC_INTERPOLATION })
+    {
+      for (vtkImageBorderMode border : { VTK_IMAGE_BORDER_CLAMP, VTK_IMAGE_BORDER_MIRROR })
+      {
+        if (!CheckReslice(image, mode, border, 0.7, 1) ||
+          !CheckReslice(image, mode, border, -2.1, 3))
+        {
+          return EXIT_FAILURE;
+        }
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
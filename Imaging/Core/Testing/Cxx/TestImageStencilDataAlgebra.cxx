@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Build stencils from an implicit function and from a thresholded image, with
+// enough rows to be processed in parallel, and check them and their union,
+// difference and replacement against a voxel by voxel evaluation.
+
+#include "vtkImageData.h"
+#include "vtkImageStencilData.h"
+#include "vtkImageToImageStencil.h"
+#include "vtkImplicitFunctionToImageStencil.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkRTAnalyticSource.h"
+#include "vtkSphere.h"
+
+#include <cstdlib>
+#include <functional>
+
+namespace
+{
+// Check IsInside for each voxel of the extent against a function
+bool CheckStencil(vtkImageStencilData* stencil, const int extent[6],
+  const std::function<bool(int, int, int)>& expected, const char* name)
+{
+  for (int k = extent[4]; k <= extent[5]; ++k)
+  {
+    for (int j = extent[2]; j <= extent[3]; ++j)
+    {
+      for (int i = extent[0]; i <= extent[1]; ++i)
+      {
+        if ((stencil->IsInside(i, j, k) != 0) != expected(i, j, k))
+        {
+          vtkLog(ERROR, "Wrong " << name << " stencil at " << i << " " << j << " " << k);
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+}
+
+int TestImageStencilDataAlgebra(int, char*[])
+{
+  const int extentA[6] = { 0, 63, 0, 63, 0, 31 };
+  const int extentB[6] = { 8, 55, 4, 59, 2, 29 };
+  const int extentAB[6] = { -2, 65, -2, 65, -2, 33 };
+
+  // a sphere
+  vtkNew<vtkSphere> sphere;
+  sphere->SetCenter(30.0, 28.0, 14.0);
+  sphere->SetRadius(20.0);
+  vtkNew<vtkImplicitFunctionToImageStencil> functionToStencil;
+  functionToStencil->SetInput(sphere);
+  functionToStencil->SetOutputWholeExtent(extentA[0], extentA[1], extentA[2], extentA[3],
+    extentA[4], extentA[5]);
+  functionToStencil->Update();
+  vtkImageStencilData* stencilA = functionToStencil->GetOutput();
+  auto insideA = [&](int i, int j, int k) {
+    const double x[3] = { static_cast<double>(i), static_cast<double>(j),
+      static_cast<double>(k) };
+    return i >= extentA[0] && i <= extentA[1] && j >= extentA[2] && j <= extentA[3] &&
+      k >= extentA[4] && k <= extentA[5] && sphere->FunctionValue(x) < 0.0;
+  };
+
+  // a thresholded image
+  vtkNew<vtkRTAnalyticSource> source;
+  source->SetWholeExtent(extentB[0], extentB[1], extentB[2], extentB[3], extentB[4], extentB[5]);
+  source->Update();
+  vtkImageData* image = source->GetOutput();
+  vtkNew<vtkImageToImageStencil> imageToStencil;
+  imageToStencil->SetInputConnection(source->GetOutputPort());
+  imageToStencil->ThresholdBetween(120.0, 220.0);
+  imageToStencil->Update();
+  vtkImageStencilData* stencilB = imageToStencil->GetOutput();
+  auto inBoxB = [&](int i, int j, int k) {
+    return i >= extentB[0] && i <= extentB[1] && j >= extentB[2] && j <= extentB[3] &&
+      k >= extentB[4] && k <= extentB[5];
+  };
+  auto insideB = [&](int i, int j, int k) {
+    if (!inBoxB(i, j, k))
+    {
+      return false;
+    }
+    double value = image->GetScalarComponentAsDouble(i, j, k, 0);
+    return value >= 120.0 && value <= 220.0;
+  };
+
+  if (!CheckStencil(stencilA, extentAB, insideA, "implicit function") ||
+    !CheckStencil(stencilB, extentAB, insideB, "image"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkImageStencilData> unionAB;
+  unionAB->DeepCopy(stencilA);
+  unionAB->Add(stencilB);
+  vtkNew<vtkImageStencilData> differenceAB;
+  differenceAB->DeepCopy(stencilA);
+  differenceAB->Subtract(stencilB);
+  vtkNew<vtkImageStencilData> replaceAB;
+  replaceAB->DeepCopy(stencilA);
+  replaceAB->Replace(stencilB);
+
+  if (!CheckStencil(unionAB, extentAB,
+        [&](int i, int j, int k) { return insideA(i, j, k) || insideB(i, j, k); }, "union") ||
+    !CheckStencil(differenceAB, extentAB,
+      [&](int i, int j, int k) { return insideA(i, j, k) && !insideB(i, j, k); }, "difference") ||
+    !CheckStencil(replaceAB, extentAB,
+      [&](int i, int j, int k) {
+        return (inBoxB(i, j, k) ? insideB(i, j, k) : insideA(i, j, k));
+      },
+      "replace"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
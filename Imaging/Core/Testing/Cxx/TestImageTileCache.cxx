@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Stream an image through vtkImageTileCache, and check the output extents and
+// the reduced levels against the whole image, that the cached tiles are not
+// requested again, that the cache respects its memory limit, and that it is
+// cleared when the input is modified.
+
+#include "vtkCallbackCommand.h"
+#include "vtkCommand.h"
+#include "vtkImageData.h"
+#include "vtkImageTileCache.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkRTAnalyticSource.h"
+
+#include <cmath>
+#include <cstdlib>
+
+namespace
+{
+// Compare the voxels of output within ext to those of reference
+bool CompareExtent(vtkImageData* output, vtkImageData* reference, const int ext[6], const char* what)
+{
+  for (int j = ext[2]; j <= ext[3]; ++j)
+  {
+    for (int i = ext[0]; i <= ext[1]; ++i)
+    {
+      const float value = *static_cast<float*>(output->GetScalarPointer(i, j, ext[4]));
+      const float expected = *static_cast<float*>(reference->GetScalarPointer(i, j, ext[4]));
+      if (std::abs(value - expected) > 1e-4f * std::abs(expected))
+      {
+        vtkLog(ERROR,
+          "Wrong value " << value << " instead of " << expected << " for " << what << " at " << i
+                         << " " << j);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Average the 2x2 voxels of an image with even dimensions along X and Y
+void Reduce(vtkImageData* input, vtkImageData* output)
+{
+  const int* inExt = input->GetExtent();
+  output->SetExtent(inExt[0] / 2, inExt[1] / 2, inExt[2] / 2, inExt[3] / 2, 0, 0);
+  output->AllocateScalars(VTK_FLOAT, 1);
+  const int* outExt = output->GetExtent();
+  for (int j = outExt[2]; j <= outExt[3]; ++j)
+  {
+    for (int i = outExt[0]; i <= outExt[1]; ++i)
+    {
+      double sum = 0.0;
+      for (int y = 2 * j; y <= 2 * j + 1; ++y)
+      {
+        for (int x = 2 * i; x <= 2 * i + 1; ++x)
+        {
+          sum += *static_cast<float*>(input->GetScalarPointer(x, y, 0));
+        }
+      }
+      *static_cast<float*>(output->GetScalarPointer(i, j, 0)) = static_cast<float>(sum / 4);
+    }
+  }
+}
+}
+
+int TestImageTileCache(int, char*[])
+{
+  vtkNew<vtkRTAnalyticSource> source;
+  source->SetWholeExtent(0, 99, 0, 79, 0, 0);
+  int executions = 0;
+  vtkNew<vtkCallbackCommand> counter;
+  counter->SetClientData(&executions);
+  counter->SetCallback([](vtkObject*, unsigned long, void* clientData, void*) {
+    ++*static_cast<int*>(clientData);
+  });
+  source->AddObserver(vtkCommand::StartEvent, counter);
+
+  vtkNew<vtkRTAnalyticSource> referenceSource;
+  referenceSource->SetWholeExtent(0, 99, 0, 79, 0, 0);
+  referenceSource->Update();
+  vtkImageData* reference = referenceSource->GetOutput();
+
+  vtkNew<vtkImageTileCache> cache;
+  cache->SetInputConnection(source->GetOutputPort());
+  cache->SetTileSize(16, 16, 1);
+
+  // each tile of the extent is requested from the source
+  const int ext1[6] = { 10, 60, 5, 40, 0, 0 };
+  cache->UpdateExtent(ext1);
+  if (!CompareExtent(cache->GetOutput(), reference, ext1, "level 0") ||
+    cache->GetNumberOfCachedTiles() != 12 || executions != 12)
+  {
+    vtkLog(ERROR,
+      "Expected 12 tiles and executions, got " << cache->GetNumberOfCachedTiles() << " and "
+                                               << executions);
+    return EXIT_FAILURE;
+  }
+
+  // an extent within the cached tiles does not execute the source
+  const int ext2[6] = { 0, 63, 0, 47, 0, 0 };
+  cache->UpdateExtent(ext2);
+  if (!CompareExtent(cache->GetOutput(), reference, ext2, "cached level 0") || executions != 12)
+  {
+    vtkLog(ERROR, "The source was executed for cached tiles");
+    return EXIT_FAILURE;
+  }
+
+  // the reduced levels
+  vtkNew<vtkImageData> level1;
+  Reduce(reference, level1);
+  vtkNew<vtkImageData> level2;
+  Reduce(level1, level2);
+  cache->SetLevel(2);
+  cache->UpdateWholeExtent();
+  vtkImageData* output = cache->GetOutput();
+  double spacing[3], origin[3];
+  output->GetSpacing(spacing);
+  output->GetOrigin(origin);
+  if (!CompareExtent(output, level2, level2->GetExtent(), "level 2") || spacing[0] != 4.0 ||
+    spacing[1] != 4.0 || origin[0] != 1.5 || origin[1] != 1.5)
+  {
+    vtkLog(ERROR,
+      "Wrong level 2 with spacing " << spacing[0] << " " << spacing[1] << " and origin "
+                                    << origin[0] << " " << origin[1]);
+    return EXIT_FAILURE;
+  }
+
+  // a cache that cannot hold the whole image
+  vtkNew<vtkImageTileCache> smallCache;
+  smallCache->SetInputConnection(source->GetOutputPort());
+  smallCache->SetTileSize(16, 16, 1);
+  smallCache->SetCacheMemoryLimit(16);
+  smallCache->SetLevel(2);
+  smallCache->UpdateWholeExtent();
+  if (!CompareExtent(smallCache->GetOutput(), level2, level2->GetExtent(), "small cache") ||
+    smallCache->GetCachedMemorySize() > 16)
+  {
+    vtkLog(ERROR, "The cache uses " << smallCache->GetCachedMemorySize() << " KiB");
+    return EXIT_FAILURE;
+  }
+
+  // modifying the source clears the cache
+  source->SetMaximum(100.0);
+  referenceSource->SetMaximum(100.0);
+  referenceSource->Update();
+  cache->SetLevel(0);
+  cache->UpdateExtent(ext2);
+  if (!CompareExtent(cache->GetOutput(), reference, ext2, "modified source"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
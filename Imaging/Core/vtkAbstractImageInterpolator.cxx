@@ -87,6 +87,8 @@ vtkAbstractImageInterpolator::vtkAbstractImageInterpolator()
   this->InterpolationFuncFloat = &(vtkInterpolateNOP<float>::InterpolationFunc);
   this->RowInterpolationFuncDouble = &(vtkInterpolateNOP<double>::RowInterpolationFunc);
   this->RowInterpolationFuncFloat = &(vtkInterpolateNOP<float>::RowInterpolationFunc);
+  this->LineInterpolationFuncDouble = nullptr;
+  this->LineInterpolationFuncFloat = nullptr;
 }
 
 //------------------------------------------------------------------------------
@@ -725,6 +727,8 @@ void vtkAbstractImageInterpolator::Update()
     this->InterpolationFuncFloat = &(vtkInterpolateNOP<float>::InterpolationFunc);
     this->RowInterpolationFuncDouble = &(vtkInterpolateNOP<double>::RowInterpolationFunc);
     this->RowInterpolationFuncFloat = &(vtkInterpolateNOP<float>::RowInterpolationFunc);
+    this->LineInterpolationFuncDouble = nullptr;
+    this->LineInterpolationFuncFloat = nullptr;
 
     return;
   }
@@ -811,6 +815,9 @@ void vtkAbstractImageInterpolator::Update()
     this->GetRowInterpolationFunc(&this->RowInterpolationFuncDouble);
     this->GetRowInterpolationFunc(&this->RowInterpolationFuncFloat);
   }
+
+  this->GetLineInterpolationFunc(&this->LineInterpolationFuncDouble);
+  this->GetLineInterpolationFunc(&this->LineInterpolationFuncFloat);
 }
 
 //------------------------------------------------------------------------------
@@ -876,6 +883,48 @@ double vtkAbstractImageInterpolator::Interpolate(double x, double y, double z, i
   return value;
 }
 
+//------------------------------------------------------------------------------
+void vtkAbstractImageInterpolator::InterpolateLineIJK(
+  const double origin[3], const double step[3], int idx, int n, double* value)
+{
+  if (this->LineInterpolationFuncDouble)
+  {
+    this->LineInterpolationFuncDouble(this->InterpolationInfo, origin, step, idx, n, value);
+    return;
+  }
+  int numscalars = this->InterpolationInfo->NumberOfComponents;
+  for (int i = idx; i < idx + n; i++)
+  {
+    double point[3];
+    point[0] = origin[0] + i * step[0];
+    point[1] = origin[1] + i * step[1];
+    point[2] = origin[2] + i * step[2];
+    this->InterpolationFuncDouble(this->InterpolationInfo, point, value);
+    value += numscalars;
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkAbstractImageInterpolator::InterpolateLineIJK(
+  const float origin[3], const float step[3], int idx, int n, float* value)
+{
+  if (this->LineInterpolationFuncFloat)
+  {
+    this->LineInterpolationFuncFloat(this->InterpolationInfo, origin, step, idx, n, value);
+    return;
+  }
+  int numscalars = this->InterpolationInfo->NumberOfComponents;
+  for (int i = idx; i < idx + n; i++)
+  {
+    float point[3];
+    point[0] = origin[0] + i * step[0];
+    point[1] = origin[1] + i * step[1];
+    point[2] = origin[2] + i * step[2];
+    this->InterpolationFuncFloat(this->InterpolationInfo, point, value);
+    value += numscalars;
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkAbstractImageInterpolator::GetInterpolationFunc(
   void (**)(vtkInterpolationInfo*, const double[3], double*))
@@ -900,6 +949,20 @@ void vtkAbstractImageInterpolator::GetRowInterpolationFunc(
 {
 }
 
+//------------------------------------------------------------------------------
+void vtkAbstractImageInterpolator::GetLineInterpolationFunc(
+  void (**doublefunc)(vtkInterpolationInfo*, const double[3], const double[3], int, int, double*))
+{
+  *doublefunc = nullptr;
+}
+
+//------------------------------------------------------------------------------
+void vtkAbstractImageInterpolator::GetLineInterpolationFunc(
+  void (**floatfunc)(vtkInterpolationInfo*, const float[3], const float[3], int, int, float*))
+{
+  *floatfunc = nullptr;
+}
+
 //------------------------------------------------------------------------------
 void vtkAbstractImageInterpolator::GetSlidingWindowFunc(
   void (**)(vtkInterpolationWeights*, int, int, int, double*, int))
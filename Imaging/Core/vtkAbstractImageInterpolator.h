@@ -148,6 +148,19 @@ public:
   bool CheckBoundsIJK(const float x[3]);
   ///@}
 
+  ///@{
+  /**
+   * Interpolate n samples along a line of structured coords, where sample i
+   * is at origin + (idx + i) * step.  All of the samples must be within the
+   * bounds, as checked by CheckBoundsIJK(), and the values are stored one
+   * sample after the other.  This gives the same result as InterpolateIJK()
+   * at each sample, but interpolators can compute the whole line at once.
+   */
+  void InterpolateLineIJK(
+    const double origin[3], const double step[3], int idx, int n, double* value);
+  void InterpolateLineIJK(const float origin[3], const float step[3], int idx, int n, float* value);
+  ///@}
+
   ///@{
   /**
    * The border mode (default: clamp).  This controls how out-of-bounds
@@ -294,6 +307,17 @@ protected:
     void (**floatfunc)(vtkInterpolationWeights*, int, int, int, float*, int));
   ///@}
 
+  ///@{
+  /**
+   * Get the line interpolation functions.  The default is nullptr, in which
+   * case InterpolateLineIJK() calls the interpolation function for each sample.
+   */
+  virtual void GetLineInterpolationFunc(void (**doublefunc)(
+    vtkInterpolationInfo*, const double[3], const double[3], int, int, double*));
+  virtual void GetLineInterpolationFunc(void (**floatfunc)(
+    vtkInterpolationInfo*, const float[3], const float[3], int, int, float*));
+  ///@}
+
   ///@{
   /**
    * Get the sliding window interpolation functions.
@@ -332,6 +356,11 @@ protected:
   void (*RowInterpolationFuncFloat)(
     vtkInterpolationWeights* weights, int idX, int idY, int idZ, float* outPtr, int n);
 
+  void (*LineInterpolationFuncDouble)(vtkInterpolationInfo* info, const double origin[3],
+    const double step[3], int idx, int n, double* outPtr);
+  void (*LineInterpolationFuncFloat)(vtkInterpolationInfo* info, const float origin[3],
+    const float step[3], int idx, int n, float* outPtr);
+
 private:
   vtkAbstractImageInterpolator(const vtkAbstractImageInterpolator&) = delete;
   void operator=(const vtkAbstractImageInterpolator&) = delete;
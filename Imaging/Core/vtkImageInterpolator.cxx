@@ -476,6 +476,318 @@ void vtkImageInterpolatorGetInterpolationFunc(
   }
 }
 
+//------------------------------------------------------------------------------
+// Interpolation along a line of samples.  The indices and the weights are
+// computed for a block of samples at a time, one axis after the other, and
+// then the values of the samples are gathered.  The loops over the samples
+// of a block have no function calls and no switches, so that the compiler
+// can vectorize them.
+
+#define VTK_INTERPOLATE_LINE_BLOCK 64
+
+template <class F, class T>
+struct vtkImageNLCLineInterpolate
+{
+  static void Trilinear(
+    vtkInterpolationInfo* info, const F origin[3], const F step[3], int idx, int n, F* outPtr);
+
+  static void Tricubic(
+    vtkInterpolationInfo* info, const F origin[3], const F step[3], int idx, int n, F* outPtr);
+};
+
+//------------------------------------------------------------------------------
+// For m samples along one axis, where the coordinate of sample i is
+// origin + (idx + i)*step, compute the memory offsets of the two nearest
+// voxels and the fractional offset.  Border() applies the border mode.
+template <class F, int (*Border)(int, int, int)>
+inline void vtkImageInterpolatorLineLinearAxis(F origin, F step, int idx, int m, int minId,
+  int maxId, vtkIdType inc, vtkIdType* fact0, vtkIdType* fact1, F* f)
+{
+  for (int i = 0; i < m; i++)
+  {
+    F x = origin + (idx + i) * step;
+    int inId0 = vtkInterpolationMath::Floor(x, f[i]);
+    int inId1 = inId0 + (f[i] != 0);
+    fact0[i] = Border(inId0, minId, maxId) * inc;
+    fact1[i] = Border(inId1, minId, maxId) * inc;
+  }
+}
+
+//------------------------------------------------------------------------------
+// Same as above, but for the four nearest voxels and their cubic weights
+template <class F, int (*Border)(int, int, int)>
+inline void vtkImageInterpolatorLineCubicAxis(F origin, F step, int idx, int m, int minId,
+  int maxId, vtkIdType inc, vtkIdType fact[4][VTK_INTERPOLATE_LINE_BLOCK],
+  F w[4][VTK_INTERPOLATE_LINE_BLOCK], F* f)
+{
+  for (int i = 0; i < m; i++)
+  {
+    F x = origin + (idx + i) * step;
+    int inId0 = vtkInterpolationMath::Floor(x, f[i]);
+    fact[0][i] = Border(inId0 - 1, minId, maxId) * inc;
+    fact[1][i] = Border(inId0, minId, maxId) * inc;
+    fact[2][i] = Border(inId0 + 1, minId, maxId) * inc;
+    fact[3][i] = Border(inId0 + 2, minId, maxId) * inc;
+
+    F coeffs[4];
+    vtkTricubicInterpWeights(coeffs, f[i]);
+    w[0][i] = coeffs[0];
+    w[1][i] = coeffs[1];
+    w[2][i] = coeffs[2];
+    w[3][i] = coeffs[3];
+  }
+}
+
+//------------------------------------------------------------------------------
+template <class F, class T>
+void vtkImageNLCLineInterpolate<F, T>::Trilinear(
+  vtkInterpolationInfo* info, const F origin[3], const F step[3], int idx, int n, F* outPtr)
+{
+  const T* inPtr = static_cast<const T*>(info->Pointer);
+  int* inExt = info->Extent;
+  vtkIdType* inInc = info->Increments;
+  int numscalars = info->NumberOfComponents;
+  int borderMode = info->BorderMode;
+
+  const int blockSize = VTK_INTERPOLATE_LINE_BLOCK;
+  vtkIdType fact0[3][VTK_INTERPOLATE_LINE_BLOCK];
+  vtkIdType fact1[3][VTK_INTERPOLATE_LINE_BLOCK];
+  F f[3][VTK_INTERPOLATE_LINE_BLOCK];
+
+  for (int i0 = 0; i0 < n; i0 += blockSize)
+  {
+    int m = ((n - i0 < blockSize) ? n - i0 : blockSize);
+
+    // compute the offsets and the fractional offsets for each axis
+    for (int j = 0; j < 3; j++)
+    {
+      int minId = inExt[2 * j];
+      int maxId = inExt[2 * j + 1];
+      int start = idx + i0;
+      switch (borderMode)
+      {
+        case VTK_IMAGE_BORDER_REPEAT:
+          vtkImageInterpolatorLineLinearAxis<F, &vtkInterpolationMath::Wrap>(
+            origin[j], step[j], start, m, minId, maxId, inInc[j], fact0[j], fact1[j], f[j]);
+          break;
+        case VTK_IMAGE_BORDER_MIRROR:
+          vtkImageInterpolatorLineLinearAxis<F, &vtkInterpolationMath::Mirror>(
+            origin[j], step[j], start, m, minId, maxId, inInc[j], fact0[j], fact1[j], f[j]);
+          break;
+        default:
+          vtkImageInterpolatorLineLinearAxis<F, &vtkInterpolationMath::Clamp>(
+            origin[j], step[j], start, m, minId, maxId, inInc[j], fact0[j], fact1[j], f[j]);
+          break;
+      }
+    }
+
+    // gather the values, the arithmetic is the same as for Trilinear()
+    if (numscalars == 1)
+    {
+      for (int i = 0; i < m; i++)
+      {
+        F fx = f[0][i];
+        F fy = f[1][i];
+        F fz = f[2][i];
+        F rx = 1 - fx;
+        F ry = 1 - fy;
+        F rz = 1 - fz;
+
+        F ryrz = ry * rz;
+        F fyrz = fy * rz;
+        F ryfz = ry * fz;
+        F fyfz = fy * fz;
+
+        vtkIdType i00 = fact0[1][i] + fact0[2][i];
+        vtkIdType i01 = fact0[1][i] + fact1[2][i];
+        vtkIdType i10 = fact1[1][i] + fact0[2][i];
+        vtkIdType i11 = fact1[1][i] + fact1[2][i];
+
+        const T* inPtr0 = inPtr + fact0[0][i];
+        const T* inPtr1 = inPtr + fact1[0][i];
+
+        outPtr[i] = (rx *
+            (ryrz * inPtr0[i00] + ryfz * inPtr0[i01] + fyrz * inPtr0[i10] + fyfz * inPtr0[i11]) +
+          fx * (ryrz * inPtr1[i00] + ryfz * inPtr1[i01] + fyrz * inPtr1[i10] + fyfz * inPtr1[i11]));
+      }
+      outPtr += m;
+    }
+    else
+    {
+      for (int i = 0; i < m; i++)
+      {
+        F fx = f[0][i];
+        F fy = f[1][i];
+        F fz = f[2][i];
+        F rx = 1 - fx;
+        F ry = 1 - fy;
+        F rz = 1 - fz;
+
+        F ryrz = ry * rz;
+        F fyrz = fy * rz;
+        F ryfz = ry * fz;
+        F fyfz = fy * fz;
+
+        vtkIdType i00 = fact0[1][i] + fact0[2][i];
+        vtkIdType i01 = fact0[1][i] + fact1[2][i];
+        vtkIdType i10 = fact1[1][i] + fact0[2][i];
+        vtkIdType i11 = fact1[1][i] + fact1[2][i];
+
+        const T* inPtr0 = inPtr + fact0[0][i];
+        const T* inPtr1 = inPtr + fact1[0][i];
+
+        int c = numscalars;
+        do
+        {
+          *outPtr++ = (rx *
+              (ryrz * inPtr0[i00] + ryfz * inPtr0[i01] + fyrz * inPtr0[i10] + fyfz * inPtr0[i11]) +
+            fx *
+              (ryrz * inPtr1[i00] + ryfz * inPtr1[i01] + fyrz * inPtr1[i10] + fyfz * inPtr1[i11]));
+          inPtr0++;
+          inPtr1++;
+        } while (--c);
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+template <class F, class T>
+void vtkImageNLCLineInterpolate<F, T>::Tricubic(
+  vtkInterpolationInfo* info, const F origin[3], const F step[3], int idx, int n, F* outPtr)
+{
+  const T* inPtr = static_cast<const T*>(info->Pointer);
+  int* inExt = info->Extent;
+  vtkIdType* inInc = info->Increments;
+  int numscalars = info->NumberOfComponents;
+  int borderMode = info->BorderMode;
+
+  // check if only one slice in a particular direction
+  int multipleY0 = (inExt[2] != inExt[3]);
+  int multipleZ0 = (inExt[4] != inExt[5]);
+
+  const int blockSize = VTK_INTERPOLATE_LINE_BLOCK;
+  vtkIdType fact[3][4][VTK_INTERPOLATE_LINE_BLOCK];
+  F w[3][4][VTK_INTERPOLATE_LINE_BLOCK];
+  F f[3][VTK_INTERPOLATE_LINE_BLOCK];
+
+  for (int i0 = 0; i0 < n; i0 += blockSize)
+  {
+    int m = ((n - i0 < blockSize) ? n - i0 : blockSize);
+
+    // compute the offsets and the interpolation coefficients for each axis
+    for (int j = 0; j < 3; j++)
+    {
+      int minId = inExt[2 * j];
+      int maxId = inExt[2 * j + 1];
+      int start = idx + i0;
+      switch (borderMode)
+      {
+        case VTK_IMAGE_BORDER_REPEAT:
+          vtkImageInterpolatorLineCubicAxis<F, &vtkInterpolationMath::Wrap>(
+            origin[j], step[j], start, m, minId, maxId, inInc[j], fact[j], w[j], f[j]);
+          break;
+        case VTK_IMAGE_BORDER_MIRROR:
+          vtkImageInterpolatorLineCubicAxis<F, &vtkInterpolationMath::Mirror>(
+            origin[j], step[j], start, m, minId, maxId, inInc[j], fact[j], w[j], f[j]);
+          break;
+        default:
+          vtkImageInterpolatorLineCubicAxis<F, &vtkInterpolationMath::Clamp>(
+            origin[j], step[j], start, m, minId, maxId, inInc[j], fact[j], w[j], f[j]);
+          break;
+      }
+    }
+
+    // gather the values, the arithmetic is the same as for Tricubic()
+    for (int i = 0; i < m; i++)
+    {
+      const vtkIdType factX[4] = { fact[0][0][i], fact[0][1][i], fact[0][2][i], fact[0][3][i] };
+      const F fX[4] = { w[0][0][i], w[0][1][i], w[0][2][i], w[0][3][i] };
+      F fY[4] = { w[1][0][i], w[1][1][i], w[1][2][i], w[1][3][i] };
+      F fZ[4] = { w[2][0][i], w[2][1][i], w[2][2][i], w[2][3][i] };
+
+      // or if fractional offset is zero
+      int multipleY = multipleY0 & (f[1][i] != 0);
+      int multipleZ = multipleZ0 & (f[2][i] != 0);
+
+      // the limits to use when doing the interpolation
+      int j1 = 1 - multipleY;
+      int j2 = 1 + 2 * multipleY;
+
+      int k1 = 1 - multipleZ;
+      int k2 = 1 + 2 * multipleZ;
+
+      // if only one coefficient will be used
+      if (multipleY == 0)
+      {
+        fY[1] = 1;
+      }
+      if (multipleZ == 0)
+      {
+        fZ[1] = 1;
+      }
+
+      const T* inPtr0 = inPtr;
+      int c = numscalars;
+      do // loop over components
+      {
+        F val = 0;
+        int k = k1;
+        do // loop over z
+        {
+          F ifz = fZ[k];
+          vtkIdType factz = fact[2][k][i];
+          int j = j1;
+          do // loop over y
+          {
+            F ify = fY[j];
+            F fzy = ifz * ify;
+            vtkIdType factzy = factz + fact[1][j][i];
+            const T* tmpPtr = inPtr0 + factzy;
+            val += fzy *
+              (fX[0] * tmpPtr[factX[0]] + fX[1] * tmpPtr[factX[1]] + fX[2] * tmpPtr[factX[2]] +
+                fX[3] * tmpPtr[factX[3]]);
+          } while (++j <= j2);
+        } while (++k <= k2);
+
+        *outPtr++ = val;
+        inPtr0++;
+      } while (--c);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Get the line interpolation function for the specified data types
+template <class F>
+void vtkImageInterpolatorGetLineInterpolationFunc(
+  void (**interpolate)(vtkInterpolationInfo*, const F[3], const F[3], int, int, F*), int dataType,
+  int interpolationMode)
+{
+  switch (interpolationMode)
+  {
+    case VTK_LINEAR_INTERPOLATION:
+      switch (dataType)
+      {
+        vtkTemplateAliasMacro(*interpolate = &(vtkImageNLCLineInterpolate<F, VTK_TT>::Trilinear));
+        default:
+          *interpolate = nullptr;
+      }
+      break;
+    case VTK_CUBIC_INTERPOLATION:
+      switch (dataType)
+      {
+        vtkTemplateAliasMacro(*interpolate = &(vtkImageNLCLineInterpolate<F, VTK_TT>::Tricubic));
+        default:
+          *interpolate = nullptr;
+      }
+      break;
+    default:
+      *interpolate = nullptr;
+      break;
+  }
+}
+
 //------------------------------------------------------------------------------
 // Interpolation for precomputed weights
 
@@ -1027,6 +1339,22 @@ void vtkImageInterpolator::GetRowInterpolationFunc(
     func, this->InterpolationInfo->ScalarType, this->InterpolationMode);
 }
 
+//------------------------------------------------------------------------------
+void vtkImageInterpolator::GetLineInterpolationFunc(
+  void (**func)(vtkInterpolationInfo*, const double[3], const double[3], int, int, double*))
+{
+  vtkImageInterpolatorGetLineInterpolationFunc(
+    func, this->InterpolationInfo->ScalarType, this->InterpolationMode);
+}
+
+//------------------------------------------------------------------------------
+void vtkImageInterpolator::GetLineInterpolationFunc(
+  void (**func)(vtkInterpolationInfo*, const float[3], const float[3], int, int, float*))
+{
+  vtkImageInterpolatorGetLineInterpolationFunc(
+    func, this->InterpolationInfo->ScalarType, this->InterpolationMode);
+}
+
 //------------------------------------------------------------------------------
 void vtkImageInterpolator::PrecomputeWeightsForExtent(
   const double matrix[16], const int extent[6], int newExtent[6], vtkInterpolationWeights*& weights)
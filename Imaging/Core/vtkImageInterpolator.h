@@ -109,6 +109,16 @@ protected:
     void (**floatfunc)(vtkInterpolationWeights*, int, int, int, float*, int)) override;
   ///@}
 
+  ///@{
+  /**
+   * Get the line interpolation functions.
+   */
+  void GetLineInterpolationFunc(void (**doublefunc)(
+    vtkInterpolationInfo*, const double[3], const double[3], int, int, double*)) override;
+  void GetLineInterpolationFunc(void (**floatfunc)(
+    vtkInterpolationInfo*, const float[3], const float[3], int, int, float*)) override;
+  ///@}
+
   int InterpolationMode;
 
 private:
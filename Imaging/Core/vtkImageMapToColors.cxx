@@ -11,6 +11,10 @@
 #include "vtkPointData.h"
 #include "vtkScalarsToColors.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <limits>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkImageMapToColors);
@@ -29,6 +33,11 @@ vtkImageMapToColors::vtkImageMapToColors()
   // Black color
   this->NaNColor[0] = this->NaNColor[1] = this->NaNColor[2] = this->NaNColor[3] = 0;
 
+  this->ValueColors = vtkUnsignedCharArray::New();
+
+  // Use vtkSMPTools for the pieces instead of the multi-threader
+  this->EnableSMP = true;
+
   // Make sure the Scalars are used as default ArrayToProcess
   this->SetInputArrayToProcess(0, 0, 0, vtkDataObject::POINT, vtkDataSetAttributes::SCALARS);
 }
@@ -40,6 +49,7 @@ vtkImageMapToColors::~vtkImageMapToColors()
   {
     this->LookupTable->UnRegister(this);
   }
+  this->ValueColors->Delete();
 }
 
 //------------------------------------------------------------------------------
@@ -59,6 +69,103 @@ vtkMTimeType vtkImageMapToColors::GetMTime()
   return t1;
 }
 
+//------------------------------------------------------------------------------
+namespace
+{
+
+// Map each value of an 8-bit or 16-bit type through the lookup table, if the
+// image has more voxels than the type has values
+template <class T>
+void vtkImageMapToColorsMapValues(vtkScalarsToColors* lookupTable, int dataType,
+  int outputFormat, vtkIdType numVoxels, vtkUnsignedCharArray* colors)
+{
+  const int minValue = std::numeric_limits<T>::min();
+  const int numValues = std::numeric_limits<T>::max() - minValue + 1;
+  if (numVoxels < numValues || outputFormat < VTK_LUMINANCE || outputFormat > VTK_RGBA)
+  {
+    return;
+  }
+
+  std::vector<T> values(numValues);
+  for (int i = 0; i < numValues; i++)
+  {
+    values[i] = static_cast<T>(minValue + i);
+  }
+  colors->SetNumberOfComponents(outputFormat);
+  colors->SetNumberOfTuples(numValues);
+  lookupTable->MapScalarsThroughTable2(
+    values.data(), colors->GetPointer(0), dataType, numValues, 1, outputFormat);
+}
+
+// Map a row through the colors of all the values of the type
+template <class T, int N>
+void vtkImageMapToColorsLookup(
+  const T* inPtr, int inIncr, unsigned char* outPtr, int n, const unsigned char* colors)
+{
+  const int minValue = std::numeric_limits<T>::min();
+  for (int i = 0; i < n; i++)
+  {
+    const unsigned char* color = colors + N * (static_cast<int>(*inPtr) - minValue);
+    for (int k = 0; k < N; k++)
+    {
+      outPtr[k] = color[k];
+    }
+    inPtr += inIncr;
+    outPtr += N;
+  }
+}
+
+template <class T>
+void vtkImageMapToColorsLookup(const T* inPtr, int inIncr, unsigned char* outPtr, int n,
+  const unsigned char* colors, int outputFormat)
+{
+  switch (outputFormat)
+  {
+    case VTK_RGBA:
+      vtkImageMapToColorsLookup<T, 4>(inPtr, inIncr, outPtr, n, colors);
+      break;
+    case VTK_RGB:
+      vtkImageMapToColorsLookup<T, 3>(inPtr, inIncr, outPtr, n, colors);
+      break;
+    case VTK_LUMINANCE_ALPHA:
+      vtkImageMapToColorsLookup<T, 2>(inPtr, inIncr, outPtr, n, colors);
+      break;
+    case VTK_LUMINANCE:
+      vtkImageMapToColorsLookup<T, 1>(inPtr, inIncr, outPtr, n, colors);
+      break;
+  }
+}
+
+void vtkImageMapToColorsLookup(const void* inPtr, int dataType, int inIncr,
+  unsigned char* outPtr, int n, const unsigned char* colors, int outputFormat)
+{
+  switch (dataType)
+  {
+    case VTK_CHAR:
+      vtkImageMapToColorsLookup(
+        static_cast<const char*>(inPtr), inIncr, outPtr, n, colors, outputFormat);
+      break;
+    case VTK_SIGNED_CHAR:
+      vtkImageMapToColorsLookup(
+        static_cast<const signed char*>(inPtr), inIncr, outPtr, n, colors, outputFormat);
+      break;
+    case VTK_UNSIGNED_CHAR:
+      vtkImageMapToColorsLookup(
+        static_cast<const unsigned char*>(inPtr), inIncr, outPtr, n, colors, outputFormat);
+      break;
+    case VTK_SHORT:
+      vtkImageMapToColorsLookup(
+        static_cast<const short*>(inPtr), inIncr, outPtr, n, colors, outputFormat);
+      break;
+    case VTK_UNSIGNED_SHORT:
+      vtkImageMapToColorsLookup(
+        static_cast<const unsigned short*>(inPtr), inIncr, outPtr, n, colors, outputFormat);
+      break;
+  }
+}
+
+} // end anonymous namespace
+
 //------------------------------------------------------------------------------
 // This method checks to see if we can simply reference the input data
 int vtkImageMapToColors::RequestData(
@@ -90,7 +197,44 @@ int vtkImageMapToColors::RequestData(
       this->DataWasPassed = 0;
     }
 
-    return this->Superclass::RequestData(request, inputVector, outputVector);
+
+    // Map every value of 8-bit and 16-bit types once if there are more voxels
+    this->ValueColors->Initialize();
+    vtkDataArray* inArray = this->GetInputArrayToProcess(0, inputVector);
+    if (inArray)
+    {
+      int outExt[6];
+      outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), outExt);
+      vtkIdType numVoxels = static_cast<vtkIdType>(outExt[1] - outExt[0] + 1) *
+        (outExt[3] - outExt[2] + 1) * (outExt[5] - outExt[4] + 1);
+      switch (inArray->GetDataType())
+      {
+        case VTK_CHAR:
+          vtkImageMapToColorsMapValues<char>(
+            this->LookupTable, VTK_CHAR, this->OutputFormat, numVoxels, this->ValueColors);
+          break;
+        case VTK_SIGNED_CHAR:
+          vtkImageMapToColorsMapValues<signed char>(
+            this->LookupTable, VTK_SIGNED_CHAR, this->OutputFormat, numVoxels, this->ValueColors);
+          break;
+        case VTK_UNSIGNED_CHAR:
+          vtkImageMapToColorsMapValues<unsigned char>(this->LookupTable, VTK_UNSIGNED_CHAR,
+            this->OutputFormat, numVoxels, this->ValueColors);
+          break;
+        case VTK_SHORT:
+          vtkImageMapToColorsMapValues<short>(
+            this->LookupTable, VTK_SHORT, this->OutputFormat, numVoxels, this->ValueColors);
+          break;
+        case VTK_UNSIGNED_SHORT:
+          vtkImageMapToColorsMapValues<unsigned short>(this->LookupTable, VTK_UNSIGNED_SHORT,
+            this->OutputFormat, numVoxels, this->ValueColors);
+          break;
+      }
+    }
+
+    int rval = this->Superclass::RequestData(request, inputVector, outputVector);
+    this->ValueColors->Initialize();
+    return rval;
   }
 
   return 1;
@@ -155,7 +299,7 @@ int vtkImageMapToColors::RequestInformation(vtkInformation* vtkNotUsed(request),
 
 static void vtkImageMapToColorsExecute(vtkImageMapToColors* self, vtkImageData* inData,
   vtkDataArray* inArray, vtkCharArray* maskArray, vtkImageData* outData, vtkDataArray* outArray,
-  int outExt[6], int id, unsigned char* nanColor)
+  int outExt[6], int id, unsigned char* nanColor, const unsigned char* valueColors)
 {
   int idxY, idxZ;
   int extX, extY, extZ;
@@ -219,8 +363,16 @@ static void vtkImageMapToColorsExecute(vtkImageMapToColors* self, vtkImageData*
         }
         count++;
       }
-      lookupTable->MapScalarsThroughTable2(
-        inPtr1, outPtr1, dataType, extX, numberOfComponents, outputFormat);
+      if (valueColors)
+      {
+        vtkImageMapToColorsLookup(
+          inPtr1, dataType, numberOfComponents, outPtr1, extX, valueColors, outputFormat);
+      }
+      else
+      {
+        lookupTable->MapScalarsThroughTable2(
+          inPtr1, outPtr1, dataType, extX, numberOfComponents, outputFormat);
+      }
       // Handle NaN color when mask
       if (inMask != nullptr)
       {
@@ -287,8 +439,10 @@ void vtkImageMapToColors::ThreadedRequestData(vtkInformation* vtkNotUsed(request
   vtkDataArray* inArray = this->GetInputArrayToProcess(0, inputVector);
 
   // Working method
-  vtkImageMapToColorsExecute(
-    this, inData[0][0], inArray, maskArray, outData[0], outArray, outExt, id, this->NaNColor);
+  const unsigned char* valueColors =
+    (this->ValueColors->GetNumberOfTuples() > 0 ? this->ValueColors->GetPointer(0) : nullptr);
+  vtkImageMapToColorsExecute(this, inData[0][0], inArray, maskArray, outData[0], outArray, outExt,
+    id, this->NaNColor, valueColors);
 }
 
 //------------------------------------------------------------------------------
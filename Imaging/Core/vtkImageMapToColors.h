@@ -10,6 +10,10 @@
  * If the lookup table is not set, or is set to nullptr, then the input
  * data will be passed through if it is already of type VTK_UNSIGNED_CHAR.
  *
+ * For 8-bit and 16-bit input scalars, if the image has more voxels than the
+ * scalar type has values, every value is mapped through the lookup table
+ * once and the voxels are mapped by accessing the resulting colors.
+ *
  * @sa
  * vtkLookupTable vtkScalarsToColors
  */
@@ -22,6 +26,7 @@
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkScalarsToColors;
+class vtkUnsignedCharArray;
 
 class VTKIMAGINGCORE_EXPORT vtkImageMapToColors : public vtkThreadedImageAlgorithm
 {
@@ -106,6 +111,10 @@ protected:
   unsigned char NaNColor[4];
 
 private:
+  // The colors of all the values of an 8-bit or 16-bit type
+  vtkUnsignedCharArray* ValueColors;
+
+
   vtkImageMapToColors(const vtkImageMapToColors&) = delete;
   void operator=(const vtkImageMapToColors&) = delete;
 };
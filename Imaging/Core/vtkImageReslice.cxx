@@ -27,6 +27,10 @@
 #undef VTK_USE_UINT64
 #define VTK_USE_UINT64 0
 
+// the width of the strips that are used for oblique reslicing
+#define VTK_RESLICE_TILE_SIZE 64
+
+#include <algorithm>
 #include <cfloat>
 #include <climits>
 #include <cmath>
@@ -2016,6 +2020,9 @@ void vtkImageResliceExecute(vtkImageReslice* self, vtkDataArray* scalars,
     optimizeNearest = true;
   }
 
+  // can each segment of a row be interpolated at once?
+  bool optimizeLine = !(newtrans || perspective) && nsamples <= 1;
+
   // get pixel information
   int scalarType = outData->GetScalarType();
   int scalarSize = outData->GetScalarSize();
@@ -2180,7 +2187,10 @@ void vtkImageResliceExecute(vtkImageReslice* self, vtkDataArray* scalars,
                 // do the interpolation
                 sampleCount++;
                 isInBounds = true;
-                interpolator->InterpolateIJK(inPoint, tmpPtr);
+                if (!optimizeLine)
+                {
+                  interpolator->InterpolateIJK(inPoint, tmpPtr);
+                }
                 tmpPtr += inComponents;
               }
             }
@@ -2202,6 +2212,13 @@ void vtkImageResliceExecute(vtkImageReslice* self, vtkDataArray* scalars,
 
           if (wasInBounds)
           {
+            if (optimizeLine)
+            {
+              // interpolate all the samples of the segment together
+              interpolator->InterpolateLineIJK(inPoint1, xAxis, startIdX, numpixels,
+                tmpPtr - inComponents * (idX - startIdX));
+            }
+
             if (outputStencil)
             {
               outputStencil->InsertNextExtent(startIdX, endIdX, idY, idZ);
@@ -3290,9 +3307,25 @@ void vtkImageReslice::ThreadedRequestData(vtkInformation* vtkNotUsed(request),
   }
   else
   {
-    vtkImageResliceExecute(this, scalars, this->Interpolator, outData[0], outPtr, this->ScalarShift,
-      this->ScalarScale, (this->HasConvertScalars ? &vtkImageReslice::ConvertScalarsBase : nullptr),
-      outExt, threadId, newmat, newtrans);
+    // if the output rows are oblique to the input rows, then process the
+    // output in strips along X, so that the input voxels that are used for
+    // one row of a strip are still in the cache for the next row
+    int tileSize = outExt[1] - outExt[0] + 1;
+    if (newtrans == nullptr && (newmat[1][0] != 0 || newmat[2][0] != 0) &&
+      tileSize > 2 * VTK_RESLICE_TILE_SIZE)
+    {
+      tileSize = VTK_RESLICE_TILE_SIZE;
+    }
+
+    int tileExt[6] = { outExt[0], outExt[1], outExt[2], outExt[3], outExt[4], outExt[5] };
+    for (tileExt[0] = outExt[0]; tileExt[0] <= outExt[1]; tileExt[0] += tileSize)
+    {
+      tileExt[1] = std::min(tileExt[0] + tileSize - 1, outExt[1]);
+      vtkImageResliceExecute(this, scalars, this->Interpolator, outData[0], outPtr,
+        this->ScalarShift, this->ScalarScale,
+        (this->HasConvertScalars ? &vtkImageReslice::ConvertScalarsBase : nullptr), tileExt,
+        threadId, newmat, newtrans);
+    }
   }
 }
 VTK_ABI_NAMESPACE_END
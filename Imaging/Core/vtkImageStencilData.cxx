@@ -10,6 +10,7 @@
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 
 #include <algorithm>
 #include <cmath>
@@ -21,6 +22,10 @@ vtkStandardNewMacro(vtkImageStencilData);
 namespace
 {
 
+// The number of rows that are combined by each task of the logical
+// operations, the rows are cheap so that small stencils are done serially.
+const vtkIdType vtkImageStencilDataRowsPerTask = 1024;
+
 // Compute a single index from yIdx and zIdx.
 int vtkImageStencilDataIndex(const int extent[6], int yIdx, int zIdx)
 {
@@ -855,11 +860,14 @@ void vtkImageStencilData::LogicalOperationInPlace(vtkImageStencilData* stencil,
     }
   }
 
-  // Iterate over the intersected extent
-  for (int idz = extent[4]; idz <= extent[5]; idz++)
-  {
-    for (int idy = extent[2]; idy <= extent[3]; idy++)
+  // Each row has its own extent list, so the rows are combined in parallel
+  int ySize = extent[3] - extent[2] + 1;
+  vtkIdType numRows = static_cast<vtkIdType>(ySize) * (extent[5] - extent[4] + 1);
+  vtkSMPTools::For(0, numRows, vtkImageStencilDataRowsPerTask, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType row = begin; row < end; row++)
     {
+      int idy = extent[2] + static_cast<int>(row % ySize);
+      int idz = extent[4] + static_cast<int>(row / ySize);
       int incr = vtkImageStencilDataIndex(stencil->Extent, idy, idz);
       int clistlen2 = stencil->ExtentListLengths[incr];
       int* clist2 = stencil->ExtentLists[incr];
@@ -898,7 +906,7 @@ void vtkImageStencilData::LogicalOperationInPlace(vtkImageStencilData* stencil,
         delete[] clist1;
       }
     }
-  }
+  });
 }
 
 //------------------------------------------------------------------------------
@@ -950,7 +958,7 @@ void vtkImageStencilData::Subtract(vtkImageStencilData* stencil1)
 //------------------------------------------------------------------------------
 void vtkImageStencilData::Replace(vtkImageStencilData* stencil1)
 {
-  int extent[6], extent1[6], extent2[6], r1, r2, idy, idz, iter = 0;
+  int extent[6], extent1[6], extent2[6];
   stencil1->GetExtent(extent1);
   this->GetExtent(extent2);
 
@@ -969,12 +977,18 @@ void vtkImageStencilData::Replace(vtkImageStencilData* stencil1)
   extent[4] = (extent1[4] < extent2[4]) ? extent2[4] : extent1[4];
   extent[5] = (extent1[5] > extent2[5]) ? extent2[5] : extent1[5];
 
-  for (idz = extent[4]; idz <= extent[5]; idz++, iter = 0)
-  {
-    for (idy = extent[2]; idy <= extent[3]; idy++, iter = 0)
+  // The rows are replaced in parallel, since each has its own extent list
+  int ySize = extent[3] - extent[2] + 1;
+  vtkIdType numRows = static_cast<vtkIdType>(ySize) * (extent[5] - extent[4] + 1);
+  vtkSMPTools::For(0, numRows, vtkImageStencilDataRowsPerTask, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType row = begin; row < end; row++)
     {
+      int idy = extent[2] + static_cast<int>(row % ySize);
+      int idz = extent[4] + static_cast<int>(row / ySize);
       this->RemoveExtent(extent[0], extent[1], idy, idz);
 
+      int r1, r2;
+      int iter = 0;
       int moreSubExtents = 1;
       while (moreSubExtents)
       {
@@ -986,7 +1000,7 @@ void vtkImageStencilData::Replace(vtkImageStencilData* stencil1)
         }
       }
     }
-  }
+  });
 
   this->Modified();
 }
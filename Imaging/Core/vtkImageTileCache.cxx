@@ -0,0 +1,633 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkImageTileCache.h"
+
+#include "vtkDataArray.h"
+#include "vtkDemandDrivenPipeline.h"
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkSmartPointer.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+#include <algorithm>
+#include <cmath>
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkImageTileCache);
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+// A tile is identified by its level and by its index along each axis
+struct vtkImageTileKey
+{
+  int Level;
+  int Index[3];
+
+  bool operator<(const vtkImageTileKey& other) const
+  {
+    if (this->Level != other.Level)
+    {
+      return this->Level < other.Level;
+    }
+    return std::lexicographical_compare(
+      this->Index, this->Index + 3, other.Index, other.Index + 3);
+  }
+};
+
+//------------------------------------------------------------------------------
+// Floor of a/2, also for negative values
+inline int vtkImageTileHalf(int a)
+{
+  return (a >= 0 ? a / 2 : -((1 - a) / 2));
+}
+
+//------------------------------------------------------------------------------
+// Intersect two extents, return false if the intersection is empty
+inline bool vtkImageTileIntersect(const int ext1[6], const int ext2[6], int ext[6])
+{
+  bool empty = false;
+  for (int i = 0; i < 3; i++)
+  {
+    ext[2 * i] = std::max(ext1[2 * i], ext2[2 * i]);
+    ext[2 * i + 1] = std::min(ext1[2 * i + 1], ext2[2 * i + 1]);
+    empty |= (ext[2 * i] > ext[2 * i + 1]);
+  }
+  return !empty;
+}
+
+//------------------------------------------------------------------------------
+// Convert the average of some voxels to the scalar type
+template <class T>
+inline T vtkImageTileCast(double value, std::true_type)
+{
+  return static_cast<T>(std::floor(value + 0.5));
+}
+
+template <class T>
+inline T vtkImageTileCast(double value, std::false_type)
+{
+  return static_cast<T>(value);
+}
+
+//------------------------------------------------------------------------------
+// Compute each voxel of outData as the average of the voxels 2*i and 2*i+1
+// of inData along X and Y that are within the extent of inData
+template <class T>
+void vtkImageTileReduce(vtkImageData* inData, const T* inPtr, vtkImageData* outData, T* outPtr)
+{
+  const int* inExt = inData->GetExtent();
+  const int* outExt = outData->GetExtent();
+  vtkIdType inInc[3], outInc[3];
+  inData->GetIncrements(inInc);
+  outData->GetIncrements(outInc);
+  int numComps = inData->GetNumberOfScalarComponents();
+
+  for (int idZ = outExt[4]; idZ <= outExt[5]; idZ++)
+  {
+    for (int idY = outExt[2]; idY <= outExt[3]; idY++)
+    {
+      int y0 = std::max(2 * idY, inExt[2]);
+      int y1 = std::min(2 * idY + 1, inExt[3]);
+      const T* inSlice = inPtr + (idZ - inExt[4]) * inInc[2];
+      T* outRow = outPtr + (idY - outExt[2]) * outInc[1] + (idZ - outExt[4]) * outInc[2];
+      for (int idX = outExt[0]; idX <= outExt[1]; idX++)
+      {
+        int x0 = std::max(2 * idX, inExt[0]);
+        int x1 = std::min(2 * idX + 1, inExt[1]);
+        double count = (x1 - x0 + 1) * (y1 - y0 + 1);
+        for (int c = 0; c < numComps; c++)
+        {
+          double sum = 0.0;
+          for (int y = y0; y <= y1; y++)
+          {
+            for (int x = x0; x <= x1; x++)
+            {
+              sum += inSlice[(x - inExt[0]) * inInc[0] + (y - inExt[2]) * inInc[1] + c];
+            }
+          }
+          outRow[(idX - outExt[0]) * outInc[0] + c] =
+            vtkImageTileCast<T>(sum / count, std::is_integral<T>());
+        }
+      }
+    }
+  }
+}
+
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+class vtkImageTileCache::vtkInternals
+{
+public:
+  struct Tile
+  {
+    vtkSmartPointer<vtkImageData> Data;
+    unsigned long Memory;
+    std::list<vtkImageTileKey>::iterator Use;
+  };
+
+  // A tile that is computed from the tiles of the level below
+  struct Node
+  {
+    vtkImageTileKey Key;
+    std::vector<vtkImageTileKey> Children;
+  };
+
+  // The cache, with the keys from the most to the least recently used
+  std::map<vtkImageTileKey, Tile> Tiles;
+  std::list<vtkImageTileKey> Uses;
+  unsigned long Memory = 0;
+
+  // The current request: the tiles of the output, the tiles of level 0 that
+  // must be read from the input, and the tiles that must be computed from
+  // the level below, in the order in which their children are read
+  std::vector<vtkImageTileKey> Outputs;
+  std::vector<vtkImageTileKey> Reads;
+  size_t NextRead = 0;
+  std::vector<Node> Nodes;
+  size_t NextNode = 0;
+  // the tiles that the request still needs, with the number of uses
+  std::map<vtkImageTileKey, int> Pins;
+  bool Streaming = false;
+
+  int WholeExtent[6] = { 0, -1, 0, -1, 0, -1 };
+  int TileSize[3] = { 256, 256, 1 };
+  vtkMTimeType InputTime = 0;
+
+  //----------------------------------------------------------------------------
+  void GetLevelExtent(int level, int ext[6]) const
+  {
+    std::copy(this->WholeExtent, this->WholeExtent + 6, ext);
+    for (int l = 0; l < level; l++)
+    {
+      for (int i = 0; i < 4; i++)
+      {
+        ext[i] = vtkImageTileHalf(ext[i]);
+      }
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  void GetTileExtent(const vtkImageTileKey& key, int ext[6]) const
+  {
+    int levelExt[6];
+    this->GetLevelExtent(key.Level, levelExt);
+    for (int i = 0; i < 3; i++)
+    {
+      ext[2 * i] = levelExt[2 * i] + key.Index[i] * this->TileSize[i];
+      ext[2 * i + 1] = std::min(ext[2 * i] + this->TileSize[i] - 1, levelExt[2 * i + 1]);
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // The extent of the level below that is reduced to ext
+  void GetSourceExtent(int level, const int ext[6], int sourceExt[6]) const
+  {
+    int levelExt[6];
+    this->GetLevelExtent(level - 1, levelExt);
+    for (int i = 0; i < 2; i++)
+    {
+      sourceExt[2 * i] = std::max(2 * ext[2 * i], levelExt[2 * i]);
+      sourceExt[2 * i + 1] = std::min(2 * ext[2 * i + 1] + 1, levelExt[2 * i + 1]);
+    }
+    sourceExt[4] = ext[4];
+    sourceExt[5] = ext[5];
+  }
+
+  //----------------------------------------------------------------------------
+  // Append the keys of the tiles of a level that intersect ext, which must
+  // be within the extent of the level
+  void GetTiles(int level, const int ext[6], std::vector<vtkImageTileKey>& keys) const
+  {
+    int levelExt[6];
+    this->GetLevelExtent(level, levelExt);
+    int lo[3], hi[3];
+    for (int i = 0; i < 3; i++)
+    {
+      lo[i] = (ext[2 * i] - levelExt[2 * i]) / this->TileSize[i];
+      hi[i] = (ext[2 * i + 1] - levelExt[2 * i]) / this->TileSize[i];
+    }
+    for (int k = lo[2]; k <= hi[2]; k++)
+    {
+      for (int j = lo[1]; j <= hi[1]; j++)
+      {
+        for (int i = lo[0]; i <= hi[0]; i++)
+        {
+          keys.push_back(vtkImageTileKey{ level, { i, j, k } });
+        }
+      }
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Get a tile from the cache, and mark it as the most recently used
+  vtkImageData* Find(const vtkImageTileKey& key)
+  {
+    auto tile = this->Tiles.find(key);
+    if (tile == this->Tiles.end())
+    {
+      return nullptr;
+    }
+    this->Uses.splice(this->Uses.begin(), this->Uses, tile->second.Use);
+    return tile->second.Data;
+  }
+
+  //----------------------------------------------------------------------------
+  void Insert(const vtkImageTileKey& key, vtkImageData* data)
+  {
+    auto tile = this->Tiles.find(key);
+    if (tile != this->Tiles.end())
+    {
+      this->Memory -= tile->second.Memory;
+      this->Uses.erase(tile->second.Use);
+      this->Tiles.erase(tile);
+    }
+    this->Uses.push_front(key);
+    Tile& newTile = this->Tiles[key];
+    newTile.Data = data;
+    newTile.Memory = data->GetActualMemorySize();
+    newTile.Use = this->Uses.begin();
+    this->Memory += newTile.Memory;
+  }
+
+  //----------------------------------------------------------------------------
+  // Release the least recently used tiles that the current request does not
+  // need, until the memory is within the limit
+  void Release(unsigned long limit)
+  {
+    auto use = this->Uses.end();
+    while (this->Memory > limit && use != this->Uses.begin())
+    {
+      --use;
+      if (this->Pins.count(*use) == 0)
+      {
+        auto tile = this->Tiles.find(*use);
+        this->Memory -= tile->second.Memory;
+        this->Tiles.erase(tile);
+        use = this->Uses.erase(use);
+      }
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  void Clear()
+  {
+    this->Tiles.clear();
+    this->Uses.clear();
+    this->Memory = 0;
+    this->EndRequest();
+  }
+
+  //----------------------------------------------------------------------------
+  // Find the tiles that must be read or computed for a tile that is needed
+  void Collect(const vtkImageTileKey& key, std::set<vtkImageTileKey>& visited)
+  {
+    if (!visited.insert(key).second || this->Tiles.count(key) != 0)
+    {
+      return;
+    }
+    if (key.Level == 0)
+    {
+      this->Reads.push_back(key);
+      return;
+    }
+    Node node;
+    node.Key = key;
+    int ext[6], sourceExt[6];
+    this->GetTileExtent(key, ext);
+    this->GetSourceExtent(key.Level, ext, sourceExt);
+    this->GetTiles(key.Level - 1, sourceExt, node.Children);
+    for (const vtkImageTileKey& child : node.Children)
+    {
+      this->Pins[child]++;
+      this->Collect(child, visited);
+    }
+    this->Nodes.push_back(node);
+  }
+
+  //----------------------------------------------------------------------------
+  void StartRequest(int level, const int ext[6])
+  {
+    this->EndRequest();
+    int levelExt[6], outExt[6];
+    this->GetLevelExtent(level, levelExt);
+    if (vtkImageTileIntersect(ext, levelExt, outExt))
+    {
+      this->GetTiles(level, outExt, this->Outputs);
+    }
+    std::set<vtkImageTileKey> visited;
+    for (const vtkImageTileKey& key : this->Outputs)
+    {
+      this->Pins[key]++;
+      this->Collect(key, visited);
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  void EndRequest()
+  {
+    this->Outputs.clear();
+    this->Reads.clear();
+    this->NextRead = 0;
+    this->Nodes.clear();
+    this->NextNode = 0;
+    this->Pins.clear();
+    this->Streaming = false;
+  }
+
+  //----------------------------------------------------------------------------
+  // Compute the tiles whose children are all in the cache, in order
+  void Reduce()
+  {
+    for (; this->NextNode < this->Nodes.size(); this->NextNode++)
+    {
+      const Node& node = this->Nodes[this->NextNode];
+      for (const vtkImageTileKey& child : node.Children)
+      {
+        if (this->Tiles.count(child) == 0)
+        {
+          return;
+        }
+      }
+
+      // gather the children into the source extent
+      int ext[6], sourceExt[6];
+      this->GetTileExtent(node.Key, ext);
+      this->GetSourceExtent(node.Key.Level, ext, sourceExt);
+      vtkNew<vtkImageData> source;
+      source->SetExtent(sourceExt);
+      vtkDataArray* scalars = nullptr;
+      for (const vtkImageTileKey& child : node.Children)
+      {
+        vtkImageData* childData = this->Find(child);
+        if (!scalars)
+        {
+          scalars = childData->GetPointData()->GetScalars();
+          source->AllocateScalars(scalars->GetDataType(), scalars->GetNumberOfComponents());
+        }
+        int childExt[6];
+        if (vtkImageTileIntersect(childData->GetExtent(), sourceExt, childExt))
+        {
+          source->CopyAndCastFrom(childData, childExt);
+        }
+      }
+
+      vtkNew<vtkImageData> tile;
+      tile->SetExtent(ext);
+      tile->AllocateScalars(scalars->GetDataType(), scalars->GetNumberOfComponents());
+      tile->GetPointData()->GetScalars()->SetName(scalars->GetName());
+      switch (scalars->GetDataType())
+      {
+        vtkTemplateMacro(vtkImageTileReduce(source,
+          static_cast<const VTK_TT*>(source->GetScalarPointer()), tile,
+          static_cast<VTK_TT*>(tile->GetScalarPointer())));
+      }
+      this->Insert(node.Key, tile);
+
+      for (const vtkImageTileKey& child : node.Children)
+      {
+        auto pin = this->Pins.find(child);
+        if (pin != this->Pins.end() && --pin->second == 0)
+        {
+          this->Pins.erase(pin);
+        }
+      }
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+vtkImageTileCache::vtkImageTileCache()
+  : Internals(new vtkInternals)
+{
+  this->TileSize[0] = 256;
+  this->TileSize[1] = 256;
+  this->TileSize[2] = 1;
+  this->Level = 0;
+  this->CacheMemoryLimit = 262144;
+}
+
+//------------------------------------------------------------------------------
+vtkImageTileCache::~vtkImageTileCache() = default;
+
+//------------------------------------------------------------------------------
+void vtkImageTileCache::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "TileSize: (" << this->TileSize[0] << ", " << this->TileSize[1] << ", "
+     << this->TileSize[2] << ")\n";
+  os << indent << "Level: " << this->Level << "\n";
+  os << indent << "CacheMemoryLimit: " << this->CacheMemoryLimit << "\n";
+}
+
+//------------------------------------------------------------------------------
+void vtkImageTileCache::SetTileSize(int x, int y, int z)
+{
+  x = std::max(x, 1);
+  y = std::max(y, 1);
+  z = std::max(z, 1);
+  if (x != this->TileSize[0] || y != this->TileSize[1] || z != this->TileSize[2])
+  {
+    this->TileSize[0] = x;
+    this->TileSize[1] = y;
+    this->TileSize[2] = z;
+    this->ClearCache();
+    std::copy(this->TileSize, this->TileSize + 3, this->Internals->TileSize);
+    this->Modified();
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkImageTileCache::ClearCache()
+{
+  this->Internals->Clear();
+}
+
+//------------------------------------------------------------------------------
+int vtkImageTileCache::GetNumberOfCachedTiles()
+{
+  return static_cast<int>(this->Internals->Tiles.size());
+}
+
+//------------------------------------------------------------------------------
+unsigned long vtkImageTileCache::GetCachedMemorySize()
+{
+  return this->Internals->Memory;
+}
+
+//------------------------------------------------------------------------------
+int vtkImageTileCache::RequestInformation(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  vtkInternals* internals = this->Internals.get();
+
+  int wholeExt[6];
+  double spacing[3], origin[3];
+  double direction[9] = { 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0 };
+  inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExt);
+  inInfo->Get(vtkDataObject::SPACING(), spacing);
+  inInfo->Get(vtkDataObject::ORIGIN(), origin);
+  if (inInfo->Has(vtkDataObject::DIRECTION()))
+  {
+    inInfo->Get(vtkDataObject::DIRECTION(), direction);
+  }
+
+  // the cached tiles are obsolete if the input was modified
+  vtkMTimeType inputTime = 0;
+  vtkDemandDrivenPipeline* inputExecutive =
+    vtkDemandDrivenPipeline::SafeDownCast(this->GetInputExecutive(0, 0));
+  if (inputExecutive)
+  {
+    inputTime = inputExecutive->GetPipelineMTime();
+  }
+  if (inputTime > internals->InputTime ||
+    !std::equal(wholeExt, wholeExt + 6, internals->WholeExtent))
+  {
+    internals->Clear();
+    std::copy(wholeExt, wholeExt + 6, internals->WholeExtent);
+  }
+  internals->InputTime = inputTime;
+
+  // the voxels of a level are at the centers of the voxels that they average
+  int ext[6];
+  internals->GetLevelExtent(this->Level, ext);
+  double factor = static_cast<double>(1 << this->Level);
+  double shift[2] = { 0.5 * (factor - 1.0) * spacing[0], 0.5 * (factor - 1.0) * spacing[1] };
+  for (int i = 0; i < 3; i++)
+  {
+    origin[i] += direction[3 * i] * shift[0] + direction[3 * i + 1] * shift[1];
+  }
+  spacing[0] *= factor;
+  spacing[1] *= factor;
+
+  outInfo->Set(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), ext, 6);
+  outInfo->Set(vtkDataObject::SPACING(), spacing, 3);
+  outInfo->Set(vtkDataObject::ORIGIN(), origin, 3);
+
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkImageTileCache::RequestUpdateExtent(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  vtkInternals* internals = this->Internals.get();
+
+  // find the tiles that are missing for a new request
+  if (!internals->Streaming)
+  {
+    int outExt[6];
+    outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), outExt);
+    internals->StartRequest(this->Level, outExt);
+  }
+
+  // request the next missing tile of level 0, or nothing
+  int inExt[6] = { 0, -1, 0, -1, 0, -1 };
+  if (internals->NextRead < internals->Reads.size())
+  {
+    internals->GetTileExtent(internals->Reads[internals->NextRead], inExt);
+  }
+  inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), inExt, 6);
+
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkImageTileCache::RequestData(
+  vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  vtkInformation* outInfo = outputVector->GetInformationObject(0);
+  vtkImageData* input = vtkImageData::GetData(inInfo);
+  vtkImageData* output = vtkImageData::GetData(outInfo);
+  vtkInternals* internals = this->Internals.get();
+
+  // add the tile that was requested from the input to the cache
+  if (internals->NextRead < internals->Reads.size())
+  {
+    int tileExt[6], ext[6];
+    internals->GetTileExtent(internals->Reads[internals->NextRead], tileExt);
+    vtkDataArray* scalars = (input ? input->GetPointData()->GetScalars() : nullptr);
+    if (!scalars || !vtkImageTileIntersect(input->GetExtent(), tileExt, ext) ||
+      !std::equal(ext, ext + 6, tileExt))
+    {
+      vtkErrorMacro("The input has no scalars for the extent " << tileExt[0] << " " << tileExt[1]
+                                                              << " " << tileExt[2] << " "
+                                                              << tileExt[3] << " " << tileExt[4]
+                                                              << " " << tileExt[5]);
+      internals->EndRequest();
+      request->Remove(vtkStreamingDemandDrivenPipeline::CONTINUE_EXECUTING());
+      return 0;
+    }
+
+    vtkNew<vtkImageData> tile;
+    tile->SetExtent(tileExt);
+    tile->AllocateScalars(scalars->GetDataType(), scalars->GetNumberOfComponents());
+    tile->GetPointData()->GetScalars()->SetName(scalars->GetName());
+    tile->CopyAndCastFrom(input, tileExt);
+    internals->Insert(internals->Reads[internals->NextRead], tile);
+    internals->NextRead++;
+
+    // compute the tiles of the reduced levels as soon as possible, so that
+    // the tiles of the levels below can be released
+    internals->Reduce();
+    internals->Release(this->CacheMemoryLimit);
+  }
+
+  if (internals->NextRead < internals->Reads.size())
+  {
+    // tell the pipeline to execute again for the next tile
+    internals->Streaming = true;
+    request->Set(vtkStreamingDemandDrivenPipeline::CONTINUE_EXECUTING(), 1);
+    this->UpdateProgress(
+      static_cast<double>(internals->NextRead) / static_cast<double>(internals->Reads.size()));
+    return 1;
+  }
+  request->Remove(vtkStreamingDemandDrivenPipeline::CONTINUE_EXECUTING());
+  internals->Streaming = false;
+  internals->Reduce();
+
+  // copy the tiles to the output
+  int outExt[6], levelExt[6], ext[6];
+  outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), outExt);
+  internals->GetLevelExtent(this->Level, levelExt);
+  if (vtkImageTileIntersect(outExt, levelExt, ext))
+  {
+    this->AllocateOutputData(output, outInfo, ext);
+    vtkDataArray* outScalars = output->GetPointData()->GetScalars();
+    for (const vtkImageTileKey& key : internals->Outputs)
+    {
+      vtkImageData* tile = internals->Find(key);
+      int tileExt[6];
+      if (tile && vtkImageTileIntersect(tile->GetExtent(), ext, tileExt))
+      {
+        output->CopyAndCastFrom(tile, tileExt);
+        outScalars->SetName(tile->GetPointData()->GetScalars()->GetName());
+      }
+    }
+  }
+
+  internals->EndRequest();
+  internals->Release(this->CacheMemoryLimit);
+  this->UpdateProgress(1.0);
+
+  return 1;
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,114 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkImageTileCache
+ * @brief   Streams an image through a cache of tiles and of reduced levels.
+ *
+ * vtkImageTileCache divides the whole extent of its input into tiles of a
+ * fixed size, and keeps the tiles of previous updates in a cache with a
+ * memory limit.  To satisfy a request, it updates its input once for each
+ * tile of the requested extent that is not in the cache, so that the readers
+ * and filters upstream only process tiles, and panning over a large image
+ * only executes them for the tiles that were never seen or that were released.
+ * When the cache exceeds its memory limit, the least recently used tiles are
+ * released.
+ *
+ * The output can also be a reduced level of the input, to view large images
+ * as a multi-resolution pyramid.  Each level halves the dimensions of the
+ * level below along X and Y by averaging 2x2 voxels, and is divided in tiles
+ * that are cached as well.  The tiles of a level are computed from the tiles
+ * of the level below as soon as these are available, so that requesting a
+ * reduced level of an image that does not fit in the memory limit streams it
+ * from the input.
+ *
+ * Only the point scalars of the input are cached.  The cache is cleared when
+ * the input is modified, or when the tile size is changed.
+ *
+ * @sa
+ * vtkImageDataStreamer vtkImageCacheFilter
+ */
+
+#ifndef vtkImageTileCache_h
+#define vtkImageTileCache_h
+
+#include "vtkImageAlgorithm.h"
+#include "vtkImagingCoreModule.h" // For export macro
+
+#include <memory> // For std::unique_ptr
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKIMAGINGCORE_EXPORT vtkImageTileCache : public vtkImageAlgorithm
+{
+public:
+  static vtkImageTileCache* New();
+  vtkTypeMacro(vtkImageTileCache, vtkImageAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * The size of the tiles in voxels, the default is 256x256x1.  The tiles
+   * are aligned with the lower corner of the whole extent of each level.
+   * Changing the tile size clears the cache.
+   */
+  void SetTileSize(int x, int y, int z);
+  void SetTileSize(const int size[3]) { this->SetTileSize(size[0], size[1], size[2]); }
+  vtkGetVector3Macro(TileSize, int);
+  ///@}
+
+  ///@{
+  /**
+   * The level of the output, the default is 0 for the input itself.  The
+   * dimensions of level n are those of the input divided by 2^n along X and
+   * Y, and its spacing is multiplied by 2^n.
+   */
+  vtkSetClampMacro(Level, int, 0, 30);
+  vtkGetMacro(Level, int);
+  ///@}
+
+  ///@{
+  /**
+   * The memory limit of the cache in kibibytes, the default is 262144
+   * (256 MiB).  The tiles that are used by the current request are kept
+   * until it is complete, even if they exceed the limit.
+   */
+  vtkSetMacro(CacheMemoryLimit, unsigned long);
+  vtkGetMacro(CacheMemoryLimit, unsigned long);
+  ///@}
+
+  /**
+   * Release all the tiles of the cache.
+   */
+  void ClearCache();
+
+  /**
+   * Get the number of tiles in the cache, for all the levels.
+   */
+  int GetNumberOfCachedTiles();
+
+  /**
+   * Get the memory used by the tiles of the cache, in kibibytes.
+   */
+  unsigned long GetCachedMemorySize();
+
+protected:
+  vtkImageTileCache();
+  ~vtkImageTileCache() override;
+
+  int RequestInformation(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+  int RequestUpdateExtent(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
+  int TileSize[3];
+  int Level;
+  unsigned long CacheMemoryLimit;
+
+private:
+  vtkImageTileCache(const vtkImageTileCache&) = delete;
+  void operator=(const vtkImageTileCache&) = delete;
+
+  class vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
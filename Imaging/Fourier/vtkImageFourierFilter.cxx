@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkImageFourierFilter.h"
 
+#include "vtkFFT.h"
 #include "vtkMath.h"
 #include <cmath>
 
@@ -202,7 +203,7 @@ void vtkImageFourierFilter::ExecuteFftForwardBackward(
 // (It is engineered for no decimation)
 void vtkImageFourierFilter::ExecuteFft(vtkImageComplex* in, vtkImageComplex* out, int N)
 {
-  this->ExecuteFftForwardBackward(in, out, N, 1);
+  this->ExecuteFftBatch(in, out, N, 1);
 }
 
 //------------------------------------------------------------------------------
@@ -211,7 +212,32 @@ void vtkImageFourierFilter::ExecuteFft(vtkImageComplex* in, vtkImageComplex* out
 // (It is engineered for no decimation)
 void vtkImageFourierFilter::ExecuteRfft(vtkImageComplex* in, vtkImageComplex* out, int N)
 {
-  this->ExecuteFftForwardBackward(in, out, N, -1);
+  this->ExecuteRfftBatch(in, out, N, 1);
+}
+
+//------------------------------------------------------------------------------
+// vtkImageComplex and vtkFFT::ComplexNumber are both a pair of doubles.
+static_assert(sizeof(vtkImageComplex) == sizeof(vtkFFT::ComplexNumber) &&
+    sizeof(vtkFFT::ScalarNumber) == sizeof(double),
+  "vtkImageComplex and vtkFFT::ComplexNumber must have the same layout");
+
+//------------------------------------------------------------------------------
+// This function calculates the fft of count arrays stored one after the other.
+void vtkImageFourierFilter::ExecuteFftBatch(
+  vtkImageComplex* in, vtkImageComplex* out, int N, int count)
+{
+  vtkFFT::BatchFft(reinterpret_cast<const vtkFFT::ComplexNumber*>(in), N, count,
+    reinterpret_cast<vtkFFT::ComplexNumber*>(out));
+}
+
+//------------------------------------------------------------------------------
+// This function calculates the reverse fft of count arrays stored one after
+// the other.
+void vtkImageFourierFilter::ExecuteRfftBatch(
+  vtkImageComplex* in, vtkImageComplex* out, int N, int count)
+{
+  vtkFFT::BatchIFft(reinterpret_cast<const vtkFFT::ComplexNumber*>(in), N, count,
+    reinterpret_cast<vtkFFT::ComplexNumber*>(out));
 }
 
 //------------------------------------------------------------------------------
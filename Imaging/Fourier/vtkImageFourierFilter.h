@@ -116,6 +116,16 @@ public:
    */
   void ExecuteRfft(vtkImageComplex* in, vtkImageComplex* out, int N);
 
+  ///@{
+  /**
+   * These functions calculate the fft, or the reverse fft, of count arrays
+   * of N complex numbers stored one after the other. The transform is set up
+   * once for all the arrays, with vtkFFT.
+   */
+  void ExecuteFftBatch(vtkImageComplex* in, vtkImageComplex* out, int N, int count);
+  void ExecuteRfftBatch(vtkImageComplex* in, vtkImageComplex* out, int N, int count);
+  ///@}
+
 protected:
   vtkImageFourierFilter() = default;
   ~vtkImageFourierFilter() override = default;
@@ -8,6 +8,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
+#include <algorithm>
 #include <cmath>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -63,11 +64,11 @@ void vtkImageRFFTExecute(vtkImageRFFT* self, vtkImageData* inData, int inExt[6],
   //
   int inMin0, inMax0;
   vtkIdType inInc0, inInc1, inInc2;
-  T *inPtr0, *inPtr1, *inPtr2;
+  T* inPtr0;
   //
   int outMin0, outMax0, outMin1, outMax1, outMin2, outMax2;
   vtkIdType outInc0, outInc1, outInc2;
-  double *outPtr0, *outPtr1, *outPtr2;
+  double* outPtr0;
   //
   int idx0, idx1, idx2, inSize0, numberOfComponents;
   unsigned long count = 0;
@@ -100,22 +101,27 @@ void vtkImageRFFTExecute(vtkImageRFFT* self, vtkImageData* inData, int inExt[6],
     return;
   }
 
-  // Allocate the arrays of complex numbers
-  inComplex = new vtkImageComplex[inSize0];
-  outComplex = new vtkImageComplex[inSize0];
+  // Allocate the arrays of complex numbers for a batch of lines
+  const int batchSize = 32;
+  inComplex = new vtkImageComplex[inSize0 * batchSize];
+  outComplex = new vtkImageComplex[inSize0 * batchSize];
 
   target = static_cast<unsigned long>(
     (outMax2 - outMin2 + 1) * (outMax1 - outMin1 + 1) * self->GetNumberOfIterations() / 50.0);
   target++;
 
-  // loop over other axes
-  inPtr2 = inPtr;
-  outPtr2 = outPtr;
-  for (idx2 = outMin2; idx2 <= outMax2; ++idx2)
+  // loop over the lines along the other axes, one batch at a time so that
+  // the setup of the transform is shared by the lines of the batch
+  vtkIdType numLines1 = outMax1 - outMin1 + 1;
+  vtkIdType numLines = numLines1 * (outMax2 - outMin2 + 1);
+  for (vtkIdType firstLine = 0; !self->AbortExecute && firstLine < numLines;
+       firstLine += batchSize)
   {
-    inPtr1 = inPtr2;
-    outPtr1 = outPtr2;
-    for (idx1 = outMin1; !self->AbortExecute && idx1 <= outMax1; ++idx1)
+    int batchCount = static_cast<int>(std::min<vtkIdType>(batchSize, numLines - firstLine));
+
+    // copy into complex numbers
+    pComplex = inComplex;
+    for (int line = 0; line < batchCount; ++line)
     {
       if (!id)
       {
@@ -125,9 +131,9 @@ void vtkImageRFFTExecute(vtkImageRFFT* self, vtkImageData* inData, int inExt[6],
         }
         count++;
       }
-      // copy into complex numbers
-      inPtr0 = inPtr1;
-      pComplex = inComplex;
+      idx1 = static_cast<int>((firstLine + line) % numLines1);
+      idx2 = static_cast<int>((firstLine + line) / numLines1);
+      inPtr0 = inPtr + idx1 * inInc1 + idx2 * inInc2;
       for (idx0 = inMin0; idx0 <= inMax0; ++idx0)
       {
         pComplex->Real = static_cast<double>(*inPtr0);
@@ -139,13 +145,18 @@ void vtkImageRFFTExecute(vtkImageRFFT* self, vtkImageData* inData, int inExt[6],
         inPtr0 += inInc0;
         ++pComplex;
       }
+    }
 
-      // Call the method that performs the RFFT
-      self->ExecuteRfft(inComplex, outComplex, inSize0);
+    // Call the method that performs the RFFT
+    self->ExecuteRfftBatch(inComplex, outComplex, inSize0, batchCount);
 
-      // copy into output
-      outPtr0 = outPtr1;
-      pComplex = outComplex + (outMin0 - inMin0);
+    // copy into output
+    for (int line = 0; line < batchCount; ++line)
+    {
+      idx1 = static_cast<int>((firstLine + line) % numLines1);
+      idx2 = static_cast<int>((firstLine + line) / numLines1);
+      outPtr0 = outPtr + idx1 * outInc1 + idx2 * outInc2;
+      pComplex = outComplex + line * inSize0 + (outMin0 - inMin0);
       for (idx0 = outMin0; idx0 <= outMax0; ++idx0)
       {
         *outPtr0 = static_cast<double>(pComplex->Real);
@@ -153,11 +164,7 @@ void vtkImageRFFTExecute(vtkImageRFFT* self, vtkImageData* inData, int inExt[6],
         outPtr0 += outInc0;
         ++pComplex;
       }
-      inPtr1 += inInc1;
-      outPtr1 += outInc1;
     }
-    inPtr2 += inInc2;
-    outPtr2 += outInc2;
   }
 
   delete[] inComplex;
@@ -6,9 +6,13 @@
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkImageEuclideanDistance);
@@ -20,6 +24,7 @@ vtkImageEuclideanDistance::vtkImageEuclideanDistance()
   this->MaximumDistance = VTK_INT_MAX;
   this->Initialize = 1;
   this->ConsiderAnisotropy = 1;
+  this->SignedDistance = 0;
   this->Algorithm = VTK_EDT_SAITO;
 }
 
@@ -106,6 +111,7 @@ void vtkImageEuclideanDistanceInitialize(vtkImageEuclideanDistance* self, vtkIma
 
   int idx0, idx1, idx2;
   double maxDist;
+  double insideDist;
 
   // Reorder axes
   self->PermuteExtent(outExt, outMin0, outMax0, outMin1, outMax1, outMin2, outMax2);
@@ -114,10 +120,13 @@ void vtkImageEuclideanDistanceInitialize(vtkImageEuclideanDistance* self, vtkIma
 
   if (self->GetInitialize() == 1)
   // Initialization required. Input image is only used as binary mask,
-  // so all non-zero values are set to maxDist
+  // so all non-zero values are set to maxDist. For a signed distance map,
+  // the zero values are set to -maxDist.
   //
   {
     maxDist = self->GetMaximumDistance();
+    insideDist =
+      (self->GetSignedDistance() && self->GetAlgorithm() == VTK_EDT_FELZENSZWALB) ? -maxDist : 0;
 
     inPtr2 = inPtr;
     outPtr2 = outPtr;
@@ -134,7 +143,7 @@ void vtkImageEuclideanDistanceInitialize(vtkImageEuclideanDistance* self, vtkIma
         {
           if (*inPtr0 == 0)
           {
-            *outPtr0 = 0;
+            *outPtr0 = insideDist;
           }
           else
           {
@@ -600,6 +609,116 @@ static void vtkImageEuclideanDistanceExecuteSaitoCached(
   free(temp);
   free(sq);
 }
+//------------------------------------------------------------------------------
+// Distance transform of the sampled function f along a line:
+// d[q] = min_p (f[p] + spacing2 * (q - p)^2), computed as the lower envelope
+// of the parabolas rooted at each sample. v holds the roots of the parabolas
+// of the envelope and z the boundaries between them.
+static void vtkImageEuclideanDistanceTransformLine(
+  const double* f, int n, double spacing2, double* d, int* v, double* z)
+{
+  auto intersection = [&](int q, int p) {
+    return ((f[q] + spacing2 * q * q) - (f[p] + spacing2 * p * p)) / (2.0 * spacing2 * (q - p));
+  };
+
+  int k = 0;
+  v[0] = 0;
+  z[0] = -std::numeric_limits<double>::infinity();
+  z[1] = std::numeric_limits<double>::infinity();
+  for (int q = 1; q < n; ++q)
+  {
+    double s = intersection(q, v[k]);
+    while (s <= z[k])
+    {
+      --k;
+      s = intersection(q, v[k]);
+    }
+    ++k;
+    v[k] = q;
+    z[k] = s;
+    z[k + 1] = std::numeric_limits<double>::infinity();
+  }
+
+  k = 0;
+  for (int q = 0; q < n; ++q)
+  {
+    while (z[k + 1] < q)
+    {
+      ++k;
+    }
+    const double delta = q - v[k];
+    d[q] = spacing2 * delta * delta + f[v[k]];
+  }
+}
+
+//------------------------------------------------------------------------------
+// Execute the algorithm of Felzenszwalb and Huttenlocher.
+//
+// P.F. Felzenszwalb and D.P. Huttenlocher. Distance Transforms of Sampled
+// Functions. Theory of Computing, 8(19). pp. 415--428, 2012.
+//
+// Each iteration computes the exact distance transform along one axis, in
+// linear time per line. The lines are processed in parallel. For a signed
+// distance map, the negative values hold the distances inside, which are
+// transformed separately with the non-negative values as features.
+//
+static void vtkImageEuclideanDistanceExecuteFelzenszwalb(
+  vtkImageEuclideanDistance* self, vtkImageData* outData, int outExt[6], double* outPtr)
+{
+  int outMin0, outMax0, outMin1, outMax1, outMin2, outMax2;
+  vtkIdType outInc0, outInc1, outInc2;
+
+  // Reorder axes, axis 0 is the axis of the current iteration
+  self->PermuteExtent(outExt, outMin0, outMax0, outMin1, outMax1, outMin2, outMax2);
+  self->PermuteIncrements(outData->GetIncrements(), outInc0, outInc1, outInc2);
+
+  const int inSize0 = outMax0 - outMin0 + 1;
+  const vtkIdType inSize1 = outMax1 - outMin1 + 1;
+  const vtkIdType numberOfLines = inSize1 * (outMax2 - outMin2 + 1);
+  const bool signedDistance = self->GetSignedDistance() != 0;
+
+  double spacing = 1;
+  if (self->GetConsiderAnisotropy())
+  {
+    spacing = outData->GetSpacing()[self->GetIteration()];
+  }
+  const double spacing2 = spacing * spacing;
+
+  vtkSMPTools::For(0, numberOfLines, [&](vtkIdType begin, vtkIdType end) {
+    std::vector<double> f(inSize0), d(inSize0), inside(inSize0), z(inSize0 + 1);
+    std::vector<int> v(inSize0);
+    for (vtkIdType line = begin; line < end; ++line)
+    {
+      double* linePtr = outPtr + (line % inSize1) * outInc1 + (line / inSize1) * outInc2;
+      for (int idx0 = 0; idx0 < inSize0; ++idx0)
+      {
+        f[idx0] = std::max(linePtr[idx0 * outInc0], 0.0);
+      }
+      vtkImageEuclideanDistanceTransformLine(
+        f.data(), inSize0, spacing2, d.data(), v.data(), z.data());
+
+      if (signedDistance)
+      {
+        for (int idx0 = 0; idx0 < inSize0; ++idx0)
+        {
+          f[idx0] = std::max(-linePtr[idx0 * outInc0], 0.0);
+        }
+        vtkImageEuclideanDistanceTransformLine(
+          f.data(), inSize0, spacing2, inside.data(), v.data(), z.data());
+        for (int idx0 = 0; idx0 < inSize0; ++idx0)
+        {
+          d[idx0] = d[idx0] > 0 ? d[idx0] : -inside[idx0];
+        }
+      }
+
+      for (int idx0 = 0; idx0 < inSize0; ++idx0)
+      {
+        linePtr[idx0 * outInc0] = d[idx0];
+      }
+    }
+  });
+}
+
 //------------------------------------------------------------------------------
 void vtkImageEuclideanDistance::AllocateOutputScalars(
   vtkImageData* outData, int outExt[6], vtkInformation* outInfo)
@@ -694,6 +813,10 @@ int vtkImageEuclideanDistance::IterativeRequestData(vtkInformation* vtkNotUsed(r
       vtkImageEuclideanDistanceExecuteSaitoCached(
         this, outData, outExt, static_cast<double*>(outPtr));
       break;
+    case VTK_EDT_FELZENSZWALB:
+      vtkImageEuclideanDistanceExecuteFelzenszwalb(
+        this, outData, outExt, static_cast<double*>(outPtr));
+      break;
     default:
       vtkErrorMacro(<< "Execute: Unknown Algorithm");
   }
@@ -712,6 +835,8 @@ void vtkImageEuclideanDistance::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "Consider Anisotropy: " << (this->ConsiderAnisotropy ? "On\n" : "Off\n");
 
+  os << indent << "Signed Distance: " << (this->SignedDistance ? "On\n" : "Off\n");
+
   os << indent << "Initialize: " << this->Initialize << "\n";
   os << indent << "Maximum Distance: " << this->MaximumDistance << "\n";
 
@@ -720,6 +845,10 @@ void vtkImageEuclideanDistance::PrintSelf(ostream& os, vtkIndent indent)
   {
     os << "Saito\n";
   }
+  else if (this->Algorithm == VTK_EDT_FELZENSZWALB)
+  {
+    os << "Felzenszwalb\n";
+  }
   else
   {
     os << "Saito Cached\n";
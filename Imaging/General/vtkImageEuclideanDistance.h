@@ -19,6 +19,12 @@
  * slow it very significantly. In that case, one should use
  * vtkImageEuclideanDistance::SetAlgorithmToSaitoCached() instead for better performance.
  *
+ * The Felzenszwalb algorithm computes the exact distance transform with a
+ * lower envelope of parabolas, in linear time per line whatever the distances
+ * in the image, and processes the lines of each pass in parallel. It is the
+ * algorithm of choice for large images. It can also compute a signed
+ * distance map, see SignedDistance.
+ *
  * References:
  *
  * T. Saito and J.I. Toriwaki. New algorithms for Euclidean distance
@@ -28,6 +34,9 @@
  * O. Cuisenaire. Distance Transformation: fast algorithms and applications
  * to medical image processing. PhD Thesis, Universite catholique de Louvain,
  * October 1999. http://ltswww.epfl.ch/~cuisenai/papers/oc_thesis.pdf
+ *
+ * P.F. Felzenszwalb and D.P. Huttenlocher. Distance Transforms of Sampled
+ * Functions. Theory of Computing, 8(19). pp. 415--428, 2012.
  */
 
 #ifndef vtkImageEuclideanDistance_h
@@ -38,6 +47,7 @@
 
 #define VTK_EDT_SAITO_CACHED 0
 #define VTK_EDT_SAITO 1
+#define VTK_EDT_FELZENSZWALB 2
 
 VTK_ABI_NAMESPACE_BEGIN
 class VTKIMAGINGGENERAL_EXPORT vtkImageEuclideanDistance : public vtkImageDecomposeFilter
@@ -83,12 +93,27 @@ public:
    * Selects a Euclidean DT algorithm.
    * 1. Saito
    * 2. Saito-cached
-   * More algorithms will be added later on.
+   * 3. Felzenszwalb
    */
   vtkSetMacro(Algorithm, int);
   vtkGetMacro(Algorithm, int);
   void SetAlgorithmToSaito() { this->SetAlgorithm(VTK_EDT_SAITO); }
   void SetAlgorithmToSaitoCached() { this->SetAlgorithm(VTK_EDT_SAITO_CACHED); }
+  void SetAlgorithmToFelzenszwalb() { this->SetAlgorithm(VTK_EDT_FELZENSZWALB); }
+  ///@}
+
+  ///@{
+  /**
+   * When on, the zero voxels of the input are also given the square of their
+   * distance to the nearest non-zero voxel, with a negative sign, so that the
+   * output is a signed distance map of the boundary of the non-zero region.
+   * With Initialize off, the negative values of the input are the starting
+   * point of the distances inside. Only used by the Felzenszwalb algorithm.
+   * Off by default.
+   */
+  vtkSetMacro(SignedDistance, vtkTypeBool);
+  vtkGetMacro(SignedDistance, vtkTypeBool);
+  vtkBooleanMacro(SignedDistance, vtkTypeBool);
   ///@}
 
   int IterativeRequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
@@ -100,6 +125,7 @@ protected:
   double MaximumDistance;
   vtkTypeBool Initialize;
   vtkTypeBool ConsiderAnisotropy;
+  vtkTypeBool SignedDistance;
   int Algorithm;
 
   // Replaces "EnlargeOutputUpdateExtent"
@@ -12,6 +12,9 @@
 #include "vtkStreamingDemandDrivenPipeline.h"
 
 #include <algorithm> // for std::nth_element
+#include <limits>
+#include <type_traits>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkImageMedian3D);
@@ -90,6 +93,207 @@ T vtkComputeMedianOfArray(T* aBegin, T* aEnd)
   return m;
 }
 
+//------------------------------------------------------------------------------
+// Neighborhoods with fewer elements are faster to sort than to histogram
+const int HistogramMinimumElements = 100;
+
+// Whether the values of T are few enough to be counted in a histogram
+template <class T>
+struct vtkUseMedianHistogram
+  : std::integral_constant<bool, std::is_integral<T>::value && sizeof(T) <= 2>
+{
+};
+
+//------------------------------------------------------------------------------
+// Two-level histogram of the values of a neighborhood: the value of a given
+// rank is found by scanning at most 256 coarse and 256 fine bins.
+template <class T>
+class vtkMedianHistogram
+{
+public:
+  vtkMedianHistogram()
+    : Fine(NumberOfBins, 0)
+    , Coarse((NumberOfBins + 255) / 256, 0)
+  {
+  }
+
+  void Add(T value)
+  {
+    const int bin = Bin(value);
+    ++this->Fine[bin];
+    ++this->Coarse[bin >> 8];
+  }
+
+  void Remove(T value)
+  {
+    const int bin = Bin(value);
+    --this->Fine[bin];
+    --this->Coarse[bin >> 8];
+  }
+
+  // Value of the given rank, starting at 0, among the counted values
+  T GetValue(int rank) const
+  {
+    int coarse = 0;
+    while (rank >= this->Coarse[coarse])
+    {
+      rank -= this->Coarse[coarse++];
+    }
+    int bin = coarse << 8;
+    while (rank >= this->Fine[bin])
+    {
+      rank -= this->Fine[bin++];
+    }
+    return static_cast<T>(bin + static_cast<int>(std::numeric_limits<T>::min()));
+  }
+
+  // Same median as vtkComputeMedianOfArray for count values
+  T GetMedian(int count) const
+  {
+    T m = this->GetValue(count / 2);
+    if (count % 2 == 0)
+    {
+      const T lowMid = this->GetValue(count / 2 - 1);
+      m = lowMid + (m - lowMid) / 2;
+    }
+    return m;
+  }
+
+  void Clear()
+  {
+    for (size_t coarse = 0; coarse < this->Coarse.size(); ++coarse)
+    {
+      if (this->Coarse[coarse] != 0)
+      {
+        const auto begin = this->Fine.begin() + (coarse << 8);
+        std::fill(begin, begin + std::min<size_t>(256, this->Fine.size()), 0);
+        this->Coarse[coarse] = 0;
+      }
+    }
+  }
+
+private:
+  static constexpr int NumberOfBins = 1 << (8 * sizeof(T));
+  static int Bin(T value)
+  {
+    return static_cast<int>(value) - static_cast<int>(std::numeric_limits<T>::min());
+  }
+
+  std::vector<int> Fine;
+  std::vector<int> Coarse;
+};
+
+//------------------------------------------------------------------------------
+// Sliding histogram median (Perreault and Hebert): along a row of the output,
+// moving the neighborhood by one voxel only removes and adds a column of
+// voxels, so the cost per voxel grows with the area of the kernel section
+// instead of its volume. The neighborhoods are clipped by the input extent as
+// in vtkImageMedian3DExecute.
+template <class T>
+bool vtkImageMedian3DHistogramExecute(vtkImageMedian3D*, vtkImageData*, vtkImageData*, T*, int*,
+  int, vtkDataArray*, std::false_type)
+{
+  return false;
+}
+
+template <class T>
+bool vtkImageMedian3DHistogramExecute(vtkImageMedian3D* self, vtkImageData* inData,
+  vtkImageData* outData, T* outPtr, int outExt[6], int id, vtkDataArray* inArray, std::true_type)
+{
+  const int* kernelMiddle = self->GetKernelMiddle();
+  const int* kernelSize = self->GetKernelSize();
+  const int* inExt = inData->GetExtent();
+  vtkIdType inInc0, inInc1, inInc2;
+  inData->GetIncrements(inInc0, inInc1, inInc2);
+  vtkIdType outIncX, outIncY, outIncZ;
+  outData->GetContinuousIncrements(outExt, outIncX, outIncY, outIncZ);
+  const int numComp = inArray->GetNumberOfComponents();
+  const T* inPtr = static_cast<T*>(inArray->GetVoidPointer(0));
+  auto hoodRange = [&](int axis, int outIdx, int& hoodMin, int& hoodMax) {
+    hoodMin = std::max(outIdx - kernelMiddle[axis], inExt[2 * axis]);
+    hoodMax = std::min(outIdx - kernelMiddle[axis] + kernelSize[axis] - 1, inExt[2 * axis + 1]);
+  };
+
+  unsigned long count = 0;
+  unsigned long target =
+    static_cast<unsigned long>((outExt[5] - outExt[4] + 1) * (outExt[3] - outExt[2] + 1) / 50.0);
+  target++;
+
+  vtkMedianHistogram<T> histogram;
+  const vtkIdType outRowSize = static_cast<vtkIdType>(outExt[1] - outExt[0] + 1) * numComp;
+  for (int outIdx2 = outExt[4]; outIdx2 <= outExt[5]; ++outIdx2)
+  {
+    int hoodMin2, hoodMax2;
+    hoodRange(2, outIdx2, hoodMin2, hoodMax2);
+    for (int outIdx1 = outExt[2]; !self->AbortExecute && outIdx1 <= outExt[3]; ++outIdx1)
+    {
+      if (!id)
+      {
+        if (!(count % target))
+        {
+          self->UpdateProgress(count / (50.0 * target));
+        }
+        count++;
+      }
+      int hoodMin1, hoodMax1;
+      hoodRange(1, outIdx1, hoodMin1, hoodMax1);
+      const int columnSize = (hoodMax1 - hoodMin1 + 1) * (hoodMax2 - hoodMin2 + 1);
+      for (int outIdxC = 0; outIdxC < numComp; ++outIdxC)
+      {
+        const T* columnsPtr = inPtr + (hoodMin1 - inExt[2]) * inInc1 +
+          (hoodMin2 - inExt[4]) * inInc2 - inExt[0] * inInc0 + outIdxC;
+        auto updateColumn = [&](int idx0, bool add) {
+          const T* tmpPtr2 = columnsPtr + idx0 * inInc0;
+          for (int hoodIdx2 = hoodMin2; hoodIdx2 <= hoodMax2; ++hoodIdx2)
+          {
+            const T* tmpPtr1 = tmpPtr2;
+            for (int hoodIdx1 = hoodMin1; hoodIdx1 <= hoodMax1; ++hoodIdx1)
+            {
+              if (add)
+              {
+                histogram.Add(*tmpPtr1);
+              }
+              else
+              {
+                histogram.Remove(*tmpPtr1);
+              }
+              tmpPtr1 += inInc1;
+            }
+            tmpPtr2 += inInc2;
+          }
+        };
+
+        int hoodMin0, hoodMax0;
+        hoodRange(0, outExt[0], hoodMin0, hoodMax0);
+        for (int idx0 = hoodMin0; idx0 <= hoodMax0; ++idx0)
+        {
+          updateColumn(idx0, true);
+        }
+        for (int outIdx0 = outExt[0]; outIdx0 <= outExt[1]; ++outIdx0)
+        {
+          int newMin0, newMax0;
+          hoodRange(0, outIdx0, newMin0, newMax0);
+          for (; hoodMin0 < newMin0; ++hoodMin0)
+          {
+            updateColumn(hoodMin0, false);
+          }
+          for (; hoodMax0 < newMax0; ++hoodMax0)
+          {
+            updateColumn(hoodMax0 + 1, true);
+          }
+          outPtr[(outIdx0 - outExt[0]) * numComp + outIdxC] =
+            histogram.GetMedian((hoodMax0 - hoodMin0 + 1) * columnSize);
+        }
+        histogram.Clear();
+      }
+      outPtr += outRowSize;
+      outPtr += outIncY;
+    }
+    outPtr += outIncZ;
+  }
+  return true;
+}
+
 } // end anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -123,6 +327,13 @@ void vtkImageMedian3DExecute(vtkImageMedian3D* self, vtkImageData* inData, T* in
     return;
   }
 
+  if (self->GetNumberOfElements() >= HistogramMinimumElements &&
+    vtkImageMedian3DHistogramExecute(
+      self, inData, outData, outPtr, outExt, id, inArray, vtkUseMedianHistogram<T>()))
+  {
+    return;
+  }
+
   // Array used to compute the median
   T* workArray = new T[self->GetNumberOfElements()];
 
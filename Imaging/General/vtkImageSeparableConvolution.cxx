@@ -7,71 +7,45 @@
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
+#include <algorithm>
+#include <vector>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkImageSeparableConvolution);
 vtkCxxSetObjectMacro(vtkImageSeparableConvolution, XKernel, vtkFloatArray);
 vtkCxxSetObjectMacro(vtkImageSeparableConvolution, YKernel, vtkFloatArray);
 vtkCxxSetObjectMacro(vtkImageSeparableConvolution, ZKernel, vtkFloatArray);
 
-// Actually do the convolution
-static void ExecuteConvolve(
-  float* kernel, int kernelSize, float* image, float* outImage, int imageSize)
+namespace
+{
+// Number of neighboring lines convolved together when the lines are not
+// contiguous in memory.
+constexpr int LinesPerTile = 32;
+
+// Convolve a tile of lines stored interleaved: value i of line l is
+// tile[i * numLines + l]. The tile is padded with center values repeating
+// the first and last values of the lines, so that no boundary test is needed
+// and the innermost loop, over the lines, is contiguous and vectorizes.
+void ExecuteConvolve(const float* kernel, int kernelSize, const float* tile, float* outTile,
+  int imageSize, int numLines)
 {
-
   // Consider the kernel to be centered at (int) ( (kernelSize - 1 ) / 2.0 )
-
-  int center = static_cast<int>((kernelSize - 1) / 2.0);
-  int i, j, k, kStart, iStart, iEnd, count;
-
-  for (i = 0; i < imageSize; ++i)
+  const vtkIdType lineSize = static_cast<vtkIdType>(imageSize) * numLines;
+  std::fill(outTile, outTile + lineSize, 0.0f);
+  for (int k = 0; k < kernelSize; ++k)
   {
-    outImage[i] = 0.0;
-
-    //    iStart = i - center;
-    //    if ( iStart < 0 )
-    //      {
-    //      iStart = 0;
-    //      }
-
-    //    iEnd = i + center;
-    //    if ( iEnd > imageSize - 1 )
-    //      {
-    //      iEnd = imageSize - 1;
-    //      }
-
-    // Handle padding
-    iStart = i - center;
-    k = kernelSize - 1;
-    while (iStart < 0)
+    const float weight = kernel[kernelSize - 1 - k];
+    const float* tilePtr = tile + static_cast<vtkIdType>(k) * numLines;
+    for (vtkIdType i = 0; i < lineSize; ++i)
     {
-      outImage[i] += image[0] * kernel[k];
-      ++iStart;
-      --k;
-    }
-
-    iEnd = i + center;
-    k = 0;
-    while (iEnd > imageSize - 1)
-    {
-      outImage[i] += image[imageSize - 1] * kernel[k];
-      ++k;
-      --iEnd;
-    }
-
-    kStart = center + i;
-    if (kStart > kernelSize - 1)
-    {
-      kStart = kernelSize - 1;
-    }
-    count = iEnd - iStart + 1;
-    for (j = 0; j < count; ++j)
-    {
-      outImage[i] += image[j + iStart] * kernel[kStart - j];
+      outTile[i] += weight * tilePtr[i];
     }
   }
 }
+}
 
 // Description:
 // Overload standard modified time function. If kernel arrays are modified,
@@ -186,16 +160,10 @@ template <class T>
 void vtkImageSeparableConvolutionExecute(vtkImageSeparableConvolution* self, vtkImageData* inData,
   vtkImageData* outData, T* vtkNotUsed(dummy), int* inExt, int* outExt)
 {
-  T *inPtr0, *inPtr1, *inPtr2;
-  float *outPtr0, *outPtr1, *outPtr2;
   vtkIdType inInc0, inInc1, inInc2;
   vtkIdType outInc0, outInc1, outInc2;
   int inMin0, inMax0, inMin1, inMax1, inMin2, inMax2;
   int outMin0, outMax0, outMin1, outMax1, outMin2, outMax2;
-  int idx0, idx1, idx2;
-  int i;
-  unsigned long count = 0;
-  unsigned long target;
 
   // Reorder axes (the in and out extents are assumed to be the same)
   // (see intercept cache update)
@@ -204,9 +172,6 @@ void vtkImageSeparableConvolutionExecute(vtkImageSeparableConvolution* self, vtk
   self->PermuteIncrements(inData->GetIncrements(), inInc0, inInc1, inInc2);
   self->PermuteIncrements(outData->GetIncrements(), outInc0, outInc1, outInc2);
 
-  target = static_cast<unsigned long>((inMax2 - inMin2 + 1) * (inMax1 - inMin1 + 1) / 50.0);
-  target++;
-
   vtkFloatArray* KernelArray = nullptr;
   switch (self->GetIteration())
   {
@@ -220,80 +185,82 @@ void vtkImageSeparableConvolutionExecute(vtkImageSeparableConvolution* self, vtk
       KernelArray = self->GetZKernel();
       break;
   }
-  int kernelSize = 0;
-  float* kernel = nullptr;
-
+  std::vector<float> kernel;
   if (KernelArray)
   {
-    // Allocate the arrays
-    kernelSize = KernelArray->GetNumberOfTuples();
-    kernel = new float[kernelSize];
-    // Copy the kernel
-    for (i = 0; i < kernelSize; i++)
-    {
-      kernel[i] = KernelArray->GetValue(i);
-    }
+    kernel.assign(KernelArray->GetPointer(0),
+      KernelArray->GetPointer(0) + KernelArray->GetNumberOfTuples());
   }
-
-  int imageSize = inMax0 + 1;
-  float* image = new float[imageSize];
-  float* outImage = new float[imageSize];
-  float* imagePtr;
-
-  // loop over all the extra axes
-  inPtr2 = static_cast<T*>(inData->GetScalarPointerForExtent(inExt));
-  outPtr2 = static_cast<float*>(outData->GetScalarPointerForExtent(outExt));
-  for (idx2 = inMin2; idx2 <= inMax2; ++idx2)
-  {
-    inPtr1 = inPtr2;
-    outPtr1 = outPtr2;
-    for (idx1 = inMin1; !self->AbortExecute && idx1 <= inMax1; ++idx1)
+  const int kernelSize = static_cast<int>(kernel.size());
+  const int center = static_cast<int>((kernelSize - 1) / 2.0);
+
+  // The lines along the X axis are contiguous and convolved one at a time.
+  // Along Y and Z, neighboring lines are gathered in tiles so that the reads
+  // and writes follow the memory layout.
+  const int tileWidth = self->GetIteration() == 0 ? 1 : LinesPerTile;
+  const int imageSize = inMax0 - inMin0 + 1;
+  const int numLines1 = inMax1 - inMin1 + 1;
+  const int numTiles1 = (numLines1 + tileWidth - 1) / tileWidth;
+  T* inPtr = static_cast<T*>(inData->GetScalarPointerForExtent(inExt));
+  float* outPtr = static_cast<float*>(outData->GetScalarPointerForExtent(outExt));
+
+  vtkSMPTools::For(0, inMax2 - inMin2 + 1, [&](vtkIdType begin, vtkIdType end) {
+    const bool isFirst = vtkSMPTools::GetSingleThread();
+    std::vector<float> tile(static_cast<size_t>(imageSize + 2 * center) * tileWidth);
+    std::vector<float> outTile(static_cast<size_t>(imageSize) * tileWidth);
+    for (vtkIdType idx2 = begin; idx2 < end; ++idx2)
     {
-      if (!(count % target))
-      {
-        self->UpdateProgress(count / (50.0 * target));
-      }
-      count++;
-      inPtr0 = inPtr1;
-      imagePtr = image;
-      for (idx0 = inMin0; idx0 <= inMax0; ++idx0)
+      if (isFirst)
       {
-        *imagePtr = static_cast<float>(*inPtr0);
-        inPtr0 += inInc0;
-        ++imagePtr;
+        self->UpdateProgress(static_cast<double>(idx2 - begin) / (end - begin));
       }
-
-      // Call the method that performs the convolution
-      if (kernel)
-      {
-        ExecuteConvolve(kernel, kernelSize, image, outImage, imageSize);
-        imagePtr = outImage;
-      }
-      else
+      for (int tileIdx = 0; !self->AbortExecute && tileIdx < numTiles1; ++tileIdx)
       {
+        const int firstLine = tileIdx * tileWidth;
+        const int numLines = std::min(tileWidth, numLines1 - firstLine);
+        const T* inTilePtr = inPtr + idx2 * inInc2 + firstLine * inInc1;
+
+        // Gather the lines, repeating their end values in the padding
+        float* tilePtr = tile.data() + static_cast<vtkIdType>(center) * numLines;
+        for (int idx0 = 0; idx0 < imageSize; ++idx0)
+        {
+          const T* inLinePtr = inTilePtr + idx0 * inInc0;
+          for (int line = 0; line < numLines; ++line)
+          {
+            tilePtr[idx0 * numLines + line] = static_cast<float>(inLinePtr[line * inInc1]);
+          }
+        }
+        for (int pad = 0; pad < center; ++pad)
+        {
+          std::copy(tilePtr, tilePtr + numLines, tile.data() + pad * numLines);
+          std::copy(tilePtr + (imageSize - 1) * numLines, tilePtr + imageSize * numLines,
+            tilePtr + (imageSize + pad) * numLines);
+        }
+
+        // Call the method that performs the convolution.
         // If we don't have a kernel, just copy to the output
-        imagePtr = image;
-      }
-
-      // Copy to output, be aware that we only copy to the extent that was asked for
-      outPtr0 = outPtr1;
-      imagePtr = imagePtr + (outMin0 - inMin0);
-      for (idx0 = outMin0; idx0 <= outMax0; ++idx0)
-      {
-        *outPtr0 = (*imagePtr);
-        outPtr0 += outInc0;
-        ++imagePtr;
+        const float* resultPtr = tilePtr;
+        if (kernelSize > 0)
+        {
+          ExecuteConvolve(
+            kernel.data(), kernelSize, tile.data(), outTile.data(), imageSize, numLines);
+          resultPtr = outTile.data();
+        }
+
+        // Copy to output, be aware that we only copy to the extent that was asked for
+        float* outTilePtr = outPtr + idx2 * outInc2 + firstLine * outInc1;
+        for (int idx0 = outMin0; idx0 <= outMax0; ++idx0)
+        {
+          const float* resultLinePtr = resultPtr + (idx0 - inMin0) * numLines;
+          float* outLinePtr = outTilePtr + (idx0 - outMin0) * outInc0;
+          for (int line = 0; line < numLines; ++line)
+          {
+            outLinePtr[line * outInc1] = resultLinePtr[line];
+          }
+        }
       }
-      inPtr1 += inInc1;
-      outPtr1 += outInc1;
     }
-    inPtr2 += inInc2;
-    outPtr2 += outInc2;
-  }
-
-  delete[] image;
-  delete[] outImage;
-  delete[] kernel;
+  });
 }
 
 //------------------------------------------------------------------------------
@@ -0,0 +1,142 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Label a random image with many regions and check the labels, sizes and
+// extents against a flood fill of the regions in raster order.
+
+#include "vtkIdTypeArray.h"
+#include "vtkImageConnectivityFilter.h"
+#include "vtkImageData.h"
+#include "vtkIntArray.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <stack>
+#include <vector>
+
+int TestImageConnectivityFilterLabels(int, char*[])
+{
+  const int dims[3] = { 37, 29, 23 };
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(dims[0], dims[1], dims[2]);
+  image->AllocateScalars(VTK_UNSIGNED_CHAR, 1);
+  auto values = static_cast<unsigned char*>(image->GetScalarPointer());
+  const vtkIdType numVoxels = image->GetNumberOfPoints();
+  unsigned int seed = 4321;
+  for (vtkIdType i = 0; i < numVoxels; ++i)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    values[i] = ((seed >> 16) % 100) < 30 ? 1 : 0;
+  }
+
+  // Reference labels, sizes and extents
+  std::vector<int> expected(numVoxels, 0);
+  std::vector<vtkIdType> sizes;
+  std::vector<std::vector<int>> extents;
+  for (vtkIdType i = 0; i < numVoxels; ++i)
+  {
+    if (values[i] == 0 || expected[i] != 0)
+    {
+      continue;
+    }
+    const int label = static_cast<int>(sizes.size()) + 1;
+    std::vector<int> extent = { dims[0], -1, dims[1], -1, dims[2], -1 };
+    vtkIdType size = 0;
+    std::stack<vtkIdType> stack;
+    stack.push(i);
+    expected[i] = label;
+    while (!stack.empty())
+    {
+      const vtkIdType v = stack.top();
+      stack.pop();
+      ++size;
+      const int idx[3] = { static_cast<int>(v % dims[0]), static_cast<int>(v / dims[0] % dims[1]),
+        static_cast<int>(v / (dims[0] * dims[1])) };
+      for (int k = 0; k < 3; ++k)
+      {
+        extent[2 * k] = std::min(extent[2 * k], idx[k]);
+        extent[2 * k + 1] = std::max(extent[2 * k + 1], idx[k]);
+        const vtkIdType step = k == 0 ? 1 : (k == 1 ? dims[0] : dims[0] * dims[1]);
+        for (int dir = -1; dir <= 1; dir += 2)
+        {
+          if (idx[k] + dir < 0 || idx[k] + dir >= dims[k])
+          {
+            continue;
+          }
+          const vtkIdType w = v + dir * step;
+          if (values[w] != 0 && expected[w] == 0)
+          {
+            expected[w] = label;
+            stack.push(w);
+          }
+        }
+      }
+    }
+    sizes.push_back(size);
+    extents.push_back(extent);
+  }
+  if (sizes.size() < 1000)
+  {
+    vtkLog(ERROR, "Too few regions in the test image: " << sizes.size());
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkImageConnectivityFilter> connectivity;
+  connectivity->SetInputData(image);
+  connectivity->SetLabelScalarTypeToInt();
+  connectivity->SetLabelModeToSeedScalar();
+  connectivity->GenerateRegionExtentsOn();
+  connectivity->Update();
+
+  auto labels = static_cast<int*>(connectivity->GetOutput()->GetScalarPointer());
+  for (vtkIdType i = 0; i < numVoxels; ++i)
+  {
+    if (labels[i] != expected[i])
+    {
+      vtkLog(ERROR, "Wrong label " << labels[i] << " instead of " << expected[i] << " at " << i);
+      return EXIT_FAILURE;
+    }
+  }
+  if (connectivity->GetNumberOfExtractedRegions() != static_cast<vtkIdType>(sizes.size()))
+  {
+    vtkLog(ERROR, "Wrong number of regions " << connectivity->GetNumberOfExtractedRegions());
+    return EXIT_FAILURE;
+  }
+  for (size_t r = 0; r < sizes.size(); ++r)
+  {
+    if (connectivity->GetExtractedRegionSizes()->GetValue(r) != sizes[r])
+    {
+      vtkLog(ERROR, "Wrong size for region " << r);
+      return EXIT_FAILURE;
+    }
+    for (int k = 0; k < 6; ++k)
+    {
+      if (connectivity->GetExtractedRegionExtents()->GetComponent(r, k) != extents[r][k])
+      {
+        vtkLog(ERROR, "Wrong extent for region " << r);
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // Too many regions for the label type, the largest ones are kept
+  connectivity->SetLabelScalarTypeToUnsignedChar();
+  connectivity->SetLabelModeToSizeRank();
+  connectivity->Update();
+  const vtkIdType numRegions = connectivity->GetNumberOfExtractedRegions();
+  if (numRegions == 0 || numRegions > 255)
+  {
+    vtkLog(ERROR, "Wrong number of regions for unsigned char labels: " << numRegions);
+    return EXIT_FAILURE;
+  }
+  if (connectivity->GetExtractedRegionSizes()->GetValue(0) !=
+    *std::max_element(sizes.begin(), sizes.end()))
+  {
+    vtkLog(ERROR, "The largest region was not kept");
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,167 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check the continuous dilation and erosion, the binary dilation and the
+// median of a random image against a brute force evaluation over the
+// ellipsoidal and box kernels of the filters.
+
+#include "vtkImageContinuousDilate3D.h"
+#include "vtkImageContinuousErode3D.h"
+#include "vtkImageData.h"
+#include "vtkImageDilateErode3D.h"
+#include "vtkImageEllipsoidSource.h"
+#include "vtkImageMedian3D.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+namespace
+{
+// Brute force evaluation of op over the kernel of each voxel. op returns the
+// output voxel from the values of the neighborhood and of the voxel itself.
+bool CheckFilter(vtkImageData* input, vtkImageData* output, const int kernelSize[3],
+  bool ellipsoid,
+  const std::function<unsigned short(std::vector<unsigned short>&, unsigned short)>& op,
+  const char* name)
+{
+  vtkNew<vtkImageEllipsoidSource> ellipse;
+  ellipse->SetWholeExtent(0, kernelSize[0] - 1, 0, kernelSize[1] - 1, 0, kernelSize[2] - 1);
+  ellipse->SetCenter((kernelSize[0] - 1) * 0.5, (kernelSize[1] - 1) * 0.5,
+    (kernelSize[2] - 1) * 0.5);
+  ellipse->SetRadius(kernelSize[0] * 0.5, kernelSize[1] * 0.5, kernelSize[2] * 0.5);
+  ellipse->Update();
+  vtkImageData* mask = ellipse->GetOutput();
+
+  int dims[3];
+  input->GetDimensions(dims);
+  std::vector<unsigned short> hood;
+  for (int z = 0; z < dims[2]; ++z)
+  {
+    for (int y = 0; y < dims[1]; ++y)
+    {
+      for (int x = 0; x < dims[0]; ++x)
+      {
+        hood.clear();
+        for (int k = 0; k < kernelSize[2]; ++k)
+        {
+          for (int j = 0; j < kernelSize[1]; ++j)
+          {
+            for (int i = 0; i < kernelSize[0]; ++i)
+            {
+              const int p[3] = { x + i - kernelSize[0] / 2, y + j - kernelSize[1] / 2,
+                z + k - kernelSize[2] / 2 };
+              if (p[0] < 0 || p[0] >= dims[0] || p[1] < 0 || p[1] >= dims[1] || p[2] < 0 ||
+                p[2] >= dims[2] ||
+                (ellipsoid && *static_cast<unsigned char*>(mask->GetScalarPointer(i, j, k)) == 0))
+              {
+                continue;
+              }
+              hood.push_back(
+                *static_cast<unsigned short*>(input->GetScalarPointer(p[0], p[1], p[2])));
+            }
+          }
+        }
+        const unsigned short center =
+          *static_cast<unsigned short*>(input->GetScalarPointer(x, y, z));
+        const unsigned short expected = op(hood, center);
+        const unsigned short value =
+          *static_cast<unsigned short*>(output->GetScalarPointer(x, y, z));
+        if (value != expected)
+        {
+          vtkLog(ERROR,
+            "Wrong value " << value << " instead of " << expected << " for " << name << " at "
+                           << x << " " << y << " " << z);
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+}
+
+int TestImageMorphologyKernels(int, char*[])
+{
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(23, 19, 17);
+  image->AllocateScalars(VTK_UNSIGNED_SHORT, 1);
+  vtkNew<vtkImageData> binary;
+  binary->SetDimensions(23, 19, 17);
+  binary->AllocateScalars(VTK_UNSIGNED_SHORT, 1);
+  auto values = static_cast<unsigned short*>(image->GetScalarPointer());
+  auto binaryValues = static_cast<unsigned short*>(binary->GetScalarPointer());
+  unsigned int seed = 12345;
+  for (vtkIdType i = 0; i < image->GetNumberOfPoints(); ++i)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    values[i] = static_cast<unsigned short>(seed >> 16);
+    binaryValues[i] = (seed >> 8) % 29 == 0 ? 1 : 0;
+  }
+
+  auto maximum = [](std::vector<unsigned short>& hood, unsigned short center) {
+    return std::max(center, *std::max_element(hood.begin(), hood.end()));
+  };
+  auto minimum = [](std::vector<unsigned short>& hood, unsigned short center) {
+    return std::min(center, *std::min_element(hood.begin(), hood.end()));
+  };
+
+  // Ellipsoidal and box kernels
+  const int kernels[][3] = { { 5, 5, 3 }, { 7, 4, 6 }, { 9, 1, 1 }, { 3, 3, 1 } };
+  for (const auto& kernel : kernels)
+  {
+    vtkNew<vtkImageContinuousDilate3D> dilate;
+    dilate->SetInputData(image);
+    dilate->SetKernelSize(kernel[0], kernel[1], kernel[2]);
+    dilate->Update();
+    vtkNew<vtkImageContinuousErode3D> erode;
+    erode->SetInputData(image);
+    erode->SetKernelSize(kernel[0], kernel[1], kernel[2]);
+    erode->Update();
+    if (!CheckFilter(image, dilate->GetOutput(), kernel, true, maximum, "dilate") ||
+      !CheckFilter(image, erode->GetOutput(), kernel, true, minimum, "erode"))
+    {
+      return EXIT_FAILURE;
+    }
+
+    vtkNew<vtkImageDilateErode3D> dilateErode;
+    dilateErode->SetInputData(binary);
+    dilateErode->SetDilateValue(1);
+    dilateErode->SetErodeValue(0);
+    dilateErode->SetKernelSize(kernel[0], kernel[1], kernel[2]);
+    dilateErode->Update();
+    if (!CheckFilter(binary, dilateErode->GetOutput(), kernel, true, maximum, "dilate erode"))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Medians large enough to use a histogram, with an odd and an even number
+  // of elements in the neighborhoods
+  auto median = [](std::vector<unsigned short>& hood, unsigned short) {
+    std::sort(hood.begin(), hood.end());
+    const size_t mid = hood.size() / 2;
+    if (hood.size() % 2 == 0)
+    {
+      return static_cast<unsigned short>(hood[mid - 1] + (hood[mid] - hood[mid - 1]) / 2);
+    }
+    return hood[mid];
+  };
+  const int medianKernels[][3] = { { 5, 5, 5 }, { 7, 6, 3 } };
+  for (const auto& kernel : medianKernels)
+  {
+    vtkNew<vtkImageMedian3D> medianFilter;
+    medianFilter->SetInputData(image);
+    medianFilter->SetKernelSize(kernel[0], kernel[1], kernel[2]);
+    medianFilter->Update();
+    if (!CheckFilter(image, medianFilter->GetOutput(), kernel, false, median, "median"))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -16,6 +16,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTemplateAliasMacro.h"
@@ -23,6 +24,8 @@
 #include "vtkVersion.h"
 
 #include <algorithm>
+#include <limits>
+#include <numeric>
 #include <stack>
 #include <vector>
 
@@ -286,6 +289,13 @@ protected:
     vtkImageStencilData* stencil, OT* outPtr, unsigned char* maskPtr, int extent[6],
     vtkICF::RegionVector& regionInfo);
 
+  // Execute method for when no seeds are provided, with the image split in
+  // blocks of rows that are labelled in parallel. Returns false, without
+  // changing the output, if the regions do not fit in the output type.
+  template <class OT, class IdT>
+  static bool ParallelSeedlessExecute(vtkImageConnectivityFilter* self, vtkImageData* outData,
+    OT* outPtr, unsigned char* maskPtr, int extent[6], vtkICF::RegionVector& regionInfo);
+
 public:
   // Create a bit mask from the input
   template <class IT>
@@ -1281,6 +1291,272 @@ void vtkICF::SeedlessExecute(vtkImageConnectivityFilter* self, vtkImageData* out
   }
 }
 
+//------------------------------------------------------------------------------
+// Label the regions with a union-find in each block of rows, then merge the
+// regions that touch across the block boundaries. The regions get the same
+// labels as with SeedlessExecute, i.e. they are numbered in the raster
+// order of their first voxel, as long as there are few enough of them for
+// SeedlessExecute to not prune any region.
+template <class OT, class IdT>
+bool vtkICF::ParallelSeedlessExecute(vtkImageConnectivityFilter* self, vtkImageData* outData,
+  OT* outPtr, unsigned char* maskPtr, int extent[6], vtkICF::RegionVector& regionInfo)
+{
+  bool generateExtents = (self->GetGenerateRegionExtents() != 0);
+
+  vtkIdType outInc[3];
+  outData->GetIncrements(outInc);
+
+  int outExt[6];
+  outData->GetExtent(outExt);
+
+  int maxIdx[3];
+  int* outLimits = vtkICF::ZeroBaseExtent(extent, outExt, maxIdx);
+
+  vtkIdType rowSize = maxIdx[0] + 1;
+  vtkIdType sliceSize = rowSize * (maxIdx[1] + 1);
+  vtkIdType numRows = (maxIdx[1] + 1) * static_cast<vtkIdType>(maxIdx[2] + 1);
+
+  // split the rows in a few blocks per thread, made of whole slices for 3D
+  // images so that only one slice per block has to be merged
+  vtkIdType numThreads = vtkSMPTools::GetEstimatedNumberOfThreads();
+  vtkIdType rowsPerBlock = (numRows + 4 * numThreads - 1) / (4 * numThreads);
+  if (rowsPerBlock > maxIdx[1] + 1)
+  {
+    rowsPerBlock = (rowsPerBlock + maxIdx[1]) / (maxIdx[1] + 1) * (maxIdx[1] + 1);
+  }
+  vtkIdType numBlocks = (numRows + rowsPerBlock - 1) / rowsPerBlock;
+
+  auto isForeground = [maskPtr](vtkIdType v) { return (maskPtr[v >> 3] & (1 << (v & 0x7))) == 0; };
+
+  // for each voxel, the region number within its block
+  std::vector<IdT> labels(static_cast<size_t>(rowSize * numRows));
+  std::vector<vtkICF::RegionVector> blockRegions(numBlocks);
+
+  vtkSMPTools::For(0, numBlocks, [&](vtkIdType firstBlock, vtkIdType lastBlock) {
+    for (vtkIdType block = firstBlock; block < lastBlock; block++)
+    {
+      vtkIdType begin = block * rowsPerBlock * rowSize;
+      vtkIdType end = std::min((block + 1) * rowsPerBlock, numRows) * rowSize;
+
+      // union-find with the voxel indices within the block, where the root
+      // of a tree is the first of its voxels
+      IdT* parent = labels.data() + begin;
+      auto find = [parent](IdT i) {
+        while (parent[i] != i)
+        {
+          parent[i] = parent[parent[i]];
+          i = parent[i];
+        }
+        return i;
+      };
+      auto unite = [&](IdT i, IdT j) {
+        i = find(i);
+        j = find(j);
+        if (i < j)
+        {
+          parent[j] = i;
+        }
+        else if (j < i)
+        {
+          parent[i] = j;
+        }
+      };
+
+      for (vtkIdType v = begin; v < end; v++)
+      {
+        if (!isForeground(v))
+        {
+          continue;
+        }
+        IdT i = static_cast<IdT>(v - begin);
+        parent[i] = i;
+        if (v % rowSize > 0 && isForeground(v - 1))
+        {
+          unite(i - 1, i);
+        }
+        if ((v / rowSize) % (maxIdx[1] + 1) > 0 && v - rowSize >= begin &&
+          isForeground(v - rowSize))
+        {
+          unite(static_cast<IdT>(i - rowSize), i);
+        }
+        if (v >= sliceSize && v - sliceSize >= begin && isForeground(v - sliceSize))
+        {
+          unite(static_cast<IdT>(i - sliceSize), i);
+        }
+      }
+
+      // replace the parents by region numbers, the parents precede their
+      // children so they have already been replaced
+      vtkICF::RegionVector& regions = blockRegions[block];
+      for (vtkIdType v = begin; v < end; v++)
+      {
+        if (!isForeground(v))
+        {
+          continue;
+        }
+        IdT i = static_cast<IdT>(v - begin);
+        int idx[3];
+        idx[0] = static_cast<int>(v % rowSize);
+        idx[1] = static_cast<int>((v / rowSize) % (maxIdx[1] + 1));
+        idx[2] = static_cast<int>(v / sliceSize);
+        if (parent[i] == i)
+        {
+          int seedExtent[6] = { idx[0], idx[0], idx[1], idx[1], idx[2], idx[2] };
+          parent[i] = static_cast<IdT>(regions.size());
+          regions.push_back(vtkICF::Region(1, -1, seedExtent));
+        }
+        else
+        {
+          parent[i] = parent[parent[i]];
+          vtkICF::Region& region = regions[parent[i]];
+          region.size++;
+          if (generateExtents)
+          {
+            for (int k = 0; k < 3; k++)
+            {
+              region.extent[2 * k] = std::min(region.extent[2 * k], idx[k]);
+              region.extent[2 * k + 1] = std::max(region.extent[2 * k + 1], idx[k]);
+            }
+          }
+        }
+      }
+    }
+  });
+
+  // number the regions of all blocks consecutively
+  std::vector<vtkIdType> offsets(numBlocks + 1, 0);
+  for (vtkIdType block = 0; block < numBlocks; block++)
+  {
+    offsets[block + 1] = offsets[block] + static_cast<vtkIdType>(blockRegions[block].size());
+  }
+
+  std::vector<vtkIdType> merged(offsets[numBlocks]);
+  std::iota(merged.begin(), merged.end(), 0);
+  auto find = [&merged](vtkIdType i) {
+    while (merged[i] != i)
+    {
+      merged[i] = merged[merged[i]];
+      i = merged[i];
+    }
+    return i;
+  };
+  auto unite = [&](vtkIdType i, vtkIdType j) {
+    i = find(i);
+    j = find(j);
+    if (i < j)
+    {
+      merged[j] = i;
+    }
+    else if (j < i)
+    {
+      merged[i] = j;
+    }
+  };
+  auto globalLabel = [&](vtkIdType v) {
+    return offsets[v / rowSize / rowsPerBlock] + static_cast<vtkIdType>(labels[v]);
+  };
+
+  // merge the regions connected across the start of each block
+  for (vtkIdType block = 1; block < numBlocks; block++)
+  {
+    vtkIdType begin = block * rowsPerBlock * rowSize;
+    vtkIdType end = std::min(std::min((block + 1) * rowsPerBlock, numRows) * rowSize,
+      begin + sliceSize);
+    for (vtkIdType v = begin; v < end; v++)
+    {
+      if (!isForeground(v))
+      {
+        continue;
+      }
+      if ((v / rowSize) % (maxIdx[1] + 1) > 0 && v - rowSize < begin && isForeground(v - rowSize))
+      {
+        unite(globalLabel(v), globalLabel(v - rowSize));
+      }
+      if (v >= sliceSize && isForeground(v - sliceSize))
+      {
+        unite(globalLabel(v), globalLabel(v - sliceSize));
+      }
+    }
+  }
+
+  // check that the labels will fit in the output type
+  vtkIdType numRegions = 0;
+  for (vtkIdType i = 0; i < offsets[numBlocks]; i++)
+  {
+    numRegions += (find(i) == i);
+  }
+  if (static_cast<vtkIdType>(regionInfo.size()) + numRegions >
+    static_cast<vtkIdType>(vtkTypeTraits<OT>::Max()))
+  {
+    return false;
+  }
+
+  // assign the labels in the order of the first voxel of each region
+  std::vector<OT> finalLabels(offsets[numBlocks]);
+  for (vtkIdType block = 0; block < numBlocks; block++)
+  {
+    for (size_t k = 0; k < blockRegions[block].size(); k++)
+    {
+      const vtkICF::Region& region = blockRegions[block][k];
+      vtkIdType i = offsets[block] + static_cast<vtkIdType>(k);
+      vtkIdType root = find(i);
+      if (root == i)
+      {
+        finalLabels[i] = static_cast<OT>(regionInfo.size());
+        regionInfo.push_back(region);
+      }
+      else
+      {
+        finalLabels[i] = finalLabels[root];
+        vtkICF::Region& rootRegion = regionInfo[finalLabels[root]];
+        rootRegion.size += region.size;
+        if (generateExtents)
+        {
+          for (int j = 0; j < 3; j++)
+          {
+            rootRegion.extent[2 * j] = std::min(rootRegion.extent[2 * j], region.extent[2 * j]);
+            rootRegion.extent[2 * j + 1] =
+              std::max(rootRegion.extent[2 * j + 1], region.extent[2 * j + 1]);
+          }
+        }
+      }
+    }
+  }
+
+  // write the labels to the output
+  vtkSMPTools::For(0, numBlocks, [&](vtkIdType firstBlock, vtkIdType lastBlock) {
+    vtkIdType begin = firstBlock * rowsPerBlock * rowSize;
+    vtkIdType end = std::min(lastBlock * rowsPerBlock, numRows) * rowSize;
+    for (vtkIdType v = begin; v < end; v++)
+    {
+      if (!isForeground(v))
+      {
+        continue;
+      }
+      int idx[3];
+      idx[0] = static_cast<int>(v % rowSize);
+      idx[1] = static_cast<int>((v / rowSize) % (maxIdx[1] + 1));
+      idx[2] = static_cast<int>(v / sliceSize);
+      if (outLimits)
+      {
+        if (idx[0] < outLimits[0] || idx[0] > outLimits[1] || idx[1] < outLimits[2] ||
+          idx[1] > outLimits[3] || idx[2] < outLimits[4] || idx[2] > outLimits[5])
+        {
+          continue;
+        }
+        for (int k = 0; k < 3; k++)
+        {
+          idx[k] -= outLimits[2 * k];
+        }
+      }
+      outPtr[idx[0] * outInc[0] + idx[1] * outInc[1] + idx[2] * outInc[2]] =
+        finalLabels[globalLabel(v)];
+    }
+  });
+
+  return true;
+}
+
 //------------------------------------------------------------------------------
 // This templated function executes the filter for any type of data.
 template <class OT>
@@ -1304,7 +1580,19 @@ void vtkICF::ExecuteOutput(vtkImageConnectivityFilter* self, vtkImageData* outDa
   int extractionMode = self->GetExtractionMode();
   if (!seedData || extractionMode == vtkImageConnectivityFilter::AllRegions)
   {
-    vtkICF::SeedlessExecute(self, outData, stencil, outPtr, maskPtr, extent, regionInfo);
+    // label in parallel, unless regions must be pruned while they are found
+    vtkIdType numVoxels = (extent[1] - extent[0] + 1);
+    numVoxels *= (extent[3] - extent[2] + 1);
+    numVoxels *= (extent[5] - extent[4] + 1);
+    bool done = (numVoxels <= std::numeric_limits<int>::max()
+        ? vtkICF::ParallelSeedlessExecute<OT, int>(
+            self, outData, outPtr, maskPtr, extent, regionInfo)
+        : vtkICF::ParallelSeedlessExecute<OT, vtkIdType>(
+            self, outData, outPtr, maskPtr, extent, regionInfo));
+    if (!done)
+    {
+      vtkICF::SeedlessExecute(self, outData, stencil, outPtr, maskPtr, extent, regionInfo);
+    }
   }
 
   // do final relabelling and other bookkeeping
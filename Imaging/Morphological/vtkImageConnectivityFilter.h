@@ -44,6 +44,13 @@
  * is called.  These extents can be useful for cropping the output
  * of the filter.
  *
+ * When all regions are labelled, the image is split into blocks of rows
+ * that are labelled in parallel with vtkSMPTools, after which the regions
+ * that touch across the blocks are merged. The labels are the same as those
+ * of a serial flood fill in raster order. If there are more regions than
+ * the label type can hold, a serial flood fill is used instead, so that
+ * regions can be discarded while they are found.
+ *
  * @sa
  * vtkConnectivityFilter, vtkPolyDataConnectivityFilter, vtkmImageConnectivity
  */
@@ -5,6 +5,7 @@
 #include "vtkDataArray.h"
 #include "vtkImageData.h"
 #include "vtkImageEllipsoidSource.h"
+#include "vtkImageMorphologyInternal.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
@@ -12,6 +13,8 @@
 #include "vtkStreamingDemandDrivenPipeline.h"
 
 #include <algorithm>
+#include <limits>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkImageContinuousDilate3D);
@@ -105,6 +108,22 @@ void vtkImageContinuousDilate3DExecute(vtkImageContinuousDilate3D* self, vtkImag
   vtkImageData* inData, T* inPtr, vtkImageData* outData, const int* outExt, T* outPtr, int id,
   vtkDataArray* inArray)
 {
+  // Compute the maximum over runs of the structuring element when it is convex
+  // along X, which is the case of the ellipsoid
+  std::vector<vtkImageFootprintRun> runs;
+  if (vtkImageComputeFootprintRuns(mask, self->GetKernelSize(), self->GetKernelMiddle(), runs))
+  {
+    vtkImageFootprintExtremum(
+      self, id, inData, static_cast<const T*>(inArray->GetVoidPointer(0)), outData, outExt, outPtr,
+      runs, vtkImageFootprintIsBox(runs, self->GetKernelSize(), self->GetKernelMiddle()),
+      [](T value) { return value; }, std::numeric_limits<T>::lowest(),
+      [](T a, T b) { return a > b; },
+      [](T* outVoxel, const T* inVoxel, T extremum) {
+        *outVoxel = std::max(*inVoxel, extremum);
+      });
+    return;
+  }
+
   // to compute the range
   unsigned long count = 0;
 
@@ -3,12 +3,14 @@
 #include "vtkImageDilateErode3D.h"
 #include "vtkImageData.h"
 #include "vtkImageEllipsoidSource.h"
+#include "vtkImageMorphologyInternal.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
 #include <algorithm>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkImageDilateErode3D);
@@ -107,6 +109,24 @@ template <class T>
 void vtkImageDilateErode3DExecute(vtkImageDilateErode3D* self, vtkImageData* mask,
   vtkImageData* inData, T* inPtr, vtkImageData* outData, const int* outExt, T* outPtr, int id)
 {
+  // Look for the dilate value over runs of the structuring element when it is
+  // convex along X, which is the case of the ellipsoid
+  std::vector<vtkImageFootprintRun> runs;
+  if (vtkImageComputeFootprintRuns(mask, self->GetKernelSize(), self->GetKernelMiddle(), runs))
+  {
+    const T erodeValue = static_cast<T>(self->GetErodeValue());
+    const T dilateValue = static_cast<T>(self->GetDilateValue());
+    vtkImageFootprintExtremum(
+      self, id, inData, static_cast<const T*>(inData->GetScalarPointer()), outData, outExt, outPtr,
+      runs, vtkImageFootprintIsBox(runs, self->GetKernelSize(), self->GetKernelMiddle()),
+      [dilateValue](T value) -> unsigned char { return value == dilateValue ? 1 : 0; },
+      static_cast<unsigned char>(0), [](unsigned char a, unsigned char b) { return a > b; },
+      [erodeValue, dilateValue](T* outVoxel, const T* inVoxel, unsigned char hasDilateValue) {
+        *outVoxel = (*inVoxel == erodeValue && hasDilateValue) ? dilateValue : *inVoxel;
+      });
+    return;
+  }
+
   // to compute the range
   unsigned long count = 0;
 
@@ -0,0 +1,277 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkImageMorphologyInternal
+ * @brief   extremum of an image over a structuring element
+ *
+ * vtkImageMorphologyInternal computes, for every voxel, the minimum or maximum
+ * of the input over the voxels of an ellipsoidal structuring element. The
+ * structuring element is decomposed into runs along X, and the extremum of
+ * each run is computed for a whole row with the van Herk/Gil-Werman
+ * algorithm, at a cost that does not depend on the length of the run. When
+ * the structuring element is a box, the extremum is computed separably, one
+ * axis after the other, at a cost per voxel independent of the kernel size.
+ *
+ * @warning
+ * This file is meant as a private include file to avoid code duplication. At
+ * this time it is not meant to define a public API (the API is likely to change
+ * in the future). If you write code that depends on this include, be prepared to
+ * change it in the future (without complaint).
+ *
+ * @sa
+ * vtkImageContinuousDilate3D vtkImageContinuousErode3D vtkImageDilateErode3D
+ */
+
+#ifndef vtkImageMorphologyInternal_h
+#define vtkImageMorphologyInternal_h
+
+#include "vtkAlgorithm.h"
+#include "vtkImageData.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{ // anonymous namespace
+
+// Run of the structuring element: the voxels from Min0 to Max0 along X, at
+// Offset1 along Y and Offset2 along Z from the middle of the kernel.
+struct vtkImageFootprintRun
+{
+  int Offset1;
+  int Offset2;
+  int Min0;
+  int Max0;
+};
+
+// Decompose the non-zero voxels of mask into runs along X. Returns false if
+// a row of the mask has several runs.
+inline bool vtkImageComputeFootprintRuns(vtkImageData* mask, const int* kernelSize,
+  const int* kernelMiddle, std::vector<vtkImageFootprintRun>& runs)
+{
+  runs.clear();
+  const unsigned char* maskPtr = static_cast<unsigned char*>(mask->GetScalarPointer());
+  vtkIdType maskInc0, maskInc1, maskInc2;
+  mask->GetIncrements(maskInc0, maskInc1, maskInc2);
+  for (int idx2 = 0; idx2 < kernelSize[2]; ++idx2)
+  {
+    for (int idx1 = 0; idx1 < kernelSize[1]; ++idx1)
+    {
+      int first = -1;
+      int last = -1;
+      for (int idx0 = 0; idx0 < kernelSize[0]; ++idx0)
+      {
+        if (maskPtr[idx0 * maskInc0 + idx1 * maskInc1 + idx2 * maskInc2] != 0)
+        {
+          if (last >= 0 && last != idx0 - 1)
+          {
+            return false;
+          }
+          first = first < 0 ? idx0 : first;
+          last = idx0;
+        }
+      }
+      if (first >= 0)
+      {
+        runs.push_back({ idx1 - kernelMiddle[1], idx2 - kernelMiddle[2], first - kernelMiddle[0],
+          last - kernelMiddle[0] });
+      }
+    }
+  }
+  return true;
+}
+
+// Whether the runs fill the whole kernel box
+inline bool vtkImageFootprintIsBox(
+  const std::vector<vtkImageFootprintRun>& runs, const int* kernelSize, const int* kernelMiddle)
+{
+  if (static_cast<int>(runs.size()) != kernelSize[1] * kernelSize[2])
+  {
+    return false;
+  }
+  for (const auto& run : runs)
+  {
+    if (run.Min0 != -kernelMiddle[0] || run.Max0 != kernelSize[0] - 1 - kernelMiddle[0])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// van Herk/Gil-Werman windowed extremum: out[x] is the extremum of get(j) for
+// j in [x + lo, x + hi] and 0 <= j < n. The line is split in blocks of the
+// size of the window, whose prefix and suffix extrema give the extremum of any
+// window with 3 comparisons per value.
+template <typename V, typename Getter, typename Better>
+void vtkImageWindowedExtremum(Getter get, int n, int lo, int hi, V identity, Better better,
+  V* out, std::vector<V>& prefix, std::vector<V>& suffix)
+{
+  const int window = hi - lo + 1;
+  const int length = n + window - 1;
+  prefix.resize(length);
+  suffix.resize(length);
+  auto value = [&](int s) -> V {
+    const int j = s + lo;
+    return (j >= 0 && j < n) ? get(j) : identity;
+  };
+  for (int s = 0; s < length; ++s)
+  {
+    const V v = value(s);
+    prefix[s] = (s % window == 0 || better(v, prefix[s - 1])) ? v : prefix[s - 1];
+  }
+  for (int s = length - 1; s >= 0; --s)
+  {
+    const V v = value(s);
+    suffix[s] =
+      (s % window == window - 1 || s == length - 1 || better(v, suffix[s + 1])) ? v : suffix[s + 1];
+  }
+  for (int x = 0; x < n; ++x)
+  {
+    const V& a = suffix[x];
+    const V& b = prefix[x + window - 1];
+    out[x] = better(b, a) ? b : a;
+  }
+}
+
+// For every voxel of outExt, compute the extremum of transform(value) over the
+// structuring element, clipped by the extent of inData, and pass it to
+// store(outVoxel, inVoxel, extremum) for each component.
+template <typename T, typename V, typename Transform, typename Better, typename Store>
+void vtkImageFootprintExtremum(vtkAlgorithm* self, int id, vtkImageData* inData, const T* inPtr,
+  vtkImageData* outData, const int* outExt, T* outPtr,
+  const std::vector<vtkImageFootprintRun>& runs, bool isBox, Transform transform, V identity,
+  Better better, Store store)
+{
+  const int* inExt = inData->GetExtent();
+  vtkIdType inInc[3], outInc[3];
+  inData->GetIncrements(inInc);
+  outData->GetIncrements(outInc);
+  const int numComps = outData->GetNumberOfScalarComponents();
+  const int inSize[3] = { inExt[1] - inExt[0] + 1, inExt[3] - inExt[2] + 1,
+    inExt[5] - inExt[4] + 1 };
+  const int outSize[3] = { outExt[1] - outExt[0] + 1, outExt[3] - outExt[2] + 1,
+    outExt[5] - outExt[4] + 1 };
+  // inPtr is the first voxel of inData, outPtr the first voxel of outExt
+  auto inVoxel = [&](int idx0, int idx1, int idx2) -> const T* {
+    return inPtr + (idx0 - inExt[0]) * inInc[0] + (idx1 - inExt[2]) * inInc[1] +
+      (idx2 - inExt[4]) * inInc[2];
+  };
+
+  unsigned long count = 0;
+  unsigned long target = static_cast<unsigned long>(numComps * outSize[2] * outSize[1] / 50.0);
+  target++;
+  auto progress = [&]() {
+    if (!id)
+    {
+      if (!(count % target))
+      {
+        self->UpdateProgress(count / (50.0 * target));
+      }
+      count++;
+    }
+  };
+
+  std::vector<V> prefix, suffix;
+  std::vector<V> line(std::max({ inSize[0], inSize[1], inSize[2] }));
+  for (int comp = 0; comp < numComps; ++comp)
+  {
+    if (isBox && !runs.empty())
+    {
+      // Separable extremum: along X for the rows of the input, then along Y
+      // and Z for the rows of the output
+      const vtkImageFootprintRun& first = runs.front();
+      const vtkImageFootprintRun& last = runs.back();
+      const int lo[3] = { first.Min0, first.Offset1, first.Offset2 };
+      const int hi[3] = { first.Max0, last.Offset1, last.Offset2 };
+      std::vector<V> pass(static_cast<size_t>(outSize[0]) * inSize[1] * inSize[2]);
+      for (int idx2 = 0; idx2 < inSize[2]; ++idx2)
+      {
+        for (int idx1 = 0; idx1 < inSize[1]; ++idx1)
+        {
+          const T* rowPtr = inVoxel(inExt[0], inExt[2] + idx1, inExt[4] + idx2) + comp;
+          vtkImageWindowedExtremum<V>([&](int j) -> V { return transform(rowPtr[j * inInc[0]]); },
+            inSize[0], lo[0], hi[0], identity, better, line.data(), prefix, suffix);
+          std::copy(line.begin() + (outExt[0] - inExt[0]),
+            line.begin() + (outExt[0] - inExt[0] + outSize[0]),
+            pass.begin() + (static_cast<size_t>(idx2) * inSize[1] + idx1) * outSize[0]);
+        }
+      }
+      std::vector<V> column(inSize[1]);
+      for (int idx2 = 0; idx2 < inSize[2]; ++idx2)
+      {
+        V* slice = pass.data() + static_cast<size_t>(idx2) * inSize[1] * outSize[0];
+        for (int idx0 = 0; idx0 < outSize[0]; ++idx0)
+        {
+          vtkImageWindowedExtremum<V>([&](int j) -> V { return slice[j * outSize[0] + idx0]; },
+            inSize[1], lo[1], hi[1], identity, better, column.data(), prefix, suffix);
+          for (int idx1 = 0; idx1 < inSize[1]; ++idx1)
+          {
+            slice[idx1 * outSize[0] + idx0] = column[idx1];
+          }
+        }
+      }
+      const size_t sliceSize = static_cast<size_t>(inSize[1]) * outSize[0];
+      for (int idx1 = 0; idx1 < outSize[1]; ++idx1)
+      {
+        progress();
+        const int row1 = outExt[2] + idx1 - inExt[2];
+        for (int idx0 = 0; idx0 < outSize[0]; ++idx0)
+        {
+          const V* stack = pass.data() + static_cast<size_t>(row1) * outSize[0] + idx0;
+          vtkImageWindowedExtremum<V>([&](int j) -> V { return stack[j * sliceSize]; }, inSize[2],
+            lo[2], hi[2], identity, better, line.data(), prefix, suffix);
+          for (int idx2 = 0; idx2 < outSize[2]; ++idx2)
+          {
+            const int outIdx[3] = { outExt[0] + idx0, outExt[2] + idx1, outExt[4] + idx2 };
+            store(outPtr + idx0 * outInc[0] + idx1 * outInc[1] + idx2 * outInc[2] + comp,
+              inVoxel(outIdx[0], outIdx[1], outIdx[2]) + comp, line[outIdx[2] - inExt[4]]);
+          }
+        }
+      }
+      continue;
+    }
+
+    // Combine the extrema of the runs for each row of the output
+    std::vector<V> extremum(outSize[0]);
+    for (int idx2 = outExt[4]; idx2 <= outExt[5]; ++idx2)
+    {
+      for (int idx1 = outExt[2]; !self->AbortExecute && idx1 <= outExt[3]; ++idx1)
+      {
+        progress();
+        std::fill(extremum.begin(), extremum.end(), identity);
+        for (const auto& run : runs)
+        {
+          const int row1 = idx1 + run.Offset1;
+          const int row2 = idx2 + run.Offset2;
+          if (row1 < inExt[2] || row1 > inExt[3] || row2 < inExt[4] || row2 > inExt[5])
+          {
+            continue;
+          }
+          const T* rowPtr = inVoxel(inExt[0], row1, row2) + comp;
+          vtkImageWindowedExtremum<V>([&](int j) -> V { return transform(rowPtr[j * inInc[0]]); },
+            inSize[0], run.Min0, run.Max0, identity, better, line.data(), prefix, suffix);
+          const V* runExtremum = line.data() + (outExt[0] - inExt[0]);
+          for (int idx0 = 0; idx0 < outSize[0]; ++idx0)
+          {
+            if (better(runExtremum[idx0], extremum[idx0]))
+            {
+              extremum[idx0] = runExtremum[idx0];
+            }
+          }
+        }
+        T* outRow = outPtr + (idx1 - outExt[2]) * outInc[1] + (idx2 - outExt[4]) * outInc[2] + comp;
+        const T* inRow = inVoxel(outExt[0], idx1, idx2) + comp;
+        for (int idx0 = 0; idx0 < outSize[0]; ++idx0)
+        {
+          store(outRow + idx0 * outInc[0], inRow + idx0 * inInc[0], extremum[idx0]);
+        }
+      }
+    }
+  }
+}
+
+} // anonymous namespace
+
+#endif
+// VTK-HeaderTest-Exclude: vtkImageMorphologyInternal.h
@@ -9,6 +9,7 @@
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
 #include <cmath>
@@ -21,6 +22,7 @@ vtkImageToImageStencil::vtkImageToImageStencil()
 {
   this->UpperThreshold = VTK_FLOAT_MAX;
   this->LowerThreshold = -VTK_FLOAT_MAX;
+  this->EnableSMP = true;
 }
 
 //------------------------------------------------------------------------------
@@ -34,6 +36,7 @@ void vtkImageToImageStencil::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Input: " << this->GetInput() << "\n";
   os << indent << "UpperThreshold: " << this->UpperThreshold << "\n";
   os << indent << "LowerThreshold: " << this->LowerThreshold << "\n";
+  os << indent << "EnableSMP: " << (this->EnableSMP ? "On\n" : "Off\n");
 }
 
 //------------------------------------------------------------------------------
@@ -108,31 +111,30 @@ int vtkImageToImageStencil::RequestData(
   double upperThreshold = this->UpperThreshold;
   double lowerThreshold = this->LowerThreshold;
 
-  // for keeping track of progress
-  unsigned long count = 0;
-  unsigned long target =
-    static_cast<unsigned long>((extent[5] - extent[4] + 1) * (extent[3] - extent[2] + 1) / 50.0);
-  target++;
+  // each row of the stencil has its own extent list, so the rows can be
+  // filled in parallel
+  int ySize = extent[3] - extent[2] + 1;
+  vtkIdType numRows = static_cast<vtkIdType>(ySize) * (extent[5] - extent[4] + 1);
+  auto fillRows = [&](vtkIdType begin, vtkIdType end) {
+    // for keeping track of progress
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    vtkIdType target = (end - begin) / 50 + 1;
 
-  for (int idZ = extent[4]; idZ <= extent[5]; idZ++)
-  {
-    for (int idY = extent[2]; idY <= extent[3]; idY++)
+    for (vtkIdType row = begin; row < end; row++)
     {
-      if (count % target == 0)
+      if (isFirst && (row - begin) % target == 0)
       {
-        this->UpdateProgress(count / (50.0 * target));
+        this->UpdateProgress(static_cast<double>(row - begin) / (end - begin));
       }
-      count++;
 
+      int idY = extent[2] + static_cast<int>(row % ySize);
+      int idZ = extent[4] + static_cast<int>(row / ySize);
       int state = 1; // inside or outside, start outside
       int r1 = extent[0];
       int r2 = extent[1];
 
       // index into scalar array
-      vtkIdType idS = (static_cast<vtkIdType>(extent[1] - extent[0] + 1) *
-        (static_cast<vtkIdType>(extent[3] - extent[2] + 1) *
-            static_cast<vtkIdType>(idZ - extent[4]) +
-          static_cast<vtkIdType>(idY - extent[2])));
+      vtkIdType idS = static_cast<vtkIdType>(extent[1] - extent[0] + 1) * row;
 
       for (int idX = extent[0]; idX <= extent[1]; idX++)
       {
@@ -157,8 +159,17 @@ int vtkImageToImageStencil::RequestData(
       { // if inside at end, cap off the sub extent
         data->InsertNextExtent(r1, extent[1], idY, idZ);
       }
-    } // for idY
-  }   // for idZ
+    } // for row
+  };
+
+  if (this->EnableSMP)
+  {
+    vtkSMPTools::For(0, numRows, fillRows);
+  }
+  else
+  {
+    fillRows(0, numRows);
+  }
 
   return 1;
 }
@@ -60,6 +60,14 @@ public:
   vtkGetMacro(LowerThreshold, double);
   ///@}
 
+  ///@{
+  /**
+   * Enable/Disable SMP for multithreading. SMP is On by default.
+   */
+  vtkGetMacro(EnableSMP, bool);
+  vtkSetMacro(EnableSMP, bool);
+  ///@}
+
 protected:
   vtkImageToImageStencil();
   ~vtkImageToImageStencil() override;
@@ -72,6 +80,7 @@ protected:
   double UpperThreshold;
   double LowerThreshold;
   double Threshold;
+  bool EnableSMP;
 
 private:
   vtkImageToImageStencil(const vtkImageToImageStencil&) = delete;
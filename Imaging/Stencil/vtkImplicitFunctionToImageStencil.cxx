@@ -8,6 +8,7 @@
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
 #include <cmath>
@@ -21,6 +22,7 @@ vtkImplicitFunctionToImageStencil::vtkImplicitFunctionToImageStencil()
 {
   this->SetNumberOfInputPorts(0);
   this->Threshold = 0;
+  this->EnableSMP = true;
 
   this->Input = nullptr;
 }
@@ -38,6 +40,7 @@ void vtkImplicitFunctionToImageStencil::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "Input: " << this->Input << "\n";
   os << indent << "Threshold: " << this->Threshold << "\n";
+  os << indent << "EnableSMP: " << (this->EnableSMP ? "On\n" : "Off\n");
 }
 
 //------------------------------------------------------------------------------
@@ -76,35 +79,36 @@ int vtkImplicitFunctionToImageStencil::RequestData(
     return 1;
   }
 
-  // for conversion of (idX,idY,idZ) into (x,y,z)
-  double point[3];
-
-  // for keeping track of progress
-  unsigned long count = 0;
   int extent[6];
   data->GetExtent(extent);
-  unsigned long target =
-    static_cast<unsigned long>((extent[5] - extent[4] + 1) * (extent[3] - extent[2] + 1) / 50.0);
-  target++;
 
-  // loop through all voxels
-  for (int idZ = extent[4]; idZ <= extent[5]; idZ++)
-  {
-    point[2] = idZ * spacing[2] + origin[2];
+  // each row of the stencil has its own extent list, so the rows can be
+  // filled in parallel
+  int ySize = extent[3] - extent[2] + 1;
+  vtkIdType numRows = static_cast<vtkIdType>(ySize) * (extent[5] - extent[4] + 1);
+  auto fillRows = [&](vtkIdType begin, vtkIdType end) {
+    // for keeping track of progress
+    bool isFirst = vtkSMPTools::GetSingleThread();
+    vtkIdType target = (end - begin) / 50 + 1;
 
-    for (int idY = extent[2]; idY <= extent[3]; idY++)
+    // for conversion of (idX,idY,idZ) into (x,y,z)
+    double point[3];
+
+    for (vtkIdType row = begin; row < end; row++)
     {
+      if (isFirst && (row - begin) % target == 0)
+      {
+        this->UpdateProgress(static_cast<double>(row - begin) / (end - begin));
+      }
+
+      int idY = extent[2] + static_cast<int>(row % ySize);
+      int idZ = extent[4] + static_cast<int>(row / ySize);
       point[1] = idY * spacing[1] + origin[1];
+      point[2] = idZ * spacing[2] + origin[2];
       int state = 1; // inside or outside, start outside
       int r1 = extent[0];
       int r2 = extent[1];
 
-      if (count % target == 0)
-      {
-        this->UpdateProgress(count / (50.0 * target));
-      }
-      count++;
-
       for (int idX = extent[0]; idX <= extent[1]; idX++)
       {
         point[0] = idX * spacing[0] + origin[0];
@@ -128,8 +132,17 @@ int vtkImplicitFunctionToImageStencil::RequestData(
       { // if inside at end, cap off the sub extent
         data->InsertNextExtent(r1, extent[1], idY, idZ);
       }
-    } // for idY
-  }   // for idZ
+    } // for row
+  };
+
+  if (this->EnableSMP)
+  {
+    vtkSMPTools::For(0, numRows, fillRows);
+  }
+  else
+  {
+    fillRows(0, numRows);
+  }
 
   return 1;
 }
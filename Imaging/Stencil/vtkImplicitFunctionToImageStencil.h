@@ -43,6 +43,15 @@ public:
   vtkGetMacro(Threshold, double);
   ///@}
 
+  ///@{
+  /**
+   * Enable/Disable SMP for multithreading. SMP is On by default.
+   * The implicit function must be thread safe for evaluation.
+   */
+  vtkGetMacro(EnableSMP, bool);
+  vtkSetMacro(EnableSMP, bool);
+  ///@}
+
   /**
    * Override GetMTime() to account for the implicit function.
    */
@@ -56,6 +65,7 @@ protected:
 
   vtkImplicitFunction* Input;
   double Threshold;
+  bool EnableSMP;
 
 private:
   vtkImplicitFunctionToImageStencil(const vtkImplicitFunctionToImageStencil&) = delete;
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
 // SPDX-FileCopyrightText: Copyright 2008 Sandia Corporation
 // SPDX-License-Identifier: LicenseRef-BSD-3-Clause-Sandia-USGov
+#include "vtkBarnesHut2DLayoutStrategy.h"
 #include "vtkCircularLayoutStrategy.h"
 #include "vtkEdgeListIterator.h"
 #include "vtkFast2DLayoutStrategy.h"
@@ -185,5 +186,44 @@ int TestGraphLayoutStrategy(int vtkNotUsed(argc), char* vtkNotUsed(argv)[])
   }
   cerr << "...done." << endl;
 
+  cerr << "Testing vtkBarnesHut2DLayoutStrategy..." << endl;
+  VTK_CREATE(vtkBarnesHut2DLayoutStrategy, barnesHut);
+  barnesHut->SetRestDistance(1.0f);
+  length = barnesHut->GetRestDistance();
+  layout->SetLayoutStrategy(barnesHut);
+  for (int multiLevel = 0; multiLevel < 2; ++multiLevel)
+  {
+    barnesHut->SetMultiLevel(multiLevel != 0);
+    layout->Update();
+    output = layout->GetOutput();
+    output->GetEdges(edges);
+    while (edges->HasNext())
+    {
+      vtkEdgeType e = edges->Next();
+      vtkIdType u = e.Source;
+      vtkIdType v = e.Target;
+      output->GetPoint(u, pt);
+      output->GetPoint(v, pt2);
+      double dist = sqrt(vtkMath::Distance2BetweenPoints(pt, pt2));
+      if (dist < length / tol || dist > length * tol)
+      {
+        cerr << "ERROR: Edge " << u << "," << v << " distance is " << dist
+             << " but resting distance is " << length << endl;
+        errors++;
+      }
+      if (pt[2] != 0.0)
+      {
+        cerr << "ERROR: Point " << u << " not on the xy plane" << endl;
+        errors++;
+      }
+      if (pt2[2] != 0.0)
+      {
+        cerr << "ERROR: Point " << v << " not on the xy plane" << endl;
+        errors++;
+      }
+    }
+  }
+  cerr << "...done." << endl;
+
   return errors;
 }
@@ -0,0 +1,738 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-FileCopyrightText: Copyright 2008 Sandia Corporation
+// SPDX-License-Identifier: LicenseRef-BSD-3-Clause-Sandia-USGov
+
+#include "vtkBarnesHut2DLayoutStrategy.h"
+
+#include "vtkCommand.h"
+#include "vtkDataArray.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkEdgeListIterator.h"
+#include "vtkFloatArray.h"
+#include "vtkGraph.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPoints.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkBarnesHut2DLayoutStrategy);
+
+namespace
+{
+// Cool-down function.
+inline float CoolDown(float t, float r)
+{
+  return t - (t / r);
+}
+
+// A graph in compressed sparse row form, each edge being stored in both
+// directions. Coarse graphs also remember the coarse vertex each of their
+// vertices is collapsed into.
+struct CSRGraph
+{
+  vtkIdType NumberOfVertices = 0;
+  std::vector<float> Masses;
+  std::vector<vtkIdType> Offsets;
+  std::vector<vtkIdType> Neighbors;
+  std::vector<float> Weights;
+  std::vector<vtkIdType> Parents;
+
+  double GetAverageMass() const
+  {
+    const double total = std::accumulate(this->Masses.begin(), this->Masses.end(), 0.0);
+    return this->NumberOfVertices > 0 ? total / this->NumberOfVertices : 1.0;
+  }
+};
+
+// Spread the 30 low bits of v on the even bits of the result.
+inline uint64_t SpreadBits(uint64_t v)
+{
+  v &= 0x3fffffff;
+  v = (v | (v << 16)) & 0x0000ffff0000ffffULL;
+  v = (v | (v << 8)) & 0x00ff00ff00ff00ffULL;
+  v = (v | (v << 4)) & 0x0f0f0f0f0f0f0f0fULL;
+  v = (v | (v << 2)) & 0x3333333333333333ULL;
+  v = (v | (v << 1)) & 0x5555555555555555ULL;
+  return v;
+}
+
+// A deterministic unit vector used to push i away from j when both vertices
+// are at the same place. j is pushed in the opposite direction.
+inline void SeparationDirection(vtkIdType i, vtkIdType j, float& dx, float& dy)
+{
+  const vtkIdType a = std::min(i, j);
+  const vtkIdType b = std::max(i, j);
+  const double angle =
+    2.0 * vtkMath::Pi() * std::fmod(a * 0.6180339887 + b * 0.7548776662, 1.0);
+  const float sign = i < j ? 1.0f : -1.0f;
+  dx = sign * static_cast<float>(std::cos(angle));
+  dy = sign * static_cast<float>(std::sin(angle));
+}
+
+// Barnes-Hut quadtree built over the Morton order of the vertices.
+class QuadTree
+{
+public:
+  static constexpr int MaximumDepth = 30;
+  static constexpr vtkIdType LeafSize = 8;
+
+  struct Node
+  {
+    float Center[2];
+    float Mass;
+    float Size;
+    vtkIdType Begin;
+    vtkIdType End;
+    int FirstChild;
+    int NumberOfChildren;
+  };
+
+  void Build(const float* pos, int stride, const float* masses, vtkIdType n)
+  {
+    this->Nodes.clear();
+    if (n == 0)
+    {
+      return;
+    }
+
+    float bounds[4] = { pos[0], pos[0], pos[1], pos[1] };
+    for (vtkIdType i = 1; i < n; ++i)
+    {
+      bounds[0] = std::min(bounds[0], pos[i * stride]);
+      bounds[1] = std::max(bounds[1], pos[i * stride]);
+      bounds[2] = std::min(bounds[2], pos[i * stride + 1]);
+      bounds[3] = std::max(bounds[3], pos[i * stride + 1]);
+    }
+    float size = std::max(bounds[1] - bounds[0], bounds[3] - bounds[2]);
+    size = size > 0 ? size * 1.0001f : 1.0f;
+    const double scale = static_cast<double>(1 << MaximumDepth) / size;
+
+    this->Codes.resize(n);
+    vtkSMPTools::For(0, n, [&](vtkIdType begin, vtkIdType end) {
+      const uint64_t maxCell = (1ULL << MaximumDepth) - 1;
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        const uint64_t qx = std::min(
+          maxCell, static_cast<uint64_t>((pos[i * stride] - bounds[0]) * scale));
+        const uint64_t qy = std::min(
+          maxCell, static_cast<uint64_t>((pos[i * stride + 1] - bounds[2]) * scale));
+        this->Codes[i] = std::make_pair(SpreadBits(qx) | (SpreadBits(qy) << 1), i);
+      }
+    });
+    vtkSMPTools::Sort(this->Codes.begin(), this->Codes.end());
+
+    this->Points.resize(3 * n);
+    this->Ids.resize(n);
+    vtkSMPTools::For(0, n, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        const vtkIdType id = this->Codes[i].second;
+        this->Ids[i] = id;
+        this->Points[3 * i] = pos[id * stride];
+        this->Points[3 * i + 1] = pos[id * stride + 1];
+        this->Points[3 * i + 2] = masses[id];
+      }
+    });
+
+    this->Nodes.push_back(Node{ { 0, 0 }, 0, size, 0, n, -1, 0 });
+    this->BuildNode(0, 0);
+  }
+
+  // Add to force the repulsion exerted on vertex id at (x, y) by all the
+  // other vertices.
+  void AddRepulsion(vtkIdType id, float x, float y, float k2, float theta2, float minDist2,
+    float force[2]) const
+  {
+    if (this->Nodes.empty())
+    {
+      return;
+    }
+    int stack[4 * MaximumDepth + 4];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0)
+    {
+      const Node& node = this->Nodes[stack[--top]];
+      if (node.FirstChild < 0)
+      {
+        for (vtkIdType p = node.Begin; p < node.End; ++p)
+        {
+          const vtkIdType other = this->Ids[p];
+          if (other == id)
+          {
+            continue;
+          }
+          float dx = x - this->Points[3 * p];
+          float dy = y - this->Points[3 * p + 1];
+          float d2 = dx * dx + dy * dy;
+          if (d2 < minDist2)
+          {
+            if (d2 == 0.0f)
+            {
+              SeparationDirection(id, other, dx, dy);
+            }
+            else
+            {
+              const float norm = 1.0f / std::sqrt(d2);
+              dx *= norm;
+              dy *= norm;
+            }
+            const float f = k2 * this->Points[3 * p + 2] / std::sqrt(minDist2);
+            force[0] += f * dx;
+            force[1] += f * dy;
+            continue;
+          }
+          const float f = k2 * this->Points[3 * p + 2] / d2;
+          force[0] += f * dx;
+          force[1] += f * dy;
+        }
+        continue;
+      }
+
+      const float dx = x - node.Center[0];
+      const float dy = y - node.Center[1];
+      const float d2 = dx * dx + dy * dy;
+      if (node.Size * node.Size < theta2 * d2)
+      {
+        // Far enough to be seen as a single body.
+        const float f = k2 * node.Mass / std::max(d2, minDist2);
+        force[0] += f * dx;
+        force[1] += f * dy;
+        continue;
+      }
+      for (int c = 0; c < node.NumberOfChildren; ++c)
+      {
+        stack[top++] = node.FirstChild + c;
+      }
+    }
+  }
+
+private:
+  // Split the vertices of a node into its non empty quadrants, then compute
+  // its center of mass.
+  void BuildNode(int index, int depth)
+  {
+    const vtkIdType begin = this->Nodes[index].Begin;
+    const vtkIdType end = this->Nodes[index].End;
+    if (end - begin > LeafSize && depth < MaximumDepth)
+    {
+      const int shift = 2 * (MaximumDepth - 1 - depth);
+      vtkIdType bounds[5];
+      bounds[0] = begin;
+      bounds[4] = end;
+      for (int q = 1; q < 4; ++q)
+      {
+        bounds[q] = std::partition_point(this->Codes.begin() + bounds[q - 1],
+                      this->Codes.begin() + end,
+                      [&](const std::pair<uint64_t, vtkIdType>& code) {
+                        return static_cast<int>((code.first >> shift) & 3) < q;
+                      }) -
+          this->Codes.begin();
+      }
+
+      const int firstChild = static_cast<int>(this->Nodes.size());
+      const float childSize = this->Nodes[index].Size * 0.5f;
+      for (int q = 0; q < 4; ++q)
+      {
+        if (bounds[q + 1] > bounds[q])
+        {
+          this->Nodes.push_back(Node{ { 0, 0 }, 0, childSize, bounds[q], bounds[q + 1], -1, 0 });
+        }
+      }
+      const int numberOfChildren = static_cast<int>(this->Nodes.size()) - firstChild;
+      this->Nodes[index].FirstChild = firstChild;
+      this->Nodes[index].NumberOfChildren = numberOfChildren;
+
+      double center[2] = { 0, 0 };
+      double mass = 0;
+      for (int c = firstChild; c < firstChild + numberOfChildren; ++c)
+      {
+        this->BuildNode(c, depth + 1);
+        const Node& child = this->Nodes[c];
+        center[0] += child.Center[0] * static_cast<double>(child.Mass);
+        center[1] += child.Center[1] * static_cast<double>(child.Mass);
+        mass += child.Mass;
+      }
+      this->SetCenterOfMass(index, center, mass);
+      return;
+    }
+
+    double center[2] = { 0, 0 };
+    double mass = 0;
+    for (vtkIdType p = begin; p < end; ++p)
+    {
+      center[0] += this->Points[3 * p] * static_cast<double>(this->Points[3 * p + 2]);
+      center[1] += this->Points[3 * p + 1] * static_cast<double>(this->Points[3 * p + 2]);
+      mass += this->Points[3 * p + 2];
+    }
+    this->SetCenterOfMass(index, center, mass);
+  }
+
+  void SetCenterOfMass(int index, const double center[2], double mass)
+  {
+    Node& node = this->Nodes[index];
+    node.Mass = static_cast<float>(mass);
+    if (mass > 0)
+    {
+      node.Center[0] = static_cast<float>(center[0] / mass);
+      node.Center[1] = static_cast<float>(center[1] / mass);
+    }
+    else
+    {
+      node.Center[0] = this->Points[3 * node.Begin];
+      node.Center[1] = this->Points[3 * node.Begin + 1];
+    }
+  }
+
+  std::vector<std::pair<uint64_t, vtkIdType>> Codes;
+  // x, y and mass of the vertices in Morton order.
+  std::vector<float> Points;
+  std::vector<vtkIdType> Ids;
+  std::vector<Node> Nodes;
+};
+
+// Collapse pairs of adjacent vertices chosen by heavy edge matching in a
+// random order. Returns false when the graph does not shrink enough.
+bool Coarsen(CSRGraph& fine, CSRGraph& coarse, std::mt19937& generator)
+{
+  const vtkIdType n = fine.NumberOfVertices;
+  std::vector<vtkIdType> order(n);
+  std::iota(order.begin(), order.end(), 0);
+  std::shuffle(order.begin(), order.end(), generator);
+
+  fine.Parents.assign(n, -1);
+  vtkIdType numberOfCoarseVertices = 0;
+  for (vtkIdType u : order)
+  {
+    if (fine.Parents[u] >= 0)
+    {
+      continue;
+    }
+    vtkIdType match = -1;
+    for (vtkIdType e = fine.Offsets[u]; e < fine.Offsets[u + 1]; ++e)
+    {
+      const vtkIdType v = fine.Neighbors[e];
+      if (v == u || fine.Parents[v] >= 0)
+      {
+        continue;
+      }
+      // Prefer heavy edges, then light vertices to keep the masses balanced.
+      if (match < 0 || fine.Weights[e] > fine.Weights[match] ||
+        (fine.Weights[e] == fine.Weights[match] &&
+          fine.Masses[v] < fine.Masses[fine.Neighbors[match]]))
+      {
+        match = e;
+      }
+    }
+    fine.Parents[u] = numberOfCoarseVertices;
+    if (match >= 0)
+    {
+      fine.Parents[fine.Neighbors[match]] = numberOfCoarseVertices;
+    }
+    ++numberOfCoarseVertices;
+  }
+
+  if (numberOfCoarseVertices > 0.8 * n)
+  {
+    fine.Parents.clear();
+    return false;
+  }
+
+  coarse.NumberOfVertices = numberOfCoarseVertices;
+  coarse.Masses.assign(numberOfCoarseVertices, 0.0f);
+  for (vtkIdType u = 0; u < n; ++u)
+  {
+    coarse.Masses[fine.Parents[u]] += fine.Masses[u];
+  }
+
+  // Merge the edges between the same coarse vertices, summing their weights.
+  struct CoarseEdge
+  {
+    vtkIdType Source;
+    vtkIdType Target;
+    float Weight;
+    bool operator<(const CoarseEdge& other) const
+    {
+      return this->Source < other.Source ||
+        (this->Source == other.Source && this->Target < other.Target);
+    }
+  };
+  std::vector<CoarseEdge> edges;
+  edges.reserve(fine.Neighbors.size());
+  for (vtkIdType u = 0; u < n; ++u)
+  {
+    for (vtkIdType e = fine.Offsets[u]; e < fine.Offsets[u + 1]; ++e)
+    {
+      const vtkIdType cu = fine.Parents[u];
+      const vtkIdType cv = fine.Parents[fine.Neighbors[e]];
+      if (cu != cv)
+      {
+        edges.push_back(CoarseEdge{ cu, cv, fine.Weights[e] });
+      }
+    }
+  }
+  vtkSMPTools::Sort(edges.begin(), edges.end());
+
+  coarse.Offsets.assign(numberOfCoarseVertices + 1, 0);
+  coarse.Neighbors.clear();
+  coarse.Weights.clear();
+  for (size_t e = 0; e < edges.size(); ++e)
+  {
+    if (e > 0 && edges[e].Source == edges[e - 1].Source && edges[e].Target == edges[e - 1].Target)
+    {
+      coarse.Weights.back() += edges[e].Weight;
+      continue;
+    }
+    coarse.Neighbors.push_back(edges[e].Target);
+    coarse.Weights.push_back(edges[e].Weight);
+    ++coarse.Offsets[edges[e].Source + 1];
+  }
+  std::partial_sum(coarse.Offsets.begin(), coarse.Offsets.end(), coarse.Offsets.begin());
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+class vtkBarnesHut2DLayoutStrategy::Internals
+{
+public:
+  // The input graph first, followed by the coarse graphs.
+  std::vector<CSRGraph> Levels;
+  QuadTree Tree;
+  std::vector<float> Displacements;
+  float RestDistance = 1.0f;
+
+  // One Fruchterman-Reingold step: each vertex moves along the sum of the
+  // repulsion of all the other vertices and of the attraction of its
+  // neighbors, its displacement being limited to maxStep.
+  void Iterate(const CSRGraph& graph, float* pos, int stride, float k, float maxStep, float theta)
+  {
+    const vtkIdType n = graph.NumberOfVertices;
+    this->Tree.Build(pos, stride, graph.Masses.data(), n);
+    this->Displacements.resize(2 * n);
+
+    const float k2 = k * k;
+    const float theta2 = theta * theta;
+    const float minDist2 = 1e-4f * k2;
+    vtkSMPTools::For(0, n, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        const float x = pos[i * stride];
+        const float y = pos[i * stride + 1];
+        float force[2] = { 0, 0 };
+        this->Tree.AddRepulsion(i, x, y, k2, theta2, minDist2, force);
+
+        // Heavy vertices represent several vertices that share the attraction.
+        const float invMass = 1.0f / graph.Masses[i];
+        for (vtkIdType e = graph.Offsets[i]; e < graph.Offsets[i + 1]; ++e)
+        {
+          const vtkIdType j = graph.Neighbors[e];
+          const float dx = x - pos[j * stride];
+          const float dy = y - pos[j * stride + 1];
+          const float f = graph.Weights[e] * invMass * std::sqrt(dx * dx + dy * dy) / k;
+          force[0] -= f * dx;
+          force[1] -= f * dy;
+        }
+
+        const float length = std::sqrt(force[0] * force[0] + force[1] * force[1]);
+        const float limit = length > maxStep ? maxStep / length : 1.0f;
+        this->Displacements[2 * i] = force[0] * limit;
+        this->Displacements[2 * i + 1] = force[1] * limit;
+      }
+    });
+
+    vtkSMPTools::For(0, n, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        pos[i * stride] += this->Displacements[2 * i];
+        pos[i * stride + 1] += this->Displacements[2 * i + 1];
+      }
+    });
+  }
+};
+
+//------------------------------------------------------------------------------
+vtkBarnesHut2DLayoutStrategy::vtkBarnesHut2DLayoutStrategy()
+  : Internal(new Internals)
+{
+  this->RandomSeed = 123;
+  this->MaxNumberOfIterations = 100;
+  this->IterationsPerLayout = 100;
+  this->InitialTemperature = 5;
+  this->CoolDownRate = 20.0;
+  this->RestDistance = 0;
+  this->Theta = 0.8;
+  this->MultiLevel = true;
+  this->TotalIterations = 0;
+  this->LayoutComplete = 0;
+  this->Temp = 0;
+  this->EdgeWeightField = nullptr;
+  this->SetEdgeWeightField("weight");
+}
+
+//------------------------------------------------------------------------------
+vtkBarnesHut2DLayoutStrategy::~vtkBarnesHut2DLayoutStrategy()
+{
+  this->SetEdgeWeightField(nullptr);
+}
+
+//------------------------------------------------------------------------------
+// Set the graph that will be laid out
+void vtkBarnesHut2DLayoutStrategy::Initialize()
+{
+  vtkMath::RandomSeed(this->RandomSeed);
+  this->Internal->Levels.clear();
+
+  // Set up some quick access variables
+  vtkPoints* pts = this->Graph->GetPoints();
+  vtkIdType numVertices = this->Graph->GetNumberOfVertices();
+
+  // Make sure output point type is float
+  if (pts->GetData()->GetDataType() != VTK_FLOAT)
+  {
+    vtkErrorMacro("Layout strategy expects to have points of type float");
+    this->LayoutComplete = 1;
+    return;
+  }
+
+  // Get a quick pointer to the point data
+  vtkFloatArray* array = vtkArrayDownCast<vtkFloatArray>(pts->GetData());
+  float* rawPointData = array->GetPointer(0);
+
+  // The optimal distance between vertices.
+  float k = this->RestDistance;
+  if (k <= 0)
+  {
+    k = std::sqrt(1.0f / std::max<vtkIdType>(numVertices, 1));
+  }
+  this->Internal->RestDistance = k;
+
+  // Get the weight array
+  vtkDataArray* weightArray = nullptr;
+  double maxWeight = 1;
+  if (this->WeightEdges && this->EdgeWeightField != nullptr)
+  {
+    weightArray = vtkArrayDownCast<vtkDataArray>(
+      this->Graph->GetEdgeData()->GetAbstractArray(this->EdgeWeightField));
+    if (weightArray != nullptr)
+    {
+      for (vtkIdType w = 0; w < weightArray->GetNumberOfTuples(); w++)
+      {
+        maxWeight = std::max(maxWeight, weightArray->GetTuple1(w));
+      }
+    }
+  }
+
+  // Load up the edges in both directions, skipping loops.
+  this->Internal->Levels.emplace_back();
+  CSRGraph& graph = this->Internal->Levels.back();
+  graph.NumberOfVertices = numVertices;
+  graph.Masses.assign(numVertices, 1.0f);
+  graph.Offsets.assign(numVertices + 1, 0);
+  vtkNew<vtkEdgeListIterator> it;
+  this->Graph->GetEdges(it);
+  while (it->HasNext())
+  {
+    vtkEdgeType e = it->Next();
+    if (e.Source != e.Target)
+    {
+      ++graph.Offsets[e.Source + 1];
+      ++graph.Offsets[e.Target + 1];
+    }
+  }
+  std::partial_sum(graph.Offsets.begin(), graph.Offsets.end(), graph.Offsets.begin());
+  graph.Neighbors.resize(graph.Offsets.back());
+  graph.Weights.resize(graph.Offsets.back());
+  std::vector<vtkIdType> next(graph.Offsets.begin(), graph.Offsets.end() - 1);
+  this->Graph->GetEdges(it);
+  while (it->HasNext())
+  {
+    vtkEdgeType e = it->Next();
+    if (e.Source == e.Target)
+    {
+      continue;
+    }
+    const float weight =
+      weightArray ? static_cast<float>(weightArray->GetTuple1(e.Id) / maxWeight) : 1.0f;
+    graph.Neighbors[next[e.Source]] = e.Target;
+    graph.Weights[next[e.Source]++] = weight;
+    graph.Neighbors[next[e.Target]] = e.Source;
+    graph.Weights[next[e.Target]++] = weight;
+  }
+
+  // Coarsen the graph until it is small or stops shrinking.
+  std::mt19937 generator(this->RandomSeed);
+  if (this->MultiLevel)
+  {
+    while (this->Internal->Levels.back().NumberOfVertices > 64 &&
+      this->Internal->Levels.size() < 30)
+    {
+      CSRGraph coarse;
+      if (!Coarsen(this->Internal->Levels.back(), coarse, generator))
+      {
+        break;
+      }
+      this->Internal->Levels.push_back(std::move(coarse));
+    }
+  }
+
+  const size_t numberOfLevels = this->Internal->Levels.size();
+  if (numberOfLevels == 1)
+  {
+    double bounds[6];
+    pts->GetBounds(bounds);
+    if (bounds[0] == bounds[1] && bounds[2] == bounds[3])
+    {
+      // Start from a random layout when all the vertices are at the same place.
+      const float side = std::sqrt(static_cast<float>(numVertices)) * k;
+      for (vtkIdType i = 0; i < numVertices; ++i)
+      {
+        rawPointData[3 * i] = side * static_cast<float>(vtkMath::Random() - .5);
+        rawPointData[3 * i + 1] = side * static_cast<float>(vtkMath::Random() - .5);
+      }
+    }
+    else
+    {
+      // Jitter x and y
+      for (vtkIdType i = 0; i < numVertices; ++i)
+      {
+        rawPointData[3 * i] += k * static_cast<float>(vtkMath::Random() - .5);
+        rawPointData[3 * i + 1] += k * static_cast<float>(vtkMath::Random() - .5);
+      }
+    }
+  }
+  else
+  {
+    // Place the coarsest graph randomly, then lay out each level and use the
+    // positions of the coarse vertices as the start of the finer level.
+    const CSRGraph& coarsest = this->Internal->Levels.back();
+    std::vector<float> coarsePos(2 * coarsest.NumberOfVertices);
+    const float side = std::sqrt(static_cast<float>(numVertices)) * k;
+    for (float& coordinate : coarsePos)
+    {
+      coordinate = side * static_cast<float>(vtkMath::Random() - .5);
+    }
+    for (size_t level = numberOfLevels - 1; level > 0; --level)
+    {
+      const CSRGraph& coarse = this->Internal->Levels[level];
+      // The forces are the ones between the vertices collapsed into each
+      // coarse vertex, but the steps grow with the size of the coarse vertices.
+      const float scale = k * static_cast<float>(std::sqrt(coarse.GetAverageMass()));
+      float temp = this->InitialTemperature;
+      for (int i = 0; i < this->MaxNumberOfIterations; ++i)
+      {
+        this->Internal->Iterate(coarse, coarsePos.data(), 2, k, temp * scale, this->Theta);
+        temp = CoolDown(temp, this->CoolDownRate);
+      }
+
+      const CSRGraph& fine = this->Internal->Levels[level - 1];
+      const float jitter = k * static_cast<float>(std::sqrt(fine.GetAverageMass()));
+      const int stride = level == 1 ? 3 : 2;
+      std::vector<float> finePos;
+      float* target = rawPointData;
+      if (level > 1)
+      {
+        finePos.resize(2 * fine.NumberOfVertices);
+        target = finePos.data();
+      }
+      for (vtkIdType i = 0; i < fine.NumberOfVertices; ++i)
+      {
+        const vtkIdType parent = fine.Parents[i];
+        target[i * stride] =
+          coarsePos[2 * parent] + jitter * static_cast<float>(vtkMath::Random() - .5);
+        target[i * stride + 1] =
+          coarsePos[2 * parent + 1] + jitter * static_cast<float>(vtkMath::Random() - .5);
+      }
+      coarsePos.swap(finePos);
+    }
+    this->Internal->Levels.resize(1);
+  }
+
+  // This is a 2D layout
+  for (vtkIdType i = 0; i < numVertices; ++i)
+  {
+    rawPointData[3 * i + 2] = 0;
+  }
+  pts->Modified();
+
+  // Set some vars
+  this->TotalIterations = 0;
+  this->LayoutComplete = 0;
+  this->Temp = this->InitialTemperature;
+}
+
+//------------------------------------------------------------------------------
+void vtkBarnesHut2DLayoutStrategy::Layout()
+{
+  // Do I have a graph to layout
+  if (this->Graph == nullptr)
+  {
+    vtkErrorMacro("Graph Layout called with Graph==nullptr, call SetGraph(g) first");
+    this->LayoutComplete = 1;
+    return;
+  }
+
+  // If there are zero or one vertex, we are done
+  if (this->Graph->GetNumberOfVertices() <= 1 || this->Internal->Levels.empty() ||
+    this->Internal->Levels[0].NumberOfVertices != this->Graph->GetNumberOfVertices())
+  {
+    this->LayoutComplete = 1;
+    return;
+  }
+
+  // Get a quick pointer to the point data
+  vtkPoints* pts = this->Graph->GetPoints();
+  vtkFloatArray* array = vtkArrayDownCast<vtkFloatArray>(pts->GetData());
+  float* rawPointData = array->GetPointer(0);
+
+  const float k = this->Internal->RestDistance;
+  for (int i = 0; i < this->IterationsPerLayout; ++i)
+  {
+    this->Internal->Iterate(
+      this->Internal->Levels[0], rawPointData, 3, k, this->Temp * k, this->Theta);
+
+    // Reduce temperature as layout approaches a better configuration.
+    this->Temp = CoolDown(this->Temp, this->CoolDownRate);
+
+    // Announce progress
+    double progress =
+      (i + this->TotalIterations) / static_cast<double>(this->MaxNumberOfIterations);
+    this->InvokeEvent(vtkCommand::ProgressEvent, static_cast<void*>(&progress));
+  }
+
+  // Check for completion of layout
+  this->TotalIterations += this->IterationsPerLayout;
+  if (this->TotalIterations >= this->MaxNumberOfIterations)
+  {
+    this->LayoutComplete = 1;
+  }
+
+  // Mark points as modified
+  pts->Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkBarnesHut2DLayoutStrategy::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "RandomSeed: " << this->RandomSeed << endl;
+  os << indent << "MaxNumberOfIterations: " << this->MaxNumberOfIterations << endl;
+  os << indent << "IterationsPerLayout: " << this->IterationsPerLayout << endl;
+  os << indent << "InitialTemperature: " << this->InitialTemperature << endl;
+  os << indent << "CoolDownRate: " << this->CoolDownRate << endl;
+  os << indent << "RestDistance: " << this->RestDistance << endl;
+  os << indent << "Theta: " << this->Theta << endl;
+  os << indent << "MultiLevel: " << (this->MultiLevel ? "On" : "Off") << endl;
+  os << indent << "EdgeWeightField: " << (this->EdgeWeightField ? this->EdgeWeightField : "(none)")
+     << endl;
+}
+VTK_ABI_NAMESPACE_END
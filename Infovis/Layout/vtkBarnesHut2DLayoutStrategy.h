@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-FileCopyrightText: Copyright 2008 Sandia Corporation
+// SPDX-License-Identifier: LicenseRef-BSD-3-Clause-Sandia-USGov
+/**
+ * @class   vtkBarnesHut2DLayoutStrategy
+ * @brief   a force directed 2D graph layout for large graphs
+ *
+ *
+ * This class is a Fruchterman-Reingold force directed layout strategy where
+ * the repulsion between all pairs of vertices is approximated with a
+ * Barnes-Hut quadtree, so each iteration costs O(V log V + E) instead of the
+ * O(V^2) of vtkForceDirectedLayoutStrategy. The forces are computed in
+ * parallel with vtkSMPTools.
+ *
+ * When MultiLevel is on (the default), Initialize() repeatedly coarsens the
+ * graph by collapsing matched pairs of adjacent vertices, lays out the
+ * coarsest graph, and refines the result level by level. The iterations of
+ * Layout() then only have to untangle the neighborhood of each vertex, which
+ * makes the strategy suitable for graphs of millions of vertices.
+ *
+ * @sa
+ * vtkForceDirectedLayoutStrategy vtkFast2DLayoutStrategy vtkIncrementalForceLayout
+ */
+
+#ifndef vtkBarnesHut2DLayoutStrategy_h
+#define vtkBarnesHut2DLayoutStrategy_h
+
+#include "vtkGraphLayoutStrategy.h"
+#include "vtkInfovisLayoutModule.h" // For export macro
+
+#include <memory> // For std::unique_ptr
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKINFOVISLAYOUT_EXPORT vtkBarnesHut2DLayoutStrategy : public vtkGraphLayoutStrategy
+{
+public:
+  static vtkBarnesHut2DLayoutStrategy* New();
+
+  vtkTypeMacro(vtkBarnesHut2DLayoutStrategy, vtkGraphLayoutStrategy);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Seed the random number generator used to place and jitter the vertices.
+   * The default is 123.
+   */
+  vtkSetClampMacro(RandomSeed, int, 0, VTK_INT_MAX);
+  vtkGetMacro(RandomSeed, int);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the maximum number of iterations on the full graph, and on each
+   * coarse graph when MultiLevel is on. The default is 100.
+   */
+  vtkSetClampMacro(MaxNumberOfIterations, int, 0, VTK_INT_MAX);
+  vtkGetMacro(MaxNumberOfIterations, int);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the number of iterations per layout.
+   * The only use for this ivar is for the application
+   * to do visualizations of the layout before it's complete.
+   * The default is 100 to match the default MaxNumberOfIterations.
+   */
+  vtkSetClampMacro(IterationsPerLayout, int, 0, VTK_INT_MAX);
+  vtkGetMacro(IterationsPerLayout, int);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the maximum displacement of a vertex during the first iteration,
+   * in units of RestDistance. The default is 5.
+   */
+  vtkSetClampMacro(InitialTemperature, float, 0.0, VTK_FLOAT_MAX);
+  vtkGetMacro(InitialTemperature, float);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the cool-down rate. After each iteration the temperature is
+   * reduced by temperature / CoolDownRate, so the higher this number is, the
+   * slower the layout cools down. The default is 20.
+   */
+  vtkSetClampMacro(CoolDownRate, double, 0.01, VTK_DOUBLE_MAX);
+  vtkGetMacro(CoolDownRate, double);
+  ///@}
+
+  ///@{
+  /**
+   * Manually set the resting distance, that is the ideal length of an edge.
+   * Otherwise the distance is computed automatically so that the layout
+   * spans about one unit.
+   */
+  vtkSetMacro(RestDistance, float);
+  vtkGetMacro(RestDistance, float);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the Barnes-Hut opening criterion: a quadtree cell of size s at a
+   * distance d from a vertex is approximated by its center of mass when
+   * s / d < Theta. Zero computes the exact repulsion, higher values are
+   * faster and less accurate. The default is 0.8.
+   */
+  vtkSetClampMacro(Theta, float, 0.0, VTK_FLOAT_MAX);
+  vtkGetMacro(Theta, float);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get whether the layout starts from the layout of coarsened versions
+   * of the graph. In that case the input vertex coordinates are ignored,
+   * otherwise they are the starting layout. The default is true.
+   */
+  vtkSetMacro(MultiLevel, bool);
+  vtkGetMacro(MultiLevel, bool);
+  vtkBooleanMacro(MultiLevel, bool);
+  ///@}
+
+  /**
+   * This strategy sets up some data structures
+   * for faster processing of each Layout() call,
+   * and computes the multilevel starting layout.
+   */
+  void Initialize() override;
+
+  /**
+   * This is the layout method where the graph that was
+   * set in SetGraph() is laid out. The method can either
+   * entirely layout the graph or iteratively lay out the
+   * graph. If you have an iterative layout please implement
+   * the IsLayoutComplete() method.
+   */
+  void Layout() override;
+
+  /**
+   * I'm an iterative layout so this method lets the caller
+   * know if I'm done laying out the graph
+   */
+  int IsLayoutComplete() override { return this->LayoutComplete; }
+
+protected:
+  vtkBarnesHut2DLayoutStrategy();
+  ~vtkBarnesHut2DLayoutStrategy() override;
+
+  int RandomSeed;
+  int MaxNumberOfIterations;
+  int IterationsPerLayout;
+  float InitialTemperature;
+  double CoolDownRate;
+  float RestDistance;
+  float Theta;
+  bool MultiLevel;
+
+private:
+  class Internals;
+  std::unique_ptr<Internals> Internal;
+
+  int TotalIterations;
+  int LayoutComplete;
+  float Temp;
+
+  vtkBarnesHut2DLayoutStrategy(const vtkBarnesHut2DLayoutStrategy&) = delete;
+  void operator=(const vtkBarnesHut2DLayoutStrategy&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -10,7 +10,9 @@
 #include <atomic>
 #include <chrono>
 #include <functional>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 namespace
 {
@@ -202,6 +204,96 @@ bool TestSharedFutures()
 
   return retVal;
 }
+
+//-----------------------------------------------------------------------------
+bool TestPriorities()
+{
+  vtkNew<vtkThreadedCallbackQueue> queue;
+  std::mutex mutex;
+  std::vector<int> order;
+
+  // We block the only thread of the queue so every following push is queued.
+  std::atomic_bool started(false);
+  std::atomic_bool released(false);
+  auto blocker = queue->Push([&started, &released] {
+    started = true;
+    while (!released)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  });
+  while (!started)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  auto record = [&mutex, &order](int id) {
+    std::lock_guard<std::mutex> lock(mutex);
+    order.push_back(id);
+  };
+
+  std::atomic_int detachedCount(0);
+  queue->PushWithPriority(vtkThreadedCallbackQueue::LOW_PRIORITY, record, 0);
+  queue->PushWithPriority(vtkThreadedCallbackQueue::LOW_PRIORITY, record, 1);
+  queue->Push(record, 2);
+  queue->PushDetached([&detachedCount] {
+    ++detachedCount;
+    return 42;
+  });
+  queue->PushWithPriority(vtkThreadedCallbackQueue::HIGH_PRIORITY, record, 3);
+  queue->PushDependentWithPriority(vtkThreadedCallbackQueue::HIGH_PRIORITY,
+    std::vector<vtkThreadedCallbackQueue::SharedFutureBasePointer>{ blocker }, record, 4);
+  queue->PushDetachedWithPriority(vtkThreadedCallbackQueue::LOW_PRIORITY, record, 5);
+
+  auto last = queue->PushWithPriority(vtkThreadedCallbackQueue::LOW_PRIORITY, [] {});
+
+  // We wait on the future itself: vtkThreadedCallbackQueue::Wait would run the task right away.
+  released = true;
+  last->Wait();
+
+  // The high priority tasks run first, then the normal and low priority tasks, in the order they
+  // were pushed. The dependent task is released once the blocker terminates and is queued with
+  // its priority.
+  const std::vector<int> expected = { 3, 4, 2, 0, 1, 5 };
+  if (order != expected || detachedCount != 1)
+  {
+    vtkLog(ERROR, "Tasks did not run in the order of their priority.");
+    return false;
+  }
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool TestWaitRunsOnce()
+{
+  std::atomic_int count(0);
+  int N = 100;
+  {
+    vtkNew<vtkThreadedCallbackQueue> queue;
+    std::atomic_bool released(false);
+    queue->Push([&released] {
+      while (!released)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    });
+    std::vector<vtkThreadedCallbackQueue::SharedFuturePointer<void>> futures;
+    for (int i = 0; i < N; ++i)
+    {
+      futures.emplace_back(queue->Push([&count] { ++count; }));
+    }
+    // Wait runs the task in the middle of the queue itself, it must not be run again by the queue.
+    queue->Wait(std::vector<vtkThreadedCallbackQueue::SharedFuturePointer<void>>{ futures[N / 2] });
+    released = true;
+    queue->Push([&count] { ++count; });
+  }
+  if (count != N + 1)
+  {
+    vtkLog(ERROR, "Wrong number of tasks run: " << count << " instead of " << N + 1);
+    return false;
+  }
+  return true;
+}
 } // anonymous namespace
 
 int TestThreadedCallbackQueue(int, char*[])
@@ -211,6 +303,12 @@ int TestThreadedCallbackQueue(int, char*[])
 
   retVal &= ::TestFunctionTypeCompleteness();
 
+  vtkLog(INFO, "Testing priorities");
+  retVal &= ::TestPriorities();
+
+  vtkLog(INFO, "Testing that waiting for a queued task runs it once");
+  retVal &= ::TestWaitRunsOnce();
+
   vtkLog(INFO, "Testing expanding from 2 to 8 threads");
   // Testing expanding the number of threads
   ::RunThreads(2, 8);
@@ -3,6 +3,8 @@
 #include "vtkCommunicator.h"
 
 #include "vtkBoundingBox.h"
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
 #include "vtkCharArray.h"
 #include "vtkCompositeDataSet.h"
 #include "vtkDataObjectTypes.h"
@@ -16,9 +18,13 @@
 #include "vtkIdTypeArray.h"
 #include "vtkImageData.h"
 #include "vtkIntArray.h"
+#include "vtkMatrix3x3.h"
 #include "vtkMultiProcessController.h"
 #include "vtkMultiProcessStream.h"
 #include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
 #include "vtkRectilinearGrid.h"
 #include "vtkSmartPointer.h"
 #include "vtkStructuredGrid.h"
@@ -27,10 +33,14 @@
 #include "vtkTypeTraits.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnsignedLongArray.h"
+#include "vtkUnstructuredGrid.h"
 
 #define VTK_CREATE(type, name) vtkSmartPointer<type> name = vtkSmartPointer<type>::New()
 
 #include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 #define EXTENT_HEADER_SIZE 128
@@ -68,6 +78,328 @@
     vtkGenericWarningMacro(<< #name << " not supported for floating point numbers");               \
   }
 
+//=============================================================================
+// Binary transfer of data sets: a vtkMultiProcessStream header describing the
+// structure of the data set and its arrays, followed by the raw buffer of each
+// array in the order of the header.
+namespace
+{
+enum DataObjectFormat
+{
+  LEGACY_FORMAT = 0,
+  BINARY_FORMAT = 1
+};
+
+// Where an array goes in the received data set.
+enum BinaryArrayRole
+{
+  FIELD_DATA_ARRAY = 0,
+  POINT_DATA_ARRAY,
+  CELL_DATA_ARRAY,
+  POINTS_ARRAY,
+  COORDINATES_ARRAY,
+  CELL_OFFSETS_ARRAY,
+  CELL_CONNECTIVITY_ARRAY,
+  CELL_TYPES_ARRAY,
+  FACE_LOCATIONS_ARRAY,
+  FACES_ARRAY
+};
+
+struct BinaryArray
+{
+  int Role;
+  // The attribute type of data set attributes, the axis of rectilinear
+  // coordinates or the index of the cell array of cell offsets and
+  // connectivity, -1 otherwise.
+  int Slot;
+  vtkDataArray* Array;
+};
+
+bool IsBinaryTransferable(vtkDataArray* array)
+{
+  if (!array)
+  {
+    return false;
+  }
+  switch (array->GetDataType())
+  {
+    case VTK_CHAR:
+    case VTK_SIGNED_CHAR:
+    case VTK_UNSIGNED_CHAR:
+    case VTK_SHORT:
+    case VTK_UNSIGNED_SHORT:
+    case VTK_INT:
+    case VTK_UNSIGNED_INT:
+    case VTK_LONG:
+    case VTK_UNSIGNED_LONG:
+    case VTK_LONG_LONG:
+    case VTK_UNSIGNED_LONG_LONG:
+    case VTK_FLOAT:
+    case VTK_DOUBLE:
+    case VTK_ID_TYPE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool AddBinaryArray(int role, int slot, vtkDataArray* array, std::vector<BinaryArray>& arrays)
+{
+  if (!IsBinaryTransferable(array))
+  {
+    return false;
+  }
+  arrays.push_back({ role, slot, array });
+  return true;
+}
+
+bool CollectBinaryFieldArrays(vtkFieldData* fd, int role, std::vector<BinaryArray>& arrays)
+{
+  vtkDataSetAttributes* dsa = vtkDataSetAttributes::SafeDownCast(fd);
+  for (int i = 0; i < fd->GetNumberOfArrays(); ++i)
+  {
+    // GetArray() returns nullptr for string and variant arrays.
+    if (!AddBinaryArray(role, dsa ? dsa->IsArrayAnAttribute(i) : -1, fd->GetArray(i), arrays))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool CollectBinaryCellArrays(vtkCellArray* cells, int slot, std::vector<BinaryArray>& arrays)
+{
+  return !cells ||
+    (AddBinaryArray(CELL_OFFSETS_ARRAY, slot, cells->GetOffsetsArray(), arrays) &&
+      AddBinaryArray(CELL_CONNECTIVITY_ARRAY, slot, cells->GetConnectivityArray(), arrays));
+}
+
+// Collect the arrays of the data object, return false if the data object or
+// one of its arrays cannot be transferred in the binary format.
+bool CollectBinaryArrays(vtkDataObject* data, std::vector<BinaryArray>& arrays)
+{
+  const int dataType = data->GetDataObjectType();
+  if (dataType != VTK_IMAGE_DATA && dataType != VTK_STRUCTURED_POINTS &&
+    dataType != VTK_RECTILINEAR_GRID && dataType != VTK_STRUCTURED_GRID &&
+    dataType != VTK_POLY_DATA && dataType != VTK_UNSTRUCTURED_GRID)
+  {
+    return false;
+  }
+
+  vtkDataSet* ds = vtkDataSet::SafeDownCast(data);
+  if (!ds || !CollectBinaryFieldArrays(ds->GetFieldData(), FIELD_DATA_ARRAY, arrays) ||
+    !CollectBinaryFieldArrays(ds->GetPointData(), POINT_DATA_ARRAY, arrays) ||
+    !CollectBinaryFieldArrays(ds->GetCellData(), CELL_DATA_ARRAY, arrays))
+  {
+    return false;
+  }
+
+  if (vtkRectilinearGrid* rg = vtkRectilinearGrid::SafeDownCast(ds))
+  {
+    vtkDataArray* coordinates[3] = { rg->GetXCoordinates(), rg->GetYCoordinates(),
+      rg->GetZCoordinates() };
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      if (coordinates[axis] && !AddBinaryArray(COORDINATES_ARRAY, axis, coordinates[axis], arrays))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  vtkPointSet* ps = vtkPointSet::SafeDownCast(ds);
+  if (!ps)
+  {
+    return true;
+  }
+  if (ps->GetPoints() && !AddBinaryArray(POINTS_ARRAY, -1, ps->GetPoints()->GetData(), arrays))
+  {
+    return false;
+  }
+
+  if (vtkPolyData* pd = vtkPolyData::SafeDownCast(ps))
+  {
+    return CollectBinaryCellArrays(pd->GetVerts(), 0, arrays) &&
+      CollectBinaryCellArrays(pd->GetLines(), 1, arrays) &&
+      CollectBinaryCellArrays(pd->GetPolys(), 2, arrays) &&
+      CollectBinaryCellArrays(pd->GetStrips(), 3, arrays);
+  }
+  if (vtkUnstructuredGrid* ug = vtkUnstructuredGrid::SafeDownCast(ps))
+  {
+    if (!ug->GetCells() || !ug->GetCellTypesArray())
+    {
+      return true;
+    }
+    if (!CollectBinaryCellArrays(ug->GetCells(), 0, arrays) ||
+      !AddBinaryArray(CELL_TYPES_ARRAY, -1, ug->GetCellTypesArray(), arrays))
+    {
+      return false;
+    }
+    if (ug->GetFaces() && ug->GetFaceLocations())
+    {
+      return AddBinaryArray(FACE_LOCATIONS_ARRAY, -1, ug->GetFaceLocations(), arrays) &&
+        AddBinaryArray(FACES_ARRAY, -1, ug->GetFaces(), arrays);
+    }
+  }
+  return true;
+}
+
+// The structure of the structured data sets, which is not held by arrays.
+void PushStructure(vtkDataObject* data, vtkMultiProcessStream& stream)
+{
+  int extent[6] = { 0, -1, 0, -1, 0, -1 };
+  if (vtkImageData* id = vtkImageData::SafeDownCast(data))
+  {
+    id->GetExtent(extent);
+    stream.Push(extent, 6);
+    stream.Push(id->GetOrigin(), 3);
+    stream.Push(id->GetSpacing(), 3);
+    stream.Push(id->GetDirectionMatrix()->GetData(), 9);
+  }
+  else if (vtkRectilinearGrid* rg = vtkRectilinearGrid::SafeDownCast(data))
+  {
+    rg->GetExtent(extent);
+    stream.Push(extent, 6);
+  }
+  else if (vtkStructuredGrid* sg = vtkStructuredGrid::SafeDownCast(data))
+  {
+    sg->GetExtent(extent);
+    stream.Push(extent, 6);
+  }
+}
+
+bool PopStructure(vtkDataObject* data, vtkMultiProcessStream& stream)
+{
+  if (!vtkImageData::SafeDownCast(data) && !vtkRectilinearGrid::SafeDownCast(data) &&
+    !vtkStructuredGrid::SafeDownCast(data))
+  {
+    return true;
+  }
+
+  int* extent = nullptr;
+  unsigned int size = 0;
+  stream.Pop(extent, size);
+  std::unique_ptr<int[]> extentHolder(extent);
+  if (size != 6)
+  {
+    return false;
+  }
+  if (vtkImageData* id = vtkImageData::SafeDownCast(data))
+  {
+    double* values[3] = { nullptr, nullptr, nullptr };
+    unsigned int sizes[3] = { 0, 0, 0 };
+    for (int i = 0; i < 3; ++i)
+    {
+      stream.Pop(values[i], sizes[i]);
+    }
+    std::unique_ptr<double[]> origin(values[0]), spacing(values[1]), direction(values[2]);
+    if (sizes[0] != 3 || sizes[1] != 3 || sizes[2] != 9)
+    {
+      return false;
+    }
+    id->SetExtent(extent);
+    id->SetOrigin(origin.get());
+    id->SetSpacing(spacing.get());
+    id->SetDirectionMatrix(direction.get());
+  }
+  else if (vtkRectilinearGrid* rg = vtkRectilinearGrid::SafeDownCast(data))
+  {
+    rg->SetExtent(extent);
+  }
+  else if (vtkStructuredGrid* sg = vtkStructuredGrid::SafeDownCast(data))
+  {
+    sg->SetExtent(extent);
+  }
+  return true;
+}
+
+// Put a received array in its place in the data set.
+bool SetBinaryArray(vtkDataSet* ds, int role, int slot, vtkDataArray* array,
+  vtkSmartPointer<vtkCellArray> cells[4], vtkSmartPointer<vtkDataArray> offsets[4],
+  vtkSmartPointer<vtkDataArray>& cellTypes, vtkSmartPointer<vtkDataArray>& faceLocations,
+  vtkSmartPointer<vtkDataArray>& faces)
+{
+  switch (role)
+  {
+    case FIELD_DATA_ARRAY:
+      ds->GetFieldData()->AddArray(array);
+      return true;
+    case POINT_DATA_ARRAY:
+    case CELL_DATA_ARRAY:
+    {
+      vtkDataSetAttributes* dsa = role == POINT_DATA_ARRAY
+        ? static_cast<vtkDataSetAttributes*>(ds->GetPointData())
+        : static_cast<vtkDataSetAttributes*>(ds->GetCellData());
+      const int index = dsa->AddArray(array);
+      if (slot >= 0)
+      {
+        dsa->SetActiveAttribute(index, slot);
+      }
+      return true;
+    }
+    case POINTS_ARRAY:
+    {
+      vtkPointSet* ps = vtkPointSet::SafeDownCast(ds);
+      if (!ps)
+      {
+        return false;
+      }
+      vtkNew<vtkPoints> points;
+      points->SetData(array);
+      ps->SetPoints(points);
+      return true;
+    }
+    case COORDINATES_ARRAY:
+    {
+      vtkRectilinearGrid* rg = vtkRectilinearGrid::SafeDownCast(ds);
+      if (!rg || slot < 0 || slot > 2)
+      {
+        return false;
+      }
+      if (slot == 0)
+      {
+        rg->SetXCoordinates(array);
+      }
+      else if (slot == 1)
+      {
+        rg->SetYCoordinates(array);
+      }
+      else
+      {
+        rg->SetZCoordinates(array);
+      }
+      return true;
+    }
+    case CELL_OFFSETS_ARRAY:
+      if (slot < 0 || slot > 3)
+      {
+        return false;
+      }
+      offsets[slot] = array;
+      return true;
+    case CELL_CONNECTIVITY_ARRAY:
+      if (slot < 0 || slot > 3 || !offsets[slot])
+      {
+        return false;
+      }
+      cells[slot] = vtkSmartPointer<vtkCellArray>::New();
+      return cells[slot]->SetData(offsets[slot], array);
+    case CELL_TYPES_ARRAY:
+      cellTypes = array;
+      return true;
+    case FACE_LOCATIONS_ARRAY:
+      faceLocations = array;
+      return true;
+    case FACES_ARRAY:
+      faces = array;
+      return true;
+    default:
+      return false;
+  }
+}
+}
+
 VTK_ABI_NAMESPACE_BEGIN
 STANDARD_OPERATION_DEFINITION(Max, (A[i] < B[i] ? B[i] : A[i]));
 STANDARD_OPERATION_DEFINITION(Min, (A[i] < B[i] ? A[i] : B[i]));
@@ -93,6 +425,7 @@ vtkCommunicator::vtkCommunicator()
   this->NumberOfProcesses = 1;
   this->MaximumNumberOfProcesses = vtkTypeTraits<int>::Max();
   this->Count = 0;
+  this->UseBinaryDataObjects = true;
 }
 
 //------------------------------------------------------------------------------
@@ -114,6 +447,7 @@ void vtkCommunicator::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "NumberOfProcesses: " << this->NumberOfProcesses << endl;
   os << indent << "LocalProcessId: " << this->LocalProcessId << endl;
   os << indent << "Count: " << this->Count << endl;
+  os << indent << "UseBinaryDataObjects: " << this->UseBinaryDataObjects << endl;
 }
 
 //------------------------------------------------------------------------------
@@ -201,6 +535,15 @@ int vtkCommunicator::Send(vtkDataObject* data, int remoteHandle, int tag)
 //------------------------------------------------------------------------------
 int vtkCommunicator::SendElementalDataObject(vtkDataObject* data, int remoteHandle, int tag)
 {
+  std::vector<BinaryArray> arrays;
+  int format = this->UseBinaryDataObjects && CollectBinaryArrays(data, arrays) ? BINARY_FORMAT
+                                                                               : LEGACY_FORMAT;
+  this->Send(&format, 1, remoteHandle, tag);
+  if (format == BINARY_FORMAT)
+  {
+    return this->SendBinaryDataObject(data, remoteHandle, tag);
+  }
+
   VTK_CREATE(vtkCharArray, buffer);
   if (vtkCommunicator::MarshalDataObject(data, buffer))
   {
@@ -211,6 +554,158 @@ int vtkCommunicator::SendElementalDataObject(vtkDataObject* data, int remoteHand
   return 0;
 }
 
+//------------------------------------------------------------------------------
+int vtkCommunicator::SendBinaryDataObject(vtkDataObject* data, int remoteHandle, int tag)
+{
+  std::vector<BinaryArray> arrays;
+  CollectBinaryArrays(data, arrays);
+
+  // Arrays without the standard memory layout are copied to a contiguous array
+  // of the same value type, the others are sent from their own buffer.
+  std::vector<vtkSmartPointer<vtkDataArray>> contiguousArrays;
+  vtkMultiProcessStream header;
+  PushStructure(data, header);
+  header << static_cast<int>(arrays.size());
+  for (BinaryArray& entry : arrays)
+  {
+    vtkDataArray* array = entry.Array;
+    if (!array->HasStandardMemoryLayout())
+    {
+      auto copy = vtk::TakeSmartPointer(vtkDataArray::CreateDataArray(array->GetDataType()));
+      copy->DeepCopy(array);
+      contiguousArrays.push_back(copy);
+      entry.Array = copy;
+    }
+    const char* name = array->GetName();
+    header << entry.Role << entry.Slot << array->GetDataType() << array->GetNumberOfComponents()
+           << static_cast<vtkTypeInt64>(array->GetNumberOfTuples()) << (name != nullptr)
+           << std::string(name ? name : "");
+    for (int comp = 0; comp < array->GetNumberOfComponents(); ++comp)
+    {
+      const char* compName = array->GetComponentName(comp);
+      header << (compName != nullptr) << std::string(compName ? compName : "");
+    }
+  }
+  if (!this->Send(header, remoteHandle, tag))
+  {
+    return 0;
+  }
+
+  for (const BinaryArray& entry : arrays)
+  {
+    const vtkIdType size = entry.Array->GetNumberOfValues();
+    if (size > 0 &&
+      !this->SendVoidArray(
+        entry.Array->GetVoidPointer(0), size, entry.Array->GetDataType(), remoteHandle, tag))
+    {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkCommunicator::ReceiveBinaryDataObject(vtkDataObject* data, int remoteHandle, int tag)
+{
+  vtkMultiProcessStream header;
+  if (!this->Receive(header, remoteHandle, tag))
+  {
+    return 0;
+  }
+
+  vtkDataSet* ds = vtkDataSet::SafeDownCast(data);
+  if (!ds)
+  {
+    vtkErrorMacro("Cannot receive a binary data set into a " << data->GetClassName() << ".");
+    return 0;
+  }
+  ds->Initialize();
+  if (!PopStructure(ds, header))
+  {
+    vtkErrorMacro("Invalid binary data set header.");
+    return 0;
+  }
+
+  int numberOfArrays = 0;
+  header >> numberOfArrays;
+  vtkSmartPointer<vtkCellArray> cells[4];
+  vtkSmartPointer<vtkDataArray> offsets[4];
+  vtkSmartPointer<vtkDataArray> cellTypes;
+  vtkSmartPointer<vtkDataArray> faceLocations;
+  vtkSmartPointer<vtkDataArray> faces;
+  for (int i = 0; i < numberOfArrays; ++i)
+  {
+    int role = -1;
+    int slot = -1;
+    int type = VTK_VOID;
+    int numberOfComponents = 0;
+    vtkTypeInt64 numberOfTuples = 0;
+    bool hasName = false;
+    std::string name;
+    header >> role >> slot >> type >> numberOfComponents >> numberOfTuples >> hasName >> name;
+
+    auto array = vtk::TakeSmartPointer(vtkDataArray::CreateDataArray(type));
+    if (!array || numberOfComponents < 1 || numberOfTuples < 0)
+    {
+      vtkErrorMacro("Invalid binary data set array.");
+      return 0;
+    }
+    array->SetNumberOfComponents(numberOfComponents);
+    array->SetNumberOfTuples(static_cast<vtkIdType>(numberOfTuples));
+    array->SetName(hasName ? name.c_str() : nullptr);
+    for (int comp = 0; comp < numberOfComponents; ++comp)
+    {
+      bool hasCompName = false;
+      std::string compName;
+      header >> hasCompName >> compName;
+      if (hasCompName)
+      {
+        array->SetComponentName(comp, compName.c_str());
+      }
+    }
+
+    // Receive the values directly in the array.
+    const vtkIdType size = array->GetNumberOfValues();
+    if (size > 0 &&
+      !this->ReceiveVoidArray(array->GetVoidPointer(0), size, type, remoteHandle, tag))
+    {
+      return 0;
+    }
+
+    if (!SetBinaryArray(ds, role, slot, array, cells, offsets, cellTypes, faceLocations, faces))
+    {
+      vtkErrorMacro("Invalid binary data set array.");
+      return 0;
+    }
+  }
+
+  if (vtkPolyData* pd = vtkPolyData::SafeDownCast(ds))
+  {
+    pd->SetVerts(cells[0]);
+    pd->SetLines(cells[1]);
+    pd->SetPolys(cells[2]);
+    pd->SetStrips(cells[3]);
+  }
+  else if (vtkUnstructuredGrid* ug = vtkUnstructuredGrid::SafeDownCast(ds))
+  {
+    vtkUnsignedCharArray* types = vtkUnsignedCharArray::SafeDownCast(cellTypes);
+    if (cells[0] && types)
+    {
+      vtkIdTypeArray* locations = vtkIdTypeArray::SafeDownCast(faceLocations);
+      vtkIdTypeArray* polyhedronFaces = vtkIdTypeArray::SafeDownCast(faces);
+      if (locations && polyhedronFaces)
+      {
+        ug->SetCells(types, cells[0], locations, polyhedronFaces);
+      }
+      else
+      {
+        ug->SetCells(types, cells[0]);
+      }
+    }
+  }
+  return 1;
+}
+
 //------------------------------------------------------------------------------
 int vtkCommunicator::Send(vtkDataArray* data, int remoteHandle, int tag)
 {
@@ -396,6 +891,16 @@ int vtkCommunicator::ReceiveDataObject(vtkDataObject* data, int remoteHandle, in
 //------------------------------------------------------------------------------
 int vtkCommunicator::ReceiveElementalDataObject(vtkDataObject* data, int remoteHandle, int tag)
 {
+  int format = LEGACY_FORMAT;
+  if (!this->Receive(&format, 1, remoteHandle, tag))
+  {
+    return 0;
+  }
+  if (format == BINARY_FORMAT)
+  {
+    return this->ReceiveBinaryDataObject(data, remoteHandle, tag);
+  }
+
   VTK_CREATE(vtkCharArray, buffer);
   if (!this->Receive(buffer, remoteHandle, tag))
   {
@@ -1687,6 +2192,114 @@ int vtkCommunicator::AllReduce(
     components * tuples, type, operation);
 }
 
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkCommunicatorRequest> vtkCommunicator::NoBlockAllReduceVoidArray(
+  const void* sendBuffer, void* recvBuffer, vtkIdType length, int type, int operation)
+{
+  if (!this->AllReduceVoidArray(sendBuffer, recvBuffer, length, type, operation))
+  {
+    return nullptr;
+  }
+  return vtkSmartPointer<vtkCommunicatorRequest>::New();
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkCommunicatorRequest> vtkCommunicator::NoBlockAllToAllVVoidArray(
+  const void* sendBuffer, const vtkIdType* sendLengths, const vtkIdType* sendOffsets,
+  void* recvBuffer, const vtkIdType* recvLengths, const vtkIdType* recvOffsets, int type)
+{
+  std::vector<int> peers(this->NumberOfProcesses);
+  for (int i = 0; i < this->NumberOfProcesses; i++)
+  {
+    peers[i] = i;
+  }
+  if (!this->ExchangeVoidArrays(this->NumberOfProcesses, peers.data(), sendBuffer, sendLengths,
+        sendOffsets, recvBuffer, recvLengths, recvOffsets, type))
+  {
+    return nullptr;
+  }
+  return vtkSmartPointer<vtkCommunicatorRequest>::New();
+}
+
+//------------------------------------------------------------------------------
+int vtkCommunicator::SetNeighbors(int numberOfNeighbors, const int* neighbors)
+{
+  for (int i = 0; i < numberOfNeighbors; i++)
+  {
+    if (neighbors[i] < 0 || neighbors[i] >= this->NumberOfProcesses)
+    {
+      vtkErrorMacro(<< "Invalid neighbor " << neighbors[i] << ".");
+      return 0;
+    }
+  }
+  this->Neighbors.assign(neighbors, neighbors + numberOfNeighbors);
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkCommunicatorRequest> vtkCommunicator::NoBlockNeighborAllToAllVVoidArray(
+  const void* sendBuffer, const vtkIdType* sendLengths, const vtkIdType* sendOffsets,
+  void* recvBuffer, const vtkIdType* recvLengths, const vtkIdType* recvOffsets, int type)
+{
+  if (!this->ExchangeVoidArrays(this->GetNumberOfNeighbors(), this->Neighbors.data(), sendBuffer,
+        sendLengths, sendOffsets, recvBuffer, recvLengths, recvOffsets, type))
+  {
+    return nullptr;
+  }
+  return vtkSmartPointer<vtkCommunicatorRequest>::New();
+}
+
+//------------------------------------------------------------------------------
+int vtkCommunicator::ExchangeVoidArrays(int numberOfPeers, const int* peers,
+  const void* sendBuffer, const vtkIdType* sendLengths, const vtkIdType* sendOffsets,
+  void* recvBuffer, const vtkIdType* recvLengths, const vtkIdType* recvOffsets, int type)
+{
+  int typeSize = 1;
+  switch (type)
+  {
+    vtkTemplateMacro(typeSize = sizeof(VTK_TT));
+  }
+  const char* src = reinterpret_cast<const char*>(sendBuffer);
+  char* dest = reinterpret_cast<char*>(recvBuffer);
+
+  // Exchange with the peers in increasing order of the pair (lower id, higher
+  // id). As all the processes follow the same global order, the smallest
+  // pending pair can always proceed and blocking messages cannot deadlock.
+  const int rank = this->LocalProcessId;
+  std::vector<int> order(numberOfPeers);
+  for (int i = 0; i < numberOfPeers; i++)
+  {
+    order[i] = i;
+  }
+  auto key = [rank, peers](int i) {
+    return std::make_pair(std::min(rank, peers[i]), std::max(rank, peers[i]));
+  };
+  std::sort(order.begin(), order.end(), [&key](int a, int b) { return key(a) < key(b); });
+
+  int result = 1;
+  for (int i : order)
+  {
+    const int peer = peers[i];
+    const char* sendData = src + sendOffsets[i] * typeSize;
+    char* recvData = dest + recvOffsets[i] * typeSize;
+    if (peer == rank)
+    {
+      memmove(recvData, sendData, recvLengths[i] * typeSize);
+    }
+    else if (rank < peer)
+    {
+      result &= this->SendVoidArray(sendData, sendLengths[i], type, peer, ALL_TO_ALL_TAG);
+      result &= this->ReceiveVoidArray(recvData, recvLengths[i], type, peer, ALL_TO_ALL_TAG);
+    }
+    else
+    {
+      result &= this->ReceiveVoidArray(recvData, recvLengths[i], type, peer, ALL_TO_ALL_TAG);
+      result &= this->SendVoidArray(sendData, sendLengths[i], type, peer, ALL_TO_ALL_TAG);
+    }
+  }
+  return result;
+}
+
 //------------------------------------------------------------------------------
 int vtkCommunicator::Broadcast(vtkMultiProcessStream& stream, int srcProcessId)
 {
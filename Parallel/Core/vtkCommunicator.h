@@ -20,10 +20,12 @@
 #ifndef vtkCommunicator_h
 #define vtkCommunicator_h
 
+#include "vtkCommunicatorRequest.h" // needed for vtkCommunicatorRequest.
 #include "vtkObject.h"
-#include "vtkParallelCoreModule.h" // For export macro
-#include "vtkSmartPointer.h"       // needed for vtkSmartPointer.
-#include <vector>                  // needed for std::vector
+#include "vtkParallelCoreModule.h"  // For export macro
+#include "vtkSmartPointer.h"        // needed for vtkSmartPointer.
+#include "vtkTypeTraits.h"          // needed for vtkTypeTraits.
+#include <vector>                   // needed for std::vector
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkBoundingBox;
@@ -68,7 +70,8 @@ public:
     SCATTER_TAG = 13,
     SCATTERV_TAG = 14,
     REDUCE_TAG = 15,
-    BARRIER_TAG = 16
+    BARRIER_TAG = 16,
+    ALL_TO_ALL_TAG = 17
   };
 
   enum StandardOperations
@@ -120,6 +123,21 @@ public:
    */
   int Send(vtkDataObject* data, int remoteHandle, int tag);
 
+  ///@{
+  /**
+   * When enabled, Send(vtkDataObject*) transfers the vtkImageData,
+   * vtkRectilinearGrid, vtkStructuredGrid, vtkPolyData and vtkUnstructuredGrid
+   * whose arrays are all numeric as a small header followed by the raw buffers
+   * of their arrays, without formatting them into an intermediate buffer. The
+   * receiving side allocates the arrays and receives directly into them. Other
+   * data objects are marshalled with MarshalDataObject(). Only the sending side
+   * needs to enable it. Default is true.
+   */
+  vtkSetMacro(UseBinaryDataObjects, bool);
+  vtkGetMacro(UseBinaryDataObjects, bool);
+  vtkBooleanMacro(UseBinaryDataObjects, bool);
+  ///@}
+
   /**
    * This method sends a data array to a destination.
    * Tag eliminates ambiguity
@@ -1209,6 +1227,82 @@ public:
   int AllReduce(vtkDataArray* sendBuffer, vtkDataArray* recvBuffer, Operation* operation);
   ///@}
 
+  /**
+   * Nonblocking version of AllReduce with a standard operation. The returned
+   * request must be completed with Wait() or Test() before \c recvBuffer is
+   * read or \c sendBuffer is modified, so that local computations can overlap
+   * the communication. Returns nullptr if the operation could not be started.
+   * Communicators without nonblocking collectives perform the blocking
+   * operation and return a completed request.
+   */
+  template <typename T>
+  vtkSmartPointer<vtkCommunicatorRequest> NoBlockAllReduce(
+    const T* sendBuffer, T* recvBuffer, vtkIdType length, int operation)
+  {
+    return this->NoBlockAllReduceVoidArray(
+      sendBuffer, recvBuffer, length, vtkTypeTraits<T>::VTK_TYPE_ID, operation);
+  }
+
+  /**
+   * Nonblocking personalized all-to-all exchange. Each process sends
+   * \c sendLengths[i] values from \c sendBuffer + \c sendOffsets[i] to
+   * process i, and receives \c recvLengths[i] values from process i into
+   * \c recvBuffer + \c recvOffsets[i]. All arrays of lengths and offsets have
+   * \c NumberOfProcesses entries, and the lengths sent must match the lengths
+   * received. See NoBlockAllReduce for the use of the returned request.
+   */
+  template <typename T>
+  vtkSmartPointer<vtkCommunicatorRequest> NoBlockAllToAllV(const T* sendBuffer,
+    const vtkIdType* sendLengths, const vtkIdType* sendOffsets, T* recvBuffer,
+    const vtkIdType* recvLengths, const vtkIdType* recvOffsets)
+  {
+    return this->NoBlockAllToAllVVoidArray(sendBuffer, sendLengths, sendOffsets, recvBuffer,
+      recvLengths, recvOffsets, vtkTypeTraits<T>::VTK_TYPE_ID);
+  }
+
+  ///@{
+  /**
+   * Set the neighbors of this process used by NoBlockNeighborAllToAllV. This
+   * is a collective operation. The neighborhood must be symmetric: if process
+   * i lists process j, process j must list process i. Returns 1 on success.
+   */
+  virtual int SetNeighbors(int numberOfNeighbors, const int* neighbors);
+  int GetNumberOfNeighbors() const { return static_cast<int>(this->Neighbors.size()); }
+  const int* GetNeighbors() const { return this->Neighbors.data(); }
+  ///@}
+
+  /**
+   * Nonblocking personalized exchange with the neighbors set by SetNeighbors.
+   * Same as NoBlockAllToAllV, except that the arrays of lengths and offsets
+   * have one entry per neighbor, in the order given to SetNeighbors. With MPI,
+   * this maps to the MPI-3 neighborhood collectives, whose cost depends on the
+   * number of neighbors instead of the number of processes.
+   */
+  template <typename T>
+  vtkSmartPointer<vtkCommunicatorRequest> NoBlockNeighborAllToAllV(const T* sendBuffer,
+    const vtkIdType* sendLengths, const vtkIdType* sendOffsets, T* recvBuffer,
+    const vtkIdType* recvLengths, const vtkIdType* recvOffsets)
+  {
+    return this->NoBlockNeighborAllToAllVVoidArray(sendBuffer, sendLengths, sendOffsets,
+      recvBuffer, recvLengths, recvOffsets, vtkTypeTraits<T>::VTK_TYPE_ID);
+  }
+
+  ///@{
+  /**
+   * Subclasses should reimplement these if they have nonblocking collectives.
+   * The default implementations perform the operation with blocking
+   * point-to-point messages and return a completed request.
+   */
+  virtual vtkSmartPointer<vtkCommunicatorRequest> NoBlockAllReduceVoidArray(
+    const void* sendBuffer, void* recvBuffer, vtkIdType length, int type, int operation);
+  virtual vtkSmartPointer<vtkCommunicatorRequest> NoBlockAllToAllVVoidArray(
+    const void* sendBuffer, const vtkIdType* sendLengths, const vtkIdType* sendOffsets,
+    void* recvBuffer, const vtkIdType* recvLengths, const vtkIdType* recvOffsets, int type);
+  virtual vtkSmartPointer<vtkCommunicatorRequest> NoBlockNeighborAllToAllVVoidArray(
+    const void* sendBuffer, const vtkIdType* sendLengths, const vtkIdType* sendOffsets,
+    void* recvBuffer, const vtkIdType* recvLengths, const vtkIdType* recvOffsets, int type);
+  ///@}
+
   ///@{
   /**
    * Subclasses should reimplement these if they have a more efficient
@@ -1340,8 +1434,21 @@ protected:
 
   int ReceiveDataObject(vtkDataObject* data, int remoteHandle, int tag, int type = -1);
   int ReceiveElementalDataObject(vtkDataObject* data, int remoteHandle, int tag);
+  int SendBinaryDataObject(vtkDataObject* data, int remoteHandle, int tag);
+  int ReceiveBinaryDataObject(vtkDataObject* data, int remoteHandle, int tag);
   int ReceiveMultiBlockDataSet(vtkMultiBlockDataSet* data, int remoteHandle, int tag);
 
+  /**
+   * Exchange arrays with the given processes using blocking point-to-point
+   * messages, in an order that cannot deadlock when all the processes of the
+   * exchange call it with symmetric lists of peers.
+   */
+  int ExchangeVoidArrays(int numberOfPeers, const int* peers, const void* sendBuffer,
+    const vtkIdType* sendLengths, const vtkIdType* sendOffsets, void* recvBuffer,
+    const vtkIdType* recvLengths, const vtkIdType* recvOffsets, int type);
+
+  std::vector<int> Neighbors;
+
   int MaximumNumberOfProcesses;
   int NumberOfProcesses;
 
@@ -1351,6 +1458,8 @@ protected:
 
   vtkIdType Count;
 
+  bool UseBinaryDataObjects;
+
 private:
   vtkCommunicator(const vtkCommunicator&) = delete;
   void operator=(const vtkCommunicator&) = delete;
@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCommunicatorRequest.h"
+
+#include "vtkObjectFactory.h"
+
+//------------------------------------------------------------------------------
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkCommunicatorRequest);
+
+//------------------------------------------------------------------------------
+void vtkCommunicatorRequest::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+}
+
+//------------------------------------------------------------------------------
+bool vtkCommunicatorRequest::Test()
+{
+  return true;
+}
+
+//------------------------------------------------------------------------------
+int vtkCommunicatorRequest::Wait()
+{
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkCommunicatorRequest::WaitAll(int count, vtkCommunicatorRequest* requests[])
+{
+  int result = 1;
+  for (int i = 0; i < count; ++i)
+  {
+    if (requests[i])
+    {
+      result &= requests[i]->Wait();
+    }
+  }
+  return result;
+}
+VTK_ABI_NAMESPACE_END
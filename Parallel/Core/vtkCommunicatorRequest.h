@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+/**
+ * @class   vtkCommunicatorRequest
+ * @brief   Handle on a nonblocking collective operation.
+ *
+ * vtkCommunicatorRequest is returned by the nonblocking collective
+ * operations of vtkCommunicator and vtkMultiProcessController, such as
+ * NoBlockAllReduce, NoBlockAllToAllV and NoBlockNeighborAllToAllV. The
+ * buffers given to the operation must not be accessed until Wait() returns
+ * or Test() returns true, so that local computations can be done while the
+ * operation progresses.
+ *
+ * This class represents an operation that completed when it was started,
+ * which is what communicators without nonblocking collectives return.
+ * vtkMPICommunicator returns a subclass wrapping an MPI request.
+ *
+ * @sa
+ * vtkCommunicator, vtkMultiProcessController
+ */
+
+#ifndef vtkCommunicatorRequest_h
+#define vtkCommunicatorRequest_h
+
+#include "vtkObject.h"
+#include "vtkParallelCoreModule.h" // For export macro
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKPARALLELCORE_EXPORT vtkCommunicatorRequest : public vtkObject
+{
+public:
+  vtkTypeMacro(vtkCommunicatorRequest, vtkObject);
+  static vtkCommunicatorRequest* New();
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Returns true if the operation completed, without blocking.
+   */
+  virtual bool Test();
+
+  /**
+   * Blocks until the operation completes. Returns 1 on success and 0 if the
+   * operation failed.
+   */
+  virtual int Wait();
+
+  /**
+   * Waits for all the non-null requests. Returns 1 if all of them succeeded.
+   */
+  static int WaitAll(int count, vtkCommunicatorRequest* requests[]);
+
+protected:
+  vtkCommunicatorRequest() = default;
+  ~vtkCommunicatorRequest() override = default;
+
+private:
+  vtkCommunicatorRequest(const vtkCommunicatorRequest&) = delete;
+  void operator=(const vtkCommunicatorRequest&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif // vtkCommunicatorRequest_h
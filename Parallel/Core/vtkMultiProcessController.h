@@ -1381,6 +1381,43 @@ public:
     return this->Communicator->AllReduce(sendBuffer, recvBuffer, operation);
   }
 
+  ///@{
+  /**
+   * Nonblocking collective operations. The returned request must be completed
+   * with Wait() or Test() before the buffers are accessed, so that local
+   * computations can overlap the communication. See vtkCommunicator for
+   * details; controllers without nonblocking collectives, such as
+   * vtkDummyController and vtkSocketController, perform the operation when it
+   * is started and return a completed request.
+   */
+  template <typename T>
+  vtkSmartPointer<vtkCommunicatorRequest> NoBlockAllReduce(
+    const T* sendBuffer, T* recvBuffer, vtkIdType length, int operation)
+  {
+    return this->Communicator->NoBlockAllReduce(sendBuffer, recvBuffer, length, operation);
+  }
+  template <typename T>
+  vtkSmartPointer<vtkCommunicatorRequest> NoBlockAllToAllV(const T* sendBuffer,
+    const vtkIdType* sendLengths, const vtkIdType* sendOffsets, T* recvBuffer,
+    const vtkIdType* recvLengths, const vtkIdType* recvOffsets)
+  {
+    return this->Communicator->NoBlockAllToAllV(
+      sendBuffer, sendLengths, sendOffsets, recvBuffer, recvLengths, recvOffsets);
+  }
+  int SetNeighbors(int numberOfNeighbors, const int* neighbors)
+  {
+    return this->Communicator->SetNeighbors(numberOfNeighbors, neighbors);
+  }
+  template <typename T>
+  vtkSmartPointer<vtkCommunicatorRequest> NoBlockNeighborAllToAllV(const T* sendBuffer,
+    const vtkIdType* sendLengths, const vtkIdType* sendOffsets, T* recvBuffer,
+    const vtkIdType* recvLengths, const vtkIdType* recvOffsets)
+  {
+    return this->Communicator->NoBlockNeighborAllToAllV(
+      sendBuffer, sendLengths, sendOffsets, recvBuffer, recvLengths, recvOffsets);
+  }
+  ///@}
+
   ///@{
   /**
    * Convenience methods to reduce bounds.
@@ -56,7 +56,8 @@ private:
       return false;
     }
 
-    auto& invokerQueue = this->Queue->InvokerQueue;
+    // We serve the queue of highest priority first.
+    InvokerQueueType& invokerQueue = *this->Queue->GetNextInvokerQueue();
 
     SharedFutureBasePointer invoker = std::move(invokerQueue.front());
     invokerQueue.pop_front();
@@ -65,7 +66,7 @@ private:
     // to lock invoker->Mutex
     invoker->Status.store(RUNNING, std::memory_order_release);
 
-    this->Queue->PopFrontNullptr();
+    vtkThreadedCallbackQueue::PopFrontNullptr(invokerQueue);
     lock.unlock();
 
     this->Queue->Invoke(std::move(invoker));
@@ -80,7 +81,7 @@ private:
   bool OnHold() const
   {
     return *this->ThreadIndex < this->Queue->NumberOfThreads && !this->Queue->Destroying &&
-      this->Queue->InvokerQueue.empty();
+      !this->Queue->GetNextInvokerQueue();
   }
 
   /**
@@ -89,7 +90,7 @@ private:
    */
   bool Continue() const
   {
-    return *this->ThreadIndex < this->Queue->NumberOfThreads && !this->Queue->InvokerQueue.empty();
+    return *this->ThreadIndex < this->Queue->NumberOfThreads && this->Queue->GetNextInvokerQueue();
   }
 
   vtkThreadedCallbackQueue* Queue;
@@ -195,19 +196,36 @@ void vtkThreadedCallbackQueue::Sync(int startId)
 }
 
 //-----------------------------------------------------------------------------
-void vtkThreadedCallbackQueue::PopFrontNullptr()
+void vtkThreadedCallbackQueue::PopFrontNullptr(InvokerQueueType& queue)
 {
-  while (!this->InvokerQueue.empty() && !this->InvokerQueue.front())
+  while (!queue.empty() && !queue.front())
   {
-    this->InvokerQueue.pop_front();
+    queue.pop_front();
   }
 }
 
+//-----------------------------------------------------------------------------
+vtkThreadedCallbackQueue::InvokerQueueType* vtkThreadedCallbackQueue::GetNextInvokerQueue()
+{
+  for (int priority = HIGH_PRIORITY; priority >= LOW_PRIORITY; --priority)
+  {
+    if (!this->InvokerQueues[priority].empty())
+    {
+      return &this->InvokerQueues[priority];
+    }
+  }
+  return nullptr;
+}
+
 //-----------------------------------------------------------------------------
 void vtkThreadedCallbackQueue::Invoke(vtkSharedFutureBase* invoker)
 {
   (*invoker)();
-  this->SignalDependentSharedFutures(invoker);
+  // No one can depend on a detached invoker, there is no need to lock it.
+  if (!invoker->IsDetached)
+  {
+    this->SignalDependentSharedFutures(invoker);
+  }
 }
 
 //-----------------------------------------------------------------------------
@@ -252,22 +270,20 @@ void vtkThreadedCallbackQueue::SignalDependentSharedFutures(vtkSharedFutureBase*
   if (!invokersToLaunch.empty())
   {
     std::lock_guard<std::mutex> lock(this->Mutex);
-    // We need to handle the invoker index.
-    // If the InvokerQueue is empty, then we set it such that after this look, the front has index
-    // 0.
-    vtkIdType index = this->InvokerQueue.empty() ? static_cast<vtkIdType>(invokersToLaunch.size())
-                                                 : this->InvokerQueue.front()->InvokerIndex;
     for (SharedFutureBasePointer& inv : invokersToLaunch)
     {
       assert(inv->Status.load(std::memory_order_acquire) == ON_HOLD && "Status should be ON_HOLD");
-      inv->InvokerIndex = --index;
+      InvokerQueueType& invokerQueue = this->InvokerQueues[inv->Priority];
+      // We need to handle the invoker index, which decreases towards the front of the queue.
+      inv->InvokerIndex = invokerQueue.empty() ? 0 : invokerQueue.front()->InvokerIndex - 1;
 
       std::lock_guard<std::mutex> stateLock(inv->Mutex);
       inv->Status.store(ENQUEUED, std::memory_order_release);
 
-      // This dependent has been waiting enough, let's give him some priority.
+      // This dependent has been waiting enough, let's give him some priority among the invokers
+      // of the same priority level.
       // Anyway, the invoker is past due if it was put inside InvokersOnHold.
-      this->InvokerQueue.emplace_front(std::move(inv));
+      invokerQueue.emplace_front(std::move(inv));
     }
   }
   for (std::size_t i = 0; i < invokersToLaunch.size(); ++i)
@@ -290,7 +306,8 @@ bool vtkThreadedCallbackQueue::TryInvoke(vtkSharedFutureBase* invoker)
 
         std::lock_guard<std::mutex> lock(this->Mutex);
 
-        if (this->InvokerQueue.empty())
+        InvokerQueueType& invokerQueue = this->InvokerQueues[invoker->Priority];
+        if (invokerQueue.empty())
         {
           return false;
         }
@@ -304,7 +321,7 @@ bool vtkThreadedCallbackQueue::TryInvoke(vtkSharedFutureBase* invoker)
         }
 
         // There has to be a front if we are here.
-        vtkIdType index = invoker->InvokerIndex - this->InvokerQueue.front()->InvokerIndex;
+        vtkIdType index = invoker->InvokerIndex - invokerQueue.front()->InvokerIndex;
 
         // When index is negative, it means that the invoker we want to run is already being
         // handled by the "normal" path of the queue. The invoker is locked by a mutex, we must
@@ -314,7 +331,7 @@ bool vtkThreadedCallbackQueue::TryInvoke(vtkSharedFutureBase* invoker)
           return false;
         }
 
-        SharedFutureBasePointer& result = this->InvokerQueue[index];
+        SharedFutureBasePointer& result = invokerQueue[index];
 
         // Someone has reinserted in the front another invoker. invoker is already running.
         if (result != invoker)
@@ -322,11 +339,17 @@ bool vtkThreadedCallbackQueue::TryInvoke(vtkSharedFutureBase* invoker)
           return false;
         }
 
-        // If we just picked the front invoker, let's pop the queue.
+        // If we just picked the front invoker, let's pop the queue. Otherwise, we leave a nullptr
+        // in its place so no thread picks it up again, and so the indices of the other invokers
+        // are preserved. It will be popped when it reaches the front.
         if (index == 0)
         {
-          this->InvokerQueue.pop_front();
-          this->PopFrontNullptr();
+          invokerQueue.pop_front();
+          vtkThreadedCallbackQueue::PopFrontNullptr(invokerQueue);
+        }
+        else
+        {
+          result = nullptr;
         }
         invoker->Status.store(RUNNING, std::memory_order_release);
         return true;
@@ -346,7 +369,12 @@ void vtkThreadedCallbackQueue::PrintSelf(ostream& os, vtkIndent indent)
 
   std::lock_guard<std::mutex> lock1(this->Mutex);
   os << indent << "Threads: " << this->NumberOfThreads << std::endl;
-  os << indent << "Callback queue size: " << this->InvokerQueue.size() << std::endl;
+  os << indent << "Callback queue sizes (low, normal, high priority):";
+  for (const InvokerQueueType& invokerQueue : this->InvokerQueues)
+  {
+    os << " " << invokerQueue.size();
+  }
+  os << std::endl;
 }
 
 VTK_ABI_NAMESPACE_END
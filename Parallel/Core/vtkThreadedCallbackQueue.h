@@ -12,7 +12,12 @@
  *
  * When a task is pushed, a `vtkSharedFuture` is returned. This instance can be used to get the
  * returned value when the task is finished, and provides functionalities to synchronize the main
- * thread with the status of its associated task.
+ * thread with the status of its associated task. Tasks whose result is never needed can be pushed
+ * with `PushDetached`, which does not hand out any future.
+ *
+ * Each task has a priority. Queued tasks of higher priority are picked by the threads before the
+ * ones of lower priority, so for instance interactive requests can overtake background prefetching.
+ * Tasks of the same priority are run in a FIFO fashion.
  *
  * All public methods of this class are thread safe.
  */
@@ -24,6 +29,7 @@
 #include "vtkParallelCoreModule.h" // For export macro
 #include "vtkSmartPointer.h"       // For vtkSmartPointer
 
+#include <array>              // For array
 #include <atomic>             // For atomic_bool
 #include <condition_variable> // For condition variable
 #include <deque>              // For deque
@@ -92,6 +98,17 @@ public:
    */
   ~vtkThreadedCallbackQueue() override;
 
+  /**
+   * Priorities that can be given to pushed tasks. A task that is already running is never
+   * interrupted: the priority only decides which queued task is run next.
+   */
+  enum PriorityLevel
+  {
+    LOW_PRIORITY = 0,
+    NORMAL_PRIORITY = 1,
+    HIGH_PRIORITY = 2
+  };
+
   /**
    * `vtkSharedFutureBase` is the base block to store, run, get the returned value of the tasks that
    * are pushed in the queue.
@@ -145,7 +162,7 @@ public:
 
     /**
      * Index that is set by the invoker to this shared state.
-     * The position of this invoker in the InvokerQueue can be found by subtracting this
+     * The position of this invoker in its queue of InvokerQueues can be found by subtracting this
      * InvokerIndex with the one of the front invoker.
      */
     vtkIdType InvokerIndex;
@@ -156,6 +173,17 @@ public:
      */
     bool IsHighPriority = false;
 
+    /**
+     * Priority of this invoker. It selects the queue it is enqueued in.
+     */
+    PriorityLevel Priority = NORMAL_PRIORITY;
+
+    /**
+     * When set to true, no future was handed out for this invoker, so no one can wait for it nor
+     * depend on it. Its returned value is discarded.
+     */
+    bool IsDetached = false;
+
     /**
      * List of futures which are depending on us. This is filled by them as they get pushed if we
      * are not done with our task.
@@ -272,6 +300,26 @@ public:
   template <class FT, class... ArgsT>
   SharedFuturePointer<InvokeResult<FT>> Push(FT&& f, ArgsT&&... args);
 
+  /**
+   * This method behaves the same way `Push` does, except that the task is queued with the given
+   * `priority` instead of `NORMAL_PRIORITY`.
+   */
+  template <class FT, class... ArgsT>
+  SharedFuturePointer<InvokeResult<FT>> PushWithPriority(
+    PriorityLevel priority, FT&& f, ArgsT&&... args);
+
+  ///@{
+  /**
+   * These methods behave the same way `Push` and `PushWithPriority` do, except that no future is
+   * returned. The value returned by f is discarded. This is the cheapest way to push a task that
+   * nobody needs to wait for, as the queue does not need to keep track of dependents.
+   */
+  template <class FT, class... ArgsT>
+  void PushDetached(FT&& f, ArgsT&&... args);
+  template <class FT, class... ArgsT>
+  void PushDetachedWithPriority(PriorityLevel priority, FT&& f, ArgsT&&... args);
+  ///@}
+
   /**
    * This method behaves the same way `Push` does, with the addition of a container of `futures`.
    * The function to be pushed will not be executed until the functions associated with the input
@@ -284,6 +332,14 @@ public:
   SharedFuturePointer<InvokeResult<FT>> PushDependent(
     SharedFutureContainerT&& priorSharedFutures, FT&& f, ArgsT&&... args);
 
+  /**
+   * This method behaves the same way `PushDependent` does, except that the task is queued with the
+   * given `priority` once the input futures have terminated.
+   */
+  template <class SharedFutureContainerT, class FT, class... ArgsT>
+  SharedFuturePointer<InvokeResult<FT>> PushDependentWithPriority(
+    PriorityLevel priority, SharedFutureContainerT&& priorSharedFutures, FT&& f, ArgsT&&... args);
+
   /**
    * This method blocks the current thread until all the tasks associated with each shared future
    * inside `priorSharedFuture` has terminated.
@@ -376,7 +432,7 @@ private:
     ON_HOLD = 0x01,
 
     /**
-     * The invoker is currently stored inside `InvokerQueue`. It is waiting to be picked up by a
+     * The invoker is currently stored inside `InvokerQueues`. It is waiting to be picked up by a
      * thread.
      */
     ENQUEUED = 0x02,
@@ -401,10 +457,30 @@ private:
   void Sync(int startId = 0);
 
   /**
-   * Pops all the `nullptr` pointers at the front of `InvokerQueue` until either the queue is empty,
+   * Number of priority levels, which is the number of queues in `InvokerQueues`.
+   */
+  static constexpr int NUMBER_OF_PRIORITY_LEVELS = HIGH_PRIORITY + 1;
+
+  using InvokerQueueType = std::deque<SharedFutureBasePointer>;
+
+  /**
+   * Pops all the `nullptr` pointers at the front of `queue` until either the queue is empty,
    * or the front is not `nullptr`.
    */
-  void PopFrontNullptr();
+  static void PopFrontNullptr(InvokerQueueType& queue);
+
+  /**
+   * Returns the non empty queue of highest priority, or `nullptr` if all the queues are empty.
+   * `Mutex` needs to be locked.
+   */
+  InvokerQueueType* GetNextInvokerQueue();
+
+  /**
+   * Creates an invoker with the given priority and enqueues it.
+   */
+  template <class FT, class... ArgsT>
+  InvokerPointer<FT, ArgsT...> Enqueue(
+    PriorityLevel priority, bool detached, FT&& f, ArgsT&&... args);
 
   /**
    * We go over all the dependent future ids that have been added to the invoker we just invoked.
@@ -446,9 +522,10 @@ private:
   static bool MustWait(SharedFutureContainerT&& priorSharedFutures);
 
   /**
-   * Queue of workers responsible for running the jobs that are inserted.
+   * Queues of workers responsible for running the jobs that are inserted, one per priority level.
+   * Inside each queue, the `InvokerIndex` of the invokers are consecutive.
    */
-  std::deque<SharedFutureBasePointer> InvokerQueue;
+  std::array<InvokerQueueType, NUMBER_OF_PRIORITY_LEVELS> InvokerQueues;
 
   /**
    * This mutex ensures that the queue can pop and push elements in a thread-safe manner.
@@ -172,6 +172,13 @@ struct vtkThreadedCallbackQueue::InvokerImpl
     template <class InvokerT>
     static void Invoke(InvokerT&& invoker, vtkSharedFuture<ReturnT>* future)
     {
+      if (future->IsDetached)
+      {
+        // No one will ever read the returned value, nor wait for us.
+        invoker();
+        future->Status.store(READY, std::memory_order_release);
+        return;
+      }
       future->ReturnValue = ReturnValueWrapper<ReturnT>(invoker());
       future->Status.store(READY, std::memory_order_release);
       future->ConditionVariable.notify_all();
@@ -188,7 +195,10 @@ struct vtkThreadedCallbackQueue::InvokerImpl::InvokerHelper<void>
   {
     invoker();
     future->Status.store(READY, std::memory_order_release);
-    future->ConditionVariable.notify_all();
+    if (!future->IsDetached)
+    {
+      future->ConditionVariable.notify_all();
+    }
   }
 };
 
@@ -529,7 +539,7 @@ void vtkThreadedCallbackQueue::Wait(SharedFutureContainerT&& priorSharedFutures)
   auto invoker = InvokerPointer<decltype(emptyLambda)>::New(std::move(emptyLambda));
 
   // We notify whoever harvests this invoker that we want to be run right away and not pushed in the
-  // InvokerQueue.
+  // InvokerQueues.
   invoker->IsHighPriority = true;
 
   this->HandleDependentInvoker(std::forward<SharedFutureContainerT>(priorSharedFutures), invoker);
@@ -560,18 +570,31 @@ template <class SharedFutureContainerT, class FT, class... ArgsT>
 vtkThreadedCallbackQueue::SharedFuturePointer<vtkThreadedCallbackQueue::InvokeResult<FT>>
 vtkThreadedCallbackQueue::PushDependent(
   SharedFutureContainerT&& priorSharedFutures, FT&& f, ArgsT&&... args)
+{
+  return this->PushDependentWithPriority(NORMAL_PRIORITY,
+    std::forward<SharedFutureContainerT>(priorSharedFutures), std::forward<FT>(f),
+    std::forward<ArgsT>(args)...);
+}
+
+//-----------------------------------------------------------------------------
+template <class SharedFutureContainerT, class FT, class... ArgsT>
+vtkThreadedCallbackQueue::SharedFuturePointer<vtkThreadedCallbackQueue::InvokeResult<FT>>
+vtkThreadedCallbackQueue::PushDependentWithPriority(PriorityLevel priority,
+  SharedFutureContainerT&& priorSharedFutures, FT&& f, ArgsT&&... args)
 {
   // If we can avoid doing tricks with dependent shared futures, let's do it.
   if (!this->MustWait(std::forward<SharedFutureContainerT>(priorSharedFutures)))
   {
-    return this->Push(std::forward<FT>(f), std::forward<ArgsT>(args)...);
+    return this->PushWithPriority(priority, std::forward<FT>(f), std::forward<ArgsT>(args)...);
   }
 
   using InvokerPointerType = InvokerPointer<FT, ArgsT...>;
 
   auto invoker = InvokerPointerType::New(std::forward<FT>(f), std::forward<ArgsT>(args)...);
+  invoker->Priority = priority;
 
-  this->Push(
+  // Nobody needs the future of the task registering the dependencies.
+  this->PushDetachedWithPriority(priority,
     &vtkThreadedCallbackQueue::HandleDependentInvoker<SharedFutureContainerT, InvokerPointerType>,
     this, std::forward<SharedFutureContainerT>(priorSharedFutures), invoker);
 
@@ -601,6 +624,7 @@ void vtkThreadedCallbackQueue::PushControl(FT&& f, ArgsT&&... args)
   auto invoker =
     InvokerPointerType::New(worker, this, std::forward<FT>(f), std::forward<ArgsT>(args)...);
   worker.Future = invoker;
+  invoker->Priority = HIGH_PRIORITY;
 
   // We want the setting of ControlFutures to be strictly sequential. We don't want race conditions
   // on this container with 2 `PushControl` that are called almost simultaneously and have invokers
@@ -631,11 +655,12 @@ void vtkThreadedCallbackQueue::PushControl(FT&& f, ArgsT&&... args)
       invoker->Status.store(ENQUEUED, std::memory_order_release);
 
       std::lock_guard<std::mutex> lock(this->Mutex);
-      invoker->InvokerIndex =
-        this->InvokerQueue.empty() ? 0 : this->InvokerQueue.front()->InvokerIndex - 1;
+      InvokerQueueType& invokerQueue = this->InvokerQueues[HIGH_PRIORITY];
+      invoker->InvokerIndex = invokerQueue.empty() ? 0 : invokerQueue.front()->InvokerIndex - 1;
 
-      // We give some priority to controls, we push them in the front.
-      this->InvokerQueue.emplace_front(invoker);
+      // We give some priority to controls, we push them in the front of the queue of highest
+      // priority.
+      invokerQueue.emplace_front(invoker);
     }
     this->ConditionVariable.notify_one();
     return;
@@ -651,18 +676,24 @@ void vtkThreadedCallbackQueue::PushControl(FT&& f, ArgsT&&... args)
 
 //-----------------------------------------------------------------------------
 template <class FT, class... ArgsT>
-vtkThreadedCallbackQueue::SharedFuturePointer<vtkThreadedCallbackQueue::InvokeResult<FT>>
-vtkThreadedCallbackQueue::Push(FT&& f, ArgsT&&... args)
+vtkThreadedCallbackQueue::InvokerPointer<FT, ArgsT...> vtkThreadedCallbackQueue::Enqueue(
+  PriorityLevel priority, bool detached, FT&& f, ArgsT&&... args)
 {
   auto invoker =
     InvokerPointer<FT, ArgsT...>::New(std::forward<FT>(f), std::forward<ArgsT>(args)...);
+  invoker->Priority = priority;
+  invoker->IsDetached = detached;
   invoker->Status.store(ENQUEUED, std::memory_order_release);
 
   {
     std::lock_guard<std::mutex> lock(this->Mutex);
-    invoker->InvokerIndex =
-      this->InvokerQueue.empty() ? 0 : this->InvokerQueue.back()->InvokerIndex + 1;
-    this->InvokerQueue.emplace_back(invoker);
+    InvokerQueueType& invokerQueue = this->InvokerQueues[priority];
+    // The back of the queue can be a nullptr left by TryInvoke, but the front never is, and the
+    // indices are consecutive.
+    invoker->InvokerIndex = invokerQueue.empty()
+      ? 0
+      : invokerQueue.front()->InvokerIndex + static_cast<vtkIdType>(invokerQueue.size());
+    invokerQueue.emplace_back(invoker);
   }
 
   this->ConditionVariable.notify_one();
@@ -670,4 +701,35 @@ vtkThreadedCallbackQueue::Push(FT&& f, ArgsT&&... args)
   return invoker;
 }
 
+//-----------------------------------------------------------------------------
+template <class FT, class... ArgsT>
+vtkThreadedCallbackQueue::SharedFuturePointer<vtkThreadedCallbackQueue::InvokeResult<FT>>
+vtkThreadedCallbackQueue::Push(FT&& f, ArgsT&&... args)
+{
+  return this->Enqueue(NORMAL_PRIORITY, false, std::forward<FT>(f), std::forward<ArgsT>(args)...);
+}
+
+//-----------------------------------------------------------------------------
+template <class FT, class... ArgsT>
+vtkThreadedCallbackQueue::SharedFuturePointer<vtkThreadedCallbackQueue::InvokeResult<FT>>
+vtkThreadedCallbackQueue::PushWithPriority(PriorityLevel priority, FT&& f, ArgsT&&... args)
+{
+  return this->Enqueue(priority, false, std::forward<FT>(f), std::forward<ArgsT>(args)...);
+}
+
+//-----------------------------------------------------------------------------
+template <class FT, class... ArgsT>
+void vtkThreadedCallbackQueue::PushDetached(FT&& f, ArgsT&&... args)
+{
+  this->Enqueue(NORMAL_PRIORITY, true, std::forward<FT>(f), std::forward<ArgsT>(args)...);
+}
+
+//-----------------------------------------------------------------------------
+template <class FT, class... ArgsT>
+void vtkThreadedCallbackQueue::PushDetachedWithPriority(
+  PriorityLevel priority, FT&& f, ArgsT&&... args)
+{
+  this->Enqueue(priority, true, std::forward<FT>(f), std::forward<ArgsT>(args)...);
+}
+
 VTK_ABI_NAMESPACE_END
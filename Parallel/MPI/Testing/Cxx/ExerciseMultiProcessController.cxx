@@ -6,6 +6,7 @@
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkCharArray.h"
+#include "vtkCommunicator.h"
 #include "vtkDataArray.h"
 #include "vtkDoubleArray.h"
 #include "vtkFloatArray.h"
@@ -29,7 +30,10 @@
 #include "vtkTypeTraits.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnsignedLongArray.h"
+#include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
+#include <initializer_list>
 #include <string.h>
 #include <time.h>
 #include <vector>
@@ -349,6 +353,17 @@ static int CompareDataObjects(vtkDataObject* obj1, vtkDataObject* obj2)
         return 0;
       }
     }
+
+    vtkUnstructuredGrid* ug1 = vtkUnstructuredGrid::SafeDownCast(ps1);
+    vtkUnstructuredGrid* ug2 = vtkUnstructuredGrid::SafeDownCast(ps2);
+    if (ug1 && ug2)
+    {
+      if (!compareCellArrays(ug1->GetCells(), ug2->GetCells()) ||
+        !CompareDataArrays(ug1->GetCellTypesArray(), ug2->GetCellTypesArray()))
+      {
+        return 0;
+      }
+    }
   }
 
   return 1;
@@ -704,6 +719,91 @@ void ExerciseType(vtkMultiProcessController* controller)
   }
   CheckSuccess(controller, result);
 
+  if (sizeof(baseType) > 1)
+  {
+    // Sum operation not defined for char/byte in some MPI implementations.
+    COUT("Nonblocking All Reduce");
+    buffer->SetNumberOfTuples(arraySize);
+    vtkSmartPointer<vtkCommunicatorRequest> request = controller->NoBlockAllReduce(
+      sourceArrays[rank]->GetPointer(0), buffer->GetPointer(0), arraySize, vtkCommunicator::SUM_OP);
+    result = request && request->Wait();
+    for (i = 0; result && i < arraySize; i++)
+    {
+      baseType total = static_cast<baseType>(0);
+      for (int j = 0; j < numProc; j++)
+        total += sourceArrays[j]->GetValue(i);
+      if (!AreEqual(total, buffer->GetValue(i)))
+      {
+        vtkGenericWarningMacro(<< "Unequal computation in reduce: " << total << " vs. "
+                               << buffer->GetValue(i));
+        result = 0;
+      }
+    }
+    CheckSuccess(controller, result);
+  }
+
+  // Process i sends count(i, j) values of its source array from offset j % 4
+  // to process j.
+  auto count = [](int from, int to) { return static_cast<vtkIdType>((from + 2 * to) % 3 + 1); };
+  auto exchange = [&](const std::vector<int>& peers, bool neighbors) {
+    const size_t numPeers = peers.size();
+    std::vector<vtkIdType> sendLengths(numPeers), sendOffsets(numPeers);
+    std::vector<vtkIdType> recvLengths(numPeers), recvOffsets(numPeers);
+    vtkIdType total = 0;
+    for (size_t p = 0; p < numPeers; p++)
+    {
+      sendLengths[p] = count(rank, peers[p]);
+      sendOffsets[p] = peers[p] % 4;
+      recvLengths[p] = count(peers[p], rank);
+      recvOffsets[p] = total;
+      total += recvLengths[p];
+    }
+    buffer->SetNumberOfTuples(total);
+    vtkSmartPointer<vtkCommunicatorRequest> request = neighbors
+      ? controller->NoBlockNeighborAllToAllV(sourceArrays[rank]->GetPointer(0), sendLengths.data(),
+          sendOffsets.data(), buffer->GetPointer(0), recvLengths.data(), recvOffsets.data())
+      : controller->NoBlockAllToAllV(sourceArrays[rank]->GetPointer(0), sendLengths.data(),
+          sendOffsets.data(), buffer->GetPointer(0), recvLengths.data(), recvOffsets.data());
+    int success = request && request->Wait();
+    for (size_t p = 0; success && p < numPeers; p++)
+    {
+      for (vtkIdType j = 0; j < recvLengths[p]; j++)
+      {
+        if (sourceArrays[peers[p]]->GetValue(rank % 4 + j) !=
+          buffer->GetValue(recvOffsets[p] + j))
+        {
+          vtkGenericWarningMacro("Exchanged array from " << peers[p] << " incorrect at " << j);
+          success = 0;
+          break;
+        }
+      }
+    }
+    return success;
+  };
+
+  COUT("Nonblocking All To All");
+  std::vector<int> peers(numProc);
+  for (i = 0; i < numProc; i++)
+  {
+    peers[i] = i;
+  }
+  result = exchange(peers, false);
+  CheckSuccess(controller, result);
+
+  COUT("Nonblocking Neighbor All To All");
+  // a ring, without duplicates for less than 3 processes
+  peers.clear();
+  for (int neighbor : { (rank + numProc - 1) % numProc, (rank + 1) % numProc })
+  {
+    if (std::find(peers.begin(), peers.end(), neighbor) == peers.end())
+    {
+      peers.push_back(neighbor);
+    }
+  }
+  result = controller->SetNeighbors(static_cast<int>(peers.size()), peers.data());
+  result = result && exchange(peers, true);
+  CheckSuccess(controller, result);
+
   //------------------------------------------------------------------
   // Repeat all the tests, but this time passing the vtkDataArray directly.
   COUT("Basic send and receive with vtkDataArray.");
@@ -1165,6 +1265,17 @@ static void Run(vtkMultiProcessController* controller, void* _args)
     polySource->Update();
     ExerciseDataObject(controller, polySource->GetOutput(), vtkSmartPointer<vtkPolyData>::New());
 
+    // Data sets are sent as raw arrays by default, exercise the legacy format too.
+    controller->GetCommunicator()->UseBinaryDataObjectsOff();
+    ExerciseDataObject(controller, polySource->GetOutput(), vtkSmartPointer<vtkPolyData>::New());
+    controller->GetCommunicator()->UseBinaryDataObjectsOn();
+
+    vtkNew<vtkUnstructuredGrid> grid;
+    grid->SetPoints(polySource->GetOutput()->GetPoints());
+    grid->SetCells(VTK_TRIANGLE, polySource->GetOutput()->GetPolys());
+    grid->GetPointData()->ShallowCopy(polySource->GetOutput()->GetPointData());
+    ExerciseDataObject(controller, grid, vtkSmartPointer<vtkUnstructuredGrid>::New());
+
     vtkNew<vtkPartitionedDataSetCollectionSource> pdcSource;
     pdcSource->SetNumberOfShapes(12);
     pdcSource->Update();
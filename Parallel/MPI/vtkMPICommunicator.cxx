@@ -6,6 +6,7 @@
 #include "vtkImageData.h"
 #include "vtkMPI.h"
 #include "vtkMPIController.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkProcessGroup.h"
 #include "vtkRectilinearGrid.h"
@@ -212,6 +213,111 @@ inline int vtkMPICommunicatorCheckSize(vtkTypeInt64 length)
   }
 }
 
+inline bool vtkMPICommunicatorGetMPIOp(int operation, MPI_Op& mpiOp)
+{
+  switch (operation)
+  {
+    case vtkCommunicator::MAX_OP:
+      mpiOp = MPI_MAX;
+      return true;
+    case vtkCommunicator::MIN_OP:
+      mpiOp = MPI_MIN;
+      return true;
+    case vtkCommunicator::SUM_OP:
+      mpiOp = MPI_SUM;
+      return true;
+    case vtkCommunicator::PRODUCT_OP:
+      mpiOp = MPI_PROD;
+      return true;
+    case vtkCommunicator::LOGICAL_AND_OP:
+      mpiOp = MPI_LAND;
+      return true;
+    case vtkCommunicator::BITWISE_AND_OP:
+      mpiOp = MPI_BAND;
+      return true;
+    case vtkCommunicator::LOGICAL_OR_OP:
+      mpiOp = MPI_LOR;
+      return true;
+    case vtkCommunicator::BITWISE_OR_OP:
+      mpiOp = MPI_BOR;
+      return true;
+    case vtkCommunicator::LOGICAL_XOR_OP:
+      mpiOp = MPI_LXOR;
+      return true;
+    case vtkCommunicator::BITWISE_XOR_OP:
+      mpiOp = MPI_BXOR;
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if MPI_VERSION >= 3
+//------------------------------------------------------------------------------
+// Request on a nonblocking collective, owning the arrays of counts and
+// displacements that MPI reads until the operation completes.
+class vtkMPICommunicatorCollectiveRequest : public vtkCommunicatorRequest
+{
+public:
+  static vtkMPICommunicatorCollectiveRequest* New();
+  vtkTypeMacro(vtkMPICommunicatorCollectiveRequest, vtkCommunicatorRequest);
+
+  bool Test() override
+  {
+    int flag = 1;
+    if (this->Handle != MPI_REQUEST_NULL)
+    {
+      MPI_Test(&this->Handle, &flag, MPI_STATUS_IGNORE);
+    }
+    return flag != 0;
+  }
+
+  int Wait() override
+  {
+    if (this->Handle == MPI_REQUEST_NULL)
+    {
+      return 1;
+    }
+    return MPI_Wait(&this->Handle, MPI_STATUS_IGNORE) == MPI_SUCCESS;
+  }
+
+  // Convert lengths and offsets to the int arrays of MPI, false on overflow
+  bool SetCounts(int count, const vtkIdType* sendLengths, const vtkIdType* sendOffsets,
+    const vtkIdType* recvLengths, const vtkIdType* recvOffsets)
+  {
+    this->Counts.resize(4 * static_cast<size_t>(count));
+    const vtkIdType* arrays[4] = { sendLengths, sendOffsets, recvLengths, recvOffsets };
+    for (int a = 0; a < 4; a++)
+    {
+      for (int i = 0; i < count; i++)
+      {
+        if (arrays[a][i] > VTK_INT_MAX)
+        {
+          return false;
+        }
+        this->Counts[a * count + i] = static_cast<int>(arrays[a][i]);
+      }
+    }
+    return true;
+  }
+  int* GetCounts(int array, int count) { return this->Counts.data() + array * count; }
+
+  MPI_Request Handle = MPI_REQUEST_NULL;
+
+protected:
+  vtkMPICommunicatorCollectiveRequest() = default;
+  ~vtkMPICommunicatorCollectiveRequest() override
+  {
+    // collectives cannot be cancelled, complete it before releasing the counts
+    this->Wait();
+  }
+
+private:
+  std::vector<int> Counts;
+};
+vtkStandardNewMacro(vtkMPICommunicatorCollectiveRequest);
+#endif
+
 //------------------------------------------------------------------------------
 // "_c" versions of routines are defined by MPI 4.x, using MPI_Count, a 64-bit integer type, for
 // message length
@@ -634,6 +740,7 @@ void vtkMPICommunicator::PrintSelf(ostream& os, vtkIndent indent)
 vtkMPICommunicator::vtkMPICommunicator()
 {
   this->MPIComm = new vtkMPICommunicatorOpaqueComm;
+  this->NeighborComm = nullptr;
   this->Initialized = 0;
   this->KeepHandle = 0;
   this->LastSenderId = -1;
@@ -643,6 +750,19 @@ vtkMPICommunicator::vtkMPICommunicator()
 //------------------------------------------------------------------------------
 vtkMPICommunicator::~vtkMPICommunicator()
 {
+  if (this->NeighborComm)
+  {
+    // the world communicator may be released after MPI_Finalize
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+    if (!finalized)
+    {
+      MPI_Comm_free(this->NeighborComm->Handle);
+    }
+    delete this->NeighborComm->Handle;
+    delete this->NeighborComm;
+  }
+
   // Free the handle if required and asked for.
   if (this->MPIComm)
   {
@@ -1719,41 +1839,10 @@ int vtkMPICommunicator::ReduceVoidArray(const void* sendBuffer, void* recvBuffer
 {
   vtkMPICommunicatorDebugBarrier(this->MPIComm->Handle);
   MPI_Op mpiOp;
-  switch (operation)
+  if (!vtkMPICommunicatorGetMPIOp(operation, mpiOp))
   {
-    case MAX_OP:
-      mpiOp = MPI_MAX;
-      break;
-    case MIN_OP:
-      mpiOp = MPI_MIN;
-      break;
-    case SUM_OP:
-      mpiOp = MPI_SUM;
-      break;
-    case PRODUCT_OP:
-      mpiOp = MPI_PROD;
-      break;
-    case LOGICAL_AND_OP:
-      mpiOp = MPI_LAND;
-      break;
-    case BITWISE_AND_OP:
-      mpiOp = MPI_BAND;
-      break;
-    case LOGICAL_OR_OP:
-      mpiOp = MPI_LOR;
-      break;
-    case BITWISE_OR_OP:
-      mpiOp = MPI_BOR;
-      break;
-    case LOGICAL_XOR_OP:
-      mpiOp = MPI_LXOR;
-      break;
-    case BITWISE_XOR_OP:
-      mpiOp = MPI_BXOR;
-      break;
-    default:
-      vtkWarningMacro(<< "Operation number " << operation << " not supported.");
-      return 0;
+    vtkWarningMacro(<< "Operation number " << operation << " not supported.");
+    return 0;
   }
   return CheckForMPIError(vtkMPICommunicatorReduceData(
     sendBuffer, recvBuffer, length, type, mpiOp, destProcessId, this->MPIComm->Handle));
@@ -1785,41 +1874,10 @@ int vtkMPICommunicator::AllReduceVoidArray(
 {
   vtkMPICommunicatorDebugBarrier(this->MPIComm->Handle);
   MPI_Op mpiOp;
-  switch (operation)
+  if (!vtkMPICommunicatorGetMPIOp(operation, mpiOp))
   {
-    case MAX_OP:
-      mpiOp = MPI_MAX;
-      break;
-    case MIN_OP:
-      mpiOp = MPI_MIN;
-      break;
-    case SUM_OP:
-      mpiOp = MPI_SUM;
-      break;
-    case PRODUCT_OP:
-      mpiOp = MPI_PROD;
-      break;
-    case LOGICAL_AND_OP:
-      mpiOp = MPI_LAND;
-      break;
-    case BITWISE_AND_OP:
-      mpiOp = MPI_BAND;
-      break;
-    case LOGICAL_OR_OP:
-      mpiOp = MPI_LOR;
-      break;
-    case BITWISE_OR_OP:
-      mpiOp = MPI_BOR;
-      break;
-    case LOGICAL_XOR_OP:
-      mpiOp = MPI_LXOR;
-      break;
-    case BITWISE_XOR_OP:
-      mpiOp = MPI_BXOR;
-      break;
-    default:
-      vtkWarningMacro(<< "Operation number " << operation << " not supported.");
-      return 0;
+    vtkWarningMacro(<< "Operation number " << operation << " not supported.");
+    return 0;
   }
   return CheckForMPIError(vtkMPICommunicatorAllReduceData(
     sendBuffer, recvBuffer, length, type, mpiOp, this->MPIComm->Handle));
@@ -1845,6 +1903,128 @@ int vtkMPICommunicator::AllReduceVoidArray(
   return res;
 }
 
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkCommunicatorRequest> vtkMPICommunicator::NoBlockAllReduceVoidArray(
+  const void* sendBuffer, void* recvBuffer, vtkIdType length, int type, int operation)
+{
+#if MPI_VERSION >= 3
+  MPI_Op mpiOp;
+  if (!vtkMPICommunicatorGetMPIOp(operation, mpiOp))
+  {
+    vtkWarningMacro(<< "Operation number " << operation << " not supported.");
+    return nullptr;
+  }
+  if (length > VTK_INT_MAX)
+  {
+    return this->Superclass::NoBlockAllReduceVoidArray(
+      sendBuffer, recvBuffer, length, type, operation);
+  }
+  vtkNew<vtkMPICommunicatorCollectiveRequest> request;
+  if (!CheckForMPIError(MPI_Iallreduce(sendBuffer == recvBuffer ? MPI_IN_PLACE : sendBuffer,
+        recvBuffer, static_cast<int>(length), vtkMPICommunicatorGetMPIType(type), mpiOp,
+        *this->MPIComm->Handle, &request->Handle)))
+  {
+    return nullptr;
+  }
+  return request.Get();
+#else
+  return this->Superclass::NoBlockAllReduceVoidArray(
+    sendBuffer, recvBuffer, length, type, operation);
+#endif
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkCommunicatorRequest> vtkMPICommunicator::NoBlockAllToAllVVoidArray(
+  const void* sendBuffer, const vtkIdType* sendLengths, const vtkIdType* sendOffsets,
+  void* recvBuffer, const vtkIdType* recvLengths, const vtkIdType* recvOffsets, int type)
+{
+#if MPI_VERSION >= 3
+  const int count = this->NumberOfProcesses;
+  vtkNew<vtkMPICommunicatorCollectiveRequest> request;
+  if (!request->SetCounts(count, sendLengths, sendOffsets, recvLengths, recvOffsets))
+  {
+    vtkErrorMacro(<< "This operation not yet supported for more than " << VTK_INT_MAX
+                  << " objects");
+    return nullptr;
+  }
+  MPI_Datatype mpiType = vtkMPICommunicatorGetMPIType(type);
+  if (!CheckForMPIError(MPI_Ialltoallv(sendBuffer, request->GetCounts(0, count),
+        request->GetCounts(1, count), mpiType, recvBuffer, request->GetCounts(2, count),
+        request->GetCounts(3, count), mpiType, *this->MPIComm->Handle, &request->Handle)))
+  {
+    return nullptr;
+  }
+  return request.Get();
+#else
+  return this->Superclass::NoBlockAllToAllVVoidArray(
+    sendBuffer, sendLengths, sendOffsets, recvBuffer, recvLengths, recvOffsets, type);
+#endif
+}
+
+//------------------------------------------------------------------------------
+int vtkMPICommunicator::SetNeighbors(int numberOfNeighbors, const int* neighbors)
+{
+  if (!this->Superclass::SetNeighbors(numberOfNeighbors, neighbors))
+  {
+    return 0;
+  }
+#if MPI_VERSION >= 3
+  if (this->NeighborComm)
+  {
+    MPI_Comm_free(this->NeighborComm->Handle);
+  }
+  else
+  {
+    this->NeighborComm = new vtkMPICommunicatorOpaqueComm(new MPI_Comm);
+  }
+  // the neighborhood is symmetric, sources and destinations are the same
+  int* ranks = this->Neighbors.data();
+  if (!CheckForMPIError(MPI_Dist_graph_create_adjacent(*this->MPIComm->Handle, numberOfNeighbors,
+        ranks, MPI_UNWEIGHTED, numberOfNeighbors, ranks, MPI_UNWEIGHTED, MPI_INFO_NULL, 0,
+        this->NeighborComm->Handle)))
+  {
+    delete this->NeighborComm->Handle;
+    delete this->NeighborComm;
+    this->NeighborComm = nullptr;
+    return 0;
+  }
+#endif
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkCommunicatorRequest> vtkMPICommunicator::NoBlockNeighborAllToAllVVoidArray(
+  const void* sendBuffer, const vtkIdType* sendLengths, const vtkIdType* sendOffsets,
+  void* recvBuffer, const vtkIdType* recvLengths, const vtkIdType* recvOffsets, int type)
+{
+#if MPI_VERSION >= 3
+  const int count = this->GetNumberOfNeighbors();
+  vtkNew<vtkMPICommunicatorCollectiveRequest> request;
+  if (!this->NeighborComm)
+  {
+    return this->Superclass::NoBlockNeighborAllToAllVVoidArray(
+      sendBuffer, sendLengths, sendOffsets, recvBuffer, recvLengths, recvOffsets, type);
+  }
+  if (!request->SetCounts(count, sendLengths, sendOffsets, recvLengths, recvOffsets))
+  {
+    vtkErrorMacro(<< "This operation not yet supported for more than " << VTK_INT_MAX
+                  << " objects");
+    return nullptr;
+  }
+  MPI_Datatype mpiType = vtkMPICommunicatorGetMPIType(type);
+  if (!CheckForMPIError(MPI_Ineighbor_alltoallv(sendBuffer, request->GetCounts(0, count),
+        request->GetCounts(1, count), mpiType, recvBuffer, request->GetCounts(2, count),
+        request->GetCounts(3, count), mpiType, *this->NeighborComm->Handle, &request->Handle)))
+  {
+    return nullptr;
+  }
+  return request.Get();
+#else
+  return this->Superclass::NoBlockNeighborAllToAllVVoidArray(
+    sendBuffer, sendLengths, sendOffsets, recvBuffer, recvLengths, recvOffsets, type);
+#endif
+}
+
 //------------------------------------------------------------------------------
 int vtkMPICommunicator::WaitAll(int count, Request requests[])
 {
@@ -285,6 +285,27 @@ public:
   int TestSome(int count, Request requests[], int& NCompleted, int* completed)
     VTK_SIZEHINT(requests, count);
 
+  ///@{
+  /**
+   * Nonblocking collectives using MPI_Iallreduce, MPI_Ialltoallv and
+   * MPI_Ineighbor_alltoallv. SetNeighbors creates a distributed graph
+   * communicator with MPI_Dist_graph_create_adjacent, and must be called by all
+   * the processes of the communicator. Without MPI-3, the blocking
+   * implementations of vtkCommunicator are used. Lengths and offsets must fit in
+   * an int.
+   */
+  vtkSmartPointer<vtkCommunicatorRequest> NoBlockAllReduceVoidArray(const void* sendBuffer,
+    void* recvBuffer, vtkIdType length, int type, int operation) override;
+  vtkSmartPointer<vtkCommunicatorRequest> NoBlockAllToAllVVoidArray(const void* sendBuffer,
+    const vtkIdType* sendLengths, const vtkIdType* sendOffsets, void* recvBuffer,
+    const vtkIdType* recvLengths, const vtkIdType* recvOffsets, int type) override;
+  int SetNeighbors(int numberOfNeighbors, const int* neighbors) override;
+  vtkSmartPointer<vtkCommunicatorRequest> NoBlockNeighborAllToAllVVoidArray(
+    const void* sendBuffer, const vtkIdType* sendLengths, const vtkIdType* sendOffsets,
+    void* recvBuffer, const vtkIdType* recvLengths, const vtkIdType* recvOffsets,
+    int type) override;
+  ///@}
+
   friend class vtkMPIController;
 
   vtkMPICommunicatorOpaqueComm* GetMPIComm() { return this->MPIComm; }
@@ -363,6 +384,8 @@ protected:
   ///@}
 
   vtkMPICommunicatorOpaqueComm* MPIComm;
+  // Distributed graph communicator created by SetNeighbors.
+  vtkMPICommunicatorOpaqueComm* NeighborComm;
 
   int Initialized;
   int KeepHandle;
@@ -3,6 +3,7 @@
 #include "vtkMPIController.h"
 
 #include "vtkIntArray.h"
+#include "vtkLogger.h"
 #include "vtkObjectFactory.h"
 #include "vtkOutputWindow.h"
 
@@ -133,6 +134,7 @@ void vtkMPIController::Initialize(int* argc, char*** argv, int initializedExtern
     MPI_Init(argc, argv);
   }
   this->InitializeCommunicator(vtkMPICommunicator::GetWorldCommunicator());
+  vtkLogger::SetTraceProcessId(this->GetLocalProcessId());
 
   int tmp;
   MPI_Get_processor_name(ProcessorName, &tmp);
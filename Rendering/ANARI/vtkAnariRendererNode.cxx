@@ -183,6 +183,12 @@ public:
   void ClearSurfaces();
   //@}
 
+  /**
+   * Make SurfaceInstances match the given surfaces: the instances of the surfaces still
+   * present are kept, new surfaces get their own group and instance, the others are released.
+   */
+  void UpdateSurfaceInstances(const std::vector<anari::Surface>&);
+
   //@{
   /**
    * Methods to add, get, and clear ANARI volumes.
@@ -255,6 +261,12 @@ public:
   anari_vtk::SurfaceState AnariSurfaceState;
   anari_vtk::VolumeState AnariVolumeState;
   anari_vtk::LightState AnariLightState;
+
+  // Content of the world, to only update it when the surfaces or the volumes change.
+  std::vector<anari::Surface> CommittedSurfaces;
+  std::vector<anari::Volume> CommittedVolumes;
+  std::map<anari::Surface, anari::Instance> SurfaceInstances;
+  size_t NextSurfaceId = 0;
 };
 
 vtkAnariRendererNodeInternals::vtkAnariRendererNodeInternals(vtkAnariRendererNode* owner)
@@ -306,6 +318,11 @@ vtkAnariRendererNodeInternals::~vtkAnariRendererNodeInternals()
       anari::release(this->AnariDevice, light);
     }
 
+    for (auto& surfaceInstance : this->SurfaceInstances)
+    {
+      anari::release(this->AnariDevice, surfaceInstance.second);
+    }
+
     if (this->AnariGroup != nullptr)
     {
       anari::release(this->AnariDevice, this->AnariGroup);
@@ -523,7 +540,8 @@ void vtkAnariRendererNodeInternals::AddSurfaces(
   {
     if (this->AnariSurfaceState.used)
     {
-      this->ClearSurfaces();
+      // surfaces are handed over again every frame, refilling the list is not a change
+      this->AnariSurfaceState.Surfaces.clear();
       this->AnariSurfaceState.used = false;
     }
 
@@ -556,6 +574,54 @@ void vtkAnariRendererNodeInternals::ClearSurfaces()
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkAnariRendererNodeInternals::UpdateSurfaceInstances(
+  const std::vector<anari::Surface>& surfaces)
+{
+  std::map<anari::Surface, anari::Instance> instances;
+
+  for (auto surface : surfaces)
+  {
+    auto it = this->SurfaceInstances.find(surface);
+    if (it != this->SurfaceInstances.end())
+    {
+      instances.insert(*it);
+      this->SurfaceInstances.erase(it);
+      continue;
+    }
+
+    const std::string suffix = std::to_string(this->NextSurfaceId++);
+    const std::string surfaceName = "vtk_surface_" + suffix;
+    const std::string groupName = "vtk_group_" + suffix;
+    const std::string instanceName = "vtk_instance_" + suffix;
+
+    anari::setParameter(this->AnariDevice, surface, "name", ANARI_STRING, surfaceName.c_str());
+    anari::commitParameters(this->AnariDevice, surface);
+
+    auto group = anari::newObject<anari::Group>(this->AnariDevice);
+    anari::setParameter(this->AnariDevice, group, "name", ANARI_STRING, groupName.c_str());
+    auto surfaceArray1D = anari::newArray1D(this->AnariDevice, &surface, 1);
+    anari::setAndReleaseParameter(this->AnariDevice, group, "surface", surfaceArray1D);
+    anari::commitParameters(this->AnariDevice, group);
+
+    auto instance = anari::newObject<anari::Instance>(this->AnariDevice, "transform");
+    anari::setParameter(this->AnariDevice, instance, "name", ANARI_STRING, instanceName.c_str());
+    anari::setParameter(this->AnariDevice, instance, "group", group);
+    anari::commitParameters(this->AnariDevice, instance);
+    anari::release(this->AnariDevice, group);
+
+    instances.emplace(surface, instance);
+  }
+
+  // the surfaces that are gone, they are released with their group
+  for (auto& surfaceInstance : this->SurfaceInstances)
+  {
+    anari::release(this->AnariDevice, surfaceInstance.second);
+  }
+
+  this->SurfaceInstances.swap(instances);
+}
+
 //----------------------------------------------------------------------------
 void vtkAnariRendererNodeInternals::AddVolume(anari::Volume volume, const bool changed)
 {
@@ -563,7 +629,8 @@ void vtkAnariRendererNodeInternals::AddVolume(anari::Volume volume, const bool c
   {
     if (this->AnariVolumeState.used)
     {
-      this->ClearVolumes();
+      // volumes are handed over again every frame, refilling the list is not a change
+      this->AnariVolumeState.Volumes.clear();
       this->AnariVolumeState.used = false;
     }
 
@@ -2105,66 +2172,43 @@ void vtkAnariRendererNode::Render(bool prepass)
     auto surfaceState = this->Internal->GetSurfaceState();
     auto volumeState = this->Internal->GetVolumeState();
 
-    if (surfaceState.changed || volumeState.changed)
-    {
-      if (this->Internal->AnariInstance == nullptr)
-      {
-        this->Internal->AnariInstance = anari::newObject<anari::Instance>(anariDevice, "transform");
-        anari::setParameter(
-          anariDevice, this->Internal->AnariInstance, "name", ANARI_STRING, "vtk_instance");
-        anari::commitParameters(anariDevice, this->Internal->AnariInstance);
-
-        auto instanceArray1D = anari::newArray1D(anariDevice, &this->Internal->AnariInstance, 1);
-        anari::setAndReleaseParameter(anariDevice, anariWorld, "instance", instanceArray1D);
-        anari::commitParameters(anariDevice, anariWorld);
-      }
+    // The mapper nodes hand over the same handles every frame while their content is
+    // unchanged, so only the lists that differ from what the world holds are updated.
+    const bool surfacesChanged =
+      surfaceState.changed || surfaceState.Surfaces != this->Internal->CommittedSurfaces;
+    const bool volumesChanged =
+      volumeState.changed || volumeState.Volumes != this->Internal->CommittedVolumes;
 
-      auto anariInstance = this->Internal->AnariInstance;
-
-      if (this->Internal->AnariGroup == nullptr)
+    if (surfacesChanged || volumesChanged)
+    {
+      if (surfacesChanged)
       {
-        this->Internal->AnariGroup = anari::newObject<anari::Group>(anariDevice);
-        anari::setParameter(
-          anariDevice, this->Internal->AnariGroup, "name", ANARI_STRING, "vtk_group");
-        anari::commitParameters(anariDevice, this->Internal->AnariGroup);
-
-        anari::setParameter(anariDevice, anariInstance, "group", this->Internal->AnariGroup);
-        anari::commitParameters(anariDevice, anariInstance);
+        this->Internal->AnariSurfaceState.changed = false;
+        this->Internal->UpdateSurfaceInstances(surfaceState.Surfaces);
+        this->Internal->CommittedSurfaces = surfaceState.Surfaces;
       }
 
-      auto anariGroup = this->Internal->AnariGroup;
-
-      if (surfaceState.changed)
+      if (volumesChanged)
       {
-        this->Internal->AnariSurfaceState.changed = false;
+        this->Internal->AnariVolumeState.changed = false;
 
-        if (!surfaceState.Surfaces.empty())
+        if (this->Internal->AnariGroup == nullptr)
         {
-          for (size_t i = 0; i < surfaceState.Surfaces.size(); i++)
-          {
-            std::string surfaceName("vtk_surface_");
-            surfaceName.append(std::to_string(i));
-
-            anari::setParameter(
-              anariDevice, surfaceState.Surfaces[i], "name", ANARI_STRING, surfaceName.c_str());
-            anari::commitParameters(anariDevice, surfaceState.Surfaces[i]);
-          }
+          this->Internal->AnariGroup = anari::newObject<anari::Group>(anariDevice);
+          anari::setParameter(
+            anariDevice, this->Internal->AnariGroup, "name", ANARI_STRING, "vtk_group");
+          anari::commitParameters(anariDevice, this->Internal->AnariGroup);
 
-          auto surfaceArray1D = anari::newArray1D(
-            anariDevice, surfaceState.Surfaces.data(), surfaceState.Surfaces.size());
-          anari::setAndReleaseParameter(anariDevice, anariGroup, "surface", surfaceArray1D);
-          anari::commitParameters(anariDevice, anariGroup);
-        }
-        else
-        {
-          anari::unsetParameter(anariDevice, anariGroup, "surface");
-          anari::commitParameters(anariDevice, anariGroup);
+          this->Internal->AnariInstance =
+            anari::newObject<anari::Instance>(anariDevice, "transform");
+          anari::setParameter(
+            anariDevice, this->Internal->AnariInstance, "name", ANARI_STRING, "vtk_instance");
+          anari::setParameter(
+            anariDevice, this->Internal->AnariInstance, "group", this->Internal->AnariGroup);
+          anari::commitParameters(anariDevice, this->Internal->AnariInstance);
         }
-      }
 
-      if (volumeState.changed)
-      {
-        this->Internal->AnariVolumeState.changed = false;
+        auto anariGroup = this->Internal->AnariGroup;
 
         if (!volumeState.Volumes.empty())
         {
@@ -2188,7 +2232,31 @@ void vtkAnariRendererNode::Render(bool prepass)
           anari::unsetParameter(anariDevice, anariGroup, "volume");
           anari::commitParameters(anariDevice, anariGroup);
         }
+        this->Internal->CommittedVolumes = volumeState.Volumes;
+      }
+
+      // Each surface has its own group, so that the acceleration structures of the
+      // unchanged surfaces are kept and only the top level one is rebuilt.
+      std::vector<anari::Instance> instances;
+      for (auto surface : surfaceState.Surfaces)
+      {
+        instances.emplace_back(this->Internal->SurfaceInstances[surface]);
+      }
+      if (!volumeState.Volumes.empty())
+      {
+        instances.emplace_back(this->Internal->AnariInstance);
+      }
+
+      if (!instances.empty())
+      {
+        auto instanceArray1D = anari::newArray1D(anariDevice, instances.data(), instances.size());
+        anari::setAndReleaseParameter(anariDevice, anariWorld, "instance", instanceArray1D);
+      }
+      else
+      {
+        anari::unsetParameter(anariDevice, anariWorld, "instance");
       }
+      anari::commitParameters(anariDevice, anariWorld);
     }
     else if (isNewWorld) // TODO: Should just be able to render background color??
     {
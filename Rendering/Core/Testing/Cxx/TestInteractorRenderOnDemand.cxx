@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Check that the renders requested to an interactor rendering on demand are
+// coalesced and paced to its maximum frame rate.
+
+#include "vtkCommand.h"
+#include "vtkNew.h"
+#include "vtkRenderWindow.h"
+#include "vtkRenderWindowInteractor.h"
+#include "vtkRenderer.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+constexpr int REQUEST_TIME = 2;
+constexpr int END_TIME = 2000;
+constexpr double FRAME_RATE = 20.0;
+
+class vtkRenderRequestCallback : public vtkCommand
+{
+public:
+  static vtkRenderRequestCallback* New() { return new vtkRenderRequestCallback; }
+
+  void Execute(vtkObject* caller, unsigned long eventId, void* callData) override
+  {
+    vtkRenderWindowInteractor* iren = vtkRenderWindowInteractor::SafeDownCast(caller);
+    if (eventId == vtkCommand::RenderEvent)
+    {
+      ++this->RenderCount;
+      return;
+    }
+    const int tid = *static_cast<int*>(callData);
+    if (tid == this->RequestTimerId)
+    {
+      // a burst of render requests, like the ones of interaction events
+      for (int i = 0; i < 3; ++i)
+      {
+        iren->Render();
+        ++this->RequestCount;
+      }
+    }
+    else if (tid == this->EndTimerId)
+    {
+      iren->DestroyTimer(this->RequestTimerId);
+      iren->ExitCallback();
+    }
+  }
+
+  int RequestTimerId = 0;
+  int EndTimerId = 0;
+  int RequestCount = 0;
+  int RenderCount = 0;
+};
+}
+
+int TestInteractorRenderOnDemand(int, char*[])
+{
+  vtkNew<vtkRenderer> renderer;
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->AddRenderer(renderer);
+  vtkNew<vtkRenderWindowInteractor> iren;
+  iren->SetRenderWindow(renWin);
+  iren->Initialize();
+  iren->SetMaximumFrameRate(FRAME_RATE);
+  iren->RenderOnDemandOn();
+
+  vtkNew<vtkRenderRequestCallback> cb;
+  iren->AddObserver(vtkCommand::TimerEvent, cb);
+  iren->AddObserver(vtkCommand::RenderEvent, cb);
+  cb->RequestTimerId = iren->CreateRepeatingTimer(REQUEST_TIME);
+  cb->EndTimerId = iren->CreateOneShotTimer(END_TIME);
+  iren->Start();
+
+  std::cout << cb->RequestCount << " render requests, " << cb->RenderCount << " renders."
+            << std::endl;
+  const int maxRenderCount = static_cast<int>(1.2 * FRAME_RATE * END_TIME / 1000.0) + 1;
+  if (cb->RenderCount == 0 || cb->RenderCount > maxRenderCount ||
+    cb->RenderCount >= cb->RequestCount)
+  {
+    std::cerr << "Render requests are not coalesced, expected at most " << maxRenderCount
+              << " renders." << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (iren->HasPendingRender())
+  {
+    iren->FlushPendingRender();
+  }
+  return iren->HasPendingRender() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <vtkRenderTimerLog.h>
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+int TestRenderTimerLogChromeTrace(int, char*[])
+{
+  vtkRenderTimerLog::Event child;
+  child.Name = "vtkOpenGLActor \"cow\"";
+  child.StartTime = 2000500;
+  child.EndTime = 2003500;
+
+  vtkRenderTimerLog::Event parent;
+  parent.Name = "vtkRenderWindow::Render";
+  parent.StartTime = 2000000;
+  parent.EndTime = 2010000;
+  parent.Events.push_back(child);
+
+  vtkRenderTimerLog::Frame frame;
+  frame.Events.push_back(parent);
+
+  std::ostringstream os;
+  frame.WriteChromeTrace(os);
+  const std::string trace = os.str();
+
+  const char* expected[] = {
+    "{ \"traceEvents\": [",
+    "{ \"name\": \"vtkRenderWindow::Render\", \"ph\": \"X\", \"pid\": 0, \"tid\": 0, "
+    "\"ts\": 0.000, \"dur\": 10.000 }",
+    "{ \"name\": \"vtkOpenGLActor \\\"cow\\\"\", \"ph\": \"X\", \"pid\": 0, \"tid\": 0, "
+    "\"ts\": 0.500, \"dur\": 3.000 }",
+    "\"displayTimeUnit\": \"ms\" }",
+  };
+  for (const char* part : expected)
+  {
+    if (trace.find(part) == std::string::npos)
+    {
+      std::cerr << "Missing '" << part << "' in trace:\n" << trace << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  vtkRenderTimerLog::Frame empty;
+  std::ostringstream emptyOs;
+  empty.WriteChromeTrace(emptyOs);
+  if (emptyOs.str() != "{ \"traceEvents\": [\n], \"displayTimeUnit\": \"ms\" }\n")
+  {
+    std::cerr << "Unexpected empty trace: " << emptyOs.str() << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
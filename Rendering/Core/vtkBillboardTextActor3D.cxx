@@ -16,6 +16,7 @@
 #include "vtkPolyDataMapper.h"
 #include "vtkRenderWindow.h"
 #include "vtkRenderer.h"
+#include "vtkTextImageCache.h"
 #include "vtkTextProperty.h"
 #include "vtkTextRenderer.h"
 #include "vtkTexture.h"
@@ -198,8 +199,15 @@ void vtkBillboardTextActor3D::PrintSelf(std::ostream& os, vtkIndent indent)
   os << indent << "Image:\n";
   this->Image->PrintSelf(os, indent.GetNextIndent());
 
-  os << indent << "Texture:\n";
-  this->Texture->PrintSelf(os, indent.GetNextIndent());
+  if (this->Texture)
+  {
+    os << indent << "Texture:\n";
+    this->Texture->PrintSelf(os, indent.GetNextIndent());
+  }
+  else
+  {
+    os << indent << "Texture: (none)\n";
+  }
 
   os << indent << "Quad:\n";
   this->Quad->PrintSelf(os, indent.GetNextIndent());
@@ -356,7 +364,10 @@ int vtkBillboardTextActor3D::RenderTranslucentPolygonalGeometry(vtkViewport* vp)
 void vtkBillboardTextActor3D::ReleaseGraphicsResources(vtkWindow* win)
 {
   this->RenderedRenderer = nullptr;
-  this->Texture->ReleaseGraphicsResources(win);
+  if (this->Texture)
+  {
+    this->Texture->ReleaseGraphicsResources(win);
+  }
   this->QuadMapper->ReleaseGraphicsResources(win);
   this->QuadActor->ReleaseGraphicsResources(win);
 }
@@ -393,11 +404,9 @@ vtkBillboardTextActor3D::vtkBillboardTextActor3D()
   std::fill(this->DisplayOffset, this->DisplayOffset + 2, 0);
 
   // Connect internal rendering pipeline:
-  this->Texture->InterpolateOff();
-  this->Texture->SetInputData(this->Image);
+  this->Image = vtkSmartPointer<vtkImageData>::New();
   this->QuadMapper->SetInputData(this->Quad);
   this->QuadActor->SetMapper(this->QuadMapper);
-  this->QuadActor->SetTexture(this->Texture);
 
   vtkNew<vtkPoints> points;
   points->SetDataTypeToFloat();
@@ -459,6 +468,15 @@ void vtkBillboardTextActor3D::UpdateInternals(vtkRenderer* ren)
     this->GenerateTexture(ren);
   }
 
+  vtkWindow* win = ren->GetRenderWindow();
+  if (this->IsValid() && (!this->Texture || this->TextureWindow != win))
+  {
+    // Actors displaying the same text in the same window share a texture.
+    this->Texture = vtkTextImageCache::GetTexture(this->Image, win);
+    this->TextureWindow = win;
+    this->QuadActor->SetTexture(this->Texture);
+  }
+
   if (this->IsValid() && this->QuadIsStale(ren))
   {
     this->GenerateQuad(ren);
@@ -469,8 +487,7 @@ void vtkBillboardTextActor3D::UpdateInternals(vtkRenderer* ren)
 bool vtkBillboardTextActor3D::TextureIsStale(vtkRenderer* ren)
 {
   return (this->RenderedDPI != ren->GetRenderWindow()->GetDPI() ||
-    this->Image->GetMTime() < this->InputMTime ||
-    this->Image->GetMTime() < this->TextProperty->GetMTime());
+    this->ImageTime < this->InputMTime || this->ImageTime < this->TextProperty->GetMTime());
 }
 
 //------------------------------------------------------------------------------
@@ -482,13 +499,21 @@ void vtkBillboardTextActor3D::GenerateTexture(vtkRenderer* ren)
 
   int dpi = ren->GetRenderWindow()->GetDPI();
 
-  if (!this->TextRenderer->RenderString(this->TextProperty, this->Input, this->Image, nullptr, dpi))
+  // Identical strings rendered by other actors are reused.
+  vtkSmartPointer<vtkImageData> image;
+  if (!vtkTextImageCache::RenderString(this->TextProperty, this->Input, dpi, image, nullptr))
   {
     vtkErrorMacro("Error rendering text string: " << this->Input);
     this->Invalidate();
     return;
   }
 
+  if (image != this->Image)
+  {
+    this->Image = image;
+    this->Texture = nullptr;
+  }
+  this->ImageTime.Modified();
   this->RenderedDPI = dpi;
 }
 
@@ -496,7 +521,7 @@ void vtkBillboardTextActor3D::GenerateTexture(vtkRenderer* ren)
 bool vtkBillboardTextActor3D::QuadIsStale(vtkRenderer* ren)
 {
   return (this->Quad->GetMTime() < this->GetMTime() ||
-    this->Quad->GetMTime() < this->Image->GetMTime() || this->Quad->GetMTime() < ren->GetMTime() ||
+    this->Quad->GetMTime() < this->ImageTime || this->Quad->GetMTime() < ren->GetMTime() ||
     this->Quad->GetMTime() < ren->GetRenderWindow()->GetMTime() ||
     this->Quad->GetMTime() < ren->GetActiveCamera()->GetMTime());
 }
@@ -639,7 +664,10 @@ void vtkBillboardTextActor3D::GenerateQuad(vtkRenderer* ren)
 //------------------------------------------------------------------------------
 void vtkBillboardTextActor3D::Invalidate()
 {
-  this->Image->Initialize();
+  // The image may be shared with other actors, replace it instead.
+  this->Image = vtkSmartPointer<vtkImageData>::New();
+  this->Texture = nullptr;
+  this->ImageTime.Modified();
 }
 
 //------------------------------------------------------------------------------
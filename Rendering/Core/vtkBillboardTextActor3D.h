@@ -12,6 +12,7 @@
 #include "vtkProp3D.h"
 #include "vtkRenderingCoreModule.h" // For export macro
 #include "vtkSmartPointer.h"        // For.... vtkSmartPointer!
+#include "vtkWeakPointer.h"         // For vtkWeakPointer
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkActor;
@@ -148,8 +149,10 @@ protected:
 
   // Rendering stuffies
   vtkNew<vtkTextRenderer> TextRenderer;
-  vtkNew<vtkImageData> Image;
-  vtkNew<vtkTexture> Texture;
+  vtkSmartPointer<vtkImageData> Image;
+  vtkTimeStamp ImageTime;
+  vtkSmartPointer<vtkTexture> Texture;
+  vtkWeakPointer<vtkWindow> TextureWindow;
   vtkNew<vtkPolyData> Quad;
   vtkNew<vtkPolyDataMapper> QuadMapper;
   vtkNew<vtkActor> QuadActor;
@@ -7,15 +7,21 @@
 #include "vtkCell.h"
 #include "vtkDataSet.h"
 #include "vtkFloatArray.h"
+#include "vtkGenericCell.h"
 #include "vtkIdTypeArray.h"
 #include "vtkMath.h"
 #include "vtkMatrix4x4.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
-#include "vtkSortDataArray.h"
+#include "vtkRadixSort.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 
 #include <algorithm>
 #include <stack>
 #include <utility>
+#include <vector>
 
 //------------------------------------------------------------------------------
 
@@ -112,25 +118,37 @@ void vtkCellCenterDepthSort::ComputeCellCenters()
 {
   vtkIdType numcells = this->Input->GetNumberOfCells();
   this->CellCenters->SetNumberOfTuples(numcells);
-
-  float* center = this->CellCenters->GetPointer(0);
-  double dcenter[3];
-  double* weights = new double[this->Input->GetMaxCellSize()]; // Dummy array.
-
-  for (vtkIdType i = 0; i < numcells; i++)
+  if (numcells < 1)
   {
-    vtkCell* cell = this->Input->GetCell(i);
-    double pcenter[3];
-    int subId;
-    subId = cell->GetParametricCenter(pcenter);
-    cell->EvaluateLocation(subId, pcenter, dcenter, weights);
-    center[0] = dcenter[0];
-    center[1] = dcenter[1];
-    center[2] = dcenter[2];
-    center += 3;
+    return;
   }
 
-  delete[] weights;
+  // Make sure the dataset builds its cell links before the threads query it.
+  vtkNew<vtkGenericCell> firstCell;
+  this->Input->GetCell(0, firstCell);
+
+  vtkDataSet* input = this->Input;
+  const int maxCellSize = input->GetMaxCellSize();
+  float* centers = this->CellCenters->GetPointer(0);
+  vtkSMPThreadLocalObject<vtkGenericCell> tlCell;
+  vtkSMPThreadLocal<std::vector<double>> tlWeights;
+  vtkSMPTools::For(0, numcells, [&](vtkIdType begin, vtkIdType end) {
+    vtkGenericCell* cell = tlCell.Local();
+    std::vector<double>& weights = tlWeights.Local(); // Dummy array.
+    weights.resize(maxCellSize);
+    double pcenter[3];
+    double dcenter[3];
+    for (vtkIdType i = begin; i < end; i++)
+    {
+      input->GetCell(i, cell);
+      int subId = cell->GetParametricCenter(pcenter);
+      cell->EvaluateLocation(subId, pcenter, dcenter, weights.data());
+      float* center = centers + 3 * i;
+      center[0] = dcenter[0];
+      center[1] = dcenter[1];
+      center[2] = dcenter[2];
+    }
+  });
 }
 
 void vtkCellCenterDepthSort::ComputeDepths()
@@ -138,13 +156,14 @@ void vtkCellCenterDepthSort::ComputeDepths()
   float* vector = this->ComputeProjectionVector();
   vtkIdType numcells = this->Input->GetNumberOfCells();
 
-  float* center = this->CellCenters->GetPointer(0);
-  float* depth = this->CellDepths->GetPointer(0);
-  for (vtkIdType i = 0; i < numcells; i++)
-  {
-    *(depth++) = vtkMath::Dot(center, vector);
-    center += 3;
-  }
+  const float* centers = this->CellCenters->GetPointer(0);
+  float* depths = this->CellDepths->GetPointer(0);
+  vtkSMPTools::For(0, numcells, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; i++)
+    {
+      depths[i] = vtkMath::Dot(centers + 3 * i, vector);
+    }
+  });
 }
 
 void vtkCellCenterDepthSort::InitTraversal()
@@ -153,6 +172,9 @@ void vtkCellCenterDepthSort::InitTraversal()
 
   vtkIdType numcells = this->Input->GetNumberOfCells();
 
+  // The previous order is kept as a starting point as long as the cells are
+  // the same, it is usually almost sorted for the new camera.
+  bool resort = this->SortedCells->GetNumberOfTuples() == numcells;
   if ((this->LastSortTime < this->Input->GetMTime()) || (this->LastSortTime < this->MTime))
   {
     vtkDebugMacro("Building cell centers array.");
@@ -161,21 +183,51 @@ void vtkCellCenterDepthSort::InitTraversal()
     this->ComputeCellCenters();
     this->CellDepths->SetNumberOfTuples(numcells);
     this->SortedCells->SetNumberOfTuples(numcells);
+    resort = false;
   }
 
-  vtkDebugMacro("Filling SortedCells to initial values.");
-  vtkIdType* id = this->SortedCells->GetPointer(0);
-  for (vtkIdType i = 0; i < numcells; i++)
+  vtkIdType* cellIds = this->SortedCells->GetPointer(0);
+  if (!resort)
   {
-    *(id++) = i;
+    vtkDebugMacro("Filling SortedCells to initial values.");
+    for (vtkIdType i = 0; i < numcells; i++)
+    {
+      cellIds[i] = i;
+    }
   }
 
   vtkDebugMacro("Calculating depths.");
   this->ComputeDepths();
 
+  vtkDebugMacro("Sorting cells.");
+  float* cellDepths = this->CellDepths->GetPointer(0);
+  if (resort)
+  {
+    vtkRadixSort::ResortIdsByKey(cellDepths, cellIds, numcells);
+  }
+  else
+  {
+    vtkRadixSort::SortIdsByKey(cellDepths, cellIds, numcells);
+  }
+
+  // Store the depths in the sorted order, as returned with the cells.
+  std::vector<float> sortedDepths(numcells);
+  vtkSMPTools::For(0, numcells, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; i++)
+    {
+      sortedDepths[i] = cellDepths[cellIds[i]];
+    }
+  });
+  std::copy(sortedDepths.begin(), sortedDepths.end(), cellDepths);
+
+  // Queue the slices of at most MaxCellsReturned cells, the first on top.
   while (!this->ToSort->Stack.empty())
     this->ToSort->Stack.pop();
-  this->ToSort->Stack.emplace(0, numcells);
+  const vtkIdType sliceSize = std::max(this->MaxCellsReturned, 1);
+  for (vtkIdType end = numcells; end > 0; end -= sliceSize)
+  {
+    this->ToSort->Stack.emplace(std::max<vtkIdType>(end - sliceSize, 0), end);
+  }
 
   this->LastSortTime.Modified();
 }
@@ -184,48 +236,16 @@ vtkIdTypeArray* vtkCellCenterDepthSort::GetNextCells()
 {
   if (this->ToSort->Stack.empty())
   {
-    // Already sorted and returned everything.
+    // Already returned everything.
     return nullptr;
   }
 
   vtkIdType* cellIds = this->SortedCells->GetPointer(0);
   float* cellDepths = this->CellDepths->GetPointer(0);
-  vtkIdPair partition;
-
-  partition = this->ToSort->Stack.top();
+  vtkIdPair partition = this->ToSort->Stack.top();
   this->ToSort->Stack.pop();
-  while (partition.second - partition.first > this->MaxCellsReturned)
-  {
-    vtkIdType left = partition.first;
-    vtkIdType right = partition.second - 1;
-    float pivot = cellDepths[static_cast<vtkIdType>(vtkMath::Random(left, right))];
-    while (left <= right)
-    {
-      while ((left <= right) && (cellDepths[left] < pivot))
-        left++;
-      while ((left <= right) && (cellDepths[right] > pivot))
-        right--;
-
-      if (left > right)
-        break;
-
-      std::swap(cellIds[left], cellIds[right]);
-      std::swap(cellDepths[left], cellDepths[right]);
-
-      left++;
-      right--;
-    }
-
-    this->ToSort->Stack.emplace(left, partition.second);
-    partition.second = left;
-  }
-
-  if (partition.second <= partition.first)
-  {
-    // Got a partition of zero size.  Just recurse to get the next one.
-    return this->GetNextCells();
-  }
 
+  // The cells were all sorted by InitTraversal.
   vtkIdType firstcell = partition.first;
   vtkIdType numcells = partition.second - partition.first;
 
@@ -234,7 +254,6 @@ vtkIdTypeArray* vtkCellCenterDepthSort::GetNextCells()
   this->CellPartitionDepths->SetArray(cellDepths + firstcell, numcells, 1);
   this->CellPartitionDepths->SetNumberOfTuples(numcells);
 
-  vtkSortDataArray::Sort(this->CellPartitionDepths, this->SortedCellPartition);
   return this->SortedCellPartition;
 }
 VTK_ABI_NAMESPACE_END
@@ -14,6 +14,11 @@
  * camera transformed into object space.  It then performs an ordinary sort
  * on the result.
  *
+ * The centers and depths are computed in parallel and all the cells are
+ * sorted by InitTraversal with a parallel radix sort. As long as the input
+ * does not change, the order of the previous traversal is reused as the
+ * starting point of the next sort, which is then usually much cheaper.
+ *
  */
 
 #ifndef vtkCellCenterDepthSort_h
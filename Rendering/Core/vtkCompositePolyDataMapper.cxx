@@ -9,6 +9,9 @@
 #include "vtkCompositePolyDataMapper.h"
 
 #include "vtkActor.h"
+#include "vtkBinnedDecimation.h"
+#include "vtkCamera.h"
+#include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkCommand.h"
 #include "vtkCompositeDataDisplayAttributes.h"
@@ -24,6 +27,7 @@
 #include "vtkInformation.h"
 #include "vtkMapper.h"
 #include "vtkMath.h"
+#include "vtkMatrix4x4.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
@@ -34,6 +38,9 @@
 #include "vtkScalarsToColors.h"
 #include "vtkTexture.h"
 
+#include <chrono>
+#include <cmath>
+#include <future>
 #include <map>
 #include <stack>
 #include <vector>
@@ -71,6 +78,27 @@ public:
 
   std::vector<vtkPolyData*> RenderedList;
 
+  /**
+   * Decimated versions of a large block, from the finest to the coarsest.
+   */
+  struct LevelOfDetail
+  {
+    vtkSmartPointer<vtkBinnedDecimation> Decimation;
+    std::future<vtkTypeBool> Pending;
+    vtkSmartPointer<vtkPolyData> PolyData;
+    double Error = 0.0; // size of the bins in model coordinates
+  };
+  struct LevelOfDetailHierarchy
+  {
+    vtkMTimeType BuildTime = 0;
+    double Center[3] = { 0.0, 0.0, 0.0 };
+    double Radius = 0.0;
+    std::vector<LevelOfDetail> Levels;
+    size_t Selected = 0; // 0 is the block itself
+    bool Marked = false;
+  };
+  std::map<vtkPolyData*, LevelOfDetailHierarchy> LevelsOfDetail;
+
   /**
    * Mappers created per block along with time of creation.
    */
@@ -175,6 +203,13 @@ void vtkCompositePolyDataMapper::ShallowCopy(vtkAbstractMapper* mapper)
   {
     this->SetCompositeDataDisplayAttributes(cpdm->GetCompositeDataDisplayAttributes());
     this->SetColorMissingArraysWithNanColor(cpdm->GetColorMissingArraysWithNanColor());
+    this->SetUseMultiDrawIndirect(cpdm->GetUseMultiDrawIndirect());
+    this->SetBlockFrustumCulling(cpdm->GetBlockFrustumCulling());
+    this->SetBlockOcclusionCulling(cpdm->GetBlockOcclusionCulling());
+    this->SetUseLevelOfDetail(cpdm->GetUseLevelOfDetail());
+    this->SetNumberOfLevelsOfDetail(cpdm->GetNumberOfLevelsOfDetail());
+    this->SetMaximumScreenSpaceError(cpdm->GetMaximumScreenSpaceError());
+    this->SetLevelOfDetailMinimumNumberOfCells(cpdm->GetLevelOfDetailMinimumNumberOfCells());
     this->SetCellIdArrayName(cpdm->GetCellIdArrayName());
     this->SetCompositeIdArrayName(cpdm->GetCompositeIdArrayName());
     this->SetPointIdArrayName(cpdm->GetPointIdArrayName());
@@ -238,6 +273,16 @@ void vtkCompositePolyDataMapper::SetPauseShiftScale(bool pauseShiftScale)
 void vtkCompositePolyDataMapper::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "ColorMissingArraysWithNanColor: " << this->ColorMissingArraysWithNanColor
+     << "\n";
+  os << indent << "UseMultiDrawIndirect: " << this->UseMultiDrawIndirect << "\n";
+  os << indent << "BlockFrustumCulling: " << this->BlockFrustumCulling << "\n";
+  os << indent << "BlockOcclusionCulling: " << this->BlockOcclusionCulling << "\n";
+  os << indent << "UseLevelOfDetail: " << this->UseLevelOfDetail << "\n";
+  os << indent << "NumberOfLevelsOfDetail: " << this->NumberOfLevelsOfDetail << "\n";
+  os << indent << "MaximumScreenSpaceError: " << this->MaximumScreenSpaceError << "\n";
+  os << indent << "LevelOfDetailMinimumNumberOfCells: " << this->LevelOfDetailMinimumNumberOfCells
+     << "\n";
 }
 
 //------------------------------------------------------------------------------
@@ -348,11 +393,14 @@ void vtkCompositePolyDataMapper::Render(vtkRenderer* renderer, vtkActor* actor)
     this->DelegatorMTime.Modified();
   }
 
+  this->UpdateLevelsOfDetail(renderer, actor);
+
   // rebuild the render values if needed.
   this->TempState.Clear();
   this->TempState.Append(actor->GetProperty()->GetMTime(), "actor mtime");
   this->TempState.Append(this->GetMTime(), "this mtime");
   this->TempState.Append(this->DelegatorMTime, "delegator mtime");
+  this->TempState.Append(this->LevelOfDetailTime, "level of detail time");
   this->TempState.Append(
     actor->GetTexture() ? actor->GetTexture()->GetMTime() : 0, "texture mtime");
 
@@ -396,11 +444,29 @@ void vtkCompositePolyDataMapper::Render(vtkRenderer* renderer, vtkActor* actor)
     internals.BlockState.ScalarRange.emplace(this->ScalarRange[0], this->ScalarRange[1]);
     internals.BlockState.LookupTable.push(this->GetLookupTable());
 
+    for (auto& iter : internals.LevelsOfDetail)
+    {
+      iter.second.Marked = false;
+    }
+
     {
       unsigned int flatIndex = 0;
       this->BuildRenderValues(renderer, actor, input, flatIndex);
     }
 
+    // forget the levels of detail of removed blocks
+    for (auto iter = internals.LevelsOfDetail.begin(); iter != internals.LevelsOfDetail.end();)
+    {
+      if (!iter->second.Marked)
+      {
+        internals.LevelsOfDetail.erase(iter++);
+      }
+      else
+      {
+        ++iter;
+      }
+    }
+
     // Pop base-values from the state stack.
     internals.BlockState.Visibility.pop();
     internals.BlockState.Pickability.pop();
@@ -460,6 +526,154 @@ void vtkCompositePolyDataMapper::Render(vtkRenderer* renderer, vtkActor* actor)
   this->PostRender(delegators, renderer, actor);
 }
 
+//------------------------------------------------------------------------------
+void vtkCompositePolyDataMapper::UpdateLevelsOfDetail(vtkRenderer* renderer, vtkActor* actor)
+{
+  auto& internals = (*this->Internals);
+  if (internals.LevelsOfDetail.empty())
+  {
+    return;
+  }
+
+  // pixels covered by a unit length at a unit distance from the camera, or at
+  // any distance with a parallel projection
+  vtkCamera* camera = renderer->GetActiveCamera();
+  const bool parallel = camera->GetParallelProjection() != 0;
+  const double height = renderer->GetSize()[1];
+  const double pixels = parallel
+    ? height / (2.0 * camera->GetParallelScale())
+    : height / (2.0 * std::tan(vtkMath::RadiansFromDegrees(camera->GetViewAngle()) / 2.0));
+  double position[3];
+  camera->GetPosition(position);
+
+  vtkMatrix4x4* matrix = actor->GetIsIdentity() ? nullptr : actor->GetMatrix();
+  double scale = matrix ? 0.0 : 1.0;
+  for (int c = 0; matrix && c < 3; ++c)
+  {
+    const double column[3] = { matrix->GetElement(0, c), matrix->GetElement(1, c),
+      matrix->GetElement(2, c) };
+    scale = std::max(scale, vtkMath::Norm(column));
+  }
+  const bool selecting = renderer->GetSelector() != nullptr;
+
+  bool changed = false;
+  for (auto& iter : internals.LevelsOfDetail)
+  {
+    auto& hierarchy = iter.second;
+    for (auto& level : hierarchy.Levels)
+    {
+      if (level.Pending.valid() &&
+        level.Pending.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+      {
+        vtkPolyData* output = level.Decimation->GetOutput();
+        if (level.Pending.get() && output->GetNumberOfCells() > 0)
+        {
+          level.PolyData = vtkSmartPointer<vtkPolyData>::New();
+          level.PolyData->ShallowCopy(output);
+        }
+        level.Decimation = nullptr;
+      }
+    }
+
+    size_t selected = 0;
+    double center[4] = { hierarchy.Center[0], hierarchy.Center[1], hierarchy.Center[2], 1.0 };
+    if (matrix)
+    {
+      matrix->MultiplyPoint(center, center);
+    }
+    const double distance =
+      std::sqrt(vtkMath::Distance2BetweenPoints(center, position)) - hierarchy.Radius * scale;
+    if (!selecting && (parallel || distance > 0.0))
+    {
+      const double pixelsPerUnit = scale * (parallel ? pixels : pixels / distance);
+      for (size_t i = 0; i < hierarchy.Levels.size(); ++i)
+      {
+        // be a bit stricter when switching to a coarser level to avoid
+        // flickering between two levels
+        const double maximumError =
+          this->MaximumScreenSpaceError * (i + 1 > hierarchy.Selected ? 0.75 : 1.0);
+        const auto& level = hierarchy.Levels[i];
+        if (level.PolyData && level.Error * pixelsPerUnit <= maximumError)
+        {
+          selected = i + 1;
+        }
+      }
+    }
+    if (selected != hierarchy.Selected)
+    {
+      hierarchy.Selected = selected;
+      changed = true;
+    }
+  }
+  if (changed)
+  {
+    this->LevelOfDetailTime.Modified();
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkPolyData* vtkCompositePolyDataMapper::GetLevelOfDetail(vtkPolyData* polydata)
+{
+  auto& internals = (*this->Internals);
+  vtkCellArray* polys = polydata->GetPolys();
+  if (!this->UseLevelOfDetail || polydata->GetNumberOfVerts() || polydata->GetNumberOfLines() ||
+    polydata->GetNumberOfStrips() ||
+    polys->GetNumberOfCells() < std::max<vtkIdType>(this->LevelOfDetailMinimumNumberOfCells, 1) ||
+    polys->IsHomogeneous() != 3)
+  {
+    return polydata;
+  }
+
+  auto& hierarchy = internals.LevelsOfDetail[polydata];
+  hierarchy.Marked = true;
+  if (hierarchy.BuildTime != polydata->GetMTime() ||
+    hierarchy.Levels.size() != static_cast<size_t>(this->NumberOfLevelsOfDetail))
+  {
+    hierarchy.BuildTime = polydata->GetMTime();
+    hierarchy.Selected = 0;
+    hierarchy.Levels.clear();
+    hierarchy.Levels.resize(this->NumberOfLevelsOfDetail);
+
+    double bounds[6];
+    polydata->GetBounds(bounds);
+    double length = 0.0;
+    for (int c = 0; c < 3; ++c)
+    {
+      hierarchy.Center[c] = 0.5 * (bounds[2 * c] + bounds[2 * c + 1]);
+      length = std::max(length, bounds[2 * c + 1] - bounds[2 * c]);
+    }
+    hierarchy.Radius = 0.5 * polydata->GetLength();
+
+    // the finest level has about as many bins along the longest axis as a
+    // square grid of the same number of triangles
+    const double cells = static_cast<double>(polys->GetNumberOfCells());
+    int divisions = 1 << static_cast<int>(std::ceil(std::log2(std::sqrt(cells))));
+
+    // the decimation runs on a copy so that the pipeline of the block is
+    // left untouched
+    vtkNew<vtkPolyData> input;
+    input->ShallowCopy(polydata);
+    for (auto& level : hierarchy.Levels)
+    {
+      divisions = std::max(divisions / 2, 2);
+      level.Error = length / divisions;
+      level.Decimation = vtkSmartPointer<vtkBinnedDecimation>::New();
+      level.Decimation->SetInputData(input);
+      level.Decimation->SetNumberOfDivisions(divisions, divisions, divisions);
+      level.Decimation->SetPointGenerationModeToBinAverages();
+      level.Decimation->ProducePointDataOn();
+      level.Decimation->ProduceCellDataOn();
+      level.Pending = level.Decimation->UpdateAsync();
+    }
+  }
+
+  if (hierarchy.Selected > 0)
+  {
+    return hierarchy.Levels[hierarchy.Selected - 1].PolyData;
+  }
+  return polydata;
+}
+
 //------------------------------------------------------------------------------
 vtkCompositePolyDataMapper::MapperHashType vtkCompositePolyDataMapper::InsertPolyData(
   vtkPolyData* polydata, const unsigned int& flatIndex)
@@ -639,8 +853,9 @@ void vtkCompositePolyDataMapper::BuildRenderValues(
       }
     }
   }
-  else if (auto polydata = vtkPolyData::SafeDownCast(dobj))
+  else if (auto block = vtkPolyData::SafeDownCast(dobj))
   {
+    vtkPolyData* polydata = this->GetLevelOfDetail(block);
     // The prototype mapper is a placeholder mapper that doesn't have inputs. It relies on object
     // factory overrides to facilitate hash computation using the underlying graphics implementation
     // of vtkPolydataMapper. Prepare the prototype mapper with exact scalar mapping attributes, so
@@ -194,6 +194,68 @@ public:
   vtkBooleanMacro(ColorMissingArraysWithNanColor, bool);
   ///@}
 
+  ///@{
+  /**
+   * When supported by the rendering backend, draw all the blocks of a batch
+   * with one multi draw indirect call per primitive type, reading the colors
+   * and opacity of each block from a GPU buffer and hiding blocks by editing
+   * the draw commands. This removes the per block draw calls and uniform
+   * updates that limit scenes with many blocks. Picking, selections, edges
+   * and vertices still use per block draws. The OpenGL backend requires
+   * OpenGL 4.3. Default is false.
+   */
+  vtkSetMacro(UseMultiDrawIndirect, bool);
+  vtkGetMacro(UseMultiDrawIndirect, bool);
+  vtkBooleanMacro(UseMultiDrawIndirect, bool);
+  ///@}
+
+  ///@{
+  /**
+   * When true, blocks whose bounding box lies entirely outside of the view
+   * frustum are not drawn. Hardware selection is never culled. Default is
+   * false.
+   */
+  vtkSetMacro(BlockFrustumCulling, bool);
+  vtkGetMacro(BlockFrustumCulling, bool);
+  vtkBooleanMacro(BlockFrustumCulling, bool);
+  ///@}
+
+  ///@{
+  /**
+   * When true, the bounding box of every block is tested against the depth
+   * buffer once the opaque geometry is drawn, and blocks whose box was hidden
+   * in the previous frame are not drawn. The test results are read back
+   * without waiting for the GPU, so a block that comes into view may appear
+   * one frame late. Hardware selection is never culled. Default is false.
+   */
+  vtkSetMacro(BlockOcclusionCulling, bool);
+  vtkGetMacro(BlockOcclusionCulling, bool);
+  vtkBooleanMacro(BlockOcclusionCulling, bool);
+  ///@}
+
+  ///@{
+  /**
+   * When true, large triangle blocks are decimated in the background into
+   * NumberOfLevelsOfDetail levels with vtkBinnedDecimation, each with half the
+   * bin divisions of the previous one. Every frame, each block is drawn with
+   * the coarsest level whose bin size projects to at most
+   * MaximumScreenSpaceError pixels on screen, once that level is ready. Only
+   * blocks made of at least LevelOfDetailMinimumNumberOfCells triangles, and
+   * of no other cells, are decimated. The levels are kept until the block is
+   * modified or removed. Hardware selection always uses the full blocks.
+   * Default is false.
+   */
+  vtkSetMacro(UseLevelOfDetail, bool);
+  vtkGetMacro(UseLevelOfDetail, bool);
+  vtkBooleanMacro(UseLevelOfDetail, bool);
+  vtkSetClampMacro(NumberOfLevelsOfDetail, int, 1, 8);
+  vtkGetMacro(NumberOfLevelsOfDetail, int);
+  vtkSetClampMacro(MaximumScreenSpaceError, double, 0.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(MaximumScreenSpaceError, double);
+  vtkSetClampMacro(LevelOfDetailMinimumNumberOfCells, vtkIdType, 0, VTK_ID_MAX);
+  vtkGetMacro(LevelOfDetailMinimumNumberOfCells, vtkIdType);
+  ///@}
+
   ///@{
   /**
    * Call SetInputArrayToProcess on helpers.
@@ -335,6 +397,20 @@ protected:
 
   bool RecursiveHasTranslucentGeometry(vtkDataObject* dobj, unsigned int& flat_index);
 
+  /**
+   * Collect the levels of detail built in the background and select the one
+   * drawn for each block. LevelOfDetailTime is modified when the selection
+   * changes.
+   */
+  void UpdateLevelsOfDetail(vtkRenderer* renderer, vtkActor* actor);
+
+  /**
+   * Returns the selected level of detail of a block, which is the block itself
+   * until a decimated level is selected. The decimation of large blocks is
+   * started the first time they are seen.
+   */
+  vtkPolyData* GetLevelOfDetail(vtkPolyData* polydata);
+
   void BuildRenderValues(
     vtkRenderer* renderer, vtkActor* actor, vtkDataObject* dobj, unsigned int& flat_index);
 
@@ -356,6 +432,26 @@ protected:
    */
   bool ColorMissingArraysWithNanColor = false;
 
+  /**
+   * Draw the blocks of a batch with multi draw indirect calls when possible.
+   */
+  bool UseMultiDrawIndirect = false;
+
+  /**
+   * Skip blocks outside of the view frustum or hidden in the previous frame.
+   */
+  bool BlockFrustumCulling = false;
+  bool BlockOcclusionCulling = false;
+
+  /**
+   * Draw large blocks with decimated levels of detail.
+   */
+  bool UseLevelOfDetail = false;
+  int NumberOfLevelsOfDetail = 3;
+  double MaximumScreenSpaceError = 2.0;
+  vtkIdType LevelOfDetailMinimumNumberOfCells = 100000;
+  vtkTimeStamp LevelOfDetailTime;
+
   /**
    * Time stamp for computation of bounds.
    */
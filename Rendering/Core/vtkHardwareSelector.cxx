@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkHardwareSelector.h"
 
+#include "vtkCamera.h"
 #include "vtkCommand.h"
 #include "vtkDataObject.h"
 #include "vtkDataSetAttributes.h"
@@ -9,12 +10,14 @@
 #include "vtkInformation.h"
 #include "vtkObjectFactory.h"
 #include "vtkProp.h"
+#include "vtkPropCollection.h"
 #include "vtkRenderWindow.h"
 #include "vtkRenderer.h"
 #include "vtkSelection.h"
 #include "vtkSelectionNode.h"
 #include "vtkSmartPointer.h"
 
+#include <algorithm>
 #include <cassert>
 #include <map>
 #include <set>
@@ -238,14 +241,77 @@ void vtkHardwareSelector::EndSelection()
 vtkSelection* vtkHardwareSelector::Select()
 {
   vtkSelection* sel = nullptr;
-  if (this->CaptureBuffers())
+  if (!this->CacheBuffers || !this->Renderer)
   {
-    sel = this->GenerateSelection();
-    this->ReleasePixBuffers();
+    if (this->CaptureBuffers())
+    {
+      sel = this->GenerateSelection();
+      this->ReleasePixBuffers();
+    }
+    return sel;
+  }
+
+  unsigned int area[4] = { this->Area[0], this->Area[1], this->Area[2], this->Area[3] };
+  vtkStateStorage state;
+  this->GetCacheState(state);
+  const bool stale = !this->PixBuffer[ACTOR_PASS] || this->CachedState != state ||
+    area[0] < this->CachedArea[0] || area[1] < this->CachedArea[1] ||
+    area[2] > this->CachedArea[2] || area[3] > this->CachedArea[3];
+  if (stale)
+  {
+    // capture the whole renderer so that the next selections are served from
+    // the buffers
+    const int* origin = this->Renderer->GetOrigin();
+    const int* size = this->Renderer->GetSize();
+    this->Area[0] = static_cast<unsigned int>(std::max(origin[0], 0));
+    this->Area[1] = static_cast<unsigned int>(std::max(origin[1], 0));
+    this->Area[2] = static_cast<unsigned int>(std::max(origin[0] + size[0] - 1, 0));
+    this->Area[3] = static_cast<unsigned int>(std::max(origin[1] + size[1] - 1, 0));
+    this->CachedState.Clear();
+    if (!this->CaptureBuffers())
+    {
+      std::copy(area, area + 4, this->Area);
+      return nullptr;
+    }
+    std::copy(this->Area, this->Area + 4, this->CachedArea);
+    // rendering may have updated the pipelines, so look at the scene again
+    this->GetCacheState(this->CachedState);
   }
+
+  std::copy(this->CachedArea, this->CachedArea + 4, this->Area);
+  sel = this->GenerateSelection(area);
+  std::copy(area, area + 4, this->Area);
   return sel;
 }
 
+//------------------------------------------------------------------------------
+void vtkHardwareSelector::GetCacheState(vtkStateStorage& state)
+{
+  state.Clear();
+  state.Append(this->Renderer, "renderer");
+  state.Append(this->Renderer->GetActiveCamera()->GetMTime(), "camera mtime");
+  const int* origin = this->Renderer->GetOrigin();
+  const int* size = this->Renderer->GetSize();
+  state.Append(origin[0], "origin x");
+  state.Append(origin[1], "origin y");
+  state.Append(size[0], "width");
+  state.Append(size[1], "height");
+  state.Append(this->FieldAssociation, "field association");
+  state.Append(this->UseProcessIdFromData, "process id from data");
+  state.Append(this->ProcessID, "process id");
+  state.Append(this->ActorPassOnly, "actor pass only");
+  state.Append(this->CaptureZValues, "z values");
+
+  vtkPropCollection* props = this->Renderer->GetViewProps();
+  vtkCollectionSimpleIterator pit;
+  props->InitTraversal(pit);
+  while (vtkProp* prop = props->GetNextProp(pit))
+  {
+    state.Append(prop, "prop");
+    state.Append(prop->GetRedrawMTime(), "prop mtime");
+  }
+}
+
 //------------------------------------------------------------------------------
 bool vtkHardwareSelector::CaptureBuffers()
 {
@@ -299,6 +365,14 @@ bool vtkHardwareSelector::CaptureBuffers()
         continue;
       }
 
+      // only the pixels of the area are read back, so do not shade the
+      // others
+      vtkCamera* camera = this->Renderer->GetActiveCamera();
+      camera->SetUseScissor(true);
+      camera->SetScissorRect(vtkRecti(static_cast<int>(this->Area[0]),
+        static_cast<int>(this->Area[1]), static_cast<int>(this->Area[2] - this->Area[0] + 1),
+        static_cast<int>(this->Area[3] - this->Area[1] + 1)));
+
       this->PreCapturePass(this->CurrentPass);
       rwin->Render();
       this->PostCapturePass(this->CurrentPass);
@@ -870,5 +944,6 @@ void vtkHardwareSelector::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Renderer: " << this->Renderer << endl;
   os << indent << "UseProcessIdFromData: " << this->UseProcessIdFromData << endl;
   os << indent << "ActorPassOnly: " << this->ActorPassOnly << endl;
+  os << indent << "CacheBuffers: " << this->CacheBuffers << endl;
 }
 VTK_ABI_NAMESPACE_END
@@ -99,6 +99,7 @@
 
 #include "vtkObject.h"
 #include "vtkRenderingCoreModule.h" // For export macro
+#include "vtkStateStorage.h"        // For ivar
 
 #include <string> // for std::string
 
@@ -187,6 +188,21 @@ public:
    */
   VTK_NEWINSTANCE vtkSelection* Select();
 
+  ///@{
+  /**
+   * When true, Select() captures the selection buffers for the whole
+   * renderer and keeps them. Following calls to Select() for an area inside
+   * the renderer are then answered from the kept buffers without rendering,
+   * until the camera, the renderer size, the selector settings or any view
+   * prop of the renderer is modified. This makes repeated picking of a static
+   * scene, e.g. to show hover information, much cheaper. Buffers are released
+   * by ClearBuffers(). Default is false.
+   */
+  vtkSetMacro(CacheBuffers, bool);
+  vtkGetMacro(CacheBuffers, bool);
+  vtkBooleanMacro(CacheBuffers, bool);
+  ///@}
+
   ///@{
   /**
    * It is possible to use the vtkHardwareSelector for a custom picking. (Look
@@ -507,6 +523,15 @@ protected:
 
   bool CaptureZValues;
 
+  bool CacheBuffers = false;
+  unsigned int CachedArea[4] = { 0, 0, 0, 0 };
+  vtkStateStorage CachedState;
+
+  /**
+   * Fills \c state with everything that invalidates cached buffers.
+   */
+  void GetCacheState(vtkStateStorage& state);
+
 private:
   vtkHardwareSelector(const vtkHardwareSelector&) = delete;
   void operator=(const vtkHardwareSelector&) = delete;
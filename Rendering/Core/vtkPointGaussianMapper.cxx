@@ -58,5 +58,8 @@ void vtkPointGaussianMapper::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "OpacityTableSize: " << this->OpacityTableSize << "\n";
   os << indent << "ScaleTableSize: " << this->ScaleTableSize << "\n";
   os << indent << "BoundScale: " << this->BoundScale << "\n";
+  os << indent << "LevelOfDetail: " << this->LevelOfDetail << "\n";
+  os << indent << "LODPixelSpacing: " << this->LODPixelSpacing << "\n";
+  os << indent << "PointBudget: " << this->PointBudget << "\n";
 }
 VTK_ABI_NAMESPACE_END
@@ -192,6 +192,41 @@ public:
   vtkGetVector3Macro(LowpassMatrix, float);
   ///@}
 
+  ///@{
+  /**
+   * Turn on/off the level of detail of the points. When on, the points are
+   * sorted into nested levels like the ones of an octree: the first level has
+   * a single point, and each level adds the points needed to have one point in
+   * each occupied cell of a grid twice as fine as the one of the previous
+   * level. Each frame then only draws the levels needed for the cells to be
+   * at most LODPixelSpacing pixels wide on screen, up to PointBudget points,
+   * so that large or distant point clouds draw a spatially uniform subset of
+   * their points. Default is off.
+   */
+  vtkSetMacro(LevelOfDetail, bool);
+  vtkGetMacro(LevelOfDetail, bool);
+  vtkBooleanMacro(LevelOfDetail, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the size in pixels of the cells of the finest level drawn when
+   * LevelOfDetail is on, that is the screen spacing between the points drawn.
+   * Larger values draw fewer points. Default is 1.
+   */
+  vtkSetClampMacro(LODPixelSpacing, double, 0.01, VTK_DOUBLE_MAX);
+  vtkGetMacro(LODPixelSpacing, double);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the maximum number of points drawn per frame when LevelOfDetail
+   * is on, 0 for no limit. Default is 0.
+   */
+  vtkSetClampMacro(PointBudget, vtkIdType, 0, VTK_ID_MAX);
+  vtkGetMacro(PointBudget, vtkIdType);
+  ///@}
+
   /**
    * WARNING: INTERNAL METHOD - NOT INTENDED FOR GENERAL USE
    * DO NOT USE THIS METHOD OUTSIDE OF THE RENDERING PROCESS
@@ -228,6 +263,9 @@ private:
   char* RotationArray = nullptr;
   float LowpassMatrix[3] = { 0.f, 0.f, 0.f };
   bool Anisotropic = false;
+  bool LevelOfDetail = false;
+  double LODPixelSpacing = 1.0;
+  vtkIdType PointBudget = 0;
 };
 
 VTK_ABI_NAMESPACE_END
@@ -3,8 +3,10 @@
 
 #include "vtkRenderTimerLog.h"
 
+#include "vtkLogger.h"
 #include "vtkObjectFactory.h"
 
+#include <algorithm>
 #include <iomanip>
 #include <utility>
 
@@ -101,6 +103,77 @@ void vtkRenderTimerLog::Frame::Print(std::ostream& os, float threshMs)
   }
 }
 
+//------------------------------------------------------------------------------
+namespace
+{
+void WriteChromeTraceEvents(std::ostream& os, const std::vector<vtkRenderTimerLog::Event>& events,
+  vtkTypeUInt64 origin, bool& first)
+{
+  for (const auto& event : events)
+  {
+    os << (first ? "\n" : ",\n") << "  { \"name\": \"";
+    first = false;
+    for (char c : event.Name)
+    {
+      if (c == '"' || c == '\\')
+      {
+        os << '\\' << c;
+      }
+      else if (static_cast<unsigned char>(c) >= 0x20)
+      {
+        os << c;
+      }
+    }
+    // complete events, in microseconds
+    os << "\", \"ph\": \"X\", \"pid\": 0, \"tid\": 0, \"ts\": " << std::fixed
+       << std::setprecision(3) << (event.StartTime - origin) * 1e-3
+       << ", \"dur\": " << event.ElapsedTimeNanoseconds() * 1e-3 << " }";
+    WriteChromeTraceEvents(os, event.Events, origin, first);
+  }
+}
+
+void AddEventsToTrace(
+  const std::vector<vtkRenderTimerLog::Event>& events, vtkTypeUInt64 origin, double startTime)
+{
+  for (const auto& event : events)
+  {
+    vtkLogger::TraceComplete(event.Name.c_str(), startTime + (event.StartTime - origin) * 1e-9,
+      event.ElapsedTimeNanoseconds() * 1e-9, "GPU");
+    AddEventsToTrace(event.Events, origin, startTime);
+  }
+}
+}
+
+//------------------------------------------------------------------------------
+void vtkRenderTimerLog::Frame::AddToTrace(double startTime) const
+{
+  if (this->Events.empty() || !vtkLogger::IsTracing())
+  {
+    return;
+  }
+  vtkTypeUInt64 origin = this->Events.front().StartTime;
+  for (const auto& event : this->Events)
+  {
+    origin = std::min(origin, event.StartTime);
+  }
+  AddEventsToTrace(this->Events, origin, startTime);
+}
+
+//------------------------------------------------------------------------------
+void vtkRenderTimerLog::Frame::WriteChromeTrace(std::ostream& os) const
+{
+  vtkTypeUInt64 origin = this->Events.empty() ? 0 : this->Events.front().StartTime;
+  for (const auto& event : this->Events)
+  {
+    origin = std::min(origin, event.StartTime);
+  }
+
+  bool first = true;
+  os << "{ \"traceEvents\": [";
+  WriteChromeTraceEvents(os, this->Events, origin, first);
+  os << "\n], \"displayTimeUnit\": \"ms\" }\n";
+}
+
 //------------------------------------------------------------------------------
 void vtkRenderTimerLog::Event::Print(
   std::ostream& os, float parentTime, float threshMs, vtkIndent indent)
@@ -59,9 +59,12 @@
   vtkRenderTimerLog::ScopedEventLogger identifier;                                                 \
   do                                                                                               \
   {                                                                                                \
-    std::ostringstream _eventNameStream;                                                           \
-    _eventNameStream << eventName;                                                                 \
-    identifier = timer->StartScopedEvent(_eventNameStream.str());                                  \
+    if (timer->GetLoggingEnabled()) /* Do not build names that will not be used */                 \
+    {                                                                                              \
+      std::ostringstream _eventNameStream;                                                         \
+      _eventNameStream << eventName;                                                               \
+      identifier = timer->StartScopedEvent(_eventNameStream.str());                                \
+    }                                                                                              \
     (void)identifier; /* Prevent set-but-not-used var warnings */                                  \
   } while (false)     /* Do-while loop prevents duplicate semicolon warnings */
 
@@ -116,6 +119,21 @@ public:
      * @param threshMs Only print events with a time > threshMs milliseconds.
      */
     void Print(std::ostream& os, float threshMs = 0.f);
+
+    /** Write all events in this frame to a stream as a JSON document in the
+     * Chrome trace event format, which can be opened in chrome://tracing or
+     * in the Perfetto UI. Times are relative to the start of the first event.
+     * @param os The stream.
+     */
+    void WriteChromeTrace(std::ostream& os) const;
+
+    /** Add all events in this frame to the trace of vtkLogger, in a "GPU"
+     * timeline. The GPU clock is not synchronized with the one of the trace,
+     * so the events are placed relative to `startTime`, the trace time in
+     * seconds of the start of the first event, see vtkLogger::GetTraceTime().
+     * @param startTime The trace time of the start of the frame.
+     */
+    void AddToTrace(double startTime) const;
   };
 
   /**
@@ -141,7 +141,7 @@ public:
    * Ask each renderer owned by this RenderWindow to render its image and
    * synchronize this process.
    */
-  void Render() override;
+  VTK_UNBLOCKTHREADS void Render() override;
 
   /**
    * Start the rendering process for a frame
@@ -17,6 +17,7 @@
 #include "vtkRenderWindow.h"
 #include "vtkRenderer.h"
 #include "vtkRendererCollection.h"
+#include "vtkTimerLog.h"
 
 #include <map>
 
@@ -73,6 +74,11 @@ vtkRenderWindowInteractor::vtkRenderWindowInteractor()
   this->Initialized = 0;
   this->Enabled = 0;
   this->EnableRender = true;
+  this->RenderOnDemand = false;
+  this->MaximumFrameRate = 60.0;
+  this->LastFrameTime = 0.0;
+  this->LastFrameEnd = 0.0;
+  this->FrameTimerId = 0;
   this->DesiredUpdateRate = 15;
   // default limit is 3 hours per frame
   this->StillUpdateRate = 0.0001;
@@ -137,6 +143,11 @@ vtkRenderWindowInteractor::vtkRenderWindowInteractor()
   this->PointersDownCount = 0;
   this->CurrentGesture = vtkCommand::StartEvent;
   this->Done = false;
+
+  // The frames scheduled when rendering on demand are rendered before any
+  // other observer sees their timer, and their timer events are not passed on.
+  this->AddObserver(
+    vtkCommand::TimerEvent, this, &vtkRenderWindowInteractor::OnFrameTimer, VTK_FLOAT_MAX);
 }
 
 //------------------------------------------------------------------------------
@@ -162,16 +173,96 @@ vtkObjectFactoryNewMacro(vtkRenderWindowInteractor);
 
 //------------------------------------------------------------------------------
 void vtkRenderWindowInteractor::Render()
+{
+  if (this->RenderOnDemand && this->ScheduleFrame())
+  {
+    return;
+  }
+  this->RenderFrame();
+}
+
+//------------------------------------------------------------------------------
+void vtkRenderWindowInteractor::RenderFrame()
 {
   if (this->RenderWindow && this->Enabled && this->EnableRender)
   {
+    const double start = vtkTimerLog::GetUniversalTime();
     this->RenderWindow->Render();
+    this->LastFrameEnd = vtkTimerLog::GetUniversalTime();
+    this->LastFrameTime = this->LastFrameEnd - start;
   }
   // outside the above test so that third-party code can redirect
   // the render to the appropriate class
   this->InvokeEvent(vtkCommand::RenderEvent, nullptr);
 }
 
+//------------------------------------------------------------------------------
+bool vtkRenderWindowInteractor::ScheduleFrame()
+{
+  if (this->FrameTimerId)
+  {
+    // coalesced with the frame already scheduled
+    return true;
+  }
+  if (!this->Initialized || !this->Enabled)
+  {
+    return false;
+  }
+
+  // wait for the end of the current frame period, at least one millisecond so
+  // that the pending events are handled first
+  const double elapsed = vtkTimerLog::GetUniversalTime() - this->LastFrameEnd;
+  const double wait = 1000.0 * (1.0 / this->MaximumFrameRate - elapsed);
+  const unsigned long duration = wait > 1.0 ? static_cast<unsigned long>(wait) : 1;
+  this->FrameTimerId = this->CreateOneShotTimer(duration);
+  return this->FrameTimerId != 0;
+}
+
+//------------------------------------------------------------------------------
+bool vtkRenderWindowInteractor::OnFrameTimer(vtkObject*, unsigned long, void* callData)
+{
+  if (!this->FrameTimerId || !callData)
+  {
+    return false;
+  }
+  // depending on the platform, timer events carry either the VTK or the
+  // platform specific timer id
+  const int timerId = *static_cast<int*>(callData);
+  vtkTimerIdMapIterator iter = this->TimerMap->find(this->FrameTimerId);
+  if (timerId != this->FrameTimerId &&
+    (iter == this->TimerMap->end() || timerId != iter->second.Id))
+  {
+    return false;
+  }
+  this->FlushPendingRender();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkRenderWindowInteractor::FlushPendingRender()
+{
+  if (this->FrameTimerId)
+  {
+    this->DestroyTimer(this->FrameTimerId);
+    this->FrameTimerId = 0;
+    this->RenderFrame();
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkRenderWindowInteractor::SetRenderOnDemand(bool renderOnDemand)
+{
+  if (this->RenderOnDemand != renderOnDemand)
+  {
+    this->RenderOnDemand = renderOnDemand;
+    if (!renderOnDemand)
+    {
+      this->FlushPendingRender();
+    }
+    this->Modified();
+  }
+}
+
 //------------------------------------------------------------------------------
 // treat renderWindow and interactor as one object.
 // it might be easier if the GetReference count method were redefined.
@@ -956,6 +1047,9 @@ void vtkRenderWindowInteractor::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Initialized: " << this->Initialized << "\n";
   os << indent << "Enabled: " << this->Enabled << "\n";
   os << indent << "EnableRender: " << this->EnableRender << "\n";
+  os << indent << "RenderOnDemand: " << this->RenderOnDemand << "\n";
+  os << indent << "MaximumFrameRate: " << this->MaximumFrameRate << "\n";
+  os << indent << "LastFrameTime: " << this->LastFrameTime << "\n";
   os << indent << "EventPosition: "
      << "( " << this->EventPosition[0] << ", " << this->EventPosition[1] << " )\n";
   os << indent << "LastEventPosition: "
@@ -145,6 +145,47 @@ public:
   vtkGetMacro(EnableRender, bool);
   ///@}
 
+  ///@{
+  /**
+   * Turn on/off rendering on demand. When on, Render() does not render right
+   * away but schedules a frame with a one-shot timer, and all the renders
+   * requested until this frame is rendered are coalesced into it. Frames are
+   * paced to MaximumFrameRate, so that a burst of interaction events causes a
+   * single render per frame and the events are handled in between. Render()
+   * still renders right away when the interactor is not initialized or cannot
+   * create timers. Default is Off.
+   */
+  virtual void SetRenderOnDemand(bool);
+  vtkBooleanMacro(RenderOnDemand, bool);
+  vtkGetMacro(RenderOnDemand, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the maximum number of frames per second rendered on demand,
+   * typically the refresh rate of the display. Default is 60.
+   */
+  vtkSetClampMacro(MaximumFrameRate, double, 1.0, VTK_FLOAT_MAX);
+  vtkGetMacro(MaximumFrameRate, double);
+  ///@}
+
+  /**
+   * Return true if a frame has been scheduled by Render() and is not rendered
+   * yet. Only used when rendering on demand.
+   */
+  bool HasPendingRender() { return this->FrameTimerId != 0; }
+
+  /**
+   * Render the frame scheduled by Render() right away, if any.
+   */
+  void FlushPendingRender();
+
+  /**
+   * Get the time in seconds taken by the render window to render the last
+   * frame rendered through this interactor.
+   */
+  vtkGetMacro(LastFrameTime, double);
+
   ///@{
   /**
    * Set/Get the rendering window being controlled by this object.
@@ -877,6 +918,26 @@ protected:
   int Initialized;
   int Enabled;
   bool EnableRender;
+  bool RenderOnDemand;
+  double MaximumFrameRate;
+  double LastFrameTime;
+  double LastFrameEnd; // universal time at the end of the last frame
+  int FrameTimerId;    // one-shot timer of the scheduled frame, 0 if none
+
+  /**
+   * Render the scene right away, without scheduling a frame.
+   */
+  void RenderFrame();
+
+  /**
+   * Schedule a frame if none is, return false if it cannot be scheduled.
+   */
+  bool ScheduleFrame();
+
+  /**
+   * Render the scheduled frame when its timer fires.
+   */
+  bool OnFrameTimer(vtkObject*, unsigned long, void* callData);
   int Style;
   vtkTypeBool LightFollowCamera;
   int ActorMode;
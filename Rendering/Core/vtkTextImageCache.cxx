@@ -0,0 +1,231 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkTextImageCache.h"
+
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkStdString.h"
+#include "vtkTextProperty.h"
+#include "vtkTextRenderer.h"
+#include "vtkTexture.h"
+#include "vtkWeakPointer.h"
+#include "vtkWindow.h"
+
+#include <algorithm>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace vtkTextImageCache
+{
+VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+struct Entry
+{
+  std::string Key;
+  vtkSmartPointer<vtkImageData> Image;
+  int TextDims[2];
+  std::vector<std::pair<vtkWeakPointer<vtkWindow>, vtkSmartPointer<vtkTexture>>> Textures;
+};
+
+struct Cache
+{
+  std::mutex Mutex;
+  size_t MaximumNumberOfEntries = 1024;
+  // Most recently used first.
+  std::list<Entry> Entries;
+  std::unordered_map<std::string, std::list<Entry>::iterator> EntriesByKey;
+  std::unordered_map<vtkImageData*, std::list<Entry>::iterator> EntriesByImage;
+
+  void Erase(std::list<Entry>::iterator it)
+  {
+    this->EntriesByKey.erase(it->Key);
+    this->EntriesByImage.erase(it->Image.Get());
+    this->Entries.erase(it);
+  }
+
+  void Trim()
+  {
+    while (this->Entries.size() > this->MaximumNumberOfEntries)
+    {
+      this->Erase(std::prev(this->Entries.end()));
+    }
+  }
+};
+
+Cache& GetCache()
+{
+  static Cache cache;
+  return cache;
+}
+
+template <typename T>
+void Append(std::string& key, const T& value)
+{
+  key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void AppendString(std::string& key, const char* str)
+{
+  const size_t length = str ? std::strlen(str) : 0;
+  Append(key, length);
+  key.append(str ? str : "", length);
+}
+
+// Everything in the text property that changes the rendered image.
+std::string MakeKey(vtkTextProperty* tprop, const std::string& str, int dpi)
+{
+  std::string key;
+  key.reserve(256 + str.size());
+  Append(key, dpi);
+  for (int i = 0; i < 3; ++i)
+  {
+    Append(key, tprop->GetColor()[i]);
+    Append(key, tprop->GetBackgroundColor()[i]);
+    Append(key, tprop->GetFrameColor()[i]);
+    Append(key, tprop->GetInteriorLinesColor()[i]);
+  }
+  Append(key, tprop->GetOpacity());
+  Append(key, tprop->GetBackgroundOpacity());
+  Append(key, tprop->GetFrame());
+  Append(key, tprop->GetFrameWidth());
+  AppendString(key, tprop->GetFontFamilyAsString());
+  AppendString(key, tprop->GetFontFile());
+  Append(key, tprop->GetFontSize());
+  Append(key, tprop->GetBold());
+  Append(key, tprop->GetItalic());
+  Append(key, tprop->GetShadow());
+  Append(key, tprop->GetShadowOffset()[0]);
+  Append(key, tprop->GetShadowOffset()[1]);
+  Append(key, tprop->GetJustification());
+  Append(key, tprop->GetVerticalJustification());
+  Append(key, tprop->GetUseTightBoundingBox());
+  Append(key, tprop->GetOrientation());
+  Append(key, tprop->GetLineOffset());
+  Append(key, tprop->GetLineSpacing());
+  Append(key, tprop->GetCellOffset());
+  Append(key, tprop->GetInteriorLinesVisibility());
+  Append(key, tprop->GetInteriorLinesWidth());
+  key.append(str);
+  return key;
+}
+}
+
+//------------------------------------------------------------------------------
+bool RenderString(vtkTextProperty* tprop, const std::string& str, int dpi,
+  vtkSmartPointer<vtkImageData>& image, int textDims[2])
+{
+  vtkTextRenderer* tren = vtkTextRenderer::GetInstance();
+  if (!tprop || !tren)
+  {
+    return false;
+  }
+
+  Cache& cache = GetCache();
+  const std::string key = MakeKey(tprop, str, dpi);
+  {
+    std::lock_guard<std::mutex> lock(cache.Mutex);
+    auto found = cache.EntriesByKey.find(key);
+    if (found != cache.EntriesByKey.end())
+    {
+      cache.Entries.splice(cache.Entries.begin(), cache.Entries, found->second);
+      image = found->second->Image;
+      if (textDims)
+      {
+        std::copy_n(found->second->TextDims, 2, textDims);
+      }
+      return true;
+    }
+  }
+
+  // Always render in a new image: the previous one may be shared.
+  Entry entry;
+  entry.Key = key;
+  entry.Image = vtkSmartPointer<vtkImageData>::New();
+  if (!tren->RenderString(tprop, vtkStdString(str), entry.Image, entry.TextDims, dpi))
+  {
+    return false;
+  }
+  image = entry.Image;
+  if (textDims)
+  {
+    std::copy_n(entry.TextDims, 2, textDims);
+  }
+
+  std::lock_guard<std::mutex> lock(cache.Mutex);
+  if (cache.MaximumNumberOfEntries > 0 && cache.EntriesByKey.find(key) == cache.EntriesByKey.end())
+  {
+    cache.Entries.push_front(std::move(entry));
+    cache.EntriesByKey[key] = cache.Entries.begin();
+    cache.EntriesByImage[image.Get()] = cache.Entries.begin();
+    cache.Trim();
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkTexture> GetTexture(vtkImageData* image, vtkWindow* win)
+{
+  Cache& cache = GetCache();
+  std::lock_guard<std::mutex> lock(cache.Mutex);
+  auto found = cache.EntriesByImage.find(image);
+  if (!win || found == cache.EntriesByImage.end())
+  {
+    vtkNew<vtkTexture> texture;
+    texture->InterpolateOff();
+    texture->SetInputData(image);
+    return texture.Get();
+  }
+
+  auto& textures = found->second->Textures;
+  textures.erase(std::remove_if(textures.begin(), textures.end(),
+                   [](const std::pair<vtkWeakPointer<vtkWindow>, vtkSmartPointer<vtkTexture>>& t) {
+                     return t.first == nullptr;
+                   }),
+    textures.end());
+  for (const auto& texture : textures)
+  {
+    if (texture.first == win)
+    {
+      return texture.second;
+    }
+  }
+  vtkNew<vtkTexture> texture;
+  texture->InterpolateOff();
+  texture->SetInputData(image);
+  textures.emplace_back(win, texture.Get());
+  return texture.Get();
+}
+
+//------------------------------------------------------------------------------
+void Clear()
+{
+  Cache& cache = GetCache();
+  std::lock_guard<std::mutex> lock(cache.Mutex);
+  cache.EntriesByKey.clear();
+  cache.EntriesByImage.clear();
+  cache.Entries.clear();
+}
+
+//------------------------------------------------------------------------------
+void SetMaximumNumberOfEntries(size_t size)
+{
+  Cache& cache = GetCache();
+  std::lock_guard<std::mutex> lock(cache.Mutex);
+  cache.MaximumNumberOfEntries = size;
+  cache.Trim();
+}
+
+//------------------------------------------------------------------------------
+size_t GetMaximumNumberOfEntries()
+{
+  Cache& cache = GetCache();
+  std::lock_guard<std::mutex> lock(cache.Mutex);
+  return cache.MaximumNumberOfEntries;
+}
+VTK_ABI_NAMESPACE_END
+}
@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * Private header used by vtkTextMapper and vtkBillboardTextActor3D to share
+ * rendered strings.
+ *
+ * Scenes with many text props often display the same few strings with the
+ * same text property, e.g. callouts, tick labels or units. Instead of having
+ * each prop rasterize the string and upload it to its own texture, the images
+ * produced by vtkTextRenderer are kept in a process wide least recently used
+ * cache keyed by the string, the DPI and the state of the text property, and
+ * each cached image owns one texture per render window. Props displaying the
+ * same text thus share a single rasterization and a single texture upload.
+ *
+ * The cached images must be treated as read only.
+ */
+
+#ifndef vtkTextImageCache_h
+#define vtkTextImageCache_h
+
+#include "vtkABINamespace.h"
+#include "vtkRenderingCoreModule.h" // For export macro
+#include "vtkSmartPointer.h"        // For vtkSmartPointer
+
+#include <cstddef> // For size_t
+#include <string>  // For std::string
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkImageData;
+class vtkTextProperty;
+class vtkTexture;
+class vtkWindow;
+VTK_ABI_NAMESPACE_END
+
+namespace vtkTextImageCache
+{
+VTK_ABI_NAMESPACE_BEGIN
+/**
+ * Return in image the rendering of str with tprop at the given dpi, and in
+ * textDims (if not null) the dimensions of the text in the image, as
+ * vtkTextRenderer::RenderString does. The string is only rendered when it
+ * is not in the cache already. Return false if the rendering failed.
+ */
+VTKRENDERINGCORE_EXPORT bool RenderString(vtkTextProperty* tprop, const std::string& str,
+  int dpi, vtkSmartPointer<vtkImageData>& image, int textDims[2]);
+
+/**
+ * Return the texture of an image returned by RenderString for the given
+ * window. The texture is shared by all the callers using this image in this
+ * window while the image remains in the cache.
+ */
+VTKRENDERINGCORE_EXPORT vtkSmartPointer<vtkTexture> GetTexture(
+  vtkImageData* image, vtkWindow* win);
+
+/**
+ * Empty the cache. Call it after changing global font settings, such as the
+ * ones of vtkFreeTypeTools, which are not part of the cache key.
+ */
+VTKRENDERINGCORE_EXPORT void Clear();
+
+///@{
+/**
+ * Set/Get the maximum number of strings kept in the cache, 1024 by default.
+ * Zero disables the cache.
+ */
+VTKRENDERINGCORE_EXPORT void SetMaximumNumberOfEntries(size_t size);
+VTKRENDERINGCORE_EXPORT size_t GetMaximumNumberOfEntries();
+///@}
+VTK_ABI_NAMESPACE_END
+}
+
+#endif
+// VTK-HeaderTest-Exclude: vtkTextImageCache.h
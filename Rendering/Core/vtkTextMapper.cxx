@@ -13,6 +13,7 @@
 #include "vtkPolyData.h"
 #include "vtkPolyDataMapper2D.h"
 #include "vtkRenderer.h"
+#include "vtkTextImageCache.h"
 #include "vtkTextProperty.h"
 #include "vtkTextRenderer.h"
 #include "vtkTexture.h"
@@ -63,7 +64,7 @@ vtkTextMapper::vtkTextMapper()
   this->PolyData->GetPointData()->SetTCoords(tcoords);
   this->Mapper->SetInputData(this->PolyData);
 
-  this->Texture->SetInputData(this->Image);
+  this->Image = vtkSmartPointer<vtkImageData>::New();
   this->TextDims[0] = this->TextDims[1] = 0;
 }
 
@@ -118,8 +119,15 @@ void vtkTextMapper::PrintSelf(ostream& os, vtkIndent indent)
   this->PolyData->PrintSelf(os, indent.GetNextIndent());
   os << indent << "Mapper:\n";
   this->Mapper->PrintSelf(os, indent.GetNextIndent());
-  os << indent << "Texture:\n";
-  this->Texture->PrintSelf(os, indent.GetNextIndent());
+  if (this->Texture)
+  {
+    os << indent << "Texture:\n";
+    this->Texture->PrintSelf(os, indent.GetNextIndent());
+  }
+  else
+  {
+    os << indent << "Texture: (none)\n";
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -351,6 +359,12 @@ void vtkTextMapper::RenderOverlay(vtkViewport* viewport, vtkActor2D* actor)
     this->UpdateQuad(actor, win->GetDPI());
 
     ren = vtkRenderer::SafeDownCast(viewport);
+    if (ren && (!this->Texture || this->TextureWindow != win))
+    {
+      // Mappers displaying the same text in the same window share a texture.
+      this->Texture = vtkTextImageCache::GetTexture(this->Image, win);
+      this->TextureWindow = win;
+    }
     if (ren)
     {
       vtkDebugMacro(<< "Texture::Render called");
@@ -384,7 +398,10 @@ void vtkTextMapper::ReleaseGraphicsResources(vtkWindow* win)
 {
   this->Superclass::ReleaseGraphicsResources(win);
   this->Mapper->ReleaseGraphicsResources(win);
-  this->Texture->ReleaseGraphicsResources(win);
+  if (this->Texture)
+  {
+    this->Texture->ReleaseGraphicsResources(win);
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -396,7 +413,11 @@ vtkMTimeType vtkTextMapper::GetMTime()
   result = std::max(result, this->Points->GetMTime());
   result = std::max(result, this->PolyData->GetMTime());
   result = std::max(result, this->Mapper->GetMTime());
-  result = std::max(result, this->Texture->GetMTime());
+  result = std::max(result, this->ImageTime.GetMTime());
+  if (this->Texture)
+  {
+    result = std::max(result, this->Texture->GetMTime());
+  }
   return result;
 }
 
@@ -406,7 +427,7 @@ void vtkTextMapper::UpdateQuad(vtkActor2D* actor, int dpi)
   vtkDebugMacro(<< "UpdateQuad called");
 
   // Update texture coordinates:
-  if (this->Image->GetMTime() > this->TCoordsTime)
+  if (this->ImageTime > this->TCoordsTime)
   {
     int dims[3];
     this->Image->GetDimensions(dims);
@@ -490,17 +511,25 @@ void vtkTextMapper::UpdateQuad(vtkActor2D* actor, int dpi)
 void vtkTextMapper::UpdateImage(int dpi)
 {
   vtkDebugMacro(<< "UpdateImage called");
-  if (this->MTime > this->Image->GetMTime() || this->RenderedDPI != dpi ||
-    this->TextProperty->GetMTime() > this->Image->GetMTime())
+  if (this->MTime > this->ImageTime || this->RenderedDPI != dpi ||
+    this->TextProperty->GetMTime() > this->ImageTime)
   {
     vtkTextRenderer* tren = vtkTextRenderer::GetInstance();
     if (tren)
     {
-      if (!tren->RenderString(this->TextProperty, this->Input ? this->Input : std::string(),
-            this->Image, this->TextDims, dpi))
+      // Identical strings rendered by other mappers are reused.
+      vtkSmartPointer<vtkImageData> image;
+      if (!vtkTextImageCache::RenderString(this->TextProperty,
+            this->Input ? this->Input : std::string(), dpi, image, this->TextDims))
       {
         vtkErrorMacro(<< "Texture generation failed.");
       }
+      else if (image != this->Image)
+      {
+        this->Image = image;
+        this->Texture = nullptr;
+      }
+      this->ImageTime.Modified();
       this->RenderedDPI = dpi;
       vtkDebugMacro(<< "Text rendered to " << this->TextDims[0] << ", " << this->TextDims[1]
                     << " buffer.");
@@ -20,7 +20,9 @@
 #include "vtkMapper2D.h"
 #include "vtkRenderingCoreModule.h" // For export macro
 
-#include "vtkNew.h" // For vtkNew
+#include "vtkNew.h"          // For vtkNew
+#include "vtkSmartPointer.h" // For vtkSmartPointer
+#include "vtkWeakPointer.h"  // For vtkWeakPointer
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkActor2D;
@@ -32,6 +34,7 @@ class vtkTextProperty;
 class vtkTexture;
 class vtkTimeStamp;
 class vtkViewport;
+class vtkWindow;
 
 class VTKRENDERINGCORE_EXPORT vtkTextMapper : public vtkMapper2D
 {
@@ -131,11 +134,13 @@ private:
   int RenderedDPI;
   vtkTimeStamp CoordsTime;
   vtkTimeStamp TCoordsTime;
-  vtkNew<vtkImageData> Image;
+  vtkTimeStamp ImageTime;
+  vtkSmartPointer<vtkImageData> Image;
   vtkNew<vtkPoints> Points;
   vtkNew<vtkPolyData> PolyData;
   vtkNew<vtkPolyDataMapper2D> Mapper;
-  vtkNew<vtkTexture> Texture;
+  vtkSmartPointer<vtkTexture> Texture;
+  vtkWeakPointer<vtkWindow> TextureWindow;
 };
 
 VTK_ABI_NAMESPACE_END
@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkSmartPointer.h"
+#include "vtkTextImageCache.h"
+#include "vtkTextProperty.h"
+
+#include <iostream>
+
+int TestTextImageCache(int, char*[])
+{
+  vtkTextImageCache::Clear();
+
+  vtkNew<vtkTextProperty> tprop1;
+  tprop1->SetFontSize(18);
+  vtkNew<vtkTextProperty> tprop2;
+  tprop2->ShallowCopy(tprop1);
+
+  // Equal text properties share the rendered image.
+  vtkSmartPointer<vtkImageData> image1;
+  vtkSmartPointer<vtkImageData> image2;
+  int dims1[2] = { 0, 0 };
+  int dims2[2] = { 0, 0 };
+  if (!vtkTextImageCache::RenderString(tprop1, "Callout", 72, image1, dims1) ||
+    !vtkTextImageCache::RenderString(tprop2, "Callout", 72, image2, dims2))
+  {
+    std::cerr << "Rendering failed." << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (image1 != image2 || dims1[0] != dims2[0] || dims1[1] != dims2[1] || dims1[0] <= 0)
+  {
+    std::cerr << "Identical strings were not shared." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Any change of the string, the property or the DPI renders a new image.
+  vtkSmartPointer<vtkImageData> image3;
+  vtkTextImageCache::RenderString(tprop1, "Callout 2", 72, image3, nullptr);
+  vtkSmartPointer<vtkImageData> image4;
+  vtkTextImageCache::RenderString(tprop1, "Callout", 144, image4, nullptr);
+  tprop2->SetColor(1.0, 0.0, 0.0);
+  vtkSmartPointer<vtkImageData> image5;
+  vtkTextImageCache::RenderString(tprop2, "Callout", 72, image5, nullptr);
+  if (image3 == image1 || image4 == image1 || image5 == image1)
+  {
+    std::cerr << "Different renderings were shared." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Evicted entries are rendered again.
+  vtkTextImageCache::SetMaximumNumberOfEntries(1);
+  vtkTextImageCache::RenderString(tprop1, "Callout", 72, image2, nullptr);
+  if (image2 == image1)
+  {
+    std::cerr << "Evicted image was reused." << std::endl;
+    return EXIT_FAILURE;
+  }
+  vtkTextImageCache::SetMaximumNumberOfEntries(1024);
+  vtkTextImageCache::Clear();
+
+  return EXIT_SUCCESS;
+}
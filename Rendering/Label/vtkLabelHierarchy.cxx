@@ -23,11 +23,13 @@
 #include "vtkPolyData.h"
 #include "vtkPythagoreanQuadruples.h"
 #include "vtkRenderer.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkTextProperty.h"
 
 #include <deque>
 #include <map>
+#include <numeric>
 #include <octree/octree>
 #include <set>
 #include <vector>
@@ -2378,10 +2380,27 @@ void vtkLabelHierarchy::Implementation::PrepareSortedAnchors(LabelSet& anchors)
 {
   anchors.clear();
   vtkIdType npts = this->Husk->GetPoints()->GetNumberOfPoints();
-  for (vtkIdType i = 0; i < npts; ++i)
-  {
-    anchors.insert(i);
+  std::vector<vtkIdType> ids(npts);
+  std::iota(ids.begin(), ids.end(), 0);
+
+  // Sort in parallel on a copy of the priorities, in the order of the multiset: descending
+  // priorities, equal priorities in increasing id order. Inserting the sorted ids at the end
+  // of the multiset then takes constant time each.
+  vtkDataArray* priorities = this->Husk->GetPriorities();
+  if (priorities)
+  {
+    std::vector<double> values(npts);
+    vtkSMPTools::For(0, npts, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        values[i] = priorities->GetComponent(i, 0);
+      }
+    });
+    vtkSMPTools::Sort(ids.begin(), ids.end(), [&values](vtkIdType a, vtkIdType b) {
+      return values[a] > values[b] || (!(values[b] > values[a]) && a < b);
+    });
   }
+  anchors.insert(ids.begin(), ids.end());
 }
 
 void vtkLabelHierarchy::Implementation::FillHierarchyRoot(LabelSet& anchors)
@@ -29,6 +29,14 @@
 #include "vtkTimerLog.h"
 #include "vtkTransformCoordinateSystems.h"
 
+#include <algorithm>
+#include <array>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 // From: http://www.flipcode.com/archives/2D_OBB_Intersection.shtml
 VTK_ABI_NAMESPACE_BEGIN
 class LabelRect
@@ -329,7 +337,60 @@ public:
     void Reset() { this->Labels.clear(); }
     void Insert(const LabelRect& rect) { this->Labels.push_back(rect); }
   };
+  /// Label bounds computed by the render strategy, which measures the text with a font
+  /// engine. They are kept across frames for each text property, orientation and label.
+  struct LabelBoundsCache
+  {
+    struct Entry
+    {
+      vtkMTimeType TextPropertyTime = 0;
+      std::unordered_map<std::string, std::array<double, 4>> Bounds;
+    };
+    std::map<vtkTextProperty*, Entry> Entries;
+    vtkLabelRenderStrategy* Strategy = nullptr;
+    vtkMTimeType StrategyTime = 0;
+    int DPI = 0;
+
+    /// Forget everything when the strategy or the resolution changed.
+    void Validate(vtkLabelRenderStrategy* strategy, int dpi)
+    {
+      if (strategy != this->Strategy || strategy->GetMTime() != this->StrategyTime ||
+        dpi != this->DPI)
+      {
+        this->Entries.clear();
+        this->Strategy = strategy;
+        this->StrategyTime = strategy->GetMTime();
+        this->DPI = dpi;
+      }
+    }
+
+    /// Bounds of a label rendered with tpropCopy, a copy of tprop with the label
+    /// orientation.
+    void GetBounds(
+      vtkTextProperty* tprop, vtkTextProperty* tpropCopy, const vtkStdString& label, double bds[4])
+    {
+      Entry& entry = this->Entries[tprop];
+      if (entry.TextPropertyTime != tprop->GetMTime())
+      {
+        entry.Bounds.clear();
+        entry.TextPropertyTime = tprop->GetMTime();
+      }
+      const double orientation = tpropCopy->GetOrientation();
+      std::string key(reinterpret_cast<const char*>(&orientation), sizeof(orientation));
+      key += label;
+      auto it = entry.Bounds.find(key);
+      if (it == entry.Bounds.end())
+      {
+        std::array<double, 4> bounds;
+        this->Strategy->ComputeLabelBounds(tpropCopy, label, bounds.data());
+        it = entry.Bounds.emplace(std::move(key), bounds).first;
+      }
+      std::copy(it->second.begin(), it->second.end(), bds);
+    }
+  };
+
   std::vector<std::vector<ScreenTile>> Tiles;
+  LabelBoundsCache BoundsCache;
   float ScreenOrigin[2];
   float TileSize[2];
   int NumTiles[2];
@@ -561,7 +622,13 @@ void vtkLabelPlacementMapper::RenderOverlay(vtkViewport* viewport, vtkActor2D* v
   if (!this->Buckets || this->Buckets->NumTiles[0] * this->Buckets->TileSize[0] < tvpsz[2] ||
     this->Buckets->NumTiles[1] * this->Buckets->TileSize[1] < tvpsz[3])
   {
-    this->Buckets = new Internal(kdbounds, tileSize);
+    Internal* buckets = new Internal(kdbounds, tileSize);
+    if (this->Buckets)
+    {
+      buckets->BoundsCache = std::move(this->Buckets->BoundsCache);
+      delete this->Buckets;
+    }
+    this->Buckets = buckets;
   }
   else
   {
@@ -641,6 +708,7 @@ void vtkLabelPlacementMapper::RenderOverlay(vtkViewport* viewport, vtkActor2D* v
   timer->StartTimer();
 
   vtkSmartPointer<vtkTextProperty> tpropCopy = vtkSmartPointer<vtkTextProperty>::New();
+  this->Buckets->BoundsCache.Validate(this->RenderStrategy, ren->GetRenderWindow()->GetDPI());
 
   for (; !inIter->IsAtEnd(); inIter->Next())
   {
@@ -699,7 +767,7 @@ void vtkLabelPlacementMapper::RenderOverlay(vtkViewport* viewport, vtkActor2D* v
     }
 
     double bds[4];
-    this->RenderStrategy->ComputeLabelBounds(tpropCopy, inIter->GetLabel(), bds);
+    this->Buckets->BoundsCache.GetBounds(tprop, tpropCopy, inIter->GetLabel(), bds);
 
     // Offset display position by lower left corner of bounding box
     dispx[0] = static_cast<int>(origin[0] + bds[0]);
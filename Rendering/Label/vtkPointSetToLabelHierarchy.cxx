@@ -15,6 +15,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPointSet.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStringArray.h"
 #include "vtkTextProperty.h"
@@ -233,14 +234,12 @@ int vtkPointSetToLabelHierarchy::RequestData(vtkInformation* vtkNotUsed(request)
       vtkIdType numTuples = labels->GetNumberOfTuples();
       arr->SetNumberOfComponents(numComps);
       arr->SetNumberOfTuples(numTuples);
-      for (vtkIdType i = 0; i < numTuples; ++i)
-      {
-        for (vtkIdType j = 0; j < numComps; ++j)
+      vtkSMPTools::For(0, numTuples * numComps, [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType ind = begin; ind < end; ++ind)
         {
-          vtkIdType ind = i * numComps + j;
           arr->SetValue(ind, labels->GetVariantValue(ind).ToString());
         }
-      }
+      });
       arr->SetName(labels->GetName());
       ouData->GetPointData()->AddArray(arr);
       ouData->SetLabels(arr);
@@ -386,7 +386,7 @@ public:
   void PopContext() override;
   ///@}
 
-  void Render() override;
+  VTK_UNBLOCKTHREADS void Render() override;
 
 protected:
   vtkCocoaRenderWindow();
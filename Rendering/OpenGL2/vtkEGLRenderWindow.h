@@ -170,7 +170,7 @@ public:
    * This computes the size of the render window
    * before calling the supper classes render
    */
-  void Render() override;
+  VTK_UNBLOCKTHREADS void Render() override;
 
   /**
    * Check to see if a mouse button has been pressed.  All other events
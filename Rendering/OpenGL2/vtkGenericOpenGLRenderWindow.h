@@ -113,7 +113,7 @@ public:
    * \sa vtkOpenGLRenderWindow::SaveGLState()
    * \sa vtkOpenGLRenderWindow::RestoreGLState()
    */
-  void Render() override;
+  VTK_UNBLOCKTHREADS void Render() override;
 
   /**
    * Overridden to pass explicitly specified MaximumHardwareLineWidth, if any.
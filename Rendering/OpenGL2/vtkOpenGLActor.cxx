@@ -16,6 +16,7 @@
 #include "vtkOpenGLRenderer.h"
 #include "vtkOpenGLState.h"
 #include "vtkProperty.h"
+#include "vtkRenderTimerLog.h"
 #include "vtkRenderWindow.h"
 #include "vtkTransform.h"
 
@@ -90,7 +91,11 @@ void vtkOpenGLActor::Render(vtkRenderer* ren, vtkMapper* mapper)
   }
 
   // send a render to the mapper; update pipeline
-  mapper->Render(ren, this);
+  {
+    VTK_SCOPED_RENDER_EVENT(this->GetObjectDescription() << " " << mapper->GetClassName(),
+      ren->GetRenderWindow()->GetRenderTimer());
+    mapper->Render(ren, this);
+  }
 
   if (!opaque)
   {
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 
 #include "vtkOpenGLBatchedPolyDataMapper.h"
+#include "vtkCamera.h"
 #include "vtkCellData.h"
 #include "vtkColorTransferFunction.h"
 #include "vtkCompositePolyDataMapper.h"
@@ -9,13 +10,21 @@
 #include "vtkHardwareSelector.h"
 #include "vtkImageData.h"
 #include "vtkLookupTable.h"
+#include "vtkMath.h"
+#include "vtkMatrix3x3.h"
+#include "vtkMatrix4x4.h"
 #include "vtkObjectFactory.h"
+#include "vtkOpenGLActor.h"
+#include "vtkOpenGLBufferObject.h"
+#include "vtkOpenGLCamera.h"
 #include "vtkOpenGLCellToVTKCellMap.h"
 #include "vtkOpenGLCompositePolyDataMapperDelegator.h"
 #include "vtkOpenGLIndexBufferObject.h"
 #include "vtkOpenGLRenderWindow.h"
+#include "vtkOpenGLShaderCache.h"
 #include "vtkOpenGLState.h"
 #include "vtkOpenGLTexture.h"
+#include "vtkOpenGLVertexArrayObject.h"
 #include "vtkOpenGLVertexBufferObject.h"
 #include "vtkOpenGLVertexBufferObjectGroup.h"
 #include "vtkPointData.h"
@@ -28,6 +37,8 @@
 #include "vtkTextureObject.h"
 #include "vtkTransform.h"
 #include "vtkUnsignedIntArray.h"
+
+#include <algorithm>
 #include <sstream>
 
 namespace
@@ -49,6 +60,69 @@ private:
   T Value;
 };
 
+#ifdef GL_ES_VERSION_3_0
+const GLenum OcclusionQueryTarget = GL_ANY_SAMPLES_PASSED;
+#else
+const GLenum OcclusionQueryTarget = GL_SAMPLES_PASSED;
+#endif
+
+// Computes the corners of the bounding box of a block, grown a little so that
+// the box is in front of the block surfaces, in model and world coordinates.
+bool GetBlockCorners(vtkPolyData* polydata, vtkMatrix4x4* matrix, double model[8][3],
+  double world[8][3])
+{
+  double bounds[6];
+  polydata->GetBounds(bounds);
+  if (!vtkMath::AreBoundsInitialized(bounds))
+  {
+    return false;
+  }
+  double length = 0.0;
+  for (int i = 0; i < 3; ++i)
+  {
+    length = std::max(length, bounds[2 * i + 1] - bounds[2 * i]);
+  }
+  const double margin = length > 0.0 ? 0.01 * length : 1e-6;
+  for (int i = 0; i < 8; ++i)
+  {
+    double point[4] = { i & 1 ? bounds[1] + margin : bounds[0] - margin,
+      i & 2 ? bounds[3] + margin : bounds[2] - margin,
+      i & 4 ? bounds[5] + margin : bounds[4] - margin, 1.0 };
+    std::copy(point, point + 3, model[i]);
+    if (matrix)
+    {
+      matrix->MultiplyPoint(point, point);
+      for (int j = 0; j < 3; ++j)
+      {
+        point[j] /= point[3];
+      }
+    }
+    std::copy(point, point + 3, world[i]);
+  }
+  return true;
+}
+
+// Returns true when all the corners are on the outer side of one of the planes.
+bool IsOutside(const double* planes, int numberOfPlanes, const double corners[8][3])
+{
+  for (int i = 0; i < numberOfPlanes; ++i)
+  {
+    const double* plane = planes + 4 * i;
+    int outside = 0;
+    for (int j = 0; j < 8; ++j)
+    {
+      outside +=
+        plane[0] * corners[j][0] + plane[1] * corners[j][1] + plane[2] * corners[j][2] + plane[3] <
+        0.0;
+    }
+    if (outside == 8)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
 } // end anonymous namespace
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -70,6 +144,10 @@ vtkOpenGLBatchedPolyDataMapper::vtkOpenGLBatchedPolyDataMapper()
 {
   // force static
   this->Static = true;
+  for (auto& counts : this->IndirectDrawCounts)
+  {
+    std::fill(counts, counts + PrimitiveTriStrips + 1, 0u);
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -81,6 +159,29 @@ void vtkOpenGLBatchedPolyDataMapper::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
   os << indent << "Primitive ID Used: " << this->PrimIDUsed << endl;
   os << indent << "Override Color Used: " << this->OverideColorUsed << endl;
+  os << indent << "Using Indirect Draws: " << this->UsingIndirectDraws << endl;
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLBatchedPolyDataMapper::ReleaseGraphicsResources(vtkWindow* window)
+{
+  this->IndirectAttributeBuffer->ReleaseGraphicsResources();
+  this->IndirectCommandBuffer->ReleaseGraphicsResources();
+  this->IndirectAttributes.clear();
+  this->IndirectCommands.clear();
+  this->UsingIndirectDraws = false;
+  // makes the context current before the queries are deleted
+  this->OcclusionBoxes.ReleaseGraphicsResources(window);
+  if (window && !this->OcclusionQueries.empty())
+  {
+    glDeleteQueries(static_cast<GLsizei>(this->OcclusionQueries.size()),
+      this->OcclusionQueries.data());
+  }
+  this->OcclusionQueries.clear();
+  this->OcclusionQueryKeys.clear();
+  this->OcclusionBoxBuffer->ReleaseGraphicsResources();
+  this->OcclusionBoxVertices.clear();
+  this->Superclass::ReleaseGraphicsResources(window);
 }
 
 //------------------------------------------------------------------------------
@@ -213,6 +314,33 @@ void vtkOpenGLBatchedPolyDataMapper::RenderPieceDraw(vtkRenderer* renderer, vtkA
 
   this->PrimitiveIDOffset = 0;
 
+  // the programs of multi draw indirect calls read the block attributes
+  // from instanced arrays, so they are rebuilt when the path changes
+  bool useIndirectDraws = this->Parent && this->Parent->GetUseMultiDrawIndirect() &&
+    !this->CurrentSelector && vtkOpenGLBatchedPolyDataMapper::IsMultiDrawIndirectSupported();
+  if (useIndirectDraws != this->UsingIndirectDraws)
+  {
+    this->UsingIndirectDraws = useIndirectDraws;
+    for (int i = vtkOpenGLPolyDataMapper::PrimitiveStart; i < vtkOpenGLPolyDataMapper::PrimitiveEnd;
+         i++)
+    {
+      this->Primitives[i].Program = nullptr;
+    }
+  }
+  const bool occlusionCulling =
+    this->Parent && this->Parent->GetBlockOcclusionCulling() && !this->CurrentSelector;
+  const bool opaquePass = !actor->IsRenderingTranslucentPolygonalGeometry();
+  if (occlusionCulling && opaquePass)
+  {
+    this->ReadOcclusionQueries();
+  }
+  this->CullBatchElements(renderer, actor);
+
+  if (this->UsingIndirectDraws)
+  {
+    this->UpdateIndirectBuffers(actor);
+  }
+
   // draw IBOs
   for (int i = vtkOpenGLPolyDataMapper::PrimitiveStart;
        i < (this->CurrentSelector ? vtkOpenGLPolyDataMapper::PrimitiveTriStrips + 1
@@ -243,6 +371,11 @@ void vtkOpenGLBatchedPolyDataMapper::RenderPieceDraw(vtkRenderer* renderer, vtkA
     }
   }
 
+  if (occlusionCulling && opaquePass)
+  {
+    this->IssueOcclusionQueries(renderer, actor);
+  }
+
   if (this->CurrentSelector &&
     (this->CurrentSelector->GetCurrentPass() == vtkHardwareSelector::CELL_ID_LOW24 ||
       this->CurrentSelector->GetCurrentPass() == vtkHardwareSelector::CELL_ID_HIGH24))
@@ -651,6 +784,13 @@ void vtkOpenGLBatchedPolyDataMapper::DrawIBO(vtkRenderer* renderer, vtkActor* ac
       ostate->vtkglLineWidth(actor->GetProperty()->GetLineWidth());
     }
 
+    // draw all the blocks at once when possible
+    if (this->DrawIndirect(actor, primType, CellBO, mode))
+    {
+      CellBO.IBO->Release();
+      return;
+    }
+
     // if (this->DrawingEdgesOrVetices && !this->DrawingTubes(CellBO, actor))
     // {
     //   vtkProperty *ppty = actor->GetProperty();
@@ -672,6 +812,7 @@ void vtkOpenGLBatchedPolyDataMapper::DrawIBO(vtkRenderer* renderer, vtkActor* ac
       auto glBatchElement = iter.second.get();
       auto& batchElement = glBatchElement->Parent;
       bool shouldDraw = batchElement.Visibility     // must be visible
+        && !glBatchElement->Culled                  // and not culled
         && (!selecting || batchElement.Pickability) // and pickable when selecting
         && (((selecting || batchElement.IsOpaque || actor->GetForceOpaque()) &&
               !tpass) // opaque during opaque or when selecting
@@ -701,6 +842,192 @@ void vtkOpenGLBatchedPolyDataMapper::DrawIBO(vtkRenderer* renderer, vtkActor* ac
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkOpenGLBatchedPolyDataMapper::CullBatchElements(vtkRenderer* renderer, vtkActor* actor)
+{
+  const bool frustumCulling =
+    this->Parent && this->Parent->GetBlockFrustumCulling() && !this->CurrentSelector;
+  const bool occlusionCulling =
+    this->Parent && this->Parent->GetBlockOcclusionCulling() && !this->CurrentSelector;
+
+  double planes[24];
+  if (frustumCulling)
+  {
+    renderer->GetActiveCamera()->GetFrustumPlanes(renderer->GetTiledAspectRatio(), planes);
+  }
+  vtkMatrix4x4* matrix = actor->GetIsIdentity() ? nullptr : actor->GetMatrix();
+  for (auto& iter : this->VTKPolyDataToGLBatchElement)
+  {
+    auto glBatchElement = iter.second.get();
+    glBatchElement->Culled = occlusionCulling && glBatchElement->Occluded;
+    double model[8][3];
+    double world[8][3];
+    if (frustumCulling && !glBatchElement->Culled &&
+      ::GetBlockCorners(glBatchElement->Parent.PolyData, matrix, model, world))
+    {
+      glBatchElement->Culled = ::IsOutside(planes, 6, world);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLBatchedPolyDataMapper::ReadOcclusionQueries()
+{
+  size_t index = 0;
+  for (auto& iter : this->VTKPolyDataToGLBatchElement)
+  {
+    auto glBatchElement = iter.second.get();
+    if (index < this->OcclusionQueryKeys.size() && this->OcclusionQueryKeys[index] == iter.first)
+    {
+      // do not wait for the GPU, a result which is not ready yet leaves the
+      // block as it was
+      GLuint available = 0;
+      glGetQueryObjectuiv(this->OcclusionQueries[index], GL_QUERY_RESULT_AVAILABLE, &available);
+      if (available)
+      {
+        GLuint samples = 0;
+        glGetQueryObjectuiv(this->OcclusionQueries[index], GL_QUERY_RESULT, &samples);
+        glBatchElement->Occluded = samples == 0;
+      }
+    }
+    else
+    {
+      glBatchElement->Occluded = false;
+    }
+    ++index;
+  }
+  this->OcclusionQueryKeys.clear();
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLBatchedPolyDataMapper::IssueOcclusionQueries(vtkRenderer* renderer, vtkActor* actor)
+{
+  vtkOpenGLRenderWindow* renWin = static_cast<vtkOpenGLRenderWindow*>(renderer->GetRenderWindow());
+  vtkOpenGLState* ostate = renWin->GetState();
+
+  const size_t numberOfBlocks = this->VTKPolyDataToGLBatchElement.size();
+  if (this->OcclusionQueries.size() < numberOfBlocks)
+  {
+    const size_t first = this->OcclusionQueries.size();
+    this->OcclusionQueries.resize(numberOfBlocks);
+    glGenQueries(static_cast<GLsizei>(numberOfBlocks - first), &this->OcclusionQueries[first]);
+  }
+  this->OcclusionQueryKeys.assign(numberOfBlocks, 0);
+
+  // 12 triangles per box, blocks which are not tested get an empty box
+  static const int boxTriangles[36] = { 0, 2, 1, 1, 2, 3, 4, 5, 6, 5, 7, 6, 0, 1, 4, 1, 5, 4, 2,
+    6, 3, 3, 6, 7, 0, 4, 2, 2, 4, 6, 1, 3, 5, 3, 7, 5 };
+  std::vector<float> vertices(numberOfBlocks * 36 * 3, 0.0f);
+  double planes[24];
+  renderer->GetActiveCamera()->GetFrustumPlanes(renderer->GetTiledAspectRatio(), planes);
+  vtkMatrix4x4* matrix = actor->GetIsIdentity() ? nullptr : actor->GetMatrix();
+  size_t index = 0;
+  for (auto& iter : this->VTKPolyDataToGLBatchElement)
+  {
+    auto glBatchElement = iter.second.get();
+    double model[8][3];
+    double world[8][3];
+    // a box crossing the near plane would be clipped, so the camera may be
+    // inside it and the block is never considered hidden
+    if (glBatchElement->Parent.Visibility &&
+      ::GetBlockCorners(glBatchElement->Parent.PolyData, matrix, model, world) &&
+      !::IsOutside(planes + 16, 1, world))
+    {
+      this->OcclusionQueryKeys[index] = iter.first;
+      float* vertex = &vertices[index * 36 * 3];
+      for (int i = 0; i < 36; ++i)
+      {
+        for (int j = 0; j < 3; ++j)
+        {
+          *vertex++ = static_cast<float>(model[boxTriangles[i]][j]);
+        }
+      }
+    }
+    ++index;
+  }
+  if (vertices != this->OcclusionBoxVertices)
+  {
+    this->OcclusionBoxVertices.swap(vertices);
+    this->OcclusionBoxBuffer->Upload(
+      this->OcclusionBoxVertices, vtkOpenGLBufferObject::ArrayBuffer);
+  }
+
+  vtkOpenGLHelper& helper = this->OcclusionBoxes;
+  if (!helper.Program)
+  {
+    std::string VSSource = "//VTK::System::Dec\n"
+                           "in vec4 vertexMC;\n"
+                           "uniform mat4 MCDCMatrix;\n"
+                           "void main()\n"
+                           "{\n"
+                           "  gl_Position = MCDCMatrix * vertexMC;\n"
+                           "}\n";
+    std::string FSSource = "//VTK::System::Dec\n"
+                           "//VTK::Output::Dec\n"
+                           "void main()\n"
+                           "{\n"
+                           "  gl_FragData[0] = vec4(1.0);\n"
+                           "}\n";
+    helper.Program =
+      renWin->GetShaderCache()->ReadyShaderProgram(VSSource.c_str(), FSSource.c_str(), "");
+    helper.VAO->ShaderProgramChanged();
+  }
+  else
+  {
+    renWin->GetShaderCache()->ReadyShaderProgram(helper.Program);
+  }
+  if (!helper.Program)
+  {
+    return;
+  }
+
+  helper.VAO->Bind();
+  if (!helper.VAO->AddAttributeArray(helper.Program, this->OcclusionBoxBuffer, "vertexMC", 0,
+        3 * sizeof(float), VTK_FLOAT, 3, false))
+  {
+    vtkErrorMacro(<< "Error setting 'vertexMC' in shader VAO.");
+  }
+
+  vtkMatrix4x4* wcdc;
+  vtkMatrix4x4* wcvc;
+  vtkMatrix3x3* norms;
+  vtkMatrix4x4* vcdc;
+  static_cast<vtkOpenGLCamera*>(renderer->GetActiveCamera())
+    ->GetKeyMatrices(renderer, wcvc, norms, vcdc, wcdc);
+  if (actor->GetIsIdentity())
+  {
+    helper.Program->SetUniformMatrix("MCDCMatrix", wcdc);
+  }
+  else
+  {
+    vtkMatrix4x4* mcwc;
+    vtkMatrix3x3* anorms;
+    static_cast<vtkOpenGLActor*>(actor)->GetKeyMatrices(mcwc, anorms);
+    vtkMatrix4x4::Multiply4x4(mcwc, wcdc, this->TempMatrix4);
+    helper.Program->SetUniformMatrix("MCDCMatrix", this->TempMatrix4);
+  }
+
+  // test the boxes against the depth buffer without writing anything
+  vtkOpenGLState::ScopedglColorMask colorMaskSaver(ostate);
+  vtkOpenGLState::ScopedglDepthMask depthMaskSaver(ostate);
+  vtkOpenGLState::ScopedglDepthFunc depthFuncSaver(ostate);
+  vtkOpenGLState::ScopedglEnableDisable cullFaceSaver(ostate, GL_CULL_FACE);
+  ostate->vtkglColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+  ostate->vtkglDepthMask(GL_FALSE);
+  ostate->vtkglDepthFunc(GL_LEQUAL);
+  ostate->vtkglDisable(GL_CULL_FACE);
+  for (index = 0; index < numberOfBlocks; ++index)
+  {
+    if (this->OcclusionQueryKeys[index])
+    {
+      glBeginQuery(::OcclusionQueryTarget, this->OcclusionQueries[index]);
+      glDrawArrays(GL_TRIANGLES, static_cast<GLint>(index * 36), 36);
+      glEndQuery(::OcclusionQueryTarget);
+    }
+  }
+  helper.VAO->Release();
+}
+
 //------------------------------------------------------------------------------
 void vtkOpenGLBatchedPolyDataMapper::SetShaderValues(
   vtkShaderProgram* prog, GLBatchElement* glBatchElement, size_t primOffset)
@@ -722,6 +1049,27 @@ void vtkOpenGLBatchedPolyDataMapper::SetShaderValues(
     return;
   }
 
+  // override the opacity and color
+  float ambientColor[3];
+  float diffuseColor[3];
+  float opacity;
+  bool useNanColor =
+    this->GetBatchElementColors(glBatchElement, ambientColor, diffuseColor, opacity);
+  prog->SetUniformf("opacityUniform", opacity);
+  prog->SetUniform3f("ambientColorUniform", ambientColor);
+  prog->SetUniform3f("diffuseColorUniform", diffuseColor);
+  if (!useNanColor && this->OverideColorUsed)
+  {
+    prog->SetUniformi("OverridesColor", batchElement.OverridesColor);
+  }
+}
+
+//------------------------------------------------------------------------------
+bool vtkOpenGLBatchedPolyDataMapper::GetBatchElementColors(GLBatchElement* glBatchElement,
+  float ambientColor[3], float diffuseColor[3], float& opacity)
+{
+  auto& batchElement = glBatchElement->Parent;
+
   SCOPED_ROLLBACK(int, ColorMode);
   SCOPED_ROLLBACK(int, ScalarMode);
   SCOPED_ROLLBACK(int, ArrayAccessMode);
@@ -762,45 +1110,183 @@ void vtkOpenGLBatchedPolyDataMapper::SetShaderValues(
     }
   }
 
-  // override the opacity and color
-  prog->SetUniformf("opacityUniform", batchElement.Opacity);
-
+  opacity = static_cast<float>(batchElement.Opacity);
   if (useNanColor)
   {
-    float fnancolor[3] = { static_cast<float>(nanColor[0]), static_cast<float>(nanColor[1]),
-      static_cast<float>(nanColor[2]) };
-    prog->SetUniform3f("ambientColorUniform", fnancolor);
-    prog->SetUniform3f("diffuseColorUniform", fnancolor);
+    for (int i = 0; i < 3; ++i)
+    {
+      ambientColor[i] = diffuseColor[i] = static_cast<float>(nanColor[i]);
+    }
+  }
+  else if (this->DrawingSelection)
+  {
+    vtkColor3d& sColor = batchElement.SelectionColor;
+    for (int i = 0; i < 3; ++i)
+    {
+      ambientColor[i] = diffuseColor[i] = static_cast<float>(sColor[i]);
+    }
+    opacity = static_cast<float>(batchElement.SelectionOpacity);
   }
   else
   {
-    if (this->DrawingSelection)
+    vtkColor3d& aColor = batchElement.AmbientColor;
+    vtkColor3d& dColor = batchElement.DiffuseColor;
+    for (int i = 0; i < 3; ++i)
     {
-      vtkColor3d& sColor = batchElement.SelectionColor;
-      float selectionColor[3] = { static_cast<float>(sColor[0]), static_cast<float>(sColor[1]),
-        static_cast<float>(sColor[2]) };
-      prog->SetUniform3f("ambientColorUniform", selectionColor);
-      prog->SetUniform3f("diffuseColorUniform", selectionColor);
-      prog->SetUniformf("opacityUniform", batchElement.SelectionOpacity);
+      ambientColor[i] = static_cast<float>(aColor[i]);
+      diffuseColor[i] = static_cast<float>(dColor[i]);
     }
-    else
+  }
+  return useNanColor;
+}
+
+//------------------------------------------------------------------------------
+bool vtkOpenGLBatchedPolyDataMapper::IsMultiDrawIndirectSupported()
+{
+#ifdef GL_ES_VERSION_3_0
+  return false;
+#else
+  // the divisor of the per block attributes needs instanced arrays
+  return (GLEW_VERSION_4_3 || (GLEW_ARB_multi_draw_indirect && GLEW_ARB_base_instance)) &&
+    GLEW_ARB_instanced_arrays;
+#endif
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLBatchedPolyDataMapper::UpdateIndirectBuffers(vtkActor* actor)
+{
+  // One instance per block and primitive type holds the attributes of the
+  // block, and one command per pass, primitive type and block draws it as
+  // that instance. Hidden blocks keep their command with no instance.
+  const size_t numberOfBlocks = this->VTKPolyDataToGLBatchElement.size();
+  const int numberOfTypes = PrimitiveTriStrips + 1;
+  std::vector<float> attributes(numberOfTypes * numberOfBlocks * 10);
+  std::vector<GLuint> commands(2 * numberOfTypes * numberOfBlocks * 5);
+  for (int pass = 0; pass < 2; ++pass)
+  {
+    for (int primType = 0; primType < numberOfTypes; ++primType)
     {
-      vtkColor3d& aColor = batchElement.AmbientColor;
-      float ambientColor[3] = { static_cast<float>(aColor[0]), static_cast<float>(aColor[1]),
-        static_cast<float>(aColor[2]) };
-      vtkColor3d& dColor = batchElement.DiffuseColor;
-      float diffuseColor[3] = { static_cast<float>(dColor[0]), static_cast<float>(dColor[1]),
-        static_cast<float>(dColor[2]) };
-      prog->SetUniform3f("ambientColorUniform", ambientColor);
-      prog->SetUniform3f("diffuseColorUniform", diffuseColor);
+      this->IndirectDrawCounts[pass][primType] = 0;
     }
-    if (this->OverideColorUsed)
+  }
+
+  size_t block = 0;
+  for (auto& iter : this->VTKPolyDataToGLBatchElement)
+  {
+    auto glBatchElement = iter.second.get();
+    auto& batchElement = glBatchElement->Parent;
+    float ambientColor[3];
+    float diffuseColor[3];
+    float opacity;
+    const bool overridesColor =
+      !this->GetBatchElementColors(glBatchElement, ambientColor, diffuseColor, opacity) &&
+      batchElement.OverridesColor;
+    const bool visible = batchElement.Visibility && !glBatchElement->Culled;
+    const bool drawInPass[2] = { visible && (batchElement.IsOpaque || actor->GetForceOpaque()),
+      visible && (!batchElement.IsOpaque || actor->GetForceTranslucent()) };
+
+    for (int primType = 0; primType < numberOfTypes; ++primType)
     {
-      prog->SetUniformi("OverridesColor", batchElement.OverridesColor);
+      const size_t instance = primType * numberOfBlocks + block;
+      float* record = &attributes[instance * 10];
+      std::copy(ambientColor, ambientColor + 3, record);
+      record[3] = opacity;
+      std::copy(diffuseColor, diffuseColor + 3, record + 4);
+      record[7] = overridesColor ? 1.0f : 0.0f;
+      // split the offset so that floats represent it exactly
+      const vtkIdType offset = glBatchElement->CellCellMap->GetPrimitiveOffsets()[primType];
+      record[8] = static_cast<float>(offset / 65536);
+      record[9] = static_cast<float>(offset % 65536);
+
+      const GLuint count =
+        glBatchElement->NextIndex[primType] > glBatchElement->StartIndex[primType]
+        ? glBatchElement->NextIndex[primType] - glBatchElement->StartIndex[primType]
+        : 0;
+      for (int pass = 0; pass < 2; ++pass)
+      {
+        const bool draw = count > 0 && drawInPass[pass];
+        GLuint* command =
+          &commands[((pass * numberOfTypes + primType) * numberOfBlocks + block) * 5];
+        command[0] = count;
+        command[1] = draw ? 1 : 0;
+        command[2] = glBatchElement->StartIndex[primType];
+        command[3] = 0;
+        command[4] = static_cast<GLuint>(instance);
+        this->IndirectDrawCounts[pass][primType] += draw ? 1 : 0;
+      }
     }
+    ++block;
+  }
+
+  // only upload what changed, which is usually nothing
+  if (attributes != this->IndirectAttributes)
+  {
+    this->IndirectAttributes.swap(attributes);
+    this->IndirectAttributeBuffer->Upload(
+      this->IndirectAttributes, vtkOpenGLBufferObject::ArrayBuffer);
+  }
+  if (commands != this->IndirectCommands)
+  {
+    this->IndirectCommands.swap(commands);
+    this->IndirectCommandBuffer->Upload(
+      this->IndirectCommands, vtkOpenGLBufferObject::DrawIndirectBuffer);
+    this->IndirectCommandBuffer->Release();
   }
 }
 
+//------------------------------------------------------------------------------
+bool vtkOpenGLBatchedPolyDataMapper::DrawIndirect(
+  vtkActor* actor, int primType, vtkOpenGLHelper& CellBO, GLenum mode)
+{
+  vtkShaderProgram* prog = CellBO.Program;
+  const char* names[3] = { "blockAmbientOpacity", "blockDiffuseOverrides",
+    "blockPrimitiveIDOffset" };
+  const int offsets[3] = { 0, 4, 8 };
+  const int sizes[3] = { 4, 4, 2 };
+  bool used[3];
+  for (int i = 0; i < 3; ++i)
+  {
+    used[i] = prog->IsAttributeUsed(names[i]);
+  }
+  // programs which do not need the block attributes, as in depth only
+  // passes, are drawn block by block
+  if (!this->UsingIndirectDraws || this->DrawingSelection || primType > PrimitiveTriStrips ||
+    !(used[0] || used[1] || used[2]))
+  {
+    return false;
+  }
+
+  const int pass = actor->IsRenderingTranslucentPolygonalGeometry() ? 1 : 0;
+  if (this->IndirectDrawCounts[pass][primType] == 0)
+  {
+    return true;
+  }
+
+#ifndef GL_ES_VERSION_3_0
+  for (int i = 0; i < 3; ++i)
+  {
+    if (used[i] &&
+      !CellBO.VAO->AddAttributeArrayWithDivisor(prog, this->IndirectAttributeBuffer, names[i],
+        offsets[i] * sizeof(float), 10 * sizeof(float), VTK_FLOAT, sizes[i], false, 1, false))
+    {
+      vtkErrorMacro(<< "Error setting '" << names[i] << "' in shader VAO.");
+      return true;
+    }
+  }
+
+  const size_t numberOfBlocks = this->VTKPolyDataToGLBatchElement.size();
+  const size_t firstCommand = (pass * (PrimitiveTriStrips + 1) + primType) * numberOfBlocks;
+  this->IndirectCommandBuffer->Bind();
+  glMultiDrawElementsIndirect(mode, GL_UNSIGNED_INT,
+    reinterpret_cast<const GLvoid*>(firstCommand * 5 * sizeof(GLuint)),
+    static_cast<GLsizei>(numberOfBlocks), 0);
+  this->IndirectCommandBuffer->Release();
+#else
+  (void)mode;
+#endif
+  return true;
+}
+
 //------------------------------------------------------------------------------
 void vtkOpenGLBatchedPolyDataMapper::UpdateShaders(
   vtkOpenGLHelper& cellBO, vtkRenderer* renderer, vtkActor* actor)
@@ -817,13 +1303,20 @@ void vtkOpenGLBatchedPolyDataMapper::UpdateShaders(
 void vtkOpenGLBatchedPolyDataMapper::ReplaceShaderColor(
   std::map<vtkShader::Type, vtkShader*> shaders, vtkRenderer* renderer, vtkActor* actor)
 {
+  // with multi draw indirect calls the block attributes come from instanced
+  // arrays, which geometry shaders would have to pass through
+  const bool indirect = this->UsingIndirectDraws && !this->DrawingSelection &&
+    !this->DrawingVertices && shaders[vtkShader::Geometry]->GetSource().empty();
+
   if (!this->CurrentSelector)
   {
     std::string FSSource = shaders[vtkShader::Fragment]->GetSource();
 
     vtkShaderProgram::Substitute(FSSource, "//VTK::Color::Dec",
-      "uniform bool OverridesColor;\n"
-      "//VTK::Color::Dec",
+      indirect ? "#define OverridesColor (blockDiffuseOverridesVSOutput.a != 0.0)\n"
+                 "//VTK::Color::Dec"
+               : "uniform bool OverridesColor;\n"
+                 "//VTK::Color::Dec",
       false);
 
     vtkShaderProgram::Substitute(FSSource, "//VTK::Color::Impl",
@@ -836,7 +1329,48 @@ void vtkOpenGLBatchedPolyDataMapper::ReplaceShaderColor(
     shaders[vtkShader::Fragment]->SetSource(FSSource);
   }
 
+  if (indirect)
+  {
+    std::string VSSource = shaders[vtkShader::Vertex]->GetSource();
+    vtkShaderProgram::Substitute(VSSource, "//VTK::Color::Dec",
+      "in vec4 blockAmbientOpacity;\n"
+      "in vec4 blockDiffuseOverrides;\n"
+      "in vec2 blockPrimitiveIDOffset;\n"
+      "flat out vec4 blockAmbientOpacityVSOutput;\n"
+      "flat out vec4 blockDiffuseOverridesVSOutput;\n"
+      "flat out int blockPrimitiveIDOffsetVSOutput;\n"
+      "//VTK::Color::Dec",
+      false);
+    vtkShaderProgram::Substitute(VSSource, "//VTK::Color::Impl",
+      "blockAmbientOpacityVSOutput = blockAmbientOpacity;\n"
+      "  blockDiffuseOverridesVSOutput = blockDiffuseOverrides;\n"
+      "  blockPrimitiveIDOffsetVSOutput =\n"
+      "    int(blockPrimitiveIDOffset.x) * 65536 + int(blockPrimitiveIDOffset.y);\n"
+      "  //VTK::Color::Impl",
+      false);
+    shaders[vtkShader::Vertex]->SetSource(VSSource);
+  }
+
   this->Superclass::ReplaceShaderColor(shaders, renderer, actor);
+
+  if (indirect)
+  {
+    // the block values replace the uniforms set for each block
+    std::string FSSource = shaders[vtkShader::Fragment]->GetSource();
+    vtkShaderProgram::Substitute(FSSource, "uniform int PrimitiveIDOffset;",
+      "flat in vec4 blockAmbientOpacityVSOutput;\n"
+      "flat in vec4 blockDiffuseOverridesVSOutput;\n"
+      "flat in int blockPrimitiveIDOffsetVSOutput;\n"
+      "#define PrimitiveIDOffset blockPrimitiveIDOffsetVSOutput",
+      false);
+    vtkShaderProgram::Substitute(FSSource, "uniform float opacityUniform;",
+      "#define opacityUniform blockAmbientOpacityVSOutput.a //", false);
+    vtkShaderProgram::Substitute(FSSource, "uniform vec3 ambientColorUniform;",
+      "#define ambientColorUniform blockAmbientOpacityVSOutput.rgb //", false);
+    vtkShaderProgram::Substitute(FSSource, "uniform vec3 diffuseColorUniform;",
+      "#define diffuseColorUniform blockDiffuseOverridesVSOutput.rgb //", false);
+    shaders[vtkShader::Fragment]->SetSource(FSSource);
+  }
 }
 
 //------------------------------------------------------------------------------
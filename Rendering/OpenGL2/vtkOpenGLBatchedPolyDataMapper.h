@@ -26,9 +26,11 @@
 
 #include <cstdint> // for std::uintptr_t
 #include <memory>  // for shared_ptr
+#include <vector>  // for ivar
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkCompositePolyDataMapper;
+class vtkOpenGLBufferObject;
 class vtkPolyData;
 
 class VTKRENDERINGOPENGL2_EXPORT vtkOpenGLBatchedPolyDataMapper : public vtkOpenGLPolyDataMapper
@@ -72,6 +74,18 @@ public:
   virtual void ProcessCompositePixelBuffers(vtkHardwareSelector* sel, vtkProp* prop,
     GLBatchElement* glBatchElement, std::vector<unsigned int>& mypixels);
 
+  /**
+   * Release any graphics resources that are being consumed by this mapper.
+   */
+  void ReleaseGraphicsResources(vtkWindow* window) override;
+
+  /**
+   * Returns true when the current context can draw the blocks with a single
+   * glMultiDrawElementsIndirect call per primitive type. Requires a current
+   * OpenGL context.
+   */
+  static bool IsMultiDrawIndirectSupported();
+
 protected:
   vtkOpenGLBatchedPolyDataMapper();
   ~vtkOpenGLBatchedPolyDataMapper() override;
@@ -91,6 +105,42 @@ protected:
   virtual void SetShaderValues(
     vtkShaderProgram* prog, GLBatchElement* glBatchElement, size_t primOffset);
 
+  /**
+   * Computes the colors and opacity of the polydata in the glBatchElement.
+   * Returns true when the NaN color is used, in which case the block does
+   * not override the scalar colors.
+   */
+  bool GetBatchElementColors(GLBatchElement* glBatchElement, float ambientColor[3],
+    float diffuseColor[3], float& opacity);
+
+  /**
+   * Updates the per block attributes and the draw commands of the multi draw
+   * indirect path. Only the buffers whose contents changed are uploaded.
+   */
+  void UpdateIndirectBuffers(vtkActor* actor);
+
+  /**
+   * Draws every block of a primitive type with one multi draw indirect call.
+   * Returns false when the program must draw the blocks one by one.
+   */
+  bool DrawIndirect(vtkActor* actor, int primType, vtkOpenGLHelper& CellBO, GLenum mode);
+
+  /**
+   * Marks the blocks outside of the view frustum, or hidden in the previous
+   * frame, as culled so that they are not drawn.
+   */
+  void CullBatchElements(vtkRenderer* renderer, vtkActor* actor);
+
+  ///@{
+  /**
+   * Occlusion culling. The bounding box of every block is drawn inside an
+   * occlusion query after the opaque geometry, and the results are read back
+   * at the start of the next frame if they are available.
+   */
+  void ReadOcclusionQueries();
+  void IssueOcclusionQueries(vtkRenderer* renderer, vtkActor* actor);
+  ///@}
+
   /**
    * Make sure appropriate shaders are defined, compiled and bound.  This method
    * orchistrates the process, much of the work is done in other methods
@@ -146,6 +196,23 @@ protected:
   std::vector<std::vector<unsigned int>> PickPixels;
   // cached array map
   std::map<vtkAbstractArray*, vtkDataArray*> ColorArrayMap;
+  // Whether the blocks are drawn with multi draw indirect calls
+  bool UsingIndirectDraws = false;
+  // Per block attributes, read as instanced arrays, and the draw commands
+  vtkNew<vtkOpenGLBufferObject> IndirectAttributeBuffer;
+  vtkNew<vtkOpenGLBufferObject> IndirectCommandBuffer;
+  std::vector<float> IndirectAttributes;
+  std::vector<GLuint> IndirectCommands;
+  // Number of commands drawing something, per opaque/translucent pass
+  unsigned int IndirectDrawCounts[2][PrimitiveTriStrips + 1];
+  // Occlusion queries, one per block, with the key of the block each one
+  // tested or 0 when the block was not tested
+  std::vector<GLuint> OcclusionQueries;
+  std::vector<std::uintptr_t> OcclusionQueryKeys;
+  // Bounding boxes of the blocks, drawn by the occlusion queries
+  vtkOpenGLHelper OcclusionBoxes;
+  vtkNew<vtkOpenGLBufferObject> OcclusionBoxBuffer;
+  std::vector<float> OcclusionBoxVertices;
 
 private:
   vtkOpenGLBatchedPolyDataMapper(const vtkOpenGLBatchedPolyDataMapper&) = delete;
@@ -2,9 +2,13 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkOpenGLBufferObject.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 
 #include "vtk_glew.h"
 
+#include <algorithm>
+#include <cstring>
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkOpenGLBufferObject);
 
@@ -16,6 +20,12 @@ inline GLenum convertType(vtkOpenGLBufferObject::ObjectType type)
   {
     case vtkOpenGLBufferObject::ElementArrayBuffer:
       return GL_ELEMENT_ARRAY_BUFFER;
+    case vtkOpenGLBufferObject::DrawIndirectBuffer:
+#if defined(GL_DRAW_INDIRECT_BUFFER)
+      return GL_DRAW_INDIRECT_BUFFER;
+#else
+      return GL_ARRAY_BUFFER;
+#endif
     case vtkOpenGLBufferObject::TextureBuffer:
 #if defined(GL_TEXTURE_BUFFER)
       return GL_TEXTURE_BUFFER;
@@ -67,6 +77,21 @@ struct vtkOpenGLBufferObject::Private
   GLenum Usage;
   GLuint Handle;
   size_t Size;
+
+  // Double buffered persistently mapped storage. Handle is one of the two
+  // storages while it is in use. The fence of a storage is set when uploads
+  // move to the other one, after the last draw reading it.
+  bool PersistentMapping = false;
+  int ActiveStorage = 0;
+  GLuint Storage[2] = { 0, 0 };
+  size_t StorageSize[2] = { 0, 0 };
+  void* StoragePointer[2] = { nullptr, nullptr };
+  GLsync StorageFence[2] = { nullptr, nullptr };
+
+  bool UsesPersistentStorage() const
+  {
+    return this->Handle != 0 && this->Handle == this->Storage[this->ActiveStorage];
+  }
 };
 
 //------------------------------------------------------------------------------
@@ -80,6 +105,7 @@ vtkOpenGLBufferObject::vtkOpenGLBufferObject()
 //------------------------------------------------------------------------------
 vtkOpenGLBufferObject::~vtkOpenGLBufferObject()
 {
+  this->ReleasePersistentStorage();
   if (this->Internal->Handle != 0)
   {
     glDeleteBuffers(1, &this->Internal->Handle);
@@ -90,6 +116,7 @@ vtkOpenGLBufferObject::~vtkOpenGLBufferObject()
 //------------------------------------------------------------------------------
 void vtkOpenGLBufferObject::ReleaseGraphicsResources()
 {
+  this->ReleasePersistentStorage();
   if (this->Internal->Handle != 0)
   {
     glBindBuffer(this->Internal->Type, 0);
@@ -115,6 +142,12 @@ vtkOpenGLBufferObject::ObjectType vtkOpenGLBufferObject::GetType() const
   {
     return vtkOpenGLBufferObject::ElementArrayBuffer;
   }
+#if defined(GL_DRAW_INDIRECT_BUFFER)
+  if (this->Internal->Type == GL_DRAW_INDIRECT_BUFFER)
+  {
+    return vtkOpenGLBufferObject::DrawIndirectBuffer;
+  }
+#endif
   else
   {
     return vtkOpenGLBufferObject::TextureBuffer;
@@ -163,6 +196,8 @@ int vtkOpenGLBufferObject::GetHandle() const
 //------------------------------------------------------------------------------
 bool vtkOpenGLBufferObject::Allocate(size_t size, ObjectType objectType, ObjectUsage objectUsage)
 {
+  // the persistent storage cannot be reallocated
+  this->ReleasePersistentStorage();
   const bool generated = this->GenerateBuffer(objectType);
   if (!generated)
   {
@@ -238,10 +273,170 @@ bool vtkOpenGLBufferObject::GenerateBuffer(vtkOpenGLBufferObject::ObjectType obj
   return (this->Internal->Type == objectTypeGL);
 }
 
+//------------------------------------------------------------------------------
+bool vtkOpenGLBufferObject::IsPersistentMappingSupported()
+{
+#if defined(GL_ES_VERSION_3_0) || !defined(GL_MAP_PERSISTENT_BIT)
+  return false;
+#else
+  return GLEW_VERSION_4_4 || GLEW_ARB_buffer_storage;
+#endif
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLBufferObject::SetPersistentMapping(bool value)
+{
+  this->Internal->PersistentMapping = value;
+}
+
+//------------------------------------------------------------------------------
+bool vtkOpenGLBufferObject::GetPersistentMapping() const
+{
+  return this->Internal->PersistentMapping;
+}
+
+//------------------------------------------------------------------------------
+void* vtkOpenGLBufferObject::BeginPersistentUpload(size_t size, ObjectType objectType)
+{
+#if defined(GL_ES_VERSION_3_0) || !defined(GL_MAP_PERSISTENT_BIT)
+  (void)size;
+  (void)objectType;
+  return nullptr;
+#else
+  Private& internal = *this->Internal;
+  const GLenum type = convertType(objectType);
+  if (!internal.PersistentMapping || size == 0 ||
+    !vtkOpenGLBufferObject::IsPersistentMappingSupported())
+  {
+    return nullptr;
+  }
+  if (internal.Handle != 0 && internal.Type != type)
+  {
+    this->Error = "Trying to upload array buffer to incompatible buffer.";
+    return nullptr;
+  }
+
+  if (internal.UsesPersistentStorage())
+  {
+    // draws issued so far read the active storage
+    GLsync& fence = internal.StorageFence[internal.ActiveStorage];
+    if (fence)
+    {
+      glDeleteSync(fence);
+    }
+    fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  }
+  else if (internal.Handle != 0)
+  {
+    // replace a buffer allocated with glBufferData
+    glBindBuffer(type, 0);
+    glDeleteBuffers(1, &internal.Handle);
+    internal.Handle = 0;
+  }
+
+  const int slot = 1 - internal.ActiveStorage;
+  GLsync& fence = internal.StorageFence[slot];
+  if (fence)
+  {
+    while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000) == GL_TIMEOUT_EXPIRED)
+    {
+    }
+    glDeleteSync(fence);
+    fence = nullptr;
+  }
+
+  if (internal.StorageSize[slot] < size)
+  {
+    if (internal.Storage[slot])
+    {
+      glBindBuffer(type, internal.Storage[slot]);
+      glUnmapBuffer(type);
+      glDeleteBuffers(1, &internal.Storage[slot]);
+    }
+    // leave room for a mesh growing from one step to the next
+    const size_t capacity = size + size / 4;
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glGenBuffers(1, &internal.Storage[slot]);
+    glBindBuffer(type, internal.Storage[slot]);
+    glBufferStorage(type, static_cast<GLsizeiptr>(capacity), nullptr,
+      flags | GL_DYNAMIC_STORAGE_BIT);
+    internal.StoragePointer[slot] =
+      glMapBufferRange(type, 0, static_cast<GLsizeiptr>(capacity), flags);
+    internal.StorageSize[slot] = capacity;
+    glBindBuffer(type, 0);
+    if (!internal.StoragePointer[slot])
+    {
+      glDeleteBuffers(1, &internal.Storage[slot]);
+      internal.Storage[slot] = 0;
+      internal.StorageSize[slot] = 0;
+      this->Error = "Could not map the persistent buffer storage.";
+      return nullptr;
+    }
+  }
+
+  internal.ActiveStorage = slot;
+  internal.Handle = internal.Storage[slot];
+  internal.Type = type;
+  internal.Size = size;
+  // vertex array objects have to bind the new handle
+  this->Modified();
+  return internal.StoragePointer[slot];
+#endif
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLBufferObject::EndPersistentUpload()
+{
+  // the mapping is coherent, the writes are visible to the next draws
+  this->Dirty = false;
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLBufferObject::ReleasePersistentStorage()
+{
+#if !defined(GL_ES_VERSION_3_0) && defined(GL_MAP_PERSISTENT_BIT)
+  Private& internal = *this->Internal;
+  if (internal.UsesPersistentStorage())
+  {
+    internal.Handle = 0;
+  }
+  for (int i = 0; i < 2; ++i)
+  {
+    if (internal.StorageFence[i])
+    {
+      glDeleteSync(internal.StorageFence[i]);
+      internal.StorageFence[i] = nullptr;
+    }
+    if (internal.Storage[i])
+    {
+      // deleting a buffer also unmaps it
+      glDeleteBuffers(1, &internal.Storage[i]);
+      internal.Storage[i] = 0;
+    }
+    internal.StorageSize[i] = 0;
+    internal.StoragePointer[i] = nullptr;
+  }
+#endif
+}
+
 //------------------------------------------------------------------------------
 bool vtkOpenGLBufferObject::UploadInternal(
   const void* buffer, size_t size, vtkOpenGLBufferObject::ObjectType objectType)
 {
+  if (void* mapped = this->BeginPersistentUpload(size, objectType))
+  {
+    // copy large buffers from several threads
+    const size_t blockSize = 1 << 20;
+    const vtkIdType numberOfBlocks = static_cast<vtkIdType>((size + blockSize - 1) / blockSize);
+    vtkSMPTools::For(0, numberOfBlocks, [&](vtkIdType first, vtkIdType last) {
+      const size_t begin = static_cast<size_t>(first) * blockSize;
+      const size_t end = std::min(size, static_cast<size_t>(last) * blockSize);
+      std::memcpy(static_cast<char*>(mapped) + begin, static_cast<const char*>(buffer) + begin,
+        end - begin);
+    });
+    this->EndPersistentUpload();
+    return true;
+  }
   this->Allocate(size, objectType, this->GetUsage());
   return this->UploadRangeInternal(buffer, 0, size, objectType);
 }
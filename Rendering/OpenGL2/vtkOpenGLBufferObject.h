@@ -32,7 +32,8 @@ public:
   {
     ArrayBuffer,
     ElementArrayBuffer,
-    TextureBuffer
+    TextureBuffer,
+    DrawIndirectBuffer
   };
   enum ObjectUsage
   {
@@ -98,6 +99,34 @@ public:
    */
   size_t GetSize();
 
+  /**
+   * Returns true when the current context supports persistently mapped
+   * buffers (OpenGL 4.4 or ARB_buffer_storage).
+   */
+  static bool IsPersistentMappingSupported();
+
+  ///@{
+  /**
+   * When on and supported, a full upload writes into one of two persistently
+   * mapped buffers, alternating between them, instead of reallocating the
+   * buffer with glBufferData. The copy is split across the vtkSMPTools
+   * threads, and the render thread only waits when the GPU still reads the
+   * buffer being written, which was last drawn two uploads ago. The handle
+   * changes with every full upload. Off by default.
+   */
+  void SetPersistentMapping(bool value);
+  bool GetPersistentMapping() const;
+  ///@}
+
+  /**
+   * Returns a pointer where `size` bytes of new content can be written,
+   * possibly from several threads, before EndPersistentUpload is called.
+   * Returns nullptr when persistent mapping is off or not supported, in
+   * which case the content has to be uploaded the usual way.
+   */
+  void* BeginPersistentUpload(size_t size, ObjectType type);
+  void EndPersistentUpload();
+
   /**
    * Download data from the buffer object.
    */
@@ -144,6 +173,7 @@ protected:
 
 private:
   bool DownloadRangeInternal(void* buffer, ptrdiff_t offset, size_t size);
+  void ReleasePersistentStorage();
 
   vtkOpenGLBufferObject(const vtkOpenGLBufferObject&) = delete;
   void operator=(const vtkOpenGLBufferObject&) = delete;
@@ -53,6 +53,11 @@ public:
 
     // stores the mapping from vtk cells to gl_PrimitiveId
     vtkNew<vtkOpenGLCellToVTKCellMap> CellCellMap;
+
+    // whether the block is skipped in the current frame, and whether its
+    // bounding box was hidden in the previous one
+    bool Culled = false;
+    bool Occluded = false;
   };
 
   ///@{
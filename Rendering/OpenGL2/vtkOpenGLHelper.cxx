@@ -14,6 +14,7 @@ vtkOpenGLHelper::vtkOpenGLHelper()
   this->IBO = vtkOpenGLIndexBufferObject::New();
   this->VAO = vtkOpenGLVertexArrayObject::New();
   this->ShaderChangeValue = 0;
+  this->ProgramPending = false;
 }
 
 vtkOpenGLHelper::~vtkOpenGLHelper()
@@ -38,6 +39,7 @@ void vtkOpenGLHelper::ReleaseGraphicsResources(vtkWindow* win)
     // responsible for creation and deletion.
     this->Program = nullptr;
   }
+  this->ProgramPending = false;
   this->IBO->ReleaseGraphicsResources();
   this->VAO->ReleaseGraphicsResources();
 }
@@ -26,6 +26,8 @@ public:
   vtkTimeStamp AttributeUpdateTime;
   int PrimitiveType;
   unsigned int ShaderChangeValue;
+  // the new program of the helper is still compiled in the background
+  bool ProgramPending;
 
   vtkOpenGLIndexBufferObject* IBO;
 
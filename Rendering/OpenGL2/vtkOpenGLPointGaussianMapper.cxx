@@ -5,6 +5,7 @@
 #include "vtkOpenGLHelper.h"
 
 #include "vtkBoundingBox.h"
+#include "vtkCamera.h"
 #include "vtkCellArray.h"
 #include "vtkCommand.h"
 #include "vtkCompositeDataIterator.h"
@@ -32,6 +33,7 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkProperty.h"
+#include "vtkSMPTools.h"
 #include "vtkShaderProgram.h"
 #include "vtkUnsignedCharArray.h"
 
@@ -41,7 +43,11 @@
 
 #include "vtk_glew.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <numeric>
+#include <utility>
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkOpenGLPointGaussianMapperHelper : public vtkOpenGLPolyDataMapper
@@ -65,6 +71,12 @@ public:
   bool UsingPoints;
   double BoundScale;
 
+  // level of detail: number of point ids up to each level, and bounds and
+  // cell size of the first level
+  std::vector<vtkIdType> LODLevelCounts;
+  double LODBounds[6];
+  double LODCellSize;
+
   // called by our Owner skips some stuff
   void GaussianRender(vtkRenderer* ren, vtkActor* act);
 
@@ -102,6 +114,10 @@ protected:
 
   void RenderPieceDraw(vtkRenderer* ren, vtkActor* act) override;
 
+  // Description:
+  // Number of point ids to draw for the level of detail of the current view
+  vtkIdType GetLODIndexCount(vtkRenderer* ren, vtkActor* act);
+
   // Description:
   // Does the shader source need to be recomputed
   bool GetNeedToRebuildShaders(vtkOpenGLHelper& cellBO, vtkRenderer* ren, vtkActor* act) override;
@@ -127,6 +143,8 @@ vtkOpenGLPointGaussianMapperHelper::vtkOpenGLPointGaussianMapperHelper()
   this->ScaleScale = 1.0;
   this->OpacityOffset = 0.0;
   this->ScaleOffset = 0.0;
+  vtkMath::UninitializeBounds(this->LODBounds);
+  this->LODCellSize = 0.0;
 }
 
 //------------------------------------------------------------------------------
@@ -439,8 +457,142 @@ void vtkOpenGLPointGaussianMapperHelperSizes(vtkFloatArray* scales, PointDataTyp
   }
 }
 
+
+// Levels of detail go up to a grid of 2^20 cells per axis, so that the cell
+// codes of the finest level fit in 60 bits.
+constexpr int LODMaxLevel = 20;
+
+// Interleave the bits of the cell indices of a point at the finest level.
+std::uint64_t ComputeLODCellCode(const unsigned int ijk[3])
+{
+  std::uint64_t code = 0;
+  for (int bit = LODMaxLevel - 1; bit >= 0; --bit)
+  {
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      code = (code << 1) | ((ijk[axis] >> bit) & 1u);
+    }
+  }
+  return code;
+}
+
+// Sort the point ids into nested levels of detail. The ids are sorted by cell
+// code, so that the points of each cell of each level are contiguous, and the
+// first point of each cell belongs to the level of this cell. A point thus
+// belongs to the coarsest level at which its cell differs from the one of the
+// previous point, and each level adds one point to each occupied cell that has
+// none yet. The ids are then stably grouped by level, and levelCounts gets the
+// number of ids up to each level.
+void ComputeLODOrder(vtkPoints* points, const double bounds[6], double cellSize,
+  std::vector<unsigned int>& ids, std::vector<vtkIdType>& levelCounts)
+{
+  const vtkIdType numIds = static_cast<vtkIdType>(ids.size());
+  std::vector<std::pair<std::uint64_t, unsigned int>> codes(ids.size());
+  const double numCells = static_cast<double>(1u << LODMaxLevel);
+  vtkSMPTools::For(0, numIds, [&](vtkIdType begin, vtkIdType end) {
+    double x[3];
+    unsigned int ijk[3];
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      points->GetPoint(ids[i], x);
+      for (int axis = 0; axis < 3; ++axis)
+      {
+        const double t = (x[axis] - bounds[2 * axis]) / cellSize * numCells;
+        ijk[axis] = static_cast<unsigned int>(std::min(std::max(t, 0.0), numCells - 1.0));
+      }
+      codes[i] = std::make_pair(ComputeLODCellCode(ijk), ids[i]);
+    }
+  });
+  vtkSMPTools::Sort(codes.begin(), codes.end());
+
+  // the points with the same code as the previous point go to an extra level
+  std::vector<unsigned char> levels(ids.size());
+  vtkSMPTools::For(0, numIds, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      const std::uint64_t diff = i > 0 ? codes[i - 1].first ^ codes[i].first : 0;
+      int level = i > 0 ? LODMaxLevel + 1 : 0;
+      if (diff)
+      {
+        int highestBit = 3 * LODMaxLevel - 1;
+        while (!((diff >> highestBit) & 1u))
+        {
+          --highestBit;
+        }
+        level = LODMaxLevel - highestBit / 3;
+      }
+      levels[i] = static_cast<unsigned char>(level);
+    }
+  });
+
+  levelCounts.assign(LODMaxLevel + 2, 0);
+  for (unsigned char level : levels)
+  {
+    ++levelCounts[level];
+  }
+  std::partial_sum(levelCounts.begin(), levelCounts.end(), levelCounts.begin());
+  std::vector<vtkIdType> offsets(levelCounts.size(), 0);
+  std::copy(levelCounts.begin(), levelCounts.end() - 1, offsets.begin() + 1);
+  for (vtkIdType i = 0; i < numIds; ++i)
+  {
+    ids[offsets[levels[i]]++] = codes[i].second;
+  }
+}
+
 } // anonymous namespace
 
+//------------------------------------------------------------------------------
+vtkIdType vtkOpenGLPointGaussianMapperHelper::GetLODIndexCount(vtkRenderer* ren, vtkActor* act)
+{
+  const vtkIdType indexCount = this->Primitives[PrimitivePoints].IBO->IndexCount;
+  if (this->LODLevelCounts.empty())
+  {
+    return indexCount;
+  }
+
+  // size of a pixel in world coordinates at the nearest point of the points
+  int width, height, lowerLeft[2];
+  ren->GetTiledSizeAndOrigin(&width, &height, lowerLeft, lowerLeft + 1);
+  vtkCamera* camera = ren->GetActiveCamera();
+  double pixelSize;
+  if (camera->GetParallelProjection())
+  {
+    pixelSize = 2.0 * camera->GetParallelScale() / std::max(height, 1);
+  }
+  else
+  {
+    vtkBoundingBox worldBox(act->GetBounds());
+    double center[3];
+    worldBox.GetCenter(center);
+    const double distance =
+      std::max(std::sqrt(vtkMath::Distance2BetweenPoints(camera->GetPosition(), center)) -
+          0.5 * worldBox.GetDiagonalLength(),
+        camera->GetClippingRange()[0]);
+    pixelSize = 2.0 * distance *
+      std::tan(vtkMath::RadiansFromDegrees(0.5 * camera->GetViewAngle())) / std::max(height, 1);
+  }
+
+  // account for the scaling of the actor
+  const double modelDiagonal = vtkBoundingBox(this->LODBounds).GetDiagonalLength();
+  const double worldDiagonal = vtkBoundingBox(act->GetBounds()).GetDiagonalLength();
+  double cellSize = this->LODCellSize * (modelDiagonal > 0.0 ? worldDiagonal / modelDiagonal : 1.0);
+
+  // draw the levels up to the first one with small enough cells
+  const double maxCellSize = this->Owner->GetLODPixelSpacing() * pixelSize;
+  std::size_t level = 0;
+  while (level + 1 < this->LODLevelCounts.size() && cellSize > maxCellSize)
+  {
+    cellSize *= 0.5;
+    ++level;
+  }
+  vtkIdType count = std::min(this->LODLevelCounts[level], indexCount);
+  if (this->Owner->GetPointBudget() > 0)
+  {
+    count = std::min(count, this->Owner->GetPointBudget());
+  }
+  return count;
+}
+
 //------------------------------------------------------------------------------
 bool vtkOpenGLPointGaussianMapperHelper::GetNeedToRebuildBufferObjects(
   vtkRenderer* vtkNotUsed(ren), vtkActor* act)
@@ -556,7 +708,37 @@ void vtkOpenGLPointGaussianMapperHelper::BuildBufferObjects(
     this->Primitives[i].IBO->IndexCount = 0;
   }
 
-  if (poly->GetVerts()->GetNumberOfCells() > 0)
+  this->LODLevelCounts.clear();
+  if (this->Owner->GetLevelOfDetail() && splatCount > 0)
+  {
+    std::vector<unsigned int> verts(splatCount);
+    if (poly->GetVerts()->GetNumberOfCells() > 0)
+    {
+      vtkDataArray* connectivity = poly->GetVerts()->GetConnectivityArray();
+      for (int i = 0; i < splatCount; ++i)
+      {
+        verts[i] = static_cast<unsigned int>(connectivity->GetComponent(i, 0));
+      }
+    }
+    else
+    {
+      std::iota(verts.begin(), verts.end(), 0);
+    }
+    // the cells of the first level are cubes enclosing the points
+    poly->GetPoints()->GetBounds(this->LODBounds);
+    this->LODCellSize = std::max({ this->LODBounds[1] - this->LODBounds[0],
+      this->LODBounds[3] - this->LODBounds[2], this->LODBounds[5] - this->LODBounds[4] });
+    if (this->LODCellSize <= 0.0)
+    {
+      this->LODCellSize = 1.0;
+    }
+    ComputeLODOrder(
+      poly->GetPoints(), this->LODBounds, this->LODCellSize, verts, this->LODLevelCounts);
+    this->Primitives[PrimitivePoints].IBO->Upload(
+      verts, vtkOpenGLIndexBufferObject::ElementArrayBuffer);
+    this->Primitives[PrimitivePoints].IBO->IndexCount = splatCount;
+  }
+  else if (poly->GetVerts()->GetNumberOfCells() > 0)
   {
     this->Primitives[PrimitivePoints].IBO->CreatePointIndexBuffer(poly->GetVerts());
   }
@@ -580,11 +762,14 @@ void vtkOpenGLPointGaussianMapperHelper::RenderPieceDraw(vtkRenderer* ren, vtkAc
   if (numVerts)
   {
     this->UpdateShaders(this->Primitives[PrimitivePoints], ren, actor);
+    if (!this->Primitives[PrimitivePoints].Program)
+    {
+      return;
+    }
 
     this->Primitives[PrimitivePoints].IBO->Bind();
     glDrawRangeElements(GL_POINTS, 0, static_cast<GLuint>(numVerts - 1),
-      static_cast<GLsizei>(this->Primitives[PrimitivePoints].IBO->IndexCount), GL_UNSIGNED_INT,
-      nullptr);
+      static_cast<GLsizei>(this->GetLODIndexCount(ren, actor)), GL_UNSIGNED_INT, nullptr);
     this->Primitives[PrimitivePoints].IBO->Release();
   }
 }
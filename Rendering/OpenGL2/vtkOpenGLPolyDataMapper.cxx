@@ -2,11 +2,13 @@
 // SPDX-License-Identifier: BSD-3-Clause
 
 #include "vtkOpenGLPolyDataMapper.h"
+#include "vtkArrayDispatch.h"
 
 #include "vtkCamera.h"
 #include "vtkCellArray.h"
 #include "vtkCellData.h"
 #include "vtkCommand.h"
+#include "vtkDataArrayRange.h"
 #include "vtkFloatArray.h"
 #include "vtkHardwareSelector.h"
 #include "vtkIdTypeArray.h"
@@ -48,6 +50,8 @@
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
 #include "vtkProperty.h"
+#include "vtkRenderTimerLog.h"
+#include "vtkSMPTools.h"
 #include "vtkScalarsToColors.h"
 #include "vtkSelection.h"
 #include "vtkSelectionNode.h"
@@ -65,6 +69,9 @@
 #include "vtkPolyDataWideLineGS.h"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
 #include <sstream>
 
 //------------------------------------------------------------------------------
@@ -495,6 +502,240 @@ std::vector<texinfo> vtkOpenGLPolyDataMapper::GetTextures(vtkActor* actor)
   return res;
 }
 
+//------------------------------------------------------------------------------
+struct vtkOpenGLPolyDataMapper::MeshletsWorker
+{
+  const std::vector<unsigned int>& Indices;
+  std::vector<vtkOpenGLPolyDataMapper::Meshlet>& Meshlets;
+  size_t MeshletSize;
+
+  MeshletsWorker(const std::vector<unsigned int>& indices,
+    std::vector<vtkOpenGLPolyDataMapper::Meshlet>& meshlets, size_t meshletSize)
+    : Indices(indices)
+    , Meshlets(meshlets)
+    , MeshletSize(meshletSize)
+  {
+  }
+
+  template <typename PointArray>
+  void operator()(PointArray* array)
+  {
+    const auto points = vtk::DataArrayTupleRange<3>(array);
+    const size_t numberOfTriangles = this->Indices.size() / 3;
+    vtkSMPTools::For(0, static_cast<vtkIdType>(this->Meshlets.size()),
+      [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType m = begin; m < end; ++m)
+        {
+          vtkOpenGLPolyDataMapper::Meshlet& meshlet = this->Meshlets[m];
+          const size_t first = static_cast<size_t>(m) * this->MeshletSize;
+          const size_t last = std::min(first + this->MeshletSize, numberOfTriangles);
+          meshlet.FirstIndex = static_cast<unsigned int>(3 * first);
+          meshlet.IndexCount = static_cast<unsigned int>(3 * (last - first));
+
+          // bounding sphere around the center of the bounding box
+          double bounds[6] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MIN, VTK_DOUBLE_MAX, VTK_DOUBLE_MIN,
+            VTK_DOUBLE_MAX, VTK_DOUBLE_MIN };
+          for (size_t i = 3 * first; i < 3 * last; ++i)
+          {
+            const auto point = points[this->Indices[i]];
+            for (int c = 0; c < 3; ++c)
+            {
+              bounds[2 * c] = std::min(bounds[2 * c], static_cast<double>(point[c]));
+              bounds[2 * c + 1] = std::max(bounds[2 * c + 1], static_cast<double>(point[c]));
+            }
+          }
+          double radius2 = 0.0;
+          for (int c = 0; c < 3; ++c)
+          {
+            meshlet.Center[c] = 0.5 * (bounds[2 * c] + bounds[2 * c + 1]);
+          }
+          for (size_t i = 3 * first; i < 3 * last; ++i)
+          {
+            const auto point = points[this->Indices[i]];
+            const double p[3] = { static_cast<double>(point[0]), static_cast<double>(point[1]),
+              static_cast<double>(point[2]) };
+            radius2 = std::max(radius2, vtkMath::Distance2BetweenPoints(p, meshlet.Center));
+          }
+          meshlet.Radius = std::sqrt(radius2);
+
+          // cone around the triangle normals, as in meshoptimizer
+          std::vector<std::array<double, 3>> normals;
+          normals.reserve(last - first);
+          double axis[3] = { 0.0, 0.0, 0.0 };
+          for (size_t t = first; t < last; ++t)
+          {
+            double p[3][3];
+            for (int v = 0; v < 3; ++v)
+            {
+              const auto point = points[this->Indices[3 * t + v]];
+              for (int c = 0; c < 3; ++c)
+              {
+                p[v][c] = static_cast<double>(point[c]);
+              }
+            }
+            std::array<double, 3> normal;
+            const double e1[3] = { p[1][0] - p[0][0], p[1][1] - p[0][1], p[1][2] - p[0][2] };
+            const double e2[3] = { p[2][0] - p[0][0], p[2][1] - p[0][1], p[2][2] - p[0][2] };
+            vtkMath::Cross(e1, e2, normal.data());
+            if (vtkMath::Normalize(normal.data()) > 0.0)
+            {
+              vtkMath::Add(axis, normal.data(), axis);
+              normals.push_back(normal);
+            }
+          }
+          meshlet.ConeCutoff = 1.0;
+          if (vtkMath::Normalize(axis) > 0.0)
+          {
+            double minDot = 1.0;
+            for (const auto& normal : normals)
+            {
+              minDot = std::min(minDot, vtkMath::Dot(axis, normal.data()));
+            }
+            // wider than about 84 degrees the cone never culls anything
+            if (minDot > 0.1)
+            {
+              meshlet.ConeCutoff = std::sqrt(1.0 - minDot * minDot);
+            }
+          }
+          std::copy(axis, axis + 3, meshlet.ConeAxis);
+        }
+      });
+  }
+};
+
+//------------------------------------------------------------------------------
+void vtkOpenGLPolyDataMapper::BuildMeshlets(
+  const std::vector<unsigned int>& indices, vtkPoints* points)
+{
+  const size_t meshletSize = static_cast<size_t>(this->MeshletSize);
+  const size_t numberOfTriangles = indices.size() / 3;
+  this->Meshlets.resize((numberOfTriangles + meshletSize - 1) / meshletSize);
+  if (this->Meshlets.empty())
+  {
+    return;
+  }
+
+  MeshletsWorker worker(indices, this->Meshlets, meshletSize);
+  using Dispatcher = vtkArrayDispatch::DispatchByValueType<vtkArrayDispatch::Reals>;
+  if (!Dispatcher::Execute(points->GetData(), worker))
+  {
+    worker(points->GetData());
+  }
+}
+
+//------------------------------------------------------------------------------
+bool vtkOpenGLPolyDataMapper::DrawMeshlets(vtkRenderer* ren, vtkActor* actor, int mode)
+{
+#ifdef GL_ES_VERSION_3_0
+  (void)ren;
+  (void)actor;
+  (void)mode;
+  return false;
+#else
+  if (this->Meshlets.empty())
+  {
+    return false;
+  }
+
+  vtkCamera* camera = ren->GetActiveCamera();
+  double planes[24];
+  camera->GetFrustumPlanes(ren->GetTiledAspectRatio(), planes);
+  for (int p = 0; p < 6; ++p)
+  {
+    const double norm = vtkMath::Norm(planes + 4 * p);
+    for (int c = 0; norm > 0.0 && c < 4; ++c)
+    {
+      planes[4 * p + c] /= norm;
+    }
+  }
+
+  // spheres are moved to world coordinates, cones are only tested when the
+  // actor has no transform as the angles between normals are not preserved
+  vtkMatrix4x4* matrix = actor->GetIsIdentity() ? nullptr : actor->GetMatrix();
+  double scale = matrix ? 0.0 : 1.0;
+  for (int c = 0; matrix && c < 3; ++c)
+  {
+    const double column[3] = { matrix->GetElement(0, c), matrix->GetElement(1, c),
+      matrix->GetElement(2, c) };
+    scale = std::max(scale, vtkMath::Norm(column));
+  }
+  vtkProperty* prop = actor->GetProperty();
+  const bool coneCulling = !matrix && prop->GetBackfaceCulling() && !prop->GetFrontfaceCulling();
+  const bool parallel = camera->GetParallelProjection() != 0;
+  double position[3];
+  double direction[3];
+  camera->GetPosition(position);
+  camera->GetDirectionOfProjection(direction);
+
+  this->MeshletDrawCounts.clear();
+  this->MeshletDrawOffsets.clear();
+  unsigned int lastIndex = 0;
+  for (const auto& meshlet : this->Meshlets)
+  {
+    double center[4] = { meshlet.Center[0], meshlet.Center[1], meshlet.Center[2], 1.0 };
+    if (matrix)
+    {
+      matrix->MultiplyPoint(center, center);
+    }
+    const double radius = meshlet.Radius * scale;
+    bool visible = true;
+    for (int p = 0; p < 6 && visible; ++p)
+    {
+      visible = vtkMath::Dot(planes + 4 * p, center) + planes[4 * p + 3] >= -radius;
+    }
+    if (visible && coneCulling && meshlet.ConeCutoff < 1.0)
+    {
+      if (parallel)
+      {
+        visible = vtkMath::Dot(direction, meshlet.ConeAxis) < meshlet.ConeCutoff;
+      }
+      else
+      {
+        double toCenter[3];
+        vtkMath::Subtract(center, position, toCenter);
+        visible = vtkMath::Dot(toCenter, meshlet.ConeAxis) <
+          meshlet.ConeCutoff * vtkMath::Norm(toCenter) + radius;
+      }
+    }
+    if (!visible)
+    {
+      continue;
+    }
+
+    // merge consecutive visible meshlets into a single range
+    if (!this->MeshletDrawCounts.empty() && lastIndex == meshlet.FirstIndex)
+    {
+      this->MeshletDrawCounts.back() += static_cast<int>(meshlet.IndexCount);
+    }
+    else
+    {
+      this->MeshletDrawCounts.push_back(static_cast<int>(meshlet.IndexCount));
+      this->MeshletDrawOffsets.push_back(reinterpret_cast<const void*>(
+        static_cast<uintptr_t>(meshlet.FirstIndex * sizeof(unsigned int))));
+    }
+    lastIndex = meshlet.FirstIndex + meshlet.IndexCount;
+  }
+
+  if (!this->MeshletDrawCounts.empty())
+  {
+    glMultiDrawElements(static_cast<GLenum>(mode), this->MeshletDrawCounts.data(),
+      GL_UNSIGNED_INT, this->MeshletDrawOffsets.data(),
+      static_cast<GLsizei>(this->MeshletDrawCounts.size()));
+  }
+  return true;
+#endif
+}
+
+//------------------------------------------------------------------------------
+bool vtkOpenGLPolyDataMapper::HaveNormalsVBO()
+{
+  const int numComps = this->VBOs->GetNumberOfComponents("normalMC");
+  vtkOpenGLVertexBufferObject* normalVBO = this->VBOs->GetVBO("normalMC");
+  return numComps == 3 ||
+    (numComps == 2 && normalVBO &&
+      normalVBO->GetCompression() == vtkOpenGLVertexBufferObject::OCTAHEDRAL_NORMALS);
+}
+
 //------------------------------------------------------------------------------
 bool vtkOpenGLPolyDataMapper::HaveTCoords(vtkPolyData* poly)
 {
@@ -942,8 +1183,7 @@ void vtkOpenGLPolyDataMapper::ReplaceShaderLight(
                 "  float NdV = clamp(dot(N, V), 1e-5, 1.0);\n";
 
     if (actor->GetProperty()->GetAnisotropy() != 0.0 &&
-      this->VBOs->GetNumberOfComponents("normalMC") == 3 &&
-      this->VBOs->GetNumberOfComponents("tangentMC") == 3)
+      this->HaveNormalsVBO() && this->VBOs->GetNumberOfComponents("tangentMC") == 3)
     {
       // anisotropy, tangentVC and bitangentVC are defined
       hasAnisotropy = true;
@@ -2071,16 +2311,40 @@ void vtkOpenGLPolyDataMapper::ReplaceShaderNormal(
     bool hasClearCoat = actor->GetProperty()->GetInterpolation() == VTK_PBR &&
       actor->GetProperty()->GetCoatStrength() > 0.0;
 
-    if (this->VBOs->GetNumberOfComponents("normalMC") == 3)
+    if (this->HaveNormalsVBO())
     {
-      vtkShaderProgram::Substitute(VSSource, "//VTK::Normal::Dec",
-        "//VTK::Normal::Dec\n"
-        "in vec3 normalMC;\n"
-        "uniform mat3 normalMatrix;\n"
-        "out vec3 normalVCVSOutput;");
-      vtkShaderProgram::Substitute(VSSource, "//VTK::Normal::Impl",
-        "normalVCVSOutput = normalMatrix * normalMC;\n"
-        "//VTK::Normal::Impl");
+      if (this->VBOs->GetNumberOfComponents("normalMC") == 2)
+      {
+        // octahedral encoding, see vtkOpenGLVertexBufferObject
+        vtkShaderProgram::Substitute(VSSource, "//VTK::Normal::Dec",
+          "//VTK::Normal::Dec\n"
+          "in vec2 normalMC;\n"
+          "uniform mat3 normalMatrix;\n"
+          "out vec3 normalVCVSOutput;\n"
+          "vec3 decodeNormal(vec2 e)\n"
+          "{\n"
+          "  vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));\n"
+          "  if (n.z < 0.0)\n"
+          "  {\n"
+          "    n.xy = (1.0 - abs(n.yx)) * vec2(e.x >= 0.0 ? 1.0 : -1.0, e.y >= 0.0 ? 1.0 : -1.0);\n"
+          "  }\n"
+          "  return normalize(n);\n"
+          "}");
+        vtkShaderProgram::Substitute(VSSource, "//VTK::Normal::Impl",
+          "normalVCVSOutput = normalMatrix * decodeNormal(normalMC);\n"
+          "//VTK::Normal::Impl");
+      }
+      else
+      {
+        vtkShaderProgram::Substitute(VSSource, "//VTK::Normal::Dec",
+          "//VTK::Normal::Dec\n"
+          "in vec3 normalMC;\n"
+          "uniform mat3 normalMatrix;\n"
+          "out vec3 normalVCVSOutput;");
+        vtkShaderProgram::Substitute(VSSource, "//VTK::Normal::Impl",
+          "normalVCVSOutput = normalMatrix * normalMC;\n"
+          "//VTK::Normal::Impl");
+      }
       vtkShaderProgram::Substitute(GSSource, "//VTK::Normal::Dec",
         "//VTK::Normal::Dec\n"
         "in vec3 normalVCVSOutput[];\n"
@@ -2599,8 +2863,10 @@ void vtkOpenGLPolyDataMapper::UpdateShaders(
   this->LastBoundBO = &cellBO;
 
   // has something changed that would require us to recreate the shader?
-  if (this->GetNeedToRebuildShaders(cellBO, ren, actor))
+  if (this->GetNeedToRebuildShaders(cellBO, ren, actor) || cellBO.ProgramPending)
   {
+    VTK_SCOPED_RENDER_EVENT("vtkOpenGLPolyDataMapper::BuildShaders", renWin->GetRenderTimer());
+
     // build the shader source code
     std::map<vtkShader::Type, vtkShader*> shaders;
     vtkShader* vss = vtkShader::New();
@@ -2615,8 +2881,10 @@ void vtkOpenGLPolyDataMapper::UpdateShaders(
 
     this->BuildShaders(shaders, ren, actor);
 
-    // compile and bind the program if needed
-    vtkShaderProgram* newShader = renWin->GetShaderCache()->ReadyShaderProgram(shaders);
+    // compile and bind the program if needed, possibly in the background
+    vtkOpenGLShaderCache* shaderCache = renWin->GetShaderCache();
+    vtkShaderProgram* newShader =
+      shaderCache->TryReadyShaderProgram(shaders, cellBO.ProgramPending);
     if (newShader)
     {
       vss->Delete();
@@ -2633,6 +2901,23 @@ void vtkOpenGLPolyDataMapper::UpdateShaders(
 
       cellBO.ShaderSourceTime.Modified();
     }
+    else if (cellBO.ProgramPending)
+    {
+      vss->Delete();
+      fss->Delete();
+      gss->Delete();
+
+      // until the new program is ready, keep the previous one or draw nothing
+      if (cellBO.Program &&
+        shaderCache->GetPendingProgramMode() == vtkOpenGLShaderCache::RENDER_PREVIOUS_PROGRAM)
+      {
+        shaderCache->ReadyShaderProgram(cellBO.Program);
+      }
+      else
+      {
+        cellBO.Program = nullptr;
+      }
+    }
     else
     {
       vtkErrorMacro("Could not set shader program");
@@ -3486,15 +3771,27 @@ void vtkOpenGLPolyDataMapper::RenderPieceDraw(vtkRenderer* ren, vtkActor* actor)
       // Update/build/etc the shader.
       this->UpdateShaders(this->Primitives[i], ren, actor);
 
-      if (mode == GL_LINES && !this->HaveWideLines(ren, actor))
+      // there is no program while a new one is compiled in the background
+      if (this->Primitives[i].Program)
       {
-        ostate->vtkglLineWidth(actor->GetProperty()->GetLineWidth());
-      }
+        if (mode == GL_LINES && !this->HaveWideLines(ren, actor))
+        {
+          ostate->vtkglLineWidth(actor->GetProperty()->GetLineWidth());
+        }
 
-      this->Primitives[i].IBO->Bind();
-      glDrawRangeElements(mode, 0, static_cast<GLuint>(numVerts - 1),
-        static_cast<GLsizei>(this->Primitives[i].IBO->IndexCount), GL_UNSIGNED_INT, nullptr);
-      this->Primitives[i].IBO->Release();
+        this->Primitives[i].IBO->Bind();
+        // meshlets rely on gl_PrimitiveID not being used as it restarts for
+        // each range of triangles
+        const bool useMeshlets = i == vtkOpenGLPolyDataMapper::PrimitiveTris &&
+          representation == VTK_SURFACE && !draw_surface_with_edges && !selector &&
+          !this->HaveCellScalars && !this->HaveCellNormals;
+        if (!useMeshlets || !this->DrawMeshlets(ren, actor, mode))
+        {
+          glDrawRangeElements(mode, 0, static_cast<GLuint>(numVerts - 1),
+            static_cast<GLsizei>(this->Primitives[i].IBO->IndexCount), GL_UNSIGNED_INT, nullptr);
+        }
+        this->Primitives[i].IBO->Release();
+      }
       if (i < 3)
       {
         this->PrimitiveIDOffset = this->CellCellMap->GetPrimitiveOffsets()[i + 1];
@@ -3515,11 +3812,14 @@ void vtkOpenGLPolyDataMapper::RenderPieceDraw(vtkRenderer* ren, vtkActor* actor)
       // Update/build/etc the shader.
       this->UpdateShaders(this->SelectionPrimitives[i], ren, actor);
 
-      this->SelectionPrimitives[i].IBO->Bind();
-      glDrawRangeElements(mode, 0, static_cast<GLuint>(numVerts - 1),
-        static_cast<GLsizei>(this->SelectionPrimitives[i].IBO->IndexCount), GL_UNSIGNED_INT,
-        nullptr);
-      this->SelectionPrimitives[i].IBO->Release();
+      if (this->SelectionPrimitives[i].Program)
+      {
+        this->SelectionPrimitives[i].IBO->Bind();
+        glDrawRangeElements(mode, 0, static_cast<GLuint>(numVerts - 1),
+          static_cast<GLsizei>(this->SelectionPrimitives[i].IBO->IndexCount), GL_UNSIGNED_INT,
+          nullptr);
+        this->SelectionPrimitives[i].IBO->Release();
+      }
     }
   }
 }
@@ -3681,6 +3981,8 @@ void vtkOpenGLPolyDataMapper::UpdateBufferObjects(vtkRenderer* ren, vtkActor* ac
   // Rebuild buffers if needed
   if (this->GetNeedToRebuildBufferObjects(ren, act))
   {
+    VTK_SCOPED_RENDER_EVENT(
+      "vtkOpenGLPolyDataMapper::BuildBufferObjects", ren->GetRenderWindow()->GetRenderTimer());
     this->BuildBufferObjects(ren, act);
   }
 
@@ -3972,17 +4274,28 @@ void vtkOpenGLPolyDataMapper::BuildBufferObjects(vtkRenderer* ren, vtkActor* act
     this->VBOs->CacheDataArray(itr.first.c_str(), da, cache, VTK_FLOAT);
   }
 
-  this->VBOs->CacheDataArray("vertexMC", poly->GetPoints()->GetData(), cache, VTK_FLOAT);
+  this->VBOs->CacheDataArray("vertexMC", poly->GetPoints()->GetData(), cache,
+    this->CompressPointCoordinates ? VTK_SHORT : VTK_FLOAT);
   vtkOpenGLVertexBufferObject* posVBO = this->VBOs->GetVBO("vertexMC");
   if (posVBO)
   {
+    posVBO->SetCompression(this->CompressPointCoordinates
+        ? vtkOpenGLVertexBufferObject::QUANTIZE_COORDINATES
+        : vtkOpenGLVertexBufferObject::NO_COMPRESSION);
     posVBO->SetCoordShiftAndScaleMethod(
       static_cast<vtkOpenGLVertexBufferObject::ShiftScaleMethod>(this->ShiftScaleMethod));
     posVBO->SetProp3D(act);
     posVBO->SetCamera(ren->GetActiveCamera());
   }
 
-  this->VBOs->CacheDataArray("normalMC", n, cache, VTK_FLOAT);
+  this->VBOs->CacheDataArray(
+    "normalMC", n, cache, this->CompressNormals && n ? VTK_SHORT : VTK_FLOAT);
+  if (vtkOpenGLVertexBufferObject* normalVBO = this->VBOs->GetVBO("normalMC"))
+  {
+    normalVBO->SetCompression(this->CompressNormals
+        ? vtkOpenGLVertexBufferObject::OCTAHEDRAL_NORMALS
+        : vtkOpenGLVertexBufferObject::NO_COMPRESSION);
+  }
   this->VBOs->CacheDataArray("scalarColor", c, cache, VTK_UNSIGNED_CHAR);
   this->VBOs->CacheDataArray("tcoord", tcoords, cache, VTK_FLOAT);
   this->VBOs->CacheDataArray("colorTCoord", colorTCoords, cache, VTK_FLOAT);
@@ -4059,10 +4372,14 @@ void vtkOpenGLPolyDataMapper::BuildIBO(vtkRenderer* ren, vtkActor* act, vtkPolyD
   this->TempState.Append(representation, "representation");
   this->TempState.Append(ef ? ef->GetMTime() : 0, "edge flags mtime");
   this->TempState.Append(draw_surface_with_edges, "draw surface with edges");
+  this->TempState.Append(this->UseMeshlets ? this->MeshletSize : 0, "meshlet size");
+  this->TempState.Append(
+    this->UseMeshlets ? poly->GetPoints()->GetMTime() : 0, "meshlet points mtime");
 
   if (this->IBOBuildState != this->TempState)
   {
     this->EdgeValues.clear();
+    this->Meshlets.clear();
 
     this->IBOBuildState = this->TempState;
     this->Primitives[PrimitivePoints].IBO->CreatePointIndexBuffer(prims[0]);
@@ -4116,6 +4433,16 @@ void vtkOpenGLPolyDataMapper::BuildIBO(vtkRenderer* ren, vtkActor* act, vtkPolyD
               this->EdgeBuffer);
           }
         }
+        else if (this->UseMeshlets && prims[2]->GetNumberOfCells())
+        {
+          std::vector<unsigned int> indexArray;
+          vtkOpenGLIndexBufferObject::AppendTriangleIndexBuffer(
+            indexArray, prims[2], poly->GetPoints(), 0, nullptr, nullptr);
+          this->BuildMeshlets(indexArray, poly->GetPoints());
+          this->Primitives[PrimitiveTris].IBO->Upload(
+            indexArray, vtkOpenGLIndexBufferObject::ElementArrayBuffer);
+          this->Primitives[PrimitiveTris].IBO->IndexCount = indexArray.size();
+        }
         else
         {
           this->Primitives[PrimitiveTris].IBO->CreateTriangleIndexBuffer(
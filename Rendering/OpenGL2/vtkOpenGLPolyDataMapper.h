@@ -152,6 +152,42 @@ public:
   vtkSetMacro(UseProgramPointSize, bool);
   vtkBooleanMacro(UseProgramPointSize, bool);
 
+  ///@{
+  /**
+   * Store the point coordinates as 16 bit integers relative to the bounds of
+   * the points, which replaces the VBO shift and scale method, and the point
+   * normals as two 16 bit integers with an octahedral mapping decoded in the
+   * vertex shader. This halves the memory used by the coordinates and divides
+   * the one used by the normals by three, at the cost of a precision of about
+   * 1/65535 of the bounds. Scalar colors are always stored as 8 bit values.
+   * Both are off by default.
+   */
+  vtkGetMacro(CompressPointCoordinates, bool);
+  vtkSetMacro(CompressPointCoordinates, bool);
+  vtkBooleanMacro(CompressPointCoordinates, bool);
+  vtkGetMacro(CompressNormals, bool);
+  vtkSetMacro(CompressNormals, bool);
+  vtkBooleanMacro(CompressNormals, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Split the triangles into meshlets, runs of MeshletSize consecutive
+   * triangles with a bounding sphere and a cone bounding their normals, and
+   * only draw the meshlets which intersect the view frustum and, when backface
+   * culling is on, face the camera. This speeds up the rendering of very large
+   * surfaces of which only a part is visible, such as scans seen from close.
+   * Meshlets are rebuilt when the cells or the points change. They are not
+   * used for wireframes, edges, cell scalars or normals, selection, and on
+   * OpenGL ES. UseMeshlets is off by default and MeshletSize defaults to 128.
+   */
+  vtkGetMacro(UseMeshlets, bool);
+  vtkSetMacro(UseMeshlets, bool);
+  vtkBooleanMacro(UseMeshlets, bool);
+  vtkSetClampMacro(MeshletSize, int, 1, VTK_INT_MAX);
+  vtkGetMacro(MeshletSize, int);
+  ///@}
+
   enum PrimitiveTypes
   {
     PrimitiveStart = 0,
@@ -429,6 +465,36 @@ protected:
   vtkNew<vtkTransform> VBOInverseTransform;
   vtkNew<vtkMatrix4x4> VBOShiftScale;
   bool UseProgramPointSize;
+  bool CompressPointCoordinates = false;
+  bool CompressNormals = false;
+
+  // Returns true when the VBOs hold point normals, compressed or not
+  bool HaveNormalsVBO();
+
+  bool UseMeshlets = false;
+  int MeshletSize = 128;
+
+  // a run of consecutive triangles of the triangle IBO, see UseMeshlets
+  struct Meshlet
+  {
+    unsigned int FirstIndex;
+    unsigned int IndexCount;
+    double Center[3];
+    double Radius;
+    double ConeAxis[3];
+    double ConeCutoff; // sine of the cone angle, 1 when the cone is too wide to cull
+  };
+  struct MeshletsWorker;
+  std::vector<Meshlet> Meshlets;
+  std::vector<int> MeshletDrawCounts;
+  std::vector<const void*> MeshletDrawOffsets;
+
+  // compute the meshlets of the triangles in the given index array
+  void BuildMeshlets(const std::vector<unsigned int>& indices, vtkPoints* points);
+
+  // draw the visible meshlets with the bound triangle IBO, returns false when
+  // the triangles have to be drawn as a whole instead
+  bool DrawMeshlets(vtkRenderer* ren, vtkActor* actor, int mode);
 
   // if set to true, tcoords will be passed to the
   // VBO even if the mapper knows of no texture maps
@@ -282,6 +282,7 @@ void vtkOpenGLRenderer::DeviceRender()
     vtkRenderState s(this);
     s.SetPropArrayAndCount(this->PropArray, this->PropArrayCount);
     s.SetFrameBuffer(nullptr);
+    VTK_SCOPED_RENDER_EVENT(this->Pass->GetClassName(), this->GetRenderWindow()->GetRenderTimer());
     this->Pass->Render(&s);
   }
   else
@@ -10,10 +10,34 @@
 #include "vtkShader.h"
 #include "vtkShaderProgram.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
 #include <sstream>
+#include <vector>
 
+#include "vtksys/Directory.hxx"
+#include "vtksys/FStream.hxx"
 #include "vtksys/MD5.h"
+#include "vtksys/SystemInformation.hxx"
+#include "vtksys/SystemTools.hxx"
+
+namespace
+{
+// header of the files of the program binary cache, followed by the binary
+struct ProgramBinaryHeader
+{
+  char Magic[8];
+  char Key[32];
+  char Checksum[32];
+  vtkTypeUInt32 Format;
+  vtkTypeUInt32 Length;
+};
+
+const char ProgramBinaryMagic[8] = { 'V', 'T', 'K', 'S', 'P', 'B', '0', '1' };
+const char* ProgramBinaryExtension = ".vtkpb";
+}
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkOpenGLShaderCache::Private
@@ -24,6 +48,13 @@ public:
   // map of hash to shader program structs
   std::map<std::string, vtkShaderProgram*> ShaderPrograms;
 
+  // vendor, renderer and version strings of the context, part of the keys
+  // of the program binary cache
+  std::string DriverKey;
+
+  // whether the driver was allowed to compile shaders in the background
+  bool ParallelCompileEnabled = false;
+
   Private() { md5 = vtksysMD5_New(); }
 
   ~Private() { vtksysMD5_Delete(this->md5); }
@@ -57,6 +88,46 @@ public:
 
     hash = md5Hash;
   }
+
+  //-----------------------------------------------------------------------------
+  void ComputeMD5(const unsigned char* content, size_t size, std::string& hash)
+  {
+    unsigned char digest[16];
+    char md5Hash[33];
+    md5Hash[32] = '\0';
+
+    vtksysMD5_Initialize(this->md5);
+    vtksysMD5_Append(this->md5, content, static_cast<int>(size));
+    vtksysMD5_Finalize(this->md5, digest);
+    vtksysMD5_DigestToHex(digest, md5Hash);
+
+    hash = md5Hash;
+  }
+
+  //-----------------------------------------------------------------------------
+  // key of a program in the binary cache, which changes with the driver
+  std::string ComputeProgramBinaryKey(vtkShaderProgram* shader)
+  {
+    if (this->DriverKey.empty())
+    {
+      const GLenum names[4] = { GL_VENDOR, GL_RENDERER, GL_VERSION, GL_SHADING_LANGUAGE_VERSION };
+      for (GLenum name : names)
+      {
+        const GLubyte* value = glGetString(name);
+        this->DriverKey += value ? reinterpret_cast<const char*>(value) : "";
+        this->DriverKey += '\n';
+      }
+    }
+
+    std::string sources;
+    this->ComputeMD5(shader->GetVertexShader()->GetSource().c_str(),
+      shader->GetFragmentShader()->GetSource().c_str(),
+      shader->GetGeometryShader()->GetSource().c_str(), sources);
+    std::string key;
+    this->ComputeMD5(sources.c_str(), std::to_string(shader->NumberOfOutputs).c_str(),
+      this->DriverKey.c_str(), key);
+    return key;
+  }
 };
 
 //------------------------------------------------------------------------------
@@ -69,6 +140,12 @@ vtkOpenGLShaderCache::vtkOpenGLShaderCache()
   this->LastShaderBound = nullptr;
   this->OpenGLMajorVersion = 0;
   this->OpenGLMinorVersion = 0;
+
+  std::string directory;
+  if (vtksys::SystemTools::GetEnv("VTK_SHADER_BINARY_CACHE_DIR", directory))
+  {
+    this->SetProgramBinaryCacheDirectory(directory.c_str());
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -82,6 +159,7 @@ vtkOpenGLShaderCache::~vtkOpenGLShaderCache()
   }
 
   delete this->Internal;
+  this->SetProgramBinaryCacheDirectory(nullptr);
 }
 
 // perform System and Output replacements
@@ -274,6 +352,33 @@ vtkShaderProgram* vtkOpenGLShaderCache::ReadyShaderProgram(const char* vertexCod
 vtkShaderProgram* vtkOpenGLShaderCache::ReadyShaderProgram(
   vtkShaderProgram* shader, vtkTransformFeedback* cap)
 {
+  bool pending = false;
+  return this->ReadyShaderProgramInternal(shader, cap, false, pending);
+}
+
+// return nullptr if there is an issue or if the program is not ready yet
+vtkShaderProgram* vtkOpenGLShaderCache::TryReadyShaderProgram(
+  std::map<vtkShader::Type, vtkShader*> shaders, bool& pending, vtkTransformFeedback* cap)
+{
+  std::string VSSource = shaders[vtkShader::Vertex]->GetSource();
+  std::string FSSource = shaders[vtkShader::Fragment]->GetSource();
+  std::string GSSource = shaders[vtkShader::Geometry]->GetSource();
+
+  unsigned int count = this->ReplaceShaderValues(VSSource, FSSource, GSSource);
+  shaders[vtkShader::Vertex]->SetSource(VSSource);
+  shaders[vtkShader::Fragment]->SetSource(FSSource);
+  shaders[vtkShader::Geometry]->SetSource(GSSource);
+
+  vtkShaderProgram* shader = this->GetShaderProgram(shaders);
+  shader->SetNumberOfOutputs(count);
+
+  return this->ReadyShaderProgramInternal(shader, cap, true, pending);
+}
+
+vtkShaderProgram* vtkOpenGLShaderCache::ReadyShaderProgramInternal(
+  vtkShaderProgram* shader, vtkTransformFeedback* cap, bool asynchronous, bool& pending)
+{
+  pending = false;
   if (!shader)
   {
     return nullptr;
@@ -286,10 +391,69 @@ vtkShaderProgram* vtkOpenGLShaderCache::ReadyShaderProgram(
     shader->SetTransformFeedback(cap);
   }
 
-  // compile if needed
-  if (!shader->GetCompiled() && !shader->CompileShader())
+  // compile if needed, unless the program binary cache has it
+  if (!shader->GetCompiled() && !shader->GetCompilePending())
   {
-    return nullptr;
+    const bool useBinaryCache = this->ProgramBinaryCacheDirectory &&
+      *this->ProgramBinaryCacheDirectory && !cap &&
+      shader->GetComputeShader()->GetSource().empty() &&
+      !(shader->GetFileNamePrefixForDebugging() && *shader->GetFileNamePrefixForDebugging()) &&
+      vtkShaderProgram::IsProgramBinarySupported();
+    if (!useBinaryCache || !this->LoadProgramBinary(shader))
+    {
+      shader->ProgramBinaryRetrievable = useBinaryCache;
+      if (asynchronous && this->AsynchronousCompilation && !cap &&
+        shader->GetComputeShader()->GetSource().empty() &&
+        vtkShaderProgram::IsParallelCompileSupported())
+      {
+        if (!this->Internal->ParallelCompileEnabled)
+        {
+#if !defined(GL_ES_VERSION_3_0) && defined(GL_COMPLETION_STATUS_KHR)
+          // let the driver use as many threads as it wants
+          if (GLEW_KHR_parallel_shader_compile)
+          {
+            glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+          }
+          else
+          {
+            glMaxShaderCompilerThreadsARB(0xFFFFFFFF);
+          }
+#endif
+          this->Internal->ParallelCompileEnabled = true;
+        }
+        if (!shader->StartCompileShader())
+        {
+          return nullptr;
+        }
+      }
+      else if (!shader->CompileShader())
+      {
+        return nullptr;
+      }
+      else if (useBinaryCache)
+      {
+        this->SaveProgramBinary(shader);
+      }
+    }
+  }
+
+  // finish a background compilation once the driver is done with it, or
+  // right away when the caller cannot wait
+  if (shader->GetCompilePending())
+  {
+    if (asynchronous && !shader->IsCompileComplete())
+    {
+      pending = true;
+      return nullptr;
+    }
+    if (!shader->FinishCompileShader())
+    {
+      return nullptr;
+    }
+    if (shader->ProgramBinaryRetrievable)
+    {
+      this->SaveProgramBinary(shader);
+    }
   }
 
   // bind if needed
@@ -301,6 +465,17 @@ vtkShaderProgram* vtkOpenGLShaderCache::ReadyShaderProgram(
   return shader;
 }
 
+//------------------------------------------------------------------------------
+int vtkOpenGLShaderCache::GetNumberOfPendingShaderPrograms()
+{
+  int count = 0;
+  for (const auto& program : this->Internal->ShaderPrograms)
+  {
+    count += program.second->GetCompilePending() ? 1 : 0;
+  }
+  return count;
+}
+
 vtkShaderProgram* vtkOpenGLShaderCache::GetShaderProgram(
   std::map<vtkShader::Type, vtkShader*> shaders)
 {
@@ -379,6 +554,135 @@ void vtkOpenGLShaderCache::ReleaseGraphicsResources(vtkWindow* win)
     iter->second->ReleaseGraphicsResources(win);
   }
   this->OpenGLMajorVersion = 0;
+  this->Internal->DriverKey.clear();
+  this->Internal->ParallelCompileEnabled = false;
+}
+
+//------------------------------------------------------------------------------
+bool vtkOpenGLShaderCache::LoadProgramBinary(vtkShaderProgram* shader)
+{
+  const std::string key = this->Internal->ComputeProgramBinaryKey(shader);
+  const std::string fileName =
+    std::string(this->ProgramBinaryCacheDirectory) + "/" + key + ProgramBinaryExtension;
+  if (!vtksys::SystemTools::FileExists(fileName, true))
+  {
+    return false;
+  }
+
+  ProgramBinaryHeader header;
+  std::vector<unsigned char> binary;
+  bool valid = false;
+  {
+    vtksys::ifstream file(fileName.c_str(), std::ios::in | std::ios::binary);
+    if (file.read(reinterpret_cast<char*>(&header), sizeof(header)) &&
+      memcmp(header.Magic, ProgramBinaryMagic, sizeof(header.Magic)) == 0 &&
+      memcmp(header.Key, key.c_str(), sizeof(header.Key)) == 0 && header.Length > 0 &&
+      vtksys::SystemTools::FileLength(fileName) == sizeof(header) + header.Length)
+    {
+      binary.resize(header.Length);
+      if (file.read(reinterpret_cast<char*>(binary.data()), header.Length))
+      {
+        std::string checksum;
+        this->Internal->ComputeMD5(binary.data(), binary.size(), checksum);
+        valid = memcmp(header.Checksum, checksum.c_str(), sizeof(header.Checksum)) == 0;
+      }
+    }
+  }
+
+  // a corrupted file or a binary the driver no longer accepts is useless
+  if (!valid || !shader->LoadProgramBinary(header.Format, binary))
+  {
+    vtkDebugMacro("Removing invalid program binary " << fileName);
+    vtksys::SystemTools::RemoveFile(fileName);
+    return false;
+  }
+
+  // the modification time orders the binaries for eviction
+  vtksys::SystemTools::Touch(fileName, false);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLShaderCache::SaveProgramBinary(vtkShaderProgram* shader)
+{
+  unsigned int format = 0;
+  std::vector<unsigned char> binary;
+  if (!shader->GetProgramBinary(format, binary))
+  {
+    return;
+  }
+
+  const std::string directory = this->ProgramBinaryCacheDirectory;
+  if (!vtksys::SystemTools::MakeDirectory(directory))
+  {
+    vtkWarningMacro("Could not create the program binary cache directory " << directory);
+    return;
+  }
+
+  const std::string key = this->Internal->ComputeProgramBinaryKey(shader);
+  std::string checksum;
+  this->Internal->ComputeMD5(binary.data(), binary.size(), checksum);
+  ProgramBinaryHeader header;
+  memcpy(header.Magic, ProgramBinaryMagic, sizeof(header.Magic));
+  memcpy(header.Key, key.c_str(), sizeof(header.Key));
+  memcpy(header.Checksum, checksum.c_str(), sizeof(header.Checksum));
+  header.Format = static_cast<vtkTypeUInt32>(format);
+  header.Length = static_cast<vtkTypeUInt32>(binary.size());
+
+  // write a temporary file first so that concurrent processes sharing the
+  // directory never read a partially written binary
+  const std::string fileName = directory + "/" + key + ProgramBinaryExtension;
+  vtksys::SystemInformation info;
+  const std::string tempName = fileName + "." + std::to_string(info.GetProcessId()) + ".tmp";
+  bool written = false;
+  {
+    vtksys::ofstream file(tempName.c_str(), std::ios::out | std::ios::binary);
+    written = file.write(reinterpret_cast<const char*>(&header), sizeof(header)) &&
+      file.write(reinterpret_cast<const char*>(binary.data()), binary.size());
+  }
+  if (!written || std::rename(tempName.c_str(), fileName.c_str()) != 0)
+  {
+    vtkDebugMacro("Could not write program binary " << fileName);
+    vtksys::SystemTools::RemoveFile(tempName);
+    return;
+  }
+
+  // evict the least recently used binaries past the maximum size
+  struct Entry
+  {
+    std::string Name;
+    unsigned long Size;
+    long Time;
+  };
+  std::vector<Entry> entries;
+  unsigned long long totalSize = 0;
+  vtksys::Directory dir;
+  dir.Load(directory);
+  for (unsigned long cc = 0; cc < dir.GetNumberOfFiles(); ++cc)
+  {
+    const std::string name = directory + "/" + dir.GetFile(cc);
+    if (vtksys::SystemTools::GetFilenameLastExtension(name) == ProgramBinaryExtension)
+    {
+      entries.push_back(Entry{ name, vtksys::SystemTools::FileLength(name),
+        vtksys::SystemTools::ModifiedTime(name) });
+      totalSize += entries.back().Size;
+    }
+  }
+  std::sort(entries.begin(), entries.end(),
+    [](const Entry& a, const Entry& b) { return a.Time < b.Time; });
+  const unsigned long long maximumSize =
+    static_cast<unsigned long long>(this->MaximumProgramBinaryCacheSize) * 1024 * 1024;
+  for (const Entry& entry : entries)
+  {
+    if (totalSize <= maximumSize)
+    {
+      break;
+    }
+    if (entry.Name != fileName && vtksys::SystemTools::RemoveFile(entry.Name))
+    {
+      totalSize -= entry.Size;
+    }
+  }
 }
 
 void vtkOpenGLShaderCache::ReleaseCurrentShader()
@@ -416,5 +720,11 @@ int vtkOpenGLShaderCache::BindShader(vtkShaderProgram* shader)
 void vtkOpenGLShaderCache::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "ProgramBinaryCacheDirectory: "
+     << (this->ProgramBinaryCacheDirectory ? this->ProgramBinaryCacheDirectory : "(none)") << "\n";
+  os << indent << "MaximumProgramBinaryCacheSize: " << this->MaximumProgramBinaryCacheSize
+     << "\n";
+  os << indent << "AsynchronousCompilation: " << this->AsynchronousCompilation << "\n";
+  os << indent << "PendingProgramMode: " << this->PendingProgramMode << "\n";
 }
 VTK_ABI_NAMESPACE_END
@@ -5,6 +5,15 @@
  * @brief   manage Shader Programs within a context
  *
  * vtkOpenGLShaderCache manages shader program compilation and binding
+ *
+ * When `ProgramBinaryCacheDirectory` is set, the linked programs are also
+ * saved as driver specific binaries in that directory, and later runs load
+ * them instead of compiling the shaders again. A binary is keyed on the
+ * shader sources and on the vendor, renderer and version strings of the
+ * OpenGL context, so a driver update or another GPU simply misses the cache.
+ * Binaries that fail validation or are rejected by the driver are removed
+ * and the program is compiled as usual. The least recently used binaries are
+ * evicted once the directory grows past `MaximumProgramBinaryCacheSize`.
  */
 
 #ifndef vtkOpenGLShaderCache_h
@@ -42,6 +51,48 @@ public:
   virtual vtkShaderProgram* ReadyShaderProgram(
     vtkShaderProgram* shader, vtkTransformFeedback* cap = nullptr);
 
+  // same as above, but when AsynchronousCompilation is on a new program is
+  // compiled in the background: nullptr is returned with pending set to
+  // true until the program is ready, and callers try again on later renders
+  virtual vtkShaderProgram* TryReadyShaderProgram(std::map<vtkShader::Type, vtkShader*> shaders,
+    bool& pending, vtkTransformFeedback* cap = nullptr);
+
+  ///@{
+  /**
+   * Set/Get whether the programs requested through TryReadyShaderProgram are
+   * compiled in the background, so that a new shader variant does not stall
+   * the render. This requires vtkShaderProgram::IsParallelCompileSupported(),
+   * programs are compiled synchronously otherwise. Off by default.
+   */
+  vtkSetMacro(AsynchronousCompilation, bool);
+  vtkGetMacro(AsynchronousCompilation, bool);
+  vtkBooleanMacro(AsynchronousCompilation, bool);
+  ///@}
+
+  enum PendingProgramModes
+  {
+    RENDER_PREVIOUS_PROGRAM = 0,
+    SKIP_RENDERING
+  };
+
+  ///@{
+  /**
+   * Set/Get what mappers do while their new program is compiled in the
+   * background: render with the program they used before, when they have
+   * one, or skip rendering until the program is ready. Defaults to
+   * RENDER_PREVIOUS_PROGRAM.
+   */
+  vtkSetClampMacro(PendingProgramMode, int, RENDER_PREVIOUS_PROGRAM, SKIP_RENDERING);
+  vtkGetMacro(PendingProgramMode, int);
+  ///@}
+
+  /**
+   * Get the number of programs which are still compiled in the background.
+   * Applications can keep rendering while it is not zero, so that the props
+   * waiting for their programs show up as soon as they are ready.
+   */
+  int GetNumberOfPendingShaderPrograms();
+
   /**
    * Release the current shader.  Basically go back to
    * having no shaders loaded.  This is useful for old
@@ -64,6 +115,28 @@ public:
   // Set the time in seconds elapsed since the first render
   void SetElapsedTime(float val) { this->ElapsedTime = val; }
 
+  ///@{
+  /**
+   * Set/Get the directory where the binaries of the linked programs are
+   * cached across runs. The directory is created if needed. The cache is
+   * disabled when empty, which is the default unless the
+   * `VTK_SHADER_BINARY_CACHE_DIR` environment variable is set. Programs with
+   * a transform feedback or a compute shader are never cached, and caching
+   * requires vtkShaderProgram::IsProgramBinarySupported().
+   */
+  vtkSetFilePathMacro(ProgramBinaryCacheDirectory);
+  vtkGetFilePathMacro(ProgramBinaryCacheDirectory);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the maximum size in megabytes of the binaries kept in
+   * `ProgramBinaryCacheDirectory`. Defaults to 64.
+   */
+  vtkSetClampMacro(MaximumProgramBinaryCacheSize, int, 1, VTK_INT_MAX);
+  vtkGetMacro(MaximumProgramBinaryCacheSize, int);
+  ///@}
+
 protected:
   vtkOpenGLShaderCache();
   ~vtkOpenGLShaderCache() override;
@@ -78,6 +151,15 @@ protected:
   virtual vtkShaderProgram* GetShaderProgram(std::map<vtkShader::Type, vtkShader*> shaders);
   virtual int BindShader(vtkShaderProgram* shader);
 
+  // compile, or start compiling when asynchronous is true, and bind
+  vtkShaderProgram* ReadyShaderProgramInternal(
+    vtkShaderProgram* shader, vtkTransformFeedback* cap, bool asynchronous, bool& pending);
+
+  // load the program from the binary cache, return false on a miss
+  virtual bool LoadProgramBinary(vtkShaderProgram* shader);
+  // save the program in the binary cache and evict old entries
+  virtual void SaveProgramBinary(vtkShaderProgram* shader);
+
   class Private;
   Private* Internal;
   vtkShaderProgram* LastShaderBound;
@@ -87,6 +169,11 @@ protected:
 
   float ElapsedTime;
 
+  char* ProgramBinaryCacheDirectory = nullptr;
+  int MaximumProgramBinaryCacheSize = 64;
+  bool AsynchronousCompilation = false;
+  int PendingProgramMode = RENDER_PREVIOUS_PROGRAM;
+
 private:
   vtkOpenGLShaderCache(const vtkOpenGLShaderCache&) = delete;
   void operator=(const vtkOpenGLShaderCache&) = delete;
@@ -321,7 +321,10 @@ void vtkOpenGLSphereMapper::RenderPieceDraw(vtkRenderer* ren, vtkActor* actor)
   {
     // First we do the triangles, update the shader, set uniforms, etc.
     this->UpdateShaders(this->Primitives[PrimitiveTris], ren, actor);
-    glDrawArrays(GL_POINTS, 0, static_cast<GLuint>(numVerts));
+    if (this->Primitives[PrimitiveTris].Program)
+    {
+      glDrawArrays(GL_POINTS, 0, static_cast<GLuint>(numVerts));
+    }
   }
 }
 VTK_ABI_NAMESPACE_END
@@ -410,7 +410,10 @@ void vtkOpenGLStickMapper::RenderPieceDraw(vtkRenderer* ren, vtkActor* actor)
   {
     // First we do the triangles, update the shader, set uniforms, etc.
     this->UpdateShaders(this->Primitives[PrimitiveTris], ren, actor);
-    glDrawArrays(GL_POINTS, 0, static_cast<GLuint>(numVerts));
+    if (this->Primitives[PrimitiveTris].Program)
+    {
+      glDrawArrays(GL_POINTS, 0, static_cast<GLuint>(numVerts));
+    }
   }
 }
 VTK_ABI_NAMESPACE_END
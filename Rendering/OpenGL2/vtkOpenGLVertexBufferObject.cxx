@@ -6,10 +6,13 @@
 #include "vtkArrayDispatch.h"
 #include "vtkCamera.h"
 #include "vtkDataArrayRange.h"
+#include "vtkIdTypeArray.h"
 #include "vtkMatrix4x4.h"
+#include "vtkNew.h"
 #include "vtkOpenGLVertexBufferObjectCache.h"
 #include "vtkPoints.h"
 #include "vtkProp3D.h"
+#include "vtkSMPTools.h"
 
 #include "vtk_glew.h"
 
@@ -27,6 +30,7 @@ vtkOpenGLVertexBufferObject::vtkOpenGLVertexBufferObject()
   this->SetType(vtkOpenGLBufferObject::ArrayBuffer);
   this->CoordShiftAndScaleMethod = ShiftScaleMethod::DISABLE_SHIFT_SCALE;
   this->CoordShiftAndScaleEnabled = false;
+  this->SetPersistentMapping(vtkOpenGLVertexBufferObject::GlobalPersistentMappingEnabled != 0);
 }
 
 vtkOpenGLVertexBufferObject::~vtkOpenGLVertexBufferObject()
@@ -43,7 +47,10 @@ vtkCxxSetObjectMacro(vtkOpenGLVertexBufferObject, Cache, vtkOpenGLVertexBufferOb
 
 bool vtkOpenGLVertexBufferObject::GetCoordShiftAndScaleEnabled()
 {
-  auto value = GetGlobalCoordShiftAndScaleEnabled() ? this->CoordShiftAndScaleEnabled : false;
+  // quantized coordinates cannot be decoded without their shift and scale
+  auto value = GetGlobalCoordShiftAndScaleEnabled() || this->Compression == QUANTIZE_COORDINATES
+    ? this->CoordShiftAndScaleEnabled
+    : false;
   vtkDebugMacro(<< this->GetClassName() << " (" << this
                 << "): returning CoordShiftAndScaleEnabled of " << value);
   return value;
@@ -241,19 +248,88 @@ vtkTypeBool vtkOpenGLVertexBufferObject::GetGlobalCoordShiftAndScaleEnabled()
   return vtkOpenGLVertexBufferObject::GlobalCoordShiftAndScaleEnabled;
 }
 
+vtkTypeBool vtkOpenGLVertexBufferObject::GlobalPersistentMappingEnabled = 0;
+
+void vtkOpenGLVertexBufferObject::SetGlobalPersistentMappingEnabled(vtkTypeBool val)
+{
+  vtkOpenGLVertexBufferObject::GlobalPersistentMappingEnabled = val;
+}
+
+vtkTypeBool vtkOpenGLVertexBufferObject::GetGlobalPersistentMappingEnabled()
+{
+  return vtkOpenGLVertexBufferObject::GlobalPersistentMappingEnabled;
+}
+
 namespace
 {
 
+// Converts a shifted and scaled value. Integer destinations hold normalized
+// values, quantized from [-1, 1].
+template <typename destType>
+destType ConvertShiftScaled(double value)
+{
+  return static_cast<destType>(value);
+}
+
+template <>
+short ConvertShiftScaled<short>(double value)
+{
+  return static_cast<short>(std::lround(std::max(-1.0, std::min(1.0, value)) * 32767.0));
+}
+
+// Encodes unit vectors with an octahedral mapping into two 16 bit normalized
+// integers.
+class vtkOctahedralNormalsWorker
+{
+public:
+  vtkOctahedralNormalsWorker(short* destination)
+    : Destination(destination)
+  {
+  }
+
+  short* Destination;
+
+  template <typename DataArray>
+  void operator()(DataArray* array)
+  {
+    vtkSMPTools::For(0, array->GetNumberOfTuples(), [&](vtkIdType begin, vtkIdType end) {
+      short* out = this->Destination + 2 * begin;
+      for (const auto tuple : vtk::DataArrayTupleRange<3>(array, begin, end))
+      {
+        double n[3] = { static_cast<double>(tuple[0]), static_cast<double>(tuple[1]),
+          static_cast<double>(tuple[2]) };
+        const double norm = std::abs(n[0]) + std::abs(n[1]) + std::abs(n[2]);
+        double p[2] = { 0.0, 0.0 };
+        if (norm > 0.0)
+        {
+          p[0] = n[0] / norm;
+          p[1] = n[1] / norm;
+          if (n[2] < 0.0)
+          {
+            const double x = p[0];
+            p[0] = (1.0 - std::abs(p[1])) * (x >= 0.0 ? 1.0 : -1.0);
+            p[1] = (1.0 - std::abs(x)) * (p[1] >= 0.0 ? 1.0 : -1.0);
+          }
+        }
+        *(out++) = ConvertShiftScaled<short>(p[0]);
+        *(out++) = ConvertShiftScaled<short>(p[1]);
+      }
+    });
+  }
+};
+
 template <typename destType>
 class vtkAppendVBOWorker
 {
 public:
   vtkAppendVBOWorker(vtkOpenGLVertexBufferObject* vbo, unsigned int offset,
-    const std::vector<double>& shift, const std::vector<double>& scale)
+    const std::vector<double>& shift, const std::vector<double>& scale,
+    void* destination = nullptr)
     : VBO(vbo)
     , Offset(offset)
     , Shift(shift)
     , Scale(scale)
+    , Destination(destination)
   {
   }
 
@@ -261,6 +337,8 @@ public:
   unsigned int Offset;
   const std::vector<double>& Shift;
   const std::vector<double>& Scale;
+  // where to write the values, the PackedVBO of the VBO when null
+  void* Destination;
 
   // faster path
   template <typename ValueType>
@@ -271,6 +349,14 @@ public:
   void operator()(DataArray* array);
 
   vtkAppendVBOWorker<destType>& operator=(const vtkAppendVBOWorker&) = delete;
+
+private:
+  destType* GetDestination()
+  {
+    return this->Destination
+      ? static_cast<destType*>(this->Destination)
+      : reinterpret_cast<destType*>(&this->VBO->GetPackedVBO()[this->Offset]);
+  }
 };
 
 template <typename destType>
@@ -284,15 +370,16 @@ void vtkAppendVBOWorker<destType>::operator()(vtkAOSDataArrayTemplate<ValueType>
     return; // fixme: should handle error here?
   }
 
-  destType* VBOit = reinterpret_cast<destType*>(&this->VBO->GetPackedVBO()[this->Offset]);
+  destType* VBOBegin = this->GetDestination();
 
-  ValueType* input = src->Begin();
-  unsigned int numComps = this->VBO->GetNumberOfComponents();
-  unsigned int numTuples = src->GetNumberOfTuples();
+  const ValueType* inputBegin = src->Begin();
+  const unsigned int numComps = this->VBO->GetNumberOfComponents();
+  const vtkIdType numTuples = src->GetNumberOfTuples();
 
   // compute extra padding required
   int bytesNeeded = this->VBO->GetDataTypeSize() * this->VBO->GetNumberOfComponents();
   int extraComponents = ((4 - (bytesNeeded % 4)) % 4) / this->VBO->GetDataTypeSize();
+  const unsigned int tupleSize = numComps + extraComponents;
 
   // If not shift & scale
   if (!this->VBO->GetCoordShiftAndScaleEnabled())
@@ -300,30 +387,39 @@ void vtkAppendVBOWorker<destType>::operator()(vtkAOSDataArrayTemplate<ValueType>
     // if no padding and no type conversion then memcpy
     if (extraComponents == 0 && src->GetDataType() == this->VBO->GetDataType())
     {
-      memcpy(VBOit, input, this->VBO->GetDataTypeSize() * numComps * numTuples);
+      memcpy(VBOBegin, inputBegin, this->VBO->GetDataTypeSize() * numComps * numTuples);
     }
     else
     {
-      for (unsigned int i = 0; i < numTuples; ++i)
-      {
-        for (unsigned int j = 0; j < numComps; j++)
+      vtkSMPTools::For(0, numTuples, [&](vtkIdType begin, vtkIdType end) {
+        destType* VBOit = VBOBegin + begin * tupleSize;
+        const ValueType* input = inputBegin + begin * numComps;
+        for (vtkIdType i = begin; i < end; ++i)
         {
-          *(VBOit++) = *(input++);
+          for (unsigned int j = 0; j < numComps; j++)
+          {
+            *(VBOit++) = *(input++);
+          }
+          VBOit += extraComponents;
         }
-        VBOit += extraComponents;
-      }
+      });
     }
   }
   else
   {
-    for (unsigned int i = 0; i < numTuples; ++i)
-    {
-      for (unsigned int j = 0; j < numComps; j++)
+    vtkSMPTools::For(0, numTuples, [&](vtkIdType begin, vtkIdType end) {
+      destType* VBOit = VBOBegin + begin * tupleSize;
+      const ValueType* input = inputBegin + begin * numComps;
+      for (vtkIdType i = begin; i < end; ++i)
       {
-        *(VBOit++) = (*(input++) - this->Shift.at(j)) * this->Scale.at(j);
+        for (unsigned int j = 0; j < numComps; j++)
+        {
+          *(VBOit++) =
+            ConvertShiftScaled<destType>((*(input++) - this->Shift[j]) * this->Scale[j]);
+        }
+        VBOit += extraComponents;
       }
-      VBOit += extraComponents;
-    }
+    });
   } // end if shift*scale
 }
 
@@ -338,38 +434,64 @@ void vtkAppendVBOWorker<destType>::operator()(DataArray* array)
     return; // fixme: should handle error here?
   }
 
-  destType* VBOit = reinterpret_cast<destType*>(&this->VBO->GetPackedVBO()[this->Offset]);
-
-  const auto dataRange = vtk::DataArrayTupleRange(array);
+  destType* VBOBegin = this->GetDestination();
 
   // compute extra padding required
   int bytesNeeded = this->VBO->GetDataTypeSize() * this->VBO->GetNumberOfComponents();
   int extraComponents = ((4 - (bytesNeeded % 4)) % 4) / this->VBO->GetDataTypeSize();
+  const unsigned int tupleSize = this->VBO->GetNumberOfComponents() + extraComponents;
 
-  // If not shift & scale
-  if (!this->VBO->GetCoordShiftAndScaleEnabled())
-  {
-    for (const auto tuple : dataRange)
+  vtkSMPTools::For(0, array->GetNumberOfTuples(), [&](vtkIdType begin, vtkIdType end) {
+    const auto dataRange = vtk::DataArrayTupleRange(array, begin, end);
+    destType* VBOit = VBOBegin + begin * tupleSize;
+
+    // If not shift & scale
+    if (!this->VBO->GetCoordShiftAndScaleEnabled())
     {
-      VBOit = std::copy(tuple.cbegin(), tuple.cend(), VBOit);
-      VBOit += extraComponents;
+      for (const auto tuple : dataRange)
+      {
+        VBOit = std::copy(tuple.cbegin(), tuple.cend(), VBOit);
+        VBOit += extraComponents;
+      }
     }
-  }
-  else
-  {
-    for (const auto tuple : dataRange)
+    else
     {
-      for (int j = 0; j < tuple.size(); ++j)
+      for (const auto tuple : dataRange)
       {
-        *(VBOit++) = (tuple[j] - this->Shift[j]) * this->Scale[j];
+        for (int j = 0; j < tuple.size(); ++j)
+        {
+          *(VBOit++) =
+            ConvertShiftScaled<destType>((tuple[j] - this->Shift[j]) * this->Scale[j]);
+        }
+        VBOit += extraComponents;
       }
-      VBOit += extraComponents;
-    }
-  } // end if shift*scale
+    } // end if shift*scale
+  });
 }
 
 } // end anon namespace
 
+void vtkOpenGLVertexBufferObject::SetCompression(int compression)
+{
+  if (this->Compression == compression)
+  {
+    return;
+  }
+  this->Compression = compression;
+  if (compression != NO_COMPRESSION)
+  {
+    this->SetDataType(VTK_SHORT);
+  }
+  else
+  {
+    // back to uncompressed values, the shift and scale are recomputed
+    this->CoordShiftAndScaleEnabled = false;
+    this->Shift.clear();
+    this->Scale.clear();
+  }
+  this->Modified();
+}
+
 void vtkOpenGLVertexBufferObject::SetDataType(int v)
 {
   if (this->DataType == v)
@@ -408,6 +530,26 @@ void vtkOpenGLVertexBufferObject::SetProp3D(vtkProp3D* prop)
 // update shift scale for methods that are computed such as auto or camera
 void vtkOpenGLVertexBufferObject::UpdateShiftScale(vtkDataArray* array)
 {
+  // quantized coordinates map the range of the array to [-1, 1]
+  if (this->Compression == QUANTIZE_COORDINATES)
+  {
+    std::vector<double> shift;
+    std::vector<double> scale;
+    for (int i = 0; i < array->GetNumberOfComponents(); ++i)
+    {
+      double range[2];
+      array->GetRange(range, i);
+      shift.push_back(0.5 * (range[1] + range[0]));
+      double delta = range[1] - range[0];
+      scale.push_back(delta > 0 ? 2.0 / delta : 1.0);
+    }
+    this->SetShift(shift);
+    this->SetScale(scale);
+    // a zero shift and unit scale still have to be reported as enabled
+    this->CoordShiftAndScaleEnabled = true;
+    return;
+  }
+
   // first consider auto
   bool useSS = false;
   if (this->GetCoordShiftAndScaleMethod() == ShiftScaleMethod::AUTO_SHIFT_SCALE)
@@ -527,7 +669,14 @@ void vtkOpenGLVertexBufferObject::UploadDataArray(vtkDataArray* array)
     return;
   }
 
-  this->NumberOfComponents = array->GetNumberOfComponents();
+  const bool octahedral = this->Compression == OCTAHEDRAL_NORMALS;
+  if (octahedral && array->GetNumberOfComponents() != 3)
+  {
+    vtkErrorMacro(<< "Octahedral encoding needs 3 components, got "
+                  << array->GetNumberOfComponents() << ".");
+    return;
+  }
+  this->NumberOfComponents = octahedral ? 2 : array->GetNumberOfComponents();
 
   // Set stride (size of a tuple in bytes on the VBO) based on the data
   int bytesNeeded = this->NumberOfComponents * this->DataTypeSize;
@@ -536,16 +685,39 @@ void vtkOpenGLVertexBufferObject::UploadDataArray(vtkDataArray* array)
   this->Stride = (this->NumberOfComponents + extraComponents) * this->DataTypeSize;
 
   // handle any shift scale calcs required before upload
-  this->UpdateShiftScale(array);
+  if (!octahedral)
+  {
+    this->UpdateShiftScale(array);
+  }
 
   // can we use the fast path and just upload the raw array?
-  if (!this->GetCoordShiftAndScaleEnabled() && this->DataType == array->GetDataType() &&
-    extraComponents == 0)
+  if (this->Compression == NO_COMPRESSION && !this->GetCoordShiftAndScaleEnabled() &&
+    this->DataType == array->GetDataType() && extraComponents == 0)
   {
-    this->NumberOfTuples = array->GetNumberOfTuples();
+    const unsigned int numTuples = static_cast<unsigned int>(array->GetNumberOfTuples());
     this->PackedVBO.resize(0);
-    this->Upload(reinterpret_cast<float*>(array->GetVoidPointer(0)),
-      this->NumberOfTuples * this->Stride / sizeof(float), vtkOpenGLBufferObject::ArrayBuffer);
+
+    // Only upload the modified tuples if the buffer holds a previous state
+    // of the same array
+    vtkNew<vtkIdTypeArray> ranges;
+    if (this->UploadedArray == array && this->NumberOfTuples == numTuples && this->IsReady() &&
+      array->GetModifiedTupleRanges(this->UploadTime.GetMTime(), ranges))
+    {
+      const unsigned char* bytes = static_cast<const unsigned char*>(array->GetVoidPointer(0));
+      for (vtkIdType i = 0; i < ranges->GetNumberOfTuples(); ++i)
+      {
+        const vtkIdType offset = ranges->GetTypedComponent(i, 0) * this->Stride;
+        const vtkIdType size = ranges->GetTypedComponent(i, 1) * this->Stride - offset;
+        this->UploadRange(bytes + offset, offset, size, vtkOpenGLBufferObject::ArrayBuffer);
+      }
+    }
+    else
+    {
+      this->NumberOfTuples = numTuples;
+      this->Upload(reinterpret_cast<float*>(array->GetVoidPointer(0)),
+        this->NumberOfTuples * this->Stride / sizeof(float), vtkOpenGLBufferObject::ArrayBuffer);
+    }
+    this->UploadedArray = array;
     this->UploadTime.Modified();
   }
   // otherwise use a worker to build the array to upload
@@ -553,17 +725,43 @@ void vtkOpenGLVertexBufferObject::UploadDataArray(vtkDataArray* array)
   {
     this->NumberOfTuples = array->GetNumberOfTuples();
 
-    // Resize VBO to fit new array
-    this->PackedVBO.resize(this->NumberOfTuples * this->Stride / sizeof(float));
+    // With a persistently mapped buffer the worker writes the converted
+    // values in place, otherwise it fills the PackedVBO which is uploaded.
+    void* mapped = this->BeginPersistentUpload(
+      static_cast<size_t>(this->NumberOfTuples) * this->Stride, vtkOpenGLBufferObject::ArrayBuffer);
+    if (!mapped)
+    {
+      // Resize VBO to fit new array
+      this->PackedVBO.resize(this->NumberOfTuples * this->Stride / sizeof(float));
+    }
 
     // Dispatch based on the array data type
     typedef vtkArrayDispatch::DispatchByValueType<vtkArrayDispatch::AllTypes> Dispatcher;
     bool result = true;
-    switch (this->DataType)
+    switch (octahedral ? -1 : this->DataType)
     {
+      case -1:
+      {
+        vtkOctahedralNormalsWorker worker(
+          static_cast<short*>(mapped ? mapped : static_cast<void*>(this->PackedVBO.data())));
+        if (!Dispatcher::Execute(array, worker))
+        {
+          worker(array);
+        }
+        break;
+      }
+      case VTK_SHORT:
+      {
+        vtkAppendVBOWorker<short> worker(this, 0, this->GetShift(), this->GetScale(), mapped);
+        if (!Dispatcher::Execute(array, worker))
+        {
+          worker(array);
+        }
+        break;
+      }
       case VTK_FLOAT:
       {
-        vtkAppendVBOWorker<float> worker(this, 0, this->GetShift(), this->GetScale());
+        vtkAppendVBOWorker<float> worker(this, 0, this->GetShift(), this->GetScale(), mapped);
         // result = Dispatcher::Execute(array, worker);
         if (!Dispatcher::Execute(array, worker))
         {
@@ -573,7 +771,8 @@ void vtkOpenGLVertexBufferObject::UploadDataArray(vtkDataArray* array)
       }
       case VTK_UNSIGNED_CHAR:
       {
-        vtkAppendVBOWorker<unsigned char> worker(this, 0, this->GetShift(), this->GetScale());
+        vtkAppendVBOWorker<unsigned char> worker(
+          this, 0, this->GetShift(), this->GetScale(), mapped);
         // result = Dispatcher::Execute(array, worker);
         if (!Dispatcher::Execute(array, worker))
         {
@@ -589,7 +788,16 @@ void vtkOpenGLVertexBufferObject::UploadDataArray(vtkDataArray* array)
     }
 
     this->Modified();
-    this->UploadVBO();
+    if (mapped)
+    {
+      this->EndPersistentUpload();
+      this->UploadedArray = nullptr;
+      this->UploadTime.Modified();
+    }
+    else
+    {
+      this->UploadVBO();
+    }
   }
 }
 
@@ -663,6 +871,7 @@ void vtkOpenGLVertexBufferObject::AppendDataArray(vtkDataArray* array)
 //------------------------------------------------------------------------------
 void vtkOpenGLVertexBufferObject::UploadVBO()
 {
+  this->UploadedArray = nullptr;
   this->Upload(this->PackedVBO, vtkOpenGLBufferObject::ArrayBuffer);
   this->PackedVBO.resize(0);
   this->UploadTime.Modified();
@@ -26,6 +26,7 @@ union vtkFourByteUnion {
 };
 
 class vtkCamera;
+class vtkDataArray;
 class vtkProp3D;
 
 class VTKRENDERINGOPENGL2_EXPORT vtkOpenGLVertexBufferObject : public vtkOpenGLBufferObject
@@ -37,7 +38,10 @@ public:
 
   // set the VBOs data to the provided data array and upload
   // this can use a fast path of just passing the
-  // data array pointer to OpenGL if it is suitable
+  // data array pointer to OpenGL if it is suitable.
+  // When the fast path is used and the array only had some
+  // tuples modified since the last upload (see
+  // vtkDataArray::ModifiedTuples) only those are uploaded
   void UploadDataArray(vtkDataArray* array);
 
   // append a data array to this VBO, always
@@ -119,11 +123,36 @@ public:
   static void GlobalCoordShiftAndScaleEnabledOff() { SetGlobalCoordShiftAndScaleEnabled(0); }
   static vtkTypeBool GetGlobalCoordShiftAndScaleEnabled();
 
+  // Use persistently mapped, double buffered storage for the VBOs created
+  // from now on, when the context supports it. Geometry that changes every
+  // frame is then converted and copied by the vtkSMPTools threads directly
+  // into the buffer the GPU is not reading, instead of reallocating the
+  // buffer on the render thread. Off by default.
+  // See vtkOpenGLBufferObject::SetPersistentMapping.
+  static void SetGlobalPersistentMappingEnabled(vtkTypeBool val);
+  static void GlobalPersistentMappingEnabledOn() { SetGlobalPersistentMappingEnabled(1); }
+  static void GlobalPersistentMappingEnabledOff() { SetGlobalPersistentMappingEnabled(0); }
+  static vtkTypeBool GetGlobalPersistentMappingEnabled();
+
   // Set/Get the DataType to use for the VBO
   // As a side effect sets the DataTypeSize
   void SetDataType(int v);
   vtkGetMacro(DataType, int);
 
+  // Compressed storage used by UploadDataArray. QUANTIZE_COORDINATES stores
+  // each component as a 16 bit normalized integer relative to the range of
+  // the array, through a shift and scale that the mapper inverts like any
+  // other. OCTAHEDRAL_NORMALS stores unit vectors as two 16 bit normalized
+  // integers which the shader decodes. Both set the DataType to VTK_SHORT.
+  enum CompressionType
+  {
+    NO_COMPRESSION = 0,
+    QUANTIZE_COORDINATES,
+    OCTAHEDRAL_NORMALS
+  };
+  void SetCompression(int compression);
+  vtkGetMacro(Compression, int);
+
   // Get the size in bytes of the data type
   vtkGetMacro(DataTypeSize, unsigned int);
 
@@ -164,6 +193,7 @@ protected:
   unsigned int NumberOfTuples;
   int DataType;
   unsigned int DataTypeSize;
+  int Compression = NO_COMPRESSION;
 
   int CoordShiftAndScaleMethod;
   bool CoordShiftAndScaleEnabled;
@@ -175,12 +205,18 @@ protected:
   vtkWeakPointer<vtkCamera> Camera;
   vtkWeakPointer<vtkProp3D> Prop3D;
 
+  // The array last uploaded with the fast path, if the buffer holds it
+  vtkWeakPointer<vtkDataArray> UploadedArray;
+
 private:
   vtkOpenGLVertexBufferObject(const vtkOpenGLVertexBufferObject&) = delete;
   void operator=(const vtkOpenGLVertexBufferObject&) = delete;
 
   // Initialize static member that controls shifts and scales
   static vtkTypeBool GlobalCoordShiftAndScaleEnabled;
+
+  // Initialize static member that controls persistent mapping
+  static vtkTypeBool GlobalPersistentMappingEnabled;
 };
 
 VTK_ABI_NAMESPACE_END
@@ -262,9 +262,10 @@ void vtkOpenGLVertexBufferObjectGroup::AddAllAttributesToVAO(
     if (program->IsAttributeUsed(dataShaderName.c_str()))
     {
       vtkOpenGLVertexBufferObject* vbo = i->second;
+      // colors and compressed attributes are normalized integers
       if (!vao->AddAttributeArray(program, vbo, dataShaderName,
-            0,                                          // offset see assert later in this file
-            (vbo->GetDataType() == VTK_UNSIGNED_CHAR))) // TODO: fix tweak. true for colors.
+            0, // offset see assert later in this file
+            (vbo->GetDataType() == VTK_UNSIGNED_CHAR || vbo->GetDataType() == VTK_SHORT)))
       {
         vtkErrorMacro(<< "Error setting '" << dataShaderName << "' in shader VAO.");
       }
@@ -351,7 +352,9 @@ void vtkOpenGLVertexBufferObjectGroup::BuildAllVBOs(vtkOpenGLVertexBufferObjectC
     std::vector<vtkDataArray*>& vec = i->second;
     vtkOpenGLVertexBufferObject* vbo = this->UsedVBOs[attribute];
 
-    if (vec.size() == 1 && vec[0]->GetMTime() > vbo->GetUploadTime())
+    // the VBO itself changes when its data type or compression does
+    if (vec.size() == 1 &&
+      (vec[0]->GetMTime() > vbo->GetUploadTime() || vbo->GetMTime() > vbo->GetUploadTime()))
     {
       vbo->UploadDataArray(vec[0]);
     }
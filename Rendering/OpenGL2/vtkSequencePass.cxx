@@ -4,6 +4,10 @@
 #include "vtkSequencePass.h"
 #include "vtkObjectFactory.h"
 #include "vtkRenderPassCollection.h"
+#include "vtkRenderState.h"
+#include "vtkRenderTimerLog.h"
+#include "vtkRenderWindow.h"
+#include "vtkRenderer.h"
 #include <cassert>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -54,8 +58,10 @@ void vtkSequencePass::Render(const vtkRenderState* s)
   {
     this->Passes->InitTraversal();
     vtkRenderPass* p = this->Passes->GetNextRenderPass();
+    vtkRenderTimerLog* timer = s->GetRenderer()->GetRenderWindow()->GetRenderTimer();
     while (p)
     {
+      VTK_SCOPED_RENDER_EVENT(p->GetClassName(), timer);
       p->Render(s);
       this->NumberOfRenderedProps += p->GetNumberOfRenderedProps();
       p = this->Passes->GetNextRenderPass();
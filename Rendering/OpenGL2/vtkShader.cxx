@@ -31,6 +31,11 @@ void vtkShader::SetSource(const std::string& source)
 }
 
 bool vtkShader::Compile()
+{
+  return this->StartCompile() && this->CheckCompileStatus();
+}
+
+bool vtkShader::StartCompile()
 {
   if (this->Source.empty() || this->ShaderType == Unknown || !this->Dirty)
   {
@@ -79,6 +84,20 @@ bool vtkShader::Compile()
   const GLchar* source = static_cast<const GLchar*>(this->Source.c_str());
   glShaderSource(handle, 1, &source, nullptr);
   glCompileShader(handle);
+  this->Handle = static_cast<int>(handle);
+  this->Dirty = false;
+
+  return true;
+}
+
+bool vtkShader::CheckCompileStatus()
+{
+  if (this->Handle == 0)
+  {
+    return false;
+  }
+
+  GLuint handle = static_cast<GLuint>(this->Handle);
   GLint isCompiled;
   glGetShaderiv(handle, GL_COMPILE_STATUS, &isCompiled);
 
@@ -95,13 +114,11 @@ bool vtkShader::Compile()
       delete[] logMessage;
     }
     glDeleteShader(handle);
+    this->Handle = 0;
+    this->Dirty = true;
     return false;
   }
 
-  // The shader compiled, store its handle and return success.
-  this->Handle = static_cast<int>(handle);
-  this->Dirty = false;
-
   return true;
 }
 
@@ -64,6 +64,17 @@ public:
    */
   bool Compile();
 
+  /** Start compiling the shader without waiting for the result, which lets
+   * drivers with KHR_parallel_shader_compile compile in the background.
+   * Return false only if the shader could not be created.
+   */
+  bool StartCompile();
+
+  /** Wait for the compilation started by StartCompile and return whether it
+   * succeeded. On failure, the error is set and the shader is deleted.
+   */
+  bool CheckCompileStatus();
+
   /** Delete the shader.
    * @note This should only be done once the ShaderProgram is done with the
    * Shader.
@@ -367,6 +367,11 @@ bool vtkShaderProgram::Link()
     return true;
   }
 
+  return this->StartLink() && this->CheckLinkStatus();
+}
+
+bool vtkShaderProgram::StartLink()
+{
   if (this->Handle == 0)
   {
     this->Error = "Program has not been initialized, and/or does not have shaders.";
@@ -391,8 +396,21 @@ bool vtkShaderProgram::Link()
   }
 #endif
 
-  GLint isCompiled;
+#if defined(GL_ES_VERSION_3_0) || defined(GL_PROGRAM_BINARY_RETRIEVABLE_HINT)
+  if (this->ProgramBinaryRetrievable && vtkShaderProgram::IsProgramBinarySupported())
+  {
+    glProgramParameteri(
+      static_cast<GLuint>(this->Handle), GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+  }
+#endif
+
   glLinkProgram(static_cast<GLuint>(this->Handle));
+  return true;
+}
+
+bool vtkShaderProgram::CheckLinkStatus()
+{
+  GLint isCompiled;
   glGetProgramiv(static_cast<GLuint>(this->Handle), GL_LINK_STATUS, &isCompiled);
   if (isCompiled == 0)
   {
@@ -436,6 +454,10 @@ bool vtkShaderProgram::Bind()
     }
     this->CompileShader();
   }
+  if (this->CompilePending && !this->FinishCompileShader())
+  {
+    return false;
+  }
   if (!this->Linked && !this->Link())
   {
     return false;
@@ -523,17 +545,204 @@ int vtkShaderProgram::CompileShader()
   return 1;
 }
 
+bool vtkShaderProgram::StartCompileShader()
+{
+  std::vector<vtkShader*> shaders = { this->GetVertexShader(), this->GetFragmentShader() };
+#ifdef GL_GEOMETRY_SHADER
+  if (!this->GetGeometryShader()->GetSource().empty())
+  {
+    shaders.push_back(this->GetGeometryShader());
+  }
+#endif
+
+  // the driver may compile in the background, errors are reported when
+  // the compilation is finished
+  for (vtkShader* shader : shaders)
+  {
+    if (!shader->GetSource().empty() && !shader->StartCompile())
+    {
+      this->ReportShaderError(shader);
+      return false;
+    }
+  }
+  for (vtkShader* shader : shaders)
+  {
+    if (!this->AttachShader(shader))
+    {
+      vtkErrorMacro(<< this->GetError());
+      return false;
+    }
+  }
+
+  // Setup transform feedback:
+  if (this->TransformFeedback)
+  {
+    this->TransformFeedback->BindVaryings(this);
+  }
+
+  if (!this->StartLink())
+  {
+    vtkErrorMacro(<< "Links failed: " << this->GetError());
+    return false;
+  }
+
+  this->CompilePending = true;
+  return true;
+}
+
+bool vtkShaderProgram::IsCompileComplete()
+{
+  if (!this->CompilePending)
+  {
+    return true;
+  }
+#if !defined(GL_ES_VERSION_3_0) && defined(GL_COMPLETION_STATUS_KHR)
+  if (vtkShaderProgram::IsParallelCompileSupported())
+  {
+    GLint isComplete = GL_TRUE;
+    glGetProgramiv(static_cast<GLuint>(this->Handle), GL_COMPLETION_STATUS_KHR, &isComplete);
+    return isComplete != GL_FALSE;
+  }
+#endif
+  return true;
+}
+
+int vtkShaderProgram::FinishCompileShader()
+{
+  if (!this->CompilePending)
+  {
+    return this->Compiled ? 1 : 0;
+  }
+  this->CompilePending = false;
+
+  vtkShader* shaders[3] = { this->VertexShader, this->FragmentShader, this->GeometryShader };
+  for (vtkShader* shader : shaders)
+  {
+    if (shader->GetHandle() != 0 && !shader->CheckCompileStatus())
+    {
+      this->ReportShaderError(shader);
+      return 0;
+    }
+  }
+
+  if (!this->CheckLinkStatus())
+  {
+    vtkErrorMacro(<< "Links failed: " << this->GetError());
+    return 0;
+  }
+
+  this->Compiled = true;
+  return 1;
+}
+
 void vtkShaderProgram::Release()
 {
   glUseProgram(0);
   this->Bound = false;
 }
 
+bool vtkShaderProgram::IsProgramBinarySupported()
+{
+#if defined(GL_ES_VERSION_3_0) || defined(GL_NUM_PROGRAM_BINARY_FORMATS)
+#ifndef GL_ES_VERSION_3_0
+  if (!GLEW_VERSION_4_1 && !GLEW_ARB_get_program_binary)
+  {
+    return false;
+  }
+#endif
+  GLint numberOfFormats = 0;
+  glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numberOfFormats);
+  return numberOfFormats > 0;
+#else
+  return false;
+#endif
+}
+
+bool vtkShaderProgram::IsParallelCompileSupported()
+{
+#if !defined(GL_ES_VERSION_3_0) && defined(GL_COMPLETION_STATUS_KHR)
+  return GLEW_KHR_parallel_shader_compile || GLEW_ARB_parallel_shader_compile;
+#else
+  return false;
+#endif
+}
+
+bool vtkShaderProgram::GetProgramBinary(unsigned int& format, std::vector<unsigned char>& binary)
+{
+  binary.clear();
+#if defined(GL_ES_VERSION_3_0) || defined(GL_PROGRAM_BINARY_LENGTH)
+  if (!this->Linked || this->Handle == 0 || !vtkShaderProgram::IsProgramBinarySupported())
+  {
+    return false;
+  }
+  GLint length = 0;
+  glGetProgramiv(static_cast<GLuint>(this->Handle), GL_PROGRAM_BINARY_LENGTH, &length);
+  if (length <= 0)
+  {
+    return false;
+  }
+  binary.resize(static_cast<size_t>(length));
+  GLsizei written = 0;
+  GLenum binaryFormat = 0;
+  glGetProgramBinary(
+    static_cast<GLuint>(this->Handle), length, &written, &binaryFormat, binary.data());
+  if (written <= 0)
+  {
+    binary.clear();
+    return false;
+  }
+  binary.resize(static_cast<size_t>(written));
+  format = static_cast<unsigned int>(binaryFormat);
+  return true;
+#else
+  (void)format;
+  return false;
+#endif
+}
+
+bool vtkShaderProgram::LoadProgramBinary(
+  unsigned int format, const std::vector<unsigned char>& binary)
+{
+#if defined(GL_ES_VERSION_3_0) || defined(GL_PROGRAM_BINARY_LENGTH)
+  // the shaders must not have been attached to a program yet
+  if (this->Handle != 0 || binary.empty() || !vtkShaderProgram::IsProgramBinarySupported())
+  {
+    return false;
+  }
+  GLuint handle = glCreateProgram();
+  if (handle == 0)
+  {
+    this->Error = "Could not create shader program.";
+    return false;
+  }
+  glProgramBinary(
+    handle, static_cast<GLenum>(format), binary.data(), static_cast<GLsizei>(binary.size()));
+  GLint isLinked = 0;
+  glGetProgramiv(handle, GL_LINK_STATUS, &isLinked);
+  if (isLinked == 0)
+  {
+    glDeleteProgram(handle);
+    this->Error = "The program binary was rejected by the driver.";
+    return false;
+  }
+
+  this->ClearMaps();
+  this->Handle = static_cast<int>(handle);
+  this->Linked = true;
+  this->Compiled = true;
+  return true;
+#else
+  (void)format;
+  (void)binary;
+  return false;
+#endif
+}
+
 void vtkShaderProgram::ReleaseGraphicsResources(vtkWindow* win)
 {
   this->Release();
 
-  if (this->Compiled)
+  if (this->Compiled || this->CompilePending)
   {
     this->DetachShader(this->VertexShader);
     this->DetachShader(this->FragmentShader);
@@ -542,6 +751,7 @@ void vtkShaderProgram::ReleaseGraphicsResources(vtkWindow* win)
     this->FragmentShader->Cleanup();
     this->GeometryShader->Cleanup();
     this->Compiled = false;
+    this->CompilePending = false;
   }
 
   vtkOpenGLRenderWindow* renWin = vtkOpenGLRenderWindow::SafeDownCast(win);
@@ -17,6 +17,7 @@
 
 #include <map>    // For member variables.
 #include <string> // For member variables.
+#include <vector> // For program binaries.
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkMatrix3x3;
@@ -91,6 +92,12 @@ public:
   vtkBooleanMacro(Compiled, bool);
   ///@}
 
+  /**
+   * Get whether an asynchronous compilation of this program was started by
+   * the shader cache and has not been finished yet.
+   */
+  vtkGetMacro(CompilePending, bool);
+
   /**
    * Set/Get the md5 hash of this program
    */
@@ -252,6 +259,20 @@ public:
    */
   bool IsAttributeUsed(const char* name);
 
+  /**
+   * Check if linked programs can be saved as binaries and loaded back, which
+   * requires OpenGL 4.1, GL_ARB_get_program_binary or OpenGL ES 3.0, and at
+   * least one binary format supported by the driver.
+   */
+  static bool IsProgramBinarySupported();
+
+  /**
+   * Check if the driver can compile and link programs in the background,
+   * which requires GL_KHR_parallel_shader_compile or
+   * GL_ARB_parallel_shader_compile.
+   */
+  static bool IsParallelCompileSupported();
+
   // maps of std::string are super slow when calling find
   // with a string literal or const char * as find
   // forces construction/copy/destruction of a
@@ -338,6 +359,26 @@ protected:
    */
   virtual int CompileShader();
 
+  /**
+   * Start compiling the attached shaders and linking the program without
+   * waiting for the result. IsCompileComplete tells when the driver is done
+   * and FinishCompileShader reports the result, waiting if needed.
+   * @return false if the compilation could not be started.
+   */
+  bool StartCompileShader();
+
+  /**
+   * Check, without blocking, if the compilation started by
+   * StartCompileShader is done.
+   */
+  bool IsCompileComplete();
+
+  /**
+   * Finish the compilation started by StartCompileShader, as CompileShader
+   * would have.
+   */
+  int FinishCompileShader();
+
   /**
    * Attempt to link the shader program.
    * @return false on failure. Query error to get the reason.
@@ -345,6 +386,15 @@ protected:
    */
   bool Link();
 
+  ///@{
+  /**
+   * The two halves of Link, so that the link status is only queried, which
+   * blocks, once the driver is done.
+   */
+  bool StartLink();
+  bool CheckLinkStatus();
+  ///@}
+
   /**
    * Bind the program in order to use it. If the program has not been linked
    * then link() will be called.
@@ -354,6 +404,20 @@ protected:
   /** Releases the shader program from the current context. */
   void Release();
 
+  /**
+   * Get the binary of the linked program and its driver specific format.
+   * Return false if the binary could not be retrieved.
+   */
+  bool GetProgramBinary(unsigned int& format, std::vector<unsigned char>& binary);
+
+  /**
+   * Create the program from a binary returned by GetProgramBinary instead of
+   * compiling and linking the shaders. The program is then compiled and
+   * linked. Return false if the driver rejects the binary, in which case the
+   * shaders still have to be compiled.
+   */
+  bool LoadProgramBinary(unsigned int format, const std::vector<unsigned char>& binary);
+
   /************* end **************************************/
 
   vtkShader* VertexShader;
@@ -376,6 +440,10 @@ protected:
   bool Linked;
   bool Bound;
   bool Compiled;
+  bool CompilePending = false;
+
+  // hint the driver that the binary will be retrieved after linking
+  bool ProgramBinaryRetrievable = false;
 
   // for glsl 1.5 or later, how many outputs
   // does this shader create
@@ -81,7 +81,7 @@ public:
    * Overridden to not release resources that would interfere with an external
    * application's rendering. Avoiding round trip.
    */
-  void Render() override;
+  VTK_UNBLOCKTHREADS void Render() override;
 
   /**
    * Intermediate method performs operations required between the rendering
@@ -78,7 +78,7 @@ public:
    * Overridden to not release resources that would interfere with an external
    * application's rendering. Avoiding round trip.
    */
-  void Render() override;
+  VTK_UNBLOCKTHREADS void Render() override;
 
   /**
    * Initialize the rendering window.  This will setup all system-specific
@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Composite synthetic depth and color buffers with vtkRadixKCompositer using
+// several radices, with and without compression, and check the result on the
+// first process against the closest pixel of all the processes.
+
+#include "vtkFloatArray.h"
+#include "vtkLogger.h"
+#include "vtkMPIController.h"
+#include "vtkNew.h"
+#include "vtkRadixKCompositer.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <cstdlib>
+
+namespace
+{
+constexpr int NumberOfPixels = 1037;
+
+//------------------------------------------------------------------------------
+// Depth of a pixel rendered by a process, 1 for the background.
+float GetDepth(int id, int pixel)
+{
+  unsigned int hash = (id * 2654435761u) ^ (pixel * 40503u);
+  hash ^= hash >> 13;
+  hash *= 0x5bd1e995u;
+  hash ^= hash >> 15;
+  return hash % 10 < 6 ? 1.0f : (hash % 100000) / 100000.0f;
+}
+
+//------------------------------------------------------------------------------
+unsigned char GetColor(int id, int pixel)
+{
+  return GetDepth(id, pixel) < 1.0f ? static_cast<unsigned char>(id * 7) : 200;
+}
+
+//------------------------------------------------------------------------------
+bool TestComposite(vtkMultiProcessController* controller, int radix, bool compression)
+{
+  const int myId = controller->GetLocalProcessId();
+  vtkNew<vtkUnsignedCharArray> colors;
+  colors->SetNumberOfComponents(4);
+  colors->SetNumberOfTuples(NumberOfPixels);
+  vtkNew<vtkFloatArray> depths;
+  depths->SetNumberOfTuples(NumberOfPixels);
+  for (int pixel = 0; pixel < NumberOfPixels; ++pixel)
+  {
+    depths->SetValue(pixel, GetDepth(myId, pixel));
+    for (int comp = 0; comp < 4; ++comp)
+    {
+      colors->SetTypedComponent(pixel, comp, GetColor(myId, pixel));
+    }
+  }
+
+  vtkNew<vtkRadixKCompositer> compositer;
+  compositer->SetController(controller);
+  compositer->SetRadix(radix);
+  compositer->SetUseCompression(compression);
+  vtkNew<vtkUnsignedCharArray> colorsTmp;
+  vtkNew<vtkFloatArray> depthsTmp;
+  compositer->CompositeBuffer(colors, depths, colorsTmp, depthsTmp);
+
+  if (myId != 0)
+  {
+    return true;
+  }
+  for (int pixel = 0; pixel < NumberOfPixels; ++pixel)
+  {
+    int closest = 0;
+    for (int id = 1; id < controller->GetNumberOfProcesses(); ++id)
+    {
+      if (GetDepth(id, pixel) < GetDepth(closest, pixel))
+      {
+        closest = id;
+      }
+    }
+    if (depths->GetValue(pixel) != GetDepth(closest, pixel) ||
+      colors->GetTypedComponent(pixel, 3) != GetColor(closest, pixel))
+    {
+      vtkLog(ERROR,
+        "Wrong pixel " << pixel << " with radix " << radix << " and compression "
+                       << compression);
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestRadixKCompositer(int argc, char* argv[])
+{
+  vtkNew<vtkMPIController> controller;
+  controller->Initialize(&argc, &argv);
+  vtkMultiProcessController::SetGlobalController(controller);
+
+  int retVal = EXIT_SUCCESS;
+  for (int radix : { 2, 3, 8 })
+  {
+    for (bool compression : { false, true })
+    {
+      if (!TestComposite(controller, radix, compression))
+      {
+        retVal = EXIT_FAILURE;
+      }
+    }
+  }
+
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  controller->Finalize();
+  return retVal;
+}
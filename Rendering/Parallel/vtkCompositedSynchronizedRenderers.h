@@ -27,6 +27,7 @@ public:
   ///@{
   /**
    * Get/Set the composite. vtkTreeCompositer is used by default.
+   * vtkRadixKCompositer scales better with many processes.
    */
   void SetCompositer(vtkCompositer*);
   vtkGetObjectMacro(Compositer, vtkCompositer);
@@ -0,0 +1,303 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkRadixKCompositer.h"
+#include "vtkCommunicator.h"
+#include "vtkDataArray.h"
+#include "vtkFloatArray.h"
+#include "vtkMultiProcessController.h"
+#include "vtkObjectFactory.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+constexpr int RADIXK_ROUND_TAG = 9920;
+constexpr int RADIXK_GATHER_TAG = 9921;
+
+//------------------------------------------------------------------------------
+// Split the number of processes into factors no larger than the radix when possible.
+std::vector<int> ComputeFactors(int numProcs, int radix)
+{
+  std::vector<int> factors;
+  while (numProcs > 1)
+  {
+    int factor = 0;
+    for (int candidate = std::min(radix, numProcs); candidate > 1; --candidate)
+    {
+      if (numProcs % candidate == 0)
+      {
+        factor = candidate;
+        break;
+      }
+    }
+    if (factor == 0)
+    {
+      // smallest divisor, larger than the radix
+      factor = radix + 1;
+      while (numProcs % factor != 0)
+      {
+        ++factor;
+      }
+    }
+    factors.push_back(factor);
+    numProcs /= factor;
+  }
+  return factors;
+}
+
+//------------------------------------------------------------------------------
+// Part `index` of the range [begin, end) split in `count` parts.
+void GetPart(vtkIdType& begin, vtkIdType& end, int count, int index)
+{
+  const vtkIdType length = end - begin;
+  end = begin + length * (index + 1) / count;
+  begin = begin + length * index / count;
+}
+
+//------------------------------------------------------------------------------
+// Partner of `position` at `step` of a round-robin schedule between `count`
+// positions, or -1 when idle. Every pair of positions meets exactly once in the
+// `count - 1` steps (`count` steps when it is odd).
+int GetPartner(int position, int step, int count)
+{
+  const int modulo = count + (count % 2) - 1;
+  int partner;
+  if (position == modulo)
+  {
+    partner = step;
+  }
+  else
+  {
+    partner = ((2 * step - position) % modulo + modulo) % modulo;
+    partner = partner == position ? modulo : partner;
+  }
+  return partner < count ? partner : -1;
+}
+
+//------------------------------------------------------------------------------
+// Depth and color buffers of an image, the color being handled as raw bytes.
+struct ImageBuffers
+{
+  float* Depth;
+  unsigned char* Color;
+  int ColorSize;
+
+  // Maximum size of a message holding `length` pixels.
+  vtkIdType GetMaximumMessageSize(vtkIdType length) const
+  {
+    return sizeof(vtkTypeInt32) * (length + 2) + (sizeof(float) + this->ColorSize) * length;
+  }
+
+  // Pack the pixels [begin, end). The compressed message holds the number of runs
+  // of active pixels, the runs as offset and length pairs, then their depth and
+  // color.
+  void Pack(vtkIdType begin, vtkIdType end, bool compress, std::vector<unsigned char>& message)
+  {
+    const vtkIdType length = end - begin;
+    message.clear();
+    if (!compress)
+    {
+      message.resize((sizeof(float) + this->ColorSize) * length);
+      std::memcpy(message.data(), this->Depth + begin, sizeof(float) * length);
+      std::memcpy(message.data() + sizeof(float) * length, this->Color + this->ColorSize * begin,
+        this->ColorSize * length);
+      return;
+    }
+
+    std::vector<vtkTypeInt32> runs(1, 0);
+    vtkIdType numberOfActive = 0;
+    for (vtkIdType pixel = begin; pixel < end;)
+    {
+      if (this->Depth[pixel] >= 1.0f)
+      {
+        ++pixel;
+        continue;
+      }
+      const vtkIdType start = pixel;
+      while (pixel < end && this->Depth[pixel] < 1.0f)
+      {
+        ++pixel;
+      }
+      runs.push_back(static_cast<vtkTypeInt32>(start - begin));
+      runs.push_back(static_cast<vtkTypeInt32>(pixel - start));
+      numberOfActive += pixel - start;
+    }
+    runs[0] = static_cast<vtkTypeInt32>(runs.size() / 2);
+
+    message.resize(sizeof(vtkTypeInt32) * runs.size() +
+      (sizeof(float) + this->ColorSize) * numberOfActive);
+    std::memcpy(message.data(), runs.data(), sizeof(vtkTypeInt32) * runs.size());
+    unsigned char* depth = message.data() + sizeof(vtkTypeInt32) * runs.size();
+    unsigned char* color = depth + sizeof(float) * numberOfActive;
+    for (size_t run = 1; run < runs.size(); run += 2)
+    {
+      const vtkIdType start = begin + runs[run];
+      const vtkIdType count = runs[run + 1];
+      std::memcpy(depth, this->Depth + start, sizeof(float) * count);
+      std::memcpy(color, this->Color + this->ColorSize * start, this->ColorSize * count);
+      depth += sizeof(float) * count;
+      color += this->ColorSize * count;
+    }
+  }
+
+  // Composite a message packed from pixels [begin, end) into the buffers.
+  void Composite(vtkIdType begin, vtkIdType end, bool compress, const unsigned char* message)
+  {
+    if (!compress)
+    {
+      this->CompositeRun(begin, end - begin, message, message + sizeof(float) * (end - begin));
+      return;
+    }
+
+    vtkTypeInt32 numberOfRuns;
+    std::memcpy(&numberOfRuns, message, sizeof(vtkTypeInt32));
+    std::vector<vtkTypeInt32> runs(2 * numberOfRuns);
+    std::memcpy(runs.data(), message + sizeof(vtkTypeInt32), sizeof(vtkTypeInt32) * runs.size());
+    vtkIdType numberOfActive = 0;
+    for (size_t run = 0; run < runs.size(); run += 2)
+    {
+      numberOfActive += runs[run + 1];
+    }
+    const unsigned char* depth = message + sizeof(vtkTypeInt32) * (runs.size() + 1);
+    const unsigned char* color = depth + sizeof(float) * numberOfActive;
+    for (size_t run = 0; run < runs.size(); run += 2)
+    {
+      const vtkIdType count = runs[run + 1];
+      this->CompositeRun(begin + runs[run], count, depth, color);
+      depth += sizeof(float) * count;
+      color += this->ColorSize * count;
+    }
+  }
+
+  // Keep the closest of the local pixels and the `count` remote pixels.
+  void CompositeRun(
+    vtkIdType start, vtkIdType count, const unsigned char* depth, const unsigned char* color)
+  {
+    for (vtkIdType cc = 0; cc < count; ++cc)
+    {
+      float remoteDepth;
+      std::memcpy(&remoteDepth, depth + sizeof(float) * cc, sizeof(float));
+      if (remoteDepth < this->Depth[start + cc])
+      {
+        this->Depth[start + cc] = remoteDepth;
+        std::memcpy(this->Color + this->ColorSize * (start + cc), color + this->ColorSize * cc,
+          this->ColorSize);
+      }
+    }
+  }
+};
+}
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkRadixKCompositer);
+
+//------------------------------------------------------------------------------
+vtkRadixKCompositer::vtkRadixKCompositer() = default;
+
+//------------------------------------------------------------------------------
+vtkRadixKCompositer::~vtkRadixKCompositer() = default;
+
+//------------------------------------------------------------------------------
+void vtkRadixKCompositer::CompositeBuffer(vtkDataArray* pBuf, vtkFloatArray* zBuf,
+  vtkDataArray* vtkNotUsed(pTmp), vtkFloatArray* vtkNotUsed(zTmp))
+{
+  const int myId = this->Controller->GetLocalProcessId();
+  const int numProcs = this->NumberOfProcesses;
+  if (numProcs <= 1 || myId >= numProcs)
+  {
+    return;
+  }
+
+  ::ImageBuffers image;
+  image.Depth = zBuf->GetPointer(0);
+  image.Color = static_cast<unsigned char*>(pBuf->GetVoidPointer(0));
+  image.ColorSize = pBuf->GetNumberOfComponents() * pBuf->GetDataTypeSize();
+  const vtkIdType totalPixels = zBuf->GetNumberOfTuples();
+  const std::vector<int> factors = ::ComputeFactors(numProcs, this->Radix);
+  vtkCommunicator* communicator = this->Controller->GetCommunicator();
+
+  // The pixels a process is responsible for after all the rounds.
+  auto getRegion = [&](int id, vtkIdType& begin, vtkIdType& end)
+  {
+    begin = 0;
+    end = totalPixels;
+    for (size_t round = 0, stride = 1; round < factors.size(); stride *= factors[round++])
+    {
+      ::GetPart(begin, end, factors[round], static_cast<int>((id / stride) % factors[round]));
+    }
+  };
+
+  std::vector<unsigned char> sendMessage;
+  std::vector<unsigned char> recvMessage(image.GetMaximumMessageSize(totalPixels));
+  vtkIdType begin = 0;
+  vtkIdType end = totalPixels;
+  int stride = 1;
+  for (int count : factors)
+  {
+    // Exchange the parts of the current range with the other processes of the
+    // group, ordering the blocking sends and receives of each pair.
+    const int position = (myId / stride) % count;
+    for (int step = 0; step < count + (count % 2) - 1; ++step)
+    {
+      const int partner = ::GetPartner(position, step, count);
+      if (partner < 0)
+      {
+        continue;
+      }
+      const int partnerId = myId + (partner - position) * stride;
+      vtkIdType partnerBegin = begin, partnerEnd = end;
+      ::GetPart(partnerBegin, partnerEnd, count, partner);
+      vtkIdType localBegin = begin, localEnd = end;
+      ::GetPart(localBegin, localEnd, count, position);
+      image.Pack(partnerBegin, partnerEnd, this->UseCompression, sendMessage);
+
+      const vtkIdType maximumSize = image.GetMaximumMessageSize(localEnd - localBegin);
+      for (int turn = 0; turn < 2; ++turn)
+      {
+        if ((turn == 0) == (position < partner))
+        {
+          communicator->Send(sendMessage.data(), static_cast<vtkIdType>(sendMessage.size()),
+            partnerId, RADIXK_ROUND_TAG);
+        }
+        else
+        {
+          communicator->Receive(recvMessage.data(), maximumSize, partnerId, RADIXK_ROUND_TAG);
+          image.Composite(localBegin, localEnd, this->UseCompression, recvMessage.data());
+        }
+      }
+    }
+    ::GetPart(begin, end, count, position);
+    stride *= count;
+  }
+
+  // Gather the composited parts on the first process.
+  if (myId == 0)
+  {
+    for (int id = 1; id < numProcs; ++id)
+    {
+      vtkIdType idBegin, idEnd;
+      getRegion(id, idBegin, idEnd);
+      communicator->Receive(recvMessage.data(), image.GetMaximumMessageSize(idEnd - idBegin), id,
+        RADIXK_GATHER_TAG);
+      image.Composite(idBegin, idEnd, this->UseCompression, recvMessage.data());
+    }
+  }
+  else
+  {
+    image.Pack(begin, end, this->UseCompression, sendMessage);
+    communicator->Send(sendMessage.data(), static_cast<vtkIdType>(sendMessage.size()), 0,
+      RADIXK_GATHER_TAG);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkRadixKCompositer::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Radix: " << this->Radix << endl;
+  os << indent << "UseCompression: " << this->UseCompression << endl;
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkRadixKCompositer
+ * @brief   Implements radix-k and binary-swap compositing.
+ *
+ *
+ * vtkRadixKCompositer operates in multiple processes. The image is split
+ * among the processes in rounds: in each round, the processes are arranged in
+ * groups of at most `Radix` processes, which exchange the parts of the image
+ * they are responsible for and composite them with the depth buffer. Unlike
+ * tree compositing, all the processes work on a fraction of the image in each
+ * round, so the amount of data sent by each process does not grow with the
+ * number of processes. The composited parts are finally gathered on process
+ * 0. A radix of 2 with a power-of-two number of processes gives binary-swap
+ * compositing. Other numbers of processes are factored into groups, and a
+ * prime factor larger than the radix forms a single group.
+ *
+ * When `UseCompression` is on, only the active pixels, whose depth is smaller
+ * than the far plane, are sent, as runs of consecutive pixels.
+ *
+ * Like the other compositers, it does not handle transparency.
+ *
+ * @sa
+ * vtkTreeCompositer, vtkCompressCompositer, vtkCompositedSynchronizedRenderers
+ */
+
+#ifndef vtkRadixKCompositer_h
+#define vtkRadixKCompositer_h
+
+#include "vtkCompositer.h"
+#include "vtkRenderingParallelModule.h" // For export macro
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKRENDERINGPARALLEL_EXPORT vtkRadixKCompositer : public vtkCompositer
+{
+public:
+  static vtkRadixKCompositer* New();
+  vtkTypeMacro(vtkRadixKCompositer, vtkCompositer);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  void CompositeBuffer(
+    vtkDataArray* pBuf, vtkFloatArray* zBuf, vtkDataArray* pTmp, vtkFloatArray* zTmp) override;
+
+  ///@{
+  /**
+   * Get/Set the maximum number of processes exchanging parts of the image in
+   * a round. Default is 8.
+   */
+  vtkSetClampMacro(Radix, int, 2, VTK_INT_MAX);
+  vtkGetMacro(Radix, int);
+  ///@}
+
+  ///@{
+  /**
+   * Get/Set whether only the active pixels are sent. Default is on.
+   */
+  vtkSetMacro(UseCompression, bool);
+  vtkGetMacro(UseCompression, bool);
+  vtkBooleanMacro(UseCompression, bool);
+  ///@}
+
+protected:
+  vtkRadixKCompositer();
+  ~vtkRadixKCompositer() override;
+
+  int Radix = 8;
+  bool UseCompression = true;
+
+private:
+  vtkRadixKCompositer(const vtkRadixKCompositer&) = delete;
+  void operator=(const vtkRadixKCompositer&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
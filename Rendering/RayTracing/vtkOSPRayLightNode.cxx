@@ -15,6 +15,7 @@
 #include "vtkOpenGLRenderer.h"
 #include "vtkTransform.h"
 
+#include <algorithm>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -142,10 +143,31 @@ void vtkOSPRayLightNode::Render(bool prepass)
     RTW::Backend* backend = orn->GetBackend();
     if (backend == nullptr)
       return;
-    ospRelease((OSPLight)this->OLight);
-    OSPLight ospLight;
 
+    // reuse the light when nothing it depends on changed, which also lets the renderer
+    // node keep its world
     vtkLight* light = vtkLight::SafeDownCast(this->GetRenderable());
+    vtkMTimeType inTime = std::max(light->GetMTime(), light->GetInformation()->GetMTime());
+    if (vtkMatrix4x4* lightTransfo = light->GetTransformMatrix())
+    {
+      inTime = std::max(inTime, lightTransfo->GetMTime());
+    }
+    if (userLightTransfo)
+    {
+      inTime = std::max(inTime, userLightTransfo->GetMTime());
+      inTime = std::max(inTime, ren->GetActiveCamera()->GetMTime());
+    }
+    if (this->OLight && this->RenderTime >= inTime &&
+      this->LastLightScale == vtkOSPRayLightNode::LightScale)
+    {
+      orn->AddLight((OSPLight)this->OLight);
+      return;
+    }
+    this->RenderTime = inTime;
+    this->LastLightScale = vtkOSPRayLightNode::LightScale;
+
+    ospRelease((OSPLight)this->OLight);
+    OSPLight ospLight;
 
     float color[3] = { 0.0, 0.0, 0.0 };
     if (light->GetSwitch())
@@ -85,6 +85,7 @@ private:
 
   static double LightScale;
   void* OLight;
+  double LastLightScale = 0.0;
 };
 
 VTK_ABI_NAMESPACE_END
@@ -486,6 +486,7 @@ vtkOSPRayRendererNode::~vtkOSPRayRendererNode()
     ospRelease(this->ORenderer);
     ospRelease(this->OFrameBuffer);
     ospRelease(this->OCamera);
+    ospRelease(this->DefaultAmbientLight);
     this->CacheContents.clear();
     this->Cache->SetSize(0);
     this->Lights.clear();
@@ -1087,13 +1088,20 @@ void vtkOSPRayRendererNode::Traverse(int operation)
   if (!hasAmbient && (this->GetAmbientSamples(static_cast<vtkRenderer*>(this->Renderable)) > 0))
   {
     // hardcode an ambient light for AO since OSP 1.2 stopped doing so.
-    OSPLight ospAmbient = ospNewLight("ambient");
-    ospSetString(ospAmbient, "name", "default_ambient");
-    ospSetVec3f(ospAmbient, "color", 1.f, 1.f, 1.f);
-    ospSetFloat(
-      ospAmbient, "intensity", 0.13f * vtkOSPRayLightNode::GetLightScale() * vtkMath::Pi());
-    ospCommit(ospAmbient);
-    this->Lights.push_back(ospAmbient);
+    // It is kept across frames so that the world does not have to be rebuilt.
+    if (this->DefaultAmbientLight == nullptr ||
+      this->DefaultAmbientLightScale != vtkOSPRayLightNode::GetLightScale())
+    {
+      ospRelease(this->DefaultAmbientLight);
+      this->DefaultAmbientLight = ospNewLight("ambient");
+      this->DefaultAmbientLightScale = vtkOSPRayLightNode::GetLightScale();
+      ospSetString(this->DefaultAmbientLight, "name", "default_ambient");
+      ospSetVec3f(this->DefaultAmbientLight, "color", 1.f, 1.f, 1.f);
+      ospSetFloat(this->DefaultAmbientLight, "intensity",
+        0.13f * vtkOSPRayLightNode::GetLightScale() * vtkMath::Pi());
+      ospCommit(this->DefaultAmbientLight);
+    }
+    this->Lights.push_back(this->DefaultAmbientLight);
   }
 
   bool bpreused = this->Internal->SetupPathTraceBackground(true, backend);
@@ -1281,13 +1289,22 @@ void vtkOSPRayRendererNode::Render(bool prepass)
     if (cached)
     {
       this->OWorld = static_cast<OSPWorld>(cached->object);
+      this->WorldInstances.clear();
+      this->WorldLights.clear();
     }
-    else
+    else if (this->OWorld == nullptr || this->Instances != this->WorldInstances ||
+      this->Lights != this->WorldLights)
     {
+      // Only rebuild the world when an instance or a light was added, removed or replaced.
+      // Unmodified actors and lights keep their handles, so their changes alone do not
+      // trigger this, and the world holds a reference on its content so that a released
+      // handle cannot be reused by a new object while it is compared here.
       if (this->CacheContents.find(this->OWorld) == this->CacheContents.end())
       {
         ospRelease(this->OWorld);
       }
+      this->WorldInstances = this->Instances;
+      this->WorldLights = this->Lights;
       this->OWorld = ospNewWorld();
       // put the model into a group (collection of models)
       OSPData lights = nullptr;
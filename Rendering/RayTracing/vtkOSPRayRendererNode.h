@@ -375,8 +375,13 @@ protected:
   OSPRenderer ORenderer{ nullptr };
   OSPFrameBuffer OFrameBuffer{ nullptr };
   OSPCamera OCamera{ nullptr };
+  OSPLight DefaultAmbientLight{ nullptr };
+  double DefaultAmbientLightScale = 0.0;
   int ImageX, ImageY;
   std::vector<OSPLight> Lights;
+  // Content of OWorld, to only rebuild it when the instances or the lights change.
+  std::vector<OSPInstance> WorldInstances;
+  std::vector<OSPLight> WorldLights;
   int NumActors;
   bool ComputeDepth;
   bool Accumulate;
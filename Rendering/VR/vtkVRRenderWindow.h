@@ -309,7 +309,7 @@ public:
    * Overridden to not release resources that would interfere with an external
    * application's rendering. Avoiding round trip.
    */
-  void Render() override;
+  VTK_UNBLOCKTHREADS void Render() override;
 
   ///@{
   /**
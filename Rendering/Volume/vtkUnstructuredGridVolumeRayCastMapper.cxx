@@ -9,13 +9,15 @@
 #include "vtkFiniteDifferenceGradientEstimator.h"
 #include "vtkIdList.h"
 #include "vtkMath.h"
-#include "vtkMultiThreader.h"
 #include "vtkObjectFactory.h"
 #include "vtkPlaneCollection.h"
 #include "vtkPointData.h"
 #include "vtkRayCastImageDisplayHelper.h"
 #include "vtkRenderWindow.h"
 #include "vtkRenderer.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 #include "vtkTimerLog.h"
 #include "vtkTransform.h"
 #include "vtkUnstructuredGrid.h"
@@ -26,10 +28,101 @@
 #include "vtkUnstructuredGridVolumeRayCastIterator.h"
 #include "vtkVolumeProperty.h"
 
+#include <atomic>
 #include <cmath>
 
 VTK_ABI_NAMESPACE_BEGIN
-VTK_THREAD_RETURN_TYPE UnstructuredGridVolumeRayCastMapper_CastRays(void* arg);
+namespace
+{
+// Iterator and intersection buffers of a thread
+struct vtkUGVRCMRayBuffers
+{
+  vtkSmartPointer<vtkUnstructuredGridVolumeRayCastIterator> Iterator;
+  vtkSmartPointer<vtkIdList> IntersectedCells;
+  vtkSmartPointer<vtkDoubleArray> IntersectionLengths;
+  vtkSmartPointer<vtkDataArray> NearIntersections;
+  vtkSmartPointer<vtkDataArray> FarIntersections;
+
+  void Initialize(vtkUnstructuredGridVolumeRayCastFunction* function, vtkDataArray* scalars,
+    bool cellScalars)
+  {
+    this->Iterator.TakeReference(function->NewIterator());
+    if (!this->Iterator)
+    {
+      return;
+    }
+    const vtkIdType maxIntersections = this->Iterator->GetMaxNumberOfIntersections();
+    this->IntersectionLengths = vtkSmartPointer<vtkDoubleArray>::New();
+    this->IntersectionLengths->Allocate(maxIntersections);
+    this->NearIntersections.TakeReference(vtkDataArray::CreateDataArray(scalars->GetDataType()));
+    this->NearIntersections->Allocate(maxIntersections);
+    if (cellScalars)
+    {
+      this->IntersectedCells = vtkSmartPointer<vtkIdList>::New();
+      this->IntersectedCells->Allocate(maxIntersections);
+      this->FarIntersections = this->NearIntersections;
+    }
+    else
+    {
+      this->FarIntersections.TakeReference(vtkDataArray::CreateDataArray(scalars->GetDataType()));
+      this->FarIntersections->Allocate(maxIntersections);
+    }
+  }
+};
+
+// Casts the rows of the image with buffers local to each thread. The rows
+// are handed out in small ranges so that the threads stay busy even when the
+// volume covers only part of the image.
+struct vtkUGVRCMCastRaysFunctor
+{
+  vtkUnstructuredGridVolumeRayCastMapper* Mapper;
+  vtkUnstructuredGridVolumeRayCastFunction* Function;
+  vtkDataArray* Scalars;
+  bool CellScalars;
+  vtkRenderWindow* RenderWindow;
+  int NumberOfRows;
+  std::atomic<int> RowsDone{ 0 };
+  vtkSMPThreadLocal<vtkUGVRCMRayBuffers> Buffers;
+
+  void Initialize()
+  {
+    this->Buffers.Local().Initialize(this->Function, this->Scalars, this->CellScalars);
+  }
+
+  void operator()(vtkIdType rowBegin, vtkIdType rowEnd)
+  {
+    vtkUGVRCMRayBuffers& buffers = this->Buffers.Local();
+    if (!buffers.Iterator)
+    {
+      return;
+    }
+    const bool isFirst = vtkSMPTools::GetSingleThread();
+    for (vtkIdType row = rowBegin; row < rowEnd; ++row)
+    {
+      // Only the main thread may process events while checking for an abort
+      if (isFirst)
+      {
+        this->Mapper->UpdateProgress(static_cast<double>(this->RowsDone) / this->NumberOfRows);
+        if (this->RenderWindow->CheckAbortStatus())
+        {
+          return;
+        }
+      }
+      else if (this->RenderWindow->GetAbortRender())
+      {
+        return;
+      }
+
+      this->Mapper->CastRays(buffers.Iterator, buffers.IntersectedCells,
+        buffers.IntersectionLengths, buffers.NearIntersections, buffers.FarIntersections,
+        static_cast<int>(row), static_cast<int>(row + 1));
+      ++this->RowsDone;
+    }
+  }
+
+  void Reduce() {}
+};
+}
 
 vtkStandardNewMacro(vtkUnstructuredGridVolumeRayCastMapper);
 
@@ -49,8 +142,7 @@ vtkUnstructuredGridVolumeRayCastMapper::vtkUnstructuredGridVolumeRayCastMapper()
   this->ImageMemorySize[0] = 0;
   this->ImageMemorySize[1] = 0;
 
-  this->Threader = vtkMultiThreader::New();
-  this->NumberOfThreads = this->Threader->GetNumberOfThreads();
+  this->NumberOfThreads = vtkSMPTools::GetEstimatedNumberOfThreads();
 
   this->Image = nullptr;
 
@@ -78,8 +170,6 @@ vtkUnstructuredGridVolumeRayCastMapper::vtkUnstructuredGridVolumeRayCastMapper()
 // Destruct a vtkUnstructuredGridVolumeRayCastMapper - clean up any memory used
 vtkUnstructuredGridVolumeRayCastMapper::~vtkUnstructuredGridVolumeRayCastMapper()
 {
-  this->Threader->Delete();
-
   delete[] this->Image;
 
   if (this->RenderTableSize)
@@ -374,65 +464,20 @@ void vtkUnstructuredGridVolumeRayCastMapper::Render(vtkRenderer* ren, vtkVolume*
   this->CurrentVolume = vol;
   this->CurrentRenderer = ren;
 
-  // Create iterators and buffers here to prevent race conditions.
-  this->RayCastIterators = new vtkUnstructuredGridVolumeRayCastIterator*[this->NumberOfThreads];
-  this->IntersectedCellsBuffer = new vtkIdList*[this->NumberOfThreads];
-  this->IntersectionLengthsBuffer = new vtkDoubleArray*[this->NumberOfThreads];
-  this->NearIntersectionsBuffer = new vtkDataArray*[this->NumberOfThreads];
-  this->FarIntersectionsBuffer = new vtkDataArray*[this->NumberOfThreads];
-  for (i = 0; i < this->NumberOfThreads; i++)
-  {
-    this->RayCastIterators[i] = this->RayCastFunction->NewIterator();
-    this->IntersectionLengthsBuffer[i] = vtkDoubleArray::New();
-    this->IntersectionLengthsBuffer[i]->Allocate(
-      this->RayCastIterators[i]->GetMaxNumberOfIntersections());
-    this->NearIntersectionsBuffer[i] = vtkDataArray::CreateDataArray(this->Scalars->GetDataType());
-    this->NearIntersectionsBuffer[i]->Allocate(
-      this->RayCastIterators[i]->GetMaxNumberOfIntersections());
-    if (this->CellScalars)
-    {
-      this->IntersectedCellsBuffer[i] = vtkIdList::New();
-      this->IntersectedCellsBuffer[i]->Allocate(
-        this->RayCastIterators[i]->GetMaxNumberOfIntersections());
-      this->FarIntersectionsBuffer[i] = this->NearIntersectionsBuffer[i];
-    }
-    else
-    {
-      this->IntersectedCellsBuffer[i] = nullptr;
-      this->FarIntersectionsBuffer[i] = vtkDataArray::CreateDataArray(this->Scalars->GetDataType());
-      this->FarIntersectionsBuffer[i]->Allocate(
-        this->RayCastIterators[i]->GetMaxNumberOfIntersections());
-    }
-  }
-
-  // Set the number of threads to use for ray casting,
-  // then set the execution method and do it.
-  this->Threader->SetNumberOfThreads(this->NumberOfThreads);
-  this->Threader->SetSingleMethod(UnstructuredGridVolumeRayCastMapper_CastRays, (void*)this);
-  this->Threader->SingleMethodExecute();
+  // Cast the rows in parallel, each thread with its own iterator and buffers.
+  vtkUGVRCMCastRaysFunctor functor;
+  functor.Mapper = this;
+  functor.Function = this->RayCastFunction;
+  functor.Scalars = this->Scalars;
+  functor.CellScalars = this->CellScalars != 0;
+  functor.RenderWindow = ren->GetRenderWindow();
+  functor.NumberOfRows = this->ImageInUseSize[1];
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ this->NumberOfThreads },
+    [&]() { vtkSMPTools::For(0, this->ImageInUseSize[1], 1, functor); });
 
   // We don't need these anymore
   this->CurrentVolume = nullptr;
   this->CurrentRenderer = nullptr;
-  for (i = 0; i < this->NumberOfThreads; i++)
-  {
-    this->RayCastIterators[i]->Delete();
-    this->IntersectionLengthsBuffer[i]->Delete();
-    this->NearIntersectionsBuffer[i]->Delete();
-    if (this->CellScalars)
-    {
-      this->IntersectedCellsBuffer[i]->Delete();
-    }
-    else
-    {
-      this->FarIntersectionsBuffer[i]->Delete();
-    }
-  }
-  delete[] this->RayCastIterators;
-  delete[] this->IntersectedCellsBuffer;
-  delete[] this->IntersectionLengthsBuffer;
-  delete[] this->NearIntersectionsBuffer;
-  delete[] this->FarIntersectionsBuffer;
 
   if (!ren->GetRenderWindow()->GetAbortRender())
   {
@@ -464,25 +509,6 @@ void vtkUnstructuredGridVolumeRayCastMapper::Render(vtkRenderer* ren, vtkVolume*
   this->UpdateProgress(1.0);
 }
 
-VTK_THREAD_RETURN_TYPE UnstructuredGridVolumeRayCastMapper_CastRays(void* arg)
-{
-  // Get the info out of the input structure
-  int threadID = ((vtkMultiThreader::ThreadInfo*)(arg))->ThreadID;
-  int threadCount = ((vtkMultiThreader::ThreadInfo*)(arg))->NumberOfThreads;
-  vtkUnstructuredGridVolumeRayCastMapper* me =
-    (vtkUnstructuredGridVolumeRayCastMapper*)((vtkMultiThreader::ThreadInfo*)arg)->UserData;
-
-  if (!me)
-  {
-    vtkGenericWarningMacro("The volume does not have a ray cast mapper!");
-    return VTK_THREAD_RETURN_VALUE;
-  }
-
-  me->CastRays(threadID, threadCount);
-
-  return VTK_THREAD_RETURN_VALUE;
-}
-
 template <class T>
 inline void vtkUGVRCMLookupCopy(
   const T* src, T* dest, vtkIdType* lookup, int numcomponents, int numtuples)
@@ -501,24 +527,22 @@ inline void vtkUGVRCMLookupCopy(
 
 void vtkUnstructuredGridVolumeRayCastMapper::CastRays(int threadID, int threadCount)
 {
-  int i, j;
-  unsigned char* ucptr;
+  if (!this->CurrentRenderer)
+  {
+    vtkErrorMacro("Rays can only be cast while rendering.");
+    return;
+  }
 
   vtkRenderWindow* renWin = this->CurrentRenderer->GetRenderWindow();
-  vtkUnstructuredGridVolumeRayCastIterator* iterator = this->RayCastIterators[threadID];
-
-  vtkIdList* intersectedCells = this->IntersectedCellsBuffer[threadID];
-  vtkDoubleArray* intersectionLengths = this->IntersectionLengthsBuffer[threadID];
-  vtkDataArray* nearIntersections = this->NearIntersectionsBuffer[threadID];
-  vtkDataArray* farIntersections = this->FarIntersectionsBuffer[threadID];
-
-  for (j = 0; j < this->ImageInUseSize[1]; j++)
+  vtkUGVRCMRayBuffers buffers;
+  buffers.Initialize(this->RayCastFunction, this->Scalars, this->CellScalars != 0);
+  if (!buffers.Iterator)
   {
-    if (j % threadCount != threadID)
-    {
-      continue;
-    }
+    return;
+  }
 
+  for (int j = threadID; j < this->ImageInUseSize[1]; j += threadCount)
+  {
     if (!threadID)
     {
       this->UpdateProgress((double)j / this->ImageInUseSize[1]);
@@ -532,6 +556,21 @@ void vtkUnstructuredGridVolumeRayCastMapper::CastRays(int threadID, int threadCo
       break;
     }
 
+    this->CastRays(buffers.Iterator, buffers.IntersectedCells, buffers.IntersectionLengths,
+      buffers.NearIntersections, buffers.FarIntersections, j, j + 1);
+  }
+}
+
+void vtkUnstructuredGridVolumeRayCastMapper::CastRays(
+  vtkUnstructuredGridVolumeRayCastIterator* iterator, vtkIdList* intersectedCells,
+  vtkDoubleArray* intersectionLengths, vtkDataArray* nearIntersections,
+  vtkDataArray* farIntersections, int rowBegin, int rowEnd)
+{
+  int i, j;
+  unsigned char* ucptr;
+
+  for (j = rowBegin; j < rowEnd; j++)
+  {
     ucptr = this->Image + 4 * j * this->ImageMemorySize[0];
 
     for (i = 0; i < this->ImageInUseSize[0]; i++)
@@ -6,6 +6,8 @@
  * @brief   A software mapper for unstructured volumes
  *
  * This is a software ray caster for rendering volumes in vtkUnstructuredGrid.
+ * The rows of the image are cast in parallel with vtkSMPTools, so it renders
+ * unstructured volumes on nodes without a GPU.
  *
  * @sa
  * vtkVolumeMapper
@@ -14,13 +16,13 @@
 #ifndef vtkUnstructuredGridVolumeRayCastMapper_h
 #define vtkUnstructuredGridVolumeRayCastMapper_h
 
-#include "vtkRenderingVolumeModule.h" // For export macro
+#include "vtkDeprecation.h"              // For VTK_DEPRECATED_IN_9_4_0
+#include "vtkRenderingVolumeModule.h"    // For export macro
 #include "vtkUnstructuredGridVolumeMapper.h"
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkDoubleArray;
 class vtkIdList;
-class vtkMultiThreader;
 class vtkRayCastImageDisplayHelper;
 class vtkRenderer;
 class vtkTimerLog;
@@ -79,8 +81,9 @@ public:
 
   ///@{
   /**
-   * Set/Get the number of threads to use. This by default is equal to
-   * the number of available processors detected.
+   * Set/Get the maximum number of threads used to cast the rays with
+   * vtkSMPTools. This by default is equal to the number of threads
+   * vtkSMPTools estimates for its backend. 0 uses the vtkSMPTools default.
    */
   vtkSetMacro(NumberOfThreads, int);
   vtkGetMacro(NumberOfThreads, int);
@@ -131,6 +134,18 @@ public:
   vtkGetVectorMacro(ImageOrigin, int, 2);
   vtkGetVectorMacro(ImageViewportSize, int, 2);
 
+  /**
+   * WARNING: INTERNAL METHOD - NOT INTENDED FOR GENERAL USE
+   * Cast the rays of the rows [rowBegin, rowEnd) of the image in use with an
+   * iterator and intersection buffers owned by the calling thread.
+   * intersectedCells is only used with cell scalars, in which case
+   * farIntersections is the same array as nearIntersections.
+   */
+  void CastRays(vtkUnstructuredGridVolumeRayCastIterator* iterator, vtkIdList* intersectedCells,
+    vtkDoubleArray* intersectionLengths, vtkDataArray* nearIntersections,
+    vtkDataArray* farIntersections, int rowBegin, int rowEnd);
+
+  VTK_DEPRECATED_IN_9_4_0("The rays are cast with vtkSMPTools, use the row range overload.")
   void CastRays(int threadID, int threadCount);
 
 protected:
@@ -142,7 +157,6 @@ protected:
   float MaximumImageSampleDistance;
   vtkTypeBool AutoAdjustSampleDistances;
 
-  vtkMultiThreader* Threader;
   int NumberOfThreads;
 
   vtkRayCastImageDisplayHelper* ImageDisplayHelper;
@@ -192,15 +206,9 @@ protected:
   double GetMinimumBoundsDepth(vtkRenderer* ren, vtkVolume* vol);
 
   vtkUnstructuredGridVolumeRayCastFunction* RayCastFunction;
-  vtkUnstructuredGridVolumeRayCastIterator** RayCastIterators;
   vtkUnstructuredGridVolumeRayIntegrator* RayIntegrator;
   vtkUnstructuredGridVolumeRayIntegrator* RealRayIntegrator;
 
-  vtkIdList** IntersectedCellsBuffer;
-  vtkDoubleArray** IntersectionLengthsBuffer;
-  vtkDataArray** NearIntersectionsBuffer;
-  vtkDataArray** FarIntersectionsBuffer;
-
   vtkVolume* CurrentVolume;
   vtkRenderer* CurrentRenderer;
 
@@ -139,6 +139,8 @@ void safe_0_vector(inout Ray ray)
 
 //VTK::DepthPeeling::Dec
 
+//VTK::EmptySpaceSkipping::Dec
+
 uniform float in_scale;
 uniform float in_bias;
 
@@ -282,6 +284,8 @@ vec4 castRay(const float zStart, const float zEnd)
   /// For all samples along the ray
   while (!g_exit)
   {
+    //VTK::EmptySpaceSkipping::Impl
+
     //VTK::Base::Impl
 
     //VTK::Cropping::Impl
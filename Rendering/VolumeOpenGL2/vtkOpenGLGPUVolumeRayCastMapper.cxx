@@ -23,11 +23,13 @@
 #include <vtkCamera.h>
 #include <vtkCellArray.h>
 #include <vtkCellData.h>
+#include <vtkArrayDispatch.h>
 #include <vtkClipConvexPolyData.h>
 #include <vtkColorTransferFunction.h>
 #include <vtkCommand.h>
 #include <vtkContourFilter.h>
 #include <vtkDataArray.h>
+#include <vtkDataArrayRange.h>
 #include <vtkDensifyPolyData.h>
 #include <vtkFloatArray.h>
 #include <vtkImageData.h>
@@ -48,6 +50,7 @@
 #include <vtkOpenGLShaderCache.h>
 #include <vtkOpenGLShaderProperty.h>
 #include <vtkOpenGLVertexArrayObject.h>
+#include <vtkPiecewiseFunction.h>
 #include <vtkPixelBufferObject.h>
 #include <vtkPixelExtent.h>
 #include <vtkPixelTransfer.h>
@@ -59,6 +62,7 @@
 #include <vtkRectilinearGrid.h>
 #include <vtkRenderWindow.h>
 #include <vtkRenderer.h>
+#include <vtkSMPTools.h>
 #include <vtkShader.h>
 #include <vtkShaderProgram.h>
 #include <vtkSmartPointer.h>
@@ -84,13 +88,65 @@
 #include <vtkVolumeTexture.h>
 
 // C/C++ includes
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <limits>
 #include <map>
 #include <sstream>
 #include <string>
 
 VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+// Computes the scalar range of every macro cell of the volume. The range
+// includes the layer of voxels surrounding the macro cell, which trilinear
+// interpolation reaches into when sampling close to the macro cell faces.
+struct MacroCellRangeWorker
+{
+  template <typename ArrayT>
+  void operator()(
+    ArrayT* array, const int dims[3], int cellSize, const int cellDims[3], double* ranges)
+  {
+    const auto values = vtk::DataArrayValueRange<1>(array);
+    vtkSMPTools::For(0, cellDims[2], [&](vtkIdType kBegin, vtkIdType kEnd) {
+      for (vtkIdType k = kBegin; k < kEnd; ++k)
+      {
+        const vtkIdType z0 = std::max<vtkIdType>(k * cellSize - 1, 0);
+        const vtkIdType z1 = std::min<vtkIdType>((k + 1) * cellSize, dims[2] - 1);
+        for (vtkIdType j = 0; j < cellDims[1]; ++j)
+        {
+          const vtkIdType y0 = std::max<vtkIdType>(j * cellSize - 1, 0);
+          const vtkIdType y1 = std::min<vtkIdType>((j + 1) * cellSize, dims[1] - 1);
+          for (vtkIdType i = 0; i < cellDims[0]; ++i)
+          {
+            const vtkIdType x0 = std::max<vtkIdType>(i * cellSize - 1, 0);
+            const vtkIdType x1 = std::min<vtkIdType>((i + 1) * cellSize, dims[0] - 1);
+            double range[2] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MIN };
+            for (vtkIdType z = z0; z <= z1; ++z)
+            {
+              for (vtkIdType y = y0; y <= y1; ++y)
+              {
+                vtkIdType index = x0 + dims[0] * (y + dims[1] * z);
+                for (vtkIdType x = x0; x <= x1; ++x, ++index)
+                {
+                  const double value = static_cast<double>(values[index]);
+                  range[0] = std::min(range[0], value);
+                  range[1] = std::max(range[1], value);
+                }
+              }
+            }
+            double* cellRange = ranges + 2 * (i + cellDims[0] * (j + cellDims[1] * k));
+            cellRange[0] = range[0];
+            cellRange[1] = range[1];
+          }
+        }
+      }
+    });
+  }
+};
+}
+
 vtkStandardNewMacro(vtkOpenGLGPUVolumeRayCastMapper);
 
 //------------------------------------------------------------------------------
@@ -198,10 +254,23 @@ public:
       this->ImageSampleVAO->Delete();
       this->ImageSampleVAO = nullptr;
     }
+
+    if (this->ProgressiveFBO)
+    {
+      this->ProgressiveFBO->Delete();
+      this->ProgressiveFBO = nullptr;
+    }
+
+    if (this->ProgressiveVAO)
+    {
+      this->ProgressiveVAO->Delete();
+      this->ProgressiveVAO = nullptr;
+    }
     this->DeleteMaskTransfer();
 
     // Do not delete the shader programs - Let the cache clean them up.
     this->ImageSampleProg = nullptr;
+    this->ProgressiveProg = nullptr;
   }
 
   // Helper methods
@@ -245,6 +314,18 @@ public:
 
   bool LoadMask(vtkRenderer* ren, vtkVolume* vol);
 
+  ///@{
+  /**
+   * \brief Update the macro cell scalar ranges and the occupancy texture
+   * used to leap over transparent regions, and bind the texture.
+   * EmptySpaceSkipping is only true when the current configuration is
+   * supported and the occupancy texture is up to date.
+   */
+  bool IsEmptySpaceSkippingSupported(vtkVolume* vol);
+  void UpdateEmptySpaceSkipping(vtkRenderer* ren, vtkVolume* vol);
+  void SetEmptySpaceSkippingShaderParameters(vtkShaderProgram* prog);
+  ///@}
+
   // Update the depth sampler with the current state of the z-buffer. The
   // sampler is used for z-buffer compositing with opaque geometry during
   // ray-casting (rays are early-terminated if hidden begin opaque geometry).
@@ -382,6 +463,22 @@ public:
   size_t GetNumImageSampleDrawBuffers(vtkVolume* vol);
   ///@}
 
+  ///@{
+  /**
+   * Progressive rendering. The frame ray-cast in ImageSampleFBO is blended
+   * into the history texture last written, reprojected with the previous
+   * view-projection matrix at the depth of the volume center, and the
+   * result is written to the other history texture, which is then composited
+   * instead of the frame itself. AccumulateProgressiveFrame returns that
+   * texture, or nullptr if the frame could not be accumulated. The history
+   * is discarded when GetProgressiveContentTime reports a modification and
+   * weighted down when the camera or the lights changed.
+   */
+  vtkTextureObject* AccumulateProgressiveFrame(vtkRenderer* ren);
+  vtkMTimeType GetProgressiveContentTime(vtkVolume* vol);
+  void ReleaseProgressiveGraphicsResources(vtkWindow* win);
+  ///@}
+
   ///@{
   /**
    * Allocate and update input data. A list of active ports is maintained
@@ -502,6 +599,27 @@ public:
   vtkSmartPointer<vtkVolumeTexture> Transfer2DYAxisScalars;
   vtkTimeStamp Transfer2DYAxisScalarsUpdateTime;
 
+  bool EmptySpaceSkipping = false;
+  bool EmptySpaceSkippingInShader = false;
+  vtkSmartPointer<vtkTextureObject> OccupancyTexture;
+  std::vector<double> MacroCellRanges;
+  int MacroCellSize = 0;
+  int MacroCellDimensions[3] = { 0, 0, 0 };
+  int MacroCellVolumeDimensions[3] = { 0, 0, 0 };
+  vtkTimeStamp MacroCellRangesTime;
+  vtkTimeStamp OccupancyTime;
+
+  bool ProgressiveRendering = false;
+  vtkOpenGLFramebufferObject* ProgressiveFBO = nullptr;
+  vtkSmartPointer<vtkTextureObject> ProgressiveHistory[2];
+  int ProgressiveHistoryIndex = 0;
+  int ProgressiveFrames = 0;
+  unsigned int ProgressiveFrameIndex = 0;
+  vtkNew<vtkMatrix4x4> ProgressiveViewProjection;
+  vtkTimeStamp ProgressiveTime;
+  vtkShaderProgram* ProgressiveProg = nullptr;
+  vtkOpenGLVertexArrayObject* ProgressiveVAO = nullptr;
+
   vtkNew<vtkContourFilter> ContourFilter;
   vtkNew<vtkPolyDataMapper> ContourMapper;
   vtkNew<vtkActor> ContourActor;
@@ -708,6 +826,153 @@ bool vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::LoadMask(vtkRenderer* ren, vt
   return result;
 }
 
+//------------------------------------------------------------------------------
+bool vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::IsEmptySpaceSkippingSupported(vtkVolume* vol)
+{
+  if (!this->Parent->UseEmptySpaceSkipping || this->MultiVolume ||
+    this->Parent->BlendMode != vtkVolumeMapper::COMPOSITE_BLEND ||
+    this->Parent->GetScalarOpacityRangeType() != vtkGPUVolumeRayCastMapper::SCALAR ||
+    vol->GetProperty()->GetTransferFunctionMode() != vtkVolumeProperty::TF_1D ||
+    (this->Parent->MaskInput != nullptr && this->Parent->MaskType == LabelMapMaskType))
+  {
+    return false;
+  }
+
+  auto volumeTex = this->Parent->AssembledInputs[0].Texture.GetPointer();
+  vtkDataArray* scalars = volumeTex->GetLoadedScalars();
+  const auto& partitions = volumeTex->GetPartitions();
+  return scalars != nullptr && scalars->GetNumberOfComponents() == 1 &&
+    partitions[0] * partitions[1] * partitions[2] == 1 &&
+    vtkImageData::SafeDownCast(this->Parent->GetTransformedInput(0)) != nullptr;
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::UpdateEmptySpaceSkipping(
+  vtkRenderer* ren, vtkVolume* vol)
+{
+  this->EmptySpaceSkipping = false;
+  if (!this->IsEmptySpaceSkippingSupported(vol))
+  {
+    return;
+  }
+
+  auto& input = this->Parent->AssembledInputs[0];
+  auto volumeTex = input.Texture.GetPointer();
+  vtkDataArray* scalars = volumeTex->GetLoadedScalars();
+  auto image = vtkImageData::SafeDownCast(this->Parent->GetTransformedInput(0));
+  const int cellSize = this->Parent->EmptySpaceSkippingCellSize;
+
+  // Texels are the points, or the cells for cell data.
+  int dims[3];
+  int cellDims[3];
+  image->GetDimensions(dims);
+  vtkIdType numberOfTexels = 1;
+  for (int i = 0; i < 3; ++i)
+  {
+    dims[i] = volumeTex->IsCellData ? std::max(dims[i] - 1, 1) : dims[i];
+    cellDims[i] = (dims[i] + cellSize - 1) / cellSize;
+    numberOfTexels *= dims[i];
+  }
+  const float* scalarRange = volumeTex->ScalarRange[0];
+  if (numberOfTexels != scalars->GetNumberOfTuples() || !(scalarRange[1] > scalarRange[0]))
+  {
+    return;
+  }
+
+  if (volumeTex->UploadTime > this->MacroCellRangesTime || cellSize != this->MacroCellSize ||
+    !std::equal(dims, dims + 3, this->MacroCellVolumeDimensions))
+  {
+    this->MacroCellRanges.resize(
+      2 * static_cast<size_t>(cellDims[0]) * static_cast<size_t>(cellDims[1]) * cellDims[2]);
+    MacroCellRangeWorker worker;
+    if (!vtkArrayDispatch::Dispatch::Execute(
+          scalars, worker, dims, cellSize, cellDims, this->MacroCellRanges.data()))
+    {
+      worker(scalars, dims, cellSize, cellDims, this->MacroCellRanges.data());
+    }
+    this->MacroCellSize = cellSize;
+    std::copy(dims, dims + 3, this->MacroCellVolumeDimensions);
+    std::copy(cellDims, cellDims + 3, this->MacroCellDimensions);
+    this->MacroCellRangesTime.Modified();
+  }
+
+  if (!this->OccupancyTexture || this->NeedToInitializeResources ||
+    this->MacroCellRangesTime > this->OccupancyTime ||
+    vol->GetProperty()->GetMTime() > this->OccupancyTime)
+  {
+    // Tabulate the scalar opacity function exactly as the opacity lookup
+    // table does, so that a macro cell is empty only when every texel of the
+    // table its scalar range can interpolate from is fully transparent.
+    const int width = input.OpacityTables->GetTable(0)->GetTextureWidth();
+    std::vector<float> table(width);
+    vol->GetProperty()->GetScalarOpacity(0)->GetTable(
+      scalarRange[0], scalarRange[1], width, table.data());
+    std::vector<int> opaqueTexels(width + 1, 0);
+    for (int i = 0; i < width; ++i)
+    {
+      opaqueTexels[i + 1] = opaqueTexels[i] + (table[i] > 0.0f ? 1 : 0);
+    }
+
+    const double scale = width / (static_cast<double>(scalarRange[1]) - scalarRange[0]);
+    const size_t numberOfCells = this->MacroCellRanges.size() / 2;
+    std::vector<unsigned char> occupancy(numberOfCells);
+    for (size_t c = 0; c < numberOfCells; ++c)
+    {
+      const double* range = &this->MacroCellRanges[2 * c];
+      const double first = std::floor((range[0] - scalarRange[0]) * scale - 0.5);
+      const double last = std::floor((range[1] - scalarRange[0]) * scale - 0.5) + 1.0;
+      const int t0 = static_cast<int>(vtkMath::ClampValue(first, 0.0, width - 1.0));
+      const int t1 = static_cast<int>(vtkMath::ClampValue(last, 0.0, width - 1.0));
+      occupancy[c] = opaqueTexels[t1 + 1] > opaqueTexels[t0] ? 255 : 0;
+    }
+
+    if (!this->OccupancyTexture)
+    {
+      this->OccupancyTexture = vtkSmartPointer<vtkTextureObject>::New();
+    }
+    this->OccupancyTexture->SetContext(
+      vtkOpenGLRenderWindow::SafeDownCast(ren->GetRenderWindow()));
+    this->OccupancyTexture->SetWrapS(vtkTextureObject::ClampToEdge);
+    this->OccupancyTexture->SetWrapT(vtkTextureObject::ClampToEdge);
+    this->OccupancyTexture->SetWrapR(vtkTextureObject::ClampToEdge);
+    this->OccupancyTexture->SetMagnificationFilter(vtkTextureObject::Nearest);
+    this->OccupancyTexture->SetMinificationFilter(vtkTextureObject::Nearest);
+    if (!this->OccupancyTexture->Create3DFromRaw(this->MacroCellDimensions[0],
+          this->MacroCellDimensions[1], this->MacroCellDimensions[2], 1, VTK_UNSIGNED_CHAR,
+          occupancy.data()))
+    {
+      this->OccupancyTexture = nullptr;
+      return;
+    }
+    this->OccupancyTime.Modified();
+  }
+
+  this->EmptySpaceSkipping = true;
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::SetEmptySpaceSkippingShaderParameters(
+  vtkShaderProgram* prog)
+{
+  if (!this->EmptySpaceSkippingInShader)
+  {
+    return;
+  }
+
+  this->OccupancyTexture->Activate();
+  prog->SetUniformi("in_occupancy", this->OccupancyTexture->GetTextureUnit());
+
+  float fvalue3[3];
+  for (int i = 0; i < 3; ++i)
+  {
+    fvalue3[i] = static_cast<float>(this->MacroCellVolumeDimensions[i]) / this->MacroCellSize;
+  }
+  prog->SetUniform3fv("in_occupancyScale", 1, &fvalue3);
+  vtkInternal::ToFloat(this->MacroCellDimensions[0], this->MacroCellDimensions[1],
+    this->MacroCellDimensions[2], fvalue3);
+  prog->SetUniform3fv("in_occupancySize", 1, &fvalue3);
+}
+
 //------------------------------------------------------------------------------
 void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::ReleaseGraphicsMaskTransfer(vtkWindow* window)
 {
@@ -1671,7 +1936,7 @@ void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::BeginImageSample(vtkRenderer*
   }
 
   float const xySampleDist = this->Parent->ImageSampleDistance;
-  if (xySampleDist != 1.f && this->InitializeImageSampleFBO(ren))
+  if ((xySampleDist != 1.f || this->ProgressiveRendering) && this->InitializeImageSampleFBO(ren))
   {
     this->ImageSampleFBO->GetContext()->GetState()->PushDrawFramebufferBinding();
     this->ImageSampleFBO->Bind(GL_DRAW_FRAMEBUFFER);
@@ -1767,7 +2032,7 @@ bool vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::InitializeImageSampleFBO(vtkR
 //------------------------------------------------------------------------------
 void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::EndImageSample(vtkRenderer* ren)
 {
-  if (this->Parent->ImageSampleDistance != 1.f)
+  if (this->Parent->ImageSampleDistance != 1.f || this->ProgressiveRendering)
   {
     this->ImageSampleFBO->DeactivateDrawBuffers();
     if (this->RenderPassAttached)
@@ -1778,6 +2043,11 @@ void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::EndImageSample(vtkRenderer* r
     vtkOpenGLRenderWindow* win = static_cast<vtkOpenGLRenderWindow*>(ren->GetRenderWindow());
     win->GetState()->PopDrawFramebufferBinding();
 
+    // With progressive rendering the accumulated history is displayed in
+    // place of the frame that was just rendered.
+    vtkTextureObject* progressiveTex =
+      this->ProgressiveRendering ? this->AccumulateProgressiveFrame(ren) : nullptr;
+
     // Render the contents of ImageSampleFBO as a quad to intermix with the
     // rest of the scene.
     typedef vtkOpenGLRenderUtilities GLUtil;
@@ -1829,9 +2099,11 @@ void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::EndImageSample(vtkRenderer* r
 
     for (size_t i = 0; i < this->NumImageSampleDrawBuffers; i++)
     {
-      this->ImageSampleTexture[i]->Activate();
+      vtkTextureObject* tex =
+        (i == 0 && progressiveTex) ? progressiveTex : this->ImageSampleTexture[i].Get();
+      tex->Activate();
       this->ImageSampleProg->SetUniformi(
-        this->ImageSampleTexNames[i].c_str(), this->ImageSampleTexture[i]->GetTextureUnit());
+        this->ImageSampleTexNames[i].c_str(), tex->GetTextureUnit());
     }
 
     this->ImageSampleVAO->Bind();
@@ -1843,7 +2115,212 @@ void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::EndImageSample(vtkRenderer* r
     {
       tex->Deactivate();
     }
+    if (progressiveTex)
+    {
+      progressiveTex->Deactivate();
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkMTimeType vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::GetProgressiveContentTime(
+  vtkVolume* vol)
+{
+  // vtkVolume::GetMTime accounts for the property and the user matrix and
+  // vtkAbstractMapper::GetMTime for the clipping planes.
+  vtkMTimeType time = std::max(this->Parent->GetMTime(), vol->GetMTime());
+  for (auto& item : this->Parent->AssembledInputs)
+  {
+    time = std::max(time, item.second.Volume->GetMTime());
+    vtkDataSet* input = this->Parent->GetTransformedInput(item.first);
+    if (input)
+    {
+      time = std::max(time, input->GetMTime());
+    }
   }
+  return time;
+}
+
+//------------------------------------------------------------------------------
+vtkTextureObject* vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::AccumulateProgressiveFrame(
+  vtkRenderer* ren)
+{
+  typedef vtkOpenGLRenderUtilities GLUtil;
+  vtkOpenGLRenderWindow* win = static_cast<vtkOpenGLRenderWindow*>(ren->GetRenderWindow());
+  vtkOpenGLState* ostate = win->GetState();
+  vtkVolume* vol = this->GetActiveVolume();
+
+  // The history has the size of ImageSampleFBO, WindowSize has not been
+  // restored to the viewport size yet.
+  const int width = this->WindowSize[0];
+  const int height = this->WindowSize[1];
+  bool allocated = false;
+  if (!this->ProgressiveFBO ||
+    static_cast<int>(this->ProgressiveHistory[0]->GetWidth()) != width ||
+    static_cast<int>(this->ProgressiveHistory[0]->GetHeight()) != height)
+  {
+    for (auto& tex : this->ProgressiveHistory)
+    {
+      if (!tex)
+      {
+        tex = vtkSmartPointer<vtkTextureObject>::New();
+        tex->SetContext(win);
+      }
+      tex->Create2D(width, height, 4, VTK_FLOAT, false);
+      tex->SetMinificationFilter(vtkTextureObject::Linear);
+      tex->SetMagnificationFilter(vtkTextureObject::Linear);
+      tex->SetWrapS(vtkTextureObject::ClampToEdge);
+      tex->SetWrapT(vtkTextureObject::ClampToEdge);
+    }
+    if (!this->ProgressiveFBO)
+    {
+      this->ProgressiveFBO = vtkOpenGLFramebufferObject::New();
+      this->ProgressiveFBO->SetContext(win);
+    }
+    this->ProgressiveFrames = 0;
+    allocated = true;
+  }
+
+  if (!this->ProgressiveProg)
+  {
+    std::string frag = GLUtil::GetFullScreenQuadFragmentShaderTemplate();
+    vtkShaderProgram::Substitute(
+      frag, "//VTK::FSQ::Decl", vtkvolume::ProgressiveAccumulationDeclarationFrag());
+    vtkShaderProgram::Substitute(
+      frag, "//VTK::FSQ::Impl", vtkvolume::ProgressiveAccumulationImplementationFrag());
+
+    this->ProgressiveProg =
+      win->GetShaderCache()->ReadyShaderProgram(GLUtil::GetFullScreenQuadVertexShader().c_str(),
+        frag.c_str(), GLUtil::GetFullScreenQuadGeometryShader().c_str());
+  }
+  else
+  {
+    win->GetShaderCache()->ReadyShaderProgram(this->ProgressiveProg);
+  }
+
+  if (!this->ProgressiveProg)
+  {
+    vtkGenericWarningMacro(<< "Failed to initialize the progressive accumulation program!");
+    return nullptr;
+  }
+
+  if (!this->ProgressiveVAO)
+  {
+    this->ProgressiveVAO = vtkOpenGLVertexArrayObject::New();
+    GLUtil::PrepFullScreenVAO(win, this->ProgressiveVAO, this->ProgressiveProg);
+  }
+
+  // Discard the history when what is rendered changed, only weight it down
+  // when the camera or the lights moved as it can then be reprojected.
+  vtkMatrix4x4* viewProj = ren->GetActiveCamera()->GetCompositeProjectionTransformMatrix(
+    ren->GetTiledAspectRatio(), -1, 1);
+  const double* prevViewProj = this->ProgressiveViewProjection->GetData();
+  if (this->GetProgressiveContentTime(vol) > this->ProgressiveTime.GetMTime())
+  {
+    this->ProgressiveFrames = 0;
+  }
+  else if (!std::equal(viewProj->GetData(), viewProj->GetData() + 16, prevViewProj) ||
+    this->LastModifiedLightTime(ren->GetLights()) > this->ProgressiveTime.GetMTime())
+  {
+    this->ProgressiveFrames = std::min(this->ProgressiveFrames, 1);
+  }
+
+  // Running average of the last NumberOfProgressiveFrames frames
+  const int history =
+    std::min(this->ProgressiveFrames, this->Parent->NumberOfProgressiveFrames - 1);
+  const float historyWeight = static_cast<float>(history) / static_cast<float>(history + 1);
+
+  // Current normalized device coordinates to previous ones, assuming the
+  // pixels lie at the depth of the volume center.
+  vtkNew<vtkMatrix4x4> invViewProj;
+  vtkMatrix4x4::Invert(viewProj, invViewProj);
+  vtkNew<vtkMatrix4x4> reprojection;
+  vtkMatrix4x4::Multiply4x4(this->ProgressiveViewProjection, invViewProj, reprojection);
+  reprojection->Transpose();
+
+  const double* bounds = vol->GetBounds();
+  double center[4] = { (bounds[0] + bounds[1]) * 0.5, (bounds[2] + bounds[3]) * 0.5,
+    (bounds[4] + bounds[5]) * 0.5, 1.0 };
+  viewProj->MultiplyPoint(center, center);
+  const float depth = center[3] > 0.0
+    ? static_cast<float>(vtkMath::ClampValue(center[2] / center[3], -1.0, 1.0))
+    : 0.f;
+
+  const int readIdx = this->ProgressiveHistoryIndex;
+  const int writeIdx = 1 - readIdx;
+
+  ostate->PushFramebufferBindings();
+  this->ProgressiveFBO->Bind();
+  this->ProgressiveFBO->AddColorAttachment(0, this->ProgressiveHistory[writeIdx]);
+  this->ProgressiveFBO->ActivateDrawBuffers(1);
+  if (allocated && !this->ProgressiveFBO->CheckFrameBufferStatus(GL_FRAMEBUFFER))
+  {
+    ostate->PopFramebufferBindings();
+    vtkGenericWarningMacro(<< "Failed to attach the progressive history texture!");
+    this->ReleaseProgressiveGraphicsResources(win);
+    return nullptr;
+  }
+
+  ostate->vtkglViewport(0, 0, width, height);
+  ostate->vtkglDisable(GL_BLEND);
+  ostate->vtkglDisable(GL_DEPTH_TEST);
+
+  this->ImageSampleTexture[0]->Activate();
+  this->ProgressiveHistory[readIdx]->Activate();
+  this->ProgressiveProg->SetUniformi(
+    "in_currentFrame", this->ImageSampleTexture[0]->GetTextureUnit());
+  this->ProgressiveProg->SetUniformi(
+    "in_history", this->ProgressiveHistory[readIdx]->GetTextureUnit());
+  this->ProgressiveProg->SetUniformMatrix("in_reprojection", reprojection);
+  this->ProgressiveProg->SetUniformf("in_reprojectionDepth", depth);
+  this->ProgressiveProg->SetUniformf("in_historyWeight", historyWeight);
+
+  this->ProgressiveVAO->Bind();
+  GLUtil::DrawFullScreenQuad();
+  this->ProgressiveVAO->Release();
+  vtkOpenGLStaticCheckErrorMacro("Error after progressive accumulation!");
+
+  this->ImageSampleTexture[0]->Deactivate();
+  this->ProgressiveHistory[readIdx]->Deactivate();
+  ostate->PopFramebufferBindings();
+
+  this->ProgressiveHistoryIndex = writeIdx;
+  this->ProgressiveFrames = std::min(this->ProgressiveFrames + 1, VTK_INT_MAX - 1);
+  this->ProgressiveFrameIndex++;
+  this->ProgressiveViewProjection->DeepCopy(viewProj);
+  this->ProgressiveTime.Modified();
+
+  return this->ProgressiveHistory[writeIdx];
+}
+
+//------------------------------------------------------------------------------
+void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::ReleaseProgressiveGraphicsResources(
+  vtkWindow* win)
+{
+  if (this->ProgressiveFBO)
+  {
+    this->ProgressiveFBO->Delete();
+    this->ProgressiveFBO = nullptr;
+  }
+
+  for (auto& tex : this->ProgressiveHistory)
+  {
+    if (tex)
+    {
+      tex->ReleaseGraphicsResources(win);
+      tex = nullptr;
+    }
+  }
+
+  if (this->ProgressiveVAO)
+  {
+    this->ProgressiveVAO->Delete();
+    this->ProgressiveVAO = nullptr;
+  }
+
+  // Do not delete the shader program - Let the cache clean it up.
+  this->ProgressiveProg = nullptr;
+  this->ProgressiveFrames = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -2167,6 +2644,7 @@ void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal ::ReleaseImageSampleGraphicsRe
     // Do not delete the shader program - Let the cache clean it up.
     this->ImageSampleProg = nullptr;
   }
+  this->ReleaseProgressiveGraphicsResources(win);
 }
 
 //------------------------------------------------------------------------------
@@ -2175,6 +2653,13 @@ vtkOpenGLGPUVolumeRayCastMapper::vtkOpenGLGPUVolumeRayCastMapper()
   this->Impl = new vtkInternal(this);
   this->ReductionFactor = 1.0;
   this->CurrentPass = RenderPass;
+  this->UseHalfFloatTextures = false;
+  this->BrickCacheSize = 0;
+  this->UseEmptySpaceSkipping = false;
+  this->EmptySpaceSkippingCellSize = 8;
+  this->UseProgressiveRendering = false;
+  this->NumberOfProgressiveFrames = 16;
+  this->ProgressiveSampleDistanceFactor = 2.0f;
 
   this->ResourceCallback = new vtkOpenGLResourceFreeCallback<vtkOpenGLGPUVolumeRayCastMapper>(
     this, &vtkOpenGLGPUVolumeRayCastMapper::ReleaseGraphicsResources);
@@ -2203,6 +2688,14 @@ void vtkOpenGLGPUVolumeRayCastMapper::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "ReductionFactor: " << this->ReductionFactor << "\n";
   os << indent << "CurrentPass: " << this->CurrentPass << "\n";
+  os << indent << "UseHalfFloatTextures: " << this->UseHalfFloatTextures << "\n";
+  os << indent << "BrickCacheSize: " << this->BrickCacheSize << "\n";
+  os << indent << "UseEmptySpaceSkipping: " << this->UseEmptySpaceSkipping << "\n";
+  os << indent << "EmptySpaceSkippingCellSize: " << this->EmptySpaceSkippingCellSize << "\n";
+  os << indent << "UseProgressiveRendering: " << this->UseProgressiveRendering << "\n";
+  os << indent << "NumberOfProgressiveFrames: " << this->NumberOfProgressiveFrames << "\n";
+  os << indent << "ProgressiveSampleDistanceFactor: " << this->ProgressiveSampleDistanceFactor
+     << "\n";
 }
 
 void vtkOpenGLGPUVolumeRayCastMapper::SetSharedDepthTexture(vtkTextureObject* nt)
@@ -2294,6 +2787,12 @@ void vtkOpenGLGPUVolumeRayCastMapper::ReleaseGraphicsResources(vtkWindow* window
   this->Impl->ReleaseGraphicsMaskTransfer(window);
   this->Impl->DeleteMaskTransfer();
 
+  if (this->Impl->OccupancyTexture)
+  {
+    this->Impl->OccupancyTexture->ReleaseGraphicsResources(window);
+    this->Impl->OccupancyTexture = nullptr;
+  }
+
   this->Impl->ReleaseResourcesTime.Modified();
 }
 
@@ -2689,6 +3188,22 @@ void vtkOpenGLGPUVolumeRayCastMapper::ReplaceShaderRTT(
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkOpenGLGPUVolumeRayCastMapper::ReplaceShaderEmptySpaceSkipping(
+  std::map<vtkShader::Type, vtkShader*>& shaders, vtkRenderer* ren, vtkVolume* vol,
+  int vtkNotUsed(numComps))
+{
+  vtkShader* fragmentShader = shaders[vtkShader::Fragment];
+  const bool skip = this->Impl->EmptySpaceSkipping;
+  this->Impl->EmptySpaceSkippingInShader = skip;
+
+  vtkShaderProgram::Substitute(fragmentShader, "//VTK::EmptySpaceSkipping::Dec",
+    vtkvolume::EmptySpaceSkippingDeclarationFragment(ren, this, vol, skip));
+
+  vtkShaderProgram::Substitute(fragmentShader, "//VTK::EmptySpaceSkipping::Impl",
+    vtkvolume::EmptySpaceSkippingImplementation(ren, this, vol, skip));
+}
+
 //------------------------------------------------------------------------------
 void vtkOpenGLGPUVolumeRayCastMapper::ReplaceShaderValues(
   std::map<vtkShader::Type, vtkShader*>& shaders, vtkRenderer* ren, vtkVolume* vol,
@@ -2779,6 +3294,10 @@ void vtkOpenGLGPUVolumeRayCastMapper::ReplaceShaderValues(
   //---------------------------------------------------------------------------
   this->ReplaceShaderRTT(shaders, ren, vol, noOfComponents);
 
+  // Empty space skipping
+  //---------------------------------------------------------------------------
+  this->ReplaceShaderEmptySpaceSkipping(shaders, ren, vol, noOfComponents);
+
   // Set number of isosurfaces
   if (this->GetBlendMode() == vtkVolumeMapper::ISOSURFACE_BLEND)
   {
@@ -3040,11 +3559,13 @@ bool vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::UpdateInputs(vtkRenderer* ren
 
     if (this->NeedToInitializeResources || (input->GetMTime() > it->second.Texture->UploadTime) ||
       (scalars != it->second.Texture->GetLoadedScalars()) ||
-      (scalars != nullptr && scalars->GetMTime() > it->second.Texture->UploadTime))
+      (scalars != nullptr && scalars->GetMTime() > it->second.Texture->UploadTime) ||
+      (it->second.Texture->UseHalfFloat != this->Parent->UseHalfFloatTextures))
     {
       auto& volInput = this->Parent->AssembledInputs[port];
       auto volumeTex = volInput.Texture.GetPointer();
       volumeTex->SetPartitions(this->Partitions[0], this->Partitions[1], this->Partitions[2]);
+      volumeTex->UseHalfFloat = this->Parent->UseHalfFloatTextures;
       success &= volumeTex->LoadVolume(
         ren, input, scalars, this->Parent->CellFlag, property->GetInterpolationType());
       volInput.ComponentMode = this->GetComponentMode(property, scalars);
@@ -3054,6 +3575,7 @@ bool vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::UpdateInputs(vtkRenderer* ren
       // Update vtkVolumeTexture
       it->second.Texture->UpdateVolume(property);
     }
+    it->second.Texture->BrickCacheSize = static_cast<size_t>(this->Parent->BrickCacheSize) << 20;
 
     // Volume may have changed, so make sure the helper updates its reference to it.
     it->second.Volume = vol;
@@ -3230,6 +3752,16 @@ void vtkOpenGLGPUVolumeRayCastMapper::GPURender(vtkRenderer* ren, vtkVolume* vol
     return;
   }
   this->Impl->UpdateSamplingDistance(ren);
+
+  // Progressive frames are cast with fewer samples, the accumulation of
+  // jittered frames makes up for it.
+  this->Impl->ProgressiveRendering = this->UseProgressiveRendering && !this->RenderToImage &&
+    !this->Impl->RenderPassAttached &&
+    !(this->UseDepthPass && this->GetBlendMode() == vtkVolumeMapper::COMPOSITE_BLEND);
+  if (this->Impl->ProgressiveRendering)
+  {
+    this->Impl->ActualSampleDistance *= this->ProgressiveSampleDistanceFactor;
+  }
   this->Impl->UpdateTransfer2DYAxisArray(ren, vol);
   this->Impl->UpdateTransferFunctions(ren);
 
@@ -3238,6 +3770,7 @@ void vtkOpenGLGPUVolumeRayCastMapper::GPURender(vtkRenderer* ren, vtkVolume* vol
   {
     this->Impl->LoadMask(ren, vol);
   }
+  this->Impl->UpdateEmptySpaceSkipping(ren, vol);
 
   // Get the shader cache. This is important to make sure that shader cache
   // knows the state of various shader programs in use.
@@ -3245,6 +3778,7 @@ void vtkOpenGLGPUVolumeRayCastMapper::GPURender(vtkRenderer* ren, vtkVolume* vol
     vtkOpenGLRenderWindow::SafeDownCast(ren->GetRenderWindow())->GetShaderCache();
 
   this->Impl->CheckPickingState(ren);
+  this->Impl->ProgressiveRendering = this->Impl->ProgressiveRendering && !this->Impl->IsPicking;
 
   if (this->UseDepthPass && this->GetBlendMode() == vtkVolumeMapper::COMPOSITE_BLEND)
   {
@@ -3329,7 +3863,8 @@ bool vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::ShaderRebuildNeeded(
     this->SelectionStateTime.GetMTime() > this->ShaderBuildTime.GetMTime() ||
     renderPassTime > this->ShaderBuildTime ||
     ren->GetLights()->GetMTime() > this->ShaderBuildTime.GetMTime() ||
-    this->LastModifiedLightTime(ren->GetLights()) > this->ShaderBuildTime.GetMTime());
+    this->LastModifiedLightTime(ren->GetLights()) > this->ShaderBuildTime.GetMTime() ||
+    this->EmptySpaceSkipping != this->EmptySpaceSkippingInShader);
 }
 
 //------------------------------------------------------------------------------
@@ -3350,7 +3885,8 @@ void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::RenderWithDepthPass(
     renderPassTime > this->ShaderBuildTime ||
     shaderProperty->GetShaderMTime() > this->ShaderBuildTime ||
     ren->GetLights()->GetMTime() > this->ShaderBuildTime.GetMTime() ||
-    this->LastModifiedLightTime(ren->GetLights()) > this->ShaderBuildTime.GetMTime())
+    this->LastModifiedLightTime(ren->GetLights()) > this->ShaderBuildTime.GetMTime() ||
+    this->EmptySpaceSkipping != this->EmptySpaceSkippingInShader)
   {
     this->LastProjectionParallel = cam->GetParallelProjection();
 
@@ -3625,11 +4161,19 @@ void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::SetMapperShaderParameters(
   }
   prog->SetUniformi("in_depthSampler", this->DepthTextureObject->GetTextureUnit());
 
-  if (this->Parent->GetUseJittering())
+  if (this->Parent->GetUseJittering() || this->Parent->UseProgressiveRendering)
   {
     vtkOpenGLRenderWindow* win = static_cast<vtkOpenGLRenderWindow*>(ren->GetRenderWindow());
     prog->SetUniformi("in_noiseSampler", win->GetNoiseTextureUnit());
   }
+  if (this->Parent->UseProgressiveRendering)
+  {
+    // Golden ratio sequence, evenly covers [0, 1) for any number of frames
+    const float offset = this->ProgressiveRendering
+      ? static_cast<float>(std::fmod(this->ProgressiveFrameIndex * 0.6180339887498949, 1.0))
+      : 0.f;
+    prog->SetUniformf("in_jitterOffset", offset);
+  }
 
   prog->SetUniformi("in_noOfComponents", numComp);
   prog->SetUniformf("in_sampleDistance", this->ActualSampleDistance);
@@ -3865,6 +4409,11 @@ void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::FinishRendering(const int num
     this->CurrentMask->GetCurrentBlock()->TextureObject->Deactivate();
   }
 
+  if (this->EmptySpaceSkippingInShader)
+  {
+    this->OccupancyTexture->Deactivate();
+  }
+
   if (numComp == 1 && this->Parent->BlendMode != vtkGPUVolumeRayCastMapper::ADDITIVE_BLEND)
   {
     if (this->Parent->MaskInput != nullptr && this->Parent->MaskType == LabelMapMaskType)
@@ -3964,6 +4513,7 @@ void vtkOpenGLGPUVolumeRayCastMapper::vtkInternal::RenderSingleInput(
     this->SetVolumeShaderParameters(prog, independent, numComp, wcvc);
 
     this->SetMaskShaderParameters(prog, vol->GetProperty(), numComp);
+    this->SetEmptySpaceSkippingShaderParameters(prog);
     this->SetLightingShaderParameters(ren, prog, vol, numSamplers);
     this->SetCameraShaderParameters(prog, ren, cam);
     this->SetAdvancedShaderParameters(ren, prog, vol, block, numComp);
@@ -135,6 +135,74 @@ public:
    */
   void SetPartitions(unsigned short x, unsigned short y, unsigned short z);
 
+  ///@{
+  /**
+   * GPU memory, in megabytes, used to keep the blocks of a partitioned volume
+   * (see SetPartitions) resident between frames. The least recently rendered
+   * blocks are evicted when the cache is full. With the default of 0 every
+   * visible block is uploaded again each frame. In both cases the blocks
+   * outside of the view frustum are neither uploaded nor rendered.
+   */
+  vtkSetClampMacro(BrickCacheSize, int, 0, VTK_INT_MAX);
+  vtkGetMacro(BrickCacheSize, int);
+  ///@}
+
+  ///@{
+  /**
+   * Store the float, double and 32-bit or 64-bit integer scalars in 16-bit
+   * half float textures, which halves the GPU memory of float volumes.  The
+   * values are normalized to the scalar range before they are converted, so
+   * that they keep about 11 bits of precision.  This is Off by default.
+   */
+  vtkSetMacro(UseHalfFloatTextures, bool);
+  vtkGetMacro(UseHalfFloatTextures, bool);
+  vtkBooleanMacro(UseHalfFloatTextures, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Leap over fully transparent regions of the volume while ray-casting.
+   * The mapper keeps the scalar range of every macro cell of
+   * EmptySpaceSkippingCellSize^3 voxels and, whenever the volume property
+   * changes, derives from it a coarse occupancy texture telling which macro
+   * cells the scalar opacity transfer function maps to a non-zero opacity.
+   * Rays then jump over the empty macro cells, staying on their sample
+   * lattice so the image is unchanged.  Only single component inputs rendered
+   * with composite blending, a 1D transfer function, the scalar opacity range
+   * type set to SCALAR and a single texture block are accelerated; other
+   * configurations ignore the setting.  This is Off by default.
+   */
+  vtkSetMacro(UseEmptySpaceSkipping, bool);
+  vtkGetMacro(UseEmptySpaceSkipping, bool);
+  vtkBooleanMacro(UseEmptySpaceSkipping, bool);
+  vtkSetClampMacro(EmptySpaceSkippingCellSize, int, 2, 64);
+  vtkGetMacro(EmptySpaceSkippingCellSize, int);
+  ///@}
+
+  ///@{
+  /**
+   * Render the volume progressively.  Every frame is ray-cast with a sample
+   * distance ProgressiveSampleDistanceFactor times larger than usual and a
+   * ray start offset that changes from frame to frame, then blended into a
+   * history buffer holding the running average of the last
+   * NumberOfProgressiveFrames frames.  While the camera is static the image
+   * converges to the full quality one at the cost of a coarse frame; when the
+   * camera moves the history is reprojected onto the new view and weighted
+   * down instead of being discarded, which hides the banding of coarse
+   * sampling during interaction.  The history is reset when the volume, its
+   * property, its input or the mapper are modified.  Progressive rendering
+   * is ignored by render passes, picking, RenderToImage and the depth pass.
+   * This is Off by default.
+   */
+  vtkSetMacro(UseProgressiveRendering, bool);
+  vtkGetMacro(UseProgressiveRendering, bool);
+  vtkBooleanMacro(UseProgressiveRendering, bool);
+  vtkSetClampMacro(NumberOfProgressiveFrames, int, 1, 1024);
+  vtkGetMacro(NumberOfProgressiveFrames, int);
+  vtkSetClampMacro(ProgressiveSampleDistanceFactor, float, 1.0f, 16.0f);
+  vtkGetMacro(ProgressiveSampleDistanceFactor, float);
+  ///@}
+
   /**
    *  Load the volume texture into GPU memory.  Actual loading occurs
    *  in vtkVolumeTexture::LoadVolume.  The mapper by default loads data
@@ -263,6 +331,8 @@ protected:
     std::map<vtkShader::Type, vtkShader*>& shaders, vtkRenderer* ren, vtkVolume* vol, int numComps);
   void ReplaceShaderRTT(
     std::map<vtkShader::Type, vtkShader*>& shaders, vtkRenderer* ren, vtkVolume* vol, int numComps);
+  void ReplaceShaderEmptySpaceSkipping(
+    std::map<vtkShader::Type, vtkShader*>& shaders, vtkRenderer* ren, vtkVolume* vol, int numComps);
   void ReplaceShaderRenderPass(
     std::map<vtkShader::Type, vtkShader*>& shaders, vtkVolume* vol, bool prePass);
 
@@ -281,6 +351,13 @@ protected:
 
   double ReductionFactor;
   int CurrentPass;
+  bool UseHalfFloatTextures;
+  int BrickCacheSize;
+  bool UseEmptySpaceSkipping;
+  int EmptySpaceSkippingCellSize;
+  bool UseProgressiveRendering;
+  int NumberOfProgressiveFrames;
+  float ProgressiveSampleDistanceFactor;
 
 public:
   using VolumeInput = vtkVolumeInputHelper;
@@ -171,10 +171,14 @@ inline std::string BaseDeclarationFragment(vtkRenderer* vtkNotUsed(ren), vtkVolu
                  "uniform vec3 in_cameraPos;\n";
 
   vtkOpenGLGPUVolumeRayCastMapper* glMapper = vtkOpenGLGPUVolumeRayCastMapper::SafeDownCast(mapper);
-  if (glMapper->GetUseJittering())
+  if (glMapper->GetUseJittering() || glMapper->GetUseProgressiveRendering())
   {
     toShaderStr << "uniform sampler2D in_noiseSampler;\n";
   }
+  if (glMapper->GetUseProgressiveRendering())
+  {
+    toShaderStr << "uniform float in_jitterOffset;\n";
+  }
 
   // For multiple inputs (numInputs > 1), an additional transformation is
   // needed for the bounding-box.
@@ -457,11 +461,21 @@ inline std::string BaseInit(vtkRenderer* vtkNotUsed(ren), vtkVolumeMapper* mappe
   if (glMapper->GetBlendMode() != vtkVolumeMapper::SLICE_BLEND)
   {
     // Intersection is computed with g_rayOrigin, so we should not modify it with Slice mode
-    if (glMapper->GetUseJittering())
+    if (glMapper->GetUseJittering() || glMapper->GetUseProgressiveRendering())
     {
       shaderStr << "\
           \n    jitterValue = texture2D(in_noiseSampler, gl_FragCoord.xy /\
                                               vec2(textureSize(in_noiseSampler, 0))).x;\
+          \n";
+      if (glMapper->GetUseProgressiveRendering())
+      {
+        // Shift the per pixel offset by a different amount every frame so
+        // that the accumulated frames sample the whole step.
+        shaderStr << "\
+          \n    jitterValue = fract(jitterValue + in_jitterOffset);\
+          \n";
+      }
+      shaderStr << "\
           \n    g_rayJitter = g_dirStep * jitterValue;\
           \n";
     }
@@ -3908,6 +3922,65 @@ inline std::string DepthPassExit(
     \n                        1.0);");
 }
 
+//---------------------------------------------------------------------------
+inline std::string EmptySpaceSkippingDeclarationFragment(vtkRenderer* vtkNotUsed(ren),
+  vtkVolumeMapper* vtkNotUsed(mapper), vtkVolume* vtkNotUsed(vol), bool skipEmptySpace)
+{
+  if (!skipEmptySpace)
+  {
+    return std::string();
+  }
+
+  return std::string("\
+    \nuniform sampler3D in_occupancy;\
+    \n// Texture coordinates to macro cell coordinates\
+    \nuniform vec3 in_occupancyScale;\
+    \n// Number of macro cells along each axis\
+    \nuniform vec3 in_occupancySize;\
+    \n");
+}
+
+//---------------------------------------------------------------------------
+inline std::string EmptySpaceSkippingImplementation(vtkRenderer* vtkNotUsed(ren),
+  vtkVolumeMapper* vtkNotUsed(mapper), vtkVolume* vtkNotUsed(vol), bool skipEmptySpace)
+{
+  if (!skipEmptySpace)
+  {
+    return std::string();
+  }
+
+  return std::string("\
+    \n    // Leap over the macro cells in which every sample is transparent,\
+    \n    // staying on the sample lattice of the ray. The sample reached is\
+    \n    // still within the empty macro cell and is composited as usual.\
+    \n    {\
+    \n    vec3 l_macroCell = floor(g_dataPos * in_occupancyScale);\
+    \n    if (all(greaterThanEqual(l_macroCell, vec3(0.0))) &&\
+    \n      all(lessThan(l_macroCell, in_occupancySize)) &&\
+    \n      texture3D(in_occupancy, (l_macroCell + vec3(0.5)) / in_occupancySize).r == 0.0)\
+    \n      {\
+    \n      vec3 l_macroCellExit = (l_macroCell + step(vec3(0.0), g_dirStep)) /\
+    \n        in_occupancyScale;\
+    \n      vec3 l_exitSteps = vec3(1.0e30);\
+    \n      for (int i = 0; i < 3; ++i)\
+    \n        {\
+    \n        if (g_dirStep[i] != 0.0)\
+    \n          {\
+    \n          l_exitSteps[i] = (l_macroCellExit[i] - g_dataPos[i]) / g_dirStep[i];\
+    \n          }\
+    \n        }\
+    \n      float l_leap = floor(min(l_exitSteps.x, min(l_exitSteps.y, l_exitSteps.z)));\
+    \n      l_leap = min(l_leap, floor(g_terminatePointMax - g_currentT));\
+    \n      if (l_leap > 0.0)\
+    \n        {\
+    \n        g_dataPos += l_leap * g_dirStep;\
+    \n        g_currentT += l_leap;\
+    \n        }\
+    \n      }\
+    \n    }\
+    \n");
+}
+
 //---------------------------------------------------------------------------
 inline std::string WorkerImplementation(
   vtkRenderer* vtkNotUsed(ren), vtkVolumeMapper* vtkNotUsed(mapper), vtkVolume* vtkNotUsed(vol))
@@ -3944,6 +4017,38 @@ inline std::string ImageSampleImplementationFrag(
   shader += " return;\n";
   return shader;
 }
+
+//---------------------------------------------------------------------------
+inline std::string ProgressiveAccumulationDeclarationFrag()
+{
+  return std::string("\
+    \nuniform sampler2D in_currentFrame;\
+    \nuniform sampler2D in_history;\
+    \n// Maps the current normalized device coordinates to the previous ones\
+    \nuniform mat4 in_reprojection;\
+    \nuniform float in_reprojectionDepth;\
+    \nuniform float in_historyWeight;\
+    \n");
+}
+
+//---------------------------------------------------------------------------
+inline std::string ProgressiveAccumulationImplementationFrag()
+{
+  return std::string("\
+    \n  vec4 current = texture2D(in_currentFrame, texCoord);\
+    \n  vec4 prevPos = in_reprojection *\
+    \n    vec4(texCoord * 2.0 - 1.0, in_reprojectionDepth, 1.0);\
+    \n  vec2 prevCoord = prevPos.xy / prevPos.w * 0.5 + 0.5;\
+    \n  gl_FragData[0] = current;\
+    \n  // The history is not initialized when its weight is 0\
+    \n  if (in_historyWeight > 0.0 && prevPos.w > 0.0 &&\
+    \n    all(greaterThanEqual(prevCoord, vec2(0.0))) &&\
+    \n    all(lessThanEqual(prevCoord, vec2(1.0))))\
+    \n  {\
+    \n    gl_FragData[0] = mix(current, texture2D(in_history, prevCoord), in_historyWeight);\
+    \n  }\
+    \n");
+}
 VTK_ABI_NAMESPACE_END
 }
 
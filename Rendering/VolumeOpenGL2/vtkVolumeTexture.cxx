@@ -22,14 +22,49 @@
 #include "vtkVolumeTexture.h"
 #include "vtk_glew.h"
 
+namespace
+{
+// The formats of the half float textures for 1 to 4 components
+void vtkVolumeTextureHalfFloatFormat(
+  int noOfComponents, unsigned int& format, unsigned int& internalFormat)
+{
+  switch (noOfComponents)
+  {
+    case 1:
+      internalFormat = GL_R16F;
+      format = GL_RED;
+      break;
+    case 2:
+      internalFormat = GL_RG16F;
+      format = GL_RG;
+      break;
+    case 3:
+      internalFormat = GL_RGB16F;
+      format = GL_RGB;
+      break;
+    case 4:
+      internalFormat = GL_RGBA16F;
+      format = GL_RGBA;
+      break;
+  }
+}
+}
+
 VTK_ABI_NAMESPACE_BEGIN
 vtkVolumeTexture::vtkVolumeTexture()
   : HandleLargeDataTypes(false)
+  , UseHalfFloat(false)
+  , BrickCacheSize(0)
   , InterpolationType(vtkTextureObject::Linear)
   , Texture(nullptr)
   , CurrentBlockIdx(0)
   , StreamBlocks(false)
   , Scalars(nullptr)
+  , TextureFormat(0)
+  , TextureInternalFormat(0)
+  , TextureType(0)
+  , BrickCacheBytes(0)
+  , BrickCacheClock(0)
 {
   this->Partitions[0] = this->Partitions[1] = this->Partitions[2] = 1;
 
@@ -179,6 +214,18 @@ void vtkVolumeTexture::SetInterpolation(int interpolation)
     this->Texture->SetMagnificationFilter(interpolation);
     this->Texture->SetMinificationFilter(interpolation);
   }
+  else
+  {
+    // Resident blocks pick up the new filters the next time they are bound
+    for (auto& item : this->ImageDataBlockMap)
+    {
+      if (item.second->CachedTexture)
+      {
+        item.second->CachedTexture->SetMagnificationFilter(interpolation);
+        item.second->CachedTexture->SetMinificationFilter(interpolation);
+      }
+    }
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -196,7 +243,7 @@ vtkVolumeTexture::VolumeBlock* vtkVolumeTexture::GetNextBlock()
   // Load current block
   if (this->StreamBlocks)
   {
-    this->LoadTexture(this->InterpolationType, block);
+    this->LoadBlock(block);
   }
 
   return block;
@@ -205,9 +252,143 @@ vtkVolumeTexture::VolumeBlock* vtkVolumeTexture::GetNextBlock()
 //------------------------------------------------------------------------------
 vtkVolumeTexture::VolumeBlock* vtkVolumeTexture::GetCurrentBlock()
 {
+  if (this->SortedVolumeBlocks.empty())
+  {
+    return nullptr;
+  }
   return this->SortedVolumeBlocks[this->CurrentBlockIdx];
 }
 
+//------------------------------------------------------------------------------
+bool vtkVolumeTexture::LoadBlock(VolumeBlock* volBlock)
+{
+  if (this->BrickCacheSize == 0)
+  {
+    this->TrimBrickCache(0, nullptr);
+    return this->LoadTexture(this->InterpolationType, volBlock);
+  }
+
+  volBlock->LastUsed = ++this->BrickCacheClock;
+  if (volBlock->CachedTexture)
+  {
+    // Resident, no upload needed
+    return true;
+  }
+
+  size_t const blockBytes = this->GetBlockSizeInBytes(volBlock);
+  this->TrimBrickCache(
+    this->BrickCacheSize > blockBytes ? this->BrickCacheSize - blockBytes : 0, volBlock);
+
+  auto texture = vtkSmartPointer<vtkTextureObject>::New();
+  texture->SetContext(this->Texture->GetContext());
+  texture->SetFormat(this->TextureFormat);
+  texture->SetInternalFormat(this->TextureInternalFormat);
+  texture->SetDataType(this->TextureType);
+  volBlock->CachedTexture = texture;
+  volBlock->TextureObject = texture;
+  if (!this->LoadTexture(this->InterpolationType, volBlock))
+  {
+    texture->ReleaseGraphicsResources(this->Texture->GetContext());
+    volBlock->CachedTexture = nullptr;
+    volBlock->TextureObject = this->Texture;
+    return false;
+  }
+  this->BrickCacheBytes += blockBytes;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+size_t vtkVolumeTexture::GetBlockSizeInBytes(VolumeBlock* volBlock)
+{
+  size_t texelSize = static_cast<size_t>(this->Scalars->GetDataTypeSize());
+  if (this->HandleLargeDataTypes)
+  {
+    texelSize = this->UseHalfFloat ? 2 : sizeof(float);
+  }
+  Size3 const& blockSize = volBlock->TextureSize;
+  return texelSize * this->Scalars->GetNumberOfComponents() * static_cast<size_t>(blockSize[0]) *
+    static_cast<size_t>(blockSize[1]) * static_cast<size_t>(blockSize[2]);
+}
+
+//------------------------------------------------------------------------------
+void vtkVolumeTexture::EvictBlock(VolumeBlock* volBlock, vtkWindow* win)
+{
+  if (!volBlock->CachedTexture)
+  {
+    return;
+  }
+
+  this->BrickCacheBytes -= std::min(this->BrickCacheBytes, this->GetBlockSizeInBytes(volBlock));
+  volBlock->CachedTexture->ReleaseGraphicsResources(win);
+  volBlock->CachedTexture = nullptr;
+  volBlock->TextureObject = this->Texture;
+}
+
+//------------------------------------------------------------------------------
+void vtkVolumeTexture::TrimBrickCache(size_t size, VolumeBlock* keep)
+{
+  while (this->BrickCacheBytes > size)
+  {
+    // Evict the least recently rendered block
+    VolumeBlock* oldest = nullptr;
+    for (auto& item : this->ImageDataBlockMap)
+    {
+      VolumeBlock* block = item.second;
+      if (block != keep && block->CachedTexture &&
+        (!oldest || block->LastUsed < oldest->LastUsed))
+      {
+        oldest = block;
+      }
+    }
+    if (!oldest)
+    {
+      break;
+    }
+    this->EvictBlock(oldest, this->Texture ? this->Texture->GetContext() : nullptr);
+  }
+}
+
+//------------------------------------------------------------------------------
+bool vtkVolumeTexture::IsBlockInFrustum(
+  VolumeBlock* volBlock, vtkMatrix4x4* volumeMat, const double planes[24])
+{
+  double const* bounds = volBlock->LoadedBoundsAA;
+  double corners[8][3];
+  for (int c = 0; c < 8; ++c)
+  {
+    double const in[4] = { bounds[c & 1], bounds[2 + ((c >> 1) & 1)], bounds[4 + ((c >> 2) & 1)],
+      1.0 };
+    double out[4];
+    volumeMat->MultiplyPoint(in, out);
+    double const w = out[3] != 0.0 ? out[3] : 1.0;
+    for (int i = 0; i < 3; ++i)
+    {
+      corners[c][i] = out[i] / w;
+    }
+  }
+
+  // The block is culled when all of its corners lie outside one of the planes
+  for (int p = 0; p < 6; ++p)
+  {
+    double const* plane = planes + 4 * p;
+    int outside = 0;
+    for (int c = 0; c < 8; ++c)
+    {
+      if (plane[0] * corners[c][0] + plane[1] * corners[c][1] + plane[2] * corners[c][2] +
+          plane[3] <
+        0.0)
+      {
+        ++outside;
+      }
+    }
+    if (outside == 8)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 //------------------------------------------------------------------------------
 void vtkVolumeTexture::CreateBlocks(unsigned int format, unsigned int internalFormat, int type)
 {
@@ -249,6 +430,9 @@ void vtkVolumeTexture::CreateBlocks(unsigned int format, unsigned int internalFo
   this->Texture->SetFormat(format);
   this->Texture->SetInternalFormat(internalFormat);
   this->Texture->SetDataType(type);
+  this->TextureFormat = format;
+  this->TextureInternalFormat = internalFormat;
+  this->TextureType = type;
 
   // Sorting is skipped when handling a single block, so here the block vector
   // is initialized
@@ -573,6 +757,12 @@ bool vtkVolumeTexture::LoadTexture(int interpolation, VolumeBlock* volBlock)
 //------------------------------------------------------------------------------
 void vtkVolumeTexture::ReleaseGraphicsResources(vtkWindow* win)
 {
+  for (auto& item : this->ImageDataBlockMap)
+  {
+    this->EvictBlock(item.second, win);
+  }
+  this->BrickCacheBytes = 0;
+
   if (this->Texture)
   {
     this->Texture->ReleaseGraphicsResources(win);
@@ -588,14 +778,19 @@ void vtkVolumeTexture::ClearBlocks()
     return;
   }
 
+  // Blocks outside of the view frustum are not in SortedVolumeBlocks
+  for (auto& item : this->ImageDataBlockMap)
+  {
+    delete item.second;
+  }
   size_t const numBlocks = this->ImageDataBlocks.size();
   for (size_t i = 0; i < numBlocks; i++)
   {
     this->ImageDataBlocks.at(i)->Delete();
-    delete this->SortedVolumeBlocks.at(i);
   }
 
   this->CurrentBlockIdx = 0;
+  this->BrickCacheBytes = 0;
   this->ImageDataBlocks.clear();
   this->SortedVolumeBlocks.clear();
   this->ImageDataBlockMap.clear();
@@ -704,7 +899,14 @@ void vtkVolumeTexture::SelectTextureFormat(
   switch (scalarType)
   {
     case VTK_FLOAT:
-      if (supportsFloat)
+      if (this->UseHalfFloat)
+      {
+        // Normalized and converted to float on upload, like the large types
+        this->HandleLargeDataTypes = true;
+        type = GL_FLOAT;
+        vtkVolumeTextureHalfFloatFormat(noOfComponents, format, internalFormat);
+      }
+      else if (supportsFloat)
       {
         switch (noOfComponents)
         {
@@ -764,6 +966,11 @@ void vtkVolumeTexture::SelectTextureFormat(
     case VTK_UNSIGNED_LONG_LONG:
       this->HandleLargeDataTypes = true;
       type = GL_FLOAT;
+      if (this->UseHalfFloat)
+      {
+        vtkVolumeTextureHalfFloatFormat(noOfComponents, format, internalFormat);
+        break;
+      }
       switch (noOfComponents)
       {
         case 1:
@@ -864,17 +1071,31 @@ void vtkVolumeTexture::SortBlocksBackToFront(vtkRenderer* ren, vtkMatrix4x4* vol
     vtkBlockSortHelper::Sort(
       this->ImageDataBlocks.begin(), this->ImageDataBlocks.end(), sortBlocks);
 
+    // Only request the blocks intersecting the view frustum
+    double planes[24];
+    ren->GetActiveCamera()->GetFrustumPlanes(ren->GetTiledAspectRatio(), planes);
+
     size_t const numBlocks = this->ImageDataBlocks.size();
     this->SortedVolumeBlocks.clear();
     this->SortedVolumeBlocks.reserve(numBlocks);
     for (size_t i = 0; i < numBlocks; i++)
     {
-      this->SortedVolumeBlocks.push_back(this->ImageDataBlockMap[this->ImageDataBlocks[i]]);
+      VolumeBlock* block = this->ImageDataBlockMap[this->ImageDataBlocks[i]];
+      if (this->IsBlockInFrustum(block, volumeMat, planes))
+      {
+        this->SortedVolumeBlocks.push_back(block);
+      }
     }
+    this->CurrentBlockIdx = 0;
+
+    // Honor a cache size reduced since the previous frame
+    this->TrimBrickCache(this->BrickCacheSize, nullptr);
 
     // Load the first block
-    auto firstBlock = this->SortedVolumeBlocks.at(0);
-    this->LoadTexture(this->InterpolationType, firstBlock);
+    if (!this->SortedVolumeBlocks.empty())
+    {
+      this->LoadBlock(this->SortedVolumeBlocks.at(0));
+    }
   }
 }
 
@@ -911,6 +1132,8 @@ void vtkVolumeTexture::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
 
   os << indent << "HandleLargeDataTypes: " << this->HandleLargeDataTypes << '\n';
+  os << indent << "UseHalfFloat: " << this->UseHalfFloat << '\n';
+  os << indent << "BrickCacheSize: " << this->BrickCacheSize << '\n';
   os << indent << "GL Scale: " << this->Scale[0] << ", " << this->Scale[1] << ", " << this->Scale[2]
      << ", " << this->Scale[3] << '\n';
   os << indent << "GL Bias: " << this->Bias[0] << ", " << this->Bias[1] << ", " << this->Bias[2]
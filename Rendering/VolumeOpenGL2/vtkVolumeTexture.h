@@ -45,6 +45,12 @@
  * - Future work will extend the API to be able to compute an ideal number of
  *   partitions and extents based on the platform capabilities.
  *
+ * When streaming, only the blocks intersecting the view frustum are returned
+ * by GetNextBlock(). A non-zero BrickCacheSize keeps the blocks resident in
+ * their own textures, up to that many bytes, instead of uploading every block
+ * again into a shared texture each frame. The least recently rendered blocks
+ * are evicted first when the cache is full.
+ *
  * @warning This is an internal class of vtkOpenGLGPUVolumeRayCastMapper. It
  * assumes there is an active OpenGL context in methods involving GL calls
  * (MakeCurrent() is expected to be called in the mapper beforehand).
@@ -116,6 +122,13 @@ public:
     double LoadedBoundsAA[6];
     double VolumeGeometry[24];
     int Extents[6];
+
+    /**
+     * Texture of the block when it is resident in the brick cache, and the
+     * value of the brick cache clock the last time the block was rendered.
+     */
+    vtkSmartPointer<vtkTextureObject> CachedTexture;
+    vtkMTimeType LastUsed = 0;
   };
 
   vtkTypeMacro(vtkVolumeTexture, vtkObject);
@@ -154,7 +167,7 @@ public:
    */
   VolumeBlock* GetNextBlock();
   /**
-   * Return the currently loaded block.
+   * Return the currently loaded block, or nullptr if no block is visible.
    */
   VolumeBlock* GetCurrentBlock();
 
@@ -173,6 +186,11 @@ public:
   vtkDataArray* GetLoadedScalars();
 
   bool HandleLargeDataTypes;
+  // Store float and larger types in half float textures
+  bool UseHalfFloat;
+
+  // GPU memory in bytes kept for resident blocks when streaming, 0 disables
+  size_t BrickCacheSize;
   float Scale[4];
   float Bias[4];
   float ScalarRange[4][2];
@@ -207,6 +225,24 @@ private:
    */
   bool LoadTexture(int interpolation, VolumeBlock* volBlock);
 
+  ///@{
+  /**
+   * Make a streamed block available for rendering, either by uploading it to
+   * the shared texture or through the brick cache. Requires an active OpenGL
+   * context.
+   */
+  bool LoadBlock(VolumeBlock* volBlock);
+  size_t GetBlockSizeInBytes(VolumeBlock* volBlock);
+  void EvictBlock(VolumeBlock* volBlock, vtkWindow* win);
+  void TrimBrickCache(size_t size, VolumeBlock* keep);
+  ///@}
+
+  /**
+   * Whether the bounds of a block, transformed by volumeMat, intersect the
+   * frustum defined by the planes given by vtkCamera::GetFrustumPlanes().
+   */
+  bool IsBlockInFrustum(VolumeBlock* volBlock, vtkMatrix4x4* volumeMat, const double planes[24]);
+
   /**
    * Divide the image data in NxMxO user-defined blocks.
    */
@@ -290,6 +326,12 @@ private:
   Size3 Partitions;
 
   vtkDataArray* Scalars;
+
+  unsigned int TextureFormat;
+  unsigned int TextureInternalFormat;
+  int TextureType;
+  size_t BrickCacheBytes;
+  vtkMTimeType BrickCacheClock;
 };
 
 VTK_ABI_NAMESPACE_END
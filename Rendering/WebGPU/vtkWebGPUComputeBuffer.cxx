@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkWebGPUComputeBuffer.h"
+
+#include "vtkDataArray.h"
+#include "vtkDataArrayRange.h"
+#include "vtkObjectFactory.h"
+
+#include <algorithm>
+#include <cstring>
+
+VTK_ABI_NAMESPACE_BEGIN
+
+//------------------------------------------------------------------------------
+vtkStandardNewMacro(vtkWebGPUComputeBuffer);
+
+//------------------------------------------------------------------------------
+vtkWebGPUComputeBuffer::vtkWebGPUComputeBuffer() = default;
+
+//------------------------------------------------------------------------------
+vtkWebGPUComputeBuffer::~vtkWebGPUComputeBuffer() = default;
+
+//------------------------------------------------------------------------------
+void vtkWebGPUComputeBuffer::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Group: " << this->Group << "\n";
+  os << indent << "Binding: " << this->Binding << "\n";
+  os << indent << "Mode: " << this->Mode << "\n";
+  os << indent << "Label: " << this->Label << "\n";
+  os << indent << "ByteSize: " << this->ByteSize << "\n";
+}
+
+//------------------------------------------------------------------------------
+void vtkWebGPUComputeBuffer::SetData(vtkDataArray* array)
+{
+  if (array == nullptr)
+  {
+    this->SetByteSize(0);
+    return;
+  }
+  const auto values = vtk::DataArrayValueRange(array);
+  std::vector<float> floats(values.size());
+  std::transform(values.cbegin(), values.cend(), floats.begin(),
+    [](double value) { return static_cast<float>(value); });
+  this->SetData(floats.data(), floats.size() * sizeof(float));
+}
+
+//------------------------------------------------------------------------------
+void vtkWebGPUComputeBuffer::SetData(const void* data, std::size_t byteSize)
+{
+  this->Data.resize(byteSize);
+  if (byteSize > 0)
+  {
+    std::memcpy(this->Data.data(), data, byteSize);
+  }
+  this->ByteSize = byteSize;
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkWebGPUComputeBuffer::SetByteSize(std::size_t byteSize)
+{
+  this->Data.clear();
+  this->ByteSize = byteSize;
+  this->Modified();
+}
+
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkWebGPUComputeBuffer
+ * @brief   a buffer bound to a vtkWebGPUComputePass
+ *
+ * vtkWebGPUComputeBuffer describes one binding of a compute shader: its bind group and binding
+ * indices, whether the shader reads it, writes it or uses it as uniforms, and its initial
+ * content. The content can mirror a vtkDataArray, in which case the values are converted to
+ * 32-bit floats since WGSL has no double precision type, or be given as raw bytes. Buffers
+ * only written by the shader just need a byte size.
+ *
+ * @sa vtkWebGPUComputePass
+ */
+#ifndef vtkWebGPUComputeBuffer_h
+#define vtkWebGPUComputeBuffer_h
+
+#include "vtkObject.h"
+
+#include "vtkRenderingWebGPUModule.h" // for export macro
+
+#include <string> // for ivar
+#include <vector> // for ivar
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkDataArray;
+
+class VTKRENDERINGWEBGPU_EXPORT vtkWebGPUComputeBuffer : public vtkObject
+{
+public:
+  static vtkWebGPUComputeBuffer* New();
+  vtkTypeMacro(vtkWebGPUComputeBuffer, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  enum BufferMode
+  {
+    // var<storage, read> in the shader.
+    READ_ONLY_COMPUTE_STORAGE = 0,
+    // var<storage, read_write> in the shader, can be read back with
+    // vtkWebGPUComputePass::ReadBufferFromGPU.
+    READ_WRITE_COMPUTE_STORAGE,
+    // var<uniform> in the shader.
+    UNIFORM_BUFFER
+  };
+
+  ///@{
+  /**
+   * Bind group and binding of the buffer in the shader, as in
+   * `@group(0) @binding(1)`. Default is 0 for both.
+   */
+  vtkSetMacro(Group, vtkTypeUInt32);
+  vtkGetMacro(Group, vtkTypeUInt32);
+  vtkSetMacro(Binding, vtkTypeUInt32);
+  vtkGetMacro(Binding, vtkTypeUInt32);
+  ///@}
+
+  ///@{
+  /**
+   * How the shader uses the buffer. Default is READ_ONLY_COMPUTE_STORAGE.
+   */
+  vtkSetClampMacro(Mode, int, READ_ONLY_COMPUTE_STORAGE, UNIFORM_BUFFER);
+  vtkGetMacro(Mode, int);
+  ///@}
+
+  ///@{
+  /**
+   * Label given to the device buffer, shown in the WebGPU validation messages.
+   */
+  vtkSetMacro(Label, std::string);
+  vtkGetMacro(Label, std::string);
+  ///@}
+
+  /**
+   * Initialize the content of the buffer with the values of the array, converted to floats.
+   * The components of a tuple are consecutive.
+   */
+  void SetData(vtkDataArray* array);
+
+  /**
+   * Initialize the content of the buffer with byteSize bytes.
+   */
+  void SetData(const void* data, std::size_t byteSize);
+
+  /**
+   * Size of the buffer in bytes. Setting it discards the content, the device buffer is then
+   * zero initialized. The size is rounded up to a multiple of 4 bytes on the device.
+   */
+  void SetByteSize(std::size_t byteSize);
+  std::size_t GetByteSize() const { return this->ByteSize; }
+
+  /**
+   * Content given by SetData, empty when only the size was set.
+   */
+  const std::vector<unsigned char>& GetData() const { return this->Data; }
+
+protected:
+  vtkWebGPUComputeBuffer();
+  ~vtkWebGPUComputeBuffer() override;
+
+  vtkTypeUInt32 Group = 0;
+  vtkTypeUInt32 Binding = 0;
+  int Mode = READ_ONLY_COMPUTE_STORAGE;
+  std::string Label;
+  std::vector<unsigned char> Data;
+  std::size_t ByteSize = 0;
+
+private:
+  vtkWebGPUComputeBuffer(const vtkWebGPUComputeBuffer&) = delete;
+  void operator=(const vtkWebGPUComputeBuffer&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -0,0 +1,369 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkWebGPUComputePass.h"
+
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+#include "vtkWGPUContext.h"
+#include "vtkWebGPUComputeBuffer.h"
+#include "vtkWebGPUInternalsBuffer.h"
+#include "vtkWebGPUInternalsShaderModule.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+
+struct vtkWebGPUComputePass::vtkInternals
+{
+  wgpu::Device Device;
+  std::vector<vtkSmartPointer<vtkWebGPUComputeBuffer>> Buffers;
+
+  // Device resources, rebuilt when the pass or a buffer is modified.
+  std::vector<wgpu::Buffer> DeviceBuffers;
+  std::vector<wgpu::BindGroup> BindGroups;
+  wgpu::ShaderModule ShaderModule;
+  std::string ShaderModuleSource;
+  wgpu::ComputePipeline Pipeline;
+  vtkTimeStamp BuildTime;
+};
+
+//------------------------------------------------------------------------------
+vtkStandardNewMacro(vtkWebGPUComputePass);
+
+//------------------------------------------------------------------------------
+vtkWebGPUComputePass::vtkWebGPUComputePass()
+  : Internals(new vtkInternals)
+{
+}
+
+//------------------------------------------------------------------------------
+vtkWebGPUComputePass::~vtkWebGPUComputePass() = default;
+
+//------------------------------------------------------------------------------
+void vtkWebGPUComputePass::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "ShaderEntryPoint: " << this->ShaderEntryPoint << "\n";
+  os << indent << "Workgroups: " << this->Workgroups[0] << ", " << this->Workgroups[1] << ", "
+     << this->Workgroups[2] << "\n";
+  os << indent << "NumberOfBuffers: " << this->Internals->Buffers.size() << "\n";
+}
+
+//------------------------------------------------------------------------------
+void vtkWebGPUComputePass::SetDevice(const wgpu::Device& device)
+{
+  if (this->Internals->Device.Get() != device.Get())
+  {
+    this->ReleaseResources();
+    this->Internals->Device = device;
+    this->Modified();
+  }
+}
+
+//------------------------------------------------------------------------------
+wgpu::Device vtkWebGPUComputePass::GetDevice()
+{
+  if (this->Internals->Device.Get() == nullptr)
+  {
+    wgpu::RequestAdapterOptions options;
+    wgpu::Adapter adapter = vtkWGPUContext::RequestAdapter(options);
+    wgpu::DeviceDescriptor deviceDescriptor = {};
+    deviceDescriptor.label = "vtkWebGPUComputePass";
+    this->Internals->Device = vtkWGPUContext::RequestDevice(adapter, deviceDescriptor);
+  }
+  return this->Internals->Device;
+}
+
+//------------------------------------------------------------------------------
+int vtkWebGPUComputePass::AddBuffer(vtkWebGPUComputeBuffer* buffer)
+{
+  this->Internals->Buffers.emplace_back(buffer);
+  this->Modified();
+  return static_cast<int>(this->Internals->Buffers.size()) - 1;
+}
+
+//------------------------------------------------------------------------------
+vtkWebGPUComputeBuffer* vtkWebGPUComputePass::GetBuffer(int index)
+{
+  if (index < 0 || index >= static_cast<int>(this->Internals->Buffers.size()))
+  {
+    return nullptr;
+  }
+  return this->Internals->Buffers[index];
+}
+
+//------------------------------------------------------------------------------
+void vtkWebGPUComputePass::RemoveAllBuffers()
+{
+  this->Internals->Buffers.clear();
+  this->Internals->DeviceBuffers.clear();
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkWebGPUComputePass::SetWorkgroups(vtkTypeUInt32 x, vtkTypeUInt32 y, vtkTypeUInt32 z)
+{
+  // Not a modification of the pass: the device resources do not depend on it.
+  this->Workgroups[0] = std::max<vtkTypeUInt32>(x, 1);
+  this->Workgroups[1] = std::max<vtkTypeUInt32>(y, 1);
+  this->Workgroups[2] = std::max<vtkTypeUInt32>(z, 1);
+}
+
+//------------------------------------------------------------------------------
+vtkTypeUInt32 vtkWebGPUComputePass::GetNumberOfWorkgroups(
+  vtkIdType count, vtkTypeUInt32 workgroupSize)
+{
+  return static_cast<vtkTypeUInt32>((count + workgroupSize - 1) / workgroupSize);
+}
+
+//------------------------------------------------------------------------------
+void vtkWebGPUComputePass::UpdateBufferData(int index, const void* data, std::size_t byteSize)
+{
+  vtkInternals& internals = *this->Internals;
+  if (index < 0 || index >= static_cast<int>(internals.DeviceBuffers.size()))
+  {
+    vtkErrorMacro(<< "No device buffer at index " << index << ", call Dispatch() first.");
+    return;
+  }
+  const wgpu::Buffer& buffer = internals.DeviceBuffers[index];
+  if (byteSize > buffer.GetSize())
+  {
+    vtkErrorMacro(<< "Cannot write " << byteSize << " bytes in a buffer of " << buffer.GetSize()
+                  << " bytes.");
+    return;
+  }
+  // WriteBuffer requires a size multiple of 4 bytes.
+  std::vector<unsigned char> padded(vtkWGPUContext::Align(byteSize, 4), 0);
+  std::memcpy(padded.data(), data, byteSize);
+  internals.Device.GetQueue().WriteBuffer(buffer, 0, padded.data(), padded.size());
+}
+
+//------------------------------------------------------------------------------
+bool vtkWebGPUComputePass::BuildResources()
+{
+  vtkInternals& internals = *this->Internals;
+  bool modified = internals.BuildTime < this->GetMTime() || internals.Pipeline.Get() == nullptr;
+  for (const auto& buffer : internals.Buffers)
+  {
+    modified |= internals.BuildTime < buffer->GetMTime();
+  }
+  if (!modified)
+  {
+    return true;
+  }
+
+  const wgpu::Device device = this->GetDevice();
+  if (device.Get() == nullptr)
+  {
+    vtkErrorMacro(<< "No WebGPU device available.");
+    return false;
+  }
+  if (this->ShaderSource.empty())
+  {
+    vtkErrorMacro(<< "No compute shader source.");
+    return false;
+  }
+
+  if (internals.ShaderModule.Get() == nullptr || internals.ShaderModuleSource != this->ShaderSource)
+  {
+    internals.ShaderModule =
+      vtkWebGPUInternalsShaderModule::CreateFromWGSL(device, this->ShaderSource);
+    internals.ShaderModuleSource = this->ShaderSource;
+  }
+
+  // device buffers, only recreated for the buffers modified since the last build
+  internals.DeviceBuffers.resize(internals.Buffers.size());
+  vtkTypeUInt32 numberOfGroups = 0;
+  for (std::size_t i = 0; i < internals.Buffers.size(); ++i)
+  {
+    vtkWebGPUComputeBuffer* buffer = internals.Buffers[i];
+    numberOfGroups = std::max(numberOfGroups, buffer->GetGroup() + 1);
+    if (internals.DeviceBuffers[i].Get() != nullptr && buffer->GetMTime() < internals.BuildTime)
+    {
+      continue;
+    }
+    const bool uniform = buffer->GetMode() == vtkWebGPUComputeBuffer::UNIFORM_BUFFER;
+    const wgpu::BufferUsage usage = uniform
+      ? wgpu::BufferUsage::Uniform | wgpu::BufferUsage::CopyDst
+      : wgpu::BufferUsage::Storage | wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::CopySrc;
+    const std::size_t size = vtkWGPUContext::Align(std::max<std::size_t>(buffer->GetByteSize(), 4),
+      uniform ? 16 : 4);
+    const std::vector<unsigned char>& data = buffer->GetData();
+    if (data.empty())
+    {
+      internals.DeviceBuffers[i] = vtkWebGPUInternalsBuffer::CreateABuffer(
+        device, size, usage, false, buffer->GetLabel().c_str());
+    }
+    else
+    {
+      std::vector<unsigned char> padded(size, 0);
+      std::copy(data.begin(), data.end(), padded.begin());
+      internals.DeviceBuffers[i] = vtkWebGPUInternalsBuffer::Upload(
+        device, 0, padded.data(), size, usage, buffer->GetLabel().c_str());
+    }
+  }
+
+  // one bind group layout and bind group per group index
+  std::vector<wgpu::BindGroupLayout> layouts(numberOfGroups);
+  internals.BindGroups.assign(numberOfGroups, nullptr);
+  for (vtkTypeUInt32 group = 0; group < numberOfGroups; ++group)
+  {
+    std::vector<wgpu::BindGroupLayoutEntry> layoutEntries;
+    std::vector<wgpu::BindGroupEntry> entries;
+    for (std::size_t i = 0; i < internals.Buffers.size(); ++i)
+    {
+      vtkWebGPUComputeBuffer* buffer = internals.Buffers[i];
+      if (buffer->GetGroup() != group)
+      {
+        continue;
+      }
+      wgpu::BindGroupLayoutEntry layoutEntry;
+      layoutEntry.binding = buffer->GetBinding();
+      layoutEntry.visibility = wgpu::ShaderStage::Compute;
+      switch (buffer->GetMode())
+      {
+        case vtkWebGPUComputeBuffer::UNIFORM_BUFFER:
+          layoutEntry.buffer.type = wgpu::BufferBindingType::Uniform;
+          break;
+        case vtkWebGPUComputeBuffer::READ_WRITE_COMPUTE_STORAGE:
+          layoutEntry.buffer.type = wgpu::BufferBindingType::Storage;
+          break;
+        case vtkWebGPUComputeBuffer::READ_ONLY_COMPUTE_STORAGE:
+        default:
+          layoutEntry.buffer.type = wgpu::BufferBindingType::ReadOnlyStorage;
+          break;
+      }
+      layoutEntries.emplace_back(layoutEntry);
+
+      wgpu::BindGroupEntry entry;
+      entry.binding = buffer->GetBinding();
+      entry.buffer = internals.DeviceBuffers[i];
+      entry.offset = 0;
+      entry.size = internals.DeviceBuffers[i].GetSize();
+      entries.emplace_back(entry);
+    }
+
+    wgpu::BindGroupLayoutDescriptor layoutDescriptor;
+    layoutDescriptor.entryCount = static_cast<uint32_t>(layoutEntries.size());
+    layoutDescriptor.entries = layoutEntries.data();
+    layouts[group] = device.CreateBindGroupLayout(&layoutDescriptor);
+
+    wgpu::BindGroupDescriptor descriptor;
+    descriptor.layout = layouts[group];
+    descriptor.entryCount = static_cast<uint32_t>(entries.size());
+    descriptor.entries = entries.data();
+    internals.BindGroups[group] = device.CreateBindGroup(&descriptor);
+  }
+
+  wgpu::PipelineLayoutDescriptor pipelineLayoutDescriptor;
+  pipelineLayoutDescriptor.bindGroupLayoutCount = numberOfGroups;
+  pipelineLayoutDescriptor.bindGroupLayouts = layouts.data();
+
+  wgpu::ComputePipelineDescriptor pipelineDescriptor;
+  pipelineDescriptor.label = "vtkWebGPUComputePass";
+  pipelineDescriptor.layout = device.CreatePipelineLayout(&pipelineLayoutDescriptor);
+  pipelineDescriptor.compute.module = internals.ShaderModule;
+  pipelineDescriptor.compute.entryPoint = this->ShaderEntryPoint.c_str();
+  internals.Pipeline = device.CreateComputePipeline(&pipelineDescriptor);
+
+  internals.BuildTime.Modified();
+  return internals.Pipeline.Get() != nullptr;
+}
+
+//------------------------------------------------------------------------------
+bool vtkWebGPUComputePass::Dispatch()
+{
+  if (!this->BuildResources())
+  {
+    return false;
+  }
+  vtkInternals& internals = *this->Internals;
+
+  wgpu::CommandEncoder encoder = internals.Device.CreateCommandEncoder();
+  wgpu::ComputePassEncoder pass = encoder.BeginComputePass();
+  pass.SetPipeline(internals.Pipeline);
+  for (std::size_t group = 0; group < internals.BindGroups.size(); ++group)
+  {
+    pass.SetBindGroup(static_cast<uint32_t>(group), internals.BindGroups[group]);
+  }
+  pass.DispatchWorkgroups(this->Workgroups[0], this->Workgroups[1], this->Workgroups[2]);
+  pass.End();
+  wgpu::CommandBuffer commands = encoder.Finish();
+  internals.Device.GetQueue().Submit(1, &commands);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkWebGPUComputePass::ReadBufferFromGPU(int index, void* data, std::size_t byteSize)
+{
+  vtkInternals& internals = *this->Internals;
+  if (index < 0 || index >= static_cast<int>(internals.DeviceBuffers.size()) ||
+    internals.Buffers[index]->GetMode() != vtkWebGPUComputeBuffer::READ_WRITE_COMPUTE_STORAGE)
+  {
+    vtkErrorMacro(<< "No read-write device buffer at index " << index << ".");
+    return false;
+  }
+  if (byteSize == 0)
+  {
+    return true;
+  }
+  const wgpu::Buffer& source = internals.DeviceBuffers[index];
+  const std::size_t size = vtkWGPUContext::Align(byteSize, 4);
+  if (size > source.GetSize())
+  {
+    vtkErrorMacro(<< "Cannot read " << byteSize << " bytes from a buffer of " << source.GetSize()
+                  << " bytes.");
+    return false;
+  }
+
+  wgpu::Buffer staging = vtkWebGPUInternalsBuffer::CreateABuffer(internals.Device, size,
+    wgpu::BufferUsage::MapRead | wgpu::BufferUsage::CopyDst, false,
+    "vtkWebGPUComputePass read back");
+  wgpu::CommandEncoder encoder = internals.Device.CreateCommandEncoder();
+  encoder.CopyBufferToBuffer(source, 0, staging, 0, size);
+  wgpu::CommandBuffer commands = encoder.Finish();
+  internals.Device.GetQueue().Submit(1, &commands);
+
+  struct MappingContext
+  {
+    bool Done = false;
+    bool Success = false;
+  } context;
+  staging.MapAsync(
+    wgpu::MapMode::Read, 0, size,
+    [](WGPUBufferMapAsyncStatus status, void* userdata) {
+      auto ctx = reinterpret_cast<MappingContext*>(userdata);
+      ctx->Success = status == WGPUBufferMapAsyncStatus_Success;
+      ctx->Done = true;
+    },
+    &context);
+  while (!context.Done)
+  {
+    vtkWGPUContext::WaitABit();
+  }
+  if (!context.Success)
+  {
+    vtkErrorMacro(<< "Failed to map the read back buffer.");
+    return false;
+  }
+  const void* mapped = staging.GetConstMappedRange(0, size);
+  std::memcpy(data, mapped, byteSize);
+  staging.Unmap();
+  staging.Destroy();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkWebGPUComputePass::ReleaseResources()
+{
+  vtkInternals& internals = *this->Internals;
+  internals.DeviceBuffers.clear();
+  internals.BindGroups.clear();
+  internals.Pipeline = nullptr;
+  internals.ShaderModule = nullptr;
+  internals.ShaderModuleSource.clear();
+}
+
+VTK_ABI_NAMESPACE_END
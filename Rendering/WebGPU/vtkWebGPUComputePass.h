@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkWebGPUComputePass
+ * @brief   run a WGSL compute shader on vtkWebGPUComputeBuffer objects
+ *
+ * vtkWebGPUComputePass compiles a compute shader, creates the device buffers, bind group
+ * layouts, bind groups and compute pipeline matching the vtkWebGPUComputeBuffer objects added
+ * to it, and dispatches the shader. Buffers written by the shader can then be read back with
+ * ReadBufferFromGPU().
+ *
+ * The device resources are created on the first Dispatch() and rebuilt when the pass or one of
+ * its buffers is modified. UpdateBufferData() uploads new content without rebuilding anything,
+ * which is the cheap way to change the parameters of consecutive dispatches.
+ *
+ * The pass runs on the device given to SetDevice(), for instance the one of a
+ * vtkWebGPURenderWindow so that the results can be used for rendering, or requests its own
+ * device through vtkWGPUContext otherwise.
+ *
+ * @warning ReadBufferFromGPU() waits for the device, which requires the Dawn event loop. In a
+ * browser, the wait only returns when the application is built with ASYNCIFY.
+ *
+ * @sa vtkWebGPUComputeBuffer
+ */
+#ifndef vtkWebGPUComputePass_h
+#define vtkWebGPUComputePass_h
+
+#include "vtkObject.h"
+
+#include "vtkRenderingWebGPUModule.h" // for export macro
+#include "vtk_wgpu.h"                 // for webgpu
+
+#include <memory> // for unique_ptr
+#include <string> // for ivar
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkWebGPUComputeBuffer;
+
+class VTKRENDERINGWEBGPU_EXPORT vtkWebGPUComputePass : public vtkObject
+{
+public:
+  static vtkWebGPUComputePass* New();
+  vtkTypeMacro(vtkWebGPUComputePass, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Device the pass runs on. When not set, a device is requested on the first dispatch.
+   */
+  void SetDevice(const wgpu::Device& device);
+  wgpu::Device GetDevice();
+  ///@}
+
+  ///@{
+  /**
+   * WGSL source of the compute shader and name of its entry point.
+   * Default entry point is "computeMain".
+   */
+  vtkSetMacro(ShaderSource, std::string);
+  vtkGetMacro(ShaderSource, std::string);
+  vtkSetMacro(ShaderEntryPoint, std::string);
+  vtkGetMacro(ShaderEntryPoint, std::string);
+  ///@}
+
+  /**
+   * Add a buffer bound to the shader, returns its index in the pass.
+   */
+  int AddBuffer(vtkWebGPUComputeBuffer* buffer);
+
+  /**
+   * Get the buffer at the given index, nullptr if out of range.
+   */
+  vtkWebGPUComputeBuffer* GetBuffer(int index);
+
+  /**
+   * Remove all the buffers.
+   */
+  void RemoveAllBuffers();
+
+  /**
+   * Write byteSize bytes at the beginning of the device buffer at the given index. The device
+   * resources must exist, i.e. Dispatch() was called since the last modification of the pass,
+   * and byteSize must not exceed the size of the buffer.
+   */
+  void UpdateBufferData(int index, const void* data, std::size_t byteSize);
+
+  /**
+   * Set the number of workgroups launched by Dispatch() in each dimension.
+   */
+  void SetWorkgroups(vtkTypeUInt32 x, vtkTypeUInt32 y = 1, vtkTypeUInt32 z = 1);
+
+  /**
+   * Number of workgroups of workgroupSize invocations needed to cover count invocations.
+   */
+  static vtkTypeUInt32 GetNumberOfWorkgroups(vtkIdType count, vtkTypeUInt32 workgroupSize);
+
+  /**
+   * Build the device resources if needed and submit the compute shader.
+   * Returns false when the resources could not be built.
+   */
+  bool Dispatch();
+
+  /**
+   * Copy the first byteSize bytes of the device buffer at the given index into data, waiting
+   * for the work submitted so far. The buffer must be a READ_WRITE_COMPUTE_STORAGE buffer.
+   */
+  bool ReadBufferFromGPU(int index, void* data, std::size_t byteSize);
+
+  /**
+   * Release the device resources, they are rebuilt on the next dispatch.
+   */
+  void ReleaseResources();
+
+protected:
+  vtkWebGPUComputePass();
+  ~vtkWebGPUComputePass() override;
+
+  bool BuildResources();
+
+  std::string ShaderSource;
+  std::string ShaderEntryPoint = "computeMain";
+  vtkTypeUInt32 Workgroups[3] = { 1, 1, 1 };
+
+private:
+  vtkWebGPUComputePass(const vtkWebGPUComputePass&) = delete;
+  void operator=(const vtkWebGPUComputePass&) = delete;
+
+  struct vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -0,0 +1,285 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkWebGPUImageContourFilter.h"
+
+#include "vtkCellArray.h"
+#include "vtkDataArray.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkFloatArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkMarchingCubesTriangleCases.h"
+#include "vtkMatrix3x3.h"
+#include "vtkObjectFactory.h"
+#include "vtkPlane.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkWebGPUComputeBuffer.h"
+#include "vtkWebGPUComputePass.h"
+
+#include "ImageContour.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+
+namespace
+{
+// Matches struct Parameters of ImageContour.wgsl.
+struct ContourParameters
+{
+  vtkTypeUInt32 Dims[4];
+  float Value[4];
+  float Plane[4];
+  vtkTypeUInt32 Capacity[4];
+};
+
+constexpr vtkTypeUInt32 WorkgroupSize = 64;
+constexpr vtkTypeUInt32 MaximumWorkgroups = 65535;
+}
+
+//------------------------------------------------------------------------------
+vtkStandardNewMacro(vtkWebGPUImageContourFilter);
+
+//------------------------------------------------------------------------------
+vtkWebGPUImageContourFilter::vtkWebGPUImageContourFilter()
+{
+  this->SetInputArrayToProcess(
+    0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, vtkDataSetAttributes::SCALARS);
+
+  this->ParametersBuffer->SetMode(vtkWebGPUComputeBuffer::UNIFORM_BUFFER);
+  this->ParametersBuffer->SetBinding(0);
+  this->ParametersBuffer->SetLabel("ImageContour parameters");
+  this->ScalarsBuffer->SetMode(vtkWebGPUComputeBuffer::READ_ONLY_COMPUTE_STORAGE);
+  this->ScalarsBuffer->SetBinding(1);
+  this->ScalarsBuffer->SetLabel("ImageContour scalars");
+  this->CasesBuffer->SetMode(vtkWebGPUComputeBuffer::READ_ONLY_COMPUTE_STORAGE);
+  this->CasesBuffer->SetBinding(2);
+  this->CasesBuffer->SetLabel("ImageContour cases");
+  this->CounterBuffer->SetMode(vtkWebGPUComputeBuffer::READ_WRITE_COMPUTE_STORAGE);
+  this->CounterBuffer->SetBinding(3);
+  this->CounterBuffer->SetLabel("ImageContour counter");
+  this->TrianglesBuffer->SetMode(vtkWebGPUComputeBuffer::READ_WRITE_COMPUTE_STORAGE);
+  this->TrianglesBuffer->SetBinding(4);
+  this->TrianglesBuffer->SetLabel("ImageContour triangles");
+
+  std::vector<vtkTypeInt32> cases(256 * 16);
+  const vtkMarchingCubesTriangleCases* triangleCases =
+    vtkMarchingCubesTriangleCases::GetCases();
+  for (int i = 0; i < 256; ++i)
+  {
+    std::copy(triangleCases[i].edges, triangleCases[i].edges + 16, cases.begin() + 16 * i);
+  }
+  this->CasesBuffer->SetData(cases.data(), cases.size() * sizeof(vtkTypeInt32));
+
+  this->ComputePass->SetShaderSource(ImageContour);
+  this->ComputePass->AddBuffer(this->ParametersBuffer);
+  this->ComputePass->AddBuffer(this->ScalarsBuffer);
+  this->ComputePass->AddBuffer(this->CasesBuffer);
+  this->ComputePass->AddBuffer(this->CounterBuffer);
+  this->ComputePass->AddBuffer(this->TrianglesBuffer);
+}
+
+//------------------------------------------------------------------------------
+vtkWebGPUImageContourFilter::~vtkWebGPUImageContourFilter() = default;
+
+//------------------------------------------------------------------------------
+void vtkWebGPUImageContourFilter::SetDevice(const wgpu::Device& device)
+{
+  this->ComputePass->SetDevice(device);
+}
+
+//------------------------------------------------------------------------------
+vtkMTimeType vtkWebGPUImageContourFilter::GetMTime()
+{
+  vtkMTimeType mTime = this->Superclass::GetMTime();
+  if (this->Plane)
+  {
+    mTime = std::max(mTime, this->Plane->GetMTime());
+  }
+  return mTime;
+}
+
+//------------------------------------------------------------------------------
+int vtkWebGPUImageContourFilter::FillInputPortInformation(int, vtkInformation* info)
+{
+  info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkImageData");
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkWebGPUImageContourFilter::RequestData(vtkInformation*,
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkImageData* input = vtkImageData::GetData(inputVector[0]);
+  vtkPolyData* output = vtkPolyData::GetData(outputVector);
+
+  int dims[3];
+  input->GetDimensions(dims);
+  if (dims[0] < 2 || dims[1] < 2 || dims[2] < 2)
+  {
+    vtkErrorMacro(<< "Only 3D images are supported.");
+    return 0;
+  }
+  const vtkIdType numberOfCells = input->GetNumberOfCells();
+  if (numberOfCells > std::numeric_limits<vtkTypeUInt32>::max())
+  {
+    vtkErrorMacro(<< "The image has too many cells.");
+    return 0;
+  }
+
+  ContourParameters parameters = {};
+  std::copy(dims, dims + 3, parameters.Dims);
+  parameters.Value[0] = static_cast<float>(this->Value);
+
+  if (this->Plane)
+  {
+    // The plane function is affine in the point indices: evaluate it at the origin of the
+    // index space and one step along each axis.
+    int* extent = input->GetExtent();
+    double* origin = input->GetOrigin();
+    double* spacing = input->GetSpacing();
+    double* direction = input->GetDirectionMatrix()->GetData();
+    double xyz[3];
+    vtkImageData::TransformContinuousIndexToPhysicalPoint(
+      extent[0], extent[2], extent[4], origin, spacing, direction, xyz);
+    const double constant = this->Plane->EvaluateFunction(xyz);
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      double ijk[3] = { static_cast<double>(extent[0]), static_cast<double>(extent[2]),
+        static_cast<double>(extent[4]) };
+      ijk[axis] += 1.0;
+      vtkImageData::TransformContinuousIndexToPhysicalPoint(
+        ijk[0], ijk[1], ijk[2], origin, spacing, direction, xyz);
+      parameters.Plane[axis] = static_cast<float>(this->Plane->EvaluateFunction(xyz) - constant);
+    }
+    parameters.Plane[3] = static_cast<float>(constant);
+    parameters.Value[1] = 1.0f;
+
+    // The shader does not read the scalars, keep the buffer as small as possible.
+    if (this->UploadedScalars || this->ScalarsBuffer->GetByteSize() == 0)
+    {
+      this->ScalarsBuffer->SetByteSize(4);
+      this->UploadedScalars = nullptr;
+    }
+  }
+  else
+  {
+    vtkDataArray* scalars = this->GetInputArrayToProcess(0, inputVector);
+    if (!scalars)
+    {
+      vtkErrorMacro(<< "No point scalars to contour.");
+      return 0;
+    }
+    if (scalars != this->UploadedScalars || scalars->GetMTime() != this->UploadedScalarsMTime)
+    {
+      const vtkIdType numberOfPoints = scalars->GetNumberOfTuples();
+      std::vector<float> values(numberOfPoints);
+      vtkSMPTools::For(0, numberOfPoints, [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          values[i] = static_cast<float>(scalars->GetComponent(i, 0));
+        }
+      });
+      this->ScalarsBuffer->SetData(values.data(), values.size() * sizeof(float));
+      this->UploadedScalars = scalars;
+      this->UploadedScalarsMTime = scalars->GetMTime();
+    }
+  }
+
+  // Lay the workgroups out on a 2D grid since each dimension is limited to 65535.
+  const vtkTypeUInt32 workgroups =
+    vtkWebGPUComputePass::GetNumberOfWorkgroups(numberOfCells, WorkgroupSize);
+  const vtkTypeUInt32 workgroupsX = std::min(workgroups, MaximumWorkgroups);
+  this->ComputePass->SetWorkgroups(
+    workgroupsX, (workgroups + workgroupsX - 1) / workgroupsX);
+
+  // First pass: count the triangles.
+  const vtkTypeUInt32 zero = 0;
+  vtkTypeUInt32 numberOfTriangles = 0;
+  this->ParametersBuffer->SetData(&parameters, sizeof(parameters));
+  this->CounterBuffer->SetData(&zero, sizeof(zero));
+  if (this->TrianglesBuffer->GetByteSize() == 0)
+  {
+    this->TrianglesBuffer->SetByteSize(4);
+  }
+  if (!this->ComputePass->Dispatch() ||
+    !this->ComputePass->ReadBufferFromGPU(3, &numberOfTriangles, sizeof(numberOfTriangles)))
+  {
+    vtkErrorMacro(<< "Failed to count the triangles on the device.");
+    return 0;
+  }
+
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToFloat();
+  vtkNew<vtkCellArray> polys;
+  output->SetPoints(points);
+  output->SetPolys(polys);
+  if (numberOfTriangles == 0)
+  {
+    return 1;
+  }
+
+  // Second pass: write them.
+  std::vector<float> triangles(9 * static_cast<std::size_t>(numberOfTriangles));
+  this->TrianglesBuffer->SetByteSize(triangles.size() * sizeof(float));
+  parameters.Dims[3] = 1;
+  parameters.Capacity[0] = numberOfTriangles;
+  this->ParametersBuffer->SetData(&parameters, sizeof(parameters));
+  this->CounterBuffer->SetData(&zero, sizeof(zero));
+  if (!this->ComputePass->Dispatch() ||
+    !this->ComputePass->ReadBufferFromGPU(
+      4, triangles.data(), triangles.size() * sizeof(float)))
+  {
+    vtkErrorMacro(<< "Failed to generate the triangles on the device.");
+    return 0;
+  }
+
+  // The shader outputs index coordinates relative to the first point of the extent.
+  const vtkIdType numberOfPoints = 3 * static_cast<vtkIdType>(numberOfTriangles);
+  points->SetNumberOfPoints(numberOfPoints);
+  vtkFloatArray* coordinates = vtkFloatArray::SafeDownCast(points->GetData());
+  int* extent = input->GetExtent();
+  double* origin = input->GetOrigin();
+  double* spacing = input->GetSpacing();
+  double* direction = input->GetDirectionMatrix()->GetData();
+  vtkSMPTools::For(0, numberOfPoints, [&](vtkIdType begin, vtkIdType end) {
+    float* xyz = coordinates->GetPointer(3 * begin);
+    double point[3];
+    for (vtkIdType i = begin; i < end; ++i, xyz += 3)
+    {
+      const float* ijk = triangles.data() + 3 * i;
+      vtkImageData::TransformContinuousIndexToPhysicalPoint(ijk[0] + extent[0],
+        ijk[1] + extent[2], ijk[2] + extent[4], origin, spacing, direction, point);
+      xyz[0] = static_cast<float>(point[0]);
+      xyz[1] = static_cast<float>(point[1]);
+      xyz[2] = static_cast<float>(point[2]);
+    }
+  });
+
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfValues(numberOfPoints);
+  vtkSMPTools::For(0, numberOfPoints, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      connectivity->SetValue(i, i);
+    }
+  });
+  polys->SetData(3, connectivity);
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkWebGPUImageContourFilter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Value: " << this->Value << "\n";
+  os << indent << "Plane: " << this->Plane << "\n";
+}
+
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,98 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkWebGPUImageContourFilter
+ * @brief   contour or cut a vtkImageData with a WebGPU compute shader
+ *
+ * vtkWebGPUImageContourFilter runs marching cubes on the device: each cell of the input image
+ * is processed by one shader invocation, which appends its triangles to a device buffer. A
+ * first dispatch counts the triangles, a second one writes them, and the triangles are read
+ * back into the output vtkPolyData.
+ *
+ * The filter extracts the isosurface of the point scalars selected with
+ * SetInputArrayToProcess() (first component, converted to float) at the given Value, or, when
+ * a Plane is set, cuts the image with the plane; the plane function is then evaluated by the
+ * shader and no scalars are uploaded. The scalars are only uploaded again when they change, so
+ * that moving the contour value or the plane interactively is cheap.
+ *
+ * The output triangles do not share their points and their order depends on the scheduling of
+ * the device. Only 3D images are supported. Run vtkStaticCleanPolyData on the output to merge
+ * coincident points if needed.
+ *
+ * @sa vtkWebGPUComputePass vtkFlyingEdges3D vtkCutter
+ */
+#ifndef vtkWebGPUImageContourFilter_h
+#define vtkWebGPUImageContourFilter_h
+
+#include "vtkPolyDataAlgorithm.h"
+
+#include "vtkNew.h"                   // for ivar
+#include "vtkRenderingWebGPUModule.h" // for export macro
+#include "vtkSmartPointer.h"          // for ivar
+#include "vtk_wgpu.h"                 // for webgpu
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkDataArray;
+class vtkPlane;
+class vtkWebGPUComputeBuffer;
+class vtkWebGPUComputePass;
+
+class VTKRENDERINGWEBGPU_EXPORT vtkWebGPUImageContourFilter : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkWebGPUImageContourFilter* New();
+  vtkTypeMacro(vtkWebGPUImageContourFilter, vtkPolyDataAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Contour value. Default is 0.
+   */
+  vtkSetMacro(Value, double);
+  vtkGetMacro(Value, double);
+  ///@}
+
+  ///@{
+  /**
+   * When set, the image is cut by this plane instead of being contoured.
+   */
+  vtkSetSmartPointerMacro(Plane, vtkPlane);
+  vtkGetSmartPointerMacro(Plane, vtkPlane);
+  ///@}
+
+  /**
+   * Run the compute shaders on this device, for instance the one of a vtkWebGPURenderWindow.
+   * A device is requested otherwise.
+   */
+  void SetDevice(const wgpu::Device& device);
+
+  vtkMTimeType GetMTime() override;
+
+protected:
+  vtkWebGPUImageContourFilter();
+  ~vtkWebGPUImageContourFilter() override;
+
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+
+  double Value = 0.0;
+  vtkSmartPointer<vtkPlane> Plane;
+
+  vtkNew<vtkWebGPUComputePass> ComputePass;
+  vtkNew<vtkWebGPUComputeBuffer> ParametersBuffer;
+  vtkNew<vtkWebGPUComputeBuffer> ScalarsBuffer;
+  vtkNew<vtkWebGPUComputeBuffer> CasesBuffer;
+  vtkNew<vtkWebGPUComputeBuffer> CounterBuffer;
+  vtkNew<vtkWebGPUComputeBuffer> TrianglesBuffer;
+
+  // Scalars currently in ScalarsBuffer.
+  vtkDataArray* UploadedScalars = nullptr;
+  vtkMTimeType UploadedScalarsMTime = 0;
+
+private:
+  vtkWebGPUImageContourFilter(const vtkWebGPUImageContourFilter&) = delete;
+  void operator=(const vtkWebGPUImageContourFilter&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
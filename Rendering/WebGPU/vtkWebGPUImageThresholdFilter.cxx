@@ -0,0 +1,278 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkWebGPUImageThresholdFilter.h"
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkCellType.h"
+#include "vtkDataArray.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkFloatArray.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkMatrix3x3.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkSMPTools.h"
+#include "vtkUnstructuredGrid.h"
+#include "vtkWebGPUComputeBuffer.h"
+#include "vtkWebGPUComputePass.h"
+
+#include "ImageThreshold.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+
+namespace
+{
+// Matches struct Parameters of ImageThreshold.wgsl.
+struct ThresholdParameters
+{
+  vtkTypeUInt32 Dims[4];
+  float Thresholds[4];
+  vtkTypeUInt32 Capacity[4];
+};
+
+constexpr vtkTypeUInt32 WorkgroupSize = 64;
+constexpr vtkTypeUInt32 MaximumWorkgroups = 65535;
+
+// Point offsets of a voxel, in the order of VTK_VOXEL.
+constexpr int VoxelOffsets[8][3] = { { 0, 0, 0 }, { 1, 0, 0 }, { 0, 1, 0 }, { 1, 1, 0 },
+  { 0, 0, 1 }, { 1, 0, 1 }, { 0, 1, 1 }, { 1, 1, 1 } };
+}
+
+//------------------------------------------------------------------------------
+vtkStandardNewMacro(vtkWebGPUImageThresholdFilter);
+
+//------------------------------------------------------------------------------
+vtkWebGPUImageThresholdFilter::vtkWebGPUImageThresholdFilter()
+{
+  this->SetInputArrayToProcess(
+    0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, vtkDataSetAttributes::SCALARS);
+
+  this->ParametersBuffer->SetMode(vtkWebGPUComputeBuffer::UNIFORM_BUFFER);
+  this->ParametersBuffer->SetBinding(0);
+  this->ParametersBuffer->SetLabel("ImageThreshold parameters");
+  this->ScalarsBuffer->SetMode(vtkWebGPUComputeBuffer::READ_ONLY_COMPUTE_STORAGE);
+  this->ScalarsBuffer->SetBinding(1);
+  this->ScalarsBuffer->SetLabel("ImageThreshold scalars");
+  this->CounterBuffer->SetMode(vtkWebGPUComputeBuffer::READ_WRITE_COMPUTE_STORAGE);
+  this->CounterBuffer->SetBinding(2);
+  this->CounterBuffer->SetLabel("ImageThreshold counter");
+  this->CellIdsBuffer->SetMode(vtkWebGPUComputeBuffer::READ_WRITE_COMPUTE_STORAGE);
+  this->CellIdsBuffer->SetBinding(3);
+  this->CellIdsBuffer->SetLabel("ImageThreshold cell ids");
+
+  this->ComputePass->SetShaderSource(ImageThreshold);
+  this->ComputePass->AddBuffer(this->ParametersBuffer);
+  this->ComputePass->AddBuffer(this->ScalarsBuffer);
+  this->ComputePass->AddBuffer(this->CounterBuffer);
+  this->ComputePass->AddBuffer(this->CellIdsBuffer);
+}
+
+//------------------------------------------------------------------------------
+vtkWebGPUImageThresholdFilter::~vtkWebGPUImageThresholdFilter() = default;
+
+//------------------------------------------------------------------------------
+void vtkWebGPUImageThresholdFilter::SetDevice(const wgpu::Device& device)
+{
+  this->ComputePass->SetDevice(device);
+}
+
+//------------------------------------------------------------------------------
+int vtkWebGPUImageThresholdFilter::FillInputPortInformation(int, vtkInformation* info)
+{
+  info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkImageData");
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkWebGPUImageThresholdFilter::RequestData(vtkInformation*,
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkImageData* input = vtkImageData::GetData(inputVector[0]);
+  vtkUnstructuredGrid* output = vtkUnstructuredGrid::GetData(outputVector);
+
+  int dims[3];
+  input->GetDimensions(dims);
+  if (dims[0] < 2 || dims[1] < 2 || dims[2] < 2)
+  {
+    vtkErrorMacro(<< "Only 3D images are supported.");
+    return 0;
+  }
+  const vtkIdType numberOfCells = input->GetNumberOfCells();
+  if (numberOfCells > std::numeric_limits<vtkTypeUInt32>::max())
+  {
+    vtkErrorMacro(<< "The image has too many cells.");
+    return 0;
+  }
+  vtkDataArray* scalars = this->GetInputArrayToProcess(0, inputVector);
+  if (!scalars)
+  {
+    vtkErrorMacro(<< "No point scalars to threshold.");
+    return 0;
+  }
+  if (scalars != this->UploadedScalars || scalars->GetMTime() != this->UploadedScalarsMTime)
+  {
+    const vtkIdType numberOfPoints = scalars->GetNumberOfTuples();
+    std::vector<float> values(numberOfPoints);
+    vtkSMPTools::For(0, numberOfPoints, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        values[i] = static_cast<float>(scalars->GetComponent(i, 0));
+      }
+    });
+    this->ScalarsBuffer->SetData(values.data(), values.size() * sizeof(float));
+    this->UploadedScalars = scalars;
+    this->UploadedScalarsMTime = scalars->GetMTime();
+  }
+
+  ThresholdParameters parameters = {};
+  std::copy(dims, dims + 3, parameters.Dims);
+  parameters.Thresholds[0] = static_cast<float>(this->LowerThreshold);
+  parameters.Thresholds[1] = static_cast<float>(this->UpperThreshold);
+
+  // Lay the workgroups out on a 2D grid since each dimension is limited to 65535.
+  const vtkTypeUInt32 workgroups =
+    vtkWebGPUComputePass::GetNumberOfWorkgroups(numberOfCells, WorkgroupSize);
+  const vtkTypeUInt32 workgroupsX = std::min(workgroups, MaximumWorkgroups);
+  this->ComputePass->SetWorkgroups(
+    workgroupsX, (workgroups + workgroupsX - 1) / workgroupsX);
+
+  // First pass: count the selected cells.
+  const vtkTypeUInt32 zero = 0;
+  vtkTypeUInt32 numberOfSelectedCells = 0;
+  this->ParametersBuffer->SetData(&parameters, sizeof(parameters));
+  this->CounterBuffer->SetData(&zero, sizeof(zero));
+  if (this->CellIdsBuffer->GetByteSize() == 0)
+  {
+    this->CellIdsBuffer->SetByteSize(4);
+  }
+  if (!this->ComputePass->Dispatch() ||
+    !this->ComputePass->ReadBufferFromGPU(
+      2, &numberOfSelectedCells, sizeof(numberOfSelectedCells)))
+  {
+    vtkErrorMacro(<< "Failed to count the selected cells on the device.");
+    return 0;
+  }
+
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToFloat();
+  output->SetPoints(points);
+  vtkNew<vtkCellArray> cells;
+  if (numberOfSelectedCells == 0)
+  {
+    output->SetCells(VTK_VOXEL, cells);
+    return 1;
+  }
+
+  // Second pass: write their ids, in an arbitrary order.
+  std::vector<vtkTypeUInt32> cellIds(numberOfSelectedCells);
+  this->CellIdsBuffer->SetByteSize(cellIds.size() * sizeof(vtkTypeUInt32));
+  parameters.Dims[3] = 1;
+  parameters.Capacity[0] = numberOfSelectedCells;
+  this->ParametersBuffer->SetData(&parameters, sizeof(parameters));
+  this->CounterBuffer->SetData(&zero, sizeof(zero));
+  if (!this->ComputePass->Dispatch() ||
+    !this->ComputePass->ReadBufferFromGPU(
+      3, cellIds.data(), cellIds.size() * sizeof(vtkTypeUInt32)))
+  {
+    vtkErrorMacro(<< "Failed to select the cells on the device.");
+    return 0;
+  }
+  vtkSMPTools::Sort(cellIds.begin(), cellIds.end());
+
+  // Number the points used by the selected cells.
+  const vtkIdType cellDims[2] = { dims[0] - 1, dims[1] - 1 };
+  const vtkIdType numberOfInputPoints = input->GetNumberOfPoints();
+  std::vector<vtkIdType> pointMap(numberOfInputPoints, -1);
+  for (vtkTypeUInt32 cellId : cellIds)
+  {
+    const vtkIdType i = cellId % cellDims[0];
+    const vtkIdType j = (cellId / cellDims[0]) % cellDims[1];
+    const vtkIdType k = cellId / (cellDims[0] * cellDims[1]);
+    for (const auto& offset : VoxelOffsets)
+    {
+      pointMap[(i + offset[0]) + dims[0] * ((j + offset[1]) + dims[1] * (k + offset[2]))] = 0;
+    }
+  }
+  vtkNew<vtkIdList> pointIds;
+  for (vtkIdType id = 0; id < numberOfInputPoints; ++id)
+  {
+    if (pointMap[id] == 0)
+    {
+      pointMap[id] = pointIds->GetNumberOfIds();
+      pointIds->InsertNextId(id);
+    }
+  }
+
+  const vtkIdType numberOfPoints = pointIds->GetNumberOfIds();
+  points->SetNumberOfPoints(numberOfPoints);
+  vtkFloatArray* coordinates = vtkFloatArray::SafeDownCast(points->GetData());
+  int* extent = input->GetExtent();
+  double* origin = input->GetOrigin();
+  double* spacing = input->GetSpacing();
+  double* direction = input->GetDirectionMatrix()->GetData();
+  vtkSMPTools::For(0, numberOfPoints, [&](vtkIdType begin, vtkIdType end) {
+    double point[3];
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      const vtkIdType id = pointIds->GetId(i);
+      vtkImageData::TransformContinuousIndexToPhysicalPoint(extent[0] + id % dims[0],
+        extent[2] + (id / dims[0]) % dims[1], extent[4] + id / (dims[0] * dims[1]), origin,
+        spacing, direction, point);
+      const float xyz[3] = { static_cast<float>(point[0]), static_cast<float>(point[1]),
+        static_cast<float>(point[2]) };
+      coordinates->SetTypedTuple(i, xyz);
+    }
+  });
+
+  const vtkIdType numberOfOutputCells = static_cast<vtkIdType>(cellIds.size());
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfValues(8 * numberOfOutputCells);
+  vtkNew<vtkIdList> inputCellIds;
+  inputCellIds->SetNumberOfIds(numberOfOutputCells);
+  vtkSMPTools::For(0, numberOfOutputCells, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType c = begin; c < end; ++c)
+    {
+      const vtkIdType cellId = cellIds[c];
+      const vtkIdType i = cellId % cellDims[0];
+      const vtkIdType j = (cellId / cellDims[0]) % cellDims[1];
+      const vtkIdType k = cellId / (cellDims[0] * cellDims[1]);
+      for (int v = 0; v < 8; ++v)
+      {
+        const int* offset = VoxelOffsets[v];
+        connectivity->SetValue(8 * c + v,
+          pointMap[(i + offset[0]) + dims[0] * ((j + offset[1]) + dims[1] * (k + offset[2]))]);
+      }
+      inputCellIds->SetId(c, cellId);
+    }
+  });
+  cells->SetData(8, connectivity);
+  output->SetCells(VTK_VOXEL, cells);
+
+  vtkPointData* outPD = output->GetPointData();
+  outPD->CopyAllocate(input->GetPointData(), numberOfPoints);
+  outPD->CopyData(input->GetPointData(), pointIds);
+  vtkCellData* outCD = output->GetCellData();
+  outCD->CopyAllocate(input->GetCellData(), numberOfOutputCells);
+  outCD->CopyData(input->GetCellData(), inputCellIds);
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkWebGPUImageThresholdFilter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "LowerThreshold: " << this->LowerThreshold << "\n";
+  os << indent << "UpperThreshold: " << this->UpperThreshold << "\n";
+}
+
+VTK_ABI_NAMESPACE_END
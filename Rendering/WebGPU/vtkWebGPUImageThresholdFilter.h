@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkWebGPUImageThresholdFilter
+ * @brief   extract the cells of a vtkImageData within a scalar range with a WebGPU compute shader
+ *
+ * vtkWebGPUImageThresholdFilter selects on the device the cells of the input image whose point
+ * scalars are all between LowerThreshold and UpperThreshold, which is the default criterion of
+ * vtkThreshold. The scalars are selected with SetInputArrayToProcess(), only their first
+ * component is used and it is converted to float. The ids of the selected cells are read back
+ * and the output vtkUnstructuredGrid of voxels, with the used points and the point and cell
+ * data of the input, is assembled on the host. The scalars are only uploaded again when they
+ * change, so that moving the thresholds interactively is cheap.
+ *
+ * Only 3D images are supported.
+ *
+ * @sa vtkWebGPUComputePass vtkThreshold vtkWebGPUImageContourFilter
+ */
+#ifndef vtkWebGPUImageThresholdFilter_h
+#define vtkWebGPUImageThresholdFilter_h
+
+#include "vtkUnstructuredGridAlgorithm.h"
+
+#include "vtkNew.h"                   // for ivar
+#include "vtkRenderingWebGPUModule.h" // for export macro
+#include "vtk_wgpu.h"                 // for webgpu
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkDataArray;
+class vtkWebGPUComputeBuffer;
+class vtkWebGPUComputePass;
+
+class VTKRENDERINGWEBGPU_EXPORT vtkWebGPUImageThresholdFilter : public vtkUnstructuredGridAlgorithm
+{
+public:
+  static vtkWebGPUImageThresholdFilter* New();
+  vtkTypeMacro(vtkWebGPUImageThresholdFilter, vtkUnstructuredGridAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Range of the selected point scalars, bounds included. Default is [0, 1].
+   */
+  vtkSetMacro(LowerThreshold, double);
+  vtkGetMacro(LowerThreshold, double);
+  vtkSetMacro(UpperThreshold, double);
+  vtkGetMacro(UpperThreshold, double);
+  ///@}
+
+  /**
+   * Run the compute shader on this device, for instance the one of a vtkWebGPURenderWindow.
+   * A device is requested otherwise.
+   */
+  void SetDevice(const wgpu::Device& device);
+
+protected:
+  vtkWebGPUImageThresholdFilter();
+  ~vtkWebGPUImageThresholdFilter() override;
+
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+
+  double LowerThreshold = 0.0;
+  double UpperThreshold = 1.0;
+
+  vtkNew<vtkWebGPUComputePass> ComputePass;
+  vtkNew<vtkWebGPUComputeBuffer> ParametersBuffer;
+  vtkNew<vtkWebGPUComputeBuffer> ScalarsBuffer;
+  vtkNew<vtkWebGPUComputeBuffer> CounterBuffer;
+  vtkNew<vtkWebGPUComputeBuffer> CellIdsBuffer;
+
+  // Scalars currently in ScalarsBuffer.
+  vtkDataArray* UploadedScalars = nullptr;
+  vtkMTimeType UploadedScalarsMTime = 0;
+
+private:
+  vtkWebGPUImageThresholdFilter(const vtkWebGPUImageThresholdFilter&) = delete;
+  void operator=(const vtkWebGPUImageThresholdFilter&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
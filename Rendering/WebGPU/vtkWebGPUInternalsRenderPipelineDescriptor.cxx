@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkWebGPUInternalsRenderPipelineDescriptor.h"
 
+#include <sstream>
+
 VTK_ABI_NAMESPACE_BEGIN
 //------------------------------------------------------------------------------
 vtkWebGPUInternalsRenderPipelineDescriptor::vtkWebGPUInternalsRenderPipelineDescriptor()
@@ -114,4 +116,68 @@ void vtkWebGPUInternalsRenderPipelineDescriptor::DisableDepthStencil()
 {
   this->depthStencil = nullptr;
 }
+
+//------------------------------------------------------------------------------
+std::string vtkWebGPUInternalsRenderPipelineDescriptor::GetCacheKey() const
+{
+  std::ostringstream key;
+  key << "layout=" << this->layout.Get() << ";";
+
+  key << "vertex=" << this->vertex.module.Get() << "," << this->vertex.entryPoint;
+  for (std::size_t i = 0; i < this->vertex.bufferCount; ++i)
+  {
+    const wgpu::VertexBufferLayout& buffer = this->vertex.buffers[i];
+    key << "," << buffer.arrayStride << "," << static_cast<uint32_t>(buffer.stepMode);
+    for (std::size_t j = 0; j < buffer.attributeCount; ++j)
+    {
+      const wgpu::VertexAttribute& attribute = buffer.attributes[j];
+      key << "," << attribute.shaderLocation << "," << attribute.offset << ","
+          << static_cast<uint32_t>(attribute.format);
+    }
+  }
+  key << ";";
+
+  key << "primitive=" << static_cast<uint32_t>(this->primitive.topology) << ","
+      << static_cast<uint32_t>(this->primitive.stripIndexFormat) << ","
+      << static_cast<uint32_t>(this->primitive.frontFace) << ","
+      << static_cast<uint32_t>(this->primitive.cullMode) << ";";
+
+  if (this->depthStencil != nullptr)
+  {
+    const wgpu::DepthStencilState& ds = *this->depthStencil;
+    key << "depthStencil=" << static_cast<uint32_t>(ds.format) << ","
+        << static_cast<uint32_t>(ds.depthWriteEnabled) << ","
+        << static_cast<uint32_t>(ds.depthCompare) << ","
+        << static_cast<uint32_t>(ds.stencilFront.compare) << ","
+        << static_cast<uint32_t>(ds.stencilBack.compare) << "," << ds.stencilReadMask << ","
+        << ds.stencilWriteMask << "," << ds.depthBias << "," << ds.depthBiasSlopeScale << ","
+        << ds.depthBiasClamp << ";";
+  }
+
+  key << "multisample=" << this->multisample.count << "," << this->multisample.mask << ","
+      << this->multisample.alphaToCoverageEnabled << ";";
+
+  if (this->fragment != nullptr)
+  {
+    key << "fragment=" << this->fragment->module.Get() << "," << this->fragment->entryPoint;
+    for (std::size_t i = 0; i < this->fragment->targetCount; ++i)
+    {
+      const wgpu::ColorTargetState& target = this->fragment->targets[i];
+      key << "," << static_cast<uint32_t>(target.format) << ","
+          << static_cast<uint32_t>(target.writeMask);
+      if (target.blend != nullptr)
+      {
+        const wgpu::BlendState& blend = *target.blend;
+        key << ",blend," << static_cast<uint32_t>(blend.color.srcFactor) << ","
+            << static_cast<uint32_t>(blend.color.dstFactor) << ","
+            << static_cast<uint32_t>(blend.color.operation) << ","
+            << static_cast<uint32_t>(blend.alpha.srcFactor) << ","
+            << static_cast<uint32_t>(blend.alpha.dstFactor) << ","
+            << static_cast<uint32_t>(blend.alpha.operation);
+      }
+    }
+    key << ";";
+  }
+  return key.str();
+}
 VTK_ABI_NAMESPACE_END
@@ -7,6 +7,7 @@
 #include "vtk_wgpu.h"
 
 #include <array>
+#include <string>
 
 VTK_ABI_NAMESPACE_BEGIN
 class VTKRENDERINGWEBGPU_NO_EXPORT vtkWebGPUInternalsRenderPipelineDescriptor
@@ -31,6 +32,14 @@ public:
     wgpu::TextureFormat format = wgpu::TextureFormat::Depth24PlusStencil8);
   void DisableDepthStencil();
 
+  /**
+   * Build a key that identifies the render pipeline created from this descriptor. Two
+   * descriptors with the same key create equivalent pipelines, so the key can be used to share
+   * pipelines between mappers. The layout and the shader modules are identified by their
+   * handles, they must themselves be shared for the pipelines to be.
+   */
+  std::string GetCacheKey() const;
+
   std::array<wgpu::VertexBufferLayout, kMaxVertexBuffers> cBuffers;
   std::array<wgpu::VertexAttribute, kMaxVertexAttributes> cAttributes;
   std::array<wgpu::ColorTargetState, kMaxColorAttachments> cTargets;
@@ -32,10 +32,28 @@
 
 #include <algorithm>
 #include <numeric>
+#include <string>
 #include <type_traits>
 
 VTK_ABI_NAMESPACE_BEGIN
 
+namespace
+{
+// Reuse the renderer's pipeline if another mapper already created an equivalent one.
+wgpu::RenderPipeline GetRenderPipeline(const wgpu::Device& device,
+  vtkWebGPURenderer* wgpuRenderer, const vtkWebGPUInternalsRenderPipelineDescriptor& descriptor)
+{
+  const std::string key = descriptor.GetCacheKey();
+  wgpu::RenderPipeline pipeline = wgpuRenderer->HasRenderPipelineCache(key);
+  if (pipeline == nullptr)
+  {
+    pipeline = device.CreateRenderPipeline(&descriptor);
+    wgpuRenderer->InsertRenderPipeline(key, pipeline);
+  }
+  return pipeline;
+}
+}
+
 //------------------------------------------------------------------------------
 vtkStandardNewMacro(vtkWebGPUPolyDataMapper);
 
@@ -256,42 +274,59 @@ void vtkWebGPUPolyDataMapper::EncodeRenderCommands(
 void vtkWebGPUPolyDataMapper::SetupPipelineLayout(
   const wgpu::Device& device, vtkRenderer* renderer, vtkActor*)
 {
+  // The layouts are the same for all the mappers of a renderer, share them so that the
+  // render pipelines can be shared too.
+  auto wgpuRenderer = reinterpret_cast<vtkWebGPURenderer*>(renderer);
+  assert(wgpuRenderer != nullptr);
   this->MeshAttributeBindGroupLayout =
-    vtkWebGPUInternalsBindGroupLayout::MakeBindGroupLayout(device,
+    wgpuRenderer->HasBindGroupLayoutCache("MeshAttributeBindGroupLayout");
+  if (this->MeshAttributeBindGroupLayout == nullptr)
+  {
+    this->MeshAttributeBindGroupLayout =
+      vtkWebGPUInternalsBindGroupLayout::MakeBindGroupLayout(device,
+        {
+          // clang-format off
+          // MeshAttributeArrayDescriptor
+          { 0, wgpu::ShaderStage::Vertex, wgpu::BufferBindingType::Uniform },
+          // point_data
+          { 1, wgpu::ShaderStage::Vertex, wgpu::BufferBindingType::ReadOnlyStorage },
+          // cell_data
+          { 2, wgpu::ShaderStage::Vertex, wgpu::BufferBindingType::ReadOnlyStorage }
+          // clang-format on
+        });
+    this->MeshAttributeBindGroupLayout.SetLabel("MeshAttributeBindGroupLayout");
+    wgpuRenderer->InsertBindGroupLayout(
+      "MeshAttributeBindGroupLayout", this->MeshAttributeBindGroupLayout);
+  }
+
+  this->PrimitiveBindGroupLayout =
+    wgpuRenderer->HasBindGroupLayoutCache("PrimitiveBindGroupLayout");
+  if (this->PrimitiveBindGroupLayout == nullptr)
+  {
+    this->PrimitiveBindGroupLayout = vtkWebGPUInternalsBindGroupLayout::MakeBindGroupLayout(device,
       {
         // clang-format off
-        // MeshAttributeArrayDescriptor
-        { 0, wgpu::ShaderStage::Vertex, wgpu::BufferBindingType::Uniform },
-        // point_data
-        { 1, wgpu::ShaderStage::Vertex, wgpu::BufferBindingType::ReadOnlyStorage },
-        // cell_data
-        { 2, wgpu::ShaderStage::Vertex, wgpu::BufferBindingType::ReadOnlyStorage }
-        // clang-format on
-      });
-  this->MeshAttributeBindGroupLayout.SetLabel("MeshAttributeBindGroupLayout");
-  this->PrimitiveBindGroupLayout = vtkWebGPUInternalsBindGroupLayout::MakeBindGroupLayout(device,
-    {
-      // clang-format off
         // Primitive size
         { 0, wgpu::ShaderStage::Vertex, wgpu::BufferBindingType::Uniform },
         // topology
         { 1, wgpu::ShaderStage::Vertex, wgpu::BufferBindingType::ReadOnlyStorage },
-      // clang-format on
-    });
-
-  this->PrimitiveBindGroupLayout.SetLabel("PrimitiveBindGroupLayout");
+        // clang-format on
+      });
+    this->PrimitiveBindGroupLayout.SetLabel("PrimitiveBindGroupLayout");
+    wgpuRenderer->InsertBindGroupLayout("PrimitiveBindGroupLayout", this->PrimitiveBindGroupLayout);
+  }
 
   // create pipeline layout.
-  ///@{ TODO: Can the mappers simply keep track of bindgroup layouts and let renderer control
-  /// per-mapper pipeline creation?
-  auto wgpuRenderer = reinterpret_cast<vtkWebGPURenderer*>(renderer);
-  assert(wgpuRenderer != nullptr);
-  std::vector<wgpu::BindGroupLayout> bgls;
-  wgpuRenderer->PopulateBindgroupLayouts(bgls);
-  bgls.emplace_back(this->MeshAttributeBindGroupLayout);
-  bgls.emplace_back(this->PrimitiveBindGroupLayout);
-  this->PipelineLayout = vtkWebGPUInternalsPipelineLayout::MakePipelineLayout(device, bgls);
-  ///@}
+  this->PipelineLayout = wgpuRenderer->HasPipelineLayoutCache("vtkWebGPUPolyDataMapper");
+  if (this->PipelineLayout == nullptr)
+  {
+    std::vector<wgpu::BindGroupLayout> bgls;
+    wgpuRenderer->PopulateBindgroupLayouts(bgls);
+    bgls.emplace_back(this->MeshAttributeBindGroupLayout);
+    bgls.emplace_back(this->PrimitiveBindGroupLayout);
+    this->PipelineLayout = vtkWebGPUInternalsPipelineLayout::MakePipelineLayout(device, bgls);
+    wgpuRenderer->InsertPipelineLayout("vtkWebGPUPolyDataMapper", this->PipelineLayout);
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -962,7 +997,8 @@ void vtkWebGPUPolyDataMapper::SetupGraphicsPipeline(
   {
     std::string info = "primitive=VTK_POINT;representation=" + reprAsStr;
     descriptor.primitive.topology = wgpu::PrimitiveTopology::TriangleList;
-    this->PointPrimitiveBGInfo.Pipeline = device.CreateRenderPipeline(&descriptor);
+    this->PointPrimitiveBGInfo.Pipeline =
+      ::GetRenderPipeline(device, wgpuRenderer, descriptor);
   }
   if (this->LinePrimitiveBGInfo.VertexCount > 0)
   {
@@ -970,13 +1006,15 @@ void vtkWebGPUPolyDataMapper::SetupGraphicsPipeline(
     descriptor.primitive.topology = representation == VTK_POINTS
       ? wgpu::PrimitiveTopology::TriangleList
       : wgpu::PrimitiveTopology::LineList;
-    this->LinePrimitiveBGInfo.Pipeline = device.CreateRenderPipeline(&descriptor);
+    this->LinePrimitiveBGInfo.Pipeline =
+      ::GetRenderPipeline(device, wgpuRenderer, descriptor);
   }
   if (this->TrianglePrimitiveBGInfo.VertexCount > 0)
   {
     std::string info = "primitive=VTK_TRIANGLE;representation=" + reprAsStr;
     descriptor.primitive.topology = wgpu::PrimitiveTopology::TriangleList;
-    this->TrianglePrimitiveBGInfo.Pipeline = device.CreateRenderPipeline(&descriptor);
+    this->TrianglePrimitiveBGInfo.Pipeline =
+      ::GetRenderPipeline(device, wgpuRenderer, descriptor);
   }
 }
 
@@ -74,7 +74,7 @@ public:
   /**
    * Handle opengl specific code and calls superclass
    */
-  void Render() override;
+  VTK_UNBLOCKTHREADS void Render() override;
 
   /**
    * Intermediate method performs operations required between the rendering
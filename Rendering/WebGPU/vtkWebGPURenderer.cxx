@@ -468,6 +468,9 @@ void vtkWebGPURenderer::ReleaseGraphicsResources(vtkWindow* vtkNotUsed(w))
 {
   this->PropWGPUItems.clear();
   this->Bundles.clear();
+  this->RenderPipelineCache.clear();
+  this->PipelineLayoutCache.clear();
+  this->BindGroupLayoutCache.clear();
 }
 
 //------------------------------------------------------------------------------
@@ -575,4 +578,45 @@ void vtkWebGPURenderer::InsertShader(const std::string& source, wgpu::ShaderModu
   this->ShaderCache.emplace(source, shader);
 }
 
+//------------------------------------------------------------------------------
+wgpu::BindGroupLayout vtkWebGPURenderer::HasBindGroupLayoutCache(const std::string& label)
+{
+  auto it = this->BindGroupLayoutCache.find(label);
+  return it != this->BindGroupLayoutCache.end() ? it->second : nullptr;
+}
+
+//------------------------------------------------------------------------------
+void vtkWebGPURenderer::InsertBindGroupLayout(
+  const std::string& label, wgpu::BindGroupLayout layout)
+{
+  this->BindGroupLayoutCache.emplace(label, layout);
+}
+
+//------------------------------------------------------------------------------
+wgpu::PipelineLayout vtkWebGPURenderer::HasPipelineLayoutCache(const std::string& label)
+{
+  auto it = this->PipelineLayoutCache.find(label);
+  return it != this->PipelineLayoutCache.end() ? it->second : nullptr;
+}
+
+//------------------------------------------------------------------------------
+void vtkWebGPURenderer::InsertPipelineLayout(const std::string& label, wgpu::PipelineLayout layout)
+{
+  this->PipelineLayoutCache.emplace(label, layout);
+}
+
+//------------------------------------------------------------------------------
+wgpu::RenderPipeline vtkWebGPURenderer::HasRenderPipelineCache(const std::string& key)
+{
+  auto it = this->RenderPipelineCache.find(key);
+  return it != this->RenderPipelineCache.end() ? it->second : nullptr;
+}
+
+//------------------------------------------------------------------------------
+void vtkWebGPURenderer::InsertRenderPipeline(
+  const std::string& key, wgpu::RenderPipeline pipeline)
+{
+  this->RenderPipelineCache.emplace(key, pipeline);
+}
+
 VTK_ABI_NAMESPACE_END
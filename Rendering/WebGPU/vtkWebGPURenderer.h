@@ -81,6 +81,21 @@ public:
   wgpu::ShaderModule HasShaderCache(const std::string& source);
   void InsertShader(const std::string& source, wgpu::ShaderModule shader);
 
+  ///@{
+  /**
+   * Bind group layouts, pipeline layouts and render pipelines shared by the mappers of this
+   * renderer. Mappers that bind the same kind of resources look up their layouts by label, and
+   * their render pipelines by vtkWebGPUInternalsRenderPipelineDescriptor::GetCacheKey(), so
+   * that many actors end up drawn with a handful of pipelines instead of one per mapper.
+   */
+  wgpu::BindGroupLayout HasBindGroupLayoutCache(const std::string& label);
+  void InsertBindGroupLayout(const std::string& label, wgpu::BindGroupLayout layout);
+  wgpu::PipelineLayout HasPipelineLayoutCache(const std::string& label);
+  void InsertPipelineLayout(const std::string& label, wgpu::PipelineLayout layout);
+  wgpu::RenderPipeline HasRenderPipelineCache(const std::string& key);
+  void InsertRenderPipeline(const std::string& key, wgpu::RenderPipeline pipeline);
+  ///@}
+
   ///@{
   /**
    * Set the user light transform applied after the camera transform.
@@ -164,6 +179,9 @@ protected:
   std::unordered_map<vtkProp*, vtkWGPUPropItem> PropWGPUItems;
 
   std::unordered_map<std::string, wgpu::ShaderModule> ShaderCache;
+  std::unordered_map<std::string, wgpu::BindGroupLayout> BindGroupLayoutCache;
+  std::unordered_map<std::string, wgpu::PipelineLayout> PipelineLayoutCache;
+  std::unordered_map<std::string, wgpu::RenderPipeline> RenderPipelineCache;
   std::size_t NumberOfPropsUpdated = 0;
   int LightingComplexity = 0;
   std::size_t NumberOfLightsUsed = 0;
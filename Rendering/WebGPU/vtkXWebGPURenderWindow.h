@@ -257,7 +257,7 @@ public:
    * This computes the size of the render window
    * before calling the supper classes render
    */
-  void Render() override;
+  VTK_UNBLOCKTHREADS void Render() override;
 
 protected:
   vtkXWebGPURenderWindow();
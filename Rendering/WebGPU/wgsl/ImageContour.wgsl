@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Marching cubes on the point scalars of an image, or on an affine function of the point
+// indices when cutting by a plane. Each invocation processes one cell and appends its
+// triangles, in index coordinates, to the output buffer. The first dispatch only counts the
+// triangles so that the output buffer can be allocated.
+
+//-------------------------------------------------------------------
+struct Parameters {
+  // x, y, z: number of points along each axis, w: 1 to write the triangles, 0 to count them
+  dims: vec4<u32>,
+  // x: contour value, y: 1 to contour the plane function instead of the scalars
+  value: vec4<f32>,
+  // plane function in index coordinates: dot(plane.xyz, ijk) + plane.w
+  plane: vec4<f32>,
+  // x: number of triangles that fit in the output buffer
+  capacity: vec4<u32>
+}
+
+@group(0) @binding(0) var<uniform> params: Parameters;
+@group(0) @binding(1) var<storage, read> scalars: array<f32>;
+// vtkMarchingCubesTriangleCases, 16 edge ids per case, -1 terminated
+@group(0) @binding(2) var<storage, read> cases: array<i32>;
+@group(0) @binding(3) var<storage, read_write> counter: atomic<u32>;
+@group(0) @binding(4) var<storage, read_write> triangles: array<f32>;
+
+// same vertex and edge numbering as vtkMarchingCubes
+const VERTEX_OFFSETS = array<vec3<u32>, 8>(
+  vec3<u32>(0u, 0u, 0u), vec3<u32>(1u, 0u, 0u), vec3<u32>(1u, 1u, 0u), vec3<u32>(0u, 1u, 0u),
+  vec3<u32>(0u, 0u, 1u), vec3<u32>(1u, 0u, 1u), vec3<u32>(1u, 1u, 1u), vec3<u32>(0u, 1u, 1u));
+const EDGE_VERTICES = array<vec2<u32>, 12>(
+  vec2<u32>(0u, 1u), vec2<u32>(1u, 2u), vec2<u32>(3u, 2u), vec2<u32>(0u, 3u),
+  vec2<u32>(4u, 5u), vec2<u32>(5u, 6u), vec2<u32>(7u, 6u), vec2<u32>(4u, 7u),
+  vec2<u32>(0u, 4u), vec2<u32>(1u, 5u), vec2<u32>(3u, 7u), vec2<u32>(2u, 6u));
+
+//-------------------------------------------------------------------
+fn scalarAt(p: vec3<u32>) -> f32 {
+  if (params.value.y > 0.5) {
+    return dot(params.plane.xyz, vec3<f32>(p)) + params.plane.w;
+  }
+  return scalars[p.x + params.dims.x * (p.y + params.dims.y * p.z)];
+}
+
+//-------------------------------------------------------------------
+@compute @workgroup_size(64)
+fn computeMain(@builtin(global_invocation_id) id: vec3<u32>,
+  @builtin(num_workgroups) workgroups: vec3<u32>) {
+  let cells = params.dims.xyz - vec3<u32>(1u);
+  let cell = id.x + id.y * workgroups.x * 64u;
+  if (cell >= cells.x * cells.y * cells.z) {
+    return;
+  }
+  let ijk = vec3<u32>(cell % cells.x, (cell / cells.x) % cells.y, cell / (cells.x * cells.y));
+
+  var offsets = VERTEX_OFFSETS;
+  var edges = EDGE_VERTICES;
+  var s: array<f32, 8>;
+  var caseIndex = 0u;
+  for (var v = 0u; v < 8u; v++) {
+    s[v] = scalarAt(ijk + offsets[v]);
+    if (s[v] >= params.value.x) {
+      caseIndex |= 1u << v;
+    }
+  }
+  if (caseIndex == 0u || caseIndex == 255u) {
+    return;
+  }
+
+  var numTriangles = 0u;
+  for (var e = 0u; e < 16u; e += 3u) {
+    if (cases[16u * caseIndex + e] < 0) {
+      break;
+    }
+    numTriangles += 1u;
+  }
+  let firstTriangle = atomicAdd(&counter, numTriangles);
+  if (params.dims.w == 0u || firstTriangle + numTriangles > params.capacity.x) {
+    return;
+  }
+
+  for (var tri = 0u; tri < numTriangles; tri++) {
+    for (var k = 0u; k < 3u; k++) {
+      let edge = edges[u32(cases[16u * caseIndex + 3u * tri + k])];
+      let t = (params.value.x - s[edge.x]) / (s[edge.y] - s[edge.x]);
+      let x0 = vec3<f32>(ijk + offsets[edge.x]);
+      let x1 = vec3<f32>(ijk + offsets[edge.y]);
+      let x = x0 + t * (x1 - x0);
+      let dst = 9u * (firstTriangle + tri) + 3u * k;
+      triangles[dst] = x.x;
+      triangles[dst + 1u] = x.y;
+      triangles[dst + 2u] = x.z;
+    }
+  }
+}
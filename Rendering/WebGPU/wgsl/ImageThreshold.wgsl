@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Select the cells of an image whose point scalars are all within a range. Each invocation
+// processes one cell and appends its id to the output buffer. The first dispatch only counts
+// the cells so that the output buffer can be allocated.
+
+//-------------------------------------------------------------------
+struct Parameters {
+  // x, y, z: number of points along each axis, w: 1 to write the cell ids, 0 to count them
+  dims: vec4<u32>,
+  // x: lower threshold, y: upper threshold
+  thresholds: vec4<f32>,
+  // x: number of cell ids that fit in the output buffer
+  capacity: vec4<u32>
+}
+
+@group(0) @binding(0) var<uniform> params: Parameters;
+@group(0) @binding(1) var<storage, read> scalars: array<f32>;
+@group(0) @binding(2) var<storage, read_write> counter: atomic<u32>;
+@group(0) @binding(3) var<storage, read_write> cell_ids: array<u32>;
+
+const VERTEX_OFFSETS = array<vec3<u32>, 8>(
+  vec3<u32>(0u, 0u, 0u), vec3<u32>(1u, 0u, 0u), vec3<u32>(0u, 1u, 0u), vec3<u32>(1u, 1u, 0u),
+  vec3<u32>(0u, 0u, 1u), vec3<u32>(1u, 0u, 1u), vec3<u32>(0u, 1u, 1u), vec3<u32>(1u, 1u, 1u));
+
+//-------------------------------------------------------------------
+@compute @workgroup_size(64)
+fn computeMain(@builtin(global_invocation_id) id: vec3<u32>,
+  @builtin(num_workgroups) workgroups: vec3<u32>) {
+  let cells = params.dims.xyz - vec3<u32>(1u);
+  let cell = id.x + id.y * workgroups.x * 64u;
+  if (cell >= cells.x * cells.y * cells.z) {
+    return;
+  }
+  let ijk = vec3<u32>(cell % cells.x, (cell / cells.x) % cells.y, cell / (cells.x * cells.y));
+
+  var offsets = VERTEX_OFFSETS;
+  for (var v = 0u; v < 8u; v++) {
+    let p = ijk + offsets[v];
+    let s = scalars[p.x + params.dims.x * (p.y + params.dims.y * p.z)];
+    if (s < params.thresholds.x || s > params.thresholds.y) {
+      return;
+    }
+  }
+
+  let slot = atomicAdd(&counter, 1u);
+  if (params.dims.w != 0u && slot < params.capacity.x) {
+    cell_ids[slot] = cell;
+  }
+}
@@ -0,0 +1,559 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*
+Microbenchmarks for the core data structures of VTK: data array access paths,
+cell array traversal, point and cell locators and vtkSMPTools overhead. They do
+not need any rendering and are meant to be run before and after a VTK upgrade
+to catch performance regressions.
+
+Each benchmark is run repeatedly until the requested time is spent, and the best
+time per iteration is reported. Results are printed on the standard output and
+can also be written as JSON (in a layout close to the one produced by google
+benchmark) with the -json option.
+
+To add a benchmark, add a call to AddBenchmark() in main(): the setup function
+is called once, then the run function is timed and must return the number of
+items it processed.
+*/
+
+#include "vtkArrayDispatch.h"
+#include "vtkCellArray.h"
+#include "vtkCellArrayIterator.h"
+#include "vtkCellLocator.h"
+#include "vtkDataArrayRange.h"
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkGenericCell.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMP.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkStaticCellLocator.h"
+#include "vtkStaticPointLocator.h"
+#include "vtkUnstructuredGrid.h"
+#include "vtkVersion.h"
+
+#include <vtksys/CommandLineArguments.hxx>
+#include <vtksys/FStream.hxx>
+#include <vtksys/RegularExpression.hxx>
+#include <vtksys/SystemInformation.hxx>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+//------------------------------------------------------------------------------
+struct Benchmark
+{
+  std::string Name;
+  std::function<void()> Setup;
+  std::function<vtkIdType()> Run;
+};
+
+struct BenchmarkResult
+{
+  std::string Name;
+  long Iterations = 0;
+  double BestTime = 0.0; // seconds per iteration
+  double MeanTime = 0.0; // seconds per iteration
+  vtkIdType Items = 0;   // items processed per iteration
+};
+
+//------------------------------------------------------------------------------
+BenchmarkResult RunBenchmark(const Benchmark& benchmark, double minTime)
+{
+  using Clock = std::chrono::steady_clock;
+
+  benchmark.Setup();
+
+  BenchmarkResult result;
+  result.Name = benchmark.Name;
+  result.BestTime = std::numeric_limits<double>::max();
+  double totalTime = 0.0;
+  // Warm up caches and lazily built structures
+  benchmark.Run();
+  do
+  {
+    const auto start = Clock::now();
+    result.Items = benchmark.Run();
+    const double time = std::chrono::duration<double>(Clock::now() - start).count();
+    result.BestTime = std::min(result.BestTime, time);
+    totalTime += time;
+    result.Iterations++;
+  } while (totalTime < minTime || result.Iterations < 3);
+  result.MeanTime = totalTime / result.Iterations;
+  return result;
+}
+
+//------------------------------------------------------------------------------
+std::string EscapeJSON(const std::string& str)
+{
+  std::string escaped;
+  for (char c : str)
+  {
+    if (c == '"' || c == '\\')
+    {
+      escaped += '\\';
+    }
+    escaped += c;
+  }
+  return escaped;
+}
+
+//------------------------------------------------------------------------------
+void WriteJSON(std::ostream& os, const std::vector<BenchmarkResult>& results)
+{
+  vtksys::SystemInformation systemInfo;
+  systemInfo.RunCPUCheck();
+  systemInfo.RunOSCheck();
+
+  os << std::setprecision(9);
+  os << "{\n  \"context\": {\n";
+  os << "    \"vtk_version\": \"" << vtkVersion::GetVTKVersionFull() << "\",\n";
+  os << "    \"host_name\": \"" << EscapeJSON(systemInfo.GetHostname()) << "\",\n";
+  os << "    \"os_name\": \"" << EscapeJSON(systemInfo.GetOSName()) << "\",\n";
+  os << "    \"num_cpus\": " << systemInfo.GetNumberOfLogicalCPU() << ",\n";
+  os << "    \"smp_backend\": \"" << vtkSMPTools::GetBackend() << "\",\n";
+  os << "    \"smp_threads\": " << vtkSMPTools::GetEstimatedNumberOfThreads() << "\n";
+  os << "  },\n  \"benchmarks\": [";
+  for (std::size_t i = 0; i < results.size(); ++i)
+  {
+    const BenchmarkResult& result = results[i];
+    os << (i ? ",\n" : "\n") << "    {\n";
+    os << "      \"name\": \"" << EscapeJSON(result.Name) << "\",\n";
+    os << "      \"iterations\": " << result.Iterations << ",\n";
+    os << "      \"real_time\": " << result.BestTime * 1e9 << ",\n";
+    os << "      \"mean_time\": " << result.MeanTime * 1e9 << ",\n";
+    os << "      \"time_unit\": \"ns\",\n";
+    os << "      \"items_per_second\": "
+       << (result.BestTime > 0.0 ? result.Items / result.BestTime : 0.0) << "\n";
+    os << "    }";
+  }
+  os << "\n  ]\n}\n";
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkPoints> MakeRandomPoints(vtkIdType numberOfPoints, int seed)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(seed);
+  auto points = vtkSmartPointer<vtkPoints>::New();
+  points->SetDataTypeToDouble();
+  points->SetNumberOfPoints(numberOfPoints);
+  for (vtkIdType i = 0; i < numberOfPoints; ++i)
+  {
+    double x[3];
+    for (int c = 0; c < 3; ++c)
+    {
+      x[c] = random->GetNextValue();
+    }
+    points->SetPoint(i, x);
+  }
+  return points;
+}
+
+//------------------------------------------------------------------------------
+// Unstructured grid of dim^3 hexahedra filling the unit cube
+vtkSmartPointer<vtkUnstructuredGrid> MakeHexahedra(int dim)
+{
+  const int npts = dim + 1;
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToDouble();
+  points->SetNumberOfPoints(static_cast<vtkIdType>(npts) * npts * npts);
+  vtkIdType ptId = 0;
+  for (int k = 0; k < npts; ++k)
+  {
+    for (int j = 0; j < npts; ++j)
+    {
+      for (int i = 0; i < npts; ++i)
+      {
+        points->SetPoint(ptId++, static_cast<double>(i) / dim, static_cast<double>(j) / dim,
+          static_cast<double>(k) / dim);
+      }
+    }
+  }
+
+  auto grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  grid->SetPoints(points);
+  grid->AllocateExact(static_cast<vtkIdType>(dim) * dim * dim, 8);
+  auto id = [npts](int i, int j, int k) -> vtkIdType
+  { return i + static_cast<vtkIdType>(npts) * (j + static_cast<vtkIdType>(npts) * k); };
+  for (int k = 0; k < dim; ++k)
+  {
+    for (int j = 0; j < dim; ++j)
+    {
+      for (int i = 0; i < dim; ++i)
+      {
+        const vtkIdType hex[8] = { id(i, j, k), id(i + 1, j, k), id(i + 1, j + 1, k),
+          id(i, j + 1, k), id(i, j, k + 1), id(i + 1, j, k + 1), id(i + 1, j + 1, k + 1),
+          id(i, j + 1, k + 1) };
+        grid->InsertNextCell(VTK_HEXAHEDRON, 8, hex);
+      }
+    }
+  }
+  return grid;
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkCellArray> MakeTriangles(vtkIdType numberOfCells, bool use64Bit)
+{
+  auto cells = vtkSmartPointer<vtkCellArray>::New();
+  if (use64Bit)
+  {
+    cells->Use64BitStorage();
+  }
+  else
+  {
+    cells->Use32BitStorage();
+  }
+  cells->AllocateExact(numberOfCells, 3 * numberOfCells);
+  for (vtkIdType cellId = 0; cellId < numberOfCells; ++cellId)
+  {
+    const vtkIdType tri[3] = { cellId, cellId + 1, cellId + 2 };
+    cells->InsertNextCell(3, tri);
+  }
+  return cells;
+}
+
+//------------------------------------------------------------------------------
+struct SumWorker
+{
+  double Sum = 0.0;
+
+  template <typename ArrayT>
+  void operator()(ArrayT* array)
+  {
+    double sum = 0.0;
+    for (const auto tuple : vtk::DataArrayTupleRange<3>(array))
+    {
+      sum += tuple[0] + tuple[1] + tuple[2];
+    }
+    this->Sum = sum;
+  }
+};
+
+// Avoid the optimizer to discard the benchmarked computations
+volatile double Sink = 0.0;
+}
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  std::string regex = ".*";
+  std::string jsonFileName;
+  double minTime = 0.5;
+  double scale = 1.0;
+  bool displayHelp = false;
+
+  vtksys::CommandLineArguments arguments;
+  arguments.Initialize(argc, argv);
+  using argT = vtksys::CommandLineArguments;
+  arguments.AddArgument(
+    "-regex", argT::SPACE_ARGUMENT, &regex, "Only run the benchmarks matching this regex.");
+  arguments.AddArgument("-json", argT::SPACE_ARGUMENT, &jsonFileName,
+    "Write the results in JSON format to the given file.");
+  arguments.AddArgument("-tl", argT::SPACE_ARGUMENT, &minTime,
+    "Minimum time in seconds spent running each benchmark (default 0.5).");
+  arguments.AddArgument("-scale", argT::SPACE_ARGUMENT, &scale,
+    "Scale factor applied to the size of the benchmarked data (default 1).");
+  arguments.AddBooleanArgument("-help", &displayHelp, "Provide a listing of command line options.");
+  arguments.AddBooleanArgument("--help", &displayHelp, "Provide a listing of command line options.");
+  if (!arguments.Parse() || displayHelp)
+  {
+    std::cerr << "Usage: " << argv[0] << " [options]\n\nOptions:\n" << arguments.GetHelp();
+    return displayHelp ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+
+  const vtkIdType numberOfTuples = static_cast<vtkIdType>(1000000 * scale);
+  const vtkIdType numberOfCells = static_cast<vtkIdType>(1000000 * scale);
+  const vtkIdType numberOfPoints = static_cast<vtkIdType>(500000 * scale);
+  const vtkIdType numberOfQueries = static_cast<vtkIdType>(100000 * scale);
+  const int hexDim = std::max(2, static_cast<int>(50 * std::cbrt(scale)));
+
+  std::vector<Benchmark> benchmarks;
+  auto AddBenchmark = [&benchmarks](const std::string& name, std::function<void()> setup,
+                        std::function<vtkIdType()> run)
+  { benchmarks.push_back(Benchmark{ name, setup, run }); };
+
+  // Data array access paths
+  vtkNew<vtkDoubleArray> doubleArray;
+  vtkNew<vtkFloatArray> floatArray;
+  auto setupArrays = [&]()
+  {
+    doubleArray->SetNumberOfComponents(3);
+    doubleArray->SetNumberOfTuples(numberOfTuples);
+    floatArray->SetNumberOfComponents(3);
+    floatArray->SetNumberOfTuples(numberOfTuples);
+    for (vtkIdType i = 0; i < numberOfTuples * 3; ++i)
+    {
+      doubleArray->SetValue(i, static_cast<double>(i % 100));
+      floatArray->SetValue(i, static_cast<float>(i % 100));
+    }
+  };
+  for (vtkDataArray* array : { static_cast<vtkDataArray*>(doubleArray.Get()),
+         static_cast<vtkDataArray*>(floatArray.Get()) })
+  {
+    const std::string type = array->GetDataTypeAsString();
+    AddBenchmark("DataArray/GetTuple/" + type, setupArrays,
+      [array, numberOfTuples]()
+      {
+        double sum = 0.0;
+        double tuple[3];
+        for (vtkIdType i = 0; i < numberOfTuples; ++i)
+        {
+          array->GetTuple(i, tuple);
+          sum += tuple[0] + tuple[1] + tuple[2];
+        }
+        Sink = sum;
+        return numberOfTuples;
+      });
+    AddBenchmark("DataArray/GenericRange/" + type, setupArrays,
+      [array, numberOfTuples]()
+      {
+        double sum = 0.0;
+        for (const auto tuple : vtk::DataArrayTupleRange<3>(array))
+        {
+          sum += tuple[0] + tuple[1] + tuple[2];
+        }
+        Sink = sum;
+        return numberOfTuples;
+      });
+    AddBenchmark("DataArray/Dispatch/" + type, setupArrays,
+      [array, numberOfTuples]()
+      {
+        SumWorker worker;
+        if (!vtkArrayDispatch::Dispatch::Execute(array, worker))
+        {
+          worker(array);
+        }
+        Sink = worker.Sum;
+        return numberOfTuples;
+      });
+  }
+
+  // Cell array traversal
+  for (const bool use64Bit : { false, true })
+  {
+    const std::string storage = use64Bit ? "64" : "32";
+    auto cells = std::make_shared<vtkSmartPointer<vtkCellArray>>();
+    auto setupCells = [cells, numberOfCells, use64Bit]()
+    { *cells = MakeTriangles(numberOfCells, use64Bit); };
+    AddBenchmark("CellArray/Iterator/" + storage, setupCells,
+      [cells]()
+      {
+        vtkIdType sum = 0;
+        auto iter = vtk::TakeSmartPointer((*cells)->NewIterator());
+        for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal(); iter->GoToNextCell())
+        {
+          vtkIdType npts;
+          const vtkIdType* pts;
+          iter->GetCurrentCell(npts, pts);
+          sum += pts[npts - 1];
+        }
+        Sink = static_cast<double>(sum);
+        return (*cells)->GetNumberOfCells();
+      });
+    AddBenchmark("CellArray/GetCellAtId/" + storage, setupCells,
+      [cells]()
+      {
+        vtkIdType sum = 0;
+        vtkNew<vtkIdList> tmp;
+        const vtkIdType nbCells = (*cells)->GetNumberOfCells();
+        for (vtkIdType cellId = 0; cellId < nbCells; ++cellId)
+        {
+          vtkIdType npts;
+          const vtkIdType* pts;
+          (*cells)->GetCellAtId(cellId, npts, pts, tmp);
+          sum += pts[npts - 1];
+        }
+        Sink = static_cast<double>(sum);
+        return nbCells;
+      });
+  }
+
+  // Point locator
+  vtkNew<vtkPolyData> pointSet;
+  vtkNew<vtkStaticPointLocator> pointLocator;
+  auto queries = MakeRandomPoints(0, 2);
+  auto setupPointSet = [&]()
+  {
+    if (pointSet->GetNumberOfPoints() == 0)
+    {
+      pointSet->SetPoints(MakeRandomPoints(numberOfPoints, 1));
+      queries = MakeRandomPoints(numberOfQueries, 2);
+    }
+    pointLocator->SetDataSet(pointSet);
+  };
+  AddBenchmark("StaticPointLocator/BuildLocator", setupPointSet,
+    [&]()
+    {
+      pointLocator->Modified();
+      pointLocator->BuildLocator();
+      return pointSet->GetNumberOfPoints();
+    });
+  AddBenchmark("StaticPointLocator/FindClosestPoint",
+    [&]()
+    {
+      setupPointSet();
+      pointLocator->BuildLocator();
+    },
+    [&]()
+    {
+      vtkIdType sum = 0;
+      for (vtkIdType i = 0; i < numberOfQueries; ++i)
+      {
+        sum += pointLocator->FindClosestPoint(queries->GetPoint(i));
+      }
+      Sink = static_cast<double>(sum);
+      return numberOfQueries;
+    });
+
+  // Cell locators
+  vtkSmartPointer<vtkUnstructuredGrid> hexahedra;
+  auto setupHexahedra = [&]()
+  {
+    if (!hexahedra)
+    {
+      hexahedra = MakeHexahedra(hexDim);
+      if (queries->GetNumberOfPoints() == 0)
+      {
+        queries = MakeRandomPoints(numberOfQueries, 2);
+      }
+    }
+  };
+  vtkNew<vtkCellLocator> cellLocator;
+  vtkNew<vtkStaticCellLocator> staticCellLocator;
+  for (vtkAbstractCellLocator* locator :
+    { static_cast<vtkAbstractCellLocator*>(cellLocator.Get()),
+      static_cast<vtkAbstractCellLocator*>(staticCellLocator.Get()) })
+  {
+    const std::string name = locator->GetClassName();
+    AddBenchmark(name + "/BuildLocator",
+      [&, locator]()
+      {
+        setupHexahedra();
+        locator->SetDataSet(hexahedra);
+      },
+      [&, locator]()
+      {
+        locator->Modified();
+        locator->BuildLocator();
+        return hexahedra->GetNumberOfCells();
+      });
+    AddBenchmark(name + "/FindCell",
+      [&, locator]()
+      {
+        setupHexahedra();
+        locator->SetDataSet(hexahedra);
+        locator->BuildLocator();
+      },
+      [&, locator]()
+      {
+        vtkNew<vtkGenericCell> cell;
+        double pcoords[3], weights[8];
+        int subId;
+        vtkIdType sum = 0;
+        for (vtkIdType i = 0; i < numberOfQueries; ++i)
+        {
+          double x[3];
+          queries->GetPoint(i, x);
+          sum += locator->FindCell(x, 0.0, cell, subId, pcoords, weights);
+        }
+        Sink = static_cast<double>(sum);
+        return numberOfQueries;
+      });
+  }
+
+  // SMP overhead for each available backend: time of an empty For split in
+  // one chunk per thread, and a parallel sum over an array.
+  std::vector<std::string> backends;
+#if VTK_SMP_ENABLE_SEQUENTIAL
+  backends.emplace_back("Sequential");
+#endif
+#if VTK_SMP_ENABLE_STDTHREAD
+  backends.emplace_back("STDThread");
+#endif
+#if VTK_SMP_ENABLE_TBB
+  backends.emplace_back("TBB");
+#endif
+#if VTK_SMP_ENABLE_OPENMP
+  backends.emplace_back("OpenMP");
+#endif
+  for (const std::string& backend : backends)
+  {
+    AddBenchmark("SMPTools/EmptyFor/" + backend, []() {},
+      [backend]()
+      {
+        const vtkIdType numberOfCalls = 1000;
+        vtkSMPTools::LocalScope(vtkSMPTools::Config{ backend },
+          [numberOfCalls]()
+          {
+            const vtkIdType nbThreads = vtkSMPTools::GetEstimatedNumberOfThreads();
+            for (vtkIdType i = 0; i < numberOfCalls; ++i)
+            {
+              vtkSMPTools::For(0, nbThreads, 1, [](vtkIdType, vtkIdType) {});
+            }
+          });
+        return numberOfCalls;
+      });
+    AddBenchmark("SMPTools/Sum/" + backend, setupArrays,
+      [&doubleArray, backend]()
+      {
+        double total = 0.0;
+        vtkSMPTools::LocalScope(vtkSMPTools::Config{ backend },
+          [&]()
+          {
+            const auto values = vtk::DataArrayValueRange(doubleArray.Get());
+            total = vtkSMPTools::Reduce(values.begin(), values.end(), 0.0);
+          });
+        Sink = total;
+        return doubleArray->GetNumberOfValues();
+      });
+  }
+
+  // Run the benchmarks
+  vtksys::RegularExpression re(regex);
+  std::vector<BenchmarkResult> results;
+  std::cout << std::left << std::setw(48) << "Benchmark" << std::right << std::setw(14)
+            << "Time (ns)" << std::setw(12) << "Iterations" << std::setw(16) << "Items/s"
+            << "\n";
+  for (const Benchmark& benchmark : benchmarks)
+  {
+    if (!re.find(benchmark.Name))
+    {
+      continue;
+    }
+    results.push_back(RunBenchmark(benchmark, minTime));
+    const BenchmarkResult& result = results.back();
+    std::cout << std::left << std::setw(48) << result.Name << std::right << std::setw(14)
+              << std::fixed << std::setprecision(0) << result.BestTime * 1e9 << std::setw(12)
+              << result.Iterations << std::setw(16) << std::scientific << std::setprecision(3)
+              << (result.BestTime > 0.0 ? result.Items / result.BestTime : 0.0) << std::endl;
+  }
+
+  if (!jsonFileName.empty())
+  {
+    vtksys::ofstream file(jsonFileName.c_str());
+    if (!file)
+    {
+      std::cerr << "Unable to write " << jsonFileName << std::endl;
+      return EXIT_FAILURE;
+    }
+    WriteJSON(file, results);
+  }
+  return EXIT_SUCCESS;
+}
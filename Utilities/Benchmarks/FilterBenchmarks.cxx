@@ -0,0 +1,500 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*
+Filter level performance regression harness.
+
+A curated set of filters (contour, clip, slice, threshold, probe, surface
+extraction and normals) is run on the output of vtkRTAnalyticSource for each
+requested size and each available vtkSMPTools backend. For each run the
+throughput (input cells per second), the increase of the peak memory of the
+process during the run and the output memory are reported.
+
+Results can be written as JSON with -json, and compared with a previously
+written JSON file with -baseline: the program fails if the throughput of a
+filter dropped by more than the tolerance (-tolerance, 10% by default) compared
+to the baseline. Sizes are the half width of the wavelet extent, so a size of
+n generates (2n)^3 cells: -sizes 256 already processes 134M cells.
+*/
+
+#include "vtkContourFilter.h"
+#include "vtkDataSetSurfaceFilter.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkPlane.h"
+#include "vtkPlaneCutter.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataNormals.h"
+#include "vtkProbeFilter.h"
+#include "vtkRTAnalyticSource.h"
+#include "vtkSMP.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkTableBasedClipDataSet.h"
+#include "vtkThreshold.h"
+#include "vtkUnstructuredGrid.h"
+#include "vtkVersion.h"
+
+#include <vtk_jsoncpp.h>
+
+#include <vtksys/CommandLineArguments.hxx>
+#include <vtksys/FStream.hxx>
+#include <vtksys/RegularExpression.hxx>
+#include <vtksys/SystemInformation.hxx>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+//------------------------------------------------------------------------------
+// Peak resident memory of the process in KiB, or the current one when the
+// peak is not available on this platform.
+long long GetPeakMemoryKiB()
+{
+#if defined(__linux__) || defined(__APPLE__)
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0)
+  {
+#if defined(__APPLE__)
+    return static_cast<long long>(usage.ru_maxrss) / 1024; // bytes on macOS
+#else
+    return static_cast<long long>(usage.ru_maxrss);
+#endif
+  }
+#endif
+  vtksys::SystemInformation systemInfo;
+  return systemInfo.GetProcMemoryUsed();
+}
+
+#if defined(__linux__)
+//------------------------------------------------------------------------------
+// Value in KiB of a "Key:   N kB" line of /proc/self/status, or -1.
+long long GetProcStatusKiB(const std::string& key)
+{
+  vtksys::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line))
+  {
+    if (line.compare(0, key.size() + 1, key + ":") == 0)
+    {
+      return std::atoll(line.c_str() + key.size() + 1);
+    }
+  }
+  return -1;
+}
+#endif
+
+//------------------------------------------------------------------------------
+// Measure the increase of the peak resident memory of the process during a run.
+// The peak of getrusage() is the high-water mark of the whole process, which
+// would report the same stale value for every run after a large one. On Linux,
+// the high-water mark (VmHWM) is reset to the current resident memory before
+// the run by writing 5 to /proc/self/clear_refs. Elsewhere, or if it cannot be
+// reset, the increase of the process peak is reported, which is a lower bound:
+// it is 0 for a run that stays below the peak of a previous run.
+class PeakMemoryIncrease
+{
+public:
+  // Sample the baseline, just before the run
+  void Start()
+  {
+#if defined(__linux__)
+    vtksys::ofstream clearRefs("/proc/self/clear_refs");
+    this->Reset = clearRefs && (clearRefs << "5").flush() &&
+      (this->Baseline = GetProcStatusKiB("VmRSS")) >= 0;
+    if (this->Reset)
+    {
+      return;
+    }
+#endif
+    this->Baseline = GetPeakMemoryKiB();
+  }
+
+  // Increase in KiB since Start()
+  long long Stop() const
+  {
+    long long peak = -1;
+#if defined(__linux__)
+    if (this->Reset)
+    {
+      peak = GetProcStatusKiB("VmHWM");
+    }
+#endif
+    if (peak < 0)
+    {
+      peak = GetPeakMemoryKiB();
+    }
+    return std::max(peak - this->Baseline, 0LL);
+  }
+
+private:
+  long long Baseline = 0;
+  bool Reset = false;
+};
+
+//------------------------------------------------------------------------------
+struct FilterBenchmark
+{
+  std::string Name;
+  // Create the filter with its input already set, inputs are built once per size
+  std::function<vtkSmartPointer<vtkAlgorithm>()> Create;
+  // Number of cells of the input of the filter
+  std::function<vtkIdType()> NumberOfInputCells;
+};
+
+struct FilterResult
+{
+  std::string Name;
+  std::string Filter;
+  std::string Backend;
+  int Size = 0;
+  vtkIdType NumberOfInputCells = 0;
+  double Time = 0.0; // best time in seconds
+  double CellsPerSecond = 0.0;
+  long long PeakMemoryIncrease = 0; // KiB, largest of the runs
+  long long OutputMemory = 0;       // KiB
+};
+
+//------------------------------------------------------------------------------
+std::vector<int> ParseSizes(const std::string& sizes)
+{
+  std::vector<int> result;
+  std::stringstream stream(sizes);
+  std::string item;
+  while (std::getline(stream, item, ','))
+  {
+    const int size = std::atoi(item.c_str());
+    if (size > 0)
+    {
+      result.push_back(size);
+    }
+  }
+  return result;
+}
+
+//------------------------------------------------------------------------------
+FilterResult RunFilter(const FilterBenchmark& benchmark, int repeat)
+{
+  using Clock = std::chrono::steady_clock;
+
+  FilterResult result;
+  result.Filter = benchmark.Name;
+  result.NumberOfInputCells = benchmark.NumberOfInputCells();
+  result.Time = std::numeric_limits<double>::max();
+  for (int i = 0; i < repeat; ++i)
+  {
+    vtkSmartPointer<vtkAlgorithm> filter = benchmark.Create();
+    PeakMemoryIncrease memory;
+    memory.Start();
+    const auto start = Clock::now();
+    filter->Update();
+    const double time = std::chrono::duration<double>(Clock::now() - start).count();
+    result.PeakMemoryIncrease = std::max(result.PeakMemoryIncrease, memory.Stop());
+    result.Time = std::min(result.Time, time);
+    if (vtkDataObject* output = filter->GetOutputDataObject(0))
+    {
+      result.OutputMemory = output->GetActualMemorySize();
+    }
+  }
+  result.CellsPerSecond = result.Time > 0.0 ? result.NumberOfInputCells / result.Time : 0.0;
+  return result;
+}
+
+//------------------------------------------------------------------------------
+Json::Value ToJSON(const std::vector<FilterResult>& results)
+{
+  vtksys::SystemInformation systemInfo;
+  systemInfo.RunCPUCheck();
+  systemInfo.RunOSCheck();
+
+  Json::Value root;
+  root["context"]["vtk_version"] = vtkVersion::GetVTKVersionFull();
+  root["context"]["host_name"] = systemInfo.GetHostname();
+  root["context"]["num_cpus"] = systemInfo.GetNumberOfLogicalCPU();
+  Json::Value& benchmarks = root["benchmarks"];
+  benchmarks = Json::Value(Json::arrayValue);
+  for (const FilterResult& result : results)
+  {
+    Json::Value entry;
+    entry["name"] = result.Name;
+    entry["filter"] = result.Filter;
+    entry["backend"] = result.Backend;
+    entry["size"] = result.Size;
+    entry["input_cells"] = static_cast<Json::Int64>(result.NumberOfInputCells);
+    entry["real_time"] = result.Time;
+    entry["time_unit"] = "s";
+    entry["cells_per_second"] = result.CellsPerSecond;
+    entry["peak_memory_increase_kib"] = static_cast<Json::Int64>(result.PeakMemoryIncrease);
+    entry["output_memory_kib"] = static_cast<Json::Int64>(result.OutputMemory);
+    benchmarks.append(entry);
+  }
+  return root;
+}
+
+//------------------------------------------------------------------------------
+bool ReadBaseline(const std::string& fileName, std::map<std::string, double>& baseline)
+{
+  vtksys::ifstream file(fileName.c_str());
+  if (!file)
+  {
+    std::cerr << "Unable to read baseline " << fileName << std::endl;
+    return false;
+  }
+  Json::CharReaderBuilder builder;
+  Json::Value root;
+  std::string errors;
+  if (!Json::parseFromStream(builder, file, &root, &errors))
+  {
+    std::cerr << "Unable to parse baseline " << fileName << ": " << errors << std::endl;
+    return false;
+  }
+  for (const Json::Value& entry : root["benchmarks"])
+  {
+    baseline[entry["name"].asString()] = entry["cells_per_second"].asDouble();
+  }
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  std::string regex = ".*";
+  std::string sizesArgument = "32,64";
+  std::string jsonFileName;
+  std::string baselineFileName;
+  double tolerance = 0.1;
+  int repeat = 3;
+  bool displayHelp = false;
+
+  vtksys::CommandLineArguments arguments;
+  arguments.Initialize(argc, argv);
+  using argT = vtksys::CommandLineArguments;
+  arguments.AddArgument("-regex", argT::SPACE_ARGUMENT, &regex,
+    "Only run the benchmarks whose name (Filter/Size/Backend) matches this regex.");
+  arguments.AddArgument("-sizes", argT::SPACE_ARGUMENT, &sizesArgument,
+    "Comma separated half widths of the wavelet extent (default 32,64).");
+  arguments.AddArgument(
+    "-repeat", argT::SPACE_ARGUMENT, &repeat, "Number of runs of each filter (default 3).");
+  arguments.AddArgument("-json", argT::SPACE_ARGUMENT, &jsonFileName,
+    "Write the results in JSON format to the given file.");
+  arguments.AddArgument("-baseline", argT::SPACE_ARGUMENT, &baselineFileName,
+    "Compare the throughput with the results stored in the given JSON file.");
+  arguments.AddArgument("-tolerance", argT::SPACE_ARGUMENT, &tolerance,
+    "Maximum relative throughput loss accepted against the baseline (default 0.1).");
+  arguments.AddBooleanArgument("-help", &displayHelp, "Provide a listing of command line options.");
+  arguments.AddBooleanArgument("--help", &displayHelp, "Provide a listing of command line options.");
+  if (!arguments.Parse() || displayHelp)
+  {
+    std::cerr << "Usage: " << argv[0] << " [options]\n\nOptions:\n" << arguments.GetHelp();
+    return displayHelp ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+  repeat = std::max(repeat, 1);
+
+  std::map<std::string, double> baseline;
+  if (!baselineFileName.empty() && !ReadBaseline(baselineFileName, baseline))
+  {
+    return EXIT_FAILURE;
+  }
+
+  std::vector<std::string> backends;
+#if VTK_SMP_ENABLE_SEQUENTIAL
+  backends.emplace_back("Sequential");
+#endif
+#if VTK_SMP_ENABLE_STDTHREAD
+  backends.emplace_back("STDThread");
+#endif
+#if VTK_SMP_ENABLE_TBB
+  backends.emplace_back("TBB");
+#endif
+#if VTK_SMP_ENABLE_OPENMP
+  backends.emplace_back("OpenMP");
+#endif
+
+  // Inputs, built once per size
+  vtkSmartPointer<vtkImageData> image;
+  vtkSmartPointer<vtkPolyData> contour;
+  vtkSmartPointer<vtkUnstructuredGrid> threshold;
+  vtkSmartPointer<vtkImageData> probePoints;
+  const double isoValue = 157.0;
+
+  std::vector<FilterBenchmark> benchmarks;
+  auto imageCells = [&image]() { return image->GetNumberOfCells(); };
+  benchmarks.push_back(FilterBenchmark{ "Contour",
+    [&]()
+    {
+      auto filter = vtkSmartPointer<vtkContourFilter>::New();
+      filter->SetInputData(image);
+      filter->SetValue(0, isoValue);
+      return vtkSmartPointer<vtkAlgorithm>(filter);
+    },
+    imageCells });
+  benchmarks.push_back(FilterBenchmark{ "Clip",
+    [&]()
+    {
+      auto filter = vtkSmartPointer<vtkTableBasedClipDataSet>::New();
+      filter->SetInputData(image);
+      filter->SetValue(isoValue);
+      return vtkSmartPointer<vtkAlgorithm>(filter);
+    },
+    imageCells });
+  benchmarks.push_back(FilterBenchmark{ "Slice",
+    [&]()
+    {
+      auto filter = vtkSmartPointer<vtkPlaneCutter>::New();
+      vtkNew<vtkPlane> plane;
+      plane->SetOrigin(image->GetCenter());
+      plane->SetNormal(1.0, 1.0, 1.0);
+      filter->SetInputData(image);
+      filter->SetPlane(plane);
+      return vtkSmartPointer<vtkAlgorithm>(filter);
+    },
+    imageCells });
+  benchmarks.push_back(FilterBenchmark{ "Threshold",
+    [&]()
+    {
+      auto filter = vtkSmartPointer<vtkThreshold>::New();
+      filter->SetInputData(image);
+      filter->SetLowerThreshold(100.0);
+      filter->SetUpperThreshold(200.0);
+      filter->SetThresholdFunction(vtkThreshold::THRESHOLD_BETWEEN);
+      return vtkSmartPointer<vtkAlgorithm>(filter);
+    },
+    imageCells });
+  benchmarks.push_back(FilterBenchmark{ "Probe",
+    [&]()
+    {
+      auto filter = vtkSmartPointer<vtkProbeFilter>::New();
+      filter->SetInputData(probePoints);
+      filter->SetSourceData(image);
+      return vtkSmartPointer<vtkAlgorithm>(filter);
+    },
+    [&probePoints]() { return probePoints->GetNumberOfPoints(); } });
+  benchmarks.push_back(FilterBenchmark{ "SurfaceExtraction",
+    [&]()
+    {
+      auto filter = vtkSmartPointer<vtkDataSetSurfaceFilter>::New();
+      filter->SetInputData(threshold);
+      return vtkSmartPointer<vtkAlgorithm>(filter);
+    },
+    [&threshold]() { return threshold->GetNumberOfCells(); } });
+  benchmarks.push_back(FilterBenchmark{ "Normals",
+    [&]()
+    {
+      auto filter = vtkSmartPointer<vtkPolyDataNormals>::New();
+      filter->SetInputData(contour);
+      return vtkSmartPointer<vtkAlgorithm>(filter);
+    },
+    [&contour]() { return contour->GetNumberOfCells(); } });
+
+  vtksys::RegularExpression re(regex);
+  std::vector<FilterResult> results;
+  bool regression = false;
+  std::cout << std::left << std::setw(40) << "Benchmark" << std::right << std::setw(14)
+            << "Cells" << std::setw(12) << "Time (s)" << std::setw(14) << "Cells/s"
+            << std::setw(14) << "+Peak (MiB)" << std::setw(12) << "Baseline"
+            << "\n";
+  for (const int size : ParseSizes(sizesArgument))
+  {
+    // Generate the inputs of this size
+    vtkNew<vtkRTAnalyticSource> source;
+    source->SetWholeExtent(-size, size, -size, size, -size, size);
+    source->Update();
+    image = source->GetOutput();
+
+    vtkNew<vtkContourFilter> contourFilter;
+    contourFilter->SetInputData(image);
+    contourFilter->SetValue(0, isoValue);
+    contourFilter->Update();
+    contour = contourFilter->GetOutput();
+
+    vtkNew<vtkThreshold> thresholdFilter;
+    thresholdFilter->SetInputData(image);
+    thresholdFilter->SetLowerThreshold(isoValue);
+    thresholdFilter->SetUpperThreshold(std::numeric_limits<double>::max());
+    thresholdFilter->SetThresholdFunction(vtkThreshold::THRESHOLD_BETWEEN);
+    thresholdFilter->Update();
+    threshold = thresholdFilter->GetOutput();
+
+    // Probe at cell centers of a image twice as coarse
+    probePoints = vtkSmartPointer<vtkImageData>::New();
+    probePoints->SetDimensions(size, size, size);
+    probePoints->SetOrigin(-size + 1.0, -size + 1.0, -size + 1.0);
+    probePoints->SetSpacing(2.0, 2.0, 2.0);
+
+    for (const std::string& backend : backends)
+    {
+      for (const FilterBenchmark& benchmark : benchmarks)
+      {
+        const std::string name = benchmark.Name + "/" + std::to_string(size) + "/" + backend;
+        if (!re.find(name))
+        {
+          continue;
+        }
+        FilterResult result;
+        vtkSMPTools::LocalScope(vtkSMPTools::Config{ backend },
+          [&]() { result = RunFilter(benchmark, repeat); });
+        result.Name = name;
+        result.Backend = backend;
+        result.Size = size;
+        results.push_back(result);
+
+        std::string comparison = "-";
+        auto it = baseline.find(name);
+        if (it != baseline.end() && it->second > 0.0)
+        {
+          const double ratio = result.CellsPerSecond / it->second;
+          std::stringstream stream;
+          stream << std::fixed << std::setprecision(2) << ratio << "x";
+          comparison = stream.str();
+          if (ratio < 1.0 - tolerance)
+          {
+            comparison += " REGRESSION";
+            regression = true;
+          }
+        }
+        std::cout << std::left << std::setw(40) << name << std::right << std::setw(14)
+                  << result.NumberOfInputCells << std::setw(12) << std::fixed
+                  << std::setprecision(4) << result.Time << std::setw(14) << std::scientific
+                  << std::setprecision(3) << result.CellsPerSecond << std::setw(14) << std::fixed
+                  << std::setprecision(1) << result.PeakMemoryIncrease / 1024.0 << "  "
+                  << comparison << std::endl;
+      }
+    }
+  }
+
+  if (!jsonFileName.empty())
+  {
+    vtksys::ofstream file(jsonFileName.c_str());
+    if (!file)
+    {
+      std::cerr << "Unable to write " << jsonFileName << std::endl;
+      return EXIT_FAILURE;
+    }
+    Json::StreamWriterBuilder builder;
+    builder["indentation"] = "  ";
+    file << Json::writeString(builder, ToJSON(results)) << "\n";
+  }
+
+  if (regression)
+  {
+    std::cerr << "Throughput regressions detected against " << baselineFileName << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -1219,6 +1219,43 @@ void DICOMAppHelper::Clear()
   this->Implementation->SeriesUIDMap.clear();
 }
 
+DICOMFileEntry DICOMAppHelper::GetFileEntry(const dicom_stl::string& filename)
+{
+  DICOMFileEntry entry;
+  for (dicom_stl::map<dicom_stl::string, dicom_stl::vector<dicom_stl::string>, ltstdstr>::iterator
+         iter = this->Implementation->SeriesUIDMap.begin();
+       iter != this->Implementation->SeriesUIDMap.end() && !entry.HasSeriesUID; ++iter)
+  {
+    if (dicom_stl::find((*iter).second.begin(), (*iter).second.end(), filename) !=
+      (*iter).second.end())
+    {
+      entry.HasSeriesUID = true;
+      entry.SeriesUID = (*iter).first;
+    }
+  }
+
+  dicom_stl::map<dicom_stl::string, DICOMOrderingElements, ltstdstr>::iterator it =
+    this->Implementation->SliceOrderingMap.find(filename);
+  if (it != this->Implementation->SliceOrderingMap.end())
+  {
+    entry.HasOrderingElements = true;
+    entry.OrderingElements = (*it).second;
+  }
+  return entry;
+}
+
+void DICOMAppHelper::AddFileEntry(const dicom_stl::string& filename, const DICOMFileEntry& entry)
+{
+  if (entry.HasSeriesUID)
+  {
+    this->Implementation->SeriesUIDMap[entry.SeriesUID].push_back(filename);
+  }
+  if (entry.HasOrderingElements)
+  {
+    this->Implementation->SliceOrderingMap[filename] = entry.OrderingElements;
+  }
+}
+
 void DICOMAppHelper::PatientNameCallback(
   DICOMParser*, doublebyte, doublebyte, DICOMParser::VRTypes, unsigned char* val, quadbyte)
 {
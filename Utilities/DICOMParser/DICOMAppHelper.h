@@ -68,6 +68,25 @@ public:
   float ImageOrientationPatient[6];
 };
 
+/**
+ * Entries of the databases of a DICOMAppHelper for one file: the
+ * series UID the file was grouped under and the tags used to order
+ * the file within its series.
+ */
+struct DICOMFileEntry
+{
+  DICOMFileEntry()
+    : HasSeriesUID(false)
+    , HasOrderingElements(false)
+  {
+  }
+
+  bool HasSeriesUID;
+  dicom_stl::string SeriesUID;
+  bool HasOrderingElements;
+  DICOMOrderingElements OrderingElements;
+};
+
 class DICOMAppHelperImplementation;
 
 /**
@@ -265,6 +284,16 @@ public:
    * ordering filenames based on image locations. */
   void Clear();
 
+  /** Get the entries of the databases for a file processed since the
+   * last clearing of the cache. */
+  DICOMFileEntry GetFileEntry(const dicom_stl::string& filename);
+
+  /** Add the entries of a file to the databases, as if its header had
+   * been processed by the DICOMParser. This allows an application to
+   * process headers with other helpers, in other threads or in
+   * previous sessions, and group the files afterwards. */
+  void AddFileEntry(const dicom_stl::string& filename, const DICOMFileEntry& entry);
+
   /** Get the series UIDs for the files processed since the last
    * clearing of the cache. */
   void GetSeriesUIDs(dicom_stl::vector<dicom_stl::string>& v);
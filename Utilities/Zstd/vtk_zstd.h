@@ -0,0 +1,9 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#ifndef vtk_zstd_h
+#define vtk_zstd_h
+
+/* Use the external zstd library, VTK does not provide one.  */
+#include <zstd.h>
+
+#endif
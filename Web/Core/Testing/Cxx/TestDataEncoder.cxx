@@ -4,9 +4,11 @@
 #include <vtkImageCast.h>
 #include <vtkImageData.h>
 #include <vtkImageMandelbrotSource.h>
+#include <vtkJPEGReader.h>
 #include <vtkLogger.h>
 #include <vtkNew.h>
 #include <vtkSmartPointer.h>
+#include <vtkUnsignedCharArray.h>
 
 #include <chrono>
 #include <thread>
@@ -108,10 +110,46 @@ bool TestLatestOutput()
   return true;
 }
 
+bool TestShrink()
+{
+  vtkLogScopeFunction(INFO);
+  constexpr int KEY = 1020;
+
+  vtkNew<vtkDataEncoder> encoder;
+  // no base64 encoding, so that the result can be read back as a JPEG.
+  encoder->Push(KEY, GetData(), 50, 0, 2);
+  encoder->Flush(KEY);
+
+  vtkSmartPointer<vtkUnsignedCharArray> result;
+  if (!encoder->GetLatestOutput(KEY, result) || !result)
+  {
+    vtkLogF(ERROR, "latest output expected!");
+    return false;
+  }
+  if (encoder->GetEncodingTime(KEY) <= 0)
+  {
+    vtkLogF(ERROR, "positive encoding time expected!");
+    return false;
+  }
+
+  vtkNew<vtkJPEGReader> reader;
+  reader->SetMemoryBuffer(result->GetPointer(0));
+  reader->SetMemoryBufferLength(result->GetNumberOfValues());
+  reader->Update();
+  int dims[3];
+  reader->GetOutput()->GetDimensions(dims);
+  if (dims[0] != 128 || dims[1] != 128)
+  {
+    vtkLogF(ERROR, "expected a 128x128 image, got %dx%d", dims[0], dims[1]);
+    return false;
+  }
+  return true;
+}
+
 int TestDataEncoder(int /*argc*/, char* /*argv*/[])
 {
   TestCreate();
   TestFlush();
   TestLatestOutput();
-  return EXIT_SUCCESS;
+  return TestShrink() ? EXIT_SUCCESS : EXIT_FAILURE;
 }
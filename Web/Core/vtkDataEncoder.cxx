@@ -10,15 +10,18 @@
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPNGWriter.h"
+#include "vtkPointData.h"
 #include "vtkSmartPointer.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cmath>
 #include <condition_variable>
+#include <deque>
 #include <map>
 #include <mutex>
-#include <queue>
 #include <thread>
 #include <vector>
 
@@ -35,14 +38,16 @@ struct vtkWork
   vtkSmartPointer<vtkImageData> Image;
   int Quality = 0;
   int Encoding = 0;
+  int ShrinkFactor = 1;
   vtkTypeUInt64 TimeStamp = 0;
   vtkTypeUInt32 Key = 0;
 
   vtkWork() = default;
-  vtkWork(vtkTypeUInt32 key, vtkImageData* image, int quality, int encoding)
+  vtkWork(vtkTypeUInt32 key, vtkImageData* image, int quality, int encoding, int shrinkFactor)
     : Image(image)
     , Quality(quality)
     , Encoding(encoding)
+    , ShrinkFactor(shrinkFactor)
     , TimeStamp(0)
     , Key(key)
   {
@@ -51,16 +56,66 @@ struct vtkWork
   vtkWork& operator=(const vtkWork&) = default;
 };
 
+// Average the pixels of an unsigned char image over blocks of factor x factor
+// pixels. Images of other scalar types are returned unchanged.
+vtkSmartPointer<vtkImageData> Shrink(vtkImageData* image, int factor)
+{
+  vtkUnsignedCharArray* scalars =
+    vtkArrayDownCast<vtkUnsignedCharArray>(image->GetPointData()->GetScalars());
+  int dims[3];
+  image->GetDimensions(dims);
+  if (factor <= 1 || !scalars || dims[2] != 1)
+  {
+    return image;
+  }
+
+  const int numComps = scalars->GetNumberOfComponents();
+  const int width = std::max(dims[0] / factor, 1);
+  const int height = std::max(dims[1] / factor, 1);
+  const int blockWidth = std::min(factor, dims[0]);
+  const int blockHeight = std::min(factor, dims[1]);
+  const int blockSize = blockWidth * blockHeight;
+
+  auto result = vtkSmartPointer<vtkImageData>::New();
+  result->SetDimensions(width, height, 1);
+  result->AllocateScalars(VTK_UNSIGNED_CHAR, numComps);
+  const unsigned char* src = scalars->GetPointer(0);
+  unsigned char* dst = static_cast<unsigned char*>(result->GetScalarPointer());
+  std::vector<int> sums(numComps);
+  for (int j = 0; j < height; ++j)
+  {
+    for (int i = 0; i < width; ++i)
+    {
+      std::fill(sums.begin(), sums.end(), 0);
+      for (int y = j * blockHeight; y < (j + 1) * blockHeight; ++y)
+      {
+        const unsigned char* row =
+          src + (static_cast<size_t>(y) * dims[0] + i * blockWidth) * numComps;
+        for (int x = 0; x < blockWidth * numComps; ++x)
+        {
+          sums[x % numComps] += row[x];
+        }
+      }
+      for (int c = 0; c < numComps; ++c)
+      {
+        *dst++ = static_cast<unsigned char>((sums[c] + blockSize / 2) / blockSize);
+      }
+    }
+  }
+  return result;
+}
+
 class vtkWorkQueue
 {
   mutable std::mutex ResultsMutex;
   std::map<vtkTypeUInt32, std::pair<vtkTypeUInt64, vtkSmartPointer<vtkUnsignedCharArray>>> Results;
+  std::map<vtkTypeUInt32, double> EncodingTimes;
   std::condition_variable ResultsCondition;
 
   std::map<vtkTypeUInt32, std::atomic<vtkTypeUInt32>> LastTimeStamp;
 
   std::mutex QueueMutex;
-  std::queue<vtkWork> Queue;
+  std::deque<vtkWork> Queue;
   std::condition_variable QueueCondition;
 
   std::vector<std::thread> ThreadPool;
@@ -93,10 +148,11 @@ class vtkWorkQueue
           break;
         }
         work = self->Queue.front();
-        self->Queue.pop();
+        self->Queue.pop_front();
       }
 
-      writer->SetInputData(work.Image);
+      auto start = std::chrono::steady_clock::now();
+      writer->SetInputData(Shrink(work.Image, work.ShrinkFactor));
       writer->SetQuality(work.Quality);
       writer->Write();
 
@@ -118,6 +174,7 @@ class vtkWorkQueue
         result->DeepCopy(writer->GetResult());
       }
       writer->SetInputData(nullptr);
+      const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
 
       {
         std::unique_lock<std::mutex> lock(self->ResultsMutex);
@@ -125,6 +182,7 @@ class vtkWorkQueue
         if (pair.first < work.TimeStamp)
         {
           pair = std::make_pair(work.TimeStamp, result);
+          self->EncodingTimes[work.Key] = elapsed.count();
           lock.unlock();
           self->ResultsCondition.notify_all();
         }
@@ -156,7 +214,7 @@ public:
 
   bool IsValid() const { return !this->ThreadPool.empty(); }
 
-  void PushBack(vtkWork&& work)
+  void PushBack(vtkWork&& work, bool coalesce)
   {
     if (!this->IsValid())
     {
@@ -168,7 +226,19 @@ public:
     work.TimeStamp = ++this->LastTimeStamp[key];
     {
       std::unique_lock<std::mutex> lock(this->QueueMutex);
-      this->Queue.emplace(std::move(work));
+      if (coalesce)
+      {
+        // A frame not taken up by a worker yet would be outdated by this one
+        // once encoded: replace it instead of encoding both.
+        auto iter = std::find_if(this->Queue.begin(), this->Queue.end(),
+          [key](const vtkWork& queued) { return queued.Key == key; });
+        if (iter != this->Queue.end())
+        {
+          *iter = std::move(work);
+          return;
+        }
+      }
+      this->Queue.emplace_back(std::move(work));
     }
     this->QueueCondition.notify_one();
   }
@@ -188,6 +258,13 @@ public:
     return (resultsPair.first == this->LastTimeStamp.at(key));
   }
 
+  double GetEncodingTime(vtkTypeUInt32 key) const
+  {
+    std::unique_lock<std::mutex> lock(this->ResultsMutex);
+    auto iter = this->EncodingTimes.find(key);
+    return iter == this->EncodingTimes.end() ? 0.0 : iter->second;
+  }
+
   void Flush(vtkTypeUInt32 key)
   {
     auto tsIter = this->LastTimeStamp.find(key);
@@ -247,6 +324,7 @@ vtkStandardNewMacro(vtkDataEncoder);
 //------------------------------------------------------------------------------
 vtkDataEncoder::vtkDataEncoder()
   : MaxThreads(3)
+  , CoalesceFrames(true)
   , Internals(new vtkInternals(this->MaxThreads))
 {
 }
@@ -270,10 +348,19 @@ void vtkDataEncoder::Initialize()
 }
 
 //------------------------------------------------------------------------------
-void vtkDataEncoder::Push(vtkTypeUInt32 key, vtkImageData* data, int quality, int encoding)
+void vtkDataEncoder::Push(
+  vtkTypeUInt32 key, vtkImageData* data, int quality, int encoding, int shrinkFactor)
+{
+  auto& internals = (*this->Internals);
+  internals.Queue.PushBack(
+    detail::vtkWork(key, data, quality, encoding, shrinkFactor), this->CoalesceFrames);
+}
+
+//------------------------------------------------------------------------------
+double vtkDataEncoder::GetEncodingTime(vtkTypeUInt32 key)
 {
   auto& internals = (*this->Internals);
-  internals.Queue.PushBack(detail::vtkWork(key, data, quality, encoding));
+  return internals.Queue.GetEncodingTime(key);
 }
 
 //------------------------------------------------------------------------------
@@ -322,6 +409,8 @@ void vtkDataEncoder::Flush(vtkTypeUInt32 key)
 void vtkDataEncoder::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "MaxThreads: " << this->MaxThreads << endl;
+  os << indent << "CoalesceFrames: " << this->CoalesceFrames << endl;
 }
 
 //------------------------------------------------------------------------------
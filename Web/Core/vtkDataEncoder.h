@@ -16,6 +16,12 @@
  * takes longer to compress and encode than that pushed in at N+1-th location or
  * if it was pushed in before the N-th location was even taken up for encoding
  * by the a thread in the thread pool.
+ *
+ * When a new image is pushed for a key while a previous image for the same key
+ * is still waiting for a worker, the waiting image is dropped (see
+ * CoalesceFrames), so that a slow encoder does not accumulate a backlog of
+ * outdated frames. Images can also be shrunk by the workers before encoding to
+ * reduce the size of the encoded result.
  */
 
 #ifndef vtkDataEncoder_h
@@ -52,13 +58,32 @@ public:
    */
   void Initialize();
 
+  ///@{
+  /**
+   * When enabled, pushing an image replaces the image pushed for the same key
+   * that no worker has taken up yet, instead of encoding both. Default is true.
+   */
+  vtkSetMacro(CoalesceFrames, bool);
+  vtkGetMacro(CoalesceFrames, bool);
+  vtkBooleanMacro(CoalesceFrames, bool);
+  ///@}
+
   /**
    * Push an image into the encoder. The data is considered unchanging and thus
    * should not be modified once pushed. Reference count changes are now thread safe
    * and hence callers should ensure they release the reference held, if
-   * appropriate.
+   * appropriate. When @a shrinkFactor is greater than 1, the workers average
+   * the pixels of unsigned char images over blocks of shrinkFactor x
+   * shrinkFactor pixels before encoding them.
+   */
+  void Push(
+    vtkTypeUInt32 key, vtkImageData* data, int quality, int encoding = 1, int shrinkFactor = 1);
+
+  /**
+   * Return the time in seconds taken to shrink and encode the image of the
+   * most recent output for the given key, 0 if there is none.
    */
-  void Push(vtkTypeUInt32 key, vtkImageData* data, int quality, int encoding = 1);
+  double GetEncodingTime(vtkTypeUInt32 key);
 
   /**
    * Get access to the most-recent fully encoded result corresponding to the
@@ -97,6 +122,7 @@ protected:
   ~vtkDataEncoder() override;
 
   vtkTypeUInt32 MaxThreads;
+  bool CoalesceFrames;
 
 private:
   vtkDataEncoder(const vtkDataEncoder&) = delete;
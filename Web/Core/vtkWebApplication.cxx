@@ -24,7 +24,9 @@
 #include "vtkWebInteractionEvent.h"
 #include "vtkWindowToImageFilter.h"
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cmath>
 #include <map>
 #include <sstream>
@@ -41,11 +43,26 @@ public:
     bool HasImagesBeingProcessed;
     vtkObject* ViewPointer;
     unsigned long ObserverId;
+    // Quality and shrink factor of the last image pushed to the encoder.
+    int Quality;
+    int ShrinkFactor;
+    // Adaptive settings of the interactive images, with the smoothed latency
+    // they are adapted to (negative until the first measurement).
+    int InteractiveQuality;
+    int InteractiveShrinkFactor;
+    double Latency;
+    bool LatencyReported;
     ImageCacheValueType()
       : NeedsRender(true)
       , HasImagesBeingProcessed(false)
       , ViewPointer(nullptr)
       , ObserverId(0)
+      , Quality(0)
+      , ShrinkFactor(1)
+      , InteractiveQuality(-1)
+      , InteractiveShrinkFactor(1)
+      , Latency(-1.0)
+      , LatencyReported(false)
     {
     }
 
@@ -110,6 +127,11 @@ vtkStandardNewMacro(vtkWebApplication);
 vtkWebApplication::vtkWebApplication()
   : ImageEncoding(ENCODING_BASE64)
   , ImageCompression(COMPRESSION_JPEG)
+  , LastStillRenderToMTime(0)
+  , AdaptiveQuality(false)
+  , TargetFrameLatency(0.1)
+  , MinimumQuality(20)
+  , MaximumShrinkFactor(4)
   , Internals(new vtkWebApplication::vtkInternals())
 {
 }
@@ -144,8 +166,94 @@ bool vtkWebApplication::GetHasImagesBeingProcessed(vtkRenderWindow* view)
 //------------------------------------------------------------------------------
 vtkUnsignedCharArray* vtkWebApplication::InteractiveRender(vtkRenderWindow* view, int quality)
 {
-  // for now, just do the same as StillRender().
-  return this->StillRender(view, quality);
+  if (!this->AdaptiveQuality || !view)
+  {
+    return this->StillRender(view, quality);
+  }
+
+  vtkInternals::ImageCacheValueType& value = this->Internals->ImageCache[view];
+  if (value.InteractiveQuality < 0 || value.InteractiveQuality > quality)
+  {
+    value.InteractiveQuality = quality;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  vtkUnsignedCharArray* result =
+    this->Render(view, value.InteractiveQuality, value.InteractiveShrinkFactor);
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  if (!value.LatencyReported)
+  {
+    // the encoding time is the one of the most recent image, which may not be
+    // the image just pushed but was obtained with similar settings.
+    auto viewID = this->Internals->ObjectIdMap->GetGlobalId(view);
+    this->AdaptToLatency(
+      view, elapsed.count() + this->Internals->Encoder->GetEncodingTime(viewID));
+  }
+  value.InteractiveQuality = std::min(value.InteractiveQuality, quality);
+  return result;
+}
+
+//------------------------------------------------------------------------------
+void vtkWebApplication::ReportFrameLatency(vtkRenderWindow* view, double latency)
+{
+  if (!view || latency < 0)
+  {
+    return;
+  }
+  this->Internals->ImageCache[view].LatencyReported = true;
+  this->AdaptToLatency(view, latency);
+}
+
+//------------------------------------------------------------------------------
+void vtkWebApplication::AdaptToLatency(vtkRenderWindow* view, double latency)
+{
+  vtkInternals::ImageCacheValueType& value = this->Internals->ImageCache[view];
+  value.Latency = value.Latency < 0 ? latency : 0.7 * value.Latency + 0.3 * latency;
+  if (value.InteractiveQuality < 0)
+  {
+    // InteractiveRender() has not been called yet, its quality is unknown.
+    return;
+  }
+
+  // Degrade quickly and restore slowly, the quality first and then the resolution
+  // when degrading, in the reverse order when restoring.
+  if (value.Latency > this->TargetFrameLatency)
+  {
+    if (value.InteractiveQuality > this->MinimumQuality)
+    {
+      value.InteractiveQuality = std::max(this->MinimumQuality, value.InteractiveQuality - 10);
+    }
+    else if (value.InteractiveShrinkFactor < this->MaximumShrinkFactor)
+    {
+      ++value.InteractiveShrinkFactor;
+    }
+  }
+  else if (value.Latency < 0.5 * this->TargetFrameLatency)
+  {
+    if (value.InteractiveShrinkFactor > 1)
+    {
+      --value.InteractiveShrinkFactor;
+    }
+    else
+    {
+      // InteractiveRender() clamps it to the requested quality.
+      value.InteractiveQuality += 5;
+    }
+  }
+  value.InteractiveShrinkFactor =
+    std::min(value.InteractiveShrinkFactor, std::max(this->MaximumShrinkFactor, 1));
+}
+
+//------------------------------------------------------------------------------
+int vtkWebApplication::GetInteractiveQuality(vtkRenderWindow* view)
+{
+  return this->Internals->ImageCache[view].InteractiveQuality;
+}
+
+//------------------------------------------------------------------------------
+int vtkWebApplication::GetInteractiveShrinkFactor(vtkRenderWindow* view)
+{
+  return this->Internals->ImageCache[view].InteractiveShrinkFactor;
 }
 
 //------------------------------------------------------------------------------
@@ -156,6 +264,13 @@ void vtkWebApplication::InvalidateCache(vtkRenderWindow* view)
 
 //------------------------------------------------------------------------------
 vtkUnsignedCharArray* vtkWebApplication::StillRender(vtkRenderWindow* view, int quality)
+{
+  return this->Render(view, quality, 1);
+}
+
+//------------------------------------------------------------------------------
+vtkUnsignedCharArray* vtkWebApplication::Render(
+  vtkRenderWindow* view, int quality, int shrinkFactor)
 {
   if (!view)
   {
@@ -167,8 +282,8 @@ vtkUnsignedCharArray* vtkWebApplication::StillRender(vtkRenderWindow* view, int
   vtkInternals::ImageCacheValueType& value = this->Internals->ImageCache[view];
   value.SetListener(view);
 
-  if (!value.NeedsRender &&
-    value.Data != nullptr /* FIXME SEB &&
+  if (!value.NeedsRender && value.Data != nullptr && value.Quality >= quality &&
+    value.ShrinkFactor <= shrinkFactor /* FIXME SEB &&
     view->HasDirtyRepresentation() == false */)
   {
     bool latest = this->Internals->Encoder->GetLatestOutput(viewID, value.Data);
@@ -202,7 +317,9 @@ vtkUnsignedCharArray* vtkWebApplication::StillRender(vtkRenderWindow* view, int
   // vtkTimerLog::MarkEndEvent("StillRenderToString");
   // vtkTimerLog::DumpLogWithIndents(&cout, 0.0);
 
-  this->Internals->Encoder->Push(viewID, image, quality, this->ImageEncoding);
+  this->Internals->Encoder->Push(viewID, image, quality, this->ImageEncoding, shrinkFactor);
+  value.Quality = quality;
+  value.ShrinkFactor = shrinkFactor;
 
   if (value.Data == nullptr)
   {
@@ -446,6 +563,10 @@ void vtkWebApplication::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
   os << indent << "ImageEncoding: " << this->ImageEncoding << endl;
   os << indent << "ImageCompression: " << this->ImageCompression << endl;
+  os << indent << "AdaptiveQuality: " << this->AdaptiveQuality << endl;
+  os << indent << "TargetFrameLatency: " << this->TargetFrameLatency << endl;
+  os << indent << "MinimumQuality: " << this->MinimumQuality << endl;
+  os << indent << "MaximumShrinkFactor: " << this->MaximumShrinkFactor << endl;
 }
 
 //------------------------------------------------------------------------------
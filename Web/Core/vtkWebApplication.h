@@ -67,7 +67,11 @@ public:
 
   ///@{
   /**
-   * Render a view and obtain the rendered image.
+   * Render a view and obtain the rendered image. The image of a view is cached
+   * and returned again as long as the view has not changed, unless it was
+   * encoded with a lower quality or resolution than requested.
+   * InteractiveRender() uses the adaptive quality and resolution of the view
+   * when AdaptiveQuality is enabled, @a quality being the maximum quality.
    */
   vtkUnsignedCharArray* StillRender(vtkRenderWindow* view, int quality = 100);
   vtkUnsignedCharArray* InteractiveRender(vtkRenderWindow* view, int quality = 50);
@@ -76,6 +80,64 @@ public:
     vtkRenderWindow* view, vtkMTimeType time = 0, int quality = 100);
   ///@}
 
+  ///@{
+  /**
+   * Enable the adaptation of the interactive images of each view to the frame
+   * latency of the view. While the latency exceeds TargetFrameLatency, the JPEG
+   * quality of the images of InteractiveRender() is lowered down to
+   * MinimumQuality, then their resolution is divided by a shrink factor up to
+   * MaximumShrinkFactor. Both are restored progressively once the latency is
+   * below half the target. Default is false.
+   */
+  vtkSetMacro(AdaptiveQuality, bool);
+  vtkGetMacro(AdaptiveQuality, bool);
+  vtkBooleanMacro(AdaptiveQuality, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Set the frame latency, in seconds, targeted by the adaptive quality.
+   * Default is 0.1.
+   */
+  vtkSetClampMacro(TargetFrameLatency, double, 0.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(TargetFrameLatency, double);
+  ///@}
+
+  ///@{
+  /**
+   * Set the lowest JPEG quality used by the adaptive quality. Default is 20.
+   */
+  vtkSetClampMacro(MinimumQuality, int, 0, 100);
+  vtkGetMacro(MinimumQuality, int);
+  ///@}
+
+  ///@{
+  /**
+   * Set the largest factor the resolution of the interactive images can be
+   * divided by. Default is 4.
+   */
+  vtkSetClampMacro(MaximumShrinkFactor, int, 1, 16);
+  vtkGetMacro(MaximumShrinkFactor, int);
+  ///@}
+
+  /**
+   * Report the frame latency of a view measured by the client, e.g. the time
+   * between sending an interaction event and displaying the resulting image,
+   * which includes the network transfers. Once a latency is reported for a
+   * view, the adaptive quality of the view only uses the reported latencies;
+   * otherwise, it uses the time taken to render, capture and encode the images.
+   */
+  void ReportFrameLatency(vtkRenderWindow* view, double latency);
+
+  ///@{
+  /**
+   * Get the current JPEG quality and shrink factor of the interactive images
+   * of a view.
+   */
+  int GetInteractiveQuality(vtkRenderWindow* view);
+  int GetInteractiveShrinkFactor(vtkRenderWindow* view);
+  ///@}
+
   /**
    * StillRenderToString() need not necessary returns the most recently rendered
    * image. Use this method to get whether there are any pending images being
@@ -131,11 +193,18 @@ protected:
   int ImageEncoding;
   int ImageCompression;
   vtkMTimeType LastStillRenderToMTime;
+  bool AdaptiveQuality;
+  double TargetFrameLatency;
+  int MinimumQuality;
+  int MaximumShrinkFactor;
 
 private:
   vtkWebApplication(const vtkWebApplication&) = delete;
   void operator=(const vtkWebApplication&) = delete;
 
+  vtkUnsignedCharArray* Render(vtkRenderWindow* view, int quality, int shrinkFactor);
+  void AdaptToLatency(vtkRenderWindow* view, double latency);
+
   class vtkInternals;
   vtkInternals* Internals;
 };
@@ -19,6 +19,7 @@
 #include "PyVTKObject.h"
 #include "PyVTKMethodDescriptor.h"
 #include "vtkABINamespace.h"
+#include "vtkAOSDataArrayTemplate.h"
 #include "vtkDataArray.h"
 #include "vtkObjectBase.h"
 #include "vtkPythonCommand.h"
@@ -404,6 +405,31 @@ static const char* pythonTypeFormat(int t)
   return b;
 }
 
+//------------------------------------------------------------------------------
+// Check whether the values of an array must not be modified through a buffer:
+// the external memory wrapped read-only by an AOS array (which is copied on
+// write by the VTK API), or the values cached for an implicit array.
+template <typename T>
+static bool isReadOnlyBuffer(vtkDataArray* da)
+{
+  vtkAOSDataArrayTemplate<T>* aos = vtkAOSDataArrayTemplate<T>::FastDownCast(da);
+  return aos && aos->GetBuffer()->GetReadOnly();
+}
+
+static bool isReadOnlyArray(vtkDataArray* da)
+{
+  if (da->GetArrayType() == vtkAbstractArray::ImplicitArray)
+  {
+    return true;
+  }
+  bool readOnly = false;
+  switch (da->GetDataType())
+  {
+    vtkTemplateMacro(readOnly = isReadOnlyBuffer<VTK_TT>(da));
+  }
+  return readOnly;
+}
+
 //------------------------------------------------------------------------------
 static int PyVTKObject_AsBuffer_GetBuffer(PyObject* obj, Py_buffer* view, int flags)
 {
@@ -411,6 +437,8 @@ static int PyVTKObject_AsBuffer_GetBuffer(PyObject* obj, Py_buffer* view, int fl
   vtkDataArray* da = vtkDataArray::SafeDownCast(self->vtk_ptr);
   if (da)
   {
+    // a read-only buffer lets numpy share the memory instead of copying it
+    int readOnly = isReadOnlyArray(da);
     void* ptr = da->GetVoidPointer(0);
     Py_ssize_t ntuples = da->GetNumberOfTuples();
     int ncomp = da->GetNumberOfComponents();
@@ -424,7 +452,7 @@ static int PyVTKObject_AsBuffer_GetBuffer(PyObject* obj, Py_buffer* view, int fl
     }
 
     // start by building a basic "unsigned char" buffer
-    if (PyBuffer_FillInfo(view, obj, ptr, size, 0, flags) == -1)
+    if (PyBuffer_FillInfo(view, obj, ptr, size, readOnly, flags) == -1)
     {
       return -1;
     }
@@ -2490,6 +2490,10 @@ structor_declaration:
       {
         currentFunction->IsExcluded = 1;
       }
+      if (getAttributes() & VTK_PARSE_UNBLOCKTHREADS)
+      {
+        currentFunction->IsUnblockable = 1;
+      }
       if (getAttributes() & VTK_PARSE_DEPRECATED)
       {
         currentFunction->IsDeprecated = 1;
@@ -4349,6 +4353,11 @@ static void handle_attribute(const char* att, int pack)
     {
       addAttribute(VTK_PARSE_FILEPATH);
     }
+    else if (l == 19 && strncmp(att, "vtk::unblockthreads", l) == 0 && !args &&
+      role == VTK_PARSE_ATTRIB_DECL)
+    {
+      addAttribute(VTK_PARSE_UNBLOCKTHREADS);
+    }
     else if (l == 15 && strncmp(att, "vtk::deprecated", l) == 0 &&
       (role == VTK_PARSE_ATTRIB_DECL || role == VTK_PARSE_ATTRIB_CLASS ||
         role == VTK_PARSE_ATTRIB_ID))
@@ -4529,6 +4538,13 @@ static void output_function(void)
       currentFunction->IsExcluded = 1;
     }
 
+    if (currentFunction->ReturnValue->Attributes & VTK_PARSE_UNBLOCKTHREADS)
+    {
+      /* remove "unblockthreads" attrib from ReturnValue, attach it to function */
+      currentFunction->ReturnValue->Attributes ^= VTK_PARSE_UNBLOCKTHREADS;
+      currentFunction->IsUnblockable = 1;
+    }
+
     if (currentFunction->ReturnValue->Attributes & VTK_PARSE_DEPRECATED)
     {
       /* remove "deprecated" attrib from ReturnValue, attach it to function */
@@ -141,6 +141,7 @@ void vtkParse_InitFunction(FunctionInfo* func)
   func->IsOverride = 0;
   func->IsExplicit = 0;
   func->IsExcluded = 0;
+  func->IsUnblockable = 0;
   func->IsDeprecated = 0;
 
 #ifndef VTK_PARSE_LEGACY_REMOVE
@@ -230,6 +231,7 @@ void vtkParse_CopyFunction(FunctionInfo* func, const FunctionInfo* orig)
   func->IsExplicit = orig->IsExplicit;
   func->IsLegacy = orig->IsLegacy;
   func->IsExcluded = orig->IsExcluded;
+  func->IsUnblockable = orig->IsUnblockable;
   func->IsDeprecated = orig->IsDeprecated;
 
 #ifndef VTK_PARSE_LEGACY_REMOVE
@@ -174,6 +174,7 @@ struct FunctionInfo_
   int IsVariadic;
   int IsExcluded;    /* marked as excluded from wrapping */
   int IsDeprecated;  /* method or function has been deprecated */
+  int IsUnblockable; /* other threads can run while it executes */
   int IsStatic;      /* methods only */
   int IsVirtual;     /* methods only */
   int IsPureVirtual; /* methods only */
@@ -805,12 +805,31 @@ static void vtkWrapPython_GenerateMethodCall(FILE* fp, FunctionInfo* currentFunc
   ValueInfo* arg;
   int totalArgs;
   int is_constructor;
+  int unblock_threads;
   int i, k, n;
 
   totalArgs = vtkWrap_CountWrappedParameters(currentFunction);
 
   is_constructor = vtkWrap_IsConstructor(data, currentFunction);
 
+  /* release the GIL during the call, unless it must use the Python API */
+  unblock_threads = (currentFunction->IsUnblockable && !is_constructor);
+  for (i = 0; i < totalArgs; i++)
+  {
+    if (vtkWrap_IsFunction(currentFunction->Parameters[i]))
+    {
+      unblock_threads = 0;
+    }
+  }
+
+  if (unblock_threads)
+  {
+    fprintf(fp,
+      "#if defined(VTK_PYTHON_FULL_THREADSAFE) && !defined(VTK_NO_PYTHON_THREADS)\n"
+      "    PyThreadState *_save = PyEval_SaveThread();\n"
+      "#endif\n");
+  }
+
   /* for vtkobjects, do a bound call and an unbound call */
   n = 1;
   if (is_vtkobject && !currentFunction->IsStatic && !currentFunction->IsPureVirtual &&
@@ -961,6 +980,14 @@ static void vtkWrapPython_GenerateMethodCall(FILE* fp, FunctionInfo* currentFunc
     }
   }
 
+  if (unblock_threads)
+  {
+    fprintf(fp,
+      "#if defined(VTK_PYTHON_FULL_THREADSAFE) && !defined(VTK_NO_PYTHON_THREADS)\n"
+      "    PyEval_RestoreThread(_save);\n"
+      "#endif\n");
+  }
+
   if (is_constructor)
   {
     /* initialize tuples created with default constructor */